@@ -385,6 +385,24 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"async\" {
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return AgentParser::make_ASYNC(driver.loc_);
+    default:
+        return AgentParser::make_STRING("async", driver.loc_);
+    }
+}
+
+\"async-queue-size\" {
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return AgentParser::make_ASYNC_QUEUE_SIZE(driver.loc_);
+    default:
+        return AgentParser::make_STRING("async-queue-size", driver.loc_);
+    }
+}
+
 \"debuglevel\" {
     switch(driver.ctx_) {
     case ParserContext::LOGGERS:
@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.4.1.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015, 2018-2019 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,8 +30,9 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
-// Undocumented macros, especially those whose name start with YY_,
-// are private implementation details.  Do not rely on them.
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
 
 
 // Take the name prefix into account.
@@ -47,7 +48,7 @@
 
 #include <agent/parser_context.h>
 
-#line 51 "agent_parser.cc"
+#line 52 "agent_parser.cc"
 
 
 #ifndef YY_
@@ -62,6 +63,7 @@
 # endif
 #endif
 
+
 // Whether we are compiled with exception support.
 #ifndef YY_EXCEPTIONS
 # if defined __GNUC__ && !defined __EXCEPTIONS
@@ -92,9 +94,6 @@
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if AGENT_DEBUG
 
@@ -120,13 +119,13 @@
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !AGENT_DEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE (Symbol)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
 # define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
 # define YY_STACK_PRINT()                static_cast<void> (0)
 
@@ -142,56 +141,15 @@
 
 #line 14 "agent_parser.yy"
 namespace isc { namespace agent {
-#line 146 "agent_parser.cc"
-
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  AgentParser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr;
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              else
-                goto append;
-
-            append:
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 145 "agent_parser.cc"
 
   /// Build a parser object.
   AgentParser::AgentParser (isc::agent::ParserContext& ctx_yyarg)
-    :
 #if AGENT_DEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       ctx (ctx_yyarg)
   {}
@@ -202,9 +160,9 @@ namespace isc { namespace agent {
   AgentParser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
   {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
@@ -234,13 +192,13 @@ namespace isc { namespace agent {
     : state (s)
   {}
 
-  AgentParser::symbol_number_type
-  AgentParser::by_state::type_get () const YY_NOEXCEPT
+  AgentParser::symbol_kind_type
+  AgentParser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
   AgentParser::stack_symbol_type::stack_symbol_type ()
@@ -249,27 +207,27 @@ namespace isc { namespace agent {
   AgentParser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
     : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
   {
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 53: // value
-      case 56: // map_value
-      case 107: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 44: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
         break;
 
-      case 43: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
         break;
 
-      case 42: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 41: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
         break;
 
@@ -286,27 +244,27 @@ namespace isc { namespace agent {
   AgentParser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
     : super_type (s, YY_MOVE (that.location))
   {
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 53: // value
-      case 56: // map_value
-      case 107: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 44: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 43: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 42: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 41: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (YY_MOVE (that.value));
         break;
 
@@ -315,35 +273,71 @@ namespace isc { namespace agent {
     }
 
     // that is emptied.
-    that.type = empty_symbol;
+    that.kind_ = symbol_kind::S_YYEMPTY;
   }
 
 #if YY_CPLUSPLUS < 201103L
+  AgentParser::stack_symbol_type&
+  AgentParser::stack_symbol_type::operator= (const stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
+        value.copy< ElementPtr > (that.value);
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.copy< bool > (that.value);
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.copy< double > (that.value);
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.copy< int64_t > (that.value);
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.copy< std::string > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    return *this;
+  }
+
   AgentParser::stack_symbol_type&
   AgentParser::stack_symbol_type::operator= (stack_symbol_type& that)
   {
     state = that.state;
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 53: // value
-      case 56: // map_value
-      case 107: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 44: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 43: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 42: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 41: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -369,69 +363,67 @@ namespace isc { namespace agent {
 #if AGENT_DEBUG
   template <typename Base>
   void
-  AgentParser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  AgentParser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-#if defined __GNUC__ && ! defined __clang__ && ! defined __ICC && __GNUC__ * 100 + __GNUC_MINOR__ <= 408
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-#endif
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    switch (yytype)
-    {
-      case 41: // "constant string"
-#line 103 "agent_parser.yy"
-        { yyoutput << yysym.value.template as < std::string > (); }
-#line 393 "agent_parser.cc"
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        switch (yykind)
+    {
+      case symbol_kind::S_STRING: // "constant string"
+#line 105 "agent_parser.yy"
+                 { yyoutput << yysym.value.template as < std::string > (); }
+#line 384 "agent_parser.cc"
         break;
 
-      case 42: // "integer"
-#line 103 "agent_parser.yy"
-        { yyoutput << yysym.value.template as < int64_t > (); }
-#line 399 "agent_parser.cc"
+      case symbol_kind::S_INTEGER: // "integer"
+#line 105 "agent_parser.yy"
+                 { yyoutput << yysym.value.template as < int64_t > (); }
+#line 390 "agent_parser.cc"
         break;
 
-      case 43: // "floating point"
-#line 103 "agent_parser.yy"
-        { yyoutput << yysym.value.template as < double > (); }
-#line 405 "agent_parser.cc"
+      case symbol_kind::S_FLOAT: // "floating point"
+#line 105 "agent_parser.yy"
+                 { yyoutput << yysym.value.template as < double > (); }
+#line 396 "agent_parser.cc"
         break;
 
-      case 44: // "boolean"
-#line 103 "agent_parser.yy"
-        { yyoutput << yysym.value.template as < bool > (); }
-#line 411 "agent_parser.cc"
+      case symbol_kind::S_BOOLEAN: // "boolean"
+#line 105 "agent_parser.yy"
+                 { yyoutput << yysym.value.template as < bool > (); }
+#line 402 "agent_parser.cc"
         break;
 
-      case 53: // value
-#line 103 "agent_parser.yy"
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 417 "agent_parser.cc"
+      case symbol_kind::S_value: // value
+#line 105 "agent_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 408 "agent_parser.cc"
         break;
 
-      case 56: // map_value
-#line 103 "agent_parser.yy"
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 423 "agent_parser.cc"
+      case symbol_kind::S_map_value: // map_value
+#line 105 "agent_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 414 "agent_parser.cc"
         break;
 
-      case 107: // socket_type_value
-#line 103 "agent_parser.yy"
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 429 "agent_parser.cc"
+      case symbol_kind::S_socket_type_value: // socket_type_value
+#line 105 "agent_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 420 "agent_parser.cc"
         break;
 
       default:
         break;
     }
-    yyo << ')';
+        yyo << ')';
+      }
   }
 #endif
 
@@ -455,7 +447,7 @@ namespace isc { namespace agent {
   }
 
   void
-  AgentParser::yypop_ (int n)
+  AgentParser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -490,21 +482,21 @@ namespace isc { namespace agent {
   AgentParser::state_type
   AgentParser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
   bool
-  AgentParser::yy_pact_value_is_default_ (int yyvalue)
+  AgentParser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
   bool
-  AgentParser::yy_table_value_is_error_ (int yyvalue)
+  AgentParser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
@@ -518,7 +510,6 @@ namespace isc { namespace agent {
   int
   AgentParser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -554,7 +545,8 @@ namespace isc { namespace agent {
   | yynewstate -- push a new symbol on the stack.  |
   `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << '\n';
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
@@ -568,14 +560,14 @@ namespace isc { namespace agent {
   `-----------*/
   yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
 #if YY_EXCEPTIONS
         try
 #endif // YY_EXCEPTIONS
@@ -594,11 +586,23 @@ namespace isc { namespace agent {
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -615,7 +619,7 @@ namespace isc { namespace agent {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, YY_MOVE (yyla));
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
 
@@ -623,7 +627,7 @@ namespace isc { namespace agent {
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
@@ -642,25 +646,25 @@ namespace isc { namespace agent {
          when using variants.  */
       switch (yyr1_[yyn])
     {
-      case 53: // value
-      case 56: // map_value
-      case 107: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 44: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         yylhs.value.emplace< bool > ();
         break;
 
-      case 43: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         yylhs.value.emplace< double > ();
         break;
 
-      case 42: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         yylhs.value.emplace< int64_t > ();
         break;
 
-      case 41: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         yylhs.value.emplace< std::string > ();
         break;
 
@@ -684,208 +688,208 @@ namespace isc { namespace agent {
         {
           switch (yyn)
             {
-  case 2:
-#line 114 "agent_parser.yy"
-    { ctx.ctx_ = ctx.NO_KEYWORDS; }
-#line 691 "agent_parser.cc"
+  case 2: // $@1: %empty
+#line 116 "agent_parser.yy"
+                       { ctx.ctx_ = ctx.NO_KEYWORDS; }
+#line 695 "agent_parser.cc"
     break;
 
-  case 4:
-#line 115 "agent_parser.yy"
-    { ctx.ctx_ = ctx.CONFIG; }
-#line 697 "agent_parser.cc"
+  case 4: // $@2: %empty
+#line 117 "agent_parser.yy"
+                       { ctx.ctx_ = ctx.CONFIG; }
+#line 701 "agent_parser.cc"
     break;
 
-  case 6:
-#line 116 "agent_parser.yy"
-    { ctx.ctx_ = ctx.AGENT; }
-#line 703 "agent_parser.cc"
+  case 6: // $@3: %empty
+#line 118 "agent_parser.yy"
+                       { ctx.ctx_ = ctx.AGENT; }
+#line 707 "agent_parser.cc"
     break;
 
-  case 8:
-#line 124 "agent_parser.yy"
-    {
+  case 8: // $@4: %empty
+#line 126 "agent_parser.yy"
+                          {
     // Parse the Control-agent map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 713 "agent_parser.cc"
+#line 717 "agent_parser.cc"
     break;
 
-  case 9:
-#line 128 "agent_parser.yy"
-    {
+  case 9: // sub_agent: "{" $@4 global_params "}"
+#line 130 "agent_parser.yy"
+                               {
     // parsing completed
 }
-#line 721 "agent_parser.cc"
+#line 725 "agent_parser.cc"
     break;
 
-  case 10:
-#line 135 "agent_parser.yy"
-    {
+  case 10: // json: value
+#line 137 "agent_parser.yy"
+            {
     // Push back the JSON value on the stack
     ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
 }
-#line 730 "agent_parser.cc"
+#line 734 "agent_parser.cc"
     break;
 
-  case 11:
-#line 141 "agent_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
-#line 736 "agent_parser.cc"
-    break;
-
-  case 12:
-#line 142 "agent_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
-#line 742 "agent_parser.cc"
-    break;
-
-  case 13:
+  case 11: // value: "integer"
 #line 143 "agent_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
-#line 748 "agent_parser.cc"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
+#line 740 "agent_parser.cc"
     break;
 
-  case 14:
+  case 12: // value: "floating point"
 #line 144 "agent_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
-#line 754 "agent_parser.cc"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
+#line 746 "agent_parser.cc"
     break;
 
-  case 15:
+  case 13: // value: "boolean"
 #line 145 "agent_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
-#line 760 "agent_parser.cc"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
+#line 752 "agent_parser.cc"
     break;
 
-  case 16:
+  case 14: // value: "constant string"
 #line 146 "agent_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 766 "agent_parser.cc"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
+#line 758 "agent_parser.cc"
     break;
 
-  case 17:
+  case 15: // value: "null"
 #line 147 "agent_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 772 "agent_parser.cc"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
+#line 764 "agent_parser.cc"
     break;
 
-  case 18:
-#line 151 "agent_parser.yy"
-    {
+  case 16: // value: map
+#line 148 "agent_parser.yy"
+           { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 770 "agent_parser.cc"
+    break;
+
+  case 17: // value: list_generic
+#line 149 "agent_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 776 "agent_parser.cc"
+    break;
+
+  case 18: // $@5: %empty
+#line 153 "agent_parser.yy"
+                    {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 783 "agent_parser.cc"
+#line 787 "agent_parser.cc"
     break;
 
-  case 19:
-#line 156 "agent_parser.yy"
-    {
+  case 19: // map: "{" $@5 map_content "}"
+#line 158 "agent_parser.yy"
+                             {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 793 "agent_parser.cc"
+#line 797 "agent_parser.cc"
     break;
 
-  case 20:
-#line 162 "agent_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 799 "agent_parser.cc"
+  case 20: // map_value: map
+#line 164 "agent_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 803 "agent_parser.cc"
     break;
 
-  case 23:
-#line 176 "agent_parser.yy"
-    {
+  case 23: // not_empty_map: "constant string" ":" value
+#line 178 "agent_parser.yy"
+                                  {
                   // map containing a single entry
                   ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 808 "agent_parser.cc"
+#line 812 "agent_parser.cc"
     break;
 
-  case 24:
-#line 180 "agent_parser.yy"
-    {
+  case 24: // not_empty_map: not_empty_map "," "constant string" ":" value
+#line 182 "agent_parser.yy"
+                                                      {
                   // map consisting of a shorter map followed by
                   // comma and string:value
                   ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 818 "agent_parser.cc"
+#line 822 "agent_parser.cc"
     break;
 
-  case 25:
-#line 187 "agent_parser.yy"
-    {
+  case 25: // $@6: %empty
+#line 189 "agent_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 827 "agent_parser.cc"
+#line 831 "agent_parser.cc"
     break;
 
-  case 26:
-#line 190 "agent_parser.yy"
-    {
+  case 26: // list_generic: "[" $@6 list_content "]"
+#line 192 "agent_parser.yy"
+                               {
 }
-#line 834 "agent_parser.cc"
+#line 838 "agent_parser.cc"
     break;
 
-  case 29:
-#line 197 "agent_parser.yy"
-    {
+  case 29: // not_empty_list: value
+#line 199 "agent_parser.yy"
+                      {
                   // List consisting of a single element.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 843 "agent_parser.cc"
+#line 847 "agent_parser.cc"
     break;
 
-  case 30:
-#line 201 "agent_parser.yy"
-    {
+  case 30: // not_empty_list: not_empty_list "," value
+#line 203 "agent_parser.yy"
+                                           {
                   // List ending with , and a value.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 852 "agent_parser.cc"
+#line 856 "agent_parser.cc"
     break;
 
-  case 31:
-#line 214 "agent_parser.yy"
-    {
+  case 31: // unknown_map_entry: "constant string" ":"
+#line 216 "agent_parser.yy"
+                                {
     const std::string& where = ctx.contextName();
     const std::string& keyword = yystack_[1].value.as < std::string > ();
     error(yystack_[1].location,
           "got unexpected keyword \"" + keyword + "\" in " + where + " map.");
 }
-#line 863 "agent_parser.cc"
+#line 867 "agent_parser.cc"
     break;
 
-  case 32:
-#line 223 "agent_parser.yy"
-    {
+  case 32: // $@7: %empty
+#line 225 "agent_parser.yy"
+                                 {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 874 "agent_parser.cc"
+#line 878 "agent_parser.cc"
     break;
 
-  case 33:
-#line 228 "agent_parser.yy"
-    {
+  case 33: // agent_syntax_map: "{" $@7 global_objects "}"
+#line 230 "agent_parser.yy"
+                                {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 884 "agent_parser.cc"
+#line 888 "agent_parser.cc"
     break;
 
-  case 42:
-#line 249 "agent_parser.yy"
-    {
+  case 42: // $@8: %empty
+#line 251 "agent_parser.yy"
+                            {
 
     // Let's create a MapElement that will represent it, add it to the
     // top level map (that's already on the stack) and put the new map
@@ -896,58 +900,58 @@ namespace isc { namespace agent {
     ctx.stack_.push_back(m);
     ctx.enter(ctx.AGENT);
 }
-#line 900 "agent_parser.cc"
+#line 904 "agent_parser.cc"
     break;
 
-  case 43:
-#line 259 "agent_parser.yy"
-    {
+  case 43: // agent_object: "Control-agent" $@8 ":" "{" global_params "}"
+#line 261 "agent_parser.yy"
+                                                    {
     // Ok, we're done with parsing control-agent. Let's take the map
     // off the stack.
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 911 "agent_parser.cc"
+#line 915 "agent_parser.cc"
     break;
 
-  case 54:
-#line 282 "agent_parser.yy"
-    {
+  case 54: // $@9: %empty
+#line 284 "agent_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 919 "agent_parser.cc"
+#line 923 "agent_parser.cc"
     break;
 
-  case 55:
-#line 284 "agent_parser.yy"
-    {
+  case 55: // http_host: "http-host" $@9 ":" "constant string"
+#line 286 "agent_parser.yy"
+               {
     ElementPtr host(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("http-host", host);
     ctx.leave();
 }
-#line 929 "agent_parser.cc"
+#line 933 "agent_parser.cc"
     break;
 
-  case 56:
-#line 290 "agent_parser.yy"
-    {
+  case 56: // http_port: "http-port" ":" "integer"
+#line 292 "agent_parser.yy"
+                                   {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("http-port", prf);
 }
-#line 938 "agent_parser.cc"
+#line 942 "agent_parser.cc"
     break;
 
-  case 57:
-#line 295 "agent_parser.yy"
-    {
+  case 57: // $@10: %empty
+#line 297 "agent_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 946 "agent_parser.cc"
+#line 950 "agent_parser.cc"
     break;
 
-  case 58:
-#line 297 "agent_parser.yy"
-    {
+  case 58: // user_context: "user-context" $@10 ":" map_value
+#line 299 "agent_parser.yy"
+                  {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context = yystack_[0].value.as < ElementPtr > ();
     ConstElementPtr old = parent->get("user-context");
@@ -969,20 +973,20 @@ namespace isc { namespace agent {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 973 "agent_parser.cc"
+#line 977 "agent_parser.cc"
     break;
 
-  case 59:
-#line 320 "agent_parser.yy"
-    {
+  case 59: // $@11: %empty
+#line 322 "agent_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 981 "agent_parser.cc"
+#line 985 "agent_parser.cc"
     break;
 
-  case 60:
-#line 322 "agent_parser.yy"
-    {
+  case 60: // comment: "comment" $@11 ":" "constant string"
+#line 324 "agent_parser.yy"
+               {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
     ElementPtr comment(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
@@ -1006,442 +1010,472 @@ namespace isc { namespace agent {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 1010 "agent_parser.cc"
+#line 1014 "agent_parser.cc"
     break;
 
-  case 61:
-#line 348 "agent_parser.yy"
-    {
+  case 61: // $@12: %empty
+#line 350 "agent_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 1021 "agent_parser.cc"
+#line 1025 "agent_parser.cc"
     break;
 
-  case 62:
-#line 353 "agent_parser.yy"
-    {
+  case 62: // hooks_libraries: "hooks-libraries" $@12 ":" "[" hooks_libraries_list "]"
+#line 355 "agent_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1030 "agent_parser.cc"
+#line 1034 "agent_parser.cc"
     break;
 
-  case 67:
-#line 366 "agent_parser.yy"
-    {
+  case 67: // $@13: %empty
+#line 368 "agent_parser.yy"
+                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1040 "agent_parser.cc"
+#line 1044 "agent_parser.cc"
     break;
 
-  case 68:
-#line 370 "agent_parser.yy"
-    {
+  case 68: // hooks_library: "{" $@13 hooks_params "}"
+#line 372 "agent_parser.yy"
+                              {
     ctx.stack_.pop_back();
 }
-#line 1048 "agent_parser.cc"
+#line 1052 "agent_parser.cc"
     break;
 
-  case 74:
-#line 383 "agent_parser.yy"
-    {
+  case 74: // $@14: %empty
+#line 385 "agent_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1056 "agent_parser.cc"
+#line 1060 "agent_parser.cc"
     break;
 
-  case 75:
-#line 385 "agent_parser.yy"
-    {
+  case 75: // library: "library" $@14 ":" "constant string"
+#line 387 "agent_parser.yy"
+               {
     ElementPtr lib(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 1066 "agent_parser.cc"
+#line 1070 "agent_parser.cc"
     break;
 
-  case 76:
-#line 391 "agent_parser.yy"
-    {
+  case 76: // $@15: %empty
+#line 393 "agent_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1074 "agent_parser.cc"
+#line 1078 "agent_parser.cc"
     break;
 
-  case 77:
-#line 393 "agent_parser.yy"
-    {
+  case 77: // parameters: "parameters" $@15 ":" value
+#line 395 "agent_parser.yy"
+              {
     ctx.stack_.back()->set("parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1083 "agent_parser.cc"
+#line 1087 "agent_parser.cc"
     break;
 
-  case 78:
-#line 401 "agent_parser.yy"
-    {
+  case 78: // $@16: %empty
+#line 403 "agent_parser.yy"
+                                                      {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[2].location)));
     ctx.stack_.back()->set("control-sockets", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKETS);
 }
-#line 1094 "agent_parser.cc"
+#line 1098 "agent_parser.cc"
     break;
 
-  case 79:
-#line 406 "agent_parser.yy"
-    {
+  case 79: // control_sockets: "control-sockets" ":" "{" $@16 control_sockets_params "}"
+#line 408 "agent_parser.yy"
+                                        {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1103 "agent_parser.cc"
+#line 1107 "agent_parser.cc"
     break;
 
-  case 86:
-#line 427 "agent_parser.yy"
-    {
+  case 86: // $@17: %empty
+#line 429 "agent_parser.yy"
+                                  {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER);
 }
-#line 1114 "agent_parser.cc"
+#line 1118 "agent_parser.cc"
     break;
 
-  case 87:
-#line 432 "agent_parser.yy"
-    {
+  case 87: // dhcp4_server_socket: "dhcp4" $@17 ":" "{" control_socket_params "}"
+#line 434 "agent_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1123 "agent_parser.cc"
+#line 1127 "agent_parser.cc"
     break;
 
-  case 88:
-#line 438 "agent_parser.yy"
-    {
+  case 88: // $@18: %empty
+#line 440 "agent_parser.yy"
+                                  {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp6", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER);
 }
-#line 1134 "agent_parser.cc"
+#line 1138 "agent_parser.cc"
     break;
 
-  case 89:
-#line 443 "agent_parser.yy"
-    {
+  case 89: // dhcp6_server_socket: "dhcp6" $@18 ":" "{" control_socket_params "}"
+#line 445 "agent_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1143 "agent_parser.cc"
+#line 1147 "agent_parser.cc"
     break;
 
-  case 90:
-#line 449 "agent_parser.yy"
-    {
+  case 90: // $@19: %empty
+#line 451 "agent_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("d2", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER);
 }
-#line 1154 "agent_parser.cc"
+#line 1158 "agent_parser.cc"
     break;
 
-  case 91:
-#line 454 "agent_parser.yy"
-    {
+  case 91: // d2_server_socket: "d2" $@19 ":" "{" control_socket_params "}"
+#line 456 "agent_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1163 "agent_parser.cc"
+#line 1167 "agent_parser.cc"
     break;
 
-  case 99:
-#line 473 "agent_parser.yy"
-    {
+  case 99: // $@20: %empty
+#line 475 "agent_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1171 "agent_parser.cc"
+#line 1175 "agent_parser.cc"
     break;
 
-  case 100:
-#line 475 "agent_parser.yy"
-    {
+  case 100: // socket_name: "socket-name" $@20 ":" "constant string"
+#line 477 "agent_parser.yy"
+               {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 1181 "agent_parser.cc"
+#line 1185 "agent_parser.cc"
     break;
 
-  case 101:
-#line 482 "agent_parser.yy"
-    {
+  case 101: // $@21: %empty
+#line 484 "agent_parser.yy"
+                         {
     ctx.enter(ctx.SOCKET_TYPE);
 }
-#line 1189 "agent_parser.cc"
+#line 1193 "agent_parser.cc"
     break;
 
-  case 102:
-#line 484 "agent_parser.yy"
-    {
+  case 102: // socket_type: "socket-type" $@21 ":" socket_type_value
+#line 486 "agent_parser.yy"
+                          {
     ctx.stack_.back()->set("socket-type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1198 "agent_parser.cc"
+#line 1202 "agent_parser.cc"
     break;
 
-  case 103:
-#line 490 "agent_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("unix", ctx.loc2pos(yystack_[0].location))); }
-#line 1204 "agent_parser.cc"
+  case 103: // socket_type_value: "unix"
+#line 492 "agent_parser.yy"
+                         { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("unix", ctx.loc2pos(yystack_[0].location))); }
+#line 1208 "agent_parser.cc"
     break;
 
-  case 104:
-#line 496 "agent_parser.yy"
-    {
+  case 104: // $@22: %empty
+#line 498 "agent_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1212 "agent_parser.cc"
+#line 1216 "agent_parser.cc"
     break;
 
-  case 105:
-#line 498 "agent_parser.yy"
-    {
+  case 105: // dhcp4_json_object: "Dhcp4" $@22 ":" value
+#line 500 "agent_parser.yy"
+              {
     ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1221 "agent_parser.cc"
+#line 1225 "agent_parser.cc"
     break;
 
-  case 106:
-#line 503 "agent_parser.yy"
-    {
+  case 106: // $@23: %empty
+#line 505 "agent_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1229 "agent_parser.cc"
+#line 1233 "agent_parser.cc"
     break;
 
-  case 107:
-#line 505 "agent_parser.yy"
-    {
+  case 107: // dhcp6_json_object: "Dhcp6" $@23 ":" value
+#line 507 "agent_parser.yy"
+              {
     ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1238 "agent_parser.cc"
+#line 1242 "agent_parser.cc"
     break;
 
-  case 108:
-#line 510 "agent_parser.yy"
-    {
+  case 108: // $@24: %empty
+#line 512 "agent_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1246 "agent_parser.cc"
+#line 1250 "agent_parser.cc"
     break;
 
-  case 109:
-#line 512 "agent_parser.yy"
-    {
+  case 109: // dhcpddns_json_object: "DhcpDdns" $@24 ":" value
+#line 514 "agent_parser.yy"
+              {
     ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1255 "agent_parser.cc"
+#line 1259 "agent_parser.cc"
     break;
 
-  case 110:
-#line 522 "agent_parser.yy"
-    {
+  case 110: // $@25: %empty
+#line 524 "agent_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 1266 "agent_parser.cc"
+#line 1270 "agent_parser.cc"
     break;
 
-  case 111:
-#line 527 "agent_parser.yy"
-    {
+  case 111: // logging_object: "Logging" $@25 ":" "{" logging_params "}"
+#line 529 "agent_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1275 "agent_parser.cc"
+#line 1279 "agent_parser.cc"
     break;
 
-  case 115:
-#line 544 "agent_parser.yy"
-    {
+  case 115: // $@26: %empty
+#line 546 "agent_parser.yy"
+                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 1286 "agent_parser.cc"
+#line 1290 "agent_parser.cc"
     break;
 
-  case 116:
-#line 549 "agent_parser.yy"
-    {
+  case 116: // loggers: "loggers" $@26 ":" "[" loggers_entries "]"
+#line 551 "agent_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1295 "agent_parser.cc"
+#line 1299 "agent_parser.cc"
     break;
 
-  case 119:
-#line 561 "agent_parser.yy"
-    {
+  case 119: // $@27: %empty
+#line 563 "agent_parser.yy"
+                             {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 1305 "agent_parser.cc"
+#line 1309 "agent_parser.cc"
     break;
 
-  case 120:
-#line 565 "agent_parser.yy"
-    {
+  case 120: // logger_entry: "{" $@27 logger_params "}"
+#line 567 "agent_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 1313 "agent_parser.cc"
+#line 1317 "agent_parser.cc"
     break;
 
-  case 130:
-#line 582 "agent_parser.yy"
-    {
+  case 130: // $@28: %empty
+#line 584 "agent_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1321 "agent_parser.cc"
+#line 1325 "agent_parser.cc"
     break;
 
-  case 131:
-#line 584 "agent_parser.yy"
-    {
+  case 131: // name: "name" $@28 ":" "constant string"
+#line 586 "agent_parser.yy"
+               {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1331 "agent_parser.cc"
+#line 1335 "agent_parser.cc"
     break;
 
-  case 132:
-#line 590 "agent_parser.yy"
-    {
+  case 132: // debuglevel: "debuglevel" ":" "integer"
+#line 592 "agent_parser.yy"
+                                     {
     ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 1340 "agent_parser.cc"
+#line 1344 "agent_parser.cc"
     break;
 
-  case 133:
-#line 595 "agent_parser.yy"
-    {
+  case 133: // $@29: %empty
+#line 597 "agent_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1348 "agent_parser.cc"
+#line 1352 "agent_parser.cc"
     break;
 
-  case 134:
-#line 597 "agent_parser.yy"
-    {
+  case 134: // severity: "severity" $@29 ":" "constant string"
+#line 599 "agent_parser.yy"
+               {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 1358 "agent_parser.cc"
+#line 1362 "agent_parser.cc"
     break;
 
-  case 135:
-#line 603 "agent_parser.yy"
-    {
+  case 135: // $@30: %empty
+#line 605 "agent_parser.yy"
+                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 1369 "agent_parser.cc"
+#line 1373 "agent_parser.cc"
     break;
 
-  case 136:
-#line 608 "agent_parser.yy"
-    {
+  case 136: // output_options_list: "output_options" $@30 ":" "[" output_options_list_content "]"
+#line 610 "agent_parser.yy"
+                                                                    {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1378 "agent_parser.cc"
+#line 1382 "agent_parser.cc"
     break;
 
-  case 139:
-#line 617 "agent_parser.yy"
-    {
+  case 139: // $@31: %empty
+#line 619 "agent_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1388 "agent_parser.cc"
+#line 1392 "agent_parser.cc"
     break;
 
-  case 140:
-#line 621 "agent_parser.yy"
-    {
+  case 140: // output_entry: "{" $@31 output_params_list "}"
+#line 623 "agent_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 1396 "agent_parser.cc"
+#line 1400 "agent_parser.cc"
     break;
 
-  case 147:
-#line 635 "agent_parser.yy"
-    {
+  case 149: // $@32: %empty
+#line 639 "agent_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1404 "agent_parser.cc"
+#line 1408 "agent_parser.cc"
     break;
 
-  case 148:
-#line 637 "agent_parser.yy"
-    {
+  case 150: // output: "output" $@32 ":" "constant string"
+#line 641 "agent_parser.yy"
+               {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 1414 "agent_parser.cc"
+#line 1418 "agent_parser.cc"
     break;
 
-  case 149:
-#line 643 "agent_parser.yy"
-    {
+  case 151: // flush: "flush" ":" "boolean"
+#line 647 "agent_parser.yy"
+                           {
     ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 1423 "agent_parser.cc"
+#line 1427 "agent_parser.cc"
     break;
 
-  case 150:
-#line 648 "agent_parser.yy"
-    {
+  case 152: // maxsize: "maxsize" ":" "integer"
+#line 652 "agent_parser.yy"
+                               {
     ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 1432 "agent_parser.cc"
+#line 1436 "agent_parser.cc"
     break;
 
-  case 151:
-#line 653 "agent_parser.yy"
-    {
+  case 153: // maxver: "maxver" ":" "integer"
+#line 657 "agent_parser.yy"
+                             {
     ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 1441 "agent_parser.cc"
+#line 1445 "agent_parser.cc"
     break;
 
+  case 154: // $@33: %empty
+#line 662 "agent_parser.yy"
+             {
+    ctx.enter(ctx.NO_KEYWORDS);
+}
+#line 1453 "agent_parser.cc"
+    break;
+
+  case 155: // async: "async" $@33 ":" "constant string"
+#line 664 "agent_parser.yy"
+               {
+    ElementPtr async(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async", async);
+    ctx.leave();
+}
+#line 1463 "agent_parser.cc"
+    break;
+
+  case 156: // async_queue_size: "async-queue-size" ":" "integer"
+#line 670 "agent_parser.yy"
+                                                 {
+    if (yystack_[0].value.as < int64_t > () <= 0) {
+        error(yystack_[0].location, "async-queue-size must be greater than zero");
+    }
+    ElementPtr size(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async-queue-size", size);
+}
+#line 1475 "agent_parser.cc"
+    break;
 
-#line 1445 "agent_parser.cc"
+
+#line 1479 "agent_parser.cc"
 
             default:
               break;
@@ -1458,7 +1492,6 @@ namespace isc { namespace agent {
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
       yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
@@ -1474,7 +1507,9 @@ namespace isc { namespace agent {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -1485,7 +1520,7 @@ namespace isc { namespace agent {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -1511,6 +1546,7 @@ namespace isc { namespace agent {
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
 
@@ -1519,37 +1555,39 @@ namespace isc { namespace agent {
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
+      error_token.state = state_type (yyn);
       yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
@@ -1581,6 +1619,7 @@ namespace isc { namespace agent {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -1614,18 +1653,103 @@ namespace isc { namespace agent {
     error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  AgentParser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  AgentParser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
+
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
+
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  AgentParser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
+
+
+  // AgentParser::context.
+  AgentParser::context::context (const AgentParser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  AgentParser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
 
+
+
+  int
+  AgentParser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -1644,41 +1768,32 @@ namespace isc { namespace agent {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  AgentParser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -1699,11 +1814,11 @@ namespace isc { namespace agent {
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -1712,39 +1827,40 @@ namespace isc { namespace agent {
   }
 
 
-  const short AgentParser::yypact_ninf_ = -133;
+  const signed char AgentParser::yypact_ninf_ = -122;
 
   const signed char AgentParser::yytable_ninf_ = -1;
 
   const short
   AgentParser::yypact_[] =
   {
-      71,  -133,  -133,  -133,     7,     3,     2,     4,  -133,  -133,
-    -133,  -133,  -133,  -133,  -133,  -133,  -133,  -133,  -133,  -133,
-    -133,  -133,  -133,  -133,     3,   -28,    -8,     9,  -133,    20,
-      29,    54,    49,    76,  -133,  -133,  -133,  -133,  -133,    95,
-    -133,    22,  -133,  -133,  -133,  -133,  -133,  -133,  -133,   101,
-    -133,  -133,   103,  -133,  -133,  -133,    69,  -133,  -133,  -133,
-    -133,  -133,  -133,  -133,  -133,  -133,     3,     3,  -133,    63,
-     104,   108,   109,   110,   111,  -133,    -8,  -133,   112,    75,
-     114,   115,   113,   118,   120,     9,  -133,  -133,  -133,   121,
-     122,   123,     3,     3,     3,  -133,    91,  -133,   124,    96,
-    -133,   128,   129,  -133,     3,     9,   116,  -133,  -133,  -133,
-    -133,  -133,  -133,  -133,    -2,   131,   132,  -133,    70,    78,
-    -133,  -133,  -133,  -133,  -133,  -133,    82,  -133,  -133,  -133,
-    -133,  -133,   130,   137,  -133,  -133,    53,  -133,  -133,   116,
-    -133,   139,   140,   141,    -2,  -133,    -5,  -133,   131,    24,
-     132,  -133,  -133,   134,   142,   143,  -133,  -133,  -133,  -133,
-      84,  -133,  -133,  -133,  -133,  -133,  -133,   144,  -133,  -133,
-    -133,  -133,    86,  -133,  -133,  -133,  -133,  -133,  -133,    47,
-      47,    47,   147,   148,    17,  -133,   149,   150,   105,   151,
-      24,  -133,  -133,  -133,  -133,  -133,  -133,    90,  -133,  -133,
-    -133,    92,    93,   117,     3,  -133,   119,   152,  -133,   125,
-    -133,   155,   157,    47,  -133,  -133,  -133,  -133,  -133,  -133,
-     156,  -133,   133,   135,  -133,  -133,   100,  -133,  -133,  -133,
-    -133,    42,   156,  -133,  -133,   158,   160,   161,    94,  -133,
-    -133,  -133,  -133,  -133,  -133,   166,   102,   136,   145,    42,
-    -133,   138,  -133,  -133,  -133,  -133,  -133
+      71,  -122,  -122,  -122,     8,     2,     3,    12,  -122,  -122,
+    -122,  -122,  -122,  -122,  -122,  -122,  -122,  -122,  -122,  -122,
+    -122,  -122,  -122,  -122,     2,   -16,    -9,    11,  -122,    35,
+      64,    75,    69,    83,  -122,  -122,  -122,  -122,  -122,    84,
+    -122,    28,  -122,  -122,  -122,  -122,  -122,  -122,  -122,   104,
+    -122,  -122,   106,  -122,  -122,  -122,    47,  -122,  -122,  -122,
+    -122,  -122,  -122,  -122,  -122,  -122,     2,     2,  -122,    72,
+     110,   112,   113,   114,   115,  -122,    -9,  -122,   116,    57,
+     118,   120,   100,   121,   125,    11,  -122,  -122,  -122,   126,
+     124,   127,     2,     2,     2,  -122,    89,  -122,   128,    90,
+    -122,   131,   132,  -122,     2,    11,   117,  -122,  -122,  -122,
+    -122,  -122,  -122,  -122,    22,   133,   134,  -122,    48,    58,
+    -122,  -122,  -122,  -122,  -122,  -122,    70,  -122,  -122,  -122,
+    -122,  -122,   136,   135,  -122,  -122,    46,  -122,  -122,   117,
+    -122,   140,   141,   142,    22,  -122,   -11,  -122,   133,    44,
+     134,  -122,  -122,   143,   144,   145,  -122,  -122,  -122,  -122,
+      73,  -122,  -122,  -122,  -122,  -122,  -122,   149,  -122,  -122,
+    -122,  -122,    82,  -122,  -122,  -122,  -122,  -122,  -122,     1,
+       1,     1,   150,   151,    -6,  -122,   152,   153,   105,   154,
+      44,  -122,  -122,  -122,  -122,  -122,  -122,    94,  -122,  -122,
+    -122,    95,    96,   119,     2,  -122,   122,   155,  -122,   123,
+    -122,   157,   159,     1,  -122,  -122,  -122,  -122,  -122,  -122,
+     163,  -122,   129,   138,  -122,  -122,   103,  -122,  -122,  -122,
+    -122,    60,   163,  -122,  -122,   160,   167,   169,  -122,   170,
+      97,  -122,  -122,  -122,  -122,  -122,  -122,  -122,  -122,   171,
+      93,   137,   139,   172,   146,    60,  -122,   148,  -122,  -122,
+    -122,   156,  -122,  -122,  -122,  -122
   };
 
   const unsigned char
@@ -1773,30 +1889,31 @@ namespace isc { namespace agent {
       95,     0,     0,     0,     0,    70,     0,     0,   132,     0,
      122,     0,     0,     0,    87,    89,    91,    75,    77,   131,
        0,   134,     0,     0,    93,   139,     0,   137,   100,   103,
-     102,     0,     0,   136,   147,     0,     0,     0,     0,   141,
-     143,   144,   145,   146,   138,     0,     0,     0,     0,     0,
-     140,     0,   149,   150,   151,   142,   148
+     102,     0,     0,   136,   149,     0,     0,     0,   154,     0,
+       0,   141,   143,   144,   145,   146,   147,   148,   138,     0,
+       0,     0,     0,     0,     0,     0,   140,     0,   151,   152,
+     153,     0,   156,   142,   150,   155
   };
 
-  const short
+  const signed char
   AgentParser::yypgoto_[] =
   {
-    -133,  -133,  -133,  -133,  -133,  -133,  -133,  -133,   -24,    37,
-    -133,  -133,  -133,  -133,  -133,  -133,  -133,  -133,   -23,  -133,
-    -133,  -133,    97,  -133,  -133,    66,    87,  -133,  -133,  -133,
-     -22,  -133,   -21,  -133,  -133,  -133,  -133,  -133,    27,  -133,
-    -133,    -7,  -133,  -133,  -133,  -133,  -133,  -133,  -133,    32,
-    -133,  -133,  -133,  -133,  -133,  -133,  -132,   -32,  -133,  -133,
-    -133,  -133,  -133,  -133,  -133,  -133,  -133,  -133,  -133,  -133,
-    -133,  -133,    43,  -105,  -133,  -133,    33,  -133,  -133,    -6,
-    -133,  -133,  -133,  -133,  -133,  -133,  -133,  -133,   -47,  -133,
-    -133,   -63,  -133,  -133,  -133,  -133,  -133
+    -122,  -122,  -122,  -122,  -122,  -122,  -122,  -122,   -24,    49,
+    -122,  -122,  -122,  -122,  -122,  -122,  -122,  -122,   -23,  -122,
+    -122,  -122,   101,  -122,  -122,    43,    99,  -122,  -122,  -122,
+     -22,  -122,   -21,  -122,  -122,  -122,  -122,  -122,    30,  -122,
+    -122,    -5,  -122,  -122,  -122,  -122,  -122,  -122,  -122,    38,
+    -122,  -122,  -122,  -122,  -122,  -122,  -121,   -28,  -122,  -122,
+    -122,  -122,  -122,  -122,  -122,  -122,  -122,  -122,  -122,  -122,
+    -122,  -122,    50,  -104,  -122,  -122,    36,  -122,  -122,    -3,
+    -122,  -122,  -122,  -122,  -122,  -122,  -122,  -122,   -44,  -122,
+    -122,   -63,  -122,  -122,  -122,  -122,  -122,  -122,  -122,  -122
   };
 
-  const short
+  const unsigned char
   AgentParser::yydefgoto_[] =
   {
-      -1,     4,     5,     6,     7,    23,    27,    16,    17,    18,
+       0,     4,     5,     6,     7,    23,    27,    16,    17,    18,
       25,   112,    32,    33,    19,    24,    29,    30,   194,    21,
       26,    41,    42,    43,    70,    56,    57,    58,    78,    59,
      195,    80,   196,    81,    62,    83,   132,   133,   134,   146,
@@ -1805,110 +1922,113 @@ namespace isc { namespace agent {
      200,   212,   230,    44,    72,    45,    73,    46,    74,    47,
       71,   119,   120,    64,    84,   136,   137,   149,   172,   173,
      174,   186,   175,   176,   189,   177,   187,   226,   227,   231,
-     238,   239,   240,   245,   241,   242,   243
+     240,   241,   242,   249,   243,   244,   245,   246,   253,   247
   };
 
-  const unsigned short
+  const short
   AgentParser::yytable_[] =
   {
-      28,   121,    34,    40,    55,    60,    61,     8,     9,    20,
-      10,    22,    11,    31,   122,   123,   124,    35,   157,   158,
-      48,    49,    50,    51,    52,    76,    65,    36,    37,    38,
-      77,    53,    66,    39,   121,    54,    39,    50,    51,    39,
-     157,   158,    87,    88,    12,    13,    14,    15,   201,   202,
-      39,   165,   166,    40,   167,   168,   150,    68,    67,   151,
-      50,    51,    55,    60,    61,    39,   192,   193,   107,   108,
-     109,   234,    85,    85,   235,   236,   237,    86,   138,    69,
-     117,   139,    55,    60,    61,   144,   140,   184,    39,   190,
-     145,   125,   185,   213,   191,   213,   213,   249,   214,    75,
-     215,   216,   250,   232,    89,    79,   233,    82,    90,     1,
-       2,     3,    91,    92,    93,    94,    96,    97,    98,    99,
-     100,   125,   101,   159,   102,   104,   169,   170,   171,   105,
-     106,    10,   110,   115,   116,   111,   147,   113,   131,   135,
-     148,   179,    54,   153,   154,   155,   252,   208,   188,   180,
-     181,   203,   204,   206,   207,   209,   229,   220,   217,   222,
-     219,   223,   246,   225,   247,   248,   221,   169,   170,   171,
-     251,   118,   103,    95,   228,   164,   156,   205,   253,   256,
-     218,   224,   152,   178,   210,   244,   255,   254
+      28,    34,   121,    40,    55,    60,    61,     9,     8,    10,
+      20,    11,   157,   158,    50,    51,    35,   157,   158,    22,
+     192,   193,    48,    49,    50,    51,    52,    31,    36,    37,
+      38,    76,    39,    53,    39,   121,    77,    54,   122,   123,
+     124,    65,    87,    88,    39,    12,    13,    14,    15,   150,
+      85,    85,   151,    40,    39,    86,   138,    50,    51,   201,
+     202,   139,    55,    60,    61,    39,   140,    66,   107,   108,
+     109,   165,   166,   144,   167,   168,   184,    68,   145,    67,
+     117,   185,    55,    60,    61,   190,    69,    39,    75,   234,
+     191,   125,   235,   236,   237,   238,   239,   213,   213,   213,
+     255,    97,   214,   215,   216,   256,   232,   100,    79,   233,
+      82,     1,     2,     3,    90,    89,    91,    92,    93,    94,
+      96,   125,    98,   159,    99,   101,   169,   170,   171,   102,
+     104,   105,   110,   113,   106,    10,   115,   116,   148,   258,
+     131,   135,   147,    54,   153,   154,   155,   111,   118,   208,
+     179,   180,   181,   188,   203,   204,   206,   207,   209,   229,
+     220,   222,   217,   223,   250,   219,   221,   169,   170,   171,
+     225,   251,   228,   252,   254,   257,   261,    95,   164,   205,
+     218,   259,   156,   260,   103,   224,   178,   210,   248,   152,
+     262,   264,   263,     0,     0,     0,     0,     0,     0,   265
   };
 
-  const unsigned char
+  const short
   AgentParser::yycheck_[] =
   {
-      24,   106,    10,    26,    27,    27,    27,     0,     5,     7,
-       7,     7,     9,    41,    16,    17,    18,    25,    23,    24,
-      11,    12,    13,    14,    15,     3,     6,    35,    36,    37,
-       8,    22,     3,    41,   139,    26,    41,    13,    14,    41,
-      23,    24,    66,    67,    41,    42,    43,    44,   180,   181,
-      41,    27,    28,    76,    30,    31,     3,     8,     4,     6,
-      13,    14,    85,    85,    85,    41,    19,    20,    92,    93,
-      94,    29,     3,     3,    32,    33,    34,     8,     8,     3,
-     104,     3,   105,   105,   105,     3,     8,     3,    41,     3,
-       8,   114,     8,     3,     8,     3,     3,     3,     8,     4,
-       8,     8,     8,     3,    41,     4,     6,     4,     4,    38,
-      39,    40,     4,     4,     4,     4,     4,    42,     4,     4,
-       7,   144,     4,   146,     4,     4,   149,   149,   149,     7,
-       7,     7,    41,     5,     5,    98,     6,    41,     7,     7,
-       3,     7,    26,     4,     4,     4,    44,    42,     4,     7,
-       7,     4,     4,     4,     4,     4,    21,     5,    41,     4,
-      41,     4,     4,     7,     4,     4,    41,   190,   190,   190,
-       4,   105,    85,    76,    41,   148,   144,   184,    42,    41,
-     204,   213,   139,   150,   190,   232,   249,    42
+      24,    10,   106,    26,    27,    27,    27,     5,     0,     7,
+       7,     9,    23,    24,    13,    14,    25,    23,    24,     7,
+      19,    20,    11,    12,    13,    14,    15,    43,    37,    38,
+      39,     3,    43,    22,    43,   139,     8,    26,    16,    17,
+      18,     6,    66,    67,    43,    43,    44,    45,    46,     3,
+       3,     3,     6,    76,    43,     8,     8,    13,    14,   180,
+     181,     3,    85,    85,    85,    43,     8,     3,    92,    93,
+      94,    27,    28,     3,    30,    31,     3,     8,     8,     4,
+     104,     8,   105,   105,   105,     3,     3,    43,     4,    29,
+       8,   114,    32,    33,    34,    35,    36,     3,     3,     3,
+       3,    44,     8,     8,     8,     8,     3,     7,     4,     6,
+       4,    40,    41,    42,     4,    43,     4,     4,     4,     4,
+       4,   144,     4,   146,     4,     4,   149,   149,   149,     4,
+       4,     7,    43,    43,     7,     7,     5,     5,     3,    46,
+       7,     7,     6,    26,     4,     4,     4,    98,   105,    44,
+       7,     7,     7,     4,     4,     4,     4,     4,     4,    21,
+       5,     4,    43,     4,     4,    43,    43,   190,   190,   190,
+       7,     4,    43,     4,     4,     4,     4,    76,   148,   184,
+     204,    44,   144,    44,    85,   213,   150,   190,   232,   139,
+      44,    43,   255,    -1,    -1,    -1,    -1,    -1,    -1,    43
   };
 
   const unsigned char
   AgentParser::yystos_[] =
   {
-       0,    38,    39,    40,    46,    47,    48,    49,     0,     5,
-       7,     9,    41,    42,    43,    44,    52,    53,    54,    59,
-       7,    64,     7,    50,    60,    55,    65,    51,    53,    61,
-      62,    41,    57,    58,    10,    25,    35,    36,    37,    41,
-      63,    66,    67,    68,   108,   110,   112,   114,    11,    12,
-      13,    14,    15,    22,    26,    63,    70,    71,    72,    74,
-      75,    77,    79,    91,   118,     6,     3,     4,     8,     3,
-      69,   115,   109,   111,   113,     4,     3,     8,    73,     4,
-      76,    78,     4,    80,   119,     3,     8,    53,    53,    41,
-       4,     4,     4,     4,     4,    67,     4,    42,     4,     4,
-       7,     4,     4,    71,     4,     7,     7,    53,    53,    53,
-      41,    54,    56,    41,    92,     5,     5,    53,    70,   116,
-     117,   118,    16,    17,    18,    63,    93,    94,    95,    97,
-      99,     7,    81,    82,    83,     7,   120,   121,     8,     3,
-       8,    96,    98,   100,     3,     8,    84,     6,     3,   122,
-       3,     6,   117,     4,     4,     4,    94,    23,    24,    63,
-      85,    86,    87,    89,    83,    27,    28,    30,    31,    63,
-      75,    77,   123,   124,   125,   127,   128,   130,   121,     7,
-       7,     7,    88,    90,     3,     8,   126,   131,     4,   129,
-       3,     8,    19,    20,    63,    75,    77,   101,   102,   103,
-     105,   101,   101,     4,     4,    86,     4,     4,    42,     4,
-     124,   104,   106,     3,     8,     8,     8,    41,    53,    41,
-       5,    41,     4,     4,   102,     7,   132,   133,    41,    21,
-     107,   134,     3,     6,    29,    32,    33,    34,   135,   136,
-     137,   139,   140,   141,   133,   138,     4,     4,     4,     3,
-       8,     4,    44,    42,    42,   136,    41
+       0,    40,    41,    42,    48,    49,    50,    51,     0,     5,
+       7,     9,    43,    44,    45,    46,    54,    55,    56,    61,
+       7,    66,     7,    52,    62,    57,    67,    53,    55,    63,
+      64,    43,    59,    60,    10,    25,    37,    38,    39,    43,
+      65,    68,    69,    70,   110,   112,   114,   116,    11,    12,
+      13,    14,    15,    22,    26,    65,    72,    73,    74,    76,
+      77,    79,    81,    93,   120,     6,     3,     4,     8,     3,
+      71,   117,   111,   113,   115,     4,     3,     8,    75,     4,
+      78,    80,     4,    82,   121,     3,     8,    55,    55,    43,
+       4,     4,     4,     4,     4,    69,     4,    44,     4,     4,
+       7,     4,     4,    73,     4,     7,     7,    55,    55,    55,
+      43,    56,    58,    43,    94,     5,     5,    55,    72,   118,
+     119,   120,    16,    17,    18,    65,    95,    96,    97,    99,
+     101,     7,    83,    84,    85,     7,   122,   123,     8,     3,
+       8,    98,   100,   102,     3,     8,    86,     6,     3,   124,
+       3,     6,   119,     4,     4,     4,    96,    23,    24,    65,
+      87,    88,    89,    91,    85,    27,    28,    30,    31,    65,
+      77,    79,   125,   126,   127,   129,   130,   132,   123,     7,
+       7,     7,    90,    92,     3,     8,   128,   133,     4,   131,
+       3,     8,    19,    20,    65,    77,    79,   103,   104,   105,
+     107,   103,   103,     4,     4,    88,     4,     4,    44,     4,
+     126,   106,   108,     3,     8,     8,     8,    43,    55,    43,
+       5,    43,     4,     4,   104,     7,   134,   135,    43,    21,
+     109,   136,     3,     6,    29,    32,    33,    34,    35,    36,
+     137,   138,   139,   141,   142,   143,   144,   146,   135,   140,
+       4,     4,     4,   145,     4,     3,     8,     4,    46,    44,
+      44,     4,    44,   138,    43,    43
   };
 
   const unsigned char
   AgentParser::yyr1_[] =
   {
-       0,    45,    47,    46,    48,    46,    49,    46,    51,    50,
-      52,    53,    53,    53,    53,    53,    53,    53,    55,    54,
-      56,    57,    57,    58,    58,    60,    59,    61,    61,    62,
-      62,    63,    65,    64,    66,    66,    67,    67,    67,    67,
-      67,    67,    69,    68,    70,    70,    71,    71,    71,    71,
-      71,    71,    71,    71,    73,    72,    74,    76,    75,    78,
-      77,    80,    79,    81,    81,    82,    82,    84,    83,    85,
-      85,    85,    86,    86,    88,    87,    90,    89,    92,    91,
-      93,    93,    94,    94,    94,    94,    96,    95,    98,    97,
-     100,    99,   101,   101,   102,   102,   102,   102,   102,   104,
-     103,   106,   105,   107,   109,   108,   111,   110,   113,   112,
-     115,   114,   116,   116,   117,   119,   118,   120,   120,   122,
-     121,   123,   123,   124,   124,   124,   124,   124,   124,   124,
-     126,   125,   127,   129,   128,   131,   130,   132,   132,   134,
-     133,   135,   135,   136,   136,   136,   136,   138,   137,   139,
-     140,   141
+       0,    47,    49,    48,    50,    48,    51,    48,    53,    52,
+      54,    55,    55,    55,    55,    55,    55,    55,    57,    56,
+      58,    59,    59,    60,    60,    62,    61,    63,    63,    64,
+      64,    65,    67,    66,    68,    68,    69,    69,    69,    69,
+      69,    69,    71,    70,    72,    72,    73,    73,    73,    73,
+      73,    73,    73,    73,    75,    74,    76,    78,    77,    80,
+      79,    82,    81,    83,    83,    84,    84,    86,    85,    87,
+      87,    87,    88,    88,    90,    89,    92,    91,    94,    93,
+      95,    95,    96,    96,    96,    96,    98,    97,   100,    99,
+     102,   101,   103,   103,   104,   104,   104,   104,   104,   106,
+     105,   108,   107,   109,   111,   110,   113,   112,   115,   114,
+     117,   116,   118,   118,   119,   121,   120,   122,   122,   124,
+     123,   125,   125,   126,   126,   126,   126,   126,   126,   126,
+     128,   127,   129,   131,   130,   133,   132,   134,   134,   136,
+     135,   137,   137,   138,   138,   138,   138,   138,   138,   140,
+     139,   141,   142,   143,   145,   144,   146
   };
 
-  const unsigned char
+  const signed char
   AgentParser::yyr2_[] =
   {
        0,     2,     0,     3,     0,     3,     0,     3,     0,     4,
@@ -1925,90 +2045,91 @@ namespace isc { namespace agent {
        0,     6,     1,     3,     1,     0,     6,     1,     3,     0,
        4,     1,     3,     1,     1,     1,     1,     1,     1,     1,
        0,     4,     3,     0,     4,     0,     6,     1,     3,     0,
-       4,     1,     3,     1,     1,     1,     1,     0,     4,     3,
-       3,     3
+       4,     1,     3,     1,     1,     1,     1,     1,     1,     0,
+       4,     3,     3,     3,     0,     4,     3
   };
 
 
-
+#if AGENT_DEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const AgentParser::yytname_[] =
   {
-  "\"end of file\"", "error", "$undefined", "\",\"", "\":\"", "\"[\"",
-  "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Control-agent\"",
+  "\"end of file\"", "error", "\"invalid token\"", "\",\"", "\":\"",
+  "\"[\"", "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Control-agent\"",
   "\"http-host\"", "\"http-port\"", "\"user-context\"", "\"comment\"",
   "\"control-sockets\"", "\"dhcp4\"", "\"dhcp6\"", "\"d2\"",
   "\"socket-name\"", "\"socket-type\"", "\"unix\"", "\"hooks-libraries\"",
   "\"library\"", "\"parameters\"", "\"Logging\"", "\"loggers\"",
   "\"name\"", "\"output_options\"", "\"output\"", "\"debuglevel\"",
-  "\"severity\"", "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"Dhcp4\"",
-  "\"Dhcp6\"", "\"DhcpDdns\"", "START_JSON", "START_AGENT",
-  "START_SUB_AGENT", "\"constant string\"", "\"integer\"",
-  "\"floating point\"", "\"boolean\"", "$accept", "start", "$@1", "$@2",
-  "$@3", "sub_agent", "$@4", "json", "value", "map", "$@5", "map_value",
-  "map_content", "not_empty_map", "list_generic", "$@6", "list_content",
-  "not_empty_list", "unknown_map_entry", "agent_syntax_map", "$@7",
-  "global_objects", "global_object", "agent_object", "$@8",
-  "global_params", "global_param", "http_host", "$@9", "http_port",
-  "user_context", "$@10", "comment", "$@11", "hooks_libraries", "$@12",
-  "hooks_libraries_list", "not_empty_hooks_libraries_list",
-  "hooks_library", "$@13", "hooks_params", "hooks_param", "library",
-  "$@14", "parameters", "$@15", "control_sockets", "$@16",
-  "control_sockets_params", "control_socket", "dhcp4_server_socket",
-  "$@17", "dhcp6_server_socket", "$@18", "d2_server_socket", "$@19",
-  "control_socket_params", "control_socket_param", "socket_name", "$@20",
-  "socket_type", "$@21", "socket_type_value", "dhcp4_json_object", "$@22",
-  "dhcp6_json_object", "$@23", "dhcpddns_json_object", "$@24",
-  "logging_object", "$@25", "logging_params", "logging_param", "loggers",
-  "$@26", "loggers_entries", "logger_entry", "$@27", "logger_params",
-  "logger_param", "name", "$@28", "debuglevel", "severity", "$@29",
-  "output_options_list", "$@30", "output_options_list_content",
-  "output_entry", "$@31", "output_params_list", "output_params", "output",
-  "$@32", "flush", "maxsize", "maxver", YY_NULLPTR
+  "\"severity\"", "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"async\"",
+  "\"async-queue-size\"", "\"Dhcp4\"", "\"Dhcp6\"", "\"DhcpDdns\"",
+  "START_JSON", "START_AGENT", "START_SUB_AGENT", "\"constant string\"",
+  "\"integer\"", "\"floating point\"", "\"boolean\"", "$accept", "start",
+  "$@1", "$@2", "$@3", "sub_agent", "$@4", "json", "value", "map", "$@5",
+  "map_value", "map_content", "not_empty_map", "list_generic", "$@6",
+  "list_content", "not_empty_list", "unknown_map_entry",
+  "agent_syntax_map", "$@7", "global_objects", "global_object",
+  "agent_object", "$@8", "global_params", "global_param", "http_host",
+  "$@9", "http_port", "user_context", "$@10", "comment", "$@11",
+  "hooks_libraries", "$@12", "hooks_libraries_list",
+  "not_empty_hooks_libraries_list", "hooks_library", "$@13",
+  "hooks_params", "hooks_param", "library", "$@14", "parameters", "$@15",
+  "control_sockets", "$@16", "control_sockets_params", "control_socket",
+  "dhcp4_server_socket", "$@17", "dhcp6_server_socket", "$@18",
+  "d2_server_socket", "$@19", "control_socket_params",
+  "control_socket_param", "socket_name", "$@20", "socket_type", "$@21",
+  "socket_type_value", "dhcp4_json_object", "$@22", "dhcp6_json_object",
+  "$@23", "dhcpddns_json_object", "$@24", "logging_object", "$@25",
+  "logging_params", "logging_param", "loggers", "$@26", "loggers_entries",
+  "logger_entry", "$@27", "logger_params", "logger_param", "name", "$@28",
+  "debuglevel", "severity", "$@29", "output_options_list", "$@30",
+  "output_options_list_content", "output_entry", "$@31",
+  "output_params_list", "output_params", "output", "$@32", "flush",
+  "maxsize", "maxver", "async", "$@33", "async_queue_size", YY_NULLPTR
   };
+#endif
+
 
 #if AGENT_DEBUG
-  const unsigned short
+  const short
   AgentParser::yyrline_[] =
   {
-       0,   114,   114,   114,   115,   115,   116,   116,   124,   124,
-     135,   141,   142,   143,   144,   145,   146,   147,   151,   151,
-     162,   167,   168,   176,   180,   187,   187,   193,   194,   197,
-     201,   214,   223,   223,   235,   236,   240,   241,   242,   243,
-     244,   245,   249,   249,   266,   267,   272,   273,   274,   275,
-     276,   277,   278,   279,   282,   282,   290,   295,   295,   320,
-     320,   348,   348,   358,   359,   362,   363,   366,   366,   374,
-     375,   376,   379,   380,   383,   383,   391,   391,   401,   401,
-     414,   415,   420,   421,   422,   423,   427,   427,   438,   438,
-     449,   449,   460,   461,   465,   466,   467,   468,   469,   473,
-     473,   482,   482,   490,   496,   496,   503,   503,   510,   510,
-     522,   522,   535,   536,   540,   544,   544,   556,   557,   561,
-     561,   569,   570,   573,   574,   575,   576,   577,   578,   579,
-     582,   582,   590,   595,   595,   603,   603,   613,   614,   617,
-     617,   625,   626,   629,   630,   631,   632,   635,   635,   643,
-     648,   653
+       0,   116,   116,   116,   117,   117,   118,   118,   126,   126,
+     137,   143,   144,   145,   146,   147,   148,   149,   153,   153,
+     164,   169,   170,   178,   182,   189,   189,   195,   196,   199,
+     203,   216,   225,   225,   237,   238,   242,   243,   244,   245,
+     246,   247,   251,   251,   268,   269,   274,   275,   276,   277,
+     278,   279,   280,   281,   284,   284,   292,   297,   297,   322,
+     322,   350,   350,   360,   361,   364,   365,   368,   368,   376,
+     377,   378,   381,   382,   385,   385,   393,   393,   403,   403,
+     416,   417,   422,   423,   424,   425,   429,   429,   440,   440,
+     451,   451,   462,   463,   467,   468,   469,   470,   471,   475,
+     475,   484,   484,   492,   498,   498,   505,   505,   512,   512,
+     524,   524,   537,   538,   542,   546,   546,   558,   559,   563,
+     563,   571,   572,   575,   576,   577,   578,   579,   580,   581,
+     584,   584,   592,   597,   597,   605,   605,   615,   616,   619,
+     619,   627,   628,   631,   632,   633,   634,   635,   636,   639,
+     639,   647,   652,   657,   662,   662,   670
   };
 
-  // Print the state stack on the debug stream.
   void
-  AgentParser::yystack_print_ ()
+  AgentParser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
+      *yycdebug_ << ' ' << int (i->state);
     *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  AgentParser::yy_reduce_print_ (int yyrule)
+  AgentParser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
@@ -2023,9 +2144,9 @@ namespace isc { namespace agent {
 
 #line 14 "agent_parser.yy"
 } } // isc::agent
-#line 2027 "agent_parser.cc"
+#line 2148 "agent_parser.cc"
 
-#line 658 "agent_parser.yy"
+#line 678 "agent_parser.yy"
 
 
 void
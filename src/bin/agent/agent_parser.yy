@@ -77,6 +77,8 @@ using namespace std;
   FLUSH "flush"
   MAXSIZE "maxsize"
   MAXVER "maxver"
+  ASYNC "async"
+  ASYNC_QUEUE_SIZE "async-queue-size"
 
   DHCP4 "Dhcp4"
   DHCP6 "Dhcp6"
@@ -630,6 +632,8 @@ output_params: output
              | flush
              | maxsize
              | maxver
+             | async
+             | async_queue_size
              ;
 
 output: OUTPUT {
@@ -655,6 +659,22 @@ maxver: MAXVER COLON INTEGER {
     ctx.stack_.back()->set("maxver", maxver);
 }
 
+async: ASYNC {
+    ctx.enter(ctx.NO_KEYWORDS);
+} COLON STRING {
+    ElementPtr async(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("async", async);
+    ctx.leave();
+};
+
+async_queue_size: ASYNC_QUEUE_SIZE COLON INTEGER {
+    if ($3 <= 0) {
+        error(@3, "async-queue-size must be greater than zero");
+    }
+    ElementPtr size(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("async-queue-size", size);
+};
+
 %%
 
 void
@@ -16,6 +16,7 @@
 #include <boost/scoped_ptr.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 
+#include <limits>
 #include <sstream>
 #include <string>
 
@@ -66,12 +67,6 @@ D2Params::validateContents() {
                   "D2Params: DNS server timeout must be larger than 0");
     }
 
-    if (ncr_format_ != dhcp_ddns::FMT_JSON) {
-        isc_throw(D2CfgError, "D2Params: NCR Format:"
-                  << dhcp_ddns::ncrFormatToString(ncr_format_)
-                  << " is not yet supported");
-    }
-
     if (ncr_protocol_ != dhcp_ddns::NCR_UDP) {
         isc_throw(D2CfgError, "D2Params: NCR Protocol:"
                   << dhcp_ddns::ncrProtocolToString(ncr_protocol_)
@@ -204,7 +199,7 @@ DnsServerInfo::DnsServerInfo(const std::string& hostname,
                              isc::asiolink::IOAddress ip_address, uint32_t port,
                              bool enabled)
     :hostname_(hostname), ip_address_(ip_address), port_(port),
-    enabled_(enabled) {
+    enabled_(enabled), protocol_(dhcp_ddns::NCR_UDP), max_transactions_(0) {
 }
 
 DnsServerInfo::~DnsServerInfo() {
@@ -228,6 +223,12 @@ DnsServerInfo::toElement() const {
     result->set("ip-address", Element::create(ip_address_.toText()));
     // Set port
     result->set("port", Element::create(static_cast<int64_t>(port_)));
+    // Set protocol
+    result->set("protocol",
+                Element::create(dhcp_ddns::ncrProtocolToString(protocol_)));
+    // Set max-transactions
+    result->set("max-transactions",
+                Element::create(static_cast<int64_t>(max_transactions_)));
 
     return (result);
 }
@@ -480,6 +481,13 @@ DnsServerInfoParser::parse(ConstElementPtr server_config) {
     std::string hostname = getString(server_config, "hostname");
     std::string ip_address = getString(server_config, "ip-address");
     uint32_t port = getInteger(server_config, "port");
+    dhcp_ddns::NameChangeProtocol protocol =
+        getAndConvert<dhcp_ddns::NameChangeProtocol,
+                      dhcp_ddns::stringToNcrProtocol>(server_config, "protocol",
+                                                      "DNS update protocol");
+    uint32_t max_transactions =
+        getInteger(server_config, "max-transactions", 0,
+                   std::numeric_limits<uint32_t>::max());
     ConstElementPtr user_context = server_config->get("user-context");
 
     // The configuration must specify one or the other.
@@ -519,6 +527,9 @@ DnsServerInfoParser::parse(ConstElementPtr server_config) {
         }
     }
 
+    server_info->setProtocol(protocol);
+    server_info->setMaxTransactions(max_transactions);
+
     // Add user-context
     if (user_context) {
         server_info->setContext(user_context);
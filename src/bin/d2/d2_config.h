@@ -12,6 +12,7 @@
 #include <cc/simple_parser.h>
 #include <cc/cfg_to_element.h>
 #include <cc/user_context.h>
+#include <dhcp_ddns/ncr_io.h>
 #include <dhcpsrv/parsers/dhcp_parsers.h>
 #include <dns/tsig.h>
 #include <exceptions/exceptions.h>
@@ -481,6 +482,38 @@ public:
         enabled_ = false;
     }
 
+    /// @brief Getter which returns the protocol used to send the DNS
+    /// updates to the server.
+    ///
+    /// @return returns the protocol, UDP or TCP.
+    dhcp_ddns::NameChangeProtocol getProtocol() const {
+        return (protocol_);
+    }
+
+    /// @brief Sets the protocol used to send the DNS updates to the server.
+    ///
+    /// @param protocol is the new protocol, UDP or TCP.
+    void setProtocol(const dhcp_ddns::NameChangeProtocol protocol) {
+        protocol_ = protocol;
+    }
+
+    /// @brief Getter which returns the maximum number of concurrent
+    /// transactions sent to the server.
+    ///
+    /// @return returns the maximum, zero when only the global limit applies.
+    uint32_t getMaxTransactions() const {
+        return (max_transactions_);
+    }
+
+    /// @brief Sets the maximum number of concurrent transactions sent to
+    /// the server.
+    ///
+    /// @param max_transactions is the new maximum, zero for no limit other
+    /// than the global one.
+    void setMaxTransactions(const uint32_t max_transactions) {
+        max_transactions_ = max_transactions;
+    }
+
     /// @brief Returns a text representation for the server.
     std::string toText() const;
 
@@ -505,6 +538,13 @@ private:
     /// @param enabled is a flag that indicates whether this server is
     /// enabled for use. It defaults to true.
     bool enabled_;
+
+    /// @brief The protocol used to send the DNS updates to the server.
+    dhcp_ddns::NameChangeProtocol protocol_;
+
+    /// @brief The maximum number of concurrent transactions sent to the
+    /// server, zero when only the global limit applies.
+    uint32_t max_transactions_;
 };
 
 std::ostream&
@@ -803,6 +843,7 @@ public:
     /// -# hostname is not blank, hostname is not yet supported
     /// -# ip_address is invalid
     /// -# port is 0
+    /// -# protocol is neither UDP nor TCP
     DnsServerInfoPtr parse(data::ConstElementPtr server_config);
 };
 
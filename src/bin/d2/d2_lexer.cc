@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 67
-#define YY_END_OF_BUFFER 68
+#define YY_NUM_RULES 72
+#define YY_END_OF_BUFFER 73
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,54 +700,60 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[417] =
+static const flex_int16_t yy_accept[478] =
     {   0,
-       60,   60,    0,    0,    0,    0,    0,    0,    0,    0,
-       68,   66,   10,   11,   66,    1,   60,   57,   60,   60,
-       66,   59,   58,   66,   66,   66,   66,   66,   53,   54,
-       66,   66,   66,   55,   56,    5,    5,    5,   66,   66,
-       66,   10,   11,    0,    0,   49,    0,    0,    0,    0,
+       65,   65,    0,    0,    0,    0,    0,    0,    0,    0,
+       73,    1,   71,   71,   71,   10,   11,   58,   59,   60,
+       62,   61,   63,   65,   64,   65,   65,   71,   71,   71,
+       71,   71,   71,   71,   71,    5,   11,    5,    5,   10,
+       11,   71,   71,   10,   11,   71,   71,   71,   10,   71,
+       11,    1,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    1,
-       60,   60,    0,   59,   60,    3,    2,    6,    0,   60,
-        0,    0,    0,    0,    0,    0,    4,    0,    0,    9,
-        0,   50,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   54,    0,    3,
+        2,    6,   10,   11,   64,   65,    0,   65,   65,    0,
+       65,    0,    0,    0,    0,    0,    0,    4,    0,    0,
 
-       52,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        9,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    2,    0,    0,    0,    0,    0,
-        0,    0,    8,    0,    0,    0,    0,    0,    0,    0,
-        0,   51,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   65,   63,
-        0,   62,   61,    0,    0,    0,    0,    0,    0,   19,
-       18,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   57,    0,    0,    0,   55,    0,    0,    2,
+        0,    0,    0,    0,    0,    0,    0,    8,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   56,    0,    0,   68,   66,    0,
+        0,   67,   70,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,   64,   61,    0,
-        0,    0,    0,    0,    0,   20,    0,    0,    0,    0,
+        0,    0,   19,   18,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   43,    0,    0,    0,   14,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   46,   47,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   40,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    7,    0,    0,    0,    0,
+        0,   69,   66,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   20,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   48,    0,
+        0,    0,   14,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   51,   52,
+        0,    0,    0,    0,   46,    0,    0,    0,    0,    0,
+        0,   43,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    7,
+        0,    0,   45,   21,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   42,    0,    0,   39,    0,    0,   32,    0,
-
-        0,    0,    0,    0,    0,   36,    0,   22,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   37,   41,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   12,
-        0,    0,    0,    0,    0,    0,    0,   28,    0,   26,
-        0,    0,    0,    0,   45,    0,    0,    0,    0,    0,
-       30,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   29,    0,    0,    0,    0,   44,
-        0,    0,    0,    0,   13,   17,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   31,    0,   27,    0,    0,
-        0,    0,   35,   34,    0,    0,    0,   25,    0,   23,
-
-       16,    0,   24,   21,   48,    0,    0,    0,   33,    0,
-       38,    0,    0,    0,   15,    0
+        0,    0,    0,   42,    0,    0,   35,    0,    0,    0,
+        0,    0,    0,   44,    0,    0,   39,    0,    0,    0,
+       23,    0,    0,    0,    0,    0,    0,    0,    0,   40,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   12,    0,    0,    0,    0,    0,    0,    0,
+        0,   29,    0,   27,    0,    0,    0,   30,    0,   50,
+        0,    0,    0,    0,    0,    0,   33,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   32,    0,    0,    0,    0,    0,    0,    0,    0,
+       49,    0,    0,   13,   17,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   28,   34,    0,
+        0,    0,    0,   38,   37,    0,    0,    0,    0,    0,
+       26,    0,   24,   16,    0,   25,   22,    0,   53,    0,
+        0,    0,    0,    0,    0,   36,    0,   41,    0,    0,
+        0,   31,   47,    0,    0,   15,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -759,13 +765,13 @@ static const YY_CHAR yy_ec[256] =
         5,    8,    9,   10,   11,   12,   13,   14,   14,   14,
        14,   15,   14,   16,   14,   14,   14,   17,    5,   18,
         5,   19,   20,    5,   21,   22,   23,   24,   25,   26,
-        5,    5,    5,   27,    5,   28,    5,   29,   30,   31,
-        5,   32,   33,   34,   35,    5,    5,    5,    5,    5,
-       36,   37,   38,    5,   39,    5,   40,   41,   42,   43,
+        5,    5,   27,   28,    5,   29,    5,   30,   31,   32,
+        5,   33,   34,   35,   36,    5,    5,    5,   37,    5,
+       38,   39,   40,    5,   41,    5,   42,   43,   44,   45,
 
-       44,   45,   46,   47,   48,   49,   50,   51,   52,   53,
-       54,   55,    5,   56,   57,   58,   59,   60,   61,   62,
-       63,   64,   65,    5,   66,    5,    5,    5,    5,    5,
+       46,   47,   48,   49,   50,   28,   51,   52,   53,   54,
+       55,   56,   57,   58,   59,   60,   61,   62,   63,   64,
+       65,   66,   67,    5,   68,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -782,213 +788,314 @@ static const YY_CHAR yy_ec[256] =
         5,    5,    5,    5,    5
     } ;
 
-static const YY_CHAR yy_meta[67] =
+static const YY_CHAR yy_meta[69] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    3,    3,    3,    3,
-        5,    5,    5,    5,    5,    5,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    5,
-        5,    5,    5,    5,    5,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[428] =
+static const flex_int16_t yy_base[478] =
     {   0,
-        0,    0,   65,   68,   71,    0,   69,   73,   54,   70,
-      735,  736,   89,  731,  137,    0,  192,  736,  197,  200,
-       86,  212,  736,  713,   97,   74,   63,   69,  736,  736,
-       83,   68,   78,  736,  736,  736,  124,  719,  678,    0,
-      711,  128,  726,  212,  234,  736,  674,  680,  172,  672,
-      196,  196,  257,  674,  670,  187,  191,  669,  667,  677,
-      666,  679,   91,  659,  663,  672,  179,  209,  210,    0,
-      281,  289,  308,  314,  293,  736,    0,  736,  232,  257,
-      224,  227,  276,  292,  293,  277,  736,  673,  708,  736,
-      294,  736,  328,  660,  670,  297,  665,  301,  307,  704,
-
-        0,  374,  663,  207,  655,  666,  660,  648,  645,  647,
-      645,  690,  637,  653,  636,  645,  640,  637,  638,  633,
-      300,  650,  643,  646,    0,  307,  317,  255,  313,  320,
-      322,  638,  736,    0,  630,  632,  321,  640,  679,  678,
-      677,  736,  406,  628,  629,  622,  622,  619,  633,  665,
-      618,  613,  615,  632,  660,  624,  292,  625,  657,  612,
-      608,  621,  608,  619,  612,  615,  604,  328,  736,  736,
-      332,  736,  736,  600,    0,  602,  339,  651,  608,  736,
-      736,  438,  599,  610,  597,  641,  605,  593,  592,  601,
-      607,  593,  602,  591,  599,  594,  597,  634,  209,  580,
-
-      632,  581,  592,  579,  590,  622,  621,  736,  736,  588,
-        0,  576,  623,  622,  584,  736,  573,  470,  577,  571,
-      569,  579,  570,  562,  575,  612,  561,  576,  572,  574,
-      557,  548,  555,  736,  556,  553,  550,  736,  550,  548,
-      557,  546,  553,  560,  557,    0,  549,  736,  736,  546,
-      552,  539,  538,  544,  540,  549,  581,  535,  736,  547,
-      537,  532,  535,  529,  541,  578,  527,  528,  204,  537,
-      574,  521,  567,  533,  522,  736,  564,  517,  567,  525,
-      565,  559,  517,  508,  526,  506,  554,  520,  519,  518,
-      555,  554,  736,  507,  500,  736,  503,  545,  736,  492,
-
-      322,  491,  500,  512,  545,  736,  498,  736,  492,  502,
-      485,  479,  478,  466,  502,  450,  500,  736,  736,  465,
-      450,  448,  459,  495,  460,  436,  441,  439,  444,  736,
-      483,  434,  439,  426,  418,  419,  431,  736,  416,  736,
-      414,  429,  412,  426,  736,  416,  412,  460,  421,  414,
-      736,  415,  403,  449,  388,  348,  391,  437,  436,  387,
-      392,  386,  394,  393,  736,  374,  382,  384,  376,  736,
-      420,  367,  418,  366,  736,  736,  362,  358,  354,  404,
-      403,  350,  349,  362,  398,  736,  355,  736,  396,  395,
-      341,  387,  736,  736,  386,  385,  327,  736,  331,  736,
-
-      736,  325,  736,  736,  736,  373,  334,  371,  736,  313,
-      736,  302,  207,  244,  736,  736,  515,  520,  525,  530,
-      535,  540,  543,  216,  130,  115,   87
+        1,    1,   70,    1,  139,    1,  208,    1,  277,    1,
+        1,  691,  346, 1033,  993, 1043,  832,  694,    1,    1,
+        1,    1,    1, 1150,    1,  885,  970,  961, 1048, 1049,
+     1056,  705,  941,  963,    1,    1,    1, 1076,    1,    1,
+        1,    1, 1082,    1,    1,    1,  829,    1,    1, 1311,
+        1,    1,  945, 1290,  952, 1278, 1286, 1060, 1281, 1084,
+     1094,  919, 1282, 1138, 1083, 1283, 1283, 1294, 1286, 1016,
+     1283, 1082, 1299,  979, 1000,  967,  415,    1,  484,    1,
+      760,    1,    1,    1,    1,    1,    1,    1,    1, 1142,
+        1, 1091, 1285, 1134, 1298, 1138, 1299,    1, 1308, 1347,
+
+        1, 1290, 1139, 1301, 1312, 1139, 1309, 1141, 1142, 1311,
+     1296,  957, 1308, 1304, 1321, 1317, 1305, 1309, 1309, 1358,
+     1305, 1323, 1319, 1315, 1314, 1317, 1321, 1315, 1127, 1334,
+     1329, 1334,    1,    1,  553,  898,    1,    1, 1148,    1,
+     1095, 1335, 1148, 1323, 1170, 1331, 1332,    1, 1031, 1179,
+     1325, 1330, 1171, 1339, 1382, 1383, 1335, 1337, 1332, 1340,
+     1335, 1384, 1335, 1351, 1339, 1336, 1340, 1359, 1391, 1355,
+     1358, 1394, 1350, 1347, 1348, 1363, 1352, 1365, 1361, 1365,
+     1356,  993,    1,    1,    1,    1, 1006,    1,    1, 1178,
+     1369,    1,    1, 1355, 1357, 1368, 1373, 1152, 1362, 1056,
+
+     1415, 1372,    1,    1, 1365, 1380, 1367, 1380, 1416, 1369,
+     1381, 1371, 1382, 1390, 1379, 1389, 1381, 1390, 1431, 1157,
+     1377, 1433, 1385, 1383, 1396, 1385, 1398, 1434, 1435, 1040,
+     1053,    1,    1, 1402, 1390, 1383, 1392, 1168, 1396, 1446,
+     1447, 1409,    1, 1401, 1406, 1205, 1402, 1404, 1414, 1414,
+     1409, 1402, 1457, 1406, 1423, 1421, 1425, 1410,    1, 1414,
+     1412, 1411,    1, 1428, 1414, 1414, 1425, 1416, 1426, 1434,
+     1087, 1100, 1433, 1438, 1435, 1476, 1477, 1432,    1,    1,
+     1431, 1438, 1427, 1431,    1, 1437, 1430, 1436, 1434, 1447,
+     1483,    1, 1450, 1443, 1439, 1445, 1440, 1442, 1446, 1206,
+
+     1447, 1457, 1498, 1445, 1495, 1461, 1453,    1, 1134,    1,
+     1455, 1504,    1,    1, 1500, 1453, 1507, 1465, 1454, 1505,
+     1511, 1465, 1457, 1458, 1478, 1511, 1477, 1478, 1479, 1520,
+     1474, 1468, 1474,    1, 1478, 1520,    1, 1467, 1160, 1468,
+     1480,    1, 1476,    1, 1494, 1531,    1, 1485, 1493, 1481,
+        1, 1499, 1496, 1497, 1494, 1500, 1540, 1488, 1542,    1,
+     1507, 1495, 1495, 1546, 1508, 1548, 1513, 1491, 1498, 1498,
+     1517, 1512,    1, 1555, 1501, 1508, 1514, 1507, 1514, 1507,
+     1523,    1, 1510,    1, 1510, 1527, 1512,    1, 1528,    1,
+     1521, 1519, 1570, 1531, 1534, 1126,    1, 1173, 1184, 1175,
+
+     1046, 1212, 1181, 1185, 1224, 1225, 1190, 1192, 1194, 1195,
+     1204,    1, 1193, 1196, 1201, 1062, 1202, 1209, 1210, 1243,
+        1, 1252, 1217,    1,    1, 1219, 1218, 1220, 1257, 1258,
+     1223, 1227, 1230, 1232, 1236, 1269, 1238,    1,    1, 1275,
+     1278, 1244, 1281,    1,    1, 1283, 1250, 1287, 1253, 1254,
+        1, 1255,    1,    1, 1259,    1,    1, 1262,    1, 1260,
+     1300, 1267, 1301, 1268, 1273,    1, 1279,    1, 1306, 1316,
+     1286,    1,    1, 1289, 1318,    1,  622
     } ;
 
-static const flex_int16_t yy_def[428] =
+static const flex_int16_t yy_def[478] =
     {   0,
-      416,    1,  417,  417,    1,    5,    5,    5,    5,    5,
-      416,  416,  416,  416,  416,  418,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  419,
-      416,  416,  416,  420,   15,  416,   45,   45,   45,   45,
-       45,   45,  421,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,  418,
-      416,  416,  416,  416,  416,  416,  422,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  419,  416,
-      420,  416,  416,   45,   45,   45,   45,   45,   45,  423,
-
-       45,  421,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,  422,  416,  416,  416,  416,  416,
-      416,  416,  416,  424,   45,   45,   45,   45,   45,   45,
-      423,  416,  421,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,  416,  416,  416,
-      416,  416,  416,  416,  425,   45,   45,   45,   45,  416,
-      416,  421,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,  416,  416,  416,
-      426,   45,   45,   45,   45,  416,   45,  421,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,  416,   45,   45,   45,  416,   45,   45,
-       45,   45,   45,   45,  416,  427,   45,  416,  416,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,  416,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,  416,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,  416,   45,   45,  416,   45,   45,  416,   45,
-
-       45,   45,   45,   45,   45,  416,   45,  416,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,  416,  416,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,  416,
-       45,   45,   45,   45,   45,   45,   45,  416,   45,  416,
-       45,   45,   45,   45,  416,   45,   45,   45,   45,   45,
-      416,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,  416,   45,   45,   45,   45,  416,
-       45,   45,   45,   45,  416,  416,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,  416,   45,  416,   45,   45,
-       45,   45,  416,  416,   45,   45,   45,  416,   45,  416,
-
-      416,   45,  416,  416,  416,   45,   45,   45,  416,   45,
-      416,   45,   45,   45,  416,    0,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416
+      477,    1,  477,    3,  477,    5,  477,    7,  477,    9,
+      477,  477,  477,  477,  477,  477,  477,  477,   18,   18,
+       18,   18,   18,   18,   24,   24,   24,   18,   18,   18,
+       18,   29,   30,   31,   18,   16,   17,   18,   18,   16,
+       17,   18,   18,   16,   17,   18,  477,   18,   16,   18,
+       17,   12,   13,   53,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   53,
+       54,   54,   54,   54,   54,   54,  477,   18,  477,   18,
+      477,   18,   16,   17,   24,   27,   28,   26,   27,   28,
+       90,   18,   92,   18,   94,   18,   96,   18,   18,   47,
+
+       18,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,  477,  477,   18,   79,   18,   81,
+       18,  141,   18,  143,   18,  145,   18,   18,   54,   53,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   53,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,  135,  136,  136,   18,   79,   18,   18,   18,   18,
+      190,   18,   18,   18,   54,   54,   54,   54,   54,   54,
+
+       54,   54,   18,   18,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   53,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,  135,
+       18,   18,   18,   18,   54,   54,   54,   54,   54,   54,
+       54,   54,   18,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   53,   54,   53,   54,   18,   54,
+       54,   54,   18,   54,   54,   54,   54,   54,   54,   54,
+      135,   18,   18,   53,   54,   54,   54,   54,   18,   18,
+       54,   54,   54,   54,   18,   54,   54,   54,   54,   54,
+       54,   18,   54,   54,   54,   54,   54,   54,   54,   54,
+
+       54,   54,   54,   54,   54,   54,   54,   54,   18,   18,
+       54,   54,   18,   18,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   18,   54,   54,   18,   54,   54,   54,
+       54,   79,   54,   18,   53,   54,   18,   54,   54,   54,
+       18,   53,   54,   54,   54,   54,   54,   54,   54,   18,
+       53,   54,   54,   54,   54,   54,   53,   54,   54,   54,
+       53,   54,   18,   54,   54,   54,   54,   54,   54,   54,
+       54,   18,   54,   18,   54,   54,   54,   18,   54,   18,
+       54,   54,   54,   54,   54,  168,   18,  168,   70,  168,
+
+      168,  168,  168,  168,  168,  168,  168,  168,  168,  168,
+      168,   18,  168,  168,  168,  168,  168,  168,  168,  168,
+       18,  168,  168,   18,   18,  168,  168,  168,  168,  168,
+      168,  168,  168,  168,  168,  168,  168,   18,   18,  168,
+      168,  168,  168,   18,   18,  168,  168,  168,  168,  168,
+       18,  168,   18,   18,  168,   18,   18,  168,   18,  168,
+      168,  168,  168,  168,  168,   18,  168,   18,  168,  168,
+      168,   18,   18,  168,  168,   18,    0
     } ;
 
-static const flex_int16_t yy_nxt[803] =
+static const flex_int16_t yy_nxt[1639] =
     {   0,
-       12,   13,   14,   13,   12,   15,   16,   12,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   12,   12,
-       12,   12,   12,   12,   25,   26,   12,   12,   27,   12,
-       12,   12,   12,   28,   12,   29,   12,   30,   12,   12,
-       12,   12,   12,   25,   31,   12,   12,   12,   12,   12,
-       12,   12,   32,   12,   12,   12,   12,   33,   12,   12,
-       12,   12,   12,   12,   34,   35,   37,   14,   37,   37,
-       14,   37,   38,   41,   40,   38,   12,   12,   40,   12,
-       12,   12,   12,   12,   12,   12,   12,   12,   12,   41,
-       42,   91,   42,   76,   81,   12,   12,   82,   77,   12,
-
-       83,   12,   82,   81,   12,   79,   12,   79,   12,   83,
-       80,   80,   80,   81,   12,   12,   12,   12,   39,  246,
-       12,   82,   84,   12,   83,   42,   85,   42,   12,   42,
-      116,   42,  117,   86,  211,   12,   12,   44,   44,   44,
-       45,   45,   46,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   47,
-       48,   45,   45,   49,   50,   45,   45,   45,   45,   45,
-       51,   52,   45,   53,   45,   45,   54,   45,   55,   56,
-       45,   57,   45,   58,   59,   49,   60,   61,   62,   63,
-       64,   65,   66,   67,   68,   69,   45,   45,   45,   45,
-
-       45,   45,   45,   71,   96,   72,   72,   72,   71,  296,
-       74,   74,   74,   75,   75,   75,   73,   92,   98,   99,
-      175,   73,  121,   71,   73,   74,   74,   74,   96,  105,
-      106,   98,  122,   99,  107,   73,   73,   98,   99,  108,
-       73,  109,  297,   73,  110,   80,   80,   80,   93,  415,
-       98,  126,   99,  235,  127,   73,   45,   45,  145,  146,
-       45,   45,  101,  236,  414,  123,  124,   45,   45,   45,
-       80,   80,   80,   45,  126,   45,   45,  127,   45,  170,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   75,   75,   75,   45,  170,   92,
-
-       71,   45,   72,   72,   72,   73,   75,   75,   75,   45,
-      128,  128,   45,   73,   45,  102,   79,   73,   79,  126,
-      127,   80,   80,   80,   73,   71,  137,   74,   74,   74,
-       93,  139,   73,   91,  128,  131,   73,  140,   73,  168,
-       91,  163,  129,  130,  169,  168,  170,  169,  196,  178,
-      137,  197,  208,  213,  214,  139,  208,   73,  372,  164,
-      413,  140,  215,  168,   91,  173,  412,  169,   91,  171,
-      172,  208,   91,  178,  325,  209,  411,  410,  409,  326,
-       91,  408,  407,   91,  406,   91,  134,  143,  143,  143,
-      405,  404,  403,  402,  143,  143,  143,  143,  143,  143,
-
-      401,  400,  399,  398,  373,  397,  396,  395,  394,  393,
-      392,  391,  390,  143,  143,  143,  143,  143,  143,  182,
-      182,  182,  389,  388,  387,  386,  182,  182,  182,  182,
-      182,  182,  385,  384,  383,  382,  381,  380,  379,  378,
-      377,  376,  375,  374,  371,  182,  182,  182,  182,  182,
-      182,  218,  218,  218,  370,  369,  368,  367,  218,  218,
-      218,  218,  218,  218,  366,  365,  364,  363,  362,  361,
-      360,  359,  358,  357,  356,  355,  354,  218,  218,  218,
-      218,  218,  218,   45,   45,   45,  353,  352,  351,  350,
-       45,   45,   45,   45,   45,   45,  349,  348,  347,  346,
-
-      345,  344,  343,  342,  341,  340,  339,  338,  337,   45,
-       45,   45,   45,   45,   45,   36,   36,   36,   36,   36,
-       70,  336,   70,   70,   70,   89,  335,   89,  334,   89,
-       91,   91,   91,   91,   91,  100,  100,  100,  100,  100,
-      125,  333,  125,  125,  125,  141,  141,  141,  332,  331,
-      330,  329,  328,  327,  324,  323,  322,  321,  320,  319,
-      318,  317,  316,  315,  314,  313,  312,  311,  310,  309,
-      308,  307,  306,  305,  304,  303,  302,  301,  300,  299,
-      298,  295,  294,  293,  292,  291,  290,  289,  288,  287,
-      286,  285,  284,  283,  282,  281,  280,  279,  278,  277,
-
-      276,  275,  274,  273,  272,  271,  270,  269,  268,  267,
-      266,  265,  264,  263,  262,  261,  260,  259,  258,  257,
-      256,  255,  254,  253,  252,  251,  250,  249,  248,  247,
-      245,  244,  243,  242,  241,  240,  239,  238,  237,  234,
-      233,  232,  231,  230,  229,  228,  227,  226,  225,  224,
-      223,  222,  221,  220,  219,  217,  216,  212,  210,  207,
-      206,  205,  204,  203,  202,  201,  200,  199,  198,  195,
-      194,  193,  192,  191,  190,  189,  188,  187,  186,  185,
-      184,  183,  142,  181,  180,  179,  177,  176,  174,  167,
-      166,  165,  162,  161,  160,  159,  158,  157,  156,  155,
-
-      154,  153,  152,  151,  150,  149,  148,  147,  144,  142,
-      138,  136,  135,  133,  132,  120,  119,  118,  115,  114,
-      113,  112,  111,  104,  103,   97,   95,   94,   43,   90,
-       88,   87,   78,   43,  416,   11,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-
-      416,  416
+       11,   35,   16,   17,   16,   35,   13,   12,   35,   26,
+       21,   24,   27,   14,   25,   25,   25,   23,   15,   35,
+       35,   35,   35,   35,   35,   28,   33,   35,   35,   35,
+       34,   35,   35,   35,   35,   32,   35,   35,   18,   35,
+       19,   35,   35,   35,   35,   35,   28,   30,   35,   35,
+       35,   35,   35,   35,   31,   35,   35,   35,   35,   35,
+       29,   35,   35,   35,   35,   35,   35,   20,   22,   11,
+       39,   36,   37,   36,   39,   39,   39,   38,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   11,   42,
+       40,   41,   40,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   43,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+
+       42,   42,   42,   42,   42,   42,   42,   11,   46,   44,
+       45,   44,   46,   47,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   11,   48,   49,   51,
+       49,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   50,   48,   48,   48,
+
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   11,   79,   79,   79,   54,
+       54,   78,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   55,   56,   57,
+       54,   54,   54,   58,   59,   54,   54,   54,   54,   54,
+       60,   61,   54,   54,   77,   54,   54,   62,   55,   63,
+       64,   54,   65,   54,   66,   67,   68,   69,   53,   70,
+
+       71,   72,   54,   73,   74,   75,   76,   54,   54,   54,
+       54,   54,   54,   54,   11,  136,  136,  136,  136,  136,
+      133,  136,  136,  136,  136,  136,  136,  134,  136,  136,
+      136,  136,  136,  136,  136,  136,  136,  136,  136,  136,
+      136,  136,  136,  136,  136,  136,  136,  136,  136,  136,
+      136,  136,  136,  134,  136,  136,  136,  134,  136,  136,
+      136,  134,  136,  136,  136,  136,  136,  136,  134,  136,
+      136,  136,  134,  136,  134,  135,  136,  136,  136,  136,
+      136,  136,  136,   11,  138,  138,  138,  138,  138,  137,
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+      138,  138,  139,  138,  138,  138,  138,  138,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+      138,  138,   11,  183,  183,  183,  183,  183,  183,  183,
+      183,  183,  183,  183,  183,  183,  182,  182,  182,  183,
+      183,  183,  183,  182,  182,  182,  182,  182,  182,  183,
+      183,  183,  183,  183,  183,  183,  183,  183,  183,  183,
+      183,  183,  183,  183,  182,  182,  182,  182,  182,  182,
+
+      183,  183,  183,  183,  183,  183,  183,  183,  183,  183,
+      183,  183,  183,  183,  183,  183,  183,  183,  183,  183,
+      183,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+       11,   52,   52,   11,   52,   52,   52,   52,   52,   52,
+
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   11,
+      140,  140,   93,  140,  140,  140,  140,  140,  140,  140,
+      140,  140,  140,  140,  140,  140,  140,  140,  140,  140,
+      140,  140,  140,  140,  140,  140,  140,  140,  140,  140,
+      140,  140,  140,  140,  140,  140,  140,  140,  140,  140,
+
+      140,  140,  140,  140,  140,  140,  140,  140,  140,  140,
+      140,  140,  140,  140,  140,  140,  140,  140,  140,  140,
+      140,  140,  140,  140,  140,  140,  140,  140,   11,  100,
+      100,   11,  100,  100,   84,  100,  100,  100,  100,  100,
+      100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+      100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+      100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+      100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+      100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+      100,  100,  100,  100,  100,  100,  100,   11,   88,   88,
+
+       88,  184,  184,  185,  184,  184,  184,  184,  184,  184,
+      184,  184,  184,  184,  184,  184,  184,  184,  184,  184,
+      184,  184,  184,  184,  184,  184,  184,  184,  184,  184,
+      184,  184,  184,  184,  184,  184,  184,  184,  184,  184,
+      184,  184,  184,  184,  184,  184,  184,  184,  184,  184,
+      184,  184,  184,  184,  184,  184,  184,  184,  184,  184,
+      184,  184,  184,  184,  184,  184,   54,   54,   54,   90,
+      110,   90,   54,   54,   91,   91,   91,  111,  103,   54,
+       54,  477,   95,   89,   89,   89,  102,   54,   54,   54,
+      109,   54,   11,   54,   54,   54,   54,   54,   54,   54,
+
+       54,  103,   54,   54,   54,   54,  230,  230,  230,  160,
+      159,  109,   82,  230,  230,  230,  230,  230,  230,  231,
+      231,  231,  108,   97,  129,  132,  231,  231,  231,  231,
+      231,  231,   11,  130,  230,  230,  230,  230,  230,  230,
+       80,  195,   11,  108,   83,   81,   83,  231,  231,  231,
+      231,  231,  231,  271,  271,  271,  419,  123,  131,  124,
+      271,  271,  271,  271,  271,  271,  272,  272,  272,   95,
+      240,  241,  434,  272,  272,  272,  272,  272,  272,  242,
+       93,  271,  271,  271,  271,  271,  271,   54,   98,  196,
+       94,   97,  197,  106,  272,  272,  272,  272,  272,  272,
+
+      308,  308,  308,   54,  420,   92,  108,  308,  308,  308,
+      308,  308,  308,  309,  309,  309,   96,  109,  106,  188,
+      309,  309,  309,  309,  309,  309,  142,  108,  308,  308,
+      308,  308,  308,  308,  117,   99,  126,  118,  109,  127,
+      189,  309,  309,  309,  309,  309,  309,  342,  342,  342,
+      477,  141,  477,  186,  342,  342,  342,  342,  342,  342,
+      186,   86,  144,   85,   85,   85,  146,   54,  150,  153,
+      177,  415,  155,  156,   87,  342,  342,  342,  342,  342,
+      342,  190,  113,  115,  238,  143,  186,  116,  178,  145,
+      186,  114,  150,  153,  186,   87,  155,  156,  193,  198,
+
+      201,  186,  232,  260,  277,  186,  191,  186,  187,  238,
+      285,  334,  261,  367,   54,  284,   54,  421,  416,  368,
+      198,  192,   54,  232,  201,   54,   54,  417,  418,  424,
+      425,   54,  277,   54,   54,   54,   54,   54,  423,  422,
+      429,  427,   54,   54,  426,   54,  333,  428,  438,  430,
+       54,   54,  435,   54,  433,  432,  431,  439,   54,   54,
+       54,   54,  444,  445,   54,   54,   54,  436,   54,  437,
+      441,   54,  442,   54,  451,  440,  447,   54,  443,   54,
+      453,  450,  446,  454,   54,   54,  456,  452,  457,  448,
+      449,   54,  459,   54,   54,   54,   54,  455,   54,   54,
+
+       54,   54,  460,   54,  458,  466,  468,  462,   54,   54,
+       54,  472,  467,  461,   54,  464,   54,  463,  470,   54,
+       54,  473,   54,  476,   54,  465,  469,   54,   54,  101,
+       54,   54,  104,  471,  105,  107,  112,  119,  120,  121,
+      122,   54,   54,  125,  128,  142,  474,   54,  475,  144,
+      146,  147,  148,  149,  151,  152,  154,   54,  157,   54,
+      158,  161,  162,  163,  164,  165,  166,  167,  168,  169,
+      170,  171,  172,  173,  174,  175,  176,  179,  180,  181,
+      188,  190,  193,  194,  199,  200,  202,  203,  204,  205,
+      206,  207,  208,  209,  210,  211,  212,  213,  214,  215,
+
+      216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+      226,  227,  228,  229,  233,  234,  235,  236,  237,  239,
+      243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+      253,  254,  255,  256,  257,  258,  259,  262,  263,  264,
+      265,  266,  267,  268,  269,  270,  273,  274,  275,  276,
+      278,  279,  280,  281,  282,  283,  286,  287,  288,  289,
+      290,  291,  292,  293,  294,  295,  296,  297,  298,  299,
+      300,  301,  302,  303,  304,  305,  306,  307,  310,  311,
+      312,  313,  314,  315,  316,  317,  318,  319,  320,  321,
+      322,  323,  324,  325,  326,  327,  328,  329,  330,  331,
+
+      332,  335,  336,  337,  338,  339,  340,  341,  343,  344,
+      345,  346,  347,  348,  349,  350,  351,  352,  353,  354,
+      355,  356,  357,  358,  359,  360,  361,  362,  363,  364,
+      365,  366,  369,  370,  371,  372,  373,  374,  375,  376,
+      377,  378,  379,  380,  381,  382,  383,  384,  385,  386,
+      387,  388,  389,  390,  391,  392,  393,  394,  395,  396,
+      397,  398,  399,  400,  401,  402,  403,  404,  405,  406,
+      407,  408,  409,  410,  411,  412,  413,  414,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
     } ;
 
-static const flex_int16_t yy_chk[803] =
+static const flex_int16_t yy_chk[1639] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -996,89 +1103,180 @@ static const flex_int16_t yy_chk[803] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    3,    3,    3,    4,
-        4,    4,    3,    9,    7,    4,    5,    5,    8,    5,
-        5,    5,    5,    5,    5,    5,    5,    5,    5,   10,
-       13,  427,   13,   21,   26,    5,    5,   27,   21,    5,
-
-       28,    9,   32,   31,    5,   25,    5,   25,    5,   33,
-       25,   25,   25,   26,    5,    5,    7,   10,    5,  426,
-        8,   27,   31,    5,   28,   37,   32,   37,    5,   42,
-       63,   42,   63,   33,  425,    5,    5,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-
-       15,   15,   15,   17,   49,   17,   17,   17,   19,  269,
-       19,   19,   19,   20,   20,   20,   17,   44,   51,   52,
-      424,   19,   67,   22,   20,   22,   22,   22,   49,   56,
-       56,   68,   67,   69,   56,   17,   22,   51,   52,   56,
-       19,   57,  269,   20,   57,   79,   79,   79,   44,  414,
-       68,   81,   69,  199,   82,   22,   45,   45,  104,  104,
-       45,   45,   53,  199,  413,   68,   69,   45,   45,   53,
-       80,   80,   80,   45,   81,   45,   45,   82,   45,  128,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   53,   71,   71,   71,   53,  128,   91,
-
-       72,   53,   72,   72,   72,   71,   75,   75,   75,   53,
-       83,   86,   53,   72,   53,   53,   73,   75,   73,   84,
-       85,   73,   73,   73,   71,   74,   96,   74,   74,   74,
-       91,   98,   72,   93,   83,   86,   75,   99,   74,  126,
-       93,  121,   84,   85,  127,  129,  131,  130,  157,  137,
-       96,  157,  168,  177,  177,   98,  171,   74,  356,  121,
-      412,   99,  177,  126,   93,  131,  410,  127,   93,  129,
-      130,  168,   93,  137,  301,  171,  408,  407,  406,  301,
-       93,  402,  399,   93,  397,   93,   93,  102,  102,  102,
-      396,  395,  392,  391,  102,  102,  102,  102,  102,  102,
-
-      390,  389,  387,  385,  356,  384,  383,  382,  381,  380,
-      379,  378,  377,  102,  102,  102,  102,  102,  102,  143,
-      143,  143,  374,  373,  372,  371,  143,  143,  143,  143,
-      143,  143,  369,  368,  367,  366,  364,  363,  362,  361,
-      360,  359,  358,  357,  355,  143,  143,  143,  143,  143,
-      143,  182,  182,  182,  354,  353,  352,  350,  182,  182,
-      182,  182,  182,  182,  349,  348,  347,  346,  344,  343,
-      342,  341,  339,  337,  336,  335,  334,  182,  182,  182,
-      182,  182,  182,  218,  218,  218,  333,  332,  331,  329,
-      218,  218,  218,  218,  218,  218,  328,  327,  326,  325,
-
-      324,  323,  322,  321,  320,  317,  316,  315,  314,  218,
-      218,  218,  218,  218,  218,  417,  417,  417,  417,  417,
-      418,  313,  418,  418,  418,  419,  312,  419,  311,  419,
-      420,  420,  420,  420,  420,  421,  421,  421,  421,  421,
-      422,  310,  422,  422,  422,  423,  423,  423,  309,  307,
-      305,  304,  303,  302,  300,  298,  297,  295,  294,  292,
-      291,  290,  289,  288,  287,  286,  285,  284,  283,  282,
-      281,  280,  279,  278,  277,  275,  274,  273,  272,  271,
-      270,  268,  267,  266,  265,  264,  263,  262,  261,  260,
-      258,  257,  256,  255,  254,  253,  252,  251,  250,  247,
-
-      245,  244,  243,  242,  241,  240,  239,  237,  236,  235,
-      233,  232,  231,  230,  229,  228,  227,  226,  225,  224,
-      223,  222,  221,  220,  219,  217,  215,  214,  213,  212,
-      210,  207,  206,  205,  204,  203,  202,  201,  200,  198,
-      197,  196,  195,  194,  193,  192,  191,  190,  189,  188,
-      187,  186,  185,  184,  183,  179,  178,  176,  174,  167,
-      166,  165,  164,  163,  162,  161,  160,  159,  158,  156,
-      155,  154,  153,  152,  151,  150,  149,  148,  147,  146,
-      145,  144,  141,  140,  139,  138,  136,  135,  132,  124,
-      123,  122,  120,  119,  118,  117,  116,  115,  114,  113,
-
-      112,  111,  110,  109,  108,  107,  106,  105,  103,  100,
-       97,   95,   94,   89,   88,   66,   65,   64,   62,   61,
-       60,   59,   58,   55,   54,   50,   48,   47,   43,   41,
-       39,   38,   24,   14,   11,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-
-      416,  416
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+
+        5,    5,    5,    5,    5,    5,    5,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,  135,  135,  135,  135,  135,  135,  135,  135,
+      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
+      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
+      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
+      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
+
+      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
+      135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
+      135,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+       12,   12,   12,   18,   12,   12,   12,   12,   12,   12,
+
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   81,
+       81,   81,   32,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   47,   47,
+       47,   17,   47,   47,   17,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,  136,   26,   26,
+
+       26,  136,  136,  136,  136,  136,  136,  136,  136,  136,
+      136,  136,  136,  136,  136,  136,  136,  136,  136,  136,
+      136,  136,  136,  136,  136,  136,  136,  136,  136,  136,
+      136,  136,  136,  136,  136,  136,  136,  136,  136,  136,
+      136,  136,  136,  136,  136,  136,  136,  136,  136,  136,
+      136,  136,  136,  136,  136,  136,  136,  136,  136,  136,
+      136,  136,  136,  136,  136,  136,   53,   53,   53,   28,
+       62,   28,   53,   53,   28,   28,   28,   62,   55,   53,
+       53,   27,   33,   27,   27,   27,   53,   53,   53,   53,
+       76,   53,   15,   53,   53,   53,   53,   53,   53,   53,
+
+       53,   55,   53,   53,   53,   53,  182,  182,  182,  112,
+      112,   76,   15,  182,  182,  182,  182,  182,  182,  187,
+      187,  187,   75,   34,   74,   76,  187,  187,  187,  187,
+      187,  187,   14,   74,  182,  182,  182,  182,  182,  182,
+       14,  149,   16,   75,   16,   14,   16,  187,  187,  187,
+      187,  187,  187,  230,  230,  230,  401,   70,   75,   70,
+      230,  230,  230,  230,  230,  230,  231,  231,  231,   30,
+      200,  200,  416,  231,  231,  231,  231,  231,  231,  200,
+       29,  230,  230,  230,  230,  230,  230,  401,   38,  149,
+       30,   31,  149,   58,  231,  231,  231,  231,  231,  231,
+
+      271,  271,  271,  416,  401,   29,   60,  271,  271,  271,
+      271,  271,  271,  272,  272,  272,   31,   61,   58,  141,
+      272,  272,  272,  272,  272,  272,   92,   60,  271,  271,
+      271,  271,  271,  271,   65,   43,   72,   65,   61,   72,
+      141,  272,  272,  272,  272,  272,  272,  309,  309,  309,
+       90,   92,   90,  139,  309,  309,  309,  309,  309,  309,
+      139,   24,   94,   24,   24,   24,   96,  396,  103,  106,
+      129,  396,  108,  109,   24,  309,  309,  309,  309,  309,
+      309,  143,   64,   64,  198,   94,  139,   64,  129,   96,
+      139,   64,  103,  106,  139,   24,  108,  109,  145,  150,
+
+      153,  139,  190,  220,  238,  139,  143,  139,  139,  198,
+      246,  300,  220,  339,  398,  246,  400,  402,  398,  339,
+      150,  145,  403,  190,  153,  399,  404,  399,  400,  405,
+      406,  407,  238,  408,  413,  409,  410,  414,  404,  403,
+      410,  408,  415,  417,  407,  411,  300,  409,  420,  411,
+      418,  419,  417,  402,  415,  414,  413,  422,  423,  427,
+      426,  428,  429,  430,  431,  405,  406,  418,  432,  419,
+      426,  433,  427,  434,  436,  423,  432,  435,  428,  437,
+      440,  435,  431,  441,  420,  442,  443,  437,  446,  433,
+      434,  447,  448,  422,  449,  450,  452,  442,  429,  430,
+
+      455,  460,  449,  458,  447,  461,  463,  452,  462,  464,
+      436,  469,  462,  450,  465,  458,  440,  455,  465,  441,
+      467,  470,  443,  475,  446,  460,  464,  471,  448,   50,
+      474,   54,   56,  467,   57,   59,   63,   66,   67,   68,
+       69,  461,  463,   71,   73,   93,  471,  469,  474,   95,
+       97,   99,  100,  102,  104,  105,  107,  470,  110,  475,
+      111,  113,  114,  115,  116,  117,  118,  119,  120,  121,
+      122,  123,  124,  125,  126,  127,  128,  130,  131,  132,
+      142,  144,  146,  147,  151,  152,  154,  155,  156,  157,
+      158,  159,  160,  161,  162,  163,  164,  165,  166,  167,
+
+      168,  169,  170,  171,  172,  173,  174,  175,  176,  177,
+      178,  179,  180,  181,  191,  194,  195,  196,  197,  199,
+      201,  202,  205,  206,  207,  208,  209,  210,  211,  212,
+      213,  214,  215,  216,  217,  218,  219,  221,  222,  223,
+      224,  225,  226,  227,  228,  229,  234,  235,  236,  237,
+      239,  240,  241,  242,  244,  245,  247,  248,  249,  250,
+      251,  252,  253,  254,  255,  256,  257,  258,  260,  261,
+      262,  264,  265,  266,  267,  268,  269,  270,  273,  274,
+      275,  276,  277,  278,  281,  282,  283,  284,  286,  287,
+      288,  289,  290,  291,  293,  294,  295,  296,  297,  298,
+
+      299,  301,  302,  303,  304,  305,  306,  307,  311,  312,
+      315,  316,  317,  318,  319,  320,  321,  322,  323,  324,
+      325,  326,  327,  328,  329,  330,  331,  332,  333,  335,
+      336,  338,  340,  341,  343,  345,  346,  348,  349,  350,
+      352,  353,  354,  355,  356,  357,  358,  359,  361,  362,
+      363,  364,  365,  366,  367,  368,  369,  370,  371,  372,
+      374,  375,  376,  377,  378,  379,  380,  381,  383,  385,
+      386,  387,  389,  391,  392,  393,  394,  395,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1087,15 +1285,16 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[67] =
+static const flex_int16_t yy_rule_linenum[72] =
     {   0,
       133,  135,  137,  142,  143,  148,  149,  150,  162,  165,
       170,  176,  185,  196,  207,  216,  225,  234,  244,  254,
-      264,  281,  298,  307,  316,  326,  336,  346,  357,  366,
-      376,  386,  396,  405,  414,  424,  433,  443,  452,  461,
-      470,  479,  488,  501,  510,  519,  528,  537,  547,  646,
-      651,  656,  661,  662,  663,  664,  665,  666,  668,  686,
-      699,  704,  708,  710,  712,  714
+      264,  274,  291,  308,  317,  326,  336,  346,  356,  366,
+      376,  387,  396,  406,  416,  426,  435,  444,  454,  463,
+      473,  482,  491,  500,  509,  518,  527,  536,  549,  558,
+      567,  576,  585,  595,  694,  699,  704,  709,  710,  711,
+      712,  713,  714,  716,  734,  747,  752,  756,  758,  760,
+      762
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1146,7 +1345,7 @@ unsigned int comment_start_line = 0;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::d2::D2ParserContext::fatal(msg)
-#line 1149 "d2_lexer.cc"
+#line 1348 "d2_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1172,8 +1371,8 @@ unsigned int comment_start_line = 0;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1175 "d2_lexer.cc"
-#line 1176 "d2_lexer.cc"
+#line 1374 "d2_lexer.cc"
+#line 1375 "d2_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1491,7 +1690,7 @@ YY_DECL
     }
 
 
-#line 1494 "d2_lexer.cc"
+#line 1693 "d2_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1520,13 +1719,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 417 )
+				if ( yy_current_state >= 478 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 416 );
+		while ( yy_current_state != 477 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -1545,13 +1744,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 67 )
+			else if ( yy_act < 72 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], yytext );
-			else if ( yy_act == 67 )
+			else if ( yy_act == 72 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         yytext );
-			else if ( yy_act == 68 )
+			else if ( yy_act == 73 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -1773,6 +1972,19 @@ YY_RULE_SETUP
 case 21:
 YY_RULE_SETUP
 #line 264 "d2_lexer.ll"
+{
+    /* dhcp-ddns value keywords are case insensitive */
+    if (driver.ctx_ == isc::d2::D2ParserContext::NCR_FORMAT) {
+        return isc::d2::D2Parser::make_BINARY(driver.loc_);
+    }
+    std::string tmp(yytext+1);
+    tmp.resize(tmp.size() - 1);
+    return isc::d2::D2Parser::make_STRING(tmp, driver.loc_);
+}
+	YY_BREAK
+case 22:
+YY_RULE_SETUP
+#line 274 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1790,9 +2002,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 22:
+case 23:
 YY_RULE_SETUP
-#line 281 "d2_lexer.ll"
+#line 291 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1810,9 +2022,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 23:
+case 24:
 YY_RULE_SETUP
-#line 298 "d2_lexer.ll"
+#line 308 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1822,9 +2034,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 24:
+case 25:
 YY_RULE_SETUP
-#line 307 "d2_lexer.ll"
+#line 317 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1834,9 +2046,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 25:
+case 26:
 YY_RULE_SETUP
-#line 316 "d2_lexer.ll"
+#line 326 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::FORWARD_DDNS:
@@ -1847,9 +2059,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 26:
+case 27:
 YY_RULE_SETUP
-#line 326 "d2_lexer.ll"
+#line 336 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DDNS_DOMAIN:
@@ -1860,9 +2072,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 27:
+case 28:
 YY_RULE_SETUP
-#line 336 "d2_lexer.ll"
+#line 346 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DDNS_DOMAIN:
@@ -1873,9 +2085,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 28:
+case 29:
 YY_RULE_SETUP
-#line 346 "d2_lexer.ll"
+#line 356 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DNS_SERVER:
@@ -1886,9 +2098,35 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 29:
+case 30:
+YY_RULE_SETUP
+#line 366 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DNS_SERVER:
+    case isc::d2::D2ParserContext::DNS_SERVERS:
+        return isc::d2::D2Parser::make_PROTOCOL(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("protocol", driver.loc_);
+    }
+}
+	YY_BREAK
+case 31:
 YY_RULE_SETUP
-#line 357 "d2_lexer.ll"
+#line 376 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DNS_SERVER:
+    case isc::d2::D2ParserContext::DNS_SERVERS:
+        return isc::d2::D2Parser::make_MAX_TRANSACTIONS(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("max-transactions", driver.loc_);
+    }
+}
+	YY_BREAK
+case 32:
+YY_RULE_SETUP
+#line 387 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1898,9 +2136,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 30:
+case 33:
 YY_RULE_SETUP
-#line 366 "d2_lexer.ll"
+#line 396 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::TSIG_KEY:
@@ -1911,9 +2149,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 31:
+case 34:
 YY_RULE_SETUP
-#line 376 "d2_lexer.ll"
+#line 406 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::TSIG_KEY:
@@ -1924,9 +2162,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 32:
+case 35:
 YY_RULE_SETUP
-#line 386 "d2_lexer.ll"
+#line 416 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::TSIG_KEY:
@@ -1937,9 +2175,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 33:
+case 36:
 YY_RULE_SETUP
-#line 396 "d2_lexer.ll"
+#line 426 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1949,9 +2187,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 34:
+case 37:
 YY_RULE_SETUP
-#line 405 "d2_lexer.ll"
+#line 435 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONTROL_SOCKET:
@@ -1961,9 +2199,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 35:
+case 38:
 YY_RULE_SETUP
-#line 414 "d2_lexer.ll"
+#line 444 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONTROL_SOCKET:
@@ -1973,9 +2211,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 36:
+case 39:
 YY_RULE_SETUP
-#line 424 "d2_lexer.ll"
+#line 454 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -1985,9 +2223,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 37:
+case 40:
 YY_RULE_SETUP
-#line 433 "d2_lexer.ll"
+#line 463 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1998,9 +2236,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 38:
+case 41:
 YY_RULE_SETUP
-#line 443 "d2_lexer.ll"
+#line 473 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -2010,9 +2248,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 39:
+case 42:
 YY_RULE_SETUP
-#line 452 "d2_lexer.ll"
+#line 482 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
@@ -2022,9 +2260,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 40:
+case 43:
 YY_RULE_SETUP
-#line 461 "d2_lexer.ll"
+#line 491 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
@@ -2034,9 +2272,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 41:
+case 44:
 YY_RULE_SETUP
-#line 470 "d2_lexer.ll"
+#line 500 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
@@ -2046,9 +2284,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 42:
+case 45:
 YY_RULE_SETUP
-#line 479 "d2_lexer.ll"
+#line 509 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
@@ -2058,9 +2296,33 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 43:
+case 46:
 YY_RULE_SETUP
-#line 488 "d2_lexer.ll"
+#line 518 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
+        return isc::d2::D2Parser::make_ASYNC(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("async", driver.loc_);
+    }
+}
+	YY_BREAK
+case 47:
+YY_RULE_SETUP
+#line 527 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
+        return isc::d2::D2Parser::make_ASYNC_QUEUE_SIZE(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("async-queue-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 48:
+YY_RULE_SETUP
+#line 536 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -2074,9 +2336,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 44:
+case 49:
 YY_RULE_SETUP
-#line 501 "d2_lexer.ll"
+#line 549 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -2086,9 +2348,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 45:
+case 50:
 YY_RULE_SETUP
-#line 510 "d2_lexer.ll"
+#line 558 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -2098,9 +2360,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 46:
+case 51:
 YY_RULE_SETUP
-#line 519 "d2_lexer.ll"
+#line 567 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -2110,9 +2372,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 47:
+case 52:
 YY_RULE_SETUP
-#line 528 "d2_lexer.ll"
+#line 576 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -2122,9 +2384,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 48:
+case 53:
 YY_RULE_SETUP
-#line 537 "d2_lexer.ll"
+#line 585 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -2134,9 +2396,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 49:
+case 54:
 YY_RULE_SETUP
-#line 547 "d2_lexer.ll"
+#line 595 "d2_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -2236,65 +2498,65 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 50:
-/* rule 50 can match eol */
+case 55:
+/* rule 55 can match eol */
 YY_RULE_SETUP
-#line 646 "d2_lexer.ll"
+#line 694 "d2_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 51:
-/* rule 51 can match eol */
+case 56:
+/* rule 56 can match eol */
 YY_RULE_SETUP
-#line 651 "d2_lexer.ll"
+#line 699 "d2_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 52:
+case 57:
 YY_RULE_SETUP
-#line 656 "d2_lexer.ll"
+#line 704 "d2_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 53:
+case 58:
 YY_RULE_SETUP
-#line 661 "d2_lexer.ll"
+#line 709 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 54:
+case 59:
 YY_RULE_SETUP
-#line 662 "d2_lexer.ll"
+#line 710 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 55:
+case 60:
 YY_RULE_SETUP
-#line 663 "d2_lexer.ll"
+#line 711 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 56:
+case 61:
 YY_RULE_SETUP
-#line 664 "d2_lexer.ll"
+#line 712 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 57:
+case 62:
 YY_RULE_SETUP
-#line 665 "d2_lexer.ll"
+#line 713 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 58:
+case 63:
 YY_RULE_SETUP
-#line 666 "d2_lexer.ll"
+#line 714 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 59:
+case 64:
 YY_RULE_SETUP
-#line 668 "d2_lexer.ll"
+#line 716 "d2_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -2313,9 +2575,9 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 60:
+case 65:
 YY_RULE_SETUP
-#line 686 "d2_lexer.ll"
+#line 734 "d2_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -2329,43 +2591,43 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 61:
+case 66:
 YY_RULE_SETUP
-#line 699 "d2_lexer.ll"
+#line 747 "d2_lexer.ll"
 {
     string tmp(yytext);
     return isc::d2::D2Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 62:
+case 67:
 YY_RULE_SETUP
-#line 704 "d2_lexer.ll"
+#line 752 "d2_lexer.ll"
 {
    return isc::d2::D2Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 63:
+case 68:
 YY_RULE_SETUP
-#line 708 "d2_lexer.ll"
+#line 756 "d2_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 64:
+case 69:
 YY_RULE_SETUP
-#line 710 "d2_lexer.ll"
+#line 758 "d2_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 65:
+case 70:
 YY_RULE_SETUP
-#line 712 "d2_lexer.ll"
+#line 760 "d2_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 66:
+case 71:
 YY_RULE_SETUP
-#line 714 "d2_lexer.ll"
+#line 762 "d2_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 716 "d2_lexer.ll"
+#line 764 "d2_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::d2::D2Parser::make_END(driver.loc_);
@@ -2389,12 +2651,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 67:
+case 72:
 YY_RULE_SETUP
-#line 739 "d2_lexer.ll"
+#line 787 "d2_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 2397 "d2_lexer.cc"
+#line 2659 "d2_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -2713,7 +2975,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 417 )
+			if ( yy_current_state >= 478 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -2746,11 +3008,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 417 )
+		if ( yy_current_state >= 478 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 416);
+	yy_is_jam = (yy_current_state == 477);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -3499,8 +3761,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 739 "d2_lexer.ll"
-
+#line 787 "d2_lexer.ll"
 
 using namespace isc::dhcp;
 
@@ -260,6 +260,16 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     return isc::d2::D2Parser::make_STRING(tmp, driver.loc_);
 }
 
+(?i:\"BINARY\") {
+    /* dhcp-ddns value keywords are case insensitive */
+    if (driver.ctx_ == isc::d2::D2ParserContext::NCR_FORMAT) {
+        return isc::d2::D2Parser::make_BINARY(driver.loc_);
+    }
+    std::string tmp(yytext+1);
+    tmp.resize(tmp.size() - 1);
+    return isc::d2::D2Parser::make_STRING(tmp, driver.loc_);
+}
+
 \"user-context\" {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -352,6 +362,26 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"protocol\" {
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DNS_SERVER:
+    case isc::d2::D2ParserContext::DNS_SERVERS:
+        return isc::d2::D2Parser::make_PROTOCOL(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("protocol", driver.loc_);
+    }
+}
+
+\"max-transactions\" {
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DNS_SERVER:
+    case isc::d2::D2ParserContext::DNS_SERVERS:
+        return isc::d2::D2Parser::make_MAX_TRANSACTIONS(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("max-transactions", driver.loc_);
+    }
+}
+
 
 \"tsig-keys\" {
     switch(driver.ctx_) {
@@ -484,6 +514,24 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"async\" {
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
+        return isc::d2::D2Parser::make_ASYNC(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("async", driver.loc_);
+    }
+}
+
+\"async-queue-size\" {
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
+        return isc::d2::D2Parser::make_ASYNC_QUEUE_SIZE(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("async-queue-size", driver.loc_);
+    }
+}
+
 \"name\" {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -10,6 +10,7 @@ namespace d2 {
 extern const isc::log::MessageID DHCP_DDNS_ADD_FAILED = "DHCP_DDNS_ADD_FAILED";
 extern const isc::log::MessageID DHCP_DDNS_ADD_SUCCEEDED = "DHCP_DDNS_ADD_SUCCEEDED";
 extern const isc::log::MessageID DHCP_DDNS_ALREADY_RUNNING = "DHCP_DDNS_ALREADY_RUNNING";
+extern const isc::log::MessageID DHCP_DDNS_AT_MAX_SERVER_TRANSACTIONS = "DHCP_DDNS_AT_MAX_SERVER_TRANSACTIONS";
 extern const isc::log::MessageID DHCP_DDNS_AT_MAX_TRANSACTIONS = "DHCP_DDNS_AT_MAX_TRANSACTIONS";
 extern const isc::log::MessageID DHCP_DDNS_CLEARED_FOR_SHUTDOWN = "DHCP_DDNS_CLEARED_FOR_SHUTDOWN";
 extern const isc::log::MessageID DHCP_DDNS_COMMAND = "DHCP_DDNS_COMMAND";
@@ -45,6 +46,7 @@ extern const isc::log::MessageID DHCP_DDNS_NO_FWD_MATCH_ERROR = "DHCP_DDNS_NO_FW
 extern const isc::log::MessageID DHCP_DDNS_NO_MATCH = "DHCP_DDNS_NO_MATCH";
 extern const isc::log::MessageID DHCP_DDNS_NO_REV_MATCH_ERROR = "DHCP_DDNS_NO_REV_MATCH_ERROR";
 extern const isc::log::MessageID DHCP_DDNS_PROCESS_INIT = "DHCP_DDNS_PROCESS_INIT";
+extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_NCR_COALESCED = "DHCP_DDNS_QUEUE_MGR_NCR_COALESCED";
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_QUEUE_FULL = "DHCP_DDNS_QUEUE_MGR_QUEUE_FULL";
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_QUEUE_RECEIVE = "DHCP_DDNS_QUEUE_MGR_QUEUE_RECEIVE";
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_RECONFIGURING = "DHCP_DDNS_QUEUE_MGR_RECONFIGURING";
@@ -78,6 +80,10 @@ extern const isc::log::MessageID DHCP_DDNS_SHUTDOWN_COMMAND = "DHCP_DDNS_SHUTDOW
 extern const isc::log::MessageID DHCP_DDNS_STARTED = "DHCP_DDNS_STARTED";
 extern const isc::log::MessageID DHCP_DDNS_STARTING_TRANSACTION = "DHCP_DDNS_STARTING_TRANSACTION";
 extern const isc::log::MessageID DHCP_DDNS_STATE_MODEL_UNEXPECTED_ERROR = "DHCP_DDNS_STATE_MODEL_UNEXPECTED_ERROR";
+extern const isc::log::MessageID DHCP_DDNS_TCP_CONNECTED = "DHCP_DDNS_TCP_CONNECTED";
+extern const isc::log::MessageID DHCP_DDNS_TCP_CONNECT_FAILED = "DHCP_DDNS_TCP_CONNECT_FAILED";
+extern const isc::log::MessageID DHCP_DDNS_TCP_RECONNECT = "DHCP_DDNS_TCP_RECONNECT";
+extern const isc::log::MessageID DHCP_DDNS_TCP_UNEXPECTED_RESPONSE = "DHCP_DDNS_TCP_UNEXPECTED_RESPONSE";
 extern const isc::log::MessageID DHCP_DDNS_TRANS_SEND_ERROR = "DHCP_DDNS_TRANS_SEND_ERROR";
 extern const isc::log::MessageID DHCP_DDNS_UPDATE_REQUEST_SENT = "DHCP_DDNS_UPDATE_REQUEST_SENT";
 extern const isc::log::MessageID DHCP_DDNS_UPDATE_RESPONSE_RECEIVED = "DHCP_DDNS_UPDATE_RESPONSE_RECEIVED";
@@ -91,6 +97,7 @@ const char* values[] = {
     "DHCP_DDNS_ADD_FAILED", "DHCP_DDNS Request ID %1: Transaction outcome %2",
     "DHCP_DDNS_ADD_SUCCEEDED", "DHCP_DDNS Request ID %1: successfully added the DNS mapping addition for this request: %2",
     "DHCP_DDNS_ALREADY_RUNNING", "%1 already running? %2",
+    "DHCP_DDNS_AT_MAX_SERVER_TRANSACTIONS", "Request ID %1: request postponed as DNS server %2 port %3 has reached maximum number of %4 concurrent transactions",
     "DHCP_DDNS_AT_MAX_TRANSACTIONS", "application has %1 queued requests but has reached maximum number of %2 concurrent transactions",
     "DHCP_DDNS_CLEARED_FOR_SHUTDOWN", "application has met shutdown criteria for shutdown type: %1",
     "DHCP_DDNS_COMMAND", "command directive received, command: %1 - args: %2",
@@ -126,6 +133,7 @@ const char* values[] = {
     "DHCP_DDNS_NO_MATCH", "No DNS servers match FQDN %1",
     "DHCP_DDNS_NO_REV_MATCH_ERROR", "Request ID %1: the configured list of reverse DDNS domains does not contain a match for: %2  The request has been discarded.",
     "DHCP_DDNS_PROCESS_INIT", "application init invoked",
+    "DHCP_DDNS_QUEUE_MGR_NCR_COALESCED", "Request ID %1: received request replaces the queued request for the same client and FQDN",
     "DHCP_DDNS_QUEUE_MGR_QUEUE_FULL", "application request queue has reached maximum number of entries %1",
     "DHCP_DDNS_QUEUE_MGR_QUEUE_RECEIVE", "Request ID %1: received and queued a request.",
     "DHCP_DDNS_QUEUE_MGR_RECONFIGURING", "application is reconfiguring the queue manager",
@@ -159,6 +167,10 @@ const char* values[] = {
     "DHCP_DDNS_STARTED", "Kea DHCP-DDNS server version %1 started",
     "DHCP_DDNS_STARTING_TRANSACTION", "Request ID %1:",
     "DHCP_DDNS_STATE_MODEL_UNEXPECTED_ERROR", "Request ID %1: application encountered an unexpected error while carrying out a NameChangeRequest: %2",
+    "DHCP_DDNS_TCP_CONNECTED", "connected over TCP to DNS server %1",
+    "DHCP_DDNS_TCP_CONNECT_FAILED", "failed to connect over TCP to DNS server %1: %2",
+    "DHCP_DDNS_TCP_RECONNECT", "DNS server %1 closed the TCP connection with %2 DNS updates pending, reconnecting to send them again",
+    "DHCP_DDNS_TCP_UNEXPECTED_RESPONSE", "discarded response with ID %1 received over TCP from DNS server %2",
     "DHCP_DDNS_TRANS_SEND_ERROR", "Request ID %1: application encountered an unexpected error while attempting to send a DNS update: %2",
     "DHCP_DDNS_UPDATE_REQUEST_SENT", "Request ID %1: %2 to server: %3",
     "DHCP_DDNS_UPDATE_RESPONSE_RECEIVED", "Request ID %1: to server: %2 status: %3",
@@ -11,6 +11,7 @@ namespace d2 {
 extern const isc::log::MessageID DHCP_DDNS_ADD_FAILED;
 extern const isc::log::MessageID DHCP_DDNS_ADD_SUCCEEDED;
 extern const isc::log::MessageID DHCP_DDNS_ALREADY_RUNNING;
+extern const isc::log::MessageID DHCP_DDNS_AT_MAX_SERVER_TRANSACTIONS;
 extern const isc::log::MessageID DHCP_DDNS_AT_MAX_TRANSACTIONS;
 extern const isc::log::MessageID DHCP_DDNS_CLEARED_FOR_SHUTDOWN;
 extern const isc::log::MessageID DHCP_DDNS_COMMAND;
@@ -46,6 +47,7 @@ extern const isc::log::MessageID DHCP_DDNS_NO_FWD_MATCH_ERROR;
 extern const isc::log::MessageID DHCP_DDNS_NO_MATCH;
 extern const isc::log::MessageID DHCP_DDNS_NO_REV_MATCH_ERROR;
 extern const isc::log::MessageID DHCP_DDNS_PROCESS_INIT;
+extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_NCR_COALESCED;
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_QUEUE_FULL;
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_QUEUE_RECEIVE;
 extern const isc::log::MessageID DHCP_DDNS_QUEUE_MGR_RECONFIGURING;
@@ -79,6 +81,10 @@ extern const isc::log::MessageID DHCP_DDNS_SHUTDOWN_COMMAND;
 extern const isc::log::MessageID DHCP_DDNS_STARTED;
 extern const isc::log::MessageID DHCP_DDNS_STARTING_TRANSACTION;
 extern const isc::log::MessageID DHCP_DDNS_STATE_MODEL_UNEXPECTED_ERROR;
+extern const isc::log::MessageID DHCP_DDNS_TCP_CONNECTED;
+extern const isc::log::MessageID DHCP_DDNS_TCP_CONNECT_FAILED;
+extern const isc::log::MessageID DHCP_DDNS_TCP_RECONNECT;
+extern const isc::log::MessageID DHCP_DDNS_TCP_UNEXPECTED_RESPONSE;
 extern const isc::log::MessageID DHCP_DDNS_TRANS_SEND_ERROR;
 extern const isc::log::MessageID DHCP_DDNS_UPDATE_REQUEST_SENT;
 extern const isc::log::MessageID DHCP_DDNS_UPDATE_RESPONSE_RECEIVED;
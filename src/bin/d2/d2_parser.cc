@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.4.1.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015, 2018-2019 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,8 +30,9 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
-// Undocumented macros, especially those whose name start with YY_,
-// are private implementation details.  Do not rely on them.
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
 
 
 // Take the name prefix into account.
@@ -47,7 +48,7 @@
 
 #include <d2/parser_context.h>
 
-#line 51 "d2_parser.cc"
+#line 52 "d2_parser.cc"
 
 
 #ifndef YY_
@@ -62,6 +63,7 @@
 # endif
 #endif
 
+
 // Whether we are compiled with exception support.
 #ifndef YY_EXCEPTIONS
 # if defined __GNUC__ && !defined __EXCEPTIONS
@@ -92,9 +94,6 @@
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if D2_PARSER_DEBUG
 
@@ -120,13 +119,13 @@
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !D2_PARSER_DEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE (Symbol)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
 # define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
 # define YY_STACK_PRINT()                static_cast<void> (0)
 
@@ -142,56 +141,15 @@
 
 #line 14 "d2_parser.yy"
 namespace isc { namespace d2 {
-#line 146 "d2_parser.cc"
-
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  D2Parser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr;
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              else
-                goto append;
-
-            append:
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 145 "d2_parser.cc"
 
   /// Build a parser object.
   D2Parser::D2Parser (isc::d2::D2ParserContext& ctx_yyarg)
-    :
 #if D2_PARSER_DEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       ctx (ctx_yyarg)
   {}
@@ -202,9 +160,9 @@ namespace isc { namespace d2 {
   D2Parser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
   {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
@@ -234,13 +192,13 @@ namespace isc { namespace d2 {
     : state (s)
   {}
 
-  D2Parser::symbol_number_type
-  D2Parser::by_state::type_get () const YY_NOEXCEPT
+  D2Parser::symbol_kind_type
+  D2Parser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
   D2Parser::stack_symbol_type::stack_symbol_type ()
@@ -249,27 +207,28 @@ namespace isc { namespace d2 {
   D2Parser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
     : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
   {
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 71: // value
-      case 75: // map_value
-      case 99: // ncr_protocol_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
         value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 59: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
         break;
 
-      case 58: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
         break;
 
-      case 57: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 56: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
         break;
 
@@ -286,27 +245,28 @@ namespace isc { namespace d2 {
   D2Parser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
     : super_type (s, YY_MOVE (that.location))
   {
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 71: // value
-      case 75: // map_value
-      case 99: // ncr_protocol_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
         value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 59: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 58: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 57: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 56: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (YY_MOVE (that.value));
         break;
 
@@ -315,35 +275,73 @@ namespace isc { namespace d2 {
     }
 
     // that is emptied.
-    that.type = empty_symbol;
+    that.kind_ = symbol_kind::S_YYEMPTY;
   }
 
 #if YY_CPLUSPLUS < 201103L
+  D2Parser::stack_symbol_type&
+  D2Parser::stack_symbol_type::operator= (const stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+        value.copy< ElementPtr > (that.value);
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.copy< bool > (that.value);
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.copy< double > (that.value);
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.copy< int64_t > (that.value);
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.copy< std::string > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    return *this;
+  }
+
   D2Parser::stack_symbol_type&
   D2Parser::stack_symbol_type::operator= (stack_symbol_type& that)
   {
     state = that.state;
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 71: // value
-      case 75: // map_value
-      case 99: // ncr_protocol_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 59: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 58: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 57: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 56: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -369,69 +367,73 @@ namespace isc { namespace d2 {
 #if D2_PARSER_DEBUG
   template <typename Base>
   void
-  D2Parser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  D2Parser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-#if defined __GNUC__ && ! defined __clang__ && ! defined __ICC && __GNUC__ * 100 + __GNUC_MINOR__ <= 408
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-#endif
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    switch (yytype)
-    {
-      case 56: // "constant string"
-#line 115 "d2_parser.yy"
-        { yyoutput << yysym.value.template as < std::string > (); }
-#line 393 "d2_parser.cc"
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        switch (yykind)
+    {
+      case symbol_kind::S_STRING: // "constant string"
+#line 121 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < std::string > (); }
+#line 388 "d2_parser.cc"
         break;
 
-      case 57: // "integer"
-#line 115 "d2_parser.yy"
-        { yyoutput << yysym.value.template as < int64_t > (); }
-#line 399 "d2_parser.cc"
+      case symbol_kind::S_INTEGER: // "integer"
+#line 121 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < int64_t > (); }
+#line 394 "d2_parser.cc"
         break;
 
-      case 58: // "floating point"
-#line 115 "d2_parser.yy"
-        { yyoutput << yysym.value.template as < double > (); }
-#line 405 "d2_parser.cc"
+      case symbol_kind::S_FLOAT: // "floating point"
+#line 121 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < double > (); }
+#line 400 "d2_parser.cc"
         break;
 
-      case 59: // "boolean"
-#line 115 "d2_parser.yy"
-        { yyoutput << yysym.value.template as < bool > (); }
-#line 411 "d2_parser.cc"
+      case symbol_kind::S_BOOLEAN: // "boolean"
+#line 121 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < bool > (); }
+#line 406 "d2_parser.cc"
         break;
 
-      case 71: // value
-#line 115 "d2_parser.yy"
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 417 "d2_parser.cc"
+      case symbol_kind::S_value: // value
+#line 121 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 412 "d2_parser.cc"
         break;
 
-      case 75: // map_value
-#line 115 "d2_parser.yy"
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 423 "d2_parser.cc"
+      case symbol_kind::S_map_value: // map_value
+#line 121 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 418 "d2_parser.cc"
         break;
 
-      case 99: // ncr_protocol_value
-#line 115 "d2_parser.yy"
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 429 "d2_parser.cc"
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+#line 121 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 424 "d2_parser.cc"
+        break;
+
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+#line 121 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 430 "d2_parser.cc"
         break;
 
       default:
         break;
     }
-    yyo << ')';
+        yyo << ')';
+      }
   }
 #endif
 
@@ -455,7 +457,7 @@ namespace isc { namespace d2 {
   }
 
   void
-  D2Parser::yypop_ (int n)
+  D2Parser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -490,21 +492,21 @@ namespace isc { namespace d2 {
   D2Parser::state_type
   D2Parser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
   bool
-  D2Parser::yy_pact_value_is_default_ (int yyvalue)
+  D2Parser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
   bool
-  D2Parser::yy_table_value_is_error_ (int yyvalue)
+  D2Parser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
@@ -518,7 +520,6 @@ namespace isc { namespace d2 {
   int
   D2Parser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -554,7 +555,8 @@ namespace isc { namespace d2 {
   | yynewstate -- push a new symbol on the stack.  |
   `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << '\n';
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
@@ -568,14 +570,14 @@ namespace isc { namespace d2 {
   `-----------*/
   yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
 #if YY_EXCEPTIONS
         try
 #endif // YY_EXCEPTIONS
@@ -594,11 +596,23 @@ namespace isc { namespace d2 {
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -615,7 +629,7 @@ namespace isc { namespace d2 {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, YY_MOVE (yyla));
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
 
@@ -623,7 +637,7 @@ namespace isc { namespace d2 {
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
@@ -642,25 +656,26 @@ namespace isc { namespace d2 {
          when using variants.  */
       switch (yyr1_[yyn])
     {
-      case 71: // value
-      case 75: // map_value
-      case 99: // ncr_protocol_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
         yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 59: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         yylhs.value.emplace< bool > ();
         break;
 
-      case 58: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         yylhs.value.emplace< double > ();
         break;
 
-      case 57: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         yylhs.value.emplace< int64_t > ();
         break;
 
-      case 56: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         yylhs.value.emplace< std::string > ();
         break;
 
@@ -684,295 +699,295 @@ namespace isc { namespace d2 {
         {
           switch (yyn)
             {
-  case 2:
-#line 124 "d2_parser.yy"
-    { ctx.ctx_ = ctx.NO_KEYWORD; }
-#line 691 "d2_parser.cc"
+  case 2: // $@1: %empty
+#line 130 "d2_parser.yy"
+                     { ctx.ctx_ = ctx.NO_KEYWORD; }
+#line 706 "d2_parser.cc"
     break;
 
-  case 4:
-#line 125 "d2_parser.yy"
-    { ctx.ctx_ = ctx.CONFIG; }
-#line 697 "d2_parser.cc"
+  case 4: // $@2: %empty
+#line 131 "d2_parser.yy"
+                         { ctx.ctx_ = ctx.CONFIG; }
+#line 712 "d2_parser.cc"
     break;
 
-  case 6:
-#line 126 "d2_parser.yy"
-    { ctx.ctx_ = ctx.DHCPDDNS; }
-#line 703 "d2_parser.cc"
+  case 6: // $@3: %empty
+#line 132 "d2_parser.yy"
+                    { ctx.ctx_ = ctx.DHCPDDNS; }
+#line 718 "d2_parser.cc"
     break;
 
-  case 8:
-#line 127 "d2_parser.yy"
-    { ctx.ctx_ = ctx.TSIG_KEY; }
-#line 709 "d2_parser.cc"
+  case 8: // $@4: %empty
+#line 133 "d2_parser.yy"
+                    { ctx.ctx_ = ctx.TSIG_KEY; }
+#line 724 "d2_parser.cc"
     break;
 
-  case 10:
-#line 128 "d2_parser.yy"
-    { ctx.ctx_ = ctx.TSIG_KEYS; }
-#line 715 "d2_parser.cc"
+  case 10: // $@5: %empty
+#line 134 "d2_parser.yy"
+                     { ctx.ctx_ = ctx.TSIG_KEYS; }
+#line 730 "d2_parser.cc"
     break;
 
-  case 12:
-#line 129 "d2_parser.yy"
-    { ctx.ctx_ = ctx.DDNS_DOMAIN; }
-#line 721 "d2_parser.cc"
+  case 12: // $@6: %empty
+#line 135 "d2_parser.yy"
+                       { ctx.ctx_ = ctx.DDNS_DOMAIN; }
+#line 736 "d2_parser.cc"
     break;
 
-  case 14:
-#line 130 "d2_parser.yy"
-    { ctx.ctx_ = ctx.DDNS_DOMAINS; }
-#line 727 "d2_parser.cc"
+  case 14: // $@7: %empty
+#line 136 "d2_parser.yy"
+                        { ctx.ctx_ = ctx.DDNS_DOMAINS; }
+#line 742 "d2_parser.cc"
     break;
 
-  case 16:
-#line 131 "d2_parser.yy"
-    { ctx.ctx_ = ctx.DNS_SERVERS; }
-#line 733 "d2_parser.cc"
+  case 16: // $@8: %empty
+#line 137 "d2_parser.yy"
+                      { ctx.ctx_ = ctx.DNS_SERVERS; }
+#line 748 "d2_parser.cc"
     break;
 
-  case 18:
-#line 132 "d2_parser.yy"
-    { ctx.ctx_ = ctx.DNS_SERVERS; }
-#line 739 "d2_parser.cc"
+  case 18: // $@9: %empty
+#line 138 "d2_parser.yy"
+                       { ctx.ctx_ = ctx.DNS_SERVERS; }
+#line 754 "d2_parser.cc"
     break;
 
-  case 20:
-#line 140 "d2_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
-#line 745 "d2_parser.cc"
+  case 20: // value: "integer"
+#line 146 "d2_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
+#line 760 "d2_parser.cc"
     break;
 
-  case 21:
-#line 141 "d2_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
-#line 751 "d2_parser.cc"
+  case 21: // value: "floating point"
+#line 147 "d2_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
+#line 766 "d2_parser.cc"
     break;
 
-  case 22:
-#line 142 "d2_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
-#line 757 "d2_parser.cc"
+  case 22: // value: "boolean"
+#line 148 "d2_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
+#line 772 "d2_parser.cc"
     break;
 
-  case 23:
-#line 143 "d2_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
-#line 763 "d2_parser.cc"
+  case 23: // value: "constant string"
+#line 149 "d2_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
+#line 778 "d2_parser.cc"
     break;
 
-  case 24:
-#line 144 "d2_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
-#line 769 "d2_parser.cc"
+  case 24: // value: "null"
+#line 150 "d2_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
+#line 784 "d2_parser.cc"
     break;
 
-  case 25:
-#line 145 "d2_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 775 "d2_parser.cc"
+  case 25: // value: map2
+#line 151 "d2_parser.yy"
+            { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 790 "d2_parser.cc"
     break;
 
-  case 26:
-#line 146 "d2_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 781 "d2_parser.cc"
+  case 26: // value: list_generic
+#line 152 "d2_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 796 "d2_parser.cc"
     break;
 
-  case 27:
-#line 149 "d2_parser.yy"
-    {
+  case 27: // sub_json: value
+#line 155 "d2_parser.yy"
+                {
     // Push back the JSON value on the stack
     ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
 }
-#line 790 "d2_parser.cc"
+#line 805 "d2_parser.cc"
     break;
 
-  case 28:
-#line 154 "d2_parser.yy"
-    {
+  case 28: // $@10: %empty
+#line 160 "d2_parser.yy"
+                     {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 801 "d2_parser.cc"
+#line 816 "d2_parser.cc"
     break;
 
-  case 29:
-#line 159 "d2_parser.yy"
-    {
+  case 29: // map2: "{" $@10 map_content "}"
+#line 165 "d2_parser.yy"
+                             {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 811 "d2_parser.cc"
+#line 826 "d2_parser.cc"
     break;
 
-  case 30:
-#line 165 "d2_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 817 "d2_parser.cc"
+  case 30: // map_value: map2
+#line 171 "d2_parser.yy"
+                { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 832 "d2_parser.cc"
     break;
 
-  case 33:
-#line 172 "d2_parser.yy"
-    {
+  case 33: // not_empty_map: "constant string" ":" value
+#line 178 "d2_parser.yy"
+                                  {
                   // map containing a single entry
                   ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 826 "d2_parser.cc"
+#line 841 "d2_parser.cc"
     break;
 
-  case 34:
-#line 176 "d2_parser.yy"
-    {
+  case 34: // not_empty_map: not_empty_map "," "constant string" ":" value
+#line 182 "d2_parser.yy"
+                                                      {
                   // map consisting of a shorter map followed by
                   // comma and string:value
                   ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 836 "d2_parser.cc"
+#line 851 "d2_parser.cc"
     break;
 
-  case 35:
-#line 183 "d2_parser.yy"
-    {
+  case 35: // $@11: %empty
+#line 189 "d2_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 845 "d2_parser.cc"
+#line 860 "d2_parser.cc"
     break;
 
-  case 36:
-#line 186 "d2_parser.yy"
-    {
+  case 36: // list_generic: "[" $@11 list_content "]"
+#line 192 "d2_parser.yy"
+                               {
     // list parsing complete. Put any sanity checking here
 }
-#line 853 "d2_parser.cc"
+#line 868 "d2_parser.cc"
     break;
 
-  case 39:
-#line 194 "d2_parser.yy"
-    {
+  case 39: // not_empty_list: value
+#line 200 "d2_parser.yy"
+                      {
                   // List consisting of a single element.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 862 "d2_parser.cc"
+#line 877 "d2_parser.cc"
     break;
 
-  case 40:
-#line 198 "d2_parser.yy"
-    {
+  case 40: // not_empty_list: not_empty_list "," value
+#line 204 "d2_parser.yy"
+                                           {
                   // List ending with , and a value.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 871 "d2_parser.cc"
+#line 886 "d2_parser.cc"
     break;
 
-  case 41:
-#line 209 "d2_parser.yy"
-    {
+  case 41: // unknown_map_entry: "constant string" ":"
+#line 215 "d2_parser.yy"
+                                {
     const std::string& where = ctx.contextName();
     const std::string& keyword = yystack_[1].value.as < std::string > ();
     error(yystack_[1].location,
           "got unexpected keyword \"" + keyword + "\" in " + where + " map.");
 }
-#line 882 "d2_parser.cc"
+#line 897 "d2_parser.cc"
     break;
 
-  case 42:
-#line 219 "d2_parser.yy"
-    {
+  case 42: // $@12: %empty
+#line 225 "d2_parser.yy"
+                           {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 893 "d2_parser.cc"
+#line 908 "d2_parser.cc"
     break;
 
-  case 43:
-#line 224 "d2_parser.yy"
-    {
+  case 43: // syntax_map: "{" $@12 global_objects "}"
+#line 230 "d2_parser.yy"
+                                {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 903 "d2_parser.cc"
+#line 918 "d2_parser.cc"
     break;
 
-  case 52:
-#line 246 "d2_parser.yy"
-    {
+  case 52: // $@13: %empty
+#line 252 "d2_parser.yy"
+                          {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("DhcpDdns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCPDDNS);
 }
-#line 914 "d2_parser.cc"
+#line 929 "d2_parser.cc"
     break;
 
-  case 53:
-#line 251 "d2_parser.yy"
-    {
+  case 53: // dhcpddns_object: "DhcpDdns" $@13 ":" "{" dhcpddns_params "}"
+#line 257 "d2_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 923 "d2_parser.cc"
+#line 938 "d2_parser.cc"
     break;
 
-  case 54:
-#line 256 "d2_parser.yy"
-    {
+  case 54: // $@14: %empty
+#line 262 "d2_parser.yy"
+                             {
     // Parse the dhcpddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 933 "d2_parser.cc"
+#line 948 "d2_parser.cc"
     break;
 
-  case 55:
-#line 260 "d2_parser.yy"
-    {
+  case 55: // sub_dhcpddns: "{" $@14 dhcpddns_params "}"
+#line 266 "d2_parser.yy"
+                                 {
     // parsing completed
 }
-#line 941 "d2_parser.cc"
+#line 956 "d2_parser.cc"
     break;
 
-  case 71:
-#line 284 "d2_parser.yy"
-    {
+  case 71: // $@15: %empty
+#line 290 "d2_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 949 "d2_parser.cc"
+#line 964 "d2_parser.cc"
     break;
 
-  case 72:
-#line 286 "d2_parser.yy"
-    {
+  case 72: // ip_address: "ip-address" $@15 ":" "constant string"
+#line 292 "d2_parser.yy"
+               {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", s);
     ctx.leave();
 }
-#line 959 "d2_parser.cc"
+#line 974 "d2_parser.cc"
     break;
 
-  case 73:
-#line 292 "d2_parser.yy"
-    {
+  case 73: // port: "port" ":" "integer"
+#line 298 "d2_parser.yy"
+                         {
     if (yystack_[0].value.as < int64_t > () <= 0 || yystack_[0].value.as < int64_t > () >= 65536 ) {
         error(yystack_[0].location, "port must be greater than zero but less than 65536");
     }
     ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", i);
 }
-#line 971 "d2_parser.cc"
+#line 986 "d2_parser.cc"
     break;
 
-  case 74:
-#line 300 "d2_parser.yy"
-    {
+  case 74: // dns_server_timeout: "dns-server-timeout" ":" "integer"
+#line 306 "d2_parser.yy"
+                                                     {
     if (yystack_[0].value.as < int64_t > () <= 0) {
         error(yystack_[0].location, "dns-server-timeout must be greater than zero");
     } else {
@@ -980,67 +995,78 @@ namespace isc { namespace d2 {
         ctx.stack_.back()->set("dns-server-timeout", i);
     }
 }
-#line 984 "d2_parser.cc"
+#line 999 "d2_parser.cc"
     break;
 
-  case 75:
-#line 309 "d2_parser.yy"
-    {
+  case 75: // $@16: %empty
+#line 315 "d2_parser.yy"
+                           {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 992 "d2_parser.cc"
+#line 1007 "d2_parser.cc"
     break;
 
-  case 76:
-#line 311 "d2_parser.yy"
-    {
+  case 76: // ncr_protocol: "ncr-protocol" $@16 ":" ncr_protocol_value
+#line 317 "d2_parser.yy"
+                           {
     ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1001 "d2_parser.cc"
+#line 1016 "d2_parser.cc"
     break;
 
-  case 77:
-#line 317 "d2_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 1007 "d2_parser.cc"
+  case 77: // ncr_protocol_value: "UDP"
+#line 323 "d2_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
+#line 1022 "d2_parser.cc"
     break;
 
-  case 78:
-#line 318 "d2_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 1013 "d2_parser.cc"
+  case 78: // ncr_protocol_value: "TCP"
+#line 324 "d2_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
+#line 1028 "d2_parser.cc"
     break;
 
-  case 79:
-#line 321 "d2_parser.yy"
-    {
+  case 79: // $@17: %empty
+#line 327 "d2_parser.yy"
+                       {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 1021 "d2_parser.cc"
+#line 1036 "d2_parser.cc"
     break;
 
-  case 80:
-#line 323 "d2_parser.yy"
-    {
-    ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
-    ctx.stack_.back()->set("ncr-format", json);
+  case 80: // ncr_format: "ncr-format" $@17 ":" ncr_format_value
+#line 329 "d2_parser.yy"
+                         {
+    ctx.stack_.back()->set("ncr-format", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1031 "d2_parser.cc"
+#line 1045 "d2_parser.cc"
     break;
 
-  case 81:
-#line 329 "d2_parser.yy"
-    {
+  case 81: // ncr_format_value: "JSON"
+#line 335 "d2_parser.yy"
+         { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("JSON", ctx.loc2pos(yystack_[0].location))); }
+#line 1051 "d2_parser.cc"
+    break;
+
+  case 82: // ncr_format_value: "BINARY"
+#line 336 "d2_parser.yy"
+           { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("BINARY", ctx.loc2pos(yystack_[0].location))); }
+#line 1057 "d2_parser.cc"
+    break;
+
+  case 83: // $@18: %empty
+#line 339 "d2_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1039 "d2_parser.cc"
+#line 1065 "d2_parser.cc"
     break;
 
-  case 82:
-#line 331 "d2_parser.yy"
-    {
+  case 84: // user_context: "user-context" $@18 ":" map_value
+#line 341 "d2_parser.yy"
+                  {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context = yystack_[0].value.as < ElementPtr > ();
     ConstElementPtr old = parent->get("user-context");
@@ -1062,20 +1088,20 @@ namespace isc { namespace d2 {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 1066 "d2_parser.cc"
+#line 1092 "d2_parser.cc"
     break;
 
-  case 83:
-#line 354 "d2_parser.yy"
-    {
+  case 85: // $@19: %empty
+#line 364 "d2_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1074 "d2_parser.cc"
+#line 1100 "d2_parser.cc"
     break;
 
-  case 84:
-#line 356 "d2_parser.yy"
-    {
+  case 86: // comment: "comment" $@19 ":" "constant string"
+#line 366 "d2_parser.yy"
+               {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
     ElementPtr comment(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
@@ -1099,132 +1125,132 @@ namespace isc { namespace d2 {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 1103 "d2_parser.cc"
+#line 1129 "d2_parser.cc"
     break;
 
-  case 85:
-#line 381 "d2_parser.yy"
-    {
+  case 87: // $@20: %empty
+#line 391 "d2_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("forward-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.FORWARD_DDNS);
 }
-#line 1114 "d2_parser.cc"
+#line 1140 "d2_parser.cc"
     break;
 
-  case 86:
-#line 386 "d2_parser.yy"
-    {
+  case 88: // forward_ddns: "forward-ddns" $@20 ":" "{" ddns_mgr_params "}"
+#line 396 "d2_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1123 "d2_parser.cc"
+#line 1149 "d2_parser.cc"
     break;
 
-  case 87:
-#line 391 "d2_parser.yy"
-    {
+  case 89: // $@21: %empty
+#line 401 "d2_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reverse-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.REVERSE_DDNS);
 }
-#line 1134 "d2_parser.cc"
+#line 1160 "d2_parser.cc"
     break;
 
-  case 88:
-#line 396 "d2_parser.yy"
-    {
+  case 90: // reverse_ddns: "reverse-ddns" $@21 ":" "{" ddns_mgr_params "}"
+#line 406 "d2_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1143 "d2_parser.cc"
+#line 1169 "d2_parser.cc"
     break;
 
-  case 95:
-#line 415 "d2_parser.yy"
-    {
+  case 97: // $@22: %empty
+#line 425 "d2_parser.yy"
+                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-domains", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.DDNS_DOMAINS);
 }
-#line 1154 "d2_parser.cc"
+#line 1180 "d2_parser.cc"
     break;
 
-  case 96:
-#line 420 "d2_parser.yy"
-    {
+  case 98: // ddns_domains: "ddns-domains" $@22 ":" "[" ddns_domain_list "]"
+#line 430 "d2_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1163 "d2_parser.cc"
+#line 1189 "d2_parser.cc"
     break;
 
-  case 97:
-#line 425 "d2_parser.yy"
-    {
+  case 99: // $@23: %empty
+#line 435 "d2_parser.yy"
+                                  {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 1172 "d2_parser.cc"
+#line 1198 "d2_parser.cc"
     break;
 
-  case 98:
-#line 428 "d2_parser.yy"
-    {
+  case 100: // sub_ddns_domains: "[" $@23 ddns_domain_list "]"
+#line 438 "d2_parser.yy"
+                                   {
     // parsing completed
 }
-#line 1180 "d2_parser.cc"
+#line 1206 "d2_parser.cc"
     break;
 
-  case 103:
-#line 440 "d2_parser.yy"
-    {
+  case 105: // $@24: %empty
+#line 450 "d2_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1190 "d2_parser.cc"
+#line 1216 "d2_parser.cc"
     break;
 
-  case 104:
-#line 444 "d2_parser.yy"
-    {
+  case 106: // ddns_domain: "{" $@24 ddns_domain_params "}"
+#line 454 "d2_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 1198 "d2_parser.cc"
+#line 1224 "d2_parser.cc"
     break;
 
-  case 105:
-#line 448 "d2_parser.yy"
-    {
+  case 107: // $@25: %empty
+#line 458 "d2_parser.yy"
+                                {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1207 "d2_parser.cc"
+#line 1233 "d2_parser.cc"
     break;
 
-  case 106:
-#line 451 "d2_parser.yy"
-    {
+  case 108: // sub_ddns_domain: "{" $@25 ddns_domain_params "}"
+#line 461 "d2_parser.yy"
+                                    {
     // parsing completed
 }
-#line 1215 "d2_parser.cc"
+#line 1241 "d2_parser.cc"
     break;
 
-  case 115:
-#line 468 "d2_parser.yy"
-    {
+  case 117: // $@26: %empty
+#line 478 "d2_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1223 "d2_parser.cc"
+#line 1249 "d2_parser.cc"
     break;
 
-  case 116:
-#line 470 "d2_parser.yy"
-    {
+  case 118: // ddns_domain_name: "name" $@26 ":" "constant string"
+#line 480 "d2_parser.yy"
+               {
     if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "Ddns domain name cannot be blank");
     }
@@ -1233,111 +1259,111 @@ namespace isc { namespace d2 {
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1237 "d2_parser.cc"
+#line 1263 "d2_parser.cc"
     break;
 
-  case 117:
-#line 480 "d2_parser.yy"
-    {
+  case 119: // $@27: %empty
+#line 490 "d2_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1245 "d2_parser.cc"
+#line 1271 "d2_parser.cc"
     break;
 
-  case 118:
-#line 482 "d2_parser.yy"
-    {
+  case 120: // ddns_domain_key_name: "key-name" $@27 ":" "constant string"
+#line 492 "d2_parser.yy"
+               {
     ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("key-name", name);
     ctx.leave();
 }
-#line 1256 "d2_parser.cc"
+#line 1282 "d2_parser.cc"
     break;
 
-  case 119:
-#line 492 "d2_parser.yy"
-    {
+  case 121: // $@28: %empty
+#line 502 "d2_parser.yy"
+                         {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dns-servers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.DNS_SERVERS);
 }
-#line 1267 "d2_parser.cc"
+#line 1293 "d2_parser.cc"
     break;
 
-  case 120:
-#line 497 "d2_parser.yy"
-    {
+  case 122: // dns_servers: "dns-servers" $@28 ":" "[" dns_server_list "]"
+#line 507 "d2_parser.yy"
+                                                        {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1276 "d2_parser.cc"
+#line 1302 "d2_parser.cc"
     break;
 
-  case 121:
-#line 502 "d2_parser.yy"
-    {
+  case 123: // $@29: %empty
+#line 512 "d2_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 1285 "d2_parser.cc"
+#line 1311 "d2_parser.cc"
     break;
 
-  case 122:
-#line 505 "d2_parser.yy"
-    {
+  case 124: // sub_dns_servers: "[" $@29 dns_server_list "]"
+#line 515 "d2_parser.yy"
+                                  {
     // parsing completed
 }
-#line 1293 "d2_parser.cc"
+#line 1319 "d2_parser.cc"
     break;
 
-  case 125:
-#line 513 "d2_parser.yy"
-    {
+  case 127: // $@30: %empty
+#line 523 "d2_parser.yy"
+                           {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1303 "d2_parser.cc"
+#line 1329 "d2_parser.cc"
     break;
 
-  case 126:
-#line 517 "d2_parser.yy"
-    {
+  case 128: // dns_server: "{" $@30 dns_server_params "}"
+#line 527 "d2_parser.yy"
+                                   {
     ctx.stack_.pop_back();
 }
-#line 1311 "d2_parser.cc"
+#line 1337 "d2_parser.cc"
     break;
 
-  case 127:
-#line 521 "d2_parser.yy"
-    {
+  case 129: // $@31: %empty
+#line 531 "d2_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1320 "d2_parser.cc"
+#line 1346 "d2_parser.cc"
     break;
 
-  case 128:
-#line 524 "d2_parser.yy"
-    {
+  case 130: // sub_dns_server: "{" $@31 dns_server_params "}"
+#line 534 "d2_parser.yy"
+                                   {
     // parsing completed
 }
-#line 1328 "d2_parser.cc"
+#line 1354 "d2_parser.cc"
     break;
 
-  case 137:
-#line 540 "d2_parser.yy"
-    {
+  case 141: // $@32: %empty
+#line 552 "d2_parser.yy"
+                              {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1336 "d2_parser.cc"
+#line 1362 "d2_parser.cc"
     break;
 
-  case 138:
-#line 542 "d2_parser.yy"
-    {
+  case 142: // dns_server_hostname: "hostname" $@32 ":" "constant string"
+#line 554 "d2_parser.yy"
+               {
     if (yystack_[0].value.as < std::string > () != "") {
         error(yystack_[1].location, "hostname is not yet supported");
     }
@@ -1346,123 +1372,152 @@ namespace isc { namespace d2 {
     ctx.stack_.back()->set("hostname", name);
     ctx.leave();
 }
-#line 1350 "d2_parser.cc"
+#line 1376 "d2_parser.cc"
     break;
 
-  case 139:
-#line 552 "d2_parser.yy"
-    {
+  case 143: // $@33: %empty
+#line 564 "d2_parser.yy"
+                                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1358 "d2_parser.cc"
+#line 1384 "d2_parser.cc"
     break;
 
-  case 140:
-#line 554 "d2_parser.yy"
-    {
+  case 144: // dns_server_ip_address: "ip-address" $@33 ":" "constant string"
+#line 566 "d2_parser.yy"
+               {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", s);
     ctx.leave();
 }
-#line 1368 "d2_parser.cc"
+#line 1394 "d2_parser.cc"
     break;
 
-  case 141:
-#line 560 "d2_parser.yy"
-    {
+  case 145: // dns_server_port: "port" ":" "integer"
+#line 572 "d2_parser.yy"
+                                    {
     if (yystack_[0].value.as < int64_t > () <= 0 || yystack_[0].value.as < int64_t > () >= 65536 ) {
         error(yystack_[0].location, "port must be greater than zero but less than 65536");
     }
     ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", i);
 }
-#line 1380 "d2_parser.cc"
+#line 1406 "d2_parser.cc"
     break;
 
-  case 142:
-#line 574 "d2_parser.yy"
-    {
+  case 146: // $@34: %empty
+#line 580 "d2_parser.yy"
+                              {
+    ctx.enter(ctx.NCR_PROTOCOL);
+}
+#line 1414 "d2_parser.cc"
+    break;
+
+  case 147: // dns_server_protocol: "protocol" $@34 ":" ncr_protocol_value
+#line 582 "d2_parser.yy"
+                           {
+    ctx.stack_.back()->set("protocol", yystack_[0].value.as < ElementPtr > ());
+    ctx.leave();
+}
+#line 1423 "d2_parser.cc"
+    break;
+
+  case 148: // dns_server_max_transactions: "max-transactions" ":" "integer"
+#line 587 "d2_parser.yy"
+                                                            {
+    if (yystack_[0].value.as < int64_t > () < 0) {
+        error(yystack_[0].location, "max-transactions must not be negative");
+    }
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("max-transactions", i);
+}
+#line 1435 "d2_parser.cc"
+    break;
+
+  case 149: // $@35: %empty
+#line 601 "d2_parser.yy"
+                     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tsig-keys", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.TSIG_KEYS);
 }
-#line 1391 "d2_parser.cc"
+#line 1446 "d2_parser.cc"
     break;
 
-  case 143:
-#line 579 "d2_parser.yy"
-    {
+  case 150: // tsig_keys: "tsig-keys" $@35 ":" "[" tsig_keys_list "]"
+#line 606 "d2_parser.yy"
+                                                       {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1400 "d2_parser.cc"
+#line 1455 "d2_parser.cc"
     break;
 
-  case 144:
-#line 584 "d2_parser.yy"
-    {
+  case 151: // $@36: %empty
+#line 611 "d2_parser.yy"
+                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 1409 "d2_parser.cc"
+#line 1464 "d2_parser.cc"
     break;
 
-  case 145:
-#line 587 "d2_parser.yy"
-    {
+  case 152: // sub_tsig_keys: "[" $@36 tsig_keys_list "]"
+#line 614 "d2_parser.yy"
+                                 {
     // parsing completed
 }
-#line 1417 "d2_parser.cc"
+#line 1472 "d2_parser.cc"
     break;
 
-  case 150:
-#line 599 "d2_parser.yy"
-    {
+  case 157: // $@37: %empty
+#line 626 "d2_parser.yy"
+                         {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1427 "d2_parser.cc"
+#line 1482 "d2_parser.cc"
     break;
 
-  case 151:
-#line 603 "d2_parser.yy"
-    {
+  case 158: // tsig_key: "{" $@37 tsig_key_params "}"
+#line 630 "d2_parser.yy"
+                                 {
     ctx.stack_.pop_back();
 }
-#line 1435 "d2_parser.cc"
+#line 1490 "d2_parser.cc"
     break;
 
-  case 152:
-#line 607 "d2_parser.yy"
-    {
+  case 159: // $@38: %empty
+#line 634 "d2_parser.yy"
+                             {
     // Parse tsig key list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1445 "d2_parser.cc"
+#line 1500 "d2_parser.cc"
     break;
 
-  case 153:
-#line 611 "d2_parser.yy"
-    {
+  case 160: // sub_tsig_key: "{" $@38 tsig_key_params "}"
+#line 638 "d2_parser.yy"
+                                 {
     // parsing completed
 }
-#line 1453 "d2_parser.cc"
+#line 1508 "d2_parser.cc"
     break;
 
-  case 163:
-#line 629 "d2_parser.yy"
-    {
+  case 170: // $@39: %empty
+#line 656 "d2_parser.yy"
+                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1461 "d2_parser.cc"
+#line 1516 "d2_parser.cc"
     break;
 
-  case 164:
-#line 631 "d2_parser.yy"
-    {
+  case 171: // tsig_key_name: "name" $@39 ":" "constant string"
+#line 658 "d2_parser.yy"
+               {
     if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "TSIG key name cannot be blank");
     }
@@ -1471,20 +1526,20 @@ namespace isc { namespace d2 {
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1475 "d2_parser.cc"
+#line 1530 "d2_parser.cc"
     break;
 
-  case 165:
-#line 641 "d2_parser.yy"
-    {
+  case 172: // $@40: %empty
+#line 668 "d2_parser.yy"
+                              {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1483 "d2_parser.cc"
+#line 1538 "d2_parser.cc"
     break;
 
-  case 166:
-#line 643 "d2_parser.yy"
-    {
+  case 173: // tsig_key_algorithm: "algorithm" $@40 ":" "constant string"
+#line 670 "d2_parser.yy"
+               {
     if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "TSIG key algorithm cannot be blank");
     }
@@ -1492,32 +1547,32 @@ namespace isc { namespace d2 {
     ctx.stack_.back()->set("algorithm", elem);
     ctx.leave();
 }
-#line 1496 "d2_parser.cc"
+#line 1551 "d2_parser.cc"
     break;
 
-  case 167:
-#line 652 "d2_parser.yy"
-    {
+  case 174: // tsig_key_digest_bits: "digest-bits" ":" "integer"
+#line 679 "d2_parser.yy"
+                                                {
     if (yystack_[0].value.as < int64_t > () < 0 || (yystack_[0].value.as < int64_t > () > 0  && (yystack_[0].value.as < int64_t > () % 8 != 0))) {
         error(yystack_[0].location, "TSIG key digest-bits must either be zero or a positive, multiple of eight");
     }
     ElementPtr elem(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("digest-bits", elem);
 }
-#line 1508 "d2_parser.cc"
+#line 1563 "d2_parser.cc"
     break;
 
-  case 168:
-#line 660 "d2_parser.yy"
-    {
+  case 175: // $@41: %empty
+#line 687 "d2_parser.yy"
+                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1516 "d2_parser.cc"
+#line 1571 "d2_parser.cc"
     break;
 
-  case 169:
-#line 662 "d2_parser.yy"
-    {
+  case 176: // tsig_key_secret: "secret" $@41 ":" "constant string"
+#line 689 "d2_parser.yy"
+               {
     if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "TSIG key secret cannot be blank");
     }
@@ -1525,304 +1580,334 @@ namespace isc { namespace d2 {
     ctx.stack_.back()->set("secret", elem);
     ctx.leave();
 }
-#line 1529 "d2_parser.cc"
+#line 1584 "d2_parser.cc"
     break;
 
-  case 170:
-#line 676 "d2_parser.yy"
-    {
+  case 177: // $@42: %empty
+#line 703 "d2_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 1540 "d2_parser.cc"
+#line 1595 "d2_parser.cc"
     break;
 
-  case 171:
-#line 681 "d2_parser.yy"
-    {
+  case 178: // control_socket: "control-socket" $@42 ":" "{" control_socket_params "}"
+#line 708 "d2_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1549 "d2_parser.cc"
+#line 1604 "d2_parser.cc"
     break;
 
-  case 179:
-#line 697 "d2_parser.yy"
-    {
+  case 186: // $@43: %empty
+#line 724 "d2_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1557 "d2_parser.cc"
+#line 1612 "d2_parser.cc"
     break;
 
-  case 180:
-#line 699 "d2_parser.yy"
-    {
+  case 187: // control_socket_type: "socket-type" $@43 ":" "constant string"
+#line 726 "d2_parser.yy"
+               {
     ElementPtr stype(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
     ctx.leave();
 }
-#line 1567 "d2_parser.cc"
+#line 1622 "d2_parser.cc"
     break;
 
-  case 181:
-#line 705 "d2_parser.yy"
-    {
+  case 188: // $@44: %empty
+#line 732 "d2_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1575 "d2_parser.cc"
+#line 1630 "d2_parser.cc"
     break;
 
-  case 182:
-#line 707 "d2_parser.yy"
-    {
+  case 189: // control_socket_name: "socket-name" $@44 ":" "constant string"
+#line 734 "d2_parser.yy"
+               {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 1585 "d2_parser.cc"
+#line 1640 "d2_parser.cc"
     break;
 
-  case 183:
-#line 715 "d2_parser.yy"
-    {
+  case 190: // $@45: %empty
+#line 742 "d2_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1593 "d2_parser.cc"
+#line 1648 "d2_parser.cc"
     break;
 
-  case 184:
-#line 717 "d2_parser.yy"
-    {
+  case 191: // dhcp6_json_object: "Dhcp6" $@45 ":" value
+#line 744 "d2_parser.yy"
+              {
     ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1602 "d2_parser.cc"
+#line 1657 "d2_parser.cc"
     break;
 
-  case 185:
-#line 722 "d2_parser.yy"
-    {
+  case 192: // $@46: %empty
+#line 749 "d2_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1610 "d2_parser.cc"
+#line 1665 "d2_parser.cc"
     break;
 
-  case 186:
-#line 724 "d2_parser.yy"
-    {
+  case 193: // dhcp4_json_object: "Dhcp4" $@46 ":" value
+#line 751 "d2_parser.yy"
+              {
     ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1619 "d2_parser.cc"
+#line 1674 "d2_parser.cc"
     break;
 
-  case 187:
-#line 729 "d2_parser.yy"
-    {
+  case 194: // $@47: %empty
+#line 756 "d2_parser.yy"
+                                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1627 "d2_parser.cc"
+#line 1682 "d2_parser.cc"
     break;
 
-  case 188:
-#line 731 "d2_parser.yy"
-    {
+  case 195: // control_agent_json_object: "Control-agent" $@47 ":" value
+#line 758 "d2_parser.yy"
+              {
     ctx.stack_.back()->set("Control-agent", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1636 "d2_parser.cc"
+#line 1691 "d2_parser.cc"
     break;
 
-  case 189:
-#line 741 "d2_parser.yy"
-    {
+  case 196: // $@48: %empty
+#line 768 "d2_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 1647 "d2_parser.cc"
+#line 1702 "d2_parser.cc"
     break;
 
-  case 190:
-#line 746 "d2_parser.yy"
-    {
+  case 197: // logging_object: "Logging" $@48 ":" "{" logging_params "}"
+#line 773 "d2_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1656 "d2_parser.cc"
+#line 1711 "d2_parser.cc"
     break;
 
-  case 194:
-#line 763 "d2_parser.yy"
-    {
+  case 201: // $@49: %empty
+#line 790 "d2_parser.yy"
+                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 1667 "d2_parser.cc"
+#line 1722 "d2_parser.cc"
     break;
 
-  case 195:
-#line 768 "d2_parser.yy"
-    {
+  case 202: // loggers: "loggers" $@49 ":" "[" loggers_entries "]"
+#line 795 "d2_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1676 "d2_parser.cc"
+#line 1731 "d2_parser.cc"
     break;
 
-  case 198:
-#line 780 "d2_parser.yy"
-    {
+  case 205: // $@50: %empty
+#line 807 "d2_parser.yy"
+                             {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 1686 "d2_parser.cc"
+#line 1741 "d2_parser.cc"
     break;
 
-  case 199:
-#line 784 "d2_parser.yy"
-    {
+  case 206: // logger_entry: "{" $@50 logger_params "}"
+#line 811 "d2_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 1694 "d2_parser.cc"
+#line 1749 "d2_parser.cc"
     break;
 
-  case 209:
-#line 801 "d2_parser.yy"
-    {
+  case 216: // $@51: %empty
+#line 828 "d2_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1702 "d2_parser.cc"
+#line 1757 "d2_parser.cc"
     break;
 
-  case 210:
-#line 803 "d2_parser.yy"
-    {
+  case 217: // name: "name" $@51 ":" "constant string"
+#line 830 "d2_parser.yy"
+               {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1712 "d2_parser.cc"
+#line 1767 "d2_parser.cc"
     break;
 
-  case 211:
-#line 809 "d2_parser.yy"
-    {
+  case 218: // debuglevel: "debuglevel" ":" "integer"
+#line 836 "d2_parser.yy"
+                                     {
     ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 1721 "d2_parser.cc"
+#line 1776 "d2_parser.cc"
     break;
 
-  case 212:
-#line 813 "d2_parser.yy"
-    {
+  case 219: // $@52: %empty
+#line 840 "d2_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1729 "d2_parser.cc"
+#line 1784 "d2_parser.cc"
     break;
 
-  case 213:
-#line 815 "d2_parser.yy"
-    {
+  case 220: // severity: "severity" $@52 ":" "constant string"
+#line 842 "d2_parser.yy"
+               {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 1739 "d2_parser.cc"
+#line 1794 "d2_parser.cc"
     break;
 
-  case 214:
-#line 821 "d2_parser.yy"
-    {
+  case 221: // $@53: %empty
+#line 848 "d2_parser.yy"
+                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 1750 "d2_parser.cc"
+#line 1805 "d2_parser.cc"
     break;
 
-  case 215:
-#line 826 "d2_parser.yy"
-    {
+  case 222: // output_options_list: "output_options" $@53 ":" "[" output_options_list_content "]"
+#line 853 "d2_parser.yy"
+                                                                    {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1759 "d2_parser.cc"
+#line 1814 "d2_parser.cc"
     break;
 
-  case 218:
-#line 835 "d2_parser.yy"
-    {
+  case 225: // $@54: %empty
+#line 862 "d2_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1769 "d2_parser.cc"
+#line 1824 "d2_parser.cc"
     break;
 
-  case 219:
-#line 839 "d2_parser.yy"
-    {
+  case 226: // output_entry: "{" $@54 output_params_list "}"
+#line 866 "d2_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 1777 "d2_parser.cc"
+#line 1832 "d2_parser.cc"
     break;
 
-  case 226:
-#line 853 "d2_parser.yy"
-    {
+  case 235: // $@55: %empty
+#line 882 "d2_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1785 "d2_parser.cc"
+#line 1840 "d2_parser.cc"
     break;
 
-  case 227:
-#line 855 "d2_parser.yy"
-    {
+  case 236: // output: "output" $@55 ":" "constant string"
+#line 884 "d2_parser.yy"
+               {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 1795 "d2_parser.cc"
+#line 1850 "d2_parser.cc"
     break;
 
-  case 228:
-#line 861 "d2_parser.yy"
-    {
+  case 237: // flush: "flush" ":" "boolean"
+#line 890 "d2_parser.yy"
+                           {
     ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 1804 "d2_parser.cc"
+#line 1859 "d2_parser.cc"
     break;
 
-  case 229:
-#line 866 "d2_parser.yy"
-    {
+  case 238: // maxsize: "maxsize" ":" "integer"
+#line 895 "d2_parser.yy"
+                               {
     ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 1813 "d2_parser.cc"
+#line 1868 "d2_parser.cc"
     break;
 
-  case 230:
-#line 871 "d2_parser.yy"
-    {
+  case 239: // maxver: "maxver" ":" "integer"
+#line 900 "d2_parser.yy"
+                             {
     ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 1822 "d2_parser.cc"
+#line 1877 "d2_parser.cc"
+    break;
+
+  case 240: // $@56: %empty
+#line 905 "d2_parser.yy"
+             {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1885 "d2_parser.cc"
+    break;
+
+  case 241: // async: "async" $@56 ":" "constant string"
+#line 907 "d2_parser.yy"
+               {
+    ElementPtr async(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async", async);
+    ctx.leave();
+}
+#line 1895 "d2_parser.cc"
+    break;
+
+  case 242: // async_queue_size: "async-queue-size" ":" "integer"
+#line 913 "d2_parser.yy"
+                                                 {
+    if (yystack_[0].value.as < int64_t > () <= 0) {
+        error(yystack_[0].location, "async-queue-size must be greater than zero");
+    }
+    ElementPtr size(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async-queue-size", size);
+}
+#line 1907 "d2_parser.cc"
     break;
 
 
-#line 1826 "d2_parser.cc"
+#line 1911 "d2_parser.cc"
 
             default:
               break;
@@ -1839,7 +1924,6 @@ namespace isc { namespace d2 {
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
       yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
@@ -1855,7 +1939,9 @@ namespace isc { namespace d2 {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -1866,7 +1952,7 @@ namespace isc { namespace d2 {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -1892,6 +1978,7 @@ namespace isc { namespace d2 {
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
 
@@ -1900,37 +1987,39 @@ namespace isc { namespace d2 {
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
+      error_token.state = state_type (yyn);
       yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
@@ -1962,6 +2051,7 @@ namespace isc { namespace d2 {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -1995,18 +2085,103 @@ namespace isc { namespace d2 {
     error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  D2Parser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  D2Parser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
 
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
+
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  D2Parser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
+
+
+  // D2Parser::context.
+  D2Parser::context::context (const D2Parser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  D2Parser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
+
+
+  int
+  D2Parser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -2025,41 +2200,32 @@ namespace isc { namespace d2 {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  D2Parser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -2080,11 +2246,11 @@ namespace isc { namespace d2 {
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -2093,52 +2259,54 @@ namespace isc { namespace d2 {
   }
 
 
-  const short D2Parser::yypact_ninf_ = -238;
+  const short D2Parser::yypact_ninf_ = -251;
 
   const signed char D2Parser::yytable_ninf_ = -1;
 
   const short
   D2Parser::yypact_[] =
   {
-      69,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,
-      16,     2,     7,    24,    34,    52,    38,    77,    48,   108,
-    -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,
-    -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,
-    -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,     2,    71,
-       9,    10,    40,   121,    53,   128,    14,   129,  -238,   131,
-     135,   140,   138,   151,  -238,  -238,  -238,  -238,  -238,   160,
-    -238,    15,  -238,  -238,  -238,  -238,  -238,  -238,  -238,   161,
-     162,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,
-    -238,    46,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,
-    -238,  -238,  -238,  -238,  -238,  -238,   167,  -238,  -238,  -238,
-    -238,  -238,    66,  -238,  -238,  -238,  -238,  -238,  -238,   150,
-     169,  -238,  -238,  -238,  -238,  -238,  -238,  -238,    86,  -238,
-    -238,  -238,  -238,  -238,   168,   170,  -238,  -238,   171,  -238,
-    -238,  -238,  -238,    90,  -238,  -238,  -238,  -238,  -238,    36,
-    -238,  -238,     2,     2,  -238,   120,   173,   174,   175,   176,
-     177,  -238,     9,  -238,   178,   126,   127,   181,   182,   183,
-     184,   185,   186,   187,   188,   189,    10,  -238,   190,   139,
-     191,   193,    40,  -238,    40,  -238,   121,   194,   195,   196,
-      53,  -238,    53,  -238,   128,   197,   145,   199,    14,  -238,
-      14,   129,  -238,  -238,  -238,   200,     2,     2,     2,   198,
-     205,  -238,   157,  -238,  -238,    88,   202,   207,   163,   208,
-     209,   212,   211,   215,  -238,   165,  -238,   172,   179,  -238,
-      92,  -238,   180,   219,   192,  -238,    94,  -238,   201,  -238,
-     210,  -238,    96,  -238,     2,  -238,  -238,  -238,    10,   203,
-    -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,   -18,   -18,
-     121,    55,   218,  -238,  -238,  -238,  -238,  -238,   129,  -238,
-    -238,  -238,  -238,  -238,  -238,   100,   102,  -238,  -238,  -238,
-    -238,   122,  -238,  -238,  -238,   149,   220,  -238,  -238,  -238,
-    -238,  -238,   152,  -238,  -238,  -238,  -238,    50,  -238,    80,
-    -238,   203,  -238,   223,   -18,  -238,  -238,  -238,   225,   226,
-      55,  -238,    45,   218,  -238,  -238,  -238,   227,  -238,   213,
-     214,  -238,  -238,  -238,   229,  -238,  -238,  -238,  -238,   155,
-    -238,  -238,  -238,  -238,  -238,  -238,   128,  -238,  -238,   230,
-     233,   206,   234,    45,  -238,   236,   216,   235,  -238,   221,
-    -238,  -238,  -238,   224,  -238,  -238,   123,  -238,     6,   224,
-    -238,  -238,   239,   240,   241,   159,  -238,  -238,  -238,  -238,
-    -238,  -238,   242,   148,   217,   222,     6,  -238,   228,  -238,
-    -238,  -238,  -238,  -238
+      55,  -251,  -251,  -251,  -251,  -251,  -251,  -251,  -251,  -251,
+      18,     3,    25,    26,    33,    44,    34,    52,    56,    81,
+    -251,  -251,  -251,  -251,  -251,  -251,  -251,  -251,  -251,  -251,
+    -251,  -251,  -251,  -251,  -251,  -251,  -251,  -251,  -251,  -251,
+    -251,  -251,  -251,  -251,  -251,  -251,  -251,  -251,     3,    16,
+      10,    11,    19,    96,    45,    97,    15,   125,  -251,   133,
+     137,   144,   142,   138,  -251,  -251,  -251,  -251,  -251,   148,
+    -251,     8,  -251,  -251,  -251,  -251,  -251,  -251,  -251,   160,
+     166,  -251,  -251,  -251,  -251,  -251,  -251,  -251,  -251,  -251,
+    -251,    48,  -251,  -251,  -251,  -251,  -251,  -251,  -251,  -251,
+    -251,  -251,  -251,  -251,  -251,  -251,   168,  -251,  -251,  -251,
+    -251,  -251,    67,  -251,  -251,  -251,  -251,  -251,  -251,   156,
+     174,  -251,  -251,  -251,  -251,  -251,  -251,  -251,    92,  -251,
+    -251,  -251,  -251,  -251,   172,   177,  -251,  -251,   178,  -251,
+    -251,   179,  -251,  -251,  -251,    93,  -251,  -251,  -251,  -251,
+    -251,  -251,  -251,    99,  -251,  -251,     3,     3,  -251,   124,
+     180,   182,   183,   184,   185,  -251,    10,  -251,   186,   129,
+     130,   189,   190,   191,   192,   193,   194,   195,   196,   197,
+      11,  -251,   198,   141,   200,   201,    19,  -251,    19,  -251,
+      96,   202,   203,   204,    45,  -251,    45,  -251,    97,   205,
+     149,   206,   208,   152,    15,  -251,    15,   125,  -251,  -251,
+    -251,   211,     3,     3,     3,   209,   210,  -251,   161,  -251,
+    -251,    -5,    72,   216,   163,   218,   219,   176,   220,   223,
+    -251,   169,  -251,   170,   171,  -251,   116,  -251,   175,   224,
+     181,  -251,   117,  -251,   187,  -251,   188,    -5,  -251,  -251,
+     119,  -251,     3,  -251,  -251,  -251,    11,   199,  -251,  -251,
+    -251,  -251,  -251,  -251,  -251,  -251,  -251,  -251,    -3,    -3,
+      96,    60,   226,  -251,  -251,  -251,  -251,  -251,   125,  -251,
+    -251,  -251,  -251,  -251,  -251,  -251,   120,   123,  -251,  -251,
+    -251,  -251,   126,  -251,  -251,  -251,   139,   229,  -251,  -251,
+    -251,  -251,  -251,   155,  -251,  -251,  -251,  -251,   127,  -251,
+     165,  -251,   199,  -251,   233,    -3,  -251,  -251,  -251,   234,
+     235,    60,  -251,    36,   226,  -251,  -251,  -251,   236,  -251,
+     207,   213,  -251,  -251,  -251,   239,  -251,  -251,  -251,  -251,
+     157,  -251,  -251,  -251,  -251,  -251,  -251,    97,  -251,  -251,
+     240,   241,   214,   242,    36,  -251,   244,   217,   246,  -251,
+     221,  -251,  -251,  -251,   245,  -251,  -251,   173,  -251,    41,
+     245,  -251,  -251,   243,   249,   250,  -251,   251,   158,  -251,
+    -251,  -251,  -251,  -251,  -251,  -251,  -251,   252,   215,   225,
+     227,   253,   228,    41,  -251,   222,  -251,  -251,  -251,   230,
+    -251,  -251,  -251,  -251
   };
 
   const unsigned char
@@ -2147,230 +2315,239 @@ namespace isc { namespace d2 {
        0,     2,     4,     6,     8,    10,    12,    14,    16,    18,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        1,    35,    28,    24,    23,    20,    21,    22,    27,     3,
-      25,    26,    42,     5,    54,     7,   152,     9,   144,    11,
-     105,    13,    97,    15,   127,    17,   121,    19,    37,    31,
-       0,     0,     0,   146,     0,    99,     0,     0,    39,     0,
-      38,     0,     0,    32,   183,   185,   187,    52,   189,     0,
+      25,    26,    42,     5,    54,     7,   159,     9,   151,    11,
+     107,    13,    99,    15,   129,    17,   123,    19,    37,    31,
+       0,     0,     0,   153,     0,   101,     0,     0,    39,     0,
+      38,     0,     0,    32,   190,   192,   194,    52,   196,     0,
       51,     0,    44,    49,    46,    48,    50,    47,    71,     0,
-       0,    75,    79,    81,    83,    85,    87,   142,   170,   194,
+       0,    75,    79,    83,    85,    87,    89,   149,   177,   201,
       70,     0,    56,    58,    59,    60,    61,    62,    68,    69,
-      63,    64,    65,    66,    67,   165,     0,   168,   163,   162,
-     160,   161,     0,   154,   156,   157,   158,   159,   150,     0,
-     147,   148,   117,   119,   115,   114,   112,   113,     0,   107,
-     109,   110,   111,   103,     0,   100,   101,   139,     0,   137,
-     136,   134,   135,     0,   129,   131,   132,   133,   125,     0,
-     123,    36,     0,     0,    29,     0,     0,     0,     0,     0,
-       0,    41,     0,    43,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    55,     0,     0,
-       0,     0,     0,   153,     0,   145,     0,     0,     0,     0,
-       0,   106,     0,    98,     0,     0,     0,     0,     0,   128,
-       0,     0,   122,    40,    33,     0,     0,     0,     0,     0,
-       0,    45,     0,    73,    74,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    57,     0,   167,     0,     0,   155,
-       0,   149,     0,     0,     0,   108,     0,   102,     0,   141,
-       0,   130,     0,   124,     0,   184,   186,   188,     0,     0,
-      72,    77,    78,    76,    80,    30,    82,    84,    89,    89,
-     146,     0,     0,   166,   169,   164,   151,   118,     0,   116,
-     104,   140,   138,   126,    34,     0,     0,   191,   193,    95,
-      94,     0,    90,    91,    93,     0,     0,   179,   181,   178,
-     176,   177,     0,   172,   174,   175,   198,     0,   196,     0,
-      53,     0,   190,     0,     0,    86,    88,   143,     0,     0,
-       0,   171,     0,     0,   195,   120,   192,     0,    92,     0,
-       0,   173,   209,   214,     0,   212,   208,   206,   207,     0,
-     200,   202,   204,   205,   203,   197,    99,   180,   182,     0,
-       0,     0,     0,     0,   199,     0,     0,     0,   211,     0,
-     201,    96,   210,     0,   213,   218,     0,   216,     0,     0,
-     215,   226,     0,     0,     0,     0,   220,   222,   223,   224,
-     225,   217,     0,     0,     0,     0,     0,   219,     0,   228,
-     229,   230,   221,   227
+      63,    64,    65,    66,    67,   172,     0,   175,   170,   169,
+     167,   168,     0,   161,   163,   164,   165,   166,   157,     0,
+     154,   155,   119,   121,   117,   116,   114,   115,     0,   109,
+     111,   112,   113,   105,     0,   102,   103,   143,     0,   141,
+     146,     0,   140,   138,   139,     0,   131,   133,   134,   135,
+     136,   137,   127,     0,   125,    36,     0,     0,    29,     0,
+       0,     0,     0,     0,     0,    41,     0,    43,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    55,     0,     0,     0,     0,     0,   160,     0,   152,
+       0,     0,     0,     0,     0,   108,     0,   100,     0,     0,
+       0,     0,     0,     0,     0,   130,     0,     0,   124,    40,
+      33,     0,     0,     0,     0,     0,     0,    45,     0,    73,
+      74,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      57,     0,   174,     0,     0,   162,     0,   156,     0,     0,
+       0,   110,     0,   104,     0,   145,     0,     0,   148,   132,
+       0,   126,     0,   191,   193,   195,     0,     0,    72,    77,
+      78,    76,    81,    82,    80,    30,    84,    86,    91,    91,
+     153,     0,     0,   173,   176,   171,   158,   120,     0,   118,
+     106,   144,   142,   147,   128,    34,     0,     0,   198,   200,
+      97,    96,     0,    92,    93,    95,     0,     0,   186,   188,
+     185,   183,   184,     0,   179,   181,   182,   205,     0,   203,
+       0,    53,     0,   197,     0,     0,    88,    90,   150,     0,
+       0,     0,   178,     0,     0,   202,   122,   199,     0,    94,
+       0,     0,   180,   216,   221,     0,   219,   215,   213,   214,
+       0,   207,   209,   211,   212,   210,   204,   101,   187,   189,
+       0,     0,     0,     0,     0,   206,     0,     0,     0,   218,
+       0,   208,    98,   217,     0,   220,   225,     0,   223,     0,
+       0,   222,   235,     0,     0,     0,   240,     0,     0,   227,
+     229,   230,   231,   232,   233,   234,   224,     0,     0,     0,
+       0,     0,     0,     0,   226,     0,   237,   238,   239,     0,
+     242,   228,   236,   241
   };
 
   const short
   D2Parser::yypgoto_[] =
   {
-    -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,
-    -238,   -38,  -238,    22,  -238,  -238,  -238,  -238,  -238,  -238,
-    -238,  -238,   -50,  -238,  -238,  -238,    85,  -238,  -238,  -238,
-    -238,     1,    74,  -238,  -238,  -238,  -238,  -238,  -238,  -238,
-    -238,  -238,   -51,  -238,   -39,  -238,  -238,  -238,  -238,  -238,
-      -8,  -238,   -52,  -238,  -238,  -238,  -238,   -83,  -238,    61,
-    -238,  -238,  -238,    64,    68,  -238,  -238,  -238,  -238,  -238,
-    -238,  -238,  -238,    -4,    67,  -238,  -238,  -238,    65,    78,
-    -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,    18,
-    -238,    81,  -238,  -238,  -238,    91,    98,  -238,  -238,  -238,
-    -238,  -238,  -238,  -238,  -238,  -238,  -238,   -29,  -238,  -238,
-    -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,  -238,
-    -238,   -19,  -237,  -238,  -238,   -30,  -238,  -238,   -58,  -238,
-    -238,  -238,  -238,  -238,  -238,  -238,  -238,   -73,  -238,  -238,
-     -89,  -238,  -238,  -238,  -238,  -238
+    -251,  -251,  -251,  -251,  -251,  -251,  -251,  -251,  -251,  -251,
+    -251,   -39,  -251,    35,  -251,  -251,  -251,  -251,  -251,  -251,
+    -251,  -251,   -50,  -251,  -251,  -251,    94,  -251,  -251,  -251,
+    -251,     5,    79,  -251,  -251,  -251,  -251,  -251,  -251,    17,
+    -251,  -251,  -251,   -51,  -251,   -37,  -251,  -251,  -251,  -251,
+    -251,    -7,  -251,   -52,  -251,  -251,  -251,  -251,   -81,  -251,
+      69,  -251,  -251,  -251,    73,    83,  -251,  -251,  -251,  -251,
+    -251,  -251,  -251,  -251,     2,    68,  -251,  -251,  -251,    75,
+      84,  -251,  -251,  -251,  -251,  -251,  -251,  -251,  -251,  -251,
+    -251,  -251,  -251,    22,  -251,    95,  -251,  -251,  -251,   105,
+     108,  -251,  -251,  -251,  -251,  -251,  -251,  -251,  -251,  -251,
+    -251,   -26,  -251,  -251,  -251,  -251,  -251,  -251,  -251,  -251,
+    -251,  -251,  -251,  -251,  -251,   -16,  -250,  -251,  -251,   -27,
+    -251,  -251,   -56,  -251,  -251,  -251,  -251,  -251,  -251,  -251,
+    -251,   -71,  -251,  -251,   -93,  -251,  -251,  -251,  -251,  -251,
+    -251,  -251,  -251
   };
 
   const short
   D2Parser::yydefgoto_[] =
   {
-      -1,    10,    11,    12,    13,    14,    15,    16,    17,    18,
-      19,    28,    29,    30,    49,   256,    62,    63,    31,    48,
-      59,    60,    90,    33,    50,    71,    72,    73,   159,    35,
-      51,    91,    92,    93,   164,    94,    95,    96,   167,   253,
-      97,   168,    98,   169,    99,   170,   100,   171,   101,   172,
-     281,   282,   283,   284,   303,    43,    55,   134,   135,   136,
-     192,    41,    54,   128,   129,   130,   189,   131,   187,   132,
-     188,    47,    57,   149,   150,   200,    45,    56,   143,   144,
-     145,   197,   146,   195,   147,   102,   173,    39,    53,   119,
-     120,   121,   184,    37,    52,   112,   113,   114,   181,   115,
-     178,   116,   117,   180,   103,   174,   292,   293,   294,   308,
-     295,   309,    74,   156,    75,   157,    76,   158,    77,   160,
-     276,   277,   104,   175,   297,   298,   312,   329,   330,   331,
-     339,   332,   333,   342,   334,   340,   356,   357,   358,   365,
-     366,   367,   372,   368,   369,   370
+       0,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+      19,    28,    29,    30,    49,   266,    62,    63,    31,    48,
+      59,    60,    90,    33,    50,    71,    72,    73,   163,    35,
+      51,    91,    92,    93,   168,    94,    95,    96,   171,   261,
+      97,   172,   264,    98,   173,    99,   174,   100,   175,   101,
+     176,   292,   293,   294,   295,   314,    43,    55,   134,   135,
+     136,   196,    41,    54,   128,   129,   130,   193,   131,   191,
+     132,   192,    47,    57,   153,   154,   206,    45,    56,   145,
+     146,   147,   201,   148,   199,   149,   150,   202,   151,   102,
+     177,    39,    53,   119,   120,   121,   188,    37,    52,   112,
+     113,   114,   185,   115,   182,   116,   117,   184,   103,   178,
+     303,   304,   305,   319,   306,   320,    74,   160,    75,   161,
+      76,   162,    77,   164,   287,   288,   104,   179,   308,   309,
+     323,   340,   341,   342,   350,   343,   344,   353,   345,   351,
+     367,   368,   369,   378,   379,   380,   387,   381,   382,   383,
+     384,   391,   385
   };
 
-  const unsigned short
+  const short
   D2Parser::yytable_[] =
   {
-      70,   110,   109,   126,   125,   141,   140,    21,   279,    22,
-      58,    23,   278,   111,    32,   127,    20,   142,   162,    64,
-      65,    66,    67,   163,    78,    79,    80,    81,   137,   138,
-      82,    34,    83,    84,    85,    86,    83,    84,    69,   201,
-      87,    36,   202,   139,    88,    40,    68,   361,    89,   176,
-     362,   363,   364,   313,   177,    44,   314,    38,    24,    25,
-      26,    27,    83,    84,   278,    69,    69,    83,    84,   182,
-      69,   105,   106,   107,   183,    83,    84,    83,    84,   108,
-     122,   123,    42,   201,   322,   323,   315,   324,   325,   190,
-     287,   288,   124,   198,   191,   182,    69,   190,   199,   198,
-     266,    69,   270,   176,   273,   301,   251,   252,   300,    69,
-     302,    69,    70,    46,   203,   204,     1,     2,     3,     4,
-       5,     6,     7,     8,     9,   304,   359,    61,   118,   360,
-     305,   110,   109,   110,   109,   133,   148,   151,   152,   126,
-     125,   126,   125,   111,   153,   111,   154,   141,   140,   141,
-     140,   127,   304,   127,   155,   310,   185,   306,   343,   142,
-     311,   142,   376,   344,   161,   165,   166,   377,   245,   246,
-     247,   179,   186,   194,   193,   196,   205,   206,   207,   208,
-     209,   210,   212,   213,   214,   215,   216,   217,   218,   219,
-     220,   221,   222,   223,   225,   227,   226,   228,   232,   233,
-     234,   238,   239,   240,   244,   248,   274,   379,   280,   280,
-     290,   289,   249,   250,    22,   258,   259,   260,   261,   257,
-     262,   263,   291,   254,   268,   296,   307,   317,   264,   319,
-     320,   355,   336,   341,   346,   265,   267,   347,   349,   255,
-     353,    89,   351,   373,   374,   375,   378,   211,   269,   275,
-     224,   285,   318,   345,   280,   237,   236,   271,   235,   290,
-     289,   327,   326,   348,   299,   242,   272,   231,   243,   337,
-     338,   291,   352,   328,   380,   230,   241,   354,   286,   381,
-     229,   321,   316,   335,   383,   350,   371,   382,     0,     0,
-       0,     0,   327,   326,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   328
+      70,   110,   109,   126,   125,   143,   142,   289,    21,    58,
+      22,   166,    23,   259,   260,   111,   167,   127,    20,   144,
+      64,    65,    66,    67,   290,    78,    79,    80,    81,   137,
+     138,    82,    32,    34,    83,    84,    85,    86,    83,    84,
+      36,    40,    83,    84,    87,   139,   140,   141,    88,    38,
+      68,   180,    89,   105,   106,   107,   181,    42,    69,    83,
+      84,   108,   289,    44,    24,    25,    26,    27,    83,    84,
+     186,    69,    69,   122,   123,   187,    69,    61,   333,   334,
+      69,   335,   336,    83,    84,   372,    46,   124,   373,   374,
+     375,   376,   377,   262,   263,   194,   204,    69,   298,   299,
+     195,   205,   207,   118,   133,   208,    69,     1,     2,     3,
+       4,     5,     6,     7,     8,     9,    70,   209,   210,   186,
+     194,    69,   204,   180,   276,   280,   312,   284,   311,   315,
+     324,   313,   152,   325,   316,   110,   109,   110,   109,   155,
+     156,   159,   315,   126,   125,   126,   125,   317,   157,   111,
+     158,   111,   165,   143,   142,   143,   142,   127,   321,   127,
+     354,   393,   189,   322,   169,   355,   394,   144,   207,   144,
+     170,   326,   183,   253,   254,   255,   370,   190,   197,   371,
+     198,   270,   200,   203,   212,   211,   213,   214,   215,   216,
+     218,   219,   220,   221,   222,   223,   224,   225,   226,   227,
+     228,   229,   231,   232,   233,   234,   238,   239,   240,   244,
+     246,   245,   247,   285,   248,   252,   256,   257,   291,   291,
+     301,   300,   258,    22,   267,   268,   269,   271,   272,   278,
+     273,   274,   275,   307,   302,   318,   277,   328,   330,   331,
+      89,   347,   279,   352,   357,   358,   360,   388,   281,   282,
+     362,   364,   366,   389,   390,   392,   395,   399,   265,   230,
+     217,   286,   296,   329,   283,   291,   356,   243,   348,   242,
+     301,   300,   338,   337,   349,   251,   359,   241,   363,   396,
+     310,   250,   365,   402,   302,   237,   339,   397,   249,   398,
+     400,   403,   297,   236,   235,   332,   327,   346,   361,   386,
+     401,     0,     0,   338,   337,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   339
   };
 
   const short
   D2Parser::yycheck_[] =
   {
-      50,    52,    52,    54,    54,    56,    56,     5,    26,     7,
-      48,     9,   249,    52,     7,    54,     0,    56,     3,    10,
-      11,    12,    13,     8,    14,    15,    16,    17,    14,    15,
-      20,     7,    22,    23,    24,    25,    22,    23,    56,     3,
-      30,     7,     6,    29,    34,     7,    37,    41,    38,     3,
-      44,    45,    46,     3,     8,     7,     6,     5,    56,    57,
-      58,    59,    22,    23,   301,    56,    56,    22,    23,     3,
-      56,    31,    32,    33,     8,    22,    23,    22,    23,    39,
-      27,    28,     5,     3,    39,    40,     6,    42,    43,     3,
-      35,    36,    39,     3,     8,     3,    56,     3,     8,     3,
-       8,    56,     8,     3,     8,     3,    18,    19,     8,    56,
-       8,    56,   162,     5,   152,   153,    47,    48,    49,    50,
-      51,    52,    53,    54,    55,     3,     3,    56,     7,     6,
-       8,   182,   182,   184,   184,     7,     7,     6,     3,   190,
-     190,   192,   192,   182,     4,   184,     8,   198,   198,   200,
-     200,   190,     3,   192,     3,     3,     6,     8,     3,   198,
-       8,   200,     3,     8,     4,     4,     4,     8,   206,   207,
-     208,     4,     3,     3,     6,     4,    56,     4,     4,     4,
-       4,     4,     4,    57,    57,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,    57,     4,     4,     4,
-       4,     4,    57,     4,     4,     7,   244,    59,   258,   259,
-     261,   261,     7,    56,     7,     7,     7,     5,     7,    56,
-       5,    56,   261,    21,     5,     7,     6,     4,    56,     4,
-       4,     7,     5,     4,     4,    56,    56,     4,     4,   217,
-       5,    38,     6,     4,     4,     4,     4,   162,    56,   248,
-     176,   259,   304,   336,   304,   194,   192,    56,   190,   310,
-     310,   312,   312,    57,   268,   200,    56,   186,   201,    56,
-      56,   310,    56,   312,    57,   184,   198,    56,   260,    57,
-     182,   310,   301,   313,    56,   343,   359,   376,    -1,    -1,
-      -1,    -1,   343,   343,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   343
+      50,    52,    52,    54,    54,    56,    56,   257,     5,    48,
+       7,     3,     9,    18,    19,    52,     8,    54,     0,    56,
+      10,    11,    12,    13,    27,    14,    15,    16,    17,    14,
+      15,    20,     7,     7,    23,    24,    25,    26,    23,    24,
+       7,     7,    23,    24,    33,    30,    31,    32,    37,     5,
+      40,     3,    41,    34,    35,    36,     8,     5,    61,    23,
+      24,    42,   312,     7,    61,    62,    63,    64,    23,    24,
+       3,    61,    61,    28,    29,     8,    61,    61,    42,    43,
+      61,    45,    46,    23,    24,    44,     5,    42,    47,    48,
+      49,    50,    51,    21,    22,     3,     3,    61,    38,    39,
+       8,     8,     3,     7,     7,     6,    61,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,   166,   156,   157,     3,
+       3,    61,     3,     3,     8,     8,     3,     8,     8,     3,
+       3,     8,     7,     6,     8,   186,   186,   188,   188,     6,
+       3,     3,     3,   194,   194,   196,   196,     8,     4,   186,
+       8,   188,     4,   204,   204,   206,   206,   194,     3,   196,
+       3,     3,     6,     8,     4,     8,     8,   204,     3,   206,
+       4,     6,     4,   212,   213,   214,     3,     3,     6,     6,
+       3,     5,     4,     4,     4,    61,     4,     4,     4,     4,
+       4,    62,    62,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,    62,     4,     4,     4,     4,     4,     4,
+       4,    62,     4,   252,    62,     4,     7,     7,   268,   269,
+     271,   271,    61,     7,    61,     7,     7,     7,     5,     5,
+      61,    61,    61,     7,   271,     6,    61,     4,     4,     4,
+      41,     5,    61,     4,     4,     4,     4,     4,    61,    61,
+       6,     5,     7,     4,     4,     4,     4,     4,   223,   180,
+     166,   256,   269,   315,   247,   315,   347,   198,    61,   196,
+     321,   321,   323,   323,    61,   207,    62,   194,    61,    64,
+     278,   206,    61,    61,   321,   190,   323,    62,   204,    62,
+      62,    61,   270,   188,   186,   321,   312,   324,   354,   370,
+     393,    -1,    -1,   354,   354,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   354
   };
 
   const unsigned char
   D2Parser::yystos_[] =
   {
-       0,    47,    48,    49,    50,    51,    52,    53,    54,    55,
-      61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
-       0,     5,     7,     9,    56,    57,    58,    59,    71,    72,
-      73,    78,     7,    83,     7,    89,     7,   153,     5,   147,
-       7,   121,     5,   115,     7,   136,     5,   131,    79,    74,
-      84,    90,   154,   148,   122,   116,   137,   132,    71,    80,
-      81,    56,    76,    77,    10,    11,    12,    13,    37,    56,
-      82,    85,    86,    87,   172,   174,   176,   178,    14,    15,
-      16,    17,    20,    22,    23,    24,    25,    30,    34,    38,
-      82,    91,    92,    93,    95,    96,    97,   100,   102,   104,
-     106,   108,   145,   164,   182,    31,    32,    33,    39,    82,
-     102,   104,   155,   156,   157,   159,   161,   162,     7,   149,
-     150,   151,    27,    28,    39,    82,   102,   104,   123,   124,
-     125,   127,   129,     7,   117,   118,   119,    14,    15,    29,
-      82,   102,   104,   138,   139,   140,   142,   144,     7,   133,
-     134,     6,     3,     4,     8,     3,   173,   175,   177,    88,
-     179,     4,     3,     8,    94,     4,     4,    98,   101,   103,
-     105,   107,   109,   146,   165,   183,     3,     8,   160,     4,
-     163,   158,     3,     8,   152,     6,     3,   128,   130,   126,
-       3,     8,   120,     6,     3,   143,     4,   141,     3,     8,
-     135,     3,     6,    71,    71,    56,     4,     4,     4,     4,
-       4,    86,     4,    57,    57,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,    92,     4,    57,     4,     4,   156,
-     155,   151,     4,     4,     4,   124,   123,   119,     4,    57,
-       4,   139,   138,   134,     4,    71,    71,    71,     7,     7,
-      56,    18,    19,    99,    21,    73,    75,    56,     7,     7,
-       5,     7,     5,    56,    56,    56,     8,    56,     5,    56,
-       8,    56,    56,     8,    71,    91,   180,   181,   182,    26,
-      82,   110,   111,   112,   113,   110,   149,    35,    36,    82,
-     102,   104,   166,   167,   168,   170,     7,   184,   185,   133,
-       8,     3,     8,   114,     3,     8,     8,     6,   169,   171,
-       3,     8,   186,     3,     6,     6,   181,     4,   112,     4,
-       4,   167,    39,    40,    42,    43,    82,   102,   104,   187,
-     188,   189,   191,   192,   194,   185,     5,    56,    56,   190,
-     195,     4,   193,     3,     8,   117,     4,     4,    57,     4,
-     188,     6,    56,     5,    56,     7,   196,   197,   198,     3,
-       6,    41,    44,    45,    46,   199,   200,   201,   203,   204,
-     205,   197,   202,     4,     4,     4,     3,     8,     4,    59,
-      57,    57,   200,    56
+       0,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
+       0,     5,     7,     9,    61,    62,    63,    64,    76,    77,
+      78,    83,     7,    88,     7,    94,     7,   162,     5,   156,
+       7,   127,     5,   121,     7,   142,     5,   137,    84,    79,
+      89,    95,   163,   157,   128,   122,   143,   138,    76,    85,
+      86,    61,    81,    82,    10,    11,    12,    13,    40,    61,
+      87,    90,    91,    92,   181,   183,   185,   187,    14,    15,
+      16,    17,    20,    23,    24,    25,    26,    33,    37,    41,
+      87,    96,    97,    98,   100,   101,   102,   105,   108,   110,
+     112,   114,   154,   173,   191,    34,    35,    36,    42,    87,
+     108,   110,   164,   165,   166,   168,   170,   171,     7,   158,
+     159,   160,    28,    29,    42,    87,   108,   110,   129,   130,
+     131,   133,   135,     7,   123,   124,   125,    14,    15,    30,
+      31,    32,    87,   108,   110,   144,   145,   146,   148,   150,
+     151,   153,     7,   139,   140,     6,     3,     4,     8,     3,
+     182,   184,   186,    93,   188,     4,     3,     8,    99,     4,
+       4,   103,   106,   109,   111,   113,   115,   155,   174,   192,
+       3,     8,   169,     4,   172,   167,     3,     8,   161,     6,
+       3,   134,   136,   132,     3,     8,   126,     6,     3,   149,
+       4,   147,   152,     4,     3,     8,   141,     3,     6,    76,
+      76,    61,     4,     4,     4,     4,     4,    91,     4,    62,
+      62,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+      97,     4,    62,     4,     4,   165,   164,   160,     4,     4,
+       4,   130,   129,   125,     4,    62,     4,     4,    62,   145,
+     144,   140,     4,    76,    76,    76,     7,     7,    61,    18,
+      19,   104,    21,    22,   107,    78,    80,    61,     7,     7,
+       5,     7,     5,    61,    61,    61,     8,    61,     5,    61,
+       8,    61,    61,   104,     8,    76,    96,   189,   190,   191,
+      27,    87,   116,   117,   118,   119,   116,   158,    38,    39,
+      87,   108,   110,   175,   176,   177,   179,     7,   193,   194,
+     139,     8,     3,     8,   120,     3,     8,     8,     6,   178,
+     180,     3,     8,   195,     3,     6,     6,   190,     4,   118,
+       4,     4,   176,    42,    43,    45,    46,    87,   108,   110,
+     196,   197,   198,   200,   201,   203,   194,     5,    61,    61,
+     199,   204,     4,   202,     3,     8,   123,     4,     4,    62,
+       4,   197,     6,    61,     5,    61,     7,   205,   206,   207,
+       3,     6,    44,    47,    48,    49,    50,    51,   208,   209,
+     210,   212,   213,   214,   215,   217,   206,   211,     4,     4,
+       4,   216,     4,     3,     8,     4,    64,    62,    62,     4,
+      62,   209,    61,    61
   };
 
   const unsigned char
   D2Parser::yyr1_[] =
   {
-       0,    60,    62,    61,    63,    61,    64,    61,    65,    61,
-      66,    61,    67,    61,    68,    61,    69,    61,    70,    61,
-      71,    71,    71,    71,    71,    71,    71,    72,    74,    73,
-      75,    76,    76,    77,    77,    79,    78,    80,    80,    81,
-      81,    82,    84,    83,    85,    85,    86,    86,    86,    86,
-      86,    86,    88,    87,    90,    89,    91,    91,    92,    92,
-      92,    92,    92,    92,    92,    92,    92,    92,    92,    92,
-      92,    94,    93,    95,    96,    98,    97,    99,    99,   101,
-     100,   103,   102,   105,   104,   107,   106,   109,   108,   110,
-     110,   111,   111,   112,   112,   114,   113,   116,   115,   117,
-     117,   118,   118,   120,   119,   122,   121,   123,   123,   124,
-     124,   124,   124,   124,   124,   126,   125,   128,   127,   130,
-     129,   132,   131,   133,   133,   135,   134,   137,   136,   138,
-     138,   139,   139,   139,   139,   139,   139,   141,   140,   143,
-     142,   144,   146,   145,   148,   147,   149,   149,   150,   150,
-     152,   151,   154,   153,   155,   155,   156,   156,   156,   156,
-     156,   156,   156,   158,   157,   160,   159,   161,   163,   162,
-     165,   164,   166,   166,   167,   167,   167,   167,   167,   169,
-     168,   171,   170,   173,   172,   175,   174,   177,   176,   179,
-     178,   180,   180,   181,   183,   182,   184,   184,   186,   185,
-     187,   187,   188,   188,   188,   188,   188,   188,   188,   190,
-     189,   191,   193,   192,   195,   194,   196,   196,   198,   197,
-     199,   199,   200,   200,   200,   200,   202,   201,   203,   204,
-     205
+       0,    65,    67,    66,    68,    66,    69,    66,    70,    66,
+      71,    66,    72,    66,    73,    66,    74,    66,    75,    66,
+      76,    76,    76,    76,    76,    76,    76,    77,    79,    78,
+      80,    81,    81,    82,    82,    84,    83,    85,    85,    86,
+      86,    87,    89,    88,    90,    90,    91,    91,    91,    91,
+      91,    91,    93,    92,    95,    94,    96,    96,    97,    97,
+      97,    97,    97,    97,    97,    97,    97,    97,    97,    97,
+      97,    99,    98,   100,   101,   103,   102,   104,   104,   106,
+     105,   107,   107,   109,   108,   111,   110,   113,   112,   115,
+     114,   116,   116,   117,   117,   118,   118,   120,   119,   122,
+     121,   123,   123,   124,   124,   126,   125,   128,   127,   129,
+     129,   130,   130,   130,   130,   130,   130,   132,   131,   134,
+     133,   136,   135,   138,   137,   139,   139,   141,   140,   143,
+     142,   144,   144,   145,   145,   145,   145,   145,   145,   145,
+     145,   147,   146,   149,   148,   150,   152,   151,   153,   155,
+     154,   157,   156,   158,   158,   159,   159,   161,   160,   163,
+     162,   164,   164,   165,   165,   165,   165,   165,   165,   165,
+     167,   166,   169,   168,   170,   172,   171,   174,   173,   175,
+     175,   176,   176,   176,   176,   176,   178,   177,   180,   179,
+     182,   181,   184,   183,   186,   185,   188,   187,   189,   189,
+     190,   192,   191,   193,   193,   195,   194,   196,   196,   197,
+     197,   197,   197,   197,   197,   197,   199,   198,   200,   202,
+     201,   204,   203,   205,   205,   207,   206,   208,   208,   209,
+     209,   209,   209,   209,   209,   211,   210,   212,   213,   214,
+     216,   215,   217
   };
 
-  const unsigned char
+  const signed char
   D2Parser::yyr2_[] =
   {
        0,     2,     0,     3,     0,     3,     0,     3,     0,     3,
@@ -2381,128 +2558,133 @@ namespace isc { namespace d2 {
        1,     1,     0,     6,     0,     4,     1,     3,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     0,     4,     3,     3,     0,     4,     1,     1,     0,
-       4,     0,     4,     0,     4,     0,     6,     0,     6,     0,
-       1,     1,     3,     1,     1,     0,     6,     0,     4,     0,
-       1,     1,     3,     0,     4,     0,     4,     1,     3,     1,
-       1,     1,     1,     1,     1,     0,     4,     0,     4,     0,
-       6,     0,     4,     1,     3,     0,     4,     0,     4,     1,
+       4,     1,     1,     0,     4,     0,     4,     0,     6,     0,
+       6,     0,     1,     1,     3,     1,     1,     0,     6,     0,
+       4,     0,     1,     1,     3,     0,     4,     0,     4,     1,
        3,     1,     1,     1,     1,     1,     1,     0,     4,     0,
-       4,     3,     0,     6,     0,     4,     0,     1,     1,     3,
-       0,     4,     0,     4,     1,     3,     1,     1,     1,     1,
-       1,     1,     1,     0,     4,     0,     4,     3,     0,     4,
-       0,     6,     1,     3,     1,     1,     1,     1,     1,     0,
-       4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
-       6,     1,     3,     1,     0,     6,     1,     3,     0,     4,
-       1,     3,     1,     1,     1,     1,     1,     1,     1,     0,
-       4,     3,     0,     4,     0,     6,     1,     3,     0,     4,
-       1,     3,     1,     1,     1,     1,     0,     4,     3,     3,
-       3
+       4,     0,     6,     0,     4,     1,     3,     0,     4,     0,
+       4,     1,     3,     1,     1,     1,     1,     1,     1,     1,
+       1,     0,     4,     0,     4,     3,     0,     4,     3,     0,
+       6,     0,     4,     0,     1,     1,     3,     0,     4,     0,
+       4,     1,     3,     1,     1,     1,     1,     1,     1,     1,
+       0,     4,     0,     4,     3,     0,     4,     0,     6,     1,
+       3,     1,     1,     1,     1,     1,     0,     4,     0,     4,
+       0,     4,     0,     4,     0,     4,     0,     6,     1,     3,
+       1,     0,     6,     1,     3,     0,     4,     1,     3,     1,
+       1,     1,     1,     1,     1,     1,     0,     4,     3,     0,
+       4,     0,     6,     1,     3,     0,     4,     1,     3,     1,
+       1,     1,     1,     1,     1,     0,     4,     3,     3,     3,
+       0,     4,     3
   };
 
 
-
+#if D2_PARSER_DEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const D2Parser::yytname_[] =
   {
-  "\"end of file\"", "error", "$undefined", "\",\"", "\":\"", "\"[\"",
-  "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp6\"", "\"Dhcp4\"",
+  "\"end of file\"", "error", "\"invalid token\"", "\",\"", "\":\"",
+  "\"[\"", "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp6\"", "\"Dhcp4\"",
   "\"Control-agent\"", "\"DhcpDdns\"", "\"ip-address\"", "\"port\"",
   "\"dns-server-timeout\"", "\"ncr-protocol\"", "\"UDP\"", "\"TCP\"",
-  "\"ncr-format\"", "\"JSON\"", "\"user-context\"", "\"comment\"",
-  "\"forward-ddns\"", "\"reverse-ddns\"", "\"ddns-domains\"",
-  "\"key-name\"", "\"dns-servers\"", "\"hostname\"", "\"tsig-keys\"",
-  "\"algorithm\"", "\"digest-bits\"", "\"secret\"", "\"control-socket\"",
-  "\"socket-type\"", "\"socket-name\"", "\"Logging\"", "\"loggers\"",
-  "\"name\"", "\"output_options\"", "\"output\"", "\"debuglevel\"",
-  "\"severity\"", "\"flush\"", "\"maxsize\"", "\"maxver\"",
-  "TOPLEVEL_JSON", "TOPLEVEL_DHCPDDNS", "SUB_DHCPDDNS", "SUB_TSIG_KEY",
-  "SUB_TSIG_KEYS", "SUB_DDNS_DOMAIN", "SUB_DDNS_DOMAINS", "SUB_DNS_SERVER",
-  "SUB_DNS_SERVERS", "\"constant string\"", "\"integer\"",
-  "\"floating point\"", "\"boolean\"", "$accept", "start", "$@1", "$@2",
-  "$@3", "$@4", "$@5", "$@6", "$@7", "$@8", "$@9", "value", "sub_json",
-  "map2", "$@10", "map_value", "map_content", "not_empty_map",
-  "list_generic", "$@11", "list_content", "not_empty_list",
-  "unknown_map_entry", "syntax_map", "$@12", "global_objects",
-  "global_object", "dhcpddns_object", "$@13", "sub_dhcpddns", "$@14",
-  "dhcpddns_params", "dhcpddns_param", "ip_address", "$@15", "port",
-  "dns_server_timeout", "ncr_protocol", "$@16", "ncr_protocol_value",
-  "ncr_format", "$@17", "user_context", "$@18", "comment", "$@19",
-  "forward_ddns", "$@20", "reverse_ddns", "$@21", "ddns_mgr_params",
-  "not_empty_ddns_mgr_params", "ddns_mgr_param", "ddns_domains", "$@22",
-  "sub_ddns_domains", "$@23", "ddns_domain_list",
-  "not_empty_ddns_domain_list", "ddns_domain", "$@24", "sub_ddns_domain",
-  "$@25", "ddns_domain_params", "ddns_domain_param", "ddns_domain_name",
-  "$@26", "ddns_domain_key_name", "$@27", "dns_servers", "$@28",
-  "sub_dns_servers", "$@29", "dns_server_list", "dns_server", "$@30",
-  "sub_dns_server", "$@31", "dns_server_params", "dns_server_param",
-  "dns_server_hostname", "$@32", "dns_server_ip_address", "$@33",
-  "dns_server_port", "tsig_keys", "$@34", "sub_tsig_keys", "$@35",
-  "tsig_keys_list", "not_empty_tsig_keys_list", "tsig_key", "$@36",
-  "sub_tsig_key", "$@37", "tsig_key_params", "tsig_key_param",
-  "tsig_key_name", "$@38", "tsig_key_algorithm", "$@39",
-  "tsig_key_digest_bits", "tsig_key_secret", "$@40", "control_socket",
-  "$@41", "control_socket_params", "control_socket_param",
-  "control_socket_type", "$@42", "control_socket_name", "$@43",
-  "dhcp6_json_object", "$@44", "dhcp4_json_object", "$@45",
-  "control_agent_json_object", "$@46", "logging_object", "$@47",
-  "logging_params", "logging_param", "loggers", "$@48", "loggers_entries",
-  "logger_entry", "$@49", "logger_params", "logger_param", "name", "$@50",
-  "debuglevel", "severity", "$@51", "output_options_list", "$@52",
-  "output_options_list_content", "output_entry", "$@53",
-  "output_params_list", "output_params", "output", "$@54", "flush",
-  "maxsize", "maxver", YY_NULLPTR
+  "\"ncr-format\"", "\"JSON\"", "\"BINARY\"", "\"user-context\"",
+  "\"comment\"", "\"forward-ddns\"", "\"reverse-ddns\"",
+  "\"ddns-domains\"", "\"key-name\"", "\"dns-servers\"", "\"hostname\"",
+  "\"protocol\"", "\"max-transactions\"", "\"tsig-keys\"", "\"algorithm\"",
+  "\"digest-bits\"", "\"secret\"", "\"control-socket\"", "\"socket-type\"",
+  "\"socket-name\"", "\"Logging\"", "\"loggers\"", "\"name\"",
+  "\"output_options\"", "\"output\"", "\"debuglevel\"", "\"severity\"",
+  "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"async\"",
+  "\"async-queue-size\"", "TOPLEVEL_JSON", "TOPLEVEL_DHCPDDNS",
+  "SUB_DHCPDDNS", "SUB_TSIG_KEY", "SUB_TSIG_KEYS", "SUB_DDNS_DOMAIN",
+  "SUB_DDNS_DOMAINS", "SUB_DNS_SERVER", "SUB_DNS_SERVERS",
+  "\"constant string\"", "\"integer\"", "\"floating point\"",
+  "\"boolean\"", "$accept", "start", "$@1", "$@2", "$@3", "$@4", "$@5",
+  "$@6", "$@7", "$@8", "$@9", "value", "sub_json", "map2", "$@10",
+  "map_value", "map_content", "not_empty_map", "list_generic", "$@11",
+  "list_content", "not_empty_list", "unknown_map_entry", "syntax_map",
+  "$@12", "global_objects", "global_object", "dhcpddns_object", "$@13",
+  "sub_dhcpddns", "$@14", "dhcpddns_params", "dhcpddns_param",
+  "ip_address", "$@15", "port", "dns_server_timeout", "ncr_protocol",
+  "$@16", "ncr_protocol_value", "ncr_format", "$@17", "ncr_format_value",
+  "user_context", "$@18", "comment", "$@19", "forward_ddns", "$@20",
+  "reverse_ddns", "$@21", "ddns_mgr_params", "not_empty_ddns_mgr_params",
+  "ddns_mgr_param", "ddns_domains", "$@22", "sub_ddns_domains", "$@23",
+  "ddns_domain_list", "not_empty_ddns_domain_list", "ddns_domain", "$@24",
+  "sub_ddns_domain", "$@25", "ddns_domain_params", "ddns_domain_param",
+  "ddns_domain_name", "$@26", "ddns_domain_key_name", "$@27",
+  "dns_servers", "$@28", "sub_dns_servers", "$@29", "dns_server_list",
+  "dns_server", "$@30", "sub_dns_server", "$@31", "dns_server_params",
+  "dns_server_param", "dns_server_hostname", "$@32",
+  "dns_server_ip_address", "$@33", "dns_server_port",
+  "dns_server_protocol", "$@34", "dns_server_max_transactions",
+  "tsig_keys", "$@35", "sub_tsig_keys", "$@36", "tsig_keys_list",
+  "not_empty_tsig_keys_list", "tsig_key", "$@37", "sub_tsig_key", "$@38",
+  "tsig_key_params", "tsig_key_param", "tsig_key_name", "$@39",
+  "tsig_key_algorithm", "$@40", "tsig_key_digest_bits", "tsig_key_secret",
+  "$@41", "control_socket", "$@42", "control_socket_params",
+  "control_socket_param", "control_socket_type", "$@43",
+  "control_socket_name", "$@44", "dhcp6_json_object", "$@45",
+  "dhcp4_json_object", "$@46", "control_agent_json_object", "$@47",
+  "logging_object", "$@48", "logging_params", "logging_param", "loggers",
+  "$@49", "loggers_entries", "logger_entry", "$@50", "logger_params",
+  "logger_param", "name", "$@51", "debuglevel", "severity", "$@52",
+  "output_options_list", "$@53", "output_options_list_content",
+  "output_entry", "$@54", "output_params_list", "output_params", "output",
+  "$@55", "flush", "maxsize", "maxver", "async", "$@56",
+  "async_queue_size", YY_NULLPTR
   };
+#endif
+
 
 #if D2_PARSER_DEBUG
-  const unsigned short
+  const short
   D2Parser::yyrline_[] =
   {
-       0,   124,   124,   124,   125,   125,   126,   126,   127,   127,
-     128,   128,   129,   129,   130,   130,   131,   131,   132,   132,
-     140,   141,   142,   143,   144,   145,   146,   149,   154,   154,
-     165,   168,   169,   172,   176,   183,   183,   190,   191,   194,
-     198,   209,   219,   219,   231,   232,   236,   237,   238,   239,
-     240,   241,   246,   246,   256,   256,   264,   265,   269,   270,
-     271,   272,   273,   274,   275,   276,   277,   278,   279,   280,
-     281,   284,   284,   292,   300,   309,   309,   317,   318,   321,
-     321,   329,   329,   354,   354,   381,   381,   391,   391,   401,
-     402,   405,   406,   409,   410,   415,   415,   425,   425,   432,
-     433,   436,   437,   440,   440,   448,   448,   455,   456,   459,
-     460,   461,   462,   463,   464,   468,   468,   480,   480,   492,
-     492,   502,   502,   509,   510,   513,   513,   521,   521,   528,
-     529,   532,   533,   534,   535,   536,   537,   540,   540,   552,
-     552,   560,   574,   574,   584,   584,   591,   592,   595,   596,
-     599,   599,   607,   607,   616,   617,   620,   621,   622,   623,
-     624,   625,   626,   629,   629,   641,   641,   652,   660,   660,
-     676,   676,   686,   687,   690,   691,   692,   693,   694,   697,
-     697,   705,   705,   715,   715,   722,   722,   729,   729,   741,
-     741,   754,   755,   759,   763,   763,   775,   776,   780,   780,
-     788,   789,   792,   793,   794,   795,   796,   797,   798,   801,
-     801,   809,   813,   813,   821,   821,   831,   832,   835,   835,
-     843,   844,   847,   848,   849,   850,   853,   853,   861,   866,
-     871
+       0,   130,   130,   130,   131,   131,   132,   132,   133,   133,
+     134,   134,   135,   135,   136,   136,   137,   137,   138,   138,
+     146,   147,   148,   149,   150,   151,   152,   155,   160,   160,
+     171,   174,   175,   178,   182,   189,   189,   196,   197,   200,
+     204,   215,   225,   225,   237,   238,   242,   243,   244,   245,
+     246,   247,   252,   252,   262,   262,   270,   271,   275,   276,
+     277,   278,   279,   280,   281,   282,   283,   284,   285,   286,
+     287,   290,   290,   298,   306,   315,   315,   323,   324,   327,
+     327,   335,   336,   339,   339,   364,   364,   391,   391,   401,
+     401,   411,   412,   415,   416,   419,   420,   425,   425,   435,
+     435,   442,   443,   446,   447,   450,   450,   458,   458,   465,
+     466,   469,   470,   471,   472,   473,   474,   478,   478,   490,
+     490,   502,   502,   512,   512,   519,   520,   523,   523,   531,
+     531,   538,   539,   542,   543,   544,   545,   546,   547,   548,
+     549,   552,   552,   564,   564,   572,   580,   580,   587,   601,
+     601,   611,   611,   618,   619,   622,   623,   626,   626,   634,
+     634,   643,   644,   647,   648,   649,   650,   651,   652,   653,
+     656,   656,   668,   668,   679,   687,   687,   703,   703,   713,
+     714,   717,   718,   719,   720,   721,   724,   724,   732,   732,
+     742,   742,   749,   749,   756,   756,   768,   768,   781,   782,
+     786,   790,   790,   802,   803,   807,   807,   815,   816,   819,
+     820,   821,   822,   823,   824,   825,   828,   828,   836,   840,
+     840,   848,   848,   858,   859,   862,   862,   870,   871,   874,
+     875,   876,   877,   878,   879,   882,   882,   890,   895,   900,
+     905,   905,   913
   };
 
-  // Print the state stack on the debug stream.
   void
-  D2Parser::yystack_print_ ()
+  D2Parser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
+      *yycdebug_ << ' ' << int (i->state);
     *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  D2Parser::yy_reduce_print_ (int yyrule)
+  D2Parser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
@@ -2517,9 +2699,9 @@ namespace isc { namespace d2 {
 
 #line 14 "d2_parser.yy"
 } } // isc::d2
-#line 2521 "d2_parser.cc"
+#line 2703 "d2_parser.cc"
 
-#line 876 "d2_parser.yy"
+#line 921 "d2_parser.yy"
 
 
 void
@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.4.1.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton interface for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015, 2018-2019 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -38,12 +38,13 @@
 
 // C++ LALR(1) parser skeleton written by Akim Demaille.
 
-// Undocumented macros, especially those whose name start with YY_,
-// are private implementation details.  Do not rely on them.
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
 
 #ifndef YY_D2_PARSER_D2_PARSER_H_INCLUDED
 # define YY_D2_PARSER_D2_PARSER_H_INCLUDED
-// //                    "%code requires" blocks.
+// "%code requires" blocks.
 #line 17 "d2_parser.yy"
 
 #include <string>
@@ -56,7 +57,7 @@ using namespace isc::d2;
 using namespace isc::data;
 using namespace std;
 
-#line 60 "d2_parser.h"
+#line 61 "d2_parser.h"
 
 # include <cassert>
 # include <cstdlib> // std::abort
@@ -103,44 +104,48 @@ using namespace std;
 #endif
 # include "location.hh"
 #include <typeinfo>
-#ifndef YYASSERT
+#ifndef D2_PARSER__ASSERT
 # include <cassert>
-# define YYASSERT assert
+# define D2_PARSER__ASSERT assert
 #endif
 
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
 # else
-#  define YY_ATTRIBUTE(Spec) /* empty */
+#  define YY_ATTRIBUTE_PURE
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
-#endif
-
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && ! defined __ICC && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -153,6 +158,27 @@ using namespace std;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
 #  if defined __cplusplus
 #   if 201103L <= __cplusplus
@@ -180,7 +206,7 @@ using namespace std;
 
 #line 14 "d2_parser.yy"
 namespace isc { namespace d2 {
-#line 184 "d2_parser.h"
+#line 210 "d2_parser.h"
 
 
 
@@ -189,37 +215,49 @@ namespace isc { namespace d2 {
   class D2Parser
   {
   public:
-#ifndef D2_PARSER_STYPE
+#ifdef D2_PARSER_STYPE
+# ifdef __GNUC__
+#  pragma GCC message "bison: do not #define D2_PARSER_STYPE in C++, use %define api.value.type"
+# endif
+    typedef D2_PARSER_STYPE value_type;
+#else
   /// A buffer to store and retrieve objects.
   ///
   /// Sort of a variant, but does not keep track of the nature
   /// of the stored data, since that knowledge is available
   /// via the current parser state.
-  class semantic_type
+  class value_type
   {
   public:
     /// Type of *this.
-    typedef semantic_type self_type;
+    typedef value_type self_type;
 
     /// Empty construction.
-    semantic_type () YY_NOEXCEPT
-      : yybuffer_ ()
+    value_type () YY_NOEXCEPT
+      : yyraw_ ()
       , yytypeid_ (YY_NULLPTR)
     {}
 
     /// Construct and fill.
     template <typename T>
-    semantic_type (YY_RVREF (T) t)
+    value_type (YY_RVREF (T) t)
       : yytypeid_ (&typeid (T))
     {
-      YYASSERT (sizeof (T) <= size);
+      D2_PARSER__ASSERT (sizeof (T) <= size);
       new (yyas_<T> ()) T (YY_MOVE (t));
     }
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    value_type (const self_type&) = delete;
+    /// Non copyable.
+    self_type& operator= (const self_type&) = delete;
+#endif
+
     /// Destruction, allowed only if empty.
-    ~semantic_type () YY_NOEXCEPT
+    ~value_type () YY_NOEXCEPT
     {
-      YYASSERT (!yytypeid_);
+      D2_PARSER__ASSERT (!yytypeid_);
     }
 
 # if 201103L <= YY_CPLUSPLUS
@@ -228,8 +266,8 @@ namespace isc { namespace d2 {
     T&
     emplace (U&&... u)
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= size);
+      D2_PARSER__ASSERT (!yytypeid_);
+      D2_PARSER__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T (std::forward <U>(u)...);
     }
@@ -239,8 +277,8 @@ namespace isc { namespace d2 {
     T&
     emplace ()
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= size);
+      D2_PARSER__ASSERT (!yytypeid_);
+      D2_PARSER__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T ();
     }
@@ -250,8 +288,8 @@ namespace isc { namespace d2 {
     T&
     emplace (const T& t)
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= size);
+      D2_PARSER__ASSERT (!yytypeid_);
+      D2_PARSER__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T (t);
     }
@@ -280,9 +318,9 @@ namespace isc { namespace d2 {
     T&
     as () YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= size);
+      D2_PARSER__ASSERT (yytypeid_);
+      D2_PARSER__ASSERT (*yytypeid_ == typeid (T));
+      D2_PARSER__ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
@@ -291,9 +329,9 @@ namespace isc { namespace d2 {
     const T&
     as () const YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= size);
+      D2_PARSER__ASSERT (yytypeid_);
+      D2_PARSER__ASSERT (*yytypeid_ == typeid (T));
+      D2_PARSER__ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
@@ -309,8 +347,8 @@ namespace isc { namespace d2 {
     void
     swap (self_type& that) YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == *that.yytypeid_);
+      D2_PARSER__ASSERT (yytypeid_);
+      D2_PARSER__ASSERT (*yytypeid_ == *that.yytypeid_);
       std::swap (as<T> (), that.as<T> ());
     }
 
@@ -359,16 +397,19 @@ namespace isc { namespace d2 {
     }
 
   private:
-    /// Prohibit blind copies.
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    value_type (const self_type&);
+    /// Non copyable.
     self_type& operator= (const self_type&);
-    semantic_type (const self_type&);
+#endif
 
     /// Accessor to raw memory as \a T.
     template <typename T>
     T*
     yyas_ () YY_NOEXCEPT
     {
-      void *yyp = yybuffer_.yyraw;
+      void *yyp = yyraw_;
       return static_cast<T*> (yyp);
      }
 
@@ -377,7 +418,7 @@ namespace isc { namespace d2 {
     const T*
     yyas_ () const YY_NOEXCEPT
     {
-      const void *yyp = yybuffer_.yyraw;
+      const void *yyp = yyraw_;
       return static_cast<const T*> (yyp);
      }
 
@@ -387,6 +428,7 @@ namespace isc { namespace d2 {
       // value
       // map_value
       // ncr_protocol_value
+      // ncr_format_value
       char dummy1[sizeof (ElementPtr)];
 
       // "boolean"
@@ -409,18 +451,19 @@ namespace isc { namespace d2 {
     union
     {
       /// Strongest alignment constraints.
-      long double yyalign_me;
+      long double yyalign_me_;
       /// A buffer large enough to store any of the semantic values.
-      char yyraw[size];
-    } yybuffer_;
+      char yyraw_[size];
+    };
 
     /// Whether the content is built: if defined, the name of the stored type.
     const std::type_info *yytypeid_;
   };
 
-#else
-    typedef D2_PARSER_STYPE semantic_type;
 #endif
+    /// Backward compatibility (Bison 3.8).
+    typedef value_type semantic_type;
+
     /// Symbol locations.
     typedef location location_type;
 
@@ -442,88 +485,326 @@ namespace isc { namespace d2 {
       location_type location;
     };
 
-    /// Tokens.
+    /// Token kinds.
     struct token
     {
-      enum yytokentype
-      {
-        TOKEN_END = 0,
-        TOKEN_COMMA = 258,
-        TOKEN_COLON = 259,
-        TOKEN_LSQUARE_BRACKET = 260,
-        TOKEN_RSQUARE_BRACKET = 261,
-        TOKEN_LCURLY_BRACKET = 262,
-        TOKEN_RCURLY_BRACKET = 263,
-        TOKEN_NULL_TYPE = 264,
-        TOKEN_DHCP6 = 265,
-        TOKEN_DHCP4 = 266,
-        TOKEN_CONTROL_AGENT = 267,
-        TOKEN_DHCPDDNS = 268,
-        TOKEN_IP_ADDRESS = 269,
-        TOKEN_PORT = 270,
-        TOKEN_DNS_SERVER_TIMEOUT = 271,
-        TOKEN_NCR_PROTOCOL = 272,
-        TOKEN_UDP = 273,
-        TOKEN_TCP = 274,
-        TOKEN_NCR_FORMAT = 275,
-        TOKEN_JSON = 276,
-        TOKEN_USER_CONTEXT = 277,
-        TOKEN_COMMENT = 278,
-        TOKEN_FORWARD_DDNS = 279,
-        TOKEN_REVERSE_DDNS = 280,
-        TOKEN_DDNS_DOMAINS = 281,
-        TOKEN_KEY_NAME = 282,
-        TOKEN_DNS_SERVERS = 283,
-        TOKEN_HOSTNAME = 284,
-        TOKEN_TSIG_KEYS = 285,
-        TOKEN_ALGORITHM = 286,
-        TOKEN_DIGEST_BITS = 287,
-        TOKEN_SECRET = 288,
-        TOKEN_CONTROL_SOCKET = 289,
-        TOKEN_SOCKET_TYPE = 290,
-        TOKEN_SOCKET_NAME = 291,
-        TOKEN_LOGGING = 292,
-        TOKEN_LOGGERS = 293,
-        TOKEN_NAME = 294,
-        TOKEN_OUTPUT_OPTIONS = 295,
-        TOKEN_OUTPUT = 296,
-        TOKEN_DEBUGLEVEL = 297,
-        TOKEN_SEVERITY = 298,
-        TOKEN_FLUSH = 299,
-        TOKEN_MAXSIZE = 300,
-        TOKEN_MAXVER = 301,
-        TOKEN_TOPLEVEL_JSON = 302,
-        TOKEN_TOPLEVEL_DHCPDDNS = 303,
-        TOKEN_SUB_DHCPDDNS = 304,
-        TOKEN_SUB_TSIG_KEY = 305,
-        TOKEN_SUB_TSIG_KEYS = 306,
-        TOKEN_SUB_DDNS_DOMAIN = 307,
-        TOKEN_SUB_DDNS_DOMAINS = 308,
-        TOKEN_SUB_DNS_SERVER = 309,
-        TOKEN_SUB_DNS_SERVERS = 310,
-        TOKEN_STRING = 311,
-        TOKEN_INTEGER = 312,
-        TOKEN_FLOAT = 313,
-        TOKEN_BOOLEAN = 314
+      enum token_kind_type
+      {
+        TOKEN_D2_PARSER_EMPTY = -2,
+    TOKEN_END = 0,                 // "end of file"
+    TOKEN_D2_PARSER_error = 256,   // error
+    TOKEN_D2_PARSER_UNDEF = 257,   // "invalid token"
+    TOKEN_COMMA = 258,             // ","
+    TOKEN_COLON = 259,             // ":"
+    TOKEN_LSQUARE_BRACKET = 260,   // "["
+    TOKEN_RSQUARE_BRACKET = 261,   // "]"
+    TOKEN_LCURLY_BRACKET = 262,    // "{"
+    TOKEN_RCURLY_BRACKET = 263,    // "}"
+    TOKEN_NULL_TYPE = 264,         // "null"
+    TOKEN_DHCP6 = 265,             // "Dhcp6"
+    TOKEN_DHCP4 = 266,             // "Dhcp4"
+    TOKEN_CONTROL_AGENT = 267,     // "Control-agent"
+    TOKEN_DHCPDDNS = 268,          // "DhcpDdns"
+    TOKEN_IP_ADDRESS = 269,        // "ip-address"
+    TOKEN_PORT = 270,              // "port"
+    TOKEN_DNS_SERVER_TIMEOUT = 271, // "dns-server-timeout"
+    TOKEN_NCR_PROTOCOL = 272,      // "ncr-protocol"
+    TOKEN_UDP = 273,               // "UDP"
+    TOKEN_TCP = 274,               // "TCP"
+    TOKEN_NCR_FORMAT = 275,        // "ncr-format"
+    TOKEN_JSON = 276,              // "JSON"
+    TOKEN_BINARY = 277,            // "BINARY"
+    TOKEN_USER_CONTEXT = 278,      // "user-context"
+    TOKEN_COMMENT = 279,           // "comment"
+    TOKEN_FORWARD_DDNS = 280,      // "forward-ddns"
+    TOKEN_REVERSE_DDNS = 281,      // "reverse-ddns"
+    TOKEN_DDNS_DOMAINS = 282,      // "ddns-domains"
+    TOKEN_KEY_NAME = 283,          // "key-name"
+    TOKEN_DNS_SERVERS = 284,       // "dns-servers"
+    TOKEN_HOSTNAME = 285,          // "hostname"
+    TOKEN_PROTOCOL = 286,          // "protocol"
+    TOKEN_MAX_TRANSACTIONS = 287,  // "max-transactions"
+    TOKEN_TSIG_KEYS = 288,         // "tsig-keys"
+    TOKEN_ALGORITHM = 289,         // "algorithm"
+    TOKEN_DIGEST_BITS = 290,       // "digest-bits"
+    TOKEN_SECRET = 291,            // "secret"
+    TOKEN_CONTROL_SOCKET = 292,    // "control-socket"
+    TOKEN_SOCKET_TYPE = 293,       // "socket-type"
+    TOKEN_SOCKET_NAME = 294,       // "socket-name"
+    TOKEN_LOGGING = 295,           // "Logging"
+    TOKEN_LOGGERS = 296,           // "loggers"
+    TOKEN_NAME = 297,              // "name"
+    TOKEN_OUTPUT_OPTIONS = 298,    // "output_options"
+    TOKEN_OUTPUT = 299,            // "output"
+    TOKEN_DEBUGLEVEL = 300,        // "debuglevel"
+    TOKEN_SEVERITY = 301,          // "severity"
+    TOKEN_FLUSH = 302,             // "flush"
+    TOKEN_MAXSIZE = 303,           // "maxsize"
+    TOKEN_MAXVER = 304,            // "maxver"
+    TOKEN_ASYNC = 305,             // "async"
+    TOKEN_ASYNC_QUEUE_SIZE = 306,  // "async-queue-size"
+    TOKEN_TOPLEVEL_JSON = 307,     // TOPLEVEL_JSON
+    TOKEN_TOPLEVEL_DHCPDDNS = 308, // TOPLEVEL_DHCPDDNS
+    TOKEN_SUB_DHCPDDNS = 309,      // SUB_DHCPDDNS
+    TOKEN_SUB_TSIG_KEY = 310,      // SUB_TSIG_KEY
+    TOKEN_SUB_TSIG_KEYS = 311,     // SUB_TSIG_KEYS
+    TOKEN_SUB_DDNS_DOMAIN = 312,   // SUB_DDNS_DOMAIN
+    TOKEN_SUB_DDNS_DOMAINS = 313,  // SUB_DDNS_DOMAINS
+    TOKEN_SUB_DNS_SERVER = 314,    // SUB_DNS_SERVER
+    TOKEN_SUB_DNS_SERVERS = 315,   // SUB_DNS_SERVERS
+    TOKEN_STRING = 316,            // "constant string"
+    TOKEN_INTEGER = 317,           // "integer"
+    TOKEN_FLOAT = 318,             // "floating point"
+    TOKEN_BOOLEAN = 319            // "boolean"
       };
+      /// Backward compatibility alias (Bison 3.6).
+      typedef token_kind_type yytokentype;
     };
 
-    /// (External) token type, as returned by yylex.
-    typedef token::yytokentype token_type;
+    /// Token kind, as returned by yylex.
+    typedef token::token_kind_type token_kind_type;
 
-    /// Symbol type: an internal symbol number.
-    typedef int symbol_number_type;
+    /// Backward compatibility alias (Bison 3.6).
+    typedef token_kind_type token_type;
 
-    /// The symbol type number to denote an empty symbol.
-    enum { empty_symbol = -2 };
+    /// Symbol kinds.
+    struct symbol_kind
+    {
+      enum symbol_kind_type
+      {
+        YYNTOKENS = 65, ///< Number of tokens.
+        S_YYEMPTY = -2,
+        S_YYEOF = 0,                             // "end of file"
+        S_YYerror = 1,                           // error
+        S_YYUNDEF = 2,                           // "invalid token"
+        S_COMMA = 3,                             // ","
+        S_COLON = 4,                             // ":"
+        S_LSQUARE_BRACKET = 5,                   // "["
+        S_RSQUARE_BRACKET = 6,                   // "]"
+        S_LCURLY_BRACKET = 7,                    // "{"
+        S_RCURLY_BRACKET = 8,                    // "}"
+        S_NULL_TYPE = 9,                         // "null"
+        S_DHCP6 = 10,                            // "Dhcp6"
+        S_DHCP4 = 11,                            // "Dhcp4"
+        S_CONTROL_AGENT = 12,                    // "Control-agent"
+        S_DHCPDDNS = 13,                         // "DhcpDdns"
+        S_IP_ADDRESS = 14,                       // "ip-address"
+        S_PORT = 15,                             // "port"
+        S_DNS_SERVER_TIMEOUT = 16,               // "dns-server-timeout"
+        S_NCR_PROTOCOL = 17,                     // "ncr-protocol"
+        S_UDP = 18,                              // "UDP"
+        S_TCP = 19,                              // "TCP"
+        S_NCR_FORMAT = 20,                       // "ncr-format"
+        S_JSON = 21,                             // "JSON"
+        S_BINARY = 22,                           // "BINARY"
+        S_USER_CONTEXT = 23,                     // "user-context"
+        S_COMMENT = 24,                          // "comment"
+        S_FORWARD_DDNS = 25,                     // "forward-ddns"
+        S_REVERSE_DDNS = 26,                     // "reverse-ddns"
+        S_DDNS_DOMAINS = 27,                     // "ddns-domains"
+        S_KEY_NAME = 28,                         // "key-name"
+        S_DNS_SERVERS = 29,                      // "dns-servers"
+        S_HOSTNAME = 30,                         // "hostname"
+        S_PROTOCOL = 31,                         // "protocol"
+        S_MAX_TRANSACTIONS = 32,                 // "max-transactions"
+        S_TSIG_KEYS = 33,                        // "tsig-keys"
+        S_ALGORITHM = 34,                        // "algorithm"
+        S_DIGEST_BITS = 35,                      // "digest-bits"
+        S_SECRET = 36,                           // "secret"
+        S_CONTROL_SOCKET = 37,                   // "control-socket"
+        S_SOCKET_TYPE = 38,                      // "socket-type"
+        S_SOCKET_NAME = 39,                      // "socket-name"
+        S_LOGGING = 40,                          // "Logging"
+        S_LOGGERS = 41,                          // "loggers"
+        S_NAME = 42,                             // "name"
+        S_OUTPUT_OPTIONS = 43,                   // "output_options"
+        S_OUTPUT = 44,                           // "output"
+        S_DEBUGLEVEL = 45,                       // "debuglevel"
+        S_SEVERITY = 46,                         // "severity"
+        S_FLUSH = 47,                            // "flush"
+        S_MAXSIZE = 48,                          // "maxsize"
+        S_MAXVER = 49,                           // "maxver"
+        S_ASYNC = 50,                            // "async"
+        S_ASYNC_QUEUE_SIZE = 51,                 // "async-queue-size"
+        S_TOPLEVEL_JSON = 52,                    // TOPLEVEL_JSON
+        S_TOPLEVEL_DHCPDDNS = 53,                // TOPLEVEL_DHCPDDNS
+        S_SUB_DHCPDDNS = 54,                     // SUB_DHCPDDNS
+        S_SUB_TSIG_KEY = 55,                     // SUB_TSIG_KEY
+        S_SUB_TSIG_KEYS = 56,                    // SUB_TSIG_KEYS
+        S_SUB_DDNS_DOMAIN = 57,                  // SUB_DDNS_DOMAIN
+        S_SUB_DDNS_DOMAINS = 58,                 // SUB_DDNS_DOMAINS
+        S_SUB_DNS_SERVER = 59,                   // SUB_DNS_SERVER
+        S_SUB_DNS_SERVERS = 60,                  // SUB_DNS_SERVERS
+        S_STRING = 61,                           // "constant string"
+        S_INTEGER = 62,                          // "integer"
+        S_FLOAT = 63,                            // "floating point"
+        S_BOOLEAN = 64,                          // "boolean"
+        S_YYACCEPT = 65,                         // $accept
+        S_start = 66,                            // start
+        S_67_1 = 67,                             // $@1
+        S_68_2 = 68,                             // $@2
+        S_69_3 = 69,                             // $@3
+        S_70_4 = 70,                             // $@4
+        S_71_5 = 71,                             // $@5
+        S_72_6 = 72,                             // $@6
+        S_73_7 = 73,                             // $@7
+        S_74_8 = 74,                             // $@8
+        S_75_9 = 75,                             // $@9
+        S_value = 76,                            // value
+        S_sub_json = 77,                         // sub_json
+        S_map2 = 78,                             // map2
+        S_79_10 = 79,                            // $@10
+        S_map_value = 80,                        // map_value
+        S_map_content = 81,                      // map_content
+        S_not_empty_map = 82,                    // not_empty_map
+        S_list_generic = 83,                     // list_generic
+        S_84_11 = 84,                            // $@11
+        S_list_content = 85,                     // list_content
+        S_not_empty_list = 86,                   // not_empty_list
+        S_unknown_map_entry = 87,                // unknown_map_entry
+        S_syntax_map = 88,                       // syntax_map
+        S_89_12 = 89,                            // $@12
+        S_global_objects = 90,                   // global_objects
+        S_global_object = 91,                    // global_object
+        S_dhcpddns_object = 92,                  // dhcpddns_object
+        S_93_13 = 93,                            // $@13
+        S_sub_dhcpddns = 94,                     // sub_dhcpddns
+        S_95_14 = 95,                            // $@14
+        S_dhcpddns_params = 96,                  // dhcpddns_params
+        S_dhcpddns_param = 97,                   // dhcpddns_param
+        S_ip_address = 98,                       // ip_address
+        S_99_15 = 99,                            // $@15
+        S_port = 100,                            // port
+        S_dns_server_timeout = 101,              // dns_server_timeout
+        S_ncr_protocol = 102,                    // ncr_protocol
+        S_103_16 = 103,                          // $@16
+        S_ncr_protocol_value = 104,              // ncr_protocol_value
+        S_ncr_format = 105,                      // ncr_format
+        S_106_17 = 106,                          // $@17
+        S_ncr_format_value = 107,                // ncr_format_value
+        S_user_context = 108,                    // user_context
+        S_109_18 = 109,                          // $@18
+        S_comment = 110,                         // comment
+        S_111_19 = 111,                          // $@19
+        S_forward_ddns = 112,                    // forward_ddns
+        S_113_20 = 113,                          // $@20
+        S_reverse_ddns = 114,                    // reverse_ddns
+        S_115_21 = 115,                          // $@21
+        S_ddns_mgr_params = 116,                 // ddns_mgr_params
+        S_not_empty_ddns_mgr_params = 117,       // not_empty_ddns_mgr_params
+        S_ddns_mgr_param = 118,                  // ddns_mgr_param
+        S_ddns_domains = 119,                    // ddns_domains
+        S_120_22 = 120,                          // $@22
+        S_sub_ddns_domains = 121,                // sub_ddns_domains
+        S_122_23 = 122,                          // $@23
+        S_ddns_domain_list = 123,                // ddns_domain_list
+        S_not_empty_ddns_domain_list = 124,      // not_empty_ddns_domain_list
+        S_ddns_domain = 125,                     // ddns_domain
+        S_126_24 = 126,                          // $@24
+        S_sub_ddns_domain = 127,                 // sub_ddns_domain
+        S_128_25 = 128,                          // $@25
+        S_ddns_domain_params = 129,              // ddns_domain_params
+        S_ddns_domain_param = 130,               // ddns_domain_param
+        S_ddns_domain_name = 131,                // ddns_domain_name
+        S_132_26 = 132,                          // $@26
+        S_ddns_domain_key_name = 133,            // ddns_domain_key_name
+        S_134_27 = 134,                          // $@27
+        S_dns_servers = 135,                     // dns_servers
+        S_136_28 = 136,                          // $@28
+        S_sub_dns_servers = 137,                 // sub_dns_servers
+        S_138_29 = 138,                          // $@29
+        S_dns_server_list = 139,                 // dns_server_list
+        S_dns_server = 140,                      // dns_server
+        S_141_30 = 141,                          // $@30
+        S_sub_dns_server = 142,                  // sub_dns_server
+        S_143_31 = 143,                          // $@31
+        S_dns_server_params = 144,               // dns_server_params
+        S_dns_server_param = 145,                // dns_server_param
+        S_dns_server_hostname = 146,             // dns_server_hostname
+        S_147_32 = 147,                          // $@32
+        S_dns_server_ip_address = 148,           // dns_server_ip_address
+        S_149_33 = 149,                          // $@33
+        S_dns_server_port = 150,                 // dns_server_port
+        S_dns_server_protocol = 151,             // dns_server_protocol
+        S_152_34 = 152,                          // $@34
+        S_dns_server_max_transactions = 153,     // dns_server_max_transactions
+        S_tsig_keys = 154,                       // tsig_keys
+        S_155_35 = 155,                          // $@35
+        S_sub_tsig_keys = 156,                   // sub_tsig_keys
+        S_157_36 = 157,                          // $@36
+        S_tsig_keys_list = 158,                  // tsig_keys_list
+        S_not_empty_tsig_keys_list = 159,        // not_empty_tsig_keys_list
+        S_tsig_key = 160,                        // tsig_key
+        S_161_37 = 161,                          // $@37
+        S_sub_tsig_key = 162,                    // sub_tsig_key
+        S_163_38 = 163,                          // $@38
+        S_tsig_key_params = 164,                 // tsig_key_params
+        S_tsig_key_param = 165,                  // tsig_key_param
+        S_tsig_key_name = 166,                   // tsig_key_name
+        S_167_39 = 167,                          // $@39
+        S_tsig_key_algorithm = 168,              // tsig_key_algorithm
+        S_169_40 = 169,                          // $@40
+        S_tsig_key_digest_bits = 170,            // tsig_key_digest_bits
+        S_tsig_key_secret = 171,                 // tsig_key_secret
+        S_172_41 = 172,                          // $@41
+        S_control_socket = 173,                  // control_socket
+        S_174_42 = 174,                          // $@42
+        S_control_socket_params = 175,           // control_socket_params
+        S_control_socket_param = 176,            // control_socket_param
+        S_control_socket_type = 177,             // control_socket_type
+        S_178_43 = 178,                          // $@43
+        S_control_socket_name = 179,             // control_socket_name
+        S_180_44 = 180,                          // $@44
+        S_dhcp6_json_object = 181,               // dhcp6_json_object
+        S_182_45 = 182,                          // $@45
+        S_dhcp4_json_object = 183,               // dhcp4_json_object
+        S_184_46 = 184,                          // $@46
+        S_control_agent_json_object = 185,       // control_agent_json_object
+        S_186_47 = 186,                          // $@47
+        S_logging_object = 187,                  // logging_object
+        S_188_48 = 188,                          // $@48
+        S_logging_params = 189,                  // logging_params
+        S_logging_param = 190,                   // logging_param
+        S_loggers = 191,                         // loggers
+        S_192_49 = 192,                          // $@49
+        S_loggers_entries = 193,                 // loggers_entries
+        S_logger_entry = 194,                    // logger_entry
+        S_195_50 = 195,                          // $@50
+        S_logger_params = 196,                   // logger_params
+        S_logger_param = 197,                    // logger_param
+        S_name = 198,                            // name
+        S_199_51 = 199,                          // $@51
+        S_debuglevel = 200,                      // debuglevel
+        S_severity = 201,                        // severity
+        S_202_52 = 202,                          // $@52
+        S_output_options_list = 203,             // output_options_list
+        S_204_53 = 204,                          // $@53
+        S_output_options_list_content = 205,     // output_options_list_content
+        S_output_entry = 206,                    // output_entry
+        S_207_54 = 207,                          // $@54
+        S_output_params_list = 208,              // output_params_list
+        S_output_params = 209,                   // output_params
+        S_output = 210,                          // output
+        S_211_55 = 211,                          // $@55
+        S_flush = 212,                           // flush
+        S_maxsize = 213,                         // maxsize
+        S_maxver = 214,                          // maxver
+        S_async = 215,                           // async
+        S_216_56 = 216,                          // $@56
+        S_async_queue_size = 217                 // async_queue_size
+      };
+    };
+
+    /// (Internal) symbol kind.
+    typedef symbol_kind::symbol_kind_type symbol_kind_type;
 
-    /// Internal symbol number for tokens (subsumed by symbol_number_type).
-    typedef unsigned char token_number_type;
+    /// The number of tokens.
+    static const symbol_kind_type YYNTOKENS = symbol_kind::YYNTOKENS;
 
     /// A complete symbol.
     ///
-    /// Expects its Base type to provide access to the symbol type
-    /// via type_get ().
+    /// Expects its Base type to provide access to the symbol kind
+    /// via kind ().
     ///
     /// Provide access to semantic value and location.
     template <typename Base>
@@ -533,20 +814,54 @@ namespace isc { namespace d2 {
       typedef Base super_type;
 
       /// Default constructor.
-      basic_symbol ()
+      basic_symbol () YY_NOEXCEPT
         : value ()
         , location ()
       {}
 
 #if 201103L <= YY_CPLUSPLUS
       /// Move constructor.
-      basic_symbol (basic_symbol&& that);
+      basic_symbol (basic_symbol&& that)
+        : Base (std::move (that))
+        , value ()
+        , location (std::move (that.location))
+      {
+        switch (this->kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+        value.move< ElementPtr > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (std::move (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+      }
 #endif
 
       /// Copy constructor.
       basic_symbol (const basic_symbol& that);
 
-      /// Constructor for valueless symbols, and symbols from each type.
+      /// Constructors for typed symbols.
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, location_type&& l)
         : Base (t)
@@ -558,6 +873,7 @@ namespace isc { namespace d2 {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, ElementPtr&& v, location_type&& l)
         : Base (t)
@@ -571,6 +887,7 @@ namespace isc { namespace d2 {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, bool&& v, location_type&& l)
         : Base (t)
@@ -584,6 +901,7 @@ namespace isc { namespace d2 {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, double&& v, location_type&& l)
         : Base (t)
@@ -597,6 +915,7 @@ namespace isc { namespace d2 {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, int64_t&& v, location_type&& l)
         : Base (t)
@@ -610,6 +929,7 @@ namespace isc { namespace d2 {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, std::string&& v, location_type&& l)
         : Base (t)
@@ -630,41 +950,44 @@ namespace isc { namespace d2 {
         clear ();
       }
 
+
+
       /// Destroy contents, and record that is empty.
-      void clear ()
+      void clear () YY_NOEXCEPT
       {
         // User destructor.
-        symbol_number_type yytype = this->type_get ();
+        symbol_kind_type yykind = this->kind ();
         basic_symbol<Base>& yysym = *this;
         (void) yysym;
-        switch (yytype)
+        switch (yykind)
         {
        default:
           break;
         }
 
-        // Type destructor.
-switch (yytype)
+        // Value type destructor.
+switch (yykind)
     {
-      case 71: // value
-      case 75: // map_value
-      case 99: // ncr_protocol_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
         value.template destroy< ElementPtr > ();
         break;
 
-      case 59: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.template destroy< bool > ();
         break;
 
-      case 58: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.template destroy< double > ();
         break;
 
-      case 57: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.template destroy< int64_t > ();
         break;
 
-      case 56: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.template destroy< std::string > ();
         break;
 
@@ -675,6 +998,15 @@ switch (yytype)
         Base::clear ();
       }
 
+      /// The user-facing name of this symbol.
+      std::string name () const YY_NOEXCEPT
+      {
+        return D2Parser::symbol_name (this->kind ());
+      }
+
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
+
       /// Whether empty.
       bool empty () const YY_NOEXCEPT;
 
@@ -682,7 +1014,7 @@ switch (yytype)
       void move (basic_symbol& s);
 
       /// The semantic value.
-      semantic_type value;
+      value_type value;
 
       /// The location.
       location_type location;
@@ -695,125 +1027,132 @@ switch (yytype)
     };
 
     /// Type access provider for token (enum) based symbols.
-    struct by_type
+    struct by_kind
     {
+      /// The symbol kind as needed by the constructor.
+      typedef token_kind_type kind_type;
+
       /// Default constructor.
-      by_type ();
+      by_kind () YY_NOEXCEPT;
 
 #if 201103L <= YY_CPLUSPLUS
       /// Move constructor.
-      by_type (by_type&& that);
+      by_kind (by_kind&& that) YY_NOEXCEPT;
 #endif
 
       /// Copy constructor.
-      by_type (const by_type& that);
-
-      /// The symbol type as needed by the constructor.
-      typedef token_type kind_type;
+      by_kind (const by_kind& that) YY_NOEXCEPT;
 
       /// Constructor from (external) token numbers.
-      by_type (kind_type t);
+      by_kind (kind_type t) YY_NOEXCEPT;
+
+
 
       /// Record that this symbol is empty.
-      void clear ();
+      void clear () YY_NOEXCEPT;
 
-      /// Steal the symbol type from \a that.
-      void move (by_type& that);
+      /// Steal the symbol kind from \a that.
+      void move (by_kind& that);
 
       /// The (internal) type number (corresponding to \a type).
       /// \a empty when empty.
-      symbol_number_type type_get () const YY_NOEXCEPT;
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
-      /// The token.
-      token_type token () const YY_NOEXCEPT;
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
 
-      /// The symbol type.
-      /// \a empty_symbol when empty.
-      /// An int, not token_number_type, to be able to store empty_symbol.
-      int type;
+      /// The symbol kind.
+      /// \a S_YYEMPTY when empty.
+      symbol_kind_type kind_;
     };
 
+    /// Backward compatibility for a private implementation detail (Bison 3.6).
+    typedef by_kind by_type;
+
     /// "External" symbols: returned by the scanner.
-    struct symbol_type : basic_symbol<by_type>
+    struct symbol_type : basic_symbol<by_kind>
     {
       /// Superclass.
-      typedef basic_symbol<by_type> super_type;
+      typedef basic_symbol<by_kind> super_type;
 
       /// Empty symbol.
-      symbol_type () {}
+      symbol_type () YY_NOEXCEPT {}
 
       /// Constructor for valueless symbols, and symbols from each type.
 #if 201103L <= YY_CPLUSPLUS
       symbol_type (int tok, location_type l)
-        : super_type(token_type (tok), std::move (l))
-      {
-        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_DHCP6 || tok == token::TOKEN_DHCP4 || tok == token::TOKEN_CONTROL_AGENT || tok == token::TOKEN_DHCPDDNS || tok == token::TOKEN_IP_ADDRESS || tok == token::TOKEN_PORT || tok == token::TOKEN_DNS_SERVER_TIMEOUT || tok == token::TOKEN_NCR_PROTOCOL || tok == token::TOKEN_UDP || tok == token::TOKEN_TCP || tok == token::TOKEN_NCR_FORMAT || tok == token::TOKEN_JSON || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_FORWARD_DDNS || tok == token::TOKEN_REVERSE_DDNS || tok == token::TOKEN_DDNS_DOMAINS || tok == token::TOKEN_KEY_NAME || tok == token::TOKEN_DNS_SERVERS || tok == token::TOKEN_HOSTNAME || tok == token::TOKEN_TSIG_KEYS || tok == token::TOKEN_ALGORITHM || tok == token::TOKEN_DIGEST_BITS || tok == token::TOKEN_SECRET || tok == token::TOKEN_CONTROL_SOCKET || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_NAME || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_TOPLEVEL_JSON || tok == token::TOKEN_TOPLEVEL_DHCPDDNS || tok == token::TOKEN_SUB_DHCPDDNS || tok == token::TOKEN_SUB_TSIG_KEY || tok == token::TOKEN_SUB_TSIG_KEYS || tok == token::TOKEN_SUB_DDNS_DOMAIN || tok == token::TOKEN_SUB_DDNS_DOMAINS || tok == token::TOKEN_SUB_DNS_SERVER || tok == token::TOKEN_SUB_DNS_SERVERS);
-      }
+        : super_type (token_kind_type (tok), std::move (l))
 #else
       symbol_type (int tok, const location_type& l)
-        : super_type(token_type (tok), l)
+        : super_type (token_kind_type (tok), l)
+#endif
       {
-        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_DHCP6 || tok == token::TOKEN_DHCP4 || tok == token::TOKEN_CONTROL_AGENT || tok == token::TOKEN_DHCPDDNS || tok == token::TOKEN_IP_ADDRESS || tok == token::TOKEN_PORT || tok == token::TOKEN_DNS_SERVER_TIMEOUT || tok == token::TOKEN_NCR_PROTOCOL || tok == token::TOKEN_UDP || tok == token::TOKEN_TCP || tok == token::TOKEN_NCR_FORMAT || tok == token::TOKEN_JSON || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_FORWARD_DDNS || tok == token::TOKEN_REVERSE_DDNS || tok == token::TOKEN_DDNS_DOMAINS || tok == token::TOKEN_KEY_NAME || tok == token::TOKEN_DNS_SERVERS || tok == token::TOKEN_HOSTNAME || tok == token::TOKEN_TSIG_KEYS || tok == token::TOKEN_ALGORITHM || tok == token::TOKEN_DIGEST_BITS || tok == token::TOKEN_SECRET || tok == token::TOKEN_CONTROL_SOCKET || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_NAME || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_TOPLEVEL_JSON || tok == token::TOKEN_TOPLEVEL_DHCPDDNS || tok == token::TOKEN_SUB_DHCPDDNS || tok == token::TOKEN_SUB_TSIG_KEY || tok == token::TOKEN_SUB_TSIG_KEYS || tok == token::TOKEN_SUB_DDNS_DOMAIN || tok == token::TOKEN_SUB_DDNS_DOMAINS || tok == token::TOKEN_SUB_DNS_SERVER || tok == token::TOKEN_SUB_DNS_SERVERS);
-      }
+#if !defined _MSC_VER || defined __clang__
+        D2_PARSER__ASSERT (tok == token::TOKEN_END
+                   || (token::TOKEN_D2_PARSER_error <= tok && tok <= token::TOKEN_SUB_DNS_SERVERS));
 #endif
+      }
 #if 201103L <= YY_CPLUSPLUS
       symbol_type (int tok, bool v, location_type l)
-        : super_type(token_type (tok), std::move (v), std::move (l))
-      {
-        YYASSERT (tok == token::TOKEN_BOOLEAN);
-      }
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
 #else
       symbol_type (int tok, const bool& v, const location_type& l)
-        : super_type(token_type (tok), v, l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
       {
-        YYASSERT (tok == token::TOKEN_BOOLEAN);
-      }
+#if !defined _MSC_VER || defined __clang__
+        D2_PARSER__ASSERT (tok == token::TOKEN_BOOLEAN);
 #endif
+      }
 #if 201103L <= YY_CPLUSPLUS
       symbol_type (int tok, double v, location_type l)
-        : super_type(token_type (tok), std::move (v), std::move (l))
-      {
-        YYASSERT (tok == token::TOKEN_FLOAT);
-      }
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
 #else
       symbol_type (int tok, const double& v, const location_type& l)
-        : super_type(token_type (tok), v, l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
       {
-        YYASSERT (tok == token::TOKEN_FLOAT);
-      }
+#if !defined _MSC_VER || defined __clang__
+        D2_PARSER__ASSERT (tok == token::TOKEN_FLOAT);
 #endif
+      }
 #if 201103L <= YY_CPLUSPLUS
       symbol_type (int tok, int64_t v, location_type l)
-        : super_type(token_type (tok), std::move (v), std::move (l))
-      {
-        YYASSERT (tok == token::TOKEN_INTEGER);
-      }
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
 #else
       symbol_type (int tok, const int64_t& v, const location_type& l)
-        : super_type(token_type (tok), v, l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
       {
-        YYASSERT (tok == token::TOKEN_INTEGER);
-      }
+#if !defined _MSC_VER || defined __clang__
+        D2_PARSER__ASSERT (tok == token::TOKEN_INTEGER);
 #endif
+      }
 #if 201103L <= YY_CPLUSPLUS
       symbol_type (int tok, std::string v, location_type l)
-        : super_type(token_type (tok), std::move (v), std::move (l))
-      {
-        YYASSERT (tok == token::TOKEN_STRING);
-      }
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
 #else
       symbol_type (int tok, const std::string& v, const location_type& l)
-        : super_type(token_type (tok), v, l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
       {
-        YYASSERT (tok == token::TOKEN_STRING);
-      }
+#if !defined _MSC_VER || defined __clang__
+        D2_PARSER__ASSERT (tok == token::TOKEN_STRING);
 #endif
+      }
     };
 
     /// Build a parser object.
     D2Parser (isc::d2::D2ParserContext& ctx_yyarg);
     virtual ~D2Parser ();
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    D2Parser (const D2Parser&) = delete;
+    /// Non copyable.
+    D2Parser& operator= (const D2Parser&) = delete;
+#endif
+
     /// Parse.  An alias for parse ().
     /// \returns  0 iff parsing succeeded.
     int operator() ();
@@ -844,7 +1183,11 @@ switch (yytype)
     /// Report a syntax error.
     void error (const syntax_error& err);
 
-    // Implementation of make_symbol for each symbol type.
+    /// The user-facing name of the symbol whose (internal) number is
+    /// YYSYMBOL.  No bounds checking.
+    static std::string symbol_name (symbol_kind_type yysymbol);
+
+    // Implementation of make_symbol for each token kind.
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -860,6 +1203,36 @@ switch (yytype)
         return symbol_type (token::TOKEN_END, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_D2_PARSER_error (location_type l)
+      {
+        return symbol_type (token::TOKEN_D2_PARSER_error, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_D2_PARSER_error (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_D2_PARSER_error, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_D2_PARSER_UNDEF (location_type l)
+      {
+        return symbol_type (token::TOKEN_D2_PARSER_UNDEF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_D2_PARSER_UNDEF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_D2_PARSER_UNDEF, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -1145,6 +1518,21 @@ switch (yytype)
         return symbol_type (token::TOKEN_JSON, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BINARY (location_type l)
+      {
+        return symbol_type (token::TOKEN_BINARY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BINARY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_BINARY, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -1265,6 +1653,36 @@ switch (yytype)
         return symbol_type (token::TOKEN_HOSTNAME, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PROTOCOL (location_type l)
+      {
+        return symbol_type (token::TOKEN_PROTOCOL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PROTOCOL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PROTOCOL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAX_TRANSACTIONS (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAX_TRANSACTIONS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAX_TRANSACTIONS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAX_TRANSACTIONS, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -1520,6 +1938,36 @@ switch (yytype)
         return symbol_type (token::TOKEN_MAXVER, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC_QUEUE_SIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_QUEUE_SIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC_QUEUE_SIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_QUEUE_SIZE, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -1717,93 +2165,119 @@ switch (yytype)
 #endif
 
 
+    class context
+    {
+    public:
+      context (const D2Parser& yyparser, const symbol_type& yyla);
+      const symbol_type& lookahead () const YY_NOEXCEPT { return yyla_; }
+      symbol_kind_type token () const YY_NOEXCEPT { return yyla_.kind (); }
+      const location_type& location () const YY_NOEXCEPT { return yyla_.location; }
+
+      /// Put in YYARG at most YYARGN of the expected tokens, and return the
+      /// number of tokens stored in YYARG.  If YYARG is null, return the
+      /// number of expected tokens (guaranteed to be less than YYNTOKENS).
+      int expected_tokens (symbol_kind_type yyarg[], int yyargn) const;
+
+    private:
+      const D2Parser& yyparser_;
+      const symbol_type& yyla_;
+    };
+
   private:
-    /// This class is not copyable.
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
     D2Parser (const D2Parser&);
+    /// Non copyable.
     D2Parser& operator= (const D2Parser&);
+#endif
 
-    /// State numbers.
-    typedef int state_type;
 
-    /// Generate an error message.
-    /// \param yystate   the state where the error occurred.
-    /// \param yyla      the lookahead token.
-    virtual std::string yysyntax_error_ (state_type yystate,
-                                         const symbol_type& yyla) const;
+    /// Stored state numbers (used for stacks).
+    typedef short state_type;
+
+    /// The arguments of the error message.
+    int yy_syntax_error_arguments_ (const context& yyctx,
+                                    symbol_kind_type yyarg[], int yyargn) const;
 
+    /// Generate an error message.
+    /// \param yyctx     the context in which the error occurred.
+    virtual std::string yysyntax_error_ (const context& yyctx) const;
     /// Compute post-reduction state.
     /// \param yystate   the current state
     /// \param yysym     the nonterminal to push on the stack
-    state_type yy_lr_goto_state_ (state_type yystate, int yysym);
+    static state_type yy_lr_goto_state_ (state_type yystate, int yysym);
 
     /// Whether the given \c yypact_ value indicates a defaulted state.
     /// \param yyvalue   the value to check
-    static bool yy_pact_value_is_default_ (int yyvalue);
+    static bool yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT;
 
     /// Whether the given \c yytable_ value indicates a syntax error.
     /// \param yyvalue   the value to check
-    static bool yy_table_value_is_error_ (int yyvalue);
+    static bool yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT;
 
     static const short yypact_ninf_;
     static const signed char yytable_ninf_;
 
-    /// Convert a scanner token number \a t to a symbol number.
-    static token_number_type yytranslate_ (token_type t);
+    /// Convert a scanner token kind \a t to a symbol kind.
+    /// In theory \a t should be a token_kind_type, but character literals
+    /// are valid, yet not members of the token_kind_type enum.
+    static symbol_kind_type yytranslate_ (int t) YY_NOEXCEPT;
 
-    // Tables.
-  // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-  // STATE-NUM.
-  static const short yypact_[];
+    /// Convert the symbol name \a n to a form suitable for a diagnostic.
+    static std::string yytnamerr_ (const char *yystr);
 
-  // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-  // Performed when YYTABLE does not specify something else to do.  Zero
-  // means the default is an error.
-  static const unsigned char yydefact_[];
+    /// For a symbol, its name in clear.
+    static const char* const yytname_[];
 
-  // YYPGOTO[NTERM-NUM].
-  static const short yypgoto_[];
 
-  // YYDEFGOTO[NTERM-NUM].
-  static const short yydefgoto_[];
+    // Tables.
+    // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+    // STATE-NUM.
+    static const short yypact_[];
 
-  // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-  // positive, shift that token.  If negative, reduce the rule whose
-  // number is the opposite.  If YYTABLE_NINF, syntax error.
-  static const unsigned short yytable_[];
+    // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+    // Performed when YYTABLE does not specify something else to do.  Zero
+    // means the default is an error.
+    static const unsigned char yydefact_[];
 
-  static const short yycheck_[];
+    // YYPGOTO[NTERM-NUM].
+    static const short yypgoto_[];
 
-  // YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-  // symbol of state STATE-NUM.
-  static const unsigned char yystos_[];
+    // YYDEFGOTO[NTERM-NUM].
+    static const short yydefgoto_[];
 
-  // YYR1[YYN] -- Symbol number of symbol that rule YYN derives.
-  static const unsigned char yyr1_[];
+    // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+    // positive, shift that token.  If negative, reduce the rule whose
+    // number is the opposite.  If YYTABLE_NINF, syntax error.
+    static const short yytable_[];
 
-  // YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.
-  static const unsigned char yyr2_[];
+    static const short yycheck_[];
 
+    // YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+    // state STATE-NUM.
+    static const unsigned char yystos_[];
 
-    /// Convert the symbol name \a n to a form suitable for a diagnostic.
-    static std::string yytnamerr_ (const char *n);
+    // YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.
+    static const unsigned char yyr1_[];
+
+    // YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.
+    static const signed char yyr2_[];
 
 
-    /// For a symbol, its name in clear.
-    static const char* const yytname_[];
 #if D2_PARSER_DEBUG
-  // YYRLINE[YYN] -- Source line where rule number YYN was defined.
-  static const unsigned short yyrline_[];
+    // YYRLINE[YYN] -- Source line where rule number YYN was defined.
+    static const short yyrline_[];
     /// Report on the debug stream that the rule \a r is going to be reduced.
-    virtual void yy_reduce_print_ (int r);
+    virtual void yy_reduce_print_ (int r) const;
     /// Print the state stack on the debug stream.
-    virtual void yystack_print_ ();
+    virtual void yy_stack_print_ () const;
 
     /// Debugging level.
     int yydebug_;
     /// Debug stream.
     std::ostream* yycdebug_;
 
-    /// \brief Display a symbol type, value and location.
+    /// \brief Display a symbol kind, value and location.
     /// \param yyo    The output stream.
     /// \param yysym  The symbol.
     template <typename Base>
@@ -1824,7 +2298,7 @@ switch (yytype)
       /// Default constructor.
       by_state () YY_NOEXCEPT;
 
-      /// The symbol type as needed by the constructor.
+      /// The symbol kind as needed by the constructor.
       typedef state_type kind_type;
 
       /// Constructor.
@@ -1836,15 +2310,16 @@ switch (yytype)
       /// Record that this symbol is empty.
       void clear () YY_NOEXCEPT;
 
-      /// Steal the symbol type from \a that.
+      /// Steal the symbol kind from \a that.
       void move (by_state& that);
 
-      /// The (internal) type number (corresponding to \a state).
-      /// \a empty_symbol when empty.
-      symbol_number_type type_get () const YY_NOEXCEPT;
+      /// The symbol kind (corresponding to \a state).
+      /// \a symbol_kind::S_YYEMPTY when empty.
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
       /// The state number used to denote an empty symbol.
-      enum { empty_state = -1 };
+      /// We use the initial state, as it does not have a value.
+      enum { empty_state = 0 };
 
       /// The state.
       /// \a empty when empty.
@@ -1866,6 +2341,10 @@ switch (yytype)
       /// Assignment, needed by push_back by some old implementations.
       /// Moves the contents of that.
       stack_symbol_type& operator= (stack_symbol_type& that);
+
+      /// Assignment, needed by push_back by other implementations.
+      /// Needed by some other old implementations.
+      stack_symbol_type& operator= (const stack_symbol_type& that);
 #endif
     };
 
@@ -1875,48 +2354,38 @@ switch (yytype)
     {
     public:
       // Hide our reversed order.
-      typedef typename S::reverse_iterator iterator;
-      typedef typename S::const_reverse_iterator const_iterator;
+      typedef typename S::iterator iterator;
+      typedef typename S::const_iterator const_iterator;
       typedef typename S::size_type size_type;
+      typedef typename std::ptrdiff_t index_type;
 
-      stack (size_type n = 200)
+      stack (size_type n = 200) YY_NOEXCEPT
         : seq_ (n)
       {}
 
-      /// Random access.
-      ///
-      /// Index 0 returns the topmost element.
-      T&
-      operator[] (size_type i)
-      {
-        return seq_[size () - 1 - i];
-      }
-
-      /// Random access.
-      ///
-      /// Index 0 returns the topmost element.
-      T&
-      operator[] (int i)
-      {
-        return operator[] (size_type (i));
-      }
+#if 201103L <= YY_CPLUSPLUS
+      /// Non copyable.
+      stack (const stack&) = delete;
+      /// Non copyable.
+      stack& operator= (const stack&) = delete;
+#endif
 
       /// Random access.
       ///
       /// Index 0 returns the topmost element.
       const T&
-      operator[] (size_type i) const
+      operator[] (index_type i) const
       {
-        return seq_[size () - 1 - i];
+        return seq_[size_type (size () - 1 - i)];
       }
 
       /// Random access.
       ///
       /// Index 0 returns the topmost element.
-      const T&
-      operator[] (int i) const
+      T&
+      operator[] (index_type i)
       {
-        return operator[] (size_type (i));
+        return seq_[size_type (size () - 1 - i)];
       }
 
       /// Steal the contents of \a t.
@@ -1931,7 +2400,7 @@ switch (yytype)
 
       /// Pop elements from the stack.
       void
-      pop (int n = 1) YY_NOEXCEPT
+      pop (std::ptrdiff_t n = 1) YY_NOEXCEPT
       {
         for (; 0 < n; --n)
           seq_.pop_back ();
@@ -1945,49 +2414,53 @@ switch (yytype)
       }
 
       /// Number of elements on the stack.
-      size_type
+      index_type
       size () const YY_NOEXCEPT
       {
-        return seq_.size ();
+        return index_type (seq_.size ());
       }
 
       /// Iterator on top of the stack (going downwards).
       const_iterator
       begin () const YY_NOEXCEPT
       {
-        return seq_.rbegin ();
+        return seq_.begin ();
       }
 
       /// Bottom of the stack.
       const_iterator
       end () const YY_NOEXCEPT
       {
-        return seq_.rend ();
+        return seq_.end ();
       }
 
       /// Present a slice of the top of a stack.
       class slice
       {
       public:
-        slice (const stack& stack, int range)
+        slice (const stack& stack, index_type range) YY_NOEXCEPT
           : stack_ (stack)
           , range_ (range)
         {}
 
         const T&
-        operator[] (int i) const
+        operator[] (index_type i) const
         {
           return stack_[range_ - i];
         }
 
       private:
         const stack& stack_;
-        int range_;
+        index_type range_;
       };
 
     private:
+#if YY_CPLUSPLUS < 201103L
+      /// Non copyable.
       stack (const stack&);
+      /// Non copyable.
       stack& operator= (const stack&);
+#endif
       /// The wrapped container.
       S seq_;
     };
@@ -2015,33 +2488,30 @@ switch (yytype)
     void yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym);
 
     /// Pop \a n symbols from the stack.
-    void yypop_ (int n = 1);
+    void yypop_ (int n = 1) YY_NOEXCEPT;
 
     /// Constants.
     enum
     {
-      yyeof_ = 0,
-      yylast_ = 304,     ///< Last index in yytable_.
-      yynnts_ = 146,  ///< Number of nonterminal symbols.
-      yyfinal_ = 20, ///< Termination state number.
-      yyterror_ = 1,
-      yyerrcode_ = 256,
-      yyntokens_ = 60  ///< Number of tokens.
+      yylast_ = 317,     ///< Last index in yytable_.
+      yynnts_ = 153,  ///< Number of nonterminal symbols.
+      yyfinal_ = 20 ///< Termination state number.
     };
 
 
     // User arguments.
     isc::d2::D2ParserContext& ctx;
+
   };
 
   inline
-  D2Parser::token_number_type
-  D2Parser::yytranslate_ (token_type t)
+  D2Parser::symbol_kind_type
+  D2Parser::yytranslate_ (int t) YY_NOEXCEPT
   {
     // YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to
     // TOKEN-NUM as returned by yylex.
     static
-    const token_number_type
+    const signed char
     translate_table[] =
     {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -2075,85 +2545,48 @@ switch (yytype)
       25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
       35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
       45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64
     };
-    const unsigned user_token_number_max_ = 314;
-    const token_number_type undef_token_ = 2;
+    // Last valid token kind.
+    const int code_max = 319;
 
-    if (static_cast<int> (t) <= yyeof_)
-      return yyeof_;
-    else if (static_cast<unsigned> (t) <= user_token_number_max_)
-      return translate_table[t];
+    if (t <= 0)
+      return symbol_kind::S_YYEOF;
+    else if (t <= code_max)
+      return static_cast <symbol_kind_type> (translate_table[t]);
     else
-      return undef_token_;
+      return symbol_kind::S_YYUNDEF;
   }
 
   // basic_symbol.
-#if 201103L <= YY_CPLUSPLUS
-  template <typename Base>
-  D2Parser::basic_symbol<Base>::basic_symbol (basic_symbol&& that)
-    : Base (std::move (that))
-    , value ()
-    , location (std::move (that.location))
-  {
-    switch (this->type_get ())
-    {
-      case 71: // value
-      case 75: // map_value
-      case 99: // ncr_protocol_value
-        value.move< ElementPtr > (std::move (that.value));
-        break;
-
-      case 59: // "boolean"
-        value.move< bool > (std::move (that.value));
-        break;
-
-      case 58: // "floating point"
-        value.move< double > (std::move (that.value));
-        break;
-
-      case 57: // "integer"
-        value.move< int64_t > (std::move (that.value));
-        break;
-
-      case 56: // "constant string"
-        value.move< std::string > (std::move (that.value));
-        break;
-
-      default:
-        break;
-    }
-
-  }
-#endif
-
   template <typename Base>
   D2Parser::basic_symbol<Base>::basic_symbol (const basic_symbol& that)
     : Base (that)
     , value ()
     , location (that.location)
   {
-    switch (this->type_get ())
+    switch (this->kind ())
     {
-      case 71: // value
-      case 75: // map_value
-      case 99: // ncr_protocol_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
         value.copy< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 59: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.copy< bool > (YY_MOVE (that.value));
         break;
 
-      case 58: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.copy< double > (YY_MOVE (that.value));
         break;
 
-      case 57: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.copy< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 56: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.copy< std::string > (YY_MOVE (that.value));
         break;
 
@@ -2165,11 +2598,20 @@ switch (yytype)
 
 
 
+
+  template <typename Base>
+  D2Parser::symbol_kind_type
+  D2Parser::basic_symbol<Base>::type_get () const YY_NOEXCEPT
+  {
+    return this->kind ();
+  }
+
+
   template <typename Base>
   bool
   D2Parser::basic_symbol<Base>::empty () const YY_NOEXCEPT
   {
-    return Base::type_get () == empty_symbol;
+    return this->kind () == symbol_kind::S_YYEMPTY;
   }
 
   template <typename Base>
@@ -2177,27 +2619,28 @@ switch (yytype)
   D2Parser::basic_symbol<Base>::move (basic_symbol& s)
   {
     super_type::move (s);
-    switch (this->type_get ())
+    switch (this->kind ())
     {
-      case 71: // value
-      case 75: // map_value
-      case 99: // ncr_protocol_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
         value.move< ElementPtr > (YY_MOVE (s.value));
         break;
 
-      case 59: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (YY_MOVE (s.value));
         break;
 
-      case 58: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (YY_MOVE (s.value));
         break;
 
-      case 57: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (YY_MOVE (s.value));
         break;
 
-      case 56: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (YY_MOVE (s.value));
         break;
 
@@ -2208,77 +2651,67 @@ switch (yytype)
     location = YY_MOVE (s.location);
   }
 
-  // by_type.
+  // by_kind.
   inline
-  D2Parser::by_type::by_type ()
-    : type (empty_symbol)
+  D2Parser::by_kind::by_kind () YY_NOEXCEPT
+    : kind_ (symbol_kind::S_YYEMPTY)
   {}
 
 #if 201103L <= YY_CPLUSPLUS
   inline
-  D2Parser::by_type::by_type (by_type&& that)
-    : type (that.type)
+  D2Parser::by_kind::by_kind (by_kind&& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
   {
     that.clear ();
   }
 #endif
 
   inline
-  D2Parser::by_type::by_type (const by_type& that)
-    : type (that.type)
+  D2Parser::by_kind::by_kind (const by_kind& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
   {}
 
   inline
-  D2Parser::by_type::by_type (token_type t)
-    : type (yytranslate_ (t))
+  D2Parser::by_kind::by_kind (token_kind_type t) YY_NOEXCEPT
+    : kind_ (yytranslate_ (t))
   {}
 
+
+
   inline
   void
-  D2Parser::by_type::clear ()
+  D2Parser::by_kind::clear () YY_NOEXCEPT
   {
-    type = empty_symbol;
+    kind_ = symbol_kind::S_YYEMPTY;
   }
 
   inline
   void
-  D2Parser::by_type::move (by_type& that)
+  D2Parser::by_kind::move (by_kind& that)
   {
-    type = that.type;
+    kind_ = that.kind_;
     that.clear ();
   }
 
   inline
-  int
-  D2Parser::by_type::type_get () const YY_NOEXCEPT
+  D2Parser::symbol_kind_type
+  D2Parser::by_kind::kind () const YY_NOEXCEPT
   {
-    return type;
+    return kind_;
   }
 
+
   inline
-  D2Parser::token_type
-  D2Parser::by_type::token () const YY_NOEXCEPT
+  D2Parser::symbol_kind_type
+  D2Parser::by_kind::type_get () const YY_NOEXCEPT
   {
-    // YYTOKNUM[NUM] -- (External) token number corresponding to the
-    // (internal) symbol number NUM (which must be that of a token).  */
-    static
-    const unsigned short
-    yytoken_number_[] =
-    {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314
-    };
-    return token_type (yytoken_number_[type]);
+    return this->kind ();
   }
 
+
 #line 14 "d2_parser.yy"
 } } // isc::d2
-#line 2281 "d2_parser.h"
-
+#line 2715 "d2_parser.h"
 
 
 
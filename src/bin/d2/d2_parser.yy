@@ -62,6 +62,7 @@ using namespace std;
   TCP "TCP"
   NCR_FORMAT "ncr-format"
   JSON "JSON"
+  BINARY "BINARY"
   USER_CONTEXT "user-context"
   COMMENT "comment"
   FORWARD_DDNS "forward-ddns"
@@ -70,6 +71,8 @@ using namespace std;
   KEY_NAME "key-name"
   DNS_SERVERS "dns-servers"
   HOSTNAME "hostname"
+  PROTOCOL "protocol"
+  MAX_TRANSACTIONS "max-transactions"
   TSIG_KEYS "tsig-keys"
   ALGORITHM "algorithm"
   DIGEST_BITS "digest-bits"
@@ -89,6 +92,8 @@ using namespace std;
   FLUSH "flush"
   MAXSIZE "maxsize"
   MAXVER "maxver"
+  ASYNC "async"
+  ASYNC_QUEUE_SIZE "async-queue-size"
 
   // Not real tokens, just a way to signal what the parser is expected to
   // parse.
@@ -111,6 +116,7 @@ using namespace std;
 %type <ElementPtr> value
 %type <ElementPtr> map_value
 %type <ElementPtr> ncr_protocol_value
+%type <ElementPtr> ncr_format_value
 
 %printer { yyoutput << $$; } <*>;
 
@@ -320,12 +326,16 @@ ncr_protocol_value:
 
 ncr_format: NCR_FORMAT {
     ctx.enter(ctx.NCR_FORMAT);
-} COLON JSON {
-    ElementPtr json(new StringElement("JSON", ctx.loc2pos(@4)));
-    ctx.stack_.back()->set("ncr-format", json);
+} COLON ncr_format_value {
+    ctx.stack_.back()->set("ncr-format", $4);
     ctx.leave();
 };
 
+ncr_format_value:
+    JSON { $$ = ElementPtr(new StringElement("JSON", ctx.loc2pos(@1))); }
+  | BINARY { $$ = ElementPtr(new StringElement("BINARY", ctx.loc2pos(@1))); }
+  ;
+
 user_context: USER_CONTEXT {
     ctx.enter(ctx.NO_KEYWORD);
 } COLON map_value {
@@ -532,6 +542,8 @@ dns_server_params: dns_server_param
 dns_server_param: dns_server_hostname
               | dns_server_ip_address
               | dns_server_port
+              | dns_server_protocol
+              | dns_server_max_transactions
               | user_context
               | comment
               | unknown_map_entry
@@ -565,6 +577,21 @@ dns_server_port: PORT COLON INTEGER {
     ctx.stack_.back()->set("port", i);
 };
 
+dns_server_protocol: PROTOCOL {
+    ctx.enter(ctx.NCR_PROTOCOL);
+} COLON ncr_protocol_value {
+    ctx.stack_.back()->set("protocol", $4);
+    ctx.leave();
+};
+
+dns_server_max_transactions: MAX_TRANSACTIONS COLON INTEGER {
+    if ($3 < 0) {
+        error(@3, "max-transactions must not be negative");
+    }
+    ElementPtr i(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("max-transactions", i);
+};
+
 // --- end of dns-servers ---------------------------------
 
 
@@ -848,6 +875,8 @@ output_params: output
              | flush
              | maxsize
              | maxver
+             | async
+             | async_queue_size
              ;
 
 output: OUTPUT {
@@ -873,6 +902,22 @@ maxver: MAXVER COLON INTEGER {
     ctx.stack_.back()->set("maxver", maxver);
 }
 
+async: ASYNC {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr async(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("async", async);
+    ctx.leave();
+};
+
+async_queue_size: ASYNC_QUEUE_SIZE COLON INTEGER {
+    if ($3 <= 0) {
+        error(@3, "async-queue-size must be greater than zero");
+    }
+    ElementPtr size(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("async-queue-size", size);
+};
+
 %%
 
 void
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2017,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,6 +9,8 @@
 #include <d2/d2_queue_mgr.h>
 #include <dhcp_ddns/ncr_udp.h>
 
+#include <algorithm>
+
 namespace isc {
 namespace d2 {
 
@@ -17,7 +19,8 @@ const size_t D2QueueMgr::MAX_QUEUE_DEFAULT;
 
 D2QueueMgr::D2QueueMgr(asiolink::IOServicePtr& io_service, const size_t max_queue_size)
     : io_service_(io_service), max_queue_size_(max_queue_size),
-      mgr_state_(NOT_INITTED), target_stop_state_(NOT_INITTED) {
+      pending_(), coalesced_count_(0), mgr_state_(NOT_INITTED),
+      target_stop_state_(NOT_INITTED) {
     if (!io_service_) {
         isc_throw(D2QueueMgrError, "IOServicePtr cannot be null");
     }
@@ -95,6 +98,41 @@ D2QueueMgr::operator()(const dhcp_ddns::NameChangeListener::Result result,
     }
 }
 
+void
+D2QueueMgr::receiveBatch(const dhcp_ddns::NameChangeListener::Result result,
+                         std::vector<dhcp_ddns::NameChangeRequestPtr>& ncrs) {
+    if (result != dhcp_ddns::NameChangeListener::SUCCESS) {
+        // Failures are never reported in batches but handle them anyway.
+        dhcp_ddns::NameChangeRequestPtr empty;
+        (*this)(result, empty);
+        return;
+    }
+
+    try {
+        // Queue as many requests as there is room for in one go.
+        size_t room = getMaxQueueSize() > getQueueSize() ?
+            getMaxQueueSize() - getQueueSize() : 0;
+        size_t count = std::min(room, ncrs.size());
+        for (size_t i = 0; i < count; ++i) {
+            enqueue(ncrs[i]);
+            LOG_DEBUG(dhcp_to_d2_logger, isc::log::DBGLVL_TRACE_DETAIL_DATA,
+                      DHCP_DDNS_QUEUE_MGR_QUEUE_RECEIVE)
+                      .arg(ncrs[i]->getRequestId());
+        }
+
+        if (count < ncrs.size()) {
+            // Queue is full, stop the listener.
+            LOG_ERROR(dhcp_to_d2_logger, DHCP_DDNS_QUEUE_MGR_QUEUE_FULL)
+                      .arg(max_queue_size_);
+            stopListening(STOPPED_QUEUE_FULL);
+        }
+    } catch (const std::exception& ex) {
+        // On the outside chance a throw occurs, let's log it and swallow it.
+        LOG_ERROR(dhcp_to_d2_logger, DHCP_DDNS_QUEUE_MGR_UNEXPECTED_HANDLER_ERROR)
+                  .arg(ex.what());
+    }
+}
+
 void
 D2QueueMgr::initUDPListener(const isc::asiolink::IOAddress& ip_address,
                             const uint32_t port,
@@ -221,6 +259,7 @@ D2QueueMgr::dequeueAt(const size_t index) {
     }
 
     RequestQueue::iterator pos = ncr_queue_.begin() + index;
+    forgetRequest(*pos);
     ncr_queue_.erase(pos);
 }
 
@@ -232,17 +271,49 @@ D2QueueMgr::dequeue() {
                   "D2QueueMgr dequeue attempted on an empty queue");
     }
 
+    forgetRequest(ncr_queue_.front());
     ncr_queue_.pop_front();
 }
 
 void
 D2QueueMgr::enqueue(dhcp_ddns::NameChangeRequestPtr& ncr) {
+    dhcp_ddns::NameChangeRequestPtr& pending = pending_[getCoalesceKey(ncr)];
+    if (pending &&
+        (pending->getIpAddress() == ncr->getIpAddress()) &&
+        (pending->isForwardChange() == ncr->isForwardChange()) &&
+        (pending->isReverseChange() == ncr->isReverseChange())) {
+        // The queued request is still waiting: update it in place so it
+        // keeps its position in the queue.
+        LOG_DEBUG(dhcp_to_d2_logger, isc::log::DBGLVL_TRACE_DETAIL_DATA,
+                  DHCP_DDNS_QUEUE_MGR_NCR_COALESCED)
+                  .arg(ncr->getRequestId());
+        *pending = *ncr;
+        ++coalesced_count_;
+        return;
+    }
+
+    pending = ncr;
     ncr_queue_.push_back(ncr);
 }
 
 void
 D2QueueMgr::clearQueue() {
     ncr_queue_.clear();
+    pending_.clear();
+}
+
+std::string
+D2QueueMgr::getCoalesceKey(const dhcp_ddns::NameChangeRequestPtr& ncr) {
+    return (ncr->getFqdn() + "/" + ncr->getDhcid().toStr());
+}
+
+void
+D2QueueMgr::forgetRequest(const dhcp_ddns::NameChangeRequestPtr& ncr) {
+    std::map<std::string, dhcp_ddns::NameChangeRequestPtr>::iterator it =
+        pending_.find(getCoalesceKey(ncr));
+    if ((it != pending_.end()) && (it->second == ncr)) {
+        pending_.erase(it);
+    }
 }
 
 void
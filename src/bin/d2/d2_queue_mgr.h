@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2015,2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2015,2017,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -16,6 +16,9 @@
 
 #include <boost/noncopyable.hpp>
 #include <deque>
+#include <map>
+#include <string>
+#include <vector>
 
 namespace isc {
 namespace d2 {
@@ -128,6 +131,13 @@ public:
 /// until they are removed explicitly via the deque() or implicitly by
 /// via the clearQueue() method.
 ///
+/// A received request for the same FQDN, DHCID and IP address as a request
+/// still in the queue, with the same update directions, replaces the queued
+/// request rather than being added to the queue: the queued request is
+/// obsolete and the DNS entries only need to reflect the last one. For
+/// instance an add, a remove and an add received for a client before the
+/// first add was processed result in a single add.
+///
 class D2QueueMgr : public dhcp_ddns::NameChangeListener::RequestReceiveHandler,
                    boost::noncopyable {
 public:
@@ -220,6 +230,18 @@ public:
     virtual void operator ()(const dhcp_ddns::NameChangeListener::Result result,
                              dhcp_ddns::NameChangeRequestPtr& ncr);
 
+    /// @brief Implements the NCR batch receive callback.
+    ///
+    /// The received requests are queued in bulk up to the maximum queue
+    /// size. If they don't all fit, the remaining ones are discarded,
+    /// stopListening() is invoked and the state is set to
+    /// STOPPED_QUEUE_FULL, as for a single request.
+    ///
+    /// @param result contains that receive outcome status.
+    /// @param ncrs contains the received NameChangeRequests.
+    virtual void receiveBatch(const dhcp_ddns::NameChangeListener::Result result,
+                              std::vector<dhcp_ddns::NameChangeRequestPtr>& ncrs);
+
     /// @brief Stops listening for requests.
     ///
     /// Invokes the listener's stopListening method which will cause it to
@@ -307,12 +329,21 @@ public:
 
     /// @brief Adds a request to the end of the queue.
     ///
+    /// If a queued request for the same FQDN, DHCID and IP address, with the
+    /// same update directions, was not yet dequeued, it is replaced by the
+    /// new request instead.
+    ///
     /// @param ncr pointer to the NameChangeRequest to add to the queue.
     void enqueue(dhcp_ddns::NameChangeRequestPtr& ncr);
 
     /// @brief Removes all entries from the queue.
     void clearQueue();
 
+    /// @brief Returns the number of requests which replaced a queued request.
+    size_t getCoalescedCount() const {
+        return (coalesced_count_);
+    }
+
   private:
     /// @brief Sets the manager state to the target stop state.
     ///
@@ -320,6 +351,17 @@ public:
     /// state and logs that the manager is stopped.
     void updateStopState();
 
+    /// @brief Returns the key by which queued requests are coalesced.
+    ///
+    /// @param ncr the request.
+    /// @return The FQDN and the DHCID of the request.
+    static std::string getCoalesceKey(const dhcp_ddns::NameChangeRequestPtr& ncr);
+
+    /// @brief Forgets a request which is removed from the queue.
+    ///
+    /// @param ncr the removed request.
+    void forgetRequest(const dhcp_ddns::NameChangeRequestPtr& ncr);
+
     /// @brief IOService that our listener should use for IO management.
     asiolink::IOServicePtr io_service_;
 
@@ -329,6 +371,12 @@ public:
     /// @brief Queue of received NameChangeRequests.
     RequestQueue ncr_queue_;
 
+    /// @brief Last queued request for each FQDN and DHCID.
+    std::map<std::string, dhcp_ddns::NameChangeRequestPtr> pending_;
+
+    /// @brief Number of requests which replaced a queued request.
+    size_t coalesced_count_;
+
     /// @brief Listener instance from which requests are received.
     boost::shared_ptr<dhcp_ddns::NameChangeListener> listener_;
 
@@ -104,8 +104,10 @@ const SimpleDefaults D2SimpleParser::DDNS_DOMAIN_DEFAULTS = {
 
 /// Supplies defaults for optional values DdnsDomain entries.
 const SimpleDefaults D2SimpleParser::DNS_SERVER_DEFAULTS = {
-    { "hostname", Element::string, "" },
-    { "port",     Element::integer, "53" },
+    { "hostname",         Element::string, "" },
+    { "port",             Element::integer, "53" },
+    { "protocol",         Element::string, "UDP" },
+    { "max-transactions", Element::integer, "0" },
 };
 
 /// @}
@@ -253,12 +255,6 @@ void D2SimpleParser::parse(const D2CfgContextPtr& ctx,
     }
 
     ncr_format = getFormat(config, "ncr-format");
-    if (ncr_format != dhcp_ddns::FMT_JSON) {
-        isc_throw(D2CfgError, "NCR Format:"
-                  << dhcp_ddns::ncrFormatToString(ncr_format)
-                  << " is not yet supported"
-                  << " (" << config->get("ncr-format")->getPosition() << ")");
-    }
 
     ConstElementPtr user = config->get("user-context");
     if (user) {
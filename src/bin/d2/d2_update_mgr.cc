@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2017,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,6 +7,7 @@
 #include <config.h>
 
 #include <d2/d2_update_mgr.h>
+#include <d2/dns_tcp_connection.h>
 #include <d2/nc_add.h>
 #include <d2/nc_remove.h>
 
@@ -42,6 +43,9 @@ D2UpdateMgr::D2UpdateMgr(D2QueueMgrPtr& queue_mgr, D2CfgMgrPtr& cfg_mgr,
 
 D2UpdateMgr::~D2UpdateMgr() {
     transaction_list_.clear();
+
+    // The TCP connections to the DNS servers are run by our IO service.
+    DNSTCPConnectionPool::instance().clear();
 }
 
 void D2UpdateMgr::sweep() {
@@ -84,6 +88,7 @@ D2UpdateMgr::checkFinishedTransactions() {
         if (trans->isModelDone()) {
             // @todo  Additional actions based on NCR status could be
             // performed here.
+            releaseServers((*it).first);
             transaction_list_.erase(it++);
         } else {
             ++it;
@@ -101,7 +106,8 @@ void D2UpdateMgr::pickNextJob() {
     size_t queue_count = getQueueCount();
     for (size_t index = 0; index < queue_count; ++index) {
         dhcp_ddns::NameChangeRequestPtr found_ncr = queue_mgr_->peekAt(index);
-        if (!hasTransaction(found_ncr->getDhcid())) {
+        if (!hasTransaction(found_ncr->getDhcid()) &&
+            serversAvailable(found_ncr)) {
             queue_mgr_->dequeueAt(index);
             makeTransaction(found_ncr);
             return;
@@ -109,7 +115,7 @@ void D2UpdateMgr::pickNextJob() {
     }
 
     // There were no eligible jobs. All of the current DHCIDs already have
-    // transactions pending.
+    // transactions pending or their DNS servers are busy.
     LOG_DEBUG(dhcp_to_d2_logger, isc::log::DBGLVL_TRACE_DETAIL_DATA,
               DHCP_DDNS_NO_ELIGIBLE_JOBS)
         .arg(getQueueCount()).arg(getTransactionCount());
@@ -209,10 +215,107 @@ D2UpdateMgr::makeTransaction(dhcp_ddns::NameChangeRequestPtr& next_ncr) {
     // Add the new transaction to the list.
     transaction_list_[key] = trans;
 
+    // Account it to the servers it tries first.
+    std::vector<DnsServerKey> servers = getServerKeys(forward_domain,
+                                                      reverse_domain);
+    for (auto server = servers.begin(); server != servers.end(); ++server) {
+        ++server_transactions_[*server];
+    }
+    transaction_servers_[key].swap(servers);
+
     // Start it.
     trans->startTransaction();
 }
 
+std::vector<DnsServerKey>
+D2UpdateMgr::getServerKeys(const DdnsDomainPtr& forward_domain,
+                           const DdnsDomainPtr& reverse_domain) {
+    std::vector<DnsServerKey> servers;
+    const DdnsDomainPtr domains[] = { forward_domain, reverse_domain };
+    for (size_t i = 0; i < 2; ++i) {
+        if (!domains[i] || !domains[i]->getServers() ||
+            domains[i]->getServers()->empty()) {
+            continue;
+        }
+        const DnsServerInfoPtr& server = domains[i]->getServers()->front();
+        DnsServerKey server_key(server->getIpAddress(), server->getPort());
+        // Both directions may be served by the same server.
+        if (servers.empty() || (servers.front() != server_key)) {
+            servers.push_back(server_key);
+        }
+    }
+    return (servers);
+}
+
+bool
+D2UpdateMgr::serversAvailable(const dhcp_ddns::NameChangeRequestPtr& ncr) {
+    if (server_transactions_.empty()) {
+        return (true);
+    }
+
+    // Match the domains as the transaction would. A request which doesn't
+    // match is available: it will be dropped by makeTransaction.
+    DdnsDomainPtr forward_domain;
+    if (ncr->isForwardChange() && cfg_mgr_->forwardUpdatesEnabled()) {
+        cfg_mgr_->matchForward(ncr->getFqdn(), forward_domain);
+    }
+    DdnsDomainPtr reverse_domain;
+    if (ncr->isReverseChange() && cfg_mgr_->reverseUpdatesEnabled()) {
+        cfg_mgr_->matchReverse(ncr->getIpAddress(), reverse_domain);
+    }
+
+    const DdnsDomainPtr domains[] = { forward_domain, reverse_domain };
+    for (size_t i = 0; i < 2; ++i) {
+        if (!domains[i] || !domains[i]->getServers() ||
+            domains[i]->getServers()->empty()) {
+            continue;
+        }
+        const DnsServerInfoPtr& server = domains[i]->getServers()->front();
+        uint32_t max_transactions = server->getMaxTransactions();
+        if (max_transactions == 0) {
+            continue;
+        }
+        std::map<DnsServerKey, size_t>::const_iterator count =
+            server_transactions_.find(DnsServerKey(server->getIpAddress(),
+                                                   server->getPort()));
+        if ((count != server_transactions_.end()) &&
+            (count->second >= max_transactions)) {
+            LOG_DEBUG(dhcp_to_d2_logger, isc::log::DBGLVL_TRACE_DETAIL_DATA,
+                      DHCP_DDNS_AT_MAX_SERVER_TRANSACTIONS)
+                .arg(ncr->getRequestId()).arg(server->getIpAddress())
+                .arg(server->getPort()).arg(max_transactions);
+            return (false);
+        }
+    }
+    return (true);
+}
+
+void
+D2UpdateMgr::releaseServers(const TransactionKey& key) {
+    std::map<TransactionKey, std::vector<DnsServerKey> >::iterator trans =
+        transaction_servers_.find(key);
+    if (trans == transaction_servers_.end()) {
+        return;
+    }
+    for (auto server = trans->second.begin(); server != trans->second.end();
+         ++server) {
+        std::map<DnsServerKey, size_t>::iterator count =
+            server_transactions_.find(*server);
+        if (count != server_transactions_.end() && (--count->second == 0)) {
+            server_transactions_.erase(count);
+        }
+    }
+    transaction_servers_.erase(trans);
+}
+
+size_t
+D2UpdateMgr::getServerTransactionCount(const asiolink::IOAddress& address,
+                                       const uint16_t port) const {
+    std::map<DnsServerKey, size_t>::const_iterator count =
+        server_transactions_.find(DnsServerKey(address, port));
+    return (count == server_transactions_.end() ? 0 : count->second);
+}
+
 TransactionList::iterator
 D2UpdateMgr::findTransaction(const TransactionKey& key) {
     return (transaction_list_.find(key));
@@ -227,6 +330,7 @@ void
 D2UpdateMgr::removeTransaction(const TransactionKey& key) {
     TransactionList::iterator pos = findTransaction(key);
     if (pos != transactionListEnd()) {
+        releaseServers(key);
         transaction_list_.erase(pos);
     }
 }
@@ -246,6 +350,8 @@ D2UpdateMgr::clearTransactionList() {
     // @todo for now this just wipes them out. We might need something
     // more elegant, that allows a cancel first.
     transaction_list_.clear();
+    transaction_servers_.clear();
+    server_transactions_.clear();
 }
 
 void
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2015,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -19,6 +19,8 @@
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
 #include <map>
+#include <utility>
+#include <vector>
 
 namespace isc {
 namespace d2 {
@@ -33,6 +35,9 @@ public:
 /// @brief Defines a list of transactions.
 typedef std::map<TransactionKey, NameChangeTransactionPtr> TransactionList;
 
+/// @brief Identifies a DNS server by its address and port.
+typedef std::pair<asiolink::IOAddress, uint16_t> DnsServerKey;
+
 /// @brief D2UpdateMgr creates and manages update transactions.
 ///
 /// D2UpdateMgr is the DHCP_DDNS task master, instantiating and then supervising
@@ -57,6 +62,13 @@ typedef std::map<TransactionKey, NameChangeTransactionPtr> TransactionList;
 /// transactions complete,  D2UpdateMgr removes them from the transaction list,
 /// replacing them with new transactions.
 ///
+/// The number of concurrent transactions is limited globally and may also
+/// be limited per DNS server by its max-transactions parameter, so that a slow or unresponsive server doesn't
+/// take all the transaction slots from the other servers. A transaction is
+/// accounted to the first server of each of its domains, which it tries
+/// first. The requests for a server at its limit stay queued while the
+/// following requests for other servers are started.
+///
 /// D2UpdateMgr carries out each of the above steps, with a method called
 /// sweep().  This method is intended to be called as IO events complete.
 /// The upper layer(s) are responsible for calling sweep in a timely and cyclic
@@ -132,11 +144,38 @@ protected:
     /// If a request is selected, it is removed from the queue and transaction
     /// is constructed for it.
     ///
+    /// Requests for DNS servers which reached their transaction limit are
+    /// skipped too.
+    ///
     /// It is possible that no such request exists, though this is likely to be
     /// rather rare unless a system is frequently seeing requests for the same
     /// clients in quick succession.
     void pickNextJob();
 
+    /// @brief Returns the DNS servers a request will be sent to first.
+    ///
+    /// These are the first servers of the forward and reverse domains
+    /// matching a request.
+    ///
+    /// @param forward_domain the forward domain, empty if none.
+    /// @param reverse_domain the reverse domain, empty if none.
+    /// @return The keys of the servers, at most two.
+    static std::vector<DnsServerKey>
+    getServerKeys(const DdnsDomainPtr& forward_domain,
+                  const DdnsDomainPtr& reverse_domain);
+
+    /// @brief Checks if the DNS servers of a request accept a new transaction.
+    ///
+    /// @param ncr the NameChangeRequest.
+    /// @return true unless one of the servers the request would be sent to
+    /// reached its max-transactions limit.
+    bool serversAvailable(const dhcp_ddns::NameChangeRequestPtr& ncr);
+
+    /// @brief Releases the DNS servers accounted to a transaction.
+    ///
+    /// @param key the transaction key.
+    void releaseServers(const TransactionKey& key);
+
     /// @brief Create a new transaction for the given request.
     ///
     /// This method will attempt to match the request to suitable DNS servers.
@@ -183,6 +222,13 @@ public:
     /// queue.
     void setMaxTransactions(const size_t max_transactions);
 
+    /// @brief Returns the number of transactions accounted to a DNS server.
+    ///
+    /// @param address address of the server.
+    /// @param port port of the server.
+    size_t getServerTransactionCount(const asiolink::IOAddress& address,
+                                     const uint16_t port) const;
+
     /// @brief Search the transaction list for the given key.
     ///
     /// @param key the transaction key value for which to search.
@@ -245,6 +291,12 @@ private:
 
     /// @brief List of transactions.
     TransactionList transaction_list_;
+
+    /// @brief Number of transactions accounted to each DNS server.
+    std::map<DnsServerKey, size_t> server_transactions_;
+
+    /// @brief DNS servers accounted to each transaction.
+    std::map<TransactionKey, std::vector<DnsServerKey> > transaction_servers_;
 };
 
 /// @brief Defines a pointer to a D2UpdateMgr instance.
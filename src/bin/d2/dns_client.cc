@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2015,2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2015,2017,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,7 +7,10 @@
 #include <config.h>
 #include <d2/dns_client.h>
 #include <d2/d2_log.h>
+#include <d2/dns_tcp_connection.h>
 #include <dns/messagerenderer.h>
+#include <util/random/qid_gen.h>
+#include <boost/bind.hpp>
 #include <limits>
 
 namespace isc {
@@ -26,13 +29,14 @@ using namespace isc::util;
 using namespace isc::asiolink;
 using namespace isc::asiodns;
 using namespace isc::dns;
+using namespace isc::util::random;
 
 // This class provides the implementation for the DNSClient. This allows for
 // the separation of the DNSClient interface from the implementation details.
-// Currently, implementation uses IOFetch object to handle asynchronous
-// communication with the DNS. This design may be revisited in the future. If
-// implementation is changed, the DNSClient API will remain unchanged thanks
-// to this separation.
+// Over UDP, the implementation uses IOFetch object to handle asynchronous
+// communication with the DNS. Over TCP, it uses a pooled connection shared
+// with the other DNSClient instances. The DNSClient API does not depend on
+// the transport thanks to this separation.
 class DNSClientImpl : public asiodns::IOFetch::Callback {
 public:
     // A buffer holding response from a DNS.
@@ -55,6 +59,10 @@ public:
     DNSClient::Protocol proto_;
     // TSIG context used to sign outbound and verify inbound messages.
     dns::TSIGContextPtr tsig_context_;
+    // TCP connection the pending DNS Update was sent over, if any.
+    DNSTCPConnectionPtr tcp_connection_;
+    // Message ID of the DNS Update pending on the TCP connection.
+    uint16_t tcp_id_;
 
     // Constructor and Destructor
     DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
@@ -68,6 +76,17 @@ public:
     // type, representing a response from the server is set.
     virtual void operator()(asiodns::IOFetch::Result result);
 
+    // This callback is called when the DNS update message exchange over TCP
+    // is complete. It copies the response and proceeds as operator().
+    void tcpCompleted(DNSTCPConnection::Result result,
+                      const util::OutputBufferPtr& response);
+
+    // Parses the response and invokes the external callback.
+    void completed(DNSClient::Status status);
+
+    // Abandons the DNS Update pending on the TCP connection.
+    void cancelTcp();
+
     // Starts asynchronous DNS Update using TSIG.
     void doUpdate(asiolink::IOService& io_service,
                   const asiolink::IOAddress& ns_addr,
@@ -84,7 +103,8 @@ DNSClientImpl::DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
                              DNSClient::Callback* callback,
                              const DNSClient::Protocol proto)
     : in_buf_(new OutputBuffer(DEFAULT_BUFFER_SIZE)),
-      response_(response_placeholder), callback_(callback), proto_(proto) {
+      response_(response_placeholder), callback_(callback), proto_(proto),
+      tsig_context_(), tcp_connection_(), tcp_id_(0) {
 
     // Response should be an empty pointer. It gets populated by the
     // operator() method.
@@ -92,17 +112,6 @@ DNSClientImpl::DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
         isc_throw(isc::BadValue, "Response buffer pointer should be null");
     }
 
-    // @todo Currently we only support UDP. The support for TCP is planned for
-    // the future release.
-    if (proto_ == DNSClient::TCP) {
-        isc_throw(isc::NotImplemented, "TCP is currently not supported as a"
-                  << " Transport protocol for DNS Updates; please use UDP");
-    }
-
-    // Given that we already eliminated the possibility that TCP is used, it
-    // would be sufficient  to check that (proto != DNSClient::UDP). But, once
-    // support TCP is added the check above will disappear and the extra check
-    // will be needed here anyway.
     // Note that cascaded check is used here instead of:
     //   if (proto_ != DNSClient::TCP && proto_ != DNSClient::UDP)..
     // because some versions of GCC compiler complain that check above would
@@ -118,13 +127,54 @@ DNSClientImpl::DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
 }
 
 DNSClientImpl::~DNSClientImpl() {
+    // The connection outlives this object: make sure it won't call us.
+    cancelTcp();
 }
 
 void
 DNSClientImpl::operator()(asiodns::IOFetch::Result result) {
     // Get the status from IO. If no success, we just call user's callback
     // and pass the status code.
-    DNSClient::Status status = getStatus(result);
+    completed(getStatus(result));
+}
+
+void
+DNSClientImpl::tcpCompleted(DNSTCPConnection::Result result,
+                            const util::OutputBufferPtr& response) {
+    tcp_connection_.reset();
+
+    DNSClient::Status status = DNSClient::OTHER;
+    switch (result) {
+    case DNSTCPConnection::SUCCESS:
+        in_buf_->clear();
+        in_buf_->writeData(response->getData(), response->getLength());
+        status = DNSClient::SUCCESS;
+        break;
+
+    case DNSTCPConnection::TIME_OUT:
+        status = DNSClient::TIMEOUT;
+        break;
+
+    case DNSTCPConnection::STOPPED:
+        status = DNSClient::IO_STOPPED;
+        break;
+
+    default:
+        ;
+    }
+    completed(status);
+}
+
+void
+DNSClientImpl::cancelTcp() {
+    if (tcp_connection_) {
+        tcp_connection_->cancel(tcp_id_);
+        tcp_connection_.reset();
+    }
+}
+
+void
+DNSClientImpl::completed(DNSClient::Status status) {
     if (status == DNSClient::SUCCESS) {
         // Allocate a new response message. (Note that Message::fromWire
         // may only be run once per message, so we need to start fresh
@@ -190,6 +240,23 @@ DNSClientImpl::doUpdate(asiolink::IOService& io_service,
                   << ". Provided timeout value is '" << wait << "'");
     }
 
+    // Only one DNS Update is pending at a time.
+    cancelTcp();
+
+    // Over TCP the updates are matched with the responses by message ID:
+    // pick one which is not in use on the connection. The ID must be set
+    // before the message is signed.
+    DNSTCPConnectionPtr tcp_connection;
+    if (proto_ == DNSClient::TCP) {
+        tcp_connection = DNSTCPConnectionPool::instance().
+            getConnection(io_service, ns_addr, ns_port);
+        uint16_t id;
+        do {
+            id = QidGenerator::getInstance().generateQid();
+        } while (tcp_connection->isInUse(id));
+        update.setId(id);
+    }
+
     // Create a TSIG context if we have a key, otherwise clear the context
     // pointer.  Message marshalling uses non-null context is the indicator
     // that TSIG should be used.
@@ -213,6 +280,15 @@ DNSClientImpl::doUpdate(asiolink::IOService& io_service,
     // invalid message object is given.
     update.toWire(renderer, tsig_context_.get());
 
+    if (tcp_connection) {
+        tcp_connection->send(update.getId(), *msg_buf, wait,
+                             boost::bind(&DNSClientImpl::tcpCompleted,
+                                         this, _1, _2));
+        tcp_connection_ = tcp_connection;
+        tcp_id_ = update.getId();
+        return;
+    }
+
     // IOFetch has all the mechanisms that we need to perform asynchronous
     // communication with the DNS server. The last but one argument points to
     // this object as a completion callback for the message exchange. As a
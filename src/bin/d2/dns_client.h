@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2015,2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2015,2017,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -39,13 +39,14 @@ class DNSClientImpl;
 /// encapsulate DNS response, through class constructor. An exception will be
 /// thrown if the pointer is not initialized by the caller.
 ///
-/// @todo Ultimately, this class will support both TCP and UDP Transport.
-/// Currently only UDP is supported and can be specified as a preferred
-/// protocol. @c DNSClient constructor will throw an exception if TCP is
-/// specified. Once both protocols are supported, the @c DNSClient logic will
-/// try to obey caller's preference. However, it may use the other protocol if
-/// on its own discretion, when there is a legitimate reason to do so. For
-/// example, if communication with the server using preferred protocol fails.
+/// Over UDP, each DNS Update is sent from a new socket. Over TCP, the
+/// DNS Updates to a server are sent over persistent connections taken from
+/// the @c DNSTCPConnectionPool: the DNS Updates of all the @c DNSClient
+/// instances are pipelined on these connections and the responses are
+/// matched by message ID, so the ID of the DNS Update message is set by
+/// @c doUpdate.
+///
+/// A @c DNSClient instance performs one DNS Update at a time.
 class DNSClient {
 public:
 
@@ -141,6 +142,8 @@ public:
     /// @param tsig_key A pointer to an @c isc::dns::TSIGKey object that will
     /// (if not null) be used to sign the DNS Update message and verify the
     /// response.
+    /// @note Over TCP, a DNS Update still in progress is abandoned without
+    /// invoking the callback.
     void doUpdate(asiolink::IOService& io_service,
                   const asiolink::IOAddress& ns_addr,
                   const uint16_t ns_port,
@@ -0,0 +1,406 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <d2/d2_log.h>
+#include <d2/dns_tcp_connection.h>
+#include <exceptions/exceptions.h>
+
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/bind.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+using namespace isc::asiolink;
+using namespace isc::util;
+
+namespace isc {
+namespace d2 {
+
+DNSTCPConnection::DNSTCPConnection(IOService& io_service,
+                                   const IOAddress& address,
+                                   const uint16_t port)
+    : io_service_(io_service.get_io_service()),
+      endpoint_(boost::asio::ip::address::from_string(address.toText()), port),
+      socket_(io_service_), state_(CLOSED), generation_(0), requests_(),
+      sequence_(0), write_queue_(), writing_(false), read_buf_() {
+}
+
+DNSTCPConnection::~DNSTCPConnection() {
+    boost::system::error_code ignored;
+    socket_.close(ignored);
+}
+
+void
+DNSTCPConnection::send(const uint16_t id, const OutputBuffer& message,
+                       const unsigned int wait, const Handler& handler) {
+    if (isInUse(id)) {
+        isc_throw(BadValue, "DNS message ID " << id << " is already in use"
+                  " on the connection to " << endpoint_);
+    }
+    if (message.getLength() > std::numeric_limits<uint16_t>::max()) {
+        isc_throw(BadValue, "DNS message of " << message.getLength()
+                  << " bytes is too long to be sent over TCP");
+    }
+
+    // Messages are prefixed by their length over TCP (RFC 1035 4.2.2).
+    RequestPtr request(new Request(io_service_));
+    request->id_ = id;
+    request->sequence_ = sequence_++;
+    request->data_.resize(message.getLength() + 2);
+    request->data_[0] = static_cast<uint8_t>(message.getLength() >> 8);
+    request->data_[1] = static_cast<uint8_t>(message.getLength() & 0xff);
+    if (message.getLength() > 0) {
+        memcpy(&request->data_[2], message.getData(), message.getLength());
+    }
+    request->handler_ = handler;
+    request->timer_.expires_from_now(boost::posix_time::milliseconds(wait));
+    request->timer_.async_wait(boost::bind(&DNSTCPConnection::timeoutHandler,
+                                           shared_from_this(), request, _1));
+
+    requests_[id] = request;
+    write_queue_.push_back(request);
+
+    if (state_ == CLOSED) {
+        connect();
+    } else {
+        doWrite();
+    }
+}
+
+void
+DNSTCPConnection::cancel(const uint16_t id) {
+    std::map<uint16_t, RequestPtr>::iterator it = requests_.find(id);
+    if (it != requests_.end()) {
+        boost::system::error_code ignored;
+        it->second->timer_.cancel(ignored);
+        it->second->handler_ = Handler();
+        requests_.erase(it);
+    }
+}
+
+void
+DNSTCPConnection::close() {
+    fail(STOPPED);
+}
+
+void
+DNSTCPConnection::connect() {
+    state_ = CONNECTING;
+    socket_.async_connect(endpoint_,
+                          boost::bind(&DNSTCPConnection::connectHandler,
+                                      shared_from_this(), generation_, _1));
+}
+
+void
+DNSTCPConnection::connectHandler(const unsigned generation,
+                                 const boost::system::error_code& ec) {
+    if (generation != generation_) {
+        return;
+    }
+    if (ec) {
+        LOG_DEBUG(d2_to_dns_logger, isc::log::DBGLVL_TRACE_DETAIL,
+                  DHCP_DDNS_TCP_CONNECT_FAILED)
+            .arg(endpoint_).arg(ec.message());
+        fail(FAILED);
+        return;
+    }
+
+    LOG_DEBUG(d2_to_dns_logger, isc::log::DBGLVL_TRACE_DETAIL,
+              DHCP_DDNS_TCP_CONNECTED).arg(endpoint_);
+
+    // The updates are small and must not wait for the following ones.
+    boost::system::error_code ignored;
+    socket_.set_option(boost::asio::ip::tcp::no_delay(true), ignored);
+
+    state_ = CONNECTED;
+    doRead();
+    doWrite();
+}
+
+void
+DNSTCPConnection::doWrite() {
+    if (writing_ || (state_ != CONNECTED)) {
+        return;
+    }
+
+    // Skip the requests which completed (timed out or were cancelled)
+    // before they could be written.
+    RequestPtr request;
+    while (!write_queue_.empty() && !request) {
+        request = write_queue_.front();
+        write_queue_.pop_front();
+        std::map<uint16_t, RequestPtr>::const_iterator it =
+            requests_.find(request->id_);
+        if ((it == requests_.end()) || (it->second != request)) {
+            request.reset();
+        }
+    }
+    if (!request) {
+        return;
+    }
+
+    writing_ = true;
+    boost::asio::async_write(socket_, boost::asio::buffer(request->data_),
+                             boost::bind(&DNSTCPConnection::writeHandler,
+                                         shared_from_this(), generation_,
+                                         request, _1));
+}
+
+void
+DNSTCPConnection::writeHandler(const unsigned generation,
+                               const RequestPtr&,
+                               const boost::system::error_code& ec) {
+    // The request is bound to the callback to keep the written data alive.
+    if (generation != generation_) {
+        return;
+    }
+    writing_ = false;
+    if (ec) {
+        reconnect();
+        return;
+    }
+    doWrite();
+}
+
+void
+DNSTCPConnection::doRead() {
+    boost::asio::async_read(socket_, boost::asio::buffer(length_buf_),
+                            boost::bind(&DNSTCPConnection::lengthHandler,
+                                        shared_from_this(), generation_, _1));
+}
+
+void
+DNSTCPConnection::lengthHandler(const unsigned generation,
+                                const boost::system::error_code& ec) {
+    if (generation != generation_) {
+        return;
+    }
+    if (ec) {
+        // The server closes idle connections: this is not an error when
+        // no request is pending.
+        reconnect();
+        return;
+    }
+
+    const size_t length = (static_cast<size_t>(length_buf_[0]) << 8) |
+        length_buf_[1];
+    // A message shorter than the ID is garbage: the stream can't be
+    // trusted anymore.
+    if (length < 2) {
+        fail(FAILED);
+        return;
+    }
+    read_buf_.resize(length);
+    boost::asio::async_read(socket_, boost::asio::buffer(read_buf_),
+                            boost::bind(&DNSTCPConnection::bodyHandler,
+                                        shared_from_this(), generation_, _1));
+}
+
+void
+DNSTCPConnection::bodyHandler(const unsigned generation,
+                              const boost::system::error_code& ec) {
+    if (generation != generation_) {
+        return;
+    }
+    if (ec) {
+        reconnect();
+        return;
+    }
+
+    const uint16_t id = (static_cast<uint16_t>(read_buf_[0]) << 8) |
+        read_buf_[1];
+    std::map<uint16_t, RequestPtr>::iterator it = requests_.find(id);
+    if (it == requests_.end()) {
+        // Late response to a request which timed out.
+        LOG_DEBUG(d2_to_dns_logger, isc::log::DBGLVL_TRACE_DETAIL,
+                  DHCP_DDNS_TCP_UNEXPECTED_RESPONSE)
+            .arg(id).arg(endpoint_);
+    } else {
+        RequestPtr request = it->second;
+        OutputBufferPtr response(new OutputBuffer(read_buf_.size()));
+        response->writeData(&read_buf_[0], read_buf_.size());
+        complete(request, SUCCESS, response);
+    }
+
+    // The handler may have closed the connection.
+    if (generation == generation_) {
+        doRead();
+    }
+}
+
+void
+DNSTCPConnection::timeoutHandler(const RequestPtr& request,
+                                 const boost::system::error_code& ec) {
+    if (ec == boost::asio::error::operation_aborted) {
+        return;
+    }
+    std::map<uint16_t, RequestPtr>::const_iterator it =
+        requests_.find(request->id_);
+    if ((it != requests_.end()) && (it->second == request)) {
+        complete(request, TIME_OUT, OutputBufferPtr());
+    }
+}
+
+void
+DNSTCPConnection::complete(const RequestPtr& request, const Result& result,
+                           const OutputBufferPtr& response) {
+    requests_.erase(request->id_);
+    boost::system::error_code ignored;
+    request->timer_.cancel(ignored);
+    Handler handler;
+    handler.swap(request->handler_);
+    if (handler) {
+        handler(result, response);
+    }
+}
+
+void
+DNSTCPConnection::fail(const Result& result) {
+    ++generation_;
+    state_ = CLOSED;
+    writing_ = false;
+    boost::system::error_code ignored;
+    socket_.close(ignored);
+    write_queue_.clear();
+
+    // The handlers may send new requests: they use a new socket.
+    std::map<uint16_t, RequestPtr> requests;
+    requests.swap(requests_);
+    for (std::map<uint16_t, RequestPtr>::iterator it = requests.begin();
+         it != requests.end(); ++it) {
+        it->second->timer_.cancel(ignored);
+        Handler handler;
+        handler.swap(it->second->handler_);
+        if (handler) {
+            handler(result, OutputBufferPtr());
+        }
+    }
+}
+
+void
+DNSTCPConnection::reconnect() {
+    ++generation_;
+    state_ = CLOSED;
+    writing_ = false;
+    boost::system::error_code ignored;
+    socket_.close(ignored);
+    write_queue_.clear();
+
+    // The server may have closed the connection before it read all the
+    // requests or sent all the responses: the pending requests are sent
+    // again, in the submission order, unless they already were.
+    std::vector<RequestPtr> failed;
+    for (std::map<uint16_t, RequestPtr>::iterator it = requests_.begin();
+         it != requests_.end(); ) {
+        if (it->second->retried_) {
+            failed.push_back(it->second);
+            requests_.erase(it++);
+        } else {
+            it->second->retried_ = true;
+            write_queue_.push_back(it->second);
+            ++it;
+        }
+    }
+    std::sort(write_queue_.begin(), write_queue_.end(),
+              [](const RequestPtr& a, const RequestPtr& b) {
+                  return (a->sequence_ < b->sequence_);
+              });
+
+    if (!write_queue_.empty()) {
+        LOG_DEBUG(d2_to_dns_logger, isc::log::DBGLVL_TRACE_DETAIL,
+                  DHCP_DDNS_TCP_RECONNECT)
+            .arg(endpoint_).arg(write_queue_.size());
+        connect();
+    }
+
+    // The handlers may send new requests: they are queued for the new
+    // connection.
+    for (std::vector<RequestPtr>::iterator it = failed.begin();
+         it != failed.end(); ++it) {
+        (*it)->timer_.cancel(ignored);
+        Handler handler;
+        handler.swap((*it)->handler_);
+        if (handler) {
+            handler(FAILED, OutputBufferPtr());
+        }
+    }
+}
+
+const size_t DNSTCPConnectionPool::MAX_CONNECTIONS_PER_SERVER;
+const size_t DNSTCPConnectionPool::MAX_PIPELINED_REQUESTS;
+
+DNSTCPConnectionPool::DNSTCPConnectionPool()
+    : connections_() {
+}
+
+DNSTCPConnectionPool&
+DNSTCPConnectionPool::instance() {
+    static DNSTCPConnectionPool pool;
+    return (pool);
+}
+
+DNSTCPConnectionPtr
+DNSTCPConnectionPool::getConnection(IOService& io_service,
+                                    const IOAddress& address,
+                                    const uint16_t port) {
+    std::vector<DNSTCPConnectionPtr>& connections =
+        connections_[std::make_pair(address, port)];
+
+    // Evict the closed connections: the server closed them or they failed,
+    // so they would have to connect again anyway.
+    connections.erase(std::remove_if(connections.begin(), connections.end(),
+                                     [](const DNSTCPConnectionPtr& c) {
+                                         return (c->isClosed());
+                                     }),
+                      connections.end());
+
+    // Use the least loaded connection unless it is too loaded and another
+    // connection can be opened.
+    DNSTCPConnectionPtr connection;
+    for (std::vector<DNSTCPConnectionPtr>::const_iterator it =
+             connections.begin(); it != connections.end(); ++it) {
+        if (!connection ||
+            ((*it)->getPendingCount() < connection->getPendingCount())) {
+            connection = *it;
+        }
+    }
+    if (!connection ||
+        ((connection->getPendingCount() >= MAX_PIPELINED_REQUESTS) &&
+         (connections.size() < MAX_CONNECTIONS_PER_SERVER))) {
+        connection.reset(new DNSTCPConnection(io_service, address, port));
+        connections.push_back(connection);
+    }
+    return (connection);
+}
+
+void
+DNSTCPConnectionPool::clear() {
+    std::map<std::pair<IOAddress, uint16_t>,
+             std::vector<DNSTCPConnectionPtr> > connections;
+    connections.swap(connections_);
+    for (auto server = connections.begin(); server != connections.end();
+         ++server) {
+        for (auto it = server->second.begin(); it != server->second.end();
+             ++it) {
+            (*it)->close();
+        }
+    }
+}
+
+size_t
+DNSTCPConnectionPool::getConnectionCount(const IOAddress& address,
+                                         const uint16_t port) const {
+    auto server = connections_.find(std::make_pair(address, port));
+    return (server == connections_.end() ? 0 : server->second.size());
+}
+
+} // namespace d2
+} // namespace isc
@@ -0,0 +1,324 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef DNS_TCP_CONNECTION_H
+#define DNS_TCP_CONNECTION_H
+
+#include <asiolink/asio_wrapper.h>
+#include <asiolink/io_address.h>
+#include <asiolink/io_service.h>
+#include <util/buffer.h>
+
+#include <boost/asio/deadline_timer.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/enable_shared_from_this.hpp>
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <deque>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace isc {
+namespace d2 {
+
+/// @brief Persistent TCP connection to a DNS server.
+///
+/// The DNS messages are sent over the connection as soon as they are
+/// submitted, without waiting for the responses to the previous messages,
+/// and the responses are matched with the requests by the message ID, as
+/// described in RFC 7766. The connection is established upon the first
+/// request and kept open for the following requests; it is established
+/// again when the server closed it. The requests which were pending when
+/// the server closed the connection are sent once more over the new
+/// connection, as the server may close a connection at any time
+/// (RFC 7766 section 6.2.4): they fail only when the new connection is
+/// closed too.
+///
+/// The outcome of a request is always reported asynchronously, from the
+/// IO service, never from within @ref send.
+class DNSTCPConnection : public boost::enable_shared_from_this<DNSTCPConnection>,
+                         public boost::noncopyable {
+public:
+
+    /// @brief Outcome of a request.
+    enum Result {
+        SUCCESS,    ///< A response was received.
+        TIME_OUT,   ///< No response was received in time.
+        STOPPED,    ///< The connection was closed locally.
+        FAILED      ///< The connection failed or was closed by the server.
+    };
+
+    /// @brief Function invoked upon completion of a request.
+    ///
+    /// The response buffer holds the DNS message, without the length
+    /// prefix, when the result is @c SUCCESS.
+    typedef boost::function<void(Result, const util::OutputBufferPtr&)> Handler;
+
+    /// @brief Constructor.
+    ///
+    /// @param io_service IO service running the connection.
+    /// @param address Address of the DNS server.
+    /// @param port Port of the DNS server.
+    DNSTCPConnection(asiolink::IOService& io_service,
+                     const asiolink::IOAddress& address,
+                     const uint16_t port);
+
+    /// @brief Destructor.
+    ~DNSTCPConnection();
+
+    /// @brief Sends a DNS message.
+    ///
+    /// @param id ID of the message, it must not be in use on the connection.
+    /// @param message Rendered message.
+    /// @param wait Timeout of the response in milliseconds.
+    /// @param handler Function invoked upon completion.
+    /// @throw isc::BadValue if the ID is in use or the message is too long.
+    void send(const uint16_t id, const util::OutputBuffer& message,
+              const unsigned int wait, const Handler& handler);
+
+    /// @brief Abandons a request without invoking its handler.
+    ///
+    /// @param id ID of the message.
+    void cancel(const uint16_t id);
+
+    /// @brief Checks if a message ID is in use by a pending request.
+    ///
+    /// @param id ID of the message.
+    bool isInUse(const uint16_t id) const {
+        return (requests_.count(id) > 0);
+    }
+
+    /// @brief Returns the number of pending requests.
+    size_t getPendingCount() const {
+        return (requests_.size());
+    }
+
+    /// @brief Checks if the connection is established.
+    bool isConnected() const {
+        return (state_ == CONNECTED);
+    }
+
+    /// @brief Checks if the connection is closed.
+    ///
+    /// A closed connection has no pending request.
+    bool isClosed() const {
+        return (state_ == CLOSED);
+    }
+
+    /// @brief Closes the connection.
+    ///
+    /// The handlers of the pending requests are invoked with @c STOPPED.
+    void close();
+
+private:
+
+    /// @brief State of the connection.
+    enum State {
+        CLOSED,
+        CONNECTING,
+        CONNECTED
+    };
+
+    /// @brief Pending request.
+    struct Request {
+        /// @brief Constructor.
+        ///
+        /// @param io_service IO service running the timer.
+        Request(boost::asio::io_service& io_service)
+            : id_(0), sequence_(0), retried_(false), data_(),
+              timer_(io_service), handler_() {
+        }
+
+        /// @brief ID of the message.
+        uint16_t id_;
+
+        /// @brief Submission order of the request on the connection.
+        uint64_t sequence_;
+
+        /// @brief Whether the request is sent again after the server
+        /// closed the connection.
+        bool retried_;
+
+        /// @brief Message with its length prefix.
+        std::vector<uint8_t> data_;
+
+        /// @brief Response timer.
+        boost::asio::deadline_timer timer_;
+
+        /// @brief Completion handler.
+        Handler handler_;
+    };
+
+    /// @brief Pointer to a request.
+    typedef boost::shared_ptr<Request> RequestPtr;
+
+    /// @brief Starts connecting to the server.
+    void connect();
+
+    /// @brief Callback invoked when the connection is established or failed.
+    ///
+    /// @param generation Generation of the socket.
+    /// @param ec Outcome of the connection.
+    void connectHandler(const unsigned generation,
+                        const boost::system::error_code& ec);
+
+    /// @brief Writes the next queued message if no write is in progress.
+    void doWrite();
+
+    /// @brief Callback invoked when a message was written.
+    ///
+    /// @param generation Generation of the socket.
+    /// @param request The written request.
+    /// @param ec Outcome of the write.
+    void writeHandler(const unsigned generation, const RequestPtr& request,
+                      const boost::system::error_code& ec);
+
+    /// @brief Starts reading the length of the next response.
+    void doRead();
+
+    /// @brief Callback invoked when the length of a response was read.
+    ///
+    /// @param generation Generation of the socket.
+    /// @param ec Outcome of the read.
+    void lengthHandler(const unsigned generation,
+                       const boost::system::error_code& ec);
+
+    /// @brief Callback invoked when a response was read.
+    ///
+    /// @param generation Generation of the socket.
+    /// @param ec Outcome of the read.
+    void bodyHandler(const unsigned generation,
+                     const boost::system::error_code& ec);
+
+    /// @brief Callback invoked when the timer of a request expired.
+    ///
+    /// @param request The request.
+    /// @param ec Outcome of the wait.
+    void timeoutHandler(const RequestPtr& request,
+                        const boost::system::error_code& ec);
+
+    /// @brief Removes a request and invokes its handler.
+    ///
+    /// @param request The request.
+    /// @param result Outcome of the request.
+    /// @param response Response to the request.
+    void complete(const RequestPtr& request, const Result& result,
+                  const util::OutputBufferPtr& response);
+
+    /// @brief Closes the socket and fails all the pending requests.
+    ///
+    /// @param result Result reported to the handlers.
+    void fail(const Result& result);
+
+    /// @brief Closes the socket after the server closed the connection
+    /// and connects again to send the pending requests once more.
+    ///
+    /// The requests which were already sent again are failed.
+    void reconnect();
+
+    /// @brief IO service running the connection.
+    boost::asio::io_service& io_service_;
+
+    /// @brief Endpoint of the server.
+    boost::asio::ip::tcp::endpoint endpoint_;
+
+    /// @brief Socket.
+    boost::asio::ip::tcp::socket socket_;
+
+    /// @brief State of the connection.
+    State state_;
+
+    /// @brief Generation of the socket, incremented when it is closed.
+    ///
+    /// The callbacks of the operations started on a previous socket are
+    /// ignored.
+    unsigned generation_;
+
+    /// @brief Pending requests by message ID.
+    std::map<uint16_t, RequestPtr> requests_;
+
+    /// @brief Submission order of the next request.
+    uint64_t sequence_;
+
+    /// @brief Requests waiting to be written, in the submission order.
+    std::deque<RequestPtr> write_queue_;
+
+    /// @brief Whether a write is in progress.
+    bool writing_;
+
+    /// @brief Buffer receiving the length of a response.
+    uint8_t length_buf_[2];
+
+    /// @brief Buffer receiving a response.
+    std::vector<uint8_t> read_buf_;
+};
+
+/// @brief Pointer to a TCP connection to a DNS server.
+typedef boost::shared_ptr<DNSTCPConnection> DNSTCPConnectionPtr;
+
+/// @brief Pool of the persistent TCP connections to the DNS servers.
+///
+/// The requests to a server are spread over at most
+/// @c MAX_CONNECTIONS_PER_SERVER connections: a new connection is only
+/// opened when all the existing ones have @c MAX_PIPELINED_REQUESTS pending
+/// requests, otherwise the least loaded connection is used. The closed
+/// connections (closed by the server while idle or after a failure) are
+/// removed from the pool when a connection to the server is requested.
+///
+/// All the connections must be run by the same IO service: the pool must
+/// be cleared before the IO service is destroyed.
+class DNSTCPConnectionPool : public boost::noncopyable {
+public:
+
+    /// @brief Maximum number of connections to a server.
+    static const size_t MAX_CONNECTIONS_PER_SERVER = 4;
+
+    /// @brief Number of pending requests above which a new connection is
+    /// opened.
+    static const size_t MAX_PIPELINED_REQUESTS = 64;
+
+    /// @brief Returns the sole instance of the pool.
+    static DNSTCPConnectionPool& instance();
+
+    /// @brief Returns a connection to a server.
+    ///
+    /// The closed connections to the server are removed from the pool.
+    ///
+    /// @param io_service IO service running the connection.
+    /// @param address Address of the server.
+    /// @param port Port of the server.
+    /// @return Pointer to the connection.
+    DNSTCPConnectionPtr getConnection(asiolink::IOService& io_service,
+                                      const asiolink::IOAddress& address,
+                                      const uint16_t port);
+
+    /// @brief Closes and removes all the connections.
+    void clear();
+
+    /// @brief Returns the number of connections to a server.
+    ///
+    /// @param address Address of the server.
+    /// @param port Port of the server.
+    size_t getConnectionCount(const asiolink::IOAddress& address,
+                              const uint16_t port) const;
+
+private:
+
+    /// @brief Constructor.
+    DNSTCPConnectionPool();
+
+    /// @brief Connections by server address and port.
+    std::map<std::pair<asiolink::IOAddress, uint16_t>,
+             std::vector<DNSTCPConnectionPtr> > connections_;
+};
+
+} // namespace d2
+} // namespace isc
+
+#endif // DNS_TCP_CONNECTION_H
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2017,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -452,12 +452,13 @@ NameChangeTransaction::selectNextServer() {
         // Toss out any previous response.
         dns_update_response_.reset();
 
-        // @todo  Protocol is set on DNSClient constructor.  We need
-        // to propagate a configuration value downward, probably starting
-        // at global, then domain, then server
-        // Once that is supported we need to add it here.
+        // Protocol is set on DNSClient constructor from the server
+        // configuration.
+        DNSClient::Protocol protocol =
+            (current_server_->getProtocol() == dhcp_ddns::NCR_TCP ?
+             DNSClient::TCP : DNSClient::UDP);
         dns_client_.reset(new DNSClient(dns_update_response_ , this,
-                                        DNSClient::UDP));
+                                        protocol));
         ++next_server_pos_;
         return (true);
     }
@@ -232,6 +232,11 @@ TEST_F(D2CfgMgrTest, validParamsEntry) {
     EXPECT_EQ(dhcp_ddns::NCR_UDP, d2_params_->getNcrProtocol());
     EXPECT_EQ(dhcp_ddns::FMT_JSON, d2_params_->getNcrFormat());
 
+    // Verify that the binary format can be used.
+    config = makeParamsConfigString ("192.0.0.1", 777, 333, "UDP", "BINARY");
+    RUN_CONFIG_OK(config);
+    EXPECT_EQ(dhcp_ddns::FMT_BINARY, d2_params_->getNcrFormat());
+
     // Verify that ip_address can be valid v6 address.
     config = makeParamsConfigString ("3001::5", 777, 333, "UDP", "JSON");
     RUN_CONFIG_OK(config);
@@ -423,7 +428,7 @@ TEST_F(D2CfgMgrTest, invalidEntry) {
     // Invalid format
     config = makeParamsConfigString ("127.0.0.1", 777, 333, "UDP", "BOGUS");
     SYNTAX_ERROR(config, "<string>:1.115-121: syntax error,"
-                         " unexpected constant string, expecting JSON");
+                         " unexpected constant string, expecting JSON or BINARY");
 }
 
 // Control socket tests in d2_process_unittests.cc
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -295,10 +295,15 @@ TEST_F(D2ProcessTest, queueFullRecovery) {
     size_t max_queue_size = 5;
     queue_mgr->setMaxQueueSize(max_queue_size);
 
-    // Manually enqueue max requests.
+    // Manually enqueue max requests. They must be for different FQDNs
+    // as the requests for the same client and FQDN are coalesced.
     dhcp_ddns::NameChangeRequestPtr ncr;
-    ASSERT_NO_THROW(ncr = dhcp_ddns::NameChangeRequest::fromJSON(test_msg));
     for (int i = 0; i < max_queue_size; i++) {
+        ASSERT_NO_THROW(ncr = dhcp_ddns::NameChangeRequest::fromJSON(test_msg));
+        std::ostringstream fqdn;
+        fqdn << "host" << i << ".walah.com";
+        ncr->setFqdn(fqdn.str());
+
         // Verify that the request can be added to the queue and queue
         // size increments accordingly.
         ASSERT_NO_THROW(queue_mgr->enqueue(ncr));
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2017,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -47,7 +47,7 @@ const char *valid_msgs[] =
      " \"reverse-change\" : false , "
      " \"fqdn\" : \"walah.walah.com\" , "
      " \"ip-address\" : \"192.168.2.1\" , "
-     " \"dhcid\" : \"010203040A7F8E3D\" , "
+     " \"dhcid\" : \"010203040A7F8E3E\" , "
      " \"lease-expires-on\" : \"20130121132405\" , "
      " \"lease-length\" : 1300 "
      "}",
@@ -192,6 +192,68 @@ TEST(D2QueueMgrBasicTest, basicQueue) {
                  D2QueueMgrInvalidIndex);
 }
 
+/// @brief Tests the coalescing of the queued requests.
+/// This test verifies that:
+/// 1. A request for the same FQDN, DHCID and IP address as a queued request
+/// replaces it in the queue
+/// 2. Requests for another IP address or other update directions are queued
+/// 3. A request is not coalesced with a dequeued request
+TEST(D2QueueMgrBasicTest, coalesce) {
+    asiolink::IOServicePtr io_service(new isc::asiolink::IOService());
+    D2QueueMgrPtr queue_mgr;
+    ASSERT_NO_THROW(queue_mgr.reset(new D2QueueMgr(io_service)));
+
+    // Add, remove and add again the same entries.
+    NameChangeRequestPtr ncr;
+    for (int i = 0; i < 3; i++) {
+        ASSERT_NO_THROW(ncr = NameChangeRequest::fromJSON(valid_msgs[0]));
+        ncr->setChangeType(i % 2 ? CHG_REMOVE : CHG_ADD);
+        ncr->setLeaseLength(1000 + i);
+        EXPECT_NO_THROW(queue_mgr->enqueue(ncr));
+    }
+
+    // Only the last request is queued.
+    EXPECT_EQ(1, queue_mgr->getQueueSize());
+    EXPECT_EQ(2, queue_mgr->getCoalescedCount());
+    ASSERT_NO_THROW(ncr = queue_mgr->peek());
+    EXPECT_EQ(CHG_ADD, ncr->getChangeType());
+    EXPECT_EQ(1002, ncr->getLeaseLength());
+
+    // Another address is not coalesced.
+    ASSERT_NO_THROW(ncr = NameChangeRequest::fromJSON(valid_msgs[2]));
+    EXPECT_NO_THROW(queue_mgr->enqueue(ncr));
+    EXPECT_EQ(2, queue_mgr->getQueueSize());
+
+    // Other update directions are not coalesced.
+    ASSERT_NO_THROW(ncr = NameChangeRequest::fromJSON(valid_msgs[0]));
+    ncr->setReverseChange(true);
+    EXPECT_NO_THROW(queue_mgr->enqueue(ncr));
+    EXPECT_EQ(3, queue_mgr->getQueueSize());
+    EXPECT_EQ(2, queue_mgr->getCoalescedCount());
+
+    // The last request replaces the newest queued one.
+    ASSERT_NO_THROW(ncr = NameChangeRequest::fromJSON(valid_msgs[1]));
+    ncr->setDhcid("010203040A7F8E3D");
+    ncr->setReverseChange(true);
+    EXPECT_NO_THROW(queue_mgr->enqueue(ncr));
+    EXPECT_EQ(3, queue_mgr->getQueueSize());
+    EXPECT_EQ(3, queue_mgr->getCoalescedCount());
+    ASSERT_NO_THROW(ncr = queue_mgr->peekAt(2));
+    EXPECT_EQ(CHG_REMOVE, ncr->getChangeType());
+
+    // Once dequeued, a request is no longer coalesced.
+    EXPECT_NO_THROW(queue_mgr->dequeue());
+    ASSERT_NO_THROW(ncr = NameChangeRequest::fromJSON(valid_msgs[0]));
+    EXPECT_NO_THROW(queue_mgr->enqueue(ncr));
+    EXPECT_EQ(3, queue_mgr->getQueueSize());
+    EXPECT_EQ(3, queue_mgr->getCoalescedCount());
+
+    // Nor after the queue was cleared.
+    EXPECT_NO_THROW(queue_mgr->clearQueue());
+    EXPECT_NO_THROW(queue_mgr->enqueue(ncr));
+    EXPECT_EQ(1, queue_mgr->getQueueSize());
+}
+
 /// @brief Compares two NameChangeRequests for equality.
 bool checkSendVsReceived(NameChangeRequestPtr sent_ncr,
                          NameChangeRequestPtr received_ncr) {
@@ -234,6 +296,16 @@ public:
         received_ncrs_.clear();
     }
 
+    /// @brief Replaces the sender by one using the given format.
+    ///
+    /// @param format wire format of the outbound requests.
+    void resetSender(const NameChangeFormat format) {
+        isc::asiolink::IOAddress addr(TEST_ADDRESS);
+        sender_.reset(new NameChangeUDPSender(addr, SENDER_PORT,
+                                              addr, LISTENER_PORT,
+                                              format, *this, 100, true));
+    }
+
     /// @brief Implements the send completion handler.
     virtual void operator ()(const NameChangeSender::Result result,
                              NameChangeRequestPtr& ncr) {
@@ -438,4 +510,48 @@ TEST_F (QueueMgrUDPTest, liveFeed) {
     EXPECT_EQ(1, queue_mgr_->getQueueSize());
 }
 
+/// @brief Tests D2QueueMgr's ability to queue requests received in batches
+/// This test verifies that:
+/// 1. Requests packed in the binary format are queued in bulk, in order,
+/// by a listener configured for JSON.
+/// 2. The requests which don't fit in the queue are discarded and the
+/// manager transitions to STOPPED_QUEUE_FULL state.
+TEST_F (QueueMgrUDPTest, batchFeed) {
+    ASSERT_NO_THROW(queue_mgr_.reset(new D2QueueMgr(io_service_,
+                                                    VALID_MSG_CNT)));
+    isc::asiolink::IOAddress addr(TEST_ADDRESS);
+    ASSERT_NO_THROW(queue_mgr_->initUDPListener(addr, LISTENER_PORT,
+                                                FMT_JSON, true));
+    ASSERT_NO_THROW(queue_mgr_->startListening());
+
+    resetSender(FMT_BINARY);
+    ASSERT_NO_THROW(sender_->startSending(*io_service_));
+
+    // Queue more requests than the queue manager accepts: the first one
+    // is sent alone, the other ones are packed in a second datagram.
+    std::vector<NameChangeRequestPtr> ncrs;
+    for (int i = 0; i < VALID_MSG_CNT + 2; i++) {
+        NameChangeRequestPtr send_ncr;
+        ASSERT_NO_THROW(send_ncr = NameChangeRequest::
+                        fromJSON(valid_msgs[i % VALID_MSG_CNT]));
+        send_ncr->setLeaseLength(i);
+        ncrs.push_back(send_ncr);
+        ASSERT_NO_THROW(sender_->sendRequest(send_ncr));
+    }
+
+    // Run the two sends and the two receives.
+    while (queue_mgr_->getMgrState() == D2QueueMgr::RUNNING) {
+        ASSERT_NO_THROW(io_service_->run_one());
+    }
+    EXPECT_EQ(D2QueueMgr::STOPPED_QUEUE_FULL, queue_mgr_->getMgrState());
+    EXPECT_EQ(0, sender_->getQueueSize());
+    EXPECT_EQ(VALID_MSG_CNT + 2, sent_ncrs_.size());
+
+    // The queue holds the first requests in order.
+    ASSERT_EQ(VALID_MSG_CNT, queue_mgr_->getQueueSize());
+    for (int i = 0; i < VALID_MSG_CNT; i++) {
+        EXPECT_TRUE(checkSendVsReceived(ncrs[i], queue_mgr_->peekAt(i)));
+    }
+}
+
 } // end of anonymous namespace
@@ -821,6 +821,8 @@ TEST_F(TSIGKeyInfoListParserTest, validTSIGKeyList) {
 /// 1. Specifying both a hostname and an ip address is not allowed.
 /// 2. Specifying both blank a hostname and blank ip address is not allowed.
 /// 3. Specifying a negative port number is not allowed.
+/// 4. Specifying a protocol other than UDP or TCP is not allowed.
+/// 5. Specifying a negative max-transactions is not allowed.
 
 TEST_F(DnsServerInfoParserTest, invalidEntry) {
     // Create a config in which both host and ip address are supplied.
@@ -845,6 +847,19 @@ TEST_F(DnsServerInfoParserTest, invalidEntry) {
              "  \"ip-address\": \"192.168.5.6\" ,"
              "  \"port\": -100 }";
     PARSE_FAIL(config, "<string>:1.60-63: port must be greater than zero but less than 65536");
+
+    // Create a config with an unknown protocol.
+    // Verify that build fails.
+    config = "{ \"ip-address\": \"192.168.5.6\", "
+             "  \"protocol\": \"SCTP\" }";
+    PARSE_FAIL(config, "<string>:1.46-51: syntax error, unexpected constant"
+                       " string, expecting UDP or TCP");
+
+    // Create a config with a negative max-transactions.
+    // Verify that build fails.
+    config = "{ \"ip-address\": \"192.168.5.6\", "
+             "  \"max-transactions\": -1 }";
+    PARSE_FAIL(config, "<string>:1.54-55: max-transactions must not be negative");
 }
 
 
@@ -854,6 +869,8 @@ TEST_F(DnsServerInfoParserTest, invalidEntry) {
 /// 1. A DnsServerInfo entry is correctly made, when given only a hostname.
 /// 2. A DnsServerInfo entry is correctly made, when given ip address and port.
 /// 3. A DnsServerInfo entry is correctly made, when given only an ip address.
+/// 4. The protocol and max-transactions are set from the entry or default
+/// to UDP and 0.
 TEST_F(DnsServerInfoParserTest, validEntry) {
     /// @todo When resolvable hostname is supported you'll need this test.
     /// // Valid entries for dynamic host
@@ -880,10 +897,14 @@ TEST_F(DnsServerInfoParserTest, validEntry) {
     // Valid entries for static ip
     std::string config = " { \"hostname\" : \"\", "
                          "  \"ip-address\": \"127.0.0.1\" , "
-                         "  \"port\": 100 }";
+                         "  \"port\": 100, "
+                         "  \"protocol\": \"TCP\", "
+                         "  \"max-transactions\": 4 }";
     PARSE_OK(config);
     ASSERT_TRUE(server_);
     EXPECT_TRUE(checkServer(server_, "", "127.0.0.1", 100));
+    EXPECT_EQ(dhcp_ddns::NCR_TCP, server_->getProtocol());
+    EXPECT_EQ(4, server_->getMaxTransactions());
 
     // Verify unparsing.
     runToElementTest<DnsServerInfo>(config, *server_);
@@ -895,6 +916,8 @@ TEST_F(DnsServerInfoParserTest, validEntry) {
     ASSERT_TRUE(server_);
     EXPECT_TRUE(checkServer(server_, "", "192.168.2.5",
                             DnsServerInfo::STANDARD_DNS_PORT));
+    EXPECT_EQ(dhcp_ddns::NCR_UDP, server_->getProtocol());
+    EXPECT_EQ(0, server_->getMaxTransactions());
 }
 
 /// @brief Verifies that attempting to parse an invalid list of DnsServerInfo
@@ -1043,6 +1066,10 @@ TEST_F(DdnsDomainParserTest, validDomain) {
         ASSERT_NO_THROW(server_json = servers_json->getNonConst(i));
         ASSERT_NO_THROW(server_json->set("hostname",
                                          Element::create(std::string())));
+        ASSERT_NO_THROW(server_json->set("protocol",
+                                         Element::create(std::string("UDP"))));
+        ASSERT_NO_THROW(server_json->set("max-transactions",
+                                         Element::create(0)));
     }
     runToElementTest<DdnsDomain>(json, *domain_);
 }
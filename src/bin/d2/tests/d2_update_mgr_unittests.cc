@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -14,6 +14,7 @@
 
 #include <boost/function.hpp>
 #include <boost/bind.hpp>
+#include <boost/lexical_cast.hpp>
 #include <gtest/gtest.h>
 #include <gtest/gtest.h>
 #include <algorithm>
@@ -113,7 +114,12 @@ public:
     }
 
     /// @brief Seeds configuration manager with a valid DHCP_DDNS configuration.
-    void makeCannedConfig() {
+    ///
+    /// @param max_transactions value of the max-transactions parameter of
+    /// the DNS servers.
+    void makeCannedConfig(const uint32_t max_transactions = 0) {
+        std::string max = "\"max-transactions\" : " +
+            boost::lexical_cast<std::string>(max_transactions);
         std::string canned_config_ =
                  "{ "
                   "\"ip-address\" : \"192.168.1.33\" , "
@@ -123,22 +129,22 @@ public:
                   "\"ddns-domains\": [ "
                   "{ \"name\": \"example.com.\" , "
                   "  \"dns-servers\" : [ "
-                  "  { \"ip-address\": \"127.0.0.1\", \"port\" : 5301  } "
+                  "  { \"ip-address\": \"127.0.0.1\", \"port\" : 5301, " + max + " } "
                   "  ] },"
                   "{ \"name\": \"org.\" , "
                   "  \"dns-servers\" : [ "
-                  "  { \"ip-address\": \"127.0.0.1\" } "
+                  "  { \"ip-address\": \"127.0.0.1\", " + max + " } "
                   "  ] }, "
                   "] }, "
                   "\"reverse-ddns\" : { "
                   "\"ddns-domains\": [ "
                   "{ \"name\": \"1.168.192.in-addr.arpa.\" , "
                   "  \"dns-servers\" : [ "
-                  "  { \"ip-address\": \"127.0.0.1\", \"port\" : 5301 } "
+                  "  { \"ip-address\": \"127.0.0.1\", \"port\" : 5301, " + max + " } "
                   "  ] }, "
                   "{ \"name\": \"2.0.3.0.8.B.D.0.1.0.0.2.ip6.arpa.\" , "
                   "  \"dns-servers\" : [ "
-                  "  { \"ip-address\": \"127.0.0.1\" } "
+                  "  { \"ip-address\": \"127.0.0.1\", " + max + " } "
                   "  ] } "
                   "] } }";
 
@@ -809,6 +815,59 @@ TEST_F(D2UpdateMgrTest, errorTransaction) {
 
 }
 
+/// @brief Tests the limit of concurrent transactions per DNS server.
+/// This test verifies that:
+/// 1. Requests for a DNS server at its limit are left in the queue.
+/// 2. Requests for other DNS servers are picked meanwhile.
+/// 3. Finished transactions release their DNS server.
+TEST_F(D2UpdateMgrTest, maxServerTransactions) {
+    // Allow one transaction per DNS server.
+    makeCannedConfig(1);
+
+    // The canned requests are all sent to the same server.
+    for (int i = 0; i < 2; i++) {
+        ASSERT_NO_THROW(queue_mgr_->enqueue(canned_ncrs_[i]));
+    }
+
+    // Add a request for a domain served by another server.
+    dhcp_ddns::NameChangeRequestPtr
+        other_ncr(new dhcp_ddns::NameChangeRequest(*(canned_ncrs_[2])));
+    other_ncr->setFqdn("my.example.org.");
+    ASSERT_NO_THROW(queue_mgr_->enqueue(other_ncr));
+
+    asiolink::IOAddress server_ip("127.0.0.1");
+    EXPECT_NO_THROW(update_mgr_->pickNextJob());
+    EXPECT_EQ(1, update_mgr_->getTransactionCount());
+    EXPECT_EQ(1, update_mgr_->getServerTransactionCount(server_ip, 5301));
+
+    // The second canned request waits for the server while the request
+    // for the other server is picked.
+    EXPECT_NO_THROW(update_mgr_->pickNextJob());
+    EXPECT_EQ(2, update_mgr_->getTransactionCount());
+    EXPECT_TRUE(update_mgr_->hasTransaction(other_ncr->getDhcid()));
+    EXPECT_EQ(1, update_mgr_->getServerTransactionCount(server_ip, 53));
+    EXPECT_EQ(1, update_mgr_->getQueueCount());
+
+    EXPECT_NO_THROW(update_mgr_->pickNextJob());
+    EXPECT_EQ(2, update_mgr_->getTransactionCount());
+    EXPECT_EQ(1, update_mgr_->getQueueCount());
+
+    // Once the first transaction is done, the second one is started.
+    completeTransaction(0, dhcp_ddns::ST_COMPLETED);
+    EXPECT_NO_THROW(update_mgr_->checkFinishedTransactions());
+    EXPECT_EQ(0, update_mgr_->getServerTransactionCount(server_ip, 5301));
+    EXPECT_NO_THROW(update_mgr_->pickNextJob());
+    EXPECT_TRUE(update_mgr_->hasTransaction(canned_ncrs_[1]->getDhcid()));
+    EXPECT_EQ(1, update_mgr_->getServerTransactionCount(server_ip, 5301));
+    EXPECT_EQ(0, update_mgr_->getQueueCount());
+
+    // Removing the transactions releases their servers.
+    update_mgr_->removeTransaction(other_ncr->getDhcid());
+    EXPECT_EQ(0, update_mgr_->getServerTransactionCount(server_ip, 53));
+    update_mgr_->clearTransactionList();
+    EXPECT_EQ(0, update_mgr_->getServerTransactionCount(server_ip, 5301));
+}
+
 /// @brief Tests processing of multiple transactions.
 /// This test verifies that update manager can create and manage a multiple
 /// transactions, concurrently.  It uses a fake server that responds to all
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -6,17 +6,22 @@
 
 #include <config.h>
 #include <d2/dns_client.h>
+#include <d2/dns_tcp_connection.h>
 #include <dns/opcode.h>
 #include <asiodns/io_fetch.h>
 #include <asiodns/logger.h>
 #include <asiolink/interval_timer.h>
 #include <dns/messagerenderer.h>
+#include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/ip/udp.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
 #include <boost/asio/socket_base.hpp>
 #include <boost/bind.hpp>
 #include <boost/scoped_ptr.hpp>
 #include <gtest/gtest.h>
 #include <nc_test_utils.h>
+#include <vector>
 
 using namespace std;
 using namespace isc;
@@ -36,6 +41,148 @@ const char* TEST_ADDRESS = "127.0.0.1";
 const uint16_t TEST_PORT = 5301;
 const size_t MAX_SIZE = 1024;
 const long TEST_TIMEOUT = 5 * 1000;
+
+/// @brief DNS Update exchange over TCP.
+///
+/// Each exchange has its own @c DNSClient so several exchanges can be
+/// pending on the same connection.
+class TCPExchange : public DNSClient::Callback {
+public:
+    /// @brief Constructor.
+    ///
+    /// @param service IO service stopped when all the exchanges completed.
+    /// @param pending Number of pending exchanges.
+    TCPExchange(IOService& service, int& pending)
+        : response_(), client_(), status_(DNSClient::OTHER),
+          completed_(false), service_(service), pending_(pending) {
+        client_.reset(new DNSClient(response_, this, DNSClient::TCP));
+        message_.reset(new D2UpdateMessage(D2UpdateMessage::OUTBOUND));
+        message_->setRcode(Rcode(Rcode::NOERROR_CODE));
+        message_->setZone(Name("example.com"), RRClass::IN());
+    }
+
+    /// @brief Sends the DNS Update.
+    ///
+    /// @param timeout Timeout of the response in milliseconds.
+    /// @param port Port of the server.
+    void send(const unsigned int timeout, const uint16_t port = TEST_PORT) {
+        client_->doUpdate(service_, IOAddress(TEST_ADDRESS), port,
+                          *message_, timeout);
+    }
+
+    /// @brief Exchange completion callback.
+    ///
+    /// @param status A status code returned by DNSClient.
+    virtual void operator()(DNSClient::Status status) {
+        status_ = status;
+        completed_ = true;
+        if (--pending_ == 0) {
+            service_.stop();
+        }
+    }
+
+    D2UpdateMessagePtr response_;
+    DNSClientPtr client_;
+    D2UpdateMessagePtr message_;
+    DNSClient::Status status_;
+    bool completed_;
+    IOService& service_;
+    int& pending_;
+};
+
+/// @brief Minimal DNS server over TCP.
+///
+/// It accepts one connection and waits until a given number of requests
+/// were received before responding to them in the reverse order, so the
+/// requests must be pipelined and the responses matched by message ID.
+/// The response is the request with the QR bit set. It can also close the
+/// connection instead of responding and accept a new one.
+class TCPServer {
+public:
+    /// @brief Constructor.
+    ///
+    /// @param service IO service running the server.
+    /// @param batch Number of requests received before responding,
+    /// 0 to never respond.
+    TCPServer(IOService& service, const size_t batch)
+        : acceptor_(service.get_io_service()),
+          socket_(service.get_io_service()), batch_(batch), closes_(0),
+          accepted_(0) {
+        tcp::endpoint endpoint(address::from_string(TEST_ADDRESS), TEST_PORT);
+        acceptor_.open(endpoint.protocol());
+        acceptor_.set_option(tcp::acceptor::reuse_address(true));
+        acceptor_.bind(endpoint);
+        acceptor_.listen();
+        acceptor_.async_accept(socket_, boost::bind(&TCPServer::acceptHandler,
+                                                    this, _1));
+    }
+
+    /// @brief Callback invoked when the connection is accepted.
+    void acceptHandler(const boost::system::error_code& ec) {
+        if (!ec) {
+            ++accepted_;
+            readLength();
+        }
+    }
+
+    /// @brief Reads the length of the next request.
+    void readLength() {
+        boost::asio::async_read(socket_, boost::asio::buffer(length_),
+                                boost::bind(&TCPServer::lengthHandler,
+                                            this, _1));
+    }
+
+    /// @brief Callback invoked when the length of a request was read.
+    void lengthHandler(const boost::system::error_code& ec) {
+        if (!ec) {
+            request_.resize((length_[0] << 8) | length_[1]);
+            boost::asio::async_read(socket_, boost::asio::buffer(request_),
+                                    boost::bind(&TCPServer::requestHandler,
+                                                this, _1));
+        }
+    }
+
+    /// @brief Callback invoked when a request was read.
+    void requestHandler(const boost::system::error_code& ec) {
+        if (ec) {
+            return;
+        }
+        requests_.push_back(request_);
+        if ((requests_.size() == batch_) && (closes_ > 0)) {
+            --closes_;
+            requests_.clear();
+            socket_.close();
+            acceptor_.async_accept(socket_,
+                                   boost::bind(&TCPServer::acceptHandler,
+                                               this, _1));
+            return;
+        }
+        if (requests_.size() == batch_) {
+            for (auto it = requests_.rbegin(); it != requests_.rend(); ++it) {
+                std::vector<uint8_t> response(length_, length_ + 2);
+                response[0] = static_cast<uint8_t>(it->size() >> 8);
+                response[1] = static_cast<uint8_t>(it->size() & 0xff);
+                response.insert(response.end(), it->begin(), it->end());
+                // Set the QR bit (see udpReceiveHandler).
+                response[4] = 0xA8;
+                boost::asio::write(socket_, boost::asio::buffer(response));
+            }
+            requests_.clear();
+        }
+        readLength();
+    }
+
+    tcp::acceptor acceptor_;
+    tcp::socket socket_;
+    size_t batch_;
+    /// Number of times the connection is closed instead of responding.
+    int closes_;
+    int accepted_;
+    uint8_t length_[2];
+    std::vector<uint8_t> request_;
+    std::vector<std::vector<uint8_t> > requests_;
+};
+
 /// @brief Test Fixture class
 //
 // This test fixture class implements DNSClient::Callback so as it can be
@@ -91,6 +238,8 @@ public:
     //
     // Sets the asiodns logging level back to DEBUG.
     virtual ~DNSClientTest() {
+        // The connections are run by our IO service.
+        DNSTCPConnectionPool::instance().clear();
         asiodns::logger.setSeverity(isc::log::DEBUG);
     };
 
@@ -259,12 +408,7 @@ public:
     // callback object is NULL.
     void runConstructorTest() {
         EXPECT_NO_THROW(DNSClient(response_, NULL, DNSClient::UDP));
-
-        // The TCP Transport is not supported right now. So, we return exception
-        // if caller specified TCP as a preferred protocol. This test will be
-        // removed once TCP is supported.
-        EXPECT_THROW(DNSClient(response_, NULL, DNSClient::TCP),
-                     isc::NotImplemented);
+        EXPECT_NO_THROW(DNSClient(response_, NULL, DNSClient::TCP));
     }
 
     // This test verifies that it accepted timeout values belong to the range of
@@ -557,4 +701,151 @@ TEST_F(DNSClientTest, DISABLED_concurrentSendReceive) {
     runSendReceiveTest(false, true);
 }
 
+// Verify that the DNS Updates sent over TCP are pipelined on one
+// connection, matched with their responses by message ID and that the
+// connection is reused.
+TEST_F(DNSClientTest, tcpPipelined) {
+    TCPServer server(service_, 3);
+
+    int pending = 3;
+    TCPExchange first(service_, pending);
+    TCPExchange second(service_, pending);
+    TCPExchange third(service_, pending);
+    ASSERT_NO_THROW(first.send(1000));
+    ASSERT_NO_THROW(second.send(1000));
+    ASSERT_NO_THROW(third.send(1000));
+    EXPECT_EQ(1, DNSTCPConnectionPool::instance().
+              getConnectionCount(IOAddress(TEST_ADDRESS), TEST_PORT));
+
+    // The server responds once it received the three updates.
+    service_.run();
+
+    TCPExchange* exchanges[] = { &first, &second, &third };
+    for (int i = 0; i < 3; ++i) {
+        SCOPED_TRACE(i);
+        ASSERT_TRUE(exchanges[i]->completed_);
+        EXPECT_EQ(DNSClient::SUCCESS, exchanges[i]->status_);
+        ASSERT_TRUE(exchanges[i]->response_);
+        EXPECT_EQ(D2UpdateMessage::RESPONSE,
+                  exchanges[i]->response_->getQRFlag());
+        EXPECT_EQ(exchanges[i]->message_->getId(),
+                  exchanges[i]->response_->getId());
+    }
+    EXPECT_NE(first.message_->getId(), second.message_->getId());
+    EXPECT_NE(second.message_->getId(), third.message_->getId());
+
+    // The next update uses the same connection.
+    service_.get_io_service().reset();
+    server.batch_ = 1;
+    pending = 1;
+    first.response_.reset();
+    ASSERT_NO_THROW(first.send(1000));
+    service_.run();
+    EXPECT_EQ(DNSClient::SUCCESS, first.status_);
+    EXPECT_EQ(1, server.accepted_);
+}
+
+// Verify that a timeout is reported when the server does not respond
+// over TCP.
+TEST_F(DNSClientTest, tcpTimeout) {
+    TCPServer server(service_, 0);
+
+    int pending = 1;
+    TCPExchange exchange(service_, pending);
+    ASSERT_NO_THROW(exchange.send(100));
+    service_.run();
+    EXPECT_EQ(DNSClient::TIMEOUT, exchange.status_);
+    EXPECT_FALSE(exchange.response_);
+}
+
+// Verify that a failure is reported when the server can't be reached
+// over TCP.
+TEST_F(DNSClientTest, tcpConnectFailed) {
+    int pending = 1;
+    TCPExchange exchange(service_, pending);
+    ASSERT_NO_THROW(exchange.send(1000, TEST_PORT + 1));
+    // The failure is reported asynchronously.
+    EXPECT_FALSE(exchange.completed_);
+    service_.run();
+    EXPECT_EQ(DNSClient::OTHER, exchange.status_);
+}
+
+// Verify that the DNS Updates pending on a connection closed by the
+// server are sent again over a new connection.
+TEST_F(DNSClientTest, tcpReconnect) {
+    TCPServer server(service_, 2);
+    server.closes_ = 1;
+
+    int pending = 2;
+    TCPExchange first(service_, pending);
+    TCPExchange second(service_, pending);
+    ASSERT_NO_THROW(first.send(1000));
+    ASSERT_NO_THROW(second.send(1000));
+    service_.run();
+
+    EXPECT_EQ(DNSClient::SUCCESS, first.status_);
+    EXPECT_EQ(DNSClient::SUCCESS, second.status_);
+    EXPECT_EQ(2, server.accepted_);
+}
+
+// Verify that the DNS Updates are sent again only once when the server
+// closes the new connection too.
+TEST_F(DNSClientTest, tcpReconnectOnce) {
+    TCPServer server(service_, 1);
+    server.closes_ = 2;
+
+    int pending = 1;
+    TCPExchange exchange(service_, pending);
+    ASSERT_NO_THROW(exchange.send(1000));
+    service_.run();
+
+    EXPECT_EQ(DNSClient::OTHER, exchange.status_);
+    EXPECT_FALSE(exchange.response_);
+    EXPECT_EQ(2, server.accepted_);
+}
+
+// Verify that the pool evicts the connections which failed.
+TEST_F(DNSClientTest, tcpPoolEvictsClosed) {
+    DNSTCPConnectionPool& pool = DNSTCPConnectionPool::instance();
+    int pending = 1;
+    TCPExchange exchange(service_, pending);
+    ASSERT_NO_THROW(exchange.send(1000, TEST_PORT + 1));
+    DNSTCPConnectionPtr failed =
+        pool.getConnection(service_, IOAddress(TEST_ADDRESS), TEST_PORT + 1);
+    service_.run();
+    EXPECT_EQ(DNSClient::OTHER, exchange.status_);
+    EXPECT_TRUE(failed->isClosed());
+
+    // The failed connection is replaced by a new one.
+    DNSTCPConnectionPtr connection =
+        pool.getConnection(service_, IOAddress(TEST_ADDRESS), TEST_PORT + 1);
+    ASSERT_TRUE(connection);
+    EXPECT_NE(failed, connection);
+    EXPECT_EQ(1, pool.getConnectionCount(IOAddress(TEST_ADDRESS),
+                                         TEST_PORT + 1));
+}
+
+// Verify that the pool opens new connections to a server only when the
+// existing ones are loaded, up to the maximum.
+TEST_F(DNSClientTest, tcpPoolGrows) {
+    DNSTCPConnectionPool& pool = DNSTCPConnectionPool::instance();
+    OutputBuffer message(0);
+    message.writeUint32(0);
+    const size_t count = DNSTCPConnectionPool::MAX_PIPELINED_REQUESTS *
+        (DNSTCPConnectionPool::MAX_CONNECTIONS_PER_SERVER + 1);
+    for (size_t id = 0; id < count; ++id) {
+        DNSTCPConnectionPtr connection =
+            pool.getConnection(service_, IOAddress(TEST_ADDRESS), TEST_PORT);
+        ASSERT_TRUE(connection);
+        ASSERT_NO_THROW(connection->send(id, message, 1000,
+                                         DNSTCPConnection::Handler()));
+        if (id == 0) {
+            EXPECT_EQ(1, pool.getConnectionCount(IOAddress(TEST_ADDRESS),
+                                                 TEST_PORT));
+        }
+    }
+    EXPECT_EQ(DNSTCPConnectionPool::MAX_CONNECTIONS_PER_SERVER,
+              pool.getConnectionCount(IOAddress(TEST_ADDRESS), TEST_PORT));
+}
+
 } // End of anonymous namespace
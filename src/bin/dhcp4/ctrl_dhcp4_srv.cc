@@ -13,7 +13,9 @@
 #include <dhcp4/dhcp4to6_ipc.h>
 #include <dhcp4/parser_context.h>
 #include <dhcp4/json_config_parser.h>
+#include <dhcpsrv/cb_notify_fifo.h>
 #include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/host_mgr.h>
 #include <dhcpsrv/cfg_db_access.h>
 #include <hooks/hooks.h>
 #include <hooks/hooks_manager.h>
@@ -381,6 +383,12 @@ ControlledDhcpv4Srv::commandConfigSetHandler(const string&,
 
         // Use new configuration.
         CfgMgr::instance().commit();
+
+        // Watch the notifications of the config backend changes now that
+        // the configuration they apply to is in use.
+        if (server_) {
+            server_->openCBNotifyFifo();
+        }
     } else {
         // Ok, we applied the logging from the upcoming configuration, but
         // there were problems with the config. As such, we need to back off
@@ -391,6 +399,16 @@ ControlledDhcpv4Srv::commandConfigSetHandler(const string&,
     return (result);
 }
 
+ConstElementPtr
+ControlledDhcpv4Srv::commandSubnet4PatchHandler(const string&,
+                                                ConstElementPtr args) {
+    if (!args) {
+        return (createAnswer(CONTROL_RESULT_ERROR,
+                             "Missing mandatory 'arguments' parameter."));
+    }
+    return (patchDhcp4Subnets(args));
+}
+
 ConstElementPtr
 ControlledDhcpv4Srv::commandConfigTestHandler(const string&,
                                               ConstElementPtr args) {
@@ -606,6 +624,9 @@ ControlledDhcpv4Srv::processCommand(const string& command,
         } else if (command == "server-tag-get") {
             return (srv->commandServerTagGetHandler(command, args));
 
+        } else if (command == "subnet4-patch") {
+            return (srv->commandSubnet4PatchHandler(command, args));
+
         }
         ConstElementPtr answer = isc::config::createAnswer(1,
                                  "Unrecognized command:" + command);
@@ -648,12 +669,26 @@ ControlledDhcpv4Srv::processConfig(isc::data::ConstElementPtr config) {
         return (isc::config::createAnswer(1, err.str()));
     }
 
+    // Apply the packet processing settings. The lease lookup threads are
+    // restarted before the lease backend is reopened.
+    srv->configurePacketProcessing(CfgMgr::instance().getStagingCfg());
+
     // Re-open lease and host database with new parameters.
     try {
         DatabaseConnection::db_lost_callback =
             boost::bind(&ControlledDhcpv4Srv::dbLostCallback, srv, _1);
         CfgDbAccessPtr cfg_db = CfgMgr::instance().getStagingCfg()->getCfgDbAccess();
-        cfg_db->setAppendedParameters("universe=4");
+        // Unless the pool size is configured, each lease lookup thread and
+        // the server get their own connection. A configured pool-size comes
+        // first in the access string so it takes precedence.
+        std::ostringstream appended;
+        appended << "universe=4";
+        const uint32_t lookup_threads =
+            CfgMgr::instance().getStagingCfg()->getLeaseLookupThreads();
+        if (lookup_threads > 0) {
+            appended << " pool-size=" << (lookup_threads + 1);
+        }
+        cfg_db->setAppendedParameters(appended.str());
         cfg_db->createManagers();
     } catch (const std::exception& ex) {
         err << "Unable to open database: " << ex.what();
@@ -719,6 +754,10 @@ ControlledDhcpv4Srv::processConfig(isc::data::ConstElementPtr config) {
         return (isc::config::createAnswer(1, err.str()));
     }
 
+    // The periodic and the notified fetches of the configuration updates
+    // share the counter of their consecutive failures.
+    server_->cb_fetch_failure_count_.reset(new unsigned(0));
+
     auto ctl_info = CfgMgr::instance().getStagingCfg()->getConfigControlInfo();
     if (ctl_info) {
         long fetch_time = static_cast<long>(ctl_info->getConfigFetchWaitTime());
@@ -734,18 +773,34 @@ ControlledDhcpv4Srv::processConfig(isc::data::ConstElementPtr config) {
                 fetch_time = 1000 * fetch_time;
             }
 
-            boost::shared_ptr<unsigned> failure_count(new unsigned(0));
             TimerMgr::instance()->
                 registerTimer("Dhcp4CBFetchTimer",
                               boost::bind(&ControlledDhcpv4Srv::cbFetchUpdates,
                                           server_, CfgMgr::instance().getStagingCfg(),
-                                          failure_count),
+                                          server_->cb_fetch_failure_count_),
                               fetch_time,
                               asiolink::IntervalTimer::ONE_SHOT);
             TimerMgr::instance()->setup("Dhcp4CBFetchTimer");
         }
     }
 
+    // Build the filter of the host reservations and schedule its rebuilds.
+    try {
+        long filter_interval = static_cast<long>
+            (CfgMgr::instance().getStagingCfg()->getHostFilterRebuildInterval());
+        if (filter_interval > 0) {
+            // The filter is built by the timer a page of hosts at a time.
+            HostMgr::instance().startHostFilterRebuild(CfgMgr::instance().getStagingCfg());
+            if (!server_->inTestMode()) {
+                filter_interval = 1000 * filter_interval;
+            }
+            HostMgr::setupHostFilterTimer(filter_interval);
+        }
+    } catch (const std::exception& ex) {
+        err << "unable to setup the host reservations filter: " << ex.what();
+        return (isc::config::createAnswer(1, err.str()));
+    }
+
     // This hook point notifies hooks libraries that the configuration of the
     // DHCPv4 server has completed. It provides the hook library with the pointer
     // to the common IO service object, new server configuration in the JSON
@@ -791,7 +846,8 @@ ControlledDhcpv4Srv::checkConfig(isc::data::ConstElementPtr config) {
 ControlledDhcpv4Srv::ControlledDhcpv4Srv(uint16_t server_port /*= DHCP4_SERVER_PORT*/,
                                          uint16_t client_port /*= 0*/)
     : Dhcpv4Srv(server_port, client_port), io_service_(),
-      timer_mgr_(TimerMgr::instance()) {
+      timer_mgr_(TimerMgr::instance()),
+      cb_fetch_failure_count_(new unsigned(0)) {
     if (getInstance()) {
         isc_throw(InvalidOperation,
                   "There is another Dhcpv4Srv instance already.");
@@ -830,6 +886,9 @@ ControlledDhcpv4Srv::ControlledDhcpv4Srv(uint16_t server_port /*= DHCP4_SERVER_P
     CommandMgr::instance().registerCommand("dhcp-disable",
         boost::bind(&ControlledDhcpv4Srv::commandDhcpDisableHandler, this, _1, _2));
 
+    CommandMgr::instance().registerCommand("hooks-latency-get",
+        boost::bind(&HooksManager::calloutLatencyGetHandler, _1, _2));
+
     CommandMgr::instance().registerCommand("libreload",
         boost::bind(&ControlledDhcpv4Srv::commandLibReloadHandler, this, _1, _2));
 
@@ -842,6 +901,9 @@ ControlledDhcpv4Srv::ControlledDhcpv4Srv(uint16_t server_port /*= DHCP4_SERVER_P
     CommandMgr::instance().registerCommand("shutdown",
         boost::bind(&ControlledDhcpv4Srv::commandShutdownHandler, this, _1, _2));
 
+    CommandMgr::instance().registerCommand("subnet4-patch",
+        boost::bind(&ControlledDhcpv4Srv::commandSubnet4PatchHandler, this, _1, _2));
+
     CommandMgr::instance().registerCommand("version-get",
         boost::bind(&ControlledDhcpv4Srv::commandVersionGetHandler, this, _1, _2));
 
@@ -858,6 +920,9 @@ ControlledDhcpv4Srv::ControlledDhcpv4Srv(uint16_t server_port /*= DHCP4_SERVER_P
     CommandMgr::instance().registerCommand("statistic-get-all",
         boost::bind(&StatsMgr::statisticGetAllHandler, _1, _2));
 
+    CommandMgr::instance().registerCommand("statistic-latency-get",
+        boost::bind(&StatsMgr::statisticLatencyGetHandler, _1, _2));
+
     CommandMgr::instance().registerCommand("statistic-reset-all",
         boost::bind(&StatsMgr::statisticResetAllHandler, _1, _2));
 
@@ -892,6 +957,8 @@ ControlledDhcpv4Srv::~ControlledDhcpv4Srv() {
 
         timer_mgr_->unregisterTimers();
 
+        cb_notify_fifo_.close();
+
         // Close the command socket (if it exists).
         CommandMgr::instance().closeCommandSocket();
 
@@ -906,10 +973,12 @@ ControlledDhcpv4Srv::~ControlledDhcpv4Srv() {
         CommandMgr::instance().deregisterCommand("config-set");
         CommandMgr::instance().deregisterCommand("dhcp-disable");
         CommandMgr::instance().deregisterCommand("dhcp-enable");
+        CommandMgr::instance().deregisterCommand("hooks-latency-get");
         CommandMgr::instance().deregisterCommand("server-tag-get");
         CommandMgr::instance().deregisterCommand("shutdown");
         CommandMgr::instance().deregisterCommand("statistic-get");
         CommandMgr::instance().deregisterCommand("statistic-get-all");
+        CommandMgr::instance().deregisterCommand("statistic-latency-get");
         CommandMgr::instance().deregisterCommand("statistic-remove");
         CommandMgr::instance().deregisterCommand("statistic-remove-all");
         CommandMgr::instance().deregisterCommand("statistic-reset");
@@ -918,6 +987,7 @@ ControlledDhcpv4Srv::~ControlledDhcpv4Srv() {
         CommandMgr::instance().deregisterCommand("statistic-sample-age-set-all");
         CommandMgr::instance().deregisterCommand("statistic-sample-count-set");
         CommandMgr::instance().deregisterCommand("statistic-sample-count-set-all");
+        CommandMgr::instance().deregisterCommand("subnet4-patch");
         CommandMgr::instance().deregisterCommand("version-get");
 
     } catch (...) {
@@ -1032,14 +1102,42 @@ ControlledDhcpv4Srv::dbLostCallback(ReconnectCtlPtr db_reconnect_ctl) {
     return(true);
 }
 
+void
+ControlledDhcpv4Srv::openCBNotifyFifo() {
+    // Fetch the configuration updates as soon as they are notified through
+    // the named pipe, if any. The fetch also reschedules the timer.
+    cb_notify_fifo_.close();
+    SrvConfigPtr srv_cfg = CfgMgr::instance().getCurrentCfg();
+    process::ConstConfigControlInfoPtr ctl_info = srv_cfg->getConfigControlInfo();
+    if (!ctl_info || ctl_info->getNotifyFifo().empty()) {
+        return;
+    }
+
+    const std::string& notify_path = ctl_info->getNotifyFifo();
+    try {
+        cb_notify_fifo_.open(notify_path,
+                             boost::bind(&ControlledDhcpv4Srv::cbFetchUpdates,
+                                         this, srv_cfg,
+                                         cb_fetch_failure_count_));
+    } catch (const std::exception& ex) {
+        LOG_ERROR(dhcp4_logger, DHCP4_CB_NOTIFY_FIFO_FAIL)
+            .arg(notify_path).arg(ex.what());
+    }
+}
+
 void
 ControlledDhcpv4Srv::cbFetchUpdates(const SrvConfigPtr& srv_cfg,
                                     boost::shared_ptr<unsigned> failure_count) {
+    // Once the timer gave up, the fetches triggered by the notifications
+    // neither count the failures nor re-arm it.
+    const bool gave_up = (*failure_count > 10);
     try {
         // Fetch any configuration backend updates since our last fetch.
         server_->getCBControl()->databaseConfigFetch(srv_cfg,
                                                      CBControlDHCPv4::FetchMode::FETCH_UPDATE);
-        (*failure_count) = 0;
+        if (!gave_up) {
+            (*failure_count) = 0;
+        }
 
     } catch (const std::exception& ex) {
         LOG_ERROR(dhcp4_logger, DHCP4_CB_FETCH_UPDATES_FAIL)
@@ -1047,16 +1145,15 @@ ControlledDhcpv4Srv::cbFetchUpdates(const SrvConfigPtr& srv_cfg,
 
         // We allow at most 10 consecutive failures after which we stop
         // making further attempts to fetch the configuration updates.
-        // Let's return without re-scheduling the timer.
-        if (++(*failure_count) > 10) {
+        if (!gave_up && (++(*failure_count) > 10)) {
             LOG_ERROR(dhcp4_logger, DHCP4_CB_FETCH_UPDATES_RETRIES_EXHAUSTED);
-            return;
         }
     }
 
     // Reschedule the timer to fetch new updates or re-try if
-    // the previous attempt resulted in an error.
-    if (TimerMgr::instance()->isTimerRegistered("Dhcp4CBFetchTimer")) {
+    // the previous attempt resulted in an error, unless it gave up.
+    if ((*failure_count <= 10) &&
+        TimerMgr::instance()->isTimerRegistered("Dhcp4CBFetchTimer")) {
         TimerMgr::instance()->setup("Dhcp4CBFetchTimer");
     }
 }
@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 183
-#define YY_END_OF_BUFFER 184
+#define YY_NUM_RULES 193
+#define YY_END_OF_BUFFER 194
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,181 +700,198 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[1581] =
+static const flex_int16_t yy_accept[1727] =
     {   0,
-      176,  176,    0,    0,    0,    0,    0,    0,    0,    0,
-      184,  182,   10,   11,  182,    1,  176,  173,  176,  176,
-      182,  175,  174,  182,  182,  182,  182,  182,  169,  170,
-      182,  182,  182,  171,  172,    5,    5,    5,  182,  182,
-      182,   10,   11,    0,    0,  165,    0,    0,    0,    0,
+      186,  186,    0,    0,    0,    0,    0,    0,    0,    0,
+      194,  192,    1,  192,  192,   10,   11,  179,  180,  181,
+      182,  183,  184,  186,  185,  186,  186,  192,  192,  192,
+      192,  192,  192,  192,  192,    5,   11,    5,    5,   10,
+       11,  192,  192,   10,   11,  192,  192,  192,   10,  192,
+       11,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    1,
-      176,  176,    0,  175,  176,    3,    2,    6,    0,  176,
-        0,    0,    0,    0,    0,    0,    4,    0,    0,    9,
+        0,    0,    0,    0,    0,    0,  175,    0,    1,    3,
+        2,    6,   10,   11,  185,  186,    0,  186,  186,    0,
 
-        0,  166,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  168,    0,    0,    0,
+      186,    0,    0,    0,    0,    0,    0,    4,    0,    0,
+        9,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    2,    0,    0,    0,    0,    0,    0,    0,
-        8,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  178,    0,    0,  176,    0,    0,    2,    0,    0,
 
-        0,    0,    0,    0,    0,  167,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    8,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   72,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   74,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  181,  179,    0,  178,  177,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      145,    0,  144,    0,    0,   78,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   35,
+        0,    0,    0,  177,    0,    0,  189,  187,    0,    0,
+      191,  188,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   36,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   17,
+        0,    0,    0,    0,    0,    0,    0,  154,    0,    0,
+        0,    0,    0,  153,   18,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   75,    0,    0,    0,
+
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       17,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   80,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   77,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  187,  190,
+        0,    0,    0,    0,    0,    0,    0,   81,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,   18,    0,    0,    0,
-        0,  180,  177,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  146,    0,    0,  148,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   79,    0,    0,    0,
-        0,    0,    0,    0,   64,    0,    0,    0,    0,    0,
-       99,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   38,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   63,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   67,    0,   39,    0,    0,
+        0,    0,    0,  158,   32,    0,    0,    0,    0,  105,
+       37,    0,    0,    0,  155,    0,    0,    0,   40,    0,
+        0,   69,    0,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   65,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   96,   31,    0,    0,
-       36,    0,    0,    0,    0,    0,    0,    0,    0,   12,
-      153,    0,  150,    0,  149,    0,    0,    0,  109,    0,
+        0,   39,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  108,   66,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   89,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   33,    0,
-
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   66,    0,    0,    0,    0,    0,    0,    0,    0,
-      110,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  105,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    7,    0,    0,  151,    0,    0,
+        0,  119,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   68,
+        0,    0,    0,   12,  163,    0,    0,    0,    0,    0,
+        0,    0,   96,    0,  160,    0,    0,    0,    0,  114,
+        0,    0,    0,    0,    0,  159,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   34,    0,
+        0,    0,    0,    0,    0,    0,   99,    0,    0,    0,
+      118,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    7,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       77,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  156,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   72,
+        0,    0,    0,    0,    0,   98,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  161,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   94,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   79,    0,    0,    0,    0,
 
-       91,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       87,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   71,    0,    0,    0,    0,
+        0,    0,   92,  124,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   70,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   84,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   69,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   41,    0,    0,    0,
+        0,    0,    0,    0,  112,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   61,    0,
+        0,    0,    0,    0,    0,    0,    0,   97,    0,   33,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  103,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  115,   85,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   91,
 
-        0,    0,    0,   90,   32,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   40,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   59,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  154,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   31,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   38,    0,    0,    0,  164,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  101,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  113,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       74,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      104,    0,    0,    0,    0,    0,   43,    0,    0,    0,
 
+       76,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   44,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   37,    0,    0,
-        0,   30,    0,    0,    0,    0,    0,    0,    0,    0,
+      110,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   23,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       92,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       51,    0,    0,    0,    0,   73,    0,    0,    0,  140,
+        0,    0,    0,    0,  142,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  101,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  128,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       71,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
+        0,    0,    0,  137,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   23,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  133,    0,
-        0,    0,  131,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  158,    0,    0,
-        0,    0,    0,    0,    0,  102,    0,    0,    0,    0,
-        0,    0,    0,    0,  106,   88,    0,    0,    0,    0,
+      115,    0,  111,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  100,   22,    0,  111,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  137,    0,    0,    0,    0,
+        0,    0,   84,   85,    0,    0,    0,    0,    0,  123,
+       35,    0,  120,    0,    0,   22,    0,    0,    0,    0,
+        0,   60,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  146,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  109,    0,    0,    0,   95,
+
+        0,    0,    0,    0,    0,    0,    0,    0,   63,    0,
+        0,    0,    0,    0,  168,    0,    0,    0,    0,    0,
+        0,    0,    0,   45,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   57,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  117,    0,   50,    0,   21,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      141,    0,  143,    0,    0,    0,  135,  134,  172,    0,
+       30,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   67,    0,    0,    0,    0,    0,
+        0,    0,    0,   78,   64,    0,    0,    0,    0,    0,
 
-       61,    0,    0,    0,    0,    0,  114,   34,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   58,    0,    0,    0,   82,   83,
+        0,  104,    0,    0,   15,   42,    0,    0,    0,    0,
+      116,   58,    0,  107,    0,    0,    0,    0,    0,   70,
+        0,    0,    0,    0,  121,    0,    0,  157,    0,    0,
+        0,    0,    0,    0,  145,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       65,    0,    0,    0,    0,    0,    0,    0,    0,   44,
-        0,    0,    0,    0,    0,    0,    0,    0,  108,    0,
+        0,    0,    0,  132,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  162,
-        0,   62,   76,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   55,    0,    0,    0,    0,    0,    0,    0,
-
-      134,    0,    0,  132,    0,  126,  125,    0,   49,    0,
-       21,    0,    0,    0,    0,    0,  147,    0,    0,    0,
-       95,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  123,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  112,   15,    0,   41,    0,    0,    0,
-        0,    0,    0,    0,  136,    0,    0,    0,    0,    0,
-        0,   56,    0,    0,  107,    0,    0,    0,    0,   98,
-        0,    0,    0,    0,    0,    0,    0,   68,    0,  156,
-        0,  155,    0,  161,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   49,    0,    0,    0,    0,    0,
 
+        0,    0,    0,    0,   14,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  171,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  165,    0,  166,    0,    0,   52,  133,   27,    0,
+        0,    0,    0,    0,  102,   24,    0,    0,    0,    0,
+        0,    0,    0,  169,    0,  138,    0,    0,    0,  174,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   14,    0,
-        0,    0,   48,    0,    0,    0,    0,  164,    0,   93,
-       27,    0,    0,    0,   50,  124,    0,    0,    0,  159,
-      129,    0,    0,    0,    0,    0,    0,    0,    0,   25,
-        0,    0,   24,    0,  135,    0,    0,    0,    0,    0,
-        0,    0,   86,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   52,    0,    0,
-        0,    0,    0,   42,    0,    0,    0,    0,    0,    0,
-
-        0,  113,    0,    0,    0,   26,    0,  160,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   47,    0,    0,   20,    0,  163,   60,    0,  157,
-      152,    0,   28,    0,    0,    0,   16,    0,    0,  141,
-        0,    0,    0,    0,    0,    0,  121,    0,    0,    0,
-       97,    0,    0,    0,    0,    0,    0,    0,    0,   73,
+        0,  144,    0,    0,    0,    0,    0,    0,    0,   25,
+        0,    0,    0,    0,    0,    0,   54,    0,   93,    0,
+        0,    0,    0,    0,    0,    0,    0,   43,   86,    0,
+
+        0,    0,   48,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  173,    0,   20,   62,    0,    0,
+        0,    0,  170,    0,    0,    0,    0,    0,   26,    0,
+      122,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   28,    0,    0,    0,    0,    0,    0,    0,
+       75,    0,    0,    0,    0,    0,  162,    0,    0,    0,
+        0,  130,    0,    0,    0,    0,    0,    0,    0,  100,
+        0,    0,   16,    0,    0,    0,  106,  167,    0,  150,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  142,   13,    0,    0,    0,    0,    0,    0,    0,
-      130,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      127,    0,    0,    0,    0,    0,  120,    0,   54,   53,
+        0,   13,    0,    0,    0,    0,    0,    0,    0,  151,
 
-       19,    0,  138,    0,    0,    0,    0,   45,    0,   81,
-        0,    0,    0,    0,  119,    0,    0,   51,    0,    0,
-       46,  140,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  139,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   29,    0,    0,    0,    0,    0,
-      139,    0,   94,    0,    0,    0,    0,    0,    0,  117,
-      122,   57,    0,    0,    0,    0,  116,    0,    0,  143,
-        0,    0,    0,    0,    0,   80,    0,    0,  118,    0
+        0,   46,   56,  129,    0,   55,    0,    0,    0,    0,
+        0,  136,   19,    0,  147,    0,   83,    0,    0,    0,
+       47,  149,    0,    0,    0,    0,    0,   53,    0,    0,
+        0,  128,    0,    0,    0,   87,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   89,    0,    0,    0,    0,    0,    0,
+        0,   29,  103,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  148,  126,    0,  131,   88,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,   59,  125,    0,
+      152,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       90,   82,    0,    0,  127,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -886,11 +903,11 @@ static const YY_CHAR yy_ec[256] =
         5,    8,    9,   10,   11,   12,   13,   14,   15,   16,
        14,   17,   14,   18,   14,   14,   14,   19,    5,   20,
         5,   21,   22,    5,   23,   24,   25,   26,   27,   28,
-        5,   29,    5,   30,    5,   31,    5,   32,   33,   34,
-        5,   35,   36,   37,   38,   39,   40,    5,   41,    5,
-       42,   43,   44,    5,   45,    5,   46,   47,   48,   49,
+        5,   29,   30,   31,    5,   32,    5,   33,   34,   35,
+        5,   36,   37,   38,   39,   40,   41,    5,   42,    5,
+       43,   44,   45,    5,   46,    5,   47,   48,   49,   50,
 
-       50,   51,   52,   53,   54,   55,   56,   57,   58,   59,
+       51,   52,   53,   54,   55,   31,   56,   57,   58,   59,
        60,   61,   62,   63,   64,   65,   66,   67,   68,   69,
        70,   71,   72,    5,   73,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -911,834 +928,1366 @@ static const YY_CHAR yy_ec[256] =
 
 static const YY_CHAR yy_meta[74] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    5,    5,    3,    3,
-        3,    3,    5,    5,    5,    5,    5,    5,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    5,    5,    5,    5,    5,
-        5,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[1593] =
+static const flex_int16_t yy_base[1727] =
     {   0,
-        0,   72,   21,   31,   43,   51,   54,   60,   91,   99,
-     1980, 1981,   34, 1976,  145,    0,  207, 1981,  214,  221,
-       13,  228, 1981, 1956,  118,   25,    2,    6, 1981, 1981,
-       73,   11,   17, 1981, 1981, 1981,  104, 1964, 1917,    0,
-     1954,  108, 1971,   24,  262, 1981, 1913,   67, 1912, 1918,
-       84,   75, 1910,   88,  226,   91,   89,  290,  196, 1909,
-      206,  285,  206,  210,  219,   60,  223, 1918,  247,  290,
-      315,  303,  231, 1901,  297,  321,  343,  324, 1920,    0,
-      380,  387,  401,  408,  424, 1981,    0, 1981,  429,  438,
-      216,  249,  220,  315,  335,  266, 1981, 1917, 1958, 1981,
-
-      342, 1981,  421, 1945,  312, 1903, 1913,  400,   10, 1908,
-      361,  323,  370,  387,  359, 1953,    0,  474,  392, 1895,
-     1892, 1896, 1898, 1891, 1899,  412, 1895, 1884, 1885,   78,
-     1901, 1884, 1893, 1893,   95, 1884,  400, 1885, 1883,  405,
-     1931, 1935, 1875, 1928, 1868, 1891, 1888, 1888, 1882,  310,
-     1875, 1873, 1867, 1872, 1866,  436, 1877, 1870, 1861, 1860,
-     1874,  186, 1860,  413, 1876, 1853,  470,  318,  400, 1874,
-     1871, 1872, 1870, 1905, 1904,  445, 1850, 1852,  448, 1844,
-     1861, 1853,    0,  447,  447,  458,  471,  462,  483, 1852,
-     1981,    0, 1897,  490, 1842, 1845,  476,  482, 1853,  488,
-
-     1898,  499, 1897,  496, 1896, 1981,  542, 1895,  507, 1854,
-     1846, 1833, 1849, 1848, 1845, 1844, 1835,  486, 1886, 1880,
-     1844, 1823, 1831, 1826, 1840, 1836, 1824, 1836, 1836, 1827,
-     1811, 1815, 1828, 1830, 1827, 1819, 1809, 1827, 1981, 1822,
-     1825, 1806, 1805, 1857, 1804, 1814, 1817,  531, 1813, 1852,
-     1800, 1811, 1849, 1794, 1852, 1787, 1802,  533, 1792, 1808,
-     1789, 1788, 1794, 1785, 1784, 1791, 1841, 1797, 1796, 1790,
-      486, 1797, 1792, 1784, 1774, 1789, 1788, 1783, 1787,  485,
-     1785, 1771, 1777, 1784, 1772, 1769, 1768,  565, 1763, 1777,
-     1820, 1779,  484, 1770,  527, 1981, 1981,  534, 1981, 1981,
-
-     1757,    0,  241,  531, 1759,  556,  535, 1815, 1766,  540,
-     1981, 1813, 1981, 1807,  590, 1981,  540, 1747, 1756, 1804,
-     1748, 1747, 1753, 1805, 1760, 1755, 1758, 1753,  533, 1981,
-     1755, 1799, 1752, 1749,  608, 1755, 1795, 1789, 1742, 1737,
-     1734, 1785, 1742, 1731, 1747, 1781, 1727,  591, 1741, 1726,
-     1739, 1726, 1736, 1731, 1738, 1733, 1729,  559, 1727, 1730,
-     1725, 1711, 1720, 1770,  548, 1764, 1981, 1763, 1713, 1712,
-     1711, 1704, 1706, 1710, 1699, 1712,  580, 1759, 1712, 1709,
-     1981, 1712, 1701, 1701, 1713,  370, 1688, 1689, 1710,  533,
-     1692, 1743, 1688, 1702, 1705, 1700, 1686, 1698, 1697, 1696,
-
-     1695, 1694, 1693,  564, 1736, 1735, 1981, 1677, 1676,  618,
-     1689, 1981, 1981, 1688,    0, 1677, 1669,  564, 1674, 1727,
-     1726, 1682, 1724, 1981, 1670, 1722, 1981,  598,  646,  611,
-     1721, 1663, 1674, 1667, 1669, 1657, 1981, 1662, 1668, 1671,
-     1654, 1669, 1656, 1655, 1981, 1657, 1654,  584, 1652, 1654,
-     1981, 1662, 1659, 1644, 1657, 1652,  643, 1659, 1647, 1640,
-     1691, 1981, 1638, 1654, 1688, 1649, 1646, 1647, 1649, 1683,
-     1634, 1629, 1628, 1679, 1623, 1638, 1641, 1615, 1622, 1627,
-     1637, 1676, 1981, 1621, 1617, 1615, 1624, 1618, 1625, 1609,
-     1609, 1619, 1622, 1611, 1606, 1981, 1663, 1981, 1605, 1616,
-
-     1601, 1606, 1615, 1609, 1603, 1612, 1654, 1648, 1610, 1593,
-     1593, 1588, 1608, 1583, 1589, 1594, 1587, 1595, 1599, 1582,
-     1640, 1580, 1581, 1580, 1592, 1581, 1981, 1981, 1581, 1579,
-     1981, 1590, 1626, 1586,    0, 1570, 1587, 1627, 1575, 1981,
-     1981, 1572, 1981, 1578, 1981,  598,  616,  670, 1981, 1575,
-     1574, 1581, 1561, 1614, 1559, 1612, 1557, 1556, 1555, 1562,
-     1555, 1567, 1566, 1566, 1548, 1553, 1594, 1561, 1553, 1598,
-     1542, 1558, 1557, 1981, 1542, 1539, 1597, 1552, 1544, 1550,
-     1541, 1549, 1534, 1550, 1532, 1546,  341, 1528, 1522, 1527,
-     1542, 1539, 1540, 1530, 1536, 1579, 1534, 1526, 1981, 1519,
-
-     1521, 1530, 1528, 1567, 1566, 1517,   16, 1526, 1509, 1510,
-     1507, 1981, 1521, 1500, 1519, 1511, 1556, 1508, 1515, 1553,
-     1981, 1498, 1512, 1496, 1510, 1513, 1494, 1546, 1545, 1544,
-     1543, 1488, 1541, 1540, 1981,  328, 1502, 1501, 1498, 1498,
-     1496, 1479, 1484, 1486, 1981, 1492, 1482, 1981, 1529, 1475,
-     1532,  615,  584, 1473, 1471, 1478, 1469, 1522,  629, 1526,
-      594, 1520, 1480, 1518, 1517, 1469, 1459, 1514, 1465, 1473,
-     1474, 1510, 1471, 1465, 1452, 1460, 1505, 1509, 1464, 1463,
-     1981, 1464, 1457, 1446, 1459, 1462, 1457, 1458, 1455, 1454,
-     1450, 1456, 1451, 1494, 1493, 1441, 1431,  596, 1442, 1489,
-
-     1981, 1488, 1439, 1434, 1426, 1427, 1478, 1439, 1426, 1437,
-     1981, 1425, 1434, 1433, 1433,    2,  156,  229,  363,  424,
-      431,  537,  515,  499,  524,  601,  616,  624,  600,  655,
-      619,  624,  620,  637,  612,  625,  640, 1981,  680,  637,
-      638,  628,  650,  652,  638,  645,  652,  644,  658,  663,
-      704, 1981,  700,  676,  663,  668,  665,  666,  663,  661,
-      670, 1981,  660,  675,  672,  658,  665,  664,  662,  681,
-      678,  668,  666,  665,  676,  672,  728,  685,  675,  691,
-      681, 1981,  691,  692,  685,  696,  694,  739,  681,  683,
-      698,  685,  745,  702,  688,  691, 1981, 1981,  701,  706,
-
-      711,  699,  710, 1981, 1981,  711,  715,  702,  696,  701,
-      719,  706,  756,  707,  759,  708,  766, 1981,  711,  715,
-      710,  770,  723,  713,  714,  710,  723,  734,  718,  736,
-      731,  732,  734,  727,  729,  730,  731,  731,  733,  748,
-      789,  746,  751,  728, 1981,  740,  741,  755,  745,  792,
-      750,  740,  755,  756,  743,  757, 1981,  776,  784,  753,
-      748,  803,  804,  767,  771,  812,  760,  755,  756,  768,
-      775,  764,  765,  761,  770,  765,  823,  780,  781,  772,
-     1981,  774,  786,  771,  788,  782,  829,  795,  779,  780,
-     1981,  796,  799,  782,  841,  784, 1981,  801,  804,  784,
-
-      802,  842,  800,  796,  845,  846,  793,  811,  810,  811,
-      797,  812,  804,  811,  801,  819,  804, 1981,  812,  818,
-      865, 1981,  814,  819,  863,  814,  826,  820,  825,  823,
-      821,  823,  833,  878,  822,  827,  823,  882,  826,  838,
-     1981,  826,  834,  832,  829,  830,  839,  851,  835,  840,
-      850,  851,  856,  897,  854,  871,  876,  858,  855,  851,
-      846,  906,  849, 1981,  849,  869,  868,  859,  848,  865,
-      872,  915,  916,  863, 1981,  913,  860,  863,  862,  882,
-      879,  884,  885,  871,  879,  890,  870,  885,  892,  934,
-     1981,  935,  936,  887,  897,  899,  888,  884,  891,  900,
-
-      894,  895,  947,  894,  892,  894,  911,  952,  902,  901,
-      907,  905,  903,  958,  959,  955, 1981,  917,  910,  901,
-      920,  908,  918,  915,  920,  916,  929,  929, 1981,  913,
-      915,  915, 1981,  916,  976,  915,  934,  935,  981,  982,
-      935,  920,  941,  940,  924,  929,  947, 1981,  937,  970,
-      961,  993,  933,  955,  952, 1981,  939,  941,  958,  953,
-      957, 1002,  950,  954, 1981, 1981,  964,  964, 1002,  949,
-     1004,  951, 1011,  954,  965,  958,  964,  960,  978,  979,
-      981, 1981, 1981,  980, 1981,  965,  966,  985,  975,  968,
-      980, 1024,  988,  983,  984, 1981,  982, 1034,  975, 1036,
-
-     1981, 1037,  979,  985,  992, 1036, 1981, 1981,  984,  986,
-     1000, 1005,  988, 1047, 1004, 1005, 1006, 1046,  998, 1003,
-     1054, 1007, 1003, 1057, 1981, 1004, 1059, 1060, 1981, 1981,
-     1000, 1062, 1021, 1064, 1006, 1018, 1023, 1009, 1039, 1070,
-     1981, 1027, 1020, 1029, 1074, 1021, 1036, 1072, 1024, 1981,
-     1020, 1036, 1041, 1028, 1024, 1084, 1037, 1042, 1981, 1043,
-     1036, 1045, 1046, 1043, 1033, 1036, 1036, 1041, 1096, 1098,
-     1041, 1100, 1096, 1037, 1052, 1046, 1061, 1062, 1108, 1981,
-     1061, 1981, 1981, 1066, 1059, 1069, 1054, 1055, 1116, 1060,
-     1071, 1120, 1981, 1068, 1068, 1070, 1072, 1125, 1066, 1069,
-
-     1981, 1070, 1089, 1981, 1073, 1981, 1981, 1087, 1981, 1081,
-     1981, 1133, 1082, 1135, 1136, 1116, 1981, 1138, 1095, 1136,
-     1981, 1084, 1092, 1086, 1083, 1086, 1089, 1089, 1090, 1097,
-     1087, 1981, 1109, 1095, 1096, 1111, 1111, 1114, 1114, 1111,
-     1156, 1118, 1110, 1981, 1981, 1120, 1981, 1117, 1122, 1123,
-     1120, 1164, 1126, 1127, 1981, 1115, 1116, 1116, 1122, 1121,
-     1132, 1981, 1173, 1120, 1981, 1121, 1121, 1123, 1129, 1981,
-     1131, 1185, 1127, 1135, 1138, 1189, 1150, 1981, 1147, 1981,
-     1144, 1981, 1167, 1981, 1194, 1136, 1196, 1197, 1154, 1159,
-     1141, 1201, 1202, 1155, 1145, 1150, 1206, 1207, 1203, 1166,
-
-     1162, 1206, 1154, 1159, 1157, 1216, 1172, 1218, 1176, 1221,
-     1182, 1171, 1165, 1166, 1167, 1183, 1183, 1229, 1171, 1188,
-     1187, 1171, 1229, 1230, 1177, 1232, 1195, 1196, 1981, 1196,
-     1197, 1184, 1981, 1195, 1244, 1202, 1216, 1981, 1198, 1981,
-     1981, 1190, 1201, 1250, 1981, 1981, 1197, 1195, 1209, 1981,
-     1981, 1199, 1250, 1193, 1198, 1258, 1206, 1216, 1217, 1981,
-     1262, 1215, 1981, 1264, 1981, 1207, 1222, 1210, 1220, 1221,
-     1227, 1231, 1981, 1267, 1233, 1228, 1237, 1219, 1226, 1280,
-     1239, 1238, 1283, 1231, 1285, 1286, 1235, 1981, 1288, 1289,
-     1238, 1291, 1233, 1981, 1240, 1240, 1295, 1239, 1238, 1298,
-
-     1251, 1981, 1295, 1246, 1243, 1981, 1257, 1981, 1260, 1305,
-     1258, 1255, 1256, 1309, 1268, 1251, 1253, 1250, 1266, 1267,
-     1276, 1981, 1266, 1318, 1981, 1277, 1981, 1981, 1315, 1981,
-     1981, 1277, 1981, 1317, 1318, 1273, 1981, 1271, 1278, 1981,
-     1275, 1280, 1278, 1330, 1331, 1274, 1981, 1289, 1290, 1291,
-     1981, 1292, 1282, 1294, 1339, 1281, 1289, 1290, 1303, 1981,
-     1280, 1303, 1288, 1288, 1293, 1349, 1308, 1299, 1308, 1310,
-     1314, 1981, 1981, 1355, 1298, 1357, 1358, 1359, 1317, 1361,
-     1981, 1357, 1319, 1320, 1307, 1366, 1303, 1368, 1321, 1326,
-     1981, 1327, 1328, 1373, 1330, 1333, 1981, 1376, 1981, 1981,
-
-     1981, 1337, 1981, 1319, 1379, 1380, 1323, 1981, 1340, 1981,
-     1331, 1327, 1327, 1329, 1981, 1334, 1344, 1981, 1330, 1342,
-     1981, 1981, 1347, 1341, 1349, 1346, 1337, 1391, 1338, 1346,
-     1355, 1348, 1343, 1358, 1403, 1350, 1357, 1344, 1359, 1364,
-     1409, 1366, 1411, 1354, 1981, 1370, 1361, 1375, 1371, 1364,
-     1981, 1418, 1981, 1419, 1420, 1375, 1374, 1375, 1365, 1981,
-     1981, 1981, 1425, 1367, 1383, 1428, 1981, 1424, 1373, 1981,
-     1372, 1374, 1385, 1434, 1383, 1981, 1392, 1437, 1981, 1981,
-     1443, 1448, 1453, 1458, 1463, 1468, 1473, 1476, 1450, 1455,
-     1457, 1470
-
+        1,    1,   75,    1,  149,    1,  223,    1,  297,    1,
+        1,  371,  963, 1564, 1387, 1500, 1114,  966,    1,    1,
+        1,    1,    1, 1543,    1, 1246, 1338, 1627, 1556, 1417,
+     1554,  977, 1140, 1304,    1,    1,    1, 2029,    1,    1,
+        1,    1, 2055,    1,    1, 1111,    1,    1,    1, 2162,
+        1, 1242, 1516, 1732, 1597, 1463, 1536, 1656, 1554, 1547,
+     1746, 1438, 1483, 1758, 1227, 1668, 1603, 1561, 1739, 1470,
+     1666, 2273, 1514, 1630, 1723, 1624, 2740, 1896, 1573, 1906,
+     1908, 1915, 2761, 1918, 1919,  445,    1,  519,    1,    1,
+     1037,    1,    1,    1,    1,    1,    1,    1,    1, 1177,
+
+        1, 1565, 2340, 1463, 2594, 1677, 2646,    1, 2703, 2846,
+        1, 1680, 1941, 1926, 1925, 1944, 2772, 1955, 1963, 2775,
+     1966, 1480, 1959, 1971, 1349, 1972, 1772, 1402, 1350, 1986,
+     1994, 1404, 1991, 1979, 1612, 1785, 1999, 1770, 1294, 1680,
+     2003, 2012, 1784, 1985, 2021, 2041, 2026, 1796, 1701, 2030,
+     1701, 2778, 1777, 2779, 2035, 2042, 1793, 1702, 2047, 2048,
+     2056, 1792, 2062, 2070, 2077, 1348, 2085, 2078, 1821, 1822,
+     2089, 2092, 1835, 2103, 2107, 2110, 2121, 2781, 2122, 2124,
+     2130, 2133, 2139, 2783, 2149, 2174, 2784, 2153, 2162, 2178,
+     2786, 2787,  593, 1185,    1,    1, 1488,    1, 1634, 3465,
+
+     1637, 3467, 1882, 3476, 3479,    1, 1640, 2179, 2164, 2186,
+     2181, 2200, 2190, 2197, 2226, 2206, 2204, 2211, 2241, 2233,
+     2214, 2232, 2237, 2253, 2226, 2790, 2792, 2253, 2279, 2260,
+     2267, 2249, 2798, 1825, 2273, 1848, 2308, 2293, 2300, 2294,
+     1844, 2315, 2323, 2801, 1841, 2311, 2309, 2804, 2322, 2819,
+     2329, 2341, 2352, 2823, 2354, 2827,    1, 2330, 1863, 2360,
+     2361, 1871, 1864, 2379, 2340, 2374, 2382, 2388, 2381, 2399,
+     2402, 1882, 2418, 2424, 2402, 2412, 1718, 2427, 2418, 2457,
+     2435, 2443, 2456, 2454, 2830, 2462, 2831, 2482, 2834, 2836,
+     2468, 2470, 2839, 2842, 2471, 2473, 2845, 2447, 2493, 1607,
+
+     2482, 2518, 2515, 2512, 2520, 2533, 2848, 2497, 2540, 2532,
+     1297,    1,    1,    1,    1, 1312,    1,    1, 1872, 3488,
+        1,    1, 3474, 2537, 2547, 2553, 2559, 2565, 2580, 2571,
+     2583, 2581, 2524, 2595,    1, 2583, 2850, 2593, 2595, 2605,
+     2029, 2856, 1403, 2607, 2617, 2616, 2631, 2859, 2643,    1,
+     2660, 2647, 2862, 2651, 2658, 2673, 1870,    1, 2667, 2673,
+     2674, 1864, 2666,    1,    1, 2669, 2728, 2684, 2691, 2714,
+     2734, 1739, 2720, 2719, 1755, 1889, 2735, 2733, 2731, 2739,
+     2746, 2742,  667, 1973, 1499, 3490, 1268, 3491, 1480, 1430,
+     3492, 3493, 3494, 2018, 3535, 1281, 1546, 1233, 3496, 1209,
+
+     1530, 1723, 3493, 1267, 1815, 2069, 3538, 1638, 1953, 1337,
+     1454,    1, 3480, 1600, 1703, 1851, 3497, 1936, 2046, 3547,
+     3548, 3506, 3502, 3498, 1879, 3499, 3500,    1, 3498, 3551,
+     3500, 2047, 3509, 3502, 3519, 1776, 1351, 1366,    1,    1,
+     3517, 3519, 3510, 3518, 3508, 3524, 1814,    1, 3563, 3518,
+     3516, 3512, 3523, 3516, 3517, 3570, 3523, 3520, 3520, 3574,
+     3531, 3528, 3538, 3524, 3531, 3541, 3586, 3544, 3527, 3546,
+     3545, 3546, 3534,    1,    1, 3548, 3540, 3538, 3539,    1,
+        1, 3554, 3544, 3546,    1, 3541, 3547, 3557,    1, 3545,
+     3604,    1, 3548, 3548, 3563, 3608, 3609, 1559, 3564, 3567,
+
+     3566, 1653, 2132, 3564, 3614, 3558, 3565, 3560, 3569, 3619,
+     3556, 3580, 3578, 3564, 3565, 3625, 3568, 3570, 3574,    1,
+     3565, 3573, 3590, 3587, 3573, 1353, 3629, 3584, 3595, 3637,
+     3597,    1, 2088, 3634, 3583, 3636, 3598, 2192, 2094, 2118,
+     3643, 3587, 3594, 3593, 3596, 1764, 3594,    1,    1, 3644,
+     3597, 3591, 3593, 3607, 3601, 3606, 3607, 3603, 3598, 3606,
+     3614, 3620, 3611, 3622, 1405, 1420, 3619, 3606, 3615, 3662,
+     3609, 3610, 3611, 3612, 3631, 3616, 3669, 3616, 3618, 3613,
+     1499, 3619, 3634, 3621, 3622, 1941, 3637, 3678, 3639, 3634,
+     3681,    1, 3642, 3647, 3638, 3646, 3686, 3632, 3648, 3650,
+
+     3652, 3653, 3643, 3638, 3654, 3695, 3644, 3643, 3654,    1,
+     3659, 3646, 3653,    1,    1, 3707, 3659, 3652, 3669, 2275,
+     2144, 3654,    1, 3668,    1, 3708, 3709, 3710, 3657,    1,
+     3712, 3660, 3714, 3715, 2265,    1, 3676, 3668, 3666, 3719,
+     3725, 3675, 3684, 3683, 3684, 3687, 3686, 3681,    1, 3681,
+     3685, 3690, 3692, 3692, 3687, 3682,    1, 2286, 3740, 2333,
+        1, 3692, 3697, 3698, 3699, 3701, 3686, 3693, 2056, 3697,
+     3702, 3697, 1907, 3746, 3747, 3709, 3708, 3704, 3714, 2108,
+     3693, 2242, 3758, 3716, 3760, 1459,    1, 2404, 1944, 1631,
+     3716, 2061, 1799, 1722, 2347, 3710, 2246, 2332, 1452, 2116,
+
+     2440, 3709, 2491, 3719, 2360, 2501, 2294, 2126, 2502, 2386,
+     2504, 2308, 2508, 2555, 2526, 2503, 2434, 2366, 2567, 3710,
+     3721, 3722, 3723, 3716, 2621, 2626, 1651, 2634, 3725, 3706,
+     2467, 2696, 2154,    1, 2544, 3727, 2660, 1572, 2728, 3728,
+     2754, 1889, 2719, 1696, 2542, 2763, 2342, 2211, 1524,    1,
+     2805, 2636, 2564, 3722, 2765,    1, 2640, 1846, 2698, 2857,
+     2818, 2861, 2690, 3730, 2853, 2850, 2813, 2866, 2867, 3731,
+     2860,    1, 2869, 2870, 2872, 2879, 2874, 2877, 3732, 2878,
+     2889, 2883, 2925, 2891, 2886,    1, 2892, 2894, 3733, 2921,
+     2936, 2897, 3734, 2899, 3735,    1, 3736,    1, 2898, 2900,
+
+     2901, 2911, 3737, 2904, 2906,    1, 2914, 3738, 2913, 2916,
+     2918, 2915,    1,    1, 2923, 2929, 3739, 2927, 2930, 2931,
+     3733, 2932, 2934, 2924, 2935, 2985, 2947, 2944, 2950, 3741,
+     2952, 2953, 2959, 2960, 2961, 2957, 2962, 2964, 2968, 2981,
+     2969, 2971, 3011, 2974, 3742, 3732,    1, 3018, 3744, 2976,
+     3745, 3017, 2352, 2982,    1, 2984, 2979, 2987, 2995, 2990,
+     2992, 2997, 3038, 2309, 2765, 3746, 3002, 3000,    1, 3004,
+     3001, 3007, 3008, 3014, 3025, 3015, 3747,    1, 3022,    1,
+     3028, 2112, 3016, 3748, 3029, 3031, 3035, 3033, 3749, 3750,
+     3040, 3751, 3024, 3050, 3039, 3041, 3042, 3044, 3048,    1,
+
+     3085, 3051, 3053, 3059, 3097, 3058, 3064, 3752, 3063, 3065,
+     3067, 3113, 3069, 3071, 3074, 3072, 3076, 3079, 3083, 3753,
+     3121, 3084, 3092, 3134, 3094, 3095, 3096, 3102, 3099, 3103,
+     3100, 3754, 3101, 3146, 3107, 3153,    1, 3116, 3114, 3110,
+     3151, 2558, 3155, 1251,  741, 3129, 3118, 3741, 3127, 3120,
+     3124, 3131, 3756,    1, 3125, 1875, 3751,    1, 3169, 3745,
+     3184, 2837, 3165, 3753, 3805, 3748, 3750, 3141, 3755, 3809,
+     3753,    1, 3766, 3759, 3754, 3138, 3142, 3769, 3144, 3756,
+     3150, 3811, 3151, 3764, 3813, 3774, 3815, 3778,    1, 3777,
+     3766, 3783, 3784, 3769, 3769, 3143, 3775, 3770, 3779, 3774,
+
+        1, 3832, 3788, 3789, 3781, 3791, 3788, 3779, 3785, 3794,
+     3782, 3162, 3797, 3796, 3785, 3799, 3799, 3842,    1, 3799,
+     3806, 3791, 3810, 3809, 3155, 3801, 3796, 3796, 3856, 3799,
+        1, 3858, 3165, 3799, 3158, 3819, 3812, 3810, 3806, 3812,
+     3160, 3820,    1, 3821, 3818, 3815, 3810, 3829, 3830, 3827,
+     3824, 3810, 3875, 3876, 3161, 3830, 3833, 3817, 3827, 3881,
+        1, 3882, 3830, 3213, 3218,    1, 3184, 2427, 3843,    1,
+     3826, 3827, 3887, 3830,    1, 3830, 3847, 3849, 3830, 3848,
+     3849, 3838, 3842, 3897, 3844, 3848, 3848, 3856, 3844, 3850,
+     3853, 3177, 3848, 3166, 3864, 3858, 3867, 3909, 3865, 3182,
+
+     3862, 3912, 3859,    1, 3909, 3856, 3859, 3858, 3865, 3870,
+     3869, 3921, 3881, 3872, 3870, 3178, 3880, 3926, 3886, 3923,
+     3874, 3877, 3881, 3875, 3891, 3886, 3935, 3891, 3889, 3893,
+        1, 3881,    1, 3899, 3886, 3884, 3892, 3899, 3900, 3946,
+     3902, 3907, 3891, 3893, 3906, 3216, 3947, 3895, 3895, 3955,
+     3895, 3957,    1,    1, 3899, 3959, 3917, 3956, 3921,    1,
+        1, 3922,    1, 3906, 3922,    1, 3209, 3200, 3917, 3914,
+     3968,    1, 3920, 3970, 3921, 3918, 3919, 3974, 3975, 3976,
+     3926,    1, 3978, 3930, 3975, 3938, 3933, 3924, 3935, 3944,
+     3981, 3946, 3947, 3937, 3933,    1, 3986, 3992, 3932,    1,
+
+     3952, 3952, 3991, 3938, 3949, 3940, 3946, 4001,    1, 4002,
+     3954, 3999, 3945, 3953,    1, 3964, 3950, 3952, 3951, 3966,
+     3958, 3972, 4009,    1, 3961, 3962, 3972, 3231, 3960, 4014,
+     4020, 4021, 3969, 3969,    1, 3967, 3976, 4026, 4027, 3975,
+     4029, 3978, 3982, 3987, 3988,    1, 3989,    1, 4035,    1,
+     3985, 3978, 4033, 3987, 4040, 3987, 3204, 4042, 3991, 4003,
+        1, 3987,    1, 3988, 3987, 3991,    1,    1,    1, 4049,
+        1, 4004, 3185, 3992, 3184, 4047, 4007, 3997, 3998, 3997,
+     3999, 4013, 4010, 4002,    1, 4016, 4021, 4009, 4005, 4065,
+     4014, 4022, 4015,    1,    1, 4024, 4010, 4022, 4013, 4028,
+
+     4014, 4030, 4018, 4018, 4027, 4021, 4018, 4021, 4031, 4078,
+     4026,    1, 4040, 4027,    1,    1, 4028, 4028, 4084, 4031,
+        1,    1, 4032,    1, 4038, 4049, 4036, 4037, 4096,    1,
+     4056, 4050, 4056, 4055,    1, 4048, 3218,    1, 4057, 4051,
+     4045, 4105, 4053, 4057,    1, 4063, 4064, 4061, 4106, 4067,
+     4064, 4069, 4110, 4071, 4068, 4073, 4075, 4075, 4072, 4122,
+     4064, 4071, 3197,    1, 4080, 4069, 4069, 4075, 4074, 4073,
+     4131, 3240, 4086, 4087, 4134, 4135, 4136, 4092, 4097, 4080,
+     4096, 4082, 4142, 4143, 4096, 4140, 4087, 4085, 4143, 4144,
+     4106, 4151, 4147, 4153,    1, 4105, 4098, 4108, 4157, 4112,
+
+     3216, 4115, 4115, 4116,    1, 4118, 4105, 4105, 4124, 4114,
+     4108, 4168, 4125, 4111, 3189, 4129, 4118, 3248, 4168, 4116,
+     3195,    1, 4126, 4117, 4122, 4178, 4133, 4180, 4122, 4138,
+     4138,    1, 4135,    1, 4139, 4137,    1,    1,    1, 4129,
+     4139, 4189, 4190, 4142,    1,    1, 4135, 4150, 4194, 4154,
+     4137, 4144, 4153,    1, 3195,    1, 4147, 4155, 4141,    1,
+     4153, 3219, 4198, 4204, 4152, 4206, 4207, 4159, 4151, 4165,
+     4154,    1, 4212, 4164, 4169, 4170, 4156, 4164, 4218,    1,
+     4160, 4220, 4176, 4168, 4166, 4179,    1, 4184,    1, 4221,
+     4186, 4184, 4185, 4181, 3212, 4231, 4173,    1,    1, 4181,
+
+     4189, 4184,    1, 4187, 4188, 4197, 4239, 4183, 4236, 4184,
+     4190, 3255, 4244, 4186,    1, 4203,    1,    1, 4195, 4203,
+     4249, 4201,    1, 4199, 3212, 3211, 4203, 4248,    1, 4205,
+        1, 4255, 4203, 4203, 4258, 1431, 4199, 3264, 4260, 4261,
+     3209, 4262,    1, 3268, 3271, 3236, 3238, 3228, 4211, 4212,
+        1, 3230, 3240, 4217, 3235, 2233,    1, 3240, 3230, 3248,
+     3243,    1, 3251, 3252, 4215, 3298, 4216, 3250, 3253,    1,
+     3302, 4217,    1, 3263, 3260, 3267,    1,    1, 3314,    1,
+     3266, 3268, 4225, 3269, 3316, 3277, 3279, 3286, 3280, 3281,
+     3328,    1, 3287, 3334, 3336, 3340, 3291, 3341, 3302,    1,
+
+     4226, 4227, 3300, 3295, 3347, 3352, 4228, 3354,    1, 3306,
+     3356, 3301, 3310, 3311, 3360, 3364, 3327, 3330, 3325, 3322,
+     3333,    1,    1,    1, 3375,    1, 3338, 3378, 3344, 3384,
+     3345,    1,    1, 3353,    1, 3347,    1, 3386, 3352, 3358,
+        1,    1, 3356, 3362, 4229, 3366, 3367,    1, 3372, 3376,
+     3368,    1, 3379, 3382, 3383,    1, 3385, 3386, 3387, 3395,
+     3409, 3389, 3430, 3398, 3393, 3400, 3403, 3404, 3451, 3455,
+     3412, 3414, 3417,    1, 3420, 3416, 3422, 3418, 3424, 3425,
+     3470,    1,    1, 3471, 3428, 3476, 3480, 3441, 3439, 3442,
+     3444, 4230,    1,    1, 3446,    1,    1, 3448, 3441, 3447,
+
+     3454, 3484, 3501, 3458, 3505,  815, 3461,    1,    1, 3502,
+        1, 3468, 3451, 3452, 3465, 3460, 3470, 1666, 4275, 3471,
+        1,    1, 4231, 4277,    1,  889
     } ;
 
-static const flex_int16_t yy_def[1593] =
+static const flex_int16_t yy_def[1727] =
     {   0,
-     1581, 1581, 1582, 1582, 1581, 1581, 1581, 1581, 1581, 1581,
-     1580, 1580, 1580, 1580, 1580, 1583, 1580, 1580, 1580, 1580,
-     1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580,
-     1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1584,
-     1580, 1580, 1580, 1585,   15, 1580,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1586,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1583,
-     1580, 1580, 1580, 1580, 1580, 1580, 1587, 1580, 1580, 1580,
-     1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1584, 1580,
-
-     1585, 1580, 1580,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1588,   45, 1586,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1587, 1580, 1580, 1580, 1580, 1580, 1580, 1580,
-     1580, 1589,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45, 1588, 1580, 1586,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1580,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1580, 1580, 1580, 1580, 1580, 1580,
-
-     1580, 1590,   45,   45,   45,   45,   45,   45,   45,   45,
-     1580,   45, 1580,   45, 1586, 1580,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1580,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1580,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1580,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45, 1580,   45,   45,   45,
-       45, 1580, 1580, 1580, 1591,   45,   45,   45,   45,   45,
-       45,   45,   45, 1580,   45,   45, 1580,   45, 1586,   45,
-       45,   45,   45,   45,   45,   45, 1580,   45,   45,   45,
-       45,   45,   45,   45, 1580,   45,   45,   45,   45,   45,
-     1580,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1580,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1580,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1580,   45, 1580,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1580, 1580,   45,   45,
-     1580,   45,   45, 1580, 1592,   45,   45,   45,   45, 1580,
-     1580,   45, 1580,   45, 1580,   45,   45,   45, 1580,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1580,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1580,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1580,   45,   45,   45,   45,   45,   45,   45,   45,
-     1580,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1580,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1580,   45,   45, 1580,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1580,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-     1580,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1580,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1580,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1580,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1580,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1580,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1580, 1580,   45,   45,
-
-       45,   45,   45, 1580, 1580,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1580,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1580,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1580,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1580,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1580,   45,   45,   45,   45,   45, 1580,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1580,   45,   45,
-       45, 1580,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1580,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1580,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1580,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1580,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1580,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1580,   45,
-       45,   45, 1580,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1580,   45,   45,
-       45,   45,   45,   45,   45, 1580,   45,   45,   45,   45,
-       45,   45,   45,   45, 1580, 1580,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1580, 1580,   45, 1580,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1580,   45,   45,   45,   45,
-
-     1580,   45,   45,   45,   45,   45, 1580, 1580,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1580,   45,   45,   45, 1580, 1580,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1580,   45,   45,   45,   45,   45,   45,   45,   45, 1580,
-       45,   45,   45,   45,   45,   45,   45,   45, 1580,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1580,
-       45, 1580, 1580,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1580,   45,   45,   45,   45,   45,   45,   45,
-
-     1580,   45,   45, 1580,   45, 1580, 1580,   45, 1580,   45,
-     1580,   45,   45,   45,   45,   45, 1580,   45,   45,   45,
-     1580,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1580,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1580, 1580,   45, 1580,   45,   45,   45,
-       45,   45,   45,   45, 1580,   45,   45,   45,   45,   45,
-       45, 1580,   45,   45, 1580,   45,   45,   45,   45, 1580,
-       45,   45,   45,   45,   45,   45,   45, 1580,   45, 1580,
-       45, 1580,   45, 1580,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1580,   45,
-       45,   45, 1580,   45,   45,   45,   45, 1580,   45, 1580,
-     1580,   45,   45,   45, 1580, 1580,   45,   45,   45, 1580,
-     1580,   45,   45,   45,   45,   45,   45,   45,   45, 1580,
-       45,   45, 1580,   45, 1580,   45,   45,   45,   45,   45,
-       45,   45, 1580,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1580,   45,   45,
-       45,   45,   45, 1580,   45,   45,   45,   45,   45,   45,
-
-       45, 1580,   45,   45,   45, 1580,   45, 1580,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1580,   45,   45, 1580,   45, 1580, 1580,   45, 1580,
-     1580,   45, 1580,   45,   45,   45, 1580,   45,   45, 1580,
-       45,   45,   45,   45,   45,   45, 1580,   45,   45,   45,
-     1580,   45,   45,   45,   45,   45,   45,   45,   45, 1580,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1580, 1580,   45,   45,   45,   45,   45,   45,   45,
-     1580,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1580,   45,   45,   45,   45,   45, 1580,   45, 1580, 1580,
-
-     1580,   45, 1580,   45,   45,   45,   45, 1580,   45, 1580,
-       45,   45,   45,   45, 1580,   45,   45, 1580,   45,   45,
-     1580, 1580,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1580,   45,   45,   45,   45,   45,
-     1580,   45, 1580,   45,   45,   45,   45,   45,   45, 1580,
-     1580, 1580,   45,   45,   45,   45, 1580,   45,   45, 1580,
-       45,   45,   45,   45,   45, 1580,   45,   45, 1580,    0,
-     1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580,
-     1580, 1580
-
+     1726,    1, 1726,    3, 1726,    5, 1726,    7, 1726,    9,
+     1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726,   18,   18,
+       18,   18,   18,   18,   24,   24,   24,   18,   18,   18,
+       18,   29,   30,   31,   18,   16,   17,   18,   18,   16,
+       17,   18,   18,   16,   17, 1726,   18,   18,   16,   18,
+       17,   12,   52,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   52,   53,   53,   53,
+       53,   67,   53,   67,   67,   53,   67,   53,   53,   53,
+       53,   67,   67,   67,   53, 1726,   18, 1726,   13,   18,
+     1726,   18,   16,   17,   24,   27,   28,   26,   27,   28,
+
+      100,   18,  102,   18,  104,   18,  106,   18,   18,   46,
+       18,   67,   67,   67,   53,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   53,   67,   67,   67,   53,   67,   53,
+       67,   67,   67,   53,   67,   67,   67,   53,   53,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   53,   67,   67,   67,   67,
+       67,   53,   53,   67,   67,   67,   67,   67,   53,   67,
+       67,   67, 1726, 1726,   18,   88,   18,   91,   18,  199,
+
+       18,  201,   18,  203,   18,   18,   53,   67,   53,   67,
+       67,   67,   53,   67,   67,   67,   67,   67,   67,   67,
+       53,   67,   67,   67,   53,   67,   67,   53,   67,   53,
+       53,   67,   67,   53,   53,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   18,   53,   67,   67,
+       67,   67,   53,   67,   53,   67,   53,   53,   67,   67,
+       67,   53,   67,   67,   53,   53,   67,   67,   53,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   53,   67,   67,
+
+       53,   67,   67,   67,   67,   67,   67,   53,   67,   67,
+      193,  194,  194,   18,   88,   18,   18,   18,   18,  319,
+       18,   18,   18,   67,   53,   53,   53,   53,   67,   53,
+       67,   53,   67,   67,   18,   53,   67,   53,   53,   53,
+       67,   67,   67,   53,   53,   67,   67,   67,   67,   18,
+       67,   67,   67,   67,   67,   67,   67,   18,   53,   53,
+       67,   67,   67,   18,   18,   67,   67,   53,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67, 1726,  383,  384,  384,  384,  384,  384,  384,
+      384,  384,  384,  387,  390,  384,  384,  384,  384,  387,
+
+      384,  384,  401,  384,  384,  390,  390,  384,  384,  384,
+      384,   18,  411,  384,  384,  384,  401,  384,  390,  397,
+      397,  409,  401,  415,  384,  415,  415,   18,  387,  390,
+      387,  401,  401,  387,  385,  384,  193,   18,   18,   18,
+       18,  410,  415,  416,  408,  410,  384,   18,  390,  405,
+      415,  389,  401,  387,  387,  390,  447,  387,  408,  390,
+      401,  447,  409,  389,  447,  409,  397,  410,  404,  410,
+      384,  384,  408,   18,   18,  384,  415,  387,  387,   18,
+       18,  410,  415,  447,   18,  389,  415,  384,   18,  408,
+      397,   18,  387,  408,  409,  397,  397,  411,  398,  409,
+
+      398,  436,  390,  401,  397,  387,  405,  387,  401,  397,
+      414,  385,  409,  389,  389,  397,  408,  387,  415,   18,
+      414,  387,  385,  384,  425,  384,  390,  405,  385,  397,
+      385,   18,  387,  390,  387,  390,  409,  390,  408,  408,
+      397,  387,  405,  447,  405,  408,  415,   18,   18,  390,
+      447,  425,  389,  398,  447,  401,  401,  415,  425,  447,
+      398,  385,  405,  385,  193,   18,   18,  389,  405,  390,
+      389,  389,  389,  389,  385,  387,  390,  389,  408,  414,
+      405,  389,  384,  389,  389,  384,  384,  390,  384,  405,
+      390,   18,  384,  385,  405,  409,  390,  425,  384,  409,
+
+      410,  410,  415,  425,  384,  390,  387,  389,  401,   18,
+      384,  389,  447,   18,   18,  397,  401,  387,  385,  415,
+      387,  387,   18,  409,   18,  390,  390,  390,  389,   18,
+      390,  408,  390,  390,  397,   18,  384,  415,  387,  390,
+      397,  405,  410,  384,  384,  410,  384,  405,   18,  586,
+      401,  384,  409,  384,  405,  387,   18,  384,  397,  390,
+       18,  401,  384,  384,  384,  409,  425,  415,  384,  405,
+      416,  447,  397,  390,  390,  409,  398,  405,  418,  391,
+      414,  393,  397,  410,  397,   18,   18,  397,  398,  409,
+      471,  401,  402,  404,  404,  586,  410,  408,  408,  409,
+
+      410,  415,  414,  471,  415,  416,  418,  418,  425,  425,
+      425,  425,  425,  425,  425,  436,  436,  436,  436,  436,
+      471,  471,  471,  447,  436,  447,  447,  447,  471,  526,
+      447,  471,  471,   18,  471,  471,  471,  471,  471,  471,
+      471,  471,  471,  471,  471,  471,  471,  471,  471,   18,
+      471,  471,  471,  586,  471,   18,  471,  472,  476,  476,
+      488,  488,  488,  488,  488,  488,  488,  488,  488,  524,
+      524,   18,  524,  524,  524,  524,  524,  524,  524,  524,
+      524,  524,  524,  524,  524,   18,  524,  524,  524,  524,
+      524,  524,  524,  524,  524,   18,  524,   88,  524,  524,
+
+      524,  524,  524,  524,  524,   18,  524,  583,  526,  583,
+      583,  583,   18,   18,  583,  583,  583,  583,  583,  583,
+      586,  583,  583,  583,  583,  583,  583,  583,  583,  583,
+      583,  583,  583,  583,  583,  583,  583,  583,  583,  583,
+      583,  583,  583,  583,  583,  658,   18,  583,  583,  583,
+      583,  583,  583,  583,   18,  583,  583,  583,  583,  583,
+      583,  583,  583,  583,  586,  587,  586,  587,   18,  589,
+      589,  593,  593,  593,  599,  599,  599,   18,  599,   18,
+      599,  599,  605,  605,  605,  605,  605,  605,  611,  611,
+      611,  611,  611,  637,  637,  637,  637,  637,  637,   18,
+
+      637,  637,  637,  637,  637,  637,  637,  637,  637,  637,
+      637,  637,  637,  637,  644,  644,  644,  644,  644,  644,
+      644,  645,  647,  647,  652,  652,  652,  652,  654,  654,
+      658,  663,  658,  663,  663,  663,   18,  663,  664,  665,
+      669,  669,  669,  669, 1726,  945,  945,  947,  945,  945,
+      945,  945,  949,   18,  945,  945,  945,   18,  945,  955,
+      955,  945,  949,  945,  956,  955,  951,  945,  950,  956,
+      951,   18,  949,  950,  947,  945,  945,  949,  945,  947,
+      945,  959,  945,  950,  959,  949,  959,  979,   18,  949,
+      951,  946,  946,  951,  955,  945,  950,  947,  945,  951,
+
+       18,  956,  949,  949,  952,  949,  983,  947,  952,  981,
+      947,  950,  949,  968,  947,  981,  968,  959,   18,  983,
+      979,  947,  946,  979,  945,  976,  955,  947,  956,  955,
+       18,  956,  945,  996,  945,  946,  983,  976,  951,  976,
+      945,  949,   18,  949,  983,  950,  947,  946,  946,  949,
+      983, 1025,  956,  956,  945,  968,  949, 1041,  950,  956,
+       18,  956,  950,  949,  956,   18,  951,  950,  946,   18,
+      947,  947,  956,  955,   18,  947,  979, 1033, 1041,  949,
+      949,  951,  952,  956,  952,  945,  976,  949,  955,  950,
+      945,  945,  951,  945, 1033,  983,  946,  956,  949,  945,
+
+      983,  956,  952,   18,  959,  947,  951,  947,  950,  983,
+      945,  956,  946,  945,  952,  945,  949,  956,  946,  959,
+      977,  950, 1035,  951, 1033, 1092,  956,  949, 1092,  949,
+       18,  955,   18,  946,  977,  955,  945,  949,  949,  956,
+      949,  946,  955,  951,  949,  955,  959,  955,  947,  956,
+     1094,  956,   18,   18,  947,  956,  979,  959,  946,   18,
+       18,  946,   18,  955,  979,   18,  949,  947,  983,  950,
+      956,   18,  983,  956, 1035,  952,  952,  956,  956,  956,
+      945,   18,  956,  983,  959,  979,  983,  947,  983,  946,
+      959,  946,  946,  976,  951,   18,  959,  956, 1094,   18,
+
+     1033,  979,  959,  947,  983,  947,  952,  956,   18,  956,
+      983,  959,  996,  950,   18,  979,  955,  951,  947,  949,
+      952,  946,  959,   18,  952,  952,  949,  949,  955,  959,
+      956,  956,  950,  952,   18,  951,  983,  956,  956,  969,
+      965,  976,  983,  973,  973,   18,  973,   18,  965,   18,
+      999,  975,  982,  976,  970, 1005,  995, 1002,  976,  992,
+       18,  995,   18,  995,  996,  991,   18,   18,   18, 1002,
+       18,  981,  998,  998,  984,  985, 1010,  991,  991,  998,
+      995, 1003, 1007,  995,   18, 1003, 1023, 1005,  998, 1002,
+     1026, 1003, 1046,   18,   18, 1004, 1034, 1007, 1008, 1013,
+
+     1034, 1013, 1027, 1015, 1086, 1027, 1041, 1034, 1086, 1018,
+     1027,   18, 1042, 1022,   18,   18, 1028, 1034, 1105, 1028,
+       18,   18, 1028,   18, 1083, 1100, 1030, 1074, 1053,   18,
+     1036, 1092, 1077, 1042,   18, 1046, 1042,   18, 1042, 1087,
+     1047, 1053, 1046, 1123,   18, 1050, 1050, 1051, 1105, 1057,
+     1096, 1057, 1105, 1057, 1096, 1057, 1100, 1080, 1096, 1062,
+     1071, 1090, 1069,   18, 1080, 1082, 1074, 1090, 1121, 1082,
+     1084, 1084, 1272, 1272, 1084, 1084, 1084, 1088, 1097, 1106,
+     1100, 1106, 1098, 1098, 1092, 1105, 1106, 1307, 1105, 1105,
+     1100, 1098, 1105, 1098,   18, 1101, 1107, 1126, 1102, 1272,
+
+     1109, 1326, 1117, 1117,   18, 1326, 1132, 1149, 1113, 1194,
+     1149, 1118, 1326, 1149, 1124, 1125, 1176, 1127, 1147, 1132,
+     1124,   18, 1169, 1149, 1135, 1140, 1272, 1140, 1149, 1326,
+     1138,   18, 1169,   18, 1272, 1169,   18,   18,   18, 1143,
+     1169, 1150, 1150, 1169,   18,   18, 1144, 1157, 1150, 1159,
+     1149, 1170, 1220,   18, 1151,   18, 1194, 1220, 1213,   18,
+     1169, 1168, 1185, 1171, 1170, 1171, 1171, 1169, 1217, 1220,
+     1195,   18, 1174, 1184, 1220, 1220, 1213, 1214, 1179,   18,
+     1188, 1183, 1220, 1207, 1195, 1220,   18, 1190,   18, 1191,
+     1190, 1326, 1326, 1205, 1193, 1198, 1204,   18,   18, 1242,
+
+     1220, 1251,   18, 1205, 1205, 1222, 1208, 1218, 1212, 1217,
+     1214, 1210, 1231, 1219,   18, 1216,   18,   18, 1242, 1220,
+     1231, 1237,   18, 1242, 1220, 1221, 1237, 1223,   18, 1237,
+       18, 1231, 1233, 1234, 1231, 1230, 1265, 1232, 1238, 1238,
+     1236, 1238,   18, 1238, 1239, 1242, 1242, 1242, 1254, 1254,
+       18, 1251, 1251, 1332, 1251, 1254,   18, 1254, 1254, 1259,
+     1259,   18, 1259, 1259, 1305, 1265, 1305, 1265, 1265,   18,
+     1272, 1305,   18, 1272, 1305, 1305,   18,   18, 1305,   18,
+     1305, 1305, 1326, 1305, 1305, 1305, 1305, 1305, 1305, 1305,
+     1305,   18, 1305, 1305, 1305, 1305, 1305, 1305, 1305,   18,
+
+     1326, 1326, 1305, 1305, 1305, 1305, 1326, 1305,   18, 1305,
+     1307, 1307, 1309, 1309, 1326, 1326, 1326, 1326, 1326, 1326,
+     1326,   18,   18,   18, 1326,   18, 1326, 1326, 1326, 1332,
+     1332,   18,   18, 1332,   18, 1332,   18, 1332, 1357, 1357,
+       18,   18, 1357, 1357, 1357, 1357, 1357,   18, 1357, 1357,
+     1357,   18, 1357, 1357, 1357,   18, 1357, 1357, 1357, 1357,
+     1357, 1357, 1357, 1357, 1357, 1381, 1381, 1381, 1381, 1381,
+     1381, 1381, 1381,   18, 1381, 1381, 1381, 1381, 1381, 1381,
+     1381,   18,   18, 1381, 1381, 1381, 1381, 1381, 1381, 1381,
+     1381, 1391,   18,   18, 1385,   18,   18, 1385, 1385, 1391,
+
+     1391, 1391, 1391, 1391, 1391, 1726, 1706,   18,   18, 1706,
+       18, 1706, 1706, 1706, 1706, 1706, 1706, 1706, 1718, 1706,
+       18,   18, 1707, 1718,   18,    0
     } ;
 
-static const flex_int16_t yy_nxt[2055] =
+static const flex_int16_t yy_nxt[4351] =
     {   0,
-     1580,   13,   14,   13, 1580,   15,   16,  818,   17,   18,
-       19,   20,   21,   22,   22,   22,   22,   22,   23,   24,
-       86,  711,   37,   14,   37,   87,   25,   26,   38,  102,
-     1580,   27,   37,   14,   37,   42,   28,   42,   38,   92,
-       93,   29,  198,   30,   13,   14,   13,   91,   92,   25,
-       31,   93,   13,   14,   13,   13,   14,   13,   32,   40,
-      712,   13,   14,   13,   33,   40,  103,   92,   93,  198,
-       91,   34,   35,   13,   14,   13,   95,   15,   16,   96,
-       17,   18,   19,   20,   21,   22,   22,   22,   22,   22,
-       23,   24,   13,   14,   13,   91,   39,  105,   25,   26,
-
-       13,   14,   13,   27,   39,   42,  108,   42,   28,   42,
-      109,   42,   41,   29,  111,   30,  114,  115,   94,  140,
-       41,   25,   31,  105,  222,  223,   89,  141,   89,  108,
-       32,   90,   90,   90,   90,   90,   33,  111,  109,  114,
-      228,  115,  229,   34,   35,   44,   44,   44,   45,   45,
-       46,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   47,   45,   45,   45,   45,   45,   48,   45,   49,
-       50,   45,   51,   45,   52,   53,   54,   45,   45,   45,
-       45,   55,   56,   45,   57,   45,   45,   58,   45,   45,
-       59,   60,   61,   62,   63,   64,   65,   66,   67,   52,
-
-       68,   69,   70,   71,   72,   73,   74,   75,   76,   77,
-       78,   79,   57,   45,   45,   45,   45,   45,   81,  819,
-       82,   82,   82,   82,   82,   81,  105,   84,   84,   84,
-       84,   84,  108,   83,   85,   85,   85,   85,   85,   81,
-       83,   84,   84,   84,   84,   84,  184,   83,  260,  261,
-      112,  123,  119,  134,   83,  108,   83,  186,  120,  124,
-      113,  121,  125,   83,  135,  126,  137,  127,  138,  128,
-       83,  142,  184,  112,  136,  139,  162,   83,   45,  185,
-      163,  143,  820,  144,   45,  186,   45,   45,  113,   45,
-      164,   45,   45,   45,  416,  117,  146,  147,   45,   45,
-
-      148,   45,   45,  186,  417,  185,  149,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-      129,  189,   45,  738,  130,  150,   45,  131,  132,  151,
-       45,  111,  166,  152,  739,  184,  167,  102,   45,  114,
-      133,  194,   45,  157,   45,  118,  201,  174,  175,  153,
-      154,  158,  155,  159,  156,  185,  168,  112,  160,  161,
-      169,  187,  179,  170,  247,  277,  278,  113,  248,  194,
-      171,  172,  180,  201,  103,  204,  173,  181,  691,  692,
-      176,  188,  177,   85,   85,   85,   85,   85,   81,  200,
-
-       82,   82,   82,   82,   82,  113,   83,  202,  204,   89,
-      821,   89,  178,   83,   90,   90,   90,   90,   90,   81,
-      203,   84,   84,   84,   84,   84,  101,  200,  505,   83,
-      197,  194,  506,  101,   83,  202,   83,   85,   85,   85,
-       85,   85,   90,   90,   90,   90,   90,  203,  208,  231,
-       83,   90,   90,   90,   90,   90,  197,   83,  279,  209,
-      216,  235,  280,  101,  236,  232,  281,  101,  237,  217,
-      218,  101,  263,   83,  200,  264,  265,  296,  201,  101,
-      268,  203,  295,  101,  297,  101,  192,  207,  207,  207,
-      207,  207,  296,  822,  409,  823,  207,  207,  207,  207,
-
-      207,  207,  200,  296,  254,  288,  295,  297,  291,  297,
-      295,  307,  304,  308,  310,  269,  270,  271,  299,  207,
-      207,  207,  207,  207,  207,  312,  272,  314,  273,  304,
-      274,  275,  300,  276,  298,  304,  326,  310,  395,  307,
-      308,  358,  385,  370,  327,  386,  410,  824,  312,  328,
-      329,  396,  317,  412,  314,  315,  315,  315,  315,  315,
-      412,  423,  825,  826,  315,  315,  315,  315,  315,  315,
-      311,  418,  420,  421,  426,  404,  412,  827,  442,  371,
-      418,  422,  510,  413,  423,  496,  511,  315,  315,  315,
-      315,  315,  315,  372,  359,  443,  462,  360,  484,  538,
-
-      418,  463,  426,  429,  429,  429,  429,  429,  485,  430,
-      754,  828,  429,  429,  429,  429,  429,  429,  448,  525,
-      475,  476,  526,  531,  449,  477,  829,  538,  532,  546,
-      652,  547,  564,  754,  830,  429,  429,  429,  429,  429,
-      429,  763,  764,  497,  765,  565,  538,  566,  574,  464,
-      653,  753,  801,  575,  465,  802,  546,  652,  547,   45,
-       45,   45,   45,   45,  831,  832,  833,  836,   45,   45,
-       45,   45,   45,   45,  548,  648,  760,  834,  653,  753,
-      654,  841,  761,  842,  835,  845,  846,  847,  848,  837,
-      838,   45,   45,   45,   45,   45,   45,  839,  843,  849,
-
-      850,  840,  851,  852,  844,  853,  854,  855,  856,  857,
-      858,  859,  860,  861,  862,  863,  864,  865,  866,  867,
-      868,  869,  870,  871,  872,  873,  874,  875,  876,  877,
-      878,  879,  880,  881,  882,  883,  884,  885,  886,  859,
-      887,  888,  889,  890,  891,  893,  894,  895,  896,  892,
-      897,  898,  899,  900,  901,  902,  903,  904,  905,  906,
-      907,  908,  909,  910,  911,  913,  914,  915,  912,  916,
-      917,  918,  919,  920,  921,  922,  923,  924,  925,  926,
-      927,  928,  929,  930,  931,  932,  933,  934,  935,  936,
-      937,  938,  939,  940,  941,  942,  943,  944,  945,  946,
-
-      947,  948,  949,  950,  951,  952,  953,  954,  955,  956,
-      957,  958,  959,  960,  961,  962,  963,  964,  965,  966,
-      967,  968,  969,  970,  971,  972,  973,  974,  975,  976,
-      977,  978,  979,  957,  980,  981,  956,  982,  983,  984,
-      985,  986,  987,  988,  989,  990,  991,  993,  994,  995,
-      996,  997,  998,  999, 1000, 1001, 1002, 1003, 1004, 1005,
-     1006, 1007, 1008, 1009, 1010, 1011, 1012, 1014, 1015, 1016,
-     1017, 1018, 1019, 1020, 1021, 1022, 1023, 1013, 1024, 1025,
-     1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035,
-     1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045,
-
-     1046, 1047, 1048, 1049,  992, 1050, 1052, 1051, 1053, 1054,
-     1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064,
-     1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074,
-     1075, 1076, 1077, 1050, 1051, 1078, 1079, 1080, 1081, 1082,
-     1083, 1085, 1087, 1088, 1089, 1084, 1090, 1091, 1092, 1093,
-     1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
-     1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113,
-     1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123,
-     1124, 1125, 1126, 1127, 1128, 1086, 1129, 1130, 1131, 1132,
-     1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142,
-
+       11,   35,   16,   17,   16,   35,   12,   13,   35,   26,
+       22,   24,   27,   14,   25,   25,   25,   25,   25,   23,
+       15,   35,   35,   35,   35,   35,   35,   28,   33,   35,
+       35,   35,   35,   34,   35,   35,   35,   35,   32,   35,
+       35,   35,   35,   18,   35,   19,   35,   35,   35,   35,
+       35,   28,   30,   35,   35,   35,   35,   35,   35,   31,
+       35,   35,   35,   35,   35,   29,   35,   35,   35,   35,
+       35,   35,   20,   21,   11,   39,   36,   37,   36,   39,
+       39,   39,   38,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   11,   42,
+       40,   41,   40,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+
+       42,   42,   42,   43,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   11,   47,   44,   45,   44,   47,   46,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   11,   48,   49,   51,
+
+       49,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   50,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       11,   88,   88,   88,   83,   83,   87,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   81,   83,   83,
+       83,   83,   83,   75,   63,   80,   62,   83,   72,   83,
+
+       83,   60,   78,   69,   83,   83,   83,   83,   59,   58,
+       83,   66,   83,   83,   86,   83,   83,   74,   64,   52,
+       76,   55,   67,   84,   73,   65,   85,   53,   71,   70,
+       79,   61,   82,   54,   68,   56,   57,   77,   66,   83,
+       83,   83,   83,   83,   11,  194,  194,  194,  194,  194,
+      192,  194,  194,  194,  194,  194,  194,  191,  194,  194,
+      194,  194,  194,  194,  194,  194,  194,  194,  194,  194,
+      194,  194,  194,  194,  194,  194,  194,  194,  194,  194,
+      194,  194,  194,  194,  194,  194,  194,  194,  191,  194,
+      194,  194,  191,  194,  194,  194,  191,  194,  194,  194,
+
+      194,  194,  194,  191,  194,  194,  194,  191,  194,  191,
+      193,  194,  194,  194,  194,  194,  194,  194,   11,  196,
+      196,  196,  196,  196,  195,  196,  196,  196,  196,  196,
+      196,  196,  196,  196,  196,  196,  196,  196,  196,  196,
+      196,  196,  196,  196,  196,  196,  196,  196,  196,  196,
+      196,  196,  196,  196,  196,  196,  196,  196,  196,  196,
+      196,  196,  197,  196,  196,  196,  196,  196,  196,  196,
+      196,  196,  196,  196,  196,  196,  196,  196,  196,  196,
+      196,  196,  196,  196,  196,  196,  196,  196,  196,  196,
+      196,  196,   11,  312,  312,  312,  312,  312,  312,  312,
+
+      312,  312,  312,  312,  312,  312,  311,  311,  311,  311,
+      311,  312,  312,  312,  312,  311,  311,  311,  311,  311,
+      311,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  311,
+      311,  311,  311,  311,  311,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,   11,   88,   88,   88,
+       83,   83,   87,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,  505,   83,   83,   83,   83,   83,   83,
+
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       86,   83,   83,   83,   83,   83,   83,  505,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       11,   88,   88,   88,   83,   83,   87,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   86,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83, 1051,   83,   83,
+
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   11,   88,   88,   88,   83,   83,
+       87,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   86,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83, 1712,   83,   83,   83,   83,   83,   83, 1726, 1726,
+     1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726,
+
+     1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726,
+     1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726,
+     1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726,
+     1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726,
+     1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726,
+     1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726,
+     1726, 1726,   11,   89,   89,   11,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   11,  198,  198,  102,
+      198,  198,  198,  198,  198,  198,  198,  198,  198,  198,
+      198,  198,  198,  198,  198,  198,  198,  198,  198,  198,
+      198,  198,  198,  198,  198,  198,  198,  198,  198,  198,
+      198,  198,  198,  198,  198,  198,  198,  198,  198,  198,
+      198,  198,  198,  198,  198,  198,  198,  198,  198,  198,
+      198,  198,  198,  198,  198,  198,  198,  198,  198,  198,
+
+      198,  198,  198,  198,  198,  198,  198,  198,  198,  198,
+       11,  110,  110,   11,  110,  110,   94,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,   11, 1726,  105, 1726,  313,  313,
+      314,  313,  313,  313,  313,  313,  313,  313,  313,  313,
+
+      313,  313,  313,  313,  313,  313,  313,  313,  313,  313,
+      313,  313,  313,  313,  313,  313,  313,  313,  313,  313,
+      313,  313,  313,  313,  313,  313,  313,  313,  313,  313,
+      313,  313,  313,  313,  313,  313,  313,  313,  313,  313,
+      313,  313,  313,  313,  313,  313,  313,  313,  313,  313,
+      313,  313,  313,  313,  313,  313,  313,  313,   83,   98,
+       98,   98,   98,   98,   83,   83,   83,   83,   83,   83,
+      525,  524,   83,   83,   83,  523,  146,   83,   83,   83,
+       83,   83,   83,   83,  521,  147,   83,  145,  113,   83,
+       83,   83,   83,   83,   83,   83,  116,   83,  115,   83,
+
+       83,  112,   83,  117,   83,  114,   83,   83,   83,   83,
+      437,  437,  437,  437,  437, 1050,   83,   83,   83,  437,
+      437,  437,  437,  437,  437,  438,  438,  438,  438,  438,
+      509,   83,  519,  529,  438,  438,  438,  438,  438,  438,
+       83,  518,  246,  437,  437,  437,  437,  437,  437, 1726,
+       83,   99,   99,   99,   99,   99,  248,  247,  438,  438,
+      438,  438,  438,  438,  565,  565,  565,  565,  565,  107,
+       83,   83,   83,  565,  565,  565,  565,  565,  565,  566,
+      566,  566,  566,  566,  237,  538,   11,   83,  566,  566,
+      566,  566,  566,  566,   83,   83,   83,  565,  565,  565,
+
+      565,  565,  565,   83,  283,   83,   83,  284,   92,  231,
+      236,  282,  566,  566,  566,  566,  566,  566,  685,  685,
+      685,  685,  685,  645,   83,   83,   83,  685,  685,  685,
+      685,  685,  685,  686,  686,  686,  686,  686,  237,  105,
+      512,   83,  686,  686,  686,  686,  686,  686,   83,   83,
+       83,  685,  685,  685,  685,  685,  685,  813,   83,   83,
+       83,  462,  235,  104,  237,  463,  686,  686,  686,  686,
+      686,  686,  798,  798,  798,  798,  798,  130,  131, 1574,
+       83,  798,  798,  798,  798,  798,  798,  132,   83,   83,
+      223,  142,   83,  315,  202,  539,  157,   83,  127,   11,
+
+      315,   93,   83,   93,   83,  798,  798,  798,  798,  798,
+      798,  129,  143,  133,   83,   83,  160,   83,  159,  201,
+      158,   83,   83,  539,   83,  127,  224,  225,  222,  161,
+       83,  315,  128,   83,   83,  315,  226,  143,  221,  315,
+      227,  220,   83,  228,  511,  507,  315,  703,  701,   83,
+      315,  520,  315,  316,   96,  702,   95,   95,   95,   95,
+       95,  135,   83,   11,   83,   83,  120,  121,   83,   97,
+      119,   90,   83,  166,   83,  118,   91,   83,  132,   83,
+       83,  167,  867,  138,  526,  136,   83,   83,  868,  127,
+       83,  102,  107,   97,  137,   83,   83,   83,   83,  134,
+
+      616,   83,  132,  199,   83,   83,   83,  153,   83,  852,
+      138,  151,   83,   83,  154,   83,  127,  426,  103,  106,
+      155,  152,   83,   83,  182,  150,  156,   83,  616,   83,
+      199,  184,   83,  181,   83,  100,  852,  100,  180,  183,
+      101,  101,  101,  101,  101,  124,  242,   83,   83,  150,
+       83,   83,   83,   83,  424,  126,   83,   83,   83,  149,
+      317,  169,   83,   83,   83,  125,   83,  425,   83,  541,
+      177, 1721,  242,  320,  173,   83,   83,  175,  174,  801,
+      802,  135,  803,   83,  317,  620,  170,  621,   83,  176,
+       83,  325,  171,  168,   83,  172,  148,  842,  327,   83,
+
+      319,  536,   83,  326,  324,  135,   83,   83,  204,   83,
+       83,  620,  162,  621,  841,   83,  163,   83,   83,   83,
+      164,  148,   83,   83,   83,   83,   83,   83,  400,  209,
+       83,   83,   83,  203,   83,  165,   83,  208,  207,  250,
+       83,  272,  249,  251,  492,   83,   83,   83,   83,  490,
+      861,  261,   83,   83,  169,   83,  862,   83,   83,  264,
+       83,   83,  542,  263,   83,  157,  260,  265,  272,   83,
+      273,  496,  497,   83,   83,  807,  527,   83,  123,  169,
+      495,  401,  122,   83,  399,   83,   83,  143,   83,  157,
+       83,   83,  139,   83,   83,   83,  141,   83,   83,   83,
+
+       83,   83,  491,  245,  806,  140,   83,   83,   83,   83,
+      234,   83,  143,  666,   83,   83,  254,  144,   83,  242,
+       83,   83,  259,   83,   83,  667,   83,  668,   83,  245,
+       83,   83,  272,   83,  268,  267,  564,  234,   83,   83,
+       83,   83,  254,   83,   83,  243,  259,   83,   83,   83,
+       83,  355,   83,  358,  363,   83,  278,   83,  357,  272,
+      277,  287,  287,   83,   83,   83,   83,   83,   83,  481,
+       83,  530,  573,  367,  482,  355,   83,   83,  288,   83,
+     1061,   83,  292,  293,   83,   83,   83,   83,  287,  289,
+       83,   83,   83,   83,   83,  380,   83,   83,  440,  367,
+
+       83,   83,  875,  543,   83,  876,  362,  383,  394,   83,
+       83,   83,  786,  321,   83,   83,   83,   83,  385,   83,
+       83,  380,  439,   83,  498,  476,   83,   83,  477,   83,
+      384,   83,  394,   83,  383,   83,   83,   83,  322,   83,
+       83,   83,  857,  856,  553,   83,   83,   83,   83,  858,
+       83,  498,  785,  859,  800,  179,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,  185,   83,  186,  188,  190,
+       83,   83,   83,   83,  189,   83,   83,   83,   83,  213,
+      187,   83,   83,  545,   83,   83,   83,   83,   83,  210,
+       83,   83,  212,   83,   83,   83,  238,  211,  708,   83,
+
+       83,   83,  537,   83,  239,   83,  214,  216,   83,   83,
+      217,   83,   83,   83,  219,   83,   83,   83,  232,   83,
+      233,   83,   83,  506,  230,   83,  229,   83,   83,  241,
+       83,  256,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,  108,   83,   83,  255,   83,  257,   83,   83,   83,
+       83,   83,   83,  516,  240,   83,  546,   83,   83,   83,
+      253,  262,  547,   83,   83,  252,  244,   83,   83,   83,
+       83,  805,   83,  781,  532,   83,   83,   83,   83,  533,
+      516,   83,   83,  270,   83,   83,  262,   83,   83,  271,
+      258,   83,   83,   83,   83,  285,  460,   83,   83,   83,
+
+       83,  560,   83,   83,   83,  275,   83,   83,   83,  274,
+      559,   83,   83,  109,   83,   83,   83,  989,   83,  279,
+      276,  814,  988,   83,   83,   83,   83,  531,  280,   83,
+      659,   83,  534,   83,   83,   83,  822,  623,   83,  651,
+      281,   83,  622,   83,   83,   83,   83,  286,   83,   83,
+      652,  290,   83,   83,  659,  295,  291,  659,   83,   83,
+       83,   83,   83,   83,  296,   83,  294,   83,   83,   83,
+       83,   83,  793,   83,  299,   83,   83,   83,   83,  739,
+       83,  660,  111,   83,  302,  297,   83,   83,  300,  303,
+       83,  306,   83,   83,  301,   83,   83,  657,   83,   83,
+
+       83,   83,  658,   83,   83,   83,  739,  305,   83,   83,
+      332,  308,   83,   83,  329,   83,   83,  848,   83,   83,
+       83,  309,   83,   83,   83,   83,   83,   83,   83,  331,
+       83,  335,   83,   83,   83,   83,  328,   83, 1592,  330,
+      333,   83,   83,   83,   83,  334,   83,  310,   83,   83,
+       83,  339,   83,   83,   83,   83,   83,   83,  336,   83,
+       83,   83,   83,   83,  341,   83,  337,   83,   83,  866,
+      750,   83,   83,   83,  338,   83,   83,   83,   83,   83,
+      346,  751,   83,   83,  350,   83,  344,   83,  342,   83,
+       83,  343,   83,   83,  810,   83,  353,   83,  340,   83,
+
+      811,   83,  345,  349,   83,   83,  795,   83,  738,   83,
+       83,   83,   83,  358,   83,   83,   83,   83,   83,  351,
+      364,  352,   83,  356,   83,   83,   83,   83,  365,   83,
+       83,   83,   83,   83,  738,   83,   83,   83,  772,   83,
+       83,   83,  812,  773,   83,   83,   83,  771,  821,   83,
+       83,   83,  865,  359,   83,   83,   83,   83,  361,   83,
+      360,   83,  973,   83,   83,   83,  368,   83,   83,   83,
+      819,   83,  369,   83,   83,   83,   83,  826,   83,   83,
+      379,   83,   83,   83,   83,   83,  371,   83,  963,   83,
+      387,   83,   83,  373,   83,   83,   83,   83,   83,   83,
+
+       83,   83,   83,   83,  374,  200,   83,   83,   83,   87,
+       83,  808,  375,   83,  799,  963,   83,   83,  377,   83,
+       83,   83,  388,  381,   83,   83,   83,   83,  386,  382,
+       83,  832,   83,   83,  396,   83,  389,   83,  390,   83,
+       83,   83,   83,  391,  831,   83,   83,   83,   83,   83,
+      824,   83,  397,   83,  392,   83,   83,   83,   83, 1168,
+      393,   83,   83,   83,   83,   83,  398,  404,   83,  403,
+       83,   83,   83,   83,   83,  402,   83,   83,   83,   83,
+       83,   83,  395,   83,   83, 1168,  815,  412,   83,   83,
+       83,   83,   83,   83,   83,   83,  405,   83,   83,   83,
+
+       83,  422,   83,   83,   83,  407,   83,  406,   83,  408,
+       83,  820,   83,   83,   83,   83,   83,   83,   83,   83,
+      410,  415,  420,  428,   83,   83,   83,   83,   83,   83,
+      846,  419,   83,   83,   83,  416,  427,   83,   83,   83,
+       83,   83,   83,  432,  817,  423,   83,  434,   83,   83,
+      823,   83,  825,   83,   83,   83,   83,  830,   83,   83,
+       83,   83,   83,   83,   83,  828,   83,   83,   83,   83,
+       83,   83,  827,   83,   83,   83,   83,  429,   83,   83,
+       83,  430,  452,  442,  431,  448,   83,  435,   83,   83,
+      829,   83,   83,   83,   83,  436,   83,   83,   83,  443,
+
+      849,  444,   83,   83,   83,   83,   83,  445, 1048,  446,
+       83,  863,   83,   83,   83,  447,   83,   83,   83,   83,
+       83,  449,   83,  833,   83,   83,   83,   83,  871,   83,
+       83,   83,  451,  454,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,  456,   83,   83,   83,   83,  450,  457,
+      202,   83,   83,   83,   83,  459,   83,  464,   83,  458,
+      453,   83,   83,  474,   83,   83,   83,   83,   83,   83,
+      470,   83,   83,   83,  466,  840,  465,   83,  475,  480,
+       83,   83,   83,  843,   83,  839,   83,   83,   83,   83,
+       83,   83,   83,   83,  874,   83,   83,   83,  870,   83,
+
+      467,  847,  204,   83,   83,  469,   83,   83,  851,  471,
+       83,  473,   83,   83,   83,   83,   83,  478,   83,   83,
+       83,   83,   83,  479,   83,   83,   83,   83,  483,   83,
+       83,  484,   83,  485,  486,   83,   83,   83,   83,  489,
+       83,   83,   83,   83,  881,  499,   83,   83,   83,  502,
+       83,  205,  504,   83,  853,   83,   83,   83,  487,  855,
+       83,   83,   83,  877,   83,   83,   83,  860,   83,   83,
+       83,  488,  493,  494,   83,   83,   83,   83,  853,   83,
+       83,   83,  500,   83,   83,   83,  178,   83,   83,   83,
+       83,   83,   83,  501,   83,   83,   83,   83,   83,  503,
+
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+      869,  864,   83,   83,   83,   83,  873,   83,   83,  974,
+       83,  218,   83,   83,  266,  269,   83,   83,  215,   83,
+      307,   83,   83,   83,   83,   83,  347,  298,   83,  304,
+       83,   83,   83,   83,  354,  376,   83,  366,  348,   83,
+      370,  206,   83,  411,   83,   83,  411,   83,   83,  885,
+       83,   83,  878,   83,   83,   83,  880,   83,   83,  376,
+       83, 1067,   83,  378,  879,  372,  409,  411,   83,   83,
+      413,   83,  414,   83,   83,   83,   83,   83,  418,  893,
+       83,  421,   83,   83,   83,  417,  455, 1067,   83,  898,
+
+       83,   83,  461,   83,  433,  468,   83,   83,   83,  883,
+       83,   83,   83,  884,  886,   83,   83,   83,  472,   83,
+       83,  887,   83,  894,   83,  889,  897,   83,   83,   83,
+      900,  906,  890,   83,  891,  895,   83,  899,  892,   83,
+      901,   83,   83,  904,   83,  902,  907,   83,   83,   83,
+       83,   83,  903,  910,   83,  908,   83,  916,  913,  922,
+      915,   83,  918,  914,   83,   83,   83,  924,   83,  925,
+      919,   83,  923,   83,   83,   83,  920,   83,  930,   83,
+       83,   83,   83,   83,   83,   83,   83,  926,  927,  929,
+      937,  951,  939,  935,   83,  931,  933,   83,  934,  936,
+
+       83,  938,   83,   83,  940,  944,  945,   83,  942,   83,
+       83,   83,   83,  943,   83,  947,  954,  946,   83,   83,
+      948,   83,  950,  958,   83,  952,   83,  962,  949,   83,
+      964,   83,   83,  953,   83,   83,  955,   83,  966,  960,
+       83,  968,   83,  972,  965,   83,  967,   83,  976,  969,
+       83,   83,  970,  980,   83, 1001,  971,   83,   83,   83,
+      979,   83,  981,  982,   83,   83,   83,   83,   83,  977,
+      978,  983,   83,  984,   83,   83,  986,  987,   83,   83,
+      990,   83,  994,   83, 1000,   83,  998,  993,   83,   83,
+       83,   83,   83,  992,   83, 1007,  995, 1004,   83, 1006,
+
+       83,   83, 1002,   83, 1005, 1011, 1003, 1012,   83, 1010,
+     1014, 1008, 1009,   83,   83,   83, 1018,   83, 1019,   83,
+     1013,   83,   83, 1017,   83, 1016,   83, 1025, 1020,   83,
+     1021, 1028, 1022,   83,   83,   83, 1023, 1026, 1030, 1031,
+     1024, 1033,   83, 1032,   83,   83,   83,   83, 1029,   83,
+     1035, 1034,   83,   83, 1038, 1040, 1041,   83, 1043, 1037,
+       83,   83,   83,   83,   83, 1036,   83, 1042,   83, 1046,
+     1045,   83,   83, 1044,   83, 1052,   83, 1055, 1056, 1063,
+       83,   83, 1053,   83,   83,   83, 1057,   83, 1060, 1066,
+     1058, 1068, 1083, 1073,   83, 1080,   83,   83,   83,   83,
+
+       83, 1085, 1081,   83, 1049, 1087,   83,   83, 1099, 1047,
+     1114,   83, 1134, 1136,   83, 1068,   83,   83, 1163, 1167,
+     1115,   83,   83, 1166, 1127,   83, 1242, 1142, 1165, 1155,
+     1190, 1198, 1192,   83,   83, 1257, 1312, 1258,   83, 1213,
+     1337, 1347,   83,   83, 1401, 1434, 1167, 1065, 1462, 1348,
+     1433, 1475, 1476, 1480, 1350, 1508, 1513,   83,   83, 1257,
+       87,   83,   83, 1164, 1258, 1483, 1425, 1337, 1401,   87,
+       83,   83, 1565,   87, 1462, 1566,   87, 1579, 1581, 1241,
+     1542, 1311, 1583, 1513, 1584,   83,   83,   83, 1589, 1588,
+     1591,   83, 1585,   83, 1593,   83,   83,   83, 1595, 1594,
+
+       83, 1597, 1598, 1600, 1602,   83, 1596, 1556,   83,   83,
+     1603, 1479, 1604, 1606,   83,   83,   83, 1608,   83, 1609,
+     1607, 1582,   83,   83,   83,   83, 1614, 1615, 1576, 1616,
+     1610, 1611, 1613,   83, 1617,   83,   83,   83, 1620, 1622,
+     1619, 1623,   83,   83, 1621, 1624, 1626,   83, 1627, 1618,
+     1630,   83, 1632,   83, 1625, 1631,   83, 1633,   83, 1635,
+     1636, 1637,   83,   83, 1638, 1641,   83,   83,   83, 1642,
+       83,   83,   83, 1639,   83, 1640,   83, 1643, 1644,   83,
+     1648, 1645,   83, 1647,   83, 1646, 1649,   83, 1650, 1652,
+       83, 1656,   83,   83, 1651, 1653,   83,   83,   83, 1654,
+
+       83,   83, 1657,   83, 1655,   83,   83,   83,   83,   83,
+       83,   83, 1658,   83, 1674,   83,   83,   83, 1660, 1659,
+     1662,   83, 1664,   83,   83,   83, 1666,   83,   83, 1663,
+     1665,   83,   83, 1669,   83,   83,   83,   83,   83,   83,
+     1676, 1667,   83, 1671,   83, 1673, 1668,   83, 1670,   83,
+     1672, 1678,   83,   83, 1681, 1677, 1682, 1680,   83, 1675,
+     1683,   83, 1684,   83, 1679,   83,   83,   83, 1685,   83,
+     1687,   83, 1689,   83,   83, 1693, 1694,   83, 1691,   83,
+     1686, 1696, 1690, 1688, 1692, 1697, 1695, 1698,   83, 1708,
+       83,   83, 1700,   83,   83, 1701,   83, 1699, 1703,   83,
+
+       83,   83, 1704,   83,   83, 1705, 1709,   83, 1707, 1706,
+     1711, 1713, 1714, 1716, 1715,  318, 1717,   83,   83,   83,
+       83, 1718, 1710, 1719, 1720,   83,   83,   83, 1723,   83,
+      320,   83,  321,   83,   83,  323,   83,   83,  440,  441,
+      508,  510,  513,  514,  515,  517,  522,  528,  535,  540,
+       83,  544,  548,  549,   83,  550,  551,  552,  554,  555,
+      556,  557,  558,  561,  562,  563,  567,  568,   83,  569,
+      570,  571,  572,  574,  575,  576,  577,  578,  579,  580,
+      581,  582,  583,  584,  585,  586,  587,  588,  589,  590,
+      591,  592,  593,  594,  595,  596,  597,  598,  599,  600,
+
+      601,  602,  603,  604,  605,  606,  607,  608,  609,  610,
+      611,  612,  613,  614,  615,  617,  618,  619,  624,  625,
+      626,  627,  628,  629,  630,  631,  632,  633,  634,  635,
+      636,  637,  638,  639,  640,  641,  642,  643,  644,  646,
+      647,  648,  649,  650,  653,  654,  655,  656,  661,  662,
+      663,  664,  665,  669,  670,  671,  672,  673,  674,  675,
+      676,  677,  678,  679,  680,  681,  682,  683,  684,  687,
+      688,  689,  690,  691,  692,  693,  694,  695,  696,  697,
+      698,  699,  700,  704,  705,  706,  707,  709,  710,  711,
+      712,  713,  714,  715,  716,  717,  718,  719,  720,  721,
+
+      722,  723,  724,  725,  726,  727,  728,  729,  730,  731,
+      732,  733,  734,  735,  736,  737,  740,  741,  742,  743,
+      744,  745,  746,  747,  748,  749,  752,  753,  754,  755,
+      756,  757,  758,  759,  760,  761,  762,  763,  764,  765,
+      766,  767,  768,  769,  770,  772,  774,  775,  776,  777,
+      778,  779,  780,  782,  783,  784,  787,  788,  789,  790,
+      791,  792,  794,  796,  797,   87,  804,  809,  816,  818,
+      834,  835,  836,  837,  838,  844,  845,  850,  854,  872,
+      882,  888,  896,  905,  909,  911,  912,  917,  921,  928,
+      932,  941,  956,  957,  959,  961,  975,  985,  991,  996,
+
+      997,  999, 1015, 1027, 1039, 1054, 1059, 1062, 1064, 1069,
+     1070, 1071, 1072, 1074, 1075, 1076, 1077, 1078, 1079, 1082,
+     1084, 1086, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095,
+     1096, 1097, 1098, 1100, 1101, 1102, 1103, 1104, 1105, 1106,
+     1107, 1108, 1109, 1110, 1111, 1112, 1113, 1116, 1117, 1118,
+     1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1128, 1129,
+     1130, 1131, 1132, 1133, 1135, 1137, 1138, 1139, 1140, 1141,
      1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152,
-     1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1139,
-     1162, 1163, 1164, 1165, 1166, 1140, 1167, 1168, 1169, 1170,
-     1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180,
-     1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190,
-     1191, 1192, 1193, 1194, 1195, 1196, 1197, 1199, 1200, 1201,
-     1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211,
-     1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221,
-     1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232,
-     1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242,
-
-     1243, 1244, 1216, 1245, 1246, 1247, 1248, 1249, 1250, 1198,
-     1252, 1253, 1254, 1255, 1256, 1257, 1251, 1258, 1259, 1260,
-     1261, 1262, 1263, 1222, 1264, 1265, 1266, 1267, 1268, 1269,
-     1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279,
-     1280, 1282, 1283, 1284, 1285, 1281, 1286, 1287, 1288, 1289,
-     1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299,
-     1300, 1301, 1302, 1303, 1304, 1283, 1305, 1306, 1307, 1308,
-     1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318,
-     1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328,
-     1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338,
-
-     1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348,
-     1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358,
-     1359, 1360, 1362, 1363, 1364, 1337, 1365, 1366, 1367, 1368,
-     1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378,
-     1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388,
-     1389, 1391, 1390, 1392, 1393, 1394, 1395, 1396, 1397, 1398,
-     1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408,
-     1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1361,
-     1390, 1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426,
-     1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436,
-
-     1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446,
-     1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456,
-     1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466,
-     1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476,
-     1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486,
-     1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496,
-     1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506,
-     1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516,
-     1517, 1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526,
-     1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536,
-
-     1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546,
-     1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556,
-     1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566,
-     1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576,
-     1577, 1578, 1579,   12,   12,   12,   12,   12,   36,   36,
-       36,   36,   36,   80,  302,   80,   80,   80,   99,  415,
-       99,  535,   99,  101,  101,  101,  101,  101,  116,  116,
-      116,  116,  116,  183,  101,  183,  183,  183,  205,  205,
-      205,  817,  816,  815,  814,  813,  812,  811,  810,  809,
-      808,  807,  806,  805,  804,  803,  800,  799,  798,  797,
-
-      796,  795,  794,  793,  792,  791,  790,  789,  788,  787,
-      786,  785,  784,  783,  782,  781,  780,  779,  778,  777,
-      776,  775,  774,  773,  772,  771,  770,  769,  768,  767,
-      766,  762,  759,  758,  757,  756,  755,  752,  751,  750,
-      749,  748,  747,  746,  745,  744,  743,  742,  741,  740,
-      737,  736,  735,  734,  733,  732,  731,  730,  729,  728,
-      727,  726,  725,  724,  723,  722,  721,  720,  719,  718,
-      717,  716,  715,  714,  713,  710,  709,  708,  707,  706,
-      705,  704,  703,  702,  701,  700,  699,  698,  697,  696,
-      695,  694,  693,  690,  689,  688,  687,  686,  685,  684,
-
-      683,  682,  681,  680,  679,  678,  677,  676,  675,  674,
-      673,  672,  671,  670,  669,  668,  667,  666,  665,  664,
-      663,  662,  661,  660,  659,  658,  657,  656,  655,  651,
-      650,  649,  648,  647,  646,  645,  644,  643,  642,  641,
-      640,  639,  638,  637,  636,  635,  634,  633,  632,  631,
-      630,  629,  628,  627,  626,  625,  624,  623,  622,  621,
-      620,  619,  618,  617,  616,  615,  614,  613,  612,  611,
-      610,  609,  608,  607,  606,  605,  604,  603,  602,  601,
-      600,  599,  598,  597,  596,  595,  594,  593,  592,  591,
-      590,  589,  588,  587,  586,  585,  584,  583,  582,  581,
-
-      580,  579,  578,  577,  576,  573,  572,  571,  570,  569,
-      568,  567,  563,  562,  561,  560,  559,  558,  557,  556,
-      555,  554,  553,  552,  551,  550,  549,  545,  544,  543,
-      542,  541,  540,  539,  537,  536,  534,  533,  530,  529,
-      528,  527,  524,  523,  522,  521,  520,  519,  518,  517,
-      516,  515,  514,  513,  512,  509,  508,  507,  504,  503,
-      502,  501,  500,  499,  498,  495,  494,  493,  492,  491,
-      490,  489,  488,  487,  486,  483,  482,  481,  480,  479,
-      478,  474,  473,  472,  471,  470,  469,  468,  467,  466,
-      461,  460,  459,  458,  457,  456,  455,  454,  453,  452,
-
-      451,  450,  447,  446,  445,  444,  441,  440,  439,  438,
-      437,  436,  435,  434,  433,  432,  431,  428,  427,  425,
-      424,  419,  414,  411,  408,  407,  406,  405,  403,  402,
-      401,  400,  399,  398,  397,  394,  393,  392,  391,  390,
-      389,  388,  387,  384,  383,  382,  381,  380,  379,  378,
-      377,  376,  375,  374,  373,  369,  368,  367,  366,  365,
-      364,  363,  362,  361,  357,  356,  355,  354,  353,  352,
-      351,  350,  349,  348,  347,  346,  345,  344,  343,  342,
-      341,  340,  339,  338,  337,  336,  335,  334,  333,  332,
-      331,  330,  325,  324,  323,  322,  321,  320,  319,  318,
-
-      316,  206,  313,  311,  309,  306,  305,  303,  301,  294,
-      293,  292,  290,  289,  287,  286,  285,  284,  283,  282,
-      267,  266,  262,  259,  258,  257,  256,  255,  253,  252,
-      251,  250,  249,  246,  245,  244,  243,  242,  241,  240,
-      239,  238,  234,  233,  230,  227,  226,  225,  224,  221,
-      220,  219,  215,  214,  213,  212,  211,  210,  206,  199,
-      196,  195,  193,  191,  190,  182,  165,  145,  122,  110,
-      107,  106,  104,   43,  100,   98,   97,   88,   43, 1580,
-       11, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580,
-     1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580,
-
-     1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580,
-     1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580,
-     1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580,
-     1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580,
-     1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580,
-     1580, 1580, 1580, 1580
+     1153, 1154, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1169,
+     1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179,
+
+     1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189,
+     1191, 1193, 1194, 1195, 1196, 1197, 1199, 1200, 1201, 1202,
+     1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212,
+     1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223,
+     1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233,
+     1234, 1235, 1236, 1237, 1238, 1239, 1240, 1243, 1244, 1245,
+     1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255,
+     1256, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267,
+     1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277,
+     1278, 1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287,
+
+     1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297,
+     1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307,
+     1308, 1309, 1310, 1313, 1314, 1315, 1316, 1317, 1318, 1319,
+     1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329,
+     1330, 1331, 1332, 1333, 1334, 1335, 1336, 1338, 1339, 1340,
+     1341, 1342, 1343, 1344, 1345, 1346, 1349, 1351, 1352, 1353,
+     1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363,
+     1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373,
+     1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383,
+     1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393,
+
+     1394, 1395, 1396, 1397, 1398, 1399, 1400, 1402, 1403, 1404,
+     1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414,
+     1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424,
+     1426, 1427, 1428, 1429, 1430, 1431, 1432, 1435, 1436, 1437,
+     1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447,
+     1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457,
+     1458, 1459, 1460, 1461, 1463, 1464, 1465, 1466, 1467, 1468,
+     1469, 1470, 1471, 1472, 1473, 1474, 1477, 1478, 1481, 1482,
+     1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493,
+     1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503,
+
+     1504, 1505, 1506, 1507, 1509, 1510, 1511, 1512, 1514, 1515,
+     1516, 1517, 1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525,
+     1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535,
+     1536, 1537, 1538, 1539, 1540, 1541, 1543, 1544, 1545, 1546,
+     1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1557,
+     1558, 1559, 1560, 1561, 1562, 1563, 1564, 1567, 1568, 1569,
+     1570, 1571, 1572, 1573, 1575, 1577, 1578, 1580, 1586, 1587,
+     1590, 1599, 1601, 1605, 1612, 1628, 1629, 1634, 1661, 1702,
+     1722, 1724, 1725,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0
     } ;
 
-static const flex_int16_t yy_chk[2055] =
+static const flex_int16_t yy_chk[4351] =
     {   0,
-        0,    1,    1,    1,    0,    1,    1,  716,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-       21,  607,    3,    3,    3,   21,    1,    1,    3,   44,
-        0,    1,    4,    4,    4,   13,    1,   13,    4,   27,
-       28,    1,  109,    1,    5,    5,    5,   26,   32,    1,
-        1,   33,    6,    6,    6,    7,    7,    7,    1,    7,
-      607,    8,    8,    8,    1,    8,   44,   27,   28,  109,
-       26,    1,    1,    2,    2,    2,   32,    2,    2,   33,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    2,    9,    9,    9,   31,    5,   48,    2,    2,
-
-       10,   10,   10,    2,    6,   37,   51,   37,    2,   42,
-       52,   42,    9,    2,   54,    2,   56,   57,   31,   66,
-       10,    2,    2,   48,  130,  130,   25,   66,   25,   51,
-        2,   25,   25,   25,   25,   25,    2,   54,   52,   56,
-      135,   57,  135,    2,    2,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   17,  717,
-       17,   17,   17,   17,   17,   19,   59,   19,   19,   19,
-       19,   19,   64,   17,   20,   20,   20,   20,   20,   22,
-       19,   22,   22,   22,   22,   22,   91,   20,  162,  162,
-       55,   61,   59,   63,   22,   64,   17,   93,   59,   61,
-       55,   59,   61,   19,   63,   61,   64,   61,   65,   61,
-       20,   67,   91,   55,   63,   65,   73,   22,   45,   92,
-       73,   67,  718,   67,   45,   93,   45,   45,   55,   45,
-       73,   45,   45,   45,  303,   58,   69,   69,   45,   45,
-
-       69,   45,   58,   96,  303,   92,   69,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       62,   96,   58,  636,   62,   70,   58,   62,   62,   70,
-       58,   71,   75,   70,  636,   94,   75,  101,   58,   78,
-       62,  105,   58,   72,   58,   58,  112,   77,   77,   70,
-       71,   72,   71,   72,   71,   95,   76,   77,   72,   72,
-       76,   94,   78,   76,  150,  168,  168,   77,  150,  105,
-       76,   76,   78,  112,  101,  115,   76,   78,  587,  587,
-       77,   95,   77,   81,   81,   81,   81,   81,   82,  111,
-
-       82,   82,   82,   82,   82,   77,   81,  113,  115,   83,
-      719,   83,   77,   82,   83,   83,   83,   83,   83,   84,
-      114,   84,   84,   84,   84,   84,  103,  111,  386,   81,
-      108,  119,  386,  103,   84,  113,   82,   85,   85,   85,
-       85,   85,   89,   89,   89,   89,   89,  114,  119,  137,
-       85,   90,   90,   90,   90,   90,  108,   84,  169,  119,
-      126,  140,  169,  103,  140,  137,  169,  103,  140,  126,
-      126,  103,  164,   85,  156,  164,  164,  185,  176,  103,
-      167,  179,  184,  103,  186,  103,  103,  118,  118,  118,
-      118,  118,  188,  720,  293,  721,  118,  118,  118,  118,
-
-      118,  118,  156,  185,  156,  176,  187,  186,  179,  189,
-      184,  197,  194,  198,  200,  167,  167,  167,  188,  118,
-      118,  118,  118,  118,  118,  202,  167,  204,  167,  209,
-      167,  167,  189,  167,  187,  194,  218,  200,  280,  197,
-      198,  248,  271,  258,  218,  271,  293,  722,  202,  218,
-      218,  280,  209,  295,  204,  207,  207,  207,  207,  207,
-      298,  307,  723,  724,  207,  207,  207,  207,  207,  207,
-      288,  304,  306,  306,  310,  288,  295,  725,  329,  258,
-      317,  306,  390,  298,  307,  377,  390,  207,  207,  207,
-      207,  207,  207,  258,  248,  329,  348,  248,  365,  418,
-
-      304,  348,  310,  315,  315,  315,  315,  315,  365,  317,
-      653,  726,  315,  315,  315,  315,  315,  315,  335,  404,
-      358,  358,  404,  410,  335,  358,  727,  418,  410,  428,
-      546,  428,  448,  653,  728,  315,  315,  315,  315,  315,
-      315,  661,  661,  377,  661,  448,  430,  448,  457,  348,
-      547,  652,  698,  457,  348,  698,  428,  546,  428,  429,
-      429,  429,  429,  429,  729,  730,  731,  733,  429,  429,
-      429,  429,  429,  429,  430,  548,  659,  732,  547,  652,
-      548,  735,  659,  736,  732,  739,  740,  741,  742,  734,
-      734,  429,  429,  429,  429,  429,  429,  734,  737,  743,
-
-      744,  734,  745,  746,  737,  747,  748,  749,  750,  751,
-      753,  754,  755,  756,  757,  758,  759,  760,  761,  763,
-      764,  765,  766,  767,  768,  769,  770,  771,  772,  773,
-      774,  775,  776,  777,  778,  779,  780,  781,  783,  754,
-      784,  785,  786,  787,  788,  789,  790,  791,  792,  788,
-      793,  794,  795,  796,  799,  800,  801,  802,  803,  806,
-      807,  808,  809,  810,  811,  812,  813,  814,  811,  815,
-      816,  817,  819,  820,  821,  822,  823,  824,  825,  826,
-      827,  828,  829,  830,  831,  832,  833,  834,  835,  836,
-      837,  838,  839,  840,  841,  842,  843,  844,  846,  847,
-
-      848,  849,  850,  851,  852,  853,  854,  855,  856,  858,
-      859,  860,  861,  862,  863,  864,  865,  866,  867,  868,
-      869,  870,  871,  872,  873,  874,  875,  876,  877,  878,
-      879,  880,  882,  859,  883,  884,  858,  885,  886,  887,
-      888,  889,  890,  892,  893,  894,  895,  896,  898,  899,
-      900,  901,  902,  903,  904,  905,  906,  907,  908,  909,
-      910,  911,  912,  913,  914,  915,  916,  917,  919,  920,
-      921,  923,  924,  925,  926,  927,  928,  916,  929,  930,
-      931,  932,  933,  934,  935,  936,  937,  938,  939,  940,
-      942,  943,  944,  945,  946,  947,  948,  949,  950,  951,
-
-      952,  953,  954,  955,  895,  956,  958,  957,  959,  960,
-      961,  962,  963,  965,  966,  967,  968,  969,  970,  971,
-      972,  973,  974,  976,  977,  978,  979,  980,  981,  982,
-      983,  984,  985,  956,  957,  986,  987,  988,  989,  990,
-      992,  993,  994,  995,  996,  992,  997,  998,  999, 1000,
-     1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010,
-     1011, 1012, 1013, 1014, 1015, 1016, 1018, 1019, 1020, 1021,
-     1022, 1023, 1024, 1025, 1026, 1027, 1028, 1030, 1031, 1032,
-     1034, 1035, 1036, 1037, 1038,  993, 1039, 1040, 1041, 1042,
-     1043, 1044, 1045, 1046, 1047, 1049, 1050, 1051, 1052, 1053,
-
-     1054, 1055, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064,
-     1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1050,
-     1076, 1077, 1078, 1079, 1080, 1051, 1081, 1084, 1086, 1087,
-     1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1097, 1098,
-     1099, 1100, 1102, 1103, 1104, 1105, 1106, 1109, 1110, 1111,
-     1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121,
-     1122, 1123, 1124, 1126, 1127, 1128, 1131, 1132, 1133, 1134,
-     1135, 1136, 1137, 1138, 1139, 1140, 1142, 1143, 1144, 1145,
-     1146, 1147, 1148, 1149, 1151, 1152, 1153, 1154, 1155, 1156,
-     1157, 1158, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167,
-
-     1168, 1169, 1139, 1170, 1171, 1172, 1173, 1174, 1175, 1118,
-     1176, 1177, 1178, 1179, 1181, 1184, 1175, 1185, 1186, 1187,
-     1188, 1189, 1190, 1145, 1191, 1192, 1194, 1195, 1196, 1197,
-     1198, 1199, 1200, 1202, 1203, 1205, 1208, 1210, 1212, 1213,
-     1214, 1215, 1216, 1218, 1219, 1214, 1220, 1222, 1223, 1224,
-     1225, 1226, 1227, 1228, 1229, 1230, 1231, 1233, 1234, 1235,
-     1236, 1237, 1238, 1239, 1240, 1216, 1241, 1242, 1243, 1246,
-     1248, 1249, 1250, 1251, 1252, 1253, 1254, 1256, 1257, 1258,
-     1259, 1260, 1261, 1263, 1264, 1266, 1267, 1268, 1269, 1271,
-     1272, 1273, 1274, 1275, 1276, 1277, 1279, 1281, 1283, 1285,
-
-     1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295,
-     1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305,
-     1305, 1306, 1307, 1308, 1309, 1283, 1310, 1311, 1312, 1313,
-     1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323,
-     1324, 1325, 1326, 1327, 1328, 1330, 1331, 1332, 1334, 1335,
-     1336, 1339, 1337, 1342, 1343, 1344, 1347, 1348, 1349, 1352,
-     1353, 1354, 1355, 1356, 1357, 1358, 1359, 1361, 1362, 1364,
-     1366, 1367, 1368, 1369, 1370, 1371, 1372, 1374, 1375, 1306,
-     1337, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384,
-     1385, 1386, 1387, 1389, 1390, 1391, 1392, 1393, 1395, 1396,
-
-     1397, 1398, 1399, 1400, 1401, 1403, 1404, 1405, 1407, 1409,
-     1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419,
-     1420, 1421, 1423, 1424, 1426, 1429, 1432, 1434, 1435, 1436,
-     1438, 1439, 1441, 1442, 1443, 1444, 1445, 1446, 1448, 1449,
-     1450, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 1461,
-     1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471,
-     1474, 1475, 1476, 1477, 1478, 1479, 1480, 1482, 1483, 1484,
-     1485, 1486, 1487, 1488, 1489, 1490, 1492, 1493, 1494, 1495,
-     1496, 1498, 1502, 1504, 1505, 1506, 1507, 1509, 1511, 1512,
-     1513, 1514, 1516, 1517, 1519, 1520, 1523, 1524, 1525, 1526,
-
-     1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536,
-     1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1546, 1547,
-     1548, 1549, 1550, 1552, 1554, 1555, 1556, 1557, 1558, 1559,
-     1563, 1564, 1565, 1566, 1568, 1569, 1571, 1572, 1573, 1574,
-     1575, 1577, 1578, 1581, 1581, 1581, 1581, 1581, 1582, 1582,
-     1582, 1582, 1582, 1583, 1589, 1583, 1583, 1583, 1584, 1590,
-     1584, 1591, 1584, 1585, 1585, 1585, 1585, 1585, 1586, 1586,
-     1586, 1586, 1586, 1587, 1592, 1587, 1587, 1587, 1588, 1588,
-     1588,  715,  714,  713,  712,  710,  709,  708,  707,  706,
-      705,  704,  703,  702,  700,  699,  697,  696,  695,  694,
-
-      693,  692,  691,  690,  689,  688,  687,  686,  685,  684,
-      683,  682,  680,  679,  678,  677,  676,  675,  674,  673,
-      672,  671,  670,  669,  668,  667,  666,  665,  664,  663,
-      662,  660,  658,  657,  656,  655,  654,  651,  650,  649,
-      647,  646,  644,  643,  642,  641,  640,  639,  638,  637,
-      634,  633,  632,  631,  630,  629,  628,  627,  626,  625,
-      624,  623,  622,  620,  619,  618,  617,  616,  615,  614,
-      613,  611,  610,  609,  608,  606,  605,  604,  603,  602,
-      601,  600,  598,  597,  596,  595,  594,  593,  592,  591,
-      590,  589,  588,  586,  585,  584,  583,  582,  581,  580,
-
-      579,  578,  577,  576,  575,  573,  572,  571,  570,  569,
-      568,  567,  566,  565,  564,  563,  562,  561,  560,  559,
-      558,  557,  556,  555,  554,  553,  552,  551,  550,  544,
-      542,  539,  538,  537,  536,  534,  533,  532,  530,  529,
-      526,  525,  524,  523,  522,  521,  520,  519,  518,  517,
-      516,  515,  514,  513,  512,  511,  510,  509,  508,  507,
-      506,  505,  504,  503,  502,  501,  500,  499,  497,  495,
-      494,  493,  492,  491,  490,  489,  488,  487,  486,  485,
-      484,  482,  481,  480,  479,  478,  477,  476,  475,  474,
-      473,  472,  471,  470,  469,  468,  467,  466,  465,  464,
-
-      463,  461,  460,  459,  458,  456,  455,  454,  453,  452,
-      450,  449,  447,  446,  444,  443,  442,  441,  440,  439,
-      438,  436,  435,  434,  433,  432,  431,  426,  425,  423,
-      422,  421,  420,  419,  417,  416,  414,  411,  409,  408,
-      406,  405,  403,  402,  401,  400,  399,  398,  397,  396,
-      395,  394,  393,  392,  391,  389,  388,  387,  385,  384,
-      383,  382,  380,  379,  378,  376,  375,  374,  373,  372,
-      371,  370,  369,  368,  366,  364,  363,  362,  361,  360,
-      359,  357,  356,  355,  354,  353,  352,  351,  350,  349,
-      347,  346,  345,  344,  343,  342,  341,  340,  339,  338,
-
-      337,  336,  334,  333,  332,  331,  328,  327,  326,  325,
-      324,  323,  322,  321,  320,  319,  318,  314,  312,  309,
-      308,  305,  301,  294,  292,  291,  290,  289,  287,  286,
-      285,  284,  283,  282,  281,  279,  278,  277,  276,  275,
-      274,  273,  272,  270,  269,  268,  267,  266,  265,  264,
-      263,  262,  261,  260,  259,  257,  256,  255,  254,  253,
-      252,  251,  250,  249,  247,  246,  245,  244,  243,  242,
-      241,  240,  238,  237,  236,  235,  234,  233,  232,  231,
-      230,  229,  228,  227,  226,  225,  224,  223,  222,  221,
-      220,  219,  217,  216,  215,  214,  213,  212,  211,  210,
-
-      208,  205,  203,  201,  199,  196,  195,  193,  190,  182,
-      181,  180,  178,  177,  175,  174,  173,  172,  171,  170,
-      166,  165,  163,  161,  160,  159,  158,  157,  155,  154,
-      153,  152,  151,  149,  148,  147,  146,  145,  144,  143,
-      142,  141,  139,  138,  136,  134,  133,  132,  131,  129,
-      128,  127,  125,  124,  123,  122,  121,  120,  116,  110,
-      107,  106,  104,   99,   98,   79,   74,   68,   60,   53,
-       50,   49,   47,   43,   41,   39,   38,   24,   14,   11,
-     1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580,
-     1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580,
-
-     1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580,
-     1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580,
-     1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580,
-     1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580,
-     1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580,
-     1580, 1580, 1580, 1580
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    9,    9,    9,    9,
+
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,  193,  193,  193,  193,  193,  193,  193,  193,
+
+      193,  193,  193,  193,  193,  193,  193,  193,  193,  193,
+      193,  193,  193,  193,  193,  193,  193,  193,  193,  193,
+      193,  193,  193,  193,  193,  193,  193,  193,  193,  193,
+      193,  193,  193,  193,  193,  193,  193,  193,  193,  193,
+      193,  193,  193,  193,  193,  193,  193,  193,  193,  193,
+      193,  193,  193,  193,  193,  193,  193,  193,  193,  193,
+      193,  193,  193,  193,  193,  193,  383,  383,  383,  383,
+      383,  383,  383,  383,  383,  383,  383,  383,  383,  383,
+      383,  383,  383,  383,  383,  383,  383,  383,  383,  383,
+      383,  383,  383,  383,  383,  383,  383,  383,  383,  383,
+
+      383,  383,  383,  383,  383,  383,  383,  383,  383,  383,
+      383,  383,  383,  383,  383,  383,  383,  383,  383,  383,
+      383,  383,  383,  383,  383,  383,  383,  383,  383,  383,
+      383,  383,  383,  383,  383,  383,  383,  383,  383,  383,
+      945,  945,  945,  945,  945,  945,  945,  945,  945,  945,
+      945,  945,  945,  945,  945,  945,  945,  945,  945,  945,
+      945,  945,  945,  945,  945,  945,  945,  945,  945,  945,
+      945,  945,  945,  945,  945,  945,  945,  945,  945,  945,
+      945,  945,  945,  945,  945,  945,  945,  945,  945,  945,
+      945,  945,  945,  945,  945,  945,  945,  945,  945,  945,
+
+      945,  945,  945,  945,  945,  945,  945,  945,  945,  945,
+      945,  945,  945,  945, 1706, 1706, 1706, 1706, 1706, 1706,
+     1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706,
+     1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706,
+     1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706,
+     1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706,
+     1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706,
+     1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706,
+     1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706, 1726, 1726,
+     1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726,
+
+     1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726,
+     1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726,
+     1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726,
+     1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726,
+     1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726,
+     1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726,
+     1726, 1726,   13,   13,   13,   18,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   91,   91,   91,   32,
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+       46,   46,   46,   17,   46,   46,   17,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,  194,  100,   33,  100,  194,  194,
+      194,  194,  194,  194,  194,  194,  194,  194,  194,  194,
+
+      194,  194,  194,  194,  194,  194,  194,  194,  194,  194,
+      194,  194,  194,  194,  194,  194,  194,  194,  194,  194,
+      194,  194,  194,  194,  194,  194,  194,  194,  194,  194,
+      194,  194,  194,  194,  194,  194,  194,  194,  194,  194,
+      194,  194,  194,  194,  194,  194,  194,  194,  194,  194,
+      194,  194,  194,  194,  194,  194,  194,  194,   52,   26,
+       26,   26,   26,   26,   52,   52,   52,   52,  944,   52,
+      400,  400,   52,   52,   52,  400,   65,   65,   65,   52,
+       52,   65,   52,  398,  398,   65,   65,   65,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+      311,  311,  311,  311,  311,  944,  139,  404,  387,  311,
+      311,  311,  311,  311,  311,  316,  316,  316,  316,  316,
+      387,  396,  396,  404,  316,  316,  316,  316,  316,  316,
+      139,  396,  139,  311,  311,  311,  311,  311,  311,   27,
+      139,   27,   27,   27,   27,   27,  139,  139,  316,  316,
+      316,  316,  316,  316,  437,  437,  437,  437,  437,   34,
+      166,  125,  129,  437,  437,  437,  437,  437,  437,  438,
+      438,  438,  438,  438,  129,  410,   15,  410,  438,  438,
+      438,  438,  438,  438,  166,  125,  129,  437,  437,  437,
+
+      437,  437,  437,  526,  166,  125,  129,  166,   15,  125,
+      129,  166,  438,  438,  438,  438,  438,  438,  565,  565,
+      565,  565,  565,  526,  128,  343,  132,  565,  565,  565,
+      565,  565,  565,  566,  566,  566,  566,  566,  132,   30,
+      390, 1536,  566,  566,  566,  566,  566,  566,  128,  343,
+      132,  565,  565,  565,  565,  565,  565,  699,  128,  343,
+      132,  343,  128,   30,  132,  343,  566,  566,  566,  566,
+      566,  566,  686,  686,  686,  686,  686,   56,   56, 1536,
+      390,  686,  686,  686,  686,  686,  686,   56,   62,   62,
+      122,   62,   62,  197,  104,  411,   70,   62,   56,   16,
+
+      197,   16,  122,   16,  411,  686,  686,  686,  686,  686,
+      686,   56,   63,   56,   56,  699,   70,   56,   70,  104,
+       70,   70,   56,  411,   70,   56,  122,  122,  122,   70,
+      389,  197,   56,   63,   63,  197,  122,   63,  122,  197,
+      122,  122,   63,  122,  389,  385,  197,  581,  581,  385,
+      197,  397,  197,  197,   24,  581,   24,   24,   24,   24,
+       24,   57,   53,   14,   73,   73,   53,   53,   73,   24,
+       53,   14,   53,   73,  749,   53,   14,   53,   59,   53,
+      401,   73,  749,   60,  401,   57,   57,   57,  749,   59,
+       57,   29,   31,   24,   57,   57,  397,   60,   60,   57,
+
+      498,   60,   59,  102,   59,   59,   60,   68,   59,  738,
+       60,   68,   68,   59,   68,   68,   59,  300,   29,   31,
+       68,   68,  738,   79,   79,   67,   68,   79,  498,  300,
+      102,   79,   79,   79,  135,   28,  738,   28,   79,   79,
+       28,   28,   28,   28,   28,   55,  135,   55,   55,   67,
+      414,   55,   74,  300,  300,   55,   55,   67,  135,   67,
+      199,   74,   67,  300,   67,   55,   67,  300,  135,  414,
+       76, 1718,  135,  201,   76,   76,   74,   76,   76,  690,
+      690,   58,  690,   76,  199,  502,   74,  502,  408,   76,
+      207,  207,   74,   74,  207,   74,   66,  727,  207,  207,
+
+      201,  408,  112,  207,  207,   58,   58,   58,  106,  727,
+       58,  502,   71,  502,  727,   58,   71,   71,   66,   66,
+       71,   66,   66,  151,  158,   71,  112,   66,  277,  112,
+      140,  140, 1718,  106,  140,   71,  112,  112,  112,  140,
+      277,  158,  140,  140,  372,   75,  744,  151,  158,  372,
+      744,  149,  149,  415,   75,  149,  744,  151,  158,  151,
+      149,  372,  415,  151,  277,   69,  149,  151,  158,   75,
+      158,  375,  375,  402,  277,  694,  402,  375,   54,   75,
+      375,  277,   54,   54,  277,  372,   54,   64,  694,   69,
+       69,   54,   61,   69,  127,  372,   61,   61,   69,  153,
+
+       61,  375,  372,  138,  693,   61,  143,  136,   64,   64,
+      127,  375,   64,  546,  162,  157,  143,   64,  127,  136,
+      138,  138,  148,  153,  138,  546,  436,  546,  127,  138,
+      143,  136,  157,  153,  153,  153,  436,  127,  162,  157,
+      143,  136,  143,  169,  170,  136,  148,  148,  162,  157,
+      148,  234,  693,  236,  241,  148,  162,  173,  236,  157,
+      162,  169,  170,  245,  447,  405,  241,  169,  170,  362,
+      236,  405,  447,  245,  362,  234,  234,  169,  170,  234,
+      956,  173,  173,  173,  234,  259,  362,  245,  169,  170,
+      241,  173,  357,  262,  236,  259,  758,  245,  319,  245,
+
+      241,  416,  758,  416,  236,  758,  241,  262,  272,  259,
+      362,  376,  673,  203,  263,  263,  357,  262,  263,  259,
+      362,  259,  319,  263,  376,  357,  357,  262,  357,  425,
+      263,  956,  272,  272,  262,  376,  272,   82,  203,  742,
+       84,  272,  742,  742,  425,  376,   78,   78,  114,  742,
+       78,  376,  673,  742,  689,   78,   80,   80,   81,   81,
+       80,   82,   81,  113,   84,   80,  116,   81,   84,   85,
+       85,   82,  114,   85,   84,  115,  115,  118,   85,  115,
+       82,  123,  114,  418,  115,  119,  418,  113,  121,  113,
+      116,  586,  114,  124,  126,  689,  130,  113,  586,  384,
+
+      116,  118,  409,  409,  131,  123,  116,  118,  130,  119,
+      119,  118,  121,  133,  121,  123,  131,  124,  126,  119,
+      126,  137,  121,  384,  124,  141,  123,  124,  126,  134,
+      134,  145,  130,  134,  142,  144,  144,  133,  134,  144,
+      131,   38,  130,  145,  144,  137,  146,  133,  147,  141,
+      131,  341,  150,  394,  133,  137,  419,  155,  142,  141,
+      142,  150,  419,  146,  156,  141,  137,  145,  142,  159,
+      160,  692,  147,  669,  406,  341,  150,  145,  161,  406,
+      394,  155,  147,  155,  163,  341,  150,  146,  156,  156,
+      147,  155,  164,  159,  160,  167,  341,  146,  156,  165,
+
+      168,  432,  161,  159,  160,  160,  669,  167,  163,  159,
+      432,  171,  161,   43,  172,  692,  164,  882,  163,  163,
+      161,  700,  882,  165,  168,  174,  164,  406,  164,  175,
+      539,  167,  406,  165,  168,  171,  708,  503,  172,  533,
+      165,  167,  503,  177,  179,  171,  180,  168,  172,  174,
+      533,  171,  181,  175,  540,  175,  172,  539,  680,  174,
+      176,  176,  882,  175,  176,  700,  174,  177,  179,  176,
+      180,  185,  680,  708,  179,  188,  181,  177,  179,  621,
+      180,  540,   50,  182,  182,  177,  181,  182,  180,  183,
+      183,  186,  182,  183,  181,  185,  186,  538,  183,  188,
+
+      190,  208,  538,  211,  733,  185,  621,  185,  210,  188,
+      212,  188,  189,  189,  209,  209,  189,  733,  209,  214,
+      186,  189,  212,  209,  190,  208,  217,  211,  216,  211,
+      186,  215,  210,  218,  190,  208,  208,  211, 1556,  210,
+      213,  213,  210,  214,  213,  214,  212,  190,  215,  213,
+      217,  219,  216,  214,  222,  220,  212,  218,  216,  223,
+      217,  748,  216,  219,  221,  221,  217,  218,  221,  748,
+      635,  232,  215,  221,  218,  224,  225,  225,  222,  220,
+      225,  635,  215,  223,  229,  225,  223,  219,  222,  220,
+     1556,  222,  682,  223,  697,  232,  232,  219,  220,  224,
+
+      697,  229,  224,  228,  228,  232,  682,  228,  620,  224,
+      230,  230,  228,  237,  230,  238,  240,  231,  231,  230,
+      242,  231,  239,  235,  235,  229,  231,  235,  243,   72,
+      237,  247,  235,  246,  620,  229,  658,  242,  660,  238,
+      240,  707,  698,  660,  249,  243,  239,  658,  707,  238,
+      240,  251,  747,  238,  237,  247,  239,  246,  240,  864,
+      239,  242,  864,  252,  237,  247,  246,  246,  249,  243,
+      705,  242,  247,  712,  253,  251,  255,  712,  249,  243,
+      258,  258,  260,  261,  258,  251,  249,  252,  853,  258,
+      265,  265,  747,  251,  265,  698,  266,  252,  253,  265,
+
+      255,  264,  853,  269,  252,  103,  260,  261,  253,  688,
+      255,  695,  253,  695,  688,  853,  260,  261,  255,  705,
+      266,  270,  266,  260,  271,  264,  718,  269,  264,  261,
+      266,  718,  267,  267,  274,  264,  267,  269,  268,  268,
+      273,  267,  268,  269,  717,  270,  274,  268,  271,  278,
+      710,  710,  275,  275,  270,  270,  275,  281,  271, 1068,
+      271,  275,  276,  276,  273,  282,  276,  280,  279,  279,
+      274,  276,  279,  278,  273,  278,  284,  279,  283,  280,
+      274,  281,  273,  278,  286, 1068,  701,  288,  701,  282,
+      291,  281,  292,  295,  717,  296,  281,  298,  298,  282,
+
+      284,  298,  283,  280,  288,  283,  298,  282,  286,  284,
+      284,  706,  283,  280,  291,  299,  292,  295,  286,  296,
+      286,  291,  296,  302,  291,  731,  292,  295,  288,  296,
+      731,  295,  301,  301,  304,  292,  301,  303,  288,  299,
+      302,  301,  305,  306,  703,  299,  333,  308,  308,  299,
+      709,  308,  711,  706,  310,  306,  308,  716,  304,  324,
+      703,  303,  309,  716,  302,  714,  305,  709,  304,  711,
+      333,  303,  713,  713,  302,  942,  305,  303,  310,  306,
+      333,  304,  333,  324,  305,  329,  309,  309,  310,  306,
+      715,  715,  745,  324,  735,  310,  309,  325,  325,  324,
+
+      735,  325,  329,  326,  326,  331,  325,  326,  942,  327,
+      327,  745,  326,  327,  753,  328,  328,  334,  327,  328,
+      714,  330,  330,  719,  328,  330,  329,  719,  753,  331,
+      330,  332,  332,  336,  336,  332,  329,  336,  346,  331,
+      332,  334,  336,  338,  338,  339,  339,  338,  331,  339,
+      105,  334,  338,  347,  339,  340,  340,  344,  344,  340,
+      334,  344,  346,  355,  340,  349,  344,  345,  345,  352,
+      351,  345,  346,  354,  346,  726,  345,  347,  356,  361,
+      355,  725,  351,  728,  726,  725,  752,  347,  363,  349,
+      757,  366,  728,  352,  757,  356,  361,  354,  752,  349,
+
+      347,  732,  107,  352,  355,  349,  351,  354,  737,  352,
+      737,  354,  363,  369,  355,  366,  351,  359,  359,  356,
+      361,  359,  363,  360,  360,  366,  359,  360,  363,  356,
+      361,  366,  360,  367,  368,  368,  370,  369,  368,  371,
+      763,  374,  373,  368,  763,  377,  732,  369,  759,  380,
+      367,  109,  382,  379,  739,  378,  371,  377,  369,  741,
+      370,  380,   77,  759,  382,  374,  373,  743,  381,  743,
+      370,  370,  373,  374,  367,  374,  373,  379,  739,  378,
+      371,  377,  378,   83,  367,  380,   77,  379,  382,  378,
+      371,  377,  381,  379,  117,  380,   77,  120,  382,  381,
+
+      152,  154,  381,  178,  741,  184,  187,   83,  191,  192,
+      751,  746,  226,  746,  227,  755,  755,   83,  117,  865,
+      233,  120,  865,  244,  152,  154,  248,  178,  117,  184,
+      187,  120,  191,  192,  152,  154,  226,  178,  227,  184,
+      187,  250,  191,  192,  233,  254,  226,  244,  227,  256,
+      248,  110,  285,  287,  233,  751,  289,  244,  290,  767,
+      248,  293,  760,  767,  294,  250,  762,  297,  761,  254,
+      307,  962,  337,  256,  761,  250,  285,  287,  342,  254,
+      289,  348,  290,  256,  353,  293,  285,  287,  294,  776,
+      289,  297,  290,  962,  307,  293,  337,  962,  294,  781,
+
+      766,  297,  342,  765,  307,  348,  337,  760,  353,  765,
+      771,  762,  342,  766,  768,  348,  768,  769,  353,  773,
+      774,  769,  775,  777,  777,  771,  780,  778,  780,  776,
+      783,  790,  773,  782,  774,  778,  785,  782,  775,  781,
+      784,  784,  787,  788,  788,  785,  791,  792,  799,  794,
+      800,  801,  787,  794,  804,  792,  805,  802,  799,  809,
+      801,  802,  804,  800,  807,  812,  810,  811,  811,  812,
+      805,  790,  810,  815,  824,  783,  807,  818,  819,  816,
+      819,  820,  822,  809,  823,  825,  791,  815,  816,  818,
+      826,  840,  828,  824,  828,  820,  822,  827,  823,  825,
+
+      829,  827,  831,  832,  829,  833,  834,  836,  831,  833,
+      834,  835,  837,  832,  838,  836,  843,  835,  839,  841,
+      837,  842,  839,  848,  844,  841,  850,  852,  838,  857,
+      854,  840,  854,  842,  856,  826,  844,  858,  857,  850,
+      860,  859,  861,  863,  856,  859,  858,  862,  867,  860,
+      868,  871,  861,  872,  870,  894,  862,  872,  873,  867,
+      871,  843,  873,  874,  874,  876,  883,  852,  848,  868,
+      870,  875,  879,  876,  893,  875,  879,  881,  881,  885,
+      883,  886,  887,  888,  893,  887,  891,  886,  863,  895,
+      891,  896,  897,  885,  898,  901,  888,  897,  899,  899,
+
+      894,  902,  895,  903,  898,  904,  896,  905,  906,  904,
+      907,  902,  903,  909,  907,  910,  911,  911,  912,  913,
+      906,  914,  916,  910,  915,  909,  917,  918,  913,  918,
+      914,  921,  915,  919,  922,  901,  916,  919,  923,  924,
+      917,  926,  923,  925,  925,  926,  927,  905,  922,  929,
+      928,  927,  928,  930,  931,  933,  934,  935,  936,  930,
+      940,  931,  933,  912,  939,  929,  938,  935,  941,  940,
+      939,  921,  943,  938,  947,  946,  950,  949,  950,  959,
+      951,  955,  947,  949,  924,  946,  951,  952,  955,  961,
+      952,  963,  979,  968,  976,  976,  934,  968,  977,  996,
+
+      979,  981,  977,  936,  943,  983,  981,  983,  996,  941,
+     1012, 1025, 1033, 1035, 1035,  963, 1041, 1055, 1064, 1067,
+     1012, 1033, 1094, 1065, 1025,  959, 1146, 1041, 1065, 1055,
+     1092, 1100, 1094, 1092, 1116, 1167, 1228, 1168, 1100, 1116,
+     1257, 1273, 1275, 1363, 1337, 1372, 1067,  961, 1401, 1273,
+     1372, 1415, 1415, 1418, 1275, 1455, 1462, 1421, 1495, 1167,
+     1512, 1455, 1525, 1064, 1168, 1421, 1363, 1257, 1337, 1538,
+     1526, 1541, 1525, 1544, 1401, 1526, 1545, 1541, 1544, 1146,
+     1495, 1228, 1546, 1462, 1547, 1548, 1552, 1559, 1553, 1552,
+     1555, 1555, 1548, 1546, 1558, 1547, 1553, 1558, 1560, 1559,
+
+     1561, 1563, 1564, 1566, 1568, 1560, 1561, 1512, 1563, 1564,
+     1569, 1418, 1571, 1574, 1574, 1568, 1575, 1576, 1569, 1579,
+     1575, 1545, 1581, 1576, 1582, 1584, 1585, 1586, 1538, 1587,
+     1581, 1582, 1584, 1586, 1588, 1587, 1589, 1590, 1591, 1594,
+     1590, 1595, 1588, 1593, 1593, 1596, 1598, 1597, 1599, 1589,
+     1603, 1604, 1605, 1571, 1597, 1604, 1603, 1606, 1599, 1608,
+     1610, 1611, 1610, 1566, 1612, 1615, 1613, 1614, 1612, 1616,
+     1579, 1620, 1585, 1613, 1619, 1614, 1617, 1617, 1618, 1618,
+     1625, 1619, 1621, 1621, 1591, 1620, 1627, 1627, 1628, 1630,
+     1594, 1638, 1595, 1629, 1629, 1631, 1596, 1598, 1631, 1634,
+
+     1636, 1639, 1639, 1605, 1636, 1643, 1634, 1640, 1606, 1615,
+     1608, 1644, 1640, 1616, 1661, 1646, 1647, 1651, 1644, 1643,
+     1646, 1649, 1649, 1611, 1625, 1650, 1651, 1628, 1653, 1647,
+     1650, 1654, 1655, 1655, 1657, 1658, 1659, 1630, 1662, 1638,
+     1663, 1653, 1665, 1658, 1660, 1660, 1654, 1664, 1657, 1666,
+     1659, 1665, 1667, 1668, 1668, 1664, 1669, 1667, 1661, 1662,
+     1670, 1671, 1671, 1672, 1666, 1676, 1673, 1678, 1672, 1675,
+     1675, 1677, 1677, 1679, 1680, 1681, 1684, 1685, 1679, 1663,
+     1673, 1686, 1678, 1676, 1680, 1687, 1685, 1688, 1689, 1702,
+     1688, 1690, 1690, 1691, 1699, 1691, 1700, 1689, 1695, 1695,
+
+     1669, 1698, 1698, 1701, 1670, 1699, 1703, 1704, 1701, 1700,
+     1705, 1707, 1710, 1713, 1712,  200, 1714, 1713, 1714, 1681,
+     1684, 1715, 1704, 1716, 1717, 1686, 1716, 1707, 1720, 1687,
+      202, 1715,  204, 1702, 1712,  205, 1717, 1720,  320,  323,
+      386,  388,  391,  392,  393,  395,  399,  403,  407,  413,
+     1703,  417,  420,  421, 1705,  422,  423,  424,  426,  427,
+      429,  430,  431,  433,  434,  435,  441,  442, 1710,  443,
+      444,  445,  446,  449,  450,  451,  452,  453,  454,  455,
+      456,  457,  458,  459,  460,  461,  462,  463,  464,  465,
+      466,  467,  468,  469,  470,  471,  472,  473,  476,  477,
+
+      478,  479,  482,  483,  484,  486,  487,  488,  490,  491,
+      493,  494,  495,  496,  497,  499,  500,  501,  504,  505,
+      506,  507,  508,  509,  510,  511,  512,  513,  514,  515,
+      516,  517,  518,  519,  521,  522,  523,  524,  525,  527,
+      528,  529,  530,  531,  534,  535,  536,  537,  541,  542,
+      543,  544,  545,  547,  550,  551,  552,  553,  554,  555,
+      556,  557,  558,  559,  560,  561,  562,  563,  564,  567,
+      568,  569,  570,  571,  572,  573,  574,  575,  576,  577,
+      578,  579,  580,  582,  583,  584,  585,  587,  588,  589,
+      590,  591,  593,  594,  595,  596,  597,  598,  599,  600,
+
+      601,  602,  603,  604,  605,  606,  607,  608,  609,  611,
+      612,  613,  616,  617,  618,  619,  622,  624,  626,  627,
+      628,  629,  631,  632,  633,  634,  637,  638,  639,  640,
+      641,  642,  643,  644,  645,  646,  647,  648,  650,  651,
+      652,  653,  654,  655,  656,  659,  662,  663,  664,  665,
+      666,  667,  668,  670,  671,  672,  674,  675,  676,  677,
+      678,  679,  681,  683,  684,  685,  691,  696,  702,  704,
+      720,  721,  722,  723,  724,  729,  730,  736,  740,  754,
+      764,  770,  779,  789,  793,  795,  797,  803,  808,  817,
+      821,  830,  845,  846,  849,  851,  866,  877,  884,  889,
+
+      890,  892,  908,  920,  932,  948,  953,  957,  960,  964,
+      965,  966,  967,  969,  970,  971,  973,  974,  975,  978,
+      980,  982,  984,  985,  986,  987,  988,  990,  991,  992,
+      993,  994,  995,  997,  998,  999, 1000, 1002, 1003, 1004,
+     1005, 1006, 1007, 1008, 1009, 1010, 1011, 1013, 1014, 1015,
+     1016, 1017, 1018, 1020, 1021, 1022, 1023, 1024, 1026, 1027,
+     1028, 1029, 1030, 1032, 1034, 1036, 1037, 1038, 1039, 1040,
+     1042, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052,
+     1053, 1054, 1056, 1057, 1058, 1059, 1060, 1062, 1063, 1069,
+     1071, 1072, 1073, 1074, 1076, 1077, 1078, 1079, 1080, 1081,
+
+     1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091,
+     1093, 1095, 1096, 1097, 1098, 1099, 1101, 1102, 1103, 1105,
+     1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115,
+     1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126,
+     1127, 1128, 1129, 1130, 1132, 1134, 1135, 1136, 1137, 1138,
+     1139, 1140, 1141, 1142, 1143, 1144, 1145, 1147, 1148, 1149,
+     1150, 1151, 1152, 1155, 1156, 1157, 1158, 1159, 1162, 1164,
+     1165, 1169, 1170, 1171, 1173, 1174, 1175, 1176, 1177, 1178,
+     1179, 1180, 1181, 1183, 1184, 1185, 1186, 1187, 1188, 1189,
+     1190, 1191, 1192, 1193, 1194, 1195, 1197, 1198, 1199, 1201,
+
+     1202, 1203, 1204, 1205, 1206, 1207, 1208, 1210, 1211, 1212,
+     1213, 1214, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223,
+     1225, 1226, 1227, 1229, 1230, 1231, 1232, 1233, 1234, 1236,
+     1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1247,
+     1249, 1251, 1252, 1253, 1254, 1255, 1256, 1258, 1259, 1260,
+     1262, 1264, 1265, 1266, 1270, 1272, 1274, 1276, 1277, 1278,
+     1279, 1280, 1281, 1282, 1283, 1284, 1286, 1287, 1288, 1289,
+     1290, 1291, 1292, 1293, 1296, 1297, 1298, 1299, 1300, 1301,
+     1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311,
+     1313, 1314, 1317, 1318, 1319, 1320, 1323, 1325, 1326, 1327,
+
+     1328, 1329, 1331, 1332, 1333, 1334, 1336, 1339, 1340, 1341,
+     1342, 1343, 1344, 1346, 1347, 1348, 1349, 1350, 1351, 1352,
+     1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362,
+     1365, 1366, 1367, 1368, 1369, 1370, 1371, 1373, 1374, 1375,
+     1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385,
+     1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394, 1396,
+     1397, 1398, 1399, 1400, 1402, 1403, 1404, 1406, 1407, 1408,
+     1409, 1410, 1411, 1412, 1413, 1414, 1416, 1417, 1419, 1420,
+     1423, 1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431, 1433,
+     1435, 1436, 1440, 1441, 1442, 1443, 1444, 1447, 1448, 1449,
+
+     1450, 1451, 1452, 1453, 1457, 1458, 1459, 1461, 1463, 1464,
+     1465, 1466, 1467, 1468, 1469, 1470, 1471, 1473, 1474, 1475,
+     1476, 1477, 1478, 1479, 1481, 1482, 1483, 1484, 1485, 1486,
+     1488, 1490, 1491, 1492, 1493, 1494, 1496, 1497, 1500, 1501,
+     1502, 1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1513,
+     1514, 1516, 1519, 1520, 1521, 1522, 1524, 1527, 1528, 1530,
+     1532, 1533, 1534, 1535, 1537, 1539, 1540, 1542, 1549, 1550,
+     1554, 1565, 1567, 1572, 1583, 1601, 1602, 1607, 1645, 1692,
+     1719, 1723, 1724,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1747,28 +2296,30 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[183] =
+static const flex_int16_t yy_rule_linenum[193] =
     {   0,
       147,  149,  151,  156,  157,  162,  163,  164,  176,  179,
       184,  191,  200,  209,  218,  227,  236,  245,  255,  264,
       273,  282,  291,  300,  309,  318,  327,  336,  345,  354,
-      363,  375,  384,  393,  402,  411,  422,  433,  444,  455,
-      465,  475,  486,  497,  508,  519,  530,  541,  552,  563,
-      574,  585,  596,  607,  618,  629,  640,  649,  658,  668,
-      677,  687,  701,  717,  726,  735,  744,  753,  774,  795,
-      804,  814,  823,  834,  843,  852,  861,  870,  879,  889,
-      898,  909,  920,  932,  941,  951,  960,  969,  978,  987,
-      996, 1005, 1014, 1024, 1035, 1047, 1056, 1065, 1075, 1085,
-
-     1095, 1105, 1115, 1125, 1134, 1144, 1153, 1162, 1171, 1180,
-     1190, 1200, 1209, 1219, 1228, 1237, 1246, 1255, 1264, 1273,
-     1282, 1291, 1300, 1309, 1318, 1327, 1336, 1345, 1354, 1363,
-     1372, 1381, 1390, 1399, 1408, 1417, 1426, 1435, 1444, 1453,
-     1462, 1471, 1481, 1491, 1501, 1511, 1521, 1531, 1541, 1551,
-     1561, 1571, 1581, 1590, 1599, 1608, 1617, 1626, 1635, 1644,
-     1655, 1666, 1679, 1692, 1707, 1806, 1811, 1816, 1821, 1822,
-     1823, 1824, 1825, 1826, 1828, 1846, 1859, 1864, 1868, 1870,
-     1872, 1874
+      363,  372,  384,  393,  402,  411,  420,  431,  442,  453,
+      464,  474,  484,  495,  506,  517,  528,  539,  550,  561,
+      572,  583,  594,  605,  616,  627,  638,  649,  660,  669,
+      678,  688,  697,  707,  721,  737,  746,  755,  764,  773,
+      794,  815,  824,  834,  843,  854,  863,  872,  881,  890,
+      899,  909,  918,  929,  940,  951,  962,  971,  980,  989,
+      999, 1008, 1018, 1027, 1036, 1045, 1054, 1063, 1072, 1081,
+
+     1090, 1099, 1109, 1120, 1132, 1141, 1150, 1160, 1170, 1180,
+     1190, 1200, 1210, 1219, 1229, 1238, 1247, 1256, 1265, 1275,
+     1285, 1294, 1304, 1313, 1322, 1331, 1340, 1349, 1358, 1367,
+     1376, 1385, 1394, 1403, 1412, 1421, 1430, 1439, 1448, 1457,
+     1466, 1475, 1484, 1493, 1502, 1511, 1520, 1529, 1538, 1547,
+     1556, 1566, 1576, 1586, 1596, 1606, 1616, 1626, 1636, 1646,
+     1656, 1666, 1676, 1685, 1694, 1703, 1712, 1721, 1730, 1739,
+     1750, 1761, 1774, 1787, 1802, 1901, 1906, 1911, 1916, 1917,
+     1918, 1919, 1920, 1921, 1923, 1941, 1954, 1959, 1963, 1965,
+     1967, 1969
+
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1821,7 +2372,7 @@ using namespace isc::dhcp;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::dhcp::Parser4Context::fatal(msg)
-#line 1824 "dhcp4_lexer.cc"
+#line 2375 "dhcp4_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1847,8 +2398,8 @@ using namespace isc::dhcp;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1850 "dhcp4_lexer.cc"
-#line 1851 "dhcp4_lexer.cc"
+#line 2401 "dhcp4_lexer.cc"
+#line 2402 "dhcp4_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -2178,7 +2729,7 @@ YY_DECL
     }
 
 
-#line 2181 "dhcp4_lexer.cc"
+#line 2732 "dhcp4_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -2207,13 +2758,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1581 )
+				if ( yy_current_state >= 1727 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 1580 );
+		while ( yy_current_state != 1726 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -2232,13 +2783,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 183 )
+			else if ( yy_act < 193 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], yytext );
-			else if ( yy_act == 183 )
+			else if ( yy_act == 193 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         yytext );
-			else if ( yy_act == 184 )
+			else if ( yy_act == 194 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -2562,6 +3113,18 @@ YY_RULE_SETUP
 case 30:
 YY_RULE_SETUP
 #line 354 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::CONFIG_CONTROL:
+        return isc::dhcp::Dhcp4Parser::make_NOTIFY_FIFO(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("notify-fifo", driver.loc_);
+    }
+}
+	YY_BREAK
+case 31:
+YY_RULE_SETUP
+#line 363 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOSTS_DATABASE:
@@ -2571,9 +3134,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 31:
+case 32:
 YY_RULE_SETUP
-#line 363 "dhcp4_lexer.ll"
+#line 372 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2586,9 +3149,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 32:
+case 33:
 YY_RULE_SETUP
-#line 375 "dhcp4_lexer.ll"
+#line 384 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DATABASE_TYPE:
@@ -2598,9 +3161,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 33:
+case 34:
 YY_RULE_SETUP
-#line 384 "dhcp4_lexer.ll"
+#line 393 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DATABASE_TYPE:
@@ -2610,9 +3173,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 34:
+case 35:
 YY_RULE_SETUP
-#line 393 "dhcp4_lexer.ll"
+#line 402 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DATABASE_TYPE:
@@ -2622,9 +3185,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 35:
+case 36:
 YY_RULE_SETUP
-#line 402 "dhcp4_lexer.ll"
+#line 411 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DATABASE_TYPE:
@@ -2634,9 +3197,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 36:
+case 37:
 YY_RULE_SETUP
-#line 411 "dhcp4_lexer.ll"
+#line 420 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2648,9 +3211,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 37:
+case 38:
 YY_RULE_SETUP
-#line 422 "dhcp4_lexer.ll"
+#line 431 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2662,9 +3225,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 38:
+case 39:
 YY_RULE_SETUP
-#line 433 "dhcp4_lexer.ll"
+#line 442 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2676,9 +3239,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 39:
+case 40:
 YY_RULE_SETUP
-#line 444 "dhcp4_lexer.ll"
+#line 453 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2690,9 +3253,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 40:
+case 41:
 YY_RULE_SETUP
-#line 455 "dhcp4_lexer.ll"
+#line 464 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2703,9 +3266,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 41:
+case 42:
 YY_RULE_SETUP
-#line 465 "dhcp4_lexer.ll"
+#line 474 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2716,9 +3279,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 42:
+case 43:
 YY_RULE_SETUP
-#line 475 "dhcp4_lexer.ll"
+#line 484 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2730,9 +3293,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 43:
+case 44:
 YY_RULE_SETUP
-#line 486 "dhcp4_lexer.ll"
+#line 495 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2744,9 +3307,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 44:
+case 45:
 YY_RULE_SETUP
-#line 497 "dhcp4_lexer.ll"
+#line 506 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2758,9 +3321,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 45:
+case 46:
 YY_RULE_SETUP
-#line 508 "dhcp4_lexer.ll"
+#line 517 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2772,9 +3335,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 46:
+case 47:
 YY_RULE_SETUP
-#line 519 "dhcp4_lexer.ll"
+#line 528 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2786,9 +3349,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 47:
+case 48:
 YY_RULE_SETUP
-#line 530 "dhcp4_lexer.ll"
+#line 539 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2800,9 +3363,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 48:
+case 49:
 YY_RULE_SETUP
-#line 541 "dhcp4_lexer.ll"
+#line 550 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2814,9 +3377,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 49:
+case 50:
 YY_RULE_SETUP
-#line 552 "dhcp4_lexer.ll"
+#line 561 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2828,9 +3391,23 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 50:
+case 51:
+YY_RULE_SETUP
+#line 572 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+    case isc::dhcp::Parser4Context::HOSTS_DATABASE:
+    case isc::dhcp::Parser4Context::CONFIG_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_POOL_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("pool-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 52:
 YY_RULE_SETUP
-#line 563 "dhcp4_lexer.ll"
+#line 583 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2842,9 +3419,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 51:
+case 53:
 YY_RULE_SETUP
-#line 574 "dhcp4_lexer.ll"
+#line 594 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2856,9 +3433,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 52:
+case 54:
 YY_RULE_SETUP
-#line 585 "dhcp4_lexer.ll"
+#line 605 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2870,9 +3447,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 53:
+case 55:
 YY_RULE_SETUP
-#line 596 "dhcp4_lexer.ll"
+#line 616 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2884,9 +3461,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 54:
+case 56:
 YY_RULE_SETUP
-#line 607 "dhcp4_lexer.ll"
+#line 627 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2898,9 +3475,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 55:
+case 57:
 YY_RULE_SETUP
-#line 618 "dhcp4_lexer.ll"
+#line 638 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2912,9 +3489,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 56:
+case 58:
 YY_RULE_SETUP
-#line 629 "dhcp4_lexer.ll"
+#line 649 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2926,9 +3503,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 57:
+case 59:
 YY_RULE_SETUP
-#line 640 "dhcp4_lexer.ll"
+#line 660 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2938,9 +3515,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 58:
+case 60:
 YY_RULE_SETUP
-#line 649 "dhcp4_lexer.ll"
+#line 669 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2950,9 +3527,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 59:
+case 61:
 YY_RULE_SETUP
-#line 658 "dhcp4_lexer.ll"
+#line 678 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2963,9 +3540,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 60:
+case 62:
 YY_RULE_SETUP
-#line 668 "dhcp4_lexer.ll"
+#line 688 "dhcp4_lexer.ll"
 {
     switch (driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2975,9 +3552,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 61:
+case 63:
 YY_RULE_SETUP
-#line 677 "dhcp4_lexer.ll"
+#line 697 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2988,9 +3565,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 62:
+case 64:
 YY_RULE_SETUP
-#line 687 "dhcp4_lexer.ll"
+#line 707 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3005,9 +3582,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 63:
+case 65:
 YY_RULE_SETUP
-#line 701 "dhcp4_lexer.ll"
+#line 721 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -3024,9 +3601,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 64:
+case 66:
 YY_RULE_SETUP
-#line 717 "dhcp4_lexer.ll"
+#line 737 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -3036,9 +3613,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 65:
+case 67:
 YY_RULE_SETUP
-#line 726 "dhcp4_lexer.ll"
+#line 746 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -3048,9 +3625,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 66:
+case 68:
 YY_RULE_SETUP
-#line 735 "dhcp4_lexer.ll"
+#line 755 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3060,9 +3637,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 67:
+case 69:
 YY_RULE_SETUP
-#line 744 "dhcp4_lexer.ll"
+#line 764 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::POOLS:
@@ -3072,9 +3649,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 68:
+case 70:
 YY_RULE_SETUP
-#line 753 "dhcp4_lexer.ll"
+#line 773 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3096,9 +3673,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 69:
+case 71:
 YY_RULE_SETUP
-#line 774 "dhcp4_lexer.ll"
+#line 794 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3120,9 +3697,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 70:
+case 72:
 YY_RULE_SETUP
-#line 795 "dhcp4_lexer.ll"
+#line 815 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3132,9 +3709,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 71:
+case 73:
 YY_RULE_SETUP
-#line 804 "dhcp4_lexer.ll"
+#line 824 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3145,9 +3722,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 72:
+case 74:
 YY_RULE_SETUP
-#line 814 "dhcp4_lexer.ll"
+#line 834 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3157,9 +3734,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 73:
+case 75:
 YY_RULE_SETUP
-#line 823 "dhcp4_lexer.ll"
+#line 843 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3171,9 +3748,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 74:
+case 76:
 YY_RULE_SETUP
-#line 834 "dhcp4_lexer.ll"
+#line 854 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3183,9 +3760,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 75:
+case 77:
 YY_RULE_SETUP
-#line 843 "dhcp4_lexer.ll"
+#line 863 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3195,9 +3772,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 76:
+case 78:
 YY_RULE_SETUP
-#line 852 "dhcp4_lexer.ll"
+#line 872 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3207,9 +3784,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 77:
+case 79:
 YY_RULE_SETUP
-#line 861 "dhcp4_lexer.ll"
+#line 881 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3219,9 +3796,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 78:
+case 80:
 YY_RULE_SETUP
-#line 870 "dhcp4_lexer.ll"
+#line 890 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3231,9 +3808,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 79:
+case 81:
 YY_RULE_SETUP
-#line 879 "dhcp4_lexer.ll"
+#line 899 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3244,9 +3821,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 80:
+case 82:
 YY_RULE_SETUP
-#line 889 "dhcp4_lexer.ll"
+#line 909 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3256,9 +3833,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 81:
+case 83:
 YY_RULE_SETUP
-#line 898 "dhcp4_lexer.ll"
+#line 918 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3270,9 +3847,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 82:
+case 84:
 YY_RULE_SETUP
-#line 909 "dhcp4_lexer.ll"
+#line 929 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3284,9 +3861,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 83:
+case 85:
 YY_RULE_SETUP
-#line 920 "dhcp4_lexer.ll"
+#line 940 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3298,9 +3875,71 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 84:
+case 86:
+YY_RULE_SETUP
+#line 951 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::DHCP4:
+    case isc::dhcp::Parser4Context::SUBNET4:
+    case isc::dhcp::Parser4Context::SHARED_NETWORK:
+        return isc::dhcp::Dhcp4Parser::make_CACHE_THRESHOLD(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("cache-threshold", driver.loc_);
+    }
+}
+	YY_BREAK
+case 87:
+YY_RULE_SETUP
+#line 962 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::DHCP4:
+        return isc::dhcp::Dhcp4Parser::make_LEASE_LOOKUP_THREADS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lease-lookup-threads", driver.loc_);
+    }
+}
+	YY_BREAK
+case 88:
+YY_RULE_SETUP
+#line 971 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::DHCP4:
+        return isc::dhcp::Dhcp4Parser::make_PACKET_ARENA_CHUNK_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("packet-arena-chunk-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 89:
+YY_RULE_SETUP
+#line 980 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::DHCP4:
+        return isc::dhcp::Dhcp4Parser::make_PACKET_SLOW_THRESHOLD(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("packet-slow-threshold", driver.loc_);
+    }
+}
+	YY_BREAK
+case 90:
+YY_RULE_SETUP
+#line 989 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::DHCP4:
+        return isc::dhcp::Dhcp4Parser::make_HOST_FILTER_REBUILD_INTERVAL(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("host-filter-rebuild-interval", driver.loc_);
+    }
+}
+	YY_BREAK
+case 91:
 YY_RULE_SETUP
-#line 932 "dhcp4_lexer.ll"
+#line 999 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -3310,9 +3949,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 85:
+case 92:
 YY_RULE_SETUP
-#line 941 "dhcp4_lexer.ll"
+#line 1008 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3323,9 +3962,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 86:
+case 93:
 YY_RULE_SETUP
-#line 951 "dhcp4_lexer.ll"
+#line 1018 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -3335,9 +3974,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 87:
+case 94:
 YY_RULE_SETUP
-#line 960 "dhcp4_lexer.ll"
+#line 1027 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -3347,9 +3986,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 88:
+case 95:
 YY_RULE_SETUP
-#line 969 "dhcp4_lexer.ll"
+#line 1036 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -3359,9 +3998,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 89:
+case 96:
 YY_RULE_SETUP
-#line 978 "dhcp4_lexer.ll"
+#line 1045 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -3371,9 +4010,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 90:
+case 97:
 YY_RULE_SETUP
-#line 987 "dhcp4_lexer.ll"
+#line 1054 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -3383,9 +4022,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 91:
+case 98:
 YY_RULE_SETUP
-#line 996 "dhcp4_lexer.ll"
+#line 1063 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -3395,9 +4034,33 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 92:
+case 99:
 YY_RULE_SETUP
-#line 1005 "dhcp4_lexer.ll"
+#line 1072 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp4Parser::make_ASYNC(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("async", driver.loc_);
+    }
+}
+	YY_BREAK
+case 100:
+YY_RULE_SETUP
+#line 1081 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp4Parser::make_ASYNC_QUEUE_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("async-queue-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 101:
+YY_RULE_SETUP
+#line 1090 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -3407,9 +4070,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 93:
+case 102:
 YY_RULE_SETUP
-#line 1014 "dhcp4_lexer.ll"
+#line 1099 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3420,9 +4083,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 94:
+case 103:
 YY_RULE_SETUP
-#line 1024 "dhcp4_lexer.ll"
+#line 1109 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3434,9 +4097,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 95:
+case 104:
 YY_RULE_SETUP
-#line 1035 "dhcp4_lexer.ll"
+#line 1120 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3449,9 +4112,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 96:
+case 105:
 YY_RULE_SETUP
-#line 1047 "dhcp4_lexer.ll"
+#line 1132 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CLIENT_CLASSES:
@@ -3461,9 +4124,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 97:
+case 106:
 YY_RULE_SETUP
-#line 1056 "dhcp4_lexer.ll"
+#line 1141 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CLIENT_CLASSES:
@@ -3473,9 +4136,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 98:
+case 107:
 YY_RULE_SETUP
-#line 1065 "dhcp4_lexer.ll"
+#line 1150 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3486,9 +4149,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 99:
+case 108:
 YY_RULE_SETUP
-#line 1075 "dhcp4_lexer.ll"
+#line 1160 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3499,9 +4162,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 100:
+case 109:
 YY_RULE_SETUP
-#line 1085 "dhcp4_lexer.ll"
+#line 1170 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3512,9 +4175,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 101:
+case 110:
 YY_RULE_SETUP
-#line 1095 "dhcp4_lexer.ll"
+#line 1180 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3525,9 +4188,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 102:
+case 111:
 YY_RULE_SETUP
-#line 1105 "dhcp4_lexer.ll"
+#line 1190 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3538,9 +4201,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 103:
+case 112:
 YY_RULE_SETUP
-#line 1115 "dhcp4_lexer.ll"
+#line 1200 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3551,9 +4214,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 104:
+case 113:
 YY_RULE_SETUP
-#line 1125 "dhcp4_lexer.ll"
+#line 1210 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATIONS:
@@ -3563,9 +4226,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 105:
+case 114:
 YY_RULE_SETUP
-#line 1134 "dhcp4_lexer.ll"
+#line 1219 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3576,9 +4239,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 106:
+case 115:
 YY_RULE_SETUP
-#line 1144 "dhcp4_lexer.ll"
+#line 1229 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -3588,9 +4251,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 107:
+case 116:
 YY_RULE_SETUP
-#line 1153 "dhcp4_lexer.ll"
+#line 1238 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3600,9 +4263,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 108:
+case 117:
 YY_RULE_SETUP
-#line 1162 "dhcp4_lexer.ll"
+#line 1247 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3612,9 +4275,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 109:
+case 118:
 YY_RULE_SETUP
-#line 1171 "dhcp4_lexer.ll"
+#line 1256 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3624,9 +4287,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 110:
+case 119:
 YY_RULE_SETUP
-#line 1180 "dhcp4_lexer.ll"
+#line 1265 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3637,9 +4300,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 111:
+case 120:
 YY_RULE_SETUP
-#line 1190 "dhcp4_lexer.ll"
+#line 1275 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RELAY:
@@ -3650,9 +4313,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 112:
+case 121:
 YY_RULE_SETUP
-#line 1200 "dhcp4_lexer.ll"
+#line 1285 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RELAY:
@@ -3662,9 +4325,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 113:
+case 122:
 YY_RULE_SETUP
-#line 1209 "dhcp4_lexer.ll"
+#line 1294 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3674,9 +4337,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 114:
+case 123:
 YY_RULE_SETUP
-#line 1219 "dhcp4_lexer.ll"
+#line 1304 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOOKS_LIBRARIES:
@@ -3686,9 +4349,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 115:
+case 124:
 YY_RULE_SETUP
-#line 1228 "dhcp4_lexer.ll"
+#line 1313 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOOKS_LIBRARIES:
@@ -3698,9 +4361,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 116:
+case 125:
 YY_RULE_SETUP
-#line 1237 "dhcp4_lexer.ll"
+#line 1322 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3710,9 +4373,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 117:
+case 126:
 YY_RULE_SETUP
-#line 1246 "dhcp4_lexer.ll"
+#line 1331 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3722,9 +4385,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 118:
+case 127:
 YY_RULE_SETUP
-#line 1255 "dhcp4_lexer.ll"
+#line 1340 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3734,9 +4397,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 119:
+case 128:
 YY_RULE_SETUP
-#line 1264 "dhcp4_lexer.ll"
+#line 1349 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3746,9 +4409,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 120:
+case 129:
 YY_RULE_SETUP
-#line 1273 "dhcp4_lexer.ll"
+#line 1358 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3758,9 +4421,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 121:
+case 130:
 YY_RULE_SETUP
-#line 1282 "dhcp4_lexer.ll"
+#line 1367 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3770,9 +4433,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 122:
+case 131:
 YY_RULE_SETUP
-#line 1291 "dhcp4_lexer.ll"
+#line 1376 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3782,9 +4445,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 123:
+case 132:
 YY_RULE_SETUP
-#line 1300 "dhcp4_lexer.ll"
+#line 1385 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3794,9 +4457,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 124:
+case 133:
 YY_RULE_SETUP
-#line 1309 "dhcp4_lexer.ll"
+#line 1394 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3806,9 +4469,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 125:
+case 134:
 YY_RULE_SETUP
-#line 1318 "dhcp4_lexer.ll"
+#line 1403 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONTROL_SOCKET:
@@ -3818,9 +4481,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 126:
+case 135:
 YY_RULE_SETUP
-#line 1327 "dhcp4_lexer.ll"
+#line 1412 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONTROL_SOCKET:
@@ -3830,9 +4493,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 127:
+case 136:
 YY_RULE_SETUP
-#line 1336 "dhcp4_lexer.ll"
+#line 1421 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3842,9 +4505,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 128:
+case 137:
 YY_RULE_SETUP
-#line 1345 "dhcp4_lexer.ll"
+#line 1430 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3854,9 +4517,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 129:
+case 138:
 YY_RULE_SETUP
-#line 1354 "dhcp4_lexer.ll"
+#line 1439 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3866,9 +4529,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 130:
+case 139:
 YY_RULE_SETUP
-#line 1363 "dhcp4_lexer.ll"
+#line 1448 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3878,9 +4541,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 131:
+case 140:
 YY_RULE_SETUP
-#line 1372 "dhcp4_lexer.ll"
+#line 1457 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3890,9 +4553,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 132:
+case 141:
 YY_RULE_SETUP
-#line 1381 "dhcp4_lexer.ll"
+#line 1466 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3902,9 +4565,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 133:
+case 142:
 YY_RULE_SETUP
-#line 1390 "dhcp4_lexer.ll"
+#line 1475 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3914,9 +4577,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 134:
+case 143:
 YY_RULE_SETUP
-#line 1399 "dhcp4_lexer.ll"
+#line 1484 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3926,9 +4589,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 135:
+case 144:
 YY_RULE_SETUP
-#line 1408 "dhcp4_lexer.ll"
+#line 1493 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3938,9 +4601,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 136:
+case 145:
 YY_RULE_SETUP
-#line 1417 "dhcp4_lexer.ll"
+#line 1502 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3950,9 +4613,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 137:
+case 146:
 YY_RULE_SETUP
-#line 1426 "dhcp4_lexer.ll"
+#line 1511 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3962,9 +4625,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 138:
+case 147:
 YY_RULE_SETUP
-#line 1435 "dhcp4_lexer.ll"
+#line 1520 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3974,9 +4637,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 139:
+case 148:
 YY_RULE_SETUP
-#line 1444 "dhcp4_lexer.ll"
+#line 1529 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3986,9 +4649,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 140:
+case 149:
 YY_RULE_SETUP
-#line 1453 "dhcp4_lexer.ll"
+#line 1538 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3998,9 +4661,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 141:
+case 150:
 YY_RULE_SETUP
-#line 1462 "dhcp4_lexer.ll"
+#line 1547 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4010,9 +4673,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 142:
+case 151:
 YY_RULE_SETUP
-#line 1471 "dhcp4_lexer.ll"
+#line 1556 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4023,9 +4686,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 143:
+case 152:
 YY_RULE_SETUP
-#line 1481 "dhcp4_lexer.ll"
+#line 1566 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4036,9 +4699,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 144:
+case 153:
 YY_RULE_SETUP
-#line 1491 "dhcp4_lexer.ll"
+#line 1576 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_PROTOCOL) {
@@ -4049,9 +4712,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 145:
+case 154:
 YY_RULE_SETUP
-#line 1501 "dhcp4_lexer.ll"
+#line 1586 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_PROTOCOL) {
@@ -4062,9 +4725,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 146:
+case 155:
 YY_RULE_SETUP
-#line 1511 "dhcp4_lexer.ll"
+#line 1596 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_FORMAT) {
@@ -4075,9 +4738,22 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 147:
+case 156:
 YY_RULE_SETUP
-#line 1521 "dhcp4_lexer.ll"
+#line 1606 "dhcp4_lexer.ll"
+{
+    /* dhcp-ddns value keywords are case insensitive */
+    if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_FORMAT) {
+        return isc::dhcp::Dhcp4Parser::make_BINARY(driver.loc_);
+    }
+    std::string tmp(yytext+1);
+    tmp.resize(tmp.size() - 1);
+    return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
+}
+	YY_BREAK
+case 157:
+YY_RULE_SETUP
+#line 1616 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4088,9 +4764,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 148:
+case 158:
 YY_RULE_SETUP
-#line 1531 "dhcp4_lexer.ll"
+#line 1626 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4101,9 +4777,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 149:
+case 159:
 YY_RULE_SETUP
-#line 1541 "dhcp4_lexer.ll"
+#line 1636 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4114,9 +4790,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 150:
+case 160:
 YY_RULE_SETUP
-#line 1551 "dhcp4_lexer.ll"
+#line 1646 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4127,9 +4803,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 151:
+case 161:
 YY_RULE_SETUP
-#line 1561 "dhcp4_lexer.ll"
+#line 1656 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4140,9 +4816,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 152:
+case 162:
 YY_RULE_SETUP
-#line 1571 "dhcp4_lexer.ll"
+#line 1666 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4153,9 +4829,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 153:
+case 163:
 YY_RULE_SETUP
-#line 1581 "dhcp4_lexer.ll"
+#line 1676 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -4165,9 +4841,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 154:
+case 164:
 YY_RULE_SETUP
-#line 1590 "dhcp4_lexer.ll"
+#line 1685 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -4177,9 +4853,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 155:
+case 165:
 YY_RULE_SETUP
-#line 1599 "dhcp4_lexer.ll"
+#line 1694 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -4189,9 +4865,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 156:
+case 166:
 YY_RULE_SETUP
-#line 1608 "dhcp4_lexer.ll"
+#line 1703 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -4201,9 +4877,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 157:
+case 167:
 YY_RULE_SETUP
-#line 1617 "dhcp4_lexer.ll"
+#line 1712 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -4213,9 +4889,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 158:
+case 168:
 YY_RULE_SETUP
-#line 1626 "dhcp4_lexer.ll"
+#line 1721 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -4225,9 +4901,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 159:
+case 169:
 YY_RULE_SETUP
-#line 1635 "dhcp4_lexer.ll"
+#line 1730 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4237,9 +4913,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 160:
+case 170:
 YY_RULE_SETUP
-#line 1644 "dhcp4_lexer.ll"
+#line 1739 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4251,9 +4927,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 161:
+case 171:
 YY_RULE_SETUP
-#line 1655 "dhcp4_lexer.ll"
+#line 1750 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4265,9 +4941,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 162:
+case 172:
 YY_RULE_SETUP
-#line 1666 "dhcp4_lexer.ll"
+#line 1761 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4281,9 +4957,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 163:
+case 173:
 YY_RULE_SETUP
-#line 1679 "dhcp4_lexer.ll"
+#line 1774 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4297,9 +4973,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 164:
+case 174:
 YY_RULE_SETUP
-#line 1692 "dhcp4_lexer.ll"
+#line 1787 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4313,9 +4989,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 165:
+case 175:
 YY_RULE_SETUP
-#line 1707 "dhcp4_lexer.ll"
+#line 1802 "dhcp4_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -4415,65 +5091,65 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 166:
-/* rule 166 can match eol */
+case 176:
+/* rule 176 can match eol */
 YY_RULE_SETUP
-#line 1806 "dhcp4_lexer.ll"
+#line 1901 "dhcp4_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 167:
-/* rule 167 can match eol */
+case 177:
+/* rule 177 can match eol */
 YY_RULE_SETUP
-#line 1811 "dhcp4_lexer.ll"
+#line 1906 "dhcp4_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 168:
+case 178:
 YY_RULE_SETUP
-#line 1816 "dhcp4_lexer.ll"
+#line 1911 "dhcp4_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 169:
+case 179:
 YY_RULE_SETUP
-#line 1821 "dhcp4_lexer.ll"
+#line 1916 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 170:
+case 180:
 YY_RULE_SETUP
-#line 1822 "dhcp4_lexer.ll"
+#line 1917 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 171:
+case 181:
 YY_RULE_SETUP
-#line 1823 "dhcp4_lexer.ll"
+#line 1918 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 172:
+case 182:
 YY_RULE_SETUP
-#line 1824 "dhcp4_lexer.ll"
+#line 1919 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 173:
+case 183:
 YY_RULE_SETUP
-#line 1825 "dhcp4_lexer.ll"
+#line 1920 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 174:
+case 184:
 YY_RULE_SETUP
-#line 1826 "dhcp4_lexer.ll"
+#line 1921 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 175:
+case 185:
 YY_RULE_SETUP
-#line 1828 "dhcp4_lexer.ll"
+#line 1923 "dhcp4_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -4492,9 +5168,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 176:
+case 186:
 YY_RULE_SETUP
-#line 1846 "dhcp4_lexer.ll"
+#line 1941 "dhcp4_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -4508,43 +5184,43 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 177:
+case 187:
 YY_RULE_SETUP
-#line 1859 "dhcp4_lexer.ll"
+#line 1954 "dhcp4_lexer.ll"
 {
     string tmp(yytext);
     return isc::dhcp::Dhcp4Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 178:
+case 188:
 YY_RULE_SETUP
-#line 1864 "dhcp4_lexer.ll"
+#line 1959 "dhcp4_lexer.ll"
 {
    return isc::dhcp::Dhcp4Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 179:
+case 189:
 YY_RULE_SETUP
-#line 1868 "dhcp4_lexer.ll"
+#line 1963 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 180:
+case 190:
 YY_RULE_SETUP
-#line 1870 "dhcp4_lexer.ll"
+#line 1965 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 181:
+case 191:
 YY_RULE_SETUP
-#line 1872 "dhcp4_lexer.ll"
+#line 1967 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 182:
+case 192:
 YY_RULE_SETUP
-#line 1874 "dhcp4_lexer.ll"
+#line 1969 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 1876 "dhcp4_lexer.ll"
+#line 1971 "dhcp4_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::dhcp::Dhcp4Parser::make_END(driver.loc_);
@@ -4568,12 +5244,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 183:
+case 193:
 YY_RULE_SETUP
-#line 1899 "dhcp4_lexer.ll"
+#line 1994 "dhcp4_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 4576 "dhcp4_lexer.cc"
+#line 5252 "dhcp4_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -4892,7 +5568,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1581 )
+			if ( yy_current_state >= 1727 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -4925,11 +5601,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1581 )
+		if ( yy_current_state >= 1727 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 1580);
+	yy_is_jam = (yy_current_state == 1726);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -5678,8 +6354,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 1899 "dhcp4_lexer.ll"
-
+#line 1994 "dhcp4_lexer.ll"
 
 using namespace isc::dhcp;
 
@@ -16,6 +16,7 @@ extern const isc::log::MessageID DHCP4_BUFFER_UNPACK;
 extern const isc::log::MessageID DHCP4_BUFFER_WAIT_SIGNAL;
 extern const isc::log::MessageID DHCP4_CB_FETCH_UPDATES_FAIL;
 extern const isc::log::MessageID DHCP4_CB_FETCH_UPDATES_RETRIES_EXHAUSTED;
+extern const isc::log::MessageID DHCP4_CB_NOTIFY_FIFO_FAIL;
 extern const isc::log::MessageID DHCP4_CLASS_ASSIGNED;
 extern const isc::log::MessageID DHCP4_CLASS_UNCONFIGURED;
 extern const isc::log::MessageID DHCP4_CLASS_UNDEFINED;
@@ -95,6 +96,8 @@ extern const isc::log::MessageID DHCP4_PACKET_DROP_0007;
 extern const isc::log::MessageID DHCP4_PACKET_DROP_0008;
 extern const isc::log::MessageID DHCP4_PACKET_DROP_0009;
 extern const isc::log::MessageID DHCP4_PACKET_DROP_0010;
+extern const isc::log::MessageID DHCP4_PACKET_DROP_0011;
+extern const isc::log::MessageID DHCP4_PACKET_DROP_0012;
 extern const isc::log::MessageID DHCP4_PACKET_NAK_0001;
 extern const isc::log::MessageID DHCP4_PACKET_NAK_0002;
 extern const isc::log::MessageID DHCP4_PACKET_NAK_0003;
@@ -107,6 +110,7 @@ extern const isc::log::MessageID DHCP4_PACKET_PROCESS_STD_EXCEPTION;
 extern const isc::log::MessageID DHCP4_PACKET_RECEIVED;
 extern const isc::log::MessageID DHCP4_PACKET_SEND;
 extern const isc::log::MessageID DHCP4_PACKET_SEND_FAIL;
+extern const isc::log::MessageID DHCP4_PACKET_SLOW;
 extern const isc::log::MessageID DHCP4_PARSER_COMMIT_EXCEPTION;
 extern const isc::log::MessageID DHCP4_PARSER_COMMIT_FAIL;
 extern const isc::log::MessageID DHCP4_PARSER_EXCEPTION;
@@ -134,6 +138,8 @@ extern const isc::log::MessageID DHCP4_STARTING;
 extern const isc::log::MessageID DHCP4_START_INFO;
 extern const isc::log::MessageID DHCP4_SUBNET_DATA;
 extern const isc::log::MessageID DHCP4_SUBNET_DYNAMICALLY_CHANGED;
+extern const isc::log::MessageID DHCP4_SUBNET_PATCH_COMPLETE;
+extern const isc::log::MessageID DHCP4_SUBNET_PATCH_FAIL;
 extern const isc::log::MessageID DHCP4_SUBNET_SELECTED;
 extern const isc::log::MessageID DHCP4_SUBNET_SELECTION_FAILED;
 extern const isc::log::MessageID DHCP6_DHCP4O6_PACKET_RECEIVED;
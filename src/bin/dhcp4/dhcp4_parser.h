@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.4.1.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton interface for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015, 2018-2019 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -38,12 +38,13 @@
 
 // C++ LALR(1) parser skeleton written by Akim Demaille.
 
-// Undocumented macros, especially those whose name start with YY_,
-// are private implementation details.  Do not rely on them.
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
 
 #ifndef YY_PARSER4_DHCP4_PARSER_H_INCLUDED
 # define YY_PARSER4_DHCP4_PARSER_H_INCLUDED
-// //                    "%code requires" blocks.
+// "%code requires" blocks.
 #line 17 "dhcp4_parser.yy"
 
 #include <string>
@@ -56,7 +57,7 @@ using namespace isc::dhcp;
 using namespace isc::data;
 using namespace std;
 
-#line 60 "dhcp4_parser.h"
+#line 61 "dhcp4_parser.h"
 
 # include <cassert>
 # include <cstdlib> // std::abort
@@ -103,44 +104,48 @@ using namespace std;
 #endif
 # include "location.hh"
 #include <typeinfo>
-#ifndef YYASSERT
+#ifndef PARSER4__ASSERT
 # include <cassert>
-# define YYASSERT assert
+# define PARSER4__ASSERT assert
 #endif
 
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
 # else
-#  define YY_ATTRIBUTE(Spec) /* empty */
+#  define YY_ATTRIBUTE_PURE
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
-#endif
-
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && ! defined __ICC && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -153,6 +158,27 @@ using namespace std;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
 #  if defined __cplusplus
 #   if 201103L <= __cplusplus
@@ -180,7 +206,7 @@ using namespace std;
 
 #line 14 "dhcp4_parser.yy"
 namespace isc { namespace dhcp {
-#line 184 "dhcp4_parser.h"
+#line 210 "dhcp4_parser.h"
 
 
 
@@ -189,37 +215,49 @@ namespace isc { namespace dhcp {
   class Dhcp4Parser
   {
   public:
-#ifndef PARSER4_STYPE
+#ifdef PARSER4_STYPE
+# ifdef __GNUC__
+#  pragma GCC message "bison: do not #define PARSER4_STYPE in C++, use %define api.value.type"
+# endif
+    typedef PARSER4_STYPE value_type;
+#else
   /// A buffer to store and retrieve objects.
   ///
   /// Sort of a variant, but does not keep track of the nature
   /// of the stored data, since that knowledge is available
   /// via the current parser state.
-  class semantic_type
+  class value_type
   {
   public:
     /// Type of *this.
-    typedef semantic_type self_type;
+    typedef value_type self_type;
 
     /// Empty construction.
-    semantic_type () YY_NOEXCEPT
-      : yybuffer_ ()
+    value_type () YY_NOEXCEPT
+      : yyraw_ ()
       , yytypeid_ (YY_NULLPTR)
     {}
 
     /// Construct and fill.
     template <typename T>
-    semantic_type (YY_RVREF (T) t)
+    value_type (YY_RVREF (T) t)
       : yytypeid_ (&typeid (T))
     {
-      YYASSERT (sizeof (T) <= size);
+      PARSER4__ASSERT (sizeof (T) <= size);
       new (yyas_<T> ()) T (YY_MOVE (t));
     }
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    value_type (const self_type&) = delete;
+    /// Non copyable.
+    self_type& operator= (const self_type&) = delete;
+#endif
+
     /// Destruction, allowed only if empty.
-    ~semantic_type () YY_NOEXCEPT
+    ~value_type () YY_NOEXCEPT
     {
-      YYASSERT (!yytypeid_);
+      PARSER4__ASSERT (!yytypeid_);
     }
 
 # if 201103L <= YY_CPLUSPLUS
@@ -228,8 +266,8 @@ namespace isc { namespace dhcp {
     T&
     emplace (U&&... u)
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= size);
+      PARSER4__ASSERT (!yytypeid_);
+      PARSER4__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T (std::forward <U>(u)...);
     }
@@ -239,8 +277,8 @@ namespace isc { namespace dhcp {
     T&
     emplace ()
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= size);
+      PARSER4__ASSERT (!yytypeid_);
+      PARSER4__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T ();
     }
@@ -250,8 +288,8 @@ namespace isc { namespace dhcp {
     T&
     emplace (const T& t)
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= size);
+      PARSER4__ASSERT (!yytypeid_);
+      PARSER4__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T (t);
     }
@@ -280,9 +318,9 @@ namespace isc { namespace dhcp {
     T&
     as () YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= size);
+      PARSER4__ASSERT (yytypeid_);
+      PARSER4__ASSERT (*yytypeid_ == typeid (T));
+      PARSER4__ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
@@ -291,9 +329,9 @@ namespace isc { namespace dhcp {
     const T&
     as () const YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= size);
+      PARSER4__ASSERT (yytypeid_);
+      PARSER4__ASSERT (*yytypeid_ == typeid (T));
+      PARSER4__ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
@@ -309,8 +347,8 @@ namespace isc { namespace dhcp {
     void
     swap (self_type& that) YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == *that.yytypeid_);
+      PARSER4__ASSERT (yytypeid_);
+      PARSER4__ASSERT (*yytypeid_ == *that.yytypeid_);
       std::swap (as<T> (), that.as<T> ());
     }
 
@@ -359,16 +397,19 @@ namespace isc { namespace dhcp {
     }
 
   private:
-    /// Prohibit blind copies.
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    value_type (const self_type&);
+    /// Non copyable.
     self_type& operator= (const self_type&);
-    semantic_type (const self_type&);
+#endif
 
     /// Accessor to raw memory as \a T.
     template <typename T>
     T*
     yyas_ () YY_NOEXCEPT
     {
-      void *yyp = yybuffer_.yyraw;
+      void *yyp = yyraw_;
       return static_cast<T*> (yyp);
      }
 
@@ -377,7 +418,7 @@ namespace isc { namespace dhcp {
     const T*
     yyas_ () const YY_NOEXCEPT
     {
-      const void *yyp = yybuffer_.yyraw;
+      const void *yyp = yyraw_;
       return static_cast<const T*> (yyp);
      }
 
@@ -391,6 +432,7 @@ namespace isc { namespace dhcp {
       // db_type
       // hr_mode
       // ncr_protocol_value
+      // ncr_format_value
       // replace_client_name_value
       char dummy1[sizeof (ElementPtr)];
 
@@ -414,18 +456,19 @@ namespace isc { namespace dhcp {
     union
     {
       /// Strongest alignment constraints.
-      long double yyalign_me;
+      long double yyalign_me_;
       /// A buffer large enough to store any of the semantic values.
-      char yyraw[size];
-    } yybuffer_;
+      char yyraw_[size];
+    };
 
     /// Whether the content is built: if defined, the name of the stored type.
     const std::type_info *yytypeid_;
   };
 
-#else
-    typedef PARSER4_STYPE semantic_type;
 #endif
+    /// Backward compatibility (Bison 3.8).
+    typedef value_type semantic_type;
+
     /// Symbol locations.
     typedef location location_type;
 
@@ -447,205 +490,812 @@ namespace isc { namespace dhcp {
       location_type location;
     };
 
-    /// Tokens.
+    /// Token kinds.
     struct token
     {
-      enum yytokentype
-      {
-        TOKEN_END = 0,
-        TOKEN_COMMA = 258,
-        TOKEN_COLON = 259,
-        TOKEN_LSQUARE_BRACKET = 260,
-        TOKEN_RSQUARE_BRACKET = 261,
-        TOKEN_LCURLY_BRACKET = 262,
-        TOKEN_RCURLY_BRACKET = 263,
-        TOKEN_NULL_TYPE = 264,
-        TOKEN_DHCP4 = 265,
-        TOKEN_CONFIG_CONTROL = 266,
-        TOKEN_CONFIG_DATABASES = 267,
-        TOKEN_CONFIG_FETCH_WAIT_TIME = 268,
-        TOKEN_INTERFACES_CONFIG = 269,
-        TOKEN_INTERFACES = 270,
-        TOKEN_DHCP_SOCKET_TYPE = 271,
-        TOKEN_RAW = 272,
-        TOKEN_UDP = 273,
-        TOKEN_OUTBOUND_INTERFACE = 274,
-        TOKEN_SAME_AS_INBOUND = 275,
-        TOKEN_USE_ROUTING = 276,
-        TOKEN_RE_DETECT = 277,
-        TOKEN_SANITY_CHECKS = 278,
-        TOKEN_LEASE_CHECKS = 279,
-        TOKEN_ECHO_CLIENT_ID = 280,
-        TOKEN_MATCH_CLIENT_ID = 281,
-        TOKEN_AUTHORITATIVE = 282,
-        TOKEN_NEXT_SERVER = 283,
-        TOKEN_SERVER_HOSTNAME = 284,
-        TOKEN_BOOT_FILE_NAME = 285,
-        TOKEN_LEASE_DATABASE = 286,
-        TOKEN_HOSTS_DATABASE = 287,
-        TOKEN_HOSTS_DATABASES = 288,
-        TOKEN_TYPE = 289,
-        TOKEN_MEMFILE = 290,
-        TOKEN_MYSQL = 291,
-        TOKEN_POSTGRESQL = 292,
-        TOKEN_CQL = 293,
-        TOKEN_USER = 294,
-        TOKEN_PASSWORD = 295,
-        TOKEN_HOST = 296,
-        TOKEN_PORT = 297,
-        TOKEN_PERSIST = 298,
-        TOKEN_LFC_INTERVAL = 299,
-        TOKEN_READONLY = 300,
-        TOKEN_CONNECT_TIMEOUT = 301,
-        TOKEN_CONTACT_POINTS = 302,
-        TOKEN_KEYSPACE = 303,
-        TOKEN_CONSISTENCY = 304,
-        TOKEN_SERIAL_CONSISTENCY = 305,
-        TOKEN_MAX_RECONNECT_TRIES = 306,
-        TOKEN_RECONNECT_WAIT_TIME = 307,
-        TOKEN_REQUEST_TIMEOUT = 308,
-        TOKEN_TCP_KEEPALIVE = 309,
-        TOKEN_TCP_NODELAY = 310,
-        TOKEN_VALID_LIFETIME = 311,
-        TOKEN_MIN_VALID_LIFETIME = 312,
-        TOKEN_MAX_VALID_LIFETIME = 313,
-        TOKEN_RENEW_TIMER = 314,
-        TOKEN_REBIND_TIMER = 315,
-        TOKEN_CALCULATE_TEE_TIMES = 316,
-        TOKEN_T1_PERCENT = 317,
-        TOKEN_T2_PERCENT = 318,
-        TOKEN_DECLINE_PROBATION_PERIOD = 319,
-        TOKEN_SERVER_TAG = 320,
-        TOKEN_SUBNET4 = 321,
-        TOKEN_SUBNET_4O6_INTERFACE = 322,
-        TOKEN_SUBNET_4O6_INTERFACE_ID = 323,
-        TOKEN_SUBNET_4O6_SUBNET = 324,
-        TOKEN_OPTION_DEF = 325,
-        TOKEN_OPTION_DATA = 326,
-        TOKEN_NAME = 327,
-        TOKEN_DATA = 328,
-        TOKEN_CODE = 329,
-        TOKEN_SPACE = 330,
-        TOKEN_CSV_FORMAT = 331,
-        TOKEN_ALWAYS_SEND = 332,
-        TOKEN_RECORD_TYPES = 333,
-        TOKEN_ENCAPSULATE = 334,
-        TOKEN_ARRAY = 335,
-        TOKEN_SHARED_NETWORKS = 336,
-        TOKEN_POOLS = 337,
-        TOKEN_POOL = 338,
-        TOKEN_USER_CONTEXT = 339,
-        TOKEN_COMMENT = 340,
-        TOKEN_SUBNET = 341,
-        TOKEN_INTERFACE = 342,
-        TOKEN_ID = 343,
-        TOKEN_RESERVATION_MODE = 344,
-        TOKEN_DISABLED = 345,
-        TOKEN_OUT_OF_POOL = 346,
-        TOKEN_GLOBAL = 347,
-        TOKEN_ALL = 348,
-        TOKEN_HOST_RESERVATION_IDENTIFIERS = 349,
-        TOKEN_CLIENT_CLASSES = 350,
-        TOKEN_REQUIRE_CLIENT_CLASSES = 351,
-        TOKEN_TEST = 352,
-        TOKEN_ONLY_IF_REQUIRED = 353,
-        TOKEN_CLIENT_CLASS = 354,
-        TOKEN_RESERVATIONS = 355,
-        TOKEN_DUID = 356,
-        TOKEN_HW_ADDRESS = 357,
-        TOKEN_CIRCUIT_ID = 358,
-        TOKEN_CLIENT_ID = 359,
-        TOKEN_HOSTNAME = 360,
-        TOKEN_FLEX_ID = 361,
-        TOKEN_RELAY = 362,
-        TOKEN_IP_ADDRESS = 363,
-        TOKEN_IP_ADDRESSES = 364,
-        TOKEN_HOOKS_LIBRARIES = 365,
-        TOKEN_LIBRARY = 366,
-        TOKEN_PARAMETERS = 367,
-        TOKEN_EXPIRED_LEASES_PROCESSING = 368,
-        TOKEN_RECLAIM_TIMER_WAIT_TIME = 369,
-        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 370,
-        TOKEN_HOLD_RECLAIMED_TIME = 371,
-        TOKEN_MAX_RECLAIM_LEASES = 372,
-        TOKEN_MAX_RECLAIM_TIME = 373,
-        TOKEN_UNWARNED_RECLAIM_CYCLES = 374,
-        TOKEN_DHCP4O6_PORT = 375,
-        TOKEN_CONTROL_SOCKET = 376,
-        TOKEN_SOCKET_TYPE = 377,
-        TOKEN_SOCKET_NAME = 378,
-        TOKEN_DHCP_QUEUE_CONTROL = 379,
-        TOKEN_DHCP_DDNS = 380,
-        TOKEN_ENABLE_UPDATES = 381,
-        TOKEN_QUALIFYING_SUFFIX = 382,
-        TOKEN_SERVER_IP = 383,
-        TOKEN_SERVER_PORT = 384,
-        TOKEN_SENDER_IP = 385,
-        TOKEN_SENDER_PORT = 386,
-        TOKEN_MAX_QUEUE_SIZE = 387,
-        TOKEN_NCR_PROTOCOL = 388,
-        TOKEN_NCR_FORMAT = 389,
-        TOKEN_OVERRIDE_NO_UPDATE = 390,
-        TOKEN_OVERRIDE_CLIENT_UPDATE = 391,
-        TOKEN_REPLACE_CLIENT_NAME = 392,
-        TOKEN_GENERATED_PREFIX = 393,
-        TOKEN_TCP = 394,
-        TOKEN_JSON = 395,
-        TOKEN_WHEN_PRESENT = 396,
-        TOKEN_NEVER = 397,
-        TOKEN_ALWAYS = 398,
-        TOKEN_WHEN_NOT_PRESENT = 399,
-        TOKEN_HOSTNAME_CHAR_SET = 400,
-        TOKEN_HOSTNAME_CHAR_REPLACEMENT = 401,
-        TOKEN_LOGGING = 402,
-        TOKEN_LOGGERS = 403,
-        TOKEN_OUTPUT_OPTIONS = 404,
-        TOKEN_OUTPUT = 405,
-        TOKEN_DEBUGLEVEL = 406,
-        TOKEN_SEVERITY = 407,
-        TOKEN_FLUSH = 408,
-        TOKEN_MAXSIZE = 409,
-        TOKEN_MAXVER = 410,
-        TOKEN_DHCP6 = 411,
-        TOKEN_DHCPDDNS = 412,
-        TOKEN_CONTROL_AGENT = 413,
-        TOKEN_TOPLEVEL_JSON = 414,
-        TOKEN_TOPLEVEL_DHCP4 = 415,
-        TOKEN_SUB_DHCP4 = 416,
-        TOKEN_SUB_INTERFACES4 = 417,
-        TOKEN_SUB_SUBNET4 = 418,
-        TOKEN_SUB_POOL4 = 419,
-        TOKEN_SUB_RESERVATION = 420,
-        TOKEN_SUB_OPTION_DEFS = 421,
-        TOKEN_SUB_OPTION_DEF = 422,
-        TOKEN_SUB_OPTION_DATA = 423,
-        TOKEN_SUB_HOOKS_LIBRARY = 424,
-        TOKEN_SUB_DHCP_DDNS = 425,
-        TOKEN_SUB_LOGGING = 426,
-        TOKEN_SUB_CONFIG_CONTROL = 427,
-        TOKEN_STRING = 428,
-        TOKEN_INTEGER = 429,
-        TOKEN_FLOAT = 430,
-        TOKEN_BOOLEAN = 431
+      enum token_kind_type
+      {
+        TOKEN_PARSER4_EMPTY = -2,
+    TOKEN_END = 0,                 // "end of file"
+    TOKEN_PARSER4_error = 256,     // error
+    TOKEN_PARSER4_UNDEF = 257,     // "invalid token"
+    TOKEN_COMMA = 258,             // ","
+    TOKEN_COLON = 259,             // ":"
+    TOKEN_LSQUARE_BRACKET = 260,   // "["
+    TOKEN_RSQUARE_BRACKET = 261,   // "]"
+    TOKEN_LCURLY_BRACKET = 262,    // "{"
+    TOKEN_RCURLY_BRACKET = 263,    // "}"
+    TOKEN_NULL_TYPE = 264,         // "null"
+    TOKEN_DHCP4 = 265,             // "Dhcp4"
+    TOKEN_CONFIG_CONTROL = 266,    // "config-control"
+    TOKEN_CONFIG_DATABASES = 267,  // "config-databases"
+    TOKEN_CONFIG_FETCH_WAIT_TIME = 268, // "config-fetch-wait-time"
+    TOKEN_NOTIFY_FIFO = 269,       // "notify-fifo"
+    TOKEN_INTERFACES_CONFIG = 270, // "interfaces-config"
+    TOKEN_INTERFACES = 271,        // "interfaces"
+    TOKEN_DHCP_SOCKET_TYPE = 272,  // "dhcp-socket-type"
+    TOKEN_RAW = 273,               // "raw"
+    TOKEN_UDP = 274,               // "udp"
+    TOKEN_OUTBOUND_INTERFACE = 275, // "outbound-interface"
+    TOKEN_SAME_AS_INBOUND = 276,   // "same-as-inbound"
+    TOKEN_USE_ROUTING = 277,       // "use-routing"
+    TOKEN_RE_DETECT = 278,         // "re-detect"
+    TOKEN_SANITY_CHECKS = 279,     // "sanity-checks"
+    TOKEN_LEASE_CHECKS = 280,      // "lease-checks"
+    TOKEN_ECHO_CLIENT_ID = 281,    // "echo-client-id"
+    TOKEN_MATCH_CLIENT_ID = 282,   // "match-client-id"
+    TOKEN_AUTHORITATIVE = 283,     // "authoritative"
+    TOKEN_NEXT_SERVER = 284,       // "next-server"
+    TOKEN_SERVER_HOSTNAME = 285,   // "server-hostname"
+    TOKEN_BOOT_FILE_NAME = 286,    // "boot-file-name"
+    TOKEN_LEASE_DATABASE = 287,    // "lease-database"
+    TOKEN_HOSTS_DATABASE = 288,    // "hosts-database"
+    TOKEN_HOSTS_DATABASES = 289,   // "hosts-databases"
+    TOKEN_TYPE = 290,              // "type"
+    TOKEN_MEMFILE = 291,           // "memfile"
+    TOKEN_MYSQL = 292,             // "mysql"
+    TOKEN_POSTGRESQL = 293,        // "postgresql"
+    TOKEN_CQL = 294,               // "cql"
+    TOKEN_USER = 295,              // "user"
+    TOKEN_PASSWORD = 296,          // "password"
+    TOKEN_HOST = 297,              // "host"
+    TOKEN_PORT = 298,              // "port"
+    TOKEN_PERSIST = 299,           // "persist"
+    TOKEN_LFC_INTERVAL = 300,      // "lfc-interval"
+    TOKEN_READONLY = 301,          // "readonly"
+    TOKEN_CONNECT_TIMEOUT = 302,   // "connect-timeout"
+    TOKEN_CONTACT_POINTS = 303,    // "contact-points"
+    TOKEN_KEYSPACE = 304,          // "keyspace"
+    TOKEN_CONSISTENCY = 305,       // "consistency"
+    TOKEN_SERIAL_CONSISTENCY = 306, // "serial-consistency"
+    TOKEN_MAX_RECONNECT_TRIES = 307, // "max-reconnect-tries"
+    TOKEN_RECONNECT_WAIT_TIME = 308, // "reconnect-wait-time"
+    TOKEN_REQUEST_TIMEOUT = 309,   // "request-timeout"
+    TOKEN_TCP_KEEPALIVE = 310,     // "tcp-keepalive"
+    TOKEN_TCP_NODELAY = 311,       // "tcp-nodelay"
+    TOKEN_POOL_SIZE = 312,         // "pool-size"
+    TOKEN_VALID_LIFETIME = 313,    // "valid-lifetime"
+    TOKEN_MIN_VALID_LIFETIME = 314, // "min-valid-lifetime"
+    TOKEN_MAX_VALID_LIFETIME = 315, // "max-valid-lifetime"
+    TOKEN_RENEW_TIMER = 316,       // "renew-timer"
+    TOKEN_REBIND_TIMER = 317,      // "rebind-timer"
+    TOKEN_CALCULATE_TEE_TIMES = 318, // "calculate-tee-times"
+    TOKEN_T1_PERCENT = 319,        // "t1-percent"
+    TOKEN_T2_PERCENT = 320,        // "t2-percent"
+    TOKEN_CACHE_THRESHOLD = 321,   // "cache-threshold"
+    TOKEN_LEASE_LOOKUP_THREADS = 322, // "lease-lookup-threads"
+    TOKEN_PACKET_ARENA_CHUNK_SIZE = 323, // "packet-arena-chunk-size"
+    TOKEN_PACKET_SLOW_THRESHOLD = 324, // "packet-slow-threshold"
+    TOKEN_HOST_FILTER_REBUILD_INTERVAL = 325, // "host-filter-rebuild-interval"
+    TOKEN_DECLINE_PROBATION_PERIOD = 326, // "decline-probation-period"
+    TOKEN_SERVER_TAG = 327,        // "server-tag"
+    TOKEN_SUBNET4 = 328,           // "subnet4"
+    TOKEN_SUBNET_4O6_INTERFACE = 329, // "4o6-interface"
+    TOKEN_SUBNET_4O6_INTERFACE_ID = 330, // "4o6-interface-id"
+    TOKEN_SUBNET_4O6_SUBNET = 331, // "4o6-subnet"
+    TOKEN_OPTION_DEF = 332,        // "option-def"
+    TOKEN_OPTION_DATA = 333,       // "option-data"
+    TOKEN_NAME = 334,              // "name"
+    TOKEN_DATA = 335,              // "data"
+    TOKEN_CODE = 336,              // "code"
+    TOKEN_SPACE = 337,             // "space"
+    TOKEN_CSV_FORMAT = 338,        // "csv-format"
+    TOKEN_ALWAYS_SEND = 339,       // "always-send"
+    TOKEN_RECORD_TYPES = 340,      // "record-types"
+    TOKEN_ENCAPSULATE = 341,       // "encapsulate"
+    TOKEN_ARRAY = 342,             // "array"
+    TOKEN_SHARED_NETWORKS = 343,   // "shared-networks"
+    TOKEN_POOLS = 344,             // "pools"
+    TOKEN_POOL = 345,              // "pool"
+    TOKEN_USER_CONTEXT = 346,      // "user-context"
+    TOKEN_COMMENT = 347,           // "comment"
+    TOKEN_SUBNET = 348,            // "subnet"
+    TOKEN_INTERFACE = 349,         // "interface"
+    TOKEN_ID = 350,                // "id"
+    TOKEN_RESERVATION_MODE = 351,  // "reservation-mode"
+    TOKEN_DISABLED = 352,          // "disabled"
+    TOKEN_OUT_OF_POOL = 353,       // "out-of-pool"
+    TOKEN_GLOBAL = 354,            // "global"
+    TOKEN_ALL = 355,               // "all"
+    TOKEN_HOST_RESERVATION_IDENTIFIERS = 356, // "host-reservation-identifiers"
+    TOKEN_CLIENT_CLASSES = 357,    // "client-classes"
+    TOKEN_REQUIRE_CLIENT_CLASSES = 358, // "require-client-classes"
+    TOKEN_TEST = 359,              // "test"
+    TOKEN_ONLY_IF_REQUIRED = 360,  // "only-if-required"
+    TOKEN_CLIENT_CLASS = 361,      // "client-class"
+    TOKEN_RESERVATIONS = 362,      // "reservations"
+    TOKEN_DUID = 363,              // "duid"
+    TOKEN_HW_ADDRESS = 364,        // "hw-address"
+    TOKEN_CIRCUIT_ID = 365,        // "circuit-id"
+    TOKEN_CLIENT_ID = 366,         // "client-id"
+    TOKEN_HOSTNAME = 367,          // "hostname"
+    TOKEN_FLEX_ID = 368,           // "flex-id"
+    TOKEN_RELAY = 369,             // "relay"
+    TOKEN_IP_ADDRESS = 370,        // "ip-address"
+    TOKEN_IP_ADDRESSES = 371,      // "ip-addresses"
+    TOKEN_HOOKS_LIBRARIES = 372,   // "hooks-libraries"
+    TOKEN_LIBRARY = 373,           // "library"
+    TOKEN_PARAMETERS = 374,        // "parameters"
+    TOKEN_EXPIRED_LEASES_PROCESSING = 375, // "expired-leases-processing"
+    TOKEN_RECLAIM_TIMER_WAIT_TIME = 376, // "reclaim-timer-wait-time"
+    TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 377, // "flush-reclaimed-timer-wait-time"
+    TOKEN_HOLD_RECLAIMED_TIME = 378, // "hold-reclaimed-time"
+    TOKEN_MAX_RECLAIM_LEASES = 379, // "max-reclaim-leases"
+    TOKEN_MAX_RECLAIM_TIME = 380,  // "max-reclaim-time"
+    TOKEN_UNWARNED_RECLAIM_CYCLES = 381, // "unwarned-reclaim-cycles"
+    TOKEN_DHCP4O6_PORT = 382,      // "dhcp4o6-port"
+    TOKEN_CONTROL_SOCKET = 383,    // "control-socket"
+    TOKEN_SOCKET_TYPE = 384,       // "socket-type"
+    TOKEN_SOCKET_NAME = 385,       // "socket-name"
+    TOKEN_DHCP_QUEUE_CONTROL = 386, // "dhcp-queue-control"
+    TOKEN_DHCP_DDNS = 387,         // "dhcp-ddns"
+    TOKEN_ENABLE_UPDATES = 388,    // "enable-updates"
+    TOKEN_QUALIFYING_SUFFIX = 389, // "qualifying-suffix"
+    TOKEN_SERVER_IP = 390,         // "server-ip"
+    TOKEN_SERVER_PORT = 391,       // "server-port"
+    TOKEN_SENDER_IP = 392,         // "sender-ip"
+    TOKEN_SENDER_PORT = 393,       // "sender-port"
+    TOKEN_MAX_QUEUE_SIZE = 394,    // "max-queue-size"
+    TOKEN_NCR_PROTOCOL = 395,      // "ncr-protocol"
+    TOKEN_NCR_FORMAT = 396,        // "ncr-format"
+    TOKEN_OVERRIDE_NO_UPDATE = 397, // "override-no-update"
+    TOKEN_OVERRIDE_CLIENT_UPDATE = 398, // "override-client-update"
+    TOKEN_REPLACE_CLIENT_NAME = 399, // "replace-client-name"
+    TOKEN_GENERATED_PREFIX = 400,  // "generated-prefix"
+    TOKEN_TCP = 401,               // "tcp"
+    TOKEN_JSON = 402,              // "JSON"
+    TOKEN_BINARY = 403,            // "BINARY"
+    TOKEN_WHEN_PRESENT = 404,      // "when-present"
+    TOKEN_NEVER = 405,             // "never"
+    TOKEN_ALWAYS = 406,            // "always"
+    TOKEN_WHEN_NOT_PRESENT = 407,  // "when-not-present"
+    TOKEN_HOSTNAME_CHAR_SET = 408, // "hostname-char-set"
+    TOKEN_HOSTNAME_CHAR_REPLACEMENT = 409, // "hostname-char-replacement"
+    TOKEN_LOGGING = 410,           // "Logging"
+    TOKEN_LOGGERS = 411,           // "loggers"
+    TOKEN_OUTPUT_OPTIONS = 412,    // "output_options"
+    TOKEN_OUTPUT = 413,            // "output"
+    TOKEN_DEBUGLEVEL = 414,        // "debuglevel"
+    TOKEN_SEVERITY = 415,          // "severity"
+    TOKEN_FLUSH = 416,             // "flush"
+    TOKEN_MAXSIZE = 417,           // "maxsize"
+    TOKEN_MAXVER = 418,            // "maxver"
+    TOKEN_ASYNC = 419,             // "async"
+    TOKEN_ASYNC_QUEUE_SIZE = 420,  // "async-queue-size"
+    TOKEN_DHCP6 = 421,             // "Dhcp6"
+    TOKEN_DHCPDDNS = 422,          // "DhcpDdns"
+    TOKEN_CONTROL_AGENT = 423,     // "Control-agent"
+    TOKEN_TOPLEVEL_JSON = 424,     // TOPLEVEL_JSON
+    TOKEN_TOPLEVEL_DHCP4 = 425,    // TOPLEVEL_DHCP4
+    TOKEN_SUB_DHCP4 = 426,         // SUB_DHCP4
+    TOKEN_SUB_INTERFACES4 = 427,   // SUB_INTERFACES4
+    TOKEN_SUB_SUBNET4 = 428,       // SUB_SUBNET4
+    TOKEN_SUB_POOL4 = 429,         // SUB_POOL4
+    TOKEN_SUB_RESERVATION = 430,   // SUB_RESERVATION
+    TOKEN_SUB_OPTION_DEFS = 431,   // SUB_OPTION_DEFS
+    TOKEN_SUB_OPTION_DEF = 432,    // SUB_OPTION_DEF
+    TOKEN_SUB_OPTION_DATA = 433,   // SUB_OPTION_DATA
+    TOKEN_SUB_HOOKS_LIBRARY = 434, // SUB_HOOKS_LIBRARY
+    TOKEN_SUB_DHCP_DDNS = 435,     // SUB_DHCP_DDNS
+    TOKEN_SUB_LOGGING = 436,       // SUB_LOGGING
+    TOKEN_SUB_CONFIG_CONTROL = 437, // SUB_CONFIG_CONTROL
+    TOKEN_STRING = 438,            // "constant string"
+    TOKEN_INTEGER = 439,           // "integer"
+    TOKEN_FLOAT = 440,             // "floating point"
+    TOKEN_BOOLEAN = 441            // "boolean"
       };
+      /// Backward compatibility alias (Bison 3.6).
+      typedef token_kind_type yytokentype;
     };
 
-    /// (External) token type, as returned by yylex.
-    typedef token::yytokentype token_type;
+    /// Token kind, as returned by yylex.
+    typedef token::token_kind_type token_kind_type;
 
-    /// Symbol type: an internal symbol number.
-    typedef int symbol_number_type;
+    /// Backward compatibility alias (Bison 3.6).
+    typedef token_kind_type token_type;
 
-    /// The symbol type number to denote an empty symbol.
-    enum { empty_symbol = -2 };
+    /// Symbol kinds.
+    struct symbol_kind
+    {
+      enum symbol_kind_type
+      {
+        YYNTOKENS = 187, ///< Number of tokens.
+        S_YYEMPTY = -2,
+        S_YYEOF = 0,                             // "end of file"
+        S_YYerror = 1,                           // error
+        S_YYUNDEF = 2,                           // "invalid token"
+        S_COMMA = 3,                             // ","
+        S_COLON = 4,                             // ":"
+        S_LSQUARE_BRACKET = 5,                   // "["
+        S_RSQUARE_BRACKET = 6,                   // "]"
+        S_LCURLY_BRACKET = 7,                    // "{"
+        S_RCURLY_BRACKET = 8,                    // "}"
+        S_NULL_TYPE = 9,                         // "null"
+        S_DHCP4 = 10,                            // "Dhcp4"
+        S_CONFIG_CONTROL = 11,                   // "config-control"
+        S_CONFIG_DATABASES = 12,                 // "config-databases"
+        S_CONFIG_FETCH_WAIT_TIME = 13,           // "config-fetch-wait-time"
+        S_NOTIFY_FIFO = 14,                      // "notify-fifo"
+        S_INTERFACES_CONFIG = 15,                // "interfaces-config"
+        S_INTERFACES = 16,                       // "interfaces"
+        S_DHCP_SOCKET_TYPE = 17,                 // "dhcp-socket-type"
+        S_RAW = 18,                              // "raw"
+        S_UDP = 19,                              // "udp"
+        S_OUTBOUND_INTERFACE = 20,               // "outbound-interface"
+        S_SAME_AS_INBOUND = 21,                  // "same-as-inbound"
+        S_USE_ROUTING = 22,                      // "use-routing"
+        S_RE_DETECT = 23,                        // "re-detect"
+        S_SANITY_CHECKS = 24,                    // "sanity-checks"
+        S_LEASE_CHECKS = 25,                     // "lease-checks"
+        S_ECHO_CLIENT_ID = 26,                   // "echo-client-id"
+        S_MATCH_CLIENT_ID = 27,                  // "match-client-id"
+        S_AUTHORITATIVE = 28,                    // "authoritative"
+        S_NEXT_SERVER = 29,                      // "next-server"
+        S_SERVER_HOSTNAME = 30,                  // "server-hostname"
+        S_BOOT_FILE_NAME = 31,                   // "boot-file-name"
+        S_LEASE_DATABASE = 32,                   // "lease-database"
+        S_HOSTS_DATABASE = 33,                   // "hosts-database"
+        S_HOSTS_DATABASES = 34,                  // "hosts-databases"
+        S_TYPE = 35,                             // "type"
+        S_MEMFILE = 36,                          // "memfile"
+        S_MYSQL = 37,                            // "mysql"
+        S_POSTGRESQL = 38,                       // "postgresql"
+        S_CQL = 39,                              // "cql"
+        S_USER = 40,                             // "user"
+        S_PASSWORD = 41,                         // "password"
+        S_HOST = 42,                             // "host"
+        S_PORT = 43,                             // "port"
+        S_PERSIST = 44,                          // "persist"
+        S_LFC_INTERVAL = 45,                     // "lfc-interval"
+        S_READONLY = 46,                         // "readonly"
+        S_CONNECT_TIMEOUT = 47,                  // "connect-timeout"
+        S_CONTACT_POINTS = 48,                   // "contact-points"
+        S_KEYSPACE = 49,                         // "keyspace"
+        S_CONSISTENCY = 50,                      // "consistency"
+        S_SERIAL_CONSISTENCY = 51,               // "serial-consistency"
+        S_MAX_RECONNECT_TRIES = 52,              // "max-reconnect-tries"
+        S_RECONNECT_WAIT_TIME = 53,              // "reconnect-wait-time"
+        S_REQUEST_TIMEOUT = 54,                  // "request-timeout"
+        S_TCP_KEEPALIVE = 55,                    // "tcp-keepalive"
+        S_TCP_NODELAY = 56,                      // "tcp-nodelay"
+        S_POOL_SIZE = 57,                        // "pool-size"
+        S_VALID_LIFETIME = 58,                   // "valid-lifetime"
+        S_MIN_VALID_LIFETIME = 59,               // "min-valid-lifetime"
+        S_MAX_VALID_LIFETIME = 60,               // "max-valid-lifetime"
+        S_RENEW_TIMER = 61,                      // "renew-timer"
+        S_REBIND_TIMER = 62,                     // "rebind-timer"
+        S_CALCULATE_TEE_TIMES = 63,              // "calculate-tee-times"
+        S_T1_PERCENT = 64,                       // "t1-percent"
+        S_T2_PERCENT = 65,                       // "t2-percent"
+        S_CACHE_THRESHOLD = 66,                  // "cache-threshold"
+        S_LEASE_LOOKUP_THREADS = 67,             // "lease-lookup-threads"
+        S_PACKET_ARENA_CHUNK_SIZE = 68,          // "packet-arena-chunk-size"
+        S_PACKET_SLOW_THRESHOLD = 69,            // "packet-slow-threshold"
+        S_HOST_FILTER_REBUILD_INTERVAL = 70,     // "host-filter-rebuild-interval"
+        S_DECLINE_PROBATION_PERIOD = 71,         // "decline-probation-period"
+        S_SERVER_TAG = 72,                       // "server-tag"
+        S_SUBNET4 = 73,                          // "subnet4"
+        S_SUBNET_4O6_INTERFACE = 74,             // "4o6-interface"
+        S_SUBNET_4O6_INTERFACE_ID = 75,          // "4o6-interface-id"
+        S_SUBNET_4O6_SUBNET = 76,                // "4o6-subnet"
+        S_OPTION_DEF = 77,                       // "option-def"
+        S_OPTION_DATA = 78,                      // "option-data"
+        S_NAME = 79,                             // "name"
+        S_DATA = 80,                             // "data"
+        S_CODE = 81,                             // "code"
+        S_SPACE = 82,                            // "space"
+        S_CSV_FORMAT = 83,                       // "csv-format"
+        S_ALWAYS_SEND = 84,                      // "always-send"
+        S_RECORD_TYPES = 85,                     // "record-types"
+        S_ENCAPSULATE = 86,                      // "encapsulate"
+        S_ARRAY = 87,                            // "array"
+        S_SHARED_NETWORKS = 88,                  // "shared-networks"
+        S_POOLS = 89,                            // "pools"
+        S_POOL = 90,                             // "pool"
+        S_USER_CONTEXT = 91,                     // "user-context"
+        S_COMMENT = 92,                          // "comment"
+        S_SUBNET = 93,                           // "subnet"
+        S_INTERFACE = 94,                        // "interface"
+        S_ID = 95,                               // "id"
+        S_RESERVATION_MODE = 96,                 // "reservation-mode"
+        S_DISABLED = 97,                         // "disabled"
+        S_OUT_OF_POOL = 98,                      // "out-of-pool"
+        S_GLOBAL = 99,                           // "global"
+        S_ALL = 100,                             // "all"
+        S_HOST_RESERVATION_IDENTIFIERS = 101,    // "host-reservation-identifiers"
+        S_CLIENT_CLASSES = 102,                  // "client-classes"
+        S_REQUIRE_CLIENT_CLASSES = 103,          // "require-client-classes"
+        S_TEST = 104,                            // "test"
+        S_ONLY_IF_REQUIRED = 105,                // "only-if-required"
+        S_CLIENT_CLASS = 106,                    // "client-class"
+        S_RESERVATIONS = 107,                    // "reservations"
+        S_DUID = 108,                            // "duid"
+        S_HW_ADDRESS = 109,                      // "hw-address"
+        S_CIRCUIT_ID = 110,                      // "circuit-id"
+        S_CLIENT_ID = 111,                       // "client-id"
+        S_HOSTNAME = 112,                        // "hostname"
+        S_FLEX_ID = 113,                         // "flex-id"
+        S_RELAY = 114,                           // "relay"
+        S_IP_ADDRESS = 115,                      // "ip-address"
+        S_IP_ADDRESSES = 116,                    // "ip-addresses"
+        S_HOOKS_LIBRARIES = 117,                 // "hooks-libraries"
+        S_LIBRARY = 118,                         // "library"
+        S_PARAMETERS = 119,                      // "parameters"
+        S_EXPIRED_LEASES_PROCESSING = 120,       // "expired-leases-processing"
+        S_RECLAIM_TIMER_WAIT_TIME = 121,         // "reclaim-timer-wait-time"
+        S_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 122, // "flush-reclaimed-timer-wait-time"
+        S_HOLD_RECLAIMED_TIME = 123,             // "hold-reclaimed-time"
+        S_MAX_RECLAIM_LEASES = 124,              // "max-reclaim-leases"
+        S_MAX_RECLAIM_TIME = 125,                // "max-reclaim-time"
+        S_UNWARNED_RECLAIM_CYCLES = 126,         // "unwarned-reclaim-cycles"
+        S_DHCP4O6_PORT = 127,                    // "dhcp4o6-port"
+        S_CONTROL_SOCKET = 128,                  // "control-socket"
+        S_SOCKET_TYPE = 129,                     // "socket-type"
+        S_SOCKET_NAME = 130,                     // "socket-name"
+        S_DHCP_QUEUE_CONTROL = 131,              // "dhcp-queue-control"
+        S_DHCP_DDNS = 132,                       // "dhcp-ddns"
+        S_ENABLE_UPDATES = 133,                  // "enable-updates"
+        S_QUALIFYING_SUFFIX = 134,               // "qualifying-suffix"
+        S_SERVER_IP = 135,                       // "server-ip"
+        S_SERVER_PORT = 136,                     // "server-port"
+        S_SENDER_IP = 137,                       // "sender-ip"
+        S_SENDER_PORT = 138,                     // "sender-port"
+        S_MAX_QUEUE_SIZE = 139,                  // "max-queue-size"
+        S_NCR_PROTOCOL = 140,                    // "ncr-protocol"
+        S_NCR_FORMAT = 141,                      // "ncr-format"
+        S_OVERRIDE_NO_UPDATE = 142,              // "override-no-update"
+        S_OVERRIDE_CLIENT_UPDATE = 143,          // "override-client-update"
+        S_REPLACE_CLIENT_NAME = 144,             // "replace-client-name"
+        S_GENERATED_PREFIX = 145,                // "generated-prefix"
+        S_TCP = 146,                             // "tcp"
+        S_JSON = 147,                            // "JSON"
+        S_BINARY = 148,                          // "BINARY"
+        S_WHEN_PRESENT = 149,                    // "when-present"
+        S_NEVER = 150,                           // "never"
+        S_ALWAYS = 151,                          // "always"
+        S_WHEN_NOT_PRESENT = 152,                // "when-not-present"
+        S_HOSTNAME_CHAR_SET = 153,               // "hostname-char-set"
+        S_HOSTNAME_CHAR_REPLACEMENT = 154,       // "hostname-char-replacement"
+        S_LOGGING = 155,                         // "Logging"
+        S_LOGGERS = 156,                         // "loggers"
+        S_OUTPUT_OPTIONS = 157,                  // "output_options"
+        S_OUTPUT = 158,                          // "output"
+        S_DEBUGLEVEL = 159,                      // "debuglevel"
+        S_SEVERITY = 160,                        // "severity"
+        S_FLUSH = 161,                           // "flush"
+        S_MAXSIZE = 162,                         // "maxsize"
+        S_MAXVER = 163,                          // "maxver"
+        S_ASYNC = 164,                           // "async"
+        S_ASYNC_QUEUE_SIZE = 165,                // "async-queue-size"
+        S_DHCP6 = 166,                           // "Dhcp6"
+        S_DHCPDDNS = 167,                        // "DhcpDdns"
+        S_CONTROL_AGENT = 168,                   // "Control-agent"
+        S_TOPLEVEL_JSON = 169,                   // TOPLEVEL_JSON
+        S_TOPLEVEL_DHCP4 = 170,                  // TOPLEVEL_DHCP4
+        S_SUB_DHCP4 = 171,                       // SUB_DHCP4
+        S_SUB_INTERFACES4 = 172,                 // SUB_INTERFACES4
+        S_SUB_SUBNET4 = 173,                     // SUB_SUBNET4
+        S_SUB_POOL4 = 174,                       // SUB_POOL4
+        S_SUB_RESERVATION = 175,                 // SUB_RESERVATION
+        S_SUB_OPTION_DEFS = 176,                 // SUB_OPTION_DEFS
+        S_SUB_OPTION_DEF = 177,                  // SUB_OPTION_DEF
+        S_SUB_OPTION_DATA = 178,                 // SUB_OPTION_DATA
+        S_SUB_HOOKS_LIBRARY = 179,               // SUB_HOOKS_LIBRARY
+        S_SUB_DHCP_DDNS = 180,                   // SUB_DHCP_DDNS
+        S_SUB_LOGGING = 181,                     // SUB_LOGGING
+        S_SUB_CONFIG_CONTROL = 182,              // SUB_CONFIG_CONTROL
+        S_STRING = 183,                          // "constant string"
+        S_INTEGER = 184,                         // "integer"
+        S_FLOAT = 185,                           // "floating point"
+        S_BOOLEAN = 186,                         // "boolean"
+        S_YYACCEPT = 187,                        // $accept
+        S_start = 188,                           // start
+        S_189_1 = 189,                           // $@1
+        S_190_2 = 190,                           // $@2
+        S_191_3 = 191,                           // $@3
+        S_192_4 = 192,                           // $@4
+        S_193_5 = 193,                           // $@5
+        S_194_6 = 194,                           // $@6
+        S_195_7 = 195,                           // $@7
+        S_196_8 = 196,                           // $@8
+        S_197_9 = 197,                           // $@9
+        S_198_10 = 198,                          // $@10
+        S_199_11 = 199,                          // $@11
+        S_200_12 = 200,                          // $@12
+        S_201_13 = 201,                          // $@13
+        S_202_14 = 202,                          // $@14
+        S_value = 203,                           // value
+        S_sub_json = 204,                        // sub_json
+        S_map2 = 205,                            // map2
+        S_206_15 = 206,                          // $@15
+        S_map_value = 207,                       // map_value
+        S_map_content = 208,                     // map_content
+        S_not_empty_map = 209,                   // not_empty_map
+        S_list_generic = 210,                    // list_generic
+        S_211_16 = 211,                          // $@16
+        S_list_content = 212,                    // list_content
+        S_not_empty_list = 213,                  // not_empty_list
+        S_list_strings = 214,                    // list_strings
+        S_215_17 = 215,                          // $@17
+        S_list_strings_content = 216,            // list_strings_content
+        S_not_empty_list_strings = 217,          // not_empty_list_strings
+        S_unknown_map_entry = 218,               // unknown_map_entry
+        S_syntax_map = 219,                      // syntax_map
+        S_220_18 = 220,                          // $@18
+        S_global_objects = 221,                  // global_objects
+        S_global_object = 222,                   // global_object
+        S_dhcp4_object = 223,                    // dhcp4_object
+        S_224_19 = 224,                          // $@19
+        S_sub_dhcp4 = 225,                       // sub_dhcp4
+        S_226_20 = 226,                          // $@20
+        S_global_params = 227,                   // global_params
+        S_global_param = 228,                    // global_param
+        S_valid_lifetime = 229,                  // valid_lifetime
+        S_min_valid_lifetime = 230,              // min_valid_lifetime
+        S_max_valid_lifetime = 231,              // max_valid_lifetime
+        S_renew_timer = 232,                     // renew_timer
+        S_rebind_timer = 233,                    // rebind_timer
+        S_calculate_tee_times = 234,             // calculate_tee_times
+        S_t1_percent = 235,                      // t1_percent
+        S_t2_percent = 236,                      // t2_percent
+        S_cache_threshold = 237,                 // cache_threshold
+        S_lease_lookup_threads = 238,            // lease_lookup_threads
+        S_packet_arena_chunk_size = 239,         // packet_arena_chunk_size
+        S_packet_slow_threshold = 240,           // packet_slow_threshold
+        S_host_filter_rebuild_interval = 241,    // host_filter_rebuild_interval
+        S_decline_probation_period = 242,        // decline_probation_period
+        S_server_tag = 243,                      // server_tag
+        S_244_21 = 244,                          // $@21
+        S_echo_client_id = 245,                  // echo_client_id
+        S_match_client_id = 246,                 // match_client_id
+        S_authoritative = 247,                   // authoritative
+        S_interfaces_config = 248,               // interfaces_config
+        S_249_22 = 249,                          // $@22
+        S_interfaces_config_params = 250,        // interfaces_config_params
+        S_interfaces_config_param = 251,         // interfaces_config_param
+        S_sub_interfaces4 = 252,                 // sub_interfaces4
+        S_253_23 = 253,                          // $@23
+        S_interfaces_list = 254,                 // interfaces_list
+        S_255_24 = 255,                          // $@24
+        S_dhcp_socket_type = 256,                // dhcp_socket_type
+        S_257_25 = 257,                          // $@25
+        S_socket_type = 258,                     // socket_type
+        S_outbound_interface = 259,              // outbound_interface
+        S_260_26 = 260,                          // $@26
+        S_outbound_interface_value = 261,        // outbound_interface_value
+        S_re_detect = 262,                       // re_detect
+        S_lease_database = 263,                  // lease_database
+        S_264_27 = 264,                          // $@27
+        S_sanity_checks = 265,                   // sanity_checks
+        S_266_28 = 266,                          // $@28
+        S_sanity_checks_params = 267,            // sanity_checks_params
+        S_sanity_checks_param = 268,             // sanity_checks_param
+        S_lease_checks = 269,                    // lease_checks
+        S_270_29 = 270,                          // $@29
+        S_hosts_database = 271,                  // hosts_database
+        S_272_30 = 272,                          // $@30
+        S_hosts_databases = 273,                 // hosts_databases
+        S_274_31 = 274,                          // $@31
+        S_database_list = 275,                   // database_list
+        S_not_empty_database_list = 276,         // not_empty_database_list
+        S_database = 277,                        // database
+        S_278_32 = 278,                          // $@32
+        S_database_map_params = 279,             // database_map_params
+        S_database_map_param = 280,              // database_map_param
+        S_database_type = 281,                   // database_type
+        S_282_33 = 282,                          // $@33
+        S_db_type = 283,                         // db_type
+        S_user = 284,                            // user
+        S_285_34 = 285,                          // $@34
+        S_password = 286,                        // password
+        S_287_35 = 287,                          // $@35
+        S_host = 288,                            // host
+        S_289_36 = 289,                          // $@36
+        S_port = 290,                            // port
+        S_name = 291,                            // name
+        S_292_37 = 292,                          // $@37
+        S_persist = 293,                         // persist
+        S_lfc_interval = 294,                    // lfc_interval
+        S_readonly = 295,                        // readonly
+        S_connect_timeout = 296,                 // connect_timeout
+        S_request_timeout = 297,                 // request_timeout
+        S_tcp_keepalive = 298,                   // tcp_keepalive
+        S_tcp_nodelay = 299,                     // tcp_nodelay
+        S_pool_size = 300,                       // pool_size
+        S_contact_points = 301,                  // contact_points
+        S_302_38 = 302,                          // $@38
+        S_keyspace = 303,                        // keyspace
+        S_304_39 = 304,                          // $@39
+        S_consistency = 305,                     // consistency
+        S_306_40 = 306,                          // $@40
+        S_serial_consistency = 307,              // serial_consistency
+        S_308_41 = 308,                          // $@41
+        S_max_reconnect_tries = 309,             // max_reconnect_tries
+        S_reconnect_wait_time = 310,             // reconnect_wait_time
+        S_host_reservation_identifiers = 311,    // host_reservation_identifiers
+        S_312_42 = 312,                          // $@42
+        S_host_reservation_identifiers_list = 313, // host_reservation_identifiers_list
+        S_host_reservation_identifier = 314,     // host_reservation_identifier
+        S_duid_id = 315,                         // duid_id
+        S_hw_address_id = 316,                   // hw_address_id
+        S_circuit_id = 317,                      // circuit_id
+        S_client_id = 318,                       // client_id
+        S_flex_id = 319,                         // flex_id
+        S_hooks_libraries = 320,                 // hooks_libraries
+        S_321_43 = 321,                          // $@43
+        S_hooks_libraries_list = 322,            // hooks_libraries_list
+        S_not_empty_hooks_libraries_list = 323,  // not_empty_hooks_libraries_list
+        S_hooks_library = 324,                   // hooks_library
+        S_325_44 = 325,                          // $@44
+        S_sub_hooks_library = 326,               // sub_hooks_library
+        S_327_45 = 327,                          // $@45
+        S_hooks_params = 328,                    // hooks_params
+        S_hooks_param = 329,                     // hooks_param
+        S_library = 330,                         // library
+        S_331_46 = 331,                          // $@46
+        S_parameters = 332,                      // parameters
+        S_333_47 = 333,                          // $@47
+        S_expired_leases_processing = 334,       // expired_leases_processing
+        S_335_48 = 335,                          // $@48
+        S_expired_leases_params = 336,           // expired_leases_params
+        S_expired_leases_param = 337,            // expired_leases_param
+        S_reclaim_timer_wait_time = 338,         // reclaim_timer_wait_time
+        S_flush_reclaimed_timer_wait_time = 339, // flush_reclaimed_timer_wait_time
+        S_hold_reclaimed_time = 340,             // hold_reclaimed_time
+        S_max_reclaim_leases = 341,              // max_reclaim_leases
+        S_max_reclaim_time = 342,                // max_reclaim_time
+        S_unwarned_reclaim_cycles = 343,         // unwarned_reclaim_cycles
+        S_subnet4_list = 344,                    // subnet4_list
+        S_345_49 = 345,                          // $@49
+        S_subnet4_list_content = 346,            // subnet4_list_content
+        S_not_empty_subnet4_list = 347,          // not_empty_subnet4_list
+        S_subnet4 = 348,                         // subnet4
+        S_349_50 = 349,                          // $@50
+        S_sub_subnet4 = 350,                     // sub_subnet4
+        S_351_51 = 351,                          // $@51
+        S_subnet4_params = 352,                  // subnet4_params
+        S_subnet4_param = 353,                   // subnet4_param
+        S_subnet = 354,                          // subnet
+        S_355_52 = 355,                          // $@52
+        S_subnet_4o6_interface = 356,            // subnet_4o6_interface
+        S_357_53 = 357,                          // $@53
+        S_subnet_4o6_interface_id = 358,         // subnet_4o6_interface_id
+        S_359_54 = 359,                          // $@54
+        S_subnet_4o6_subnet = 360,               // subnet_4o6_subnet
+        S_361_55 = 361,                          // $@55
+        S_interface = 362,                       // interface
+        S_363_56 = 363,                          // $@56
+        S_client_class = 364,                    // client_class
+        S_365_57 = 365,                          // $@57
+        S_require_client_classes = 366,          // require_client_classes
+        S_367_58 = 367,                          // $@58
+        S_reservation_mode = 368,                // reservation_mode
+        S_369_59 = 369,                          // $@59
+        S_hr_mode = 370,                         // hr_mode
+        S_id = 371,                              // id
+        S_shared_networks = 372,                 // shared_networks
+        S_373_60 = 373,                          // $@60
+        S_shared_networks_content = 374,         // shared_networks_content
+        S_shared_networks_list = 375,            // shared_networks_list
+        S_shared_network = 376,                  // shared_network
+        S_377_61 = 377,                          // $@61
+        S_shared_network_params = 378,           // shared_network_params
+        S_shared_network_param = 379,            // shared_network_param
+        S_option_def_list = 380,                 // option_def_list
+        S_381_62 = 381,                          // $@62
+        S_sub_option_def_list = 382,             // sub_option_def_list
+        S_383_63 = 383,                          // $@63
+        S_option_def_list_content = 384,         // option_def_list_content
+        S_not_empty_option_def_list = 385,       // not_empty_option_def_list
+        S_option_def_entry = 386,                // option_def_entry
+        S_387_64 = 387,                          // $@64
+        S_sub_option_def = 388,                  // sub_option_def
+        S_389_65 = 389,                          // $@65
+        S_option_def_params = 390,               // option_def_params
+        S_not_empty_option_def_params = 391,     // not_empty_option_def_params
+        S_option_def_param = 392,                // option_def_param
+        S_option_def_name = 393,                 // option_def_name
+        S_code = 394,                            // code
+        S_option_def_code = 395,                 // option_def_code
+        S_option_def_type = 396,                 // option_def_type
+        S_397_66 = 397,                          // $@66
+        S_option_def_record_types = 398,         // option_def_record_types
+        S_399_67 = 399,                          // $@67
+        S_space = 400,                           // space
+        S_401_68 = 401,                          // $@68
+        S_option_def_space = 402,                // option_def_space
+        S_option_def_encapsulate = 403,          // option_def_encapsulate
+        S_404_69 = 404,                          // $@69
+        S_option_def_array = 405,                // option_def_array
+        S_option_data_list = 406,                // option_data_list
+        S_407_70 = 407,                          // $@70
+        S_option_data_list_content = 408,        // option_data_list_content
+        S_not_empty_option_data_list = 409,      // not_empty_option_data_list
+        S_option_data_entry = 410,               // option_data_entry
+        S_411_71 = 411,                          // $@71
+        S_sub_option_data = 412,                 // sub_option_data
+        S_413_72 = 413,                          // $@72
+        S_option_data_params = 414,              // option_data_params
+        S_not_empty_option_data_params = 415,    // not_empty_option_data_params
+        S_option_data_param = 416,               // option_data_param
+        S_option_data_name = 417,                // option_data_name
+        S_option_data_data = 418,                // option_data_data
+        S_419_73 = 419,                          // $@73
+        S_option_data_code = 420,                // option_data_code
+        S_option_data_space = 421,               // option_data_space
+        S_option_data_csv_format = 422,          // option_data_csv_format
+        S_option_data_always_send = 423,         // option_data_always_send
+        S_pools_list = 424,                      // pools_list
+        S_425_74 = 425,                          // $@74
+        S_pools_list_content = 426,              // pools_list_content
+        S_not_empty_pools_list = 427,            // not_empty_pools_list
+        S_pool_list_entry = 428,                 // pool_list_entry
+        S_429_75 = 429,                          // $@75
+        S_sub_pool4 = 430,                       // sub_pool4
+        S_431_76 = 431,                          // $@76
+        S_pool_params = 432,                     // pool_params
+        S_pool_param = 433,                      // pool_param
+        S_pool_entry = 434,                      // pool_entry
+        S_435_77 = 435,                          // $@77
+        S_user_context = 436,                    // user_context
+        S_437_78 = 437,                          // $@78
+        S_comment = 438,                         // comment
+        S_439_79 = 439,                          // $@79
+        S_reservations = 440,                    // reservations
+        S_441_80 = 441,                          // $@80
+        S_reservations_list = 442,               // reservations_list
+        S_not_empty_reservations_list = 443,     // not_empty_reservations_list
+        S_reservation = 444,                     // reservation
+        S_445_81 = 445,                          // $@81
+        S_sub_reservation = 446,                 // sub_reservation
+        S_447_82 = 447,                          // $@82
+        S_reservation_params = 448,              // reservation_params
+        S_not_empty_reservation_params = 449,    // not_empty_reservation_params
+        S_reservation_param = 450,               // reservation_param
+        S_next_server = 451,                     // next_server
+        S_452_83 = 452,                          // $@83
+        S_server_hostname = 453,                 // server_hostname
+        S_454_84 = 454,                          // $@84
+        S_boot_file_name = 455,                  // boot_file_name
+        S_456_85 = 456,                          // $@85
+        S_ip_address = 457,                      // ip_address
+        S_458_86 = 458,                          // $@86
+        S_ip_addresses = 459,                    // ip_addresses
+        S_460_87 = 460,                          // $@87
+        S_duid = 461,                            // duid
+        S_462_88 = 462,                          // $@88
+        S_hw_address = 463,                      // hw_address
+        S_464_89 = 464,                          // $@89
+        S_client_id_value = 465,                 // client_id_value
+        S_466_90 = 466,                          // $@90
+        S_circuit_id_value = 467,                // circuit_id_value
+        S_468_91 = 468,                          // $@91
+        S_flex_id_value = 469,                   // flex_id_value
+        S_470_92 = 470,                          // $@92
+        S_hostname = 471,                        // hostname
+        S_472_93 = 472,                          // $@93
+        S_reservation_client_classes = 473,      // reservation_client_classes
+        S_474_94 = 474,                          // $@94
+        S_relay = 475,                           // relay
+        S_476_95 = 476,                          // $@95
+        S_relay_map = 477,                       // relay_map
+        S_client_classes = 478,                  // client_classes
+        S_479_96 = 479,                          // $@96
+        S_client_classes_list = 480,             // client_classes_list
+        S_client_class_entry = 481,              // client_class_entry
+        S_482_97 = 482,                          // $@97
+        S_client_class_params = 483,             // client_class_params
+        S_not_empty_client_class_params = 484,   // not_empty_client_class_params
+        S_client_class_param = 485,              // client_class_param
+        S_client_class_name = 486,               // client_class_name
+        S_client_class_test = 487,               // client_class_test
+        S_488_98 = 488,                          // $@98
+        S_only_if_required = 489,                // only_if_required
+        S_dhcp4o6_port = 490,                    // dhcp4o6_port
+        S_control_socket = 491,                  // control_socket
+        S_492_99 = 492,                          // $@99
+        S_control_socket_params = 493,           // control_socket_params
+        S_control_socket_param = 494,            // control_socket_param
+        S_control_socket_type = 495,             // control_socket_type
+        S_496_100 = 496,                         // $@100
+        S_control_socket_name = 497,             // control_socket_name
+        S_498_101 = 498,                         // $@101
+        S_dhcp_queue_control = 499,              // dhcp_queue_control
+        S_500_102 = 500,                         // $@102
+        S_dhcp_ddns = 501,                       // dhcp_ddns
+        S_502_103 = 502,                         // $@103
+        S_sub_dhcp_ddns = 503,                   // sub_dhcp_ddns
+        S_504_104 = 504,                         // $@104
+        S_dhcp_ddns_params = 505,                // dhcp_ddns_params
+        S_dhcp_ddns_param = 506,                 // dhcp_ddns_param
+        S_enable_updates = 507,                  // enable_updates
+        S_qualifying_suffix = 508,               // qualifying_suffix
+        S_509_105 = 509,                         // $@105
+        S_server_ip = 510,                       // server_ip
+        S_511_106 = 511,                         // $@106
+        S_server_port = 512,                     // server_port
+        S_sender_ip = 513,                       // sender_ip
+        S_514_107 = 514,                         // $@107
+        S_sender_port = 515,                     // sender_port
+        S_max_queue_size = 516,                  // max_queue_size
+        S_ncr_protocol = 517,                    // ncr_protocol
+        S_518_108 = 518,                         // $@108
+        S_ncr_protocol_value = 519,              // ncr_protocol_value
+        S_ncr_format = 520,                      // ncr_format
+        S_521_109 = 521,                         // $@109
+        S_ncr_format_value = 522,                // ncr_format_value
+        S_override_no_update = 523,              // override_no_update
+        S_override_client_update = 524,          // override_client_update
+        S_replace_client_name = 525,             // replace_client_name
+        S_526_110 = 526,                         // $@110
+        S_replace_client_name_value = 527,       // replace_client_name_value
+        S_generated_prefix = 528,                // generated_prefix
+        S_529_111 = 529,                         // $@111
+        S_hostname_char_set = 530,               // hostname_char_set
+        S_531_112 = 531,                         // $@112
+        S_hostname_char_replacement = 532,       // hostname_char_replacement
+        S_533_113 = 533,                         // $@113
+        S_dhcp6_json_object = 534,               // dhcp6_json_object
+        S_535_114 = 535,                         // $@114
+        S_dhcpddns_json_object = 536,            // dhcpddns_json_object
+        S_537_115 = 537,                         // $@115
+        S_control_agent_json_object = 538,       // control_agent_json_object
+        S_539_116 = 539,                         // $@116
+        S_config_control = 540,                  // config_control
+        S_541_117 = 541,                         // $@117
+        S_sub_config_control = 542,              // sub_config_control
+        S_543_118 = 543,                         // $@118
+        S_config_control_params = 544,           // config_control_params
+        S_config_control_param = 545,            // config_control_param
+        S_config_databases = 546,                // config_databases
+        S_547_119 = 547,                         // $@119
+        S_config_fetch_wait_time = 548,          // config_fetch_wait_time
+        S_notify_fifo = 549,                     // notify_fifo
+        S_550_120 = 550,                         // $@120
+        S_logging_object = 551,                  // logging_object
+        S_552_121 = 552,                         // $@121
+        S_sub_logging = 553,                     // sub_logging
+        S_554_122 = 554,                         // $@122
+        S_logging_params = 555,                  // logging_params
+        S_logging_param = 556,                   // logging_param
+        S_loggers = 557,                         // loggers
+        S_558_123 = 558,                         // $@123
+        S_loggers_entries = 559,                 // loggers_entries
+        S_logger_entry = 560,                    // logger_entry
+        S_561_124 = 561,                         // $@124
+        S_logger_params = 562,                   // logger_params
+        S_logger_param = 563,                    // logger_param
+        S_debuglevel = 564,                      // debuglevel
+        S_severity = 565,                        // severity
+        S_566_125 = 566,                         // $@125
+        S_output_options_list = 567,             // output_options_list
+        S_568_126 = 568,                         // $@126
+        S_output_options_list_content = 569,     // output_options_list_content
+        S_output_entry = 570,                    // output_entry
+        S_571_127 = 571,                         // $@127
+        S_output_params_list = 572,              // output_params_list
+        S_output_params = 573,                   // output_params
+        S_output = 574,                          // output
+        S_575_128 = 575,                         // $@128
+        S_flush = 576,                           // flush
+        S_maxsize = 577,                         // maxsize
+        S_maxver = 578,                          // maxver
+        S_async = 579,                           // async
+        S_580_129 = 580,                         // $@129
+        S_async_queue_size = 581                 // async_queue_size
+      };
+    };
 
-    /// Internal symbol number for tokens (subsumed by symbol_number_type).
-    typedef unsigned char token_number_type;
+    /// (Internal) symbol kind.
+    typedef symbol_kind::symbol_kind_type symbol_kind_type;
+
+    /// The number of tokens.
+    static const symbol_kind_type YYNTOKENS = symbol_kind::YYNTOKENS;
 
     /// A complete symbol.
     ///
-    /// Expects its Base type to provide access to the symbol type
-    /// via type_get ().
+    /// Expects its Base type to provide access to the symbol kind
+    /// via kind ().
     ///
     /// Provide access to semantic value and location.
     template <typename Base>
@@ -655,20 +1305,59 @@ namespace isc { namespace dhcp {
       typedef Base super_type;
 
       /// Default constructor.
-      basic_symbol ()
+      basic_symbol () YY_NOEXCEPT
         : value ()
         , location ()
       {}
 
 #if 201103L <= YY_CPLUSPLUS
       /// Move constructor.
-      basic_symbol (basic_symbol&& that);
+      basic_symbol (basic_symbol&& that)
+        : Base (std::move (that))
+        , value ()
+        , location (std::move (that.location))
+      {
+        switch (this->kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_outbound_interface_value: // outbound_interface_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.move< ElementPtr > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (std::move (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+      }
 #endif
 
       /// Copy constructor.
       basic_symbol (const basic_symbol& that);
 
-      /// Constructor for valueless symbols, and symbols from each type.
+      /// Constructors for typed symbols.
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, location_type&& l)
         : Base (t)
@@ -680,6 +1369,7 @@ namespace isc { namespace dhcp {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, ElementPtr&& v, location_type&& l)
         : Base (t)
@@ -693,6 +1383,7 @@ namespace isc { namespace dhcp {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, bool&& v, location_type&& l)
         : Base (t)
@@ -706,6 +1397,7 @@ namespace isc { namespace dhcp {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, double&& v, location_type&& l)
         : Base (t)
@@ -719,6 +1411,7 @@ namespace isc { namespace dhcp {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, int64_t&& v, location_type&& l)
         : Base (t)
@@ -732,6 +1425,7 @@ namespace isc { namespace dhcp {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, std::string&& v, location_type&& l)
         : Base (t)
@@ -752,46 +1446,49 @@ namespace isc { namespace dhcp {
         clear ();
       }
 
+
+
       /// Destroy contents, and record that is empty.
-      void clear ()
+      void clear () YY_NOEXCEPT
       {
         // User destructor.
-        symbol_number_type yytype = this->type_get ();
+        symbol_kind_type yykind = this->kind ();
         basic_symbol<Base>& yysym = *this;
         (void) yysym;
-        switch (yytype)
+        switch (yykind)
         {
        default:
           break;
         }
 
-        // Type destructor.
-switch (yytype)
+        // Value type destructor.
+switch (yykind)
     {
-      case 193: // value
-      case 197: // map_value
-      case 243: // socket_type
-      case 246: // outbound_interface_value
-      case 268: // db_type
-      case 354: // hr_mode
-      case 503: // ncr_protocol_value
-      case 510: // replace_client_name_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_outbound_interface_value: // outbound_interface_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.template destroy< ElementPtr > ();
         break;
 
-      case 176: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.template destroy< bool > ();
         break;
 
-      case 175: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.template destroy< double > ();
         break;
 
-      case 174: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.template destroy< int64_t > ();
         break;
 
-      case 173: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.template destroy< std::string > ();
         break;
 
@@ -802,6 +1499,15 @@ switch (yytype)
         Base::clear ();
       }
 
+      /// The user-facing name of this symbol.
+      std::string name () const YY_NOEXCEPT
+      {
+        return Dhcp4Parser::symbol_name (this->kind ());
+      }
+
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
+
       /// Whether empty.
       bool empty () const YY_NOEXCEPT;
 
@@ -809,7 +1515,7 @@ switch (yytype)
       void move (basic_symbol& s);
 
       /// The semantic value.
-      semantic_type value;
+      value_type value;
 
       /// The location.
       location_type location;
@@ -822,125 +1528,132 @@ switch (yytype)
     };
 
     /// Type access provider for token (enum) based symbols.
-    struct by_type
+    struct by_kind
     {
+      /// The symbol kind as needed by the constructor.
+      typedef token_kind_type kind_type;
+
       /// Default constructor.
-      by_type ();
+      by_kind () YY_NOEXCEPT;
 
 #if 201103L <= YY_CPLUSPLUS
       /// Move constructor.
-      by_type (by_type&& that);
+      by_kind (by_kind&& that) YY_NOEXCEPT;
 #endif
 
       /// Copy constructor.
-      by_type (const by_type& that);
-
-      /// The symbol type as needed by the constructor.
-      typedef token_type kind_type;
+      by_kind (const by_kind& that) YY_NOEXCEPT;
 
       /// Constructor from (external) token numbers.
-      by_type (kind_type t);
+      by_kind (kind_type t) YY_NOEXCEPT;
+
+
 
       /// Record that this symbol is empty.
-      void clear ();
+      void clear () YY_NOEXCEPT;
 
-      /// Steal the symbol type from \a that.
-      void move (by_type& that);
+      /// Steal the symbol kind from \a that.
+      void move (by_kind& that);
 
       /// The (internal) type number (corresponding to \a type).
       /// \a empty when empty.
-      symbol_number_type type_get () const YY_NOEXCEPT;
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
-      /// The token.
-      token_type token () const YY_NOEXCEPT;
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
 
-      /// The symbol type.
-      /// \a empty_symbol when empty.
-      /// An int, not token_number_type, to be able to store empty_symbol.
-      int type;
+      /// The symbol kind.
+      /// \a S_YYEMPTY when empty.
+      symbol_kind_type kind_;
     };
 
+    /// Backward compatibility for a private implementation detail (Bison 3.6).
+    typedef by_kind by_type;
+
     /// "External" symbols: returned by the scanner.
-    struct symbol_type : basic_symbol<by_type>
+    struct symbol_type : basic_symbol<by_kind>
     {
       /// Superclass.
-      typedef basic_symbol<by_type> super_type;
+      typedef basic_symbol<by_kind> super_type;
 
       /// Empty symbol.
-      symbol_type () {}
+      symbol_type () YY_NOEXCEPT {}
 
       /// Constructor for valueless symbols, and symbols from each type.
 #if 201103L <= YY_CPLUSPLUS
       symbol_type (int tok, location_type l)
-        : super_type(token_type (tok), std::move (l))
-      {
-        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_DHCP4 || tok == token::TOKEN_CONFIG_CONTROL || tok == token::TOKEN_CONFIG_DATABASES || tok == token::TOKEN_CONFIG_FETCH_WAIT_TIME || tok == token::TOKEN_INTERFACES_CONFIG || tok == token::TOKEN_INTERFACES || tok == token::TOKEN_DHCP_SOCKET_TYPE || tok == token::TOKEN_RAW || tok == token::TOKEN_UDP || tok == token::TOKEN_OUTBOUND_INTERFACE || tok == token::TOKEN_SAME_AS_INBOUND || tok == token::TOKEN_USE_ROUTING || tok == token::TOKEN_RE_DETECT || tok == token::TOKEN_SANITY_CHECKS || tok == token::TOKEN_LEASE_CHECKS || tok == token::TOKEN_ECHO_CLIENT_ID || tok == token::TOKEN_MATCH_CLIENT_ID || tok == token::TOKEN_AUTHORITATIVE || tok == token::TOKEN_NEXT_SERVER || tok == token::TOKEN_SERVER_HOSTNAME || tok == token::TOKEN_BOOT_FILE_NAME || tok == token::TOKEN_LEASE_DATABASE || tok == token::TOKEN_HOSTS_DATABASE || tok == token::TOKEN_HOSTS_DATABASES || tok == token::TOKEN_TYPE || tok == token::TOKEN_MEMFILE || tok == token::TOKEN_MYSQL || tok == token::TOKEN_POSTGRESQL || tok == token::TOKEN_CQL || tok == token::TOKEN_USER || tok == token::TOKEN_PASSWORD || tok == token::TOKEN_HOST || tok == token::TOKEN_PORT || tok == token::TOKEN_PERSIST || tok == token::TOKEN_LFC_INTERVAL || tok == token::TOKEN_READONLY || tok == token::TOKEN_CONNECT_TIMEOUT || tok == token::TOKEN_CONTACT_POINTS || tok == token::TOKEN_KEYSPACE || tok == token::TOKEN_CONSISTENCY || tok == token::TOKEN_SERIAL_CONSISTENCY || tok == token::TOKEN_MAX_RECONNECT_TRIES || tok == token::TOKEN_RECONNECT_WAIT_TIME || tok == token::TOKEN_REQUEST_TIMEOUT || tok == token::TOKEN_TCP_KEEPALIVE || tok == token::TOKEN_TCP_NODELAY || tok == token::TOKEN_VALID_LIFETIME || tok == token::TOKEN_MIN_VALID_LIFETIME || tok == token::TOKEN_MAX_VALID_LIFETIME || tok == token::TOKEN_RENEW_TIMER || tok == token::TOKEN_REBIND_TIMER || tok == token::TOKEN_CALCULATE_TEE_TIMES || tok == token::TOKEN_T1_PERCENT || tok == token::TOKEN_T2_PERCENT || tok == token::TOKEN_DECLINE_PROBATION_PERIOD || tok == token::TOKEN_SERVER_TAG || tok == token::TOKEN_SUBNET4 || tok == token::TOKEN_SUBNET_4O6_INTERFACE || tok == token::TOKEN_SUBNET_4O6_INTERFACE_ID || tok == token::TOKEN_SUBNET_4O6_SUBNET || tok == token::TOKEN_OPTION_DEF || tok == token::TOKEN_OPTION_DATA || tok == token::TOKEN_NAME || tok == token::TOKEN_DATA || tok == token::TOKEN_CODE || tok == token::TOKEN_SPACE || tok == token::TOKEN_CSV_FORMAT || tok == token::TOKEN_ALWAYS_SEND || tok == token::TOKEN_RECORD_TYPES || tok == token::TOKEN_ENCAPSULATE || tok == token::TOKEN_ARRAY || tok == token::TOKEN_SHARED_NETWORKS || tok == token::TOKEN_POOLS || tok == token::TOKEN_POOL || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_SUBNET || tok == token::TOKEN_INTERFACE || tok == token::TOKEN_ID || tok == token::TOKEN_RESERVATION_MODE || tok == token::TOKEN_DISABLED || tok == token::TOKEN_OUT_OF_POOL || tok == token::TOKEN_GLOBAL || tok == token::TOKEN_ALL || tok == token::TOKEN_HOST_RESERVATION_IDENTIFIERS || tok == token::TOKEN_CLIENT_CLASSES || tok == token::TOKEN_REQUIRE_CLIENT_CLASSES || tok == token::TOKEN_TEST || tok == token::TOKEN_ONLY_IF_REQUIRED || tok == token::TOKEN_CLIENT_CLASS || tok == token::TOKEN_RESERVATIONS || tok == token::TOKEN_DUID || tok == token::TOKEN_HW_ADDRESS || tok == token::TOKEN_CIRCUIT_ID || tok == token::TOKEN_CLIENT_ID || tok == token::TOKEN_HOSTNAME || tok == token::TOKEN_FLEX_ID || tok == token::TOKEN_RELAY || tok == token::TOKEN_IP_ADDRESS || tok == token::TOKEN_IP_ADDRESSES || tok == token::TOKEN_HOOKS_LIBRARIES || tok == token::TOKEN_LIBRARY || tok == token::TOKEN_PARAMETERS || tok == token::TOKEN_EXPIRED_LEASES_PROCESSING || tok == token::TOKEN_RECLAIM_TIMER_WAIT_TIME || tok == token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME || tok == token::TOKEN_HOLD_RECLAIMED_TIME || tok == token::TOKEN_MAX_RECLAIM_LEASES || tok == token::TOKEN_MAX_RECLAIM_TIME || tok == token::TOKEN_UNWARNED_RECLAIM_CYCLES || tok == token::TOKEN_DHCP4O6_PORT || tok == token::TOKEN_CONTROL_SOCKET || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_DHCP_QUEUE_CONTROL || tok == token::TOKEN_DHCP_DDNS || tok == token::TOKEN_ENABLE_UPDATES || tok == token::TOKEN_QUALIFYING_SUFFIX || tok == token::TOKEN_SERVER_IP || tok == token::TOKEN_SERVER_PORT || tok == token::TOKEN_SENDER_IP || tok == token::TOKEN_SENDER_PORT || tok == token::TOKEN_MAX_QUEUE_SIZE || tok == token::TOKEN_NCR_PROTOCOL || tok == token::TOKEN_NCR_FORMAT || tok == token::TOKEN_OVERRIDE_NO_UPDATE || tok == token::TOKEN_OVERRIDE_CLIENT_UPDATE || tok == token::TOKEN_REPLACE_CLIENT_NAME || tok == token::TOKEN_GENERATED_PREFIX || tok == token::TOKEN_TCP || tok == token::TOKEN_JSON || tok == token::TOKEN_WHEN_PRESENT || tok == token::TOKEN_NEVER || tok == token::TOKEN_ALWAYS || tok == token::TOKEN_WHEN_NOT_PRESENT || tok == token::TOKEN_HOSTNAME_CHAR_SET || tok == token::TOKEN_HOSTNAME_CHAR_REPLACEMENT || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_DHCP6 || tok == token::TOKEN_DHCPDDNS || tok == token::TOKEN_CONTROL_AGENT || tok == token::TOKEN_TOPLEVEL_JSON || tok == token::TOKEN_TOPLEVEL_DHCP4 || tok == token::TOKEN_SUB_DHCP4 || tok == token::TOKEN_SUB_INTERFACES4 || tok == token::TOKEN_SUB_SUBNET4 || tok == token::TOKEN_SUB_POOL4 || tok == token::TOKEN_SUB_RESERVATION || tok == token::TOKEN_SUB_OPTION_DEFS || tok == token::TOKEN_SUB_OPTION_DEF || tok == token::TOKEN_SUB_OPTION_DATA || tok == token::TOKEN_SUB_HOOKS_LIBRARY || tok == token::TOKEN_SUB_DHCP_DDNS || tok == token::TOKEN_SUB_LOGGING || tok == token::TOKEN_SUB_CONFIG_CONTROL);
-      }
+        : super_type (token_kind_type (tok), std::move (l))
 #else
       symbol_type (int tok, const location_type& l)
-        : super_type(token_type (tok), l)
+        : super_type (token_kind_type (tok), l)
+#endif
       {
-        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_DHCP4 || tok == token::TOKEN_CONFIG_CONTROL || tok == token::TOKEN_CONFIG_DATABASES || tok == token::TOKEN_CONFIG_FETCH_WAIT_TIME || tok == token::TOKEN_INTERFACES_CONFIG || tok == token::TOKEN_INTERFACES || tok == token::TOKEN_DHCP_SOCKET_TYPE || tok == token::TOKEN_RAW || tok == token::TOKEN_UDP || tok == token::TOKEN_OUTBOUND_INTERFACE || tok == token::TOKEN_SAME_AS_INBOUND || tok == token::TOKEN_USE_ROUTING || tok == token::TOKEN_RE_DETECT || tok == token::TOKEN_SANITY_CHECKS || tok == token::TOKEN_LEASE_CHECKS || tok == token::TOKEN_ECHO_CLIENT_ID || tok == token::TOKEN_MATCH_CLIENT_ID || tok == token::TOKEN_AUTHORITATIVE || tok == token::TOKEN_NEXT_SERVER || tok == token::TOKEN_SERVER_HOSTNAME || tok == token::TOKEN_BOOT_FILE_NAME || tok == token::TOKEN_LEASE_DATABASE || tok == token::TOKEN_HOSTS_DATABASE || tok == token::TOKEN_HOSTS_DATABASES || tok == token::TOKEN_TYPE || tok == token::TOKEN_MEMFILE || tok == token::TOKEN_MYSQL || tok == token::TOKEN_POSTGRESQL || tok == token::TOKEN_CQL || tok == token::TOKEN_USER || tok == token::TOKEN_PASSWORD || tok == token::TOKEN_HOST || tok == token::TOKEN_PORT || tok == token::TOKEN_PERSIST || tok == token::TOKEN_LFC_INTERVAL || tok == token::TOKEN_READONLY || tok == token::TOKEN_CONNECT_TIMEOUT || tok == token::TOKEN_CONTACT_POINTS || tok == token::TOKEN_KEYSPACE || tok == token::TOKEN_CONSISTENCY || tok == token::TOKEN_SERIAL_CONSISTENCY || tok == token::TOKEN_MAX_RECONNECT_TRIES || tok == token::TOKEN_RECONNECT_WAIT_TIME || tok == token::TOKEN_REQUEST_TIMEOUT || tok == token::TOKEN_TCP_KEEPALIVE || tok == token::TOKEN_TCP_NODELAY || tok == token::TOKEN_VALID_LIFETIME || tok == token::TOKEN_MIN_VALID_LIFETIME || tok == token::TOKEN_MAX_VALID_LIFETIME || tok == token::TOKEN_RENEW_TIMER || tok == token::TOKEN_REBIND_TIMER || tok == token::TOKEN_CALCULATE_TEE_TIMES || tok == token::TOKEN_T1_PERCENT || tok == token::TOKEN_T2_PERCENT || tok == token::TOKEN_DECLINE_PROBATION_PERIOD || tok == token::TOKEN_SERVER_TAG || tok == token::TOKEN_SUBNET4 || tok == token::TOKEN_SUBNET_4O6_INTERFACE || tok == token::TOKEN_SUBNET_4O6_INTERFACE_ID || tok == token::TOKEN_SUBNET_4O6_SUBNET || tok == token::TOKEN_OPTION_DEF || tok == token::TOKEN_OPTION_DATA || tok == token::TOKEN_NAME || tok == token::TOKEN_DATA || tok == token::TOKEN_CODE || tok == token::TOKEN_SPACE || tok == token::TOKEN_CSV_FORMAT || tok == token::TOKEN_ALWAYS_SEND || tok == token::TOKEN_RECORD_TYPES || tok == token::TOKEN_ENCAPSULATE || tok == token::TOKEN_ARRAY || tok == token::TOKEN_SHARED_NETWORKS || tok == token::TOKEN_POOLS || tok == token::TOKEN_POOL || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_SUBNET || tok == token::TOKEN_INTERFACE || tok == token::TOKEN_ID || tok == token::TOKEN_RESERVATION_MODE || tok == token::TOKEN_DISABLED || tok == token::TOKEN_OUT_OF_POOL || tok == token::TOKEN_GLOBAL || tok == token::TOKEN_ALL || tok == token::TOKEN_HOST_RESERVATION_IDENTIFIERS || tok == token::TOKEN_CLIENT_CLASSES || tok == token::TOKEN_REQUIRE_CLIENT_CLASSES || tok == token::TOKEN_TEST || tok == token::TOKEN_ONLY_IF_REQUIRED || tok == token::TOKEN_CLIENT_CLASS || tok == token::TOKEN_RESERVATIONS || tok == token::TOKEN_DUID || tok == token::TOKEN_HW_ADDRESS || tok == token::TOKEN_CIRCUIT_ID || tok == token::TOKEN_CLIENT_ID || tok == token::TOKEN_HOSTNAME || tok == token::TOKEN_FLEX_ID || tok == token::TOKEN_RELAY || tok == token::TOKEN_IP_ADDRESS || tok == token::TOKEN_IP_ADDRESSES || tok == token::TOKEN_HOOKS_LIBRARIES || tok == token::TOKEN_LIBRARY || tok == token::TOKEN_PARAMETERS || tok == token::TOKEN_EXPIRED_LEASES_PROCESSING || tok == token::TOKEN_RECLAIM_TIMER_WAIT_TIME || tok == token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME || tok == token::TOKEN_HOLD_RECLAIMED_TIME || tok == token::TOKEN_MAX_RECLAIM_LEASES || tok == token::TOKEN_MAX_RECLAIM_TIME || tok == token::TOKEN_UNWARNED_RECLAIM_CYCLES || tok == token::TOKEN_DHCP4O6_PORT || tok == token::TOKEN_CONTROL_SOCKET || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_DHCP_QUEUE_CONTROL || tok == token::TOKEN_DHCP_DDNS || tok == token::TOKEN_ENABLE_UPDATES || tok == token::TOKEN_QUALIFYING_SUFFIX || tok == token::TOKEN_SERVER_IP || tok == token::TOKEN_SERVER_PORT || tok == token::TOKEN_SENDER_IP || tok == token::TOKEN_SENDER_PORT || tok == token::TOKEN_MAX_QUEUE_SIZE || tok == token::TOKEN_NCR_PROTOCOL || tok == token::TOKEN_NCR_FORMAT || tok == token::TOKEN_OVERRIDE_NO_UPDATE || tok == token::TOKEN_OVERRIDE_CLIENT_UPDATE || tok == token::TOKEN_REPLACE_CLIENT_NAME || tok == token::TOKEN_GENERATED_PREFIX || tok == token::TOKEN_TCP || tok == token::TOKEN_JSON || tok == token::TOKEN_WHEN_PRESENT || tok == token::TOKEN_NEVER || tok == token::TOKEN_ALWAYS || tok == token::TOKEN_WHEN_NOT_PRESENT || tok == token::TOKEN_HOSTNAME_CHAR_SET || tok == token::TOKEN_HOSTNAME_CHAR_REPLACEMENT || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_DHCP6 || tok == token::TOKEN_DHCPDDNS || tok == token::TOKEN_CONTROL_AGENT || tok == token::TOKEN_TOPLEVEL_JSON || tok == token::TOKEN_TOPLEVEL_DHCP4 || tok == token::TOKEN_SUB_DHCP4 || tok == token::TOKEN_SUB_INTERFACES4 || tok == token::TOKEN_SUB_SUBNET4 || tok == token::TOKEN_SUB_POOL4 || tok == token::TOKEN_SUB_RESERVATION || tok == token::TOKEN_SUB_OPTION_DEFS || tok == token::TOKEN_SUB_OPTION_DEF || tok == token::TOKEN_SUB_OPTION_DATA || tok == token::TOKEN_SUB_HOOKS_LIBRARY || tok == token::TOKEN_SUB_DHCP_DDNS || tok == token::TOKEN_SUB_LOGGING || tok == token::TOKEN_SUB_CONFIG_CONTROL);
-      }
+#if !defined _MSC_VER || defined __clang__
+        PARSER4__ASSERT (tok == token::TOKEN_END
+                   || (token::TOKEN_PARSER4_error <= tok && tok <= token::TOKEN_SUB_CONFIG_CONTROL));
 #endif
+      }
 #if 201103L <= YY_CPLUSPLUS
       symbol_type (int tok, bool v, location_type l)
-        : super_type(token_type (tok), std::move (v), std::move (l))
-      {
-        YYASSERT (tok == token::TOKEN_BOOLEAN);
-      }
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
 #else
       symbol_type (int tok, const bool& v, const location_type& l)
-        : super_type(token_type (tok), v, l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
       {
-        YYASSERT (tok == token::TOKEN_BOOLEAN);
-      }
+#if !defined _MSC_VER || defined __clang__
+        PARSER4__ASSERT (tok == token::TOKEN_BOOLEAN);
 #endif
+      }
 #if 201103L <= YY_CPLUSPLUS
       symbol_type (int tok, double v, location_type l)
-        : super_type(token_type (tok), std::move (v), std::move (l))
-      {
-        YYASSERT (tok == token::TOKEN_FLOAT);
-      }
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
 #else
       symbol_type (int tok, const double& v, const location_type& l)
-        : super_type(token_type (tok), v, l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
       {
-        YYASSERT (tok == token::TOKEN_FLOAT);
-      }
+#if !defined _MSC_VER || defined __clang__
+        PARSER4__ASSERT (tok == token::TOKEN_FLOAT);
 #endif
+      }
 #if 201103L <= YY_CPLUSPLUS
       symbol_type (int tok, int64_t v, location_type l)
-        : super_type(token_type (tok), std::move (v), std::move (l))
-      {
-        YYASSERT (tok == token::TOKEN_INTEGER);
-      }
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
 #else
       symbol_type (int tok, const int64_t& v, const location_type& l)
-        : super_type(token_type (tok), v, l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
       {
-        YYASSERT (tok == token::TOKEN_INTEGER);
-      }
+#if !defined _MSC_VER || defined __clang__
+        PARSER4__ASSERT (tok == token::TOKEN_INTEGER);
 #endif
+      }
 #if 201103L <= YY_CPLUSPLUS
       symbol_type (int tok, std::string v, location_type l)
-        : super_type(token_type (tok), std::move (v), std::move (l))
-      {
-        YYASSERT (tok == token::TOKEN_STRING);
-      }
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
 #else
       symbol_type (int tok, const std::string& v, const location_type& l)
-        : super_type(token_type (tok), v, l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
       {
-        YYASSERT (tok == token::TOKEN_STRING);
-      }
+#if !defined _MSC_VER || defined __clang__
+        PARSER4__ASSERT (tok == token::TOKEN_STRING);
 #endif
+      }
     };
 
     /// Build a parser object.
     Dhcp4Parser (isc::dhcp::Parser4Context& ctx_yyarg);
     virtual ~Dhcp4Parser ();
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    Dhcp4Parser (const Dhcp4Parser&) = delete;
+    /// Non copyable.
+    Dhcp4Parser& operator= (const Dhcp4Parser&) = delete;
+#endif
+
     /// Parse.  An alias for parse ().
     /// \returns  0 iff parsing succeeded.
     int operator() ();
@@ -971,7 +1684,11 @@ switch (yytype)
     /// Report a syntax error.
     void error (const syntax_error& err);
 
-    // Implementation of make_symbol for each symbol type.
+    /// The user-facing name of the symbol whose (internal) number is
+    /// YYSYMBOL.  No bounds checking.
+    static std::string symbol_name (symbol_kind_type yysymbol);
+
+    // Implementation of make_symbol for each token kind.
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -987,6 +1704,36 @@ switch (yytype)
         return symbol_type (token::TOKEN_END, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PARSER4_error (location_type l)
+      {
+        return symbol_type (token::TOKEN_PARSER4_error, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PARSER4_error (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PARSER4_error, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PARSER4_UNDEF (location_type l)
+      {
+        return symbol_type (token::TOKEN_PARSER4_UNDEF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PARSER4_UNDEF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PARSER4_UNDEF, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -1152,6 +1899,21 @@ switch (yytype)
         return symbol_type (token::TOKEN_CONFIG_FETCH_WAIT_TIME, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NOTIFY_FIFO (location_type l)
+      {
+        return symbol_type (token::TOKEN_NOTIFY_FIFO, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NOTIFY_FIFO (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NOTIFY_FIFO, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -1782,6 +2544,21 @@ switch (yytype)
         return symbol_type (token::TOKEN_TCP_NODELAY, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_POOL_SIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_POOL_SIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_POOL_SIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_POOL_SIZE, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -1902,6 +2679,81 @@ switch (yytype)
         return symbol_type (token::TOKEN_T2_PERCENT, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CACHE_THRESHOLD (location_type l)
+      {
+        return symbol_type (token::TOKEN_CACHE_THRESHOLD, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CACHE_THRESHOLD (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CACHE_THRESHOLD, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LEASE_LOOKUP_THREADS (location_type l)
+      {
+        return symbol_type (token::TOKEN_LEASE_LOOKUP_THREADS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LEASE_LOOKUP_THREADS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LEASE_LOOKUP_THREADS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PACKET_ARENA_CHUNK_SIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_PACKET_ARENA_CHUNK_SIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PACKET_ARENA_CHUNK_SIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PACKET_ARENA_CHUNK_SIZE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PACKET_SLOW_THRESHOLD (location_type l)
+      {
+        return symbol_type (token::TOKEN_PACKET_SLOW_THRESHOLD, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PACKET_SLOW_THRESHOLD (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PACKET_SLOW_THRESHOLD, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOST_FILTER_REBUILD_INTERVAL (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOST_FILTER_REBUILD_INTERVAL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOST_FILTER_REBUILD_INTERVAL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOST_FILTER_REBUILD_INTERVAL, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -3057,6 +3909,21 @@ switch (yytype)
         return symbol_type (token::TOKEN_JSON, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BINARY (location_type l)
+      {
+        return symbol_type (token::TOKEN_BINARY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BINARY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_BINARY, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -3282,6 +4149,36 @@ switch (yytype)
         return symbol_type (token::TOKEN_MAXVER, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC_QUEUE_SIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_QUEUE_SIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC_QUEUE_SIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_QUEUE_SIZE, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -3599,93 +4496,119 @@ switch (yytype)
 #endif
 
 
+    class context
+    {
+    public:
+      context (const Dhcp4Parser& yyparser, const symbol_type& yyla);
+      const symbol_type& lookahead () const YY_NOEXCEPT { return yyla_; }
+      symbol_kind_type token () const YY_NOEXCEPT { return yyla_.kind (); }
+      const location_type& location () const YY_NOEXCEPT { return yyla_.location; }
+
+      /// Put in YYARG at most YYARGN of the expected tokens, and return the
+      /// number of tokens stored in YYARG.  If YYARG is null, return the
+      /// number of expected tokens (guaranteed to be less than YYNTOKENS).
+      int expected_tokens (symbol_kind_type yyarg[], int yyargn) const;
+
+    private:
+      const Dhcp4Parser& yyparser_;
+      const symbol_type& yyla_;
+    };
+
   private:
-    /// This class is not copyable.
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
     Dhcp4Parser (const Dhcp4Parser&);
+    /// Non copyable.
     Dhcp4Parser& operator= (const Dhcp4Parser&);
+#endif
 
-    /// State numbers.
-    typedef int state_type;
 
-    /// Generate an error message.
-    /// \param yystate   the state where the error occurred.
-    /// \param yyla      the lookahead token.
-    virtual std::string yysyntax_error_ (state_type yystate,
-                                         const symbol_type& yyla) const;
+    /// Stored state numbers (used for stacks).
+    typedef short state_type;
 
+    /// The arguments of the error message.
+    int yy_syntax_error_arguments_ (const context& yyctx,
+                                    symbol_kind_type yyarg[], int yyargn) const;
+
+    /// Generate an error message.
+    /// \param yyctx     the context in which the error occurred.
+    virtual std::string yysyntax_error_ (const context& yyctx) const;
     /// Compute post-reduction state.
     /// \param yystate   the current state
     /// \param yysym     the nonterminal to push on the stack
-    state_type yy_lr_goto_state_ (state_type yystate, int yysym);
+    static state_type yy_lr_goto_state_ (state_type yystate, int yysym);
 
     /// Whether the given \c yypact_ value indicates a defaulted state.
     /// \param yyvalue   the value to check
-    static bool yy_pact_value_is_default_ (int yyvalue);
+    static bool yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT;
 
     /// Whether the given \c yytable_ value indicates a syntax error.
     /// \param yyvalue   the value to check
-    static bool yy_table_value_is_error_ (int yyvalue);
+    static bool yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT;
 
     static const short yypact_ninf_;
     static const signed char yytable_ninf_;
 
-    /// Convert a scanner token number \a t to a symbol number.
-    static token_number_type yytranslate_ (token_type t);
+    /// Convert a scanner token kind \a t to a symbol kind.
+    /// In theory \a t should be a token_kind_type, but character literals
+    /// are valid, yet not members of the token_kind_type enum.
+    static symbol_kind_type yytranslate_ (int t) YY_NOEXCEPT;
 
-    // Tables.
-  // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-  // STATE-NUM.
-  static const short yypact_[];
+    /// Convert the symbol name \a n to a form suitable for a diagnostic.
+    static std::string yytnamerr_ (const char *yystr);
+
+    /// For a symbol, its name in clear.
+    static const char* const yytname_[];
 
-  // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-  // Performed when YYTABLE does not specify something else to do.  Zero
-  // means the default is an error.
-  static const unsigned short yydefact_[];
 
-  // YYPGOTO[NTERM-NUM].
-  static const short yypgoto_[];
+    // Tables.
+    // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+    // STATE-NUM.
+    static const short yypact_[];
 
-  // YYDEFGOTO[NTERM-NUM].
-  static const short yydefgoto_[];
+    // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+    // Performed when YYTABLE does not specify something else to do.  Zero
+    // means the default is an error.
+    static const short yydefact_[];
 
-  // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-  // positive, shift that token.  If negative, reduce the rule whose
-  // number is the opposite.  If YYTABLE_NINF, syntax error.
-  static const unsigned short yytable_[];
+    // YYPGOTO[NTERM-NUM].
+    static const short yypgoto_[];
 
-  static const short yycheck_[];
+    // YYDEFGOTO[NTERM-NUM].
+    static const short yydefgoto_[];
 
-  // YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-  // symbol of state STATE-NUM.
-  static const unsigned short yystos_[];
+    // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+    // positive, shift that token.  If negative, reduce the rule whose
+    // number is the opposite.  If YYTABLE_NINF, syntax error.
+    static const short yytable_[];
 
-  // YYR1[YYN] -- Symbol number of symbol that rule YYN derives.
-  static const unsigned short yyr1_[];
+    static const short yycheck_[];
 
-  // YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.
-  static const unsigned char yyr2_[];
+    // YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+    // state STATE-NUM.
+    static const short yystos_[];
 
+    // YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.
+    static const short yyr1_[];
 
-    /// Convert the symbol name \a n to a form suitable for a diagnostic.
-    static std::string yytnamerr_ (const char *n);
+    // YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.
+    static const signed char yyr2_[];
 
 
-    /// For a symbol, its name in clear.
-    static const char* const yytname_[];
 #if PARSER4_DEBUG
-  // YYRLINE[YYN] -- Source line where rule number YYN was defined.
-  static const unsigned short yyrline_[];
+    // YYRLINE[YYN] -- Source line where rule number YYN was defined.
+    static const short yyrline_[];
     /// Report on the debug stream that the rule \a r is going to be reduced.
-    virtual void yy_reduce_print_ (int r);
+    virtual void yy_reduce_print_ (int r) const;
     /// Print the state stack on the debug stream.
-    virtual void yystack_print_ ();
+    virtual void yy_stack_print_ () const;
 
     /// Debugging level.
     int yydebug_;
     /// Debug stream.
     std::ostream* yycdebug_;
 
-    /// \brief Display a symbol type, value and location.
+    /// \brief Display a symbol kind, value and location.
     /// \param yyo    The output stream.
     /// \param yysym  The symbol.
     template <typename Base>
@@ -3706,7 +4629,7 @@ switch (yytype)
       /// Default constructor.
       by_state () YY_NOEXCEPT;
 
-      /// The symbol type as needed by the constructor.
+      /// The symbol kind as needed by the constructor.
       typedef state_type kind_type;
 
       /// Constructor.
@@ -3718,15 +4641,16 @@ switch (yytype)
       /// Record that this symbol is empty.
       void clear () YY_NOEXCEPT;
 
-      /// Steal the symbol type from \a that.
+      /// Steal the symbol kind from \a that.
       void move (by_state& that);
 
-      /// The (internal) type number (corresponding to \a state).
-      /// \a empty_symbol when empty.
-      symbol_number_type type_get () const YY_NOEXCEPT;
+      /// The symbol kind (corresponding to \a state).
+      /// \a symbol_kind::S_YYEMPTY when empty.
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
       /// The state number used to denote an empty symbol.
-      enum { empty_state = -1 };
+      /// We use the initial state, as it does not have a value.
+      enum { empty_state = 0 };
 
       /// The state.
       /// \a empty when empty.
@@ -3748,6 +4672,10 @@ switch (yytype)
       /// Assignment, needed by push_back by some old implementations.
       /// Moves the contents of that.
       stack_symbol_type& operator= (stack_symbol_type& that);
+
+      /// Assignment, needed by push_back by other implementations.
+      /// Needed by some other old implementations.
+      stack_symbol_type& operator= (const stack_symbol_type& that);
 #endif
     };
 
@@ -3757,48 +4685,38 @@ switch (yytype)
     {
     public:
       // Hide our reversed order.
-      typedef typename S::reverse_iterator iterator;
-      typedef typename S::const_reverse_iterator const_iterator;
+      typedef typename S::iterator iterator;
+      typedef typename S::const_iterator const_iterator;
       typedef typename S::size_type size_type;
+      typedef typename std::ptrdiff_t index_type;
 
-      stack (size_type n = 200)
+      stack (size_type n = 200) YY_NOEXCEPT
         : seq_ (n)
       {}
 
-      /// Random access.
-      ///
-      /// Index 0 returns the topmost element.
-      T&
-      operator[] (size_type i)
-      {
-        return seq_[size () - 1 - i];
-      }
-
-      /// Random access.
-      ///
-      /// Index 0 returns the topmost element.
-      T&
-      operator[] (int i)
-      {
-        return operator[] (size_type (i));
-      }
+#if 201103L <= YY_CPLUSPLUS
+      /// Non copyable.
+      stack (const stack&) = delete;
+      /// Non copyable.
+      stack& operator= (const stack&) = delete;
+#endif
 
       /// Random access.
       ///
       /// Index 0 returns the topmost element.
       const T&
-      operator[] (size_type i) const
+      operator[] (index_type i) const
       {
-        return seq_[size () - 1 - i];
+        return seq_[size_type (size () - 1 - i)];
       }
 
       /// Random access.
       ///
       /// Index 0 returns the topmost element.
-      const T&
-      operator[] (int i) const
+      T&
+      operator[] (index_type i)
       {
-        return operator[] (size_type (i));
+        return seq_[size_type (size () - 1 - i)];
       }
 
       /// Steal the contents of \a t.
@@ -3813,7 +4731,7 @@ switch (yytype)
 
       /// Pop elements from the stack.
       void
-      pop (int n = 1) YY_NOEXCEPT
+      pop (std::ptrdiff_t n = 1) YY_NOEXCEPT
       {
         for (; 0 < n; --n)
           seq_.pop_back ();
@@ -3827,49 +4745,53 @@ switch (yytype)
       }
 
       /// Number of elements on the stack.
-      size_type
+      index_type
       size () const YY_NOEXCEPT
       {
-        return seq_.size ();
+        return index_type (seq_.size ());
       }
 
       /// Iterator on top of the stack (going downwards).
       const_iterator
       begin () const YY_NOEXCEPT
       {
-        return seq_.rbegin ();
+        return seq_.begin ();
       }
 
       /// Bottom of the stack.
       const_iterator
       end () const YY_NOEXCEPT
       {
-        return seq_.rend ();
+        return seq_.end ();
       }
 
       /// Present a slice of the top of a stack.
       class slice
       {
       public:
-        slice (const stack& stack, int range)
+        slice (const stack& stack, index_type range) YY_NOEXCEPT
           : stack_ (stack)
           , range_ (range)
         {}
 
         const T&
-        operator[] (int i) const
+        operator[] (index_type i) const
         {
           return stack_[range_ - i];
         }
 
       private:
         const stack& stack_;
-        int range_;
+        index_type range_;
       };
 
     private:
+#if YY_CPLUSPLUS < 201103L
+      /// Non copyable.
       stack (const stack&);
+      /// Non copyable.
       stack& operator= (const stack&);
+#endif
       /// The wrapped container.
       S seq_;
     };
@@ -3897,33 +4819,30 @@ switch (yytype)
     void yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym);
 
     /// Pop \a n symbols from the stack.
-    void yypop_ (int n = 1);
+    void yypop_ (int n = 1) YY_NOEXCEPT;
 
     /// Constants.
     enum
     {
-      yyeof_ = 0,
-      yylast_ = 1050,     ///< Last index in yytable_.
-      yynnts_ = 383,  ///< Number of nonterminal symbols.
-      yyfinal_ = 30, ///< Termination state number.
-      yyterror_ = 1,
-      yyerrcode_ = 256,
-      yyntokens_ = 177  ///< Number of tokens.
+      yylast_ = 1085,     ///< Last index in yytable_.
+      yynnts_ = 395,  ///< Number of nonterminal symbols.
+      yyfinal_ = 30 ///< Termination state number.
     };
 
 
     // User arguments.
     isc::dhcp::Parser4Context& ctx;
+
   };
 
   inline
-  Dhcp4Parser::token_number_type
-  Dhcp4Parser::yytranslate_ (token_type t)
+  Dhcp4Parser::symbol_kind_type
+  Dhcp4Parser::yytranslate_ (int t) YY_NOEXCEPT
   {
     // YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to
     // TOKEN-NUM as returned by yylex.
     static
-    const token_number_type
+    const unsigned char
     translate_table[] =
     {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -3969,95 +4888,54 @@ switch (yytype)
      145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
      155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
      165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
-     175,   176
+     175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
+     185,   186
     };
-    const unsigned user_token_number_max_ = 431;
-    const token_number_type undef_token_ = 2;
+    // Last valid token kind.
+    const int code_max = 441;
 
-    if (static_cast<int> (t) <= yyeof_)
-      return yyeof_;
-    else if (static_cast<unsigned> (t) <= user_token_number_max_)
-      return translate_table[t];
+    if (t <= 0)
+      return symbol_kind::S_YYEOF;
+    else if (t <= code_max)
+      return static_cast <symbol_kind_type> (translate_table[t]);
     else
-      return undef_token_;
+      return symbol_kind::S_YYUNDEF;
   }
 
   // basic_symbol.
-#if 201103L <= YY_CPLUSPLUS
-  template <typename Base>
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol (basic_symbol&& that)
-    : Base (std::move (that))
-    , value ()
-    , location (std::move (that.location))
-  {
-    switch (this->type_get ())
-    {
-      case 193: // value
-      case 197: // map_value
-      case 243: // socket_type
-      case 246: // outbound_interface_value
-      case 268: // db_type
-      case 354: // hr_mode
-      case 503: // ncr_protocol_value
-      case 510: // replace_client_name_value
-        value.move< ElementPtr > (std::move (that.value));
-        break;
-
-      case 176: // "boolean"
-        value.move< bool > (std::move (that.value));
-        break;
-
-      case 175: // "floating point"
-        value.move< double > (std::move (that.value));
-        break;
-
-      case 174: // "integer"
-        value.move< int64_t > (std::move (that.value));
-        break;
-
-      case 173: // "constant string"
-        value.move< std::string > (std::move (that.value));
-        break;
-
-      default:
-        break;
-    }
-
-  }
-#endif
-
   template <typename Base>
   Dhcp4Parser::basic_symbol<Base>::basic_symbol (const basic_symbol& that)
     : Base (that)
     , value ()
     , location (that.location)
   {
-    switch (this->type_get ())
+    switch (this->kind ())
     {
-      case 193: // value
-      case 197: // map_value
-      case 243: // socket_type
-      case 246: // outbound_interface_value
-      case 268: // db_type
-      case 354: // hr_mode
-      case 503: // ncr_protocol_value
-      case 510: // replace_client_name_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_outbound_interface_value: // outbound_interface_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.copy< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 176: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.copy< bool > (YY_MOVE (that.value));
         break;
 
-      case 175: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.copy< double > (YY_MOVE (that.value));
         break;
 
-      case 174: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.copy< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 173: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.copy< std::string > (YY_MOVE (that.value));
         break;
 
@@ -4069,11 +4947,20 @@ switch (yytype)
 
 
 
+
+  template <typename Base>
+  Dhcp4Parser::symbol_kind_type
+  Dhcp4Parser::basic_symbol<Base>::type_get () const YY_NOEXCEPT
+  {
+    return this->kind ();
+  }
+
+
   template <typename Base>
   bool
   Dhcp4Parser::basic_symbol<Base>::empty () const YY_NOEXCEPT
   {
-    return Base::type_get () == empty_symbol;
+    return this->kind () == symbol_kind::S_YYEMPTY;
   }
 
   template <typename Base>
@@ -4081,32 +4968,33 @@ switch (yytype)
   Dhcp4Parser::basic_symbol<Base>::move (basic_symbol& s)
   {
     super_type::move (s);
-    switch (this->type_get ())
+    switch (this->kind ())
     {
-      case 193: // value
-      case 197: // map_value
-      case 243: // socket_type
-      case 246: // outbound_interface_value
-      case 268: // db_type
-      case 354: // hr_mode
-      case 503: // ncr_protocol_value
-      case 510: // replace_client_name_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_outbound_interface_value: // outbound_interface_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.move< ElementPtr > (YY_MOVE (s.value));
         break;
 
-      case 176: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (YY_MOVE (s.value));
         break;
 
-      case 175: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (YY_MOVE (s.value));
         break;
 
-      case 174: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (YY_MOVE (s.value));
         break;
 
-      case 173: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (YY_MOVE (s.value));
         break;
 
@@ -4117,89 +5005,67 @@ switch (yytype)
     location = YY_MOVE (s.location);
   }
 
-  // by_type.
+  // by_kind.
   inline
-  Dhcp4Parser::by_type::by_type ()
-    : type (empty_symbol)
+  Dhcp4Parser::by_kind::by_kind () YY_NOEXCEPT
+    : kind_ (symbol_kind::S_YYEMPTY)
   {}
 
 #if 201103L <= YY_CPLUSPLUS
   inline
-  Dhcp4Parser::by_type::by_type (by_type&& that)
-    : type (that.type)
+  Dhcp4Parser::by_kind::by_kind (by_kind&& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
   {
     that.clear ();
   }
 #endif
 
   inline
-  Dhcp4Parser::by_type::by_type (const by_type& that)
-    : type (that.type)
+  Dhcp4Parser::by_kind::by_kind (const by_kind& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
   {}
 
   inline
-  Dhcp4Parser::by_type::by_type (token_type t)
-    : type (yytranslate_ (t))
+  Dhcp4Parser::by_kind::by_kind (token_kind_type t) YY_NOEXCEPT
+    : kind_ (yytranslate_ (t))
   {}
 
+
+
   inline
   void
-  Dhcp4Parser::by_type::clear ()
+  Dhcp4Parser::by_kind::clear () YY_NOEXCEPT
   {
-    type = empty_symbol;
+    kind_ = symbol_kind::S_YYEMPTY;
   }
 
   inline
   void
-  Dhcp4Parser::by_type::move (by_type& that)
+  Dhcp4Parser::by_kind::move (by_kind& that)
   {
-    type = that.type;
+    kind_ = that.kind_;
     that.clear ();
   }
 
   inline
-  int
-  Dhcp4Parser::by_type::type_get () const YY_NOEXCEPT
+  Dhcp4Parser::symbol_kind_type
+  Dhcp4Parser::by_kind::kind () const YY_NOEXCEPT
   {
-    return type;
+    return kind_;
   }
 
+
   inline
-  Dhcp4Parser::token_type
-  Dhcp4Parser::by_type::token () const YY_NOEXCEPT
+  Dhcp4Parser::symbol_kind_type
+  Dhcp4Parser::by_kind::type_get () const YY_NOEXCEPT
   {
-    // YYTOKNUM[NUM] -- (External) token number corresponding to the
-    // (internal) symbol number NUM (which must be that of a token).  */
-    static
-    const unsigned short
-    yytoken_number_[] =
-    {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
-     425,   426,   427,   428,   429,   430,   431
-    };
-    return token_type (yytoken_number_[type]);
+    return this->kind ();
   }
 
+
 #line 14 "dhcp4_parser.yy"
 } } // isc::dhcp
-#line 4202 "dhcp4_parser.h"
-
+#line 5069 "dhcp4_parser.h"
 
 
 
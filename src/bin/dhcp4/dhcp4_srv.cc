@@ -34,6 +34,7 @@
 #include <dhcpsrv/lease_mgr.h>
 #include <dhcpsrv/lease_mgr_factory.h>
 #include <dhcpsrv/ncr_generator.h>
+#include <dhcpsrv/packet_latency.h>
 #include <dhcpsrv/shared_network.h>
 #include <dhcpsrv/subnet.h>
 #include <dhcpsrv/subnet_selector.h>
@@ -45,6 +46,7 @@
 #include <hooks/hooks_log.h>
 #include <hooks/hooks_manager.h>
 #include <stats/stats_mgr.h>
+#include <util/memory_arena.h>
 #include <util/strutil.h>
 #include <stats/stats_mgr.h>
 #include <log/logger.h>
@@ -78,6 +80,7 @@ using namespace isc::dhcp_ddns;
 using namespace isc::hooks;
 using namespace isc::log;
 using namespace isc::stats;
+using namespace isc::util;
 using namespace std;
 
 namespace {
@@ -93,6 +96,8 @@ struct Dhcp4Hooks {
     int hook_index_buffer4_send_;      ///< index for "buffer4_send" hook point
     int hook_index_lease4_decline_;    ///< index for "lease4_decline" hook point
     int hook_index_host4_identifier_;  ///< index for "host4_identifier" hook point
+    int argument_index_query4_;        ///< index for "query4" argument
+    int argument_index_response4_;     ///< index for "response4" argument
 
     /// Constructor that registers hook points for DHCPv4 engine
     Dhcp4Hooks() {
@@ -105,6 +110,8 @@ struct Dhcp4Hooks {
         hook_index_buffer4_send_      = HooksManager::registerHook("buffer4_send");
         hook_index_lease4_decline_    = HooksManager::registerHook("lease4_decline");
         hook_index_host4_identifier_  = HooksManager::registerHook("host4_identifier");
+        argument_index_query4_        = HooksManager::registerArgument("query4");
+        argument_index_response4_     = HooksManager::registerArgument("response4");
     }
 };
 
@@ -164,6 +171,7 @@ Dhcpv4Exchange::Dhcpv4Exchange(const AllocEnginePtr& alloc_engine,
             alloc_engine->findReservation(*context_);
         }
     }
+    query->markStage(Pkt::HOSTS_LOOKED_UP);
 
     // Set KNOWN builtin class if something was found, UNKNOWN if not.
     if (!context_->hosts_.empty()) {
@@ -379,7 +387,7 @@ Dhcpv4Exchange::setHostIdentifiers() {
                 ScopedCalloutHandleState callout_handle_state(callout_handle);
 
                 // Pass incoming packet as argument
-                callout_handle->setArgument("query4", context_->query_);
+                callout_handle->setArgument(Hooks.argument_index_query4_, context_->query_);
                 callout_handle->setArgument("id_type", type);
                 callout_handle->setArgument("id_value", id);
 
@@ -448,7 +456,9 @@ Dhcpv4Srv::Dhcpv4Srv(uint16_t server_port, uint16_t client_port,
       server_port_(server_port), use_bcast_(use_bcast),
       client_port_(client_port),
       network_state_(new NetworkState(NetworkState::DHCPv4)),
-      cb_control_(new CBControlDHCPv4()) {
+      cb_control_(new CBControlDHCPv4()), lease_lookup_(),
+      lease_lookup_parking_(new ParkingLot()), packet_arena_chunk_size_(0),
+      packet_latency_("pkt4") {
 
     LOG_DEBUG(dhcp4_logger, DBG_DHCP4_START, DHCP4_OPEN_SOCKET)
         .arg(server_port);
@@ -504,6 +514,9 @@ Dhcpv4Srv::~Dhcpv4Srv() {
 
     IfaceMgr::instance().closeSockets();
 
+    // Stop the lease lookups before the lease manager goes away.
+    lease_lookup_.reset();
+
     // The lease manager was instantiated during DHCPv4Srv configuration,
     // so we should clean up after ourselves.
     LeaseMgrFactory::destroy();
@@ -550,7 +563,7 @@ Dhcpv4Srv::selectSubnet(const Pkt4Ptr& query, bool& drop,
         ScopedEnableOptionsCopy<Pkt4> query4_options_copy(query);
 
         // Set new arguments
-        callout_handle->setArgument("query4", query);
+        callout_handle->setArgument(Hooks.argument_index_query4_, query);
         callout_handle->setArgument("subnet4", subnet);
         callout_handle->setArgument("subnet4collection",
                                     cfgmgr.getCurrentCfg()->
@@ -668,7 +681,7 @@ Dhcpv4Srv::selectSubnet4o6(const Pkt4Ptr& query, bool& drop,
         ScopedCalloutHandleState callout_handle_state(callout_handle);
 
         // Set new arguments
-        callout_handle->setArgument("query4", query);
+        callout_handle->setArgument(Hooks.argument_index_query4_, query);
         callout_handle->setArgument("subnet4", subnet);
         callout_handle->setArgument("subnet4collection",
                                     cfgmgr.getCurrentCfg()->
@@ -774,6 +787,11 @@ Dhcpv4Srv::run_one() {
         // point are: the interface, source address and destination addresses
         // and ports.
         if (query) {
+            // The receive time was stamped when the packet was read from
+            // the socket, possibly long before it was dequeued.
+            query->markStage(Pkt::RECEIVED, query->getTimestamp());
+            query->markStage(Pkt::DEQUEUED);
+
             LOG_DEBUG(packet4_logger, DBG_DHCP4_BASIC, DHCP4_BUFFER_RECEIVED)
                 .arg(query->getRemoteAddr().toText())
                 .arg(query->getRemotePort())
@@ -833,10 +851,16 @@ Dhcpv4Srv::run_one() {
                   DHCP4_PACKET_DROP_0008)
             .arg(query->getLabel());
         return;
-    } else {
-        processPacket(query, rsp);
     }
 
+    // Objects created from now on until the response is sent are taken
+    // from the per-packet arena, if enabled. The arena is released when
+    // the last of these objects is destroyed. The scope is opened only
+    // now: control commands are run while waiting for packets and the
+    // objects they create outlive the packet.
+    MemoryArenaScope arena_scope(packet_arena_chunk_size_);
+    processPacket(query, rsp);
+
     if (!rsp) {
         return;
     }
@@ -871,7 +895,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
         ScopedEnableOptionsCopy<Pkt4> query4_options_copy(query);
 
         // Pass incoming packet as argument
-        callout_handle->setArgument("query4", query);
+        callout_handle->setArgument(Hooks.argument_index_query4_, query);
 
         // Call callouts
         HooksManager::callCallouts(Hooks.hook_index_buffer4_receive_,
@@ -902,7 +926,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
             skip_unpack = true;
         }
 
-        callout_handle->getArgument("query4", query);
+        callout_handle->getArgument(Hooks.argument_index_query4_, query);
     }
 
     // Unpack the packet information unless the buffer4_receive callouts
@@ -938,6 +962,8 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
         }
     }
 
+    query->markStage(Pkt::UNPACKED);
+
     // Update statistics accordingly for received packet.
     processStatsReceived(query);
 
@@ -948,6 +974,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
 
     // Now it is classified the deferred unpacking can be done.
     deferredUnpack(query);
+    query->markStage(Pkt::CLASSIFIED);
 
     // Check whether the message should be further processed or discarded.
     // There is no need to log anything here. This function logs by itself.
@@ -986,7 +1013,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
         ScopedEnableOptionsCopy<Pkt4> query4_options_copy(query);
 
         // Pass incoming packet as argument
-        callout_handle->setArgument("query4", query);
+        callout_handle->setArgument(Hooks.argument_index_query4_, query);
 
         // Call callouts
         HooksManager::callCallouts(Hooks.hook_index_pkt4_receive_,
@@ -1003,7 +1030,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
             return;
         }
 
-        callout_handle->getArgument("query4", query);
+        callout_handle->getArgument(Hooks.argument_index_query4_, query);
     }
 
     // Check the DROP special class.
@@ -1014,20 +1041,137 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
                                                   static_cast<int64_t>(1));
         return;
     }
+    query->markStage(Pkt::ACCEPTED);
+
+    // When the leases are fetched by the lease lookup threads the query
+    // is parked until they are available.
+    if (allow_packet_park && lease_lookup_ && parkForLeaseLookup(query)) {
+        return;
+    }
+
+    processDhcp4Query(query, rsp, allow_packet_park);
+}
+
+bool
+Dhcpv4Srv::parkForLeaseLookup(const Pkt4Ptr& query) {
+    if (((query->getType() != DHCPDISCOVER) &&
+         (query->getType() != DHCPREQUEST)) ||
+        !AsyncLeaseLookup::isSupported()) {
+        return (false);
+    }
+
+    HWAddrPtr hwaddr = query->getHWAddr();
+    if (!hwaddr || hwaddr->hwaddr_.empty()) {
+        return (false);
+    }
+
+    ClientIdPtr clientid;
+    OptionPtr opt_clientid = query->getOption(DHO_DHCP_CLIENT_IDENTIFIER);
+    if (opt_clientid) {
+        try {
+            clientid.reset(new ClientId(opt_clientid->getData()));
+        } catch (...) {
+            // An invalid client identifier is not used to look up the
+            // leases: the allocation engine does not use it either.
+        }
+    }
+
+    // The leases are handed over to the callback invoked when the query
+    // is unparked.
+    boost::shared_ptr<ClientLeases4Ptr> client_leases(new ClientLeases4Ptr());
+    ParkingLotPtr parking_lot = lease_lookup_parking_;
+    parking_lot->reference(query);
+    parking_lot->park(query, [this, query, client_leases]() {
+        try {
+            Pkt4Ptr pkt = query;
+            Pkt4Ptr rsp;
+            processDhcp4Query(pkt, rsp, true, *client_leases);
+            if (rsp) {
+                CalloutHandlePtr callout_handle = getCalloutHandle(pkt);
+                processPacketBufferSend(callout_handle, rsp);
+            }
+        } catch (const std::exception& ex) {
+            LOG_ERROR(packet4_logger, DHCP4_PACKET_PROCESS_STD_EXCEPTION)
+                .arg(ex.what());
+        } catch (...) {
+            LOG_ERROR(packet4_logger, DHCP4_PACKET_PROCESS_EXCEPTION);
+        }
+    });
+
+    bool started = lease_lookup_->getClientLeases4(clientid, hwaddr,
+        [parking_lot, query, client_leases](const ClientLeases4Ptr& leases) {
+        if (!leases) {
+            LOG_DEBUG(bad_packet4_logger, DBG_DHCP4_BASIC,
+                      DHCP4_PACKET_DROP_0012)
+                .arg(query->getLabel());
+            isc::stats::StatsMgr::instance().addValue("pkt4-receive-drop",
+                                                      static_cast<int64_t>(1));
+            parking_lot->drop(query);
+            return;
+        }
+        *client_leases = leases;
+        parking_lot->unpark(query);
+    });
+
+    if (!started) {
+        parking_lot->drop(query);
+        LOG_DEBUG(bad_packet4_logger, DBG_DHCP4_BASIC, DHCP4_PACKET_DROP_0011)
+            .arg(query->getLabel());
+        isc::stats::StatsMgr::instance().addValue("pkt4-receive-drop",
+                                                  static_cast<int64_t>(1));
+    }
+
+    return (true);
+}
+
+void
+Dhcpv4Srv::waitLeaseLookups() {
+    if (lease_lookup_) {
+        try {
+            lease_lookup_->wait();
+        } catch (const isc::db::DbOperationError&) {
+            // The loss of connectivity has been logged and the lease
+            // backend is about to be opened again.
+        }
+    }
+}
+
+void
+Dhcpv4Srv::configurePacketProcessing(const ConstSrvConfigPtr& cfg) {
+    // Check if the objects created for each packet should be allocated
+    // from a per-packet memory arena.
+    packet_arena_chunk_size_ = cfg->getPacketArenaChunkSize();
+
+    // Check if the slow packets should be reported.
+    packet_latency_.setSlowThreshold(cfg->getPacketSlowThreshold());
+
+    // Check if the leases of the clients should be fetched by
+    // dedicated threads. The threads are stopped before the lease
+    // backend is reopened.
+    lease_lookup_.reset();
+    const uint32_t lookup_threads = cfg->getLeaseLookupThreads();
+    if (lookup_threads > 0) {
+        lease_lookup_.reset(new AsyncLeaseLookup(lookup_threads));
+    }
+}
 
+void
+Dhcpv4Srv::processDhcp4Query(Pkt4Ptr& query, Pkt4Ptr& rsp,
+                             bool allow_packet_park,
+                             const ClientLeases4Ptr& client_leases) {
     AllocEngine::ClientContext4Ptr ctx;
 
     try {
         switch (query->getType()) {
         case DHCPDISCOVER:
-            rsp = processDiscover(query);
+            rsp = processDiscover(query, client_leases);
             break;
 
         case DHCPREQUEST:
             // Note that REQUEST is used for many things in DHCPv4: for
             // requesting new leases, renewing existing ones and even
             // for rebinding.
-            rsp = processRequest(query, ctx);
+            rsp = processRequest(query, ctx, client_leases);
             break;
 
         case DHCPRELEASE:
@@ -1066,6 +1210,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
         isc::stats::StatsMgr::instance().addValue("pkt4-receive-drop",
                                                   static_cast<int64_t>(1));
     }
+    query->markStage(Pkt::PROCESSED);
 
     bool packet_park = false;
 
@@ -1081,7 +1226,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
         ScopedEnableOptionsCopy<Pkt4> query4_options_copy(query);
 
         // Also pass the corresponding query packet as argument
-        callout_handle->setArgument("query4", query);
+        callout_handle->setArgument(Hooks.argument_index_query4_, query);
 
         Lease4CollectionPtr new_leases(new Lease4Collection());
         if (ctx->new_lease_) {
@@ -1149,6 +1294,10 @@ Dhcpv4Srv::processPacketPktSend(hooks::CalloutHandlePtr& callout_handle,
         return;
     }
 
+    // The response carries the processing stages of its query until it
+    // is sent.
+    rsp->copyStageTimes(*query);
+
     // Specifies if server should do the packing
     bool skip_pack = false;
 
@@ -1166,10 +1315,10 @@ Dhcpv4Srv::processPacketPktSend(hooks::CalloutHandlePtr& callout_handle,
         ScopedEnableOptionsCopy<Pkt4> query_resp_options_copy(query, rsp);
 
         // Set our response
-        callout_handle->setArgument("response4", rsp);
+        callout_handle->setArgument(Hooks.argument_index_response4_, rsp);
 
         // Also pass the corresponding query packet as argument
-        callout_handle->setArgument("query4", query);
+        callout_handle->setArgument(Hooks.argument_index_query4_, query);
 
         // Call all installed callouts
         HooksManager::callCallouts(Hooks.hook_index_pkt4_send_,
@@ -1198,6 +1347,7 @@ Dhcpv4Srv::processPacketPktSend(hooks::CalloutHandlePtr& callout_handle,
                 .arg(e.what());
         }
     }
+    rsp->markStage(Pkt::PACKED);
 }
 
 void
@@ -1224,7 +1374,7 @@ Dhcpv4Srv::processPacketBufferSend(CalloutHandlePtr& callout_handle,
             ScopedEnableOptionsCopy<Pkt4> resp4_options_copy(rsp);
 
             // Pass incoming packet as argument
-            callout_handle->setArgument("response4", rsp);
+            callout_handle->setArgument(Hooks.argument_index_response4_, rsp);
 
             // Call callouts
             HooksManager::callCallouts(Hooks.hook_index_buffer4_send_,
@@ -1241,7 +1391,7 @@ Dhcpv4Srv::processPacketBufferSend(CalloutHandlePtr& callout_handle,
                 return;
             }
 
-            callout_handle->getArgument("response4", rsp);
+            callout_handle->getArgument(Hooks.argument_index_response4_, rsp);
         }
 
         LOG_DEBUG(packet4_logger, DBG_DHCP4_BASIC, DHCP4_PACKET_SEND)
@@ -1262,10 +1412,21 @@ Dhcpv4Srv::processPacketBufferSend(CalloutHandlePtr& callout_handle,
             .arg(static_cast<int>(rsp->getType()))
             .arg(rsp->toText());
         sendPacket(rsp);
+        rsp->markStage(Pkt::SENT);
 
         // Update statistics accordingly for sent packet.
         processStatsSent(rsp);
 
+        // Record the latencies of the processing stages and report the
+        // breakdown of the outliers.
+        const uint64_t total = packet_latency_.record(*rsp);
+        if (packet_latency_.reportSlow(total)) {
+            LOG_WARN(packet4_logger, DHCP4_PACKET_SLOW)
+                .arg(rsp->getLabel())
+                .arg(total)
+                .arg(PacketLatency::breakdownToText(*rsp));
+        }
+
     } catch (const std::exception& e) {
         LOG_ERROR(packet4_logger, DHCP4_PACKET_SEND_FAIL)
             .arg(rsp->getLabel())
@@ -1422,6 +1583,29 @@ Dhcpv4Srv::appendRequestedOptions(Dhcpv4Exchange& ex) {
     if (option_prl) {
         requested_opts = option_prl->getValues();
     }
+
+    // Use the options resolved for this option list by the previous
+    // packets if the list is made of the configured scopes only.
+    ConstResolvedCfgOptionPtr resolved = CfgMgr::instance().getCurrentCfg()->
+        getCfgOptionListCache()->get(co_list, DHCP4_OPTION_SPACE);
+    if (resolved) {
+        const std::vector<uint16_t>& persistent = resolved->getPersistentCodes();
+        for (std::vector<uint16_t>::const_iterator code = persistent.begin();
+             code != persistent.end(); ++code) {
+            requested_opts.push_back(static_cast<uint8_t>(*code));
+        }
+        for (std::vector<uint8_t>::const_iterator opt = requested_opts.begin();
+             opt != requested_opts.end(); ++opt) {
+            if (!resp->getOption(*opt)) {
+                OptionPtr option = resolved->get(*opt);
+                if (option) {
+                    resp->addOption(option);
+                }
+            }
+        }
+        return;
+    }
+
     // Iterate on the configured option list to add persistent options
     for (CfgOptionList::const_iterator copts = co_list.begin();
          copts != co_list.end(); ++copts) {
@@ -2110,6 +2294,7 @@ Dhcpv4Srv::assignLease(Dhcpv4Exchange& ex) {
     ctx->callout_handle_ = callout_handle;
 
     Lease4Ptr lease = alloc_engine_->allocateLease4(*ctx);
+    query->markStage(Pkt::LEASES_ALLOCATED);
 
     // Subnet may be modified by the allocation engine, if the initial subnet
     // belongs to a shared network.
@@ -2615,17 +2800,22 @@ Dhcpv4Srv::getNetmaskOption(const Subnet4Ptr& subnet) {
 }
 
 Pkt4Ptr
-Dhcpv4Srv::processDiscover(Pkt4Ptr& discover) {
+Dhcpv4Srv::processDiscover(Pkt4Ptr& discover,
+                           const ClientLeases4Ptr& client_leases) {
     sanityCheck(discover, FORBIDDEN);
 
     bool drop = false;
-    Dhcpv4Exchange ex(alloc_engine_, discover, selectSubnet(discover, drop));
+    Subnet4Ptr subnet = selectSubnet(discover, drop);
+    discover->markStage(Pkt::SUBNET_SELECTED);
+    Dhcpv4Exchange ex(alloc_engine_, discover, subnet);
 
     // Stop here if selectSubnet decided to drop the packet
     if (drop) {
         return (Pkt4Ptr());
     }
 
+    ex.getContext()->client_leases_ = client_leases;
+
     // If DHCPDISCOVER message contains the FQDN or Hostname option, server
     // may respond to the client with the appropriate FQDN or Hostname
     // option to indicate that whether it will take responsibility for
@@ -2674,18 +2864,23 @@ Dhcpv4Srv::processDiscover(Pkt4Ptr& discover) {
 }
 
 Pkt4Ptr
-Dhcpv4Srv::processRequest(Pkt4Ptr& request, AllocEngine::ClientContext4Ptr& context) {
+Dhcpv4Srv::processRequest(Pkt4Ptr& request, AllocEngine::ClientContext4Ptr& context,
+                          const ClientLeases4Ptr& client_leases) {
     /// @todo Uncomment this (see ticket #3116)
     /// sanityCheck(request, MANDATORY);
 
     bool drop = false;
-    Dhcpv4Exchange ex(alloc_engine_, request, selectSubnet(request, drop));
+    Subnet4Ptr subnet = selectSubnet(request, drop);
+    request->markStage(Pkt::SUBNET_SELECTED);
+    Dhcpv4Exchange ex(alloc_engine_, request, subnet);
 
     // Stop here if selectSubnet decided to drop the packet
     if (drop) {
         return (Pkt4Ptr());
     }
 
+    ex.getContext()->client_leases_ = client_leases;
+
     // If DHCPREQUEST message contains the FQDN or Hostname option, server
     // should respond to the client with the appropriate FQDN or Hostname
     // option to indicate if it takes responsibility for the DNS updates.
@@ -2791,7 +2986,7 @@ Dhcpv4Srv::processRelease(Pkt4Ptr& release, AllocEngine::ClientContext4Ptr& cont
             ScopedEnableOptionsCopy<Pkt4> query4_options_copy(release);
 
             // Pass the original packet
-            callout_handle->setArgument("query4", release);
+            callout_handle->setArgument(Hooks.argument_index_query4_, release);
 
             // Pass the lease to be updated
             callout_handle->setArgument("lease4", lease);
@@ -2945,7 +3140,7 @@ Dhcpv4Srv::declineLease(const Lease4Ptr& lease, const Pkt4Ptr& decline,
 
         // Pass incoming Decline and the lease to be declined.
         callout_handle->setArgument("lease4", lease);
-        callout_handle->setArgument("query4", decline);
+        callout_handle->setArgument(Hooks.argument_index_query4_, decline);
 
         // Call callouts
         HooksManager::callCallouts(Hooks.hook_index_lease4_decline_,
@@ -3006,7 +3201,9 @@ Dhcpv4Srv::processInform(Pkt4Ptr& inform) {
     sanityCheck(inform, FORBIDDEN);
 
     bool drop = false;
-    Dhcpv4Exchange ex(alloc_engine_, inform, selectSubnet(inform, drop));
+    Subnet4Ptr subnet = selectSubnet(inform, drop);
+    inform->markStage(Pkt::SUBNET_SELECTED);
+    Dhcpv4Exchange ex(alloc_engine_, inform, subnet);
 
     // Stop here if selectSubnet decided to drop the packet
     if (drop) {
@@ -3704,6 +3901,7 @@ void Dhcpv4Srv::discardPackets() {
     isc::dhcp::Pkt4Ptr pkt4ptr_empty;
     isc::dhcp::getCalloutHandle(pkt4ptr_empty);
     HooksManager::clearParkingLots();
+    lease_lookup_parking_.reset(new ParkingLot());
 }
 
 }   // namespace dhcp
@@ -16,13 +16,16 @@
 #include <dhcp/option_custom.h>
 #include <dhcp_ddns/ncr_msg.h>
 #include <dhcpsrv/alloc_engine.h>
+#include <dhcpsrv/async_lease_lookup.h>
 #include <dhcpsrv/cb_ctl_dhcp4.h>
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/callout_handle_store.h>
 #include <dhcpsrv/d2_client_mgr.h>
 #include <dhcpsrv/network_state.h>
+#include <dhcpsrv/packet_latency.h>
 #include <dhcpsrv/subnet.h>
 #include <hooks/callout_handle.h>
+#include <hooks/parking_lots.h>
 #include <process/daemon.h>
 
 #include <boost/noncopyable.hpp>
@@ -291,6 +294,36 @@ public:
     void processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp,
                        bool allow_packet_park = true);
 
+    /// @brief Process a DHCPv4 query accepted by @ref processPacket.
+    ///
+    /// It calls per-type processXXX methods and the leases4_committed
+    /// callouts.
+    ///
+    /// @param query A pointer to the packet to be processed.
+    /// @param rsp A pointer to the response
+    /// @param allow_packet_park Indicates if parking a packet is allowed.
+    /// @param client_leases Leases of the client fetched before the
+    /// processing, may be null.
+    void processDhcp4Query(Pkt4Ptr& query, Pkt4Ptr& rsp,
+                           bool allow_packet_park,
+                           const ClientLeases4Ptr& client_leases = ClientLeases4Ptr());
+
+    /// @brief Waits for the pending asynchronous lease lookups.
+    ///
+    /// The packets parked for these lookups are processed. It must be
+    /// called before the lease backend is reconfigured.
+    void waitLeaseLookups();
+
+    /// @brief Applies the packet processing settings of a configuration.
+    ///
+    /// Sets the chunk size of the per-packet memory arenas and the
+    /// threshold of the slow packets, and restarts the lease lookup
+    /// threads. It must be called after @ref waitLeaseLookups and before
+    /// the lease backend is reconfigured.
+    ///
+    /// @param cfg Server configuration.
+    void configurePacketProcessing(const ConstSrvConfigPtr& cfg);
+
 
     /// @brief Instructs the server to shut down.
     void shutdown();
@@ -467,9 +500,12 @@ protected:
     /// as an offer to a client if it should be served.
     ///
     /// @param discover DISCOVER message received from client
+    /// @param client_leases Leases of the client fetched before the
+    /// processing, may be null.
     ///
     /// @return OFFER message or NULL
-    Pkt4Ptr processDiscover(Pkt4Ptr& discover);
+    Pkt4Ptr processDiscover(Pkt4Ptr& discover,
+                            const ClientLeases4Ptr& client_leases = ClientLeases4Ptr());
 
     /// @brief Processes incoming REQUEST and returns REPLY response.
     ///
@@ -483,9 +519,12 @@ protected:
     /// @param request a message received from client
     /// @param [out] context pointer to the client context where allocated
     /// and deleted leases are stored.
+    /// @param client_leases Leases of the client fetched before the
+    /// processing, may be null.
     ///
     /// @return ACK or NAK message
-    Pkt4Ptr processRequest(Pkt4Ptr& request, AllocEngine::ClientContext4Ptr& context);
+    Pkt4Ptr processRequest(Pkt4Ptr& request, AllocEngine::ClientContext4Ptr& context,
+                           const ClientLeases4Ptr& client_leases = ClientLeases4Ptr());
 
     /// @brief Processes incoming DHCPRELEASE messages.
     ///
@@ -953,6 +992,18 @@ protected:
     void processPacketBufferSend(hooks::CalloutHandlePtr& callout_handle,
                                  Pkt4Ptr& rsp);
 
+    /// @brief Parks a query until the leases of the client are fetched.
+    ///
+    /// The leases of DISCOVER and REQUEST clients are fetched by the
+    /// asynchronous lease lookup when the lease backend is a SQL database.
+    /// The query is processed when the lookup completes and the server
+    /// can process other packets in the meantime.
+    ///
+    /// @param query Pointer to the query.
+    /// @return true if the query was parked or dropped, false if it must
+    /// be processed now.
+    bool parkForLeaseLookup(const Pkt4Ptr& query);
+
     /// @brief Allocation Engine.
     /// Pointer to the allocation engine that we are currently using
     /// It must be a pointer, because we will support changing engines
@@ -994,6 +1045,31 @@ protected:
     /// @brief Controls access to the configuration backends.
     CBControlDHCPv4Ptr cb_control_;
 
+    /// @brief Asynchronous lease lookup.
+    ///
+    /// It is created when the @c lease-lookup-threads parameter is set
+    /// to a non zero number of threads.
+    AsyncLeaseLookupPtr lease_lookup_;
+
+    /// @brief Parking lot of the queries waiting for the leases of
+    /// their client.
+    hooks::ParkingLotPtr lease_lookup_parking_;
+
+    /// @brief Size of the chunks of the per-packet memory arena.
+    ///
+    /// When not zero, response packets, options, allocation engine
+    /// client contexts and callout handles created while a received
+    /// packet is processed are allocated from a @c isc::util::MemoryArena
+    /// which lives as long as these objects. It is set from the
+    /// @c packet-arena-chunk-size parameter.
+    size_t packet_arena_chunk_size_;
+
+    /// @brief Latencies of the processing stages of the packets.
+    ///
+    /// They are recorded when the responses are sent. The slow packets
+    /// are reported when the @c packet-slow-threshold parameter is set.
+    PacketLatency packet_latency_;
+
 public:
     /// Class methods for DHCPv4-over-DHCPv6 handler
 
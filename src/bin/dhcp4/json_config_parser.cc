@@ -32,6 +32,7 @@
 #include <dhcpsrv/parsers/shared_networks_list_parser.h>
 #include <dhcpsrv/parsers/sanity_checks_parser.h>
 #include <dhcpsrv/host_data_source_factory.h>
+#include <dhcpsrv/host_mgr.h>
 #include <dhcpsrv/timer_mgr.h>
 #include <process/config_ctl_parser.h>
 #include <hooks/hooks_parser.h>
@@ -49,6 +50,7 @@
 #include <netinet/in.h>
 #include <vector>
 #include <map>
+#include <set>
 
 using namespace std;
 using namespace isc;
@@ -83,6 +85,10 @@ public:
     /// - echo-client-id
     /// - decline-probation-period
     /// - dhcp4o6-port
+    /// - lease-lookup-threads
+    /// - packet-arena-chunk-size
+    /// - packet-slow-threshold
+    /// - host-filter-rebuild-interval
     /// - user-context
     ///
     /// @throw DhcpConfigError if parameters are missing or
@@ -103,6 +109,33 @@ public:
         uint16_t dhcp4o6_port = getUint16(global, "dhcp4o6-port");
         cfg->setDhcp4o6Port(dhcp4o6_port);
 
+        // Set the number of threads fetching the leases of the clients.
+        if (global->contains("lease-lookup-threads")) {
+            int64_t lookup_threads = getInteger(global, "lease-lookup-threads",
+                                                0, MAX_LEASE_LOOKUP_THREADS);
+            cfg->setLeaseLookupThreads(lookup_threads);
+        }
+
+        // Set the chunk size of the per-packet memory arenas.
+        if (global->contains("packet-arena-chunk-size")) {
+            uint32_t chunk_size = getUint32(global, "packet-arena-chunk-size");
+            cfg->setPacketArenaChunkSize(chunk_size);
+        }
+
+        // Set the processing time above which a packet is reported as slow.
+        if (global->contains("packet-slow-threshold")) {
+            int64_t slow_threshold = getInteger(global, "packet-slow-threshold", 0,
+                                                std::numeric_limits<int64_t>::max());
+            cfg->setPacketSlowThreshold(slow_threshold);
+        }
+
+        // Set the interval between the rebuilds of the host filter.
+        if (global->contains("host-filter-rebuild-interval")) {
+            int64_t filter_interval = getInteger(global, "host-filter-rebuild-interval",
+                                                 0, HOST_FILTER_MAX_REBUILD_INTERVAL);
+            cfg->setHostFilterRebuildInterval(filter_interval);
+        }
+
         // Set the global user context.
         ConstElementPtr user_context = global->get("user-context");
         if (user_context) {
@@ -317,6 +350,8 @@ configureDhcp4Server(Dhcpv4Srv& server, isc::data::ConstElementPtr config_set,
     // Remove any existing timers.
     if (!check_only) {
         TimerMgr::instance()->unregisterTimers();
+        // Complete the lease lookups while the lease backend is still open.
+        server.waitLeaseLookups();
         server.discardPackets();
         server.getCBControl()->reset();
     }
@@ -561,6 +596,11 @@ configureDhcp4Server(Dhcpv4Srv& server, isc::data::ConstElementPtr config_set,
                  (config_pair.first == "calculate-tee-times") ||
                  (config_pair.first == "t1-percent") ||
                  (config_pair.first == "t2-percent") ||
+                 (config_pair.first == "cache-threshold") ||
+                 (config_pair.first == "lease-lookup-threads") ||
+                 (config_pair.first == "packet-arena-chunk-size") ||
+                 (config_pair.first == "packet-slow-threshold") ||
+                 (config_pair.first == "host-filter-rebuild-interval") ||
                  (config_pair.first == "loggers") ||
                  (config_pair.first == "hostname-char-set") ||
                  (config_pair.first == "hostname-char-replacement")) {
@@ -705,5 +745,211 @@ configureDhcp4Server(Dhcpv4Srv& server, isc::data::ConstElementPtr config_set,
     return (answer);
 }
 
+isc::data::ConstElementPtr
+patchDhcp4Subnets(isc::data::ConstElementPtr args) {
+    ConstElementPtr answer;
+    try {
+        if (!args || (args->getType() != Element::map)) {
+            isc_throw(DhcpConfigError, "arguments must be a map");
+        }
+        ConstElementPtr subnets = args->get("subnet4");
+        if (subnets && (subnets->getType() != Element::list)) {
+            isc_throw(DhcpConfigError, "'subnet4' must be a list");
+        }
+        ConstElementPtr remove = args->get("remove");
+        if (remove && (remove->getType() != Element::list)) {
+            isc_throw(DhcpConfigError, "'remove' must be a list");
+        }
+
+        SrvConfigPtr current = CfgMgr::instance().getCurrentCfg();
+        ConstElementPtr globals = current->getConfiguredGlobals();
+        CfgSubnets4Ptr current_subnets = current->getCfgSubnets4();
+        CfgSharedNetworks4Ptr networks = current->getCfgSharedNetworks4();
+
+        // Collect the identifiers of the subnets to remove.
+        std::set<SubnetID> removed;
+        if (remove) {
+            BOOST_FOREACH(ConstElementPtr id, remove->listValue()) {
+                if ((id->getType() != Element::integer) ||
+                    (id->intValue() <= 0) ||
+                    (id->intValue() > std::numeric_limits<uint32_t>::max())) {
+                    isc_throw(DhcpConfigError, "invalid subnet id "
+                              << id->str() << " in 'remove'");
+                }
+                SubnetID subnet_id = static_cast<SubnetID>(id->intValue());
+                if (!current_subnets->getBySubnetId(subnet_id)) {
+                    isc_throw(DhcpConfigError, "no subnet with id "
+                              << subnet_id << " to remove");
+                }
+                removed.insert(subnet_id);
+            }
+        }
+
+        // The subnets are parsed into a fresh staging configuration holding
+        // the current option definitions: the parsers look up the option
+        // definitions and store the reservations there.
+        CfgMgr::instance().rollback();
+        SrvConfigPtr staging = CfgMgr::instance().getStagingCfg();
+        current->getCfgOptionDef()->copyTo(*staging->getCfgOptionDef());
+
+        // The new subnets and the shared networks they belong to.
+        std::vector<std::pair<Subnet4Ptr, SharedNetwork4Ptr> > patched;
+        std::set<SubnetID> patched_ids;
+        if (subnets) {
+            BOOST_FOREACH(ConstElementPtr subnet, subnets->listValue()) {
+                if (!subnet->get("id")) {
+                    isc_throw(DhcpConfigError, "subnet must have an id ("
+                              << subnet->getPosition() << ")");
+                }
+                SubnetID subnet_id = static_cast<SubnetID>(SimpleParser::
+                    getInteger(subnet, "id", 1,
+                               std::numeric_limits<uint32_t>::max()));
+                if (removed.count(subnet_id) > 0) {
+                    isc_throw(DhcpConfigError, "subnet with id " << subnet_id
+                              << " is both replaced and removed");
+                }
+                if (!patched_ids.insert(subnet_id).second) {
+                    isc_throw(DhcpConfigError, "subnet with id " << subnet_id
+                              << " is specified more than once");
+                }
+
+                // The subnet belongs to the shared network named by the
+                // "shared-network-name" parameter, an empty name meaning
+                // no shared network. Without this parameter a replaced
+                // subnet remains in its shared network.
+                ElementPtr mutable_subnet = isc::data::copy(subnet);
+                SharedNetwork4Ptr network;
+                ConstElementPtr network_name =
+                    mutable_subnet->get("shared-network-name");
+                if (network_name) {
+                    std::string name = SimpleParser::getString(mutable_subnet,
+                        "shared-network-name");
+                    if (!name.empty()) {
+                        network = networks->getByName(name);
+                        if (!network) {
+                            isc_throw(DhcpConfigError, "no shared network named '"
+                                      << name << "' for the subnet with id "
+                                      << subnet_id << " ("
+                                      << network_name->getPosition() << ")");
+                        }
+                    }
+                    mutable_subnet->remove("shared-network-name");
+                } else {
+                    ConstSubnet4Ptr existing =
+                        current_subnets->getBySubnetId(subnet_id);
+                    if (existing) {
+                        existing->getSharedNetwork(network);
+                    }
+                }
+
+                // Fill the parameters the way a full configuration would:
+                // the defaults, then the parameters inherited from the
+                // shared network or from the globals.
+                if (network) {
+                    SimpleParser::setDefaults(mutable_subnet,
+                                              SimpleParser4::SHARED_SUBNET4_DEFAULTS);
+                    ElementPtr mutable_network = network->toElement();
+                    SimpleParser::deriveParams(globals, mutable_network,
+                                               SimpleParser4::INHERIT_TO_SUBNET4);
+                    SimpleParser::deriveParams(mutable_network, mutable_subnet,
+                                               SimpleParser4::INHERIT_TO_SUBNET4);
+                } else {
+                    SimpleParser::setDefaults(mutable_subnet,
+                                              SimpleParser4::SUBNET4_DEFAULTS);
+                    SimpleParser::deriveParams(globals, mutable_subnet,
+                                               SimpleParser4::INHERIT_TO_SUBNET4);
+                }
+
+                Subnet4ConfigParser parser;
+                Subnet4Ptr new_subnet = parser.parse(mutable_subnet);
+
+                // Create the options of the subnet from the definitions.
+                new_subnet->getCfgOption()->createOptions(current->getCfgOptionDef());
+                for (auto pool : new_subnet->getPoolsWritable(Lease::TYPE_V4)) {
+                    pool->getCfgOption()->createOptions(current->getCfgOptionDef());
+                }
+                new_subnet->setFetchGlobalsFn([]() -> ConstElementPtr {
+                    return (CfgMgr::instance().getCurrentCfg()->getConfiguredGlobals());
+                });
+                patched.push_back(std::make_pair(new_subnet, network));
+            }
+        }
+
+        // A subnet with the same prefix but another id would be rejected
+        // when the subnets are added below: report it with the id of the
+        // conflicting subnet. The prefixes of the removed and replaced
+        // subnets are available.
+        std::map<std::string, SubnetID> prefixes;
+        for (auto p = patched.begin(); p != patched.end(); ++p) {
+            const std::string prefix = p->first->toText();
+            ConstSubnet4Ptr same_prefix = current_subnets->getByPrefix(prefix);
+            if (same_prefix && (same_prefix->getID() != p->first->getID()) &&
+                (removed.count(same_prefix->getID()) == 0) &&
+                (patched_ids.count(same_prefix->getID()) == 0)) {
+                isc_throw(DhcpConfigError, "subnet with the prefix of '"
+                          << prefix << "' already exists with id "
+                          << same_prefix->getID());
+            }
+            auto inserted = prefixes.insert(std::make_pair(prefix,
+                                                           p->first->getID()));
+            if (!inserted.second) {
+                isc_throw(DhcpConfigError, "subnet with the prefix of '"
+                          << prefix << "' already exists with id "
+                          << inserted.first->second);
+            }
+        }
+
+        // Everything was checked: only the removed, replaced and added
+        // subnets and their reservations are changed in the current
+        // configuration, the others are left untouched. The statistics of
+        // the replaced and removed subnets must go before the subnets do.
+        CfgHostsPtr current_hosts = current->getCfgHosts();
+        current->removeStatistics();
+        std::set<SubnetID> deleted(removed);
+        deleted.insert(patched_ids.begin(), patched_ids.end());
+        for (auto id = deleted.begin(); id != deleted.end(); ++id) {
+            Subnet4Ptr existing = current_subnets->getSubnet(*id);
+            if (existing) {
+                SharedNetwork4Ptr network;
+                existing->getSharedNetwork(network);
+                if (network) {
+                    network->del(*id);
+                }
+                current_subnets->del(*id);
+            }
+            current_hosts->delAll4(*id);
+        }
+        for (auto p = patched.begin(); p != patched.end(); ++p) {
+            current_subnets->add(p->first);
+            if (p->second) {
+                p->second->add(p->first);
+            }
+            HostCollection hosts =
+                staging->getCfgHosts()->getAll4(p->first->getID());
+            for (auto host = hosts.begin(); host != hosts.end(); ++host) {
+                current_hosts->add(*host);
+            }
+        }
+        current->updateStatistics();
+        current->updateOptionsCache();
+        CfgMgr::instance().rollback();
+
+        LOG_INFO(dhcp4_logger, DHCP4_SUBNET_PATCH_COMPLETE)
+            .arg(patched.size()).arg(removed.size());
+
+        std::ostringstream msg;
+        msg << patched.size() << " IPv4 subnet(s) added or replaced, "
+            << removed.size() << " removed";
+        answer = isc::config::createAnswer(CONTROL_RESULT_SUCCESS, msg.str());
+
+    } catch (const std::exception& ex) {
+        CfgMgr::instance().rollback();
+        LOG_ERROR(dhcp4_logger, DHCP4_SUBNET_PATCH_FAIL).arg(ex.what());
+        answer = isc::config::createAnswer(CONTROL_RESULT_ERROR, ex.what());
+    }
+
+    return (answer);
+}
+
 }; // end of isc::dhcp namespace
 }; // end of isc namespace
@@ -60,6 +60,36 @@ configureDhcp4Server(Dhcpv4Srv&,
                      isc::data::ConstElementPtr config_set,
                      bool check_only = false);
 
+/// @brief Applies changes of IPv4 subnets to the current configuration.
+///
+/// Unlike @c configureDhcp4Server which parses the whole configuration
+/// again, this function parses only the given subnets. This makes
+/// changing a few subnets of a configuration holding a large number of
+/// subnets cheap.
+///
+/// The arguments are expected to be:
+/// { "subnet4": [ subnets to add or replace ], "remove": [ subnet ids ] }
+/// where both lists are optional. Each subnet must have an id: it
+/// replaces the existing subnet with this id or is added when there is
+/// no such subnet. A subnet may have a "shared-network-name" naming the
+/// existing shared network it belongs to, an empty name meaning none.
+/// Without this parameter a replaced subnet remains in its shared network
+/// and an added subnet does not belong to a shared network. The
+/// reservations of the replaced and removed subnets are replaced by the
+/// new ones.
+///
+/// The change is atomic: the new subnets and their reservations are
+/// parsed and all the conflicts are checked before the current
+/// configuration is changed, so an error leaves the configuration and its
+/// statistics intact. Only the removed, replaced and added subnets and
+/// their reservations are then changed in place: the cost does not depend
+/// on the number of other subnets and reservations.
+///
+/// @param args arguments of the subnet4-patch command
+/// @return answer that contains the result of the operation
+isc::data::ConstElementPtr
+patchDhcp4Subnets(isc::data::ConstElementPtr args);
+
 }; // end of isc::dhcp namespace
 }; // end of isc namespace
 
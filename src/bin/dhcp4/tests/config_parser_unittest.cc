@@ -243,6 +243,7 @@ const char* PARSER_CONFIGS[] = {
     "    \"renew-timer\": 1000, \n"
     "    \"config-control\": { \n"
     "       \"config-fetch-wait-time\": 10, \n"
+    "       \"notify-fifo\": \"/tmp/kea-cb-notify\", \n"
     "       \"config-databases\": [ { \n"
     "               \"type\": \"mysql\", \n"
     "               \"name\": \"keatest1\", \n"
@@ -4315,7 +4316,7 @@ TEST_F(Dhcp4ParserTest, d2ClientConfigGlobal) {
         "     \"sender-port\" : 778, "
         "     \"max-queue-size\" : 2048, "
         "     \"ncr-protocol\" : \"UDP\", "
-        "     \"ncr-format\" : \"JSON\", "
+        "     \"ncr-format\" : \"BINARY\", "
         "     \"override-no-update\" : true, "
         "     \"override-client-update\" : true, "
         "     \"replace-client-name\" : \"when-present\", "
@@ -4351,7 +4352,7 @@ TEST_F(Dhcp4ParserTest, d2ClientConfigGlobal) {
     EXPECT_EQ(778, d2_client_config->getSenderPort());
     EXPECT_EQ(2048, d2_client_config->getMaxQueueSize());
     EXPECT_EQ(dhcp_ddns::NCR_UDP, d2_client_config->getNcrProtocol());
-    EXPECT_EQ(dhcp_ddns::FMT_JSON, d2_client_config->getNcrFormat());
+    EXPECT_EQ(dhcp_ddns::FMT_BINARY, d2_client_config->getNcrFormat());
     EXPECT_TRUE(d2_client_config->getOverrideNoUpdate());
     EXPECT_TRUE(d2_client_config->getOverrideClientUpdate());
     EXPECT_EQ(D2ClientConfig::RCM_WHEN_PRESENT, d2_client_config->getReplaceClientNameMode());
@@ -6726,6 +6727,9 @@ TEST_F(Dhcp4ParserTest, configControlInfo) {
     // Verify that the config-fetch-wait-time is correct.
     EXPECT_FALSE(info->getConfigFetchWaitTime().unspecified());
     EXPECT_EQ(10, info->getConfigFetchWaitTime().get());
+
+    // Verify that the notify-fifo is correct.
+    EXPECT_EQ("/tmp/kea-cb-notify", info->getNotifyFifo());
 }
 
 // Check whether it is possible to configure server-tag
@@ -6986,5 +6990,124 @@ TEST_F(Dhcp4ParserTest, calculateTeeTimesInheritence) {
     EXPECT_TRUE(util::areDoublesEquivalent(0.875, subnet4->getT2Percent()));
 }
 
+// Checks inheritance of cache-threshold and that invalid values are rejected.
+TEST_F(Dhcp4ParserTest, cacheThresholdInheritance) {
+    // Configure the server. This should succeed.
+    string config =
+        "{ \n"
+        "    \"interfaces-config\": { \n"
+        "        \"interfaces\": [\"*\" ] \n"
+        "    }, \n"
+        "    \"valid-lifetime\": 4000, \n"
+        "    \"cache-threshold\": .25, \n"
+        "    \"shared-networks\": [ { \n"
+        "        \"name\": \"foo\", \n"
+        "        \"cache-threshold\": .5, \n"
+        "        \"subnet4\": ["
+        "        { "
+        "            \"id\": 100,"
+        "            \"subnet\": \"192.0.1.0/24\", \n"
+        "            \"pools\": [ { \"pool\": \"192.0.1.1-192.0.1.10\" } ], \n"
+        "            \"cache-threshold\": 0.0 \n"
+        "        }, \n"
+        "        {  \n"
+        "            \"id\": 200, \n"
+        "            \"subnet\": \"192.0.2.0/24\", \n"
+        "            \"pools\": [ { \"pool\": \"192.0.2.1-192.0.2.10\"} ] \n"
+        "        } \n"
+        "        ] \n"
+        "     } ], \n"
+        "    \"subnet4\": [ { \n"
+        "        \"id\": 300, \n"
+        "        \"subnet\": \"192.0.3.0/24\", \n"
+        "        \"pools\": [ { \"pool\":  \"192.0.3.0 - 192.0.3.15\" } ]\n"
+        "     } ] \n"
+        "} \n";
+
+    extractConfig(config);
+    configure(config, CONTROL_RESULT_SUCCESS, "");
+
+    CfgSubnets4Ptr subnets4 = CfgMgr::instance().getStagingCfg()->getCfgSubnets4();
+
+    // Subnet 100 should use its own explicit value.
+    ConstSubnet4Ptr subnet4 = subnets4->getBySubnetId(100);
+    ASSERT_TRUE(subnet4);
+    EXPECT_TRUE(util::areDoublesEquivalent(0., subnet4->getCacheThreshold()));
+
+    // Subnet 200 should use the shared-network value.
+    subnet4 = subnets4->getBySubnetId(200);
+    ASSERT_TRUE(subnet4);
+    EXPECT_TRUE(util::areDoublesEquivalent(0.5, subnet4->getCacheThreshold()));
+
+    // Subnet 300 should use the global value.
+    subnet4 = subnets4->getBySubnetId(300);
+    ASSERT_TRUE(subnet4);
+    EXPECT_TRUE(util::areDoublesEquivalent(0.25, subnet4->getCacheThreshold()));
+
+    // The threshold must be lower than 1.
+    config =
+        "{ \n"
+        "    \"interfaces-config\": { \n"
+        "        \"interfaces\": [\"*\" ] \n"
+        "    }, \n"
+        "    \"valid-lifetime\": 4000, \n"
+        "    \"subnet4\": [ { \n"
+        "        \"id\": 300, \n"
+        "        \"subnet\": \"192.0.3.0/24\", \n"
+        "        \"cache-threshold\": 1.0 \n"
+        "     } ] \n"
+        "} \n";
+
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = parseDHCP4(config));
+    ConstElementPtr status;
+    EXPECT_NO_THROW(status = configureDhcp4Server(*srv_, json));
+    checkResult(status, 1);
+}
+
+// This test checks that the packet processing settings are parsed
+// and kept in the configured globals.
+TEST_F(Dhcp4ParserTest, packetProcessingGlobals) {
+    string config =
+        "{ \n"
+        "    \"interfaces-config\": { \n"
+        "        \"interfaces\": [\"*\" ] \n"
+        "    }, \n"
+        "    \"lease-lookup-threads\": 4, \n"
+        "    \"packet-arena-chunk-size\": 8192, \n"
+        "    \"packet-slow-threshold\": 50000, \n"
+        "    \"host-filter-rebuild-interval\": 3600, \n"
+        "    \"subnet4\": [ ] \n"
+        "} \n";
+
+    extractConfig(config);
+    configure(config, CONTROL_RESULT_SUCCESS, "");
+
+    SrvConfigPtr cfg = CfgMgr::instance().getStagingCfg();
+    EXPECT_EQ(4, cfg->getLeaseLookupThreads());
+    EXPECT_EQ(8192, cfg->getPacketArenaChunkSize());
+    EXPECT_EQ(50000, cfg->getPacketSlowThreshold());
+    EXPECT_EQ(3600, cfg->getHostFilterRebuildInterval());
+    ConstElementPtr globals = cfg->getConfiguredGlobals();
+    ASSERT_TRUE(globals->get("packet-slow-threshold"));
+    EXPECT_EQ(50000, globals->get("packet-slow-threshold")->intValue());
+
+    // Out of range values are rejected.
+    config =
+        "{ \n"
+        "    \"interfaces-config\": { \n"
+        "        \"interfaces\": [\"*\" ] \n"
+        "    }, \n"
+        "    \"lease-lookup-threads\": 257, \n"
+        "    \"subnet4\": [ ] \n"
+        "} \n";
+
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = parseDHCP4(config));
+    ConstElementPtr status;
+    EXPECT_NO_THROW(status = configureDhcp4Server(*srv_, json));
+    checkResult(status, 1);
+}
+
 
 }
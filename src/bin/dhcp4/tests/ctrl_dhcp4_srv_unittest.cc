@@ -487,6 +487,7 @@ TEST_F(CtrlChannelDhcpv4SrvTest, commandsRegistration) {
     EXPECT_TRUE(command_list.find("\"shutdown\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-get\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-get-all\"") != string::npos);
+    EXPECT_TRUE(command_list.find("\"statistic-latency-get\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-remove\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-remove-all\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-reset\"") != string::npos);
@@ -495,6 +496,7 @@ TEST_F(CtrlChannelDhcpv4SrvTest, commandsRegistration) {
     EXPECT_TRUE(command_list.find("\"statistic-sample-age-set-all\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-sample-count-set\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-sample-count-set-all\"") != string::npos);
+    EXPECT_TRUE(command_list.find("\"subnet4-patch\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"version-get\"") != string::npos);
 
     // Ok, and now delete the server. It should deregister its commands.
@@ -629,6 +631,27 @@ TEST_F(CtrlChannelDhcpv4SrvTest, serverTagGet) {
     expected = "{ \"arguments\": { \"server-tag\": \"foobar\" }, \"result\": 0 }";
 }
 
+// This test verifies that the hooks-latency-get command returns the
+// latencies of the callouts and validates its arguments.
+TEST_F(CtrlChannelDhcpv4SrvTest, hooksLatencyGet) {
+    createUnixChannelServer();
+
+    std::string response;
+
+    // No hooks library is loaded.
+    sendUnixCommand("{ \"command\": \"hooks-latency-get\" }", response);
+    EXPECT_EQ("{ \"arguments\": {  }, \"result\": 0 }", response);
+
+    sendUnixCommand("{ \"command\": \"hooks-latency-get\", "
+                    "\"arguments\": { \"reset\": true } }", response);
+    EXPECT_EQ("{ \"arguments\": {  }, \"result\": 0 }", response);
+
+    sendUnixCommand("{ \"command\": \"hooks-latency-get\", "
+                    "\"arguments\": { \"reset\": \"yes\" } }", response);
+    EXPECT_EQ("{ \"result\": 1, \"text\": \"'reset' must be a boolean\" }",
+              response);
+}
+
 // This test verifies that the DHCP server immediately removed expired
 // This test verifies that the DHCP server immediately removed expired
 // leases on leases-reclaim command with remove = true
@@ -887,6 +910,183 @@ TEST_F(CtrlChannelDhcpv4SrvTest, configSet) {
     CfgMgr::instance().clear();
 }
 
+// Tests that the subnet4-patch command adds, replaces and removes subnets
+// of the current configuration.
+TEST_F(CtrlChannelDhcpv4SrvTest, subnet4Patch) {
+    createUnixChannelServer();
+
+    std::ostringstream os;
+    os << "{ \"command\": \"config-set\", \"arguments\": { \"Dhcp4\": { \n"
+        "    \"interfaces-config\": { \"interfaces\": [ \"*\" ] }, \n"
+        "    \"valid-lifetime\": 4000, \n"
+        "    \"lease-database\": { \"type\": \"memfile\", \"persist\": false }, \n"
+        "    \"subnet4\": [ \n"
+        "        { \"id\": 1, \"subnet\": \"192.2.0.0/24\", \n"
+        "          \"pools\": [ { \"pool\": \"192.2.0.1-192.2.0.50\" } ] }, \n"
+        "        { \"id\": 2, \"subnet\": \"192.2.1.0/24\", \n"
+        "          \"reservations\": [ { \"hw-address\": \"aa:bb:cc:dd:ee:ff\", \n"
+        "                                \"ip-address\": \"192.2.1.10\" } ] } \n"
+        "    ], \n"
+        "    \"control-socket\": { \"socket-type\": \"unix\", \n"
+        "                          \"socket-name\": \"" << socket_path_ << "\" } \n"
+        "} } }";
+
+    std::string response;
+    sendUnixCommand(os.str(), response);
+    EXPECT_EQ("{ \"result\": 0, \"text\": \"Configuration successful.\" }",
+              response);
+
+    // Replace the first subnet, add a third one and remove the second one.
+    sendUnixCommand("{ \"command\": \"subnet4-patch\", \"arguments\": { \n"
+                    "    \"subnet4\": [ \n"
+                    "        { \"id\": 1, \"subnet\": \"192.2.0.0/24\", \n"
+                    "          \"renew-timer\": 1000, \n"
+                    "          \"pools\": [ { \"pool\": \"192.2.0.100-192.2.0.150\" } ], \n"
+                    "          \"reservations\": [ { \"hw-address\": \"aa:bb:cc:dd:ee:ff\", \n"
+                    "                                \"ip-address\": \"192.2.0.10\" } ] }, \n"
+                    "        { \"id\": 3, \"subnet\": \"192.2.2.0/24\" } \n"
+                    "    ], \n"
+                    "    \"remove\": [ 2 ] \n"
+                    "} }", response);
+    EXPECT_EQ("{ \"result\": 0, \"text\": \"2 IPv4 subnet(s) added or "
+              "replaced, 1 removed\" }", response);
+
+    CfgSubnets4Ptr subnets = CfgMgr::instance().getCurrentCfg()->getCfgSubnets4();
+    EXPECT_EQ(2, subnets->getAll()->size());
+    EXPECT_FALSE(subnets->getBySubnetId(2));
+    ConstSubnet4Ptr subnet = subnets->getBySubnetId(1);
+    ASSERT_TRUE(subnet);
+    EXPECT_TRUE(subnet->inPool(Lease::TYPE_V4, IOAddress("192.2.0.100")));
+    EXPECT_FALSE(subnet->inPool(Lease::TYPE_V4, IOAddress("192.2.0.1")));
+    EXPECT_EQ(1000, subnet->getT1());
+    // The global valid lifetime was inherited.
+    EXPECT_EQ(4000, subnet->getValid());
+    ASSERT_TRUE(subnets->getBySubnetId(3));
+
+    // The reservations of the removed subnet were removed too.
+    ConstCfgHostsPtr hosts = CfgMgr::instance().getCurrentCfg()->getCfgHosts();
+    EXPECT_TRUE(hosts->getAll4(SubnetID(2)).empty());
+    ASSERT_EQ(1, hosts->getAll4(SubnetID(1)).size());
+    EXPECT_EQ("192.2.0.10",
+              hosts->getAll4(SubnetID(1))[0]->getIPv4Reservation().toText());
+
+    // A subnet with the prefix of another subnet is rejected and the
+    // configuration is left intact.
+    sendUnixCommand("{ \"command\": \"subnet4-patch\", \"arguments\": { \n"
+                    "    \"subnet4\": [ { \"id\": 4, \"subnet\": \"192.2.2.0/24\" } ] \n"
+                    "} }", response);
+    EXPECT_EQ("{ \"result\": 1, \"text\": \"subnet with the prefix of "
+              "'192.2.2.0/24' already exists with id 3\" }", response);
+    EXPECT_EQ(subnets, CfgMgr::instance().getCurrentCfg()->getCfgSubnets4());
+    EXPECT_EQ(2, subnets->getAll()->size());
+
+    // A conflict between the patched subnets is detected once all of them
+    // were parsed: the valid replacement of the subnet 3 is not applied
+    // and the statistics are left in place.
+    sendUnixCommand("{ \"command\": \"subnet4-patch\", \"arguments\": { \n"
+                    "    \"subnet4\": [ \n"
+                    "        { \"id\": 3, \"subnet\": \"192.2.5.0/24\" }, \n"
+                    "        { \"id\": 6, \"subnet\": \"192.2.5.0/24\" } \n"
+                    "    ] \n"
+                    "} }", response);
+    EXPECT_EQ(0, response.find("{ \"result\": 1, \"text\": \"subnet with "
+                               "the prefix of '192.2.5.0/24' already exists"));
+    EXPECT_EQ(subnets, CfgMgr::instance().getCurrentCfg()->getCfgSubnets4());
+    ASSERT_TRUE(subnets->getBySubnetId(3));
+    EXPECT_EQ("192.2.2.0/24", subnets->getBySubnetId(3)->toText());
+    EXPECT_TRUE(StatsMgr::instance().getObservation("subnet[1].total-addresses"));
+    EXPECT_TRUE(StatsMgr::instance().getObservation("subnet[3].total-addresses"));
+
+    // A subnet must have an id.
+    sendUnixCommand("{ \"command\": \"subnet4-patch\", \"arguments\": { \n"
+                    "    \"subnet4\": [ { \"subnet\": \"192.2.3.0/24\" } ] \n"
+                    "} }", response);
+    EXPECT_EQ(0, response.find("{ \"result\": 1, \"text\": \"subnet must "
+                               "have an id"));
+
+    // Only existing subnets can be removed.
+    sendUnixCommand("{ \"command\": \"subnet4-patch\", \"arguments\": { \n"
+                    "    \"remove\": [ 5 ] \n"
+                    "} }", response);
+    EXPECT_EQ("{ \"result\": 1, \"text\": \"no subnet with id 5 to remove\" }",
+              response);
+    EXPECT_EQ(2, subnets->getAll()->size());
+
+    // Clean up after the test.
+    CfgMgr::instance().clear();
+}
+
+// Tests that the subnet4-patch command moves the subnets in and out of
+// the shared networks.
+TEST_F(CtrlChannelDhcpv4SrvTest, subnet4PatchSharedNetwork) {
+    createUnixChannelServer();
+
+    std::ostringstream os;
+    os << "{ \"command\": \"config-set\", \"arguments\": { \"Dhcp4\": { \n"
+        "    \"interfaces-config\": { \"interfaces\": [ \"*\" ] }, \n"
+        "    \"valid-lifetime\": 4000, \n"
+        "    \"lease-database\": { \"type\": \"memfile\", \"persist\": false }, \n"
+        "    \"shared-networks\": [ { \n"
+        "        \"name\": \"frog\", \n"
+        "        \"valid-lifetime\": 5000, \n"
+        "        \"subnet4\": [ { \"id\": 1, \"subnet\": \"192.2.0.0/24\" } ] \n"
+        "    } ], \n"
+        "    \"subnet4\": [ { \"id\": 2, \"subnet\": \"192.2.1.0/24\" } ], \n"
+        "    \"control-socket\": { \"socket-type\": \"unix\", \n"
+        "                          \"socket-name\": \"" << socket_path_ << "\" } \n"
+        "} } }";
+
+    std::string response;
+    sendUnixCommand(os.str(), response);
+    EXPECT_EQ("{ \"result\": 0, \"text\": \"Configuration successful.\" }",
+              response);
+
+    // Add a subnet to the shared network and take the subnet 1 out of it.
+    sendUnixCommand("{ \"command\": \"subnet4-patch\", \"arguments\": { \n"
+                    "    \"subnet4\": [ \n"
+                    "        { \"id\": 1, \"subnet\": \"192.2.0.0/24\", \n"
+                    "          \"shared-network-name\": \"\" }, \n"
+                    "        { \"id\": 3, \"subnet\": \"192.2.2.0/24\", \n"
+                    "          \"shared-network-name\": \"frog\" } \n"
+                    "    ] \n"
+                    "} }", response);
+    EXPECT_EQ("{ \"result\": 0, \"text\": \"2 IPv4 subnet(s) added or "
+              "replaced, 0 removed\" }", response);
+
+    SrvConfigPtr current = CfgMgr::instance().getCurrentCfg();
+    SharedNetwork4Ptr network =
+        current->getCfgSharedNetworks4()->getByName("frog");
+    ASSERT_TRUE(network);
+    ASSERT_EQ(1, network->getAllSubnets()->size());
+    EXPECT_EQ(3, (*network->getAllSubnets()->begin())->getID());
+
+    ConstSubnet4Ptr subnet = current->getCfgSubnets4()->getBySubnetId(3);
+    ASSERT_TRUE(subnet);
+    EXPECT_EQ("frog", subnet->getSharedNetworkName());
+    // The valid lifetime was inherited from the shared network.
+    EXPECT_EQ(5000, subnet->getValid());
+
+    subnet = current->getCfgSubnets4()->getBySubnetId(1);
+    ASSERT_TRUE(subnet);
+    EXPECT_TRUE(subnet->getSharedNetworkName().empty());
+    EXPECT_EQ(4000, subnet->getValid());
+
+    // An unknown shared network is rejected.
+    sendUnixCommand("{ \"command\": \"subnet4-patch\", \"arguments\": { \n"
+                    "    \"subnet4\": [ { \"id\": 2, \"subnet\": \"192.2.1.0/24\", \n"
+                    "                     \"shared-network-name\": \"toad\" } ] \n"
+                    "} }", response);
+    EXPECT_EQ(0, response.find("{ \"result\": 1, \"text\": \"no shared "
+                               "network named 'toad' for the subnet with id 2"));
+    subnet = current->getCfgSubnets4()->getBySubnetId(2);
+    ASSERT_TRUE(subnet);
+    EXPECT_TRUE(subnet->getSharedNetworkName().empty());
+    EXPECT_EQ(1, network->getAllSubnets()->size());
+
+    // Clean up after the test.
+    CfgMgr::instance().clear();
+}
+
 // Tests that the server properly responds to shtudown command sent
 // via ControlChannel
 TEST_F(CtrlChannelDhcpv4SrvTest, listCommands) {
@@ -904,6 +1104,7 @@ TEST_F(CtrlChannelDhcpv4SrvTest, listCommands) {
     checkListCommands(rsp, "config-reload");
     checkListCommands(rsp, "config-set");
     checkListCommands(rsp, "config-write");
+    checkListCommands(rsp, "hooks-latency-get");
     checkListCommands(rsp, "list-commands");
     checkListCommands(rsp, "leases-reclaim");
     checkListCommands(rsp, "libreload");
@@ -911,6 +1112,7 @@ TEST_F(CtrlChannelDhcpv4SrvTest, listCommands) {
     checkListCommands(rsp, "shutdown");
     checkListCommands(rsp, "statistic-get");
     checkListCommands(rsp, "statistic-get-all");
+    checkListCommands(rsp, "statistic-latency-get");
     checkListCommands(rsp, "statistic-remove");
     checkListCommands(rsp, "statistic-remove-all");
     checkListCommands(rsp, "statistic-reset");
@@ -919,6 +1121,7 @@ TEST_F(CtrlChannelDhcpv4SrvTest, listCommands) {
     checkListCommands(rsp, "statistic-sample-age-set-all");
     checkListCommands(rsp, "statistic-sample-count-set");
     checkListCommands(rsp, "statistic-sample-count-set-all");
+    checkListCommands(rsp, "subnet4-patch");
     checkListCommands(rsp, "version-get");
 }
 
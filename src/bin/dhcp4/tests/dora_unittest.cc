@@ -1958,6 +1958,33 @@ TEST_F(DORATest, statisticsDORA) {
     EXPECT_EQ(5, pkt4_sent->getInteger().first);
 }
 
+/// This test verifies that the latencies of the processing stages are
+/// recorded for the sent responses.
+TEST_F(DORATest, latenciesDORA) {
+    using namespace isc::stats;
+    StatsMgr& mgr = StatsMgr::instance();
+    mgr.resetLatencies();
+
+    Dhcp4Client client(Dhcp4Client::SELECTING);
+    // Configure DHCP server.
+    configure(DORA_CONFIGS[0], *client.getServer());
+
+    ASSERT_NO_THROW(client.doDORA());
+    ASSERT_TRUE(client.getContext().response_);
+
+    // Both the DHCPOFFER and the DHCPACK were recorded.
+    EXPECT_EQ(2, mgr.getLatencyHistogram("pkt4-latency-total")->getCount());
+    EXPECT_EQ(2, mgr.getLatencyHistogram("pkt4-latency-subnet-selected")->getCount());
+    EXPECT_EQ(2, mgr.getLatencyHistogram("pkt4-latency-leases-allocated")->getCount());
+    EXPECT_EQ(2, mgr.getLatencyHistogram("pkt4-latency-sent")->getCount());
+
+    // The latencies are returned by name.
+    ConstElementPtr latencies = mgr.getLatencies();
+    ASSERT_TRUE(latencies);
+    ASSERT_TRUE(latencies->get("pkt4-latency-hosts-looked-up"));
+    EXPECT_EQ(2, latencies->get("pkt4-latency-hosts-looked-up")->get("count")->intValue());
+}
+
 // This test verifies that after a client completes an exchange that result
 // in NAK, appropriate statistics are updated.
 TEST_F(DORATest, statisticsNAK) {
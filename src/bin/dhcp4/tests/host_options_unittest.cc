@@ -483,7 +483,7 @@ HostOptionsTest::testOverrideVendorOptions(const bool stateless) {
     // Information option with exactly one suboption.
     ASSERT_EQ(1, client.config_.vendor_suboptions_.size());
     // Assume this suboption is a TFTP servers suboption.
-    std::multimap<unsigned int, OptionPtr>::const_iterator opt =
+    OptionCollection::const_iterator opt =
         client.config_.vendor_suboptions_.find(DOCSIS3_V4_TFTP_SERVERS);
     ASSERT_TRUE(opt->second);
     Option4AddrLstPtr opt_tftp = boost::dynamic_pointer_cast<
@@ -40,6 +40,7 @@
 #include <sstream>
 
 #include <arpa/inet.h>
+#include <fcntl.h>
 #include <unistd.h>
 
 using namespace std;
@@ -857,6 +858,58 @@ TEST_F(JSONFileBackendTest, configBackendTimerWithThrow) {
     testConfigBackendTimer(1, true);
 }
 
+// This test verifies that the fetches notified through the named pipe
+// share the failure counter of the timer and don't re-arm the timer
+// once it gave up.
+TEST_F(JSONFileBackendTest, configBackendNotifyAfterGiveUp) {
+    const std::string fifo_path(TEST_DATA_BUILDDIR "/test-cb-notify.fifo");
+    static_cast<void>(remove(fifo_path.c_str()));
+
+    std::string config =
+        "{ \"Dhcp4\": {"
+        "\"interfaces-config\": {"
+        "    \"interfaces\": [ ]"
+        "},"
+        "\"lease-database\": {"
+        "     \"type\": \"memfile\","
+        "     \"persist\": false"
+        "},"
+        "\"config-control\": {"
+        "     \"config-fetch-wait-time\": 1,"
+        "     \"notify-fifo\": \"" + fifo_path + "\""
+        "},"
+        "\"subnet4\": [ ],"
+        "\"valid-lifetime\": 4000 }"
+        "}";
+    writeFile(TEST_FILE, config);
+
+    boost::scoped_ptr<NakedControlledDhcpv4Srv> srv;
+    ASSERT_NO_THROW(srv.reset(new NakedControlledDhcpv4Srv()));
+    ASSERT_NO_THROW(srv->init(TEST_FILE));
+    auto cb_control = boost::dynamic_pointer_cast<TestCBControlDHCPv4>(srv->getCBControl());
+    cb_control->enableThrow();
+
+    // Let the timer give up: one fetch at startup, 10 failures and the
+    // one which stops the timer.
+    ASSERT_NO_THROW(runTimersWithTimeout(srv->getIOService(), 500));
+    EXPECT_EQ(12, cb_control->getDatabaseConfigFetchCalls());
+
+    // A notification still triggers a fetch.
+    int fd = open(fifo_path.c_str(), O_WRONLY | O_NONBLOCK);
+    ASSERT_GE(fd, 0);
+    EXPECT_EQ(1, write(fd, "\n", 1));
+    close(fd);
+    IfaceMgr::instance().receive4(0, 0);
+    EXPECT_EQ(13, cb_control->getDatabaseConfigFetchCalls());
+
+    // But its failure doesn't restart the timer.
+    ASSERT_NO_THROW(runTimersWithTimeout(srv->getIOService(), 100));
+    EXPECT_EQ(13, cb_control->getDatabaseConfigFetchCalls());
+
+    srv.reset();
+    static_cast<void>(remove(fifo_path.c_str()));
+}
+
 // Starting tests which require MySQL backend availability. Those tests
 // will not be executed if Kea has been compiled without the
 // --with-mysql.
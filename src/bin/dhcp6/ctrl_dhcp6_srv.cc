@@ -9,7 +9,9 @@
 #include <cc/command_interpreter.h>
 #include <config/command_mgr.h>
 #include <dhcp/libdhcp++.h>
+#include <dhcpsrv/cb_notify_fifo.h>
 #include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/host_mgr.h>
 #include <dhcpsrv/cfg_db_access.h>
 #include <dhcp6/ctrl_dhcp6_srv.h>
 #include <dhcp6/dhcp6to4_ipc.h>
@@ -383,6 +385,12 @@ ControlledDhcpv6Srv::commandConfigSetHandler(const string&,
 
         // Use new configuration.
         CfgMgr::instance().commit();
+
+        // Watch the notifications of the config backend changes now that
+        // the configuration they apply to is in use.
+        if (server_) {
+            server_->openCBNotifyFifo();
+        }
     } else {
         // Ok, we applied the logging from the upcoming configuration, but
         // there were problems with the config. As such, we need to back off
@@ -648,6 +656,9 @@ ControlledDhcpv6Srv::processConfig(isc::data::ConstElementPtr config) {
                                           + string(ex.what())));
     }
 
+    // Apply the packet processing settings.
+    srv->configurePacketProcessing(CfgMgr::instance().getStagingCfg());
+
     // Re-open lease and host database with new parameters.
     try {
         DatabaseConnection::db_lost_callback =
@@ -740,6 +751,10 @@ ControlledDhcpv6Srv::processConfig(isc::data::ConstElementPtr config) {
         return (isc::config::createAnswer(1, err.str()));
     }
 
+    // The periodic and the notified fetches of the configuration updates
+    // share the counter of their consecutive failures.
+    server_->cb_fetch_failure_count_.reset(new unsigned(0));
+
     // Setup config backend polling, if configured for it.
     auto ctl_info = CfgMgr::instance().getStagingCfg()->getConfigControlInfo();
     if (ctl_info) {
@@ -756,18 +771,35 @@ ControlledDhcpv6Srv::processConfig(isc::data::ConstElementPtr config) {
                 fetch_time = 1000 * fetch_time;
             }
 
-            boost::shared_ptr<unsigned> failure_count(new unsigned(0));
             TimerMgr::instance()->
                 registerTimer("Dhcp6CBFetchTimer",
                               boost::bind(&ControlledDhcpv6Srv::cbFetchUpdates,
                                           server_, CfgMgr::instance().getStagingCfg(),
-                                          failure_count),
+                                          server_->cb_fetch_failure_count_),
                               fetch_time,
                               asiolink::IntervalTimer::ONE_SHOT);
             TimerMgr::instance()->setup("Dhcp6CBFetchTimer");
         }
     }
 
+    // Build the filter of the host reservations and schedule its rebuilds.
+    try {
+        long filter_interval = static_cast<long>
+            (CfgMgr::instance().getStagingCfg()->getHostFilterRebuildInterval());
+        if (filter_interval > 0) {
+            // The filter is built by the timer a page of hosts at a time.
+            HostMgr::instance().startHostFilterRebuild(CfgMgr::instance().getStagingCfg());
+            if (!server_->inTestMode()) {
+                filter_interval = 1000 * filter_interval;
+            }
+            HostMgr::setupHostFilterTimer(filter_interval);
+        }
+    } catch (const std::exception& ex) {
+        std::ostringstream err;
+        err << "unable to setup the host reservations filter: " << ex.what();
+        return (isc::config::createAnswer(1, err.str()));
+    }
+
     // Finally, we can commit runtime option definitions in libdhcp++. This is
     // exception free.
     LibDHCP::commitRuntimeOptionDefs();
@@ -815,7 +847,8 @@ ControlledDhcpv6Srv::checkConfig(isc::data::ConstElementPtr config) {
 ControlledDhcpv6Srv::ControlledDhcpv6Srv(uint16_t server_port,
                                          uint16_t client_port)
     : Dhcpv6Srv(server_port, client_port), io_service_(),
-      timer_mgr_(TimerMgr::instance()) {
+      timer_mgr_(TimerMgr::instance()),
+      cb_fetch_failure_count_(new unsigned(0)) {
     if (server_) {
         isc_throw(InvalidOperation,
                   "There is another Dhcpv6Srv instance already.");
@@ -848,6 +881,9 @@ ControlledDhcpv6Srv::ControlledDhcpv6Srv(uint16_t server_port,
     CommandMgr::instance().registerCommand("dhcp-disable",
         boost::bind(&ControlledDhcpv6Srv::commandDhcpDisableHandler, this, _1, _2));
 
+    CommandMgr::instance().registerCommand("hooks-latency-get",
+        boost::bind(&HooksManager::calloutLatencyGetHandler, _1, _2));
+
     CommandMgr::instance().registerCommand("dhcp-enable",
         boost::bind(&ControlledDhcpv6Srv::commandDhcpEnableHandler, this, _1, _2));
 
@@ -876,6 +912,9 @@ ControlledDhcpv6Srv::ControlledDhcpv6Srv(uint16_t server_port,
     CommandMgr::instance().registerCommand("statistic-get-all",
         boost::bind(&StatsMgr::statisticGetAllHandler, _1, _2));
 
+    CommandMgr::instance().registerCommand("statistic-latency-get",
+        boost::bind(&StatsMgr::statisticLatencyGetHandler, _1, _2));
+
     CommandMgr::instance().registerCommand("statistic-reset",
         boost::bind(&StatsMgr::statisticResetHandler, _1, _2));
 
@@ -916,6 +955,8 @@ ControlledDhcpv6Srv::~ControlledDhcpv6Srv() {
 
         timer_mgr_->unregisterTimers();
 
+        cb_notify_fifo_.close();
+
         // Close the command socket (if it exists).
         CommandMgr::instance().closeCommandSocket();
 
@@ -928,12 +969,14 @@ ControlledDhcpv6Srv::~ControlledDhcpv6Srv() {
         CommandMgr::instance().deregisterCommand("config-write");
         CommandMgr::instance().deregisterCommand("dhcp-disable");
         CommandMgr::instance().deregisterCommand("dhcp-enable");
+        CommandMgr::instance().deregisterCommand("hooks-latency-get");
         CommandMgr::instance().deregisterCommand("leases-reclaim");
         CommandMgr::instance().deregisterCommand("libreload");
         CommandMgr::instance().deregisterCommand("server-tag-get");
         CommandMgr::instance().deregisterCommand("shutdown");
         CommandMgr::instance().deregisterCommand("statistic-get");
         CommandMgr::instance().deregisterCommand("statistic-get-all");
+        CommandMgr::instance().deregisterCommand("statistic-latency-get");
         CommandMgr::instance().deregisterCommand("statistic-remove");
         CommandMgr::instance().deregisterCommand("statistic-remove-all");
         CommandMgr::instance().deregisterCommand("statistic-reset");
@@ -1055,14 +1098,42 @@ ControlledDhcpv6Srv::dbLostCallback(ReconnectCtlPtr db_reconnect_ctl) {
     return(true);
 }
 
+void
+ControlledDhcpv6Srv::openCBNotifyFifo() {
+    // Fetch the configuration updates as soon as they are notified through
+    // the named pipe, if any. The fetch also reschedules the timer.
+    cb_notify_fifo_.close();
+    SrvConfigPtr srv_cfg = CfgMgr::instance().getCurrentCfg();
+    process::ConstConfigControlInfoPtr ctl_info = srv_cfg->getConfigControlInfo();
+    if (!ctl_info || ctl_info->getNotifyFifo().empty()) {
+        return;
+    }
+
+    const std::string& notify_path = ctl_info->getNotifyFifo();
+    try {
+        cb_notify_fifo_.open(notify_path,
+                             boost::bind(&ControlledDhcpv6Srv::cbFetchUpdates,
+                                         this, srv_cfg,
+                                         cb_fetch_failure_count_));
+    } catch (const std::exception& ex) {
+        LOG_ERROR(dhcp6_logger, DHCP6_CB_NOTIFY_FIFO_FAIL)
+            .arg(notify_path).arg(ex.what());
+    }
+}
+
 void
 ControlledDhcpv6Srv::cbFetchUpdates(const SrvConfigPtr& srv_cfg,
                                     boost::shared_ptr<unsigned> failure_count) {
+    // Once the timer gave up, the fetches triggered by the notifications
+    // neither count the failures nor re-arm it.
+    const bool gave_up = (*failure_count > 10);
     try {
         // Fetch any configuration backend updates since our last fetch.
         server_->getCBControl()->databaseConfigFetch(srv_cfg,
                                                      CBControlDHCPv6::FetchMode::FETCH_UPDATE);
-        (*failure_count) = 0;
+        if (!gave_up) {
+            (*failure_count) = 0;
+        }
 
     } catch (const std::exception& ex) {
         LOG_ERROR(dhcp6_logger, DHCP6_CB_FETCH_UPDATES_FAIL)
@@ -1070,16 +1141,15 @@ ControlledDhcpv6Srv::cbFetchUpdates(const SrvConfigPtr& srv_cfg,
 
         // We allow at most 10 consecutive failures after which we stop
         // making further attempts to fetch the configuration updates.
-        // Let's return without re-scheduling the timer.
-        if (++(*failure_count) > 10) {
+        if (!gave_up && (++(*failure_count) > 10)) {
             LOG_ERROR(dhcp6_logger, DHCP6_CB_FETCH_UPDATES_RETRIES_EXHAUSTED);
-            return;
         }
     }
 
     // Reschedule the timer to fetch new updates or re-try if
-    // the previous attempt resulted in an error.
-    if (TimerMgr::instance()->isTimerRegistered("Dhcp6CBFetchTimer")) {
+    // the previous attempt resulted in an error, unless it gave up.
+    if ((*failure_count <= 10) &&
+        TimerMgr::instance()->isTimerRegistered("Dhcp6CBFetchTimer")) {
         TimerMgr::instance()->setup("Dhcp6CBFetchTimer");
     }
 }
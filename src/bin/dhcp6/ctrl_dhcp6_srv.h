@@ -12,6 +12,7 @@
 #include <cc/data.h>
 #include <cc/command_interpreter.h>
 #include <database/database_connection.h>
+#include <dhcpsrv/cb_notify_fifo.h>
 #include <dhcpsrv/timer_mgr.h>
 #include <dhcp6/dhcp6_srv.h>
 
@@ -371,11 +372,21 @@ private:
     /// configured reconnect parameters
     bool dbLostCallback(db::ReconnectCtlPtr db_reconnect_ctl);
 
-    /// @brief Callback invoked periodically to fetch configuration updates
-    /// from the Config Backends.
+    /// @brief Opens the named pipe notifying the config backend changes.
+    ///
+    /// Called once a new configuration was committed: the notifications
+    /// trigger fetches of the updates of the current configuration. The
+    /// pipe is closed when the @c notify-fifo parameter of the
+    /// config-control is not set.
+    void openCBNotifyFifo();
+
+    /// @brief Callback invoked periodically, or upon notification, to fetch
+    /// configuration updates from the Config Backends.
     ///
     /// This method calls @c CBControlDHCPv6::databaseConfigFetch and then
-    /// reschedules the timer.
+    /// reschedules the timer. The fetches triggered by the notifications
+    /// share the failure counter of the timer and don't re-arm it after it
+    /// gave up.
     ///
     /// @param srv_cfg Server configuration holding the database credentials
     /// and server tag.
@@ -399,6 +410,13 @@ private:
     /// Shared pointer to the instance of timer @c TimerMgr is held here to
     /// make sure that the @c TimerMgr outlives instance of this class.
     TimerMgrPtr timer_mgr_;
+
+    /// @brief Named pipe the config backend changes are notified through.
+    CBNotifyFifo cb_notify_fifo_;
+
+    /// @brief Number of consecutive failures to fetch the config backend
+    /// updates, shared by the timer and the notifications.
+    boost::shared_ptr<unsigned> cb_fetch_failure_count_;
 };
 
 }; // namespace isc::dhcp
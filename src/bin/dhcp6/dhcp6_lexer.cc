@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 190
-#define YY_END_OF_BUFFER 191
+#define YY_NUM_RULES 199
+#define YY_END_OF_BUFFER 200
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,186 +700,200 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[1615] =
+static const flex_int16_t yy_accept[1746] =
     {   0,
-      183,  183,    0,    0,    0,    0,    0,    0,    0,    0,
-      191,  189,   10,   11,  189,    1,  183,  180,  183,  183,
-      189,  182,  181,  189,  189,  189,  189,  189,  176,  177,
-      189,  189,  189,  178,  179,    5,    5,    5,  189,  189,
-      189,   10,   11,    0,    0,  172,    0,    0,    0,    0,
+      192,  192,    0,    0,    0,    0,    0,    0,    0,    0,
+      200,    1,  198,  198,  198,  198,  198,   10,  192,  189,
+      192,  192,  191,  190,  198,  198,  198,  198,  185,  186,
+      198,  198,  187,  188,   11,    5,    5,    5,   11,  198,
+       10,  198,   11,  198,   10,  198,   11,  198,  198,   10,
+       11,    1,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    1,  183,
-      183,    0,  182,  183,    3,    2,    6,    0,  183,    0,
-        0,    0,    0,    0,    0,    4,    0,    0,    9,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  181,    0,
+        3,    2,   10,  192,  192,    0,  191,  192,    6,    0,
 
-      173,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  175,    0,    0,    0,
+      192,    0,    0,    0,    0,   11,    4,    0,    0,    9,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    2,    0,    0,    0,    0,    0,    0,    0,    8,
-        0,    0,    0,    0,  150,    0,    0,  151,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      184,    0,    0,    0,    0,  182,    0,    0,    2,    0,
 
-        0,    0,    0,    0,    0,    0,  174,    0,    0,    0,
+        0,    0,    0,    0,    8,  197,  194,  159,    0,    0,
+        0,    0,    0,    0,  160,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  105,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  102,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  188,  186,
 
-        0,  185,  184,    0,    0,    0,    0,    0,    0,    0,
-      149,    0,    0,   28,    0,   27,    0,    0,  109,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   55,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  183,    0,    0,    0,
+        0,    0,  195,    0,  193,    0,    0,    0,    0,    0,
+        0,  158,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   57,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   28,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      106,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
+        0,    0,    0,    0,    0,  109,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  112,    0,    0,    0,    0,    0,   27,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  187,  184,    0,    0,    0,    0,
-        0,    0,    0,    0,   29,    0,    0,   31,    0,    0,
-        0,    0,    0,    0,  110,    0,    0,    0,    0,    0,
-        0,    0,   87,    0,    0,    0,    0,    0,    0,    0,
-      134,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   58,    0,    0,    0,    0,    0,    0,    0,
+        0,  196,  193,    0,    0,    0,    0,   60,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   86,    0,    0,
+        0,    0,  113,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       61,   99,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   32,  138,  163,   53,
 
-       96,    0,   59,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   90,    0,    0,    0,    0,
+        0,    0,    0,  143,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   89,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  129,  154,   51,    0,   56,    0,    0,
-        0,    0,    0,    0,  169,   37,    0,   34,    0,   33,
-        0,    0,    0,  142,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   58,    0,
+        0,    0,    0,   29,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  121,    0,    0,
-        0,    0,    0,    0,    0,    0,  153,    0,    0,    0,
+      162,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,   53,    0,    0,   32,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   89,
+        0,    0,    0,    0,  152,    0,    0,    0,    0,    0,
+        0,   92,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  147,    0,
+        0,    0,    0,    0,    0,    0,    0,   34,    0,    0,
+       33,    0,    0,    0,    0,    0,    0,   35,    0,    0,
+      128,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   55,    0,    0,    0,    0,  151,    0,
+      131,    0,    0,    0,    0,    0,  178,    0,   38,    0,
+        0,    0,    0,    0,    0,    0,    7,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  143,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  138,    0,    0,    0,    0,
-        0,    0,    0,    0,    7,   35,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   94,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  108,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  102,    0,
+        0,    0,    0,    0,  127,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  130,    0,    0,    0,   36,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  123,
-        0,    0,    0,    0,    0,    0,    0,    0,  120,    0,
-        0,    0,    0,    0,    0,    0,    0,   91,    0,    0,
+      111,    0,    0,    0,   30,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  124,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  101,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   99,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  117,    0,    0,    0,    0,    0,   98,    0,
+        0,    0,    0,    0,    0,    0,   62,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      137,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   85,    0,    0,    0,
+        0,    0,    0,    0,    0,  146,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,  147,  118,    0,    0,
-        0,    0,    0,    0,  122,   52,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   60,    0,
+      156,  125,    0,    0,    0,    0,    0,    0,  129,   54,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  145,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   82,    0,
-        0,    0,    0,    0,    0,    0,    0,  170,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   52,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  105,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  136,
+        0,  142,    0,    0,    0,    0,   59,   93,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  108,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  134,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,   63,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   57,   90,    0,
-        0,    0,  133,    0,    0,    0,   50,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  125,    0,    0,    0,    0,
+        0,    0,    0,    0,   65,  179,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  168,    0,    0,    0,    0,    0,
+      103,    0,    0,    0,   42,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   72,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  177,    0,    0,    0,    0,
+        0,    0,    0,  157,   14,    0,   16,    0,    0,    0,
 
-        0,  100,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   41,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   16,    0,    0,  148,   14,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  144,  148,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   41,
+        0,    0,  153,    0,  161,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   56,   95,    0,    0,
+        0,  155,    0,    0,  118,  119,    0,    0,    0,    0,
+        0,    0,  133,    0,    0,    0,    0,    0,    0,    0,
+        0,   84,    0,    0,    0,    0,   20,    0,    0,    0,
+
+        0,    0,    0,    0,    0,   87,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  139,    0,  124,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  135,  152,    0,   40,    0,  144,    0,    0,
-
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       20,    0,    0,    0,   84,    0,    0,    0,    0,  146,
-       54,    0,   92,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   81,
-        0,    0,    0,  115,  116,    0,    0,    0,    0,    0,
-        0,    0,    0,   88,    0,    0,    0,    0,    0,    0,
-       64,    0,    0,    0,    0,    0,    0,    0,    0,  141,
+       66,    0,    0,    0,    0,    0,   81,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  111,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   85,  107,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   78,
-        0,    0,    0,    0,    0,    0,   17,    0,   15,    0,
-      166,  165,    0,   69,    0,    0,    0,    0,    0,   30,
-        0,  128,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  163,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  101,    0,  132,   43,    0,
-       61,    0,    0,    0,    0,    0,    0,    0,    0,   19,
-        0,    0,    0,    0,    0,    0,  103,   79,    0,    0,
-      140,    0,    0,    0,    0,    0,  131,    0,    0,    0,
-        0,    0,   97,    0,  171,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,   95,    0,    0,  155,
+        0,    0,   71,    0,    0,    0,  150,    0,    0,    0,
+        0,    0,    0,    0,  174,  175,    0,   15,   17,    0,
+        0,    0,   51,    0,    0,    0,  110,    0,   88,    0,
+        0,    0,    0,  114,    0,    0,    0,    0,    0,    0,
+
+        0,   91,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  137,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  104,  141,   82,
+        0,    0,  149,    0,    0,    0,    0,    0,  140,  106,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  172,    0,    0,    0,    0,   19,    0,    0,
+        0,    0,    0,   63,   44,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  100,    0,    0,    0,   31,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   42,    0,    0,   68,    0,    0,    0,    0,
-      126,   47,    0,    0,    0,   70,  164,   38,    0,    0,
-       12,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       45,    0,    0,   44,    0,   18,    0,    0,    0,    0,
-        0,    0,    0,  119,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   75,    0,
-
-        0,    0,    0,   62,    0,    0,   93,    0,    0,    0,
-        0,    0,  145,    0,    0,    0,   46,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,   70,    0,
+        0,    0,  164,    0,    0,   98,    0,    0,    0,   43,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  180,
+        0,    0,    0,    0,    0,    0,   46,    0,    0,  135,
+        0,    0,    0,   48,    0,    0,   73,  173,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   67,    0,    0,    0,   83,    0,
-       36,    0,   48,    0,    0,    0,    0,    0,    0,   24,
-        0,    0,    0,    0,    0,    0,    0,  161,    0,    0,
-        0,    0,  130,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  104,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   25,   39,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   13,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,  167,    0,    0,
-        0,    0,    0,    0,    0,  160,    0,   77,    0,   76,
-        0,   21,   72,    0,    0,    0,    0,    0,   65,    0,
-      114,    0,    0,   94,    0,    0,  159,    0,    0,    0,
-       71,    0,    0,    0,   66,    0,   23,    0,    0,    0,
+        0,   12,   39,    0,    0,    0,    0,    0,    0,    0,
+      126,    0,    0,   45,   18,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   78,    0,    0,    0,
+
+        0,   47,  154,    0,  120,    0,    0,    0,   64,    0,
+        0,    0,    0,    0,   69,    0,    0,    0,    0,    0,
+        0,   96,    0,    0,    0,    0,    0,   86,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   49,
+        0,    0,    0,    0,    0,    0,    0,  107,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  139,
+        0,    0,    0,  170,    0,    0,    0,    0,  132,    0,
+       24,   37,   25,    0,    0,    0,    0,    0,    0,   40,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   49,    0,    0,    0,    0,
-        0,   74,   73,   22,    0,  112,  127,    0,    0,    0,
-        0,    0,    0,  157,  162,   80,    0,    0,    0,    0,
 
-      156,    0,    0,   26,    0,    0,    0,    0,    0,  113,
-        0,    0,  158,    0
+        0,    0,   13,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   75,    0,    0,    0,    0,
+        0,  176,   67,    0,   21,    0,    0,    0,  169,   80,
+        0,   79,    0,    0,    0,    0,  168,  117,    0,    0,
+       68,    0,   23,    0,    0,    0,   97,    0,    0,    0,
+        0,    0,   74,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  122,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+       50,    0,  115,  136,    0,    0,    0,   22,    0,   77,
+       76,    0,    0,    0,    0,  166,  121,    0,    0,    0,
+      171,    0,    0,    0,    0,   83,    0,   26,    0,    0,
+      165,    0,    0,    0,    0,    0,    0,    0,  116,  123,
+        0,    0,    0,  167,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -891,11 +905,11 @@ static const YY_CHAR yy_ec[256] =
         5,    8,    9,   10,   11,   12,   13,   14,   15,   16,
        14,   17,   14,   18,   14,   14,   14,   19,    5,   20,
         5,   21,   22,    5,   23,   24,   25,   26,   27,   28,
-        5,   29,    5,   30,    5,   31,    5,   32,   33,   34,
-        5,   35,   36,   37,   38,   39,   40,    5,   41,    5,
-       42,   43,   44,    5,   45,    5,   46,   47,   48,   49,
+        5,   29,   30,   31,    5,   32,    5,   33,   34,   35,
+        5,   36,   37,   38,   39,   40,   41,    5,   42,    5,
+       43,   44,   45,    5,   46,    5,   47,   48,   49,   50,
 
-       50,   51,   52,   53,   54,   55,   56,   57,   58,   59,
+       51,   52,   53,   54,   55,   31,   56,   57,   58,   59,
        60,   61,   62,   63,   64,   65,   66,   67,   68,   69,
        70,   71,   72,    5,   73,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -916,846 +930,1230 @@ static const YY_CHAR yy_ec[256] =
 
 static const YY_CHAR yy_meta[74] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    5,    5,    3,    3,
-        3,    3,    5,    5,    5,    5,    5,    5,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    5,    5,    5,    5,    5,
-        5,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[1627] =
+static const flex_int16_t yy_base[1746] =
     {   0,
-        0,   72,   21,   31,   43,   51,   54,   60,   91,   99,
-     2016, 2017,   34, 2012,  145,    0,  207, 2017,  214,  221,
-       13,  228, 2017, 1992,  118,   25,    2,    6, 2017, 2017,
-       73,   11,   17, 2017, 2017, 2017,  104, 2000, 1953,    0,
-     1990,  108, 2007,   24,  256, 2017,   67, 1949, 1955, 1975,
-       84,   75,  189,   88,  226,   91,   89,  284,  196,  206,
-      219,  191,  210,  197,   60,  242, 1956,  278,  287,  298,
-      294,  313, 1939,  212,  318,  350,  328, 1958,    0,  379,
-      400,  417,  424,  429, 2017,    0, 2017,  393,  407,  269,
-      299,  301,  406,  418,  304, 2017, 1955, 1996, 2017,  293,
-
-     2017,  442,  312, 1942, 1952, 1993,  421,   10,  345, 1946,
-      319,  338,  336,  369,  248, 1991,    0,  495,  413, 1933,
-     1938, 1940,  332, 1936, 1925, 1926,  410, 1942, 1925, 1934,
-      418,  340,  226, 1928, 1926,  405, 1915, 1973,  448, 1918,
-     1971, 1911, 1934, 1931, 1931, 1925,  411, 1918, 1916, 1910,
-     1915, 1909,  421, 1920, 1913, 1904, 1903, 1917,  408, 1955,
-     1902,  413, 1914, 1917, 1901,  491, 1902,  423, 1914, 1911,
-     1912, 1910, 1945, 1944,  434, 1890, 1895, 1891, 1883, 1900,
-     1892,    0,  451,  460,  434,  460,  468,  476, 1891, 2017,
-        0,  481, 1882, 1885, 2017,  464,  474, 2017, 1939, 1892,
-
-      504, 1937,  507, 1936,  497, 1935, 2017,  544, 1934,  517,
-     1893, 1890, 1887, 1886, 1877,  514, 1928, 1922, 1886, 1865,
-     1873, 1879, 1867, 1881, 1877, 1878, 1878, 1873, 1865, 1867,
-     1851, 1855, 1868, 1870, 1867, 1859, 1849, 1852, 1866, 2017,
-     1852, 1860, 1863, 1844, 1843, 1895, 1842, 1852, 1892,  519,
-     1851, 1890, 1838, 1849, 1887,  524, 1891, 1826, 1841,  358,
-     1831, 1847, 1828, 1830, 1826, 1832, 1823, 1822, 1835, 1828,
-     1830, 1834, 1833, 1827,  220, 1834, 1829, 1821, 1811, 1826,
-     1821, 1825,  482, 1823, 1809, 1815, 1822, 1810, 1807, 1806,
-      486, 1801, 1815, 1814, 1817, 1799, 1807,  537, 2017, 2017,
-
-      539, 2017, 2017, 1794,    0,  506, 1796,  579,  548, 1852,
-     2017, 1803,  545, 2017, 1850, 2017, 1844,  595, 2017,  536,
-     1784, 1787, 1793, 1845, 1800, 1795, 1798, 1793,   80, 2017,
-     1795,  593, 1793, 1790, 1791,  323, 1795, 1835, 1783, 1778,
-     1775, 1771, 1773, 1824, 1781, 1770, 1786, 1820, 1766,  596,
-     1779, 1779, 1762, 1763, 1776, 1763, 1773, 1768, 1775, 1770,
-     1755,  563, 1764, 1767, 1762,  322, 1758, 1808,  566,  553,
-     2017, 1802, 1752, 1751, 1744, 1746, 1750, 1739, 1746, 1751,
-      575, 1798, 1751,  578, 1748, 1752, 1750, 1739, 1739, 1751,
-      570, 1726, 1727, 1748,  581, 1730, 1727, 1741, 1744, 1739,
-
-     1725, 1737, 1736, 1735, 1734, 1733, 1732,  476, 1775, 1774,
-     1773, 1715,  641, 1728, 2017, 2017, 1727,    0,  598, 1715,
-     1768, 1767, 1723, 1765, 2017, 1711, 1763, 2017,  604,  652,
-      617, 1762, 1710, 1701, 2017, 1706, 1712, 1715, 1698, 1713,
-     1700, 1699, 2017, 1709, 1700, 1697, 1709,  552, 1694, 1696,
-     2017, 1702, 1687, 1689, 1700, 1698, 1693,  643, 1700, 1688,
-     1681, 1732, 2017, 1679, 1695, 1729, 1733, 1689, 1683, 1685,
-     1686, 1688, 1722, 1673, 1668, 1667, 1669, 1665, 1661, 1676,
-     1679, 1653, 1660, 1665, 1658, 1674, 1713, 2017, 1658, 1654,
-     1710, 1661, 1655, 1662, 1647, 1657, 1660, 1649, 1648, 1643,
-
-     2017, 1700, 2017, 1642, 1641, 1634, 1651, 1690, 1635, 1640,
-     1649, 1643, 1637, 1646,  645, 1683, 1645, 1628, 1628, 1623,
-     1619, 1625, 1630, 1623, 1631, 1635, 1618, 1676, 1616, 1617,
-     1616, 1628, 1617, 2017, 2017, 2017, 1617, 2017, 1627, 1663,
-     1623,    0, 1666, 1614, 2017, 2017, 1611, 2017, 1617, 2017,
-      604,  622,  676, 2017, 1622, 1656, 1601, 1654, 1599, 1598,
-     1597, 1604, 1597, 1605, 1608, 1607, 1591, 1606, 1588, 1635,
-     1602, 1640, 1584, 1586, 1598, 1598, 1597, 2017, 1582, 1579,
-     1637, 1592, 1584, 1590, 1581, 1589, 2017, 1574, 1585, 1589,
-     1571, 1585,  536, 1567, 1561, 1566, 1563, 1578, 1577, 1578,
-
-     1568, 1574, 1617, 1572, 1571, 1563, 2017, 1556, 1558, 2017,
-     1566, 1605, 1604,   16, 1565, 1548, 1549, 1554, 1545, 2017,
-     1559, 1545,  677, 1537, 1558, 1555, 1547, 1592, 1544, 1551,
-     1589, 2017, 1535, 1533, 1547, 1531, 1545, 1548, 1582, 1581,
-     1580, 1579, 1524, 1577, 1576, 2017,  597, 1538, 1537, 1534,
-     1534, 1532, 1521, 1523, 2017, 2017, 1568, 1514, 1571,  621,
-      621, 1512, 1510, 1526, 1567,  641, 1561, 1521, 1559, 1558,
-     1510, 1504, 1499, 1554, 1514, 1504, 1512, 1550, 1511, 1493,
-     1501, 1503, 1507, 1544, 1548, 1503, 1502, 2017, 1503, 1496,
-     1485, 1498, 1501, 1496, 1491, 1496, 1493, 1492, 1488, 1494,
-
-     1489, 1532, 1531, 1473, 1484, 1468,  634, 1479, 1526, 2017,
-     1525, 1479, 1475, 1470, 1462, 1515, 1476, 1463, 2017, 1463,
-     1472, 1471, 1471, 1455, 1512,   77,  245, 2017,  348,  430,
-      460,  456,  534,  530,  575,  639,  611,  596,  606,  619,
-      663,  673,  682,  630,  648,  643,  657,  652,  637,  649,
-      650, 2017,  704,  661,  662,  653,  666,  669,  660,  666,
-      675,  716, 2017,  712,  688,  675,  676,  671, 2017,  669,
-      684,  681,  667,  674,  673,  671,  690,  687,  688,  678,
-      691,  677,  676,  682,  738,  684,  700,  683,  737,  692,
-     2017,  702,  702,  696,  707,  705,  750,  692,  694,  709,
-
-      710,  698,  757,  714,  700,  703, 2017, 2017,  719,  718,
-      719,  724,  712,  723, 2017, 2017,  723,  725,  729,  716,
-      714,  732,  719,  719,  770,  720,  778,  779, 2017,  724,
-      738,  738,  783,  731,  733,  727,  787,  740,  730,  731,
-      727,  737,  741,  752,  736,  754,  749,  751,  744,  746,
-      747,  759,  749,  764,  805,  762,  767,  744, 2017,  756,
-      757,  771,  761,  808,  756,  771,  771, 2017,  790,  798,
-      767,  816,  782,  770,  765,  766,  778,  785,  774,  775,
-      771,  789,  781,  776,  829,  835,  792,  783, 2017,  795,
-      780,  796,  786,  799,  793,  841,  807,  791,  792, 2017,
-
-      808,  811,  794,  796,  854,  797, 2017,  814,  817,  797,
-      816,  804,  857,  815,  811,  860,  809,  862,  809,  827,
-      826,  812,  827,  819,  815,  833,  818, 2017, 2017,  826,
-      873,  826, 2017,  834,  829,  882, 2017,  831,  836,  880,
-      832,  833,  845,  839,  843,  841,  839,  850,  895,  839,
-      844,  898,  899,  843,  855, 2017,  843,  851,  849,  846,
-      847,  856,  868,  852,  866,  867,  869,  885,  890,  872,
-      858,  860,  860,  880,  879,  870,  859,  876,  883,  926,
-      868,  928,  875,  879, 2017,  926,  875,  893,  890,  930,
-      879,  897,  898,  884,  892,  901,  883,  898,  905,  947,
-
-      948, 2017,  901,  950,  951,  902,  912,  914,  898,  900,
-      900,  907,  916,  910,  905,  912,  964,  911,  910,  927,
-      968,  918,  922,  920,  918,  973,  974,  924,  976,  972,
-      930, 2017,  935,  928,  919,  938,  932,  927,  937,  934,
-      939,  935,  947, 2017,  931,  933, 2017, 2017,  933,  993,
-      932,  952,  953,  998,  999,  952,  937,  958,  940,  945,
-      952,  985,  976, 1008,  965,  952,  954,  971,  966,  970,
-     1015,  963,  967, 2017,  964, 2017,  978,  976,  979,  963,
-      964, 1024,  977,  982,  969,  980,  973,  979,  975,  993,
-      994,  996, 2017, 2017,  994, 2017,  996, 2017,  981,  982,
-
-     1001,  991, 1043, 1000,  997, 1041, 1005, 1000, 1005, 1002,
-     2017, 1000,  992, 1053, 2017, 1054, 1001, 1008, 1052, 2017,
-     2017, 1010, 2017, 1001, 1001, 1004, 1018, 1023, 1006, 1017,
-     1066, 1023, 1024, 1025, 1065, 1021, 1072, 1025, 1074, 2017,
-     1021, 1076, 1077, 2017, 2017, 1017, 1079, 1038, 1022, 1034,
-     1024, 1054, 1085, 2017, 1042, 1087, 1034, 1049, 1085, 1037,
-     2017, 1033, 1049, 1037, 1055, 1043, 1043, 1098, 1055, 2017,
-     1057, 1056, 1058, 1051, 1060, 1061, 1058, 1048, 1051, 1051,
-     1110, 1057, 1113, 1114, 1057, 1116, 2017, 1074, 1053, 1068,
-     1061, 1076, 1079, 1079, 1125, 1078, 2017, 2017, 1075, 1085,
-
-     1070, 1087, 1073, 1134, 1135, 1079, 1089, 1138, 1095, 2017,
-     1087, 1087, 1089, 1091, 1144, 1087, 2017, 1088, 2017, 1090,
-     2017, 2017, 1104, 2017, 1098, 1150, 1099, 1152, 1132, 2017,
-     1149, 2017, 1097, 1105, 1099, 1096, 1099, 1102, 1102, 1098,
-     1104, 1164, 1112, 2017, 1108, 1167, 1120, 1111, 1126, 1126,
-     1129, 1129, 1126, 1170, 1133, 2017, 1125, 2017, 2017, 1135,
-     2017, 1175, 1137, 1138, 1135, 1179, 1141, 1181, 1143, 2017,
-     1131, 1131, 1137, 1136, 1148, 1148, 2017, 2017, 1189, 1136,
-     2017, 1153, 1138, 1138, 1140, 1146, 2017, 1201, 1143, 1153,
-     1204, 1165, 2017, 1162, 2017, 1181, 1149, 1209, 1210, 1167,
-
-     1172, 1154, 1214, 1215, 1216, 1169, 2017, 1159, 1219, 2017,
-     1157, 1216, 1179, 1175, 1219, 1167, 1172, 1170, 1229, 1185,
-     1231, 1181, 1233, 1195, 1184, 1178, 1179, 1188, 1181, 1197,
-     1242, 1184, 1201, 1186, 1201, 1185, 1243, 1244, 1245, 1192,
-     1247, 1210, 2017, 1210, 1197, 2017, 1208, 1257, 1227, 1211,
-     2017, 2017, 1202, 1213, 1262, 2017, 2017, 2017, 1209, 1207,
-     2017, 1265, 1211, 1262, 1205, 1210, 1271, 1219, 1229, 1230,
-     2017, 1275, 1228, 2017, 1229, 2017, 1220, 1235, 1223, 1233,
-     1234, 1235, 1241, 2017, 1280, 1248, 1241, 1242, 1251, 1233,
-     1239, 1241, 1295, 1254, 1253, 1245, 1299, 1248, 2017, 1301,
-
-     1250, 1303, 1245, 2017, 1252, 1252, 2017, 1256, 1251, 1250,
-     1310, 1263, 2017, 1307, 1258, 1255, 2017, 1269, 1271, 1273,
-     1318, 1271, 1268, 1276, 1270, 1323, 1264, 1266, 1274, 1264,
-     1280, 1281, 1275, 1291, 2017, 1281, 1333, 1292, 2017, 1330,
-     2017, 1292, 2017, 1332, 1333, 1288, 1296, 1287, 1294, 2017,
-     1291, 1296, 1294, 1346, 1347, 1304, 1291, 2017, 1306, 1307,
-     1308, 1309, 2017, 1299, 1311, 1312, 1357, 1299, 1307, 1301,
-     1309, 1322, 2017, 1299, 1322, 1307, 1307, 1312, 1368, 1316,
-     1328, 1319, 1328, 1330, 1334, 2017, 2017, 1316, 1376, 1319,
-     1378, 1320, 1380, 1338, 1382, 1383, 2017, 1379, 1341, 1338,
-
-     1343, 1330, 1389, 1326, 1391, 1344, 1349, 2017, 1394, 1351,
-     1352, 1397, 1354, 1357, 1352, 2017, 1401, 2017, 1354, 2017,
-     1363, 2017, 2017, 1345, 1405, 1352, 1407, 1350, 2017, 1367,
-     2017, 1358, 1354, 2017, 1354, 1356, 2017, 1361, 1371, 1364,
-     2017, 1365, 1359, 1371, 2017, 1367, 2017, 1377, 1371, 1379,
-     1376, 1367, 1421, 1368, 1376, 1385, 1386, 1387, 1380, 1375,
-     1376, 1391, 1436, 1383, 1390, 1377, 1392, 1397, 1442, 1443,
-     1444, 1401, 1446, 1447, 1390, 2017, 1406, 1397, 1411, 1407,
-     1400, 2017, 2017, 2017, 1454, 2017, 2017, 1455, 1456, 1411,
-     1410, 1411, 1401, 2017, 2017, 2017, 1461, 1403, 1419, 1464,
-
-     2017, 1460, 1409, 2017, 1408, 1410, 1421, 1470, 1419, 2017,
-     1428, 1473, 2017, 2017, 1479, 1484, 1489, 1494, 1499, 1504,
-     1509, 1512, 1486, 1491, 1493, 1506
+        1,    1,   75,    1,  149,    1,  223,    1,  297,    1,
+        1,  889, 1197,  826,  371, 1450,  966, 1110, 1427,    1,
+     1256, 1190,    1,    1, 1091, 1466, 1268, 1835,    1,    1,
+     1152, 1176,    1,    1, 1565,    1,    1, 1666,    1,    1,
+        1, 1716,    1,    1,    1, 1037,    1, 1827,    1,    1,
+        1,    1, 1584, 1886, 1162, 1477, 1245, 1353, 1496, 1404,
+     1373, 1383, 1311, 1450, 1242, 1425, 1460, 1265, 1518, 1466,
+     1507, 1470, 1480, 1328, 1294, 1132, 1489, 1598, 1368, 1221,
+     2154, 2151,  445, 2598, 2157, 2575, 1485, 2586,    1,  519,
+        1,  963,    1,    1,    1,    1,    1,    1,    1, 1627,
+
+        1, 2158, 2153, 2577, 2569,    1,    1, 2587, 2631,    1,
+     2159, 2581, 2633, 1586, 2570, 2630, 1565, 2589, 2576, 2590,
+     1499, 1203, 2589, 2583, 2638, 1484, 1400, 2589, 1265, 2601,
+     1243, 2645, 2594, 2152, 2647, 2648, 2161, 2160, 2600, 2610,
+     2609, 1995, 1600, 2606, 1607, 2625, 2612, 2624, 2634, 2635,
+     2634, 1594, 2625, 2638, 2638, 2161, 2629, 2627, 2162, 2626,
+     2641, 2628, 2642, 2638, 2631, 2173, 1853, 2648, 2651, 2651,
+     2647, 1789, 2643, 2638, 2644, 2165, 1610, 2641, 2635, 2655,
+     2639, 2174, 2648, 2650, 2640, 2176, 2662, 2184, 1783, 2653,
+        1,    1,  593, 1111, 2656,    1,    1, 1408,    1, 2170,
+
+     2176, 2650, 2664, 2659,    1,    1,    1,    1, 2652, 2662,
+     2669, 2659, 2674, 2716,    1, 2670, 2713, 2674, 2672, 2678,
+     1319, 2677, 2671, 2724, 2680, 2685,    1, 2674, 2683, 2685,
+     2686, 2682,  983, 2691, 2682, 2674, 2690, 2687, 2678, 2687,
+     2680, 2694, 2691, 2701, 2685, 2689, 2687, 2041, 2746, 2692,
+     2693, 2193, 2690, 2705, 2706, 2701, 2704, 2712, 2714, 2711,
+     2716, 2698, 2708, 2715, 2706, 2721, 2719, 2713, 2722, 2716,
+     2170, 2723, 2723, 2720, 2713, 2718, 2194, 2727, 2768, 2196,
+     2725, 2718, 1407, 2776, 2713, 2729, 2187, 2716, 2722, 2776,
+     2724, 2726, 2737, 2780, 1226, 2740, 2731, 2783, 2208, 2789,
+
+     2209, 2749, 2738, 2735, 2752, 2794, 2753, 2751, 2739, 2205,
+     2743, 2216, 2207, 2740, 1217,    1,    1,    1, 2751,    1,
+     1232, 2214,    1, 2756,    1, 2742, 1429, 2745, 2799, 2760,
+     2762,    1, 2758, 2762, 2756, 2765, 2751, 2763, 2768, 2765,
+     1283, 2815, 2771,    1, 2760, 2774, 2760, 2758, 2776, 2768,
+     2770, 2783, 1612, 2761, 2785, 1672, 2770, 2784, 2829, 1459,
+     2783, 1948, 2786, 2780, 2771, 2780, 2786, 2041,    1, 2791,
+     2792, 2838, 2839, 2840, 2841, 2782, 2786, 2793, 2790, 2789,
+     2242, 2800, 2799, 2802, 1181, 2808, 2851, 2803, 2808, 2809,
+     2814, 2811, 2812, 2801, 2800, 1510, 1571, 1517, 1627, 1526,
+
+     1527, 1630, 1465, 1615, 1633,    1, 1658, 1637, 1537, 1661,
+     1626, 1640, 1650, 1643, 1654, 1644, 1433, 1651, 1665, 1667,
+     1655, 1533, 1539,    1, 1549, 1671, 1534, 1568, 1674,    1,
+     1685, 1686, 1692, 1705, 1514, 1566, 1710, 1695, 1271, 1696,
+     1286,    1,    1, 2816, 1701, 1456, 1724,    1, 1728, 1703,
+     1709, 1717, 2209, 1714, 1719, 1748, 1723, 1732, 1730, 1737,
+     1739, 1744,    1, 2213, 1738, 1759, 1753, 1782, 1761, 2216,
+     1766, 1762, 2217, 1769, 1578, 1773, 1772, 1780, 1778, 1813,
+        1,    1, 1790, 1794, 1781, 1796, 1797, 1802, 1800, 1809,
+     1814, 1817, 1819, 1824, 1829, 1830,    1,    1,    1,    1,
+
+     1844, 1831, 1846, 1842, 1852,    1, 1858, 1853, 2219, 1862,
+     1562, 1863, 1867,    1, 1866, 1874, 1869, 1881, 1882, 1883,
+     1894, 1896, 1897, 1898, 1926,    1, 1902, 1906, 1931, 1911,
+     1917, 1915, 1919, 1918, 2221, 1954, 1934, 1599, 2224, 1925,
+     1935, 1942, 1949, 1953, 1955, 1964, 1963, 1958, 1962, 1967,
+     1973, 1971, 1969, 1580, 1581, 2005, 1609, 1987,    1, 2225,
+     1974, 1994, 2002,    1, 2033, 2004, 2034, 1564, 1593, 2009,
+     1325, 2032, 1340, 2816, 2012, 2022, 2017, 2024, 2018, 2027,
+        1, 2025, 2026, 2047, 2071, 2054, 2056, 2079, 2061, 2062,
+     2063, 2066, 2072, 2085, 2076, 2065, 2075, 2096, 2100, 2103,
+
+     2083, 2110, 2134, 2113,    1, 2115, 2116, 2117, 2123,  667,
+     2212,    1, 2211, 2147, 1189, 1943, 2220, 2805, 2222, 2804,
+     2819, 1332, 2822, 2823, 2822, 2824, 2864, 2221, 2813, 2822,
+     2827, 2828, 2815, 2831, 2816, 1298, 2832, 1817,    1, 2873,
+     2874, 2875, 2876, 2823, 2878, 2879, 2268,    1, 2828, 2228,
+        1, 2881, 2843, 1363, 2883, 2240, 2884,    1, 2846, 2834,
+        1, 2833, 2232, 2829, 2241, 2834, 2850, 2851, 2854, 2847,
+     2854, 2253, 2855,    1, 2856, 2851, 2903, 2899,    1, 2242,
+        1, 2851, 2861, 2907, 2849, 2866,    1, 2244,    1, 2910,
+     2239, 2258, 2860, 2869, 2862, 1379,    1, 2869, 2857, 2865,
+
+     2876, 2869, 2876, 2875, 2921, 2870, 2880, 2876, 2866, 1310,
+     2921, 2882, 2923, 2924, 2930, 2888, 2887, 2884, 2885, 2892,
+     2872, 2878, 2933, 2896, 2881, 2881, 2937, 2938, 2939, 2886,
+     2892, 2882, 2890, 2898, 2892,    1, 2906, 2248, 2907, 2909,
+     2896, 2955, 2901, 2912, 2913, 2914, 2916, 2956, 2902, 2912,
+     2915, 2908, 2905, 2962, 2923, 2916, 2925, 2966, 2928, 2924,
+     2241, 2931, 2046, 2246, 2911, 2933, 2924, 2978,    1, 2927,
+     2921, 2935, 2937, 2929,    1, 2929, 2980, 2942, 2987, 2943,
+     2944, 2942, 2950, 2992, 2993, 2937, 2935, 2950, 2251, 2948,
+     2998,    1, 2999, 2954, 2952,    1, 2944, 2943, 2951, 2961,
+
+        1, 2961, 2962, 2950,    1, 2258, 2271, 3004, 2961,    1,
+     2303, 2966, 2953, 2954, 2972, 2964, 2958,    1, 2976, 2967,
+     2962, 2975, 2980, 2968, 2978, 2965, 2972, 2971, 2969,    1,
+     2983, 2971, 2985, 2979, 2973, 3033, 2985, 2976, 2977, 2973,
+     2983, 2996, 2981, 2998, 2993, 2991, 2999, 2989, 3001, 3047,
+     3004, 2992, 2999, 2994, 3052, 3053,    1, 3013, 3004, 3003,
+     3004, 3053, 3008, 3005, 3020, 3004, 3018, 3019, 3010, 3022,
+     3009, 3008, 3014, 3070, 3018, 3008, 3032, 3020, 3034, 2263,
+     3022, 3022, 3024, 3079, 3032, 3036,    1, 3041, 3029, 3035,
+     3080, 3031, 3033, 3031, 2268,    1, 3046, 3033, 3046, 3033,
+
+        1,    1, 3050, 3049, 3050, 3043, 3056, 3054,    1,    1,
+     3054, 3056, 3056, 3057, 3044, 3099, 3061, 3106, 3107, 3103,
+     2273, 3068, 3064, 3068,    1, 3055, 3068, 3073, 3058, 3075,
+     3059, 3059, 3078, 3075, 3116, 3063, 3070, 3065, 3076, 3083,
+     3073, 3074, 2154, 3071, 3073, 3086, 3132,    1, 3081, 3085,
+     3130, 3081, 3082, 3087, 3090, 3089, 3087, 3090, 3143, 3093,
+     3092,    1, 3141, 3102, 3094, 3091,    1,    1, 3099, 3110,
+     3093, 3094, 3099, 3110, 3112, 3098, 3113, 3116, 3109, 3104,
+     3157, 3163, 3119, 3111,    1, 2267, 3111, 3115, 3115, 3122,
+     3170, 3171, 3115, 3173, 3117,    1, 3130, 3117, 3118, 3135,
+
+     3133, 2268, 3121, 3127, 3137, 3124, 3138, 3134, 3125, 3144,
+     3147, 3144, 3185, 3134, 3139, 3144, 3189, 3138, 3191, 3144,
+     3138, 3154, 3143, 3196,    1,    1, 2283, 2298, 3155, 3158,
+     3156, 3144, 3149, 3165, 3167, 3160, 3210, 3211, 3154, 3155,
+     3155, 3174, 3157, 3174, 3166, 3155, 3171, 3178, 2320, 3173,
+        1, 2291, 3223, 3167,    1, 3180, 3174, 2317, 3182, 3177,
+     3180, 3178, 3182, 3179, 3184,    1, 3234, 3235, 3185, 3184,
+     2275, 3238, 3190, 3176, 3241, 3242, 3186, 3203, 3204, 3201,
+     3242, 3189, 3249, 3196, 3200,    1, 3247, 3196, 3249, 3210,
+     3211, 3199, 3258,    1,    1, 3200,    1, 3201, 3218, 2272,
+
+     3262, 3209, 3210, 3214, 3212, 3218, 3217, 3213, 3229, 3271,
+     3231, 3232, 2276, 2285, 3216, 3217, 3219, 3232, 3226, 3228,
+     3223, 3230, 3238, 3238, 2277, 3239, 3230, 2300, 2305, 3241,
+     3228, 3247, 3248, 3285, 3250, 3235, 3241,    1,    1, 3236,
+     3247, 3251, 1683, 3240, 3250, 3254, 3300, 3248, 2291,    1,
+     3259, 1998,    1, 3245,    1, 3304, 3248, 3261, 3266, 3250,
+     3260, 3265, 3266, 3267, 2328, 3254,    1,    1, 3265, 3274,
+     3311,    1, 2294, 3317,    1,    1, 3273, 3261, 3261, 3321,
+     3273, 3269,    1, 2305, 3279, 3282, 3267, 3269, 3328, 3329,
+     3281,    1, 3331, 3332, 2096, 3279,    1, 2339, 3334, 3286,
+
+     3331, 3283, 3338, 2342, 3339,    1, 3291, 2308, 3283, 3301,
+     3343, 3295, 3300, 3303, 3342, 3299, 3304, 3301, 3351, 3347,
+     3294, 3311, 3298, 2324, 2318, 3303, 3308, 3301, 3300, 3303,
+     3303, 3313, 3318, 2351, 3310, 3320, 3325, 3313, 3363, 3315,
+        1, 3311, 3326, 3318, 2352, 2353,    1, 2356, 2309, 2311,
+     1543, 3328, 2321, 2309, 2311, 2320, 2367, 2371, 2330, 2373,
+     2338, 2335,    1, 2337, 2340, 2344,    1, 2348, 2341, 2352,
+     2351, 2357, 2401, 2360,    1,    1, 2364,    1,    1, 2365,
+     2367, 2409,    1, 2370, 2374, 2375,    1, 2376,    1, 2378,
+     2426, 2427, 2388,    1, 2386, 2389, 2394, 2114, 2392, 2396,
+
+     2399,    1, 2398, 2436, 2404, 2405, 2136, 2443, 2406, 2411,
+     2452, 2415, 2416, 2417, 2423, 2428, 2424,    1, 2430, 2469,
+     2432, 2433, 2434, 2437, 2435, 2440, 2445,    1,    1,    1,
+     2480, 2444,    1, 2448, 2446, 2451, 2457, 2459,    1,    1,
+     2461, 3331, 2466, 2501, 2472, 2464, 2467, 2508, 2474, 2475,
+     2519, 2477,    1, 2481, 2483, 2528, 2486,    1, 2488, 2490,
+     2489, 2492, 2494,    1,    1, 2503, 2507, 2535, 2538, 2510,
+     2511, 2512, 2553, 2518, 2517,    1, 2524, 2526, 2137,    1,
+     2564, 2525, 2131, 2530, 2532, 2148, 2533, 2572, 2579, 2539,
+     2542, 2543, 2580, 2546, 2547,  741, 3375, 2592, 2593, 2594,
+
+     3371, 3372, 2595, 3373, 1419, 3320, 2597, 2600,    1, 1914,
+     3375, 3381,    1, 3382, 2598,    1, 3324, 3338, 2603,    1,
+     2602, 3326, 3342, 3387, 3343, 3345, 3390, 3391, 2605, 3333,
+     2609, 2608, 3334, 3343, 3336, 2604, 3347, 3348, 2145,    1,
+     3398, 3354, 3355, 2610, 2611, 3401,    1, 3402, 3344,    1,
+     3404, 3356, 3348,    1, 3358, 3408,    1,    1, 3360, 3369,
+     3352, 2612, 3359, 3413, 2616, 3369, 3366, 3356, 3372, 2613,
+     2617,    1,    1, 3364, 3362, 3371, 3368, 3422, 3418, 3383,
+        1, 3381, 3421,    1,    1, 3378, 3371, 3384, 3372, 3382,
+     3383, 3384, 3389, 3383, 3373, 2582,    1, 3378, 3383, 3434,
+
+     3391,    1,    1, 3392,    1, 3390, 3443, 3385,    1, 2620,
+     3396, 3397, 3392, 3407,    1, 3398, 3450, 3399, 3399, 3395,
+     3403,    1, 3398, 3403, 3403, 3395, 3416,    1, 3400, 3402,
+     3462, 3404, 3418, 3416, 3466, 3422, 3416, 3423, 3418, 3471,
+     3467, 3473, 3474, 3475, 3425, 3428, 3427, 3427, 3435,    1,
+     3476, 3482, 3424, 3432, 3426, 3434, 3446,    1, 3443, 2624,
+     3441, 3445, 3437, 3487, 3442, 3494, 2619, 3440, 3451,    1,
+     3448, 3453, 3454,    1, 3442, 3456, 3457, 3458,    1, 3461,
+        1,    1,    1, 3464, 3462, 3463, 3463, 3451, 3451,    1,
+     3506, 3467, 3464, 3469, 3457, 3516, 3512, 3464, 3466, 3477,
+
+     3466, 3522,    1, 3523, 3480, 3525, 3474, 3468, 3470, 3529,
+     3530, 3472, 3532, 3469, 3491, 3490, 3531, 3537, 3538, 3490,
+     3481, 3541, 3488, 3543, 3486,    1, 3487, 3495, 3547, 3503,
+     3504,    1,    1, 3509,    1, 3506, 3503, 3553,    1,    1,
+     3505,    1, 3512, 3511, 3504, 3509,    1,    1, 3507, 3511,
+        1, 3508,    1, 3517, 3514, 3520,    1, 3507, 3509, 3508,
+     3511, 3517,    1, 3518, 3520, 3520, 3514, 3521, 3530, 3524,
+     3519, 3520, 3514, 3580, 3523, 3533, 3538, 3579, 3540, 3541,
+     3542, 3543, 3540, 3531, 3591, 3547, 3593, 3594, 3550,    1,
+     3547, 3543, 3598, 3537, 3600, 3601, 3544, 3550, 3558, 3560,
+
+        1, 3606,    1,    1, 3607, 3555, 3565,    1, 3569,    1,
+        1, 3611, 3553, 3564, 3557,    1,    1, 3568, 3616, 3568,
+        1, 3618, 3574, 2621, 3620,    1, 3562,    1, 3565, 3582,
+        1, 3619, 3567, 3575, 3568, 3628, 3629, 3581,    1,    1,
+     3579, 3587, 3633,    1,  815
     } ;
 
-static const flex_int16_t yy_def[1627] =
+static const flex_int16_t yy_def[1746] =
     {   0,
-     1615, 1615, 1616, 1616, 1615, 1615, 1615, 1615, 1615, 1615,
-     1614, 1614, 1614, 1614, 1614, 1617, 1614, 1614, 1614, 1614,
-     1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614,
-     1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1618,
-     1614, 1614, 1614, 1619,   15, 1614,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1620,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1617, 1614,
-     1614, 1614, 1614, 1614, 1614, 1621, 1614, 1614, 1614, 1614,
-     1614, 1614, 1614, 1614, 1614, 1614, 1614, 1618, 1614, 1619,
-
-     1614, 1614,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1622,   45, 1620,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1621, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614,
-     1623,   45,   45,   45, 1614,   45,   45, 1614,   45,   45,
-
-       45,   45,   45,   45,   45, 1622, 1614, 1620,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1614,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1614, 1614, 1614,
-
-     1614, 1614, 1614, 1614, 1624,   45,   45,   45,   45,   45,
-     1614,   45,   45, 1614,   45, 1614,   45, 1620, 1614,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1614,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1614,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1614, 1614, 1614, 1625,   45,   45,
-       45,   45,   45,   45, 1614,   45,   45, 1614,   45, 1620,
-       45,   45,   45,   45, 1614,   45,   45,   45,   45,   45,
-       45,   45, 1614,   45,   45,   45,   45,   45,   45,   45,
-     1614,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1614,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1614,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-     1614,   45, 1614,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1614, 1614, 1614,   45, 1614,   45,   45,
-     1614, 1626,   45,   45, 1614, 1614,   45, 1614,   45, 1614,
-       45,   45,   45, 1614,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1614,   45,   45,
-       45,   45,   45,   45,   45,   45, 1614,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45, 1614,   45,   45, 1614,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1614,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1614,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1614,   45,   45,   45,   45,
-       45,   45,   45,   45, 1614, 1614,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1614,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1614,
-       45,   45,   45,   45,   45,   45,   45,   45, 1614,   45,
-       45,   45,   45,   45,   45,   45,   45, 1614,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1614,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1614,   45,   45,   45,   45,   45, 1614,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1614,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45, 1614, 1614,   45,   45,
-       45,   45,   45,   45, 1614, 1614,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1614,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1614,   45,
-       45,   45,   45,   45,   45,   45,   45, 1614,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1614,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1614,
-
-       45,   45,   45,   45,   45,   45, 1614,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1614, 1614,   45,
-       45,   45, 1614,   45,   45,   45, 1614,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1614,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1614,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45, 1614,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1614,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1614,   45,   45, 1614, 1614,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1614,   45, 1614,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1614, 1614,   45, 1614,   45, 1614,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1614,   45,   45,   45, 1614,   45,   45,   45,   45, 1614,
-     1614,   45, 1614,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1614,
-       45,   45,   45, 1614, 1614,   45,   45,   45,   45,   45,
-       45,   45,   45, 1614,   45,   45,   45,   45,   45,   45,
-     1614,   45,   45,   45,   45,   45,   45,   45,   45, 1614,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1614,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1614, 1614,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1614,
-       45,   45,   45,   45,   45,   45, 1614,   45, 1614,   45,
-     1614, 1614,   45, 1614,   45,   45,   45,   45,   45, 1614,
-       45, 1614,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1614,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1614,   45, 1614, 1614,   45,
-     1614,   45,   45,   45,   45,   45,   45,   45,   45, 1614,
-       45,   45,   45,   45,   45,   45, 1614, 1614,   45,   45,
-     1614,   45,   45,   45,   45,   45, 1614,   45,   45,   45,
-       45,   45, 1614,   45, 1614,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45, 1614,   45,   45, 1614,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1614,   45,   45, 1614,   45,   45,   45,   45,
-     1614, 1614,   45,   45,   45, 1614, 1614, 1614,   45,   45,
-     1614,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1614,   45,   45, 1614,   45, 1614,   45,   45,   45,   45,
-       45,   45,   45, 1614,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1614,   45,
-
-       45,   45,   45, 1614,   45,   45, 1614,   45,   45,   45,
-       45,   45, 1614,   45,   45,   45, 1614,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1614,   45,   45,   45, 1614,   45,
-     1614,   45, 1614,   45,   45,   45,   45,   45,   45, 1614,
-       45,   45,   45,   45,   45,   45,   45, 1614,   45,   45,
-       45,   45, 1614,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1614,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1614, 1614,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1614,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45, 1614,   45,   45,
-       45,   45,   45,   45,   45, 1614,   45, 1614,   45, 1614,
-       45, 1614, 1614,   45,   45,   45,   45,   45, 1614,   45,
-     1614,   45,   45, 1614,   45,   45, 1614,   45,   45,   45,
-     1614,   45,   45,   45, 1614,   45, 1614,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1614,   45,   45,   45,   45,
-       45, 1614, 1614, 1614,   45, 1614, 1614,   45,   45,   45,
-       45,   45,   45, 1614, 1614, 1614,   45,   45,   45,   45,
-
-     1614,   45,   45, 1614,   45,   45,   45,   45,   45, 1614,
-       45,   45, 1614,    0, 1614, 1614, 1614, 1614, 1614, 1614,
-     1614, 1614, 1614, 1614, 1614, 1614
+     1745,    1, 1745,    3, 1745,    5, 1745,    7, 1745,    9,
+     1745, 1745, 1745,   13, 1745, 1745, 1745,   17,   17,   17,
+       19,   19,   21,   17,   17,   17,   17,   17,   17,   17,
+       27,   28,   17,   17,   17,   17,   18,   17,   35,   17,
+       18,   17,   35,   17,   18, 1745,   35,   17,   17,   18,
+       35,   12,   17,   53,   15,   55,   55,   55,   55,   55,
+       60,   55,   55,   60,   55,   60,   60,   65,   55,   55,
+       60,   55,   55,   55,   55,   73,   55,   55,   55,   55,
+       79,   55, 1745,   55,   84,   69,   75,   84,   17, 1745,
+       17, 1745,   18,   19,   22,   26,   21,   22,   17,   26,
+
+      100,   17,   13,  102,  103,   35,   17,   17,   46,   17,
+       17,  111,   84,   82,   84,   84,   84,   84,   84,   84,
+       84,   84,   84,   84,   84,   75,   84,   84,   82,   75,
+       84,   84,   84,   84,   84,   84,   84,   65,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       75,   84,   84,   84,   84,   84,   65,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   75,
+       84,   84,   82,   84,   84,   82,   84,   55,   75,   84,
+       84,   84, 1745, 1745,   84,   17,   90,   17,   92,   17,
+
+       17,  200,  201,   17,   17,   17,   17,   17,   84,   84,
+       84,   84,   84,   84,   17,   84,   84,   75,   79,   84,
+       84,   75,   84,   84,   75,   84,   17,   84,   75,   84,
+       84,   84,   82,   84,   84,   65,   75,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       84,   75,   84,   75,   75,   84,   84,   84,   84,   75,
+       84,   65,   84,   75,   84,   84,   84,   84,   84,   84,
+       84,   84,   75,   84,   84,   84,   75,   75,   84,   75,
+       84,   84,   84,   84,   84,   84,   78,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+
+       84,   84,   84,   84,   84,   84,   84,   75,   84,   55,
+       84,   84,   55,   84,  193,  194,   17,  194,   84,   90,
+       17,   17,   17,  322,   17,   17,   84,   84,   84,   75,
+       84,   17,   84,   84,   84,   75,   65,   84,   75,   84,
+       84,   84,   75,   17,   84,   84,   84,   84,   75,   82,
+       84,   84,   84,   84,   84,   75,   84,   84,   84,   84,
+       84,   75,   75,   84,   84,   82,   84,   84,   17,   75,
+       75,   84,   84,   84,   84,   65,   84,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       84,   84,   84,   84,   84,  188,  188,  188,  188,  188,
+
+      188,  188,  188,  188,  188,   17,  188,  188,  188,  188,
+      188,  188,  188,  188,  188,  188,  188,  188,  188,  188,
+      188,  188,  188,   17,  188,  188,  188,  188,  188,   17,
+      188,  188,  188,  188,  188,  188,  188,  188,  193,  188,
+       17,   17,   17,   17,  188,  188,  188,   17,  188,  188,
+      188,  188,  188,  188,  188,  188,  188,  188,  188,  188,
+      188,  188,   17,  188,  188,  188,  188,  188,  188,  188,
+      188,  188,  188,  188,  188,  188,  188,  188,  188,  188,
+       17,   17,  188,  188,  188,  188,  188,  310,  310,  310,
+      310,  310,  310,  310,  310,  310,   17,   17,   17,   17,
+
+      310,  310,  310,  310,  310,   17,  310,  310,  310,  310,
+      310,  310,  310,   17,  310,  310,  310,  310,  310,  310,
+      310,  310,  310,  310,  310,   17,  310,  310,  310,  310,
+      310,  310,  310,  310,  310,  310,  310,  310,  310,  310,
+      310,  310,  310,  310,  310,  310,  310,  310,  310,  310,
+      310,  310,  310,  310,  310,  310,  310,  310,   17,  310,
+      310,  310,  310,   17,  310,  310,  310,  310,  310,  310,
+      193,  310,   17,   17,  310,  310,  310,  310,  310,  310,
+       17,  310,  310,  310,  310,  310,  310,  310,  310,  310,
+      310,  310,  310,  310,  310,  310,  310,  310,  310,  310,
+
+      310,  310,  310,  310,   17,  310,  313,  313,  313, 1745,
+      610,   17,  610,  613,  610,  610,  610,  615,  610,  617,
+      613,  610,  610,  610,  613,  622,  616,  610,  615,  611,
+      613,  613,  617,  622,  628,  610,  613,  610,   17,  616,
+      616,  616,  616,  617,  616,  616,  636,   17,  615,  610,
+       17,  616,  622,  610,  616,  610,  616,   17,  622,  615,
+       17,  617,  610,  638,  610,  628,  613,  613,  610,  619,
+      613,  610,  613,   17,  613,  619,  672,  677,   17,  610,
+       17,  650,  613,  672,  617,  610,   17,  610,   17,  672,
+      650,  615,  619,  610,  619,   17,   17,  613,  665,  619,
+
+      694,  611,  610,  613,  672,  694,  610,  694,  617,  610,
+      616,  613,  616,  616,  672,  610,  613,  611,  611,  610,
+      638,  617,  616,  610,  617,  628,  616,  616,  616,  617,
+      650,  694,  665,  619,  665,   17,  613,  665,  613,  622,
+      665,  672,  694,  613,  613,  613,  622,  616,  628,  619,
+      611,  615,  694,  616,  613,  688,  613,  616,  622,  611,
+      617,  610,  611,  611,  638,  610,  688,  672,   17,  694,
+      617,  656,  613,  650,   17,  694,  616,  622,  672,  613,
+      613,  694,  694,  672,  672,  615,  628,  656,  619,  611,
+      672,   17,  672,  656,  611,   17,  665,  628,  688,  622,
+
+       17,  613,  613,  665,   17,  617,  613,  616,  611,   90,
+      616,  613,  617,  617,  694,  619,  665,   17,  694,  619,
+      615,  613,  694,  650,  613,  617,  688,  694,  665,   17,
+      613,  665,  613,  694,  617,  672,  611,  617,  617,  638,
+      694,  610,  617,  610,  611,  694,  613,  680,  613,  672,
+      622,  615,  619,  615,  672,  672,   17,  694,  619,  688,
+      688,  616,  619,  694,  694,  665,  613,  613,  694,  622,
+      665,  628,  694,  672,  688,  638,  694,  650,  694,  622,
+      650,  694,  650,  672,  694,  613,   17,  694,  650,  611,
+      616,  694,  650,  615,  621,   17,  623,  618,  621,  620,
+
+       17,   17,  623,  621,  625,  688,  694,  626,   17,   17,
+      631,  634,  631,  631,  633,  640,  634,  672,  672,  640,
+      665,  694,  656,  669,   17,  649,  667,  694,  649,  694,
+      665,  662,  694,  667,  652,  662,  688,  662,  694,  669,
+      682,  682,  665,  665,  694,  667,  672,   17,  694,  694,
+      694,  694,  694,  676,  694,  676,  682,  694,  684,  693,
+      688,   17,  694,  694,  694,  694,   17,   17,  693,  694,
+      694,  694,  694,  694,  740,  709,  704,  703,  734,  752,
+      711,  705,  712,  731,   17,  707,  743,  770,  756,  986,
+      715,  715,  752,  715,  752,   17,  717,  722,  722,  720,
+
+      772,  724,  725,  731,  737,  730,  772,  734,  753,  762,
+      783,  737,  748,  752,  756,  751,  748,  752,  748,  756,
+      749,  744,  752,  748,   17,   17,  776,  755,  986,  755,
+      782,  753,  752,  815,  783,  760,  768,  768,  797,  797,
+      771,  783,  771,  766,  770,  765,  790,  842,  768,  790,
+       17,  773,  779,  786,   17,  780,  834,  777,  780,  816,
+      790,  834,  790,  799,  790,   17,  785,  791,  816,  799,
+      790,  791,  795,  840,  836,  836,  821,  819,  819,  802,
+      808,  813,  836,  824,  816,   17,  808,  821,  862,  812,
+      822,  817,  836,   17,   17,  826,   17,  826,  842,  820,
+
+      836,  824,  824,  853,  878,  837,  853,  848,  858,  836,
+      858,  858,  834,  835,  866,  866,  852,  847,  846,  853,
+      852,  853,  851,  847,  846,  847,  864,  852,  860,  867,
+      971,  858,  858,  862,  858,  894,  949,   17,   17,  866,
+      885,  867,  863,  894,  885,  867,  874,  875,  869,   17,
+      897,  871,   17,  931,   17,  874,  894,  886,  877,  931,
+      890,  886,  886,  886,  891,  971,   17,   17,  890,  888,
+      891,   17,  888,  918,   17,   17,  964,  931,  971,  918,
+      939,  965,   17,  897,  964,  903,  971,  931,  918,  918,
+      939,   17,  918,  918,  918,  965,   17,  918,  918,  939,
+
+      951,  965,  918,  919,  947,   17,  939,  922,  931,  928,
+      947,  939,  964,  940,  951,  939,  964,  939,  947,  951,
+      971,  940,  945,  964,  971,  961,  950,  945,  971,  945,
+      966,  950,  964,  964,  965,  964,  970,  965,  963,  965,
+       17,  971,  964,  965,  961,  961,   17,  963,  964,  965,
+      966,  974,  970,  971,  972,  973,  974,  978,  978,  978,
+      978,  986,   17,  986,  986,  986,   17,  986,  986,  986,
+     1000, 1000, 1000, 1000,   17,   17, 1000,   17,   17, 1000,
+     1000, 1000,   17, 1000, 1000, 1000,   17, 1000,   17, 1000,
+     1010, 1010, 1010,   17, 1010, 1010, 1010, 1010, 1010, 1010,
+
+     1010,   17, 1044, 1044, 1044, 1044, 1044, 1044, 1044, 1044,
+     1044, 1044, 1044, 1044, 1044, 1044, 1044,   17, 1044, 1044,
+     1044, 1044, 1044, 1044, 1044, 1044, 1044,   17,   17,   17,
+     1044, 1044,   17, 1044, 1044, 1044, 1044, 1044,   17,   17,
+     1044, 1048, 1048, 1048, 1048, 1099, 1099, 1099, 1099, 1099,
+     1099, 1099,   17, 1099, 1099, 1099, 1099,   17, 1099, 1099,
+     1099, 1099, 1099,   17,   17, 1099, 1099, 1099, 1099, 1099,
+     1099, 1099, 1099, 1099, 1099,   17, 1099, 1099, 1099,   17,
+     1099, 1099, 1099, 1099, 1099, 1099, 1099, 1099, 1099, 1099,
+     1099, 1099, 1099, 1099, 1099, 1745, 1396, 1396, 1396, 1396,
+
+     1400, 1400, 1396, 1400, 1396, 1403, 1396, 1396,   17, 1396,
+     1400, 1396,   17, 1396, 1396,   17, 1403, 1398, 1396,   17,
+     1396, 1403, 1405, 1396, 1419, 1405, 1396, 1396, 1396, 1403,
+     1396, 1396, 1403, 1429, 1403, 1396, 1415, 1415, 1396,   17,
+     1396, 1419, 1419, 1396, 1396, 1396,   17, 1396, 1403,   17,
+     1396, 1415, 1421,   17, 1415, 1396,   17,   17, 1415, 1432,
+     1403, 1396, 1444, 1396, 1396, 1419, 1415, 1445, 1419, 1396,
+     1396,   17,   17, 1462, 1408, 1415, 1444, 1396, 1400, 1432,
+       17, 1405, 1400,   17,   17, 1415, 1408, 1419, 1421, 1415,
+     1415, 1415, 1419, 1431, 1410, 1403,   17, 1403, 1471, 1400,
+
+     1415,   17,   17, 1415,   17, 1431, 1396, 1403,   17, 1396,
+     1415, 1415, 1471, 1432,   17, 1429, 1396, 1431, 1444, 1421,
+     1429,   17, 1408, 1444, 1462, 1410, 1465,   17, 1445, 1403,
+     1396, 1403, 1398, 1415, 1396, 1419, 1431, 1398, 1431, 1396,
+     1400, 1396, 1396, 1396, 1429, 1415, 1429, 1431, 1419,   17,
+     1400, 1396, 1403, 1431, 1403, 1431, 1432,   17, 1419, 1396,
+     1407, 1419, 1462, 1400, 1429, 1396, 1396, 1471, 1419,   17,
+     1415, 1419, 1419,   17, 1421, 1419, 1419, 1419,   17, 1465,
+       17,   17,   17, 1432, 1405, 1405, 1419, 1421, 1403,   17,
+     1400, 1419, 1415, 1419, 1421, 1396, 1400, 1462, 1444, 1465,
+
+     1471, 1396,   17, 1396, 1405, 1396, 1431, 1403, 1421, 1396,
+     1396, 1403, 1396, 1567, 1465, 1419, 1400, 1396, 1396, 1415,
+     1403, 1396, 1462, 1396, 1421,   17, 1421, 1429, 1396, 1419,
+     1419,   17,   17, 1432,   17, 1419, 1415, 1396,   17,   17,
+     1415,   17, 1465, 1419, 1444, 1415,   17,   17, 1431, 1415,
+       17, 1444,   17, 1419, 1415, 1405,   17, 1421, 1408, 1403,
+     1408, 1431,   17, 1431, 1429, 1431, 1403, 1444, 1419, 1431,
+     1421, 1421, 1436, 1396, 1421, 1415, 1419, 1400, 1419, 1419,
+     1419, 1419, 1415, 1403, 1396, 1419, 1396, 1396, 1419,   17,
+     1415, 1462, 1396, 1399, 1396, 1396, 1421, 1444, 1398, 1419,
+
+       17, 1412,   17,   17, 1412, 1444, 1405,   17, 1432,   17,
+       17, 1412, 1406, 1415, 1408,   17,   17, 1510, 1412, 1415,
+       17, 1412, 1419, 1414, 1424,   17, 1417,   17, 1475, 1432,
+       17, 1479, 1453, 1429, 1430, 1427, 1427, 1437,   17,   17,
+     1431, 1442, 1441,   17,    0
     } ;
 
-static const flex_int16_t yy_nxt[2091] =
+static const flex_int16_t yy_nxt[3707] =
     {   0,
-     1614,   13,   14,   13, 1614,   15,   16, 1614,   17,   18,
-       19,   20,   21,   22,   22,   22,   22,   22,   23,   24,
-       85,  719,   37,   14,   37,   86,   25,   26,   38,  101,
-     1614,   27,   37,   14,   37,   42,   28,   42,   38,   91,
-       92,   29,  197,   30,   13,   14,   13,   90,   91,   25,
-       31,   92,   13,   14,   13,   13,   14,   13,   32,   40,
-      720,   13,   14,   13,   33,   40,  102,   91,   92,  197,
-       90,   34,   35,   13,   14,   13,   94,   15,   16,   95,
-       17,   18,   19,   20,   21,   22,   22,   22,   22,   22,
-       23,   24,   13,   14,   13,   90,   39,  103,   25,   26,
-
-       13,   14,   13,   27,   39,   42,  107,   42,   28,   42,
-      108,   42,   41,   29,  111,   30,  114,  115,   93,  136,
-       41,   25,   31,  103,  137,  440,   88,  138,   88,  107,
-       32,   89,   89,   89,   89,   89,   33,  111,  108,  114,
-      830,  115,  441,   34,   35,   44,   44,   44,   45,   45,
-       46,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   47,   45,   48,
-       49,   50,   51,   45,   52,   53,   54,   45,   45,   45,
-       45,   55,   56,   45,   57,   45,   45,   58,   45,   45,
-       59,   45,   60,   61,   62,   63,   64,   65,   66,   52,
-
-       67,   68,   69,   70,   71,   72,   73,   74,   75,   76,
-       77,   78,   57,   45,   45,   45,   45,   45,   80,  109,
-       81,   81,   81,   81,   81,   80,  103,   83,   83,   83,
-       83,   83,  107,   82,   84,   84,   84,   84,   84,   80,
-       82,   83,   83,   83,   83,   83,  134,   82,  110,  131,
-      112,  121,  119,  135,   82,  107,   82,  165,  120,  132,
-      113,  166,  122,   82,  126,  123,  133,  124,  127,  125,
-       82,  128,  129,  112,  205,  231,  390,   82,   45,  391,
-       45,   45,   45,   45,  130,   45,   45,   45,  113,  117,
-      139,  232,   45,   45,  831,   45,   45,  205,  101,  183,
-
-      140,   45,  141,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,  111,  183,   45,  143,  144,  184,
-       45,  145,  147,  448,   45,  102,  148,  146,  185,  449,
-      149,  185,   45,  151,  154,  152,   45,  153,   45,  118,
-      198,  192,  155,  114,  156,  184,  150,  201,  159,  157,
-      158,  160,  161,  167,  173,  174,  185,  168,  374,  188,
-      169,  202,  162,  203,  112,  163,  114,  170,  171,  192,
-      214,  199,  485,  172,  113,  201,  179,  229,  486,  215,
-      216,  180,   84,   84,   84,   84,   84,  175,  202,  176,
-
-      230,  203,  204,  177,  832,   82,   89,   89,   89,   89,
-       89,   80,  113,   81,   81,   81,   81,   81,  375,  178,
-       89,   89,   89,   89,   89,   88,   82,   88,   82,  204,
-       89,   89,   89,   89,   89,   80,  183,   83,   83,   83,
-       83,   83,   84,   84,   84,   84,   84,  100,  184,   82,
-       82,  196,  192,  240,  100,   82,  220,  221,  249,  201,
-      300,  235,  186,  226,  236,  227,  222,  202,  237,  209,
-      262,  263,  266,   82,  187,  267,  268,  196,   82,  250,
-      210,  282,  228,  300,  100,  283,  298,  256,  100,  284,
-      299,  314,  100,  833,  291,  298,  408,  241,  299,  309,
-
-      100,  272,  300,  306,  100,  310,  100,  191,  208,  208,
-      208,  208,  208,  834,  298,  835,  299,  208,  208,  208,
-      208,  208,  208,  301,  302,  303,  306,  309,  317,  362,
-      313,  532,  310,  315,  533,  399,  273,  274,  275,  306,
-      208,  208,  208,  208,  208,  208,  419,  276,  400,  277,
-      313,  278,  279,  313,  280,  317,  315,  318,  318,  318,
-      318,  318,  320,  415,  326,  415,  318,  318,  318,  318,
-      318,  318,  327,  370,  424,  419,  419,  328,  329,  427,
-      501,  836,  363,  699,  700,  364,  415,  427,  416,  318,
-      318,  318,  318,  318,  318,  421,  422,  424,  443,  837,
-
-      568,  463,  752,  444,  423,  431,  464,  427,  430,  430,
-      430,  430,  430,  569,  753,  491,  489,  430,  430,  430,
-      430,  430,  430,  478,  479,  480,  490,  505,  513,  481,
-      518,  506,  514,  543,  519,  551,  660,  552,  502,  838,
-      430,  430,  430,  430,  430,  430,  538,  765,  578,  839,
-      632,  539,  543,  579,  465,  633,  661,  764,  840,  466,
-      841,  543,  551,  660,  552,   45,   45,   45,   45,   45,
-      765,  842,  843,  844,   45,   45,   45,   45,   45,   45,
-      553,  656,  728,  845,  661,  764,  662,  729,  770,  771,
-      812,  772,  846,  813,  847,  848,  849,   45,   45,   45,
-
-       45,   45,   45,  850,  851,  852,  855,  856,  857,  859,
-      860,  861,  853,  862,  858,  863,  854,  864,  865,  866,
-      867,  868,  869,  870,  871,  872,  730,  873,  874,  875,
-      876,  877,  878,  879,  880,  881,  882,  883,  884,  885,
-      886,  887,  888,  889,  890,  891,  892,  893,  894,  895,
-      896,  870,  897,  898,  899,  900,  902,  903,  904,  905,
-      901,  906,  907,  908,  909,  910,  911,  912,  913,  914,
-      915,  916,  917,  918,  919,  920,  921,  922,  924,  925,
-      926,  923,  927,  928,  929,  930,  931,  932,  933,  934,
-      935,  936,  937,  938,  939,  940,  941,  942,  943,  944,
-
-      945,  946,  947,  948,  949,  950,  951,  952,  954,  955,
-      956,  957,  958,  959,  960,  961,  962,  963,  964,  953,
-      965,  966,  967,  968,  969,  970,  971,  972,  973,  974,
-      975,  976,  977,  978,  979,  980,  981,  982,  983,  984,
-      985,  986,  987,  988,  989,  990,  991,  969,  992,  993,
-      968,  994,  995,  996,  997,  998,  999, 1000, 1001, 1002,
-     1005, 1006, 1007, 1008, 1003, 1009, 1010, 1011, 1012, 1013,
+       11,   17,   18,   35,   18,   17,   15,   12,   17,   19,
+       20,   21,   22,   16,   23,   23,   23,   23,   23,   24,
+       25,   17,   17,   17,   17,   17,   17,   26,   27,   17,
+       17,   17,   17,   13,   17,   17,   17,   17,   28,   17,
+       17,   17,   17,   29,   17,   30,   17,   17,   17,   17,
+       17,   26,   31,   17,   17,   17,   17,   17,   17,   14,
+       17,   17,   17,   17,   17,   32,   17,   17,   17,   17,
+       17,   17,   33,   34,   11,   36,   37,   39,   37,   36,
+       36,   36,   38,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   11,   40,
+       41,   43,   41,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+
+       40,   40,   40,   42,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   11,   44,   45,   47,   45,   44,   46,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   11,   49,   50,   51,
+
+       50,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   48,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       11,   90,   90,   90,   84,   84,   89,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       84,   84,   84,   85,   80,   82,   79,   55,   86,   84,
+
+       84,   78,   57,   87,   84,   84,   84,   84,   77,   76,
+       84,   81,   84,   84,   83,   84,   84,   72,   80,   58,
+       64,   63,   69,   74,   56,   59,   75,   70,   71,   67,
+       68,   61,   65,   60,   66,   62,   73,   88,   81,   84,
+       84,   84,   84,   84,   11,  194,  194,  194,  194,  194,
+      191,  194,  194,  194,  194,  194,  194,  192,  194,  194,
+      194,  194,  194,  194,  194,  194,  194,  194,  194,  194,
+      194,  194,  194,  194,  194,  194,  194,  194,  194,  194,
+      194,  194,  194,  194,  194,  194,  194,  194,  192,  194,
+      194,  194,  192,  194,  194,  194,  192,  194,  194,  194,
+
+      194,  194,  194,  192,  194,  194,  194,  192,  194,  192,
+      193,  194,  194,  194,  194,  194,  194,  194,   11,  197,
+      197,  197,  197,  197,  196,  197,  197,  197,  197,  197,
+      197,  197,  197,  197,  197,  197,  197,  197,  197,  197,
+      197,  197,  197,  197,  197,  197,  197,  197,  197,  197,
+      197,  197,  197,  197,  197,  197,  197,  197,  197,  197,
+      197,  197,  198,  197,  197,  197,  197,  197,  197,  197,
+      197,  197,  197,  197,  197,  197,  197,  197,  197,  197,
+      197,  197,  197,  197,  197,  197,  197,  197,  197,  197,
+      197,  197,   11,  316,  316,  316,  316,  316,  316,  316,
+
+      316,  316,  316,  316,  316,  316,  315,  315,  315,  315,
+      315,  316,  316,  316,  316,  315,  315,  315,  315,  315,
+      315,  316,  316,  316,  316,  316,  316,  316,  316,  316,
+      316,  316,  316,  316,  316,  316,  316,  316,  316,  315,
+      315,  315,  315,  315,  315,  316,  316,  316,  316,  316,
+      316,  316,  316,  316,  316,  316,  316,  316,  316,  316,
+      316,  316,  316,  316,  316,  316,   11,   90,   90,   90,
+       84,   84,   89,   84,   84,   84,   84,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       83,   84,   84,   84,   84,  731,   84,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       11,   90,   90,   90,   84,   84, 1457,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       84,   84,   84,   84,   83,   84,   84,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       84,   84,   84,   84, 1745, 1745, 1745, 1745, 1745, 1745,
+     1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745,
+     1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745,
+     1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745,
+     1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745,
+     1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745,
+     1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745,
+     1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745,   11,   52,
+       52,   54,   52,   52,   52,   52,   52,   52,   52,   52,
+
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   11,  199,  199,   11,  199,  199,  199,  199,
+      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
+      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
+      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
+
+      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
+      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
+      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
+      199,  199,  199,  199,  199,  199,   11,  109,  109,  352,
+      109,  109,  353,  109,  109,  109,  109,  109,  109,  109,
+      109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+      109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+      109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+      109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+      109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+
+      109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+       11,   93,   99,   93,  318,  318,  317,  318,  318,  318,
+      318,  318,  318,  318,  318,  318,  318,  318,  318,  318,
+      318,  318,  318,  318,  318,  318,  318,  318,  318,  318,
+      318,  318,  318,  318,  318,  318,  318,  318,  318,  318,
+      318,  318,  318,  318,  318,  318,  318,  318,  318,  318,
+      318,  318,  318,  318,  318,  318,  318,  318,  318,  318,
+      318,  318,  318,  318,  318,  318,  318,  318,  318,  318,
+      318,  318,  318,  318,   84,   84,   84,   84,   84,   84,
+       84,  511,   84,   84,  113,   84,   11,  512,  104,   84,
+
+       84, 1745,   84,   98,   98,   98,   98,   98,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+      439,  439,  439,  439,  439,   53,  417,   84,  105,  439,
+      439,  439,  439,  439,  439,  441,  441,  441,  441,  441,
+      188,  737,  222,   84,  441,  441,  441,  441,  441,  441,
+      223,  221,   53,  439,  439,  439,  439,  439,  439,   97,
+       97,   97,   97,   97,   84,  188,  117,   84,  441,  441,
+      441,  441,  441,  441,  571,  571,  571,  571,  571,  418,
+      102,  243,  419,  571,  571,  571,  571,  571,  571,  573,
+
+      573,  573,  573,  573,  118,  244,  245,  149,  573,  573,
+      573,  573,  573,  573,  102,  758,  163,  571,  571,  571,
+      571,  571,  571,  164,  240,  165,   84,  239,  241,  461,
+      162,  161,  573,  573,  573,  573,  573,  573,  694,  694,
+      694,  694,  694,   84,  185,  462,   84,  694,  694,  694,
+      694,  694,  694,  696,  696,  696,  696,  696,  824,  823,
+       84,  825,  696,  696,  696,  696,  696,  696,  775,  143,
+      338,  694,  694,  694,  694,  694,  694,  339,  184,  142,
+       84,  744,  340,  341,  183,   84,  696,  696,  696,  696,
+      696,  696,  810,  810,  810,  810,  810,  135,  136,  121,
+
+       84,  810,  810,  810,  810,  810,  810,  137,  774,  120,
+      230,   84,  122,  320,  123,   84,  119,  405,  138,  131,
+      320,  187,  132,  133,   89,  810,  810,  810,  810,  810,
+      810,  134,  129,  139,  448,  130,   84,  140,   95,  446,
+       94,   94,   94,   94,   94,  138,  231,  232,  233,   11,
+      128,  320,  141,   96,  127,  320,  234,   91,  229,  320,
+      235,  236,   92,  237,  482,   84,  320,  404, 1466,  483,
+      320,  153,  320,  321,  100,  152,  100,   96,  154,  101,
+      101,  101,  101,  101,  151,  150,  156,  445,   84,  227,
+      155,   84,  447,  545,  544,  546,  144,   84,   84,  547,
+
+      145,  176,   84,  146,  147,  182,  157,  577,  158,   84,
+      159,  156,   84,  137,   84,  148,  169,  168,  576,  160,
+      170,   84,  484,   84,  138,  171,  177,  531,   84,  182,
+      565,  567,  178,  179,  228,  156,  114,  137,  181,  566,
+      166,  115,   84,  180,  116,  126,   84,  219, 1333,   84,
+       84,  138,  525,  172,  124,  220,  125,  173,   84,   84,
+      523,  175,  525,  536,  166,   84,   84,  106,   84,   84,
+      215,   84,   84,  559,  167,   84,  174,  527,  558,  525,
+      554,   84,  557,  605,   84,   84,  528,  536,  604,  529,
+      554,   84,   84,  552,   84,   84,   84,   84,   84,  553,
+
+       84,  568,  214,   84,  661,  690,   84,   84,  554,  660,
+       84,  634,   84,   84,  681,  111,  677,  677,  555,  680,
+       84,  524,   84,  635,   84,  691,   84,  692,  568,   84,
+       84,   84,  526,  690,  186, 1745,   84, 1745,   84,   84,
+      111,   84,  211,  677,  678,  210,  258,   84,  259,  209,
+      299,  691,  272,  692,  262,  263,  271,   84,   84,   84,
+      273,  186,   84,  264,  260,   84,  300,   84,  534,   84,
+      473,  537,   84,   84,  474,   84,   84,  301,  107,  538,
+      532,  530,   84,   84,   84,   84,   84,   84,   84,  541,
+       84,   84,  533,   84,  539,   84,  535,   84,   84,   84,
+
+      540,   84,   84,   84,  542,  548,   84,  543,   84,   84,
+      564,  551,   84,   84,  581,  549,   84,   84,   84,   84,
+      569,  550,  477,   84,   84,   84,  478,   84,   84,   84,
+     1237,  561,   84,   84,  578,   84,  560,   84,  579,   84,
+      556,   84,   84,   84,   84,  572,   84,  575,  562,   84,
+       84,   84,  563,   84,   84,   84,   84,  570,  586,   84,
+       84,   84,   84,   84,   84,  580,  582,   84,   84,   84,
+       84,   84,   84,  584,  108,   84,   84,   84,  589,  587,
+       84,   84,   84,  585,  588,   84,   84,  591,   84,  594,
+       84,   84,  597,   84,   84,   84,   84,   84,   84,  612,
+
+      590,   84,   84,  592,   84,   84,   84,  596,  595,  313,
+       84,   84,   84,   84,   84,  600,  601,   84,  603,   84,
+       84,  606,   84,  610,   84,  598,   84,   84,   84,   84,
+       84,   84,   84,  313,   84,  607,   84,  294,   84,   84,
+       84,   84,  608,  613,  609,   84,   84,  110,   84,   84,
+      617,   84,   84,  611,   84,   84,   84,  295,   84,  615,
+       84,   84,   84,   84,  614,   84,  616,   84,  618,  621,
+      103,   84,   84,  619,   84,   84,   84,   84,   84,  639,
+      620,  626,   84,  622,   84,   84,  760,   84,   84,   84,
+       84,  623,  624,  625,   84,   84,  627,  103,   84,   84,
+
+       84,   84,   84,  288,   84,  628,   84,  630,  633,  631,
+       84,   84,  629,   84,   84,   84,   84,  638,  289,   89,
+       84,   84,  636,  637,   84,   84,   84,   84,   84,   84,
+       84,  648,   84,  640,   84,  663,  651,  641,   84,   84,
+       84,   84,  112,   84,  642,  643,  646,   84,  644,   84,
+       84,   84,   84,  738,   84,   84,   84,   84,   84,  658,
+       84,  649,  647,   84,   84,  645,   84,   84,  650,   84,
+      655,  653,  656,   84,   84,   84,   84,   84,  674,  654,
+      652,   84, 1470,   84,   84,   84,   84,   84,  659,   84,
+       84,   84,   84,   84,   84,   84,   84,  664,  487,   84,
+
+       84,   84,  486,   84,  665,   84,   84,   84,  666,  670,
+      679,   84,   84,   84,  669,  676,   84,  668,  667,   84,
+       84,   84,   84,  673,  672,   84,   84,   84,  671,   84,
+      684,   84,   84,  675,   84,  682,   84,   84,  687,  689,
+      685,   84,  695,  256,   84,   84,  369, 1245,  686,   84,
+       84,  368,   84,  688,   84,  257,   84,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,  693,  698,
+       84,  700,  699,  701,  702,   84,   84,  703,  705,   84,
+       84,  707,   84,   84,   84,   84,   84,  704,   84,  710,
+       84,   84,   84,   84,   84,   84,  493,   84,   84,  494,
+
+      880,   89,  709,   84,   84,   84,  881,   84,   84,  706,
+      879,   84,   84,  722,   84,   84,  718,   84,  708,   84,
+       84,   84,  714,   84,   84,  711,  712,  713,   84,   84,
+       84,  716,   84,   84,   84,   84,  715,   84,  717,  719,
+      723,   84,   84,   84,  725,   84,  720,   84,   84,   84,
+       89, 1280,  736, 1447,   84,   84,  721,  734,   84, 1051,
+      724,   84,   84, 1439, 1050,  727,   84,  729,   84,  730,
+     1371,   84, 1379,   84,   84,   84,  726, 1496, 1370,   84,
+      728,   84,  189,   84,   84,   84,  249, 1439,  176,  200,
+      206,  201,   84, 1443, 1442,  249,   84,  735,  252, 1379,
+
+      277,  277,  323, 1496,  287,  299,  322,  189,  306,  310,
+      190, 1446,  248,  176,  200,  206,  312, 1049,  201,  372,
+      398,  249,  398,  409,  391,  252,  323,  277,  280,  287,
+      423,  423,  299,  322,  306,  310,  392,  434,  436,  437,
+      442,   84,  312,  372,  398,   84,  401,  506,   84,   84,
+      409,   84,  507,   84,  423,  425,   84,   84,  792,   84,
+       84,  733,  436,  434,  442,  437,  732,  583,   84,   84,
+       84,  593,  806,  769,  599,  602,   84,  632,  741,  657,
+      782,  783,  662,  683,  739,  768,  750,  771,   84,   84,
+       84,  777,   84,  807,  852,  920, 1153,  921,  806,  877,
+
+      882,   84,  804,  798,  785,  876,  883,  907,  925, 1028,
+      906,  853,  991,  924, 1006,   84, 1104, 1128, 1007, 1089,
+      807,  921,  920,  992, 1129, 1150, 1105,   84,   84,   84,
+     1151, 1209, 1210,   84,   84, 1224, 1028, 1225, 1256, 1196,
+       84, 1154, 1171, 1128,   89, 1221, 1243,   89, 1129,   84,
+     1307,   84, 1270,   84,   84, 1308, 1318, 1328, 1329,   84,
+     1262, 1330, 1224, 1225, 1291, 1332,   84,   84, 1336, 1337,
+       84, 1331, 1339,   84, 1307,   84, 1340, 1338,   84, 1335,
+       84, 1341, 1308, 1342, 1159, 1344,   84,   84, 1345,   84,
+     1346, 1257,   84,   84, 1347, 1282,   84, 1348, 1350,   84,
+
+       84, 1317, 1343, 1349,   84,   84, 1353, 1288,   84, 1351,
+       84,   84,   84,   84, 1358,   84, 1352,   84,   84,   84,
+     1359,   84,   84,   84,   84, 1354,   84, 1355, 1356, 1357,
+     1362, 1364, 1365, 1361,   84, 1363,   84,   84, 1368, 1360,
+       84, 1376,   84, 1372,   84, 1373,   84,   84, 1380,   84,
+     1374, 1366,   84,   84,   84, 1378, 1367,   84, 1369,   84,
+     1377, 1375, 1383,   84,   84,   84, 1385, 1386, 1382, 1384,
+     1381,   84,   84, 1387,   84,   84,   84, 1388,   84, 1391,
+       84,   84,   84,   84,   84,   84, 1390, 1389,   84, 1393,
+     1399,   84,   84,   84,   84, 1392,   84, 1401, 1396,   84,
+
+       84, 1394, 1395, 1398, 1397,   84, 1409,   84, 1400,   84,
+     1402, 1406,   84, 1413,   84,   84, 1403,   84, 1405, 1408,
+       84, 1404,   84,   84, 1416,   84, 1410, 1411,   84,   84,
+     1412,   84, 1418, 1420,   84, 1417,   84,   84,   84, 1415,
+       84, 1421,   84, 1414, 1426, 1429, 1422, 1419, 1430,   84,
+     1423,   84, 1424, 1427, 1425,   84,   84, 1428,   84,   84,
+       84, 1432, 1433, 1434, 1431,   84,   84,   84, 1435, 1440,
+     1437, 1436,   84,   84,   84, 1441,   84, 1438,   84, 1445,
+       84,   84, 1449,   84, 1450, 1454,   84,   84, 1451, 1444,
+       84,   84, 1455, 1453,   84,   84, 1448,   89,   89,   89,
+
+       89,   84,   89,   89, 1461,   89, 1452,   89,   89,   89,
+       89, 1456,   84,   89,   89,   89,   89,   89, 1522, 1543,
+       84,   89,   89, 1521,   89,   89,   89,   84,   84,   89,
+       84,   84,  195,  202,  203,  204,  205,  207,  208,  212,
+      213,  216,  217, 1459,  218,  224, 1543,  225,  226,  238,
+     1468,  242, 1474, 1477, 1489,  246,  247,  250,  251, 1464,
+     1460, 1486, 1469,  253, 1516, 1478, 1488,  254, 1500,  255,
+      261, 1513, 1552,  265, 1493,  266, 1501, 1523,  267, 1597,
+      268,  269,  270,  274,  275,  276,  278, 1730, 1604,  279,
+      281,  282,  283,  284,  285,  286,  290,  291,  292,  293,
+
+      296,  297,  298,  302,  303,  304,  305,  307,  308,  309,
+      311,  314,  319,  324,  325,  326,  327,  328,  329,  330,
+      331,  332,  333,  334,  335,  336,  337,  342,  343,  344,
+      345,  346,  347,  348,  349,  350,  351,  354,  355,  356,
+      357,  358,  359,  360,  361,  362,  363,  364,  365,  366,
+      367,  369,  370,  371,  373,  374,  375,  376,  377,  378,
+      379,  380,  381,  382,  383,  384,  385,  386,  387,  388,
+      389,  390,  393,  394,  395,  396,  397,  399,  400,  402,
+      403,  406,  407,  408,  410,  411,  412,  413,  414,  415,
+      416,  420,  421,  422,  424,  426,  427,  428,  429,  430,
+
+      431,  432,  433,  435,  438,  440,  443,  444,  449,  450,
+      451,  452,  453,  454,  455,  456,  457,  458,  459,  460,
+      463,  464,  465,  466,  467,  468,  469,  470,  471,  472,
+      475,  476,  479,  480,  481,  485,  488,  489,  490,  491,
+      492,  495,  496,  497,  498,  499,  500,  501,  502,  503,
+      504,  505,  508,  509,  510,  513,  514,  515,  516,  517,
+      518,  519,  520,  521,  522,  574,  697,  740,  742,  743,
+      745,  746,  747,  748,  749,  751,  752,  753,  754,  755,
+      756,  757,  759,  761,  762,  763,  764,  765,  766,  767,
+      770,  772,  773,  776,  778,  779,  780,  781,  784,  786,
+
+      787,  788,  789,  790,  791,  793,  794,  795,  796,  797,
+      799,  800,  801,  802,  803,  805,  808,   84,  809,  811,
+      812,  813,  814,  815,  816,  817,  818,  819,  820,  821,
+      822,  826,  827,  828,  829,  830,  831,  832,  833,  834,
+      835,  836,  837,  838,  839,  840,  841,  842,  843,  844,
+      845,  846,  847,  848,  849,  850,  851,  854,  855,  856,
+      857,  858,  859,  860,  861,  862,  863,  864,  865,  866,
+      867,  868,  869,  870,  871,  872,  873,  874,  875,  878,
+      884,  885,  886,  887,  888,  889,  890,  891,  892,  893,
+      894,  895,  896,  897,  898,  899,  900,  901,  902,  903,
+
+      904,  905,  908,  909,  910,  911,  912,  913,  914,  915,
+      916,  917,  918,  919,  922,  923,  926,  927,  928,  929,
+      930,  931,  932,  933,  934,  935,  936,  937,  938,  939,
+      940,  941,  942,  943,  944,  945,  946,  947,  948,  949,
+      950,  951,  952,  953,  954,  955,  956,  957,  958,  959,
+      960,  961,  962,  963,  964,  965,  966,  967,  968,  969,
+      970,  971,  972,  973,  974,  975,  976,  977,  978,  979,
+      980,  981,  982,  983,  984,  985,  986,  987,  988,  989,
+      990,  993,  994,  995,  996,  997,  998,  999, 1000, 1001,
+     1002, 1003, 1004, 1005, 1008, 1009, 1010, 1011, 1012, 1013,
+
      1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023,
-     1024, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034,
-     1035, 1025, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043,
-
-     1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053,
-     1054, 1055, 1056, 1057, 1058, 1059, 1060, 1004, 1061, 1062,
-     1064, 1063, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072,
-     1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082,
-     1083, 1084, 1085, 1086, 1087, 1088, 1089, 1062, 1063, 1090,
-     1091, 1092, 1093, 1094, 1095, 1096, 1098, 1100, 1101, 1102,
-     1097, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111,
-     1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121,
-     1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131,
-     1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141,
-
-     1099, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150,
-     1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160,
-     1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170,
-     1171, 1172, 1173, 1174, 1152, 1175, 1176, 1177, 1178, 1179,
-     1153, 1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188,
-     1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198,
-     1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208,
-     1209, 1210, 1211, 1212, 1213, 1214, 1216, 1217, 1218, 1219,
-     1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229,
-     1230, 1231, 1232, 1234, 1235, 1236, 1237, 1238, 1239, 1240,
-
-     1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250,
-     1251, 1252, 1253, 1254, 1255, 1256, 1257, 1229, 1258, 1259,
-     1260, 1261, 1262, 1263, 1264, 1266, 1267, 1268, 1215, 1269,
-     1270, 1271, 1265, 1272, 1273, 1274, 1233, 1275, 1276, 1277,
-     1278, 1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287,
-     1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297,
-     1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307,
-     1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317,
-     1318, 1296, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326,
-     1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336,
-
-     1337, 1338, 1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346,
-     1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356,
-     1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364, 1365, 1366,
-     1367, 1368, 1369, 1370, 1371, 1373, 1374, 1375, 1376, 1349,
-     1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386,
-     1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396,
-     1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406,
-     1407, 1409, 1410, 1411, 1412, 1408, 1413, 1414, 1415, 1416,
-     1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426,
-     1427, 1400, 1372, 1428, 1429, 1430, 1431, 1432, 1433, 1434,
-
-     1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444,
-     1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454,
-     1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464,
-     1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474,
-     1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484,
-     1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494,
-     1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504,
-     1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514,
-     1515, 1516, 1517, 1518, 1519, 1520, 1521, 1522, 1523, 1524,
-     1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534,
-
-     1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544,
-     1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554,
-     1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564,
-     1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574,
-     1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584,
-     1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594,
-     1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604,
-     1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613,   12,
-       12,   12,   12,   12,   36,   36,   36,   36,   36,   79,
-      305,   79,   79,   79,   98,  418,   98,  542,   98,  100,
-
-      100,  100,  100,  100,  116,  116,  116,  116,  116,  182,
-      100,  182,  182,  182,  206,  206,  206,  829,  828,  827,
-      826,  825,  824,  823,  822,  821,  820,  819,  818,  817,
-      816,  815,  814,  811,  810,  809,  808,  807,  806,  805,
-      804,  803,  802,  801,  800,  799,  798,  797,  796,  795,
-      794,  793,  792,  791,  790,  789,  788,  787,  786,  785,
-      784,  783,  782,  781,  780,  779,  778,  777,  776,  775,
-      774,  773,  769,  768,  767,  766,  763,  762,  761,  760,
-      759,  758,  757,  756,  755,  754,  751,  750,  749,  748,
-      747,  746,  745,  744,  743,  742,  741,  740,  739,  738,
-
-      737,  736,  735,  734,  733,  732,  731,  727,  726,  725,
-      724,  723,  722,  721,  718,  717,  716,  715,  714,  713,
-      712,  711,  710,  709,  708,  707,  706,  705,  704,  703,
-      702,  701,  698,  697,  696,  695,  694,  693,  692,  691,
-      690,  689,  688,  687,  686,  685,  684,  683,  682,  681,
-      680,  679,  678,  677,  676,  675,  674,  673,  672,  671,
-      670,  669,  668,  667,  666,  665,  664,  663,  659,  658,
-      657,  656,  655,  654,  653,  652,  651,  650,  649,  648,
-      647,  646,  645,  644,  643,  642,  641,  640,  639,  638,
-      637,  636,  635,  634,  631,  630,  629,  628,  627,  626,
-
-      625,  624,  623,  622,  621,  620,  619,  618,  617,  616,
-      615,  614,  613,  612,  611,  610,  609,  608,  607,  606,
-      605,  604,  603,  602,  601,  600,  599,  598,  597,  596,
-      595,  594,  593,  592,  591,  590,  589,  588,  587,  586,
-      585,  584,  583,  582,  581,  580,  577,  576,  575,  574,
-      573,  572,  571,  570,  567,  566,  565,  564,  563,  562,
-      561,  560,  559,  558,  557,  556,  555,  554,  550,  549,
-      548,  547,  546,  545,  544,  541,  540,  537,  536,  535,
-      534,  531,  530,  529,  528,  527,  526,  525,  524,  523,
-      522,  521,  520,  517,  516,  515,  512,  511,  510,  509,
-
-      508,  507,  504,  503,  500,  499,  498,  497,  496,  495,
-      494,  493,  492,  488,  487,  484,  483,  482,  477,  476,
-      475,  474,  473,  472,  471,  470,  469,  468,  467,  462,
-      461,  460,  459,  458,  457,  456,  455,  454,  453,  452,
-      451,  450,  447,  446,  445,  442,  439,  438,  437,  436,
-      435,  434,  433,  432,  429,  428,  426,  425,  420,  417,
-      414,  413,  412,  411,  410,  409,  407,  406,  405,  404,
-      403,  402,  401,  398,  397,  396,  395,  394,  393,  392,
-      389,  388,  387,  386,  385,  384,  383,  382,  381,  380,
-      379,  378,  377,  376,  373,  372,  371,  369,  368,  367,
-
-      366,  365,  361,  360,  359,  358,  357,  356,  355,  354,
-      353,  352,  351,  350,  349,  348,  347,  346,  345,  344,
-      343,  342,  341,  340,  339,  338,  337,  336,  335,  334,
-      333,  332,  331,  330,  325,  324,  323,  322,  321,  319,
-      207,  316,  314,  312,  311,  308,  307,  304,  297,  296,
-      295,  294,  293,  292,  290,  289,  288,  287,  286,  285,
-      281,  271,  270,  269,  265,  264,  261,  260,  259,  258,
-      257,  255,  254,  253,  252,  251,  248,  247,  246,  245,
-      244,  243,  242,  239,  238,  234,  233,  225,  224,  223,
-      219,  218,  217,  213,  212,  211,  207,  200,  195,  194,
-
-      193,  190,  189,  181,  164,  142,  106,  105,  104,   43,
-       99,   97,   96,   87,   43, 1614,   11, 1614, 1614, 1614,
-     1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614,
-     1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614,
-     1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614,
-     1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614,
-     1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614,
-     1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614,
-     1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614
+     1024, 1025, 1026, 1027, 1029, 1030, 1031, 1032, 1033, 1034,
+     1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044,
+     1045, 1046, 1047, 1048, 1052, 1053, 1054, 1055, 1056, 1057,
+     1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067,
+     1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077,
+     1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+     1088, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098,
+     1099, 1100, 1101, 1102, 1103, 1106, 1107, 1108, 1109, 1110,
+     1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120,
+
+     1121, 1122, 1123, 1124, 1125, 1126, 1127, 1130, 1131, 1132,
+     1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142,
+     1143, 1144, 1145, 1146, 1147, 1148, 1149, 1152, 1155, 1156,
+     1157, 1158, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167,
+     1168, 1169, 1170, 1172, 1173, 1174, 1175, 1176, 1177, 1178,
+     1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188,
+     1189, 1190, 1191, 1192, 1193, 1194, 1195, 1197, 1198, 1199,
+     1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1211,
+     1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1222,
+     1223, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234,
+
+     1235, 1236, 1238, 1239, 1240, 1241, 1242, 1244, 1246, 1247,
+     1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1258, 1259,
+     1260, 1261, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1271,
+     1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1281, 1283,
+     1284, 1285, 1286, 1287, 1289, 1290, 1292, 1293, 1294, 1295,
+     1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305,
+     1306, 1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316, 1319,
+     1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1334, 1407,
+     1458, 1462, 1463, 1465, 1467, 1471, 1472, 1473, 1475, 1476,
+     1479, 1480, 1481, 1482, 1483, 1484, 1485, 1487, 1490, 1491,
+
+     1492, 1494, 1495, 1497, 1498, 1499, 1502, 1503, 1504, 1505,
+     1506, 1507, 1508, 1509, 1510, 1511, 1512, 1514, 1515, 1517,
+     1518, 1519, 1520, 1524, 1525, 1526, 1527, 1528, 1529, 1530,
+     1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540,
+     1541, 1542, 1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551,
+     1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562,
+     1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572,
+     1573, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582,
+     1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592,
+     1593, 1594, 1595, 1596, 1598, 1599, 1600, 1601, 1602, 1603,
+
+     1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614,
+     1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624,
+     1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634,
+     1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644,
+     1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654,
+     1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664,
+     1665, 1666, 1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674,
+     1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684,
+     1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694,
+     1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704,
+
+     1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714,
+     1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724,
+     1725, 1726, 1727, 1728, 1729, 1731, 1732, 1733, 1734, 1735,
+     1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0
     } ;
 
-static const flex_int16_t yy_chk[2091] =
+static const flex_int16_t yy_chk[3707] =
     {   0,
-        0,    1,    1,    1,    0,    1,    1,    0,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-       21,  614,    3,    3,    3,   21,    1,    1,    3,   44,
-        0,    1,    4,    4,    4,   13,    1,   13,    4,   27,
-       28,    1,  108,    1,    5,    5,    5,   26,   32,    1,
-        1,   33,    6,    6,    6,    7,    7,    7,    1,    7,
-      614,    8,    8,    8,    1,    8,   44,   27,   28,  108,
-       26,    1,    1,    2,    2,    2,   32,    2,    2,   33,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    2,    9,    9,    9,   31,    5,   47,    2,    2,
-
-       10,   10,   10,    2,    6,   37,   51,   37,    2,   42,
-       52,   42,    9,    2,   54,    2,   56,   57,   31,   65,
-       10,    2,    2,   47,   65,  329,   25,   65,   25,   51,
-        2,   25,   25,   25,   25,   25,    2,   54,   52,   56,
-      726,   57,  329,    2,    2,   15,   15,   15,   15,   15,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    9,    9,    9,    9,
+
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   17,   53,
-       17,   17,   17,   17,   17,   19,   59,   19,   19,   19,
-       19,   19,   63,   17,   20,   20,   20,   20,   20,   22,
-       19,   22,   22,   22,   22,   22,   64,   20,   53,   62,
-       55,   60,   59,   64,   22,   63,   17,   74,   59,   62,
-       55,   74,   60,   19,   61,   60,   63,   60,   61,   60,
-       20,   61,   61,   55,  115,  133,  275,   22,   45,  275,
-       45,   45,   45,   45,   61,   45,   45,   45,   55,   58,
-       66,  133,   45,   45,  727,   45,   58,  115,  100,   90,
-
-       66,   45,   66,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   70,   90,   58,   68,   68,   91,
-       58,   68,   69,  336,   58,  100,   69,   68,   92,  336,
-       69,   95,   58,   70,   71,   70,   58,   70,   58,   58,
-      109,  103,   71,   77,   71,   91,   69,  111,   72,   71,
-       71,   72,   72,   75,   76,   76,   92,   75,  260,   95,
-       75,  112,   72,  113,   76,   72,   77,   75,   75,  103,
-      123,  109,  366,   75,   76,  111,   77,  132,  366,  123,
-      123,   77,   80,   80,   80,   80,   80,   76,  112,   76,
-
-      132,  113,  114,   76,  729,   80,   88,   88,   88,   88,
-       88,   81,   76,   81,   81,   81,   81,   81,  260,   76,
-       89,   89,   89,   89,   89,   82,   81,   82,   80,  114,
-       82,   82,   82,   82,   82,   83,   93,   83,   83,   83,
-       83,   83,   84,   84,   84,   84,   84,  102,   94,   81,
-       83,  107,  119,  139,  102,   84,  127,  127,  147,  153,
-      185,  136,   93,  131,  136,  131,  127,  175,  136,  119,
-      159,  159,  162,   83,   94,  162,  162,  107,   84,  147,
-      119,  168,  131,  185,  102,  168,  183,  153,  102,  168,
-      184,  291,  102,  730,  175,  186,  291,  139,  187,  196,
-
-      102,  166,  188,  192,  102,  197,  102,  102,  118,  118,
-      118,  118,  118,  731,  183,  732,  184,  118,  118,  118,
-      118,  118,  118,  186,  187,  188,  192,  196,  205,  250,
-      201,  408,  197,  203,  408,  283,  166,  166,  166,  210,
-      118,  118,  118,  118,  118,  118,  306,  166,  283,  166,
-      256,  166,  166,  201,  166,  205,  203,  208,  208,  208,
-      208,  208,  210,  298,  216,  301,  208,  208,  208,  208,
-      208,  208,  216,  256,  309,  306,  320,  216,  216,  313,
-      381,  733,  250,  593,  593,  250,  298,  370,  301,  208,
-      208,  208,  208,  208,  208,  308,  308,  309,  332,  734,
-
-      448,  350,  647,  332,  308,  320,  350,  313,  318,  318,
-      318,  318,  318,  448,  647,  370,  369,  318,  318,  318,
-      318,  318,  318,  362,  362,  362,  369,  384,  391,  362,
-      395,  384,  391,  419,  395,  429,  551,  429,  381,  735,
-      318,  318,  318,  318,  318,  318,  413,  661,  458,  736,
-      515,  413,  431,  458,  350,  515,  552,  660,  737,  350,
-      738,  419,  429,  551,  429,  430,  430,  430,  430,  430,
-      661,  739,  740,  741,  430,  430,  430,  430,  430,  430,
-      431,  553,  623,  742,  552,  660,  553,  623,  666,  666,
-      707,  666,  743,  707,  744,  745,  746,  430,  430,  430,
-
-      430,  430,  430,  746,  747,  748,  749,  750,  751,  753,
-      754,  755,  748,  756,  751,  757,  748,  758,  759,  760,
-      761,  762,  764,  765,  766,  767,  623,  768,  770,  771,
-      772,  773,  774,  775,  776,  777,  778,  779,  780,  781,
-      782,  783,  784,  785,  786,  787,  788,  789,  790,  792,
-      793,  765,  794,  795,  796,  797,  798,  799,  800,  801,
-      797,  802,  803,  804,  805,  806,  809,  810,  811,  812,
-      813,  814,  817,  818,  819,  820,  821,  822,  823,  824,
-      825,  822,  826,  827,  828,  830,  831,  832,  833,  834,
-      835,  836,  837,  838,  839,  840,  841,  842,  843,  844,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   90,   90,
+       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+       90,   90,  193,  193,  193,  193,  193,  193,  193,  193,
+
+      193,  193,  193,  193,  193,  193,  193,  193,  193,  193,
+      193,  193,  193,  193,  193,  193,  193,  193,  193,  193,
+      193,  193,  193,  193,  193,  193,  193,  193,  193,  193,
+      193,  193,  193,  193,  193,  193,  193,  193,  193,  193,
+      193,  193,  193,  193,  193,  193,  193,  193,  193,  193,
+      193,  193,  193,  193,  193,  193,  193,  193,  193,  193,
+      193,  193,  193,  193,  193,  193,  610,  610,  610,  610,
+      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
+      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
+      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
+
+      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
+      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
+      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
+      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
+     1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396,
+     1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396,
+     1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396,
+     1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396,
+     1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396,
+     1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396,
+
+     1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396,
+     1396, 1396, 1396, 1396, 1745, 1745, 1745, 1745, 1745, 1745,
+     1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745,
+     1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745,
+     1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745,
+     1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745,
+     1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745,
+     1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745,
+     1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745,   12,   12,
+       12,   14,   12,   12,   12,   12,   12,   12,   12,   12,
+
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   92,   92,   92,   17,   92,   92,   92,   92,
+       92,   92,   92,   92,   92,   92,   92,   92,   92,   92,
+       92,   92,   92,   92,   92,   92,   92,   92,   92,   92,
+       92,   92,   92,   92,   92,   92,   92,   92,   92,   92,
+
+       92,   92,   92,   92,   92,   92,   92,   92,   92,   92,
+       92,   92,   92,   92,   92,   92,   92,   92,   92,   92,
+       92,   92,   92,   92,   92,   92,   92,   92,   92,   92,
+       92,   92,   92,   92,   92,   92,   46,   46,   46,  233,
+       46,   46,  233,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+      194,   18,   25,   18,  194,  194,  194,  194,  194,  194,
+      194,  194,  194,  194,  194,  194,  194,  194,  194,  194,
+      194,  194,  194,  194,  194,  194,  194,  194,  194,  194,
+      194,  194,  194,  194,  194,  194,  194,  194,  194,  194,
+      194,  194,  194,  194,  194,  194,  194,  194,  194,  194,
+      194,  194,  194,  194,  194,  194,  194,  194,  194,  194,
+      194,  194,  194,  194,  194,  194,  194,  194,  194,  194,
+      194,  194,  194,  194,   55,   55,   55,   55,   55,   55,
+       76,  385,   55,   55,   55,   76,   13,  385,   31,   55,
+
+       55,   22,   55,   22,   22,   22,   22,   22,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+      315,  315,  315,  315,  315,   13,  295,  615,   32,  315,
+      315,  315,  315,  315,  315,  321,  321,  321,  321,  321,
+       80,  615,  122,   80,  321,  321,  321,  321,  321,  321,
+      122,  122,   13,  315,  315,  315,  315,  315,  315,   21,
+       21,   21,   21,   21,   65,   80,   57,   57,  321,  321,
+      321,  321,  321,  321,  439,  439,  439,  439,  439,  295,
+       27,  131,  295,  439,  439,  439,  439,  439,  439,  441,
+
+      441,  441,  441,  441,   57,  131,  131,   65,  441,  441,
+      441,  441,  441,  441,   27,  636,   68,  439,  439,  439,
+      439,  439,  439,   68,  129,   68,   75,  129,  129,  341,
+       68,   68,  441,  441,  441,  441,  441,  441,  571,  571,
+      571,  571,  571,   63,   75,  341,  636,  571,  571,  571,
+      571,  571,  571,  573,  573,  573,  573,  573,  710,  710,
+       74,  710,  573,  573,  573,  573,  573,  573,  654,   63,
+      221,  571,  571,  571,  571,  571,  571,  221,   74,   63,
+      622,  622,  221,  221,   74,   58,  573,  573,  573,  573,
+      573,  573,  696,  696,  696,  696,  696,   62,   62,   58,
+
+       79,  696,  696,  696,  696,  696,  696,   62,  654,   58,
+      127,  654,   58,  198,   58,   62,   58,  283,   62,   61,
+      198,   79,   61,   61, 1405,  696,  696,  696,  696,  696,
+      696,   62,   61,   62,  327,   61,   60,   62,   19,  327,
+       19,   19,   19,   19,   19,   62,  127,  127,  127,   16,
+       60,  198,   62,   19,   60,  198,  127,   16,  127,  198,
+      127,  127,   16,  127,  360,  417,  198,  283, 1405,  360,
+      198,   66,  198,  198,   26,   66,   26,   19,   66,   26,
+       26,   26,   26,   26,   66,   66,   67,  327,  446,  126,
+       66,  417,  327,  417,  417,  417,   64,  403,   70,  417,
+
+       64,   72,   72,   64,   64,   73,   67,  446,   67,   56,
+       67,   87,   73,   77,  446,   64,   70,   70,  446,   67,
+       70,   77,  360,  403,   77,   70,   72,  403,   59,   73,
+      435,  435,   72,   72,  126,   87,   56,   77,   73,  435,
+       69,   56,  396,   73,   56,   59,  435,  121, 1251,  398,
+       69,   77,  398,   71,   59,  121,   59,   71,  400,  401,
+      396,   71,  401,  409,   69,  422,  427,   35,  396,  409,
+      117,  423,  435,  428,   69,  398,   71,  400,  428,  398,
+      423,  425,  427,  475,  400,  401,  400,  409,  475,  401,
+      425,  422,  427,  422,  511,  409,  568,  423,  436,  422,
+
+      428,  436,  117,  397,  538,  568, 1251,  425,  423,  538,
+      475,  511,  554,  555,  557,   53,  554,  555,  425,  557,
+      511,  397,  568,  511,  436,  569,  428,  569,  436,  397,
+       78,  538,  399,  568,   78,  100,  475,  100,  554,  555,
+       53,  557,  114,  554,  555,  114,  143,  404,  143,  114,
+      177,  569,  152,  569,  145,  145,  152,  538,  411,  399,
+      152,   78,  402,  145,  143,  405,  177,  557,  407,  408,
+      353,  410,  412,  404,  353,  414,  416,  177,   38,  411,
+      404,  402,  413,  418,  411,  399,  415,  421,  402,  414,
+      407,  405,  405,  410,  412,  408,  408,  419,  412,  420,
+
+      413,  414,  416,  426,  415,  418,  429,  416,  413,  418,
+      434,  421,  415,  421,  451,  419,  407,  431,  432,  410,
+      437,  420,  356,  419,  433,  420,  356,  438,  440,  426,
+     1143,  431,  429,  445,  447,  450,  429,  434,  449, 1143,
+      426,  451,  437,  431,  432,  440,  454,  445,  432,  452,
+      433,  455,  433,  438,  440,  457,  447,  438,  456,  445,
+      449,  450,  459,  434,  458,  450,  452,  451,  437,  460,
+      465,  461,  454,  454,   42,  452,  462,  455,  459,  457,
+      456,  457,  447,  455,  458,  467,  449,  461,  459,  465,
+      458,  466,  468,  469,  472,  460,  465,  461,  471,  484,
+
+      460,  474,  462,  462,  477,  476,  456,  467,  466,  189,
+      479,  467,  478,  485,  468,  471,  472,  466,  474,  469,
+      472,  476,  483,  480,  471,  469,  484,  474,  486,  487,
+      477,  476,  489,  189,  488,  477,  479,  172,  478,  485,
+      468,  490,  478,  485,  479,  480,  491,   48,  483,  492,
+      489,  493,  484,  483,  486,  487,  494,  172,  489,  487,
+      488,  495,  496,  502,  486,  638,  488,  490,  490,  493,
+       28,  480,  491,  491,  504,  492,  501,  493,  503,  516,
+      492,  502,  494,  494,  505,  508,  638,  495,  496,  502,
+      507,  495,  496,  501,  510,  512,  503,   28,  515,  513,
+
+      504,  517,  501,  167,  503,  504,  516,  507,  510,  508,
+      505,  508,  505,  518,  519,  520,  507,  515,  167, 1410,
+      510,  512,  512,  513,  515,  513,  521,  517,  522,  523,
+      524,  525,  516,  517,  527,  540,  529,  518,  528,  518,
+      519,  520,   54,  530,  519,  520,  523,  532,  521,  531,
+      534,  533,  521,  616,  522,  523,  524,  540,  525,  536,
+      527,  527,  524,  529,  528,  522,  537,  541,  528,  530,
+      533,  531,  534,  532,  542,  531,  534,  533,  551,  532,
+      530,  543, 1410,  540,  525,  544,  536,  545,  537,  529,
+      548,  616,  537,  541,  549,  547,  546,  541,  362,  550,
+
+      542,  553,  362,  552,  542,  551,  561,  543,  543,  547,
+      556,  544,  536,  545,  546,  553,  548,  545,  544,  558,
+      549,  547,  546,  550,  549,  550,  562,  553,  548,  552,
+      561,  551,  561,  552,  563,  558,  566,  556,  565,  567,
+      562,  570,  572,  142,  575,  558,  248, 1152,  563,  577,
+      579,  248,  562,  566,  576,  142,  578,  582,  583,  580,
+      563, 1152,  566,  556,  572,  565,  567,  570,  570,  575,
+      575,  577,  576,  578,  579,  577,  579,  580,  583,  584,
+      576,  585,  578,  582,  583,  580,  586,  582,  587,  588,
+      572,  565,  567,  589,  590,  591,  368,  596,  592,  368,
+
+      763, 1195,  587,  585,  593,  584,  763,  597,  595,  584,
+      763,  588,  586,  600,  587,  601,  596,  594,  586,  589,
+      590,  591,  592,  596,  592,  589,  590,  591,  598,  585,
+      593,  594,  599,  597,  595,  600,  593,  588,  595,  597,
+      601,  601,  602,  594,  603,  604,  598,  606,  607,  608,
+     1439, 1195,  614, 1386,  598,  609,  599,  614,  599,  943,
+      602,  600, 1298, 1379,  943,  606,  603,  608,  602,  609,
+     1298,  604, 1307,  606,  607,  608,  604, 1439, 1298, 1383,
+      607,  609,   81,   82, 1307, 1379,  134, 1379,   85,  102,
+      111,  103,  603, 1383, 1383,  137, 1386,  614,  138, 1307,
+
+      156,  159,  201, 1439,  166,  176,  200,   81,  182,  186,
+       82, 1386,  134,   85,  102,  111,  188,  943,  103,  252,
+      277,  137,  280,  287,  271,  138,  201,  156,  159,  166,
+      299,  301,  176,  200,  182,  186,  271,  310,  312,  313,
+      322,  453,  188,  252,  277,  464,  280,  381,  470,  473,
+      287,  509,  381,  535,  299,  301,  539,  560,  672,  613,
+      611,  613,  312,  310,  322,  313,  611,  453,  617,  628,
+      619,  464,  691,  647,  470,  473,  650,  509,  619,  535,
+      663,  663,  539,  560,  617,  647,  628,  650,  656,  665,
+      680,  656,  688,  692,  738,  806, 1052,  807,  691,  761,
+
+      764,  672,  688,  680,  665,  761,  764,  789,  811,  921,
+      789,  738,  880,  811,  895,  986, 1002, 1027,  895,  986,
+      692,  807,  806,  880, 1028, 1049, 1002, 1058, 1100, 1071,
+     1049, 1113, 1114, 1113, 1125, 1128,  921, 1129, 1165, 1100,
+     1173, 1052, 1071, 1027, 1198, 1125, 1149, 1204, 1028, 1114,
+     1224, 1149, 1184, 1184, 1208, 1225, 1234, 1245, 1246, 1249,
+     1173, 1248, 1128, 1129, 1208, 1250, 1248, 1253, 1254, 1255,
+     1250, 1249, 1257, 1254, 1224, 1255, 1258, 1256, 1259, 1253,
+     1256, 1259, 1225, 1260, 1058, 1262, 1261, 1262, 1264, 1264,
+     1265, 1165, 1265, 1269, 1266, 1198, 1266, 1268, 1270, 1271,
+
+     1268, 1234, 1261, 1269, 1270, 1272, 1273, 1204, 1274, 1271,
+     1245, 1246, 1277, 1280, 1282, 1281, 1272, 1257, 1284, 1258,
+     1284, 1260, 1285, 1286, 1288, 1274, 1290, 1277, 1280, 1281,
+     1288, 1291, 1292, 1286, 1295, 1290, 1293, 1296, 1296, 1285,
+     1299, 1304, 1297, 1299, 1300, 1300, 1303, 1301, 1308, 1273,
+     1301, 1293, 1305, 1306, 1309, 1306, 1295, 1282, 1297, 1310,
+     1305, 1303, 1311, 1312, 1313, 1314, 1313, 1314, 1310, 1312,
+     1309, 1315, 1317, 1315, 1291, 1292, 1316, 1316, 1319, 1320,
+     1321, 1322, 1323, 1325, 1304, 1324, 1319, 1317, 1326, 1322,
+     1331, 1308, 1332, 1327, 1335, 1321, 1334, 1334, 1325, 1336,
+
+     1311, 1323, 1324, 1327, 1326, 1337, 1344, 1338, 1332, 1341,
+     1335, 1341, 1346, 1348, 1343, 1347, 1336, 1320, 1338, 1343,
+     1345, 1337, 1349, 1350, 1351, 1352, 1345, 1346, 1331, 1354,
+     1347, 1355, 1354, 1356, 1357, 1352, 1359, 1361, 1360, 1350,
+     1362, 1357, 1363, 1349, 1363, 1368, 1359, 1355, 1369, 1344,
+     1360, 1366, 1361, 1366, 1362, 1367, 1348, 1367, 1370, 1371,
+     1372, 1371, 1372, 1373, 1370, 1375, 1374, 1351, 1374, 1381,
+     1377, 1375, 1377, 1382, 1378, 1382, 1356, 1378, 1384, 1385,
+     1385, 1387, 1388, 1368, 1389, 1393, 1369, 1390, 1390, 1384,
+     1391, 1392, 1394, 1392, 1394, 1395, 1387, 1398, 1399, 1400,
+
+     1403, 1373, 1407, 1415, 1400, 1408, 1391, 1421, 1419, 1436,
+     1429, 1395, 1381, 1432, 1431, 1444, 1445, 1462, 1470, 1496,
+     1388, 1465, 1471, 1470, 1567, 1510, 1724, 1389, 1393, 1560,
+       84,   86,   88,  104,  105,  108,  109,  112,  113,  115,
+      116,  118,  119, 1398,  120,  123, 1496,  124,  125,  128,
+     1407,  130, 1415, 1419, 1432,  132,  133,  135,  136, 1403,
+     1399, 1429, 1408,  139, 1465, 1421, 1431,  140, 1444,  141,
+      144, 1462, 1510,  146, 1436,  147, 1445, 1471,  148, 1560,
+      149,  150,  151,  153,  154,  155,  157, 1724, 1567,  158,
+      160,  161,  162,  163,  164,  165,  168,  169,  170,  171,
+
+      173,  174,  175,  178,  179,  180,  181,  183,  184,  185,
+      187,  190,  195,  202,  203,  204,  209,  210,  211,  212,
+      213,  214,  216,  217,  218,  219,  220,  222,  223,  224,
+      225,  226,  228,  229,  230,  231,  232,  234,  235,  236,
+      237,  238,  239,  240,  241,  242,  243,  244,  245,  246,
+      247,  249,  250,  251,  253,  254,  255,  256,  257,  258,
+      259,  260,  261,  262,  263,  264,  265,  266,  267,  268,
+      269,  270,  272,  273,  274,  275,  276,  278,  279,  281,
+      282,  284,  285,  286,  288,  289,  290,  291,  292,  293,
+      294,  296,  297,  298,  300,  302,  303,  304,  305,  306,
+
+      307,  308,  309,  311,  314,  319,  324,  326,  328,  329,
+      330,  331,  333,  334,  335,  336,  337,  338,  339,  340,
+      342,  343,  345,  346,  347,  348,  349,  350,  351,  352,
+      354,  355,  357,  358,  359,  361,  363,  364,  365,  366,
+      367,  370,  371,  372,  373,  374,  375,  376,  377,  378,
+      379,  380,  382,  383,  384,  386,  387,  388,  389,  390,
+      391,  392,  393,  394,  395,  444,  574,  618,  620,  621,
+      623,  624,  625,  626,  627,  629,  630,  631,  632,  633,
+      634,  635,  637,  640,  641,  642,  643,  644,  645,  646,
+      649,  652,  653,  655,  657,  659,  660,  662,  664,  666,
+
+      667,  668,  669,  670,  671,  673,  675,  676,  677,  678,
+      682,  683,  684,  685,  686,  690,  693,  694,  695,  698,
+      699,  700,  701,  702,  703,  704,  705,  706,  707,  708,
+      709,  711,  712,  713,  714,  715,  716,  717,  718,  719,
+      720,  721,  722,  723,  724,  725,  726,  727,  728,  729,
+      730,  731,  732,  733,  734,  735,  737,  739,  740,  741,
+      742,  743,  744,  745,  746,  747,  748,  749,  750,  751,
+      752,  753,  754,  755,  756,  757,  758,  759,  760,  762,
+      765,  766,  767,  768,  770,  771,  772,  773,  774,  776,
+      777,  778,  779,  780,  781,  782,  783,  784,  785,  786,
+
+      787,  788,  790,  791,  793,  794,  795,  797,  798,  799,
+      800,  802,  803,  804,  808,  809,  812,  813,  814,  815,
+      816,  817,  819,  820,  821,  822,  823,  824,  825,  826,
+      827,  828,  829,  831,  832,  833,  834,  835,  836,  837,
+      838,  839,  840,  841,  842,  843,  844,  845,  846,  847,
+      848,  849,  850,  851,  852,  853,  854,  855,  856,  858,
+      859,  860,  861,  862,  863,  864,  865,  866,  867,  868,
+      869,  870,  871,  872,  873,  874,  875,  876,  877,  878,
+      879,  881,  882,  883,  884,  885,  886,  888,  889,  890,
+      891,  892,  893,  894,  897,  898,  899,  900,  903,  904,
+
+      905,  906,  907,  908,  911,  912,  913,  914,  915,  916,
+      917,  918,  919,  920,  922,  923,  924,  926,  927,  928,
+      929,  930,  931,  932,  933,  934,  935,  936,  937,  938,
+      939,  940,  941,  942,  944,  945,  946,  947,  949,  950,
+      951,  952,  953,  954,  955,  956,  957,  958,  959,  960,
+      961,  963,  964,  965,  966,  969,  970,  971,  972,  973,
+      974,  975,  976,  977,  978,  979,  980,  981,  982,  983,
+      984,  987,  988,  989,  990,  991,  992,  993,  994,  995,
+      997,  998,  999, 1000, 1001, 1003, 1004, 1005, 1006, 1007,
+     1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017,
+
+     1018, 1019, 1020, 1021, 1022, 1023, 1024, 1029, 1030, 1031,
+     1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041,
+     1042, 1043, 1044, 1045, 1046, 1047, 1048, 1050, 1053, 1054,
+     1056, 1057, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1067,
+     1068, 1069, 1070, 1072, 1073, 1074, 1075, 1076, 1077, 1078,
+     1079, 1080, 1081, 1082, 1083, 1084, 1085, 1087, 1088, 1089,
+     1090, 1091, 1092, 1093, 1096, 1098, 1099, 1101, 1102, 1103,
+     1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1115,
+     1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1126,
+     1127, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1140,
+
+     1141, 1142, 1144, 1145, 1146, 1147, 1148, 1151, 1154, 1156,
+     1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1166, 1169,
+     1170, 1171, 1174, 1177, 1178, 1179, 1180, 1181, 1182, 1185,
+     1186, 1187, 1188, 1189, 1190, 1191, 1193, 1194, 1196, 1199,
+     1200, 1201, 1202, 1203, 1205, 1207, 1209, 1210, 1211, 1212,
+     1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222,
+     1223, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1235,
+     1236, 1237, 1238, 1239, 1240, 1242, 1243, 1244, 1252, 1342,
+     1397, 1401, 1402, 1404, 1406, 1411, 1412, 1414, 1417, 1418,
+     1422, 1423, 1424, 1425, 1426, 1427, 1428, 1430, 1433, 1434,
+
+     1435, 1437, 1438, 1441, 1442, 1443, 1446, 1448, 1449, 1451,
+     1452, 1453, 1455, 1456, 1459, 1460, 1461, 1463, 1464, 1466,
+     1467, 1468, 1469, 1474, 1475, 1476, 1477, 1478, 1479, 1480,
+     1482, 1483, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493,
+     1494, 1495, 1498, 1499, 1500, 1501, 1504, 1506, 1507, 1508,
+     1511, 1512, 1513, 1514, 1516, 1517, 1518, 1519, 1520, 1521,
+     1523, 1524, 1525, 1526, 1527, 1529, 1530, 1531, 1532, 1533,
+     1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543,
+     1544, 1545, 1546, 1547, 1548, 1549, 1551, 1552, 1553, 1554,
+     1555, 1556, 1557, 1559, 1561, 1562, 1563, 1564, 1565, 1566,
+
+     1568, 1569, 1571, 1572, 1573, 1575, 1576, 1577, 1578, 1580,
+     1584, 1585, 1586, 1587, 1588, 1589, 1591, 1592, 1593, 1594,
+     1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1604, 1605,
+     1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615,
+     1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625,
+     1627, 1628, 1629, 1630, 1631, 1634, 1636, 1637, 1638, 1641,
+     1643, 1644, 1645, 1646, 1649, 1650, 1652, 1654, 1655, 1656,
+     1658, 1659, 1660, 1661, 1662, 1664, 1665, 1666, 1667, 1668,
+     1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678,
+     1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688,
+
+     1689, 1691, 1692, 1693, 1694, 1695, 1696, 1697, 1698, 1699,
+     1700, 1702, 1705, 1706, 1707, 1709, 1712, 1713, 1714, 1715,
+     1718, 1719, 1720, 1722, 1723, 1725, 1727, 1729, 1730, 1732,
+     1733, 1734, 1735, 1736, 1737, 1738, 1741, 1742, 1743,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-      845,  846,  847,  848,  849,  850,  851,  852,  853,  854,
-      855,  856,  857,  858,  860,  861,  862,  863,  864,  852,
-      865,  866,  867,  869,  870,  871,  872,  873,  874,  875,
-      876,  877,  878,  879,  880,  881,  882,  883,  884,  885,
-      886,  887,  888,  890,  891,  892,  893,  870,  894,  895,
-      869,  896,  897,  898,  899,  901,  902,  903,  904,  905,
-      906,  908,  909,  910,  905,  911,  912,  913,  914,  915,
-      916,  917,  918,  919,  920,  921,  922,  923,  924,  925,
-      926,  927,  930,  931,  932,  934,  935,  936,  938,  939,
-      940,  926,  941,  942,  943,  944,  945,  946,  947,  948,
-
-      949,  950,  951,  952,  953,  954,  955,  957,  958,  959,
-      960,  961,  962,  963,  964,  965,  966,  905,  967,  968,
-      970,  969,  971,  972,  973,  974,  975,  976,  977,  978,
-      979,  980,  981,  982,  983,  984,  986,  987,  988,  989,
-      990,  991,  992,  993,  994,  995,  996,  968,  969,  997,
-      998,  999, 1000, 1001, 1003, 1004, 1005, 1006, 1007, 1008,
-     1004, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017,
-     1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027,
-     1028, 1029, 1030, 1031, 1033, 1034, 1035, 1036, 1037, 1038,
-     1039, 1040, 1041, 1042, 1043, 1045, 1046, 1049, 1050, 1051,
-
-     1005, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060,
-     1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070,
-     1071, 1072, 1073, 1075, 1077, 1078, 1079, 1080, 1081, 1082,
-     1083, 1084, 1085, 1086, 1062, 1087, 1088, 1089, 1090, 1091,
-     1063, 1092, 1095, 1097, 1099, 1100, 1101, 1102, 1103, 1104,
-     1105, 1106, 1107, 1108, 1109, 1110, 1112, 1113, 1114, 1116,
-     1117, 1118, 1119, 1122, 1124, 1125, 1126, 1127, 1128, 1129,
-     1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139,
-     1141, 1142, 1143, 1146, 1147, 1148, 1149, 1150, 1151, 1152,
-     1153, 1155, 1156, 1157, 1158, 1159, 1160, 1162, 1163, 1164,
-
-     1165, 1166, 1167, 1168, 1169, 1171, 1172, 1173, 1174, 1175,
-     1176, 1177, 1178, 1179, 1180, 1181, 1182, 1152, 1183, 1184,
-     1185, 1186, 1188, 1189, 1190, 1191, 1192, 1193, 1135, 1194,
-     1195, 1196, 1190, 1199, 1200, 1201, 1156, 1202, 1203, 1204,
-     1205, 1206, 1207, 1208, 1209, 1211, 1212, 1213, 1214, 1215,
-     1216, 1218, 1220, 1223, 1225, 1226, 1227, 1228, 1229, 1231,
-     1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242,
-     1243, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253,
-     1254, 1229, 1255, 1257, 1260, 1262, 1263, 1264, 1265, 1266,
-     1267, 1268, 1269, 1271, 1272, 1273, 1274, 1275, 1276, 1279,
-
-     1280, 1282, 1283, 1284, 1285, 1286, 1288, 1289, 1290, 1291,
-     1292, 1294, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303,
-     1304, 1305, 1306, 1308, 1309, 1311, 1312, 1313, 1314, 1315,
-     1316, 1317, 1318, 1318, 1319, 1320, 1321, 1322, 1323, 1296,
-     1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333,
-     1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1344,
-     1345, 1347, 1348, 1349, 1350, 1353, 1354, 1355, 1359, 1360,
-     1362, 1363, 1364, 1365, 1366, 1362, 1367, 1368, 1369, 1370,
-     1372, 1373, 1375, 1377, 1378, 1379, 1380, 1381, 1382, 1383,
-     1385, 1349, 1319, 1386, 1387, 1388, 1389, 1390, 1391, 1392,
-
-     1393, 1394, 1395, 1396, 1397, 1398, 1400, 1401, 1402, 1403,
-     1405, 1406, 1408, 1409, 1410, 1411, 1412, 1414, 1415, 1416,
-     1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427,
-     1428, 1429, 1430, 1431, 1432, 1433, 1434, 1436, 1437, 1438,
-     1440, 1442, 1444, 1445, 1446, 1447, 1448, 1449, 1451, 1452,
-     1453, 1454, 1455, 1456, 1457, 1459, 1460, 1461, 1462, 1464,
-     1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472, 1474, 1475,
-     1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485,
-     1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1498,
-     1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1509,
-
-     1510, 1511, 1512, 1513, 1514, 1515, 1517, 1519, 1521, 1524,
-     1525, 1526, 1527, 1528, 1530, 1532, 1533, 1535, 1536, 1538,
-     1539, 1540, 1542, 1543, 1544, 1546, 1548, 1549, 1550, 1551,
-     1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561,
-     1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571,
-     1572, 1573, 1574, 1575, 1577, 1578, 1579, 1580, 1581, 1585,
-     1588, 1589, 1590, 1591, 1592, 1593, 1597, 1598, 1599, 1600,
-     1602, 1603, 1605, 1606, 1607, 1608, 1609, 1611, 1612, 1615,
-     1615, 1615, 1615, 1615, 1616, 1616, 1616, 1616, 1616, 1617,
-     1623, 1617, 1617, 1617, 1618, 1624, 1618, 1625, 1618, 1619,
-
-     1619, 1619, 1619, 1619, 1620, 1620, 1620, 1620, 1620, 1621,
-     1626, 1621, 1621, 1621, 1622, 1622, 1622,  725,  724,  723,
-      722,  721,  720,  718,  717,  716,  715,  714,  713,  712,
-      711,  709,  708,  706,  705,  704,  703,  702,  701,  700,
-      699,  698,  697,  696,  695,  694,  693,  692,  691,  690,
-      689,  687,  686,  685,  684,  683,  682,  681,  680,  679,
-      678,  677,  676,  675,  674,  673,  672,  671,  670,  669,
-      668,  667,  665,  664,  663,  662,  659,  658,  657,  654,
-      653,  652,  651,  650,  649,  648,  645,  644,  643,  642,
-      641,  640,  639,  638,  637,  636,  635,  634,  633,  631,
-
-      630,  629,  628,  627,  626,  625,  624,  622,  621,  619,
-      618,  617,  616,  615,  613,  612,  611,  609,  608,  606,
-      605,  604,  603,  602,  601,  600,  599,  598,  597,  596,
-      595,  594,  592,  591,  590,  589,  588,  586,  585,  584,
-      583,  582,  581,  580,  579,  577,  576,  575,  574,  573,
-      572,  571,  570,  569,  568,  567,  566,  565,  564,  563,
-      562,  561,  560,  559,  558,  557,  556,  555,  549,  547,
-      544,  543,  541,  540,  539,  537,  533,  532,  531,  530,
-      529,  528,  527,  526,  525,  524,  523,  522,  521,  520,
-      519,  518,  517,  516,  514,  513,  512,  511,  510,  509,
-
-      508,  507,  506,  505,  504,  502,  500,  499,  498,  497,
-      496,  495,  494,  493,  492,  491,  490,  489,  487,  486,
-      485,  484,  483,  482,  481,  480,  479,  478,  477,  476,
-      475,  474,  473,  472,  471,  470,  469,  468,  467,  466,
-      465,  464,  462,  461,  460,  459,  457,  456,  455,  454,
-      453,  452,  450,  449,  447,  446,  445,  444,  442,  441,
-      440,  439,  438,  437,  436,  434,  433,  432,  427,  426,
-      424,  423,  422,  421,  420,  417,  414,  412,  411,  410,
-      409,  407,  406,  405,  404,  403,  402,  401,  400,  399,
-      398,  397,  396,  394,  393,  392,  390,  389,  388,  387,
-
-      386,  385,  383,  382,  380,  379,  378,  377,  376,  375,
-      374,  373,  372,  368,  367,  365,  364,  363,  361,  360,
-      359,  358,  357,  356,  355,  354,  353,  352,  351,  349,
-      348,  347,  346,  345,  344,  343,  342,  341,  340,  339,
-      338,  337,  335,  334,  333,  331,  328,  327,  326,  325,
-      324,  323,  322,  321,  317,  315,  312,  310,  307,  304,
-      297,  296,  295,  294,  293,  292,  290,  289,  288,  287,
-      286,  285,  284,  282,  281,  280,  279,  278,  277,  276,
-      274,  273,  272,  271,  270,  269,  268,  267,  266,  265,
-      264,  263,  262,  261,  259,  258,  257,  255,  254,  253,
-
-      252,  251,  249,  248,  247,  246,  245,  244,  243,  242,
-      241,  239,  238,  237,  236,  235,  234,  233,  232,  231,
-      230,  229,  228,  227,  226,  225,  224,  223,  222,  221,
-      220,  219,  218,  217,  215,  214,  213,  212,  211,  209,
-      206,  204,  202,  200,  199,  194,  193,  189,  181,  180,
-      179,  178,  177,  176,  174,  173,  172,  171,  170,  169,
-      167,  165,  164,  163,  161,  160,  158,  157,  156,  155,
-      154,  152,  151,  150,  149,  148,  146,  145,  144,  143,
-      142,  141,  140,  138,  137,  135,  134,  130,  129,  128,
-      126,  125,  124,  122,  121,  120,  116,  110,  106,  105,
-
-      104,   98,   97,   78,   73,   67,   50,   49,   48,   43,
-       41,   39,   38,   24,   14,   11, 1614, 1614, 1614, 1614,
-     1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614,
-     1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614,
-     1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614,
-     1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614,
-     1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614,
-     1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614,
-     1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614
+        0,    0,    0,    0,    0,    0
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1764,28 +2162,30 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[190] =
+static const flex_int16_t yy_rule_linenum[199] =
     {   0,
       149,  151,  153,  158,  159,  164,  165,  166,  178,  181,
       186,  193,  202,  211,  220,  229,  238,  247,  256,  265,
       274,  283,  292,  301,  310,  320,  330,  340,  350,  360,
-      370,  380,  389,  399,  409,  419,  429,  438,  447,  456,
-      465,  474,  483,  492,  501,  510,  519,  528,  537,  546,
-      555,  568,  577,  586,  595,  604,  615,  626,  637,  648,
-      660,  671,  682,  693,  704,  715,  726,  737,  748,  759,
-      770,  781,  792,  803,  814,  825,  836,  847,  858,  869,
-      878,  887,  897,  906,  915,  930,  946,  955,  964,  973,
-      982,  991, 1000, 1009, 1018, 1027, 1036, 1058, 1080, 1089,
-
-     1099, 1109, 1118, 1128, 1139, 1148, 1157, 1166, 1175, 1184,
-     1194, 1203, 1212, 1221, 1232, 1243, 1254, 1263, 1273, 1282,
-     1291, 1300, 1309, 1319, 1328, 1337, 1347, 1359, 1372, 1381,
-     1390, 1400, 1410, 1419, 1430, 1440, 1449, 1459, 1469, 1478,
-     1487, 1496, 1505, 1515, 1524, 1534, 1543, 1552, 1561, 1570,
-     1579, 1588, 1597, 1606, 1615, 1624, 1633, 1642, 1651, 1660,
-     1669, 1678, 1687, 1696, 1705, 1714, 1723, 1732, 1741, 1750,
-     1759, 1769, 1868, 1873, 1878, 1883, 1884, 1885, 1886, 1887,
-     1888, 1890, 1908, 1921, 1926, 1930, 1932, 1934, 1936
+      370,  380,  390,  399,  409,  419,  429,  439,  448,  457,
+      466,  475,  484,  493,  502,  511,  520,  529,  538,  547,
+      556,  565,  574,  587,  596,  605,  614,  623,  634,  645,
+      656,  667,  679,  690,  701,  712,  723,  734,  745,  756,
+      767,  778,  789,  800,  811,  822,  833,  844,  855,  866,
+      877,  888,  899,  908,  917,  927,  936,  945,  960,  976,
+      985,  994, 1003, 1012, 1021, 1030, 1039, 1048, 1057, 1066,
+
+     1088, 1110, 1119, 1129, 1139, 1148, 1158, 1169, 1178, 1187,
+     1196, 1205, 1214, 1224, 1233, 1242, 1251, 1262, 1273, 1284,
+     1295, 1304, 1313, 1322, 1331, 1341, 1350, 1359, 1368, 1377,
+     1386, 1395, 1405, 1414, 1423, 1433, 1445, 1458, 1467, 1476,
+     1486, 1496, 1505, 1516, 1526, 1535, 1545, 1555, 1564, 1573,
+     1582, 1591, 1601, 1610, 1620, 1629, 1638, 1647, 1656, 1665,
+     1674, 1683, 1692, 1701, 1710, 1719, 1728, 1737, 1746, 1755,
+     1764, 1773, 1782, 1791, 1800, 1809, 1818, 1827, 1836, 1845,
+     1855, 1954, 1959, 1964, 1969, 1970, 1971, 1972, 1973, 1974,
+     1976, 1994, 2007, 2012, 2016, 2018, 2020, 2022
+
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1838,7 +2238,7 @@ using namespace isc::dhcp;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::dhcp::Parser6Context::fatal(msg)
-#line 1841 "dhcp6_lexer.cc"
+#line 2241 "dhcp6_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1864,8 +2264,8 @@ using namespace isc::dhcp;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1867 "dhcp6_lexer.cc"
-#line 1868 "dhcp6_lexer.cc"
+#line 2267 "dhcp6_lexer.cc"
+#line 2268 "dhcp6_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -2197,7 +2597,7 @@ YY_DECL
     }
 
 
-#line 2200 "dhcp6_lexer.cc"
+#line 2600 "dhcp6_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -2226,13 +2626,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1615 )
+				if ( yy_current_state >= 1746 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 1614 );
+		while ( yy_current_state != 1745 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -2251,13 +2651,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 190 )
+			else if ( yy_act < 199 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], yytext );
-			else if ( yy_act == 190 )
+			else if ( yy_act == 199 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         yytext );
-			else if ( yy_act == 191 )
+			else if ( yy_act == 200 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -2587,8 +2987,8 @@ YY_RULE_SETUP
 #line 360 "dhcp6_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
-    if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
-        return isc::dhcp::Dhcp6Parser::make_WHEN_PRESENT(driver.loc_);
+    if (driver.ctx_ == isc::dhcp::Parser6Context::NCR_FORMAT) {
+        return isc::dhcp::Dhcp6Parser::make_BINARY(driver.loc_);
     }
     std::string tmp(yytext+1);
     tmp.resize(tmp.size() - 1);
@@ -2611,6 +3011,19 @@ YY_RULE_SETUP
 case 32:
 YY_RULE_SETUP
 #line 380 "dhcp6_lexer.ll"
+{
+    /* dhcp-ddns value keywords are case insensitive */
+    if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
+        return isc::dhcp::Dhcp6Parser::make_WHEN_PRESENT(driver.loc_);
+    }
+    std::string tmp(yytext+1);
+    tmp.resize(tmp.size() - 1);
+    return isc::dhcp::Dhcp6Parser::make_STRING(tmp, driver.loc_);
+}
+	YY_BREAK
+case 33:
+YY_RULE_SETUP
+#line 390 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME:
@@ -2620,9 +3033,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 33:
+case 34:
 YY_RULE_SETUP
-#line 389 "dhcp6_lexer.ll"
+#line 399 "dhcp6_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
@@ -2633,9 +3046,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 34:
+case 35:
 YY_RULE_SETUP
-#line 399 "dhcp6_lexer.ll"
+#line 409 "dhcp6_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
@@ -2646,9 +3059,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 35:
+case 36:
 YY_RULE_SETUP
-#line 409 "dhcp6_lexer.ll"
+#line 419 "dhcp6_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
@@ -2659,9 +3072,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 36:
+case 37:
 YY_RULE_SETUP
-#line 419 "dhcp6_lexer.ll"
+#line 429 "dhcp6_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
@@ -2672,9 +3085,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 37:
+case 38:
 YY_RULE_SETUP
-#line 429 "dhcp6_lexer.ll"
+#line 439 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -2684,9 +3097,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 38:
+case 39:
 YY_RULE_SETUP
-#line 438 "dhcp6_lexer.ll"
+#line 448 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2696,9 +3109,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 39:
+case 40:
 YY_RULE_SETUP
-#line 447 "dhcp6_lexer.ll"
+#line 457 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2708,9 +3121,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 40:
+case 41:
 YY_RULE_SETUP
-#line 456 "dhcp6_lexer.ll"
+#line 466 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::INTERFACES_CONFIG:
@@ -2720,9 +3133,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 41:
+case 42:
 YY_RULE_SETUP
-#line 465 "dhcp6_lexer.ll"
+#line 475 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::INTERFACES_CONFIG:
@@ -2732,9 +3145,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 42:
+case 43:
 YY_RULE_SETUP
-#line 474 "dhcp6_lexer.ll"
+#line 484 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2744,9 +3157,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 43:
+case 44:
 YY_RULE_SETUP
-#line 483 "dhcp6_lexer.ll"
+#line 493 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SANITY_CHECKS:
@@ -2756,9 +3169,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 44:
+case 45:
 YY_RULE_SETUP
-#line 492 "dhcp6_lexer.ll"
+#line 502 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2768,9 +3181,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 45:
+case 46:
 YY_RULE_SETUP
-#line 501 "dhcp6_lexer.ll"
+#line 511 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2780,9 +3193,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 46:
+case 47:
 YY_RULE_SETUP
-#line 510 "dhcp6_lexer.ll"
+#line 520 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2792,9 +3205,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 47:
+case 48:
 YY_RULE_SETUP
-#line 519 "dhcp6_lexer.ll"
+#line 529 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2804,9 +3217,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 48:
+case 49:
 YY_RULE_SETUP
-#line 528 "dhcp6_lexer.ll"
+#line 538 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG_CONTROL:
@@ -2816,9 +3229,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 49:
+case 50:
 YY_RULE_SETUP
-#line 537 "dhcp6_lexer.ll"
+#line 547 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG_CONTROL:
@@ -2828,9 +3241,21 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 50:
+case 51:
+YY_RULE_SETUP
+#line 556 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::CONFIG_CONTROL:
+        return isc::dhcp::Dhcp6Parser::make_NOTIFY_FIFO(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("notify-fifo", driver.loc_);
+    }
+}
+	YY_BREAK
+case 52:
 YY_RULE_SETUP
-#line 546 "dhcp6_lexer.ll"
+#line 565 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOSTS_DATABASE:
@@ -2840,9 +3265,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 51:
+case 53:
 YY_RULE_SETUP
-#line 555 "dhcp6_lexer.ll"
+#line 574 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2856,9 +3281,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 52:
+case 54:
 YY_RULE_SETUP
-#line 568 "dhcp6_lexer.ll"
+#line 587 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DATABASE_TYPE:
@@ -2868,9 +3293,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 53:
+case 55:
 YY_RULE_SETUP
-#line 577 "dhcp6_lexer.ll"
+#line 596 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DATABASE_TYPE:
@@ -2880,9 +3305,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 54:
+case 56:
 YY_RULE_SETUP
-#line 586 "dhcp6_lexer.ll"
+#line 605 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DATABASE_TYPE:
@@ -2892,9 +3317,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 55:
+case 57:
 YY_RULE_SETUP
-#line 595 "dhcp6_lexer.ll"
+#line 614 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DATABASE_TYPE:
@@ -2904,9 +3329,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 56:
+case 58:
 YY_RULE_SETUP
-#line 604 "dhcp6_lexer.ll"
+#line 623 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2918,9 +3343,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 57:
+case 59:
 YY_RULE_SETUP
-#line 615 "dhcp6_lexer.ll"
+#line 634 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2932,9 +3357,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 58:
+case 60:
 YY_RULE_SETUP
-#line 626 "dhcp6_lexer.ll"
+#line 645 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2946,9 +3371,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 59:
+case 61:
 YY_RULE_SETUP
-#line 637 "dhcp6_lexer.ll"
+#line 656 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2960,9 +3385,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 60:
+case 62:
 YY_RULE_SETUP
-#line 648 "dhcp6_lexer.ll"
+#line 667 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2975,9 +3400,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 61:
+case 63:
 YY_RULE_SETUP
-#line 660 "dhcp6_lexer.ll"
+#line 679 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2989,9 +3414,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 62:
+case 64:
 YY_RULE_SETUP
-#line 671 "dhcp6_lexer.ll"
+#line 690 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3003,9 +3428,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 63:
+case 65:
 YY_RULE_SETUP
-#line 682 "dhcp6_lexer.ll"
+#line 701 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3017,9 +3442,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 64:
+case 66:
 YY_RULE_SETUP
-#line 693 "dhcp6_lexer.ll"
+#line 712 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3031,9 +3456,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 65:
+case 67:
 YY_RULE_SETUP
-#line 704 "dhcp6_lexer.ll"
+#line 723 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3045,9 +3470,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 66:
+case 68:
 YY_RULE_SETUP
-#line 715 "dhcp6_lexer.ll"
+#line 734 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3059,9 +3484,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 67:
+case 69:
 YY_RULE_SETUP
-#line 726 "dhcp6_lexer.ll"
+#line 745 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3073,9 +3498,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 68:
+case 70:
 YY_RULE_SETUP
-#line 737 "dhcp6_lexer.ll"
+#line 756 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3087,9 +3512,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 69:
+case 71:
 YY_RULE_SETUP
-#line 748 "dhcp6_lexer.ll"
+#line 767 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3101,9 +3526,23 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 70:
+case 72:
 YY_RULE_SETUP
-#line 759 "dhcp6_lexer.ll"
+#line 778 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+    case isc::dhcp::Parser6Context::HOSTS_DATABASE:
+    case isc::dhcp::Parser6Context::CONFIG_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_POOL_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("pool-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 73:
+YY_RULE_SETUP
+#line 789 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3115,9 +3554,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 71:
+case 74:
 YY_RULE_SETUP
-#line 770 "dhcp6_lexer.ll"
+#line 800 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3129,9 +3568,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 72:
+case 75:
 YY_RULE_SETUP
-#line 781 "dhcp6_lexer.ll"
+#line 811 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3143,9 +3582,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 73:
+case 76:
 YY_RULE_SETUP
-#line 792 "dhcp6_lexer.ll"
+#line 822 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3157,9 +3596,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 74:
+case 77:
 YY_RULE_SETUP
-#line 803 "dhcp6_lexer.ll"
+#line 833 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3171,9 +3610,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 75:
+case 78:
 YY_RULE_SETUP
-#line 814 "dhcp6_lexer.ll"
+#line 844 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3185,9 +3624,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 76:
+case 79:
 YY_RULE_SETUP
-#line 825 "dhcp6_lexer.ll"
+#line 855 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3199,9 +3638,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 77:
+case 80:
 YY_RULE_SETUP
-#line 836 "dhcp6_lexer.ll"
+#line 866 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3213,9 +3652,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 78:
+case 81:
 YY_RULE_SETUP
-#line 847 "dhcp6_lexer.ll"
+#line 877 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3227,9 +3666,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 79:
+case 82:
 YY_RULE_SETUP
-#line 858 "dhcp6_lexer.ll"
+#line 888 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3241,9 +3680,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 80:
+case 83:
 YY_RULE_SETUP
-#line 869 "dhcp6_lexer.ll"
+#line 899 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3253,9 +3692,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 81:
+case 84:
 YY_RULE_SETUP
-#line 878 "dhcp6_lexer.ll"
+#line 908 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3265,9 +3704,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 82:
+case 85:
 YY_RULE_SETUP
-#line 887 "dhcp6_lexer.ll"
+#line 917 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3278,9 +3717,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 83:
+case 86:
 YY_RULE_SETUP
-#line 897 "dhcp6_lexer.ll"
+#line 927 "dhcp6_lexer.ll"
 {
     switch (driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3290,9 +3729,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 84:
+case 87:
 YY_RULE_SETUP
-#line 906 "dhcp6_lexer.ll"
+#line 936 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3302,9 +3741,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 85:
+case 88:
 YY_RULE_SETUP
-#line 915 "dhcp6_lexer.ll"
+#line 945 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3320,9 +3759,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 86:
+case 89:
 YY_RULE_SETUP
-#line 930 "dhcp6_lexer.ll"
+#line 960 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3339,9 +3778,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 87:
+case 90:
 YY_RULE_SETUP
-#line 946 "dhcp6_lexer.ll"
+#line 976 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -3351,9 +3790,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 88:
+case 91:
 YY_RULE_SETUP
-#line 955 "dhcp6_lexer.ll"
+#line 985 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -3363,9 +3802,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 89:
+case 92:
 YY_RULE_SETUP
-#line 964 "dhcp6_lexer.ll"
+#line 994 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3375,9 +3814,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 90:
+case 93:
 YY_RULE_SETUP
-#line 973 "dhcp6_lexer.ll"
+#line 1003 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3387,9 +3826,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 91:
+case 94:
 YY_RULE_SETUP
-#line 982 "dhcp6_lexer.ll"
+#line 1012 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3399,9 +3838,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 92:
+case 95:
 YY_RULE_SETUP
-#line 991 "dhcp6_lexer.ll"
+#line 1021 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3411,9 +3850,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 93:
+case 96:
 YY_RULE_SETUP
-#line 1000 "dhcp6_lexer.ll"
+#line 1030 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3423,9 +3862,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 94:
+case 97:
 YY_RULE_SETUP
-#line 1009 "dhcp6_lexer.ll"
+#line 1039 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3435,9 +3874,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 95:
+case 98:
 YY_RULE_SETUP
-#line 1018 "dhcp6_lexer.ll"
+#line 1048 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3447,9 +3886,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 96:
+case 99:
 YY_RULE_SETUP
-#line 1027 "dhcp6_lexer.ll"
+#line 1057 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::POOLS:
@@ -3459,9 +3898,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 97:
+case 100:
 YY_RULE_SETUP
-#line 1036 "dhcp6_lexer.ll"
+#line 1066 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3484,9 +3923,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 98:
+case 101:
 YY_RULE_SETUP
-#line 1058 "dhcp6_lexer.ll"
+#line 1088 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3509,9 +3948,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 99:
+case 102:
 YY_RULE_SETUP
-#line 1080 "dhcp6_lexer.ll"
+#line 1110 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3521,9 +3960,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 100:
+case 103:
 YY_RULE_SETUP
-#line 1089 "dhcp6_lexer.ll"
+#line 1119 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3534,9 +3973,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 101:
+case 104:
 YY_RULE_SETUP
-#line 1099 "dhcp6_lexer.ll"
+#line 1129 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3547,9 +3986,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 102:
+case 105:
 YY_RULE_SETUP
-#line 1109 "dhcp6_lexer.ll"
+#line 1139 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3559,9 +3998,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 103:
+case 106:
 YY_RULE_SETUP
-#line 1118 "dhcp6_lexer.ll"
+#line 1148 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3572,9 +4011,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 104:
+case 107:
 YY_RULE_SETUP
-#line 1128 "dhcp6_lexer.ll"
+#line 1158 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3586,9 +4025,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 105:
+case 108:
 YY_RULE_SETUP
-#line 1139 "dhcp6_lexer.ll"
+#line 1169 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3598,9 +4037,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 106:
+case 109:
 YY_RULE_SETUP
-#line 1148 "dhcp6_lexer.ll"
+#line 1178 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3610,9 +4049,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 107:
+case 110:
 YY_RULE_SETUP
-#line 1157 "dhcp6_lexer.ll"
+#line 1187 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3622,9 +4061,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 108:
+case 111:
 YY_RULE_SETUP
-#line 1166 "dhcp6_lexer.ll"
+#line 1196 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3634,9 +4073,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 109:
+case 112:
 YY_RULE_SETUP
-#line 1175 "dhcp6_lexer.ll"
+#line 1205 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3646,9 +4085,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 110:
+case 113:
 YY_RULE_SETUP
-#line 1184 "dhcp6_lexer.ll"
+#line 1214 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3659,9 +4098,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 111:
+case 114:
 YY_RULE_SETUP
-#line 1194 "dhcp6_lexer.ll"
+#line 1224 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3671,9 +4110,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 112:
+case 115:
 YY_RULE_SETUP
-#line 1203 "dhcp6_lexer.ll"
+#line 1233 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3683,9 +4122,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 113:
+case 116:
 YY_RULE_SETUP
-#line 1212 "dhcp6_lexer.ll"
+#line 1242 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3695,9 +4134,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 114:
+case 117:
 YY_RULE_SETUP
-#line 1221 "dhcp6_lexer.ll"
+#line 1251 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3709,9 +4148,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 115:
+case 118:
 YY_RULE_SETUP
-#line 1232 "dhcp6_lexer.ll"
+#line 1262 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3723,9 +4162,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 116:
+case 119:
 YY_RULE_SETUP
-#line 1243 "dhcp6_lexer.ll"
+#line 1273 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3737,9 +4176,59 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 117:
+case 120:
+YY_RULE_SETUP
+#line 1284 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::DHCP6:
+    case isc::dhcp::Parser6Context::SUBNET6:
+    case isc::dhcp::Parser6Context::SHARED_NETWORK:
+        return isc::dhcp::Dhcp6Parser::make_CACHE_THRESHOLD(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("cache-threshold", driver.loc_);
+    }
+}
+	YY_BREAK
+case 121:
+YY_RULE_SETUP
+#line 1295 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::DHCP6:
+        return isc::dhcp::Dhcp6Parser::make_PACKET_ARENA_CHUNK_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("packet-arena-chunk-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 122:
+YY_RULE_SETUP
+#line 1304 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::DHCP6:
+        return isc::dhcp::Dhcp6Parser::make_PACKET_SLOW_THRESHOLD(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("packet-slow-threshold", driver.loc_);
+    }
+}
+	YY_BREAK
+case 123:
 YY_RULE_SETUP
-#line 1254 "dhcp6_lexer.ll"
+#line 1313 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::DHCP6:
+        return isc::dhcp::Dhcp6Parser::make_HOST_FILTER_REBUILD_INTERVAL(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("host-filter-rebuild-interval", driver.loc_);
+    }
+}
+	YY_BREAK
+case 124:
+YY_RULE_SETUP
+#line 1322 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -3749,9 +4238,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 118:
+case 125:
 YY_RULE_SETUP
-#line 1263 "dhcp6_lexer.ll"
+#line 1331 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3762,9 +4251,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 119:
+case 126:
 YY_RULE_SETUP
-#line 1273 "dhcp6_lexer.ll"
+#line 1341 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -3774,9 +4263,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 120:
+case 127:
 YY_RULE_SETUP
-#line 1282 "dhcp6_lexer.ll"
+#line 1350 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -3786,9 +4275,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 121:
+case 128:
 YY_RULE_SETUP
-#line 1291 "dhcp6_lexer.ll"
+#line 1359 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -3798,9 +4287,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 122:
+case 129:
 YY_RULE_SETUP
-#line 1300 "dhcp6_lexer.ll"
+#line 1368 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -3810,9 +4299,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 123:
+case 130:
 YY_RULE_SETUP
-#line 1309 "dhcp6_lexer.ll"
+#line 1377 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -3822,9 +4311,33 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 124:
+case 131:
+YY_RULE_SETUP
+#line 1386 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp6Parser::make_ASYNC(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("async", driver.loc_);
+    }
+}
+	YY_BREAK
+case 132:
+YY_RULE_SETUP
+#line 1395 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp6Parser::make_ASYNC_QUEUE_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("async-queue-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 133:
 YY_RULE_SETUP
-#line 1319 "dhcp6_lexer.ll"
+#line 1405 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -3834,9 +4347,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 125:
+case 134:
 YY_RULE_SETUP
-#line 1328 "dhcp6_lexer.ll"
+#line 1414 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -3846,9 +4359,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 126:
+case 135:
 YY_RULE_SETUP
-#line 1337 "dhcp6_lexer.ll"
+#line 1423 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3859,9 +4372,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 127:
+case 136:
 YY_RULE_SETUP
-#line 1347 "dhcp6_lexer.ll"
+#line 1433 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3874,9 +4387,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 128:
+case 137:
 YY_RULE_SETUP
-#line 1359 "dhcp6_lexer.ll"
+#line 1445 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3890,9 +4403,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 129:
+case 138:
 YY_RULE_SETUP
-#line 1372 "dhcp6_lexer.ll"
+#line 1458 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CLIENT_CLASSES:
@@ -3902,9 +4415,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 130:
+case 139:
 YY_RULE_SETUP
-#line 1381 "dhcp6_lexer.ll"
+#line 1467 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CLIENT_CLASSES:
@@ -3914,9 +4427,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 131:
+case 140:
 YY_RULE_SETUP
-#line 1390 "dhcp6_lexer.ll"
+#line 1476 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3927,9 +4440,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 132:
+case 141:
 YY_RULE_SETUP
-#line 1400 "dhcp6_lexer.ll"
+#line 1486 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -3940,9 +4453,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 133:
+case 142:
 YY_RULE_SETUP
-#line 1410 "dhcp6_lexer.ll"
+#line 1496 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -3952,9 +4465,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 134:
+case 143:
 YY_RULE_SETUP
-#line 1419 "dhcp6_lexer.ll"
+#line 1505 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::MAC_SOURCES:
@@ -3966,9 +4479,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 135:
+case 144:
 YY_RULE_SETUP
-#line 1430 "dhcp6_lexer.ll"
+#line 1516 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3979,9 +4492,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 136:
+case 145:
 YY_RULE_SETUP
-#line 1440 "dhcp6_lexer.ll"
+#line 1526 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -3991,9 +4504,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 137:
+case 146:
 YY_RULE_SETUP
-#line 1449 "dhcp6_lexer.ll"
+#line 1535 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOST_RESERVATION_IDENTIFIERS:
@@ -4004,9 +4517,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 138:
+case 147:
 YY_RULE_SETUP
-#line 1459 "dhcp6_lexer.ll"
+#line 1545 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -4017,9 +4530,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 139:
+case 148:
 YY_RULE_SETUP
-#line 1469 "dhcp6_lexer.ll"
+#line 1555 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -4029,9 +4542,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 140:
+case 149:
 YY_RULE_SETUP
-#line 1478 "dhcp6_lexer.ll"
+#line 1564 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -4041,9 +4554,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 141:
+case 150:
 YY_RULE_SETUP
-#line 1487 "dhcp6_lexer.ll"
+#line 1573 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -4053,9 +4566,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 142:
+case 151:
 YY_RULE_SETUP
-#line 1496 "dhcp6_lexer.ll"
+#line 1582 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -4065,9 +4578,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 143:
+case 152:
 YY_RULE_SETUP
-#line 1505 "dhcp6_lexer.ll"
+#line 1591 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -4078,9 +4591,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 144:
+case 153:
 YY_RULE_SETUP
-#line 1515 "dhcp6_lexer.ll"
+#line 1601 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RELAY:
@@ -4090,9 +4603,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 145:
+case 154:
 YY_RULE_SETUP
-#line 1524 "dhcp6_lexer.ll"
+#line 1610 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4102,9 +4615,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 146:
+case 155:
 YY_RULE_SETUP
-#line 1534 "dhcp6_lexer.ll"
+#line 1620 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -4114,9 +4627,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 147:
+case 156:
 YY_RULE_SETUP
-#line 1543 "dhcp6_lexer.ll"
+#line 1629 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -4126,9 +4639,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 148:
+case 157:
 YY_RULE_SETUP
-#line 1552 "dhcp6_lexer.ll"
+#line 1638 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4138,9 +4651,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 149:
+case 158:
 YY_RULE_SETUP
-#line 1561 "dhcp6_lexer.ll"
+#line 1647 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -4150,9 +4663,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 150:
+case 159:
 YY_RULE_SETUP
-#line 1570 "dhcp6_lexer.ll"
+#line 1656 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -4162,9 +4675,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 151:
+case 160:
 YY_RULE_SETUP
-#line 1579 "dhcp6_lexer.ll"
+#line 1665 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -4174,9 +4687,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 152:
+case 161:
 YY_RULE_SETUP
-#line 1588 "dhcp6_lexer.ll"
+#line 1674 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -4186,9 +4699,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 153:
+case 162:
 YY_RULE_SETUP
-#line 1597 "dhcp6_lexer.ll"
+#line 1683 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -4198,9 +4711,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 154:
+case 163:
 YY_RULE_SETUP
-#line 1606 "dhcp6_lexer.ll"
+#line 1692 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -4210,9 +4723,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 155:
+case 164:
 YY_RULE_SETUP
-#line 1615 "dhcp6_lexer.ll"
+#line 1701 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -4222,9 +4735,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 156:
+case 165:
 YY_RULE_SETUP
-#line 1624 "dhcp6_lexer.ll"
+#line 1710 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4234,9 +4747,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 157:
+case 166:
 YY_RULE_SETUP
-#line 1633 "dhcp6_lexer.ll"
+#line 1719 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4246,9 +4759,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 158:
+case 167:
 YY_RULE_SETUP
-#line 1642 "dhcp6_lexer.ll"
+#line 1728 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4258,9 +4771,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 159:
+case 168:
 YY_RULE_SETUP
-#line 1651 "dhcp6_lexer.ll"
+#line 1737 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4270,9 +4783,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 160:
+case 169:
 YY_RULE_SETUP
-#line 1660 "dhcp6_lexer.ll"
+#line 1746 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4282,9 +4795,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 161:
+case 170:
 YY_RULE_SETUP
-#line 1669 "dhcp6_lexer.ll"
+#line 1755 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4294,9 +4807,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 162:
+case 171:
 YY_RULE_SETUP
-#line 1678 "dhcp6_lexer.ll"
+#line 1764 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4306,9 +4819,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 163:
+case 172:
 YY_RULE_SETUP
-#line 1687 "dhcp6_lexer.ll"
+#line 1773 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4318,9 +4831,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 164:
+case 173:
 YY_RULE_SETUP
-#line 1696 "dhcp6_lexer.ll"
+#line 1782 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4330,9 +4843,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 165:
+case 174:
 YY_RULE_SETUP
-#line 1705 "dhcp6_lexer.ll"
+#line 1791 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONTROL_SOCKET:
@@ -4342,9 +4855,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 166:
+case 175:
 YY_RULE_SETUP
-#line 1714 "dhcp6_lexer.ll"
+#line 1800 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONTROL_SOCKET:
@@ -4354,9 +4867,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 167:
+case 176:
 YY_RULE_SETUP
-#line 1723 "dhcp6_lexer.ll"
+#line 1809 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4366,9 +4879,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 168:
+case 177:
 YY_RULE_SETUP
-#line 1732 "dhcp6_lexer.ll"
+#line 1818 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4378,9 +4891,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 169:
+case 178:
 YY_RULE_SETUP
-#line 1741 "dhcp6_lexer.ll"
+#line 1827 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -4390,9 +4903,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 170:
+case 179:
 YY_RULE_SETUP
-#line 1750 "dhcp6_lexer.ll"
+#line 1836 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -4402,9 +4915,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 171:
+case 180:
 YY_RULE_SETUP
-#line 1759 "dhcp6_lexer.ll"
+#line 1845 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -4414,9 +4927,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 172:
+case 181:
 YY_RULE_SETUP
-#line 1769 "dhcp6_lexer.ll"
+#line 1855 "dhcp6_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -4516,65 +5029,65 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 173:
-/* rule 173 can match eol */
+case 182:
+/* rule 182 can match eol */
 YY_RULE_SETUP
-#line 1868 "dhcp6_lexer.ll"
+#line 1954 "dhcp6_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 174:
-/* rule 174 can match eol */
+case 183:
+/* rule 183 can match eol */
 YY_RULE_SETUP
-#line 1873 "dhcp6_lexer.ll"
+#line 1959 "dhcp6_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 175:
+case 184:
 YY_RULE_SETUP
-#line 1878 "dhcp6_lexer.ll"
+#line 1964 "dhcp6_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 176:
+case 185:
 YY_RULE_SETUP
-#line 1883 "dhcp6_lexer.ll"
+#line 1969 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 177:
+case 186:
 YY_RULE_SETUP
-#line 1884 "dhcp6_lexer.ll"
+#line 1970 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 178:
+case 187:
 YY_RULE_SETUP
-#line 1885 "dhcp6_lexer.ll"
+#line 1971 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 179:
+case 188:
 YY_RULE_SETUP
-#line 1886 "dhcp6_lexer.ll"
+#line 1972 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 180:
+case 189:
 YY_RULE_SETUP
-#line 1887 "dhcp6_lexer.ll"
+#line 1973 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 181:
+case 190:
 YY_RULE_SETUP
-#line 1888 "dhcp6_lexer.ll"
+#line 1974 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 182:
+case 191:
 YY_RULE_SETUP
-#line 1890 "dhcp6_lexer.ll"
+#line 1976 "dhcp6_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -4593,9 +5106,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 183:
+case 192:
 YY_RULE_SETUP
-#line 1908 "dhcp6_lexer.ll"
+#line 1994 "dhcp6_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -4609,43 +5122,43 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 184:
+case 193:
 YY_RULE_SETUP
-#line 1921 "dhcp6_lexer.ll"
+#line 2007 "dhcp6_lexer.ll"
 {
     string tmp(yytext);
     return isc::dhcp::Dhcp6Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 185:
+case 194:
 YY_RULE_SETUP
-#line 1926 "dhcp6_lexer.ll"
+#line 2012 "dhcp6_lexer.ll"
 {
    return isc::dhcp::Dhcp6Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 186:
+case 195:
 YY_RULE_SETUP
-#line 1930 "dhcp6_lexer.ll"
+#line 2016 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 187:
+case 196:
 YY_RULE_SETUP
-#line 1932 "dhcp6_lexer.ll"
+#line 2018 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 188:
+case 197:
 YY_RULE_SETUP
-#line 1934 "dhcp6_lexer.ll"
+#line 2020 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 189:
+case 198:
 YY_RULE_SETUP
-#line 1936 "dhcp6_lexer.ll"
+#line 2022 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 1938 "dhcp6_lexer.ll"
+#line 2024 "dhcp6_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::dhcp::Dhcp6Parser::make_END(driver.loc_);
@@ -4669,12 +5182,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 190:
+case 199:
 YY_RULE_SETUP
-#line 1961 "dhcp6_lexer.ll"
+#line 2047 "dhcp6_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 4677 "dhcp6_lexer.cc"
+#line 5190 "dhcp6_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -4993,7 +5506,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1615 )
+			if ( yy_current_state >= 1746 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -5026,11 +5539,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1615 )
+		if ( yy_current_state >= 1746 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 1614);
+	yy_is_jam = (yy_current_state == 1745);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -5779,8 +6292,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 1961 "dhcp6_lexer.ll"
-
+#line 2047 "dhcp6_lexer.ll"
 
 using namespace isc::dhcp;
 
@@ -17,6 +17,7 @@ extern const isc::log::MessageID DHCP6_BUFFER_UNPACK;
 extern const isc::log::MessageID DHCP6_BUFFER_WAIT_SIGNAL;
 extern const isc::log::MessageID DHCP6_CB_FETCH_UPDATES_FAIL;
 extern const isc::log::MessageID DHCP6_CB_FETCH_UPDATES_RETRIES_EXHAUSTED;
+extern const isc::log::MessageID DHCP6_CB_NOTIFY_FIFO_FAIL;
 extern const isc::log::MessageID DHCP6_CLASS_ASSIGNED;
 extern const isc::log::MessageID DHCP6_CLASS_UNCONFIGURED;
 extern const isc::log::MessageID DHCP6_CLASS_UNDEFINED;
@@ -101,6 +102,7 @@ extern const isc::log::MessageID DHCP6_PACKET_RECEIVED;
 extern const isc::log::MessageID DHCP6_PACKET_RECEIVE_FAIL;
 extern const isc::log::MessageID DHCP6_PACKET_SEND;
 extern const isc::log::MessageID DHCP6_PACKET_SEND_FAIL;
+extern const isc::log::MessageID DHCP6_PACKET_SLOW;
 extern const isc::log::MessageID DHCP6_PACK_FAIL;
 extern const isc::log::MessageID DHCP6_PARSER_COMMIT_EXCEPTION;
 extern const isc::log::MessageID DHCP6_PARSER_COMMIT_FAIL;
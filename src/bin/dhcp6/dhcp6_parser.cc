@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.4.1.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015, 2018-2019 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,8 +30,9 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
-// Undocumented macros, especially those whose name start with YY_,
-// are private implementation details.  Do not rely on them.
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
 
 
 // Take the name prefix into account.
@@ -47,7 +48,7 @@
 
 #include <dhcp6/parser_context.h>
 
-#line 51 "dhcp6_parser.cc"
+#line 52 "dhcp6_parser.cc"
 
 
 #ifndef YY_
@@ -62,6 +63,7 @@
 # endif
 #endif
 
+
 // Whether we are compiled with exception support.
 #ifndef YY_EXCEPTIONS
 # if defined __GNUC__ && !defined __EXCEPTIONS
@@ -92,9 +94,6 @@
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if PARSER6_DEBUG
 
@@ -120,13 +119,13 @@
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !PARSER6_DEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE (Symbol)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
 # define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
 # define YY_STACK_PRINT()                static_cast<void> (0)
 
@@ -142,56 +141,15 @@
 
 #line 14 "dhcp6_parser.yy"
 namespace isc { namespace dhcp {
-#line 146 "dhcp6_parser.cc"
-
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  Dhcp6Parser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr;
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              else
-                goto append;
-
-            append:
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 145 "dhcp6_parser.cc"
 
   /// Build a parser object.
   Dhcp6Parser::Dhcp6Parser (isc::dhcp::Parser6Context& ctx_yyarg)
-    :
 #if PARSER6_DEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       ctx (ctx_yyarg)
   {}
@@ -202,9 +160,9 @@ namespace isc { namespace dhcp {
   Dhcp6Parser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
   {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
@@ -234,13 +192,13 @@ namespace isc { namespace dhcp {
     : state (s)
   {}
 
-  Dhcp6Parser::symbol_number_type
-  Dhcp6Parser::by_state::type_get () const YY_NOEXCEPT
+  Dhcp6Parser::symbol_kind_type
+  Dhcp6Parser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
   Dhcp6Parser::stack_symbol_type::stack_symbol_type ()
@@ -249,31 +207,32 @@ namespace isc { namespace dhcp {
   Dhcp6Parser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
     : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
   {
-    switch (that.type_get ())
-    {
-      case 202: // value
-      case 206: // map_value
-      case 267: // db_type
-      case 360: // hr_mode
-      case 496: // duid_type
-      case 531: // ncr_protocol_value
-      case 538: // replace_client_name_value
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 184: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
         break;
 
-      case 183: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
         break;
 
-      case 182: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 181: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
         break;
 
@@ -290,31 +249,32 @@ namespace isc { namespace dhcp {
   Dhcp6Parser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
     : super_type (s, YY_MOVE (that.location))
   {
-    switch (that.type_get ())
-    {
-      case 202: // value
-      case 206: // map_value
-      case 267: // db_type
-      case 360: // hr_mode
-      case 496: // duid_type
-      case 531: // ncr_protocol_value
-      case 538: // replace_client_name_value
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 184: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 183: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 182: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 181: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (YY_MOVE (that.value));
         break;
 
@@ -323,39 +283,81 @@ namespace isc { namespace dhcp {
     }
 
     // that is emptied.
-    that.type = empty_symbol;
+    that.kind_ = symbol_kind::S_YYEMPTY;
   }
 
 #if YY_CPLUSPLUS < 201103L
+  Dhcp6Parser::stack_symbol_type&
+  Dhcp6Parser::stack_symbol_type::operator= (const stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.copy< ElementPtr > (that.value);
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.copy< bool > (that.value);
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.copy< double > (that.value);
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.copy< int64_t > (that.value);
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.copy< std::string > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    return *this;
+  }
+
   Dhcp6Parser::stack_symbol_type&
   Dhcp6Parser::stack_symbol_type::operator= (stack_symbol_type& that)
   {
     state = that.state;
-    switch (that.type_get ())
-    {
-      case 202: // value
-      case 206: // map_value
-      case 267: // db_type
-      case 360: // hr_mode
-      case 496: // duid_type
-      case 531: // ncr_protocol_value
-      case 538: // replace_client_name_value
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 184: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 183: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 182: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 181: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -381,93 +383,97 @@ namespace isc { namespace dhcp {
 #if PARSER6_DEBUG
   template <typename Base>
   void
-  Dhcp6Parser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  Dhcp6Parser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-#if defined __GNUC__ && ! defined __clang__ && ! defined __ICC && __GNUC__ * 100 + __GNUC_MINOR__ <= 408
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-#endif
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    switch (yytype)
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        switch (yykind)
     {
-      case 181: // "constant string"
-#line 260 "dhcp6_parser.yy"
-        { yyoutput << yysym.value.template as < std::string > (); }
-#line 405 "dhcp6_parser.cc"
+      case symbol_kind::S_STRING: // "constant string"
+#line 270 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < std::string > (); }
+#line 404 "dhcp6_parser.cc"
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+#line 270 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < int64_t > (); }
+#line 410 "dhcp6_parser.cc"
         break;
 
-      case 182: // "integer"
-#line 260 "dhcp6_parser.yy"
-        { yyoutput << yysym.value.template as < int64_t > (); }
-#line 411 "dhcp6_parser.cc"
+      case symbol_kind::S_FLOAT: // "floating point"
+#line 270 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < double > (); }
+#line 416 "dhcp6_parser.cc"
         break;
 
-      case 183: // "floating point"
-#line 260 "dhcp6_parser.yy"
-        { yyoutput << yysym.value.template as < double > (); }
-#line 417 "dhcp6_parser.cc"
+      case symbol_kind::S_BOOLEAN: // "boolean"
+#line 270 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < bool > (); }
+#line 422 "dhcp6_parser.cc"
         break;
 
-      case 184: // "boolean"
-#line 260 "dhcp6_parser.yy"
-        { yyoutput << yysym.value.template as < bool > (); }
-#line 423 "dhcp6_parser.cc"
+      case symbol_kind::S_value: // value
+#line 270 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 428 "dhcp6_parser.cc"
         break;
 
-      case 202: // value
-#line 260 "dhcp6_parser.yy"
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 429 "dhcp6_parser.cc"
+      case symbol_kind::S_map_value: // map_value
+#line 270 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 434 "dhcp6_parser.cc"
         break;
 
-      case 206: // map_value
-#line 260 "dhcp6_parser.yy"
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 435 "dhcp6_parser.cc"
+      case symbol_kind::S_db_type: // db_type
+#line 270 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 440 "dhcp6_parser.cc"
         break;
 
-      case 267: // db_type
-#line 260 "dhcp6_parser.yy"
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 441 "dhcp6_parser.cc"
+      case symbol_kind::S_hr_mode: // hr_mode
+#line 270 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 446 "dhcp6_parser.cc"
         break;
 
-      case 360: // hr_mode
-#line 260 "dhcp6_parser.yy"
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 447 "dhcp6_parser.cc"
+      case symbol_kind::S_duid_type: // duid_type
+#line 270 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 452 "dhcp6_parser.cc"
         break;
 
-      case 496: // duid_type
-#line 260 "dhcp6_parser.yy"
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 453 "dhcp6_parser.cc"
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+#line 270 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 458 "dhcp6_parser.cc"
         break;
 
-      case 531: // ncr_protocol_value
-#line 260 "dhcp6_parser.yy"
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 459 "dhcp6_parser.cc"
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+#line 270 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 464 "dhcp6_parser.cc"
         break;
 
-      case 538: // replace_client_name_value
-#line 260 "dhcp6_parser.yy"
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 465 "dhcp6_parser.cc"
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+#line 270 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 470 "dhcp6_parser.cc"
         break;
 
       default:
         break;
     }
-    yyo << ')';
+        yyo << ')';
+      }
   }
 #endif
 
@@ -491,7 +497,7 @@ namespace isc { namespace dhcp {
   }
 
   void
-  Dhcp6Parser::yypop_ (int n)
+  Dhcp6Parser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -526,21 +532,21 @@ namespace isc { namespace dhcp {
   Dhcp6Parser::state_type
   Dhcp6Parser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
   bool
-  Dhcp6Parser::yy_pact_value_is_default_ (int yyvalue)
+  Dhcp6Parser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
   bool
-  Dhcp6Parser::yy_table_value_is_error_ (int yyvalue)
+  Dhcp6Parser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
@@ -554,7 +560,6 @@ namespace isc { namespace dhcp {
   int
   Dhcp6Parser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -590,7 +595,8 @@ namespace isc { namespace dhcp {
   | yynewstate -- push a new symbol on the stack.  |
   `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << '\n';
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
@@ -604,14 +610,14 @@ namespace isc { namespace dhcp {
   `-----------*/
   yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
 #if YY_EXCEPTIONS
         try
 #endif // YY_EXCEPTIONS
@@ -630,11 +636,23 @@ namespace isc { namespace dhcp {
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -651,7 +669,7 @@ namespace isc { namespace dhcp {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, YY_MOVE (yyla));
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
 
@@ -659,7 +677,7 @@ namespace isc { namespace dhcp {
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
@@ -678,29 +696,30 @@ namespace isc { namespace dhcp {
          when using variants.  */
       switch (yyr1_[yyn])
     {
-      case 202: // value
-      case 206: // map_value
-      case 267: // db_type
-      case 360: // hr_mode
-      case 496: // duid_type
-      case 531: // ncr_protocol_value
-      case 538: // replace_client_name_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 184: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         yylhs.value.emplace< bool > ();
         break;
 
-      case 183: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         yylhs.value.emplace< double > ();
         break;
 
-      case 182: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         yylhs.value.emplace< int64_t > ();
         break;
 
-      case 181: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         yylhs.value.emplace< std::string > ();
         break;
 
@@ -724,288 +743,288 @@ namespace isc { namespace dhcp {
         {
           switch (yyn)
             {
-  case 2:
-#line 269 "dhcp6_parser.yy"
-    { ctx.ctx_ = ctx.NO_KEYWORD; }
-#line 731 "dhcp6_parser.cc"
+  case 2: // $@1: %empty
+#line 279 "dhcp6_parser.yy"
+                     { ctx.ctx_ = ctx.NO_KEYWORD; }
+#line 750 "dhcp6_parser.cc"
     break;
 
-  case 4:
-#line 270 "dhcp6_parser.yy"
-    { ctx.ctx_ = ctx.CONFIG; }
-#line 737 "dhcp6_parser.cc"
+  case 4: // $@2: %empty
+#line 280 "dhcp6_parser.yy"
+                      { ctx.ctx_ = ctx.CONFIG; }
+#line 756 "dhcp6_parser.cc"
     break;
 
-  case 6:
-#line 271 "dhcp6_parser.yy"
-    { ctx.ctx_ = ctx.DHCP6; }
-#line 743 "dhcp6_parser.cc"
+  case 6: // $@3: %empty
+#line 281 "dhcp6_parser.yy"
+                 { ctx.ctx_ = ctx.DHCP6; }
+#line 762 "dhcp6_parser.cc"
     break;
 
-  case 8:
-#line 272 "dhcp6_parser.yy"
-    { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
-#line 749 "dhcp6_parser.cc"
+  case 8: // $@4: %empty
+#line 282 "dhcp6_parser.yy"
+                       { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
+#line 768 "dhcp6_parser.cc"
     break;
 
-  case 10:
-#line 273 "dhcp6_parser.yy"
-    { ctx.ctx_ = ctx.SUBNET6; }
-#line 755 "dhcp6_parser.cc"
+  case 10: // $@5: %empty
+#line 283 "dhcp6_parser.yy"
+                   { ctx.ctx_ = ctx.SUBNET6; }
+#line 774 "dhcp6_parser.cc"
     break;
 
-  case 12:
-#line 274 "dhcp6_parser.yy"
-    { ctx.ctx_ = ctx.POOLS; }
-#line 761 "dhcp6_parser.cc"
+  case 12: // $@6: %empty
+#line 284 "dhcp6_parser.yy"
+                 { ctx.ctx_ = ctx.POOLS; }
+#line 780 "dhcp6_parser.cc"
     break;
 
-  case 14:
-#line 275 "dhcp6_parser.yy"
-    { ctx.ctx_ = ctx.PD_POOLS; }
-#line 767 "dhcp6_parser.cc"
+  case 14: // $@7: %empty
+#line 285 "dhcp6_parser.yy"
+                   { ctx.ctx_ = ctx.PD_POOLS; }
+#line 786 "dhcp6_parser.cc"
     break;
 
-  case 16:
-#line 276 "dhcp6_parser.yy"
-    { ctx.ctx_ = ctx.RESERVATIONS; }
-#line 773 "dhcp6_parser.cc"
+  case 16: // $@8: %empty
+#line 286 "dhcp6_parser.yy"
+                       { ctx.ctx_ = ctx.RESERVATIONS; }
+#line 792 "dhcp6_parser.cc"
     break;
 
-  case 18:
-#line 277 "dhcp6_parser.yy"
-    { ctx.ctx_ = ctx.DHCP6; }
-#line 779 "dhcp6_parser.cc"
+  case 18: // $@9: %empty
+#line 287 "dhcp6_parser.yy"
+                       { ctx.ctx_ = ctx.DHCP6; }
+#line 798 "dhcp6_parser.cc"
     break;
 
-  case 20:
-#line 278 "dhcp6_parser.yy"
-    { ctx.ctx_ = ctx.OPTION_DEF; }
-#line 785 "dhcp6_parser.cc"
+  case 20: // $@10: %empty
+#line 288 "dhcp6_parser.yy"
+                      { ctx.ctx_ = ctx.OPTION_DEF; }
+#line 804 "dhcp6_parser.cc"
     break;
 
-  case 22:
-#line 279 "dhcp6_parser.yy"
-    { ctx.ctx_ = ctx.OPTION_DATA; }
-#line 791 "dhcp6_parser.cc"
+  case 22: // $@11: %empty
+#line 289 "dhcp6_parser.yy"
+                       { ctx.ctx_ = ctx.OPTION_DATA; }
+#line 810 "dhcp6_parser.cc"
     break;
 
-  case 24:
-#line 280 "dhcp6_parser.yy"
-    { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
-#line 797 "dhcp6_parser.cc"
+  case 24: // $@12: %empty
+#line 290 "dhcp6_parser.yy"
+                         { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
+#line 816 "dhcp6_parser.cc"
     break;
 
-  case 26:
-#line 281 "dhcp6_parser.yy"
-    { ctx.ctx_ = ctx.DHCP_DDNS; }
-#line 803 "dhcp6_parser.cc"
+  case 26: // $@13: %empty
+#line 291 "dhcp6_parser.yy"
+                     { ctx.ctx_ = ctx.DHCP_DDNS; }
+#line 822 "dhcp6_parser.cc"
     break;
 
-  case 28:
-#line 282 "dhcp6_parser.yy"
-    { ctx.ctx_ = ctx.LOGGING; }
-#line 809 "dhcp6_parser.cc"
+  case 28: // $@14: %empty
+#line 292 "dhcp6_parser.yy"
+                   { ctx.ctx_ = ctx.LOGGING; }
+#line 828 "dhcp6_parser.cc"
     break;
 
-  case 30:
-#line 283 "dhcp6_parser.yy"
-    { ctx.ctx_ = ctx.CONFIG_CONTROL; }
-#line 815 "dhcp6_parser.cc"
+  case 30: // $@15: %empty
+#line 293 "dhcp6_parser.yy"
+                          { ctx.ctx_ = ctx.CONFIG_CONTROL; }
+#line 834 "dhcp6_parser.cc"
     break;
 
-  case 32:
-#line 291 "dhcp6_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
-#line 821 "dhcp6_parser.cc"
+  case 32: // value: "integer"
+#line 301 "dhcp6_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
+#line 840 "dhcp6_parser.cc"
     break;
 
-  case 33:
-#line 292 "dhcp6_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
-#line 827 "dhcp6_parser.cc"
+  case 33: // value: "floating point"
+#line 302 "dhcp6_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
+#line 846 "dhcp6_parser.cc"
     break;
 
-  case 34:
-#line 293 "dhcp6_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
-#line 833 "dhcp6_parser.cc"
+  case 34: // value: "boolean"
+#line 303 "dhcp6_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
+#line 852 "dhcp6_parser.cc"
     break;
 
-  case 35:
-#line 294 "dhcp6_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
-#line 839 "dhcp6_parser.cc"
+  case 35: // value: "constant string"
+#line 304 "dhcp6_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
+#line 858 "dhcp6_parser.cc"
     break;
 
-  case 36:
-#line 295 "dhcp6_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
-#line 845 "dhcp6_parser.cc"
+  case 36: // value: "null"
+#line 305 "dhcp6_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
+#line 864 "dhcp6_parser.cc"
     break;
 
-  case 37:
-#line 296 "dhcp6_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 851 "dhcp6_parser.cc"
+  case 37: // value: map2
+#line 306 "dhcp6_parser.yy"
+            { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 870 "dhcp6_parser.cc"
     break;
 
-  case 38:
-#line 297 "dhcp6_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 857 "dhcp6_parser.cc"
+  case 38: // value: list_generic
+#line 307 "dhcp6_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 876 "dhcp6_parser.cc"
     break;
 
-  case 39:
-#line 300 "dhcp6_parser.yy"
-    {
+  case 39: // sub_json: value
+#line 310 "dhcp6_parser.yy"
+                {
     // Push back the JSON value on the stack
     ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
 }
-#line 866 "dhcp6_parser.cc"
+#line 885 "dhcp6_parser.cc"
     break;
 
-  case 40:
-#line 305 "dhcp6_parser.yy"
-    {
+  case 40: // $@16: %empty
+#line 315 "dhcp6_parser.yy"
+                     {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 877 "dhcp6_parser.cc"
+#line 896 "dhcp6_parser.cc"
     break;
 
-  case 41:
-#line 310 "dhcp6_parser.yy"
-    {
+  case 41: // map2: "{" $@16 map_content "}"
+#line 320 "dhcp6_parser.yy"
+                             {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 887 "dhcp6_parser.cc"
+#line 906 "dhcp6_parser.cc"
     break;
 
-  case 42:
-#line 316 "dhcp6_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 893 "dhcp6_parser.cc"
+  case 42: // map_value: map2
+#line 326 "dhcp6_parser.yy"
+                { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 912 "dhcp6_parser.cc"
     break;
 
-  case 45:
-#line 323 "dhcp6_parser.yy"
-    {
+  case 45: // not_empty_map: "constant string" ":" value
+#line 333 "dhcp6_parser.yy"
+                                  {
                   // map containing a single entry
                   ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 902 "dhcp6_parser.cc"
+#line 921 "dhcp6_parser.cc"
     break;
 
-  case 46:
-#line 327 "dhcp6_parser.yy"
-    {
+  case 46: // not_empty_map: not_empty_map "," "constant string" ":" value
+#line 337 "dhcp6_parser.yy"
+                                                      {
                   // map consisting of a shorter map followed by
                   // comma and string:value
                   ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 912 "dhcp6_parser.cc"
+#line 931 "dhcp6_parser.cc"
     break;
 
-  case 47:
-#line 334 "dhcp6_parser.yy"
-    {
+  case 47: // $@17: %empty
+#line 344 "dhcp6_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 921 "dhcp6_parser.cc"
+#line 940 "dhcp6_parser.cc"
     break;
 
-  case 48:
-#line 337 "dhcp6_parser.yy"
-    {
+  case 48: // list_generic: "[" $@17 list_content "]"
+#line 347 "dhcp6_parser.yy"
+                               {
     // list parsing complete. Put any sanity checking here
 }
-#line 929 "dhcp6_parser.cc"
+#line 948 "dhcp6_parser.cc"
     break;
 
-  case 51:
-#line 345 "dhcp6_parser.yy"
-    {
+  case 51: // not_empty_list: value
+#line 355 "dhcp6_parser.yy"
+                      {
                   // List consisting of a single element.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 938 "dhcp6_parser.cc"
+#line 957 "dhcp6_parser.cc"
     break;
 
-  case 52:
-#line 349 "dhcp6_parser.yy"
-    {
+  case 52: // not_empty_list: not_empty_list "," value
+#line 359 "dhcp6_parser.yy"
+                                           {
                   // List ending with , and a value.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 947 "dhcp6_parser.cc"
+#line 966 "dhcp6_parser.cc"
     break;
 
-  case 53:
-#line 356 "dhcp6_parser.yy"
-    {
+  case 53: // $@18: %empty
+#line 366 "dhcp6_parser.yy"
+                              {
     // List parsing about to start
 }
-#line 955 "dhcp6_parser.cc"
+#line 974 "dhcp6_parser.cc"
     break;
 
-  case 54:
-#line 358 "dhcp6_parser.yy"
-    {
+  case 54: // list_strings: "[" $@18 list_strings_content "]"
+#line 368 "dhcp6_parser.yy"
+                                       {
     // list parsing complete. Put any sanity checking here
     //ctx.stack_.pop_back();
 }
-#line 964 "dhcp6_parser.cc"
+#line 983 "dhcp6_parser.cc"
     break;
 
-  case 57:
-#line 367 "dhcp6_parser.yy"
-    {
+  case 57: // not_empty_list_strings: "constant string"
+#line 377 "dhcp6_parser.yy"
+                               {
                           ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
                           }
-#line 973 "dhcp6_parser.cc"
+#line 992 "dhcp6_parser.cc"
     break;
 
-  case 58:
-#line 371 "dhcp6_parser.yy"
-    {
+  case 58: // not_empty_list_strings: not_empty_list_strings "," "constant string"
+#line 381 "dhcp6_parser.yy"
+                                                            {
                           ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
                           }
-#line 982 "dhcp6_parser.cc"
+#line 1001 "dhcp6_parser.cc"
     break;
 
-  case 59:
-#line 382 "dhcp6_parser.yy"
-    {
+  case 59: // unknown_map_entry: "constant string" ":"
+#line 392 "dhcp6_parser.yy"
+                                {
     const std::string& where = ctx.contextName();
     const std::string& keyword = yystack_[1].value.as < std::string > ();
     error(yystack_[1].location,
           "got unexpected keyword \"" + keyword + "\" in " + where + " map.");
 }
-#line 993 "dhcp6_parser.cc"
+#line 1012 "dhcp6_parser.cc"
     break;
 
-  case 60:
-#line 392 "dhcp6_parser.yy"
-    {
+  case 60: // $@19: %empty
+#line 402 "dhcp6_parser.yy"
+                           {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1004 "dhcp6_parser.cc"
+#line 1023 "dhcp6_parser.cc"
     break;
 
-  case 61:
-#line 397 "dhcp6_parser.yy"
-    {
+  case 61: // syntax_map: "{" $@19 global_objects "}"
+#line 407 "dhcp6_parser.yy"
+                                {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
@@ -1013,12 +1032,12 @@ namespace isc { namespace dhcp {
     // Dhcp6 is required
     ctx.require("Dhcp6", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
 }
-#line 1017 "dhcp6_parser.cc"
+#line 1036 "dhcp6_parser.cc"
     break;
 
-  case 70:
-#line 420 "dhcp6_parser.yy"
-    {
+  case 70: // $@20: %empty
+#line 430 "dhcp6_parser.yy"
+                    {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -1026,641 +1045,686 @@ namespace isc { namespace dhcp {
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP6);
 }
-#line 1030 "dhcp6_parser.cc"
+#line 1049 "dhcp6_parser.cc"
     break;
 
-  case 71:
-#line 427 "dhcp6_parser.yy"
-    {
+  case 71: // dhcp6_object: "Dhcp6" $@20 ":" "{" global_params "}"
+#line 437 "dhcp6_parser.yy"
+                                                    {
     // No global parameter is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1040 "dhcp6_parser.cc"
+#line 1059 "dhcp6_parser.cc"
     break;
 
-  case 72:
-#line 435 "dhcp6_parser.yy"
-    {
+  case 72: // $@21: %empty
+#line 445 "dhcp6_parser.yy"
+                          {
     // Parse the Dhcp6 map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1050 "dhcp6_parser.cc"
+#line 1069 "dhcp6_parser.cc"
     break;
 
-  case 73:
-#line 439 "dhcp6_parser.yy"
-    {
+  case 73: // sub_dhcp6: "{" $@21 global_params "}"
+#line 449 "dhcp6_parser.yy"
+                               {
     // No global parameter is required
     // parsing completed
 }
-#line 1059 "dhcp6_parser.cc"
+#line 1078 "dhcp6_parser.cc"
     break;
 
-  case 119:
-#line 495 "dhcp6_parser.yy"
-    {
+  case 123: // $@22: %empty
+#line 509 "dhcp6_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1067 "dhcp6_parser.cc"
+#line 1086 "dhcp6_parser.cc"
     break;
 
-  case 120:
-#line 497 "dhcp6_parser.yy"
-    {
+  case 124: // data_directory: "data-directory" $@22 ":" "constant string"
+#line 511 "dhcp6_parser.yy"
+               {
     ElementPtr datadir(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data-directory", datadir);
     ctx.leave();
 }
-#line 1077 "dhcp6_parser.cc"
+#line 1096 "dhcp6_parser.cc"
     break;
 
-  case 121:
-#line 503 "dhcp6_parser.yy"
-    {
+  case 125: // preferred_lifetime: "preferred-lifetime" ":" "integer"
+#line 517 "dhcp6_parser.yy"
+                                                     {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("preferred-lifetime", prf);
 }
-#line 1086 "dhcp6_parser.cc"
+#line 1105 "dhcp6_parser.cc"
     break;
 
-  case 122:
-#line 508 "dhcp6_parser.yy"
-    {
+  case 126: // min_preferred_lifetime: "min-preferred-lifetime" ":" "integer"
+#line 522 "dhcp6_parser.yy"
+                                                             {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("min-preferred-lifetime", prf);
 }
-#line 1095 "dhcp6_parser.cc"
+#line 1114 "dhcp6_parser.cc"
     break;
 
-  case 123:
-#line 513 "dhcp6_parser.yy"
-    {
+  case 127: // max_preferred_lifetime: "max-preferred-lifetime" ":" "integer"
+#line 527 "dhcp6_parser.yy"
+                                                             {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-preferred-lifetime", prf);
 }
-#line 1104 "dhcp6_parser.cc"
+#line 1123 "dhcp6_parser.cc"
     break;
 
-  case 124:
-#line 518 "dhcp6_parser.yy"
-    {
+  case 128: // valid_lifetime: "valid-lifetime" ":" "integer"
+#line 532 "dhcp6_parser.yy"
+                                             {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("valid-lifetime", prf);
 }
-#line 1113 "dhcp6_parser.cc"
+#line 1132 "dhcp6_parser.cc"
     break;
 
-  case 125:
-#line 523 "dhcp6_parser.yy"
-    {
+  case 129: // min_valid_lifetime: "min-valid-lifetime" ":" "integer"
+#line 537 "dhcp6_parser.yy"
+                                                     {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("min-valid-lifetime", prf);
 }
-#line 1122 "dhcp6_parser.cc"
+#line 1141 "dhcp6_parser.cc"
     break;
 
-  case 126:
-#line 528 "dhcp6_parser.yy"
-    {
+  case 130: // max_valid_lifetime: "max-valid-lifetime" ":" "integer"
+#line 542 "dhcp6_parser.yy"
+                                                     {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-valid-lifetime", prf);
 }
-#line 1131 "dhcp6_parser.cc"
+#line 1150 "dhcp6_parser.cc"
     break;
 
-  case 127:
-#line 533 "dhcp6_parser.yy"
-    {
+  case 131: // renew_timer: "renew-timer" ":" "integer"
+#line 547 "dhcp6_parser.yy"
+                                       {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("renew-timer", prf);
 }
-#line 1140 "dhcp6_parser.cc"
+#line 1159 "dhcp6_parser.cc"
     break;
 
-  case 128:
-#line 538 "dhcp6_parser.yy"
-    {
+  case 132: // rebind_timer: "rebind-timer" ":" "integer"
+#line 552 "dhcp6_parser.yy"
+                                         {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rebind-timer", prf);
 }
-#line 1149 "dhcp6_parser.cc"
+#line 1168 "dhcp6_parser.cc"
     break;
 
-  case 129:
-#line 543 "dhcp6_parser.yy"
-    {
+  case 133: // calculate_tee_times: "calculate-tee-times" ":" "boolean"
+#line 557 "dhcp6_parser.yy"
+                                                       {
     ElementPtr ctt(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("calculate-tee-times", ctt);
 }
-#line 1158 "dhcp6_parser.cc"
+#line 1177 "dhcp6_parser.cc"
     break;
 
-  case 130:
-#line 548 "dhcp6_parser.yy"
-    {
+  case 134: // t1_percent: "t1-percent" ":" "floating point"
+#line 562 "dhcp6_parser.yy"
+                                   {
     ElementPtr t1(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("t1-percent", t1);
 }
-#line 1167 "dhcp6_parser.cc"
+#line 1186 "dhcp6_parser.cc"
     break;
 
-  case 131:
-#line 553 "dhcp6_parser.yy"
-    {
+  case 135: // t2_percent: "t2-percent" ":" "floating point"
+#line 567 "dhcp6_parser.yy"
+                                   {
     ElementPtr t2(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("t2-percent", t2);
 }
-#line 1176 "dhcp6_parser.cc"
+#line 1195 "dhcp6_parser.cc"
     break;
 
-  case 132:
-#line 558 "dhcp6_parser.yy"
-    {
+  case 136: // cache_threshold: "cache-threshold" ":" "floating point"
+#line 572 "dhcp6_parser.yy"
+                                             {
+    ElementPtr ct(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("cache-threshold", ct);
+}
+#line 1204 "dhcp6_parser.cc"
+    break;
+
+  case 137: // packet_arena_chunk_size: "packet-arena-chunk-size" ":" "integer"
+#line 577 "dhcp6_parser.yy"
+                                                               {
+    ElementPtr pacs(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("packet-arena-chunk-size", pacs);
+}
+#line 1213 "dhcp6_parser.cc"
+    break;
+
+  case 138: // packet_slow_threshold: "packet-slow-threshold" ":" "integer"
+#line 582 "dhcp6_parser.yy"
+                                                           {
+    ElementPtr pst(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("packet-slow-threshold", pst);
+}
+#line 1222 "dhcp6_parser.cc"
+    break;
+
+  case 139: // host_filter_rebuild_interval: "host-filter-rebuild-interval" ":" "integer"
+#line 587 "dhcp6_parser.yy"
+                                                                         {
+    ElementPtr hfri(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("host-filter-rebuild-interval", hfri);
+}
+#line 1231 "dhcp6_parser.cc"
+    break;
+
+  case 140: // decline_probation_period: "decline-probation-period" ":" "integer"
+#line 592 "dhcp6_parser.yy"
+                                                                 {
     ElementPtr dpp(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("decline-probation-period", dpp);
 }
-#line 1185 "dhcp6_parser.cc"
+#line 1240 "dhcp6_parser.cc"
     break;
 
-  case 133:
-#line 563 "dhcp6_parser.yy"
-    {
+  case 141: // $@23: %empty
+#line 597 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1193 "dhcp6_parser.cc"
+#line 1248 "dhcp6_parser.cc"
     break;
 
-  case 134:
-#line 565 "dhcp6_parser.yy"
-    {
+  case 142: // server_tag: "server-tag" $@23 ":" "constant string"
+#line 599 "dhcp6_parser.yy"
+               {
     ElementPtr stag(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-tag", stag);
     ctx.leave();
 }
-#line 1203 "dhcp6_parser.cc"
+#line 1258 "dhcp6_parser.cc"
     break;
 
-  case 135:
-#line 571 "dhcp6_parser.yy"
-    {
+  case 143: // $@24: %empty
+#line 605 "dhcp6_parser.yy"
+                                     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces-config", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.INTERFACES_CONFIG);
 }
-#line 1214 "dhcp6_parser.cc"
+#line 1269 "dhcp6_parser.cc"
     break;
 
-  case 136:
-#line 576 "dhcp6_parser.yy"
-    {
+  case 144: // interfaces_config: "interfaces-config" $@24 ":" "{" interfaces_config_params "}"
+#line 610 "dhcp6_parser.yy"
+                                                               {
     // No interfaces config param is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1224 "dhcp6_parser.cc"
+#line 1279 "dhcp6_parser.cc"
     break;
 
-  case 137:
-#line 582 "dhcp6_parser.yy"
-    {
+  case 145: // $@25: %empty
+#line 616 "dhcp6_parser.yy"
+                                {
     // Parse the interfaces-config map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1234 "dhcp6_parser.cc"
+#line 1289 "dhcp6_parser.cc"
     break;
 
-  case 138:
-#line 586 "dhcp6_parser.yy"
-    {
+  case 146: // sub_interfaces6: "{" $@25 interfaces_config_params "}"
+#line 620 "dhcp6_parser.yy"
+                                          {
     // No interfaces config param is required
     // parsing completed
 }
-#line 1243 "dhcp6_parser.cc"
+#line 1298 "dhcp6_parser.cc"
     break;
 
-  case 146:
-#line 602 "dhcp6_parser.yy"
-    {
+  case 154: // $@26: %empty
+#line 636 "dhcp6_parser.yy"
+                            {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1254 "dhcp6_parser.cc"
+#line 1309 "dhcp6_parser.cc"
     break;
 
-  case 147:
-#line 607 "dhcp6_parser.yy"
-    {
+  case 155: // interfaces_list: "interfaces" $@26 ":" list_strings
+#line 641 "dhcp6_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1263 "dhcp6_parser.cc"
+#line 1318 "dhcp6_parser.cc"
     break;
 
-  case 148:
-#line 612 "dhcp6_parser.yy"
-    {
+  case 156: // re_detect: "re-detect" ":" "boolean"
+#line 646 "dhcp6_parser.yy"
+                                   {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("re-detect", b);
 }
-#line 1272 "dhcp6_parser.cc"
+#line 1327 "dhcp6_parser.cc"
     break;
 
-  case 149:
-#line 618 "dhcp6_parser.yy"
-    {
+  case 157: // $@27: %empty
+#line 652 "dhcp6_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lease-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.LEASE_DATABASE);
 }
-#line 1283 "dhcp6_parser.cc"
+#line 1338 "dhcp6_parser.cc"
     break;
 
-  case 150:
-#line 623 "dhcp6_parser.yy"
-    {
+  case 158: // lease_database: "lease-database" $@27 ":" "{" database_map_params "}"
+#line 657 "dhcp6_parser.yy"
+                                                          {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1294 "dhcp6_parser.cc"
+#line 1349 "dhcp6_parser.cc"
     break;
 
-  case 151:
-#line 630 "dhcp6_parser.yy"
-    {
+  case 159: // $@28: %empty
+#line 664 "dhcp6_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1305 "dhcp6_parser.cc"
+#line 1360 "dhcp6_parser.cc"
     break;
 
-  case 152:
-#line 635 "dhcp6_parser.yy"
-    {
+  case 160: // hosts_database: "hosts-database" $@28 ":" "{" database_map_params "}"
+#line 669 "dhcp6_parser.yy"
+                                                          {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1316 "dhcp6_parser.cc"
+#line 1371 "dhcp6_parser.cc"
     break;
 
-  case 153:
-#line 642 "dhcp6_parser.yy"
-    {
+  case 161: // $@29: %empty
+#line 676 "dhcp6_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-databases", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1327 "dhcp6_parser.cc"
+#line 1382 "dhcp6_parser.cc"
     break;
 
-  case 154:
-#line 647 "dhcp6_parser.yy"
-    {
+  case 162: // hosts_databases: "hosts-databases" $@29 ":" "[" database_list "]"
+#line 681 "dhcp6_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1336 "dhcp6_parser.cc"
+#line 1391 "dhcp6_parser.cc"
     break;
 
-  case 159:
-#line 660 "dhcp6_parser.yy"
-    {
+  case 167: // $@30: %empty
+#line 694 "dhcp6_parser.yy"
+                         {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1346 "dhcp6_parser.cc"
+#line 1401 "dhcp6_parser.cc"
     break;
 
-  case 160:
-#line 664 "dhcp6_parser.yy"
-    {
+  case 168: // database: "{" $@30 database_map_params "}"
+#line 698 "dhcp6_parser.yy"
+                                     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1356 "dhcp6_parser.cc"
+#line 1411 "dhcp6_parser.cc"
     break;
 
-  case 183:
-#line 696 "dhcp6_parser.yy"
-    {
+  case 192: // $@31: %empty
+#line 731 "dhcp6_parser.yy"
+                    {
     ctx.enter(ctx.DATABASE_TYPE);
 }
-#line 1364 "dhcp6_parser.cc"
+#line 1419 "dhcp6_parser.cc"
     break;
 
-  case 184:
-#line 698 "dhcp6_parser.yy"
-    {
+  case 193: // database_type: "type" $@31 ":" db_type
+#line 733 "dhcp6_parser.yy"
+                {
     ctx.stack_.back()->set("type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1373 "dhcp6_parser.cc"
+#line 1428 "dhcp6_parser.cc"
     break;
 
-  case 185:
-#line 703 "dhcp6_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
-#line 1379 "dhcp6_parser.cc"
+  case 194: // db_type: "memfile"
+#line 738 "dhcp6_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
+#line 1434 "dhcp6_parser.cc"
     break;
 
-  case 186:
-#line 704 "dhcp6_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
-#line 1385 "dhcp6_parser.cc"
+  case 195: // db_type: "mysql"
+#line 739 "dhcp6_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
+#line 1440 "dhcp6_parser.cc"
     break;
 
-  case 187:
-#line 705 "dhcp6_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
-#line 1391 "dhcp6_parser.cc"
+  case 196: // db_type: "postgresql"
+#line 740 "dhcp6_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
+#line 1446 "dhcp6_parser.cc"
     break;
 
-  case 188:
-#line 706 "dhcp6_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
-#line 1397 "dhcp6_parser.cc"
+  case 197: // db_type: "cql"
+#line 741 "dhcp6_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
+#line 1452 "dhcp6_parser.cc"
     break;
 
-  case 189:
-#line 709 "dhcp6_parser.yy"
-    {
+  case 198: // $@32: %empty
+#line 744 "dhcp6_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1405 "dhcp6_parser.cc"
+#line 1460 "dhcp6_parser.cc"
     break;
 
-  case 190:
-#line 711 "dhcp6_parser.yy"
-    {
+  case 199: // user: "user" $@32 ":" "constant string"
+#line 746 "dhcp6_parser.yy"
+               {
     ElementPtr user(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("user", user);
     ctx.leave();
 }
-#line 1415 "dhcp6_parser.cc"
+#line 1470 "dhcp6_parser.cc"
     break;
 
-  case 191:
-#line 717 "dhcp6_parser.yy"
-    {
+  case 200: // $@33: %empty
+#line 752 "dhcp6_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1423 "dhcp6_parser.cc"
+#line 1478 "dhcp6_parser.cc"
     break;
 
-  case 192:
-#line 719 "dhcp6_parser.yy"
-    {
+  case 201: // password: "password" $@33 ":" "constant string"
+#line 754 "dhcp6_parser.yy"
+               {
     ElementPtr pwd(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("password", pwd);
     ctx.leave();
 }
-#line 1433 "dhcp6_parser.cc"
+#line 1488 "dhcp6_parser.cc"
     break;
 
-  case 193:
-#line 725 "dhcp6_parser.yy"
-    {
+  case 202: // $@34: %empty
+#line 760 "dhcp6_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1441 "dhcp6_parser.cc"
+#line 1496 "dhcp6_parser.cc"
     break;
 
-  case 194:
-#line 727 "dhcp6_parser.yy"
-    {
+  case 203: // host: "host" $@34 ":" "constant string"
+#line 762 "dhcp6_parser.yy"
+               {
     ElementPtr h(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host", h);
     ctx.leave();
 }
-#line 1451 "dhcp6_parser.cc"
+#line 1506 "dhcp6_parser.cc"
     break;
 
-  case 195:
-#line 733 "dhcp6_parser.yy"
-    {
+  case 204: // port: "port" ":" "integer"
+#line 768 "dhcp6_parser.yy"
+                         {
     ElementPtr p(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", p);
 }
-#line 1460 "dhcp6_parser.cc"
+#line 1515 "dhcp6_parser.cc"
     break;
 
-  case 196:
-#line 738 "dhcp6_parser.yy"
-    {
+  case 205: // $@35: %empty
+#line 773 "dhcp6_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1468 "dhcp6_parser.cc"
+#line 1523 "dhcp6_parser.cc"
     break;
 
-  case 197:
-#line 740 "dhcp6_parser.yy"
-    {
+  case 206: // name: "name" $@35 ":" "constant string"
+#line 775 "dhcp6_parser.yy"
+               {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1478 "dhcp6_parser.cc"
+#line 1533 "dhcp6_parser.cc"
     break;
 
-  case 198:
-#line 746 "dhcp6_parser.yy"
-    {
+  case 207: // persist: "persist" ":" "boolean"
+#line 781 "dhcp6_parser.yy"
+                               {
     ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("persist", n);
 }
-#line 1487 "dhcp6_parser.cc"
+#line 1542 "dhcp6_parser.cc"
     break;
 
-  case 199:
-#line 751 "dhcp6_parser.yy"
-    {
+  case 208: // lfc_interval: "lfc-interval" ":" "integer"
+#line 786 "dhcp6_parser.yy"
+                                         {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lfc-interval", n);
 }
-#line 1496 "dhcp6_parser.cc"
+#line 1551 "dhcp6_parser.cc"
     break;
 
-  case 200:
-#line 756 "dhcp6_parser.yy"
-    {
+  case 209: // readonly: "readonly" ":" "boolean"
+#line 791 "dhcp6_parser.yy"
+                                 {
     ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("readonly", n);
 }
-#line 1505 "dhcp6_parser.cc"
+#line 1560 "dhcp6_parser.cc"
     break;
 
-  case 201:
-#line 761 "dhcp6_parser.yy"
-    {
+  case 210: // connect_timeout: "connect-timeout" ":" "integer"
+#line 796 "dhcp6_parser.yy"
+                                               {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("connect-timeout", n);
 }
-#line 1514 "dhcp6_parser.cc"
+#line 1569 "dhcp6_parser.cc"
     break;
 
-  case 202:
-#line 766 "dhcp6_parser.yy"
-    {
+  case 211: // reconnect_wait_time: "reconnect-wait-time" ":" "integer"
+#line 801 "dhcp6_parser.yy"
+                                                       {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reconnect-wait-time", n);
 }
-#line 1523 "dhcp6_parser.cc"
+#line 1578 "dhcp6_parser.cc"
     break;
 
-  case 203:
-#line 771 "dhcp6_parser.yy"
-    {
+  case 212: // request_timeout: "request-timeout" ":" "integer"
+#line 806 "dhcp6_parser.yy"
+                                               {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("request-timeout", n);
 }
-#line 1532 "dhcp6_parser.cc"
+#line 1587 "dhcp6_parser.cc"
     break;
 
-  case 204:
-#line 776 "dhcp6_parser.yy"
-    {
+  case 213: // tcp_keepalive: "tcp-keepalive" ":" "integer"
+#line 811 "dhcp6_parser.yy"
+                                           {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-keepalive", n);
 }
-#line 1541 "dhcp6_parser.cc"
+#line 1596 "dhcp6_parser.cc"
     break;
 
-  case 205:
-#line 781 "dhcp6_parser.yy"
-    {
+  case 214: // tcp_nodelay: "tcp-nodelay" ":" "boolean"
+#line 816 "dhcp6_parser.yy"
+                                       {
     ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-nodelay", n);
 }
-#line 1550 "dhcp6_parser.cc"
+#line 1605 "dhcp6_parser.cc"
     break;
 
-  case 206:
-#line 786 "dhcp6_parser.yy"
-    {
+  case 215: // pool_size: "pool-size" ":" "integer"
+#line 821 "dhcp6_parser.yy"
+                                   {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("pool-size", n);
+}
+#line 1614 "dhcp6_parser.cc"
+    break;
+
+  case 216: // $@36: %empty
+#line 826 "dhcp6_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1558 "dhcp6_parser.cc"
+#line 1622 "dhcp6_parser.cc"
     break;
 
-  case 207:
-#line 788 "dhcp6_parser.yy"
-    {
+  case 217: // contact_points: "contact-points" $@36 ":" "constant string"
+#line 828 "dhcp6_parser.yy"
+               {
     ElementPtr cp(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("contact-points", cp);
     ctx.leave();
 }
-#line 1568 "dhcp6_parser.cc"
+#line 1632 "dhcp6_parser.cc"
     break;
 
-  case 208:
-#line 794 "dhcp6_parser.yy"
-    {
+  case 218: // max_reconnect_tries: "max-reconnect-tries" ":" "integer"
+#line 834 "dhcp6_parser.yy"
+                                                       {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reconnect-tries", n);
 }
-#line 1577 "dhcp6_parser.cc"
+#line 1641 "dhcp6_parser.cc"
     break;
 
-  case 209:
-#line 799 "dhcp6_parser.yy"
-    {
+  case 219: // $@37: %empty
+#line 839 "dhcp6_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1585 "dhcp6_parser.cc"
+#line 1649 "dhcp6_parser.cc"
     break;
 
-  case 210:
-#line 801 "dhcp6_parser.yy"
-    {
+  case 220: // keyspace: "keyspace" $@37 ":" "constant string"
+#line 841 "dhcp6_parser.yy"
+               {
     ElementPtr ks(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("keyspace", ks);
     ctx.leave();
 }
-#line 1595 "dhcp6_parser.cc"
+#line 1659 "dhcp6_parser.cc"
     break;
 
-  case 211:
-#line 807 "dhcp6_parser.yy"
-    {
+  case 221: // $@38: %empty
+#line 847 "dhcp6_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1603 "dhcp6_parser.cc"
+#line 1667 "dhcp6_parser.cc"
     break;
 
-  case 212:
-#line 809 "dhcp6_parser.yy"
-    {
+  case 222: // consistency: "consistency" $@38 ":" "constant string"
+#line 849 "dhcp6_parser.yy"
+               {
     ElementPtr c(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("consistency", c);
     ctx.leave();
 }
-#line 1613 "dhcp6_parser.cc"
+#line 1677 "dhcp6_parser.cc"
     break;
 
-  case 213:
-#line 815 "dhcp6_parser.yy"
-    {
+  case 223: // $@39: %empty
+#line 855 "dhcp6_parser.yy"
+                                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1621 "dhcp6_parser.cc"
+#line 1685 "dhcp6_parser.cc"
     break;
 
-  case 214:
-#line 817 "dhcp6_parser.yy"
-    {
+  case 224: // serial_consistency: "serial-consistency" $@39 ":" "constant string"
+#line 857 "dhcp6_parser.yy"
+               {
     ElementPtr c(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("serial-consistency", c);
     ctx.leave();
 }
-#line 1631 "dhcp6_parser.cc"
+#line 1695 "dhcp6_parser.cc"
     break;
 
-  case 215:
-#line 823 "dhcp6_parser.yy"
-    {
+  case 225: // $@40: %empty
+#line 863 "dhcp6_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sanity-checks", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SANITY_CHECKS);
 }
-#line 1642 "dhcp6_parser.cc"
+#line 1706 "dhcp6_parser.cc"
     break;
 
-  case 216:
-#line 828 "dhcp6_parser.yy"
-    {
+  case 226: // sanity_checks: "sanity-checks" $@40 ":" "{" sanity_checks_params "}"
+#line 868 "dhcp6_parser.yy"
+                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1651 "dhcp6_parser.cc"
+#line 1715 "dhcp6_parser.cc"
     break;
 
-  case 220:
-#line 838 "dhcp6_parser.yy"
-    {
+  case 230: // $@41: %empty
+#line 878 "dhcp6_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1659 "dhcp6_parser.cc"
+#line 1723 "dhcp6_parser.cc"
     break;
 
-  case 221:
-#line 840 "dhcp6_parser.yy"
-    {
+  case 231: // lease_checks: "lease-checks" $@41 ":" "constant string"
+#line 880 "dhcp6_parser.yy"
+               {
 
     if ( (string(yystack_[0].value.as < std::string > ()) == "none") ||
          (string(yystack_[0].value.as < std::string > ()) == "warn") ||
@@ -1675,308 +1739,308 @@ namespace isc { namespace dhcp {
               ", supported values are: none, warn, fix, fix-del, del");
     }
 }
-#line 1679 "dhcp6_parser.cc"
+#line 1743 "dhcp6_parser.cc"
     break;
 
-  case 222:
-#line 856 "dhcp6_parser.yy"
-    {
+  case 232: // $@42: %empty
+#line 896 "dhcp6_parser.yy"
+                         {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("mac-sources", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.MAC_SOURCES);
 }
-#line 1690 "dhcp6_parser.cc"
+#line 1754 "dhcp6_parser.cc"
     break;
 
-  case 223:
-#line 861 "dhcp6_parser.yy"
-    {
+  case 233: // mac_sources: "mac-sources" $@42 ":" "[" mac_sources_list "]"
+#line 901 "dhcp6_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1699 "dhcp6_parser.cc"
+#line 1763 "dhcp6_parser.cc"
     break;
 
-  case 228:
-#line 874 "dhcp6_parser.yy"
-    {
+  case 238: // duid_id: "duid"
+#line 914 "dhcp6_parser.yy"
+               {
     ElementPtr duid(new StringElement("duid", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1708 "dhcp6_parser.cc"
+#line 1772 "dhcp6_parser.cc"
     break;
 
-  case 229:
-#line 879 "dhcp6_parser.yy"
-    {
+  case 239: // string_id: "constant string"
+#line 919 "dhcp6_parser.yy"
+                   {
     ElementPtr duid(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1717 "dhcp6_parser.cc"
+#line 1781 "dhcp6_parser.cc"
     break;
 
-  case 230:
-#line 884 "dhcp6_parser.yy"
-    {
+  case 240: // $@43: %empty
+#line 924 "dhcp6_parser.yy"
+                                                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host-reservation-identifiers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOST_RESERVATION_IDENTIFIERS);
 }
-#line 1728 "dhcp6_parser.cc"
+#line 1792 "dhcp6_parser.cc"
     break;
 
-  case 231:
-#line 889 "dhcp6_parser.yy"
-    {
+  case 241: // host_reservation_identifiers: "host-reservation-identifiers" $@43 ":" "[" host_reservation_identifiers_list "]"
+#line 929 "dhcp6_parser.yy"
+                                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1737 "dhcp6_parser.cc"
+#line 1801 "dhcp6_parser.cc"
     break;
 
-  case 237:
-#line 903 "dhcp6_parser.yy"
-    {
+  case 247: // hw_address_id: "hw-address"
+#line 943 "dhcp6_parser.yy"
+                           {
     ElementPtr hwaddr(new StringElement("hw-address", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(hwaddr);
 }
-#line 1746 "dhcp6_parser.cc"
+#line 1810 "dhcp6_parser.cc"
     break;
 
-  case 238:
-#line 908 "dhcp6_parser.yy"
-    {
+  case 248: // flex_id: "flex-id"
+#line 948 "dhcp6_parser.yy"
+                  {
     ElementPtr flex_id(new StringElement("flex-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(flex_id);
 }
-#line 1755 "dhcp6_parser.cc"
+#line 1819 "dhcp6_parser.cc"
     break;
 
-  case 239:
-#line 915 "dhcp6_parser.yy"
-    {
+  case 249: // $@44: %empty
+#line 955 "dhcp6_parser.yy"
+                                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay-supplied-options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1766 "dhcp6_parser.cc"
+#line 1830 "dhcp6_parser.cc"
     break;
 
-  case 240:
-#line 920 "dhcp6_parser.yy"
-    {
+  case 250: // relay_supplied_options: "relay-supplied-options" $@44 ":" "[" list_content "]"
+#line 960 "dhcp6_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1775 "dhcp6_parser.cc"
+#line 1839 "dhcp6_parser.cc"
     break;
 
-  case 241:
-#line 925 "dhcp6_parser.yy"
-    {
+  case 251: // $@45: %empty
+#line 965 "dhcp6_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 1786 "dhcp6_parser.cc"
+#line 1850 "dhcp6_parser.cc"
     break;
 
-  case 242:
-#line 930 "dhcp6_parser.yy"
-    {
+  case 252: // hooks_libraries: "hooks-libraries" $@45 ":" "[" hooks_libraries_list "]"
+#line 970 "dhcp6_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1795 "dhcp6_parser.cc"
+#line 1859 "dhcp6_parser.cc"
     break;
 
-  case 247:
-#line 943 "dhcp6_parser.yy"
-    {
+  case 257: // $@46: %empty
+#line 983 "dhcp6_parser.yy"
+                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1805 "dhcp6_parser.cc"
+#line 1869 "dhcp6_parser.cc"
     break;
 
-  case 248:
-#line 947 "dhcp6_parser.yy"
-    {
+  case 258: // hooks_library: "{" $@46 hooks_params "}"
+#line 987 "dhcp6_parser.yy"
+                              {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1815 "dhcp6_parser.cc"
+#line 1879 "dhcp6_parser.cc"
     break;
 
-  case 249:
-#line 953 "dhcp6_parser.yy"
-    {
+  case 259: // $@47: %empty
+#line 993 "dhcp6_parser.yy"
+                                  {
     // Parse the hooks-libraries list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1825 "dhcp6_parser.cc"
+#line 1889 "dhcp6_parser.cc"
     break;
 
-  case 250:
-#line 957 "dhcp6_parser.yy"
-    {
+  case 260: // sub_hooks_library: "{" $@47 hooks_params "}"
+#line 997 "dhcp6_parser.yy"
+                              {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 1835 "dhcp6_parser.cc"
+#line 1899 "dhcp6_parser.cc"
     break;
 
-  case 256:
-#line 972 "dhcp6_parser.yy"
-    {
+  case 266: // $@48: %empty
+#line 1012 "dhcp6_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1843 "dhcp6_parser.cc"
+#line 1907 "dhcp6_parser.cc"
     break;
 
-  case 257:
-#line 974 "dhcp6_parser.yy"
-    {
+  case 267: // library: "library" $@48 ":" "constant string"
+#line 1014 "dhcp6_parser.yy"
+               {
     ElementPtr lib(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 1853 "dhcp6_parser.cc"
+#line 1917 "dhcp6_parser.cc"
     break;
 
-  case 258:
-#line 980 "dhcp6_parser.yy"
-    {
+  case 268: // $@49: %empty
+#line 1020 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1861 "dhcp6_parser.cc"
+#line 1925 "dhcp6_parser.cc"
     break;
 
-  case 259:
-#line 982 "dhcp6_parser.yy"
-    {
+  case 269: // parameters: "parameters" $@49 ":" value
+#line 1022 "dhcp6_parser.yy"
+              {
     ctx.stack_.back()->set("parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1870 "dhcp6_parser.cc"
+#line 1934 "dhcp6_parser.cc"
     break;
 
-  case 260:
-#line 988 "dhcp6_parser.yy"
-    {
+  case 270: // $@50: %empty
+#line 1028 "dhcp6_parser.yy"
+                                                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("expired-leases-processing", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.EXPIRED_LEASES_PROCESSING);
 }
-#line 1881 "dhcp6_parser.cc"
+#line 1945 "dhcp6_parser.cc"
     break;
 
-  case 261:
-#line 993 "dhcp6_parser.yy"
-    {
+  case 271: // expired_leases_processing: "expired-leases-processing" $@50 ":" "{" expired_leases_params "}"
+#line 1033 "dhcp6_parser.yy"
+                                                            {
     // No expired lease parameter is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1891 "dhcp6_parser.cc"
+#line 1955 "dhcp6_parser.cc"
     break;
 
-  case 270:
-#line 1011 "dhcp6_parser.yy"
-    {
+  case 280: // reclaim_timer_wait_time: "reclaim-timer-wait-time" ":" "integer"
+#line 1051 "dhcp6_parser.yy"
+                                                               {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reclaim-timer-wait-time", value);
 }
-#line 1900 "dhcp6_parser.cc"
+#line 1964 "dhcp6_parser.cc"
     break;
 
-  case 271:
-#line 1016 "dhcp6_parser.yy"
-    {
+  case 281: // flush_reclaimed_timer_wait_time: "flush-reclaimed-timer-wait-time" ":" "integer"
+#line 1056 "dhcp6_parser.yy"
+                                                                               {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush-reclaimed-timer-wait-time", value);
 }
-#line 1909 "dhcp6_parser.cc"
+#line 1973 "dhcp6_parser.cc"
     break;
 
-  case 272:
-#line 1021 "dhcp6_parser.yy"
-    {
+  case 282: // hold_reclaimed_time: "hold-reclaimed-time" ":" "integer"
+#line 1061 "dhcp6_parser.yy"
+                                                       {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hold-reclaimed-time", value);
 }
-#line 1918 "dhcp6_parser.cc"
+#line 1982 "dhcp6_parser.cc"
     break;
 
-  case 273:
-#line 1026 "dhcp6_parser.yy"
-    {
+  case 283: // max_reclaim_leases: "max-reclaim-leases" ":" "integer"
+#line 1066 "dhcp6_parser.yy"
+                                                     {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-leases", value);
 }
-#line 1927 "dhcp6_parser.cc"
+#line 1991 "dhcp6_parser.cc"
     break;
 
-  case 274:
-#line 1031 "dhcp6_parser.yy"
-    {
+  case 284: // max_reclaim_time: "max-reclaim-time" ":" "integer"
+#line 1071 "dhcp6_parser.yy"
+                                                 {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-time", value);
 }
-#line 1936 "dhcp6_parser.cc"
+#line 2000 "dhcp6_parser.cc"
     break;
 
-  case 275:
-#line 1036 "dhcp6_parser.yy"
-    {
+  case 285: // unwarned_reclaim_cycles: "unwarned-reclaim-cycles" ":" "integer"
+#line 1076 "dhcp6_parser.yy"
+                                                               {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("unwarned-reclaim-cycles", value);
 }
-#line 1945 "dhcp6_parser.cc"
+#line 2009 "dhcp6_parser.cc"
     break;
 
-  case 276:
-#line 1044 "dhcp6_parser.yy"
-    {
+  case 286: // $@51: %empty
+#line 1084 "dhcp6_parser.yy"
+                      {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet6", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SUBNET6);
 }
-#line 1956 "dhcp6_parser.cc"
+#line 2020 "dhcp6_parser.cc"
     break;
 
-  case 277:
-#line 1049 "dhcp6_parser.yy"
-    {
+  case 287: // subnet6_list: "subnet6" $@51 ":" "[" subnet6_list_content "]"
+#line 1089 "dhcp6_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1965 "dhcp6_parser.cc"
+#line 2029 "dhcp6_parser.cc"
     break;
 
-  case 282:
-#line 1069 "dhcp6_parser.yy"
-    {
+  case 292: // $@52: %empty
+#line 1109 "dhcp6_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1975 "dhcp6_parser.cc"
+#line 2039 "dhcp6_parser.cc"
     break;
 
-  case 283:
-#line 1073 "dhcp6_parser.yy"
-    {
+  case 293: // subnet6: "{" $@52 subnet6_params "}"
+#line 1113 "dhcp6_parser.yy"
+                                {
     // Once we reached this place, the subnet parsing is now complete.
     // If we want to, we can implement default values here.
     // In particular we can do things like this:
@@ -1997,571 +2061,571 @@ namespace isc { namespace dhcp {
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2001 "dhcp6_parser.cc"
+#line 2065 "dhcp6_parser.cc"
     break;
 
-  case 284:
-#line 1095 "dhcp6_parser.yy"
-    {
+  case 294: // $@53: %empty
+#line 1135 "dhcp6_parser.yy"
+                            {
     // Parse the subnet6 list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2011 "dhcp6_parser.cc"
+#line 2075 "dhcp6_parser.cc"
     break;
 
-  case 285:
-#line 1099 "dhcp6_parser.yy"
-    {
+  case 295: // sub_subnet6: "{" $@53 subnet6_params "}"
+#line 1139 "dhcp6_parser.yy"
+                                {
     // The subnet subnet6 parameter is required
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2021 "dhcp6_parser.cc"
+#line 2085 "dhcp6_parser.cc"
     break;
 
-  case 315:
-#line 1140 "dhcp6_parser.yy"
-    {
+  case 326: // $@54: %empty
+#line 1181 "dhcp6_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2029 "dhcp6_parser.cc"
+#line 2093 "dhcp6_parser.cc"
     break;
 
-  case 316:
-#line 1142 "dhcp6_parser.yy"
-    {
+  case 327: // subnet: "subnet" $@54 ":" "constant string"
+#line 1183 "dhcp6_parser.yy"
+               {
     ElementPtr subnet(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet", subnet);
     ctx.leave();
 }
-#line 2039 "dhcp6_parser.cc"
+#line 2103 "dhcp6_parser.cc"
     break;
 
-  case 317:
-#line 1148 "dhcp6_parser.yy"
-    {
+  case 328: // $@55: %empty
+#line 1189 "dhcp6_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2047 "dhcp6_parser.cc"
+#line 2111 "dhcp6_parser.cc"
     break;
 
-  case 318:
-#line 1150 "dhcp6_parser.yy"
-    {
+  case 329: // interface: "interface" $@55 ":" "constant string"
+#line 1191 "dhcp6_parser.yy"
+               {
     ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface", iface);
     ctx.leave();
 }
-#line 2057 "dhcp6_parser.cc"
+#line 2121 "dhcp6_parser.cc"
     break;
 
-  case 319:
-#line 1156 "dhcp6_parser.yy"
-    {
+  case 330: // $@56: %empty
+#line 1197 "dhcp6_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2065 "dhcp6_parser.cc"
+#line 2129 "dhcp6_parser.cc"
     break;
 
-  case 320:
-#line 1158 "dhcp6_parser.yy"
-    {
+  case 331: // interface_id: "interface-id" $@56 ":" "constant string"
+#line 1199 "dhcp6_parser.yy"
+               {
     ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface-id", iface);
     ctx.leave();
 }
-#line 2075 "dhcp6_parser.cc"
+#line 2139 "dhcp6_parser.cc"
     break;
 
-  case 321:
-#line 1164 "dhcp6_parser.yy"
-    {
+  case 332: // $@57: %empty
+#line 1205 "dhcp6_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2083 "dhcp6_parser.cc"
+#line 2147 "dhcp6_parser.cc"
     break;
 
-  case 322:
-#line 1166 "dhcp6_parser.yy"
-    {
+  case 333: // client_class: "client-class" $@57 ":" "constant string"
+#line 1207 "dhcp6_parser.yy"
+               {
     ElementPtr cls(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-class", cls);
     ctx.leave();
 }
-#line 2093 "dhcp6_parser.cc"
+#line 2157 "dhcp6_parser.cc"
     break;
 
-  case 323:
-#line 1172 "dhcp6_parser.yy"
-    {
+  case 334: // $@58: %empty
+#line 1213 "dhcp6_parser.yy"
+                                               {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("require-client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2104 "dhcp6_parser.cc"
+#line 2168 "dhcp6_parser.cc"
     break;
 
-  case 324:
-#line 1177 "dhcp6_parser.yy"
-    {
+  case 335: // require_client_classes: "require-client-classes" $@58 ":" list_strings
+#line 1218 "dhcp6_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2113 "dhcp6_parser.cc"
+#line 2177 "dhcp6_parser.cc"
     break;
 
-  case 325:
-#line 1182 "dhcp6_parser.yy"
-    {
+  case 336: // $@59: %empty
+#line 1223 "dhcp6_parser.yy"
+                                   {
     ctx.enter(ctx.RESERVATION_MODE);
 }
-#line 2121 "dhcp6_parser.cc"
+#line 2185 "dhcp6_parser.cc"
     break;
 
-  case 326:
-#line 1184 "dhcp6_parser.yy"
-    {
+  case 337: // reservation_mode: "reservation-mode" $@59 ":" hr_mode
+#line 1225 "dhcp6_parser.yy"
+                {
     ctx.stack_.back()->set("reservation-mode", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2130 "dhcp6_parser.cc"
+#line 2194 "dhcp6_parser.cc"
     break;
 
-  case 327:
-#line 1189 "dhcp6_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("disabled", ctx.loc2pos(yystack_[0].location))); }
-#line 2136 "dhcp6_parser.cc"
+  case 338: // hr_mode: "disabled"
+#line 1230 "dhcp6_parser.yy"
+                  { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("disabled", ctx.loc2pos(yystack_[0].location))); }
+#line 2200 "dhcp6_parser.cc"
     break;
 
-  case 328:
-#line 1190 "dhcp6_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("out-of-pool", ctx.loc2pos(yystack_[0].location))); }
-#line 2142 "dhcp6_parser.cc"
+  case 339: // hr_mode: "out-of-pool"
+#line 1231 "dhcp6_parser.yy"
+                     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("out-of-pool", ctx.loc2pos(yystack_[0].location))); }
+#line 2206 "dhcp6_parser.cc"
     break;
 
-  case 329:
-#line 1191 "dhcp6_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("global", ctx.loc2pos(yystack_[0].location))); }
-#line 2148 "dhcp6_parser.cc"
+  case 340: // hr_mode: "global"
+#line 1232 "dhcp6_parser.yy"
+                { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("global", ctx.loc2pos(yystack_[0].location))); }
+#line 2212 "dhcp6_parser.cc"
     break;
 
-  case 330:
-#line 1192 "dhcp6_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("all", ctx.loc2pos(yystack_[0].location))); }
-#line 2154 "dhcp6_parser.cc"
+  case 341: // hr_mode: "all"
+#line 1233 "dhcp6_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("all", ctx.loc2pos(yystack_[0].location))); }
+#line 2218 "dhcp6_parser.cc"
     break;
 
-  case 331:
-#line 1195 "dhcp6_parser.yy"
-    {
+  case 342: // id: "id" ":" "integer"
+#line 1236 "dhcp6_parser.yy"
+                     {
     ElementPtr id(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("id", id);
 }
-#line 2163 "dhcp6_parser.cc"
+#line 2227 "dhcp6_parser.cc"
     break;
 
-  case 332:
-#line 1200 "dhcp6_parser.yy"
-    {
+  case 343: // rapid_commit: "rapid-commit" ":" "boolean"
+#line 1241 "dhcp6_parser.yy"
+                                         {
     ElementPtr rc(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rapid-commit", rc);
 }
-#line 2172 "dhcp6_parser.cc"
+#line 2236 "dhcp6_parser.cc"
     break;
 
-  case 333:
-#line 1208 "dhcp6_parser.yy"
-    {
+  case 344: // $@60: %empty
+#line 1249 "dhcp6_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("shared-networks", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SHARED_NETWORK);
 }
-#line 2183 "dhcp6_parser.cc"
+#line 2247 "dhcp6_parser.cc"
     break;
 
-  case 334:
-#line 1213 "dhcp6_parser.yy"
-    {
+  case 345: // shared_networks: "shared-networks" $@60 ":" "[" shared_networks_content "]"
+#line 1254 "dhcp6_parser.yy"
+                                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2192 "dhcp6_parser.cc"
+#line 2256 "dhcp6_parser.cc"
     break;
 
-  case 339:
-#line 1228 "dhcp6_parser.yy"
-    {
+  case 350: // $@61: %empty
+#line 1269 "dhcp6_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2202 "dhcp6_parser.cc"
+#line 2266 "dhcp6_parser.cc"
     break;
 
-  case 340:
-#line 1232 "dhcp6_parser.yy"
-    {
+  case 351: // shared_network: "{" $@61 shared_network_params "}"
+#line 1273 "dhcp6_parser.yy"
+                                       {
     ctx.stack_.pop_back();
 }
-#line 2210 "dhcp6_parser.cc"
+#line 2274 "dhcp6_parser.cc"
     break;
 
-  case 367:
-#line 1270 "dhcp6_parser.yy"
-    {
+  case 379: // $@62: %empty
+#line 1312 "dhcp6_parser.yy"
+                            {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-def", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DEF);
 }
-#line 2221 "dhcp6_parser.cc"
+#line 2285 "dhcp6_parser.cc"
     break;
 
-  case 368:
-#line 1275 "dhcp6_parser.yy"
-    {
+  case 380: // option_def_list: "option-def" $@62 ":" "[" option_def_list_content "]"
+#line 1317 "dhcp6_parser.yy"
+                                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2230 "dhcp6_parser.cc"
+#line 2294 "dhcp6_parser.cc"
     break;
 
-  case 369:
-#line 1283 "dhcp6_parser.yy"
-    {
+  case 381: // $@63: %empty
+#line 1325 "dhcp6_parser.yy"
+                                    {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2239 "dhcp6_parser.cc"
+#line 2303 "dhcp6_parser.cc"
     break;
 
-  case 370:
-#line 1286 "dhcp6_parser.yy"
-    {
+  case 382: // sub_option_def_list: "{" $@63 option_def_list "}"
+#line 1328 "dhcp6_parser.yy"
+                                 {
     // parsing completed
 }
-#line 2247 "dhcp6_parser.cc"
+#line 2311 "dhcp6_parser.cc"
     break;
 
-  case 375:
-#line 1302 "dhcp6_parser.yy"
-    {
+  case 387: // $@64: %empty
+#line 1344 "dhcp6_parser.yy"
+                                 {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2257 "dhcp6_parser.cc"
+#line 2321 "dhcp6_parser.cc"
     break;
 
-  case 376:
-#line 1306 "dhcp6_parser.yy"
-    {
+  case 388: // option_def_entry: "{" $@64 option_def_params "}"
+#line 1348 "dhcp6_parser.yy"
+                                   {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("code", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2269 "dhcp6_parser.cc"
+#line 2333 "dhcp6_parser.cc"
     break;
 
-  case 377:
-#line 1317 "dhcp6_parser.yy"
-    {
+  case 389: // $@65: %empty
+#line 1359 "dhcp6_parser.yy"
+                               {
     // Parse the option-def list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2279 "dhcp6_parser.cc"
+#line 2343 "dhcp6_parser.cc"
     break;
 
-  case 378:
-#line 1321 "dhcp6_parser.yy"
-    {
+  case 390: // sub_option_def: "{" $@65 option_def_params "}"
+#line 1363 "dhcp6_parser.yy"
+                                   {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("code", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2291 "dhcp6_parser.cc"
+#line 2355 "dhcp6_parser.cc"
     break;
 
-  case 394:
-#line 1353 "dhcp6_parser.yy"
-    {
+  case 406: // code: "code" ":" "integer"
+#line 1395 "dhcp6_parser.yy"
+                         {
     ElementPtr code(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("code", code);
 }
-#line 2300 "dhcp6_parser.cc"
+#line 2364 "dhcp6_parser.cc"
     break;
 
-  case 396:
-#line 1360 "dhcp6_parser.yy"
-    {
+  case 408: // $@66: %empty
+#line 1402 "dhcp6_parser.yy"
+                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2308 "dhcp6_parser.cc"
+#line 2372 "dhcp6_parser.cc"
     break;
 
-  case 397:
-#line 1362 "dhcp6_parser.yy"
-    {
+  case 409: // option_def_type: "type" $@66 ":" "constant string"
+#line 1404 "dhcp6_parser.yy"
+               {
     ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("type", prf);
     ctx.leave();
 }
-#line 2318 "dhcp6_parser.cc"
+#line 2382 "dhcp6_parser.cc"
     break;
 
-  case 398:
-#line 1368 "dhcp6_parser.yy"
-    {
+  case 410: // $@67: %empty
+#line 1410 "dhcp6_parser.yy"
+                                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2326 "dhcp6_parser.cc"
+#line 2390 "dhcp6_parser.cc"
     break;
 
-  case 399:
-#line 1370 "dhcp6_parser.yy"
-    {
+  case 411: // option_def_record_types: "record-types" $@67 ":" "constant string"
+#line 1412 "dhcp6_parser.yy"
+               {
     ElementPtr rtypes(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("record-types", rtypes);
     ctx.leave();
 }
-#line 2336 "dhcp6_parser.cc"
+#line 2400 "dhcp6_parser.cc"
     break;
 
-  case 400:
-#line 1376 "dhcp6_parser.yy"
-    {
+  case 412: // $@68: %empty
+#line 1418 "dhcp6_parser.yy"
+             {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2344 "dhcp6_parser.cc"
+#line 2408 "dhcp6_parser.cc"
     break;
 
-  case 401:
-#line 1378 "dhcp6_parser.yy"
-    {
+  case 413: // space: "space" $@68 ":" "constant string"
+#line 1420 "dhcp6_parser.yy"
+               {
     ElementPtr space(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("space", space);
     ctx.leave();
 }
-#line 2354 "dhcp6_parser.cc"
+#line 2418 "dhcp6_parser.cc"
     break;
 
-  case 403:
-#line 1386 "dhcp6_parser.yy"
-    {
+  case 415: // $@69: %empty
+#line 1428 "dhcp6_parser.yy"
+                                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2362 "dhcp6_parser.cc"
+#line 2426 "dhcp6_parser.cc"
     break;
 
-  case 404:
-#line 1388 "dhcp6_parser.yy"
-    {
+  case 416: // option_def_encapsulate: "encapsulate" $@69 ":" "constant string"
+#line 1430 "dhcp6_parser.yy"
+               {
     ElementPtr encap(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("encapsulate", encap);
     ctx.leave();
 }
-#line 2372 "dhcp6_parser.cc"
+#line 2436 "dhcp6_parser.cc"
     break;
 
-  case 405:
-#line 1394 "dhcp6_parser.yy"
-    {
+  case 417: // option_def_array: "array" ":" "boolean"
+#line 1436 "dhcp6_parser.yy"
+                                      {
     ElementPtr array(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("array", array);
 }
-#line 2381 "dhcp6_parser.cc"
+#line 2445 "dhcp6_parser.cc"
     break;
 
-  case 406:
-#line 1403 "dhcp6_parser.yy"
-    {
+  case 418: // $@70: %empty
+#line 1445 "dhcp6_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-data", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DATA);
 }
-#line 2392 "dhcp6_parser.cc"
+#line 2456 "dhcp6_parser.cc"
     break;
 
-  case 407:
-#line 1408 "dhcp6_parser.yy"
-    {
+  case 419: // option_data_list: "option-data" $@70 ":" "[" option_data_list_content "]"
+#line 1450 "dhcp6_parser.yy"
+                                                                 {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2401 "dhcp6_parser.cc"
+#line 2465 "dhcp6_parser.cc"
     break;
 
-  case 412:
-#line 1427 "dhcp6_parser.yy"
-    {
+  case 424: // $@71: %empty
+#line 1469 "dhcp6_parser.yy"
+                                  {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2411 "dhcp6_parser.cc"
+#line 2475 "dhcp6_parser.cc"
     break;
 
-  case 413:
-#line 1431 "dhcp6_parser.yy"
-    {
+  case 425: // option_data_entry: "{" $@71 option_data_params "}"
+#line 1473 "dhcp6_parser.yy"
+                                    {
     /// @todo: the code or name parameters are required.
     ctx.stack_.pop_back();
 }
-#line 2420 "dhcp6_parser.cc"
+#line 2484 "dhcp6_parser.cc"
     break;
 
-  case 414:
-#line 1439 "dhcp6_parser.yy"
-    {
+  case 426: // $@72: %empty
+#line 1481 "dhcp6_parser.yy"
+                                {
     // Parse the option-data list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2430 "dhcp6_parser.cc"
+#line 2494 "dhcp6_parser.cc"
     break;
 
-  case 415:
-#line 1443 "dhcp6_parser.yy"
-    {
+  case 427: // sub_option_data: "{" $@72 option_data_params "}"
+#line 1485 "dhcp6_parser.yy"
+                                    {
     /// @todo: the code or name parameters are required.
     // parsing completed
 }
-#line 2439 "dhcp6_parser.cc"
+#line 2503 "dhcp6_parser.cc"
     break;
 
-  case 430:
-#line 1476 "dhcp6_parser.yy"
-    {
+  case 442: // $@73: %empty
+#line 1518 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2447 "dhcp6_parser.cc"
+#line 2511 "dhcp6_parser.cc"
     break;
 
-  case 431:
-#line 1478 "dhcp6_parser.yy"
-    {
+  case 443: // option_data_data: "data" $@73 ":" "constant string"
+#line 1520 "dhcp6_parser.yy"
+               {
     ElementPtr data(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data", data);
     ctx.leave();
 }
-#line 2457 "dhcp6_parser.cc"
+#line 2521 "dhcp6_parser.cc"
     break;
 
-  case 434:
-#line 1488 "dhcp6_parser.yy"
-    {
+  case 446: // option_data_csv_format: "csv-format" ":" "boolean"
+#line 1530 "dhcp6_parser.yy"
+                                                 {
     ElementPtr space(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("csv-format", space);
 }
-#line 2466 "dhcp6_parser.cc"
+#line 2530 "dhcp6_parser.cc"
     break;
 
-  case 435:
-#line 1493 "dhcp6_parser.yy"
-    {
+  case 447: // option_data_always_send: "always-send" ":" "boolean"
+#line 1535 "dhcp6_parser.yy"
+                                                   {
     ElementPtr persist(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-send", persist);
 }
-#line 2475 "dhcp6_parser.cc"
+#line 2539 "dhcp6_parser.cc"
     break;
 
-  case 436:
-#line 1501 "dhcp6_parser.yy"
-    {
+  case 448: // $@74: %empty
+#line 1543 "dhcp6_parser.yy"
+                  {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.POOLS);
 }
-#line 2486 "dhcp6_parser.cc"
+#line 2550 "dhcp6_parser.cc"
     break;
 
-  case 437:
-#line 1506 "dhcp6_parser.yy"
-    {
+  case 449: // pools_list: "pools" $@74 ":" "[" pools_list_content "]"
+#line 1548 "dhcp6_parser.yy"
+                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2495 "dhcp6_parser.cc"
+#line 2559 "dhcp6_parser.cc"
     break;
 
-  case 442:
-#line 1521 "dhcp6_parser.yy"
-    {
+  case 454: // $@75: %empty
+#line 1563 "dhcp6_parser.yy"
+                                {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2505 "dhcp6_parser.cc"
+#line 2569 "dhcp6_parser.cc"
     break;
 
-  case 443:
-#line 1525 "dhcp6_parser.yy"
-    {
+  case 455: // pool_list_entry: "{" $@75 pool_params "}"
+#line 1567 "dhcp6_parser.yy"
+                             {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2515 "dhcp6_parser.cc"
+#line 2579 "dhcp6_parser.cc"
     break;
 
-  case 444:
-#line 1531 "dhcp6_parser.yy"
-    {
+  case 456: // $@76: %empty
+#line 1573 "dhcp6_parser.yy"
+                          {
     // Parse the pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2525 "dhcp6_parser.cc"
+#line 2589 "dhcp6_parser.cc"
     break;
 
-  case 445:
-#line 1535 "dhcp6_parser.yy"
-    {
+  case 457: // sub_pool6: "{" $@76 pool_params "}"
+#line 1577 "dhcp6_parser.yy"
+                             {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
 }
-#line 2534 "dhcp6_parser.cc"
+#line 2598 "dhcp6_parser.cc"
     break;
 
-  case 455:
-#line 1553 "dhcp6_parser.yy"
-    {
+  case 467: // $@77: %empty
+#line 1595 "dhcp6_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2542 "dhcp6_parser.cc"
+#line 2606 "dhcp6_parser.cc"
     break;
 
-  case 456:
-#line 1555 "dhcp6_parser.yy"
-    {
+  case 468: // pool_entry: "pool" $@77 ":" "constant string"
+#line 1597 "dhcp6_parser.yy"
+               {
     ElementPtr pool(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pool", pool);
     ctx.leave();
 }
-#line 2552 "dhcp6_parser.cc"
+#line 2616 "dhcp6_parser.cc"
     break;
 
-  case 457:
-#line 1561 "dhcp6_parser.yy"
-    {
+  case 469: // $@78: %empty
+#line 1603 "dhcp6_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2560 "dhcp6_parser.cc"
+#line 2624 "dhcp6_parser.cc"
     break;
 
-  case 458:
-#line 1563 "dhcp6_parser.yy"
-    {
+  case 470: // user_context: "user-context" $@78 ":" map_value
+#line 1605 "dhcp6_parser.yy"
+                  {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context = yystack_[0].value.as < ElementPtr > ();
     ConstElementPtr old = parent->get("user-context");
@@ -2583,20 +2647,20 @@ namespace isc { namespace dhcp {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 2587 "dhcp6_parser.cc"
+#line 2651 "dhcp6_parser.cc"
     break;
 
-  case 459:
-#line 1586 "dhcp6_parser.yy"
-    {
+  case 471: // $@79: %empty
+#line 1628 "dhcp6_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2595 "dhcp6_parser.cc"
+#line 2659 "dhcp6_parser.cc"
     break;
 
-  case 460:
-#line 1588 "dhcp6_parser.yy"
-    {
+  case 472: // comment: "comment" $@79 ":" "constant string"
+#line 1630 "dhcp6_parser.yy"
+               {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
     ElementPtr comment(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
@@ -2620,609 +2684,609 @@ namespace isc { namespace dhcp {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 2624 "dhcp6_parser.cc"
+#line 2688 "dhcp6_parser.cc"
     break;
 
-  case 461:
-#line 1616 "dhcp6_parser.yy"
-    {
+  case 473: // $@80: %empty
+#line 1658 "dhcp6_parser.yy"
+                        {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pd-pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.PD_POOLS);
 }
-#line 2635 "dhcp6_parser.cc"
+#line 2699 "dhcp6_parser.cc"
     break;
 
-  case 462:
-#line 1621 "dhcp6_parser.yy"
-    {
+  case 474: // pd_pools_list: "pd-pools" $@80 ":" "[" pd_pools_list_content "]"
+#line 1663 "dhcp6_parser.yy"
+                                                              {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2644 "dhcp6_parser.cc"
+#line 2708 "dhcp6_parser.cc"
     break;
 
-  case 467:
-#line 1636 "dhcp6_parser.yy"
-    {
+  case 479: // $@81: %empty
+#line 1678 "dhcp6_parser.yy"
+                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2654 "dhcp6_parser.cc"
+#line 2718 "dhcp6_parser.cc"
     break;
 
-  case 468:
-#line 1640 "dhcp6_parser.yy"
-    {
+  case 480: // pd_pool_entry: "{" $@81 pd_pool_params "}"
+#line 1682 "dhcp6_parser.yy"
+                                {
     // The prefix, prefix len and delegated len parameters are required.
     ctx.require("prefix", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("prefix-len", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("delegated-len", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2666 "dhcp6_parser.cc"
+#line 2730 "dhcp6_parser.cc"
     break;
 
-  case 469:
-#line 1648 "dhcp6_parser.yy"
-    {
+  case 481: // $@82: %empty
+#line 1690 "dhcp6_parser.yy"
+                            {
     // Parse the pd-pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2676 "dhcp6_parser.cc"
+#line 2740 "dhcp6_parser.cc"
     break;
 
-  case 470:
-#line 1652 "dhcp6_parser.yy"
-    {
+  case 482: // sub_pd_pool: "{" $@82 pd_pool_params "}"
+#line 1694 "dhcp6_parser.yy"
+                                {
     // The prefix, prefix len and delegated len parameters are required.
     ctx.require("prefix", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("prefix-len", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("delegated-len", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2688 "dhcp6_parser.cc"
+#line 2752 "dhcp6_parser.cc"
     break;
 
-  case 484:
-#line 1677 "dhcp6_parser.yy"
-    {
+  case 496: // $@83: %empty
+#line 1719 "dhcp6_parser.yy"
+                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2696 "dhcp6_parser.cc"
+#line 2760 "dhcp6_parser.cc"
     break;
 
-  case 485:
-#line 1679 "dhcp6_parser.yy"
-    {
+  case 497: // pd_prefix: "prefix" $@83 ":" "constant string"
+#line 1721 "dhcp6_parser.yy"
+               {
     ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefix", prf);
     ctx.leave();
 }
-#line 2706 "dhcp6_parser.cc"
+#line 2770 "dhcp6_parser.cc"
     break;
 
-  case 486:
-#line 1685 "dhcp6_parser.yy"
-    {
+  case 498: // pd_prefix_len: "prefix-len" ":" "integer"
+#line 1727 "dhcp6_parser.yy"
+                                        {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefix-len", prf);
 }
-#line 2715 "dhcp6_parser.cc"
+#line 2779 "dhcp6_parser.cc"
     break;
 
-  case 487:
-#line 1690 "dhcp6_parser.yy"
-    {
+  case 499: // $@84: %empty
+#line 1732 "dhcp6_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2723 "dhcp6_parser.cc"
+#line 2787 "dhcp6_parser.cc"
     break;
 
-  case 488:
-#line 1692 "dhcp6_parser.yy"
-    {
+  case 500: // excluded_prefix: "excluded-prefix" $@84 ":" "constant string"
+#line 1734 "dhcp6_parser.yy"
+               {
     ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("excluded-prefix", prf);
     ctx.leave();
 }
-#line 2733 "dhcp6_parser.cc"
+#line 2797 "dhcp6_parser.cc"
     break;
 
-  case 489:
-#line 1698 "dhcp6_parser.yy"
-    {
+  case 501: // excluded_prefix_len: "excluded-prefix-len" ":" "integer"
+#line 1740 "dhcp6_parser.yy"
+                                                       {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("excluded-prefix-len", prf);
 }
-#line 2742 "dhcp6_parser.cc"
+#line 2806 "dhcp6_parser.cc"
     break;
 
-  case 490:
-#line 1703 "dhcp6_parser.yy"
-    {
+  case 502: // pd_delegated_len: "delegated-len" ":" "integer"
+#line 1745 "dhcp6_parser.yy"
+                                              {
     ElementPtr deleg(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("delegated-len", deleg);
 }
-#line 2751 "dhcp6_parser.cc"
+#line 2815 "dhcp6_parser.cc"
     break;
 
-  case 491:
-#line 1711 "dhcp6_parser.yy"
-    {
+  case 503: // $@85: %empty
+#line 1753 "dhcp6_parser.yy"
+                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservations", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.RESERVATIONS);
 }
-#line 2762 "dhcp6_parser.cc"
+#line 2826 "dhcp6_parser.cc"
     break;
 
-  case 492:
-#line 1716 "dhcp6_parser.yy"
-    {
+  case 504: // reservations: "reservations" $@85 ":" "[" reservations_list "]"
+#line 1758 "dhcp6_parser.yy"
+                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2771 "dhcp6_parser.cc"
+#line 2835 "dhcp6_parser.cc"
     break;
 
-  case 497:
-#line 1729 "dhcp6_parser.yy"
-    {
+  case 509: // $@86: %empty
+#line 1771 "dhcp6_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2781 "dhcp6_parser.cc"
+#line 2845 "dhcp6_parser.cc"
     break;
 
-  case 498:
-#line 1733 "dhcp6_parser.yy"
-    {
+  case 510: // reservation: "{" $@86 reservation_params "}"
+#line 1775 "dhcp6_parser.yy"
+                                    {
     /// @todo: an identifier parameter is required.
     ctx.stack_.pop_back();
 }
-#line 2790 "dhcp6_parser.cc"
+#line 2854 "dhcp6_parser.cc"
     break;
 
-  case 499:
-#line 1738 "dhcp6_parser.yy"
-    {
+  case 511: // $@87: %empty
+#line 1780 "dhcp6_parser.yy"
+                                {
     // Parse the reservations list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2800 "dhcp6_parser.cc"
+#line 2864 "dhcp6_parser.cc"
     break;
 
-  case 500:
-#line 1742 "dhcp6_parser.yy"
-    {
+  case 512: // sub_reservation: "{" $@87 reservation_params "}"
+#line 1784 "dhcp6_parser.yy"
+                                    {
     /// @todo: an identifier parameter is required.
     // parsing completed
 }
-#line 2809 "dhcp6_parser.cc"
+#line 2873 "dhcp6_parser.cc"
     break;
 
-  case 516:
-#line 1769 "dhcp6_parser.yy"
-    {
+  case 528: // $@88: %empty
+#line 1811 "dhcp6_parser.yy"
+                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-addresses", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2820 "dhcp6_parser.cc"
+#line 2884 "dhcp6_parser.cc"
     break;
 
-  case 517:
-#line 1774 "dhcp6_parser.yy"
-    {
+  case 529: // ip_addresses: "ip-addresses" $@88 ":" list_strings
+#line 1816 "dhcp6_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2829 "dhcp6_parser.cc"
+#line 2893 "dhcp6_parser.cc"
     break;
 
-  case 518:
-#line 1779 "dhcp6_parser.yy"
-    {
+  case 530: // $@89: %empty
+#line 1821 "dhcp6_parser.yy"
+                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefixes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2840 "dhcp6_parser.cc"
+#line 2904 "dhcp6_parser.cc"
     break;
 
-  case 519:
-#line 1784 "dhcp6_parser.yy"
-    {
+  case 531: // prefixes: "prefixes" $@89 ":" list_strings
+#line 1826 "dhcp6_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2849 "dhcp6_parser.cc"
+#line 2913 "dhcp6_parser.cc"
     break;
 
-  case 520:
-#line 1789 "dhcp6_parser.yy"
-    {
+  case 532: // $@90: %empty
+#line 1831 "dhcp6_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2857 "dhcp6_parser.cc"
+#line 2921 "dhcp6_parser.cc"
     break;
 
-  case 521:
-#line 1791 "dhcp6_parser.yy"
-    {
+  case 533: // duid: "duid" $@90 ":" "constant string"
+#line 1833 "dhcp6_parser.yy"
+               {
     ElementPtr d(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("duid", d);
     ctx.leave();
 }
-#line 2867 "dhcp6_parser.cc"
+#line 2931 "dhcp6_parser.cc"
     break;
 
-  case 522:
-#line 1797 "dhcp6_parser.yy"
-    {
+  case 534: // $@91: %empty
+#line 1839 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2875 "dhcp6_parser.cc"
+#line 2939 "dhcp6_parser.cc"
     break;
 
-  case 523:
-#line 1799 "dhcp6_parser.yy"
-    {
+  case 535: // hw_address: "hw-address" $@91 ":" "constant string"
+#line 1841 "dhcp6_parser.yy"
+               {
     ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hw-address", hw);
     ctx.leave();
 }
-#line 2885 "dhcp6_parser.cc"
+#line 2949 "dhcp6_parser.cc"
     break;
 
-  case 524:
-#line 1805 "dhcp6_parser.yy"
-    {
+  case 536: // $@92: %empty
+#line 1847 "dhcp6_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2893 "dhcp6_parser.cc"
+#line 2957 "dhcp6_parser.cc"
     break;
 
-  case 525:
-#line 1807 "dhcp6_parser.yy"
-    {
+  case 537: // hostname: "hostname" $@92 ":" "constant string"
+#line 1849 "dhcp6_parser.yy"
+               {
     ElementPtr host(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", host);
     ctx.leave();
 }
-#line 2903 "dhcp6_parser.cc"
+#line 2967 "dhcp6_parser.cc"
     break;
 
-  case 526:
-#line 1813 "dhcp6_parser.yy"
-    {
+  case 538: // $@93: %empty
+#line 1855 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2911 "dhcp6_parser.cc"
+#line 2975 "dhcp6_parser.cc"
     break;
 
-  case 527:
-#line 1815 "dhcp6_parser.yy"
-    {
+  case 539: // flex_id_value: "flex-id" $@93 ":" "constant string"
+#line 1857 "dhcp6_parser.yy"
+               {
     ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flex-id", hw);
     ctx.leave();
 }
-#line 2921 "dhcp6_parser.cc"
+#line 2985 "dhcp6_parser.cc"
     break;
 
-  case 528:
-#line 1821 "dhcp6_parser.yy"
-    {
+  case 540: // $@94: %empty
+#line 1863 "dhcp6_parser.yy"
+                                           {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2932 "dhcp6_parser.cc"
+#line 2996 "dhcp6_parser.cc"
     break;
 
-  case 529:
-#line 1826 "dhcp6_parser.yy"
-    {
+  case 541: // reservation_client_classes: "client-classes" $@94 ":" list_strings
+#line 1868 "dhcp6_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2941 "dhcp6_parser.cc"
+#line 3005 "dhcp6_parser.cc"
     break;
 
-  case 530:
-#line 1834 "dhcp6_parser.yy"
-    {
+  case 542: // $@95: %empty
+#line 1876 "dhcp6_parser.yy"
+             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.RELAY);
 }
-#line 2952 "dhcp6_parser.cc"
+#line 3016 "dhcp6_parser.cc"
     break;
 
-  case 531:
-#line 1839 "dhcp6_parser.yy"
-    {
+  case 543: // relay: "relay" $@95 ":" "{" relay_map "}"
+#line 1881 "dhcp6_parser.yy"
+                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2961 "dhcp6_parser.cc"
+#line 3025 "dhcp6_parser.cc"
     break;
 
-  case 534:
-#line 1848 "dhcp6_parser.yy"
-    {
+  case 546: // $@96: %empty
+#line 1890 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2969 "dhcp6_parser.cc"
+#line 3033 "dhcp6_parser.cc"
     break;
 
-  case 535:
-#line 1850 "dhcp6_parser.yy"
-    {
+  case 547: // ip_address: "ip-address" $@96 ":" "constant string"
+#line 1892 "dhcp6_parser.yy"
+               {
     ElementPtr addr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", addr);
     ctx.leave();
 }
-#line 2979 "dhcp6_parser.cc"
+#line 3043 "dhcp6_parser.cc"
     break;
 
-  case 536:
-#line 1859 "dhcp6_parser.yy"
-    {
+  case 548: // $@97: %empty
+#line 1901 "dhcp6_parser.yy"
+                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CLIENT_CLASSES);
 }
-#line 2990 "dhcp6_parser.cc"
+#line 3054 "dhcp6_parser.cc"
     break;
 
-  case 537:
-#line 1864 "dhcp6_parser.yy"
-    {
+  case 549: // client_classes: "client-classes" $@97 ":" "[" client_classes_list "]"
+#line 1906 "dhcp6_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2999 "dhcp6_parser.cc"
+#line 3063 "dhcp6_parser.cc"
     break;
 
-  case 540:
-#line 1873 "dhcp6_parser.yy"
-    {
+  case 552: // $@98: %empty
+#line 1915 "dhcp6_parser.yy"
+                                   {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 3009 "dhcp6_parser.cc"
+#line 3073 "dhcp6_parser.cc"
     break;
 
-  case 541:
-#line 1877 "dhcp6_parser.yy"
-    {
+  case 553: // client_class_entry: "{" $@98 client_class_params "}"
+#line 1919 "dhcp6_parser.yy"
+                                     {
     // The name client class parameter is required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 3019 "dhcp6_parser.cc"
+#line 3083 "dhcp6_parser.cc"
     break;
 
-  case 554:
-#line 1902 "dhcp6_parser.yy"
-    {
+  case 566: // $@99: %empty
+#line 1944 "dhcp6_parser.yy"
+                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3027 "dhcp6_parser.cc"
+#line 3091 "dhcp6_parser.cc"
     break;
 
-  case 555:
-#line 1904 "dhcp6_parser.yy"
-    {
+  case 567: // client_class_test: "test" $@99 ":" "constant string"
+#line 1946 "dhcp6_parser.yy"
+               {
     ElementPtr test(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("test", test);
     ctx.leave();
 }
-#line 3037 "dhcp6_parser.cc"
+#line 3101 "dhcp6_parser.cc"
     break;
 
-  case 556:
-#line 1910 "dhcp6_parser.yy"
-    {
+  case 568: // only_if_required: "only-if-required" ":" "boolean"
+#line 1952 "dhcp6_parser.yy"
+                                                 {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("only-if-required", b);
 }
-#line 3046 "dhcp6_parser.cc"
+#line 3110 "dhcp6_parser.cc"
     break;
 
-  case 557:
-#line 1918 "dhcp6_parser.yy"
-    {
+  case 569: // $@100: %empty
+#line 1960 "dhcp6_parser.yy"
+                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-id", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER_ID);
 }
-#line 3057 "dhcp6_parser.cc"
+#line 3121 "dhcp6_parser.cc"
     break;
 
-  case 558:
-#line 1923 "dhcp6_parser.yy"
-    {
+  case 570: // server_id: "server-id" $@100 ":" "{" server_id_params "}"
+#line 1965 "dhcp6_parser.yy"
+                                                       {
     // The type parameter is required.
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3068 "dhcp6_parser.cc"
+#line 3132 "dhcp6_parser.cc"
     break;
 
-  case 570:
-#line 1945 "dhcp6_parser.yy"
-    {
+  case 582: // $@101: %empty
+#line 1987 "dhcp6_parser.yy"
+                     {
     ctx.enter(ctx.DUID_TYPE);
 }
-#line 3076 "dhcp6_parser.cc"
+#line 3140 "dhcp6_parser.cc"
     break;
 
-  case 571:
-#line 1947 "dhcp6_parser.yy"
-    {
+  case 583: // server_id_type: "type" $@101 ":" duid_type
+#line 1989 "dhcp6_parser.yy"
+                  {
     ctx.stack_.back()->set("type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3085 "dhcp6_parser.cc"
+#line 3149 "dhcp6_parser.cc"
     break;
 
-  case 572:
-#line 1952 "dhcp6_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("LLT", ctx.loc2pos(yystack_[0].location))); }
-#line 3091 "dhcp6_parser.cc"
+  case 584: // duid_type: "LLT"
+#line 1994 "dhcp6_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("LLT", ctx.loc2pos(yystack_[0].location))); }
+#line 3155 "dhcp6_parser.cc"
     break;
 
-  case 573:
-#line 1953 "dhcp6_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("EN", ctx.loc2pos(yystack_[0].location))); }
-#line 3097 "dhcp6_parser.cc"
+  case 585: // duid_type: "EN"
+#line 1995 "dhcp6_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("EN", ctx.loc2pos(yystack_[0].location))); }
+#line 3161 "dhcp6_parser.cc"
     break;
 
-  case 574:
-#line 1954 "dhcp6_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("LL", ctx.loc2pos(yystack_[0].location))); }
-#line 3103 "dhcp6_parser.cc"
+  case 586: // duid_type: "LL"
+#line 1996 "dhcp6_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("LL", ctx.loc2pos(yystack_[0].location))); }
+#line 3167 "dhcp6_parser.cc"
     break;
 
-  case 575:
-#line 1957 "dhcp6_parser.yy"
-    {
+  case 587: // htype: "htype" ":" "integer"
+#line 1999 "dhcp6_parser.yy"
+                           {
     ElementPtr htype(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("htype", htype);
 }
-#line 3112 "dhcp6_parser.cc"
+#line 3176 "dhcp6_parser.cc"
     break;
 
-  case 576:
-#line 1962 "dhcp6_parser.yy"
-    {
+  case 588: // $@102: %empty
+#line 2004 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3120 "dhcp6_parser.cc"
+#line 3184 "dhcp6_parser.cc"
     break;
 
-  case 577:
-#line 1964 "dhcp6_parser.yy"
-    {
+  case 589: // identifier: "identifier" $@102 ":" "constant string"
+#line 2006 "dhcp6_parser.yy"
+               {
     ElementPtr id(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("identifier", id);
     ctx.leave();
 }
-#line 3130 "dhcp6_parser.cc"
+#line 3194 "dhcp6_parser.cc"
     break;
 
-  case 578:
-#line 1970 "dhcp6_parser.yy"
-    {
+  case 590: // time: "time" ":" "integer"
+#line 2012 "dhcp6_parser.yy"
+                         {
     ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("time", time);
 }
-#line 3139 "dhcp6_parser.cc"
+#line 3203 "dhcp6_parser.cc"
     break;
 
-  case 579:
-#line 1975 "dhcp6_parser.yy"
-    {
+  case 591: // enterprise_id: "enterprise-id" ":" "integer"
+#line 2017 "dhcp6_parser.yy"
+                                           {
     ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enterprise-id", time);
 }
-#line 3148 "dhcp6_parser.cc"
+#line 3212 "dhcp6_parser.cc"
     break;
 
-  case 580:
-#line 1982 "dhcp6_parser.yy"
-    {
+  case 592: // dhcp4o6_port: "dhcp4o6-port" ":" "integer"
+#line 2024 "dhcp6_parser.yy"
+                                         {
     ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4o6-port", time);
 }
-#line 3157 "dhcp6_parser.cc"
+#line 3221 "dhcp6_parser.cc"
     break;
 
-  case 581:
-#line 1989 "dhcp6_parser.yy"
-    {
+  case 593: // $@103: %empty
+#line 2031 "dhcp6_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 3168 "dhcp6_parser.cc"
+#line 3232 "dhcp6_parser.cc"
     break;
 
-  case 582:
-#line 1994 "dhcp6_parser.yy"
-    {
+  case 594: // control_socket: "control-socket" $@103 ":" "{" control_socket_params "}"
+#line 2036 "dhcp6_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3177 "dhcp6_parser.cc"
+#line 3241 "dhcp6_parser.cc"
     break;
 
-  case 590:
-#line 2010 "dhcp6_parser.yy"
-    {
+  case 602: // $@104: %empty
+#line 2052 "dhcp6_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3185 "dhcp6_parser.cc"
+#line 3249 "dhcp6_parser.cc"
     break;
 
-  case 591:
-#line 2012 "dhcp6_parser.yy"
-    {
+  case 603: // socket_type: "socket-type" $@104 ":" "constant string"
+#line 2054 "dhcp6_parser.yy"
+               {
     ElementPtr stype(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
     ctx.leave();
 }
-#line 3195 "dhcp6_parser.cc"
+#line 3259 "dhcp6_parser.cc"
     break;
 
-  case 592:
-#line 2018 "dhcp6_parser.yy"
-    {
+  case 604: // $@105: %empty
+#line 2060 "dhcp6_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3203 "dhcp6_parser.cc"
+#line 3267 "dhcp6_parser.cc"
     break;
 
-  case 593:
-#line 2020 "dhcp6_parser.yy"
-    {
+  case 605: // socket_name: "socket-name" $@105 ":" "constant string"
+#line 2062 "dhcp6_parser.yy"
+               {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 3213 "dhcp6_parser.cc"
+#line 3277 "dhcp6_parser.cc"
     break;
 
-  case 594:
-#line 2028 "dhcp6_parser.yy"
-    {
+  case 606: // $@106: %empty
+#line 2070 "dhcp6_parser.yy"
+                                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3221 "dhcp6_parser.cc"
+#line 3285 "dhcp6_parser.cc"
     break;
 
-  case 595:
-#line 2030 "dhcp6_parser.yy"
-    {
+  case 607: // dhcp_queue_control: "dhcp-queue-control" $@106 ":" map_value
+#line 2072 "dhcp6_parser.yy"
+                  {
     ElementPtr qc = yystack_[0].value.as < ElementPtr > ();
     ctx.stack_.back()->set("dhcp-queue-control", qc);
 
@@ -3257,626 +3321,685 @@ namespace isc { namespace dhcp {
 
     ctx.leave();
 }
-#line 3261 "dhcp6_parser.cc"
+#line 3325 "dhcp6_parser.cc"
     break;
 
-  case 596:
-#line 2068 "dhcp6_parser.yy"
-    {
+  case 608: // $@107: %empty
+#line 2110 "dhcp6_parser.yy"
+                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP_DDNS);
 }
-#line 3272 "dhcp6_parser.cc"
+#line 3336 "dhcp6_parser.cc"
     break;
 
-  case 597:
-#line 2073 "dhcp6_parser.yy"
-    {
+  case 609: // dhcp_ddns: "dhcp-ddns" $@107 ":" "{" dhcp_ddns_params "}"
+#line 2115 "dhcp6_parser.yy"
+                                                       {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3283 "dhcp6_parser.cc"
+#line 3347 "dhcp6_parser.cc"
     break;
 
-  case 598:
-#line 2080 "dhcp6_parser.yy"
-    {
+  case 610: // $@108: %empty
+#line 2122 "dhcp6_parser.yy"
+                              {
     // Parse the dhcp-ddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3293 "dhcp6_parser.cc"
+#line 3357 "dhcp6_parser.cc"
     break;
 
-  case 599:
-#line 2084 "dhcp6_parser.yy"
-    {
+  case 611: // sub_dhcp_ddns: "{" $@108 dhcp_ddns_params "}"
+#line 2126 "dhcp6_parser.yy"
+                                  {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 3303 "dhcp6_parser.cc"
+#line 3367 "dhcp6_parser.cc"
     break;
 
-  case 620:
-#line 2114 "dhcp6_parser.yy"
-    {
+  case 632: // enable_updates: "enable-updates" ":" "boolean"
+#line 2156 "dhcp6_parser.yy"
+                                             {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-updates", b);
 }
-#line 3312 "dhcp6_parser.cc"
+#line 3376 "dhcp6_parser.cc"
     break;
 
-  case 621:
-#line 2119 "dhcp6_parser.yy"
-    {
+  case 633: // $@109: %empty
+#line 2161 "dhcp6_parser.yy"
+                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3320 "dhcp6_parser.cc"
+#line 3384 "dhcp6_parser.cc"
     break;
 
-  case 622:
-#line 2121 "dhcp6_parser.yy"
-    {
+  case 634: // qualifying_suffix: "qualifying-suffix" $@109 ":" "constant string"
+#line 2163 "dhcp6_parser.yy"
+               {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("qualifying-suffix", s);
     ctx.leave();
 }
-#line 3330 "dhcp6_parser.cc"
+#line 3394 "dhcp6_parser.cc"
     break;
 
-  case 623:
-#line 2127 "dhcp6_parser.yy"
-    {
+  case 635: // $@110: %empty
+#line 2169 "dhcp6_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3338 "dhcp6_parser.cc"
+#line 3402 "dhcp6_parser.cc"
     break;
 
-  case 624:
-#line 2129 "dhcp6_parser.yy"
-    {
+  case 636: // server_ip: "server-ip" $@110 ":" "constant string"
+#line 2171 "dhcp6_parser.yy"
+               {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-ip", s);
     ctx.leave();
 }
-#line 3348 "dhcp6_parser.cc"
+#line 3412 "dhcp6_parser.cc"
     break;
 
-  case 625:
-#line 2135 "dhcp6_parser.yy"
-    {
+  case 637: // server_port: "server-port" ":" "integer"
+#line 2177 "dhcp6_parser.yy"
+                                       {
     ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-port", i);
 }
-#line 3357 "dhcp6_parser.cc"
+#line 3421 "dhcp6_parser.cc"
     break;
 
-  case 626:
-#line 2140 "dhcp6_parser.yy"
-    {
+  case 638: // $@111: %empty
+#line 2182 "dhcp6_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3365 "dhcp6_parser.cc"
+#line 3429 "dhcp6_parser.cc"
     break;
 
-  case 627:
-#line 2142 "dhcp6_parser.yy"
-    {
+  case 639: // sender_ip: "sender-ip" $@111 ":" "constant string"
+#line 2184 "dhcp6_parser.yy"
+               {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-ip", s);
     ctx.leave();
 }
-#line 3375 "dhcp6_parser.cc"
+#line 3439 "dhcp6_parser.cc"
     break;
 
-  case 628:
-#line 2148 "dhcp6_parser.yy"
-    {
+  case 640: // sender_port: "sender-port" ":" "integer"
+#line 2190 "dhcp6_parser.yy"
+                                       {
     ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-port", i);
 }
-#line 3384 "dhcp6_parser.cc"
+#line 3448 "dhcp6_parser.cc"
     break;
 
-  case 629:
-#line 2153 "dhcp6_parser.yy"
-    {
+  case 641: // max_queue_size: "max-queue-size" ":" "integer"
+#line 2195 "dhcp6_parser.yy"
+                                             {
     ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-queue-size", i);
 }
-#line 3393 "dhcp6_parser.cc"
+#line 3457 "dhcp6_parser.cc"
     break;
 
-  case 630:
-#line 2158 "dhcp6_parser.yy"
-    {
+  case 642: // $@112: %empty
+#line 2200 "dhcp6_parser.yy"
+                           {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 3401 "dhcp6_parser.cc"
+#line 3465 "dhcp6_parser.cc"
     break;
 
-  case 631:
-#line 2160 "dhcp6_parser.yy"
-    {
+  case 643: // ncr_protocol: "ncr-protocol" $@112 ":" ncr_protocol_value
+#line 2202 "dhcp6_parser.yy"
+                           {
     ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3410 "dhcp6_parser.cc"
+#line 3474 "dhcp6_parser.cc"
     break;
 
-  case 632:
-#line 2166 "dhcp6_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 3416 "dhcp6_parser.cc"
+  case 644: // ncr_protocol_value: "UDP"
+#line 2208 "dhcp6_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
+#line 3480 "dhcp6_parser.cc"
     break;
 
-  case 633:
-#line 2167 "dhcp6_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 3422 "dhcp6_parser.cc"
+  case 645: // ncr_protocol_value: "TCP"
+#line 2209 "dhcp6_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
+#line 3486 "dhcp6_parser.cc"
     break;
 
-  case 634:
-#line 2170 "dhcp6_parser.yy"
-    {
+  case 646: // $@113: %empty
+#line 2212 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 3430 "dhcp6_parser.cc"
+#line 3494 "dhcp6_parser.cc"
     break;
 
-  case 635:
-#line 2172 "dhcp6_parser.yy"
-    {
-    ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
-    ctx.stack_.back()->set("ncr-format", json);
+  case 647: // ncr_format: "ncr-format" $@113 ":" ncr_format_value
+#line 2214 "dhcp6_parser.yy"
+                         {
+    ctx.stack_.back()->set("ncr-format", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3440 "dhcp6_parser.cc"
+#line 3503 "dhcp6_parser.cc"
     break;
 
-  case 636:
-#line 2178 "dhcp6_parser.yy"
-    {
+  case 648: // ncr_format_value: "JSON"
+#line 2220 "dhcp6_parser.yy"
+         { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("JSON", ctx.loc2pos(yystack_[0].location))); }
+#line 3509 "dhcp6_parser.cc"
+    break;
+
+  case 649: // ncr_format_value: "BINARY"
+#line 2221 "dhcp6_parser.yy"
+           { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("BINARY", ctx.loc2pos(yystack_[0].location))); }
+#line 3515 "dhcp6_parser.cc"
+    break;
+
+  case 650: // override_no_update: "override-no-update" ":" "boolean"
+#line 2224 "dhcp6_parser.yy"
+                                                     {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-no-update", b);
 }
-#line 3449 "dhcp6_parser.cc"
+#line 3524 "dhcp6_parser.cc"
     break;
 
-  case 637:
-#line 2183 "dhcp6_parser.yy"
-    {
+  case 651: // override_client_update: "override-client-update" ":" "boolean"
+#line 2229 "dhcp6_parser.yy"
+                                                             {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-client-update", b);
 }
-#line 3458 "dhcp6_parser.cc"
+#line 3533 "dhcp6_parser.cc"
     break;
 
-  case 638:
-#line 2188 "dhcp6_parser.yy"
-    {
+  case 652: // $@114: %empty
+#line 2234 "dhcp6_parser.yy"
+                                         {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
-#line 3466 "dhcp6_parser.cc"
+#line 3541 "dhcp6_parser.cc"
     break;
 
-  case 639:
-#line 2190 "dhcp6_parser.yy"
-    {
+  case 653: // replace_client_name: "replace-client-name" $@114 ":" replace_client_name_value
+#line 2236 "dhcp6_parser.yy"
+                                  {
     ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3475 "dhcp6_parser.cc"
+#line 3550 "dhcp6_parser.cc"
     break;
 
-  case 640:
-#line 2196 "dhcp6_parser.yy"
-    {
+  case 654: // replace_client_name_value: "when-present"
+#line 2242 "dhcp6_parser.yy"
+                 {
       yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3483 "dhcp6_parser.cc"
+#line 3558 "dhcp6_parser.cc"
     break;
 
-  case 641:
-#line 2199 "dhcp6_parser.yy"
-    {
+  case 655: // replace_client_name_value: "never"
+#line 2245 "dhcp6_parser.yy"
+          {
       yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3491 "dhcp6_parser.cc"
+#line 3566 "dhcp6_parser.cc"
     break;
 
-  case 642:
-#line 2202 "dhcp6_parser.yy"
-    {
+  case 656: // replace_client_name_value: "always"
+#line 2248 "dhcp6_parser.yy"
+           {
       yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3499 "dhcp6_parser.cc"
+#line 3574 "dhcp6_parser.cc"
     break;
 
-  case 643:
-#line 2205 "dhcp6_parser.yy"
-    {
+  case 657: // replace_client_name_value: "when-not-present"
+#line 2251 "dhcp6_parser.yy"
+                     {
       yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3507 "dhcp6_parser.cc"
+#line 3582 "dhcp6_parser.cc"
     break;
 
-  case 644:
-#line 2208 "dhcp6_parser.yy"
-    {
+  case 658: // replace_client_name_value: "boolean"
+#line 2254 "dhcp6_parser.yy"
+             {
       error(yystack_[0].location, "boolean values for the replace-client-name are "
                 "no longer supported");
       }
-#line 3516 "dhcp6_parser.cc"
+#line 3591 "dhcp6_parser.cc"
     break;
 
-  case 645:
-#line 2214 "dhcp6_parser.yy"
-    {
+  case 659: // $@115: %empty
+#line 2260 "dhcp6_parser.yy"
+                                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3524 "dhcp6_parser.cc"
+#line 3599 "dhcp6_parser.cc"
     break;
 
-  case 646:
-#line 2216 "dhcp6_parser.yy"
-    {
+  case 660: // generated_prefix: "generated-prefix" $@115 ":" "constant string"
+#line 2262 "dhcp6_parser.yy"
+               {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("generated-prefix", s);
     ctx.leave();
 }
-#line 3534 "dhcp6_parser.cc"
+#line 3609 "dhcp6_parser.cc"
     break;
 
-  case 647:
-#line 2222 "dhcp6_parser.yy"
-    {
+  case 661: // $@116: %empty
+#line 2268 "dhcp6_parser.yy"
+                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3542 "dhcp6_parser.cc"
+#line 3617 "dhcp6_parser.cc"
     break;
 
-  case 648:
-#line 2224 "dhcp6_parser.yy"
-    {
+  case 662: // hostname_char_set: "hostname-char-set" $@116 ":" "constant string"
+#line 2270 "dhcp6_parser.yy"
+               {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-set", s);
     ctx.leave();
 }
-#line 3552 "dhcp6_parser.cc"
+#line 3627 "dhcp6_parser.cc"
     break;
 
-  case 649:
-#line 2230 "dhcp6_parser.yy"
-    {
+  case 663: // $@117: %empty
+#line 2276 "dhcp6_parser.yy"
+                                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3560 "dhcp6_parser.cc"
+#line 3635 "dhcp6_parser.cc"
     break;
 
-  case 650:
-#line 2232 "dhcp6_parser.yy"
-    {
+  case 664: // hostname_char_replacement: "hostname-char-replacement" $@117 ":" "constant string"
+#line 2278 "dhcp6_parser.yy"
+               {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-replacement", s);
     ctx.leave();
 }
-#line 3570 "dhcp6_parser.cc"
+#line 3645 "dhcp6_parser.cc"
     break;
 
-  case 651:
-#line 2240 "dhcp6_parser.yy"
-    {
+  case 665: // $@118: %empty
+#line 2286 "dhcp6_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3578 "dhcp6_parser.cc"
+#line 3653 "dhcp6_parser.cc"
     break;
 
-  case 652:
-#line 2242 "dhcp6_parser.yy"
-    {
+  case 666: // dhcp4_json_object: "Dhcp4" $@118 ":" value
+#line 2288 "dhcp6_parser.yy"
+              {
     ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3587 "dhcp6_parser.cc"
+#line 3662 "dhcp6_parser.cc"
     break;
 
-  case 653:
-#line 2247 "dhcp6_parser.yy"
-    {
+  case 667: // $@119: %empty
+#line 2293 "dhcp6_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3595 "dhcp6_parser.cc"
+#line 3670 "dhcp6_parser.cc"
     break;
 
-  case 654:
-#line 2249 "dhcp6_parser.yy"
-    {
+  case 668: // dhcpddns_json_object: "DhcpDdns" $@119 ":" value
+#line 2295 "dhcp6_parser.yy"
+              {
     ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3604 "dhcp6_parser.cc"
+#line 3679 "dhcp6_parser.cc"
     break;
 
-  case 655:
-#line 2254 "dhcp6_parser.yy"
-    {
+  case 669: // $@120: %empty
+#line 2300 "dhcp6_parser.yy"
+                                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3612 "dhcp6_parser.cc"
+#line 3687 "dhcp6_parser.cc"
     break;
 
-  case 656:
-#line 2256 "dhcp6_parser.yy"
-    {
+  case 670: // control_agent_json_object: "Control-agent" $@120 ":" value
+#line 2302 "dhcp6_parser.yy"
+              {
     ctx.stack_.back()->set("Control-agent", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3621 "dhcp6_parser.cc"
+#line 3696 "dhcp6_parser.cc"
     break;
 
-  case 657:
-#line 2263 "dhcp6_parser.yy"
-    {
+  case 671: // $@121: %empty
+#line 2309 "dhcp6_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-control", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.CONFIG_CONTROL);
 }
-#line 3632 "dhcp6_parser.cc"
+#line 3707 "dhcp6_parser.cc"
     break;
 
-  case 658:
-#line 2268 "dhcp6_parser.yy"
-    {
+  case 672: // config_control: "config-control" $@121 ":" "{" config_control_params "}"
+#line 2314 "dhcp6_parser.yy"
+                                                            {
     // No config control params are required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3642 "dhcp6_parser.cc"
+#line 3717 "dhcp6_parser.cc"
     break;
 
-  case 659:
-#line 2274 "dhcp6_parser.yy"
-    {
+  case 673: // $@122: %empty
+#line 2320 "dhcp6_parser.yy"
+                                   {
     // Parse the config-control map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3652 "dhcp6_parser.cc"
+#line 3727 "dhcp6_parser.cc"
     break;
 
-  case 660:
-#line 2278 "dhcp6_parser.yy"
-    {
+  case 674: // sub_config_control: "{" $@122 config_control_params "}"
+#line 2324 "dhcp6_parser.yy"
+                                       {
     // No config_control params are required
     // parsing completed
 }
-#line 3661 "dhcp6_parser.cc"
+#line 3736 "dhcp6_parser.cc"
     break;
 
-  case 665:
-#line 2293 "dhcp6_parser.yy"
-    {
+  case 680: // $@123: %empty
+#line 2340 "dhcp6_parser.yy"
+                                   {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-databases", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CONFIG_DATABASE);
 }
-#line 3672 "dhcp6_parser.cc"
+#line 3747 "dhcp6_parser.cc"
     break;
 
-  case 666:
-#line 2298 "dhcp6_parser.yy"
-    {
+  case 681: // config_databases: "config-databases" $@123 ":" "[" database_list "]"
+#line 2345 "dhcp6_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3681 "dhcp6_parser.cc"
+#line 3756 "dhcp6_parser.cc"
     break;
 
-  case 667:
-#line 2303 "dhcp6_parser.yy"
-    {
+  case 682: // config_fetch_wait_time: "config-fetch-wait-time" ":" "integer"
+#line 2350 "dhcp6_parser.yy"
+                                                             {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-fetch-wait-time", value);
 }
-#line 3690 "dhcp6_parser.cc"
+#line 3765 "dhcp6_parser.cc"
     break;
 
-  case 668:
-#line 2313 "dhcp6_parser.yy"
-    {
+  case 683: // $@124: %empty
+#line 2355 "dhcp6_parser.yy"
+                         {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 3773 "dhcp6_parser.cc"
+    break;
+
+  case 684: // notify_fifo: "notify-fifo" $@124 ":" "constant string"
+#line 2357 "dhcp6_parser.yy"
+               {
+    ElementPtr value(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("notify-fifo", value);
+    ctx.leave();
+}
+#line 3783 "dhcp6_parser.cc"
+    break;
+
+  case 685: // $@125: %empty
+#line 2368 "dhcp6_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 3701 "dhcp6_parser.cc"
+#line 3794 "dhcp6_parser.cc"
     break;
 
-  case 669:
-#line 2318 "dhcp6_parser.yy"
-    {
+  case 686: // logging_object: "Logging" $@125 ":" "{" logging_params "}"
+#line 2373 "dhcp6_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3710 "dhcp6_parser.cc"
+#line 3803 "dhcp6_parser.cc"
     break;
 
-  case 670:
-#line 2323 "dhcp6_parser.yy"
-    {
+  case 687: // $@126: %empty
+#line 2378 "dhcp6_parser.yy"
+                            {
     // Parse the Logging map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3720 "dhcp6_parser.cc"
+#line 3813 "dhcp6_parser.cc"
     break;
 
-  case 671:
-#line 2327 "dhcp6_parser.yy"
-    {
+  case 688: // sub_logging: "{" $@126 logging_params "}"
+#line 2382 "dhcp6_parser.yy"
+                                {
     // parsing completed
 }
-#line 3728 "dhcp6_parser.cc"
+#line 3821 "dhcp6_parser.cc"
     break;
 
-  case 675:
-#line 2343 "dhcp6_parser.yy"
-    {
+  case 692: // $@127: %empty
+#line 2398 "dhcp6_parser.yy"
+                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 3739 "dhcp6_parser.cc"
+#line 3832 "dhcp6_parser.cc"
     break;
 
-  case 676:
-#line 2348 "dhcp6_parser.yy"
-    {
+  case 693: // loggers: "loggers" $@127 ":" "[" loggers_entries "]"
+#line 2403 "dhcp6_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3748 "dhcp6_parser.cc"
+#line 3841 "dhcp6_parser.cc"
     break;
 
-  case 679:
-#line 2360 "dhcp6_parser.yy"
-    {
+  case 696: // $@128: %empty
+#line 2415 "dhcp6_parser.yy"
+                             {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 3758 "dhcp6_parser.cc"
+#line 3851 "dhcp6_parser.cc"
     break;
 
-  case 680:
-#line 2364 "dhcp6_parser.yy"
-    {
+  case 697: // logger_entry: "{" $@128 logger_params "}"
+#line 2419 "dhcp6_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 3766 "dhcp6_parser.cc"
+#line 3859 "dhcp6_parser.cc"
     break;
 
-  case 690:
-#line 2381 "dhcp6_parser.yy"
-    {
+  case 707: // debuglevel: "debuglevel" ":" "integer"
+#line 2436 "dhcp6_parser.yy"
+                                     {
     ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 3775 "dhcp6_parser.cc"
+#line 3868 "dhcp6_parser.cc"
     break;
 
-  case 691:
-#line 2386 "dhcp6_parser.yy"
-    {
+  case 708: // $@129: %empty
+#line 2441 "dhcp6_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3783 "dhcp6_parser.cc"
+#line 3876 "dhcp6_parser.cc"
     break;
 
-  case 692:
-#line 2388 "dhcp6_parser.yy"
-    {
+  case 709: // severity: "severity" $@129 ":" "constant string"
+#line 2443 "dhcp6_parser.yy"
+               {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 3793 "dhcp6_parser.cc"
+#line 3886 "dhcp6_parser.cc"
     break;
 
-  case 693:
-#line 2394 "dhcp6_parser.yy"
-    {
+  case 710: // $@130: %empty
+#line 2449 "dhcp6_parser.yy"
+                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 3804 "dhcp6_parser.cc"
+#line 3897 "dhcp6_parser.cc"
     break;
 
-  case 694:
-#line 2399 "dhcp6_parser.yy"
-    {
+  case 711: // output_options_list: "output_options" $@130 ":" "[" output_options_list_content "]"
+#line 2454 "dhcp6_parser.yy"
+                                                                    {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3813 "dhcp6_parser.cc"
+#line 3906 "dhcp6_parser.cc"
     break;
 
-  case 697:
-#line 2408 "dhcp6_parser.yy"
-    {
+  case 714: // $@131: %empty
+#line 2463 "dhcp6_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 3823 "dhcp6_parser.cc"
+#line 3916 "dhcp6_parser.cc"
     break;
 
-  case 698:
-#line 2412 "dhcp6_parser.yy"
-    {
+  case 715: // output_entry: "{" $@131 output_params_list "}"
+#line 2467 "dhcp6_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 3831 "dhcp6_parser.cc"
+#line 3924 "dhcp6_parser.cc"
     break;
 
-  case 705:
-#line 2426 "dhcp6_parser.yy"
-    {
+  case 724: // $@132: %empty
+#line 2483 "dhcp6_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3839 "dhcp6_parser.cc"
+#line 3932 "dhcp6_parser.cc"
     break;
 
-  case 706:
-#line 2428 "dhcp6_parser.yy"
-    {
+  case 725: // output: "output" $@132 ":" "constant string"
+#line 2485 "dhcp6_parser.yy"
+               {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 3849 "dhcp6_parser.cc"
+#line 3942 "dhcp6_parser.cc"
     break;
 
-  case 707:
-#line 2434 "dhcp6_parser.yy"
-    {
+  case 726: // flush: "flush" ":" "boolean"
+#line 2491 "dhcp6_parser.yy"
+                           {
     ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 3858 "dhcp6_parser.cc"
+#line 3951 "dhcp6_parser.cc"
     break;
 
-  case 708:
-#line 2439 "dhcp6_parser.yy"
-    {
+  case 727: // maxsize: "maxsize" ":" "integer"
+#line 2496 "dhcp6_parser.yy"
+                               {
     ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 3867 "dhcp6_parser.cc"
+#line 3960 "dhcp6_parser.cc"
     break;
 
-  case 709:
-#line 2444 "dhcp6_parser.yy"
-    {
+  case 728: // maxver: "maxver" ":" "integer"
+#line 2501 "dhcp6_parser.yy"
+                             {
     ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 3876 "dhcp6_parser.cc"
+#line 3969 "dhcp6_parser.cc"
     break;
 
+  case 729: // $@133: %empty
+#line 2506 "dhcp6_parser.yy"
+             {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 3977 "dhcp6_parser.cc"
+    break;
 
-#line 3880 "dhcp6_parser.cc"
+  case 730: // async: "async" $@133 ":" "constant string"
+#line 2508 "dhcp6_parser.yy"
+               {
+    ElementPtr async(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async", async);
+    ctx.leave();
+}
+#line 3987 "dhcp6_parser.cc"
+    break;
+
+  case 731: // async_queue_size: "async-queue-size" ":" "integer"
+#line 2514 "dhcp6_parser.yy"
+                                                 {
+    if (yystack_[0].value.as < int64_t > () <= 0) {
+        error(yystack_[0].location, "async-queue-size must be greater than zero");
+    }
+    ElementPtr size(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async-queue-size", size);
+}
+#line 3999 "dhcp6_parser.cc"
+    break;
+
+
+#line 4003 "dhcp6_parser.cc"
 
             default:
               break;
@@ -3893,7 +4016,6 @@ namespace isc { namespace dhcp {
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
       yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
@@ -3909,7 +4031,9 @@ namespace isc { namespace dhcp {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -3920,7 +4044,7 @@ namespace isc { namespace dhcp {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -3946,6 +4070,7 @@ namespace isc { namespace dhcp {
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
 
@@ -3954,37 +4079,39 @@ namespace isc { namespace dhcp {
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
+      error_token.state = state_type (yyn);
       yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
@@ -4016,6 +4143,7 @@ namespace isc { namespace dhcp {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -4049,18 +4177,103 @@ namespace isc { namespace dhcp {
     error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  Dhcp6Parser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  Dhcp6Parser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
+
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
+
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  Dhcp6Parser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
+
 
+  // Dhcp6Parser::context.
+  Dhcp6Parser::context::context (const Dhcp6Parser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  Dhcp6Parser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
+
+
+  int
+  Dhcp6Parser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -4079,41 +4292,32 @@ namespace isc { namespace dhcp {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  Dhcp6Parser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -4134,11 +4338,11 @@ namespace isc { namespace dhcp {
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -4147,771 +4351,794 @@ namespace isc { namespace dhcp {
   }
 
 
-  const short Dhcp6Parser::yypact_ninf_ = -875;
+  const short Dhcp6Parser::yypact_ninf_ = -897;
 
   const signed char Dhcp6Parser::yytable_ninf_ = -1;
 
   const short
   Dhcp6Parser::yypact_[] =
   {
-     428,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,    46,    70,    63,    65,
-      69,    71,    84,    93,    96,   100,   108,   130,   156,   184,
-     188,   190,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,    70,   -95,    29,    78,    41,   263,    80,   277,
-     444,   170,    43,   179,   -65,   506,    58,   291,  -875,   144,
-     273,   262,   275,   323,  -875,  -875,  -875,  -875,  -875,   332,
-    -875,    91,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,   334,   343,   353,   355,   359,   387,
-     391,   393,   394,   398,   399,   401,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,   403,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,    98,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,   405,  -875,   136,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,   408,
-     413,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,   137,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,   143,  -875,
-    -875,  -875,  -875,  -875,   415,  -875,   418,   420,  -875,  -875,
-    -875,  -875,  -875,  -875,   150,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,   320,   364,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,   419,  -875,  -875,   422,  -875,  -875,  -875,   426,
-    -875,  -875,   421,   439,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,   447,   458,  -875,
-    -875,  -875,  -875,   435,   463,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,   168,  -875,  -875,
-    -875,   466,  -875,  -875,   467,  -875,   469,   470,  -875,  -875,
-     471,   472,  -875,  -875,  -875,  -875,  -875,   182,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,   204,  -875,  -875,  -875,   473,   212,
-    -875,  -875,  -875,  -875,    70,    70,  -875,   286,   486,   487,
-     489,   492,   493,  -875,    29,  -875,   494,   495,   496,   497,
-     499,   500,   325,   326,   327,   328,   329,   335,   340,   341,
-     330,   342,   344,   346,   501,   502,   520,   522,   525,   526,
-     528,   529,   531,   532,   533,   535,   536,   537,   539,   546,
-     547,   372,   548,   549,   551,   552,   554,   555,    78,  -875,
-     556,   377,    41,  -875,   558,   559,   561,   562,   563,   386,
-     385,   566,   567,   568,   263,  -875,   569,    80,  -875,   573,
-     396,   575,   402,   404,   277,  -875,   576,   577,   583,   587,
-     608,   610,   612,  -875,   444,  -875,   614,   615,   438,   617,
-     618,   619,   440,  -875,    43,   622,   443,   445,  -875,   179,
-     624,   626,   246,  -875,   448,   627,   629,   454,   647,   474,
-     475,   648,   649,   476,   477,   650,   651,   506,  -875,    58,
-    -875,   658,   481,   291,  -875,  -875,  -875,   661,   659,   660,
-      70,    70,    70,  -875,   488,   663,   664,   665,   666,   669,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,   498,   670,   671,   672,   673,   504,   301,   676,
-     677,   678,   681,   682,   683,   685,   686,   687,   688,  -875,
-     689,   673,   690,   511,   512,   693,  -875,   694,  -875,  -875,
-     695,   696,   521,   523,   524,  -875,  -875,   694,   527,   699,
-    -875,   530,  -875,   534,  -875,   538,  -875,  -875,  -875,   694,
-     694,   694,   540,   541,   542,   543,  -875,   544,   545,  -875,
-     550,   553,   557,  -875,  -875,   560,  -875,  -875,  -875,   564,
-      70,  -875,  -875,   565,   570,  -875,   571,  -875,  -875,   248,
-     580,  -875,  -875,   -37,   572,  -875,  -875,   698,  -875,  -875,
-      70,    78,    58,  -875,  -875,  -875,  -875,   291,    41,   260,
-     260,   700,  -875,   702,   703,   705,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,   706,   -33,    70,    79,   585,   707,
-     709,   710,   157,   122,    97,  -875,   506,  -875,  -875,   711,
-    -875,  -875,   713,   721,  -875,  -875,  -875,  -875,  -875,   -48,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,   700,  -875,   220,   226,   254,   255,  -875,  -875,
-    -875,  -875,   725,   726,   728,   729,   731,  -875,   732,   733,
-    -875,  -875,  -875,   735,   736,   738,  -875,   257,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,   272,  -875,
-     662,   740,  -875,  -875,   741,   745,  -875,  -875,   743,   747,
-    -875,  -875,   748,   752,  -875,  -875,   750,   754,  -875,  -875,
-    -875,    37,  -875,  -875,  -875,   753,  -875,  -875,  -875,    82,
-    -875,  -875,  -875,  -875,   274,  -875,  -875,  -875,   200,  -875,
-    -875,   755,   757,  -875,  -875,   756,   760,  -875,   761,   762,
-     763,   764,   765,   766,   276,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,   767,   768,   769,  -875,  -875,  -875,
-    -875,   314,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,   315,  -875,  -875,  -875,   321,  -875,   211,
-    -875,   593,  -875,   758,   772,  -875,  -875,   770,   774,  -875,
-    -875,  -875,   771,  -875,   775,  -875,  -875,  -875,  -875,   776,
-     778,   779,   780,   596,   574,   603,   602,   605,   784,   607,
-     609,   786,   788,   789,   613,   616,   620,   260,  -875,  -875,
-     260,  -875,   700,   263,  -875,   702,    43,  -875,   703,   179,
-    -875,   705,   436,  -875,   706,   -33,  -875,  -875,    79,  -875,
-     790,   585,  -875,    83,   707,  -875,   444,  -875,   709,   -65,
-    -875,   710,   621,   623,   625,   628,   630,   631,   157,  -875,
-     792,   793,   632,   633,   634,   122,  -875,   795,   796,    97,
-    -875,  -875,     6,   711,  -875,  -875,   800,   798,    80,  -875,
-     713,   277,  -875,   721,   804,  -875,  -875,   425,   636,   637,
-     639,  -875,  -875,  -875,  -875,  -875,   640,  -875,  -875,   643,
-     645,   646,  -875,  -875,  -875,  -875,   322,  -875,   324,  -875,
-     794,  -875,   801,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,   362,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,   653,  -875,  -875,   807,  -875,  -875,  -875,
-    -875,  -875,   821,   833,  -875,  -875,  -875,  -875,  -875,   829,
-    -875,   363,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-     129,   657,  -875,  -875,  -875,  -875,   667,   691,  -875,  -875,
-     837,  -875,  -875,  -875,  -875,  -875,   370,  -875,  -875,  -875,
-    -875,  -875,  -875,   718,   371,  -875,   373,  -875,   720,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,   436,  -875,  -875,   846,   668,
-    -875,    83,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,   847,   701,   850,     6,  -875,  -875,  -875,  -875,  -875,
-    -875,   723,  -875,  -875,   739,  -875,   734,  -875,  -875,   852,
-    -875,  -875,   331,  -875,    75,   852,  -875,  -875,   865,   890,
-     898,   374,  -875,  -875,  -875,  -875,  -875,  -875,   903,   730,
-     742,   744,    75,  -875,   737,  -875,  -875,  -875,  -875,  -875
+     411,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,    52,    31,    39,    62,
+      68,    78,    86,   131,   133,   149,   182,   184,   197,   204,
+     210,   219,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,    31,  -113,    29,   629,    41,   251,    95,    70,
+      75,   117,    60,   169,   -45,   227,    71,   154,  -897,   234,
+     267,   285,   283,   290,  -897,  -897,  -897,  -897,  -897,   316,
+    -897,    73,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,   324,   326,   328,   356,   358,   360,
+     376,   378,   380,   381,   384,   385,   386,   389,   390,   392,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,   393,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,   138,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,   402,  -897,   192,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,   404,   405,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,   202,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,   224,  -897,  -897,
+    -897,  -897,  -897,   406,  -897,   408,   409,  -897,  -897,  -897,
+    -897,  -897,  -897,   238,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,   314,   342,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,   410,  -897,  -897,   416,  -897,  -897,  -897,   418,  -897,
+    -897,   419,   421,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,   428,   430,  -897,  -897,
+    -897,  -897,   429,   436,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,   256,  -897,  -897,  -897,
+     438,  -897,  -897,   440,  -897,   441,   449,  -897,  -897,   450,
+     452,  -897,  -897,  -897,  -897,  -897,   258,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,   260,  -897,  -897,  -897,   454,  -897,   264,
+    -897,  -897,  -897,  -897,  -897,    31,    31,  -897,   269,   458,
+     459,   460,   461,   462,  -897,    29,  -897,   469,   473,   477,
+     478,   481,   482,   266,   297,   298,   300,   301,   303,   304,
+     306,   317,   319,   320,   322,   325,   329,   330,   331,   492,
+     509,   515,   519,   520,   521,   522,   523,   524,   525,   526,
+     527,   533,   536,   539,   540,   541,   357,   542,   543,   545,
+     546,   547,   548,   629,  -897,   549,   362,    41,  -897,   552,
+     554,   555,   556,   557,   371,   370,   560,   562,   563,   251,
+    -897,   564,    95,  -897,   565,   379,   567,   382,   383,    70,
+    -897,   568,   571,   572,   573,   575,   576,   577,  -897,    75,
+    -897,   578,   579,   412,   580,   597,   598,   414,  -897,    60,
+     600,   415,   422,  -897,   169,   601,   608,   -19,  -897,   423,
+     613,   614,   431,   615,   432,   433,   616,   617,   434,   435,
+     621,   625,   227,  -897,    71,  -897,   631,   442,   633,   154,
+    -897,  -897,  -897,   634,   632,   635,    31,    31,    31,  -897,
+     456,   637,   644,   645,   646,   649,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,   467,   654,   655,   656,   657,   472,   310,   658,
+     660,   661,   662,   663,   664,   666,   667,   687,   688,  -897,
+     689,   657,   690,   483,   508,   694,  -897,   695,  -897,  -897,
+     696,   697,   513,   514,   516,  -897,  -897,   695,   517,   698,
+    -897,   518,  -897,   529,  -897,   530,  -897,  -897,  -897,   695,
+     695,   695,   531,   532,   538,   550,  -897,   551,   558,  -897,
+     559,   561,   566,  -897,  -897,   569,  -897,  -897,  -897,   570,
+      31,  -897,  -897,   574,   581,  -897,   582,  -897,  -897,    46,
+     -24,  -897,  -897,   -67,   583,  -897,  -897,   704,  -897,   584,
+    -897,    31,   629,    71,  -897,  -897,  -897,  -897,   154,    41,
+      72,    72,   703,  -897,   706,   707,   708,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,   709,   -30,    31,   242,   618,
+     723,   724,   725,   135,    35,    53,  -897,   227,  -897,  -897,
+     726,  -897,  -897,   728,   729,  -897,  -897,  -897,  -897,  -897,
+     -41,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,   703,  -897,  -897,   268,   270,
+     271,   274,  -897,  -897,  -897,  -897,   733,   734,   735,   738,
+     740,  -897,   741,   743,  -897,  -897,  -897,   746,   748,   750,
+     751,  -897,   278,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,   280,  -897,   752,   665,  -897,  -897,
+     757,   754,  -897,  -897,   761,   765,  -897,  -897,   763,   767,
+    -897,  -897,   769,   773,  -897,  -897,  -897,    80,  -897,  -897,
+    -897,   771,  -897,  -897,  -897,   173,  -897,  -897,  -897,  -897,
+     284,  -897,  -897,  -897,   351,  -897,  -897,   772,   776,  -897,
+    -897,   774,   778,  -897,   779,   780,   781,   782,   783,   786,
+     287,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+     788,   789,   790,  -897,  -897,  -897,  -897,   305,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,   308,
+    -897,  -897,  -897,   309,  -897,   355,  -897,   592,  -897,   791,
+     792,  -897,  -897,   793,   795,  -897,  -897,  -897,   794,  -897,
+     797,  -897,  -897,  -897,  -897,   796,   800,   801,   802,   605,
+     619,   610,   620,   623,   803,   624,   626,   804,   805,   806,
+     627,   630,   636,   639,    72,  -897,  -897,    72,  -897,   703,
+     251,  -897,   706,    60,  -897,   707,   169,  -897,   708,   453,
+    -897,   709,   -30,  -897,  -897,   242,  -897,   807,   618,  -897,
+      90,   723,  -897,    75,  -897,   724,   -45,  -897,   725,   640,
+     641,   642,   643,   647,   648,   135,  -897,   812,   816,   650,
+     651,   652,    35,  -897,   818,   819,    53,  -897,  -897,    79,
+     726,  -897,  -897,   820,   821,    95,  -897,   728,    70,  -897,
+     729,   823,  -897,  -897,    96,   638,   671,   673,  -897,  -897,
+    -897,  -897,  -897,   674,  -897,  -897,   675,   678,   685,  -897,
+    -897,  -897,  -897,  -897,   311,  -897,   315,  -897,   817,  -897,
+     827,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,   318,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,   691,  -897,  -897,   832,  -897,  -897,  -897,  -897,
+    -897,   829,   837,  -897,  -897,  -897,  -897,  -897,   836,  -897,
+     321,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,   122,
+     720,  -897,  -897,  -897,  -897,   731,   736,  -897,  -897,   841,
+    -897,  -897,  -897,  -897,  -897,   338,  -897,  -897,  -897,  -897,
+    -897,  -897,   739,   339,  -897,   340,  -897,   744,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,   453,  -897,  -897,   843,   684,  -897,
+      90,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+     844,   705,   847,    79,  -897,  -897,  -897,  -897,  -897,  -897,
+     753,  -897,  -897,   848,  -897,   755,  -897,  -897,   849,  -897,
+    -897,   375,  -897,    45,   849,  -897,  -897,   850,   874,   875,
+    -897,   882,   341,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,   895,   749,   737,   760,   927,   762,    45,  -897,   764,
+    -897,  -897,  -897,   766,  -897,  -897,  -897,  -897
   };
 
-  const unsigned short
+  const short
   Dhcp6Parser::yydefact_[] =
   {
        0,     2,     4,     6,     8,    10,    12,    14,    16,    18,
       20,    22,    24,    26,    28,    30,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     1,    47,    40,    36,    35,    32,    33,    34,
-      39,     3,    37,    38,    60,     5,    72,     7,   137,     9,
-     284,    11,   444,    13,   469,    15,   499,    17,   369,    19,
-     377,    21,   414,    23,   249,    25,   598,    27,   670,    29,
-     659,    31,    49,    43,     0,     0,     0,     0,     0,     0,
-     501,     0,   379,   416,     0,     0,     0,     0,    51,     0,
-      50,     0,     0,    44,    70,   668,   651,   653,   655,     0,
-      69,     0,    62,    64,    66,    67,    68,    65,   119,   657,
-     135,   149,   151,   153,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   133,   276,   367,   406,
-     457,   459,   325,   333,   222,   239,   230,   215,   536,   491,
-     241,   260,   557,     0,   581,   594,   596,   647,   649,   675,
-     118,     0,    74,    76,    77,    78,    79,    80,    81,    82,
-      83,    84,   112,   113,   114,    85,   110,    88,    89,    90,
-      91,   107,    92,    94,    93,    98,    99,    86,   111,    87,
-      96,    97,   105,   106,   108,    95,   100,   101,   102,   103,
-     104,   116,   117,   109,   115,   146,     0,   145,     0,   139,
-     141,   142,   143,   144,   436,   461,   315,   317,   319,     0,
-       0,   323,   321,   530,   314,   288,   289,   290,   291,   292,
-     293,   294,   295,   311,   312,   313,     0,   286,   299,   300,
-     301,   304,   305,   307,   302,   303,   296,   297,   309,   310,
-     298,   306,   308,   455,   454,   450,   451,   449,     0,   446,
-     448,   452,   453,   484,     0,   487,     0,     0,   483,   477,
-     478,   476,   481,   482,     0,   471,   473,   474,   479,   480,
-     475,   528,   516,   518,   520,   522,   524,   526,   515,   512,
-     513,   514,     0,   502,   503,   507,   508,   505,   509,   510,
-     511,   506,     0,   396,   196,     0,   400,   398,   403,     0,
-     392,   393,     0,   380,   381,   383,   395,   384,   385,   386,
-     402,   387,   388,   389,   390,   391,   430,     0,     0,   428,
-     429,   432,   433,     0,   417,   418,   420,   421,   422,   423,
-     424,   425,   426,   427,   256,   258,   253,     0,   251,   254,
-     255,     0,   621,   623,     0,   626,     0,     0,   630,   634,
-       0,     0,   638,   645,   619,   617,   618,     0,   600,   602,
-     603,   604,   605,   606,   607,   608,   609,   610,   611,   612,
-     613,   614,   615,   616,     0,   672,   674,   665,     0,     0,
-     661,   663,   664,    48,     0,     0,    41,     0,     0,     0,
-       0,     0,     0,    59,     0,    61,     0,     0,     0,     0,
+      39,     3,    37,    38,    60,     5,    72,     7,   145,     9,
+     294,    11,   456,    13,   481,    15,   511,    17,   381,    19,
+     389,    21,   426,    23,   259,    25,   610,    27,   687,    29,
+     673,    31,    49,    43,     0,     0,     0,     0,     0,     0,
+     513,     0,   391,   428,     0,     0,     0,     0,    51,     0,
+      50,     0,     0,    44,    70,   685,   665,   667,   669,     0,
+      69,     0,    62,    64,    66,    67,    68,    65,   123,   671,
+     143,   157,   159,   161,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     141,   286,   379,   418,   469,   471,   336,   344,   232,   249,
+     240,   225,   548,   503,   251,   270,   569,     0,   593,   606,
+     608,   661,   663,   692,   122,     0,    74,    76,    77,    78,
+      79,    80,    81,    82,    83,    84,   112,   113,   114,   115,
+     116,   117,   118,    85,   110,    88,    89,    90,    91,   107,
+      92,    94,    93,    98,    99,    86,   111,    87,    96,    97,
+     105,   106,   108,    95,   100,   101,   102,   103,   104,   120,
+     121,   109,   119,   154,     0,   153,     0,   147,   149,   150,
+     151,   152,   448,   473,   326,   328,   330,     0,     0,   334,
+     332,   542,   325,   298,   299,   300,   301,   302,   303,   304,
+     305,   321,   322,   323,   324,     0,   296,   309,   310,   311,
+     314,   315,   317,   312,   313,   306,   307,   319,   320,   308,
+     316,   318,   467,   466,   462,   463,   461,     0,   458,   460,
+     464,   465,   496,     0,   499,     0,     0,   495,   489,   490,
+     488,   493,   494,     0,   483,   485,   486,   491,   492,   487,
+     540,   528,   530,   532,   534,   536,   538,   527,   524,   525,
+     526,     0,   514,   515,   519,   520,   517,   521,   522,   523,
+     518,     0,   408,   205,     0,   412,   410,   415,     0,   404,
+     405,     0,   392,   393,   395,   407,   396,   397,   398,   414,
+     399,   400,   401,   402,   403,   442,     0,     0,   440,   441,
+     444,   445,     0,   429,   430,   432,   433,   434,   435,   436,
+     437,   438,   439,   266,   268,   263,     0,   261,   264,   265,
+       0,   633,   635,     0,   638,     0,     0,   642,   646,     0,
+       0,   652,   659,   631,   629,   630,     0,   612,   614,   615,
+     616,   617,   618,   619,   620,   621,   622,   623,   624,   625,
+     626,   627,   628,     0,   689,   691,   680,     0,   683,     0,
+     675,   677,   678,   679,    48,     0,     0,    41,     0,     0,
+       0,     0,     0,     0,    59,     0,    61,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    73,     0,     0,     0,   146,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    73,
-       0,     0,     0,   138,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   285,     0,     0,   445,     0,
-       0,     0,     0,     0,     0,   470,     0,     0,     0,     0,
-       0,     0,     0,   500,     0,   370,     0,     0,     0,     0,
-       0,     0,     0,   378,     0,     0,     0,     0,   415,     0,
-       0,     0,     0,   250,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   599,     0,
-     671,     0,     0,     0,   660,    52,    45,     0,     0,     0,
-       0,     0,     0,    63,     0,     0,     0,     0,     0,     0,
-     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
-     131,   132,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   580,
-       0,     0,     0,     0,     0,     0,    75,     0,   148,   140,
-       0,     0,     0,     0,     0,   331,   332,     0,     0,     0,
-     287,     0,   447,     0,   486,     0,   489,   490,   472,     0,
-       0,     0,     0,     0,     0,     0,   504,     0,     0,   394,
-       0,     0,     0,   405,   382,     0,   434,   435,   419,     0,
-       0,   252,   620,     0,     0,   625,     0,   628,   629,     0,
-       0,   636,   637,     0,     0,   601,   673,     0,   667,   662,
-       0,     0,     0,   652,   654,   656,   120,     0,     0,     0,
-       0,   155,   134,   278,   371,   408,    42,   458,   460,   327,
-     328,   329,   330,   326,   335,     0,    49,     0,     0,     0,
-     493,   243,     0,     0,     0,   595,     0,   648,   650,     0,
-      53,   147,   438,   463,   316,   318,   320,   324,   322,     0,
-     456,   485,   488,   529,   517,   519,   521,   523,   525,   527,
-     397,   197,   401,   399,   404,   431,   257,   259,   622,   624,
-     627,   632,   633,   631,   635,   640,   641,   642,   643,   644,
-     639,   646,   155,    46,     0,     0,     0,     0,   183,   189,
-     191,   193,     0,     0,     0,     0,     0,   206,     0,     0,
-     209,   211,   213,     0,     0,     0,   182,     0,   161,   163,
-     164,   165,   166,   167,   168,   169,   170,   171,   172,   175,
-     176,   177,   178,   173,   174,   179,   180,   181,     0,   159,
-       0,   156,   157,   282,     0,   279,   280,   375,     0,   372,
-     373,   412,     0,   409,   410,   339,     0,   336,   337,   228,
-     229,     0,   224,   226,   227,     0,   237,   238,   234,     0,
-     232,   235,   236,   220,     0,   217,   219,   540,     0,   538,
-     497,     0,   494,   495,   247,     0,   244,   245,     0,     0,
-       0,     0,     0,     0,     0,   262,   264,   265,   266,   267,
-     268,   269,   570,   576,     0,     0,     0,   569,   566,   567,
-     568,     0,   559,   561,   564,   562,   563,   565,   590,   592,
-     589,   587,   588,     0,   583,   585,   586,     0,   679,     0,
-     677,    55,   442,     0,   439,   440,   467,     0,   464,   465,
-     534,   533,     0,   532,     0,    71,   669,   658,   136,     0,
+     295,     0,     0,   457,     0,     0,     0,     0,     0,     0,
+     482,     0,     0,     0,     0,     0,     0,     0,   512,     0,
+     382,     0,     0,     0,     0,     0,     0,     0,   390,     0,
+       0,     0,     0,   427,     0,     0,     0,     0,   260,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   150,   152,
-       0,   154,     0,     0,   277,     0,   379,   368,     0,   416,
-     407,     0,     0,   334,     0,     0,   223,   240,     0,   231,
-       0,     0,   216,   542,     0,   537,   501,   492,     0,     0,
-     242,     0,     0,     0,     0,     0,     0,     0,     0,   261,
-       0,     0,     0,     0,     0,     0,   558,     0,     0,     0,
-     582,   597,     0,     0,   676,    57,     0,    56,     0,   437,
-       0,     0,   462,     0,     0,   531,   666,     0,     0,     0,
-       0,   195,   198,   199,   200,   201,     0,   208,   202,     0,
-       0,     0,   203,   204,   205,   162,     0,   158,     0,   281,
-       0,   374,     0,   411,   366,   354,   355,   356,   358,   359,
-     360,   347,   348,   363,   364,   365,   343,   344,   345,   346,
-     352,   353,   351,   357,     0,   341,   349,   361,   362,   350,
-     338,   225,   233,     0,   218,   554,     0,   552,   553,   549,
-     550,   551,     0,   543,   544,   546,   547,   548,   539,     0,
-     496,     0,   246,   270,   271,   272,   273,   274,   275,   263,
-       0,     0,   575,   578,   579,   560,     0,     0,   584,   693,
-       0,   691,   689,   683,   687,   688,     0,   681,   685,   686,
-     684,   678,    54,     0,     0,   441,     0,   466,     0,   185,
-     186,   187,   188,   184,   190,   192,   194,   207,   210,   212,
-     214,   160,   283,   376,   413,     0,   340,   221,     0,     0,
-     541,     0,   498,   248,   572,   573,   574,   571,   577,   591,
-     593,     0,     0,     0,     0,   680,    58,   443,   468,   535,
-     342,     0,   556,   545,     0,   690,     0,   682,   555,     0,
-     692,   697,     0,   695,     0,     0,   694,   705,     0,     0,
-       0,     0,   699,   701,   702,   703,   704,   696,     0,     0,
-       0,     0,     0,   698,     0,   707,   708,   709,   700,   706
+       0,     0,     0,   611,     0,   688,     0,     0,     0,     0,
+     674,    52,    45,     0,     0,     0,     0,     0,     0,    63,
+       0,     0,     0,     0,     0,     0,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
+     139,   140,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   592,
+       0,     0,     0,     0,     0,     0,    75,     0,   156,   148,
+       0,     0,     0,     0,     0,   342,   343,     0,     0,     0,
+     297,     0,   459,     0,   498,     0,   501,   502,   484,     0,
+       0,     0,     0,     0,     0,     0,   516,     0,     0,   406,
+       0,     0,     0,   417,   394,     0,   446,   447,   431,     0,
+       0,   262,   632,     0,     0,   637,     0,   640,   641,     0,
+       0,   650,   651,     0,     0,   613,   690,     0,   682,     0,
+     676,     0,     0,     0,   666,   668,   670,   124,     0,     0,
+       0,     0,   163,   142,   288,   383,   420,    42,   470,   472,
+     338,   339,   340,   341,   337,   346,     0,    49,     0,     0,
+       0,   505,   253,     0,     0,     0,   607,     0,   662,   664,
+       0,    53,   155,   450,   475,   327,   329,   331,   335,   333,
+       0,   468,   497,   500,   541,   529,   531,   533,   535,   537,
+     539,   409,   206,   413,   411,   416,   443,   267,   269,   634,
+     636,   639,   644,   645,   643,   648,   649,   647,   654,   655,
+     656,   657,   658,   653,   660,   163,   684,    46,     0,     0,
+       0,     0,   192,   198,   200,   202,     0,     0,     0,     0,
+       0,   216,     0,     0,   219,   221,   223,     0,     0,     0,
+       0,   191,     0,   169,   171,   172,   173,   174,   175,   176,
+     177,   178,   179,   180,   183,   184,   185,   186,   187,   181,
+     182,   188,   189,   190,     0,   167,     0,   164,   165,   292,
+       0,   289,   290,   387,     0,   384,   385,   424,     0,   421,
+     422,   350,     0,   347,   348,   238,   239,     0,   234,   236,
+     237,     0,   247,   248,   244,     0,   242,   245,   246,   230,
+       0,   227,   229,   552,     0,   550,   509,     0,   506,   507,
+     257,     0,   254,   255,     0,     0,     0,     0,     0,     0,
+       0,   272,   274,   275,   276,   277,   278,   279,   582,   588,
+       0,     0,     0,   581,   578,   579,   580,     0,   571,   573,
+     576,   574,   575,   577,   602,   604,   601,   599,   600,     0,
+     595,   597,   598,     0,   696,     0,   694,    55,   454,     0,
+     451,   452,   479,     0,   476,   477,   546,   545,     0,   544,
+       0,    71,   686,   672,   144,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   158,   160,     0,   162,     0,
+       0,   287,     0,   391,   380,     0,   428,   419,     0,     0,
+     345,     0,     0,   233,   250,     0,   241,     0,     0,   226,
+     554,     0,   549,   513,   504,     0,     0,   252,     0,     0,
+       0,     0,     0,     0,     0,     0,   271,     0,     0,     0,
+       0,     0,     0,   570,     0,     0,     0,   594,   609,     0,
+       0,   693,    57,     0,    56,     0,   449,     0,     0,   474,
+       0,     0,   543,   681,     0,     0,     0,     0,   204,   207,
+     208,   209,   210,     0,   218,   211,     0,     0,     0,   212,
+     213,   214,   215,   170,     0,   166,     0,   291,     0,   386,
+       0,   423,   378,   365,   366,   367,   369,   370,   371,   358,
+     359,   374,   375,   376,   377,   354,   355,   356,   357,   363,
+     364,   362,   368,     0,   352,   360,   372,   373,   361,   349,
+     235,   243,     0,   228,   566,     0,   564,   565,   561,   562,
+     563,     0,   555,   556,   558,   559,   560,   551,     0,   508,
+       0,   256,   280,   281,   282,   283,   284,   285,   273,     0,
+       0,   587,   590,   591,   572,     0,     0,   596,   710,     0,
+     708,   706,   700,   704,   705,     0,   698,   702,   703,   701,
+     695,    54,     0,     0,   453,     0,   478,     0,   194,   195,
+     196,   197,   193,   199,   201,   203,   217,   220,   222,   224,
+     168,   293,   388,   425,     0,   351,   231,     0,     0,   553,
+       0,   510,   258,   584,   585,   586,   583,   589,   603,   605,
+       0,     0,     0,     0,   697,    58,   455,   480,   547,   353,
+       0,   568,   557,     0,   707,     0,   699,   567,     0,   709,
+     714,     0,   712,     0,     0,   711,   724,     0,     0,     0,
+     729,     0,     0,   716,   718,   719,   720,   721,   722,   723,
+     713,     0,     0,     0,     0,     0,     0,     0,   715,     0,
+     726,   727,   728,     0,   731,   717,   725,   730
   };
 
   const short
   Dhcp6Parser::yypgoto_[] =
   {
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,    54,  -875,  -480,
-    -875,   366,  -875,  -875,  -875,  -875,   267,  -875,  -389,  -875,
-    -875,  -875,   -74,  -875,  -875,  -875,   578,  -875,  -875,  -875,
-    -875,   285,   490,  -875,  -875,   -70,   -46,   -40,   -36,   -22,
-     -17,   -14,     3,     7,    10,    15,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,   287,   491,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,   217,  -875,    38,  -875,  -622,    44,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-     -21,  -875,  -650,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,    21,  -875,  -875,  -875,  -875,  -875,    30,  -641,
-    -875,  -875,  -875,  -875,    26,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,    17,  -875,  -875,  -875,    20,   449,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,     8,  -875,  -875,  -875,
-    -875,  -875,  -875,  -874,  -875,  -875,  -875,    47,  -875,  -875,
-    -875,    51,   503,  -875,  -875,  -869,  -875,  -867,  -875,   -11,
-    -875,    -5,  -875,    18,  -875,  -875,  -875,  -866,  -875,  -875,
-    -875,  -875,    45,  -875,  -875,  -140,   866,  -875,  -875,  -875,
-    -875,  -875,    50,  -875,  -875,  -875,    55,  -875,   468,  -875,
-     -69,  -875,  -875,  -875,  -875,  -875,   -66,  -875,  -875,  -875,
-    -875,  -875,   -58,  -875,  -875,  -875,    49,  -875,  -875,  -875,
-      56,  -875,   464,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,     4,  -875,  -875,  -875,    11,   505,
-    -875,  -875,   -53,  -875,   -29,  -875,  -875,  -875,  -875,  -875,
-       5,  -875,  -875,  -875,     9,   507,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,   -62,  -875,  -875,  -875,    48,  -875,  -875,
-    -875,    40,  -875,   508,   282,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -864,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,    53,  -875,  -875,  -875,
-    -128,  -875,  -875,  -875,  -875,  -875,  -875,  -875,    33,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,    25,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,   299,   462,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,   -73,  -875,   -51,  -875,
-    -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,  -875,
-     333,   460,  -875,  -875,  -875,  -875,  -875,  -875,  -875,   345,
-     465,   -44,  -875,  -875,    32,  -875,  -875,  -126,  -875,  -875,
-    -875,  -875,  -875,  -875,  -149,  -875,  -875,  -163,  -875,  -875,
-    -875,  -875,  -875
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,    -4,  -897,  -502,
+    -897,   374,  -897,  -897,  -897,  -897,   275,  -897,  -403,  -897,
+    -897,  -897,   -74,  -897,  -897,  -897,   553,  -897,  -897,  -897,
+    -897,   307,   504,  -897,  -897,   -70,   -46,   -40,   -36,   -22,
+     -17,   -14,     3,     7,    10,    15,    18,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,   302,   503,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,   228,  -897,
+      43,  -897,  -633,    51,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,   -21,  -897,  -668,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,    28,  -897,  -897,
+    -897,  -897,  -897,    36,  -660,  -897,  -897,  -897,  -897,    34,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,    23,  -897,
+    -897,  -897,    26,   468,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,    19,  -897,  -897,  -897,  -897,  -897,  -897,  -896,  -897,
+    -897,  -897,    54,  -897,  -897,  -897,    57,   510,  -897,  -897,
+    -894,  -897,  -886,  -897,   -11,  -897,    -5,  -897,    21,  -897,
+    -897,  -897,  -885,  -897,  -897,  -897,  -897,    47,  -897,  -897,
+    -134,   900,  -897,  -897,  -897,  -897,  -897,    58,  -897,  -897,
+    -897,    59,  -897,   485,  -897,   -69,  -897,  -897,  -897,  -897,
+    -897,   -66,  -897,  -897,  -897,  -897,  -897,   -58,  -897,  -897,
+    -897,    61,  -897,  -897,  -897,    64,  -897,   484,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,     8,
+    -897,  -897,  -897,    11,   528,  -897,  -897,   -53,  -897,   -29,
+    -897,  -897,  -897,  -897,  -897,    12,  -897,  -897,  -897,     9,
+     512,  -897,  -897,  -897,  -897,  -897,  -897,  -897,   -62,  -897,
+    -897,  -897,    48,  -897,  -897,  -897,    55,  -897,   505,   295,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -884,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,    56,  -897,  -897,  -897,  -124,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,    37,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,    38,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,   323,   479,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,   -73,  -897,   -51,  -897,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,   344,   474,  -897,  -897,
+    -897,  -897,  -897,  -897,  -897,  -897,  -897,   352,   487,   -44,
+    -897,  -897,    42,  -897,  -897,  -127,  -897,  -897,  -897,  -897,
+    -897,  -897,  -147,  -897,  -897,  -169,  -897,  -897,  -897,  -897,
+    -897,  -897,  -897,  -897
   };
 
   const short
   Dhcp6Parser::yydefgoto_[] =
   {
-      -1,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+       0,    16,    17,    18,    19,    20,    21,    22,    23,    24,
       25,    26,    27,    28,    29,    30,    31,    88,    41,    42,
-      73,   647,    92,    93,    43,    72,    89,    90,   671,   851,
-     946,   947,   736,    45,    74,   101,   102,   103,   388,    47,
-      75,   151,   152,   153,   396,   154,   155,   156,   157,   158,
-     159,   160,   161,   162,   163,   164,   165,   166,   414,   167,
-     398,    49,    76,   198,   199,   200,   440,   201,   168,   399,
-     169,   400,   170,   401,   760,   761,   762,   890,   737,   738,
-     739,   869,  1073,   740,   870,   741,   871,   742,   872,   743,
-     744,   477,   745,   746,   747,   748,   749,   750,   751,   752,
-     753,   878,   754,   755,   881,   756,   882,   757,   883,   171,
-     425,   794,   795,   796,   910,   172,   422,   781,   782,   783,
-     784,   173,   424,   789,   790,   791,   792,   174,   423,   175,
-     428,   805,   806,   807,   919,    65,    84,   337,   338,   339,
-     490,   340,   491,   176,   429,   814,   815,   816,   817,   818,
-     819,   820,   821,   177,   415,   764,   765,   766,   893,    51,
-      77,   226,   227,   228,   446,   229,   447,   230,   448,   231,
-     452,   232,   451,   178,   420,   653,   234,   235,   179,   421,
-     776,   777,   778,   902,  1004,  1005,   180,   416,    59,    81,
-     768,   769,   770,   896,    61,    82,   302,   303,   304,   305,
-     306,   307,   308,   476,   309,   480,   310,   479,   311,   312,
-     481,   313,   181,   417,   772,   773,   774,   899,    63,    83,
-     323,   324,   325,   326,   327,   485,   328,   329,   330,   331,
-     237,   444,   853,   854,   855,   948,    53,    78,   248,   249,
-     250,   456,   182,   418,   183,   419,   240,   445,   857,   858,
-     859,   951,    55,    79,   264,   265,   266,   459,   267,   268,
-     461,   269,   270,   184,   427,   801,   802,   803,   916,    57,
-      80,   282,   283,   284,   285,   467,   286,   468,   287,   469,
-     288,   470,   289,   471,   290,   472,   291,   466,   242,   453,
-     862,   863,   954,   185,   426,   798,   799,   913,  1022,  1023,
-    1024,  1025,  1026,  1088,  1027,   186,   430,   831,   832,   833,
-     930,  1097,   834,   835,   931,   836,   837,   187,   188,   432,
-     843,   844,   845,   937,   846,   938,   189,   433,   190,   434,
-      67,    85,   357,   358,   359,   360,   495,   361,   496,   362,
-     363,   498,   364,   365,   366,   501,   703,   367,   502,   368,
-     369,   370,   505,   710,   371,   506,   191,   435,   192,   436,
-     104,   390,   105,   391,   106,   392,   193,   397,    71,    87,
-     379,   380,   381,   511,   382,   107,   389,    69,    86,   374,
-     375,   194,   437,   849,   850,   942,  1056,  1057,  1058,  1059,
-    1103,  1060,  1101,  1122,  1123,  1124,  1131,  1132,  1133,  1138,
-    1134,  1135,  1136
+      73,   668,    92,    93,    43,    72,    89,    90,   692,   877,
+     973,   974,   761,    45,    74,   101,   102,   103,   399,    47,
+      75,   155,   156,   157,   407,   158,   159,   160,   161,   162,
+     163,   164,   165,   166,   167,   168,   169,   170,   171,   172,
+     173,   174,   429,   175,   409,    49,    76,   206,   207,   208,
+     455,   209,   176,   410,   177,   411,   178,   412,   786,   787,
+     788,   917,   762,   763,   764,   895,  1102,   765,   896,   766,
+     897,   767,   898,   768,   769,   492,   770,   771,   772,   773,
+     774,   775,   776,   777,   778,   779,   904,   780,   781,   907,
+     782,   908,   783,   909,   179,   440,   820,   821,   822,   937,
+     180,   437,   807,   808,   809,   810,   181,   439,   815,   816,
+     817,   818,   182,   438,   183,   443,   831,   832,   833,   946,
+      65,    84,   346,   347,   348,   505,   349,   506,   184,   444,
+     840,   841,   842,   843,   844,   845,   846,   847,   185,   430,
+     790,   791,   792,   920,    51,    77,   235,   236,   237,   461,
+     238,   462,   239,   463,   240,   467,   241,   466,   186,   435,
+     674,   243,   244,   187,   436,   802,   803,   804,   929,  1033,
+    1034,   188,   431,    59,    81,   794,   795,   796,   923,    61,
+      82,   311,   312,   313,   314,   315,   316,   317,   491,   318,
+     495,   319,   494,   320,   321,   496,   322,   189,   432,   798,
+     799,   800,   926,    63,    83,   332,   333,   334,   335,   336,
+     500,   337,   338,   339,   340,   246,   459,   879,   880,   881,
+     975,    53,    78,   257,   258,   259,   471,   190,   433,   191,
+     434,   249,   460,   883,   884,   885,   978,    55,    79,   273,
+     274,   275,   474,   276,   277,   476,   278,   279,   192,   442,
+     827,   828,   829,   943,    57,    80,   291,   292,   293,   294,
+     482,   295,   483,   296,   484,   297,   485,   298,   486,   299,
+     487,   300,   481,   251,   468,   888,   889,   981,   193,   441,
+     824,   825,   940,  1051,  1052,  1053,  1054,  1055,  1117,  1056,
+     194,   445,   857,   858,   859,   957,  1126,   860,   861,   958,
+     862,   863,   195,   196,   447,   869,   870,   871,   964,   872,
+     965,   197,   448,   198,   449,    67,    85,   366,   367,   368,
+     369,   510,   370,   511,   371,   372,   513,   373,   374,   375,
+     516,   724,   376,   517,   727,   377,   378,   379,   520,   733,
+     380,   521,   199,   450,   200,   451,   104,   401,   105,   402,
+     106,   403,   201,   408,    71,    87,   389,   390,   391,   526,
+     392,   393,   528,   107,   400,    69,    86,   383,   384,   202,
+     452,   875,   876,   969,  1085,  1086,  1087,  1088,  1132,  1089,
+    1130,  1151,  1152,  1153,  1162,  1163,  1164,  1171,  1165,  1166,
+    1167,  1168,  1175,  1169
   };
 
-  const unsigned short
+  const short
   Dhcp6Parser::yytable_[] =
   {
-     100,   150,   197,   214,   244,   258,   278,   215,   300,   319,
-     336,   354,   372,   828,   321,   241,   788,   322,   758,   236,
-     247,   261,   279,   202,   238,   251,   262,   280,   997,   314,
-     332,   216,   355,   998,   373,   999,  1003,   217,  1009,    94,
-     905,   218,   376,   906,   334,   335,    32,   203,   239,   252,
-     263,   281,   272,   315,   333,   219,   356,   195,   196,   860,
-     220,   301,   320,   221,   293,   294,   646,   245,   259,   779,
-      44,    40,    46,   246,   260,    33,    48,    34,    50,    35,
-     222,   646,   130,   131,   223,   908,    91,   224,   909,   108,
-     109,    52,   225,   110,   394,   233,   111,   112,   113,   395,
-      54,   438,   294,    56,   295,   296,   439,    58,   297,   298,
-     299,   705,   706,   707,   708,    60,    99,   130,   131,   130,
-     131,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-     123,   124,   125,   126,   127,   128,   129,    62,   129,   442,
-     454,   129,   294,   822,   443,   455,   457,   709,   780,   243,
-     383,   458,   723,   464,   130,   131,   130,   131,   465,   130,
-     131,   132,  1049,    64,  1050,  1051,   133,   134,   135,   136,
-     137,   492,   138,   130,   131,   211,   493,   139,   212,  1015,
-    1016,   779,   786,    95,   787,   507,   140,    99,   677,   141,
-     508,    66,    96,    97,    98,    68,   142,    70,   130,   131,
-     683,   684,   685,   914,   143,   144,   915,   509,   145,   146,
-      99,   997,   510,   149,   943,   513,   998,   944,   999,  1003,
-     514,  1009,    99,   438,    99,   838,   839,   128,   865,   509,
-     147,   148,  1127,   149,   866,  1128,  1129,  1130,   294,   316,
-     295,   296,   317,   318,   823,   824,   825,   826,  1094,  1095,
-    1096,    36,    37,    38,    39,   130,   131,   513,   442,    99,
-     887,    99,   867,   868,    99,   888,   385,   788,   976,   808,
-     809,   810,   811,   812,   813,   887,   384,   911,    99,   928,
-     889,   718,   912,   386,   929,   828,   719,   720,   721,   722,
-     723,   724,   725,   726,   727,   728,   729,   730,   731,   732,
-     733,   734,   735,    99,   377,   378,   114,   115,   116,   117,
-     118,   119,   120,   121,   122,   123,   124,   935,   939,   294,
-     100,   129,   936,   940,   507,   887,   387,   454,   473,   941,
-    1081,   204,  1082,   205,  1125,   129,   393,  1126,   402,   130,
-     131,   206,   207,   208,   209,   210,   132,   403,   253,   254,
-     255,   256,   257,   130,   131,   334,   335,   404,   211,   405,
-      99,   212,   139,   406,   150,  1085,   492,   474,   197,   213,
-    1086,  1093,   211,  1104,   457,   212,   464,  1142,  1105,  1107,
-     214,  1108,  1143,   244,   215,   649,   650,   651,   652,   202,
-     258,   407,   241,   701,   702,   408,   236,   409,   410,   247,
-     278,   238,   411,   412,   251,   413,   261,   431,   216,   441,
-     300,   262,   449,   203,   217,   319,   279,   450,   218,   460,
-     321,   280,   462,   322,   463,   239,   478,   475,   252,   483,
-     482,   314,   219,   354,   372,   263,   332,   220,   515,   516,
-     221,    99,   484,   488,    99,   281,   245,  1069,  1070,  1071,
-    1072,   486,   246,   259,   355,   315,   373,   222,    99,   260,
-     333,   223,   487,   301,   224,   376,   489,   517,   320,   225,
-     494,   497,   233,   499,   500,   503,   504,   512,   356,   114,
-     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
-     518,   519,   127,   520,   129,   294,   521,   522,   524,   525,
-     526,   527,   129,   528,   529,   542,   543,   530,   531,   532,
-     533,   534,   130,   131,   538,   207,   208,   535,   210,   132,
-     130,   131,   536,   537,   544,   539,   545,   540,   541,   546,
-     547,   211,   548,   549,   212,   550,   551,   552,   271,   553,
-     554,   555,   213,   556,   272,   273,   274,   275,   276,   277,
-     557,   558,   560,   561,   559,   562,   563,   150,   564,   565,
-     567,   568,   570,   571,   197,   572,   573,   574,   575,   576,
-     577,   578,   579,   581,   633,   634,   635,   583,   584,   585,
-     589,   590,   130,   131,   586,   202,   587,   591,   376,   827,
-     840,   592,   354,   372,     1,     2,     3,     4,     5,     6,
-       7,     8,     9,    10,    11,    12,    13,    14,    15,   203,
-     829,   841,   593,   355,   594,   373,   595,    99,   597,   598,
-     599,   600,   601,   602,   603,    99,   605,   606,   609,   607,
-     610,   613,   612,   614,   830,   842,   615,   356,   341,   342,
-     343,   344,   345,   346,   347,   348,   349,   350,   351,   352,
-     353,   616,   619,   620,   623,   624,   617,   618,   147,   148,
-     621,   622,   627,   628,   697,   630,   631,   632,   891,   636,
-     637,   638,   639,   640,   641,   643,   644,   645,   793,   642,
-      34,   654,   655,   656,   713,   648,   657,    99,   659,   658,
-     660,   661,   667,   668,   662,   663,   664,   666,   669,   670,
-     672,   673,   674,   712,   675,   676,   679,   759,   678,   763,
-     767,   680,   771,   775,   797,   681,   800,   804,   848,   682,
-     852,   686,   687,   688,   689,   690,   691,   704,   856,   873,
-     874,   692,   875,   876,   693,   877,   879,   880,   694,   884,
-     885,   695,   886,   892,  1119,   696,   698,   894,   895,   897,
-     898,   699,   700,   711,   900,   901,   903,   904,   962,   907,
-     918,   917,   920,   921,   949,   922,   923,   924,   925,   926,
-     927,   932,   933,   934,   945,   950,   952,   953,   961,   955,
-     957,   956,   958,   959,   960,   963,   964,   965,   966,   967,
-     969,   968,   970,   971,  1013,   972,  1040,  1041,   973,  1046,
-    1047,  1063,  1083,  1033,   974,  1034,  1062,  1035,  1068,  1084,
-    1036,  1089,  1037,  1038,  1042,  1043,  1044,  1074,  1075,   214,
-    1076,  1077,   300,   215,  1078,   319,  1079,  1080,   984,  1090,
-     321,   241,   985,   322,  1087,   236,  1091,  1092,  1098,  1017,
-     238,  1102,   278,   314,  1006,   336,   332,   216,  1099,  1007,
-    1111,  1114,  1112,   217,  1116,  1019,   986,   218,   279,  1121,
-    1020,   827,   987,   280,   239,   840,   988,   315,  1052,  1139,
-     333,   219,  1100,  1008,   244,   301,   220,   258,   320,   221,
-     989,   996,   829,  1115,  1021,   990,   841,   281,   991,  1054,
-     247,  1000,  1018,   261,  1140,   251,   222,  1001,   262,  1106,
-     223,  1109,  1141,   224,  1118,   992,   830,  1144,   225,   993,
-     842,   233,   994,  1055,  1145,  1120,   714,   995,  1149,   252,
-    1002,  1053,   263,   785,  1146,   717,  1147,   665,   566,   864,
-     977,   975,  1014,   569,  1012,  1011,  1039,   245,  1032,  1031,
-     259,   611,   979,   246,   978,  1110,   260,   292,   981,  1010,
-     983,   980,   604,   608,  1065,   982,  1029,   580,  1067,  1064,
-    1066,   861,   582,  1113,  1048,   847,  1030,  1028,  1045,   625,
-     716,   588,   523,   629,   626,  1061,  1137,   715,  1117,  1148,
-       0,     0,   596,     0,     0,     0,     0,     0,     0,     0,
+     100,   154,   205,   222,   253,   267,   287,   223,   309,   328,
+     345,   363,   381,    40,   330,   250,   854,   331,   814,   245,
+     256,   270,   288,   210,   247,   260,   271,   289,   784,   323,
+     341,   224,   364,  1026,   382,  1027,    33,   225,    34,    94,
+      35,   226,   385,  1028,  1032,  1038,    44,   211,   248,   261,
+     272,   290,    32,   324,   342,   227,   365,   848,   203,   204,
+     228,   310,   329,   229,   667,   281,   747,   254,   268,    46,
+     343,   344,   886,   255,   269,    48,   405,    91,   805,   667,
+     230,   406,   302,   932,   231,    50,   933,   232,   728,   729,
+     730,   731,   233,    52,   742,   234,   343,   344,   242,   743,
+     744,   745,   746,   747,   748,   749,   750,   751,   752,   753,
+     754,   755,   756,   757,   758,   759,   760,   134,   135,  1098,
+    1099,  1100,  1101,   134,   135,   303,   732,   304,   305,   725,
+     726,   306,   307,   308,   133,   134,   135,   303,    54,   133,
+      56,   453,   134,   135,   303,    99,   454,   262,   263,   264,
+     265,   266,   134,   135,   133,   303,    58,   134,   135,   133,
+     806,   134,   135,   849,   850,   851,   852,   386,   387,   388,
+     252,   219,   134,   135,   220,   280,   935,   134,   135,   936,
+     132,   281,   282,   283,   284,   285,   286,   864,   865,    60,
+      95,    62,  1044,  1045,   698,   457,   219,   722,   723,   220,
+     458,    96,    97,    98,    64,   469,   704,   705,   706,  1156,
+     470,    66,  1157,  1158,  1159,  1160,  1161,    68,  1026,    99,
+    1027,    36,    37,    38,    39,    99,    70,   472,  1028,  1032,
+    1038,    99,   473,   153,   303,   325,   304,   305,   326,   327,
+     394,   479,  1078,    99,  1079,  1080,   480,  1123,  1124,  1125,
+      99,   134,   135,   834,   835,   836,   837,   838,   839,   507,
+      99,   522,    99,   524,   508,    99,   523,   529,   525,    99,
+     395,   453,   530,   524,   529,   814,   891,   457,   892,   893,
+      99,   914,   894,   914,  1004,    99,   915,   938,   916,   396,
+     955,   397,   939,   398,   854,   956,   114,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   962,   134,
+     135,   966,   522,   963,   914,   133,   967,   968,   469,  1110,
+     404,  1114,   488,  1111,   507,   212,  1115,   213,   413,  1122,
+     414,   100,   415,   134,   135,   214,   215,   216,   217,   218,
+     136,  1133,   472,   479,  1177,   489,  1134,  1136,  1137,  1178,
+     805,   812,   219,   813,   941,   220,   143,   942,   970,    99,
+     416,   971,   417,   221,   418,   350,   351,   352,   353,   354,
+     355,   356,   357,   358,   359,   360,   361,   362,  1154,   154,
+     419,  1155,   420,   205,   421,   422,   151,   152,   423,   424,
+     425,   531,   532,   426,   427,   222,   428,   446,   253,   223,
+     670,   671,   672,   673,   210,   267,   456,   250,   464,   465,
+     475,   245,   477,   478,   256,   287,   247,    99,   490,   260,
+     493,   270,   497,   224,   499,   309,   271,   498,   211,   225,
+     328,   288,   501,   226,   502,   330,   289,   503,   331,   504,
+     248,    99,   509,   261,   512,   514,   323,   227,   363,   381,
+     272,   341,   228,   515,   518,   229,   519,   546,   527,   533,
+     290,   254,   534,   535,   536,   537,   538,   255,   268,   364,
+     324,   382,   230,   540,   269,   342,   231,   541,   310,   232,
+     385,   542,   543,   329,   233,   544,   545,   234,   547,   548,
+     242,   549,   550,   365,   551,   552,   562,   553,   114,   115,
+     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+     554,   555,   556,   563,   557,   131,   558,   133,   303,   564,
+     559,   560,   561,   565,   566,   567,   568,   569,   570,   571,
+     572,   573,   654,   655,   656,   134,   135,   574,   215,   216,
+     575,   218,   136,   576,   577,   578,   580,   581,   579,   582,
+     583,   584,   585,   587,   219,   588,   590,   220,   591,   592,
+     593,   594,   595,   596,   597,   221,   598,   599,   601,   603,
+     604,   605,   609,   606,   607,   610,   611,   612,   154,   613,
+     614,   615,   617,   618,   620,   205,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,   621,   622,   619,   625,   629,   210,   623,   626,   385,
+     853,   866,   630,   363,   381,   627,   632,   633,   634,   636,
+     639,   640,   635,   637,   638,   643,   718,   641,   642,   644,
+     211,   855,   867,   648,   364,   647,   382,   649,   651,   652,
+     108,   109,   653,    99,   658,   110,   657,   737,   111,   112,
+     113,   659,   660,   661,   662,   856,   868,   663,   365,   664,
+     665,   666,   669,   675,    34,   676,   677,   678,   919,   680,
+     679,   681,   682,   688,   114,   115,   116,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   683,   684,   685,   687,   689,   690,
+     691,   693,   694,   695,   696,   700,   697,   699,   701,   735,
+     785,   134,   135,   789,   793,   797,   801,   819,   136,   702,
+     703,   707,   708,   137,   138,   139,   140,   141,   709,   142,
+     823,   826,   830,   874,   143,   878,   882,   899,   900,   901,
+     710,   711,   902,   144,   903,   905,   145,   906,   712,   713,
+     910,   714,   911,   146,   912,   913,   715,   922,   918,   716,
+     717,   147,   148,   921,   719,   149,   150,   924,   925,   927,
+     928,   720,   721,   734,   736,   930,   931,   934,   944,   945,
+     947,   948,   972,   949,   950,   951,   952,   953,   151,   152,
+     954,   153,   959,   960,   961,   977,   988,   976,   980,   979,
+     984,   990,   982,   983,   985,   986,   987,   993,   996,   997,
+     998,  1042,   989,   991,   992,   994,  1069,   995,   999,    99,
+    1070,  1000,  1075,  1076,  1092,  1112,  1091,  1097,  1103,  1001,
+    1002,  1062,  1063,  1064,  1065,  1113,  1118,  1119,  1066,  1067,
+    1120,  1071,  1072,  1073,  1121,  1131,   222,  1140,  1143,   309,
+     223,  1145,   328,  1148,  1172,  1012,  1150,   330,   250,  1013,
+     331,  1104,   245,  1105,  1106,  1107,  1046,   247,  1108,   287,
+     323,  1035,   345,   341,   224,  1109,  1036,  1141,  1173,  1174,
+     225,  1116,  1048,  1014,   226,   288,  1176,  1049,   853,  1015,
+     289,   248,   866,  1016,   324,  1081,  1144,   342,   227,  1179,
+    1037,   253,   310,   228,   267,   329,   229,  1017,  1025,   855,
+    1127,  1050,  1018,   867,   290,  1019,  1083,   256,  1029,  1047,
+     270,  1128,   260,   230,  1030,   271,  1129,   231,  1181,  1135,
+     232,  1183,  1020,   856,  1138,   233,  1021,   868,   234,  1022,
+    1084,   242,  1180,  1147,  1023,  1149,   261,  1024,  1082,   272,
+    1031,  1182,   811,  1184,  1186,   686,  1187,   586,   539,   738,
+     589,   741,  1005,   890,   254,  1003,  1043,   268,  1040,  1041,
+     255,  1061,  1060,   269,  1068,   631,  1007,  1006,  1039,   600,
+    1139,   301,  1008,  1009,   624,  1094,  1093,  1095,   628,  1011,
+    1010,   608,  1096,  1059,   616,   887,  1142,  1057,  1058,  1074,
+     602,   645,   740,   650,  1077,   739,  1146,  1170,  1185,     0,
+     873,   646,  1090,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   984,     0,     0,     0,   985,     0,  1017,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,  1006,     0,     0,
-    1052,     0,  1007,  1019,     0,     0,     0,     0,  1020,   986,
-       0,     0,     0,     0,     0,   987,     0,     0,     0,   988,
-       0,  1054,     0,     0,     0,     0,  1008,     0,     0,     0,
-       0,     0,  1021,   989,   996,     0,     0,     0,   990,     0,
-    1018,   991,     0,     0,  1000,  1055,     0,     0,     0,     0,
-    1001,     0,     0,  1053,     0,     0,     0,     0,   992,     0,
-       0,     0,   993,     0,     0,   994,     0,     0,     0,     0,
-     995,     0,     0,  1002
+    1012,     0,     0,     0,  1013,     0,  1046,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,  1035,     0,     0,  1081,
+       0,  1036,  1048,     0,     0,     0,     0,  1049,  1014,     0,
+       0,     0,     0,     0,  1015,     0,     0,     0,  1016,     0,
+    1083,     0,     0,     0,     0,  1037,     0,     0,     0,     0,
+       0,  1050,  1017,  1025,     0,     0,     0,  1018,     0,  1047,
+    1019,     0,     0,  1029,  1084,     0,     0,     0,     0,  1030,
+       0,     0,  1082,     0,     0,     0,     0,  1020,     0,     0,
+       0,  1021,     0,     0,  1022,     0,     0,     0,     0,  1023,
+       0,     0,  1024,     0,     0,  1031
   };
 
   const short
   Dhcp6Parser::yycheck_[] =
   {
       74,    75,    76,    77,    78,    79,    80,    77,    82,    83,
-      84,    85,    85,   663,    83,    77,   657,    83,   640,    77,
-      78,    79,    80,    76,    77,    78,    79,    80,   902,    82,
-      83,    77,    85,   902,    85,   902,   902,    77,   902,    10,
-       3,    77,    86,     6,   109,   110,     0,    76,    77,    78,
-      79,    80,   100,    82,    83,    77,    85,    16,    17,   107,
-      77,    82,    83,    77,    21,    59,   546,    78,    79,   102,
-       7,    17,     7,    78,    79,     5,     7,     7,     7,     9,
-      77,   561,    76,    77,    77,     3,   181,    77,     6,    11,
-      12,     7,    77,    15,     3,    77,    18,    19,    20,     8,
-       7,     3,    59,     7,    61,    62,     8,     7,    65,    66,
-      67,   148,   149,   150,   151,     7,   181,    76,    77,    76,
-      77,    43,    44,    45,    46,    47,    48,    49,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,     7,    58,     3,
-       3,    58,    59,    21,     8,     8,     3,   184,   181,    69,
-       6,     8,    30,     3,    76,    77,    76,    77,     8,    76,
-      77,    83,   156,     7,   158,   159,    88,    89,    90,    91,
-      92,     3,    94,    76,    77,    95,     8,    99,    98,    96,
-      97,   102,   103,   154,   105,     3,   108,   181,   577,   111,
-       8,     7,   163,   164,   165,     7,   118,     7,    76,    77,
-     589,   590,   591,     3,   126,   127,     6,     3,   130,   131,
-     181,  1085,     8,   155,     3,     3,  1085,     6,  1085,  1085,
-       8,  1085,   181,     3,   181,   128,   129,    57,     8,     3,
-     152,   153,   157,   155,     8,   160,   161,   162,    59,    60,
-      61,    62,    63,    64,   122,   123,   124,   125,   119,   120,
-     121,   181,   182,   183,   184,    76,    77,     3,     3,   181,
-       3,   181,     8,     8,   181,     8,     4,   908,   890,   112,
-     113,   114,   115,   116,   117,     3,     3,     3,   181,     3,
-       8,    21,     8,     8,     8,   935,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,   181,    13,    14,    43,    44,    45,    46,
-      47,    48,    49,    50,    51,    52,    53,     3,     3,    59,
-     394,    58,     8,     8,     3,     3,     3,     3,     8,     8,
-       8,    68,     8,    70,     3,    58,     4,     6,     4,    76,
-      77,    78,    79,    80,    81,    82,    83,     4,    71,    72,
-      73,    74,    75,    76,    77,   109,   110,     4,    95,     4,
-     181,    98,    99,     4,   438,     3,     3,     3,   442,   106,
-       8,     8,    95,     3,     3,    98,     3,     3,     8,     8,
-     454,     8,     8,   457,   454,    84,    85,    86,    87,   442,
-     464,     4,   454,   145,   146,     4,   454,     4,     4,   457,
-     474,   454,     4,     4,   457,     4,   464,     4,   454,     4,
-     484,   464,     4,   442,   454,   489,   474,     4,   454,     4,
-     489,   474,     4,   489,     4,   454,     4,     8,   457,     8,
-       4,   484,   454,   507,   507,   464,   489,   454,   384,   385,
-     454,   181,     3,     8,   181,   474,   457,    22,    23,    24,
-      25,     4,   457,   464,   507,   484,   507,   454,   181,   464,
-     489,   454,     4,   484,   454,   509,     3,   181,   489,   454,
-       4,     4,   454,     4,     4,     4,     4,     4,   507,    43,
-      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
-       4,     4,    56,     4,    58,    59,     4,     4,     4,     4,
-       4,     4,    58,     4,     4,     4,     4,   182,   182,   182,
-     182,   182,    76,    77,   184,    79,    80,   182,    82,    83,
-      76,    77,   182,   182,     4,   183,     4,   183,   182,     4,
-       4,    95,     4,     4,    98,     4,     4,     4,    94,     4,
-       4,     4,   106,     4,   100,   101,   102,   103,   104,   105,
-       4,     4,     4,     4,   182,     4,     4,   631,     4,     4,
-       4,   184,     4,     4,   638,     4,     4,     4,   182,   184,
-       4,     4,     4,     4,   520,   521,   522,     4,   182,     4,
-       4,     4,    76,    77,   182,   638,   182,     4,   632,   663,
-     664,     4,   666,   666,   166,   167,   168,   169,   170,   171,
-     172,   173,   174,   175,   176,   177,   178,   179,   180,   638,
-     663,   664,     4,   666,     4,   666,     4,   181,     4,     4,
-     182,     4,     4,     4,   184,   181,     4,   184,     4,   184,
-       4,     4,   184,     4,   663,   664,   182,   666,   132,   133,
-     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
-     144,     4,     4,     4,     4,     4,   182,   182,   152,   153,
-     184,   184,     4,   182,   610,     4,     7,     7,     6,   181,
-       7,     7,     7,     7,     5,     5,     5,     5,    93,   181,
-       7,     5,     5,     5,   630,   181,     5,   181,     5,     7,
-       5,     5,   181,   181,     7,     7,     7,     7,     5,     5,
-       5,     5,   181,     5,   181,   181,     7,     7,   181,     7,
-       7,   181,     7,     7,     7,   181,     7,     7,     7,   181,
-       7,   181,   181,   181,   181,   181,   181,   147,     7,     4,
-       4,   181,     4,     4,   181,     4,     4,     4,   181,     4,
-       4,   181,     4,     3,     5,   181,   181,     6,     3,     6,
-       3,   181,   181,   181,     6,     3,     6,     3,   184,     6,
-       3,     6,     6,     3,     6,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,   181,     3,     6,     3,   182,     8,
-       4,     6,     4,     4,     4,   182,   184,   182,     4,   182,
-       4,   182,     4,     4,     4,   182,     4,     4,   182,     4,
-       4,     3,     8,   182,   184,   182,     6,   182,     4,     8,
-     182,     4,   182,   182,   182,   182,   182,   181,   181,   893,
-     181,   181,   896,   893,   181,   899,   181,   181,   902,     8,
-     899,   893,   902,   899,   181,   893,     3,     8,   181,   913,
-     893,     4,   916,   896,   902,   919,   899,   893,   181,   902,
-       4,     4,   184,   893,     4,   913,   902,   893,   916,     7,
-     913,   935,   902,   916,   893,   939,   902,   896,   942,     4,
-     899,   893,   181,   902,   948,   896,   893,   951,   899,   893,
-     902,   902,   935,   182,   913,   902,   939,   916,   902,   942,
-     948,   902,   913,   951,     4,   948,   893,   902,   951,   181,
-     893,   181,     4,   893,   181,   902,   935,     4,   893,   902,
-     939,   893,   902,   942,   184,   181,   631,   902,   181,   948,
-     902,   942,   951,   656,   182,   638,   182,   561,   438,   712,
-     892,   887,   911,   442,   908,   905,   928,   948,   921,   919,
-     951,   492,   895,   948,   893,  1085,   951,    81,   898,   904,
-     901,   896,   484,   489,   950,   899,   916,   454,   953,   948,
-     951,   679,   457,  1091,   939,   666,   918,   914,   935,   507,
-     637,   464,   394,   513,   509,   943,  1125,   632,  1104,  1142,
-      -1,    -1,   474,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      84,    85,    85,    17,    83,    77,   684,    83,   678,    77,
+      78,    79,    80,    76,    77,    78,    79,    80,   661,    82,
+      83,    77,    85,   929,    85,   929,     5,    77,     7,    10,
+       9,    77,    86,   929,   929,   929,     7,    76,    77,    78,
+      79,    80,     0,    82,    83,    77,    85,    22,    17,    18,
+      77,    82,    83,    77,   566,   106,    31,    78,    79,     7,
+     115,   116,   113,    78,    79,     7,     3,   190,   108,   581,
+      77,     8,    22,     3,    77,     7,     6,    77,   155,   156,
+     157,   158,    77,     7,    22,    77,   115,   116,    77,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    43,    44,    82,    83,    23,
+      24,    25,    26,    82,    83,    65,   193,    67,    68,   153,
+     154,    71,    72,    73,    64,    82,    83,    65,     7,    64,
+       7,     3,    82,    83,    65,   190,     8,    77,    78,    79,
+      80,    81,    82,    83,    64,    65,     7,    82,    83,    64,
+     190,    82,    83,   128,   129,   130,   131,    13,    14,    15,
+      75,   101,    82,    83,   104,   100,     3,    82,    83,     6,
+      63,   106,   107,   108,   109,   110,   111,   134,   135,     7,
+     161,     7,   102,   103,   597,     3,   101,   151,   152,   104,
+       8,   172,   173,   174,     7,     3,   609,   610,   611,   164,
+       8,     7,   167,   168,   169,   170,   171,     7,  1114,   190,
+    1114,   190,   191,   192,   193,   190,     7,     3,  1114,  1114,
+    1114,   190,     8,   162,    65,    66,    67,    68,    69,    70,
+       6,     3,   163,   190,   165,   166,     8,   125,   126,   127,
+     190,    82,    83,   118,   119,   120,   121,   122,   123,     3,
+     190,     3,   190,     3,     8,   190,     8,     3,     8,   190,
+       3,     3,     8,     3,     3,   935,     8,     3,     8,     8,
+     190,     3,     8,     3,   917,   190,     8,     3,     8,     4,
+       3,     8,     8,     3,   962,     8,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,     3,    82,
+      83,     3,     3,     8,     3,    64,     8,     8,     3,     8,
+       4,     3,     8,     8,     3,    74,     8,    76,     4,     8,
+       4,   405,     4,    82,    83,    84,    85,    86,    87,    88,
+      89,     3,     3,     3,     3,     3,     8,     8,     8,     8,
+     108,   109,   101,   111,     3,   104,   105,     6,     3,   190,
+       4,     6,     4,   112,     4,   138,   139,   140,   141,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,     3,   453,
+       4,     6,     4,   457,     4,     4,   159,   160,     4,     4,
+       4,   395,   396,     4,     4,   469,     4,     4,   472,   469,
+      90,    91,    92,    93,   457,   479,     4,   469,     4,     4,
+       4,   469,     4,     4,   472,   489,   469,   190,     8,   472,
+       4,   479,     4,   469,     3,   499,   479,     8,   457,   469,
+     504,   489,     4,   469,     4,   504,   489,     8,   504,     3,
+     469,   190,     4,   472,     4,     4,   499,   469,   522,   522,
+     479,   504,   469,     4,     4,   469,     4,   191,     4,   190,
+     489,   472,     4,     4,     4,     4,     4,   472,   479,   522,
+     499,   522,   469,     4,   479,   504,   469,     4,   499,   469,
+     524,     4,     4,   504,   469,     4,     4,   469,   191,   191,
+     469,   191,   191,   522,   191,   191,     4,   191,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+     193,   192,   192,     4,   192,    62,   191,    64,    65,     4,
+     191,   191,   191,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,   536,   537,   538,    82,    83,     4,    85,    86,
+       4,    88,    89,     4,     4,     4,     4,     4,   191,     4,
+       4,     4,     4,     4,   101,   193,     4,   104,     4,     4,
+       4,     4,   191,   193,     4,   112,     4,     4,     4,     4,
+     191,     4,     4,   191,   191,     4,     4,     4,   652,     4,
+       4,     4,     4,     4,     4,   659,   175,   176,   177,   178,
+     179,   180,   181,   182,   183,   184,   185,   186,   187,   188,
+     189,     4,     4,   191,     4,     4,   659,   193,   193,   653,
+     684,   685,     4,   687,   687,   193,   193,     4,     4,     4,
+       4,     4,   191,   191,   191,     4,   630,   193,   193,     4,
+     659,   684,   685,   191,   687,     4,   687,     4,     4,     7,
+      11,    12,     7,   190,     7,    16,   190,   651,    19,    20,
+      21,     7,     7,     7,     5,   684,   685,   190,   687,     5,
+       5,     5,   190,     5,     7,     5,     5,     5,     3,     5,
+       7,     5,     5,   190,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    64,     7,     7,     7,     7,   190,     5,
+       5,     5,     5,   190,   190,     7,   190,   190,   190,     5,
+       7,    82,    83,     7,     7,     7,     7,    99,    89,   190,
+     190,   190,   190,    94,    95,    96,    97,    98,   190,   100,
+       7,     7,     7,     7,   105,     7,     7,     4,     4,     4,
+     190,   190,     4,   114,     4,     4,   117,     4,   190,   190,
+       4,   190,     4,   124,     4,     4,   190,     3,     6,   190,
+     190,   132,   133,     6,   190,   136,   137,     6,     3,     6,
+       3,   190,   190,   190,   190,     6,     3,     6,     6,     3,
+       6,     3,   190,     4,     4,     4,     4,     4,   159,   160,
+       4,   162,     4,     4,     4,     3,   191,     6,     3,     6,
+       4,   191,     8,     6,     4,     4,     4,     4,     4,     4,
+       4,     4,   193,   193,   191,   191,     4,   191,   191,   190,
+       4,   191,     4,     4,     3,     8,     6,     4,   190,   193,
+     191,   191,   191,   191,   191,     8,     4,     8,   191,   191,
+       3,   191,   191,   191,     8,     4,   920,     4,     4,   923,
+     920,     4,   926,     5,     4,   929,     7,   926,   920,   929,
+     926,   190,   920,   190,   190,   190,   940,   920,   190,   943,
+     923,   929,   946,   926,   920,   190,   929,   193,     4,     4,
+     920,   190,   940,   929,   920,   943,     4,   940,   962,   929,
+     943,   920,   966,   929,   923,   969,   191,   926,   920,     4,
+     929,   975,   923,   920,   978,   926,   920,   929,   929,   962,
+     190,   940,   929,   966,   943,   929,   969,   975,   929,   940,
+     978,   190,   975,   920,   929,   978,   190,   920,   191,   190,
+     920,     4,   929,   962,   190,   920,   929,   966,   920,   929,
+     969,   920,   193,   190,   929,   190,   975,   929,   969,   978,
+     929,   191,   677,   191,   190,   581,   190,   453,   405,   652,
+     457,   659,   919,   735,   975,   914,   938,   978,   932,   935,
+     975,   948,   946,   978,   955,   507,   922,   920,   931,   469,
+    1114,    81,   923,   925,   499,   977,   975,   978,   504,   928,
+     926,   479,   980,   945,   489,   700,  1120,   941,   943,   962,
+     472,   522,   658,   529,   966,   653,  1133,  1154,  1177,    -1,
+     687,   524,   970,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,  1085,    -1,    -1,    -1,  1085,    -1,  1091,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,  1085,    -1,    -1,
-    1104,    -1,  1085,  1091,    -1,    -1,    -1,    -1,  1091,  1085,
-      -1,    -1,    -1,    -1,    -1,  1085,    -1,    -1,    -1,  1085,
-      -1,  1104,    -1,    -1,    -1,    -1,  1085,    -1,    -1,    -1,
-      -1,    -1,  1091,  1085,  1085,    -1,    -1,    -1,  1085,    -1,
-    1091,  1085,    -1,    -1,  1085,  1104,    -1,    -1,    -1,    -1,
-    1085,    -1,    -1,  1104,    -1,    -1,    -1,    -1,  1085,    -1,
-      -1,    -1,  1085,    -1,    -1,  1085,    -1,    -1,    -1,    -1,
-    1085,    -1,    -1,  1085
+    1114,    -1,    -1,    -1,  1114,    -1,  1120,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,  1114,    -1,    -1,  1133,
+      -1,  1114,  1120,    -1,    -1,    -1,    -1,  1120,  1114,    -1,
+      -1,    -1,    -1,    -1,  1114,    -1,    -1,    -1,  1114,    -1,
+    1133,    -1,    -1,    -1,    -1,  1114,    -1,    -1,    -1,    -1,
+      -1,  1120,  1114,  1114,    -1,    -1,    -1,  1114,    -1,  1120,
+    1114,    -1,    -1,  1114,  1133,    -1,    -1,    -1,    -1,  1114,
+      -1,    -1,  1133,    -1,    -1,    -1,    -1,  1114,    -1,    -1,
+      -1,  1114,    -1,    -1,  1114,    -1,    -1,    -1,    -1,  1114,
+      -1,    -1,  1114,    -1,    -1,  1114
   };
 
-  const unsigned short
+  const short
   Dhcp6Parser::yystos_[] =
   {
-       0,   166,   167,   168,   169,   170,   171,   172,   173,   174,
-     175,   176,   177,   178,   179,   180,   186,   187,   188,   189,
-     190,   191,   192,   193,   194,   195,   196,   197,   198,   199,
-     200,   201,     0,     5,     7,     9,   181,   182,   183,   184,
-     202,   203,   204,   209,     7,   218,     7,   224,     7,   246,
-       7,   344,     7,   421,     7,   437,     7,   454,     7,   373,
-       7,   379,     7,   403,     7,   320,     7,   515,     7,   562,
-       7,   553,   210,   205,   219,   225,   247,   345,   422,   438,
-     455,   374,   380,   404,   321,   516,   563,   554,   202,   211,
-     212,   181,   207,   208,    10,   154,   163,   164,   165,   181,
-     217,   220,   221,   222,   545,   547,   549,   560,    11,    12,
-      15,    18,    19,    20,    43,    44,    45,    46,    47,    48,
-      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      76,    77,    83,    88,    89,    90,    91,    92,    94,    99,
-     108,   111,   118,   126,   127,   130,   131,   152,   153,   155,
-     217,   226,   227,   228,   230,   231,   232,   233,   234,   235,
-     236,   237,   238,   239,   240,   241,   242,   244,   253,   255,
-     257,   294,   300,   306,   312,   314,   328,   338,   358,   363,
-     371,   397,   427,   429,   448,   478,   490,   502,   503,   511,
-     513,   541,   543,   551,   566,    16,    17,   217,   248,   249,
-     250,   252,   427,   429,    68,    70,    78,    79,    80,    81,
-      82,    95,    98,   106,   217,   230,   231,   232,   233,   234,
-     235,   236,   237,   238,   239,   240,   346,   347,   348,   350,
-     352,   354,   356,   358,   361,   362,   397,   415,   427,   429,
-     431,   448,   473,    69,   217,   354,   356,   397,   423,   424,
-     425,   427,   429,    71,    72,    73,    74,    75,   217,   354,
-     356,   397,   427,   429,   439,   440,   441,   443,   444,   446,
-     447,    94,   100,   101,   102,   103,   104,   105,   217,   397,
-     427,   429,   456,   457,   458,   459,   461,   463,   465,   467,
-     469,   471,   371,    21,    59,    61,    62,    65,    66,    67,
-     217,   275,   381,   382,   383,   384,   385,   386,   387,   389,
-     391,   393,   394,   396,   427,   429,    60,    63,    64,   217,
-     275,   385,   391,   405,   406,   407,   408,   409,   411,   412,
-     413,   414,   427,   429,   109,   110,   217,   322,   323,   324,
-     326,   132,   133,   134,   135,   136,   137,   138,   139,   140,
-     141,   142,   143,   144,   217,   427,   429,   517,   518,   519,
-     520,   522,   524,   525,   527,   528,   529,   532,   534,   535,
-     536,   539,   541,   543,   564,   565,   566,    13,    14,   555,
-     556,   557,   559,     6,     3,     4,     8,     3,   223,   561,
-     546,   548,   550,     4,     3,     8,   229,   552,   245,   254,
-     256,   258,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,   243,   339,   372,   398,   428,   430,
-     359,   364,   301,   313,   307,   295,   479,   449,   315,   329,
-     491,     4,   504,   512,   514,   542,   544,   567,     3,     8,
-     251,     4,     3,     8,   416,   432,   349,   351,   353,     4,
-       4,   357,   355,   474,     3,     8,   426,     3,     8,   442,
-       4,   445,     4,     4,     3,     8,   472,   460,   462,   464,
-     466,   468,   470,     8,     3,     8,   388,   276,     4,   392,
-     390,   395,     4,     8,     3,   410,     4,     4,     8,     3,
-     325,   327,     3,     8,     4,   521,   523,     4,   526,     4,
-       4,   530,   533,     4,     4,   537,   540,     3,     8,     3,
-       8,   558,     4,     3,     8,   202,   202,   181,     4,     4,
-       4,     4,     4,   221,     4,     4,     4,     4,     4,     4,
-     182,   182,   182,   182,   182,   182,   182,   182,   184,   183,
-     183,   182,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,     4,     4,     4,   182,
-       4,     4,     4,     4,     4,     4,   227,     4,   184,   249,
-       4,     4,     4,     4,     4,   182,   184,     4,     4,     4,
-     347,     4,   424,     4,   182,     4,   182,   182,   440,     4,
-       4,     4,     4,     4,     4,     4,   458,     4,     4,   182,
-       4,     4,     4,   184,   383,     4,   184,   184,   407,     4,
-       4,   323,   184,     4,     4,   182,     4,   182,   182,     4,
-       4,   184,   184,     4,     4,   518,   565,     4,   182,   556,
-       4,     7,     7,   202,   202,   202,   181,     7,     7,     7,
-       7,     5,   181,     5,     5,     5,   204,   206,   181,    84,
-      85,    86,    87,   360,     5,     5,     5,     5,     7,     5,
-       5,     5,     7,     7,     7,   206,     7,   181,   181,     5,
-       5,   213,     5,     5,   181,   181,   181,   213,   181,     7,
-     181,   181,   181,   213,   213,   213,   181,   181,   181,   181,
-     181,   181,   181,   181,   181,   181,   181,   202,   181,   181,
-     181,   145,   146,   531,   147,   148,   149,   150,   151,   184,
-     538,   181,     5,   202,   226,   564,   555,   248,    21,    26,
-      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,    39,    40,    41,    42,   217,   263,   264,   265,
-     268,   270,   272,   274,   275,   277,   278,   279,   280,   281,
-     282,   283,   284,   285,   287,   288,   290,   292,   263,     7,
-     259,   260,   261,     7,   340,   341,   342,     7,   375,   376,
-     377,     7,   399,   400,   401,     7,   365,   366,   367,   102,
-     181,   302,   303,   304,   305,   211,   103,   105,   304,   308,
-     309,   310,   311,    93,   296,   297,   298,     7,   480,   481,
-       7,   450,   451,   452,     7,   316,   317,   318,   112,   113,
-     114,   115,   116,   117,   330,   331,   332,   333,   334,   335,
-     336,   337,    21,   122,   123,   124,   125,   217,   277,   427,
-     429,   492,   493,   494,   497,   498,   500,   501,   128,   129,
-     217,   427,   429,   505,   506,   507,   509,   517,     7,   568,
-     569,   214,     7,   417,   418,   419,     7,   433,   434,   435,
-     107,   459,   475,   476,   259,     8,     8,     8,     8,   266,
-     269,   271,   273,     4,     4,     4,     4,     4,   286,     4,
-       4,   289,   291,   293,     4,     4,     4,     3,     8,     8,
-     262,     6,     3,   343,     6,     3,   378,     6,     3,   402,
-       6,     3,   368,     6,     3,     3,     6,     6,     3,     6,
-     299,     3,     8,   482,     3,     6,   453,     6,     3,   319,
-       6,     3,     4,     4,     4,     4,     4,     4,     3,     8,
-     495,   499,     4,     4,     4,     3,     8,   508,   510,     3,
-       8,     8,   570,     3,     6,   181,   215,   216,   420,     6,
-       3,   436,     6,     3,   477,     8,     6,     4,     4,     4,
-       4,   182,   184,   182,   184,   182,     4,   182,   182,     4,
-       4,     4,   182,   182,   184,   264,   263,   261,   346,   342,
-     381,   377,   405,   401,   217,   230,   231,   232,   233,   234,
-     235,   236,   237,   238,   239,   240,   275,   338,   350,   352,
-     354,   356,   358,   362,   369,   370,   397,   427,   429,   473,
-     367,   303,   309,     4,   297,    96,    97,   217,   275,   397,
-     427,   429,   483,   484,   485,   486,   487,   489,   481,   456,
-     452,   322,   318,   182,   182,   182,   182,   182,   182,   331,
-       4,     4,   182,   182,   182,   493,     4,     4,   506,   156,
-     158,   159,   217,   275,   427,   429,   571,   572,   573,   574,
-     576,   569,     6,     3,   423,   419,   439,   435,     4,    22,
-      23,    24,    25,   267,   181,   181,   181,   181,   181,   181,
-     181,     8,     8,     8,     8,     3,     8,   181,   488,     4,
-       8,     3,     8,     8,   119,   120,   121,   496,   181,   181,
-     181,   577,     4,   575,     3,     8,   181,     8,     8,   181,
-     370,     4,   184,   485,     4,   182,     4,   572,   181,     5,
-     181,     7,   578,   579,   580,     3,     6,   157,   160,   161,
-     162,   581,   582,   583,   585,   586,   587,   579,   584,     4,
-       4,     4,     3,     8,     4,   184,   182,   182,   582,   181
+       0,   175,   176,   177,   178,   179,   180,   181,   182,   183,
+     184,   185,   186,   187,   188,   189,   195,   196,   197,   198,
+     199,   200,   201,   202,   203,   204,   205,   206,   207,   208,
+     209,   210,     0,     5,     7,     9,   190,   191,   192,   193,
+     211,   212,   213,   218,     7,   227,     7,   233,     7,   259,
+       7,   358,     7,   435,     7,   451,     7,   468,     7,   387,
+       7,   393,     7,   417,     7,   334,     7,   529,     7,   579,
+       7,   568,   219,   214,   228,   234,   260,   359,   436,   452,
+     469,   388,   394,   418,   335,   530,   580,   569,   211,   220,
+     221,   190,   216,   217,    10,   161,   172,   173,   174,   190,
+     226,   229,   230,   231,   560,   562,   564,   577,    11,    12,
+      16,    19,    20,    21,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    64,    82,    83,    89,    94,    95,    96,
+      97,    98,   100,   105,   114,   117,   124,   132,   133,   136,
+     137,   159,   160,   162,   226,   235,   236,   237,   239,   240,
+     241,   242,   243,   244,   245,   246,   247,   248,   249,   250,
+     251,   252,   253,   254,   255,   257,   266,   268,   270,   308,
+     314,   320,   326,   328,   342,   352,   372,   377,   385,   411,
+     441,   443,   462,   492,   504,   516,   517,   525,   527,   556,
+     558,   566,   583,    17,    18,   226,   261,   262,   263,   265,
+     441,   443,    74,    76,    84,    85,    86,    87,    88,   101,
+     104,   112,   226,   239,   240,   241,   242,   243,   244,   245,
+     246,   247,   248,   249,   250,   360,   361,   362,   364,   366,
+     368,   370,   372,   375,   376,   411,   429,   441,   443,   445,
+     462,   487,    75,   226,   368,   370,   411,   437,   438,   439,
+     441,   443,    77,    78,    79,    80,    81,   226,   368,   370,
+     411,   441,   443,   453,   454,   455,   457,   458,   460,   461,
+     100,   106,   107,   108,   109,   110,   111,   226,   411,   441,
+     443,   470,   471,   472,   473,   475,   477,   479,   481,   483,
+     485,   385,    22,    65,    67,    68,    71,    72,    73,   226,
+     288,   395,   396,   397,   398,   399,   400,   401,   403,   405,
+     407,   408,   410,   441,   443,    66,    69,    70,   226,   288,
+     399,   405,   419,   420,   421,   422,   423,   425,   426,   427,
+     428,   441,   443,   115,   116,   226,   336,   337,   338,   340,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,   226,   441,   443,   531,   532,   533,   534,
+     536,   538,   539,   541,   542,   543,   546,   549,   550,   551,
+     554,   556,   558,   581,   582,   583,    13,    14,    15,   570,
+     571,   572,   574,   575,     6,     3,     4,     8,     3,   232,
+     578,   561,   563,   565,     4,     3,     8,   238,   567,   258,
+     267,   269,   271,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,   256,
+     353,   386,   412,   442,   444,   373,   378,   315,   327,   321,
+     309,   493,   463,   329,   343,   505,     4,   518,   526,   528,
+     557,   559,   584,     3,     8,   264,     4,     3,     8,   430,
+     446,   363,   365,   367,     4,     4,   371,   369,   488,     3,
+       8,   440,     3,     8,   456,     4,   459,     4,     4,     3,
+       8,   486,   474,   476,   478,   480,   482,   484,     8,     3,
+       8,   402,   289,     4,   406,   404,   409,     4,     8,     3,
+     424,     4,     4,     8,     3,   339,   341,     3,     8,     4,
+     535,   537,     4,   540,     4,     4,   544,   547,     4,     4,
+     552,   555,     3,     8,     3,     8,   573,     4,   576,     3,
+       8,   211,   211,   190,     4,     4,     4,     4,     4,   230,
+       4,     4,     4,     4,     4,     4,   191,   191,   191,   191,
+     191,   191,   191,   191,   193,   192,   192,   192,   191,   191,
+     191,   191,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,   191,
+       4,     4,     4,     4,     4,     4,   236,     4,   193,   262,
+       4,     4,     4,     4,     4,   191,   193,     4,     4,     4,
+     361,     4,   438,     4,   191,     4,   191,   191,   454,     4,
+       4,     4,     4,     4,     4,     4,   472,     4,     4,   191,
+       4,     4,     4,   193,   397,     4,   193,   193,   421,     4,
+       4,   337,   193,     4,     4,   191,     4,   191,   191,     4,
+       4,   193,   193,     4,     4,   532,   582,     4,   191,     4,
+     571,     4,     7,     7,   211,   211,   211,   190,     7,     7,
+       7,     7,     5,   190,     5,     5,     5,   213,   215,   190,
+      90,    91,    92,    93,   374,     5,     5,     5,     5,     7,
+       5,     5,     5,     7,     7,     7,   215,     7,   190,   190,
+       5,     5,   222,     5,     5,   190,   190,   190,   222,   190,
+       7,   190,   190,   190,   222,   222,   222,   190,   190,   190,
+     190,   190,   190,   190,   190,   190,   190,   190,   211,   190,
+     190,   190,   151,   152,   545,   153,   154,   548,   155,   156,
+     157,   158,   193,   553,   190,     5,   190,   211,   235,   581,
+     570,   261,    22,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,   226,   276,   277,   278,   281,   283,   285,   287,   288,
+     290,   291,   292,   293,   294,   295,   296,   297,   298,   299,
+     301,   302,   304,   306,   276,     7,   272,   273,   274,     7,
+     354,   355,   356,     7,   389,   390,   391,     7,   413,   414,
+     415,     7,   379,   380,   381,   108,   190,   316,   317,   318,
+     319,   220,   109,   111,   318,   322,   323,   324,   325,    99,
+     310,   311,   312,     7,   494,   495,     7,   464,   465,   466,
+       7,   330,   331,   332,   118,   119,   120,   121,   122,   123,
+     344,   345,   346,   347,   348,   349,   350,   351,    22,   128,
+     129,   130,   131,   226,   290,   441,   443,   506,   507,   508,
+     511,   512,   514,   515,   134,   135,   226,   441,   443,   519,
+     520,   521,   523,   531,     7,   585,   586,   223,     7,   431,
+     432,   433,     7,   447,   448,   449,   113,   473,   489,   490,
+     272,     8,     8,     8,     8,   279,   282,   284,   286,     4,
+       4,     4,     4,     4,   300,     4,     4,   303,   305,   307,
+       4,     4,     4,     4,     3,     8,     8,   275,     6,     3,
+     357,     6,     3,   392,     6,     3,   416,     6,     3,   382,
+       6,     3,     3,     6,     6,     3,     6,   313,     3,     8,
+     496,     3,     6,   467,     6,     3,   333,     6,     3,     4,
+       4,     4,     4,     4,     4,     3,     8,   509,   513,     4,
+       4,     4,     3,     8,   522,   524,     3,     8,     8,   587,
+       3,     6,   190,   224,   225,   434,     6,     3,   450,     6,
+       3,   491,     8,     6,     4,     4,     4,     4,   191,   193,
+     191,   193,   191,     4,   191,   191,     4,     4,     4,   191,
+     191,   193,   191,   277,   276,   274,   360,   356,   395,   391,
+     419,   415,   226,   239,   240,   241,   242,   243,   244,   245,
+     246,   247,   248,   249,   250,   288,   352,   364,   366,   368,
+     370,   372,   376,   383,   384,   411,   441,   443,   487,   381,
+     317,   323,     4,   311,   102,   103,   226,   288,   411,   441,
+     443,   497,   498,   499,   500,   501,   503,   495,   470,   466,
+     336,   332,   191,   191,   191,   191,   191,   191,   345,     4,
+       4,   191,   191,   191,   507,     4,     4,   520,   163,   165,
+     166,   226,   288,   441,   443,   588,   589,   590,   591,   593,
+     586,     6,     3,   437,   433,   453,   449,     4,    23,    24,
+      25,    26,   280,   190,   190,   190,   190,   190,   190,   190,
+       8,     8,     8,     8,     3,     8,   190,   502,     4,     8,
+       3,     8,     8,   125,   126,   127,   510,   190,   190,   190,
+     594,     4,   592,     3,     8,   190,     8,     8,   190,   384,
+       4,   193,   499,     4,   191,     4,   589,   190,     5,   190,
+       7,   595,   596,   597,     3,     6,   164,   167,   168,   169,
+     170,   171,   598,   599,   600,   602,   603,   604,   605,   607,
+     596,   601,     4,     4,     4,   606,     4,     3,     8,     4,
+     193,   191,   191,     4,   191,   599,   190,   190
   };
 
-  const unsigned short
+  const short
   Dhcp6Parser::yyr1_[] =
   {
-       0,   185,   187,   186,   188,   186,   189,   186,   190,   186,
-     191,   186,   192,   186,   193,   186,   194,   186,   195,   186,
-     196,   186,   197,   186,   198,   186,   199,   186,   200,   186,
-     201,   186,   202,   202,   202,   202,   202,   202,   202,   203,
-     205,   204,   206,   207,   207,   208,   208,   210,   209,   211,
-     211,   212,   212,   214,   213,   215,   215,   216,   216,   217,
-     219,   218,   220,   220,   221,   221,   221,   221,   221,   221,
-     223,   222,   225,   224,   226,   226,   227,   227,   227,   227,
-     227,   227,   227,   227,   227,   227,   227,   227,   227,   227,
-     227,   227,   227,   227,   227,   227,   227,   227,   227,   227,
-     227,   227,   227,   227,   227,   227,   227,   227,   227,   227,
-     227,   227,   227,   227,   227,   227,   227,   227,   227,   229,
-     228,   230,   231,   232,   233,   234,   235,   236,   237,   238,
-     239,   240,   241,   243,   242,   245,   244,   247,   246,   248,
-     248,   249,   249,   249,   249,   249,   251,   250,   252,   254,
-     253,   256,   255,   258,   257,   259,   259,   260,   260,   262,
-     261,   263,   263,   264,   264,   264,   264,   264,   264,   264,
-     264,   264,   264,   264,   264,   264,   264,   264,   264,   264,
-     264,   264,   264,   266,   265,   267,   267,   267,   267,   269,
-     268,   271,   270,   273,   272,   274,   276,   275,   277,   278,
-     279,   280,   281,   282,   283,   284,   286,   285,   287,   289,
-     288,   291,   290,   293,   292,   295,   294,   296,   296,   297,
-     299,   298,   301,   300,   302,   302,   303,   303,   304,   305,
-     307,   306,   308,   308,   309,   309,   309,   310,   311,   313,
-     312,   315,   314,   316,   316,   317,   317,   319,   318,   321,
-     320,   322,   322,   322,   323,   323,   325,   324,   327,   326,
-     329,   328,   330,   330,   331,   331,   331,   331,   331,   331,
-     332,   333,   334,   335,   336,   337,   339,   338,   340,   340,
-     341,   341,   343,   342,   345,   344,   346,   346,   347,   347,
-     347,   347,   347,   347,   347,   347,   347,   347,   347,   347,
-     347,   347,   347,   347,   347,   347,   347,   347,   347,   347,
-     347,   347,   347,   347,   347,   349,   348,   351,   350,   353,
-     352,   355,   354,   357,   356,   359,   358,   360,   360,   360,
-     360,   361,   362,   364,   363,   365,   365,   366,   366,   368,
-     367,   369,   369,   370,   370,   370,   370,   370,   370,   370,
-     370,   370,   370,   370,   370,   370,   370,   370,   370,   370,
-     370,   370,   370,   370,   370,   370,   370,   372,   371,   374,
-     373,   375,   375,   376,   376,   378,   377,   380,   379,   381,
-     381,   382,   382,   383,   383,   383,   383,   383,   383,   383,
-     383,   383,   383,   384,   385,   386,   388,   387,   390,   389,
-     392,   391,   393,   395,   394,   396,   398,   397,   399,   399,
-     400,   400,   402,   401,   404,   403,   405,   405,   406,   406,
-     407,   407,   407,   407,   407,   407,   407,   407,   407,   408,
-     410,   409,   411,   412,   413,   414,   416,   415,   417,   417,
-     418,   418,   420,   419,   422,   421,   423,   423,   424,   424,
-     424,   424,   424,   424,   424,   426,   425,   428,   427,   430,
-     429,   432,   431,   433,   433,   434,   434,   436,   435,   438,
-     437,   439,   439,   440,   440,   440,   440,   440,   440,   440,
-     440,   440,   440,   440,   442,   441,   443,   445,   444,   446,
-     447,   449,   448,   450,   450,   451,   451,   453,   452,   455,
-     454,   456,   456,   457,   457,   458,   458,   458,   458,   458,
-     458,   458,   458,   458,   458,   458,   460,   459,   462,   461,
-     464,   463,   466,   465,   468,   467,   470,   469,   472,   471,
-     474,   473,   475,   475,   477,   476,   479,   478,   480,   480,
-     482,   481,   483,   483,   484,   484,   485,   485,   485,   485,
-     485,   485,   485,   486,   488,   487,   489,   491,   490,   492,
-     492,   493,   493,   493,   493,   493,   493,   493,   493,   493,
-     495,   494,   496,   496,   496,   497,   499,   498,   500,   501,
-     502,   504,   503,   505,   505,   506,   506,   506,   506,   506,
-     508,   507,   510,   509,   512,   511,   514,   513,   516,   515,
-     517,   517,   518,   518,   518,   518,   518,   518,   518,   518,
-     518,   518,   518,   518,   518,   518,   518,   518,   518,   518,
-     519,   521,   520,   523,   522,   524,   526,   525,   527,   528,
-     530,   529,   531,   531,   533,   532,   534,   535,   537,   536,
-     538,   538,   538,   538,   538,   540,   539,   542,   541,   544,
-     543,   546,   545,   548,   547,   550,   549,   552,   551,   554,
-     553,   555,   555,   556,   556,   558,   557,   559,   561,   560,
-     563,   562,   564,   564,   565,   567,   566,   568,   568,   570,
-     569,   571,   571,   572,   572,   572,   572,   572,   572,   572,
-     573,   575,   574,   577,   576,   578,   578,   580,   579,   581,
-     581,   582,   582,   582,   582,   584,   583,   585,   586,   587
+       0,   194,   196,   195,   197,   195,   198,   195,   199,   195,
+     200,   195,   201,   195,   202,   195,   203,   195,   204,   195,
+     205,   195,   206,   195,   207,   195,   208,   195,   209,   195,
+     210,   195,   211,   211,   211,   211,   211,   211,   211,   212,
+     214,   213,   215,   216,   216,   217,   217,   219,   218,   220,
+     220,   221,   221,   223,   222,   224,   224,   225,   225,   226,
+     228,   227,   229,   229,   230,   230,   230,   230,   230,   230,
+     232,   231,   234,   233,   235,   235,   236,   236,   236,   236,
+     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
+     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
+     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
+     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
+     236,   236,   236,   238,   237,   239,   240,   241,   242,   243,
+     244,   245,   246,   247,   248,   249,   250,   251,   252,   253,
+     254,   256,   255,   258,   257,   260,   259,   261,   261,   262,
+     262,   262,   262,   262,   264,   263,   265,   267,   266,   269,
+     268,   271,   270,   272,   272,   273,   273,   275,   274,   276,
+     276,   277,   277,   277,   277,   277,   277,   277,   277,   277,
+     277,   277,   277,   277,   277,   277,   277,   277,   277,   277,
+     277,   277,   279,   278,   280,   280,   280,   280,   282,   281,
+     284,   283,   286,   285,   287,   289,   288,   290,   291,   292,
+     293,   294,   295,   296,   297,   298,   300,   299,   301,   303,
+     302,   305,   304,   307,   306,   309,   308,   310,   310,   311,
+     313,   312,   315,   314,   316,   316,   317,   317,   318,   319,
+     321,   320,   322,   322,   323,   323,   323,   324,   325,   327,
+     326,   329,   328,   330,   330,   331,   331,   333,   332,   335,
+     334,   336,   336,   336,   337,   337,   339,   338,   341,   340,
+     343,   342,   344,   344,   345,   345,   345,   345,   345,   345,
+     346,   347,   348,   349,   350,   351,   353,   352,   354,   354,
+     355,   355,   357,   356,   359,   358,   360,   360,   361,   361,
+     361,   361,   361,   361,   361,   361,   361,   361,   361,   361,
+     361,   361,   361,   361,   361,   361,   361,   361,   361,   361,
+     361,   361,   361,   361,   361,   361,   363,   362,   365,   364,
+     367,   366,   369,   368,   371,   370,   373,   372,   374,   374,
+     374,   374,   375,   376,   378,   377,   379,   379,   380,   380,
+     382,   381,   383,   383,   384,   384,   384,   384,   384,   384,
+     384,   384,   384,   384,   384,   384,   384,   384,   384,   384,
+     384,   384,   384,   384,   384,   384,   384,   384,   384,   386,
+     385,   388,   387,   389,   389,   390,   390,   392,   391,   394,
+     393,   395,   395,   396,   396,   397,   397,   397,   397,   397,
+     397,   397,   397,   397,   397,   398,   399,   400,   402,   401,
+     404,   403,   406,   405,   407,   409,   408,   410,   412,   411,
+     413,   413,   414,   414,   416,   415,   418,   417,   419,   419,
+     420,   420,   421,   421,   421,   421,   421,   421,   421,   421,
+     421,   422,   424,   423,   425,   426,   427,   428,   430,   429,
+     431,   431,   432,   432,   434,   433,   436,   435,   437,   437,
+     438,   438,   438,   438,   438,   438,   438,   440,   439,   442,
+     441,   444,   443,   446,   445,   447,   447,   448,   448,   450,
+     449,   452,   451,   453,   453,   454,   454,   454,   454,   454,
+     454,   454,   454,   454,   454,   454,   456,   455,   457,   459,
+     458,   460,   461,   463,   462,   464,   464,   465,   465,   467,
+     466,   469,   468,   470,   470,   471,   471,   472,   472,   472,
+     472,   472,   472,   472,   472,   472,   472,   472,   474,   473,
+     476,   475,   478,   477,   480,   479,   482,   481,   484,   483,
+     486,   485,   488,   487,   489,   489,   491,   490,   493,   492,
+     494,   494,   496,   495,   497,   497,   498,   498,   499,   499,
+     499,   499,   499,   499,   499,   500,   502,   501,   503,   505,
+     504,   506,   506,   507,   507,   507,   507,   507,   507,   507,
+     507,   507,   509,   508,   510,   510,   510,   511,   513,   512,
+     514,   515,   516,   518,   517,   519,   519,   520,   520,   520,
+     520,   520,   522,   521,   524,   523,   526,   525,   528,   527,
+     530,   529,   531,   531,   532,   532,   532,   532,   532,   532,
+     532,   532,   532,   532,   532,   532,   532,   532,   532,   532,
+     532,   532,   533,   535,   534,   537,   536,   538,   540,   539,
+     541,   542,   544,   543,   545,   545,   547,   546,   548,   548,
+     549,   550,   552,   551,   553,   553,   553,   553,   553,   555,
+     554,   557,   556,   559,   558,   561,   560,   563,   562,   565,
+     564,   567,   566,   569,   568,   570,   570,   571,   571,   571,
+     573,   572,   574,   576,   575,   578,   577,   580,   579,   581,
+     581,   582,   584,   583,   585,   585,   587,   586,   588,   588,
+     589,   589,   589,   589,   589,   589,   589,   590,   592,   591,
+     594,   593,   595,   595,   597,   596,   598,   598,   599,   599,
+     599,   599,   599,   599,   601,   600,   602,   603,   604,   606,
+     605,   607
   };
 
-  const unsigned char
+  const signed char
   Dhcp6Parser::yyr2_[] =
   {
        0,     2,     0,     3,     0,     3,     0,     3,     0,     3,
@@ -4925,15 +5152,16 @@ namespace isc { namespace dhcp {
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
-       4,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     0,     4,     0,     6,     0,     4,     1,
-       3,     1,     1,     1,     1,     1,     0,     4,     3,     0,
-       6,     0,     6,     0,     6,     0,     1,     1,     3,     0,
-       4,     1,     3,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     0,     4,     1,     1,     1,     1,     0,
-       4,     0,     4,     0,     4,     3,     0,     4,     3,     3,
+       1,     1,     1,     0,     4,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     0,     4,     0,     6,     0,     4,     1,     3,     1,
+       1,     1,     1,     1,     0,     4,     3,     0,     6,     0,
+       6,     0,     6,     0,     1,     1,     3,     0,     4,     1,
+       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     0,     4,     1,     1,     1,     1,     0,     4,
+       0,     4,     0,     4,     3,     0,     4,     3,     3,     3,
        3,     3,     3,     3,     3,     3,     0,     4,     3,     0,
        4,     0,     4,     0,     4,     0,     6,     1,     3,     1,
        0,     4,     0,     6,     1,     3,     1,     1,     1,     1,
@@ -4945,80 +5173,85 @@ namespace isc { namespace dhcp {
        1,     3,     0,     4,     0,     4,     1,     3,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     0,     4,     0,     4,     0,
-       4,     0,     4,     0,     4,     0,     4,     1,     1,     1,
-       1,     3,     3,     0,     6,     0,     1,     1,     3,     0,
-       4,     1,     3,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     0,     6,     0,
-       4,     0,     1,     1,     3,     0,     4,     0,     4,     0,
-       1,     1,     3,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     3,     1,     0,     4,     0,     4,
-       0,     4,     1,     0,     4,     3,     0,     6,     0,     1,
-       1,     3,     0,     4,     0,     4,     0,     1,     1,     3,
+       1,     1,     1,     1,     1,     1,     0,     4,     0,     4,
+       0,     4,     0,     4,     0,     4,     0,     4,     1,     1,
+       1,     1,     3,     3,     0,     6,     0,     1,     1,     3,
+       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       0,     4,     1,     1,     3,     3,     0,     6,     0,     1,
-       1,     3,     0,     4,     0,     4,     1,     3,     1,     1,
-       1,     1,     1,     1,     1,     0,     4,     0,     4,     0,
-       4,     0,     6,     0,     1,     1,     3,     0,     4,     0,
-       4,     1,     3,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     0,     4,     3,     0,     4,     3,
-       3,     0,     6,     0,     1,     1,     3,     0,     4,     0,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
+       6,     0,     4,     0,     1,     1,     3,     0,     4,     0,
        4,     0,     1,     1,     3,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     0,     4,     0,     4,
-       0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
-       0,     6,     1,     1,     0,     4,     0,     6,     1,     3,
-       0,     4,     0,     1,     1,     3,     1,     1,     1,     1,
-       1,     1,     1,     1,     0,     4,     3,     0,     6,     1,
-       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       0,     4,     1,     1,     1,     3,     0,     4,     3,     3,
-       3,     0,     6,     1,     3,     1,     1,     1,     1,     1,
-       0,     4,     0,     4,     0,     4,     0,     6,     0,     4,
+       1,     1,     1,     1,     1,     1,     3,     1,     0,     4,
+       0,     4,     0,     4,     1,     0,     4,     3,     0,     6,
+       0,     1,     1,     3,     0,     4,     0,     4,     0,     1,
        1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     0,     4,     1,     1,     3,     3,     0,     6,
+       0,     1,     1,     3,     0,     4,     0,     4,     1,     3,
+       1,     1,     1,     1,     1,     1,     1,     0,     4,     0,
+       4,     0,     4,     0,     6,     0,     1,     1,     3,     0,
+       4,     0,     4,     1,     3,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     0,     4,     3,     0,
+       4,     3,     3,     0,     6,     0,     1,     1,     3,     0,
+       4,     0,     4,     0,     1,     1,     3,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     0,     4,
+       0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
+       0,     4,     0,     6,     1,     1,     0,     4,     0,     6,
+       1,     3,     0,     4,     0,     1,     1,     3,     1,     1,
+       1,     1,     1,     1,     1,     1,     0,     4,     3,     0,
+       6,     1,     3,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     0,     4,     1,     1,     1,     3,     0,     4,
+       3,     3,     3,     0,     6,     1,     3,     1,     1,     1,
+       1,     1,     0,     4,     0,     4,     0,     4,     0,     6,
+       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       3,     0,     4,     0,     4,     3,     0,     4,     3,     3,
-       0,     4,     1,     1,     0,     4,     3,     3,     0,     4,
-       1,     1,     1,     1,     1,     0,     4,     0,     4,     0,
-       4,     0,     4,     0,     4,     0,     4,     0,     6,     0,
-       4,     1,     3,     1,     1,     0,     6,     3,     0,     6,
-       0,     4,     1,     3,     1,     0,     6,     1,     3,     0,
-       4,     1,     3,     1,     1,     1,     1,     1,     1,     1,
-       3,     0,     4,     0,     6,     1,     3,     0,     4,     1,
-       3,     1,     1,     1,     1,     0,     4,     3,     3,     3
+       1,     1,     3,     0,     4,     0,     4,     3,     0,     4,
+       3,     3,     0,     4,     1,     1,     0,     4,     1,     1,
+       3,     3,     0,     4,     1,     1,     1,     1,     1,     0,
+       4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
+       4,     0,     6,     0,     4,     1,     3,     1,     1,     1,
+       0,     6,     3,     0,     4,     0,     6,     0,     4,     1,
+       3,     1,     0,     6,     1,     3,     0,     4,     1,     3,
+       1,     1,     1,     1,     1,     1,     1,     3,     0,     4,
+       0,     6,     1,     3,     0,     4,     1,     3,     1,     1,
+       1,     1,     1,     1,     0,     4,     3,     3,     3,     0,
+       4,     3
   };
 
 
-
+#if PARSER6_DEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const Dhcp6Parser::yytname_[] =
   {
-  "\"end of file\"", "error", "$undefined", "\",\"", "\":\"", "\"[\"",
-  "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp6\"", "\"data-directory\"",
-  "\"config-control\"", "\"config-databases\"",
-  "\"config-fetch-wait-time\"", "\"interfaces-config\"", "\"interfaces\"",
-  "\"re-detect\"", "\"lease-database\"", "\"hosts-database\"",
-  "\"hosts-databases\"", "\"type\"", "\"memfile\"", "\"mysql\"",
-  "\"postgresql\"", "\"cql\"", "\"user\"", "\"password\"", "\"host\"",
-  "\"port\"", "\"persist\"", "\"lfc-interval\"", "\"readonly\"",
-  "\"connect-timeout\"", "\"contact-points\"", "\"max-reconnect-tries\"",
-  "\"reconnect-wait-time\"", "\"keyspace\"", "\"consistency\"",
-  "\"serial-consistency\"", "\"request-timeout\"", "\"tcp-keepalive\"",
-  "\"tcp-nodelay\"", "\"preferred-lifetime\"",
-  "\"min-preferred-lifetime\"", "\"max-preferred-lifetime\"",
-  "\"valid-lifetime\"", "\"min-valid-lifetime\"", "\"max-valid-lifetime\"",
-  "\"renew-timer\"", "\"rebind-timer\"", "\"calculate-tee-times\"",
-  "\"t1-percent\"", "\"t2-percent\"", "\"decline-probation-period\"",
-  "\"server-tag\"", "\"subnet6\"", "\"option-def\"", "\"option-data\"",
-  "\"name\"", "\"data\"", "\"code\"", "\"space\"", "\"csv-format\"",
-  "\"always-send\"", "\"record-types\"", "\"encapsulate\"", "\"array\"",
-  "\"pools\"", "\"pool\"", "\"pd-pools\"", "\"prefix\"", "\"prefix-len\"",
-  "\"excluded-prefix\"", "\"excluded-prefix-len\"", "\"delegated-len\"",
-  "\"user-context\"", "\"comment\"", "\"subnet\"", "\"interface\"",
-  "\"interface-id\"", "\"id\"", "\"rapid-commit\"", "\"reservation-mode\"",
-  "\"disabled\"", "\"out-of-pool\"", "\"global\"", "\"all\"",
-  "\"shared-networks\"", "\"mac-sources\"", "\"relay-supplied-options\"",
+  "\"end of file\"", "error", "\"invalid token\"", "\",\"", "\":\"",
+  "\"[\"", "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp6\"",
+  "\"data-directory\"", "\"config-control\"", "\"config-databases\"",
+  "\"config-fetch-wait-time\"", "\"notify-fifo\"", "\"interfaces-config\"",
+  "\"interfaces\"", "\"re-detect\"", "\"lease-database\"",
+  "\"hosts-database\"", "\"hosts-databases\"", "\"type\"", "\"memfile\"",
+  "\"mysql\"", "\"postgresql\"", "\"cql\"", "\"user\"", "\"password\"",
+  "\"host\"", "\"port\"", "\"persist\"", "\"lfc-interval\"",
+  "\"readonly\"", "\"connect-timeout\"", "\"contact-points\"",
+  "\"max-reconnect-tries\"", "\"reconnect-wait-time\"", "\"keyspace\"",
+  "\"consistency\"", "\"serial-consistency\"", "\"request-timeout\"",
+  "\"tcp-keepalive\"", "\"tcp-nodelay\"", "\"pool-size\"",
+  "\"preferred-lifetime\"", "\"min-preferred-lifetime\"",
+  "\"max-preferred-lifetime\"", "\"valid-lifetime\"",
+  "\"min-valid-lifetime\"", "\"max-valid-lifetime\"", "\"renew-timer\"",
+  "\"rebind-timer\"", "\"calculate-tee-times\"", "\"t1-percent\"",
+  "\"t2-percent\"", "\"cache-threshold\"", "\"packet-arena-chunk-size\"",
+  "\"packet-slow-threshold\"", "\"host-filter-rebuild-interval\"",
+  "\"decline-probation-period\"", "\"server-tag\"", "\"subnet6\"",
+  "\"option-def\"", "\"option-data\"", "\"name\"", "\"data\"", "\"code\"",
+  "\"space\"", "\"csv-format\"", "\"always-send\"", "\"record-types\"",
+  "\"encapsulate\"", "\"array\"", "\"pools\"", "\"pool\"", "\"pd-pools\"",
+  "\"prefix\"", "\"prefix-len\"", "\"excluded-prefix\"",
+  "\"excluded-prefix-len\"", "\"delegated-len\"", "\"user-context\"",
+  "\"comment\"", "\"subnet\"", "\"interface\"", "\"interface-id\"",
+  "\"id\"", "\"rapid-commit\"", "\"reservation-mode\"", "\"disabled\"",
+  "\"out-of-pool\"", "\"global\"", "\"all\"", "\"shared-networks\"",
+  "\"mac-sources\"", "\"relay-supplied-options\"",
   "\"host-reservation-identifiers\"", "\"sanity-checks\"",
   "\"lease-checks\"", "\"client-classes\"", "\"require-client-classes\"",
   "\"test\"", "\"only-if-required\"", "\"client-class\"",
@@ -5037,15 +5270,16 @@ namespace isc { namespace dhcp {
   "\"max-queue-size\"", "\"ncr-protocol\"", "\"ncr-format\"",
   "\"override-no-update\"", "\"override-client-update\"",
   "\"replace-client-name\"", "\"generated-prefix\"", "\"UDP\"", "\"TCP\"",
-  "\"JSON\"", "\"when-present\"", "\"never\"", "\"always\"",
+  "\"JSON\"", "\"BINARY\"", "\"when-present\"", "\"never\"", "\"always\"",
   "\"when-not-present\"", "\"hostname-char-set\"",
   "\"hostname-char-replacement\"", "\"Logging\"", "\"loggers\"",
   "\"output_options\"", "\"output\"", "\"debuglevel\"", "\"severity\"",
-  "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"Dhcp4\"", "\"DhcpDdns\"",
-  "\"Control-agent\"", "TOPLEVEL_JSON", "TOPLEVEL_DHCP6", "SUB_DHCP6",
-  "SUB_INTERFACES6", "SUB_SUBNET6", "SUB_POOL6", "SUB_PD_POOL",
-  "SUB_RESERVATION", "SUB_OPTION_DEFS", "SUB_OPTION_DEF",
-  "SUB_OPTION_DATA", "SUB_HOOKS_LIBRARY", "SUB_DHCP_DDNS", "SUB_LOGGING",
+  "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"async\"",
+  "\"async-queue-size\"", "\"Dhcp4\"", "\"DhcpDdns\"", "\"Control-agent\"",
+  "TOPLEVEL_JSON", "TOPLEVEL_DHCP6", "SUB_DHCP6", "SUB_INTERFACES6",
+  "SUB_SUBNET6", "SUB_POOL6", "SUB_PD_POOL", "SUB_RESERVATION",
+  "SUB_OPTION_DEFS", "SUB_OPTION_DEF", "SUB_OPTION_DATA",
+  "SUB_HOOKS_LIBRARY", "SUB_DHCP_DDNS", "SUB_LOGGING",
   "SUB_CONFIG_CONTROL", "\"constant string\"", "\"integer\"",
   "\"floating point\"", "\"boolean\"", "$accept", "start", "$@1", "$@2",
   "$@3", "$@4", "$@5", "$@6", "$@7", "$@8", "$@9", "$@10", "$@11", "$@12",
@@ -5058,21 +5292,23 @@ namespace isc { namespace dhcp {
   "preferred_lifetime", "min_preferred_lifetime", "max_preferred_lifetime",
   "valid_lifetime", "min_valid_lifetime", "max_valid_lifetime",
   "renew_timer", "rebind_timer", "calculate_tee_times", "t1_percent",
-  "t2_percent", "decline_probation_period", "server_tag", "$@23",
-  "interfaces_config", "$@24", "sub_interfaces6", "$@25",
-  "interfaces_config_params", "interfaces_config_param", "interfaces_list",
-  "$@26", "re_detect", "lease_database", "$@27", "hosts_database", "$@28",
-  "hosts_databases", "$@29", "database_list", "not_empty_database_list",
-  "database", "$@30", "database_map_params", "database_map_param",
-  "database_type", "$@31", "db_type", "user", "$@32", "password", "$@33",
-  "host", "$@34", "port", "name", "$@35", "persist", "lfc_interval",
-  "readonly", "connect_timeout", "reconnect_wait_time", "request_timeout",
-  "tcp_keepalive", "tcp_nodelay", "contact_points", "$@36",
-  "max_reconnect_tries", "keyspace", "$@37", "consistency", "$@38",
-  "serial_consistency", "$@39", "sanity_checks", "$@40",
-  "sanity_checks_params", "sanity_checks_param", "lease_checks", "$@41",
-  "mac_sources", "$@42", "mac_sources_list", "mac_sources_value",
-  "duid_id", "string_id", "host_reservation_identifiers", "$@43",
+  "t2_percent", "cache_threshold", "packet_arena_chunk_size",
+  "packet_slow_threshold", "host_filter_rebuild_interval",
+  "decline_probation_period", "server_tag", "$@23", "interfaces_config",
+  "$@24", "sub_interfaces6", "$@25", "interfaces_config_params",
+  "interfaces_config_param", "interfaces_list", "$@26", "re_detect",
+  "lease_database", "$@27", "hosts_database", "$@28", "hosts_databases",
+  "$@29", "database_list", "not_empty_database_list", "database", "$@30",
+  "database_map_params", "database_map_param", "database_type", "$@31",
+  "db_type", "user", "$@32", "password", "$@33", "host", "$@34", "port",
+  "name", "$@35", "persist", "lfc_interval", "readonly", "connect_timeout",
+  "reconnect_wait_time", "request_timeout", "tcp_keepalive", "tcp_nodelay",
+  "pool_size", "contact_points", "$@36", "max_reconnect_tries", "keyspace",
+  "$@37", "consistency", "$@38", "serial_consistency", "$@39",
+  "sanity_checks", "$@40", "sanity_checks_params", "sanity_checks_param",
+  "lease_checks", "$@41", "mac_sources", "$@42", "mac_sources_list",
+  "mac_sources_value", "duid_id", "string_id",
+  "host_reservation_identifiers", "$@43",
   "host_reservation_identifiers_list", "host_reservation_identifier",
   "hw_address_id", "flex_id", "relay_supplied_options", "$@44",
   "hooks_libraries", "$@45", "hooks_libraries_list",
@@ -5129,117 +5365,121 @@ namespace isc { namespace dhcp {
   "enable_updates", "qualifying_suffix", "$@109", "server_ip", "$@110",
   "server_port", "sender_ip", "$@111", "sender_port", "max_queue_size",
   "ncr_protocol", "$@112", "ncr_protocol_value", "ncr_format", "$@113",
-  "override_no_update", "override_client_update", "replace_client_name",
-  "$@114", "replace_client_name_value", "generated_prefix", "$@115",
-  "hostname_char_set", "$@116", "hostname_char_replacement", "$@117",
-  "dhcp4_json_object", "$@118", "dhcpddns_json_object", "$@119",
-  "control_agent_json_object", "$@120", "config_control", "$@121",
-  "sub_config_control", "$@122", "config_control_params",
-  "config_control_param", "config_databases", "$@123",
-  "config_fetch_wait_time", "logging_object", "$@124", "sub_logging",
-  "$@125", "logging_params", "logging_param", "loggers", "$@126",
-  "loggers_entries", "logger_entry", "$@127", "logger_params",
-  "logger_param", "debuglevel", "severity", "$@128", "output_options_list",
-  "$@129", "output_options_list_content", "output_entry", "$@130",
-  "output_params_list", "output_params", "output", "$@131", "flush",
-  "maxsize", "maxver", YY_NULLPTR
+  "ncr_format_value", "override_no_update", "override_client_update",
+  "replace_client_name", "$@114", "replace_client_name_value",
+  "generated_prefix", "$@115", "hostname_char_set", "$@116",
+  "hostname_char_replacement", "$@117", "dhcp4_json_object", "$@118",
+  "dhcpddns_json_object", "$@119", "control_agent_json_object", "$@120",
+  "config_control", "$@121", "sub_config_control", "$@122",
+  "config_control_params", "config_control_param", "config_databases",
+  "$@123", "config_fetch_wait_time", "notify_fifo", "$@124",
+  "logging_object", "$@125", "sub_logging", "$@126", "logging_params",
+  "logging_param", "loggers", "$@127", "loggers_entries", "logger_entry",
+  "$@128", "logger_params", "logger_param", "debuglevel", "severity",
+  "$@129", "output_options_list", "$@130", "output_options_list_content",
+  "output_entry", "$@131", "output_params_list", "output_params", "output",
+  "$@132", "flush", "maxsize", "maxver", "async", "$@133",
+  "async_queue_size", YY_NULLPTR
   };
+#endif
+
 
 #if PARSER6_DEBUG
-  const unsigned short
+  const short
   Dhcp6Parser::yyrline_[] =
   {
-       0,   269,   269,   269,   270,   270,   271,   271,   272,   272,
-     273,   273,   274,   274,   275,   275,   276,   276,   277,   277,
-     278,   278,   279,   279,   280,   280,   281,   281,   282,   282,
-     283,   283,   291,   292,   293,   294,   295,   296,   297,   300,
-     305,   305,   316,   319,   320,   323,   327,   334,   334,   341,
-     342,   345,   349,   356,   356,   363,   364,   367,   371,   382,
-     392,   392,   407,   408,   412,   413,   414,   415,   416,   417,
-     420,   420,   435,   435,   444,   445,   450,   451,   452,   453,
-     454,   455,   456,   457,   458,   459,   460,   461,   462,   463,
+       0,   279,   279,   279,   280,   280,   281,   281,   282,   282,
+     283,   283,   284,   284,   285,   285,   286,   286,   287,   287,
+     288,   288,   289,   289,   290,   290,   291,   291,   292,   292,
+     293,   293,   301,   302,   303,   304,   305,   306,   307,   310,
+     315,   315,   326,   329,   330,   333,   337,   344,   344,   351,
+     352,   355,   359,   366,   366,   373,   374,   377,   381,   392,
+     402,   402,   417,   418,   422,   423,   424,   425,   426,   427,
+     430,   430,   445,   445,   454,   455,   460,   461,   462,   463,
      464,   465,   466,   467,   468,   469,   470,   471,   472,   473,
      474,   475,   476,   477,   478,   479,   480,   481,   482,   483,
-     484,   485,   486,   487,   488,   489,   490,   491,   492,   495,
-     495,   503,   508,   513,   518,   523,   528,   533,   538,   543,
-     548,   553,   558,   563,   563,   571,   571,   582,   582,   591,
-     592,   595,   596,   597,   598,   599,   602,   602,   612,   618,
-     618,   630,   630,   642,   642,   652,   653,   656,   657,   660,
-     660,   670,   671,   674,   675,   676,   677,   678,   679,   680,
-     681,   682,   683,   684,   685,   686,   687,   688,   689,   690,
-     691,   692,   693,   696,   696,   703,   704,   705,   706,   709,
-     709,   717,   717,   725,   725,   733,   738,   738,   746,   751,
-     756,   761,   766,   771,   776,   781,   786,   786,   794,   799,
-     799,   807,   807,   815,   815,   823,   823,   833,   834,   836,
-     838,   838,   856,   856,   866,   867,   870,   871,   874,   879,
-     884,   884,   894,   895,   898,   899,   900,   903,   908,   915,
-     915,   925,   925,   935,   936,   939,   940,   943,   943,   953,
-     953,   963,   964,   965,   968,   969,   972,   972,   980,   980,
-     988,   988,   999,  1000,  1003,  1004,  1005,  1006,  1007,  1008,
-    1011,  1016,  1021,  1026,  1031,  1036,  1044,  1044,  1057,  1058,
-    1061,  1062,  1069,  1069,  1095,  1095,  1106,  1107,  1111,  1112,
-    1113,  1114,  1115,  1116,  1117,  1118,  1119,  1120,  1121,  1122,
-    1123,  1124,  1125,  1126,  1127,  1128,  1129,  1130,  1131,  1132,
-    1133,  1134,  1135,  1136,  1137,  1140,  1140,  1148,  1148,  1156,
-    1156,  1164,  1164,  1172,  1172,  1182,  1182,  1189,  1190,  1191,
-    1192,  1195,  1200,  1208,  1208,  1219,  1220,  1224,  1225,  1228,
-    1228,  1236,  1237,  1240,  1241,  1242,  1243,  1244,  1245,  1246,
-    1247,  1248,  1249,  1250,  1251,  1252,  1253,  1254,  1255,  1256,
-    1257,  1258,  1259,  1260,  1261,  1262,  1263,  1270,  1270,  1283,
-    1283,  1292,  1293,  1296,  1297,  1302,  1302,  1317,  1317,  1331,
-    1332,  1335,  1336,  1339,  1340,  1341,  1342,  1343,  1344,  1345,
-    1346,  1347,  1348,  1351,  1353,  1358,  1360,  1360,  1368,  1368,
-    1376,  1376,  1384,  1386,  1386,  1394,  1403,  1403,  1415,  1416,
-    1421,  1422,  1427,  1427,  1439,  1439,  1451,  1452,  1457,  1458,
-    1463,  1464,  1465,  1466,  1467,  1468,  1469,  1470,  1471,  1474,
-    1476,  1476,  1484,  1486,  1488,  1493,  1501,  1501,  1513,  1514,
-    1517,  1518,  1521,  1521,  1531,  1531,  1540,  1541,  1544,  1545,
-    1546,  1547,  1548,  1549,  1550,  1553,  1553,  1561,  1561,  1586,
-    1586,  1616,  1616,  1628,  1629,  1632,  1633,  1636,  1636,  1648,
-    1648,  1660,  1661,  1664,  1665,  1666,  1667,  1668,  1669,  1670,
-    1671,  1672,  1673,  1674,  1677,  1677,  1685,  1690,  1690,  1698,
-    1703,  1711,  1711,  1721,  1722,  1725,  1726,  1729,  1729,  1738,
-    1738,  1747,  1748,  1751,  1752,  1756,  1757,  1758,  1759,  1760,
-    1761,  1762,  1763,  1764,  1765,  1766,  1769,  1769,  1779,  1779,
-    1789,  1789,  1797,  1797,  1805,  1805,  1813,  1813,  1821,  1821,
-    1834,  1834,  1844,  1845,  1848,  1848,  1859,  1859,  1869,  1870,
-    1873,  1873,  1883,  1884,  1887,  1888,  1891,  1892,  1893,  1894,
-    1895,  1896,  1897,  1900,  1902,  1902,  1910,  1918,  1918,  1930,
-    1931,  1934,  1935,  1936,  1937,  1938,  1939,  1940,  1941,  1942,
-    1945,  1945,  1952,  1953,  1954,  1957,  1962,  1962,  1970,  1975,
-    1982,  1989,  1989,  1999,  2000,  2003,  2004,  2005,  2006,  2007,
-    2010,  2010,  2018,  2018,  2028,  2028,  2068,  2068,  2080,  2080,
-    2090,  2091,  2094,  2095,  2096,  2097,  2098,  2099,  2100,  2101,
-    2102,  2103,  2104,  2105,  2106,  2107,  2108,  2109,  2110,  2111,
-    2114,  2119,  2119,  2127,  2127,  2135,  2140,  2140,  2148,  2153,
-    2158,  2158,  2166,  2167,  2170,  2170,  2178,  2183,  2188,  2188,
-    2196,  2199,  2202,  2205,  2208,  2214,  2214,  2222,  2222,  2230,
-    2230,  2240,  2240,  2247,  2247,  2254,  2254,  2263,  2263,  2274,
-    2274,  2284,  2285,  2289,  2290,  2293,  2293,  2303,  2313,  2313,
-    2323,  2323,  2334,  2335,  2339,  2343,  2343,  2355,  2356,  2360,
-    2360,  2368,  2369,  2372,  2373,  2374,  2375,  2376,  2377,  2378,
-    2381,  2386,  2386,  2394,  2394,  2404,  2405,  2408,  2408,  2416,
-    2417,  2420,  2421,  2422,  2423,  2426,  2426,  2434,  2439,  2444
+     484,   485,   486,   487,   488,   489,   490,   491,   492,   493,
+     494,   495,   496,   497,   498,   499,   500,   501,   502,   503,
+     504,   505,   506,   509,   509,   517,   522,   527,   532,   537,
+     542,   547,   552,   557,   562,   567,   572,   577,   582,   587,
+     592,   597,   597,   605,   605,   616,   616,   625,   626,   629,
+     630,   631,   632,   633,   636,   636,   646,   652,   652,   664,
+     664,   676,   676,   686,   687,   690,   691,   694,   694,   704,
+     705,   708,   709,   710,   711,   712,   713,   714,   715,   716,
+     717,   718,   719,   720,   721,   722,   723,   724,   725,   726,
+     727,   728,   731,   731,   738,   739,   740,   741,   744,   744,
+     752,   752,   760,   760,   768,   773,   773,   781,   786,   791,
+     796,   801,   806,   811,   816,   821,   826,   826,   834,   839,
+     839,   847,   847,   855,   855,   863,   863,   873,   874,   876,
+     878,   878,   896,   896,   906,   907,   910,   911,   914,   919,
+     924,   924,   934,   935,   938,   939,   940,   943,   948,   955,
+     955,   965,   965,   975,   976,   979,   980,   983,   983,   993,
+     993,  1003,  1004,  1005,  1008,  1009,  1012,  1012,  1020,  1020,
+    1028,  1028,  1039,  1040,  1043,  1044,  1045,  1046,  1047,  1048,
+    1051,  1056,  1061,  1066,  1071,  1076,  1084,  1084,  1097,  1098,
+    1101,  1102,  1109,  1109,  1135,  1135,  1146,  1147,  1151,  1152,
+    1153,  1154,  1155,  1156,  1157,  1158,  1159,  1160,  1161,  1162,
+    1163,  1164,  1165,  1166,  1167,  1168,  1169,  1170,  1171,  1172,
+    1173,  1174,  1175,  1176,  1177,  1178,  1181,  1181,  1189,  1189,
+    1197,  1197,  1205,  1205,  1213,  1213,  1223,  1223,  1230,  1231,
+    1232,  1233,  1236,  1241,  1249,  1249,  1260,  1261,  1265,  1266,
+    1269,  1269,  1277,  1278,  1281,  1282,  1283,  1284,  1285,  1286,
+    1287,  1288,  1289,  1290,  1291,  1292,  1293,  1294,  1295,  1296,
+    1297,  1298,  1299,  1300,  1301,  1302,  1303,  1304,  1305,  1312,
+    1312,  1325,  1325,  1334,  1335,  1338,  1339,  1344,  1344,  1359,
+    1359,  1373,  1374,  1377,  1378,  1381,  1382,  1383,  1384,  1385,
+    1386,  1387,  1388,  1389,  1390,  1393,  1395,  1400,  1402,  1402,
+    1410,  1410,  1418,  1418,  1426,  1428,  1428,  1436,  1445,  1445,
+    1457,  1458,  1463,  1464,  1469,  1469,  1481,  1481,  1493,  1494,
+    1499,  1500,  1505,  1506,  1507,  1508,  1509,  1510,  1511,  1512,
+    1513,  1516,  1518,  1518,  1526,  1528,  1530,  1535,  1543,  1543,
+    1555,  1556,  1559,  1560,  1563,  1563,  1573,  1573,  1582,  1583,
+    1586,  1587,  1588,  1589,  1590,  1591,  1592,  1595,  1595,  1603,
+    1603,  1628,  1628,  1658,  1658,  1670,  1671,  1674,  1675,  1678,
+    1678,  1690,  1690,  1702,  1703,  1706,  1707,  1708,  1709,  1710,
+    1711,  1712,  1713,  1714,  1715,  1716,  1719,  1719,  1727,  1732,
+    1732,  1740,  1745,  1753,  1753,  1763,  1764,  1767,  1768,  1771,
+    1771,  1780,  1780,  1789,  1790,  1793,  1794,  1798,  1799,  1800,
+    1801,  1802,  1803,  1804,  1805,  1806,  1807,  1808,  1811,  1811,
+    1821,  1821,  1831,  1831,  1839,  1839,  1847,  1847,  1855,  1855,
+    1863,  1863,  1876,  1876,  1886,  1887,  1890,  1890,  1901,  1901,
+    1911,  1912,  1915,  1915,  1925,  1926,  1929,  1930,  1933,  1934,
+    1935,  1936,  1937,  1938,  1939,  1942,  1944,  1944,  1952,  1960,
+    1960,  1972,  1973,  1976,  1977,  1978,  1979,  1980,  1981,  1982,
+    1983,  1984,  1987,  1987,  1994,  1995,  1996,  1999,  2004,  2004,
+    2012,  2017,  2024,  2031,  2031,  2041,  2042,  2045,  2046,  2047,
+    2048,  2049,  2052,  2052,  2060,  2060,  2070,  2070,  2110,  2110,
+    2122,  2122,  2132,  2133,  2136,  2137,  2138,  2139,  2140,  2141,
+    2142,  2143,  2144,  2145,  2146,  2147,  2148,  2149,  2150,  2151,
+    2152,  2153,  2156,  2161,  2161,  2169,  2169,  2177,  2182,  2182,
+    2190,  2195,  2200,  2200,  2208,  2209,  2212,  2212,  2220,  2221,
+    2224,  2229,  2234,  2234,  2242,  2245,  2248,  2251,  2254,  2260,
+    2260,  2268,  2268,  2276,  2276,  2286,  2286,  2293,  2293,  2300,
+    2300,  2309,  2309,  2320,  2320,  2330,  2331,  2335,  2336,  2337,
+    2340,  2340,  2350,  2355,  2355,  2368,  2368,  2378,  2378,  2389,
+    2390,  2394,  2398,  2398,  2410,  2411,  2415,  2415,  2423,  2424,
+    2427,  2428,  2429,  2430,  2431,  2432,  2433,  2436,  2441,  2441,
+    2449,  2449,  2459,  2460,  2463,  2463,  2471,  2472,  2475,  2476,
+    2477,  2478,  2479,  2480,  2483,  2483,  2491,  2496,  2501,  2506,
+    2506,  2514
   };
 
-  // Print the state stack on the debug stream.
   void
-  Dhcp6Parser::yystack_print_ ()
+  Dhcp6Parser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
+      *yycdebug_ << ' ' << int (i->state);
     *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  Dhcp6Parser::yy_reduce_print_ (int yyrule)
+  Dhcp6Parser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
@@ -5254,9 +5494,9 @@ namespace isc { namespace dhcp {
 
 #line 14 "dhcp6_parser.yy"
 } } // isc::dhcp
-#line 5258 "dhcp6_parser.cc"
+#line 5498 "dhcp6_parser.cc"
 
-#line 2449 "dhcp6_parser.yy"
+#line 2522 "dhcp6_parser.yy"
 
 
 void
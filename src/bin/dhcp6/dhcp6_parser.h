@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.4.1.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton interface for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015, 2018-2019 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -38,12 +38,13 @@
 
 // C++ LALR(1) parser skeleton written by Akim Demaille.
 
-// Undocumented macros, especially those whose name start with YY_,
-// are private implementation details.  Do not rely on them.
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
 
 #ifndef YY_PARSER6_DHCP6_PARSER_H_INCLUDED
 # define YY_PARSER6_DHCP6_PARSER_H_INCLUDED
-// //                    "%code requires" blocks.
+// "%code requires" blocks.
 #line 17 "dhcp6_parser.yy"
 
 #include <string>
@@ -56,7 +57,7 @@ using namespace isc::dhcp;
 using namespace isc::data;
 using namespace std;
 
-#line 60 "dhcp6_parser.h"
+#line 61 "dhcp6_parser.h"
 
 # include <cassert>
 # include <cstdlib> // std::abort
@@ -103,44 +104,48 @@ using namespace std;
 #endif
 # include "location.hh"
 #include <typeinfo>
-#ifndef YYASSERT
+#ifndef PARSER6__ASSERT
 # include <cassert>
-# define YYASSERT assert
+# define PARSER6__ASSERT assert
 #endif
 
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
 # else
-#  define YY_ATTRIBUTE(Spec) /* empty */
+#  define YY_ATTRIBUTE_PURE
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
-#endif
-
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && ! defined __ICC && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -153,6 +158,27 @@ using namespace std;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
 #  if defined __cplusplus
 #   if 201103L <= __cplusplus
@@ -180,7 +206,7 @@ using namespace std;
 
 #line 14 "dhcp6_parser.yy"
 namespace isc { namespace dhcp {
-#line 184 "dhcp6_parser.h"
+#line 210 "dhcp6_parser.h"
 
 
 
@@ -189,37 +215,49 @@ namespace isc { namespace dhcp {
   class Dhcp6Parser
   {
   public:
-#ifndef PARSER6_STYPE
+#ifdef PARSER6_STYPE
+# ifdef __GNUC__
+#  pragma GCC message "bison: do not #define PARSER6_STYPE in C++, use %define api.value.type"
+# endif
+    typedef PARSER6_STYPE value_type;
+#else
   /// A buffer to store and retrieve objects.
   ///
   /// Sort of a variant, but does not keep track of the nature
   /// of the stored data, since that knowledge is available
   /// via the current parser state.
-  class semantic_type
+  class value_type
   {
   public:
     /// Type of *this.
-    typedef semantic_type self_type;
+    typedef value_type self_type;
 
     /// Empty construction.
-    semantic_type () YY_NOEXCEPT
-      : yybuffer_ ()
+    value_type () YY_NOEXCEPT
+      : yyraw_ ()
       , yytypeid_ (YY_NULLPTR)
     {}
 
     /// Construct and fill.
     template <typename T>
-    semantic_type (YY_RVREF (T) t)
+    value_type (YY_RVREF (T) t)
       : yytypeid_ (&typeid (T))
     {
-      YYASSERT (sizeof (T) <= size);
+      PARSER6__ASSERT (sizeof (T) <= size);
       new (yyas_<T> ()) T (YY_MOVE (t));
     }
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    value_type (const self_type&) = delete;
+    /// Non copyable.
+    self_type& operator= (const self_type&) = delete;
+#endif
+
     /// Destruction, allowed only if empty.
-    ~semantic_type () YY_NOEXCEPT
+    ~value_type () YY_NOEXCEPT
     {
-      YYASSERT (!yytypeid_);
+      PARSER6__ASSERT (!yytypeid_);
     }
 
 # if 201103L <= YY_CPLUSPLUS
@@ -228,8 +266,8 @@ namespace isc { namespace dhcp {
     T&
     emplace (U&&... u)
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= size);
+      PARSER6__ASSERT (!yytypeid_);
+      PARSER6__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T (std::forward <U>(u)...);
     }
@@ -239,8 +277,8 @@ namespace isc { namespace dhcp {
     T&
     emplace ()
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= size);
+      PARSER6__ASSERT (!yytypeid_);
+      PARSER6__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T ();
     }
@@ -250,8 +288,8 @@ namespace isc { namespace dhcp {
     T&
     emplace (const T& t)
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= size);
+      PARSER6__ASSERT (!yytypeid_);
+      PARSER6__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T (t);
     }
@@ -280,9 +318,9 @@ namespace isc { namespace dhcp {
     T&
     as () YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= size);
+      PARSER6__ASSERT (yytypeid_);
+      PARSER6__ASSERT (*yytypeid_ == typeid (T));
+      PARSER6__ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
@@ -291,9 +329,9 @@ namespace isc { namespace dhcp {
     const T&
     as () const YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= size);
+      PARSER6__ASSERT (yytypeid_);
+      PARSER6__ASSERT (*yytypeid_ == typeid (T));
+      PARSER6__ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
@@ -309,8 +347,8 @@ namespace isc { namespace dhcp {
     void
     swap (self_type& that) YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == *that.yytypeid_);
+      PARSER6__ASSERT (yytypeid_);
+      PARSER6__ASSERT (*yytypeid_ == *that.yytypeid_);
       std::swap (as<T> (), that.as<T> ());
     }
 
@@ -359,16 +397,19 @@ namespace isc { namespace dhcp {
     }
 
   private:
-    /// Prohibit blind copies.
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    value_type (const self_type&);
+    /// Non copyable.
     self_type& operator= (const self_type&);
-    semantic_type (const self_type&);
+#endif
 
     /// Accessor to raw memory as \a T.
     template <typename T>
     T*
     yyas_ () YY_NOEXCEPT
     {
-      void *yyp = yybuffer_.yyraw;
+      void *yyp = yyraw_;
       return static_cast<T*> (yyp);
      }
 
@@ -377,7 +418,7 @@ namespace isc { namespace dhcp {
     const T*
     yyas_ () const YY_NOEXCEPT
     {
-      const void *yyp = yybuffer_.yyraw;
+      const void *yyp = yyraw_;
       return static_cast<const T*> (yyp);
      }
 
@@ -390,6 +431,7 @@ namespace isc { namespace dhcp {
       // hr_mode
       // duid_type
       // ncr_protocol_value
+      // ncr_format_value
       // replace_client_name_value
       char dummy1[sizeof (ElementPtr)];
 
@@ -413,18 +455,19 @@ namespace isc { namespace dhcp {
     union
     {
       /// Strongest alignment constraints.
-      long double yyalign_me;
+      long double yyalign_me_;
       /// A buffer large enough to store any of the semantic values.
-      char yyraw[size];
-    } yybuffer_;
+      char yyraw_[size];
+    };
 
     /// Whether the content is built: if defined, the name of the stored type.
     const std::type_info *yytypeid_;
   };
 
-#else
-    typedef PARSER6_STYPE semantic_type;
 #endif
+    /// Backward compatibility (Bison 3.8).
+    typedef value_type semantic_type;
+
     /// Symbol locations.
     typedef location location_type;
 
@@ -446,213 +489,845 @@ namespace isc { namespace dhcp {
       location_type location;
     };
 
-    /// Tokens.
+    /// Token kinds.
     struct token
     {
-      enum yytokentype
-      {
-        TOKEN_END = 0,
-        TOKEN_COMMA = 258,
-        TOKEN_COLON = 259,
-        TOKEN_LSQUARE_BRACKET = 260,
-        TOKEN_RSQUARE_BRACKET = 261,
-        TOKEN_LCURLY_BRACKET = 262,
-        TOKEN_RCURLY_BRACKET = 263,
-        TOKEN_NULL_TYPE = 264,
-        TOKEN_DHCP6 = 265,
-        TOKEN_DATA_DIRECTORY = 266,
-        TOKEN_CONFIG_CONTROL = 267,
-        TOKEN_CONFIG_DATABASES = 268,
-        TOKEN_CONFIG_FETCH_WAIT_TIME = 269,
-        TOKEN_INTERFACES_CONFIG = 270,
-        TOKEN_INTERFACES = 271,
-        TOKEN_RE_DETECT = 272,
-        TOKEN_LEASE_DATABASE = 273,
-        TOKEN_HOSTS_DATABASE = 274,
-        TOKEN_HOSTS_DATABASES = 275,
-        TOKEN_TYPE = 276,
-        TOKEN_MEMFILE = 277,
-        TOKEN_MYSQL = 278,
-        TOKEN_POSTGRESQL = 279,
-        TOKEN_CQL = 280,
-        TOKEN_USER = 281,
-        TOKEN_PASSWORD = 282,
-        TOKEN_HOST = 283,
-        TOKEN_PORT = 284,
-        TOKEN_PERSIST = 285,
-        TOKEN_LFC_INTERVAL = 286,
-        TOKEN_READONLY = 287,
-        TOKEN_CONNECT_TIMEOUT = 288,
-        TOKEN_CONTACT_POINTS = 289,
-        TOKEN_MAX_RECONNECT_TRIES = 290,
-        TOKEN_RECONNECT_WAIT_TIME = 291,
-        TOKEN_KEYSPACE = 292,
-        TOKEN_CONSISTENCY = 293,
-        TOKEN_SERIAL_CONSISTENCY = 294,
-        TOKEN_REQUEST_TIMEOUT = 295,
-        TOKEN_TCP_KEEPALIVE = 296,
-        TOKEN_TCP_NODELAY = 297,
-        TOKEN_PREFERRED_LIFETIME = 298,
-        TOKEN_MIN_PREFERRED_LIFETIME = 299,
-        TOKEN_MAX_PREFERRED_LIFETIME = 300,
-        TOKEN_VALID_LIFETIME = 301,
-        TOKEN_MIN_VALID_LIFETIME = 302,
-        TOKEN_MAX_VALID_LIFETIME = 303,
-        TOKEN_RENEW_TIMER = 304,
-        TOKEN_REBIND_TIMER = 305,
-        TOKEN_CALCULATE_TEE_TIMES = 306,
-        TOKEN_T1_PERCENT = 307,
-        TOKEN_T2_PERCENT = 308,
-        TOKEN_DECLINE_PROBATION_PERIOD = 309,
-        TOKEN_SERVER_TAG = 310,
-        TOKEN_SUBNET6 = 311,
-        TOKEN_OPTION_DEF = 312,
-        TOKEN_OPTION_DATA = 313,
-        TOKEN_NAME = 314,
-        TOKEN_DATA = 315,
-        TOKEN_CODE = 316,
-        TOKEN_SPACE = 317,
-        TOKEN_CSV_FORMAT = 318,
-        TOKEN_ALWAYS_SEND = 319,
-        TOKEN_RECORD_TYPES = 320,
-        TOKEN_ENCAPSULATE = 321,
-        TOKEN_ARRAY = 322,
-        TOKEN_POOLS = 323,
-        TOKEN_POOL = 324,
-        TOKEN_PD_POOLS = 325,
-        TOKEN_PREFIX = 326,
-        TOKEN_PREFIX_LEN = 327,
-        TOKEN_EXCLUDED_PREFIX = 328,
-        TOKEN_EXCLUDED_PREFIX_LEN = 329,
-        TOKEN_DELEGATED_LEN = 330,
-        TOKEN_USER_CONTEXT = 331,
-        TOKEN_COMMENT = 332,
-        TOKEN_SUBNET = 333,
-        TOKEN_INTERFACE = 334,
-        TOKEN_INTERFACE_ID = 335,
-        TOKEN_ID = 336,
-        TOKEN_RAPID_COMMIT = 337,
-        TOKEN_RESERVATION_MODE = 338,
-        TOKEN_DISABLED = 339,
-        TOKEN_OUT_OF_POOL = 340,
-        TOKEN_GLOBAL = 341,
-        TOKEN_ALL = 342,
-        TOKEN_SHARED_NETWORKS = 343,
-        TOKEN_MAC_SOURCES = 344,
-        TOKEN_RELAY_SUPPLIED_OPTIONS = 345,
-        TOKEN_HOST_RESERVATION_IDENTIFIERS = 346,
-        TOKEN_SANITY_CHECKS = 347,
-        TOKEN_LEASE_CHECKS = 348,
-        TOKEN_CLIENT_CLASSES = 349,
-        TOKEN_REQUIRE_CLIENT_CLASSES = 350,
-        TOKEN_TEST = 351,
-        TOKEN_ONLY_IF_REQUIRED = 352,
-        TOKEN_CLIENT_CLASS = 353,
-        TOKEN_RESERVATIONS = 354,
-        TOKEN_IP_ADDRESSES = 355,
-        TOKEN_PREFIXES = 356,
-        TOKEN_DUID = 357,
-        TOKEN_HW_ADDRESS = 358,
-        TOKEN_HOSTNAME = 359,
-        TOKEN_FLEX_ID = 360,
-        TOKEN_RELAY = 361,
-        TOKEN_IP_ADDRESS = 362,
-        TOKEN_HOOKS_LIBRARIES = 363,
-        TOKEN_LIBRARY = 364,
-        TOKEN_PARAMETERS = 365,
-        TOKEN_EXPIRED_LEASES_PROCESSING = 366,
-        TOKEN_RECLAIM_TIMER_WAIT_TIME = 367,
-        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 368,
-        TOKEN_HOLD_RECLAIMED_TIME = 369,
-        TOKEN_MAX_RECLAIM_LEASES = 370,
-        TOKEN_MAX_RECLAIM_TIME = 371,
-        TOKEN_UNWARNED_RECLAIM_CYCLES = 372,
-        TOKEN_SERVER_ID = 373,
-        TOKEN_LLT = 374,
-        TOKEN_EN = 375,
-        TOKEN_LL = 376,
-        TOKEN_IDENTIFIER = 377,
-        TOKEN_HTYPE = 378,
-        TOKEN_TIME = 379,
-        TOKEN_ENTERPRISE_ID = 380,
-        TOKEN_DHCP4O6_PORT = 381,
-        TOKEN_CONTROL_SOCKET = 382,
-        TOKEN_SOCKET_TYPE = 383,
-        TOKEN_SOCKET_NAME = 384,
-        TOKEN_DHCP_QUEUE_CONTROL = 385,
-        TOKEN_DHCP_DDNS = 386,
-        TOKEN_ENABLE_UPDATES = 387,
-        TOKEN_QUALIFYING_SUFFIX = 388,
-        TOKEN_SERVER_IP = 389,
-        TOKEN_SERVER_PORT = 390,
-        TOKEN_SENDER_IP = 391,
-        TOKEN_SENDER_PORT = 392,
-        TOKEN_MAX_QUEUE_SIZE = 393,
-        TOKEN_NCR_PROTOCOL = 394,
-        TOKEN_NCR_FORMAT = 395,
-        TOKEN_OVERRIDE_NO_UPDATE = 396,
-        TOKEN_OVERRIDE_CLIENT_UPDATE = 397,
-        TOKEN_REPLACE_CLIENT_NAME = 398,
-        TOKEN_GENERATED_PREFIX = 399,
-        TOKEN_UDP = 400,
-        TOKEN_TCP = 401,
-        TOKEN_JSON = 402,
-        TOKEN_WHEN_PRESENT = 403,
-        TOKEN_NEVER = 404,
-        TOKEN_ALWAYS = 405,
-        TOKEN_WHEN_NOT_PRESENT = 406,
-        TOKEN_HOSTNAME_CHAR_SET = 407,
-        TOKEN_HOSTNAME_CHAR_REPLACEMENT = 408,
-        TOKEN_LOGGING = 409,
-        TOKEN_LOGGERS = 410,
-        TOKEN_OUTPUT_OPTIONS = 411,
-        TOKEN_OUTPUT = 412,
-        TOKEN_DEBUGLEVEL = 413,
-        TOKEN_SEVERITY = 414,
-        TOKEN_FLUSH = 415,
-        TOKEN_MAXSIZE = 416,
-        TOKEN_MAXVER = 417,
-        TOKEN_DHCP4 = 418,
-        TOKEN_DHCPDDNS = 419,
-        TOKEN_CONTROL_AGENT = 420,
-        TOKEN_TOPLEVEL_JSON = 421,
-        TOKEN_TOPLEVEL_DHCP6 = 422,
-        TOKEN_SUB_DHCP6 = 423,
-        TOKEN_SUB_INTERFACES6 = 424,
-        TOKEN_SUB_SUBNET6 = 425,
-        TOKEN_SUB_POOL6 = 426,
-        TOKEN_SUB_PD_POOL = 427,
-        TOKEN_SUB_RESERVATION = 428,
-        TOKEN_SUB_OPTION_DEFS = 429,
-        TOKEN_SUB_OPTION_DEF = 430,
-        TOKEN_SUB_OPTION_DATA = 431,
-        TOKEN_SUB_HOOKS_LIBRARY = 432,
-        TOKEN_SUB_DHCP_DDNS = 433,
-        TOKEN_SUB_LOGGING = 434,
-        TOKEN_SUB_CONFIG_CONTROL = 435,
-        TOKEN_STRING = 436,
-        TOKEN_INTEGER = 437,
-        TOKEN_FLOAT = 438,
-        TOKEN_BOOLEAN = 439
+      enum token_kind_type
+      {
+        TOKEN_PARSER6_EMPTY = -2,
+    TOKEN_END = 0,                 // "end of file"
+    TOKEN_PARSER6_error = 256,     // error
+    TOKEN_PARSER6_UNDEF = 257,     // "invalid token"
+    TOKEN_COMMA = 258,             // ","
+    TOKEN_COLON = 259,             // ":"
+    TOKEN_LSQUARE_BRACKET = 260,   // "["
+    TOKEN_RSQUARE_BRACKET = 261,   // "]"
+    TOKEN_LCURLY_BRACKET = 262,    // "{"
+    TOKEN_RCURLY_BRACKET = 263,    // "}"
+    TOKEN_NULL_TYPE = 264,         // "null"
+    TOKEN_DHCP6 = 265,             // "Dhcp6"
+    TOKEN_DATA_DIRECTORY = 266,    // "data-directory"
+    TOKEN_CONFIG_CONTROL = 267,    // "config-control"
+    TOKEN_CONFIG_DATABASES = 268,  // "config-databases"
+    TOKEN_CONFIG_FETCH_WAIT_TIME = 269, // "config-fetch-wait-time"
+    TOKEN_NOTIFY_FIFO = 270,       // "notify-fifo"
+    TOKEN_INTERFACES_CONFIG = 271, // "interfaces-config"
+    TOKEN_INTERFACES = 272,        // "interfaces"
+    TOKEN_RE_DETECT = 273,         // "re-detect"
+    TOKEN_LEASE_DATABASE = 274,    // "lease-database"
+    TOKEN_HOSTS_DATABASE = 275,    // "hosts-database"
+    TOKEN_HOSTS_DATABASES = 276,   // "hosts-databases"
+    TOKEN_TYPE = 277,              // "type"
+    TOKEN_MEMFILE = 278,           // "memfile"
+    TOKEN_MYSQL = 279,             // "mysql"
+    TOKEN_POSTGRESQL = 280,        // "postgresql"
+    TOKEN_CQL = 281,               // "cql"
+    TOKEN_USER = 282,              // "user"
+    TOKEN_PASSWORD = 283,          // "password"
+    TOKEN_HOST = 284,              // "host"
+    TOKEN_PORT = 285,              // "port"
+    TOKEN_PERSIST = 286,           // "persist"
+    TOKEN_LFC_INTERVAL = 287,      // "lfc-interval"
+    TOKEN_READONLY = 288,          // "readonly"
+    TOKEN_CONNECT_TIMEOUT = 289,   // "connect-timeout"
+    TOKEN_CONTACT_POINTS = 290,    // "contact-points"
+    TOKEN_MAX_RECONNECT_TRIES = 291, // "max-reconnect-tries"
+    TOKEN_RECONNECT_WAIT_TIME = 292, // "reconnect-wait-time"
+    TOKEN_KEYSPACE = 293,          // "keyspace"
+    TOKEN_CONSISTENCY = 294,       // "consistency"
+    TOKEN_SERIAL_CONSISTENCY = 295, // "serial-consistency"
+    TOKEN_REQUEST_TIMEOUT = 296,   // "request-timeout"
+    TOKEN_TCP_KEEPALIVE = 297,     // "tcp-keepalive"
+    TOKEN_TCP_NODELAY = 298,       // "tcp-nodelay"
+    TOKEN_POOL_SIZE = 299,         // "pool-size"
+    TOKEN_PREFERRED_LIFETIME = 300, // "preferred-lifetime"
+    TOKEN_MIN_PREFERRED_LIFETIME = 301, // "min-preferred-lifetime"
+    TOKEN_MAX_PREFERRED_LIFETIME = 302, // "max-preferred-lifetime"
+    TOKEN_VALID_LIFETIME = 303,    // "valid-lifetime"
+    TOKEN_MIN_VALID_LIFETIME = 304, // "min-valid-lifetime"
+    TOKEN_MAX_VALID_LIFETIME = 305, // "max-valid-lifetime"
+    TOKEN_RENEW_TIMER = 306,       // "renew-timer"
+    TOKEN_REBIND_TIMER = 307,      // "rebind-timer"
+    TOKEN_CALCULATE_TEE_TIMES = 308, // "calculate-tee-times"
+    TOKEN_T1_PERCENT = 309,        // "t1-percent"
+    TOKEN_T2_PERCENT = 310,        // "t2-percent"
+    TOKEN_CACHE_THRESHOLD = 311,   // "cache-threshold"
+    TOKEN_PACKET_ARENA_CHUNK_SIZE = 312, // "packet-arena-chunk-size"
+    TOKEN_PACKET_SLOW_THRESHOLD = 313, // "packet-slow-threshold"
+    TOKEN_HOST_FILTER_REBUILD_INTERVAL = 314, // "host-filter-rebuild-interval"
+    TOKEN_DECLINE_PROBATION_PERIOD = 315, // "decline-probation-period"
+    TOKEN_SERVER_TAG = 316,        // "server-tag"
+    TOKEN_SUBNET6 = 317,           // "subnet6"
+    TOKEN_OPTION_DEF = 318,        // "option-def"
+    TOKEN_OPTION_DATA = 319,       // "option-data"
+    TOKEN_NAME = 320,              // "name"
+    TOKEN_DATA = 321,              // "data"
+    TOKEN_CODE = 322,              // "code"
+    TOKEN_SPACE = 323,             // "space"
+    TOKEN_CSV_FORMAT = 324,        // "csv-format"
+    TOKEN_ALWAYS_SEND = 325,       // "always-send"
+    TOKEN_RECORD_TYPES = 326,      // "record-types"
+    TOKEN_ENCAPSULATE = 327,       // "encapsulate"
+    TOKEN_ARRAY = 328,             // "array"
+    TOKEN_POOLS = 329,             // "pools"
+    TOKEN_POOL = 330,              // "pool"
+    TOKEN_PD_POOLS = 331,          // "pd-pools"
+    TOKEN_PREFIX = 332,            // "prefix"
+    TOKEN_PREFIX_LEN = 333,        // "prefix-len"
+    TOKEN_EXCLUDED_PREFIX = 334,   // "excluded-prefix"
+    TOKEN_EXCLUDED_PREFIX_LEN = 335, // "excluded-prefix-len"
+    TOKEN_DELEGATED_LEN = 336,     // "delegated-len"
+    TOKEN_USER_CONTEXT = 337,      // "user-context"
+    TOKEN_COMMENT = 338,           // "comment"
+    TOKEN_SUBNET = 339,            // "subnet"
+    TOKEN_INTERFACE = 340,         // "interface"
+    TOKEN_INTERFACE_ID = 341,      // "interface-id"
+    TOKEN_ID = 342,                // "id"
+    TOKEN_RAPID_COMMIT = 343,      // "rapid-commit"
+    TOKEN_RESERVATION_MODE = 344,  // "reservation-mode"
+    TOKEN_DISABLED = 345,          // "disabled"
+    TOKEN_OUT_OF_POOL = 346,       // "out-of-pool"
+    TOKEN_GLOBAL = 347,            // "global"
+    TOKEN_ALL = 348,               // "all"
+    TOKEN_SHARED_NETWORKS = 349,   // "shared-networks"
+    TOKEN_MAC_SOURCES = 350,       // "mac-sources"
+    TOKEN_RELAY_SUPPLIED_OPTIONS = 351, // "relay-supplied-options"
+    TOKEN_HOST_RESERVATION_IDENTIFIERS = 352, // "host-reservation-identifiers"
+    TOKEN_SANITY_CHECKS = 353,     // "sanity-checks"
+    TOKEN_LEASE_CHECKS = 354,      // "lease-checks"
+    TOKEN_CLIENT_CLASSES = 355,    // "client-classes"
+    TOKEN_REQUIRE_CLIENT_CLASSES = 356, // "require-client-classes"
+    TOKEN_TEST = 357,              // "test"
+    TOKEN_ONLY_IF_REQUIRED = 358,  // "only-if-required"
+    TOKEN_CLIENT_CLASS = 359,      // "client-class"
+    TOKEN_RESERVATIONS = 360,      // "reservations"
+    TOKEN_IP_ADDRESSES = 361,      // "ip-addresses"
+    TOKEN_PREFIXES = 362,          // "prefixes"
+    TOKEN_DUID = 363,              // "duid"
+    TOKEN_HW_ADDRESS = 364,        // "hw-address"
+    TOKEN_HOSTNAME = 365,          // "hostname"
+    TOKEN_FLEX_ID = 366,           // "flex-id"
+    TOKEN_RELAY = 367,             // "relay"
+    TOKEN_IP_ADDRESS = 368,        // "ip-address"
+    TOKEN_HOOKS_LIBRARIES = 369,   // "hooks-libraries"
+    TOKEN_LIBRARY = 370,           // "library"
+    TOKEN_PARAMETERS = 371,        // "parameters"
+    TOKEN_EXPIRED_LEASES_PROCESSING = 372, // "expired-leases-processing"
+    TOKEN_RECLAIM_TIMER_WAIT_TIME = 373, // "reclaim-timer-wait-time"
+    TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 374, // "flush-reclaimed-timer-wait-time"
+    TOKEN_HOLD_RECLAIMED_TIME = 375, // "hold-reclaimed-time"
+    TOKEN_MAX_RECLAIM_LEASES = 376, // "max-reclaim-leases"
+    TOKEN_MAX_RECLAIM_TIME = 377,  // "max-reclaim-time"
+    TOKEN_UNWARNED_RECLAIM_CYCLES = 378, // "unwarned-reclaim-cycles"
+    TOKEN_SERVER_ID = 379,         // "server-id"
+    TOKEN_LLT = 380,               // "LLT"
+    TOKEN_EN = 381,                // "EN"
+    TOKEN_LL = 382,                // "LL"
+    TOKEN_IDENTIFIER = 383,        // "identifier"
+    TOKEN_HTYPE = 384,             // "htype"
+    TOKEN_TIME = 385,              // "time"
+    TOKEN_ENTERPRISE_ID = 386,     // "enterprise-id"
+    TOKEN_DHCP4O6_PORT = 387,      // "dhcp4o6-port"
+    TOKEN_CONTROL_SOCKET = 388,    // "control-socket"
+    TOKEN_SOCKET_TYPE = 389,       // "socket-type"
+    TOKEN_SOCKET_NAME = 390,       // "socket-name"
+    TOKEN_DHCP_QUEUE_CONTROL = 391, // "dhcp-queue-control"
+    TOKEN_DHCP_DDNS = 392,         // "dhcp-ddns"
+    TOKEN_ENABLE_UPDATES = 393,    // "enable-updates"
+    TOKEN_QUALIFYING_SUFFIX = 394, // "qualifying-suffix"
+    TOKEN_SERVER_IP = 395,         // "server-ip"
+    TOKEN_SERVER_PORT = 396,       // "server-port"
+    TOKEN_SENDER_IP = 397,         // "sender-ip"
+    TOKEN_SENDER_PORT = 398,       // "sender-port"
+    TOKEN_MAX_QUEUE_SIZE = 399,    // "max-queue-size"
+    TOKEN_NCR_PROTOCOL = 400,      // "ncr-protocol"
+    TOKEN_NCR_FORMAT = 401,        // "ncr-format"
+    TOKEN_OVERRIDE_NO_UPDATE = 402, // "override-no-update"
+    TOKEN_OVERRIDE_CLIENT_UPDATE = 403, // "override-client-update"
+    TOKEN_REPLACE_CLIENT_NAME = 404, // "replace-client-name"
+    TOKEN_GENERATED_PREFIX = 405,  // "generated-prefix"
+    TOKEN_UDP = 406,               // "UDP"
+    TOKEN_TCP = 407,               // "TCP"
+    TOKEN_JSON = 408,              // "JSON"
+    TOKEN_BINARY = 409,            // "BINARY"
+    TOKEN_WHEN_PRESENT = 410,      // "when-present"
+    TOKEN_NEVER = 411,             // "never"
+    TOKEN_ALWAYS = 412,            // "always"
+    TOKEN_WHEN_NOT_PRESENT = 413,  // "when-not-present"
+    TOKEN_HOSTNAME_CHAR_SET = 414, // "hostname-char-set"
+    TOKEN_HOSTNAME_CHAR_REPLACEMENT = 415, // "hostname-char-replacement"
+    TOKEN_LOGGING = 416,           // "Logging"
+    TOKEN_LOGGERS = 417,           // "loggers"
+    TOKEN_OUTPUT_OPTIONS = 418,    // "output_options"
+    TOKEN_OUTPUT = 419,            // "output"
+    TOKEN_DEBUGLEVEL = 420,        // "debuglevel"
+    TOKEN_SEVERITY = 421,          // "severity"
+    TOKEN_FLUSH = 422,             // "flush"
+    TOKEN_MAXSIZE = 423,           // "maxsize"
+    TOKEN_MAXVER = 424,            // "maxver"
+    TOKEN_ASYNC = 425,             // "async"
+    TOKEN_ASYNC_QUEUE_SIZE = 426,  // "async-queue-size"
+    TOKEN_DHCP4 = 427,             // "Dhcp4"
+    TOKEN_DHCPDDNS = 428,          // "DhcpDdns"
+    TOKEN_CONTROL_AGENT = 429,     // "Control-agent"
+    TOKEN_TOPLEVEL_JSON = 430,     // TOPLEVEL_JSON
+    TOKEN_TOPLEVEL_DHCP6 = 431,    // TOPLEVEL_DHCP6
+    TOKEN_SUB_DHCP6 = 432,         // SUB_DHCP6
+    TOKEN_SUB_INTERFACES6 = 433,   // SUB_INTERFACES6
+    TOKEN_SUB_SUBNET6 = 434,       // SUB_SUBNET6
+    TOKEN_SUB_POOL6 = 435,         // SUB_POOL6
+    TOKEN_SUB_PD_POOL = 436,       // SUB_PD_POOL
+    TOKEN_SUB_RESERVATION = 437,   // SUB_RESERVATION
+    TOKEN_SUB_OPTION_DEFS = 438,   // SUB_OPTION_DEFS
+    TOKEN_SUB_OPTION_DEF = 439,    // SUB_OPTION_DEF
+    TOKEN_SUB_OPTION_DATA = 440,   // SUB_OPTION_DATA
+    TOKEN_SUB_HOOKS_LIBRARY = 441, // SUB_HOOKS_LIBRARY
+    TOKEN_SUB_DHCP_DDNS = 442,     // SUB_DHCP_DDNS
+    TOKEN_SUB_LOGGING = 443,       // SUB_LOGGING
+    TOKEN_SUB_CONFIG_CONTROL = 444, // SUB_CONFIG_CONTROL
+    TOKEN_STRING = 445,            // "constant string"
+    TOKEN_INTEGER = 446,           // "integer"
+    TOKEN_FLOAT = 447,             // "floating point"
+    TOKEN_BOOLEAN = 448            // "boolean"
       };
+      /// Backward compatibility alias (Bison 3.6).
+      typedef token_kind_type yytokentype;
     };
 
-    /// (External) token type, as returned by yylex.
-    typedef token::yytokentype token_type;
+    /// Token kind, as returned by yylex.
+    typedef token::token_kind_type token_kind_type;
+
+    /// Backward compatibility alias (Bison 3.6).
+    typedef token_kind_type token_type;
 
-    /// Symbol type: an internal symbol number.
-    typedef int symbol_number_type;
+    /// Symbol kinds.
+    struct symbol_kind
+    {
+      enum symbol_kind_type
+      {
+        YYNTOKENS = 194, ///< Number of tokens.
+        S_YYEMPTY = -2,
+        S_YYEOF = 0,                             // "end of file"
+        S_YYerror = 1,                           // error
+        S_YYUNDEF = 2,                           // "invalid token"
+        S_COMMA = 3,                             // ","
+        S_COLON = 4,                             // ":"
+        S_LSQUARE_BRACKET = 5,                   // "["
+        S_RSQUARE_BRACKET = 6,                   // "]"
+        S_LCURLY_BRACKET = 7,                    // "{"
+        S_RCURLY_BRACKET = 8,                    // "}"
+        S_NULL_TYPE = 9,                         // "null"
+        S_DHCP6 = 10,                            // "Dhcp6"
+        S_DATA_DIRECTORY = 11,                   // "data-directory"
+        S_CONFIG_CONTROL = 12,                   // "config-control"
+        S_CONFIG_DATABASES = 13,                 // "config-databases"
+        S_CONFIG_FETCH_WAIT_TIME = 14,           // "config-fetch-wait-time"
+        S_NOTIFY_FIFO = 15,                      // "notify-fifo"
+        S_INTERFACES_CONFIG = 16,                // "interfaces-config"
+        S_INTERFACES = 17,                       // "interfaces"
+        S_RE_DETECT = 18,                        // "re-detect"
+        S_LEASE_DATABASE = 19,                   // "lease-database"
+        S_HOSTS_DATABASE = 20,                   // "hosts-database"
+        S_HOSTS_DATABASES = 21,                  // "hosts-databases"
+        S_TYPE = 22,                             // "type"
+        S_MEMFILE = 23,                          // "memfile"
+        S_MYSQL = 24,                            // "mysql"
+        S_POSTGRESQL = 25,                       // "postgresql"
+        S_CQL = 26,                              // "cql"
+        S_USER = 27,                             // "user"
+        S_PASSWORD = 28,                         // "password"
+        S_HOST = 29,                             // "host"
+        S_PORT = 30,                             // "port"
+        S_PERSIST = 31,                          // "persist"
+        S_LFC_INTERVAL = 32,                     // "lfc-interval"
+        S_READONLY = 33,                         // "readonly"
+        S_CONNECT_TIMEOUT = 34,                  // "connect-timeout"
+        S_CONTACT_POINTS = 35,                   // "contact-points"
+        S_MAX_RECONNECT_TRIES = 36,              // "max-reconnect-tries"
+        S_RECONNECT_WAIT_TIME = 37,              // "reconnect-wait-time"
+        S_KEYSPACE = 38,                         // "keyspace"
+        S_CONSISTENCY = 39,                      // "consistency"
+        S_SERIAL_CONSISTENCY = 40,               // "serial-consistency"
+        S_REQUEST_TIMEOUT = 41,                  // "request-timeout"
+        S_TCP_KEEPALIVE = 42,                    // "tcp-keepalive"
+        S_TCP_NODELAY = 43,                      // "tcp-nodelay"
+        S_POOL_SIZE = 44,                        // "pool-size"
+        S_PREFERRED_LIFETIME = 45,               // "preferred-lifetime"
+        S_MIN_PREFERRED_LIFETIME = 46,           // "min-preferred-lifetime"
+        S_MAX_PREFERRED_LIFETIME = 47,           // "max-preferred-lifetime"
+        S_VALID_LIFETIME = 48,                   // "valid-lifetime"
+        S_MIN_VALID_LIFETIME = 49,               // "min-valid-lifetime"
+        S_MAX_VALID_LIFETIME = 50,               // "max-valid-lifetime"
+        S_RENEW_TIMER = 51,                      // "renew-timer"
+        S_REBIND_TIMER = 52,                     // "rebind-timer"
+        S_CALCULATE_TEE_TIMES = 53,              // "calculate-tee-times"
+        S_T1_PERCENT = 54,                       // "t1-percent"
+        S_T2_PERCENT = 55,                       // "t2-percent"
+        S_CACHE_THRESHOLD = 56,                  // "cache-threshold"
+        S_PACKET_ARENA_CHUNK_SIZE = 57,          // "packet-arena-chunk-size"
+        S_PACKET_SLOW_THRESHOLD = 58,            // "packet-slow-threshold"
+        S_HOST_FILTER_REBUILD_INTERVAL = 59,     // "host-filter-rebuild-interval"
+        S_DECLINE_PROBATION_PERIOD = 60,         // "decline-probation-period"
+        S_SERVER_TAG = 61,                       // "server-tag"
+        S_SUBNET6 = 62,                          // "subnet6"
+        S_OPTION_DEF = 63,                       // "option-def"
+        S_OPTION_DATA = 64,                      // "option-data"
+        S_NAME = 65,                             // "name"
+        S_DATA = 66,                             // "data"
+        S_CODE = 67,                             // "code"
+        S_SPACE = 68,                            // "space"
+        S_CSV_FORMAT = 69,                       // "csv-format"
+        S_ALWAYS_SEND = 70,                      // "always-send"
+        S_RECORD_TYPES = 71,                     // "record-types"
+        S_ENCAPSULATE = 72,                      // "encapsulate"
+        S_ARRAY = 73,                            // "array"
+        S_POOLS = 74,                            // "pools"
+        S_POOL = 75,                             // "pool"
+        S_PD_POOLS = 76,                         // "pd-pools"
+        S_PREFIX = 77,                           // "prefix"
+        S_PREFIX_LEN = 78,                       // "prefix-len"
+        S_EXCLUDED_PREFIX = 79,                  // "excluded-prefix"
+        S_EXCLUDED_PREFIX_LEN = 80,              // "excluded-prefix-len"
+        S_DELEGATED_LEN = 81,                    // "delegated-len"
+        S_USER_CONTEXT = 82,                     // "user-context"
+        S_COMMENT = 83,                          // "comment"
+        S_SUBNET = 84,                           // "subnet"
+        S_INTERFACE = 85,                        // "interface"
+        S_INTERFACE_ID = 86,                     // "interface-id"
+        S_ID = 87,                               // "id"
+        S_RAPID_COMMIT = 88,                     // "rapid-commit"
+        S_RESERVATION_MODE = 89,                 // "reservation-mode"
+        S_DISABLED = 90,                         // "disabled"
+        S_OUT_OF_POOL = 91,                      // "out-of-pool"
+        S_GLOBAL = 92,                           // "global"
+        S_ALL = 93,                              // "all"
+        S_SHARED_NETWORKS = 94,                  // "shared-networks"
+        S_MAC_SOURCES = 95,                      // "mac-sources"
+        S_RELAY_SUPPLIED_OPTIONS = 96,           // "relay-supplied-options"
+        S_HOST_RESERVATION_IDENTIFIERS = 97,     // "host-reservation-identifiers"
+        S_SANITY_CHECKS = 98,                    // "sanity-checks"
+        S_LEASE_CHECKS = 99,                     // "lease-checks"
+        S_CLIENT_CLASSES = 100,                  // "client-classes"
+        S_REQUIRE_CLIENT_CLASSES = 101,          // "require-client-classes"
+        S_TEST = 102,                            // "test"
+        S_ONLY_IF_REQUIRED = 103,                // "only-if-required"
+        S_CLIENT_CLASS = 104,                    // "client-class"
+        S_RESERVATIONS = 105,                    // "reservations"
+        S_IP_ADDRESSES = 106,                    // "ip-addresses"
+        S_PREFIXES = 107,                        // "prefixes"
+        S_DUID = 108,                            // "duid"
+        S_HW_ADDRESS = 109,                      // "hw-address"
+        S_HOSTNAME = 110,                        // "hostname"
+        S_FLEX_ID = 111,                         // "flex-id"
+        S_RELAY = 112,                           // "relay"
+        S_IP_ADDRESS = 113,                      // "ip-address"
+        S_HOOKS_LIBRARIES = 114,                 // "hooks-libraries"
+        S_LIBRARY = 115,                         // "library"
+        S_PARAMETERS = 116,                      // "parameters"
+        S_EXPIRED_LEASES_PROCESSING = 117,       // "expired-leases-processing"
+        S_RECLAIM_TIMER_WAIT_TIME = 118,         // "reclaim-timer-wait-time"
+        S_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 119, // "flush-reclaimed-timer-wait-time"
+        S_HOLD_RECLAIMED_TIME = 120,             // "hold-reclaimed-time"
+        S_MAX_RECLAIM_LEASES = 121,              // "max-reclaim-leases"
+        S_MAX_RECLAIM_TIME = 122,                // "max-reclaim-time"
+        S_UNWARNED_RECLAIM_CYCLES = 123,         // "unwarned-reclaim-cycles"
+        S_SERVER_ID = 124,                       // "server-id"
+        S_LLT = 125,                             // "LLT"
+        S_EN = 126,                              // "EN"
+        S_LL = 127,                              // "LL"
+        S_IDENTIFIER = 128,                      // "identifier"
+        S_HTYPE = 129,                           // "htype"
+        S_TIME = 130,                            // "time"
+        S_ENTERPRISE_ID = 131,                   // "enterprise-id"
+        S_DHCP4O6_PORT = 132,                    // "dhcp4o6-port"
+        S_CONTROL_SOCKET = 133,                  // "control-socket"
+        S_SOCKET_TYPE = 134,                     // "socket-type"
+        S_SOCKET_NAME = 135,                     // "socket-name"
+        S_DHCP_QUEUE_CONTROL = 136,              // "dhcp-queue-control"
+        S_DHCP_DDNS = 137,                       // "dhcp-ddns"
+        S_ENABLE_UPDATES = 138,                  // "enable-updates"
+        S_QUALIFYING_SUFFIX = 139,               // "qualifying-suffix"
+        S_SERVER_IP = 140,                       // "server-ip"
+        S_SERVER_PORT = 141,                     // "server-port"
+        S_SENDER_IP = 142,                       // "sender-ip"
+        S_SENDER_PORT = 143,                     // "sender-port"
+        S_MAX_QUEUE_SIZE = 144,                  // "max-queue-size"
+        S_NCR_PROTOCOL = 145,                    // "ncr-protocol"
+        S_NCR_FORMAT = 146,                      // "ncr-format"
+        S_OVERRIDE_NO_UPDATE = 147,              // "override-no-update"
+        S_OVERRIDE_CLIENT_UPDATE = 148,          // "override-client-update"
+        S_REPLACE_CLIENT_NAME = 149,             // "replace-client-name"
+        S_GENERATED_PREFIX = 150,                // "generated-prefix"
+        S_UDP = 151,                             // "UDP"
+        S_TCP = 152,                             // "TCP"
+        S_JSON = 153,                            // "JSON"
+        S_BINARY = 154,                          // "BINARY"
+        S_WHEN_PRESENT = 155,                    // "when-present"
+        S_NEVER = 156,                           // "never"
+        S_ALWAYS = 157,                          // "always"
+        S_WHEN_NOT_PRESENT = 158,                // "when-not-present"
+        S_HOSTNAME_CHAR_SET = 159,               // "hostname-char-set"
+        S_HOSTNAME_CHAR_REPLACEMENT = 160,       // "hostname-char-replacement"
+        S_LOGGING = 161,                         // "Logging"
+        S_LOGGERS = 162,                         // "loggers"
+        S_OUTPUT_OPTIONS = 163,                  // "output_options"
+        S_OUTPUT = 164,                          // "output"
+        S_DEBUGLEVEL = 165,                      // "debuglevel"
+        S_SEVERITY = 166,                        // "severity"
+        S_FLUSH = 167,                           // "flush"
+        S_MAXSIZE = 168,                         // "maxsize"
+        S_MAXVER = 169,                          // "maxver"
+        S_ASYNC = 170,                           // "async"
+        S_ASYNC_QUEUE_SIZE = 171,                // "async-queue-size"
+        S_DHCP4 = 172,                           // "Dhcp4"
+        S_DHCPDDNS = 173,                        // "DhcpDdns"
+        S_CONTROL_AGENT = 174,                   // "Control-agent"
+        S_TOPLEVEL_JSON = 175,                   // TOPLEVEL_JSON
+        S_TOPLEVEL_DHCP6 = 176,                  // TOPLEVEL_DHCP6
+        S_SUB_DHCP6 = 177,                       // SUB_DHCP6
+        S_SUB_INTERFACES6 = 178,                 // SUB_INTERFACES6
+        S_SUB_SUBNET6 = 179,                     // SUB_SUBNET6
+        S_SUB_POOL6 = 180,                       // SUB_POOL6
+        S_SUB_PD_POOL = 181,                     // SUB_PD_POOL
+        S_SUB_RESERVATION = 182,                 // SUB_RESERVATION
+        S_SUB_OPTION_DEFS = 183,                 // SUB_OPTION_DEFS
+        S_SUB_OPTION_DEF = 184,                  // SUB_OPTION_DEF
+        S_SUB_OPTION_DATA = 185,                 // SUB_OPTION_DATA
+        S_SUB_HOOKS_LIBRARY = 186,               // SUB_HOOKS_LIBRARY
+        S_SUB_DHCP_DDNS = 187,                   // SUB_DHCP_DDNS
+        S_SUB_LOGGING = 188,                     // SUB_LOGGING
+        S_SUB_CONFIG_CONTROL = 189,              // SUB_CONFIG_CONTROL
+        S_STRING = 190,                          // "constant string"
+        S_INTEGER = 191,                         // "integer"
+        S_FLOAT = 192,                           // "floating point"
+        S_BOOLEAN = 193,                         // "boolean"
+        S_YYACCEPT = 194,                        // $accept
+        S_start = 195,                           // start
+        S_196_1 = 196,                           // $@1
+        S_197_2 = 197,                           // $@2
+        S_198_3 = 198,                           // $@3
+        S_199_4 = 199,                           // $@4
+        S_200_5 = 200,                           // $@5
+        S_201_6 = 201,                           // $@6
+        S_202_7 = 202,                           // $@7
+        S_203_8 = 203,                           // $@8
+        S_204_9 = 204,                           // $@9
+        S_205_10 = 205,                          // $@10
+        S_206_11 = 206,                          // $@11
+        S_207_12 = 207,                          // $@12
+        S_208_13 = 208,                          // $@13
+        S_209_14 = 209,                          // $@14
+        S_210_15 = 210,                          // $@15
+        S_value = 211,                           // value
+        S_sub_json = 212,                        // sub_json
+        S_map2 = 213,                            // map2
+        S_214_16 = 214,                          // $@16
+        S_map_value = 215,                       // map_value
+        S_map_content = 216,                     // map_content
+        S_not_empty_map = 217,                   // not_empty_map
+        S_list_generic = 218,                    // list_generic
+        S_219_17 = 219,                          // $@17
+        S_list_content = 220,                    // list_content
+        S_not_empty_list = 221,                  // not_empty_list
+        S_list_strings = 222,                    // list_strings
+        S_223_18 = 223,                          // $@18
+        S_list_strings_content = 224,            // list_strings_content
+        S_not_empty_list_strings = 225,          // not_empty_list_strings
+        S_unknown_map_entry = 226,               // unknown_map_entry
+        S_syntax_map = 227,                      // syntax_map
+        S_228_19 = 228,                          // $@19
+        S_global_objects = 229,                  // global_objects
+        S_global_object = 230,                   // global_object
+        S_dhcp6_object = 231,                    // dhcp6_object
+        S_232_20 = 232,                          // $@20
+        S_sub_dhcp6 = 233,                       // sub_dhcp6
+        S_234_21 = 234,                          // $@21
+        S_global_params = 235,                   // global_params
+        S_global_param = 236,                    // global_param
+        S_data_directory = 237,                  // data_directory
+        S_238_22 = 238,                          // $@22
+        S_preferred_lifetime = 239,              // preferred_lifetime
+        S_min_preferred_lifetime = 240,          // min_preferred_lifetime
+        S_max_preferred_lifetime = 241,          // max_preferred_lifetime
+        S_valid_lifetime = 242,                  // valid_lifetime
+        S_min_valid_lifetime = 243,              // min_valid_lifetime
+        S_max_valid_lifetime = 244,              // max_valid_lifetime
+        S_renew_timer = 245,                     // renew_timer
+        S_rebind_timer = 246,                    // rebind_timer
+        S_calculate_tee_times = 247,             // calculate_tee_times
+        S_t1_percent = 248,                      // t1_percent
+        S_t2_percent = 249,                      // t2_percent
+        S_cache_threshold = 250,                 // cache_threshold
+        S_packet_arena_chunk_size = 251,         // packet_arena_chunk_size
+        S_packet_slow_threshold = 252,           // packet_slow_threshold
+        S_host_filter_rebuild_interval = 253,    // host_filter_rebuild_interval
+        S_decline_probation_period = 254,        // decline_probation_period
+        S_server_tag = 255,                      // server_tag
+        S_256_23 = 256,                          // $@23
+        S_interfaces_config = 257,               // interfaces_config
+        S_258_24 = 258,                          // $@24
+        S_sub_interfaces6 = 259,                 // sub_interfaces6
+        S_260_25 = 260,                          // $@25
+        S_interfaces_config_params = 261,        // interfaces_config_params
+        S_interfaces_config_param = 262,         // interfaces_config_param
+        S_interfaces_list = 263,                 // interfaces_list
+        S_264_26 = 264,                          // $@26
+        S_re_detect = 265,                       // re_detect
+        S_lease_database = 266,                  // lease_database
+        S_267_27 = 267,                          // $@27
+        S_hosts_database = 268,                  // hosts_database
+        S_269_28 = 269,                          // $@28
+        S_hosts_databases = 270,                 // hosts_databases
+        S_271_29 = 271,                          // $@29
+        S_database_list = 272,                   // database_list
+        S_not_empty_database_list = 273,         // not_empty_database_list
+        S_database = 274,                        // database
+        S_275_30 = 275,                          // $@30
+        S_database_map_params = 276,             // database_map_params
+        S_database_map_param = 277,              // database_map_param
+        S_database_type = 278,                   // database_type
+        S_279_31 = 279,                          // $@31
+        S_db_type = 280,                         // db_type
+        S_user = 281,                            // user
+        S_282_32 = 282,                          // $@32
+        S_password = 283,                        // password
+        S_284_33 = 284,                          // $@33
+        S_host = 285,                            // host
+        S_286_34 = 286,                          // $@34
+        S_port = 287,                            // port
+        S_name = 288,                            // name
+        S_289_35 = 289,                          // $@35
+        S_persist = 290,                         // persist
+        S_lfc_interval = 291,                    // lfc_interval
+        S_readonly = 292,                        // readonly
+        S_connect_timeout = 293,                 // connect_timeout
+        S_reconnect_wait_time = 294,             // reconnect_wait_time
+        S_request_timeout = 295,                 // request_timeout
+        S_tcp_keepalive = 296,                   // tcp_keepalive
+        S_tcp_nodelay = 297,                     // tcp_nodelay
+        S_pool_size = 298,                       // pool_size
+        S_contact_points = 299,                  // contact_points
+        S_300_36 = 300,                          // $@36
+        S_max_reconnect_tries = 301,             // max_reconnect_tries
+        S_keyspace = 302,                        // keyspace
+        S_303_37 = 303,                          // $@37
+        S_consistency = 304,                     // consistency
+        S_305_38 = 305,                          // $@38
+        S_serial_consistency = 306,              // serial_consistency
+        S_307_39 = 307,                          // $@39
+        S_sanity_checks = 308,                   // sanity_checks
+        S_309_40 = 309,                          // $@40
+        S_sanity_checks_params = 310,            // sanity_checks_params
+        S_sanity_checks_param = 311,             // sanity_checks_param
+        S_lease_checks = 312,                    // lease_checks
+        S_313_41 = 313,                          // $@41
+        S_mac_sources = 314,                     // mac_sources
+        S_315_42 = 315,                          // $@42
+        S_mac_sources_list = 316,                // mac_sources_list
+        S_mac_sources_value = 317,               // mac_sources_value
+        S_duid_id = 318,                         // duid_id
+        S_string_id = 319,                       // string_id
+        S_host_reservation_identifiers = 320,    // host_reservation_identifiers
+        S_321_43 = 321,                          // $@43
+        S_host_reservation_identifiers_list = 322, // host_reservation_identifiers_list
+        S_host_reservation_identifier = 323,     // host_reservation_identifier
+        S_hw_address_id = 324,                   // hw_address_id
+        S_flex_id = 325,                         // flex_id
+        S_relay_supplied_options = 326,          // relay_supplied_options
+        S_327_44 = 327,                          // $@44
+        S_hooks_libraries = 328,                 // hooks_libraries
+        S_329_45 = 329,                          // $@45
+        S_hooks_libraries_list = 330,            // hooks_libraries_list
+        S_not_empty_hooks_libraries_list = 331,  // not_empty_hooks_libraries_list
+        S_hooks_library = 332,                   // hooks_library
+        S_333_46 = 333,                          // $@46
+        S_sub_hooks_library = 334,               // sub_hooks_library
+        S_335_47 = 335,                          // $@47
+        S_hooks_params = 336,                    // hooks_params
+        S_hooks_param = 337,                     // hooks_param
+        S_library = 338,                         // library
+        S_339_48 = 339,                          // $@48
+        S_parameters = 340,                      // parameters
+        S_341_49 = 341,                          // $@49
+        S_expired_leases_processing = 342,       // expired_leases_processing
+        S_343_50 = 343,                          // $@50
+        S_expired_leases_params = 344,           // expired_leases_params
+        S_expired_leases_param = 345,            // expired_leases_param
+        S_reclaim_timer_wait_time = 346,         // reclaim_timer_wait_time
+        S_flush_reclaimed_timer_wait_time = 347, // flush_reclaimed_timer_wait_time
+        S_hold_reclaimed_time = 348,             // hold_reclaimed_time
+        S_max_reclaim_leases = 349,              // max_reclaim_leases
+        S_max_reclaim_time = 350,                // max_reclaim_time
+        S_unwarned_reclaim_cycles = 351,         // unwarned_reclaim_cycles
+        S_subnet6_list = 352,                    // subnet6_list
+        S_353_51 = 353,                          // $@51
+        S_subnet6_list_content = 354,            // subnet6_list_content
+        S_not_empty_subnet6_list = 355,          // not_empty_subnet6_list
+        S_subnet6 = 356,                         // subnet6
+        S_357_52 = 357,                          // $@52
+        S_sub_subnet6 = 358,                     // sub_subnet6
+        S_359_53 = 359,                          // $@53
+        S_subnet6_params = 360,                  // subnet6_params
+        S_subnet6_param = 361,                   // subnet6_param
+        S_subnet = 362,                          // subnet
+        S_363_54 = 363,                          // $@54
+        S_interface = 364,                       // interface
+        S_365_55 = 365,                          // $@55
+        S_interface_id = 366,                    // interface_id
+        S_367_56 = 367,                          // $@56
+        S_client_class = 368,                    // client_class
+        S_369_57 = 369,                          // $@57
+        S_require_client_classes = 370,          // require_client_classes
+        S_371_58 = 371,                          // $@58
+        S_reservation_mode = 372,                // reservation_mode
+        S_373_59 = 373,                          // $@59
+        S_hr_mode = 374,                         // hr_mode
+        S_id = 375,                              // id
+        S_rapid_commit = 376,                    // rapid_commit
+        S_shared_networks = 377,                 // shared_networks
+        S_378_60 = 378,                          // $@60
+        S_shared_networks_content = 379,         // shared_networks_content
+        S_shared_networks_list = 380,            // shared_networks_list
+        S_shared_network = 381,                  // shared_network
+        S_382_61 = 382,                          // $@61
+        S_shared_network_params = 383,           // shared_network_params
+        S_shared_network_param = 384,            // shared_network_param
+        S_option_def_list = 385,                 // option_def_list
+        S_386_62 = 386,                          // $@62
+        S_sub_option_def_list = 387,             // sub_option_def_list
+        S_388_63 = 388,                          // $@63
+        S_option_def_list_content = 389,         // option_def_list_content
+        S_not_empty_option_def_list = 390,       // not_empty_option_def_list
+        S_option_def_entry = 391,                // option_def_entry
+        S_392_64 = 392,                          // $@64
+        S_sub_option_def = 393,                  // sub_option_def
+        S_394_65 = 394,                          // $@65
+        S_option_def_params = 395,               // option_def_params
+        S_not_empty_option_def_params = 396,     // not_empty_option_def_params
+        S_option_def_param = 397,                // option_def_param
+        S_option_def_name = 398,                 // option_def_name
+        S_code = 399,                            // code
+        S_option_def_code = 400,                 // option_def_code
+        S_option_def_type = 401,                 // option_def_type
+        S_402_66 = 402,                          // $@66
+        S_option_def_record_types = 403,         // option_def_record_types
+        S_404_67 = 404,                          // $@67
+        S_space = 405,                           // space
+        S_406_68 = 406,                          // $@68
+        S_option_def_space = 407,                // option_def_space
+        S_option_def_encapsulate = 408,          // option_def_encapsulate
+        S_409_69 = 409,                          // $@69
+        S_option_def_array = 410,                // option_def_array
+        S_option_data_list = 411,                // option_data_list
+        S_412_70 = 412,                          // $@70
+        S_option_data_list_content = 413,        // option_data_list_content
+        S_not_empty_option_data_list = 414,      // not_empty_option_data_list
+        S_option_data_entry = 415,               // option_data_entry
+        S_416_71 = 416,                          // $@71
+        S_sub_option_data = 417,                 // sub_option_data
+        S_418_72 = 418,                          // $@72
+        S_option_data_params = 419,              // option_data_params
+        S_not_empty_option_data_params = 420,    // not_empty_option_data_params
+        S_option_data_param = 421,               // option_data_param
+        S_option_data_name = 422,                // option_data_name
+        S_option_data_data = 423,                // option_data_data
+        S_424_73 = 424,                          // $@73
+        S_option_data_code = 425,                // option_data_code
+        S_option_data_space = 426,               // option_data_space
+        S_option_data_csv_format = 427,          // option_data_csv_format
+        S_option_data_always_send = 428,         // option_data_always_send
+        S_pools_list = 429,                      // pools_list
+        S_430_74 = 430,                          // $@74
+        S_pools_list_content = 431,              // pools_list_content
+        S_not_empty_pools_list = 432,            // not_empty_pools_list
+        S_pool_list_entry = 433,                 // pool_list_entry
+        S_434_75 = 434,                          // $@75
+        S_sub_pool6 = 435,                       // sub_pool6
+        S_436_76 = 436,                          // $@76
+        S_pool_params = 437,                     // pool_params
+        S_pool_param = 438,                      // pool_param
+        S_pool_entry = 439,                      // pool_entry
+        S_440_77 = 440,                          // $@77
+        S_user_context = 441,                    // user_context
+        S_442_78 = 442,                          // $@78
+        S_comment = 443,                         // comment
+        S_444_79 = 444,                          // $@79
+        S_pd_pools_list = 445,                   // pd_pools_list
+        S_446_80 = 446,                          // $@80
+        S_pd_pools_list_content = 447,           // pd_pools_list_content
+        S_not_empty_pd_pools_list = 448,         // not_empty_pd_pools_list
+        S_pd_pool_entry = 449,                   // pd_pool_entry
+        S_450_81 = 450,                          // $@81
+        S_sub_pd_pool = 451,                     // sub_pd_pool
+        S_452_82 = 452,                          // $@82
+        S_pd_pool_params = 453,                  // pd_pool_params
+        S_pd_pool_param = 454,                   // pd_pool_param
+        S_pd_prefix = 455,                       // pd_prefix
+        S_456_83 = 456,                          // $@83
+        S_pd_prefix_len = 457,                   // pd_prefix_len
+        S_excluded_prefix = 458,                 // excluded_prefix
+        S_459_84 = 459,                          // $@84
+        S_excluded_prefix_len = 460,             // excluded_prefix_len
+        S_pd_delegated_len = 461,                // pd_delegated_len
+        S_reservations = 462,                    // reservations
+        S_463_85 = 463,                          // $@85
+        S_reservations_list = 464,               // reservations_list
+        S_not_empty_reservations_list = 465,     // not_empty_reservations_list
+        S_reservation = 466,                     // reservation
+        S_467_86 = 467,                          // $@86
+        S_sub_reservation = 468,                 // sub_reservation
+        S_469_87 = 469,                          // $@87
+        S_reservation_params = 470,              // reservation_params
+        S_not_empty_reservation_params = 471,    // not_empty_reservation_params
+        S_reservation_param = 472,               // reservation_param
+        S_ip_addresses = 473,                    // ip_addresses
+        S_474_88 = 474,                          // $@88
+        S_prefixes = 475,                        // prefixes
+        S_476_89 = 476,                          // $@89
+        S_duid = 477,                            // duid
+        S_478_90 = 478,                          // $@90
+        S_hw_address = 479,                      // hw_address
+        S_480_91 = 480,                          // $@91
+        S_hostname = 481,                        // hostname
+        S_482_92 = 482,                          // $@92
+        S_flex_id_value = 483,                   // flex_id_value
+        S_484_93 = 484,                          // $@93
+        S_reservation_client_classes = 485,      // reservation_client_classes
+        S_486_94 = 486,                          // $@94
+        S_relay = 487,                           // relay
+        S_488_95 = 488,                          // $@95
+        S_relay_map = 489,                       // relay_map
+        S_ip_address = 490,                      // ip_address
+        S_491_96 = 491,                          // $@96
+        S_client_classes = 492,                  // client_classes
+        S_493_97 = 493,                          // $@97
+        S_client_classes_list = 494,             // client_classes_list
+        S_client_class_entry = 495,              // client_class_entry
+        S_496_98 = 496,                          // $@98
+        S_client_class_params = 497,             // client_class_params
+        S_not_empty_client_class_params = 498,   // not_empty_client_class_params
+        S_client_class_param = 499,              // client_class_param
+        S_client_class_name = 500,               // client_class_name
+        S_client_class_test = 501,               // client_class_test
+        S_502_99 = 502,                          // $@99
+        S_only_if_required = 503,                // only_if_required
+        S_server_id = 504,                       // server_id
+        S_505_100 = 505,                         // $@100
+        S_server_id_params = 506,                // server_id_params
+        S_server_id_param = 507,                 // server_id_param
+        S_server_id_type = 508,                  // server_id_type
+        S_509_101 = 509,                         // $@101
+        S_duid_type = 510,                       // duid_type
+        S_htype = 511,                           // htype
+        S_identifier = 512,                      // identifier
+        S_513_102 = 513,                         // $@102
+        S_time = 514,                            // time
+        S_enterprise_id = 515,                   // enterprise_id
+        S_dhcp4o6_port = 516,                    // dhcp4o6_port
+        S_control_socket = 517,                  // control_socket
+        S_518_103 = 518,                         // $@103
+        S_control_socket_params = 519,           // control_socket_params
+        S_control_socket_param = 520,            // control_socket_param
+        S_socket_type = 521,                     // socket_type
+        S_522_104 = 522,                         // $@104
+        S_socket_name = 523,                     // socket_name
+        S_524_105 = 524,                         // $@105
+        S_dhcp_queue_control = 525,              // dhcp_queue_control
+        S_526_106 = 526,                         // $@106
+        S_dhcp_ddns = 527,                       // dhcp_ddns
+        S_528_107 = 528,                         // $@107
+        S_sub_dhcp_ddns = 529,                   // sub_dhcp_ddns
+        S_530_108 = 530,                         // $@108
+        S_dhcp_ddns_params = 531,                // dhcp_ddns_params
+        S_dhcp_ddns_param = 532,                 // dhcp_ddns_param
+        S_enable_updates = 533,                  // enable_updates
+        S_qualifying_suffix = 534,               // qualifying_suffix
+        S_535_109 = 535,                         // $@109
+        S_server_ip = 536,                       // server_ip
+        S_537_110 = 537,                         // $@110
+        S_server_port = 538,                     // server_port
+        S_sender_ip = 539,                       // sender_ip
+        S_540_111 = 540,                         // $@111
+        S_sender_port = 541,                     // sender_port
+        S_max_queue_size = 542,                  // max_queue_size
+        S_ncr_protocol = 543,                    // ncr_protocol
+        S_544_112 = 544,                         // $@112
+        S_ncr_protocol_value = 545,              // ncr_protocol_value
+        S_ncr_format = 546,                      // ncr_format
+        S_547_113 = 547,                         // $@113
+        S_ncr_format_value = 548,                // ncr_format_value
+        S_override_no_update = 549,              // override_no_update
+        S_override_client_update = 550,          // override_client_update
+        S_replace_client_name = 551,             // replace_client_name
+        S_552_114 = 552,                         // $@114
+        S_replace_client_name_value = 553,       // replace_client_name_value
+        S_generated_prefix = 554,                // generated_prefix
+        S_555_115 = 555,                         // $@115
+        S_hostname_char_set = 556,               // hostname_char_set
+        S_557_116 = 557,                         // $@116
+        S_hostname_char_replacement = 558,       // hostname_char_replacement
+        S_559_117 = 559,                         // $@117
+        S_dhcp4_json_object = 560,               // dhcp4_json_object
+        S_561_118 = 561,                         // $@118
+        S_dhcpddns_json_object = 562,            // dhcpddns_json_object
+        S_563_119 = 563,                         // $@119
+        S_control_agent_json_object = 564,       // control_agent_json_object
+        S_565_120 = 565,                         // $@120
+        S_config_control = 566,                  // config_control
+        S_567_121 = 567,                         // $@121
+        S_sub_config_control = 568,              // sub_config_control
+        S_569_122 = 569,                         // $@122
+        S_config_control_params = 570,           // config_control_params
+        S_config_control_param = 571,            // config_control_param
+        S_config_databases = 572,                // config_databases
+        S_573_123 = 573,                         // $@123
+        S_config_fetch_wait_time = 574,          // config_fetch_wait_time
+        S_notify_fifo = 575,                     // notify_fifo
+        S_576_124 = 576,                         // $@124
+        S_logging_object = 577,                  // logging_object
+        S_578_125 = 578,                         // $@125
+        S_sub_logging = 579,                     // sub_logging
+        S_580_126 = 580,                         // $@126
+        S_logging_params = 581,                  // logging_params
+        S_logging_param = 582,                   // logging_param
+        S_loggers = 583,                         // loggers
+        S_584_127 = 584,                         // $@127
+        S_loggers_entries = 585,                 // loggers_entries
+        S_logger_entry = 586,                    // logger_entry
+        S_587_128 = 587,                         // $@128
+        S_logger_params = 588,                   // logger_params
+        S_logger_param = 589,                    // logger_param
+        S_debuglevel = 590,                      // debuglevel
+        S_severity = 591,                        // severity
+        S_592_129 = 592,                         // $@129
+        S_output_options_list = 593,             // output_options_list
+        S_594_130 = 594,                         // $@130
+        S_output_options_list_content = 595,     // output_options_list_content
+        S_output_entry = 596,                    // output_entry
+        S_597_131 = 597,                         // $@131
+        S_output_params_list = 598,              // output_params_list
+        S_output_params = 599,                   // output_params
+        S_output = 600,                          // output
+        S_601_132 = 601,                         // $@132
+        S_flush = 602,                           // flush
+        S_maxsize = 603,                         // maxsize
+        S_maxver = 604,                          // maxver
+        S_async = 605,                           // async
+        S_606_133 = 606,                         // $@133
+        S_async_queue_size = 607                 // async_queue_size
+      };
+    };
 
-    /// The symbol type number to denote an empty symbol.
-    enum { empty_symbol = -2 };
+    /// (Internal) symbol kind.
+    typedef symbol_kind::symbol_kind_type symbol_kind_type;
 
-    /// Internal symbol number for tokens (subsumed by symbol_number_type).
-    typedef unsigned char token_number_type;
+    /// The number of tokens.
+    static const symbol_kind_type YYNTOKENS = symbol_kind::YYNTOKENS;
 
     /// A complete symbol.
     ///
-    /// Expects its Base type to provide access to the symbol type
-    /// via type_get ().
+    /// Expects its Base type to provide access to the symbol kind
+    /// via kind ().
     ///
     /// Provide access to semantic value and location.
     template <typename Base>
@@ -662,20 +1337,58 @@ namespace isc { namespace dhcp {
       typedef Base super_type;
 
       /// Default constructor.
-      basic_symbol ()
+      basic_symbol () YY_NOEXCEPT
         : value ()
         , location ()
       {}
 
 #if 201103L <= YY_CPLUSPLUS
       /// Move constructor.
-      basic_symbol (basic_symbol&& that);
+      basic_symbol (basic_symbol&& that)
+        : Base (std::move (that))
+        , value ()
+        , location (std::move (that.location))
+      {
+        switch (this->kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.move< ElementPtr > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (std::move (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+      }
 #endif
 
       /// Copy constructor.
       basic_symbol (const basic_symbol& that);
 
-      /// Constructor for valueless symbols, and symbols from each type.
+      /// Constructors for typed symbols.
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, location_type&& l)
         : Base (t)
@@ -687,6 +1400,7 @@ namespace isc { namespace dhcp {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, ElementPtr&& v, location_type&& l)
         : Base (t)
@@ -700,6 +1414,7 @@ namespace isc { namespace dhcp {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, bool&& v, location_type&& l)
         : Base (t)
@@ -713,6 +1428,7 @@ namespace isc { namespace dhcp {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, double&& v, location_type&& l)
         : Base (t)
@@ -726,6 +1442,7 @@ namespace isc { namespace dhcp {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, int64_t&& v, location_type&& l)
         : Base (t)
@@ -739,6 +1456,7 @@ namespace isc { namespace dhcp {
         , location (l)
       {}
 #endif
+
 #if 201103L <= YY_CPLUSPLUS
       basic_symbol (typename Base::kind_type t, std::string&& v, location_type&& l)
         : Base (t)
@@ -759,45 +1477,48 @@ namespace isc { namespace dhcp {
         clear ();
       }
 
+
+
       /// Destroy contents, and record that is empty.
-      void clear ()
+      void clear () YY_NOEXCEPT
       {
         // User destructor.
-        symbol_number_type yytype = this->type_get ();
+        symbol_kind_type yykind = this->kind ();
         basic_symbol<Base>& yysym = *this;
         (void) yysym;
-        switch (yytype)
+        switch (yykind)
         {
        default:
           break;
         }
 
-        // Type destructor.
-switch (yytype)
+        // Value type destructor.
+switch (yykind)
     {
-      case 202: // value
-      case 206: // map_value
-      case 267: // db_type
-      case 360: // hr_mode
-      case 496: // duid_type
-      case 531: // ncr_protocol_value
-      case 538: // replace_client_name_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.template destroy< ElementPtr > ();
         break;
 
-      case 184: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.template destroy< bool > ();
         break;
 
-      case 183: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.template destroy< double > ();
         break;
 
-      case 182: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.template destroy< int64_t > ();
         break;
 
-      case 181: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.template destroy< std::string > ();
         break;
 
@@ -808,6 +1529,15 @@ switch (yytype)
         Base::clear ();
       }
 
+      /// The user-facing name of this symbol.
+      std::string name () const YY_NOEXCEPT
+      {
+        return Dhcp6Parser::symbol_name (this->kind ());
+      }
+
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
+
       /// Whether empty.
       bool empty () const YY_NOEXCEPT;
 
@@ -815,7 +1545,7 @@ switch (yytype)
       void move (basic_symbol& s);
 
       /// The semantic value.
-      semantic_type value;
+      value_type value;
 
       /// The location.
       location_type location;
@@ -828,125 +1558,132 @@ switch (yytype)
     };
 
     /// Type access provider for token (enum) based symbols.
-    struct by_type
+    struct by_kind
     {
+      /// The symbol kind as needed by the constructor.
+      typedef token_kind_type kind_type;
+
       /// Default constructor.
-      by_type ();
+      by_kind () YY_NOEXCEPT;
 
 #if 201103L <= YY_CPLUSPLUS
       /// Move constructor.
-      by_type (by_type&& that);
+      by_kind (by_kind&& that) YY_NOEXCEPT;
 #endif
 
       /// Copy constructor.
-      by_type (const by_type& that);
-
-      /// The symbol type as needed by the constructor.
-      typedef token_type kind_type;
+      by_kind (const by_kind& that) YY_NOEXCEPT;
 
       /// Constructor from (external) token numbers.
-      by_type (kind_type t);
+      by_kind (kind_type t) YY_NOEXCEPT;
+
+
 
       /// Record that this symbol is empty.
-      void clear ();
+      void clear () YY_NOEXCEPT;
 
-      /// Steal the symbol type from \a that.
-      void move (by_type& that);
+      /// Steal the symbol kind from \a that.
+      void move (by_kind& that);
 
       /// The (internal) type number (corresponding to \a type).
       /// \a empty when empty.
-      symbol_number_type type_get () const YY_NOEXCEPT;
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
-      /// The token.
-      token_type token () const YY_NOEXCEPT;
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
 
-      /// The symbol type.
-      /// \a empty_symbol when empty.
-      /// An int, not token_number_type, to be able to store empty_symbol.
-      int type;
+      /// The symbol kind.
+      /// \a S_YYEMPTY when empty.
+      symbol_kind_type kind_;
     };
 
+    /// Backward compatibility for a private implementation detail (Bison 3.6).
+    typedef by_kind by_type;
+
     /// "External" symbols: returned by the scanner.
-    struct symbol_type : basic_symbol<by_type>
+    struct symbol_type : basic_symbol<by_kind>
     {
       /// Superclass.
-      typedef basic_symbol<by_type> super_type;
+      typedef basic_symbol<by_kind> super_type;
 
       /// Empty symbol.
-      symbol_type () {}
+      symbol_type () YY_NOEXCEPT {}
 
       /// Constructor for valueless symbols, and symbols from each type.
 #if 201103L <= YY_CPLUSPLUS
       symbol_type (int tok, location_type l)
-        : super_type(token_type (tok), std::move (l))
-      {
-        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_DHCP6 || tok == token::TOKEN_DATA_DIRECTORY || tok == token::TOKEN_CONFIG_CONTROL || tok == token::TOKEN_CONFIG_DATABASES || tok == token::TOKEN_CONFIG_FETCH_WAIT_TIME || tok == token::TOKEN_INTERFACES_CONFIG || tok == token::TOKEN_INTERFACES || tok == token::TOKEN_RE_DETECT || tok == token::TOKEN_LEASE_DATABASE || tok == token::TOKEN_HOSTS_DATABASE || tok == token::TOKEN_HOSTS_DATABASES || tok == token::TOKEN_TYPE || tok == token::TOKEN_MEMFILE || tok == token::TOKEN_MYSQL || tok == token::TOKEN_POSTGRESQL || tok == token::TOKEN_CQL || tok == token::TOKEN_USER || tok == token::TOKEN_PASSWORD || tok == token::TOKEN_HOST || tok == token::TOKEN_PORT || tok == token::TOKEN_PERSIST || tok == token::TOKEN_LFC_INTERVAL || tok == token::TOKEN_READONLY || tok == token::TOKEN_CONNECT_TIMEOUT || tok == token::TOKEN_CONTACT_POINTS || tok == token::TOKEN_MAX_RECONNECT_TRIES || tok == token::TOKEN_RECONNECT_WAIT_TIME || tok == token::TOKEN_KEYSPACE || tok == token::TOKEN_CONSISTENCY || tok == token::TOKEN_SERIAL_CONSISTENCY || tok == token::TOKEN_REQUEST_TIMEOUT || tok == token::TOKEN_TCP_KEEPALIVE || tok == token::TOKEN_TCP_NODELAY || tok == token::TOKEN_PREFERRED_LIFETIME || tok == token::TOKEN_MIN_PREFERRED_LIFETIME || tok == token::TOKEN_MAX_PREFERRED_LIFETIME || tok == token::TOKEN_VALID_LIFETIME || tok == token::TOKEN_MIN_VALID_LIFETIME || tok == token::TOKEN_MAX_VALID_LIFETIME || tok == token::TOKEN_RENEW_TIMER || tok == token::TOKEN_REBIND_TIMER || tok == token::TOKEN_CALCULATE_TEE_TIMES || tok == token::TOKEN_T1_PERCENT || tok == token::TOKEN_T2_PERCENT || tok == token::TOKEN_DECLINE_PROBATION_PERIOD || tok == token::TOKEN_SERVER_TAG || tok == token::TOKEN_SUBNET6 || tok == token::TOKEN_OPTION_DEF || tok == token::TOKEN_OPTION_DATA || tok == token::TOKEN_NAME || tok == token::TOKEN_DATA || tok == token::TOKEN_CODE || tok == token::TOKEN_SPACE || tok == token::TOKEN_CSV_FORMAT || tok == token::TOKEN_ALWAYS_SEND || tok == token::TOKEN_RECORD_TYPES || tok == token::TOKEN_ENCAPSULATE || tok == token::TOKEN_ARRAY || tok == token::TOKEN_POOLS || tok == token::TOKEN_POOL || tok == token::TOKEN_PD_POOLS || tok == token::TOKEN_PREFIX || tok == token::TOKEN_PREFIX_LEN || tok == token::TOKEN_EXCLUDED_PREFIX || tok == token::TOKEN_EXCLUDED_PREFIX_LEN || tok == token::TOKEN_DELEGATED_LEN || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_SUBNET || tok == token::TOKEN_INTERFACE || tok == token::TOKEN_INTERFACE_ID || tok == token::TOKEN_ID || tok == token::TOKEN_RAPID_COMMIT || tok == token::TOKEN_RESERVATION_MODE || tok == token::TOKEN_DISABLED || tok == token::TOKEN_OUT_OF_POOL || tok == token::TOKEN_GLOBAL || tok == token::TOKEN_ALL || tok == token::TOKEN_SHARED_NETWORKS || tok == token::TOKEN_MAC_SOURCES || tok == token::TOKEN_RELAY_SUPPLIED_OPTIONS || tok == token::TOKEN_HOST_RESERVATION_IDENTIFIERS || tok == token::TOKEN_SANITY_CHECKS || tok == token::TOKEN_LEASE_CHECKS || tok == token::TOKEN_CLIENT_CLASSES || tok == token::TOKEN_REQUIRE_CLIENT_CLASSES || tok == token::TOKEN_TEST || tok == token::TOKEN_ONLY_IF_REQUIRED || tok == token::TOKEN_CLIENT_CLASS || tok == token::TOKEN_RESERVATIONS || tok == token::TOKEN_IP_ADDRESSES || tok == token::TOKEN_PREFIXES || tok == token::TOKEN_DUID || tok == token::TOKEN_HW_ADDRESS || tok == token::TOKEN_HOSTNAME || tok == token::TOKEN_FLEX_ID || tok == token::TOKEN_RELAY || tok == token::TOKEN_IP_ADDRESS || tok == token::TOKEN_HOOKS_LIBRARIES || tok == token::TOKEN_LIBRARY || tok == token::TOKEN_PARAMETERS || tok == token::TOKEN_EXPIRED_LEASES_PROCESSING || tok == token::TOKEN_RECLAIM_TIMER_WAIT_TIME || tok == token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME || tok == token::TOKEN_HOLD_RECLAIMED_TIME || tok == token::TOKEN_MAX_RECLAIM_LEASES || tok == token::TOKEN_MAX_RECLAIM_TIME || tok == token::TOKEN_UNWARNED_RECLAIM_CYCLES || tok == token::TOKEN_SERVER_ID || tok == token::TOKEN_LLT || tok == token::TOKEN_EN || tok == token::TOKEN_LL || tok == token::TOKEN_IDENTIFIER || tok == token::TOKEN_HTYPE || tok == token::TOKEN_TIME || tok == token::TOKEN_ENTERPRISE_ID || tok == token::TOKEN_DHCP4O6_PORT || tok == token::TOKEN_CONTROL_SOCKET || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_DHCP_QUEUE_CONTROL || tok == token::TOKEN_DHCP_DDNS || tok == token::TOKEN_ENABLE_UPDATES || tok == token::TOKEN_QUALIFYING_SUFFIX || tok == token::TOKEN_SERVER_IP || tok == token::TOKEN_SERVER_PORT || tok == token::TOKEN_SENDER_IP || tok == token::TOKEN_SENDER_PORT || tok == token::TOKEN_MAX_QUEUE_SIZE || tok == token::TOKEN_NCR_PROTOCOL || tok == token::TOKEN_NCR_FORMAT || tok == token::TOKEN_OVERRIDE_NO_UPDATE || tok == token::TOKEN_OVERRIDE_CLIENT_UPDATE || tok == token::TOKEN_REPLACE_CLIENT_NAME || tok == token::TOKEN_GENERATED_PREFIX || tok == token::TOKEN_UDP || tok == token::TOKEN_TCP || tok == token::TOKEN_JSON || tok == token::TOKEN_WHEN_PRESENT || tok == token::TOKEN_NEVER || tok == token::TOKEN_ALWAYS || tok == token::TOKEN_WHEN_NOT_PRESENT || tok == token::TOKEN_HOSTNAME_CHAR_SET || tok == token::TOKEN_HOSTNAME_CHAR_REPLACEMENT || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_DHCP4 || tok == token::TOKEN_DHCPDDNS || tok == token::TOKEN_CONTROL_AGENT || tok == token::TOKEN_TOPLEVEL_JSON || tok == token::TOKEN_TOPLEVEL_DHCP6 || tok == token::TOKEN_SUB_DHCP6 || tok == token::TOKEN_SUB_INTERFACES6 || tok == token::TOKEN_SUB_SUBNET6 || tok == token::TOKEN_SUB_POOL6 || tok == token::TOKEN_SUB_PD_POOL || tok == token::TOKEN_SUB_RESERVATION || tok == token::TOKEN_SUB_OPTION_DEFS || tok == token::TOKEN_SUB_OPTION_DEF || tok == token::TOKEN_SUB_OPTION_DATA || tok == token::TOKEN_SUB_HOOKS_LIBRARY || tok == token::TOKEN_SUB_DHCP_DDNS || tok == token::TOKEN_SUB_LOGGING || tok == token::TOKEN_SUB_CONFIG_CONTROL);
-      }
+        : super_type (token_kind_type (tok), std::move (l))
 #else
       symbol_type (int tok, const location_type& l)
-        : super_type(token_type (tok), l)
+        : super_type (token_kind_type (tok), l)
+#endif
       {
-        YYASSERT (tok == token::TOKEN_END || tok == token::TOKEN_COMMA || tok == token::TOKEN_COLON || tok == token::TOKEN_LSQUARE_BRACKET || tok == token::TOKEN_RSQUARE_BRACKET || tok == token::TOKEN_LCURLY_BRACKET || tok == token::TOKEN_RCURLY_BRACKET || tok == token::TOKEN_NULL_TYPE || tok == token::TOKEN_DHCP6 || tok == token::TOKEN_DATA_DIRECTORY || tok == token::TOKEN_CONFIG_CONTROL || tok == token::TOKEN_CONFIG_DATABASES || tok == token::TOKEN_CONFIG_FETCH_WAIT_TIME || tok == token::TOKEN_INTERFACES_CONFIG || tok == token::TOKEN_INTERFACES || tok == token::TOKEN_RE_DETECT || tok == token::TOKEN_LEASE_DATABASE || tok == token::TOKEN_HOSTS_DATABASE || tok == token::TOKEN_HOSTS_DATABASES || tok == token::TOKEN_TYPE || tok == token::TOKEN_MEMFILE || tok == token::TOKEN_MYSQL || tok == token::TOKEN_POSTGRESQL || tok == token::TOKEN_CQL || tok == token::TOKEN_USER || tok == token::TOKEN_PASSWORD || tok == token::TOKEN_HOST || tok == token::TOKEN_PORT || tok == token::TOKEN_PERSIST || tok == token::TOKEN_LFC_INTERVAL || tok == token::TOKEN_READONLY || tok == token::TOKEN_CONNECT_TIMEOUT || tok == token::TOKEN_CONTACT_POINTS || tok == token::TOKEN_MAX_RECONNECT_TRIES || tok == token::TOKEN_RECONNECT_WAIT_TIME || tok == token::TOKEN_KEYSPACE || tok == token::TOKEN_CONSISTENCY || tok == token::TOKEN_SERIAL_CONSISTENCY || tok == token::TOKEN_REQUEST_TIMEOUT || tok == token::TOKEN_TCP_KEEPALIVE || tok == token::TOKEN_TCP_NODELAY || tok == token::TOKEN_PREFERRED_LIFETIME || tok == token::TOKEN_MIN_PREFERRED_LIFETIME || tok == token::TOKEN_MAX_PREFERRED_LIFETIME || tok == token::TOKEN_VALID_LIFETIME || tok == token::TOKEN_MIN_VALID_LIFETIME || tok == token::TOKEN_MAX_VALID_LIFETIME || tok == token::TOKEN_RENEW_TIMER || tok == token::TOKEN_REBIND_TIMER || tok == token::TOKEN_CALCULATE_TEE_TIMES || tok == token::TOKEN_T1_PERCENT || tok == token::TOKEN_T2_PERCENT || tok == token::TOKEN_DECLINE_PROBATION_PERIOD || tok == token::TOKEN_SERVER_TAG || tok == token::TOKEN_SUBNET6 || tok == token::TOKEN_OPTION_DEF || tok == token::TOKEN_OPTION_DATA || tok == token::TOKEN_NAME || tok == token::TOKEN_DATA || tok == token::TOKEN_CODE || tok == token::TOKEN_SPACE || tok == token::TOKEN_CSV_FORMAT || tok == token::TOKEN_ALWAYS_SEND || tok == token::TOKEN_RECORD_TYPES || tok == token::TOKEN_ENCAPSULATE || tok == token::TOKEN_ARRAY || tok == token::TOKEN_POOLS || tok == token::TOKEN_POOL || tok == token::TOKEN_PD_POOLS || tok == token::TOKEN_PREFIX || tok == token::TOKEN_PREFIX_LEN || tok == token::TOKEN_EXCLUDED_PREFIX || tok == token::TOKEN_EXCLUDED_PREFIX_LEN || tok == token::TOKEN_DELEGATED_LEN || tok == token::TOKEN_USER_CONTEXT || tok == token::TOKEN_COMMENT || tok == token::TOKEN_SUBNET || tok == token::TOKEN_INTERFACE || tok == token::TOKEN_INTERFACE_ID || tok == token::TOKEN_ID || tok == token::TOKEN_RAPID_COMMIT || tok == token::TOKEN_RESERVATION_MODE || tok == token::TOKEN_DISABLED || tok == token::TOKEN_OUT_OF_POOL || tok == token::TOKEN_GLOBAL || tok == token::TOKEN_ALL || tok == token::TOKEN_SHARED_NETWORKS || tok == token::TOKEN_MAC_SOURCES || tok == token::TOKEN_RELAY_SUPPLIED_OPTIONS || tok == token::TOKEN_HOST_RESERVATION_IDENTIFIERS || tok == token::TOKEN_SANITY_CHECKS || tok == token::TOKEN_LEASE_CHECKS || tok == token::TOKEN_CLIENT_CLASSES || tok == token::TOKEN_REQUIRE_CLIENT_CLASSES || tok == token::TOKEN_TEST || tok == token::TOKEN_ONLY_IF_REQUIRED || tok == token::TOKEN_CLIENT_CLASS || tok == token::TOKEN_RESERVATIONS || tok == token::TOKEN_IP_ADDRESSES || tok == token::TOKEN_PREFIXES || tok == token::TOKEN_DUID || tok == token::TOKEN_HW_ADDRESS || tok == token::TOKEN_HOSTNAME || tok == token::TOKEN_FLEX_ID || tok == token::TOKEN_RELAY || tok == token::TOKEN_IP_ADDRESS || tok == token::TOKEN_HOOKS_LIBRARIES || tok == token::TOKEN_LIBRARY || tok == token::TOKEN_PARAMETERS || tok == token::TOKEN_EXPIRED_LEASES_PROCESSING || tok == token::TOKEN_RECLAIM_TIMER_WAIT_TIME || tok == token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME || tok == token::TOKEN_HOLD_RECLAIMED_TIME || tok == token::TOKEN_MAX_RECLAIM_LEASES || tok == token::TOKEN_MAX_RECLAIM_TIME || tok == token::TOKEN_UNWARNED_RECLAIM_CYCLES || tok == token::TOKEN_SERVER_ID || tok == token::TOKEN_LLT || tok == token::TOKEN_EN || tok == token::TOKEN_LL || tok == token::TOKEN_IDENTIFIER || tok == token::TOKEN_HTYPE || tok == token::TOKEN_TIME || tok == token::TOKEN_ENTERPRISE_ID || tok == token::TOKEN_DHCP4O6_PORT || tok == token::TOKEN_CONTROL_SOCKET || tok == token::TOKEN_SOCKET_TYPE || tok == token::TOKEN_SOCKET_NAME || tok == token::TOKEN_DHCP_QUEUE_CONTROL || tok == token::TOKEN_DHCP_DDNS || tok == token::TOKEN_ENABLE_UPDATES || tok == token::TOKEN_QUALIFYING_SUFFIX || tok == token::TOKEN_SERVER_IP || tok == token::TOKEN_SERVER_PORT || tok == token::TOKEN_SENDER_IP || tok == token::TOKEN_SENDER_PORT || tok == token::TOKEN_MAX_QUEUE_SIZE || tok == token::TOKEN_NCR_PROTOCOL || tok == token::TOKEN_NCR_FORMAT || tok == token::TOKEN_OVERRIDE_NO_UPDATE || tok == token::TOKEN_OVERRIDE_CLIENT_UPDATE || tok == token::TOKEN_REPLACE_CLIENT_NAME || tok == token::TOKEN_GENERATED_PREFIX || tok == token::TOKEN_UDP || tok == token::TOKEN_TCP || tok == token::TOKEN_JSON || tok == token::TOKEN_WHEN_PRESENT || tok == token::TOKEN_NEVER || tok == token::TOKEN_ALWAYS || tok == token::TOKEN_WHEN_NOT_PRESENT || tok == token::TOKEN_HOSTNAME_CHAR_SET || tok == token::TOKEN_HOSTNAME_CHAR_REPLACEMENT || tok == token::TOKEN_LOGGING || tok == token::TOKEN_LOGGERS || tok == token::TOKEN_OUTPUT_OPTIONS || tok == token::TOKEN_OUTPUT || tok == token::TOKEN_DEBUGLEVEL || tok == token::TOKEN_SEVERITY || tok == token::TOKEN_FLUSH || tok == token::TOKEN_MAXSIZE || tok == token::TOKEN_MAXVER || tok == token::TOKEN_DHCP4 || tok == token::TOKEN_DHCPDDNS || tok == token::TOKEN_CONTROL_AGENT || tok == token::TOKEN_TOPLEVEL_JSON || tok == token::TOKEN_TOPLEVEL_DHCP6 || tok == token::TOKEN_SUB_DHCP6 || tok == token::TOKEN_SUB_INTERFACES6 || tok == token::TOKEN_SUB_SUBNET6 || tok == token::TOKEN_SUB_POOL6 || tok == token::TOKEN_SUB_PD_POOL || tok == token::TOKEN_SUB_RESERVATION || tok == token::TOKEN_SUB_OPTION_DEFS || tok == token::TOKEN_SUB_OPTION_DEF || tok == token::TOKEN_SUB_OPTION_DATA || tok == token::TOKEN_SUB_HOOKS_LIBRARY || tok == token::TOKEN_SUB_DHCP_DDNS || tok == token::TOKEN_SUB_LOGGING || tok == token::TOKEN_SUB_CONFIG_CONTROL);
-      }
+#if !defined _MSC_VER || defined __clang__
+        PARSER6__ASSERT (tok == token::TOKEN_END
+                   || (token::TOKEN_PARSER6_error <= tok && tok <= token::TOKEN_SUB_CONFIG_CONTROL));
 #endif
+      }
 #if 201103L <= YY_CPLUSPLUS
       symbol_type (int tok, bool v, location_type l)
-        : super_type(token_type (tok), std::move (v), std::move (l))
-      {
-        YYASSERT (tok == token::TOKEN_BOOLEAN);
-      }
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
 #else
       symbol_type (int tok, const bool& v, const location_type& l)
-        : super_type(token_type (tok), v, l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
       {
-        YYASSERT (tok == token::TOKEN_BOOLEAN);
-      }
+#if !defined _MSC_VER || defined __clang__
+        PARSER6__ASSERT (tok == token::TOKEN_BOOLEAN);
 #endif
+      }
 #if 201103L <= YY_CPLUSPLUS
       symbol_type (int tok, double v, location_type l)
-        : super_type(token_type (tok), std::move (v), std::move (l))
-      {
-        YYASSERT (tok == token::TOKEN_FLOAT);
-      }
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
 #else
       symbol_type (int tok, const double& v, const location_type& l)
-        : super_type(token_type (tok), v, l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
       {
-        YYASSERT (tok == token::TOKEN_FLOAT);
-      }
+#if !defined _MSC_VER || defined __clang__
+        PARSER6__ASSERT (tok == token::TOKEN_FLOAT);
 #endif
+      }
 #if 201103L <= YY_CPLUSPLUS
       symbol_type (int tok, int64_t v, location_type l)
-        : super_type(token_type (tok), std::move (v), std::move (l))
-      {
-        YYASSERT (tok == token::TOKEN_INTEGER);
-      }
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
 #else
       symbol_type (int tok, const int64_t& v, const location_type& l)
-        : super_type(token_type (tok), v, l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
       {
-        YYASSERT (tok == token::TOKEN_INTEGER);
-      }
+#if !defined _MSC_VER || defined __clang__
+        PARSER6__ASSERT (tok == token::TOKEN_INTEGER);
 #endif
+      }
 #if 201103L <= YY_CPLUSPLUS
       symbol_type (int tok, std::string v, location_type l)
-        : super_type(token_type (tok), std::move (v), std::move (l))
-      {
-        YYASSERT (tok == token::TOKEN_STRING);
-      }
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
 #else
       symbol_type (int tok, const std::string& v, const location_type& l)
-        : super_type(token_type (tok), v, l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
       {
-        YYASSERT (tok == token::TOKEN_STRING);
-      }
+#if !defined _MSC_VER || defined __clang__
+        PARSER6__ASSERT (tok == token::TOKEN_STRING);
 #endif
+      }
     };
 
     /// Build a parser object.
     Dhcp6Parser (isc::dhcp::Parser6Context& ctx_yyarg);
     virtual ~Dhcp6Parser ();
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    Dhcp6Parser (const Dhcp6Parser&) = delete;
+    /// Non copyable.
+    Dhcp6Parser& operator= (const Dhcp6Parser&) = delete;
+#endif
+
     /// Parse.  An alias for parse ().
     /// \returns  0 iff parsing succeeded.
     int operator() ();
@@ -977,7 +1714,11 @@ switch (yytype)
     /// Report a syntax error.
     void error (const syntax_error& err);
 
-    // Implementation of make_symbol for each symbol type.
+    /// The user-facing name of the symbol whose (internal) number is
+    /// YYSYMBOL.  No bounds checking.
+    static std::string symbol_name (symbol_kind_type yysymbol);
+
+    // Implementation of make_symbol for each token kind.
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -993,6 +1734,36 @@ switch (yytype)
         return symbol_type (token::TOKEN_END, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PARSER6_error (location_type l)
+      {
+        return symbol_type (token::TOKEN_PARSER6_error, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PARSER6_error (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PARSER6_error, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PARSER6_UNDEF (location_type l)
+      {
+        return symbol_type (token::TOKEN_PARSER6_UNDEF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PARSER6_UNDEF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PARSER6_UNDEF, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -1173,6 +1944,21 @@ switch (yytype)
         return symbol_type (token::TOKEN_CONFIG_FETCH_WAIT_TIME, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NOTIFY_FIFO (location_type l)
+      {
+        return symbol_type (token::TOKEN_NOTIFY_FIFO, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NOTIFY_FIFO (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NOTIFY_FIFO, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -1593,6 +2379,21 @@ switch (yytype)
         return symbol_type (token::TOKEN_TCP_NODELAY, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_POOL_SIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_POOL_SIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_POOL_SIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_POOL_SIZE, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -1758,6 +2559,66 @@ switch (yytype)
         return symbol_type (token::TOKEN_T2_PERCENT, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CACHE_THRESHOLD (location_type l)
+      {
+        return symbol_type (token::TOKEN_CACHE_THRESHOLD, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CACHE_THRESHOLD (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CACHE_THRESHOLD, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PACKET_ARENA_CHUNK_SIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_PACKET_ARENA_CHUNK_SIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PACKET_ARENA_CHUNK_SIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PACKET_ARENA_CHUNK_SIZE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PACKET_SLOW_THRESHOLD (location_type l)
+      {
+        return symbol_type (token::TOKEN_PACKET_SLOW_THRESHOLD, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PACKET_SLOW_THRESHOLD (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PACKET_SLOW_THRESHOLD, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOST_FILTER_REBUILD_INTERVAL (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOST_FILTER_REBUILD_INTERVAL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOST_FILTER_REBUILD_INTERVAL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOST_FILTER_REBUILD_INTERVAL, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -3168,6 +4029,21 @@ switch (yytype)
         return symbol_type (token::TOKEN_JSON, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BINARY (location_type l)
+      {
+        return symbol_type (token::TOKEN_BINARY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BINARY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_BINARY, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -3393,6 +4269,36 @@ switch (yytype)
         return symbol_type (token::TOKEN_MAXVER, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC_QUEUE_SIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_QUEUE_SIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC_QUEUE_SIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC_QUEUE_SIZE, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -3725,93 +4631,119 @@ switch (yytype)
 #endif
 
 
+    class context
+    {
+    public:
+      context (const Dhcp6Parser& yyparser, const symbol_type& yyla);
+      const symbol_type& lookahead () const YY_NOEXCEPT { return yyla_; }
+      symbol_kind_type token () const YY_NOEXCEPT { return yyla_.kind (); }
+      const location_type& location () const YY_NOEXCEPT { return yyla_.location; }
+
+      /// Put in YYARG at most YYARGN of the expected tokens, and return the
+      /// number of tokens stored in YYARG.  If YYARG is null, return the
+      /// number of expected tokens (guaranteed to be less than YYNTOKENS).
+      int expected_tokens (symbol_kind_type yyarg[], int yyargn) const;
+
+    private:
+      const Dhcp6Parser& yyparser_;
+      const symbol_type& yyla_;
+    };
+
   private:
-    /// This class is not copyable.
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
     Dhcp6Parser (const Dhcp6Parser&);
+    /// Non copyable.
     Dhcp6Parser& operator= (const Dhcp6Parser&);
+#endif
 
-    /// State numbers.
-    typedef int state_type;
 
-    /// Generate an error message.
-    /// \param yystate   the state where the error occurred.
-    /// \param yyla      the lookahead token.
-    virtual std::string yysyntax_error_ (state_type yystate,
-                                         const symbol_type& yyla) const;
+    /// Stored state numbers (used for stacks).
+    typedef short state_type;
+
+    /// The arguments of the error message.
+    int yy_syntax_error_arguments_ (const context& yyctx,
+                                    symbol_kind_type yyarg[], int yyargn) const;
 
+    /// Generate an error message.
+    /// \param yyctx     the context in which the error occurred.
+    virtual std::string yysyntax_error_ (const context& yyctx) const;
     /// Compute post-reduction state.
     /// \param yystate   the current state
     /// \param yysym     the nonterminal to push on the stack
-    state_type yy_lr_goto_state_ (state_type yystate, int yysym);
+    static state_type yy_lr_goto_state_ (state_type yystate, int yysym);
 
     /// Whether the given \c yypact_ value indicates a defaulted state.
     /// \param yyvalue   the value to check
-    static bool yy_pact_value_is_default_ (int yyvalue);
+    static bool yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT;
 
     /// Whether the given \c yytable_ value indicates a syntax error.
     /// \param yyvalue   the value to check
-    static bool yy_table_value_is_error_ (int yyvalue);
+    static bool yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT;
 
     static const short yypact_ninf_;
     static const signed char yytable_ninf_;
 
-    /// Convert a scanner token number \a t to a symbol number.
-    static token_number_type yytranslate_ (token_type t);
+    /// Convert a scanner token kind \a t to a symbol kind.
+    /// In theory \a t should be a token_kind_type, but character literals
+    /// are valid, yet not members of the token_kind_type enum.
+    static symbol_kind_type yytranslate_ (int t) YY_NOEXCEPT;
 
-    // Tables.
-  // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-  // STATE-NUM.
-  static const short yypact_[];
+    /// Convert the symbol name \a n to a form suitable for a diagnostic.
+    static std::string yytnamerr_ (const char *yystr);
 
-  // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-  // Performed when YYTABLE does not specify something else to do.  Zero
-  // means the default is an error.
-  static const unsigned short yydefact_[];
+    /// For a symbol, its name in clear.
+    static const char* const yytname_[];
 
-  // YYPGOTO[NTERM-NUM].
-  static const short yypgoto_[];
 
-  // YYDEFGOTO[NTERM-NUM].
-  static const short yydefgoto_[];
+    // Tables.
+    // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+    // STATE-NUM.
+    static const short yypact_[];
 
-  // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-  // positive, shift that token.  If negative, reduce the rule whose
-  // number is the opposite.  If YYTABLE_NINF, syntax error.
-  static const unsigned short yytable_[];
+    // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+    // Performed when YYTABLE does not specify something else to do.  Zero
+    // means the default is an error.
+    static const short yydefact_[];
 
-  static const short yycheck_[];
+    // YYPGOTO[NTERM-NUM].
+    static const short yypgoto_[];
 
-  // YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-  // symbol of state STATE-NUM.
-  static const unsigned short yystos_[];
+    // YYDEFGOTO[NTERM-NUM].
+    static const short yydefgoto_[];
 
-  // YYR1[YYN] -- Symbol number of symbol that rule YYN derives.
-  static const unsigned short yyr1_[];
+    // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+    // positive, shift that token.  If negative, reduce the rule whose
+    // number is the opposite.  If YYTABLE_NINF, syntax error.
+    static const short yytable_[];
 
-  // YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.
-  static const unsigned char yyr2_[];
+    static const short yycheck_[];
 
+    // YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+    // state STATE-NUM.
+    static const short yystos_[];
 
-    /// Convert the symbol name \a n to a form suitable for a diagnostic.
-    static std::string yytnamerr_ (const char *n);
+    // YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.
+    static const short yyr1_[];
+
+    // YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.
+    static const signed char yyr2_[];
 
 
-    /// For a symbol, its name in clear.
-    static const char* const yytname_[];
 #if PARSER6_DEBUG
-  // YYRLINE[YYN] -- Source line where rule number YYN was defined.
-  static const unsigned short yyrline_[];
+    // YYRLINE[YYN] -- Source line where rule number YYN was defined.
+    static const short yyrline_[];
     /// Report on the debug stream that the rule \a r is going to be reduced.
-    virtual void yy_reduce_print_ (int r);
+    virtual void yy_reduce_print_ (int r) const;
     /// Print the state stack on the debug stream.
-    virtual void yystack_print_ ();
+    virtual void yy_stack_print_ () const;
 
     /// Debugging level.
     int yydebug_;
     /// Debug stream.
     std::ostream* yycdebug_;
 
-    /// \brief Display a symbol type, value and location.
+    /// \brief Display a symbol kind, value and location.
     /// \param yyo    The output stream.
     /// \param yysym  The symbol.
     template <typename Base>
@@ -3832,7 +4764,7 @@ switch (yytype)
       /// Default constructor.
       by_state () YY_NOEXCEPT;
 
-      /// The symbol type as needed by the constructor.
+      /// The symbol kind as needed by the constructor.
       typedef state_type kind_type;
 
       /// Constructor.
@@ -3844,15 +4776,16 @@ switch (yytype)
       /// Record that this symbol is empty.
       void clear () YY_NOEXCEPT;
 
-      /// Steal the symbol type from \a that.
+      /// Steal the symbol kind from \a that.
       void move (by_state& that);
 
-      /// The (internal) type number (corresponding to \a state).
-      /// \a empty_symbol when empty.
-      symbol_number_type type_get () const YY_NOEXCEPT;
+      /// The symbol kind (corresponding to \a state).
+      /// \a symbol_kind::S_YYEMPTY when empty.
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
       /// The state number used to denote an empty symbol.
-      enum { empty_state = -1 };
+      /// We use the initial state, as it does not have a value.
+      enum { empty_state = 0 };
 
       /// The state.
       /// \a empty when empty.
@@ -3874,6 +4807,10 @@ switch (yytype)
       /// Assignment, needed by push_back by some old implementations.
       /// Moves the contents of that.
       stack_symbol_type& operator= (stack_symbol_type& that);
+
+      /// Assignment, needed by push_back by other implementations.
+      /// Needed by some other old implementations.
+      stack_symbol_type& operator= (const stack_symbol_type& that);
 #endif
     };
 
@@ -3883,48 +4820,38 @@ switch (yytype)
     {
     public:
       // Hide our reversed order.
-      typedef typename S::reverse_iterator iterator;
-      typedef typename S::const_reverse_iterator const_iterator;
+      typedef typename S::iterator iterator;
+      typedef typename S::const_iterator const_iterator;
       typedef typename S::size_type size_type;
+      typedef typename std::ptrdiff_t index_type;
 
-      stack (size_type n = 200)
+      stack (size_type n = 200) YY_NOEXCEPT
         : seq_ (n)
       {}
 
-      /// Random access.
-      ///
-      /// Index 0 returns the topmost element.
-      T&
-      operator[] (size_type i)
-      {
-        return seq_[size () - 1 - i];
-      }
-
-      /// Random access.
-      ///
-      /// Index 0 returns the topmost element.
-      T&
-      operator[] (int i)
-      {
-        return operator[] (size_type (i));
-      }
+#if 201103L <= YY_CPLUSPLUS
+      /// Non copyable.
+      stack (const stack&) = delete;
+      /// Non copyable.
+      stack& operator= (const stack&) = delete;
+#endif
 
       /// Random access.
       ///
       /// Index 0 returns the topmost element.
       const T&
-      operator[] (size_type i) const
+      operator[] (index_type i) const
       {
-        return seq_[size () - 1 - i];
+        return seq_[size_type (size () - 1 - i)];
       }
 
       /// Random access.
       ///
       /// Index 0 returns the topmost element.
-      const T&
-      operator[] (int i) const
+      T&
+      operator[] (index_type i)
       {
-        return operator[] (size_type (i));
+        return seq_[size_type (size () - 1 - i)];
       }
 
       /// Steal the contents of \a t.
@@ -3939,7 +4866,7 @@ switch (yytype)
 
       /// Pop elements from the stack.
       void
-      pop (int n = 1) YY_NOEXCEPT
+      pop (std::ptrdiff_t n = 1) YY_NOEXCEPT
       {
         for (; 0 < n; --n)
           seq_.pop_back ();
@@ -3953,49 +4880,53 @@ switch (yytype)
       }
 
       /// Number of elements on the stack.
-      size_type
+      index_type
       size () const YY_NOEXCEPT
       {
-        return seq_.size ();
+        return index_type (seq_.size ());
       }
 
       /// Iterator on top of the stack (going downwards).
       const_iterator
       begin () const YY_NOEXCEPT
       {
-        return seq_.rbegin ();
+        return seq_.begin ();
       }
 
       /// Bottom of the stack.
       const_iterator
       end () const YY_NOEXCEPT
       {
-        return seq_.rend ();
+        return seq_.end ();
       }
 
       /// Present a slice of the top of a stack.
       class slice
       {
       public:
-        slice (const stack& stack, int range)
+        slice (const stack& stack, index_type range) YY_NOEXCEPT
           : stack_ (stack)
           , range_ (range)
         {}
 
         const T&
-        operator[] (int i) const
+        operator[] (index_type i) const
         {
           return stack_[range_ - i];
         }
 
       private:
         const stack& stack_;
-        int range_;
+        index_type range_;
       };
 
     private:
+#if YY_CPLUSPLUS < 201103L
+      /// Non copyable.
       stack (const stack&);
+      /// Non copyable.
       stack& operator= (const stack&);
+#endif
       /// The wrapped container.
       S seq_;
     };
@@ -4023,33 +4954,30 @@ switch (yytype)
     void yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym);
 
     /// Pop \a n symbols from the stack.
-    void yypop_ (int n = 1);
+    void yypop_ (int n = 1) YY_NOEXCEPT;
 
     /// Constants.
     enum
     {
-      yyeof_ = 0,
-      yylast_ = 1103,     ///< Last index in yytable_.
-      yynnts_ = 403,  ///< Number of nonterminal symbols.
-      yyfinal_ = 32, ///< Termination state number.
-      yyterror_ = 1,
-      yyerrcode_ = 256,
-      yyntokens_ = 185  ///< Number of tokens.
+      yylast_ = 1135,     ///< Last index in yytable_.
+      yynnts_ = 414,  ///< Number of nonterminal symbols.
+      yyfinal_ = 32 ///< Termination state number.
     };
 
 
     // User arguments.
     isc::dhcp::Parser6Context& ctx;
+
   };
 
   inline
-  Dhcp6Parser::token_number_type
-  Dhcp6Parser::yytranslate_ (token_type t)
+  Dhcp6Parser::symbol_kind_type
+  Dhcp6Parser::yytranslate_ (int t) YY_NOEXCEPT
   {
     // YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to
     // TOKEN-NUM as returned by yylex.
     static
-    const token_number_type
+    const unsigned char
     translate_table[] =
     {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -4095,93 +5023,53 @@ switch (yytype)
      145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
      155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
      165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
-     175,   176,   177,   178,   179,   180,   181,   182,   183,   184
+     175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
+     185,   186,   187,   188,   189,   190,   191,   192,   193
     };
-    const unsigned user_token_number_max_ = 439;
-    const token_number_type undef_token_ = 2;
+    // Last valid token kind.
+    const int code_max = 448;
 
-    if (static_cast<int> (t) <= yyeof_)
-      return yyeof_;
-    else if (static_cast<unsigned> (t) <= user_token_number_max_)
-      return translate_table[t];
+    if (t <= 0)
+      return symbol_kind::S_YYEOF;
+    else if (t <= code_max)
+      return static_cast <symbol_kind_type> (translate_table[t]);
     else
-      return undef_token_;
+      return symbol_kind::S_YYUNDEF;
   }
 
   // basic_symbol.
-#if 201103L <= YY_CPLUSPLUS
-  template <typename Base>
-  Dhcp6Parser::basic_symbol<Base>::basic_symbol (basic_symbol&& that)
-    : Base (std::move (that))
-    , value ()
-    , location (std::move (that.location))
-  {
-    switch (this->type_get ())
-    {
-      case 202: // value
-      case 206: // map_value
-      case 267: // db_type
-      case 360: // hr_mode
-      case 496: // duid_type
-      case 531: // ncr_protocol_value
-      case 538: // replace_client_name_value
-        value.move< ElementPtr > (std::move (that.value));
-        break;
-
-      case 184: // "boolean"
-        value.move< bool > (std::move (that.value));
-        break;
-
-      case 183: // "floating point"
-        value.move< double > (std::move (that.value));
-        break;
-
-      case 182: // "integer"
-        value.move< int64_t > (std::move (that.value));
-        break;
-
-      case 181: // "constant string"
-        value.move< std::string > (std::move (that.value));
-        break;
-
-      default:
-        break;
-    }
-
-  }
-#endif
-
   template <typename Base>
   Dhcp6Parser::basic_symbol<Base>::basic_symbol (const basic_symbol& that)
     : Base (that)
     , value ()
     , location (that.location)
   {
-    switch (this->type_get ())
+    switch (this->kind ())
     {
-      case 202: // value
-      case 206: // map_value
-      case 267: // db_type
-      case 360: // hr_mode
-      case 496: // duid_type
-      case 531: // ncr_protocol_value
-      case 538: // replace_client_name_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.copy< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 184: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.copy< bool > (YY_MOVE (that.value));
         break;
 
-      case 183: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.copy< double > (YY_MOVE (that.value));
         break;
 
-      case 182: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.copy< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 181: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.copy< std::string > (YY_MOVE (that.value));
         break;
 
@@ -4193,11 +5081,20 @@ switch (yytype)
 
 
 
+
+  template <typename Base>
+  Dhcp6Parser::symbol_kind_type
+  Dhcp6Parser::basic_symbol<Base>::type_get () const YY_NOEXCEPT
+  {
+    return this->kind ();
+  }
+
+
   template <typename Base>
   bool
   Dhcp6Parser::basic_symbol<Base>::empty () const YY_NOEXCEPT
   {
-    return Base::type_get () == empty_symbol;
+    return this->kind () == symbol_kind::S_YYEMPTY;
   }
 
   template <typename Base>
@@ -4205,31 +5102,32 @@ switch (yytype)
   Dhcp6Parser::basic_symbol<Base>::move (basic_symbol& s)
   {
     super_type::move (s);
-    switch (this->type_get ())
+    switch (this->kind ())
     {
-      case 202: // value
-      case 206: // map_value
-      case 267: // db_type
-      case 360: // hr_mode
-      case 496: // duid_type
-      case 531: // ncr_protocol_value
-      case 538: // replace_client_name_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.move< ElementPtr > (YY_MOVE (s.value));
         break;
 
-      case 184: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (YY_MOVE (s.value));
         break;
 
-      case 183: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (YY_MOVE (s.value));
         break;
 
-      case 182: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (YY_MOVE (s.value));
         break;
 
-      case 181: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (YY_MOVE (s.value));
         break;
 
@@ -4240,90 +5138,67 @@ switch (yytype)
     location = YY_MOVE (s.location);
   }
 
-  // by_type.
+  // by_kind.
   inline
-  Dhcp6Parser::by_type::by_type ()
-    : type (empty_symbol)
+  Dhcp6Parser::by_kind::by_kind () YY_NOEXCEPT
+    : kind_ (symbol_kind::S_YYEMPTY)
   {}
 
 #if 201103L <= YY_CPLUSPLUS
   inline
-  Dhcp6Parser::by_type::by_type (by_type&& that)
-    : type (that.type)
+  Dhcp6Parser::by_kind::by_kind (by_kind&& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
   {
     that.clear ();
   }
 #endif
 
   inline
-  Dhcp6Parser::by_type::by_type (const by_type& that)
-    : type (that.type)
+  Dhcp6Parser::by_kind::by_kind (const by_kind& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
   {}
 
   inline
-  Dhcp6Parser::by_type::by_type (token_type t)
-    : type (yytranslate_ (t))
+  Dhcp6Parser::by_kind::by_kind (token_kind_type t) YY_NOEXCEPT
+    : kind_ (yytranslate_ (t))
   {}
 
+
+
   inline
   void
-  Dhcp6Parser::by_type::clear ()
+  Dhcp6Parser::by_kind::clear () YY_NOEXCEPT
   {
-    type = empty_symbol;
+    kind_ = symbol_kind::S_YYEMPTY;
   }
 
   inline
   void
-  Dhcp6Parser::by_type::move (by_type& that)
+  Dhcp6Parser::by_kind::move (by_kind& that)
   {
-    type = that.type;
+    kind_ = that.kind_;
     that.clear ();
   }
 
   inline
-  int
-  Dhcp6Parser::by_type::type_get () const YY_NOEXCEPT
+  Dhcp6Parser::symbol_kind_type
+  Dhcp6Parser::by_kind::kind () const YY_NOEXCEPT
   {
-    return type;
+    return kind_;
   }
 
+
   inline
-  Dhcp6Parser::token_type
-  Dhcp6Parser::by_type::token () const YY_NOEXCEPT
+  Dhcp6Parser::symbol_kind_type
+  Dhcp6Parser::by_kind::type_get () const YY_NOEXCEPT
   {
-    // YYTOKNUM[NUM] -- (External) token number corresponding to the
-    // (internal) symbol number NUM (which must be that of a token).  */
-    static
-    const unsigned short
-    yytoken_number_[] =
-    {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
-     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
-     435,   436,   437,   438,   439
-    };
-    return token_type (yytoken_number_[type]);
+    return this->kind ();
   }
 
+
 #line 14 "dhcp6_parser.yy"
 } } // isc::dhcp
-#line 4326 "dhcp6_parser.h"
-
+#line 5202 "dhcp6_parser.h"
 
 
 
@@ -54,6 +54,7 @@ using namespace std;
   CONFIG_CONTROL "config-control"
   CONFIG_DATABASES "config-databases"
   CONFIG_FETCH_WAIT_TIME "config-fetch-wait-time"
+  NOTIFY_FIFO "notify-fifo"
 
   INTERFACES_CONFIG "interfaces-config"
   INTERFACES "interfaces"
@@ -84,6 +85,7 @@ using namespace std;
   REQUEST_TIMEOUT "request-timeout"
   TCP_KEEPALIVE "tcp-keepalive"
   TCP_NODELAY "tcp-nodelay"
+  POOL_SIZE "pool-size"
 
   PREFERRED_LIFETIME "preferred-lifetime"
   MIN_PREFERRED_LIFETIME "min-preferred-lifetime"
@@ -96,6 +98,10 @@ using namespace std;
   CALCULATE_TEE_TIMES "calculate-tee-times"
   T1_PERCENT "t1-percent"
   T2_PERCENT "t2-percent"
+  CACHE_THRESHOLD "cache-threshold"
+  PACKET_ARENA_CHUNK_SIZE "packet-arena-chunk-size"
+  PACKET_SLOW_THRESHOLD "packet-slow-threshold"
+  HOST_FILTER_REBUILD_INTERVAL "host-filter-rebuild-interval"
   DECLINE_PROBATION_PERIOD "decline-probation-period"
   SERVER_TAG "server-tag"
   SUBNET6 "subnet6"
@@ -204,6 +210,7 @@ using namespace std;
   UDP "UDP"
   TCP "TCP"
   JSON "JSON"
+  BINARY "BINARY"
   WHEN_PRESENT "when-present"
   NEVER "never"
   ALWAYS "always"
@@ -220,6 +227,8 @@ using namespace std;
   FLUSH "flush"
   MAXSIZE "maxsize"
   MAXVER "maxver"
+  ASYNC "async"
+  ASYNC_QUEUE_SIZE "async-queue-size"
 
   DHCP4 "Dhcp4"
   DHCPDDNS "DhcpDdns"
@@ -255,6 +264,7 @@ using namespace std;
 %type <ElementPtr> hr_mode
 %type <ElementPtr> duid_type
 %type <ElementPtr> ncr_protocol_value
+%type <ElementPtr> ncr_format_value
 %type <ElementPtr> replace_client_name_value
 
 %printer { yyoutput << $$; } <*>;
@@ -486,6 +496,10 @@ global_param: data_directory
             | calculate_tee_times
             | t1_percent
             | t2_percent
+            | cache_threshold
+            | packet_arena_chunk_size
+            | packet_slow_threshold
+            | host_filter_rebuild_interval
             | loggers
             | hostname_char_set
             | hostname_char_replacement
@@ -555,6 +569,26 @@ t2_percent: T2_PERCENT COLON FLOAT {
     ctx.stack_.back()->set("t2-percent", t2);
 };
 
+cache_threshold: CACHE_THRESHOLD COLON FLOAT {
+    ElementPtr ct(new DoubleElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("cache-threshold", ct);
+};
+
+packet_arena_chunk_size: PACKET_ARENA_CHUNK_SIZE COLON INTEGER {
+    ElementPtr pacs(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("packet-arena-chunk-size", pacs);
+};
+
+packet_slow_threshold: PACKET_SLOW_THRESHOLD COLON INTEGER {
+    ElementPtr pst(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("packet-slow-threshold", pst);
+};
+
+host_filter_rebuild_interval: HOST_FILTER_REBUILD_INTERVAL COLON INTEGER {
+    ElementPtr hfri(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("host-filter-rebuild-interval", hfri);
+};
+
 decline_probation_period: DECLINE_PROBATION_PERIOD COLON INTEGER {
     ElementPtr dpp(new IntElement($3, ctx.loc2pos(@3)));
     ctx.stack_.back()->set("decline-probation-period", dpp);
@@ -687,6 +721,7 @@ database_map_param: database_type
                   | request_timeout
                   | tcp_keepalive
                   | tcp_nodelay
+                  | pool_size
                   | keyspace
                   | consistency
                   | serial_consistency
@@ -783,6 +818,11 @@ tcp_nodelay: TCP_NODELAY COLON BOOLEAN {
     ctx.stack_.back()->set("tcp-nodelay", n);
 };
 
+pool_size: POOL_SIZE COLON INTEGER {
+    ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("pool-size", n);
+};
+
 contact_points: CONTACT_POINTS {
     ctx.enter(ctx.NO_KEYWORD);
 } COLON STRING {
@@ -1134,6 +1174,7 @@ subnet6_param: preferred_lifetime
              | calculate_tee_times
              | t1_percent
              | t2_percent
+             | cache_threshold
              | unknown_map_entry
              ;
 
@@ -1260,6 +1301,7 @@ shared_network_param: name
                     | calculate_tee_times
                     | t1_percent
                     | t2_percent
+                    | cache_threshold
                     | unknown_map_entry
                     ;
 
@@ -2169,12 +2211,16 @@ ncr_protocol_value:
 
 ncr_format: NCR_FORMAT {
     ctx.enter(ctx.NCR_FORMAT);
-} COLON JSON {
-    ElementPtr json(new StringElement("JSON", ctx.loc2pos(@4)));
-    ctx.stack_.back()->set("ncr-format", json);
+} COLON ncr_format_value {
+    ctx.stack_.back()->set("ncr-format", $4);
     ctx.leave();
 };
 
+ncr_format_value:
+    JSON { $$ = ElementPtr(new StringElement("JSON", ctx.loc2pos(@1))); }
+  | BINARY { $$ = ElementPtr(new StringElement("BINARY", ctx.loc2pos(@1))); }
+  ;
+
 override_no_update: OVERRIDE_NO_UPDATE COLON BOOLEAN {
     ElementPtr b(new BoolElement($3, ctx.loc2pos(@3)));
     ctx.stack_.back()->set("override-no-update", b);
@@ -2288,6 +2334,7 @@ config_control_params: config_control_param
 // This defines a list of allowed parameters for each subnet.
 config_control_param: config_databases
                     | config_fetch_wait_time
+                    | notify_fifo
                     ;
 
 config_databases: CONFIG_DATABASES {
@@ -2305,6 +2352,14 @@ config_fetch_wait_time: CONFIG_FETCH_WAIT_TIME COLON INTEGER {
     ctx.stack_.back()->set("config-fetch-wait-time", value);
 };
 
+notify_fifo: NOTIFY_FIFO {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr value(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("notify-fifo", value);
+    ctx.leave();
+};
+
 // --- logging entry -----------------------------------------
 
 // This defines the top level "Logging" object. It parses
@@ -2421,6 +2476,8 @@ output_params: output
              | flush
              | maxsize
              | maxver
+             | async
+             | async_queue_size
              ;
 
 output: OUTPUT {
@@ -2446,6 +2503,22 @@ maxver: MAXVER COLON INTEGER {
     ctx.stack_.back()->set("maxver", maxver);
 };
 
+async: ASYNC {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr async(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("async", async);
+    ctx.leave();
+};
+
+async_queue_size: ASYNC_QUEUE_SIZE COLON INTEGER {
+    if ($3 <= 0) {
+        error(@3, "async-queue-size must be greater than zero");
+    }
+    ElementPtr size(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("async-queue-size", size);
+};
+
 %%
 
 void
@@ -35,6 +35,7 @@
 #include <dhcpsrv/lease_mgr.h>
 #include <dhcpsrv/lease_mgr_factory.h>
 #include <dhcpsrv/ncr_generator.h>
+#include <dhcpsrv/packet_latency.h>
 #include <dhcpsrv/subnet.h>
 #include <dhcpsrv/subnet_selector.h>
 #include <dhcpsrv/utils.h>
@@ -48,6 +49,7 @@
 
 #include <util/encode/hex.h>
 #include <util/io_utilities.h>
+#include <util/memory_arena.h>
 #include <util/pointer_util.h>
 #include <util/range_utilities.h>
 #include <log/logger.h>
@@ -103,6 +105,8 @@ struct Dhcp6Hooks {
     int hook_index_buffer6_send_;     ///< index for "buffer6_send" hook point
     int hook_index_lease6_decline_;   ///< index for "lease6_decline" hook point
     int hook_index_host6_identifier_; ///< index for "host6_identifier" hook point
+    int argument_index_query6_;       ///< index for "query6" argument
+    int argument_index_response6_;    ///< index for "response6" argument
 
     /// Constructor that registers hook points for DHCPv6 engine
     Dhcp6Hooks() {
@@ -115,6 +119,8 @@ struct Dhcp6Hooks {
         hook_index_buffer6_send_      = HooksManager::registerHook("buffer6_send");
         hook_index_lease6_decline_    = HooksManager::registerHook("lease6_decline");
         hook_index_host6_identifier_  = HooksManager::registerHook("host6_identifier");
+        argument_index_query6_        = HooksManager::registerArgument("query6");
+        argument_index_response6_     = HooksManager::registerArgument("response6");
     }
 };
 
@@ -184,7 +190,8 @@ Dhcpv6Srv::Dhcpv6Srv(uint16_t server_port, uint16_t client_port)
       client_port_(client_port), serverid_(), shutdown_(true),
       alloc_engine_(), name_change_reqs_(),
       network_state_(new NetworkState(NetworkState::DHCPv6)),
-      cb_control_(new CBControlDHCPv6()) {
+      cb_control_(new CBControlDHCPv6()), packet_arena_chunk_size_(0),
+      packet_latency_("pkt6") {
     LOG_DEBUG(dhcp6_logger, DBG_DHCP6_START, DHCP6_OPEN_SOCKET)
         .arg(server_port);
 
@@ -307,6 +314,7 @@ Dhcpv6Srv::initContext(const Pkt6Ptr& pkt,
                        AllocEngine::ClientContext6& ctx,
                        bool& drop) {
     ctx.subnet_ = selectSubnet(pkt, drop);
+    pkt->markStage(Pkt::SUBNET_SELECTED);
     ctx.duid_ = pkt->getClientId(),
     ctx.fwd_dns_update_ = false;
     ctx.rev_dns_update_ = false;
@@ -357,7 +365,7 @@ Dhcpv6Srv::initContext(const Pkt6Ptr& pkt,
                     ScopedCalloutHandleState callout_handle_state(callout_handle);
 
                     // Pass incoming packet as argument
-                    callout_handle->setArgument("query6", pkt);
+                    callout_handle->setArgument(Hooks.argument_index_query6_, pkt);
                     callout_handle->setArgument("id_type", type);
                     callout_handle->setArgument("id_value", id);
 
@@ -386,6 +394,7 @@ Dhcpv6Srv::initContext(const Pkt6Ptr& pkt,
         // Find host reservations using specified identifiers.
         alloc_engine_->findReservation(ctx);
     }
+    pkt->markStage(Pkt::HOSTS_LOOKED_UP);
 
     // Set KNOWN builtin class if something was found, UNKNOWN if not.
     if (!ctx.hosts_.empty()) {
@@ -443,6 +452,11 @@ void Dhcpv6Srv::run_one() {
         // point are: the interface, source address and destination addresses
         // and ports.
         if (query) {
+            // The receive time was stamped when the packet was read from
+            // the socket, possibly long before it was dequeued.
+            query->markStage(Pkt::RECEIVED, query->getTimestamp());
+            query->markStage(Pkt::DEQUEUED);
+
             LOG_DEBUG(packet6_logger, DBG_DHCP6_BASIC, DHCP6_BUFFER_RECEIVED)
                 .arg(query->getRemoteAddr().toText())
                 .arg(query->getRemotePort())
@@ -506,10 +520,16 @@ void Dhcpv6Srv::run_one() {
                   DHCP6_PACKET_DROP_DHCP_DISABLED)
             .arg(query->getLabel());
         return;
-    } else {
-        processPacket(query, rsp);
     }
 
+    // Objects created from now on until the response is sent are taken
+    // from the per-packet arena, if enabled. The arena is released when
+    // the last of these objects is destroyed. The scope is opened only
+    // now: control commands are run while waiting for packets and the
+    // objects they create outlive the packet.
+    MemoryArenaScope arena_scope(packet_arena_chunk_size_);
+    processPacket(query, rsp);
+
     if (!rsp) {
         return;
     }
@@ -537,7 +557,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
         ScopedEnableOptionsCopy<Pkt6> query6_options_copy(query);
 
         // Pass incoming packet as argument
-        callout_handle->setArgument("query6", query);
+        callout_handle->setArgument(Hooks.argument_index_query6_, query);
 
         // Call callouts
         HooksManager::callCallouts(Hooks.hook_index_buffer6_receive_, *callout_handle);
@@ -569,7 +589,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
             return;
         }
 
-        callout_handle->getArgument("query6", query);
+        callout_handle->getArgument(Hooks.argument_index_query6_, query);
     }
 
     // Unpack the packet information unless the buffer6_receive callouts
@@ -605,6 +625,8 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
         }
     }
 
+    query->markStage(Pkt::UNPACKED);
+
     // Update statistics accordingly for received packet.
     processStatsReceived(query);
 
@@ -629,6 +651,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
 
     // Assign this packet to a class, if possible
     classifyPacket(query);
+    query->markStage(Pkt::CLASSIFIED);
 
     LOG_DEBUG(packet6_logger, DBG_DHCP6_BASIC_DATA, DHCP6_PACKET_RECEIVED)
         .arg(query->getLabel())
@@ -657,7 +680,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
         ScopedEnableOptionsCopy<Pkt6> query6_options_copy(query);
 
         // Pass incoming packet as argument
-        callout_handle->setArgument("query6", query);
+        callout_handle->setArgument(Hooks.argument_index_query6_, query);
 
         // Call callouts
         HooksManager::callCallouts(Hooks.hook_index_pkt6_receive_, *callout_handle);
@@ -675,7 +698,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
             return;
         }
 
-        callout_handle->getArgument("query6", query);
+        callout_handle->getArgument(Hooks.argument_index_query6_, query);
     }
 
     // Reject the message if it doesn't pass the sanity check.
@@ -691,6 +714,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
                                       static_cast<int64_t>(1));
         return;
     }
+    query->markStage(Pkt::ACCEPTED);
 
     if (query->getType() == DHCPV6_DHCPV4_QUERY) {
         // This call never throws. Should this change, this section must be
@@ -766,6 +790,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
         // Increase the statistic of dropped packets.
         StatsMgr::instance().addValue("pkt6-receive-drop", static_cast<int64_t>(1));
     }
+    query->markStage(Pkt::PROCESSED);
 
     if (!rsp) {
         return;
@@ -818,7 +843,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
         ScopedEnableOptionsCopy<Pkt6> query6_options_copy(query);
 
         // Also pass the corresponding query packet as argument
-        callout_handle->setArgument("query6", query);
+        callout_handle->setArgument(Hooks.argument_index_query6_, query);
 
         Lease6CollectionPtr new_leases(new Lease6Collection());
         if (!ctx.new_leases_.empty()) {
@@ -904,6 +929,10 @@ Dhcpv6Srv::processPacketPktSend(hooks::CalloutHandlePtr& callout_handle,
         return;
     }
 
+    // The response carries the processing stages of its query until it
+    // is sent.
+    rsp->copyStageTimes(*query);
+
     // Specifies if server should do the packing
     bool skip_pack = false;
 
@@ -923,10 +952,10 @@ Dhcpv6Srv::processPacketPktSend(hooks::CalloutHandlePtr& callout_handle,
         ScopedEnableOptionsCopy<Pkt6> query_resp_options_copy(query, rsp);
 
         // Pass incoming packet as argument
-        callout_handle->setArgument("query6", query);
+        callout_handle->setArgument(Hooks.argument_index_query6_, query);
 
         // Set our response
-        callout_handle->setArgument("response6", rsp);
+        callout_handle->setArgument(Hooks.argument_index_response6_, rsp);
 
         // Call all installed callouts
         HooksManager::callCallouts(Hooks.hook_index_pkt6_send_, *callout_handle);
@@ -960,6 +989,7 @@ Dhcpv6Srv::processPacketPktSend(hooks::CalloutHandlePtr& callout_handle,
         }
 
     }
+    rsp->markStage(Pkt::PACKED);
 }
 
 void
@@ -986,7 +1016,7 @@ Dhcpv6Srv::processPacketBufferSend(CalloutHandlePtr& callout_handle,
             ScopedEnableOptionsCopy<Pkt6> response6_options_copy(rsp);
 
             // Pass incoming packet as argument
-            callout_handle->setArgument("response6", rsp);
+            callout_handle->setArgument(Hooks.argument_index_response6_, rsp);
 
             // Call callouts
             HooksManager::callCallouts(Hooks.hook_index_buffer6_send_,
@@ -1003,7 +1033,7 @@ Dhcpv6Srv::processPacketBufferSend(CalloutHandlePtr& callout_handle,
                 return;
             }
 
-            callout_handle->getArgument("response6", rsp);
+            callout_handle->getArgument(Hooks.argument_index_response6_, rsp);
         }
 
         LOG_DEBUG(packet6_logger, DBG_DHCP6_BASIC, DHCP6_PACKET_SEND)
@@ -1020,10 +1050,21 @@ Dhcpv6Srv::processPacketBufferSend(CalloutHandlePtr& callout_handle,
             .arg(static_cast<int>(rsp->getType())).arg(rsp->toText());
 
         sendPacket(rsp);
+        rsp->markStage(Pkt::SENT);
 
         // Update statistics accordingly for sent packet.
         processStatsSent(rsp);
 
+        // Record the latencies of the processing stages and report the
+        // breakdown of the outliers.
+        const uint64_t total = packet_latency_.record(*rsp);
+        if (packet_latency_.reportSlow(total)) {
+            LOG_WARN(packet6_logger, DHCP6_PACKET_SLOW)
+                .arg(rsp->getLabel())
+                .arg(total)
+                .arg(PacketLatency::breakdownToText(*rsp));
+        }
+
     } catch (const std::exception& e) {
         LOG_ERROR(packet6_logger, DHCP6_PACKET_SEND_FAIL).arg(e.what());
     }
@@ -1163,6 +1204,24 @@ Dhcpv6Srv::appendRequestedOptions(const Pkt6Ptr& question, Pkt6Ptr& answer,
     if (option_oro) {
         requested_opts = option_oro->getValues();
     }
+
+    // Use the options resolved for this option list by the previous
+    // packets if the list is made of the configured scopes only.
+    ConstResolvedCfgOptionPtr resolved = CfgMgr::instance().getCurrentCfg()->
+        getCfgOptionListCache()->get(co_list, DHCP6_OPTION_SPACE);
+    if (resolved) {
+        const std::vector<uint16_t>& persistent = resolved->getPersistentCodes();
+        requested_opts.insert(requested_opts.end(), persistent.begin(),
+                              persistent.end());
+        BOOST_FOREACH(uint16_t opt, requested_opts) {
+            OptionPtr option = resolved->get(opt);
+            if (option) {
+                answer->addOption(option);
+            }
+        }
+        return;
+    }
+
     // Iterate on the configured option list to add persistent options
     for (CfgOptionList::const_iterator copts = co_list.begin();
          copts != co_list.end(); ++copts) {
@@ -1438,7 +1497,7 @@ Dhcpv6Srv::selectSubnet(const Pkt6Ptr& question, bool& drop) {
         ScopedEnableOptionsCopy<Pkt6> query6_options_copy(question);
 
         // Set new arguments
-        callout_handle->setArgument("query6", question);
+        callout_handle->setArgument(Hooks.argument_index_query6_, question);
         callout_handle->setArgument("subnet6", subnet);
 
         // We pass pointer to const collection for performance reasons.
@@ -1536,6 +1595,7 @@ Dhcpv6Srv::assignLeases(const Pkt6Ptr& question, Pkt6Ptr& answer,
             break;
         }
     }
+    question->markStage(Pkt::LEASES_ALLOCATED);
 
     // Subnet may be modified by the allocation engine, if the initial subnet
     // belongs to a shared network.
@@ -2430,6 +2490,7 @@ Dhcpv6Srv::extendLeases(const Pkt6Ptr& query, Pkt6Ptr& reply,
             break;
         }
     }
+    query->markStage(Pkt::LEASES_ALLOCATED);
 }
 
 void
@@ -2599,7 +2660,7 @@ Dhcpv6Srv::releaseIA_NA(const DuidPtr& duid, const Pkt6Ptr& query,
         callout_handle->deleteAllArguments();
 
         // Pass the original packet
-        callout_handle->setArgument("query6", query);
+        callout_handle->setArgument(Hooks.argument_index_query6_, query);
 
         // Pass the lease to be updated
         callout_handle->setArgument("lease6", lease);
@@ -2765,7 +2826,7 @@ Dhcpv6Srv::releaseIA_PD(const DuidPtr& duid, const Pkt6Ptr& query,
         ScopedEnableOptionsCopy<Pkt6> query6_options_copy(query);
 
         // Pass the original packet
-        callout_handle->setArgument("query6", query);
+        callout_handle->setArgument(Hooks.argument_index_query6_, query);
 
         // Pass the lease to be updated
         callout_handle->setArgument("lease6", lease);
@@ -3310,7 +3371,7 @@ Dhcpv6Srv::declineLease(const Pkt6Ptr& decline, const Lease6Ptr lease,
         ScopedEnableOptionsCopy<Pkt6> query6_options_copy(decline);
 
         // Pass incoming packet as argument
-        callout_handle->setArgument("query6", decline);
+        callout_handle->setArgument(Hooks.argument_index_query6_, decline);
         callout_handle->setArgument("lease6", lease);
 
         // Call callouts
@@ -3943,6 +4004,16 @@ void Dhcpv6Srv::discardPackets() {
     HooksManager::clearParkingLots();
 }
 
+void
+Dhcpv6Srv::configurePacketProcessing(const ConstSrvConfigPtr& cfg) {
+    // Check if the objects created for each packet should be allocated
+    // from a per-packet memory arena.
+    packet_arena_chunk_size_ = cfg->getPacketArenaChunkSize();
+
+    // Check if the slow packets should be reported.
+    packet_latency_.setSlowThreshold(cfg->getPacketSlowThreshold());
+}
+
 void
 Dhcpv6Srv::setTeeTimes(uint32_t preferred_lft, const Subnet6Ptr& subnet, Option6IAPtr& resp) {
     // Default T2 time to zero.
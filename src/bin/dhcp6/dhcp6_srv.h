@@ -22,6 +22,7 @@
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/d2_client_mgr.h>
 #include <dhcpsrv/network_state.h>
+#include <dhcpsrv/packet_latency.h>
 #include <dhcpsrv/subnet.h>
 #include <hooks/callout_handle.h>
 #include <process/daemon.h>
@@ -199,6 +200,14 @@ public:
     /// of all packets.  Called during reconfigure and shutdown.
     void discardPackets();
 
+    /// @brief Applies the packet processing settings of a configuration.
+    ///
+    /// Sets the chunk size of the per-packet memory arenas and the
+    /// threshold of the slow packets.
+    ///
+    /// @param cfg Server configuration.
+    void configurePacketProcessing(const ConstSrvConfigPtr& cfg);
+
 protected:
 
     /// @brief Compare received server id with our server id
@@ -1049,6 +1058,21 @@ protected:
 
     /// @brief Controls access to the configuration backends.
     CBControlDHCPv6Ptr cb_control_;
+
+    /// @brief Size of the chunks of the per-packet memory arena.
+    ///
+    /// When not zero, response packets, options, allocation engine
+    /// client contexts and callout handles created while a received
+    /// packet is processed are allocated from a @c isc::util::MemoryArena
+    /// which lives as long as these objects. It is set from the
+    /// @c packet-arena-chunk-size parameter.
+    size_t packet_arena_chunk_size_;
+
+    /// @brief Latencies of the processing stages of the packets.
+    ///
+    /// They are recorded when the responses are sent. The slow packets
+    /// are reported when the @c packet-slow-threshold parameter is set.
+    PacketLatency packet_latency_;
 };
 
 }; // namespace isc::dhcp
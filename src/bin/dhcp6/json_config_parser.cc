@@ -37,6 +37,7 @@
 #include <dhcpsrv/parsers/shared_networks_list_parser.h>
 #include <dhcpsrv/parsers/sanity_checks_parser.h>
 #include <dhcpsrv/host_data_source_factory.h>
+#include <dhcpsrv/host_mgr.h>
 #include <hooks/hooks_parser.h>
 #include <log/logger_support.h>
 #include <process/config_ctl_parser.h>
@@ -167,6 +168,9 @@ public:
     /// - data-directory
     /// - decline-probation-period
     /// - dhcp4o6-port
+    /// - packet-arena-chunk-size
+    /// - packet-slow-threshold
+    /// - host-filter-rebuild-interval
     /// - user-context
     ///
     /// @throw DhcpConfigError if parameters are missing or
@@ -188,6 +192,26 @@ public:
         uint16_t dhcp4o6_port = getUint16(global, "dhcp4o6-port");
         srv_config->setDhcp4o6Port(dhcp4o6_port);
 
+        // Set the chunk size of the per-packet memory arenas.
+        if (global->contains("packet-arena-chunk-size")) {
+            uint32_t chunk_size = getUint32(global, "packet-arena-chunk-size");
+            srv_config->setPacketArenaChunkSize(chunk_size);
+        }
+
+        // Set the processing time above which a packet is reported as slow.
+        if (global->contains("packet-slow-threshold")) {
+            int64_t slow_threshold = getInteger(global, "packet-slow-threshold", 0,
+                                                std::numeric_limits<int64_t>::max());
+            srv_config->setPacketSlowThreshold(slow_threshold);
+        }
+
+        // Set the interval between the rebuilds of the host filter.
+        if (global->contains("host-filter-rebuild-interval")) {
+            int64_t filter_interval = getInteger(global, "host-filter-rebuild-interval",
+                                                 0, HOST_FILTER_MAX_REBUILD_INTERVAL);
+            srv_config->setHostFilterRebuildInterval(filter_interval);
+        }
+
         // Set the global user context.
         ConstElementPtr user_context = global->get("user-context");
         if (user_context) {
@@ -680,6 +704,10 @@ configureDhcp6Server(Dhcpv6Srv& server, isc::data::ConstElementPtr config_set,
                  (config_pair.first == "calculate-tee-times") ||
                  (config_pair.first == "t1-percent") ||
                  (config_pair.first == "t2-percent") ||
+                 (config_pair.first == "cache-threshold") ||
+                 (config_pair.first == "packet-arena-chunk-size") ||
+                 (config_pair.first == "packet-slow-threshold") ||
+                 (config_pair.first == "host-filter-rebuild-interval") ||
                  (config_pair.first == "loggers") ||
                  (config_pair.first == "hostname-char-set") ||
                  (config_pair.first == "hostname-char-replacement")) {
@@ -244,6 +244,7 @@ const char* PARSER_CONFIGS[] = {
     "    \"renew-timer\": 1000, \n"
     "    \"config-control\": { \n"
     "       \"config-fetch-wait-time\": 10, \n"
+    "       \"notify-fifo\": \"/tmp/kea-cb-notify\", \n"
     "       \"config-databases\": [ { \n"
     "               \"type\": \"mysql\", \n"
     "               \"name\": \"keatest1\", \n"
@@ -4868,7 +4869,7 @@ TEST_F(Dhcp6ParserTest, d2ClientConfigGlobal) {
         "     \"sender-port\" : 778, "
         "     \"max-queue-size\" : 2048, "
         "     \"ncr-protocol\" : \"UDP\", "
-        "     \"ncr-format\" : \"JSON\", "
+        "     \"ncr-format\" : \"BINARY\", "
         "     \"override-no-update\" : true, "
         "     \"override-client-update\" : true, "
         "     \"replace-client-name\" : \"when-present\", "
@@ -4905,7 +4906,7 @@ TEST_F(Dhcp6ParserTest, d2ClientConfigGlobal) {
     EXPECT_EQ(778, d2_client_config->getSenderPort());
     EXPECT_EQ(2048, d2_client_config->getMaxQueueSize());
     EXPECT_EQ(dhcp_ddns::NCR_UDP, d2_client_config->getNcrProtocol());
-    EXPECT_EQ(dhcp_ddns::FMT_JSON, d2_client_config->getNcrFormat());
+    EXPECT_EQ(dhcp_ddns::FMT_BINARY, d2_client_config->getNcrFormat());
     EXPECT_TRUE(d2_client_config->getOverrideNoUpdate());
     EXPECT_TRUE(d2_client_config->getOverrideClientUpdate());
     EXPECT_EQ(D2ClientConfig::RCM_WHEN_PRESENT, d2_client_config->getReplaceClientNameMode());
@@ -7429,6 +7430,9 @@ TEST_F(Dhcp6ParserTest, configControlInfo) {
     // Verify that the config-fetch-wait-time is correct.
     EXPECT_FALSE(info->getConfigFetchWaitTime().unspecified());
     EXPECT_EQ(10, info->getConfigFetchWaitTime().get());
+
+    // Verify that the notify-fifo is correct.
+    EXPECT_EQ("/tmp/kea-cb-notify", info->getNotifyFifo());
 }
 
 // Check whether it is possible to configure server-tag
@@ -7628,4 +7632,42 @@ TEST_F(Dhcp6ParserTest, dhcpQueueControlInvalid) {
     }
 }
 
+// This test checks that the packet processing settings are parsed
+// and kept in the configured globals.
+TEST_F(Dhcp6ParserTest, packetProcessingGlobals) {
+    string config =
+        "{ \n"
+        "    \"interfaces-config\": { \n"
+        "        \"interfaces\": [\"*\" ] \n"
+        "    }, \n"
+        "    \"packet-arena-chunk-size\": 8192, \n"
+        "    \"packet-slow-threshold\": 50000, \n"
+        "    \"host-filter-rebuild-interval\": 3600, \n"
+        "    \"subnet6\": [ ] \n"
+        "} \n";
+
+    extractConfig(config);
+    configure(config, CONTROL_RESULT_SUCCESS, "");
+
+    SrvConfigPtr cfg = CfgMgr::instance().getStagingCfg();
+    EXPECT_EQ(8192, cfg->getPacketArenaChunkSize());
+    EXPECT_EQ(50000, cfg->getPacketSlowThreshold());
+    EXPECT_EQ(3600, cfg->getHostFilterRebuildInterval());
+    ConstElementPtr globals = cfg->getConfiguredGlobals();
+    ASSERT_TRUE(globals->get("packet-slow-threshold"));
+    EXPECT_EQ(50000, globals->get("packet-slow-threshold")->intValue());
+
+    // Out of range values are rejected.
+    config =
+        "{ \n"
+        "    \"interfaces-config\": { \n"
+        "        \"interfaces\": [\"*\" ] \n"
+        "    }, \n"
+        "    \"host-filter-rebuild-interval\": 86401, \n"
+        "    \"subnet6\": [ ] \n"
+        "} \n";
+
+    configure(config, CONTROL_RESULT_ERROR);
+}
+
 };
@@ -794,6 +794,7 @@ TEST_F(CtrlDhcpv6SrvTest, commandsRegistration) {
     EXPECT_TRUE(command_list.find("\"shutdown\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-get\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-get-all\"") != string::npos);
+    EXPECT_TRUE(command_list.find("\"statistic-latency-get\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-remove\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-remove-all\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-reset\"") != string::npos);
@@ -878,6 +879,72 @@ TEST_F(CtrlChannelDhcpv6SrvTest, serverTagGet) {
     expected = "{ \"arguments\": { \"server-tag\": \"foobar\" }, \"result\": 0 }";
 }
 
+namespace {
+
+/// @brief Callout doing nothing, used to record a latency.
+int
+latencyCallout(CalloutHandle&) {
+    return (0);
+}
+
+}
+
+// This test verifies that the hooks-latency-get command returns the
+// latencies of the callouts and validates its arguments.
+TEST_F(CtrlChannelDhcpv6SrvTest, hooksLatencyGet) {
+    createUnixChannelServer();
+    std::string response;
+
+    // No callout was called.
+    sendUnixCommand("{ \"command\": \"hooks-latency-get\" }", response);
+    EXPECT_EQ("{ \"arguments\": {  }, \"result\": 0 }", response);
+
+    // Call a callout registered on the pkt6_receive hook point twice.
+    int hook_index = ServerHooks::getServerHooks().getIndex("pkt6_receive");
+    HooksManager::preCalloutsLibraryHandle().registerCallout("pkt6_receive",
+                                                             latencyCallout);
+    CalloutHandlePtr callout_handle = HooksManager::createCalloutHandle();
+    HooksManager::callCallouts(hook_index, *callout_handle);
+    HooksManager::callCallouts(hook_index, *callout_handle);
+
+    // The latencies of the hook point and of the callout are returned.
+    sendUnixCommand("{ \"command\": \"hooks-latency-get\", "
+                    "\"arguments\": { \"reset\": true } }", response);
+    ConstElementPtr rsp;
+    ASSERT_NO_THROW(rsp = Element::fromJSON(response));
+    int status = -1;
+    ConstElementPtr latencies = parseAnswer(status, rsp);
+    EXPECT_EQ(CONTROL_RESULT_SUCCESS, status);
+    ASSERT_TRUE(latencies);
+    ASSERT_EQ(1, latencies->size());
+    ConstElementPtr hook = latencies->get("pkt6_receive");
+    ASSERT_TRUE(hook);
+    ASSERT_TRUE(hook->get("count"));
+    EXPECT_EQ(2, hook->get("count")->intValue());
+    for (auto name : { "min", "max", "mean", "p50", "p90", "p99", "p99.9" }) {
+        EXPECT_TRUE(hook->get(name)) << name << " is missing";
+    }
+    ConstElementPtr libraries = hook->get("libraries");
+    ASSERT_TRUE(libraries);
+    ASSERT_EQ(1, libraries->size());
+    ConstElementPtr library = libraries->get(0);
+    ASSERT_TRUE(library->get("index"));
+    EXPECT_EQ(0, library->get("index")->intValue());
+    EXPECT_FALSE(library->get("library"));
+    ASSERT_TRUE(library->get("count"));
+    EXPECT_EQ(2, library->get("count")->intValue());
+
+    // The latencies were reset.
+    sendUnixCommand("{ \"command\": \"hooks-latency-get\" }", response);
+    EXPECT_EQ("{ \"arguments\": {  }, \"result\": 0 }", response);
+
+    // The reset argument must be a boolean.
+    sendUnixCommand("{ \"command\": \"hooks-latency-get\", "
+                    "\"arguments\": { \"reset\": \"yes\" } }", response);
+    EXPECT_EQ("{ \"result\": 1, \"text\": \"'reset' must be a boolean\" }",
+              response);
+}
+
 // This test verifies that the DHCP server immediately reclaims expired
 // leases on leases-reclaim command
 TEST_F(CtrlChannelDhcpv6SrvTest, controlLeasesReclaim) {
@@ -1074,6 +1141,7 @@ TEST_F(CtrlChannelDhcpv6SrvTest, commandsList) {
     checkListCommands(rsp, "config-set");
     checkListCommands(rsp, "config-test");
     checkListCommands(rsp, "config-write");
+    checkListCommands(rsp, "hooks-latency-get");
     checkListCommands(rsp, "list-commands");
     checkListCommands(rsp, "leases-reclaim");
     checkListCommands(rsp, "libreload");
@@ -1082,6 +1150,7 @@ TEST_F(CtrlChannelDhcpv6SrvTest, commandsList) {
     checkListCommands(rsp, "shutdown");
     checkListCommands(rsp, "statistic-get");
     checkListCommands(rsp, "statistic-get-all");
+    checkListCommands(rsp, "statistic-latency-get");
     checkListCommands(rsp, "statistic-remove");
     checkListCommands(rsp, "statistic-remove-all");
     checkListCommands(rsp, "statistic-reset");
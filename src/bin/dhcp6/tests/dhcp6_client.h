@@ -129,7 +129,7 @@ public:
         /// @return Pointer to the option if the option exists, or NULL if
         /// the option doesn't exist.
         OptionPtr findOption(const uint16_t code) const {
-            std::multimap<unsigned int, OptionPtr>::const_iterator it = options_.find(code);
+            OptionCollection::const_iterator it = options_.find(code);
             if (it != options_.end()) {
                 return (it->second);
             }
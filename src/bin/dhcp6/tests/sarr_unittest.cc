@@ -536,6 +536,28 @@ TEST_F(SARRTest, sarrStats) {
     EXPECT_EQ(2, pkt6_sent->getInteger().first);
 }
 
+// This test verifies that the latencies of the processing stages are
+// recorded for the sent responses.
+TEST_F(SARRTest, sarrLatencies) {
+    using namespace isc::stats;
+    StatsMgr& mgr = StatsMgr::instance();
+    mgr.resetLatencies();
+
+    Dhcp6Client client;
+    configure(CONFIGS[1], *client.getServer());
+    client.setInterface("eth1");
+    client.requestAddress();
+
+    ASSERT_NO_THROW(client.doSARR());
+    ASSERT_EQ(1, client.getLeaseNum());
+
+    // Both the Advertise and the Reply were recorded.
+    EXPECT_EQ(2, mgr.getLatencyHistogram("pkt6-latency-total")->getCount());
+    EXPECT_EQ(2, mgr.getLatencyHistogram("pkt6-latency-subnet-selected")->getCount());
+    EXPECT_EQ(2, mgr.getLatencyHistogram("pkt6-latency-leases-allocated")->getCount());
+    EXPECT_EQ(2, mgr.getLatencyHistogram("pkt6-latency-sent")->getCount());
+}
+
 // This test verifies that pkt6-receive-drop is increased properly when the
 // client's packet is rejected due to mismatched server-id value.
 TEST_F(SARRTest, pkt6ReceiveDropStat1) {
@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 62
-#define YY_END_OF_BUFFER 63
+#define YY_NUM_RULES 64
+#define YY_END_OF_BUFFER 65
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,48 +700,52 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[367] =
+static const flex_int16_t yy_accept[400] =
     {   0,
-       55,   55,    0,    0,    0,    0,    0,    0,    0,    0,
-       63,   61,   10,   11,   61,    1,   55,   52,   55,   55,
-       61,   54,   53,   61,   61,   61,   61,   61,   48,   49,
-       61,   61,   61,   50,   51,    5,    5,    5,   61,   61,
-       61,   10,   11,    0,    0,   44,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    1,   55,   55,    0,   54,   55,    3,    2,
-        6,    0,   55,    0,    0,    0,    0,    0,    0,    4,
-        0,    0,    9,    0,   45,    0,    0,    0,    0,   47,
+       57,   57,    0,    0,    0,    0,    0,    0,    0,    0,
+       65,    1,   63,   50,   51,   52,   53,   54,   55,   63,
+       57,   56,   57,   57,   63,   10,   63,   11,   63,   63,
+       63,   63,   63,   63,   63,    5,    5,    5,   11,   10,
+       63,   63,   11,   10,   63,   63,   11,   63,   10,   63,
+       11,    1,    3,    2,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   46,    0,    0,   56,   57,   57,   57,    0,
+       57,   10,    0,    0,   11,    0,    0,    0,    0,    6,
+        4,    0,    0,    9,    2,   49,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    2,    0,    0,    0,    0,    0,
-        0,    0,    8,    0,    0,    0,    0,   46,    0,    0,
-       22,    0,    0,   21,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   60,   58,    0,   57,   56,
+        0,    0,    0,    0,    0,   47,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    8,    0,    0,    0,   48,
+        0,    0,   21,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   22,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       60,   58,    0,    0,   59,   62,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   59,
-       56,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,   26,    0,    0,    0,    0,    0,
-        0,   36,    0,    0,    0,    0,    0,    0,   25,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   19,
-       20,   39,    0,    0,    0,    0,    0,    0,   23,    0,
-        0,    0,    0,    0,    0,    0,    0,    7,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   41,
-       38,    0,    0,    0,    0,   27,    0,    0,    0,   34,
-       12,    0,   14,    0,    0,    0,   32,   35,    0,   40,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   43,    0,    0,    0,
 
+        0,    0,    0,    0,    0,    0,   61,   58,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   26,    0,    0,
+        0,    0,    0,   36,    0,   25,    0,    0,    0,    0,
+        0,    0,   19,   20,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   42,    0,   39,    0,
+        0,    0,    0,   23,    0,    0,    0,    0,    7,    0,
+        0,    0,    0,   27,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   41,    0,   38,    0,
+        0,    0,    0,   32,   35,    0,    0,    0,    0,    0,
+
+        0,   14,    0,   34,   12,    0,    0,    0,    0,   40,
+        0,    0,    0,    0,    0,   45,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   42,    0,
-        0,    0,   33,    0,    0,   30,    0,    0,    0,   15,
-        0,    0,    0,    0,   29,   28,    0,    0,    0,    0,
-        0,    0,    0,    0,   13,    0,    0,    0,    0,    0,
-        0,    0,   24,    0,    0,   37,    0,    0,   31,   18,
-        0,    0,    0,   17,   16,    0
+        0,    0,   44,   33,    0,    0,    0,   30,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   29,   28,    0,
+        0,   15,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   13,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   24,    0,    0,    0,   37,    0,    0,
+        0,   31,   18,    0,    0,   43,   17,   16,    0
+
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -758,8 +762,8 @@ static const YY_CHAR yy_ec[256] =
        32,   33,   34,    5,   35,    5,   36,   37,   38,   39,
 
        40,   41,   42,   43,   44,    5,   45,   46,   47,   48,
-       49,   50,    5,   51,   52,   53,   54,   55,    5,   56,
-       57,   58,   59,    5,   60,    5,    5,    5,    5,    5,
+       49,   50,   51,   52,   53,   54,   55,   56,    5,   57,
+       58,   59,   60,    5,   61,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -776,391 +780,290 @@ static const YY_CHAR yy_ec[256] =
         5,    5,    5,    5,    5
     } ;
 
-static const YY_CHAR yy_meta[61] =
+static const YY_CHAR yy_meta[62] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    5,    6,    6,    6,    6,    3,    3,    3,
-        3,    6,    6,    6,    6,    3,    3,    3,    3,    3,
-        3,    3,    5,    3,    3,    6,    7,    6,    6,    6,
-        7,    3,    3,    3,    3,    3,    3,    5,    3,    3,
-        5,    3,    5,    5,    3,    3,    3,    3,    3,    3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1
     } ;
 
-static const flex_int16_t yy_base[380] =
+static const flex_int16_t yy_base[400] =
     {   0,
-        0,    0,   59,   62,   65,    0,   63,   67,   47,   64,
-      291, 2481,   84,  286,  125,    0,  105, 2481,  120,  125,
-       85,  169, 2481,  262,  139,   65,   69,   82, 2481, 2481,
-       80,   84,  118, 2481, 2481, 2481,   92,  269,  230,    0,
-      256,  110,  270,   97,  186, 2481,  193,  199,  197,  210,
-      219,  234,  255,  263,  269,  278,  284,  291,  297,  303,
-      320,  338,    0,  345,  363,  375,  381,  385, 2481,    0,
-     2481,  332,  349,  121,  144,  128,  152,  171,  160, 2481,
-      222,  248, 2481,  198, 2481,  169,  405,  411,  209,  417,
-      451,  428,  439,  450,  478,  493,  499,  506,  512,  518,
-
-      532,  540,  546,  552,  574,  586,  594,  602,  608,  614,
-      622,  628,  648,  661,    0,  177,  181,  184,  189,  207,
-      204,  130, 2481,    0,  667,  673,  155, 2481,  698,  695,
-     2481,  683,  723, 2481,  739,  748,  756,  762,  768,  776,
-      782,  810,  819,  827,  833,  839,  847,  853,  862,  875,
-      895,  903,  909,  917,  222, 2481, 2481,  223, 2481, 2481,
-      103,    0,  924,  931,  967,  937,  992, 1008,  943, 1014,
-     1020, 1032, 1042, 1049, 1055, 1065, 1071, 1077, 1088, 1099,
-     1110, 1121, 1127, 1134, 1143, 1149, 1155, 1169, 1183, 2481,
-     2481,  104,    0, 1190, 1197, 1232, 1204, 1211, 1218, 1230,
-
-     1259, 1276, 1282, 1288, 2481, 1294, 1300, 1310, 1316, 1322,
-     1328, 2481, 1334, 1351, 1357, 1363, 1369, 1375, 2481, 1391,
-     1397,   64,    0, 1403, 1409, 1437, 1445, 1451, 1459, 2481,
-     2481, 2481, 1470, 1479, 1487, 1499, 1507, 1516, 2481, 1522,
-     1528, 1540, 1557, 1550, 1563, 1569, 1576, 2481, 1583, 1597,
-     1609, 1618, 1625, 1631, 1637, 1643, 1651, 1660, 1666, 2481,
-     2481, 1672, 1686, 1694, 1700, 2481, 1706, 1712, 1722, 2481,
-     2481, 1728, 2481, 1734, 1767, 1773, 2481, 2481, 1779, 2481,
-     1786, 1792, 1802, 1812, 1820, 1827, 1836, 1848, 1855, 1861,
-     1869, 1883, 1889, 1897, 1903, 1909, 2481, 1918, 1925, 1943,
-
-     1951, 1965, 1971, 1977, 1985, 1991, 2000, 2010, 2019, 2025,
-     2036, 2044, 2053, 2064, 2072, 2079, 2086, 2092, 2481, 2098,
-     2105, 2112, 2481, 2133, 2140, 2481, 2149, 2156, 2162, 2481,
-     2168, 2174, 2182, 2210, 2481, 2481, 2218, 2224, 2230, 2236,
-     2243, 2258, 2264, 2271, 2481, 2278, 2284, 2292, 2299, 2312,
-     2320, 2327, 2481, 2333, 2340, 2481, 2346, 2355, 2481, 2481,
-     2362, 2368, 2375, 2481, 2481, 2481, 2414, 2421, 2428, 2435,
-     2442, 2449, 2456, 2460, 2465, 2467, 2469, 2471, 2473
+        1,    1,   63,    1,  125,    1,  187,    1,  249,    1,
+        1,  621,  971,  624,    1,    1,    1,    1,    1,  311,
+      858,    1,  862,  871,  914,  806,  904,  683,  921,  985,
+      757,  870,  898,    1,  990,    1,    1, 1026,    1,    1,
+        1, 1046,    1,    1,    1,  745,    1, 1096,    1,    1,
+        1,    1,    1,  683,  373,  854,  911,  936, 1068,  937,
+      939,  992,  856,  990, 1019, 1024,  958,  938, 1055, 1029,
+      960, 1057,    1,  435,    1,    1,    1,    1,    1,  990,
+        1,    1, 1054, 1430,    1,  983, 1440, 1072, 1443,    1,
+        1, 1452, 1485,    1,    1, 1455, 1456,  497,  807,  711,
+
+     1081, 1080,  887, 1084,  865,  906, 1027, 1088, 1089,  868,
+     1093, 1090, 1091,  970, 1066, 1094, 1096, 1091,  987, 1017,
+     1097, 1098, 1097, 1457, 1102,    1,    1, 1059, 1115, 1458,
+     1114, 1446, 1125, 1455, 1456,    1,  897,    1,    1,    1,
+     1107, 1113,    1, 1114, 1116, 1121, 1115, 1463, 1120, 1125,
+     1128, 1129,    1, 1132, 1138, 1137, 1139, 1141, 1140, 1142,
+     1148, 1002, 1464, 1465, 1146, 1149, 1151, 1148,    1,  925,
+        1,    1, 1171, 1466,    1,    1, 1452,  953, 1158,  998,
+     1165, 1468, 1162, 1159, 1164, 1170, 1469, 1471, 1167, 1168,
+     1169, 1182, 1204, 1181, 1217, 1185, 1186, 1183, 1474, 1189,
+
+     1224, 1191, 1227, 1223, 1197,  981,    1,    1, 1476, 1009,
+     1199, 1234, 1235, 1202, 1203, 1479, 1207, 1204, 1210, 1211,
+     1212, 1222, 1228, 1229,  878, 1218, 1243,    1, 1245, 1480,
+     1219, 1230, 1266,    1, 1239,    1, 1246, 1251, 1037, 1481,
+     1482, 1483,    1,    1, 1240, 1241, 1248, 1283, 1250, 1248,
+     1284, 1256, 1259, 1261, 1267, 1260,    1, 1269,    1, 1272,
+     1274, 1484, 1309,    1, 1031, 1272, 1277, 1065,    1, 1280,
+     1316, 1319, 1485,    1, 1286, 1290,  904, 1322, 1318, 1326,
+     1327, 1295, 1298, 1290, 1329, 1335,    1, 1298,    1, 1303,
+     1486,    1, 1487,    1,    1, 1305, 1340, 1488, 1312, 1313,
+
+     1320,    1, 1315,    1,    1, 1489, 1325, 1333, 1323,    1,
+     1314, 1334, 1366, 1338, 1339,    1, 1370, 1342, 1343, 1345,
+     1346, 1346, 1354, 1347, 1490, 1357, 1491, 1358, 1394, 1396,
+     1365, 1492, 1493, 1398, 1369, 1494, 1495, 1376, 1373, 1370,
+     1375, 1377,    1,    1, 1378, 1416, 1417,    1, 1384, 1415,
+     1421, 1388, 1390, 1393, 1391, 1399, 1407,    1,    1, 1496,
+     1401,    1, 1400, 1497, 1410, 1427, 1411, 1412, 1408, 1419,
+     1498, 1413, 1424,    1, 1429, 1430, 1460, 1433, 1434, 1435,
+     1470, 1499, 1500,    1, 1501, 1472, 1473,    1, 1440, 1441,
+     1476,    1,    1, 1477, 1478,    1,    1,    1,  559
+
     } ;
 
-static const flex_int16_t yy_def[380] =
+static const flex_int16_t yy_def[400] =
     {   0,
-      366,    1,  367,  367,    1,    5,    5,    5,    5,    5,
-      366,  366,  366,  366,  368,  369,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  370,
-      366,  366,  366,  371,  368,  366,  368,  368,  372,  368,
-      368,  368,  368,  368,  368,  368,  368,  368,  368,  368,
-      368,  368,  369,  366,  366,  366,  366,  366,  366,  373,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  370,  366,  371,  366,  374,  368,  368,  375,  368,
-      372,  368,  368,  368,  368,  368,  368,  368,  368,  368,
-
-      368,  368,  368,  368,  368,  368,  368,  368,  368,  368,
-      368,  368,  368,  368,  373,  366,  366,  366,  366,  366,
-      366,  366,  366,  376,  368,  368,  375,  366,  372,  368,
-      366,  368,  368,  366,  368,  368,  368,  368,  368,  368,
-      368,  368,  368,  368,  368,  368,  368,  368,  368,  368,
-      368,  368,  368,  368,  366,  366,  366,  366,  366,  366,
-      366,  377,  368,  368,  372,  368,  368,  368,  368,  368,
-      368,  368,  368,  368,  368,  368,  368,  368,  368,  368,
-      368,  368,  368,  368,  368,  368,  368,  368,  368,  366,
-      366,  366,  378,  368,  368,  372,  368,  368,  368,  368,
-
-      368,  368,  368,  368,  366,  368,  368,  368,  368,  368,
-      368,  366,  368,  368,  368,  368,  368,  368,  366,  368,
-      368,  366,  379,  368,  368,  368,  368,  368,  368,  366,
-      366,  366,  368,  368,  368,  368,  368,  368,  366,  368,
-      368,  368,  368,  368,  368,  368,  368,  366,  368,  368,
-      368,  368,  368,  368,  368,  368,  368,  368,  368,  366,
-      366,  368,  368,  368,  368,  366,  368,  368,  368,  366,
-      366,  368,  366,  368,  368,  368,  366,  366,  368,  366,
-      368,  368,  368,  368,  368,  368,  368,  368,  368,  368,
-      368,  368,  368,  368,  368,  368,  366,  368,  368,  368,
-
-      368,  368,  368,  368,  368,  368,  368,  368,  368,  368,
-      368,  368,  368,  368,  368,  368,  368,  368,  366,  368,
-      368,  368,  366,  368,  368,  366,  368,  368,  368,  366,
-      368,  368,  368,  368,  366,  366,  368,  368,  368,  368,
-      368,  368,  368,  368,  366,  368,  368,  368,  368,  368,
-      368,  368,  366,  368,  368,  366,  368,  368,  366,  366,
-      368,  368,  368,  366,  366,    0,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366
+      399,    1,  399,    3,  399,    5,  399,    7,  399,    9,
+      399,  399,  399,  399,   14,   14,   14,   14,   14,  399,
+       14,   21,   21,   21,   14,   14,   14,   14,   14,   14,
+       27,   29,   30,   14,   14,   26,   14,   14,   28,   26,
+       14,   14,   28,   26,   14,  399,   28,   14,   26,   14,
+       28,   12,   14,  399,  399,   20,   56,   57,   57,   57,
+       57,   57,   56,   63,   57,   63,   57,   57,   63,   63,
+       63,   63,   14,  399,   25,   21,   24,   23,   24,   25,
+       80,   26,   14,   83,   28,   14,   86,   14,   88,   14,
+       14,   14,   46,   14,   54,   63,   63,  399,  399,   63,
+
+       63,   63,   63,   63,   63,   63,   63,   63,   63,   63,
+       63,   63,   63,   63,   57,   63,   63,   57,   63,   63,
+       63,   63,   57,   63,   63,   14,   74,   14,   14,  129,
+       14,  131,   14,  133,   14,   14,   98,   99,   99,   14,
+       63,   63,   14,   63,   63,   63,   57,   63,   63,   63,
+       63,   63,   14,   63,   63,   63,   63,   63,   63,   63,
+       63,   63,   63,   63,   63,   63,   63,   57,   74,   14,
+       14,   14,   14,  173,   14,   14,   14,   98,   63,   63,
+       63,   63,   63,   63,   63,   63,   63,   63,   63,   57,
+       57,   63,   63,   63,   63,   63,   63,   57,   63,   63,
+
+       63,   63,   63,   63,   63,   14,   14,   14,   14,   98,
+       63,   63,   63,   63,   63,   63,   63,   57,   63,   63,
+       63,   57,   63,   63,   63,   63,   63,   14,   63,   63,
+       63,   63,   63,   14,   63,   14,   63,   63,   14,   14,
+       63,   63,   14,   14,   63,   63,   63,   63,   63,   57,
+       63,   63,   63,   63,   63,   63,   14,   63,   14,   63,
+       63,   63,   63,   14,   63,   57,   63,   14,   14,   63,
+       63,   63,   63,   14,   63,   63,   63,   63,   63,   63,
+       63,   63,   63,   57,   63,   63,   14,   57,   14,   63,
+       63,   74,   63,   14,   14,   63,   63,   63,   63,   63,
+
+       63,   14,   63,   14,   14,   63,   63,   63,   63,   14,
+       63,   63,   63,   63,   63,   14,   63,   63,   63,   63,
+       57,   63,   63,   63,   63,   63,   63,   63,   63,   63,
+       63,   63,   63,   63,   63,   63,   63,   63,   63,   57,
+       63,   63,   14,   14,   63,   63,   63,   14,   63,   63,
+       63,   63,   63,   57,   63,   63,   63,   14,   14,   63,
+       63,   14,   57,   63,   63,   63,   63,   63,   63,   57,
+       63,   63,   63,   14,   63,   63,   63,   63,   63,   63,
+       63,   63,   63,   14,   63,   63,   63,   14,   63,   63,
+       63,   14,   14,   63,   63,   14,   14,   14,    0
+
     } ;
 
-static const flex_int16_t yy_nxt[2542] =
+static const flex_int16_t yy_nxt[1563] =
     {   0,
-       12,   13,   14,   13,   12,   15,   16,   12,   17,   18,
-       19,   20,   21,   22,   22,   22,   22,   23,   24,   12,
-       12,   12,   12,   25,   26,   12,   27,   12,   12,   28,
-       12,   29,   12,   30,   12,   12,   12,   12,   12,   25,
-       31,   12,   12,   12,   12,   12,   12,   32,   12,   12,
-       12,   12,   33,   12,   12,   12,   12,   12,   34,   35,
-       37,   14,   37,   37,   14,   37,   38,   41,   40,   38,
-       12,   12,   40,   12,   12,   12,   12,   12,   12,   12,
-       12,   12,   12,   12,   41,   42,   74,   42,   12,   12,
-       12,   12,   69,   42,   12,   42,   12,   70,   12,   75,
-
-       74,   74,   85,  248,   12,   12,   12,   12,   39,   76,
-       12,   42,   12,   42,   75,   77,   64,   12,   65,   65,
-       65,   65,   75,   12,   12,   44,   44,   44,   66,   86,
-       46,   64,   76,   67,   67,   67,   67,   78,   68,   68,
-       68,   68,  222,   66,   66,   76,  116,   72,   66,   72,
-       47,   48,   73,   73,   73,   73,  192,   49,  118,   66,
-      128,   50,   51,   52,   66,   53,  116,   54,   79,  117,
-       55,   56,   57,   58,   59,  161,   60,  116,   61,   62,
-       64,  118,   67,   67,   67,   67,   44,   44,   44,  117,
-      118,   46,   66,   44,   44,   44,  117,  119,   46,   44,
-
-       44,   44,   90,   85,   46,  155,  156,  157,   66,   45,
-       44,   44,   44,  121,  128,   46,  120,  155,   49,   44,
-       44,   44,  124,  157,   46,   49,  156,  157,  155,   45,
-       86,   49,  156,   45,   44,   44,   44,   45,   88,   46,
-      158,   87,   49,  160,   45,  190,  190,   45,   95,   45,
-       91,   49,  159,  123,   93,   44,   44,   44,   92,  122,
-       46,  190,  191,   44,   44,   44,   49,   94,   46,   44,
-       44,   44,   43,   96,   46,   83,   97,   81,   44,   44,
-       44,   80,   71,   46,   44,   44,   44,   49,   43,   46,
-      366,   44,   44,   44,  366,   49,   46,   44,   44,   44,
-
-       98,   49,   46,   44,   44,   44,  366,  366,   46,  366,
-       49,   99,  101,  103,  366,  100,   49,  102,  366,  105,
-       44,   44,   44,   49,  366,   46,  104,  366,  366,   49,
-      366,  366,  107,  366,  366,   49,  366,  366,   44,   44,
-       44,  366,  108,   46,  106,   73,   73,   73,   73,  366,
-      366,  109,   49,  366,  366,  110,  111,  366,   68,   68,
-       68,   68,   73,   73,   73,   73,  366,  112,   66,  366,
-       49,  113,  366,  114,   64,  366,   65,   65,   65,   65,
-      366,  366,  366,   72,   66,   72,   66,  366,   73,   73,
-       73,   73,   64,  366,   67,   67,   67,   67,   68,   68,
-
-       68,   68,   66,  366,   66,   44,   44,   44,   66,  366,
-       46,   44,   44,   44,  366,  366,   46,   44,   44,   44,
-       66,  366,   46,  366,   66,  366,  366,  366,   44,   44,
-       44,  366,  366,   46,  366,  366,  366,   49,  366,   44,
-       44,   44,  366,   49,  131,  366,  125,  366,  366,   49,
-       44,   44,   44,  366,  366,   46,  366,  366,  366,  366,
-       49,  366,  366,  126,  129,  129,  129,  129,  366,  366,
-      366,   49,  129,  129,  129,  129,  130,  366,   44,   44,
-       44,  366,   49,  134,  366,  366,  129,  129,  129,  129,
-      129,  129,  366,   44,   44,   44,  132,  133,   46,   44,
-
-       44,   44,  366,  366,   46,  366,   44,   44,   44,  366,
-       49,   46,   44,   44,   44,  366,  366,   46,   44,   44,
-       44,  366,  366,   46,  366,   49,  366,  366,  366,  135,
-      366,   49,   44,   44,   44,  366,  136,   46,   49,  366,
-       44,   44,   44,  366,   49,   46,   44,   44,   44,  366,
-       49,   46,   44,   44,   44,  366,  366,   46,  366,  137,
-      138,  366,  366,  366,   49,  366,  366,  366,  140,  366,
-      139,  366,   49,  366,   44,   44,   44,  366,   49,   46,
-      366,  141,  366,  366,   49,  366,   44,   44,   44,  366,
-      144,   46,  366,  142,   44,   44,   44,  366,  366,   46,
-
-      366,  143,   44,   44,   44,  366,   49,   46,   44,   44,
-       44,  366,  366,   46,   44,   44,   44,  366,   49,   46,
-      145,  366,   44,   44,   44,  366,   49,   46,   44,   44,
-       44,  366,  366,   46,   49,  366,  366,  366,  146,  366,
-       49,  366,  366,  366,  147,  149,   49,  366,   44,   44,
-       44,  366,  150,   46,   49,  366,  148,  366,  151,  366,
-       49,   44,   44,   44,  366,  366,   46,   44,   44,   44,
-      366,  152,   46,   44,   44,   44,  366,  366,   46,  366,
-       49,  366,  366,   44,   44,   44,  366,  153,   46,  366,
-      366,  366,  366,   49,  366,   44,   44,   44,  366,   49,
-
-       46,  366,  366,  366,  366,   49,  154,  366,  163,  366,
-      164,  165,  165,  165,  165,   49,  366,  366,  366,  165,
-      165,  165,  165,   44,   44,   44,  366,   49,   46,  167,
-      366,  366,  366,  165,  165,  165,  165,  165,  165,   44,
-       44,   44,  366,  366,   46,  366,  366,  166,   44,   44,
-       44,  366,  366,   46,  366,   49,   44,   44,   44,  366,
-      366,   46,   44,   44,   44,  366,  366,   46,   44,   44,
-       44,   49,  366,   46,  366,  168,   44,   44,   44,  366,
-       49,   46,   44,   44,   44,  366,  366,   46,   49,  366,
-      366,  366,  169,  366,   49,  366,  366,  170,  366,  366,
-
-       49,  366,  366,  366,  366,  366,  172,  171,   49,  366,
-       44,   44,   44,  366,   49,   46,  366,  173,  366,   44,
-       44,   44,  366,  175,   46,  366,  174,   44,   44,   44,
-      366,  366,   46,   44,   44,   44,  366,  366,   46,   44,
-       44,   44,   49,  366,   46,  176,  366,   44,   44,   44,
-      366,   49,   46,   44,   44,   44,  366,  366,   46,   49,
-      366,  366,   44,   44,   44,   49,  179,   46,  366,  366,
-      177,   49,  180,  178,  366,   44,   44,   44,  366,   49,
-       46,  366,  182,  366,  366,   49,  366,  366,  181,  366,
-      366,  366,  183,  366,   49,   44,   44,   44,  366,  366,
-
-       46,  366,  366,   44,   44,   44,  184,   49,   46,   44,
-       44,   44,  366,  366,   46,  366,  366,   44,   44,   44,
-      366,  366,   46,  185,   44,   44,   44,   49,  366,   46,
-      366,   44,   44,   44,  366,   49,   46,   44,   44,   44,
-      366,   49,   46,   44,   44,   44,  186,  197,   46,   49,
-      366,  366,  366,  366,  366,  366,   49,  366,  187,  188,
-      189,  366,  366,   49,  366,  366,  366,  194,  366,   49,
-      366,  366,  366,  366,  366,   49,  366,  366,  366,  195,
-      196,  196,  196,  196,  200,  366,  366,  366,  196,  196,
-      196,  196,   44,   44,   44,  366,  366,   46,  366,  366,
-
-      366,  366,  196,  196,  196,  196,  196,  196,   44,   44,
-       44,  366,  366,   46,   44,   44,   44,  366,  366,   46,
-       44,   44,   44,  366,   49,   46,  366,  366,  366,  201,
-      202,  198,   44,   44,   44,  366,  366,   46,  366,  366,
-       49,  366,   44,   44,   44,  366,   49,  205,  366,   44,
-       44,   44,   49,  366,   46,   44,   44,   44,  199,  366,
-       46,  366,  203,  366,   49,   44,   44,   44,  366,  366,
-       46,   44,   44,   44,   49,  366,   46,   44,   44,   44,
-      366,   49,   46,  204,  206,  366,  366,   49,   44,   44,
-       44,  366,  366,   46,  207,  366,  366,   49,  366,   44,
-
-       44,   44,  366,   49,  212,  366,  208,  366,  366,   49,
-       44,   44,   44,  366,  209,   46,  210,  366,  366,  366,
-       49,   44,   44,   44,  366,  366,   46,   44,   44,   44,
-      366,   49,   46,  211,   44,   44,   44,  366,  366,   46,
-      366,  366,   49,   44,   44,   44,  366,  366,   46,   44,
-       44,   44,  366,   49,   46,   44,   44,   44,  366,   49,
-      219,  366,  366,  213,  366,  366,   49,  214,  366,   44,
-       44,   44,  366,  216,   46,   49,  366,  215,  366,  220,
-      366,   49,  366,   44,   44,   44,  218,   49,   46,  366,
-       44,   44,   44,  366,  366,   46,  217,   44,   44,   44,
-
-      366,   49,   46,  366,   44,   44,   44,  366,  366,   46,
-      366,   44,   44,   44,  366,   49,   46,  366,   44,   44,
-       44,  221,   49,   46,  366,  366,  366,  366,  366,   49,
-       44,   44,   44,  366,  366,   46,   49,  224,  366,  366,
-      366,  366,  366,   49,  225,   45,   45,   45,   45,  366,
-       49,  366,  366,   45,   45,   45,   45,  226,  227,   44,
-       44,   44,   49,  366,  230,  366,  228,   45,   45,   45,
-       45,   45,   45,  366,  366,  229,   44,   44,   44,  366,
-      366,  231,   44,   44,   44,  366,  366,  232,   44,   44,
-       44,   49,  366,   46,   44,   44,   44,  366,  233,   46,
-
-       44,   44,   44,  366,  366,   46,  366,  366,   49,  366,
-       44,   44,   44,  366,   49,   46,   44,   44,   44,  366,
-       49,   46,   44,   44,   44,  366,   49,   46,   44,   44,
-       44,  366,   49,  239,   44,   44,   44,  366,  366,   46,
-      366,  366,   49,  366,  234,  366,  366,  366,   49,  236,
-      235,   44,   44,   44,   49,  366,   46,   44,   44,   44,
-       49,  366,   46,   44,   44,   44,   49,  366,   46,   44,
-       44,   44,  238,  237,   46,   44,   44,   44,  366,  366,
-       46,  366,  366,   49,  366,  366,  240,  366,  366,   49,
-      241,   44,   44,   44,  366,   49,   46,   44,   44,   44,
-
-      242,   49,   46,   44,   44,   44,  366,   49,   46,   44,
-       44,   44,  366,  366,   46,  243,  366,  366,  366,  366,
-      366,  244,  366,   49,  366,  245,  366,  366,  246,   49,
-      366,  366,  247,  366,  366,   49,  366,   44,   44,   44,
-      366,   49,   46,  366,  249,   44,   44,   44,  366,  250,
-       46,   44,   44,   44,  366,  366,   46,  366,  366,   44,
-       44,   44,  366,  366,   46,  366,  366,  366,  366,   49,
-       44,   44,   44,  366,  366,   46,  366,   49,  366,   44,
-       44,   44,  366,   49,   46,  366,  251,   44,   44,   44,
-      366,   49,   46,  366,  366,  366,  253,  252,  254,   44,
-
-       44,   44,   49,  366,   46,  366,  366,   44,   44,   44,
-      366,   49,   46,  366,  366,  255,   44,   44,   44,   49,
-      366,  260,   44,   44,   44,  366,  366,  261,   44,   44,
-       44,   49,  366,   46,  366,  256,  366,  258,  257,   49,
-       44,   44,   44,  366,  366,   46,  259,  366,   49,  366,
-       44,   44,   44,  366,   49,  266,  262,   44,   44,   44,
-       49,  366,   46,   44,   44,   44,  366,  265,   46,   44,
-       44,   44,   49,  366,   46,  366,   44,   44,   44,  366,
-      263,   46,   49,   44,   44,   44,  366,  366,  270,   49,
-      366,  366,  264,  366,  366,   49,  366,   44,   44,   44,
-
-      366,   49,  271,  366,  366,  366,  267,  366,   49,   44,
-       44,   44,  366,  366,   46,   49,  366,  268,   44,   44,
-       44,  366,  366,  273,  366,   44,   44,   44,  269,   49,
-       46,   44,   44,   44,  366,  274,   46,   44,   44,   44,
-      366,   49,   46,   44,   44,   44,  366,  272,  277,  366,
-       49,   44,   44,   44,  366,  366,  278,   49,  366,  366,
-       44,   44,   44,   49,  366,   46,   44,   44,   44,   49,
-      279,  280,   44,   44,   44,   49,  366,   46,  366,  366,
-      276,  366,  366,   49,  366,  275,   44,   44,   44,  366,
-      366,   46,   49,  366,   44,   44,   44,  366,   49,   46,
-
-       44,   44,   44,  366,   49,   46,   44,   44,   44,  366,
-      366,   46,   44,   44,   44,  366,  366,   46,   49,  366,
-      281,  366,   44,   44,   44,  282,   49,   46,   44,   44,
-       44,  366,   49,   46,   44,   44,   44,  366,   49,   46,
-      366,  366,  287,  366,   49,  366,  366,  284,  366,  366,
-      283,  366,  285,  286,   49,  366,  366,  366,  366,  288,
-       49,  289,  366,  290,  366,  366,   49,   44,   44,   44,
-      366,  366,   46,   44,   44,   44,  366,  366,   46,   44,
-       44,   44,  366,  366,   46,  291,   44,   44,   44,  366,
-      366,   46,   44,   44,   44,  366,  366,   46,  366,   49,
-
-      366,  366,   44,   44,   44,   49,  292,  297,  366,  293,
-      366,   49,   44,   44,   44,  366,  366,   46,   49,  366,
-       44,   44,   44,  366,   49,   46,  366,   44,   44,   44,
-      294,  366,   46,  366,   49,  295,   44,   44,   44,  366,
-      366,   46,  296,  366,   49,  366,  366,  298,   44,   44,
-       44,  366,   49,   46,  366,   44,   44,   44,  366,   49,
-       46,   44,   44,   44,  366,  303,   46,  366,   49,   44,
-       44,   44,  366,  366,   46,  301,  299,  300,  366,  366,
-       49,  366,  366,   44,   44,   44,  366,   49,   46,   44,
-       44,   44,  366,   49,   46,  366,  366,   44,   44,   44,
-
-      302,   49,   46,   44,   44,   44,  366,  366,   46,   44,
-       44,   44,  366,  304,   46,   49,  366,  305,   44,   44,
-       44,   49,  366,   46,  366,   44,   44,   44,  306,   49,
-       46,  366,  366,  366,  366,   49,  308,  366,  366,  307,
-      366,   49,  366,   44,   44,   44,  366,  366,   46,  366,
-       49,   44,   44,   44,  366,  309,   46,   49,  366,  366,
-      310,  314,  366,  366,  311,   44,   44,   44,  366,  366,
-       46,   44,   44,   44,  312,   49,   46,   44,   44,   44,
-      366,  366,   46,   49,  366,   44,   44,   44,  313,  366,
-       46,   44,   44,   44,  366,  366,  319,   49,  366,  366,
-
-       44,   44,   44,   49,  315,   46,  366,  366,  316,   49,
-       44,   44,   44,  366,  366,   46,  317,   49,  366,   44,
-       44,   44,  318,   49,   46,   44,   44,   44,  366,  366,
-      323,  366,   49,  366,  366,  320,   44,   44,   44,  366,
-      366,   46,   49,  366,   44,   44,   44,  366,  366,   46,
-      366,   49,  366,   44,   44,   44,  366,   49,  326,  366,
-      321,  366,  322,  366,   44,   44,   44,  366,   49,   46,
-      366,  366,   44,   44,   44,  324,   49,   46,  366,   44,
-       44,   44,  366,  325,   46,   49,   44,   44,   44,  366,
-      366,  330,   44,   44,   44,  366,   49,   46,   44,   44,
-
-       44,  327,  366,   46,   49,   44,   44,   44,  366,  366,
-       46,   49,   44,   44,   44,  366,  366,   46,   49,  366,
-      366,  329,  366,  366,   49,  366,  366,  328,  366,  366,
-       49,  366,  366,   44,   44,   44,  331,   49,  335,  366,
-       44,   44,   44,  366,   49,  336,  366,  366,  332,   44,
-       44,   44,  366,  366,   46,  366,   44,   44,   44,  333,
-      334,   46,   44,   44,   44,   49,  366,   46,   44,   44,
-       44,  366,   49,   46,   44,   44,   44,  366,  366,   46,
-      366,   49,   44,   44,   44,  366,  366,   46,   49,  366,
-      366,  337,  366,  366,   49,  366,  366,  339,  366,  366,
-
-       49,  366,  366,  366,  366,  366,   49,  340,  338,  366,
-       44,   44,   44,  366,   49,   46,  366,  341,   44,   44,
-       44,  342,  366,   46,   44,   44,   44,  366,  366,  345,
-       44,   44,   44,  366,  366,   46,   44,   44,   44,  366,
-      366,   46,   49,   44,   44,   44,  366,  366,   46,  366,
-       49,  366,  366,  344,  366,  366,   49,  343,   44,   44,
-       44,  366,   49,   46,   44,   44,   44,  366,   49,   46,
-      366,   44,   44,   44,  366,   49,   46,  346,   44,   44,
-       44,  366,  348,   46,   44,   44,   44,  366,  347,  353,
-       49,  366,   44,   44,   44,  366,   49,   46,  366,   44,
-
-       44,   44,  366,   49,   46,  366,  366,  366,  349,  366,
-       49,  366,   44,   44,   44,  350,   49,  356,  351,  352,
-       44,   44,   44,  366,   49,   46,  366,   44,   44,   44,
-      366,   49,   46,   44,   44,   44,  366,  366,  359,  366,
-       44,   44,   44,  354,   49,  360,   44,   44,   44,  366,
-      355,   46,   49,  366,  366,   44,   44,   44,  366,   49,
-       46,  357,   44,   44,   44,   49,  358,   46,   44,   44,
-       44,  366,   49,  364,  366,   44,   44,   44,   49,  366,
-      365,  366,  366,  366,  366,  361,  366,   49,  366,  366,
-      366,  366,  366,  366,   49,  366,  366,  366,  366,  366,
-
-       49,  366,  366,  366,  366,  366,  362,   49,  366,  366,
-      366,  366,  366,  363,   36,   36,   36,   36,   36,   36,
-       36,   45,   45,   45,   45,   45,   45,   45,   63,  366,
-       63,   63,   63,   63,   63,   82,  366,   82,  366,   82,
-       82,   82,   84,   84,   84,   84,   84,   84,   84,   89,
-       89,   89,   89,   89,   89,   89,  115,  366,  115,  115,
-      115,  115,  115,   84,   84,  366,   84,  127,  127,  127,
-      127,  127,  162,  162,  193,  193,  223,  223,   84,   84,
-       11,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366
+       11,   34,   26,   28,   26,   34,   20,   12,   34,   23,
+       18,   21,   24,   13,   22,   22,   22,   22,   19,   35,
+       34,   34,   34,   34,   25,   32,   34,   33,   34,   34,
+       31,   34,   14,   34,   15,   34,   34,   34,   34,   34,
+       25,   29,   34,   34,   34,   34,   34,   34,   30,   34,
+       34,   34,   34,   34,   27,   34,   34,   34,   34,   34,
+       16,   17,   11,   37,   36,   39,   36,   37,   37,   37,
+       38,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   11,   41,   40,   43,   40,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   42,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   11,   45,   44,   47,
+       44,   45,   46,   45,   45,   45,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   11,   50,
+       49,   51,   49,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   48,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       11,   74,   74,   74,   62,   62,   73,   62,   62,   62,
+       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+       62,   62,   62,   62,   62,   62,   61,   63,   62,   62,
+       62,   62,   62,   55,   62,   62,   64,   65,   60,   56,
+       62,   66,   62,   67,   62,   62,   57,   68,   69,   70,
+       58,   62,   62,   59,   62,   71,   72,   62,   62,   62,
+       62,   62,   11,   99,   99,   99,   99,   99,   96,   99,
+       99,   99,   99,   99,   99,   97,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+
+       99,   99,   99,   99,   99,   97,   99,   99,   99,   97,
+       99,   99,   99,   97,   99,   99,   99,   99,   99,   99,
+       97,   99,   99,   99,   97,   99,   97,   98,   99,   99,
+       99,   99,   99,   99,   11,  127,  127,  127,  127,  127,
+      126,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  128,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,   11,  138,  138,  138,
+
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+      137,  137,  137,  137,  138,  138,  138,  138,  137,  137,
+      137,  137,  138,  138,  138,  138,  138,  138,  138,  138,
+      138,  138,  137,  137,  137,  137,  137,  137,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  138,  399,  399,
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+       11,   52,   52,   11,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   11,   95,   95,   85,   95,   95,   95,   95,
+       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+
+       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+       95,   95,   95,   95,   11,   93,   93,  141,   93,   93,
+       62,   93,   93,   93,   93,   93,   93,   93,   93,   93,
+       93,   93,   93,   93,   93,   93,   93,   93,   93,   93,
+       93,   93,   93,   93,   93,   93,   93,   93,   93,   93,
+       93,   93,   93,   93,   93,   93,   93,   93,   93,   93,
+       93,   93,   93,   93,   93,   93,   93,   93,   93,   93,
+
+       93,   93,   93,   93,   93,   93,   11,   82,   83,   82,
+      139,  139,  140,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  102,   77,
+       62,   76,   76,   76,   76,   78,   78,   78,   78,   62,
+       62,   75,  399,  257,   79,   79,   79,   79,  256,   62,
+       62,   62,   62,  100,   62,  113,  101,   75,   62,   62,
+
+       62,   62,   62,   62,   62,   87,   62,   62,   62,   62,
+      178,  178,  178,  178,  151,  152,  146,   62,  178,  178,
+      178,  178,   80,  144,   80,   62,   62,   81,   81,   81,
+       81,   83,  178,  178,  178,  178,  178,  178,  206,  206,
+      206,  206,   87,   62,  147,   62,  206,  206,  206,  206,
+       62,  299,   89,   62,  103,   84,   86,  300,  301,  104,
+      206,  206,  206,  206,  206,  206,  210,  210,  210,  210,
+       11,  105,  111,  119,  210,  210,  210,  210,   53,   62,
+       62,   62,   62,   54,   62,  110,  120,  112,  210,  210,
+      210,  210,  210,  210,  239,  239,  239,  239,  399,   62,
+
+      399,   62,  239,  239,  239,  239,  118,  123,  131,   62,
+       90,  117,  124,  212,  213,   89,  239,  239,  239,  239,
+      239,  239,  241,  241,  241,  241,   62,  156,  132,   62,
+      241,  241,  241,  241,  161,   62,  289,   62,   91,   88,
+       62,   62,  114,  162,  241,  241,  241,  241,  241,  241,
+      268,  268,  268,  268,  198,  163,   62,  199,  268,  268,
+      268,  268,   62,   62,  169,  288,   62,  115,   62,  116,
+       62,  169,  268,  268,  268,  268,  268,  268,  292,  292,
+      292,  292,  148,  122,  129,  143,  292,  292,  292,  292,
+      121,  169,  125,   92,   62,  169,   62,  134,  153,  169,
+
+      292,  292,  292,  292,  292,  292,  169,  107,  129,   62,
+      169,   62,  169,  170,  157,   94,  109,  133,  142,   62,
+       62,  106,  108,   62,  149,  145,  150,   62,   62,   62,
+       62,  154,   62,   62,   62,   62,   62,   62,  171,  160,
+      166,   62,  173,  164,  155,   62,   62,  168,  158,  159,
+      176,  165,   62,   62,  171,   62,  183,  182,   62,   62,
+       62,  179,  180,  184,   62,  181,  173,   62,   62,  187,
+      175,   62,  186,  190,  188,  191,   62,   62,   62,   62,
+       62,   62,  189,  197,  192,   62,  196,   62,   62,  195,
+       62,  205,  193,  194,  207,  202,   62,   62,   62,  211,
+
+      214,   62,  204,   62,   62,  203,   62,  219,  216,   62,
+      207,  223,   62,  217,  226,  218,   62,  224,  222,  225,
+       62,   62,  228,  227,   62,   62,  231,  230,   62,  234,
+       62,   62,  236,  237,  233,  238,   62,  229,   62,  243,
+      244,   62,   62,   62,  242,  235,   62,  249,  259,   62,
+       62,   62,   62,  245,  246,  260,   62,   62,   62,  252,
+      248,  250,   62,   62,  251,   62,   62,   62,   62,   62,
+      253,  264,  258,   62,   62,  254,  255,  262,   62,   62,
+       62,  263,   62,  266,   62,   62,  267,   62,  274,   62,
+       62,  276,  265,  272,  277,   62,   62,  271,   62,   62,
+
+       62,  273,  280,  275,  279,   62,   62,  281,   62,  278,
+      282,   62,  285,   62,  287,   62,   62,  284,  283,   62,
+      290,  294,   62,   62,  295,   62,  298,  302,  303,   62,
+      291,  304,  305,  308,   62,  293,  307,   62,   62,  309,
+      310,   62,   62,  297,   62,  316,  311,  318,   62,  306,
+      312,   62,   62,   62,   62,   62,  315,   62,   62,   62,
+      323,   62,   62,  326,   62,   62,   62,  321,   62,  324,
+      319,  320,   62,   62,   62,  325,  328,   62,   62,   62,
+      331,   62,   62,  329,   62,   62,   62,  327,  332,   62,
+      334,  330,  333,   62,  335,  342,   62,   62,  338,  343,
+
+      336,  344,  345,  348,   62,   62,  349,  337,   62,   62,
+      340,  352,   62,  354,   62,   62,   62,   62,   62,  356,
+      357,  358,  359,   62,  353,  361,  362,   62,  360,   62,
+       62,  355,  374,   62,  367,   62,   62,   62,   62,  363,
+       62,  365,  368,  371,  366,  364,   62,   62,   62,   62,
+       62,   62,   62,  370,   62,   62,   62,  373,  375,  376,
+       62,  377,  378,   62,  380,  384,   62,   62,   62,   62,
+      382,  383,   62,   62,   62,  388,  381,  392,  393,   62,
+       62,  396,  397,  398,  130,  131,  386,  387,  134,  135,
+      136,  385,  394,  395,   62,   62,  167,  172,  174,   62,
+
+      176,  177,  185,  200,  201,  208,  209,  215,  220,   62,
+      221,   62,   62,  232,  240,   62,   62,   62,  247,  261,
+      269,   62,  270,  286,  296,  313,  314,  317,  322,  339,
+      341,  346,  347,  350,  351,  369,  372,  379,  389,  390,
+      391,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0
     } ;
 
-static const flex_int16_t yy_chk[2542] =
+static const flex_int16_t yy_chk[1563] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -1168,280 +1071,172 @@ static const flex_int16_t yy_chk[2542] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        3,    3,    3,    4,    4,    4,    3,    9,    7,    4,
-        5,    5,    8,    5,    5,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,   10,   13,   26,   13,    5,    5,
-        9,    5,   21,   37,    5,   37,    5,   21,    5,   27,
-
-       26,   31,   44,  222,    5,    5,    7,   10,    5,   28,
-        8,   42,    5,   42,   32,   31,   17,    5,   17,   17,
-       17,   17,   27,    5,    5,   15,   15,   15,   17,   44,
-       15,   19,   28,   19,   19,   19,   19,   32,   20,   20,
-       20,   20,  192,   19,   17,   33,   74,   25,   20,   25,
-       15,   15,   25,   25,   25,   25,  161,   15,   76,   19,
-      127,   15,   15,   15,   20,   15,   74,   15,   33,   75,
-       15,   15,   15,   15,   15,  122,   15,   77,   15,   15,
-       22,   76,   22,   22,   22,   22,   45,   45,   45,   75,
-       79,   45,   22,   47,   47,   47,   78,   77,   47,   48,
-
-       48,   48,   49,   84,   48,  116,  117,  118,   22,   49,
-       50,   50,   50,   79,   89,   50,   78,  119,   45,   51,
-       51,   51,   86,  118,   51,   47,  117,  121,  116,   49,
-       84,   48,  120,   49,   52,   52,   52,   49,   48,   52,
-      119,   47,   50,  121,   49,  155,  158,   49,   52,   49,
-       49,   51,  120,   82,   51,   53,   53,   53,   50,   81,
-       53,  155,  158,   54,   54,   54,   52,   51,   54,   55,
-       55,   55,   43,   52,   55,   41,   52,   39,   56,   56,
-       56,   38,   24,   56,   57,   57,   57,   53,   14,   57,
-       11,   58,   58,   58,    0,   54,   58,   59,   59,   59,
-
-       53,   55,   59,   60,   60,   60,    0,    0,   60,    0,
-       56,   54,   55,   56,    0,   54,   57,   55,    0,   57,
-       61,   61,   61,   58,    0,   61,   56,    0,    0,   59,
-        0,    0,   59,    0,    0,   60,    0,    0,   62,   62,
-       62,    0,   60,   62,   58,   72,   72,   72,   72,    0,
-        0,   60,   61,    0,    0,   60,   60,    0,   64,   64,
-       64,   64,   73,   73,   73,   73,    0,   61,   64,    0,
-       62,   61,    0,   62,   65,    0,   65,   65,   65,   65,
-        0,    0,    0,   66,   64,   66,   65,    0,   66,   66,
-       66,   66,   67,    0,   67,   67,   67,   67,   68,   68,
-
-       68,   68,   65,    0,   67,   87,   87,   87,   68,    0,
-       87,   88,   88,   88,    0,    0,   88,   90,   90,   90,
-       67,    0,   90,    0,   68,    0,    0,    0,   92,   92,
-       92,    0,    0,   92,    0,    0,    0,   87,    0,   93,
-       93,   93,    0,   88,   93,    0,   87,    0,    0,   90,
-       94,   94,   94,    0,    0,   94,    0,    0,    0,    0,
-       92,    0,    0,   88,   91,   91,   91,   91,    0,    0,
-        0,   93,   91,   91,   91,   91,   92,    0,   95,   95,
-       95,    0,   94,   95,    0,    0,   91,   91,   91,   91,
-       91,   91,    0,   96,   96,   96,   94,   94,   96,   97,
-
-       97,   97,    0,    0,   97,    0,   98,   98,   98,    0,
-       95,   98,   99,   99,   99,    0,    0,   99,  100,  100,
-      100,    0,    0,  100,    0,   96,    0,    0,    0,   96,
-        0,   97,  101,  101,  101,    0,   97,  101,   98,    0,
-      102,  102,  102,    0,   99,  102,  103,  103,  103,    0,
-      100,  103,  104,  104,  104,    0,    0,  104,    0,   98,
-       99,    0,    0,    0,  101,    0,    0,    0,  101,    0,
-      100,    0,  102,    0,  105,  105,  105,    0,  103,  105,
-        0,  102,    0,    0,  104,    0,  106,  106,  106,    0,
-      104,  106,    0,  103,  107,  107,  107,    0,    0,  107,
-
-        0,  103,  108,  108,  108,    0,  105,  108,  109,  109,
-      109,    0,    0,  109,  110,  110,  110,    0,  106,  110,
-      105,    0,  111,  111,  111,    0,  107,  111,  112,  112,
-      112,    0,    0,  112,  108,    0,    0,    0,  106,    0,
-      109,    0,    0,    0,  107,  109,  110,    0,  113,  113,
-      113,    0,  110,  113,  111,    0,  108,    0,  111,    0,
-      112,  114,  114,  114,    0,    0,  114,  125,  125,  125,
-        0,  112,  125,  126,  126,  126,    0,    0,  126,    0,
-      113,    0,    0,  132,  132,  132,    0,  113,  132,    0,
-        0,    0,    0,  114,    0,  130,  130,  130,    0,  125,
-
-      130,    0,    0,    0,    0,  126,  114,    0,  125,    0,
-      126,  129,  129,  129,  129,  132,    0,    0,    0,  129,
-      129,  129,  129,  133,  133,  133,    0,  130,  133,  132,
-        0,    0,    0,  129,  129,  129,  129,  129,  129,  135,
-      135,  135,    0,    0,  135,    0,    0,  130,  136,  136,
-      136,    0,    0,  136,    0,  133,  137,  137,  137,    0,
-        0,  137,  138,  138,  138,    0,    0,  138,  139,  139,
-      139,  135,    0,  139,    0,  133,  140,  140,  140,    0,
-      136,  140,  141,  141,  141,    0,    0,  141,  137,    0,
-        0,    0,  135,    0,  138,    0,    0,  136,    0,    0,
-
-      139,    0,    0,    0,    0,    0,  138,  137,  140,    0,
-      142,  142,  142,    0,  141,  142,    0,  139,    0,  143,
-      143,  143,    0,  141,  143,    0,  140,  144,  144,  144,
-        0,    0,  144,  145,  145,  145,    0,    0,  145,  146,
-      146,  146,  142,    0,  146,  142,    0,  147,  147,  147,
-        0,  143,  147,  148,  148,  148,    0,    0,  148,  144,
-        0,    0,  149,  149,  149,  145,  144,  149,    0,    0,
-      143,  146,  145,  143,    0,  150,  150,  150,    0,  147,
-      150,    0,  147,    0,    0,  148,    0,    0,  146,    0,
-        0,    0,  148,    0,  149,  151,  151,  151,    0,    0,
-
-      151,    0,    0,  152,  152,  152,  149,  150,  152,  153,
-      153,  153,    0,    0,  153,    0,    0,  154,  154,  154,
-        0,    0,  154,  150,  163,  163,  163,  151,    0,  163,
-        0,  164,  164,  164,    0,  152,  164,  166,  166,  166,
-        0,  153,  166,  169,  169,  169,  151,  166,  169,  154,
-        0,    0,    0,    0,    0,    0,  163,    0,  152,  153,
-      154,    0,    0,  164,    0,    0,    0,  163,    0,  166,
-        0,    0,    0,    0,    0,  169,    0,    0,    0,  164,
-      165,  165,  165,  165,  169,    0,    0,    0,  165,  165,
-      165,  165,  167,  167,  167,    0,    0,  167,    0,    0,
-
-        0,    0,  165,  165,  165,  165,  165,  165,  168,  168,
-      168,    0,    0,  168,  170,  170,  170,    0,    0,  170,
-      171,  171,  171,    0,  167,  171,    0,    0,    0,  170,
-      170,  167,  172,  172,  172,    0,    0,  172,    0,    0,
-      168,    0,  173,  173,  173,    0,  170,  173,    0,  174,
-      174,  174,  171,    0,  174,  175,  175,  175,  168,    0,
-      175,    0,  171,    0,  172,  176,  176,  176,    0,    0,
-      176,  177,  177,  177,  173,    0,  177,  178,  178,  178,
-        0,  174,  178,  172,  174,    0,    0,  175,  179,  179,
-      179,    0,    0,  179,  175,    0,    0,  176,    0,  180,
-
-      180,  180,    0,  177,  180,    0,  176,    0,    0,  178,
-      181,  181,  181,    0,  177,  181,  178,    0,    0,    0,
-      179,  182,  182,  182,    0,    0,  182,  183,  183,  183,
-        0,  180,  183,  179,  184,  184,  184,    0,    0,  184,
-        0,    0,  181,  185,  185,  185,    0,    0,  185,  186,
-      186,  186,    0,  182,  186,  187,  187,  187,    0,  183,
-      187,    0,    0,  181,    0,    0,  184,  182,    0,  188,
-      188,  188,    0,  184,  188,  185,    0,  183,    0,  188,
-        0,  186,    0,  189,  189,  189,  186,  187,  189,    0,
-      194,  194,  194,    0,    0,  194,  185,  195,  195,  195,
-
-        0,  188,  195,    0,  197,  197,  197,    0,    0,  197,
-        0,  198,  198,  198,    0,  189,  198,    0,  199,  199,
-      199,  189,  194,  199,    0,    0,    0,    0,    0,  195,
-      200,  200,  200,    0,    0,  200,  197,  194,    0,    0,
-        0,    0,    0,  198,  195,  196,  196,  196,  196,    0,
-      199,    0,    0,  196,  196,  196,  196,  197,  198,  201,
-      201,  201,  200,    0,  201,    0,  199,  196,  196,  196,
-      196,  196,  196,    0,    0,  200,  202,  202,  202,    0,
-        0,  202,  203,  203,  203,    0,    0,  203,  204,  204,
-      204,  201,    0,  204,  206,  206,  206,    0,  204,  206,
-
-      207,  207,  207,    0,    0,  207,    0,    0,  202,    0,
-      208,  208,  208,    0,  203,  208,  209,  209,  209,    0,
-      204,  209,  210,  210,  210,    0,  206,  210,  211,  211,
-      211,    0,  207,  211,  213,  213,  213,    0,    0,  213,
-        0,    0,  208,    0,  206,    0,    0,    0,  209,  208,
-      207,  214,  214,  214,  210,    0,  214,  215,  215,  215,
-      211,    0,  215,  216,  216,  216,  213,    0,  216,  217,
-      217,  217,  210,  209,  217,  218,  218,  218,    0,    0,
-      218,    0,    0,  214,    0,    0,  213,    0,    0,  215,
-      214,  220,  220,  220,    0,  216,  220,  221,  221,  221,
-
-      215,  217,  221,  224,  224,  224,    0,  218,  224,  225,
-      225,  225,    0,    0,  225,  216,    0,    0,    0,    0,
-        0,  217,    0,  220,    0,  218,    0,    0,  220,  221,
-        0,    0,  221,    0,    0,  224,    0,  226,  226,  226,
-        0,  225,  226,    0,  224,  227,  227,  227,    0,  225,
-      227,  228,  228,  228,    0,    0,  228,    0,    0,  229,
-      229,  229,    0,    0,  229,    0,    0,    0,    0,  226,
-      233,  233,  233,    0,    0,  233,    0,  227,    0,  234,
-      234,  234,    0,  228,  234,    0,  226,  235,  235,  235,
-        0,  229,  235,    0,    0,    0,  228,  227,  229,  236,
-
-      236,  236,  233,    0,  236,    0,    0,  237,  237,  237,
-        0,  234,  237,    0,    0,  233,  238,  238,  238,  235,
-        0,  238,  240,  240,  240,    0,    0,  240,  241,  241,
-      241,  236,    0,  241,    0,  234,    0,  236,  235,  237,
-      242,  242,  242,    0,    0,  242,  237,    0,  238,    0,
-      244,  244,  244,    0,  240,  244,  240,  243,  243,  243,
-      241,    0,  243,  245,  245,  245,    0,  243,  245,  246,
-      246,  246,  242,    0,  246,    0,  247,  247,  247,    0,
-      241,  247,  244,  249,  249,  249,    0,    0,  249,  243,
-        0,    0,  242,    0,    0,  245,    0,  250,  250,  250,
-
-        0,  246,  250,    0,    0,    0,  245,    0,  247,  251,
-      251,  251,    0,    0,  251,  249,    0,  246,  252,  252,
-      252,    0,    0,  252,    0,  253,  253,  253,  247,  250,
-      253,  254,  254,  254,    0,  253,  254,  255,  255,  255,
-        0,  251,  255,  256,  256,  256,    0,  251,  256,    0,
-      252,  257,  257,  257,    0,    0,  257,  253,    0,    0,
-      258,  258,  258,  254,    0,  258,  259,  259,  259,  255,
-      258,  259,  262,  262,  262,  256,    0,  262,    0,    0,
-      255,    0,    0,  257,    0,  254,  263,  263,  263,    0,
-        0,  263,  258,    0,  264,  264,  264,    0,  259,  264,
-
-      265,  265,  265,    0,  262,  265,  267,  267,  267,    0,
-        0,  267,  268,  268,  268,    0,    0,  268,  263,    0,
-      262,    0,  269,  269,  269,  263,  264,  269,  272,  272,
-      272,    0,  265,  272,  274,  274,  274,    0,  267,  274,
-        0,    0,  267,    0,  268,    0,    0,  265,    0,    0,
-      264,    0,  265,  265,  269,    0,    0,    0,    0,  268,
-      272,  269,    0,  272,    0,    0,  274,  275,  275,  275,
-        0,    0,  275,  276,  276,  276,    0,    0,  276,  279,
-      279,  279,    0,    0,  279,  274,  281,  281,  281,    0,
-        0,  281,  282,  282,  282,    0,    0,  282,    0,  275,
-
-        0,    0,  283,  283,  283,  276,  275,  283,    0,  276,
-        0,  279,  284,  284,  284,    0,    0,  284,  281,    0,
-      285,  285,  285,    0,  282,  285,    0,  286,  286,  286,
-      279,    0,  286,    0,  283,  281,  287,  287,  287,    0,
-        0,  287,  282,    0,  284,    0,    0,  284,  288,  288,
-      288,    0,  285,  288,    0,  289,  289,  289,    0,  286,
-      289,  290,  290,  290,    0,  289,  290,    0,  287,  291,
-      291,  291,    0,    0,  291,  287,  285,  286,    0,    0,
-      288,    0,    0,  292,  292,  292,    0,  289,  292,  293,
-      293,  293,    0,  290,  293,    0,    0,  294,  294,  294,
-
-      288,  291,  294,  295,  295,  295,    0,    0,  295,  296,
-      296,  296,    0,  290,  296,  292,    0,  291,  298,  298,
-      298,  293,    0,  298,    0,  299,  299,  299,  292,  294,
-      299,    0,    0,    0,    0,  295,  294,    0,    0,  293,
-        0,  296,    0,  300,  300,  300,    0,    0,  300,    0,
-      298,  301,  301,  301,    0,  295,  301,  299,    0,    0,
-      296,  301,    0,    0,  298,  302,  302,  302,    0,    0,
-      302,  303,  303,  303,  299,  300,  303,  304,  304,  304,
-        0,    0,  304,  301,    0,  305,  305,  305,  300,    0,
-      305,  306,  306,  306,    0,    0,  306,  302,    0,    0,
-
-      307,  307,  307,  303,  302,  307,    0,    0,  303,  304,
-      308,  308,  308,    0,    0,  308,  304,  305,    0,  309,
-      309,  309,  305,  306,  309,  310,  310,  310,    0,    0,
-      310,    0,  307,    0,    0,  307,  311,  311,  311,    0,
-        0,  311,  308,    0,  312,  312,  312,    0,    0,  312,
-        0,  309,    0,  313,  313,  313,    0,  310,  313,    0,
-      308,    0,  309,    0,  314,  314,  314,    0,  311,  314,
-        0,    0,  315,  315,  315,  311,  312,  315,    0,  316,
-      316,  316,    0,  312,  316,  313,  317,  317,  317,    0,
-        0,  317,  318,  318,  318,    0,  314,  318,  320,  320,
-
-      320,  314,    0,  320,  315,  321,  321,  321,    0,    0,
-      321,  316,  322,  322,  322,    0,    0,  322,  317,    0,
-        0,  316,    0,    0,  318,    0,    0,  315,    0,    0,
-      320,    0,    0,  324,  324,  324,  318,  321,  324,    0,
-      325,  325,  325,    0,  322,  325,    0,    0,  320,  327,
-      327,  327,    0,    0,  327,    0,  328,  328,  328,  321,
-      322,  328,  329,  329,  329,  324,    0,  329,  331,  331,
-      331,    0,  325,  331,  332,  332,  332,    0,    0,  332,
-        0,  327,  333,  333,  333,    0,    0,  333,  328,    0,
-        0,  327,    0,    0,  329,    0,    0,  329,    0,    0,
-
-      331,    0,    0,    0,    0,    0,  332,  331,  328,    0,
-      334,  334,  334,    0,  333,  334,    0,  332,  337,  337,
-      337,  333,    0,  337,  338,  338,  338,    0,    0,  338,
-      339,  339,  339,    0,    0,  339,  340,  340,  340,    0,
-        0,  340,  334,  341,  341,  341,    0,    0,  341,    0,
-      337,    0,    0,  337,    0,    0,  338,  334,  342,  342,
-      342,    0,  339,  342,  343,  343,  343,    0,  340,  343,
-        0,  344,  344,  344,    0,  341,  344,  339,  346,  346,
-      346,    0,  341,  346,  347,  347,  347,    0,  340,  347,
-      342,    0,  348,  348,  348,    0,  343,  348,    0,  349,
-
-      349,  349,    0,  344,  349,    0,    0,    0,  342,    0,
-      346,    0,  350,  350,  350,  343,  347,  350,  344,  346,
-      351,  351,  351,    0,  348,  351,    0,  352,  352,  352,
-        0,  349,  352,  354,  354,  354,    0,    0,  354,    0,
-      355,  355,  355,  348,  350,  355,  357,  357,  357,    0,
-      349,  357,  351,    0,    0,  358,  358,  358,    0,  352,
-      358,  351,  361,  361,  361,  354,  352,  361,  362,  362,
-      362,    0,  355,  362,    0,  363,  363,  363,  357,    0,
-      363,    0,    0,    0,    0,  357,    0,  358,    0,    0,
-        0,    0,    0,    0,  361,    0,    0,    0,    0,    0,
-
-      362,    0,    0,    0,    0,    0,  358,  363,    0,    0,
-        0,    0,    0,  361,  367,  367,  367,  367,  367,  367,
-      367,  368,  368,  368,  368,  368,  368,  368,  369,    0,
-      369,  369,  369,  369,  369,  370,    0,  370,    0,  370,
-      370,  370,  371,  371,  371,  371,  371,  371,  371,  372,
-      372,  372,  372,  372,  372,  372,  373,    0,  373,  373,
-      373,  373,  373,  374,  374,    0,  374,  375,  375,  375,
-      375,  375,  376,  376,  377,  377,  378,  378,  379,  379,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366
+        1,    1,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   98,   98,   98,   98,
+
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,  399,  399,
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+       12,   12,   12,   14,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   54,   54,   54,   28,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   46,   46,   46,  100,   46,   46,
+      100,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+
+       46,   46,   46,   46,   46,   46,   99,   26,   31,   26,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   56,   21,
+       63,   21,   21,   21,   21,   23,   23,   23,   23,   56,
+       56,   21,   24,  225,   24,   24,   24,   24,  225,   56,
+       56,   56,   56,   56,   56,   63,   56,   21,   63,   56,
+
+       56,   56,   56,   56,  105,   32,   56,  110,   56,   56,
+      137,  137,  137,  137,  110,  110,  105,  225,  137,  137,
+      137,  137,   25,  103,   25,   57,  103,   25,   25,   25,
+       25,   27,  137,  137,  137,  137,  137,  137,  170,  170,
+      170,  170,   29,  277,  106,  106,  170,  170,  170,  170,
+       57,  277,   33,   57,   57,   27,   29,  277,  277,   57,
+      170,  170,  170,  170,  170,  170,  178,  178,  178,  178,
+       13,   58,   60,   68,  178,  178,  178,  178,   13,   58,
+       60,   68,   61,   13,   58,   60,   68,   61,  178,  178,
+      178,  178,  178,  178,  206,  206,  206,  206,   80,   71,
+
+       80,   67,  206,  206,  206,  206,   67,   71,   86,  114,
+       35,   67,   71,  180,  180,   30,  206,  206,  206,  206,
+      206,  206,  210,  210,  210,  210,  119,  114,   86,   64,
+      210,  210,  210,  210,  119,   62,  265,  180,   38,   30,
+       62,  162,   64,  119,  210,  210,  210,  210,  210,  210,
+      239,  239,  239,  239,  162,  120,  120,  162,  239,  239,
+      239,  239,   65,   66,  128,  265,  107,   65,   70,   66,
+      265,  128,  239,  239,  239,  239,  239,  239,  268,  268,
+      268,  268,  107,   70,   83,  102,  268,  268,  268,  268,
+       69,  128,   72,   42,   69,  128,   72,   88,  111,  128,
+
+      268,  268,  268,  268,  268,  268,  128,   59,   83,  115,
+      128,   59,  128,  128,  115,   48,   59,   88,  101,  102,
+      101,   59,   59,  104,  108,  104,  109,  108,  109,  112,
+      113,  112,  111,  116,  118,  117,  121,  122,  129,  118,
+      123,  125,  131,  121,  113,  123,  141,  125,  116,  117,
+      133,  122,  142,  144,  129,  145,  146,  145,  147,  149,
+      146,  141,  142,  147,  150,  144,  131,  151,  152,  150,
+      133,  154,  149,  154,  151,  155,  156,  155,  157,  159,
+      158,  160,  152,  161,  156,  165,  160,  161,  166,  159,
+      167,  168,  157,  158,  173,  165,  168,  179,  184,  179,
+
+      181,  183,  167,  185,  181,  166,  189,  186,  183,  186,
+      173,  190,  191,  184,  193,  185,  190,  191,  189,  192,
+      194,  192,  195,  194,  196,  197,  198,  197,  200,  201,
+      202,  198,  203,  204,  200,  205,  205,  196,  211,  212,
+      213,  214,  215,  193,  211,  202,  217,  218,  227,  219,
+      220,  221,  218,  214,  215,  229,  195,  226,  231,  221,
+      217,  219,  204,  201,  220,  222,  203,  223,  224,  232,
+      222,  233,  226,  212,  213,  223,  224,  231,  235,  245,
+      246,  232,  227,  237,  229,  237,  238,  247,  248,  249,
+      238,  250,  235,  246,  251,  252,  250,  245,  253,  256,
+
+      254,  247,  254,  249,  253,  233,  255,  255,  258,  252,
+      256,  260,  261,  261,  263,  266,  267,  260,  258,  270,
+      266,  271,  248,  251,  272,  275,  276,  278,  279,  276,
+      267,  280,  281,  284,  282,  270,  283,  283,  284,  285,
+      286,  288,  290,  275,  296,  297,  288,  299,  263,  282,
+      290,  299,  300,  311,  303,  271,  296,  279,  272,  301,
+      307,  278,  309,  311,  307,  280,  281,  303,  285,  308,
+      300,  301,  308,  312,  286,  309,  313,  314,  315,  297,
+      317,  318,  319,  314,  320,  322,  324,  312,  318,  321,
+      320,  315,  319,  323,  321,  328,  326,  328,  324,  329,
+
+      322,  330,  331,  334,  331,  313,  335,  323,  335,  317,
+      326,  338,  339,  340,  341,  338,  342,  345,  340,  342,
+      345,  346,  347,  349,  339,  350,  351,  352,  349,  353,
+      355,  341,  366,  329,  356,  330,  354,  334,  356,  352,
+      361,  354,  357,  363,  355,  353,  357,  369,  363,  365,
+      367,  368,  372,  361,  350,  346,  347,  365,  367,  368,
+      351,  369,  370,  373,  372,  377,  366,  370,  375,  376,
+      375,  376,  378,  379,  380,  381,  373,  386,  387,  389,
+      390,  391,  394,  395,   84,   87,  379,  380,   89,   92,
+       93,  378,  389,  390,   96,   97,  124,  130,  132,  377,
+
+      134,  135,  148,  163,  164,  174,  177,  182,  187,  381,
+      188,  386,  387,  199,  209,  391,  394,  395,  216,  230,
+      240,  241,  242,  262,  273,  291,  293,  298,  306,  325,
+      327,  332,  333,  336,  337,  360,  364,  371,  382,  383,
+      385,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1450,15 +1245,15 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[62] =
+static const flex_int16_t yy_rule_linenum[64] =
     {   0,
       133,  135,  137,  142,  143,  148,  149,  150,  162,  165,
       170,  177,  186,  198,  210,  220,  230,  240,  249,  258,
       267,  276,  285,  294,  303,  312,  321,  330,  339,  348,
       357,  366,  375,  384,  393,  403,  412,  421,  430,  439,
-      448,  457,  466,  475,  574,  579,  584,  589,  590,  591,
-      592,  593,  594,  596,  614,  627,  632,  636,  638,  640,
-      642
+      448,  457,  466,  475,  484,  493,  592,  597,  602,  607,
+      608,  609,  610,  611,  612,  614,  632,  645,  650,  654,
+      656,  658,  660
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1513,7 +1308,7 @@ using isc::netconf::NetconfParser;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::netconf::ParserContext::fatal(msg)
-#line 1516 "netconf_lexer.cc"
+#line 1311 "netconf_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1539,8 +1334,8 @@ using isc::netconf::NetconfParser;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1542 "netconf_lexer.cc"
-#line 1543 "netconf_lexer.cc"
+#line 1337 "netconf_lexer.cc"
+#line 1338 "netconf_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1854,7 +1649,7 @@ YY_DECL
     }
 
 
-#line 1857 "netconf_lexer.cc"
+#line 1652 "netconf_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1883,13 +1678,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 367 )
+				if ( yy_current_state >= 400 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 366 );
+		while ( yy_current_state != 399 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -1908,13 +1703,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 62 )
+			else if ( yy_act < 64 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], yytext );
-			else if ( yy_act == 62 )
+			else if ( yy_act == 64 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         yytext );
-			else if ( yy_act == 63 )
+			else if ( yy_act == 65 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -2391,6 +2186,30 @@ YY_RULE_SETUP
 case 42:
 YY_RULE_SETUP
 #line 457 "netconf_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return NetconfParser::make_ASYNC(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("async", driver.loc_);
+    }
+}
+	YY_BREAK
+case 43:
+YY_RULE_SETUP
+#line 466 "netconf_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return NetconfParser::make_ASYNC_QUEUE_SIZE(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("async-queue-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 44:
+YY_RULE_SETUP
+#line 475 "netconf_lexer.ll"
 {
     switch(driver.ctx_) {
     case ParserContext::LOGGERS:
@@ -2400,9 +2219,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 43:
+case 45:
 YY_RULE_SETUP
-#line 466 "netconf_lexer.ll"
+#line 484 "netconf_lexer.ll"
 {
     switch(driver.ctx_) {
     case ParserContext::LOGGERS:
@@ -2412,9 +2231,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 44:
+case 46:
 YY_RULE_SETUP
-#line 475 "netconf_lexer.ll"
+#line 493 "netconf_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -2514,65 +2333,65 @@ YY_RULE_SETUP
     return NetconfParser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 45:
-/* rule 45 can match eol */
+case 47:
+/* rule 47 can match eol */
 YY_RULE_SETUP
-#line 574 "netconf_lexer.ll"
+#line 592 "netconf_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 46:
-/* rule 46 can match eol */
+case 48:
+/* rule 48 can match eol */
 YY_RULE_SETUP
-#line 579 "netconf_lexer.ll"
+#line 597 "netconf_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 47:
+case 49:
 YY_RULE_SETUP
-#line 584 "netconf_lexer.ll"
+#line 602 "netconf_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 48:
+case 50:
 YY_RULE_SETUP
-#line 589 "netconf_lexer.ll"
+#line 607 "netconf_lexer.ll"
 { return NetconfParser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 49:
+case 51:
 YY_RULE_SETUP
-#line 590 "netconf_lexer.ll"
+#line 608 "netconf_lexer.ll"
 { return NetconfParser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 50:
+case 52:
 YY_RULE_SETUP
-#line 591 "netconf_lexer.ll"
+#line 609 "netconf_lexer.ll"
 { return NetconfParser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 51:
+case 53:
 YY_RULE_SETUP
-#line 592 "netconf_lexer.ll"
+#line 610 "netconf_lexer.ll"
 { return NetconfParser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 52:
+case 54:
 YY_RULE_SETUP
-#line 593 "netconf_lexer.ll"
+#line 611 "netconf_lexer.ll"
 { return NetconfParser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 53:
+case 55:
 YY_RULE_SETUP
-#line 594 "netconf_lexer.ll"
+#line 612 "netconf_lexer.ll"
 { return NetconfParser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 54:
+case 56:
 YY_RULE_SETUP
-#line 596 "netconf_lexer.ll"
+#line 614 "netconf_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -2591,9 +2410,9 @@ YY_RULE_SETUP
     return NetconfParser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 55:
+case 57:
 YY_RULE_SETUP
-#line 614 "netconf_lexer.ll"
+#line 632 "netconf_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -2607,43 +2426,43 @@ YY_RULE_SETUP
     return NetconfParser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 56:
+case 58:
 YY_RULE_SETUP
-#line 627 "netconf_lexer.ll"
+#line 645 "netconf_lexer.ll"
 {
     string tmp(yytext);
     return NetconfParser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 57:
+case 59:
 YY_RULE_SETUP
-#line 632 "netconf_lexer.ll"
+#line 650 "netconf_lexer.ll"
 {
    return NetconfParser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 58:
+case 60:
 YY_RULE_SETUP
-#line 636 "netconf_lexer.ll"
+#line 654 "netconf_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 59:
+case 61:
 YY_RULE_SETUP
-#line 638 "netconf_lexer.ll"
+#line 656 "netconf_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 60:
+case 62:
 YY_RULE_SETUP
-#line 640 "netconf_lexer.ll"
+#line 658 "netconf_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 61:
+case 63:
 YY_RULE_SETUP
-#line 642 "netconf_lexer.ll"
+#line 660 "netconf_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 644 "netconf_lexer.ll"
+#line 662 "netconf_lexer.ll"
 {
     if (driver.states_.empty()) {
         return NetconfParser::make_END(driver.loc_);
@@ -2667,12 +2486,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 62:
+case 64:
 YY_RULE_SETUP
-#line 667 "netconf_lexer.ll"
+#line 685 "netconf_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 2675 "netconf_lexer.cc"
+#line 2494 "netconf_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -2991,7 +2810,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 367 )
+			if ( yy_current_state >= 400 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -3024,11 +2843,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 367 )
+		if ( yy_current_state >= 400 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 366);
+	yy_is_jam = (yy_current_state == 399);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -3777,8 +3596,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 667 "netconf_lexer.ll"
-
+#line 685 "netconf_lexer.ll"
 
 using namespace isc::dhcp;
 
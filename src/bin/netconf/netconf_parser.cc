@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.4.1.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015, 2018-2019 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,8 +30,9 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
-// Undocumented macros, especially those whose name start with YY_,
-// are private implementation details.  Do not rely on them.
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
 
 
 // Take the name prefix into account.
@@ -47,7 +48,7 @@
 
 #include <netconf/parser_context.h>
 
-#line 51 "netconf_parser.cc"
+#line 52 "netconf_parser.cc"
 
 
 #ifndef YY_
@@ -62,6 +63,7 @@
 # endif
 #endif
 
+
 // Whether we are compiled with exception support.
 #ifndef YY_EXCEPTIONS
 # if defined __GNUC__ && !defined __EXCEPTIONS
@@ -92,9 +94,6 @@
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if NETCONF_DEBUG
 
@@ -120,13 +119,13 @@
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !NETCONF_DEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE (Symbol)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
 # define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
 # define YY_STACK_PRINT()                static_cast<void> (0)
 
@@ -142,56 +141,15 @@
 
 #line 14 "netconf_parser.yy"
 namespace isc { namespace netconf {
-#line 146 "netconf_parser.cc"
-
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  NetconfParser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr;
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              else
-                goto append;
-
-            append:
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 145 "netconf_parser.cc"
 
   /// Build a parser object.
   NetconfParser::NetconfParser (isc::netconf::ParserContext& ctx_yyarg)
-    :
 #if NETCONF_DEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       ctx (ctx_yyarg)
   {}
@@ -202,9 +160,9 @@ namespace isc { namespace netconf {
   NetconfParser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
   {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
@@ -234,13 +192,13 @@ namespace isc { namespace netconf {
     : state (s)
   {}
 
-  NetconfParser::symbol_number_type
-  NetconfParser::by_state::type_get () const YY_NOEXCEPT
+  NetconfParser::symbol_kind_type
+  NetconfParser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
   NetconfParser::stack_symbol_type::stack_symbol_type ()
@@ -249,27 +207,27 @@ namespace isc { namespace netconf {
   NetconfParser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
     : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
   {
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 57: // value
-      case 60: // map_value
-      case 119: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 48: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
         break;
 
-      case 47: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
         break;
 
-      case 46: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 45: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
         break;
 
@@ -286,27 +244,27 @@ namespace isc { namespace netconf {
   NetconfParser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
     : super_type (s, YY_MOVE (that.location))
   {
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 57: // value
-      case 60: // map_value
-      case 119: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 48: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 47: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 46: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 45: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (YY_MOVE (that.value));
         break;
 
@@ -315,35 +273,71 @@ namespace isc { namespace netconf {
     }
 
     // that is emptied.
-    that.type = empty_symbol;
+    that.kind_ = symbol_kind::S_YYEMPTY;
   }
 
 #if YY_CPLUSPLUS < 201103L
+  NetconfParser::stack_symbol_type&
+  NetconfParser::stack_symbol_type::operator= (const stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
+        value.copy< ElementPtr > (that.value);
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.copy< bool > (that.value);
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.copy< double > (that.value);
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.copy< int64_t > (that.value);
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.copy< std::string > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    return *this;
+  }
+
   NetconfParser::stack_symbol_type&
   NetconfParser::stack_symbol_type::operator= (stack_symbol_type& that)
   {
     state = that.state;
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 57: // value
-      case 60: // map_value
-      case 119: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 48: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 47: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 46: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 45: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -369,69 +363,67 @@ namespace isc { namespace netconf {
 #if NETCONF_DEBUG
   template <typename Base>
   void
-  NetconfParser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  NetconfParser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-#if defined __GNUC__ && ! defined __clang__ && ! defined __ICC && __GNUC__ * 100 + __GNUC_MINOR__ <= 408
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-#endif
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    switch (yytype)
-    {
-      case 45: // "constant string"
-#line 107 "netconf_parser.yy"
-        { yyoutput << yysym.value.template as < std::string > (); }
-#line 393 "netconf_parser.cc"
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        switch (yykind)
+    {
+      case symbol_kind::S_STRING: // "constant string"
+#line 109 "netconf_parser.yy"
+                 { yyoutput << yysym.value.template as < std::string > (); }
+#line 384 "netconf_parser.cc"
         break;
 
-      case 46: // "integer"
-#line 107 "netconf_parser.yy"
-        { yyoutput << yysym.value.template as < int64_t > (); }
-#line 399 "netconf_parser.cc"
+      case symbol_kind::S_INTEGER: // "integer"
+#line 109 "netconf_parser.yy"
+                 { yyoutput << yysym.value.template as < int64_t > (); }
+#line 390 "netconf_parser.cc"
         break;
 
-      case 47: // "floating point"
-#line 107 "netconf_parser.yy"
-        { yyoutput << yysym.value.template as < double > (); }
-#line 405 "netconf_parser.cc"
+      case symbol_kind::S_FLOAT: // "floating point"
+#line 109 "netconf_parser.yy"
+                 { yyoutput << yysym.value.template as < double > (); }
+#line 396 "netconf_parser.cc"
         break;
 
-      case 48: // "boolean"
-#line 107 "netconf_parser.yy"
-        { yyoutput << yysym.value.template as < bool > (); }
-#line 411 "netconf_parser.cc"
+      case symbol_kind::S_BOOLEAN: // "boolean"
+#line 109 "netconf_parser.yy"
+                 { yyoutput << yysym.value.template as < bool > (); }
+#line 402 "netconf_parser.cc"
         break;
 
-      case 57: // value
-#line 107 "netconf_parser.yy"
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 417 "netconf_parser.cc"
+      case symbol_kind::S_value: // value
+#line 109 "netconf_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 408 "netconf_parser.cc"
         break;
 
-      case 60: // map_value
-#line 107 "netconf_parser.yy"
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 423 "netconf_parser.cc"
+      case symbol_kind::S_map_value: // map_value
+#line 109 "netconf_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 414 "netconf_parser.cc"
         break;
 
-      case 119: // socket_type_value
-#line 107 "netconf_parser.yy"
-        { yyoutput << yysym.value.template as < ElementPtr > (); }
-#line 429 "netconf_parser.cc"
+      case symbol_kind::S_socket_type_value: // socket_type_value
+#line 109 "netconf_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 420 "netconf_parser.cc"
         break;
 
       default:
         break;
     }
-    yyo << ')';
+        yyo << ')';
+      }
   }
 #endif
 
@@ -455,7 +447,7 @@ namespace isc { namespace netconf {
   }
 
   void
-  NetconfParser::yypop_ (int n)
+  NetconfParser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -490,21 +482,21 @@ namespace isc { namespace netconf {
   NetconfParser::state_type
   NetconfParser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
   bool
-  NetconfParser::yy_pact_value_is_default_ (int yyvalue)
+  NetconfParser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
   bool
-  NetconfParser::yy_table_value_is_error_ (int yyvalue)
+  NetconfParser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
@@ -518,7 +510,6 @@ namespace isc { namespace netconf {
   int
   NetconfParser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -554,7 +545,8 @@ namespace isc { namespace netconf {
   | yynewstate -- push a new symbol on the stack.  |
   `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << '\n';
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
@@ -568,14 +560,14 @@ namespace isc { namespace netconf {
   `-----------*/
   yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
 #if YY_EXCEPTIONS
         try
 #endif // YY_EXCEPTIONS
@@ -594,11 +586,23 @@ namespace isc { namespace netconf {
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -615,7 +619,7 @@ namespace isc { namespace netconf {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, YY_MOVE (yyla));
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
 
@@ -623,7 +627,7 @@ namespace isc { namespace netconf {
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
@@ -642,25 +646,25 @@ namespace isc { namespace netconf {
          when using variants.  */
       switch (yyr1_[yyn])
     {
-      case 57: // value
-      case 60: // map_value
-      case 119: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 48: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         yylhs.value.emplace< bool > ();
         break;
 
-      case 47: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         yylhs.value.emplace< double > ();
         break;
 
-      case 46: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         yylhs.value.emplace< int64_t > ();
         break;
 
-      case 45: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         yylhs.value.emplace< std::string > ();
         break;
 
@@ -684,208 +688,208 @@ namespace isc { namespace netconf {
         {
           switch (yyn)
             {
-  case 2:
-#line 118 "netconf_parser.yy"
-    { ctx.ctx_ = ctx.NO_KEYWORDS; }
-#line 691 "netconf_parser.cc"
+  case 2: // $@1: %empty
+#line 120 "netconf_parser.yy"
+                       { ctx.ctx_ = ctx.NO_KEYWORDS; }
+#line 695 "netconf_parser.cc"
     break;
 
-  case 4:
-#line 119 "netconf_parser.yy"
-    { ctx.ctx_ = ctx.CONFIG; }
-#line 697 "netconf_parser.cc"
+  case 4: // $@2: %empty
+#line 121 "netconf_parser.yy"
+                         { ctx.ctx_ = ctx.CONFIG; }
+#line 701 "netconf_parser.cc"
     break;
 
-  case 6:
-#line 120 "netconf_parser.yy"
-    { ctx.ctx_ = ctx.NETCONF; }
-#line 703 "netconf_parser.cc"
+  case 6: // $@3: %empty
+#line 122 "netconf_parser.yy"
+                         { ctx.ctx_ = ctx.NETCONF; }
+#line 707 "netconf_parser.cc"
     break;
 
-  case 8:
-#line 128 "netconf_parser.yy"
-    {
+  case 8: // $@4: %empty
+#line 130 "netconf_parser.yy"
+                            {
     // Parse the Netconf map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 713 "netconf_parser.cc"
+#line 717 "netconf_parser.cc"
     break;
 
-  case 9:
-#line 132 "netconf_parser.yy"
-    {
+  case 9: // sub_netconf: "{" $@4 global_params "}"
+#line 134 "netconf_parser.yy"
+                               {
     // parsing completed
 }
-#line 721 "netconf_parser.cc"
+#line 725 "netconf_parser.cc"
     break;
 
-  case 10:
-#line 139 "netconf_parser.yy"
-    {
+  case 10: // json: value
+#line 141 "netconf_parser.yy"
+            {
     // Push back the JSON value on the stack
     ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
 }
-#line 730 "netconf_parser.cc"
+#line 734 "netconf_parser.cc"
     break;
 
-  case 11:
-#line 145 "netconf_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
-#line 736 "netconf_parser.cc"
-    break;
-
-  case 12:
-#line 146 "netconf_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
-#line 742 "netconf_parser.cc"
-    break;
-
-  case 13:
+  case 11: // value: "integer"
 #line 147 "netconf_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
-#line 748 "netconf_parser.cc"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
+#line 740 "netconf_parser.cc"
     break;
 
-  case 14:
+  case 12: // value: "floating point"
 #line 148 "netconf_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
-#line 754 "netconf_parser.cc"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
+#line 746 "netconf_parser.cc"
     break;
 
-  case 15:
+  case 13: // value: "boolean"
 #line 149 "netconf_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
-#line 760 "netconf_parser.cc"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
+#line 752 "netconf_parser.cc"
     break;
 
-  case 16:
+  case 14: // value: "constant string"
 #line 150 "netconf_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 766 "netconf_parser.cc"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
+#line 758 "netconf_parser.cc"
     break;
 
-  case 17:
+  case 15: // value: "null"
 #line 151 "netconf_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 772 "netconf_parser.cc"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
+#line 764 "netconf_parser.cc"
     break;
 
-  case 18:
-#line 155 "netconf_parser.yy"
-    {
+  case 16: // value: map
+#line 152 "netconf_parser.yy"
+           { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 770 "netconf_parser.cc"
+    break;
+
+  case 17: // value: list_generic
+#line 153 "netconf_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 776 "netconf_parser.cc"
+    break;
+
+  case 18: // $@5: %empty
+#line 157 "netconf_parser.yy"
+                    {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 783 "netconf_parser.cc"
+#line 787 "netconf_parser.cc"
     break;
 
-  case 19:
-#line 160 "netconf_parser.yy"
-    {
+  case 19: // map: "{" $@5 map_content "}"
+#line 162 "netconf_parser.yy"
+                             {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 793 "netconf_parser.cc"
+#line 797 "netconf_parser.cc"
     break;
 
-  case 20:
-#line 166 "netconf_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 799 "netconf_parser.cc"
+  case 20: // map_value: map
+#line 168 "netconf_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 803 "netconf_parser.cc"
     break;
 
-  case 23:
-#line 180 "netconf_parser.yy"
-    {
+  case 23: // not_empty_map: "constant string" ":" value
+#line 182 "netconf_parser.yy"
+                                  {
                   // map containing a single entry
                   ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 808 "netconf_parser.cc"
+#line 812 "netconf_parser.cc"
     break;
 
-  case 24:
-#line 184 "netconf_parser.yy"
-    {
+  case 24: // not_empty_map: not_empty_map "," "constant string" ":" value
+#line 186 "netconf_parser.yy"
+                                                      {
                   // map consisting of a shorter map followed by
                   // comma and string:value
                   ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 818 "netconf_parser.cc"
+#line 822 "netconf_parser.cc"
     break;
 
-  case 25:
-#line 191 "netconf_parser.yy"
-    {
+  case 25: // $@6: %empty
+#line 193 "netconf_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 827 "netconf_parser.cc"
+#line 831 "netconf_parser.cc"
     break;
 
-  case 26:
-#line 194 "netconf_parser.yy"
-    {
+  case 26: // list_generic: "[" $@6 list_content "]"
+#line 196 "netconf_parser.yy"
+                               {
 }
-#line 834 "netconf_parser.cc"
+#line 838 "netconf_parser.cc"
     break;
 
-  case 29:
-#line 201 "netconf_parser.yy"
-    {
+  case 29: // not_empty_list: value
+#line 203 "netconf_parser.yy"
+                      {
                   // List consisting of a single element.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 843 "netconf_parser.cc"
+#line 847 "netconf_parser.cc"
     break;
 
-  case 30:
-#line 205 "netconf_parser.yy"
-    {
+  case 30: // not_empty_list: not_empty_list "," value
+#line 207 "netconf_parser.yy"
+                                           {
                   // List ending with , and a value.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 852 "netconf_parser.cc"
+#line 856 "netconf_parser.cc"
     break;
 
-  case 31:
-#line 218 "netconf_parser.yy"
-    {
+  case 31: // unknown_map_entry: "constant string" ":"
+#line 220 "netconf_parser.yy"
+                                {
     const std::string& where = ctx.contextName();
     const std::string& keyword = yystack_[1].value.as < std::string > ();
     error(yystack_[1].location,
           "got unexpected keyword \"" + keyword + "\" in " + where + " map.");
 }
-#line 863 "netconf_parser.cc"
+#line 867 "netconf_parser.cc"
     break;
 
-  case 32:
-#line 226 "netconf_parser.yy"
-    {
+  case 32: // $@7: %empty
+#line 228 "netconf_parser.yy"
+                                   {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 874 "netconf_parser.cc"
+#line 878 "netconf_parser.cc"
     break;
 
-  case 33:
-#line 231 "netconf_parser.yy"
-    {
+  case 33: // netconf_syntax_map: "{" $@7 global_objects "}"
+#line 233 "netconf_parser.yy"
+                                {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 884 "netconf_parser.cc"
+#line 888 "netconf_parser.cc"
     break;
 
-  case 38:
-#line 248 "netconf_parser.yy"
-    {
+  case 38: // $@8: %empty
+#line 250 "netconf_parser.yy"
+                        {
 
     // Let's create a MapElement that will represent it, add it to the
     // top level map (that's already on the stack) and put the new map
@@ -896,58 +900,58 @@ namespace isc { namespace netconf {
     ctx.stack_.push_back(m);
     ctx.enter(ctx.NETCONF);
 }
-#line 900 "netconf_parser.cc"
+#line 904 "netconf_parser.cc"
     break;
 
-  case 39:
-#line 258 "netconf_parser.yy"
-    {
+  case 39: // netconf_object: "Netconf" $@8 ":" "{" global_params "}"
+#line 260 "netconf_parser.yy"
+                                                    {
     // Ok, we're done with parsing Netconf. Let's take the map
     // off the stack.
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 911 "netconf_parser.cc"
+#line 915 "netconf_parser.cc"
     break;
 
-  case 53:
-#line 286 "netconf_parser.yy"
-    {
+  case 53: // boot_update: "boot-update" ":" "boolean"
+#line 288 "netconf_parser.yy"
+                                       {
     ElementPtr flag(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("boot-update", flag);
 }
-#line 920 "netconf_parser.cc"
+#line 924 "netconf_parser.cc"
     break;
 
-  case 54:
-#line 291 "netconf_parser.yy"
-    {
+  case 54: // subscribe_changes: "subscribe-changes" ":" "boolean"
+#line 293 "netconf_parser.yy"
+                                                   {
     ElementPtr flag(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subscribe-changes", flag);
 }
-#line 929 "netconf_parser.cc"
+#line 933 "netconf_parser.cc"
     break;
 
-  case 55:
-#line 296 "netconf_parser.yy"
-    {
+  case 55: // validate_changes: "validate-changes" ":" "boolean"
+#line 298 "netconf_parser.yy"
+                                                 {
     ElementPtr flag(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("validate-changes", flag);
 }
-#line 938 "netconf_parser.cc"
+#line 942 "netconf_parser.cc"
     break;
 
-  case 56:
-#line 301 "netconf_parser.yy"
-    {
+  case 56: // $@9: %empty
+#line 303 "netconf_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 946 "netconf_parser.cc"
+#line 950 "netconf_parser.cc"
     break;
 
-  case 57:
-#line 303 "netconf_parser.yy"
-    {
+  case 57: // user_context: "user-context" $@9 ":" map_value
+#line 305 "netconf_parser.yy"
+                  {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context = yystack_[0].value.as < ElementPtr > ();
     ConstElementPtr old = parent->get("user-context");
@@ -969,20 +973,20 @@ namespace isc { namespace netconf {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 973 "netconf_parser.cc"
+#line 977 "netconf_parser.cc"
     break;
 
-  case 58:
-#line 326 "netconf_parser.yy"
-    {
+  case 58: // $@10: %empty
+#line 328 "netconf_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 981 "netconf_parser.cc"
+#line 985 "netconf_parser.cc"
     break;
 
-  case 59:
-#line 328 "netconf_parser.yy"
-    {
+  case 59: // comment: "comment" $@10 ":" "constant string"
+#line 330 "netconf_parser.yy"
+               {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
     ElementPtr comment(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
@@ -1006,479 +1010,509 @@ namespace isc { namespace netconf {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 1010 "netconf_parser.cc"
+#line 1014 "netconf_parser.cc"
     break;
 
-  case 60:
-#line 354 "netconf_parser.yy"
-    {
+  case 60: // $@11: %empty
+#line 356 "netconf_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 1021 "netconf_parser.cc"
+#line 1025 "netconf_parser.cc"
     break;
 
-  case 61:
-#line 359 "netconf_parser.yy"
-    {
+  case 61: // hooks_libraries: "hooks-libraries" $@11 ":" "[" hooks_libraries_list "]"
+#line 361 "netconf_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1030 "netconf_parser.cc"
+#line 1034 "netconf_parser.cc"
     break;
 
-  case 66:
-#line 372 "netconf_parser.yy"
-    {
+  case 66: // $@12: %empty
+#line 374 "netconf_parser.yy"
+                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1040 "netconf_parser.cc"
+#line 1044 "netconf_parser.cc"
     break;
 
-  case 67:
-#line 376 "netconf_parser.yy"
-    {
+  case 67: // hooks_library: "{" $@12 hooks_params "}"
+#line 378 "netconf_parser.yy"
+                              {
     ctx.stack_.pop_back();
 }
-#line 1048 "netconf_parser.cc"
+#line 1052 "netconf_parser.cc"
     break;
 
-  case 73:
-#line 389 "netconf_parser.yy"
-    {
+  case 73: // $@13: %empty
+#line 391 "netconf_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1056 "netconf_parser.cc"
+#line 1060 "netconf_parser.cc"
     break;
 
-  case 74:
-#line 391 "netconf_parser.yy"
-    {
+  case 74: // library: "library" $@13 ":" "constant string"
+#line 393 "netconf_parser.yy"
+               {
     ElementPtr lib(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 1066 "netconf_parser.cc"
+#line 1070 "netconf_parser.cc"
     break;
 
-  case 75:
-#line 397 "netconf_parser.yy"
-    {
+  case 75: // $@14: %empty
+#line 399 "netconf_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1074 "netconf_parser.cc"
+#line 1078 "netconf_parser.cc"
     break;
 
-  case 76:
-#line 399 "netconf_parser.yy"
-    {
+  case 76: // parameters: "parameters" $@14 ":" value
+#line 401 "netconf_parser.yy"
+              {
     ctx.stack_.back()->set("parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1083 "netconf_parser.cc"
+#line 1087 "netconf_parser.cc"
     break;
 
-  case 77:
-#line 407 "netconf_parser.yy"
-    {
+  case 77: // $@15: %empty
+#line 409 "netconf_parser.yy"
+                                                      {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[2].location)));
     ctx.stack_.back()->set("managed-servers", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.MANAGED_SERVERS);
 }
-#line 1094 "netconf_parser.cc"
+#line 1098 "netconf_parser.cc"
     break;
 
-  case 78:
-#line 412 "netconf_parser.yy"
-    {
+  case 78: // managed_servers: "managed-servers" ":" "{" $@15 servers_entries "}"
+#line 414 "netconf_parser.yy"
+                                 {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1103 "netconf_parser.cc"
+#line 1107 "netconf_parser.cc"
     break;
 
-  case 88:
-#line 436 "netconf_parser.yy"
-    {
+  case 88: // $@16: %empty
+#line 438 "netconf_parser.yy"
+                           {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER);
 }
-#line 1114 "netconf_parser.cc"
+#line 1118 "netconf_parser.cc"
     break;
 
-  case 89:
-#line 441 "netconf_parser.yy"
-    {
+  case 89: // dhcp4_server: "dhcp4" $@16 ":" "{" managed_server_params "}"
+#line 443 "netconf_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1123 "netconf_parser.cc"
+#line 1127 "netconf_parser.cc"
     break;
 
-  case 90:
-#line 447 "netconf_parser.yy"
-    {
+  case 90: // $@17: %empty
+#line 449 "netconf_parser.yy"
+                           {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp6", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER);
 }
-#line 1134 "netconf_parser.cc"
+#line 1138 "netconf_parser.cc"
     break;
 
-  case 91:
-#line 452 "netconf_parser.yy"
-    {
+  case 91: // dhcp6_server: "dhcp6" $@17 ":" "{" managed_server_params "}"
+#line 454 "netconf_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1143 "netconf_parser.cc"
+#line 1147 "netconf_parser.cc"
     break;
 
-  case 92:
-#line 458 "netconf_parser.yy"
-    {
+  case 92: // $@18: %empty
+#line 460 "netconf_parser.yy"
+                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("d2", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER);
 }
-#line 1154 "netconf_parser.cc"
+#line 1158 "netconf_parser.cc"
     break;
 
-  case 93:
-#line 463 "netconf_parser.yy"
-    {
+  case 93: // d2_server: "d2" $@18 ":" "{" managed_server_params "}"
+#line 465 "netconf_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1163 "netconf_parser.cc"
+#line 1167 "netconf_parser.cc"
     break;
 
-  case 94:
-#line 469 "netconf_parser.yy"
-    {
+  case 94: // $@19: %empty
+#line 471 "netconf_parser.yy"
+                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ca", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER);
 }
-#line 1174 "netconf_parser.cc"
+#line 1178 "netconf_parser.cc"
     break;
 
-  case 95:
-#line 474 "netconf_parser.yy"
-    {
+  case 95: // ca_server: "ca" $@19 ":" "{" managed_server_params "}"
+#line 476 "netconf_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1183 "netconf_parser.cc"
+#line 1187 "netconf_parser.cc"
     break;
 
-  case 106:
-#line 496 "netconf_parser.yy"
-    {
+  case 106: // $@20: %empty
+#line 498 "netconf_parser.yy"
+             {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1191 "netconf_parser.cc"
+#line 1195 "netconf_parser.cc"
     break;
 
-  case 107:
-#line 498 "netconf_parser.yy"
-    {
+  case 107: // model: "model" $@20 ":" "constant string"
+#line 500 "netconf_parser.yy"
+               {
     ElementPtr model(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("model", model);
     ctx.leave();
 }
-#line 1201 "netconf_parser.cc"
+#line 1205 "netconf_parser.cc"
     break;
 
-  case 108:
-#line 505 "netconf_parser.yy"
-    {
+  case 108: // $@21: %empty
+#line 507 "netconf_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 1212 "netconf_parser.cc"
+#line 1216 "netconf_parser.cc"
     break;
 
-  case 109:
-#line 510 "netconf_parser.yy"
-    {
+  case 109: // control_socket: "control-socket" $@21 ":" "{" control_socket_params "}"
+#line 512 "netconf_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1221 "netconf_parser.cc"
+#line 1225 "netconf_parser.cc"
     break;
 
-  case 118:
-#line 528 "netconf_parser.yy"
-    {
+  case 118: // $@22: %empty
+#line 530 "netconf_parser.yy"
+                         {
     ctx.enter(ctx.SOCKET_TYPE);
 }
-#line 1229 "netconf_parser.cc"
+#line 1233 "netconf_parser.cc"
     break;
 
-  case 119:
-#line 530 "netconf_parser.yy"
-    {
+  case 119: // socket_type: "socket-type" $@22 ":" socket_type_value
+#line 532 "netconf_parser.yy"
+                          {
     ctx.stack_.back()->set("socket-type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1238 "netconf_parser.cc"
+#line 1242 "netconf_parser.cc"
     break;
 
-  case 120:
-#line 536 "netconf_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("unix", ctx.loc2pos(yystack_[0].location))); }
-#line 1244 "netconf_parser.cc"
+  case 120: // socket_type_value: "unix"
+#line 538 "netconf_parser.yy"
+                         { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("unix", ctx.loc2pos(yystack_[0].location))); }
+#line 1248 "netconf_parser.cc"
     break;
 
-  case 121:
-#line 537 "netconf_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("http", ctx.loc2pos(yystack_[0].location))); }
-#line 1250 "netconf_parser.cc"
+  case 121: // socket_type_value: "http"
+#line 539 "netconf_parser.yy"
+                         { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("http", ctx.loc2pos(yystack_[0].location))); }
+#line 1254 "netconf_parser.cc"
     break;
 
-  case 122:
-#line 538 "netconf_parser.yy"
-    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("stdout", ctx.loc2pos(yystack_[0].location))); }
-#line 1256 "netconf_parser.cc"
+  case 122: // socket_type_value: "stdout"
+#line 540 "netconf_parser.yy"
+                           { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("stdout", ctx.loc2pos(yystack_[0].location))); }
+#line 1260 "netconf_parser.cc"
     break;
 
-  case 123:
-#line 541 "netconf_parser.yy"
-    {
+  case 123: // $@23: %empty
+#line 543 "netconf_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1264 "netconf_parser.cc"
+#line 1268 "netconf_parser.cc"
     break;
 
-  case 124:
-#line 543 "netconf_parser.yy"
-    {
+  case 124: // socket_name: "socket-name" $@23 ":" "constant string"
+#line 545 "netconf_parser.yy"
+               {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 1274 "netconf_parser.cc"
+#line 1278 "netconf_parser.cc"
     break;
 
-  case 125:
-#line 550 "netconf_parser.yy"
-    {
+  case 125: // $@24: %empty
+#line 552 "netconf_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1282 "netconf_parser.cc"
+#line 1286 "netconf_parser.cc"
     break;
 
-  case 126:
-#line 552 "netconf_parser.yy"
-    {
+  case 126: // socket_url: "socket-url" $@24 ":" "constant string"
+#line 554 "netconf_parser.yy"
+               {
     ElementPtr url(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-url", url);
     ctx.leave();
 }
-#line 1292 "netconf_parser.cc"
+#line 1296 "netconf_parser.cc"
     break;
 
-  case 127:
-#line 565 "netconf_parser.yy"
-    {
+  case 127: // $@25: %empty
+#line 567 "netconf_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 1303 "netconf_parser.cc"
+#line 1307 "netconf_parser.cc"
     break;
 
-  case 128:
-#line 570 "netconf_parser.yy"
-    {
+  case 128: // logging_object: "Logging" $@25 ":" "{" logging_params "}"
+#line 572 "netconf_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1312 "netconf_parser.cc"
+#line 1316 "netconf_parser.cc"
     break;
 
-  case 132:
-#line 587 "netconf_parser.yy"
-    {
+  case 132: // $@26: %empty
+#line 589 "netconf_parser.yy"
+                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 1323 "netconf_parser.cc"
+#line 1327 "netconf_parser.cc"
     break;
 
-  case 133:
-#line 592 "netconf_parser.yy"
-    {
+  case 133: // loggers: "loggers" $@26 ":" "[" loggers_entries "]"
+#line 594 "netconf_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1332 "netconf_parser.cc"
+#line 1336 "netconf_parser.cc"
     break;
 
-  case 136:
-#line 604 "netconf_parser.yy"
-    {
+  case 136: // $@27: %empty
+#line 606 "netconf_parser.yy"
+                             {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 1342 "netconf_parser.cc"
+#line 1346 "netconf_parser.cc"
     break;
 
-  case 137:
-#line 608 "netconf_parser.yy"
-    {
+  case 137: // logger_entry: "{" $@27 logger_params "}"
+#line 610 "netconf_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 1350 "netconf_parser.cc"
+#line 1354 "netconf_parser.cc"
     break;
 
-  case 147:
-#line 625 "netconf_parser.yy"
-    {
+  case 147: // $@28: %empty
+#line 627 "netconf_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1358 "netconf_parser.cc"
+#line 1362 "netconf_parser.cc"
     break;
 
-  case 148:
-#line 627 "netconf_parser.yy"
-    {
+  case 148: // name: "name" $@28 ":" "constant string"
+#line 629 "netconf_parser.yy"
+               {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1368 "netconf_parser.cc"
+#line 1372 "netconf_parser.cc"
     break;
 
-  case 149:
-#line 633 "netconf_parser.yy"
-    {
+  case 149: // debuglevel: "debuglevel" ":" "integer"
+#line 635 "netconf_parser.yy"
+                                     {
     ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 1377 "netconf_parser.cc"
+#line 1381 "netconf_parser.cc"
     break;
 
-  case 150:
-#line 638 "netconf_parser.yy"
-    {
+  case 150: // $@29: %empty
+#line 640 "netconf_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1385 "netconf_parser.cc"
+#line 1389 "netconf_parser.cc"
     break;
 
-  case 151:
-#line 640 "netconf_parser.yy"
-    {
+  case 151: // severity: "severity" $@29 ":" "constant string"
+#line 642 "netconf_parser.yy"
+               {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 1395 "netconf_parser.cc"
+#line 1399 "netconf_parser.cc"
     break;
 
-  case 152:
-#line 646 "netconf_parser.yy"
-    {
+  case 152: // $@30: %empty
+#line 648 "netconf_parser.yy"
+                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 1406 "netconf_parser.cc"
+#line 1410 "netconf_parser.cc"
     break;
 
-  case 153:
-#line 651 "netconf_parser.yy"
-    {
+  case 153: // output_options_list: "output_options" $@30 ":" "[" output_options_list_content "]"
+#line 653 "netconf_parser.yy"
+                                                                    {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1415 "netconf_parser.cc"
+#line 1419 "netconf_parser.cc"
     break;
 
-  case 156:
-#line 660 "netconf_parser.yy"
-    {
+  case 156: // $@31: %empty
+#line 662 "netconf_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1425 "netconf_parser.cc"
+#line 1429 "netconf_parser.cc"
     break;
 
-  case 157:
-#line 664 "netconf_parser.yy"
-    {
+  case 157: // output_entry: "{" $@31 output_params_list "}"
+#line 666 "netconf_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 1433 "netconf_parser.cc"
+#line 1437 "netconf_parser.cc"
     break;
 
-  case 164:
-#line 678 "netconf_parser.yy"
-    {
+  case 166: // $@32: %empty
+#line 682 "netconf_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1441 "netconf_parser.cc"
+#line 1445 "netconf_parser.cc"
     break;
 
-  case 165:
-#line 680 "netconf_parser.yy"
-    {
+  case 167: // output: "output" $@32 ":" "constant string"
+#line 684 "netconf_parser.yy"
+               {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 1451 "netconf_parser.cc"
+#line 1455 "netconf_parser.cc"
     break;
 
-  case 166:
-#line 686 "netconf_parser.yy"
-    {
+  case 168: // flush: "flush" ":" "boolean"
+#line 690 "netconf_parser.yy"
+                           {
     ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 1460 "netconf_parser.cc"
+#line 1464 "netconf_parser.cc"
     break;
 
-  case 167:
-#line 691 "netconf_parser.yy"
-    {
+  case 169: // maxsize: "maxsize" ":" "integer"
+#line 695 "netconf_parser.yy"
+                               {
     ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 1469 "netconf_parser.cc"
+#line 1473 "netconf_parser.cc"
     break;
 
-  case 168:
-#line 696 "netconf_parser.yy"
-    {
+  case 170: // maxver: "maxver" ":" "integer"
+#line 700 "netconf_parser.yy"
+                             {
     ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 1478 "netconf_parser.cc"
+#line 1482 "netconf_parser.cc"
+    break;
+
+  case 171: // $@33: %empty
+#line 705 "netconf_parser.yy"
+             {
+    ctx.enter(ctx.NO_KEYWORDS);
+}
+#line 1490 "netconf_parser.cc"
     break;
 
+  case 172: // async: "async" $@33 ":" "constant string"
+#line 707 "netconf_parser.yy"
+               {
+    ElementPtr async(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async", async);
+    ctx.leave();
+}
+#line 1500 "netconf_parser.cc"
+    break;
 
-#line 1482 "netconf_parser.cc"
+  case 173: // async_queue_size: "async-queue-size" ":" "integer"
+#line 713 "netconf_parser.yy"
+                                                 {
+    if (yystack_[0].value.as < int64_t > () <= 0) {
+        error(yystack_[0].location, "async-queue-size must be greater than zero");
+    }
+    ElementPtr size(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async-queue-size", size);
+}
+#line 1512 "netconf_parser.cc"
+    break;
+
+
+#line 1516 "netconf_parser.cc"
 
             default:
               break;
@@ -1495,7 +1529,6 @@ namespace isc { namespace netconf {
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
       yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
@@ -1511,7 +1544,9 @@ namespace isc { namespace netconf {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -1522,7 +1557,7 @@ namespace isc { namespace netconf {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -1548,6 +1583,7 @@ namespace isc { namespace netconf {
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
 
@@ -1556,37 +1592,39 @@ namespace isc { namespace netconf {
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
+      error_token.state = state_type (yyn);
       yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
@@ -1618,6 +1656,7 @@ namespace isc { namespace netconf {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -1651,18 +1690,103 @@ namespace isc { namespace netconf {
     error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  NetconfParser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  NetconfParser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
 
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
+
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  NetconfParser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
+
+
+  // NetconfParser::context.
+  NetconfParser::context::context (const NetconfParser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  NetconfParser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
+
+
+  int
+  NetconfParser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -1681,41 +1805,32 @@ namespace isc { namespace netconf {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  NetconfParser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -1736,11 +1851,11 @@ namespace isc { namespace netconf {
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -1749,42 +1864,42 @@ namespace isc { namespace netconf {
   }
 
 
-  const signed char NetconfParser::yypact_ninf_ = -83;
+  const signed char NetconfParser::yypact_ninf_ = -94;
 
   const signed char NetconfParser::yytable_ninf_ = -1;
 
   const short
   NetconfParser::yypact_[] =
   {
-      76,   -83,   -83,   -83,     6,    12,     0,    11,   -83,   -83,
-     -83,   -83,   -83,   -83,   -83,   -83,   -83,   -83,   -83,   -83,
-     -83,   -83,   -83,   -83,    12,     4,    -5,    -1,   -83,    14,
-      48,    73,    82,   104,   -83,   -83,    44,   -83,   -83,   -83,
-     -83,   -83,   108,   109,   123,   124,   -83,   -83,   125,   -83,
-     122,   128,   -83,   -83,   -83,   -83,   -83,   -83,   -83,   -83,
-     -83,   -83,    12,    12,   -83,    87,   129,   130,    -5,   -83,
-     131,   132,    89,    90,    91,   133,   137,   138,   -83,   -83,
-      -1,   -83,   -83,   139,   140,   141,   -83,   142,    99,   -83,
-     -83,   -83,   -83,   145,   146,   -83,    12,    -1,   112,   -83,
-     -83,   -83,     5,   147,   148,   -83,   144,    77,   -83,   -83,
-     -83,   -83,   -83,   -83,   -83,   152,   143,   -83,   -83,   -83,
-     -83,   -83,   -83,   150,   158,   -83,   -83,    62,   -83,   -83,
-     112,   -83,   149,   159,   160,   161,   -83,     5,    51,   -83,
-     147,    29,   148,   -83,   -83,   155,   162,   163,   164,   -83,
-     -83,   -83,   -83,    83,   -83,   -83,   -83,   -83,   -83,   -83,
-     168,   -83,   -83,   -83,   -83,    84,   -83,   -83,   -83,   -83,
-     -83,   -83,    24,    24,    24,    24,   169,   170,     3,   -83,
-     171,   172,   120,   173,    29,   -83,   -83,   -83,   -83,   -83,
-     -83,   -83,   -83,   -83,    85,   -83,   -83,   -83,    86,    94,
-      95,   134,    12,   -83,   135,   176,   -83,   151,   -83,   174,
-     179,    24,   -83,   -83,   -83,   -83,   -83,   -83,   -83,   177,
-     -83,   153,   178,   -83,   -83,   102,   -83,   -83,    72,   -10,
-     177,   -83,   -83,   -83,   -83,   -83,   -83,   -83,    98,   -83,
-     -83,   -83,   -83,   -83,   182,   183,   184,   101,   -83,   -83,
-     -83,   -83,   -83,   -83,   185,   186,   187,    72,   -83,   188,
-     119,   154,   165,   -10,   -83,    97,   167,   175,   -83,   180,
-     -83,   -83,   -83,   -83,   -83,   -83,   -83,   -83,   -83,   -83,
-     -83
+      79,   -94,   -94,   -94,     7,    10,    11,    19,   -94,   -94,
+     -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,
+     -94,   -94,   -94,   -94,    10,   -41,     6,    16,   -94,    41,
+      63,    70,    59,    80,   -94,   -94,    32,   -94,   -94,   -94,
+     -94,   -94,   101,   105,   118,   128,   -94,   -94,   129,   -94,
+      85,   110,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,
+     -94,   -94,    10,    10,   -94,    87,   131,   132,     6,   -94,
+     133,   134,    90,    91,    92,   136,   135,   140,   -94,   -94,
+      16,   -94,   -94,   141,   139,   142,   -94,   143,   104,   -94,
+     -94,   -94,   -94,   147,   148,   -94,    10,    16,   114,   -94,
+     -94,   -94,     5,   149,   153,   -94,   146,    33,   -94,   -94,
+     -94,   -94,   -94,   -94,   -94,   154,   145,   -94,   -94,   -94,
+     -94,   -94,   -94,   155,   152,   -94,   -94,    45,   -94,   -94,
+     114,   -94,   159,   160,   161,   162,   -94,     5,     3,   -94,
+     149,    53,   153,   -94,   -94,   163,   164,   165,   166,   -94,
+     -94,   -94,   -94,    36,   -94,   -94,   -94,   -94,   -94,   -94,
+     170,   -94,   -94,   -94,   -94,    74,   -94,   -94,   -94,   -94,
+     -94,   -94,    -1,    -1,    -1,    -1,   171,   172,    89,   -94,
+     173,   174,   119,   175,    53,   -94,   -94,   -94,   -94,   -94,
+     -94,   -94,   -94,   -94,    78,   -94,   -94,   -94,    86,    98,
+      99,   121,    10,   -94,   122,   176,   -94,   137,   -94,   179,
+     181,    -1,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   180,
+     -94,   144,   182,   -94,   -94,   115,   -94,   -94,    57,    56,
+     180,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   100,   -94,
+     -94,   -94,   -94,   -94,   184,   186,   188,   -94,   189,   109,
+     -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   190,   191,
+     192,    57,   -94,   193,   130,   138,   150,   195,   156,    56,
+     -94,   102,   158,   167,   -94,   168,   -94,   -94,   -94,   169,
+     -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94
   };
 
   const unsigned char
@@ -1814,160 +1929,161 @@ namespace isc { namespace netconf {
        0,     0,    89,    91,    93,    95,    74,    76,   148,     0,
      151,     0,     0,    97,   156,     0,   154,   107,     0,     0,
        0,   153,   118,   123,   125,   117,   115,   116,     0,   110,
-     112,   113,   114,   164,     0,     0,     0,     0,   158,   160,
-     161,   162,   163,   155,     0,     0,     0,     0,   109,     0,
-       0,     0,     0,     0,   157,     0,     0,     0,   111,     0,
-     166,   167,   168,   159,   120,   121,   122,   119,   124,   126,
-     165
+     112,   113,   114,   166,     0,     0,     0,   171,     0,     0,
+     158,   160,   161,   162,   163,   164,   165,   155,     0,     0,
+       0,     0,   109,     0,     0,     0,     0,     0,     0,     0,
+     157,     0,     0,     0,   111,     0,   168,   169,   170,     0,
+     173,   159,   120,   121,   122,   119,   124,   126,   167,   172
   };
 
-  const signed char
+  const short
   NetconfParser::yypgoto_[] =
   {
-     -83,   -83,   -83,   -83,   -83,   -83,   -83,   -83,   -20,    81,
-     -83,   -83,   -83,   -83,   -83,   -83,   -83,   -83,   -27,   -83,
-     -83,   -83,   126,   -83,   -83,    96,   -83,   115,   -24,   -19,
-     -18,   -26,   -83,   -25,   -83,   -83,   -83,   -83,   -83,    57,
-     -83,   -83,    21,   -83,   -83,   -83,   -83,   -83,   -83,   -83,
-     -83,    67,   -83,   -83,   -83,   -83,   -83,   -83,   -83,   -83,
-     -49,    -6,   -83,   -83,   -83,   -83,   -83,   -51,   -83,   -83,
-     -83,   -83,   -83,   -83,   -83,   -83,   -83,   -83,    78,   -82,
-     -83,   -83,    65,   -83,   -83,    25,   -83,   -83,   -83,   -83,
-     -83,   -83,   -83,   -83,   -17,   -83,   -83,   -53,   -83,   -83,
-     -83,   -83,   -83
+     -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   -20,   113,
+     -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   -27,   -94,
+     -94,   -94,   151,   -94,   -94,   111,   -94,   126,   -24,   -19,
+     -18,   -26,   -94,   -25,   -94,   -94,   -94,   -94,   -94,    67,
+     -94,   -94,    31,   -94,   -94,   -94,   -94,   -94,   -94,   -94,
+     -94,    73,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,
+     -44,     0,   -94,   -94,   -94,   -94,   -94,   -49,   -94,   -94,
+     -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,    83,   -93,
+     -94,   -94,    75,   -94,   -94,    34,   -94,   -94,   -94,   -94,
+     -94,   -94,   -94,   -94,   -10,   -94,   -94,   -48,   -94,   -94,
+     -94,   -94,   -94,   -94,   -94,   -94
   };
 
   const short
   NetconfParser::yydefgoto_[] =
   {
-      -1,     4,     5,     6,     7,    23,    27,    16,    17,    18,
+       0,     4,     5,     6,     7,    23,    27,    16,    17,    18,
       25,   100,    32,    33,    19,    24,    29,    30,   188,    21,
       26,    36,    37,    38,    66,    50,    51,    52,   189,   190,
      191,   192,    70,   193,    71,    58,    76,   123,   124,   125,
      138,   153,   154,   155,   176,   156,   177,    59,   102,   115,
      116,   117,   118,   132,   119,   133,   120,   134,   121,   135,
-     194,   195,   196,   209,   197,   210,   238,   239,   240,   254,
-     277,   241,   255,   242,   256,    39,    67,   107,   108,    60,
+     194,   195,   196,   209,   197,   210,   238,   239,   240,   258,
+     285,   241,   259,   242,   260,    39,    67,   107,   108,    60,
       77,   127,   128,   141,   165,   166,   167,   180,   168,   169,
-     183,   170,   181,   225,   226,   229,   247,   248,   249,   259,
-     250,   251,   252
+     183,   170,   181,   225,   226,   229,   249,   250,   251,   263,
+     252,   253,   254,   255,   267,   256
   };
 
-  const unsigned short
+  const short
   NetconfParser::yytable_[] =
   {
-      49,    56,    57,    53,    28,    34,     8,    20,    54,    55,
-      40,    41,    42,    43,    44,    45,   109,     9,    22,    10,
-      61,    11,   110,   111,   112,   113,   243,    35,    46,   244,
-     245,   246,    47,   150,   151,    40,    41,    42,    43,    44,
-      40,    41,    81,    82,    48,   186,   187,    68,   109,    31,
-      48,    62,    69,    49,    56,    57,    53,    12,    13,    14,
-      15,    54,    55,   158,   159,   142,   160,   161,   143,    48,
-      49,    56,    57,    53,    48,   114,   105,    63,    54,    55,
-     130,   150,   151,    40,    41,   131,   178,   184,   211,   211,
-      64,   179,   185,   212,   213,   232,    48,   211,   211,   233,
-     234,   257,   214,   215,   263,   230,   258,    65,   231,   264,
-     114,   152,    72,    73,   162,   163,   164,    48,     1,     2,
-       3,   274,   275,   276,   198,   199,   200,    74,    75,    78,
-      79,    80,    83,    84,    85,    87,    88,    89,    90,    91,
-      92,    93,    94,    96,   101,    47,   137,    97,    98,    10,
-     103,   104,   129,   145,   122,   126,   139,   162,   163,   164,
-     136,   140,   172,   146,   147,   148,   206,   270,    99,   173,
-     174,   175,   182,   201,   202,   204,   205,   207,   221,   216,
-     218,   219,   217,   222,   224,   228,   260,   261,   262,   265,
-     266,   267,   269,   106,    86,    95,   220,   157,   227,   203,
-     271,   235,   236,   237,   149,   223,   268,   171,   144,   208,
-     273,   272,   278,   253,     0,     0,     0,     0,     0,     0,
-     279,     0,     0,     0,     0,   280,     0,     0,     0,     0,
-     235,   236,   237
+      49,    56,    57,    53,    28,   109,    31,     8,    54,    55,
+      40,    41,    42,    43,    44,     9,    34,    10,    20,    11,
+     186,   187,   110,   111,   112,   113,    22,    40,    41,    42,
+      43,    44,    45,   150,   151,    68,   130,   109,    35,   178,
+      69,   131,    81,    82,   179,    46,    48,    61,   142,    47,
+      48,   143,    48,    49,    56,    57,    53,    12,    13,    14,
+      15,    54,    55,    48,    40,    41,    62,    64,    40,    41,
+      49,    56,    57,    53,    63,   114,   105,   184,    54,    55,
+     232,   211,   185,    65,   233,   234,   212,   158,   159,   211,
+     160,   161,   243,    79,   213,   244,   245,   246,   247,   248,
+      48,   211,   211,   261,    48,    72,   214,   215,   262,    73,
+     114,   152,   269,    80,   162,   163,   164,   270,   230,   150,
+     151,   231,    74,     1,     2,     3,   282,   283,   284,   198,
+     199,   200,    75,    78,    83,    84,    85,    87,    88,    93,
+      89,    90,    91,    92,    94,    96,    97,    47,   137,    98,
+      10,   101,   103,   104,   129,   140,   122,   162,   163,   164,
+     126,   139,   136,   145,   146,   147,   148,   206,   216,   218,
+     172,   173,   174,   175,   182,   201,   202,   204,   205,   207,
+     276,   219,   217,   221,   220,   222,   277,   224,   264,   228,
+     265,   227,   266,   268,   271,   272,   273,   275,   278,   279,
+      99,   235,   236,   237,   280,   286,    95,   157,   106,   203,
+     149,   223,   274,   144,   287,   288,   289,   171,   208,    86,
+     257,   281,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   235,   236,   237
   };
 
   const short
   NetconfParser::yycheck_[] =
   {
-      27,    27,    27,    27,    24,    10,     0,     7,    27,    27,
-      11,    12,    13,    14,    15,    16,    98,     5,     7,     7,
-       6,     9,    17,    18,    19,    20,    36,    32,    29,    39,
-      40,    41,    33,    30,    31,    11,    12,    13,    14,    15,
-      11,    12,    62,    63,    45,    21,    22,     3,   130,    45,
-      45,     3,     8,    80,    80,    80,    80,    45,    46,    47,
-      48,    80,    80,    34,    35,     3,    37,    38,     6,    45,
-      97,    97,    97,    97,    45,   102,    96,     4,    97,    97,
-       3,    30,    31,    11,    12,     8,     3,     3,     3,     3,
-       8,     8,     8,     8,     8,    23,    45,     3,     3,    27,
-      28,     3,     8,     8,     3,     3,     8,     3,     6,     8,
-     137,   138,     4,     4,   141,   141,   141,    45,    42,    43,
-      44,    24,    25,    26,   173,   174,   175,     4,     4,     4,
-       8,     3,    45,     4,     4,     4,     4,    48,    48,    48,
-       7,     4,     4,     4,    45,    33,     3,     7,     7,     7,
-       5,     5,     8,     4,     7,     7,     6,   184,   184,   184,
-       8,     3,     7,     4,     4,     4,    46,    48,    87,     7,
-       7,     7,     4,     4,     4,     4,     4,     4,     4,    45,
-      45,     5,   202,     4,     7,     7,     4,     4,     4,     4,
-       4,     4,     4,    97,    68,    80,    45,   140,    45,   178,
-      46,   228,   228,   228,   137,   211,   257,   142,   130,   184,
-     263,    46,    45,   230,    -1,    -1,    -1,    -1,    -1,    -1,
-      45,    -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,    -1,
-     257,   257,   257
+      27,    27,    27,    27,    24,    98,    47,     0,    27,    27,
+      11,    12,    13,    14,    15,     5,    10,     7,     7,     9,
+      21,    22,    17,    18,    19,    20,     7,    11,    12,    13,
+      14,    15,    16,    30,    31,     3,     3,   130,    32,     3,
+       8,     8,    62,    63,     8,    29,    47,     6,     3,    33,
+      47,     6,    47,    80,    80,    80,    80,    47,    48,    49,
+      50,    80,    80,    47,    11,    12,     3,     8,    11,    12,
+      97,    97,    97,    97,     4,   102,    96,     3,    97,    97,
+      23,     3,     8,     3,    27,    28,     8,    34,    35,     3,
+      37,    38,    36,     8,     8,    39,    40,    41,    42,    43,
+      47,     3,     3,     3,    47,     4,     8,     8,     8,     4,
+     137,   138,     3,     3,   141,   141,   141,     8,     3,    30,
+      31,     6,     4,    44,    45,    46,    24,    25,    26,   173,
+     174,   175,     4,     4,    47,     4,     4,     4,     4,     4,
+      50,    50,    50,     7,     4,     4,     7,    33,     3,     7,
+       7,    47,     5,     5,     8,     3,     7,   184,   184,   184,
+       7,     6,     8,     4,     4,     4,     4,    48,    47,    47,
+       7,     7,     7,     7,     4,     4,     4,     4,     4,     4,
+      50,     5,   202,     4,    47,     4,    48,     7,     4,     7,
+       4,    47,     4,     4,     4,     4,     4,     4,    48,     4,
+      87,   228,   228,   228,    48,    47,    80,   140,    97,   178,
+     137,   211,   261,   130,    47,    47,    47,   142,   184,    68,
+     230,   269,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   261,   261,   261
   };
 
   const unsigned char
   NetconfParser::yystos_[] =
   {
-       0,    42,    43,    44,    50,    51,    52,    53,     0,     5,
-       7,     9,    45,    46,    47,    48,    56,    57,    58,    63,
-       7,    68,     7,    54,    64,    59,    69,    55,    57,    65,
-      66,    45,    61,    62,    10,    32,    70,    71,    72,   124,
-      11,    12,    13,    14,    15,    16,    29,    33,    45,    67,
-      74,    75,    76,    77,    78,    79,    80,    82,    84,    96,
-     128,     6,     3,     4,     8,     3,    73,   125,     3,     8,
-      81,    83,     4,     4,     4,     4,    85,   129,     4,     8,
-       3,    57,    57,    45,     4,     4,    71,     4,     4,    48,
-      48,    48,     7,     4,     4,    76,     4,     7,     7,    58,
-      60,    45,    97,     5,     5,    57,    74,   126,   127,   128,
-      17,    18,    19,    20,    67,    98,    99,   100,   101,   103,
-     105,   107,     7,    86,    87,    88,     7,   130,   131,     8,
-       3,     8,   102,   104,   106,   108,     8,     3,    89,     6,
-       3,   132,     3,     6,   127,     4,     4,     4,     4,   100,
-      30,    31,    67,    90,    91,    92,    94,    88,    34,    35,
-      37,    38,    67,    80,    82,   133,   134,   135,   137,   138,
-     140,   131,     7,     7,     7,     7,    93,    95,     3,     8,
-     136,   141,     4,   139,     3,     8,    21,    22,    67,    77,
-      78,    79,    80,    82,   109,   110,   111,   113,   109,   109,
-     109,     4,     4,    91,     4,     4,    46,     4,   134,   112,
-     114,     3,     8,     8,     8,     8,    45,    57,    45,     5,
-      45,     4,     4,   110,     7,   142,   143,    45,     7,   144,
-       3,     6,    23,    27,    28,    67,    80,    82,   115,   116,
-     117,   120,   122,    36,    39,    40,    41,   145,   146,   147,
-     149,   150,   151,   143,   118,   121,   123,     3,     8,   148,
-       4,     4,     4,     3,     8,     4,     4,     4,   116,     4,
-      48,    46,    46,   146,    24,    25,    26,   119,    45,    45,
-      45
+       0,    44,    45,    46,    52,    53,    54,    55,     0,     5,
+       7,     9,    47,    48,    49,    50,    58,    59,    60,    65,
+       7,    70,     7,    56,    66,    61,    71,    57,    59,    67,
+      68,    47,    63,    64,    10,    32,    72,    73,    74,   126,
+      11,    12,    13,    14,    15,    16,    29,    33,    47,    69,
+      76,    77,    78,    79,    80,    81,    82,    84,    86,    98,
+     130,     6,     3,     4,     8,     3,    75,   127,     3,     8,
+      83,    85,     4,     4,     4,     4,    87,   131,     4,     8,
+       3,    59,    59,    47,     4,     4,    73,     4,     4,    50,
+      50,    50,     7,     4,     4,    78,     4,     7,     7,    60,
+      62,    47,    99,     5,     5,    59,    76,   128,   129,   130,
+      17,    18,    19,    20,    69,   100,   101,   102,   103,   105,
+     107,   109,     7,    88,    89,    90,     7,   132,   133,     8,
+       3,     8,   104,   106,   108,   110,     8,     3,    91,     6,
+       3,   134,     3,     6,   129,     4,     4,     4,     4,   102,
+      30,    31,    69,    92,    93,    94,    96,    90,    34,    35,
+      37,    38,    69,    82,    84,   135,   136,   137,   139,   140,
+     142,   133,     7,     7,     7,     7,    95,    97,     3,     8,
+     138,   143,     4,   141,     3,     8,    21,    22,    69,    79,
+      80,    81,    82,    84,   111,   112,   113,   115,   111,   111,
+     111,     4,     4,    93,     4,     4,    48,     4,   136,   114,
+     116,     3,     8,     8,     8,     8,    47,    59,    47,     5,
+      47,     4,     4,   112,     7,   144,   145,    47,     7,   146,
+       3,     6,    23,    27,    28,    69,    82,    84,   117,   118,
+     119,   122,   124,    36,    39,    40,    41,    42,    43,   147,
+     148,   149,   151,   152,   153,   154,   156,   145,   120,   123,
+     125,     3,     8,   150,     4,     4,     4,   155,     4,     3,
+       8,     4,     4,     4,   118,     4,    50,    48,    48,     4,
+      48,   148,    24,    25,    26,   121,    47,    47,    47,    47
   };
 
   const unsigned char
   NetconfParser::yyr1_[] =
   {
-       0,    49,    51,    50,    52,    50,    53,    50,    55,    54,
-      56,    57,    57,    57,    57,    57,    57,    57,    59,    58,
-      60,    61,    61,    62,    62,    64,    63,    65,    65,    66,
-      66,    67,    69,    68,    70,    70,    71,    71,    73,    72,
-      74,    74,    75,    75,    76,    76,    76,    76,    76,    76,
-      76,    76,    76,    77,    78,    79,    81,    80,    83,    82,
-      85,    84,    86,    86,    87,    87,    89,    88,    90,    90,
-      90,    91,    91,    93,    92,    95,    94,    97,    96,    98,
-      98,    99,    99,   100,   100,   100,   100,   100,   102,   101,
-     104,   103,   106,   105,   108,   107,   109,   109,   110,   110,
-     110,   110,   110,   110,   110,   110,   112,   111,   114,   113,
-     115,   115,   116,   116,   116,   116,   116,   116,   118,   117,
-     119,   119,   119,   121,   120,   123,   122,   125,   124,   126,
-     126,   127,   129,   128,   130,   130,   132,   131,   133,   133,
-     134,   134,   134,   134,   134,   134,   134,   136,   135,   137,
-     139,   138,   141,   140,   142,   142,   144,   143,   145,   145,
-     146,   146,   146,   146,   148,   147,   149,   150,   151
+       0,    51,    53,    52,    54,    52,    55,    52,    57,    56,
+      58,    59,    59,    59,    59,    59,    59,    59,    61,    60,
+      62,    63,    63,    64,    64,    66,    65,    67,    67,    68,
+      68,    69,    71,    70,    72,    72,    73,    73,    75,    74,
+      76,    76,    77,    77,    78,    78,    78,    78,    78,    78,
+      78,    78,    78,    79,    80,    81,    83,    82,    85,    84,
+      87,    86,    88,    88,    89,    89,    91,    90,    92,    92,
+      92,    93,    93,    95,    94,    97,    96,    99,    98,   100,
+     100,   101,   101,   102,   102,   102,   102,   102,   104,   103,
+     106,   105,   108,   107,   110,   109,   111,   111,   112,   112,
+     112,   112,   112,   112,   112,   112,   114,   113,   116,   115,
+     117,   117,   118,   118,   118,   118,   118,   118,   120,   119,
+     121,   121,   121,   123,   122,   125,   124,   127,   126,   128,
+     128,   129,   131,   130,   132,   132,   134,   133,   135,   135,
+     136,   136,   136,   136,   136,   136,   136,   138,   137,   139,
+     141,   140,   143,   142,   144,   144,   146,   145,   147,   147,
+     148,   148,   148,   148,   148,   148,   150,   149,   151,   152,
+     153,   155,   154,   156
   };
 
-  const unsigned char
+  const signed char
   NetconfParser::yyr2_[] =
   {
        0,     2,     0,     3,     0,     3,     0,     3,     0,     4,
@@ -1986,26 +2102,28 @@ namespace isc { namespace netconf {
        3,     1,     0,     6,     1,     3,     0,     4,     1,     3,
        1,     1,     1,     1,     1,     1,     1,     0,     4,     3,
        0,     4,     0,     6,     1,     3,     0,     4,     1,     3,
-       1,     1,     1,     1,     0,     4,     3,     3,     3
+       1,     1,     1,     1,     1,     1,     0,     4,     3,     3,
+       3,     0,     4,     3
   };
 
 
-
+#if NETCONF_DEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const NetconfParser::yytname_[] =
   {
-  "\"end of file\"", "error", "$undefined", "\",\"", "\":\"", "\"[\"",
-  "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Netconf\"", "\"user-context\"",
-  "\"comment\"", "\"boot-update\"", "\"subscribe-changes\"",
-  "\"validate-changes\"", "\"managed-servers\"", "\"dhcp4\"", "\"dhcp6\"",
-  "\"d2\"", "\"ca\"", "\"model\"", "\"control-socket\"", "\"socket-type\"",
-  "\"unix\"", "\"http\"", "\"stdout\"", "\"socket-name\"",
-  "\"socket-url\"", "\"hooks-libraries\"", "\"library\"", "\"parameters\"",
-  "\"Logging\"", "\"loggers\"", "\"name\"", "\"output_options\"",
-  "\"output\"", "\"debuglevel\"", "\"severity\"", "\"flush\"",
-  "\"maxsize\"", "\"maxver\"", "START_JSON", "START_NETCONF",
+  "\"end of file\"", "error", "\"invalid token\"", "\",\"", "\":\"",
+  "\"[\"", "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Netconf\"",
+  "\"user-context\"", "\"comment\"", "\"boot-update\"",
+  "\"subscribe-changes\"", "\"validate-changes\"", "\"managed-servers\"",
+  "\"dhcp4\"", "\"dhcp6\"", "\"d2\"", "\"ca\"", "\"model\"",
+  "\"control-socket\"", "\"socket-type\"", "\"unix\"", "\"http\"",
+  "\"stdout\"", "\"socket-name\"", "\"socket-url\"", "\"hooks-libraries\"",
+  "\"library\"", "\"parameters\"", "\"Logging\"", "\"loggers\"",
+  "\"name\"", "\"output_options\"", "\"output\"", "\"debuglevel\"",
+  "\"severity\"", "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"async\"",
+  "\"async-queue-size\"", "START_JSON", "START_NETCONF",
   "START_SUB_NETCONF", "\"constant string\"", "\"integer\"",
   "\"floating point\"", "\"boolean\"", "$accept", "start", "$@1", "$@2",
   "$@3", "sub_netconf", "$@4", "json", "value", "map", "$@5", "map_value",
@@ -2029,50 +2147,51 @@ namespace isc { namespace netconf {
   "debuglevel", "severity", "$@29", "output_options_list", "$@30",
   "output_options_list_content", "output_entry", "$@31",
   "output_params_list", "output_params", "output", "$@32", "flush",
-  "maxsize", "maxver", YY_NULLPTR
+  "maxsize", "maxver", "async", "$@33", "async_queue_size", YY_NULLPTR
   };
+#endif
+
 
 #if NETCONF_DEBUG
-  const unsigned short
+  const short
   NetconfParser::yyrline_[] =
   {
-       0,   118,   118,   118,   119,   119,   120,   120,   128,   128,
-     139,   145,   146,   147,   148,   149,   150,   151,   155,   155,
-     166,   171,   172,   180,   184,   191,   191,   197,   198,   201,
-     205,   218,   226,   226,   238,   239,   243,   244,   248,   248,
-     265,   266,   269,   270,   275,   276,   277,   278,   279,   280,
-     281,   282,   283,   286,   291,   296,   301,   301,   326,   326,
-     354,   354,   364,   365,   368,   369,   372,   372,   380,   381,
-     382,   385,   386,   389,   389,   397,   397,   407,   407,   417,
-     418,   421,   422,   428,   429,   430,   431,   432,   436,   436,
-     447,   447,   458,   458,   469,   469,   480,   481,   485,   486,
-     487,   488,   489,   490,   491,   492,   496,   496,   505,   505,
-     516,   517,   520,   521,   522,   523,   524,   525,   528,   528,
-     536,   537,   538,   541,   541,   550,   550,   565,   565,   578,
-     579,   583,   587,   587,   599,   600,   604,   604,   612,   613,
-     616,   617,   618,   619,   620,   621,   622,   625,   625,   633,
-     638,   638,   646,   646,   656,   657,   660,   660,   668,   669,
-     672,   673,   674,   675,   678,   678,   686,   691,   696
+       0,   120,   120,   120,   121,   121,   122,   122,   130,   130,
+     141,   147,   148,   149,   150,   151,   152,   153,   157,   157,
+     168,   173,   174,   182,   186,   193,   193,   199,   200,   203,
+     207,   220,   228,   228,   240,   241,   245,   246,   250,   250,
+     267,   268,   271,   272,   277,   278,   279,   280,   281,   282,
+     283,   284,   285,   288,   293,   298,   303,   303,   328,   328,
+     356,   356,   366,   367,   370,   371,   374,   374,   382,   383,
+     384,   387,   388,   391,   391,   399,   399,   409,   409,   419,
+     420,   423,   424,   430,   431,   432,   433,   434,   438,   438,
+     449,   449,   460,   460,   471,   471,   482,   483,   487,   488,
+     489,   490,   491,   492,   493,   494,   498,   498,   507,   507,
+     518,   519,   522,   523,   524,   525,   526,   527,   530,   530,
+     538,   539,   540,   543,   543,   552,   552,   567,   567,   580,
+     581,   585,   589,   589,   601,   602,   606,   606,   614,   615,
+     618,   619,   620,   621,   622,   623,   624,   627,   627,   635,
+     640,   640,   648,   648,   658,   659,   662,   662,   670,   671,
+     674,   675,   676,   677,   678,   679,   682,   682,   690,   695,
+     700,   705,   705,   713
   };
 
-  // Print the state stack on the debug stream.
   void
-  NetconfParser::yystack_print_ ()
+  NetconfParser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
+      *yycdebug_ << ' ' << int (i->state);
     *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  NetconfParser::yy_reduce_print_ (int yyrule)
+  NetconfParser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
@@ -2087,9 +2206,9 @@ namespace isc { namespace netconf {
 
 #line 14 "netconf_parser.yy"
 } } // isc::netconf
-#line 2091 "netconf_parser.cc"
+#line 2210 "netconf_parser.cc"
 
-#line 701 "netconf_parser.yy"
+#line 721 "netconf_parser.yy"
 
 
 void
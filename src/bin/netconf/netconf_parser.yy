@@ -85,6 +85,8 @@ using namespace std;
   FLUSH "flush"
   MAXSIZE "maxsize"
   MAXVER "maxver"
+  ASYNC "async"
+  ASYNC_QUEUE_SIZE "async-queue-size"
 
   // Not real tokens, just a way to signal what the parser is expected to
   // parse. This define the starting point. It either can be full grammar
@@ -673,6 +675,8 @@ output_params: output
              | flush
              | maxsize
              | maxver
+             | async
+             | async_queue_size
              ;
 
 output: OUTPUT {
@@ -698,6 +702,22 @@ maxver: MAXVER COLON INTEGER {
     ctx.stack_.back()->set("maxver", maxver);
 };
 
+async: ASYNC {
+    ctx.enter(ctx.NO_KEYWORDS);
+} COLON STRING {
+    ElementPtr async(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("async", async);
+    ctx.leave();
+};
+
+async_queue_size: ASYNC_QUEUE_SIZE COLON INTEGER {
+    if ($3 <= 0) {
+        error(@3, "async-queue-size must be greater than zero");
+    }
+    ElementPtr size(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("async-queue-size", size);
+};
+
 %%
 
 void
@@ -23,10 +23,15 @@ public:
     /// \brief Default and the only constructor of AbstractScen.
     ///
     /// \param options reference to command options,
-    /// \param socket reference to a socket.
-    AbstractScen(CommandOptions& options, BasePerfSocket &socket) :
+    /// \param socket reference to a socket,
+    /// \param receiver receiver shared between workers; if null
+    /// a new one is created,
+    /// \param worker index of the worker running the scenario.
+    AbstractScen(CommandOptions& options, BasePerfSocket &socket,
+                 const ReceiverPtr& receiver = ReceiverPtr(),
+                 size_t worker = 0) :
         options_(options),
-        tc_(options, socket)
+        tc_(options, socket, receiver, worker)
     {
         if (options_.getIpVersion() == 4) {
             stage1_xchg_ = ExchangeType::DO;
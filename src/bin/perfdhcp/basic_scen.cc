@@ -6,9 +6,14 @@
 
 #include <perfdhcp/basic_scen.h>
 
+#include <util/threads/thread.h>
 
+#include <boost/bind.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 
+#include <algorithm>
+#include <vector>
+
 using namespace std;
 using namespace boost::posix_time;
 using namespace isc;
@@ -44,14 +49,14 @@ BasicScen::checkExitConditions() {
     // Check if we reached maximum number of DISCOVER/SOLICIT sent.
     if (options_.getNumRequests().size() > 0) {
         if (stats_mgr.getSentPacketsNum(stage1_xchg_) >=
-            options_.getNumRequests()[0]) {
+            tc_.getWorkerShare(options_.getNumRequests()[0])) {
             max_requests = true;
         }
     }
     // Check if we reached maximum number REQUEST packets.
     if (options_.getNumRequests().size() > 1) {
         if (stats_mgr.getSentPacketsNum(stage2_xchg_) >=
-            options_.getNumRequests()[1]) {
+            tc_.getWorkerShare(options_.getNumRequests()[1])) {
             max_requests = true;
         }
     }
@@ -66,16 +71,18 @@ BasicScen::checkExitConditions() {
 
     // Check if we reached maximum number of drops of OFFER/ADVERTISE packets.
     bool max_drops = false;
+    // The drops limit is divided between workers but it must not drop
+    // to zero as it would end the test immediately.
     if (options_.getMaxDrop().size() > 0) {
         if (stats_mgr.getDroppedPacketsNum(stage1_xchg_) >=
-            options_.getMaxDrop()[0]) {
+            std::max<uint64_t>(tc_.getWorkerShare(options_.getMaxDrop()[0]), 1)) {
             max_drops = true;
         }
     }
     // Check if we reached maximum number of drops of ACK/REPLY packets.
     if (options_.getMaxDrop().size() > 1) {
         if (stats_mgr.getDroppedPacketsNum(stage2_xchg_) >=
-            options_.getMaxDrop()[1]) {
+            std::max<uint64_t>(tc_.getWorkerShare(options_.getMaxDrop()[1]), 1)) {
             max_drops = true;
         }
     }
@@ -120,21 +127,18 @@ BasicScen::checkExitConditions() {
     return (false);
 }
 
-int
-BasicScen::run() {
-    StatsMgr& stats_mgr(tc_.getStatsMgr());
-
+void
+BasicScen::preload() {
     // Preload server with the number of packets.
-    if (options_.getPreload() > 0) {
-        tc_.sendPackets(options_.getPreload(), true);
-    }
-
-    // Fork and run command specified with -w<wrapped-command>
-    if (!options_.getWrapped().empty()) {
-        tc_.runWrapped();
+    uint64_t preload = tc_.getWorkerShare(options_.getPreload());
+    if (preload > 0) {
+        tc_.sendPackets(preload, true);
     }
+}
 
-    tc_.start();
+void
+BasicScen::runLoop() {
+    StatsMgr& stats_mgr(tc_.getStatsMgr());
 
     for (;;) {
         // Calculate number of packets to be sent to stay
@@ -191,8 +195,9 @@ BasicScen::run() {
         }
 
         // Report delay means that user requested printing number
-        // of sent/received/dropped packets repeatedly.
-        if (options_.getReportDelay() > 0) {
+        // of sent/received/dropped packets repeatedly. Only the first
+        // worker prints them.
+        if ((options_.getReportDelay() > 0) && (tc_.getWorker() == 0)) {
             tc_.printIntermediateStats();
         }
 
@@ -204,9 +209,78 @@ BasicScen::run() {
         // searches in the long list of Reply packets increases CPU utilization.
         tc_.cleanCachedPackets();
     }
+}
+
+int
+BasicScen::run() {
+    StatsMgr& stats_mgr(tc_.getStatsMgr());
+
+    // Create other workers. They share the receiver of this one
+    // which dispatches responses to them by transaction id.
+    std::vector<boost::shared_ptr<BasicScen> > workers;
+    for (size_t i = 1; i < options_.getWorkers(); ++i) {
+        workers.push_back(boost::shared_ptr<BasicScen>(
+            new BasicScen(options_, socket_, tc_.getReceiver(), i)));
+    }
+
+    preload();
+    for (auto const& worker : workers) {
+        worker->preload();
+    }
+
+    // Fork and run command specified with -w<wrapped-command>
+    if (!options_.getWrapped().empty()) {
+        tc_.runWrapped();
+    }
+
+    tc_.start();
+
+    std::vector<boost::shared_ptr<util::thread::Thread> > threads;
+    for (auto const& worker : workers) {
+        threads.push_back(boost::shared_ptr<util::thread::Thread>(
+            new util::thread::Thread(boost::bind(&BasicScen::runLoop,
+                                                 worker.get()))));
+    }
+
+    // Wait for other workers. If any of them fails the remaining
+    // ones are stopped and the error is reported once all are done.
+    std::string error;
+    auto wait_workers = [this, &threads, &error]() {
+        for (auto const& thread : threads) {
+            try {
+                thread->wait();
+            } catch (const std::exception& ex) {
+                tc_.interrupt();
+                if (error.empty()) {
+                    error = ex.what();
+                }
+            }
+        }
+    };
+
+    try {
+        runLoop();
+    } catch (...) {
+        // Make other workers stop before their objects are destroyed.
+        tc_.interrupt();
+        wait_workers();
+        tc_.stop();
+        throw;
+    }
+
+    wait_workers();
+    if (!error.empty()) {
+        tc_.stop();
+        isc_throw(Unexpected, "worker failed: " << error);
+    }
 
     tc_.stop();
 
+    // Combine statistics gathered by all workers.
+    for (auto const& worker : workers) {
+        stats_mgr.merge(worker->tc_.getStatsMgr());
+    }
+
     tc_.printStats();
 
     if (!options_.getWrapped().empty()) {
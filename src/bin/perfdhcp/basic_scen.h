@@ -24,14 +24,23 @@ class BasicScen : public AbstractScen {
 public:
     /// \brief Default and the only constructor of BasicScen.
     ///
+    /// When more than one worker is used each of them is given an even
+    /// share of the configured rates and limits.
+    ///
     /// \param options reference to command options,
-    /// \param socket reference to a socket.
-    BasicScen(CommandOptions& options, BasePerfSocket &socket):
-        AbstractScen(options, socket)
+    /// \param socket reference to a socket,
+    /// \param receiver receiver shared between workers; if null
+    /// a new one is created,
+    /// \param worker index of the worker running the scenario.
+    BasicScen(CommandOptions& options, BasePerfSocket &socket,
+              const ReceiverPtr& receiver = ReceiverPtr(),
+              size_t worker = 0):
+        AbstractScen(options, socket, receiver, worker),
+        socket_(socket)
     {
-        basic_rate_control_.setRate(options_.getRate());
-        renew_rate_control_.setRate(options_.getRenewRate());
-        release_rate_control_.setRate(options_.getReleaseRate());
+        basic_rate_control_.setRate(tc_.getWorkerShare(options_.getRate()));
+        renew_rate_control_.setRate(tc_.getWorkerShare(options_.getRenewRate()));
+        release_rate_control_.setRate(tc_.getWorkerShare(options_.getReleaseRate()));
     };
 
     /// brief\ Run performance test.
@@ -46,6 +55,9 @@ public:
     int run() override;
 
 protected:
+    /// \brief Reference to a socket used to create other workers.
+    BasePerfSocket& socket_;
+
     /// \brief A rate control class for Discover and Solicit messages.
     RateControl basic_rate_control_;
     /// \brief A rate control class for Renew messages.
@@ -64,6 +76,12 @@ protected:
     ///
     /// \return true if any of the exit conditions is fulfilled.
     bool checkExitConditions();
+
+    /// \brief Preload server with the share of packets of this worker.
+    void preload();
+
+    /// \brief Run the main loop of the test until exit conditions are met.
+    void runLoop();
 };
 
 }
@@ -157,6 +157,12 @@ CommandOptions::reset() {
         single_thread_mode_ = false;
     }
     scenario_ = Scenario::BASIC;
+    workers_ = 1;
+    report_format_ = ReportFormat::TEXT;
+    renew_time_ = 0;
+    rebind_time_ = 0;
+    release_ratio_ = 0;
+    storm_time_ = 0;
 }
 
 bool
@@ -206,6 +212,12 @@ CommandOptions::parse(int argc, char** const argv, bool print_cmd_line) {
 }
 
 const int LONG_OPT_SCENARIO = 300;
+const int LONG_OPT_WORKERS = 301;
+const int LONG_OPT_REPORT_FORMAT = 302;
+const int LONG_OPT_RENEW_TIME = 303;
+const int LONG_OPT_REBIND_TIME = 304;
+const int LONG_OPT_RELEASE_RATIO = 305;
+const int LONG_OPT_STORM_TIME = 306;
 
 bool
 CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
@@ -225,6 +237,12 @@ CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
 
     struct option long_options[] = {
         {"scenario", required_argument, 0, LONG_OPT_SCENARIO},
+        {"workers",  required_argument, 0, LONG_OPT_WORKERS},
+        {"report-format", required_argument, 0, LONG_OPT_REPORT_FORMAT},
+        {"renew-time", required_argument, 0, LONG_OPT_RENEW_TIME},
+        {"rebind-time", required_argument, 0, LONG_OPT_REBIND_TIME},
+        {"release-ratio", required_argument, 0, LONG_OPT_RELEASE_RATIO},
+        {"storm-time", required_argument, 0, LONG_OPT_STORM_TIME},
         {0,          0,                 0, 0}
     };
 
@@ -555,11 +573,54 @@ CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
                 scenario_ = Scenario::BASIC;
             } else if (optarg_text == "avalanche") {
                 scenario_ = Scenario::AVALANCHE;
+            } else if (optarg_text == "lifecycle") {
+                scenario_ = Scenario::LIFECYCLE;
             } else {
-                isc_throw(InvalidParameter, "scenario value '" << optarg << "' is wrong - should be 'basic' or 'avalanche'");
+                isc_throw(InvalidParameter, "scenario value '" << optarg << "' is wrong - should be 'basic', 'avalanche' or 'lifecycle'");
             }
             break;
         }
+
+        case LONG_OPT_WORKERS:
+            workers_ = positiveInteger("value of workers: --workers<value>"
+                                       " must be a positive integer");
+            break;
+
+        case LONG_OPT_REPORT_FORMAT: {
+            auto optarg_text = std::string(optarg);
+            if (optarg_text == "text") {
+                report_format_ = ReportFormat::TEXT;
+            } else if (optarg_text == "json") {
+                report_format_ = ReportFormat::JSON;
+            } else if (optarg_text == "csv") {
+                report_format_ = ReportFormat::CSV;
+            } else {
+                isc_throw(InvalidParameter, "report format value '" << optarg << "' is wrong - should be 'text', 'json' or 'csv'");
+            }
+            break;
+        }
+
+        case LONG_OPT_RENEW_TIME:
+            renew_time_ = positiveInteger("value of renew time: --renew-time<value>"
+                                          " must be a positive integer");
+            break;
+
+        case LONG_OPT_REBIND_TIME:
+            rebind_time_ = positiveInteger("value of rebind time: --rebind-time<value>"
+                                           " must be a positive integer");
+            break;
+
+        case LONG_OPT_RELEASE_RATIO:
+            release_ratio_ = nonNegativeInteger("value of release ratio:"
+                                                " --release-ratio<value> must"
+                                                " be a non-negative integer");
+            break;
+
+        case LONG_OPT_STORM_TIME:
+            storm_time_ = positiveInteger("value of storm time: --storm-time<value>"
+                                          " must be a positive integer");
+            break;
+
         default:
             isc_throw(isc::InvalidParameter, "wrong command line option");
         }
@@ -614,12 +675,18 @@ CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
         std::cout << "Scenario: basic." << std::endl;
     } else if (scenario_ == Scenario::AVALANCHE) {
         std::cout << "Scenario: avalanche." << std::endl;
+    } else if (scenario_ == Scenario::LIFECYCLE) {
+        std::cout << "Scenario: lifecycle." << std::endl;
     }
 
     if (!isSingleThreaded()) {
         std::cout << "Multi-thread mode enabled." << std::endl;
     }
 
+    if (workers_ > 1) {
+        std::cout << "Workers: " << workers_ << "." << std::endl;
+    }
+
     // Handle the local '-l' address/interface
     if (!localname_.empty()) {
         if (server_name_.empty()) {
@@ -914,6 +981,29 @@ CommandOptions::validate() {
           "use -I<ip-offset>");
     check((!getMacListFile().empty() && base_.size() > 0),
           "Can't use -b with -M option");
+    check((getWorkers() > MAX_WORKERS),
+          "--workers<value> must not be greater than 256");
+    check((getWorkers() > 1) && isSingleThreaded(),
+          "--workers<value> greater than 1 requires multi-thread mode (-g multi)");
+    check((getWorkers() > 1) && (getScenario() != Scenario::BASIC),
+          "--workers<value> greater than 1 may be used with basic scenario only");
+    check((getWorkers() > 1) && (getClientsNum() > 1) &&
+          (getClientsNum() < getWorkers()),
+          "-R<range> must not be lower than --workers<value>");
+    check((getWorkers() > 1) && (getRate() != 0) &&
+          (static_cast<size_t>(getRate()) < getWorkers()),
+          "-r<rate> must not be lower than --workers<value>");
+    check((getWorkers() > 1) && (getRenewRate() != 0) &&
+          (static_cast<size_t>(getRenewRate()) < getWorkers()),
+          "-f<renew-rate> must not be lower than --workers<value>");
+    check((getWorkers() > 1) && (getReleaseRate() != 0) &&
+          (static_cast<size_t>(getReleaseRate()) < getWorkers()),
+          "-F<release-rate> must not be lower than --workers<value>");
+    check((getScenario() != Scenario::LIFECYCLE) &&
+          ((getRenewTime() != 0) || (getRebindTime() != 0) ||
+           (getReleaseRatio() != 0) || (getStormTime() != 0)),
+          "--renew-time, --rebind-time, --release-ratio and --storm-time"
+          " may be used with lifecycle scenario only");
 
     auto nthreads = std::thread::hardware_concurrency();
     if (nthreads == 1 && isSingleThreaded() == false) {
@@ -938,6 +1028,36 @@ CommandOptions::validate() {
             std::cout << "INFO: in avalanche scenario drop time is ignored" << std::endl;
         }
     }
+
+    if (scenario_ == Scenario::LIFECYCLE) {
+        check(getClientsNum() <= 0,
+              "in case of lifecycle scenario number\nof clients must be specified"
+              " using -R option explicitly");
+        check(getExchangeMode() == DO_SA,
+              "-i is not compatible with lifecycle scenario");
+        check(!getLeaseType().is(LeaseType::ADDRESS),
+              "lifecycle scenario may be only used with '-e address-only'");
+        check(!getMacListFile().empty(),
+              "-M<mac-list-file> is not compatible with lifecycle scenario");
+        check((getPeriod() == 0) && (getStormTime() == 0),
+              "in case of lifecycle scenario either -p<test-period> or"
+              " --storm-time<value> must be specified");
+        check((getPeriod() != 0) && (getStormTime() >= getPeriod()),
+              "--storm-time<value> must be lower than -p<test-period>");
+        check((getRenewTime() != 0) && (getRebindTime() != 0) &&
+              (getRebindTime() <= getRenewTime()),
+              "--rebind-time<value> must be greater than --renew-time<value>");
+        check(getReleaseRatio() > 100,
+              "--release-ratio<value> must not be greater than 100");
+
+        // Clients retransmit on their own so outstanding exchanges are
+        // dropped only after the longest retransmission interval.
+        double dt[2] = { 65.0, 65.0 };
+        drop_time_.assign(dt, dt + 2);
+        if (drop_time_set_) {
+            std::cout << "INFO: in lifecycle scenario drop time is ignored" << std::endl;
+        }
+    }
 }
 
 void
@@ -1095,6 +1215,24 @@ CommandOptions::printCommandLine() const {
     } else {
         std::cout << "multi-thread-mode" << std::endl;
     }
+    std::cout << "workers=" << workers_ << std::endl;
+    if (report_format_ == ReportFormat::JSON) {
+        std::cout << "report-format=json" << std::endl;
+    } else if (report_format_ == ReportFormat::CSV) {
+        std::cout << "report-format=csv" << std::endl;
+    }
+    if (renew_time_ != 0) {
+        std::cout << "renew-time=" << renew_time_ << std::endl;
+    }
+    if (rebind_time_ != 0) {
+        std::cout << "rebind-time=" << rebind_time_ << std::endl;
+    }
+    if (release_ratio_ != 0) {
+        std::cout << "release-ratio=" << release_ratio_ << std::endl;
+    }
+    if (storm_time_ != 0) {
+        std::cout << "storm-time=" << storm_time_ << std::endl;
+    }
 }
 
 void
@@ -1133,6 +1271,11 @@ CommandOptions::usage() const {
         "messages as request in -R option then back off mechanism is used for\n"
         "each simulated client until all requests are answered. At the end\n"
         "time of whole scenario is reported.\n"
+        "The lifecycle scenario, selected by --scenario lifecycle, simulates\n"
+        "as many stateful clients as given in -R option. Clients obtain leases\n"
+        "at the rate given by -r option, renew them at T1, rebind at T2 and\n"
+        "start over when the lease expires. A reboot storm makes all clients\n"
+        "reconnect at once. Statistics are reported for each phase of the test.\n"
         "\n"
         "Options:\n"
         "-1: Take the server-ID option from the first received message.\n"
@@ -1195,7 +1338,26 @@ CommandOptions::usage() const {
         "-R<range>: Specify how many different clients are used. With 1\n"
         "    (the default), all requests seem to come from the same client.\n"
         "-s<seed>: Specify the seed for randomization, making it repeatable.\n"
-        "--scenario <name>: where name is 'basic' (default) or 'avalanche'.\n"
+        "--scenario <name>: where name is 'basic' (default), 'avalanche' or\n"
+        "    'lifecycle'.\n"
+        "--renew-time <T1>: Time in seconds after which the lifecycle scenario\n"
+        "    clients renew their leases. By default the server's value is used.\n"
+        "--rebind-time <T2>: Time in seconds after which the lifecycle scenario\n"
+        "    clients rebind their leases. By default the server's value is used.\n"
+        "--release-ratio <percent>: Percentage of the lifecycle scenario\n"
+        "    clients releasing their leases at T1 instead of renewing them.\n"
+        "    Such clients reconnect later on (default 0).\n"
+        "--storm-time <time>: Time in seconds since the start of the lifecycle\n"
+        "    scenario after which all clients reboot and reconnect at once.\n"
+        "--report-format <format>: Format of the intermediate reports, either\n"
+        "    'text' (default), 'json' or 'csv'. JSON and CSV reports give the\n"
+        "    delay percentiles of each exchange in the last interval, and\n"
+        "    the final report is appended in the same format.\n"
+        "--workers <N>: Number of workers generating load (default 1). Each\n"
+        "    worker sends its share of the rate from its own thread using its\n"
+        "    own range of client identifiers and transaction ids. Responses\n"
+        "    are dispatched to workers by transaction id. Requires multi-thread\n"
+        "    mode and the basic scenario.\n"
         "-S<srvid-offset>: Offset of the server-ID option in the\n"
         "    (second/request) template.\n"
         "-T<template-file>: The name of a file containing the template to use\n"
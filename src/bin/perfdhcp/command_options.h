@@ -19,7 +19,14 @@ namespace perfdhcp {
 
 enum class Scenario {
     BASIC,
-    AVALANCHE
+    AVALANCHE,
+    LIFECYCLE
+};
+
+enum class ReportFormat {
+    TEXT,
+    JSON,
+    CSV
 };
 
 /// \brief Command Options.
@@ -38,6 +45,12 @@ public:
         reset();
     }
 
+    /// @brief Maximum number of workers.
+    ///
+    /// The worker index is carried in the top byte of the transaction id
+    /// so no more than 256 workers may be used.
+    static const size_t MAX_WORKERS = 256;
+
     /// @brief A vector holding MAC addresses.
     typedef std::vector<std::vector<uint8_t> > MacAddrsVector;
 
@@ -360,6 +373,37 @@ public:
     /// \return enum Scenario.
     Scenario getScenario() const { return scenario_; }
 
+    /// \brief Returns format of the reports.
+    ///
+    /// \return enum ReportFormat.
+    ReportFormat getReportFormat() const { return report_format_; }
+
+    /// \brief Returns number of load generating workers.
+    ///
+    /// \return number of workers sending and processing packets.
+    size_t getWorkers() const { return workers_; }
+
+    /// \brief Returns renew time (T1) of the lifecycle scenario.
+    ///
+    /// \return renew time in seconds, 0 if the server's value is used.
+    int getRenewTime() const { return renew_time_; }
+
+    /// \brief Returns rebind time (T2) of the lifecycle scenario.
+    ///
+    /// \return rebind time in seconds, 0 if the server's value is used.
+    int getRebindTime() const { return rebind_time_; }
+
+    /// \brief Returns percentage of clients releasing instead of renewing.
+    ///
+    /// \return release ratio in percent (0..100).
+    int getReleaseRatio() const { return release_ratio_; }
+
+    /// \brief Returns time of the reboot storm of the lifecycle scenario.
+    ///
+    /// \return time since the start of the test in seconds, 0 if no
+    /// reboot storm is triggered.
+    int getStormTime() const { return storm_time_; }
+
     /// \brief Returns server name.
     ///
     /// \return server name.
@@ -675,6 +719,28 @@ private:
 
     /// @brief Selected performance scenario. Default is basic.
     Scenario scenario_;
+
+    /// @brief Number of load generating workers. Default is 1.
+    size_t workers_;
+
+    /// @brief Format of the reports. Default is text.
+    ReportFormat report_format_;
+
+    /// @brief Renew time (T1) of the lifecycle scenario in seconds.
+    /// Default is 0 which means the value sent by the server.
+    int renew_time_;
+
+    /// @brief Rebind time (T2) of the lifecycle scenario in seconds.
+    /// Default is 0 which means the value sent by the server.
+    int rebind_time_;
+
+    /// @brief Percentage of the lifecycle scenario clients releasing
+    /// their leases instead of renewing them. Default is 0.
+    int release_ratio_;
+
+    /// @brief Time of the reboot storm of the lifecycle scenario in
+    /// seconds since the start of the test. Default is 0 (no storm).
+    int storm_time_;
 };
 
 }  // namespace perfdhcp
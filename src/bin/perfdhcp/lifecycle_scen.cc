@@ -0,0 +1,605 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <perfdhcp/lifecycle_scen.h>
+
+#include <dhcp/dhcp4.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/option6_ia.h>
+#include <dhcp/option6_iaaddr.h>
+#include <dhcp/option6_status_code.h>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+using namespace std;
+using namespace boost::posix_time;
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+
+
+namespace isc {
+namespace perfdhcp {
+
+namespace {
+
+/// \brief Returns value of the option carrying 32-bit unsigned integer.
+///
+/// \param opt option or null.
+/// \return value of the option or 0 if the option is not present.
+uint32_t
+getOptionValue(const OptionPtr& opt) {
+    if (!opt) {
+        return (0);
+    }
+    std::vector<uint8_t> buf = opt->toBinary(false);
+    if (buf.size() < sizeof(uint32_t)) {
+        return (0);
+    }
+    return ((static_cast<uint32_t>(buf[0]) << 24) |
+            (static_cast<uint32_t>(buf[1]) << 16) |
+            (static_cast<uint32_t>(buf[2]) << 8) |
+            static_cast<uint32_t>(buf[3]));
+}
+
+}
+
+LifecycleScen::PhaseStats::PhaseStats() :
+    start_(not_a_date_time),
+    end_(not_a_date_time),
+    initiated_(0),
+    renews_(0),
+    rebinds_(0),
+    reboots_(0),
+    releases_(0),
+    retransmissions_(0),
+    leases_(0),
+    naks_(0),
+    expired_(0),
+    latency_() {
+}
+
+LifecycleScen::LifecycleScen(CommandOptions& options, BasePerfSocket &socket) :
+    AbstractScen(options, socket),
+    client_gen_(new ClientGenerator()),
+    rate_control_(options.getRate()),
+    clients_(options.getClientsNum() == 0 ? 1 : options.getClientsNum()),
+    next_client_(0),
+    leased_(0),
+    start_(microsec_clock::universal_time()),
+    storm_triggered_(false),
+    phase_(Phase::BRING_UP) {
+    // New exchanges are started for the clients selected by the scenario.
+    tc_.setMacAddrGenerator(client_gen_);
+    tc_.setPacketHandler([this](const PktPtr& pkt) { processPacket(pkt); });
+}
+
+std::string
+LifecycleScen::phaseToText(Phase phase) {
+    switch (phase) {
+    case Phase::BRING_UP:
+        return ("bring-up");
+    case Phase::STEADY:
+        return ("steady");
+    case Phase::STORM:
+        return ("storm");
+    case Phase::RECOVERED:
+        return ("recovered");
+    default:
+        return ("unknown");
+    }
+}
+
+uint32_t
+LifecycleScen::getTime() const {
+    time_period period(start_, microsec_clock::universal_time());
+    uint64_t now = period.length().total_milliseconds();
+    return (static_cast<uint32_t>(std::min(now, static_cast<uint64_t>(NO_TIMER - 1))));
+}
+
+uint32_t
+LifecycleScen::getDeadline(uint32_t now, uint64_t seconds) {
+    uint64_t deadline = now + seconds * 1000;
+    return (static_cast<uint32_t>(std::min(deadline, static_cast<uint64_t>(NO_TIMER))));
+}
+
+uint32_t
+LifecycleScen::getRetransmissionDelay(uint8_t retries) {
+    uint32_t delay = 1000 << std::min(retries, static_cast<uint8_t>(6));
+    // Randomize by +/- 10% so as the clients do not retransmit in sync.
+    return (delay - delay / 10 + random() % (delay / 5 + 1));
+}
+
+bool
+LifecycleScen::isLeased(const Client& client) {
+    return ((client.state_ == ClientState::BOUND) ||
+            (client.state_ == ClientState::RENEWING) ||
+            (client.state_ == ClientState::REBINDING));
+}
+
+void
+LifecycleScen::setTimer(uint32_t client, uint32_t time, uint32_t limit) {
+    time = std::min(time, limit);
+    clients_[client].timer_ = time;
+    if (time != NO_TIMER) {
+        timers_.push(Timer(time, client));
+    }
+}
+
+size_t
+LifecycleScen::startClients(uint32_t now) {
+    size_t started = 0;
+    if (next_client_ >= clients_.size()) {
+        return (started);
+    }
+    uint64_t due = rate_control_.getOutboundMessageCount();
+    for (; (due > 0) && (next_client_ < clients_.size()); --due) {
+        sendDiscover(next_client_++, now);
+        ++started;
+    }
+    return (started);
+}
+
+void
+LifecycleScen::triggerStorm(uint32_t now) {
+    storm_triggered_ = true;
+    changePhase(Phase::STORM);
+    std::cout << "Reboot storm: " << clients_.size() << " clients"
+              << " reconnect, " << leased_ << " of them had leases."
+              << std::endl;
+    // All clients lose their transient state. The ones with unexpired
+    // leases confirm them, the others start over. The timers are due
+    // now so as the messages are sent in batches between receiving.
+    leased_ = 0;
+    for (uint32_t client = 0; client < clients_.size(); ++client) {
+        clients_[client].state_ = ClientState::INIT;
+        clients_[client].retries_ = 0;
+        setTimer(client, now);
+    }
+    next_client_ = clients_.size();
+}
+
+size_t
+LifecycleScen::processTimers(uint32_t now) {
+    size_t processed = 0;
+    while (!timers_.empty() && (timers_.top().first <= now) &&
+           (processed < TIMERS_BATCH)) {
+        Timer timer = timers_.top();
+        timers_.pop();
+        // The timer is stale if it has been replaced or cancelled.
+        Client& client = clients_[timer.second];
+        if (client.timer_ != timer.first) {
+            continue;
+        }
+        client.timer_ = NO_TIMER;
+        handleTimer(timer.second, now);
+        ++processed;
+    }
+    return (processed);
+}
+
+void
+LifecycleScen::handleTimer(uint32_t client, uint32_t now) {
+    Client& c = clients_[client];
+    PhaseStats& stats = getCurrentStats();
+    switch (c.state_) {
+    case ClientState::INIT:
+    case ClientState::RELEASED:
+        if (c.expire_ > now) {
+            // The client rebooted with an unexpired lease.
+            c.state_ = ClientState::REBOOTING;
+            c.started_ = now;
+            c.retries_ = 0;
+            ++stats.reboots_;
+            sendLeaseMessage(client, TestControl::LeaseMessage::REBOOT);
+            setTimer(client, now + getRetransmissionDelay(0));
+        } else {
+            sendDiscover(client, now);
+        }
+        break;
+
+    case ClientState::SELECTING:
+        ++c.retries_;
+        ++stats.retransmissions_;
+        client_gen_->setNext(client);
+        tc_.sendPackets(1);
+        setTimer(client, now + getRetransmissionDelay(c.retries_));
+        break;
+
+    case ClientState::BOUND:
+        if ((options_.getReleaseRatio() > 0) &&
+            (random() % 100 < options_.getReleaseRatio())) {
+            // Reconnect within the renew time of the released lease.
+            uint32_t t1 = now - c.started_;
+            ++stats.releases_;
+            sendLeaseMessage(client, TestControl::LeaseMessage::RELEASE);
+            dropLease(client);
+            c.state_ = ClientState::RELEASED;
+            setTimer(client, now + random() % (t1 + 1));
+        } else {
+            c.state_ = ClientState::RENEWING;
+            c.started_ = now;
+            c.retries_ = 0;
+            ++stats.renews_;
+            sendLeaseMessage(client, TestControl::LeaseMessage::RENEW);
+            setTimer(client, now + getRetransmissionDelay(0), c.rebind_);
+        }
+        break;
+
+    case ClientState::RENEWING:
+        if (now >= c.rebind_) {
+            c.state_ = ClientState::REBINDING;
+            c.retries_ = 0;
+            ++stats.rebinds_;
+            sendLeaseMessage(client, TestControl::LeaseMessage::REBIND);
+            setTimer(client, now + getRetransmissionDelay(0), c.expire_);
+        } else {
+            ++c.retries_;
+            ++stats.retransmissions_;
+            sendLeaseMessage(client, TestControl::LeaseMessage::RENEW);
+            setTimer(client, now + getRetransmissionDelay(c.retries_),
+                     c.rebind_);
+        }
+        break;
+
+    case ClientState::REBINDING:
+        if (now >= c.expire_) {
+            ++stats.expired_;
+            dropLease(client);
+            sendDiscover(client, now);
+        } else {
+            ++c.retries_;
+            ++stats.retransmissions_;
+            sendLeaseMessage(client, TestControl::LeaseMessage::REBIND);
+            setTimer(client, now + getRetransmissionDelay(c.retries_),
+                     c.expire_);
+        }
+        break;
+
+    case ClientState::REBOOTING:
+        if ((c.retries_ >= MAX_REBOOT_RETRIES) || (now >= c.expire_)) {
+            // No confirmation, the client forgets the lease.
+            c.expire_ = 0;
+            sendDiscover(client, now);
+        } else {
+            ++c.retries_;
+            ++stats.retransmissions_;
+            sendLeaseMessage(client, TestControl::LeaseMessage::REBOOT);
+            setTimer(client, now + getRetransmissionDelay(c.retries_));
+        }
+        break;
+    }
+}
+
+void
+LifecycleScen::sendDiscover(uint32_t client, uint32_t now) {
+    Client& c = clients_[client];
+    c.state_ = ClientState::SELECTING;
+    c.started_ = now;
+    c.retries_ = 0;
+    ++getCurrentStats().initiated_;
+    client_gen_->setNext(client);
+    tc_.sendPackets(1);
+    setTimer(client, now + getRetransmissionDelay(0));
+}
+
+void
+LifecycleScen::sendLeaseMessage(uint32_t client,
+                                TestControl::LeaseMessage msg) {
+    const Client& c = clients_[client];
+    IOAddress addr = (options_.getIpVersion() == 4 ?
+                      IOAddress::fromBytes(AF_INET, c.addr_) :
+                      IOAddress::fromBytes(AF_INET6, c.addr_));
+    tc_.sendLeaseMessage(msg, client, addr, server_id_);
+}
+
+bool
+LifecycleScen::findClient(const std::vector<uint8_t>& id,
+                          uint32_t& client) const {
+    try {
+        client = tc_.getClientIndex(id);
+    } catch (const isc::BadValue&) {
+        return (false);
+    }
+    return (client < clients_.size());
+}
+
+void
+LifecycleScen::processPacket(const PktPtr& pkt) {
+    uint32_t now = getTime();
+    if (options_.getIpVersion() == 4) {
+        processPacket4(boost::dynamic_pointer_cast<Pkt4>(pkt), now);
+    } else {
+        processPacket6(boost::dynamic_pointer_cast<Pkt6>(pkt), now);
+    }
+}
+
+void
+LifecycleScen::processPacket4(const Pkt4Ptr& pkt4, uint32_t now) {
+    if (!pkt4 || !pkt4->getHWAddr()) {
+        return;
+    }
+    // Offers are answered by the test control.
+    uint8_t type = pkt4->getType();
+    if ((type != DHCPACK) && (type != DHCPNAK)) {
+        return;
+    }
+    uint32_t client = 0;
+    if (!findClient(pkt4->getHWAddr()->hwaddr_, client)) {
+        return;
+    }
+    // Responses to the retransmitted or abandoned messages are ignored.
+    ClientState state = clients_[client].state_;
+    if ((state == ClientState::INIT) || (state == ClientState::BOUND) ||
+        (state == ClientState::RELEASED)) {
+        return;
+    }
+    if ((type == DHCPNAK) || pkt4->getYiaddr().isV4Zero()) {
+        refuse(client, now);
+        return;
+    }
+    OptionPtr server_id = pkt4->getOption(DHO_DHCP_SERVER_IDENTIFIER);
+    if (server_id) {
+        server_id_ = server_id;
+    }
+    uint32_t valid = getOptionValue(pkt4->getOption(DHO_DHCP_LEASE_TIME));
+    if (valid == 0) {
+        valid = 0xFFFFFFFF;
+    }
+    bind(client, pkt4->getYiaddr(),
+         getOptionValue(pkt4->getOption(DHO_DHCP_RENEWAL_TIME)),
+         getOptionValue(pkt4->getOption(DHO_DHCP_REBINDING_TIME)),
+         valid, now);
+}
+
+void
+LifecycleScen::processPacket6(const Pkt6Ptr& pkt6, uint32_t now) {
+    // Advertises are answered by the test control.
+    if (!pkt6 || (pkt6->getType() != DHCPV6_REPLY)) {
+        return;
+    }
+    OptionPtr client_id = pkt6->getOption(D6O_CLIENTID);
+    uint32_t client = 0;
+    if (!client_id || !findClient(client_id->getData(), client)) {
+        return;
+    }
+    ClientState state = clients_[client].state_;
+    if ((state == ClientState::INIT) || (state == ClientState::BOUND) ||
+        (state == ClientState::RELEASED)) {
+        return;
+    }
+    // The lease is refused if there is no address with non-zero
+    // lifetime or the server returned an error status.
+    Option6IAPtr ia = boost::dynamic_pointer_cast<Option6IA>(pkt6->getOption(D6O_IA_NA));
+    Option6IAAddrPtr iaaddr;
+    if (ia) {
+        iaaddr = boost::dynamic_pointer_cast<Option6IAAddr>(ia->getOption(D6O_IAADDR));
+        Option6StatusCodePtr status =
+            boost::dynamic_pointer_cast<Option6StatusCode>(ia->getOption(D6O_STATUS_CODE));
+        if (status && (status->getStatusCode() != STATUS_Success)) {
+            iaaddr.reset();
+        }
+    }
+    if (!iaaddr || (iaaddr->getValid() == 0)) {
+        refuse(client, now);
+        return;
+    }
+    OptionPtr server_id = pkt6->getOption(D6O_SERVERID);
+    if (server_id) {
+        server_id_ = server_id;
+    }
+    bind(client, iaaddr->getAddress(), ia->getT1(), ia->getT2(),
+         iaaddr->getValid(), now);
+}
+
+void
+LifecycleScen::bind(uint32_t client, const IOAddress& addr,
+                    uint32_t t1, uint32_t t2, uint32_t valid, uint32_t now) {
+    Client& c = clients_[client];
+    PhaseStats& stats = getCurrentStats();
+    stats.latency_.record(static_cast<uint64_t>(now - c.started_) * 1000);
+    ++stats.leases_;
+    if (!isLeased(c)) {
+        ++leased_;
+    }
+
+    // Configured timers override the ones sent by the server. Missing
+    // timers are computed from the valid lifetime as RFC 2131 suggests.
+    if (options_.getRenewTime() > 0) {
+        t1 = options_.getRenewTime();
+    } else if (t1 == 0) {
+        t1 = valid / 2;
+    }
+    if (options_.getRebindTime() > 0) {
+        t2 = options_.getRebindTime();
+    } else if (t2 == 0) {
+        t2 = valid / 8 * 7;
+    }
+    t2 = std::min(t2, valid);
+    t1 = std::min(t1, t2);
+
+    const std::vector<uint8_t>& bytes = addr.toBytes();
+    memcpy(c.addr_, &bytes[0], std::min(bytes.size(), sizeof(c.addr_)));
+    c.state_ = ClientState::BOUND;
+    c.retries_ = 0;
+    c.started_ = now;
+    c.rebind_ = getDeadline(now, t2);
+    c.expire_ = getDeadline(now, valid);
+    setTimer(client, getDeadline(now, t1));
+
+    if ((phase_ == Phase::BRING_UP) && (leased_ == clients_.size())) {
+        changePhase(Phase::STEADY);
+    } else if ((phase_ == Phase::STORM) && (leased_ == clients_.size())) {
+        changePhase(Phase::RECOVERED);
+    }
+}
+
+void
+LifecycleScen::refuse(uint32_t client, uint32_t now) {
+    ++getCurrentStats().naks_;
+    dropLease(client);
+    // Start over after a while so as the clients do not flood the
+    // server refusing the leases.
+    clients_[client].state_ = ClientState::INIT;
+    setTimer(client, now + getRetransmissionDelay(0));
+}
+
+void
+LifecycleScen::dropLease(uint32_t client) {
+    Client& c = clients_[client];
+    if (isLeased(c)) {
+        --leased_;
+    }
+    c.expire_ = 0;
+}
+
+void
+LifecycleScen::changePhase(Phase phase) {
+    auto now = microsec_clock::universal_time();
+    PhaseStats& current = getCurrentStats();
+    current.end_ = now;
+    std::cout << now << " phase " << phaseToText(phase_) << " finished, "
+              << leased_ << " of " << clients_.size() << " clients have leases."
+              << std::endl;
+    phase_ = phase;
+    getCurrentStats().start_ = now;
+}
+
+bool
+LifecycleScen::checkExitConditions() {
+    if (tc_.interrupted()) {
+        if (options_.testDiags('e')) {
+            std::cout << "Interrupted" << std::endl;
+        }
+        return (true);
+    }
+    if (options_.getPeriod() != 0) {
+        time_period period(start_, microsec_clock::universal_time());
+        if (period.length().total_seconds() >= options_.getPeriod()) {
+            if (options_.testDiags('e')) {
+                std::cout << "reached test-period." << std::endl;
+            }
+            return (true);
+        }
+    } else if (phase_ == Phase::RECOVERED) {
+        // Without the test period the test ends after the storm.
+        if (options_.testDiags('e')) {
+            std::cout << "recovered from the reboot storm." << std::endl;
+        }
+        return (true);
+    }
+    return (false);
+}
+
+void
+LifecycleScen::printPhaseStats(Phase phase) const {
+    const PhaseStats& stats = getPhaseStats(phase);
+    if (stats.start_.is_not_a_date_time()) {
+        return;
+    }
+    ptime end = stats.end_;
+    if (end.is_not_a_date_time()) {
+        end = microsec_clock::universal_time();
+    }
+    time_period duration(stats.start_, end);
+    std::cout << "***Phase " << phaseToText(phase) << "***" << std::endl
+              << "duration: " << duration.length() << std::endl
+              << "initiated: " << stats.initiated_ << std::endl
+              << "renews: " << stats.renews_ << std::endl
+              << "rebinds: " << stats.rebinds_ << std::endl
+              << "reboots: " << stats.reboots_ << std::endl
+              << "releases: " << stats.releases_ << std::endl
+              << "retransmissions: " << stats.retransmissions_ << std::endl
+              << "leases: " << stats.leases_ << std::endl
+              << "refused: " << stats.naks_ << std::endl
+              << "expired: " << stats.expired_ << std::endl;
+    if (stats.latency_.getCount() > 0) {
+        std::cout << std::fixed << std::setprecision(3)
+                  << "lease time p50: "
+                  << stats.latency_.getPercentile(50) / 1e3 << " ms" << std::endl
+                  << "lease time p90: "
+                  << stats.latency_.getPercentile(90) / 1e3 << " ms" << std::endl
+                  << "lease time p99: "
+                  << stats.latency_.getPercentile(99) / 1e3 << " ms" << std::endl
+                  << "lease time p99.9: "
+                  << stats.latency_.getPercentile(99.9) / 1e3 << " ms" << std::endl;
+    }
+}
+
+int
+LifecycleScen::run() {
+    // Clients are started at the given rate. Each of them has at most
+    // one pending timer: retransmission, T1, T2 or the lease expiration.
+    // In a loop the due timers are processed in batches, then received
+    // packets update the states of the clients. Server responses are
+    // matched to the clients by MAC address (DHCPv4) or DUID (DHCPv6).
+    StatsMgr& stats_mgr(tc_.getStatsMgr());
+
+    tc_.start();
+
+    start_ = microsec_clock::universal_time();
+    phase_ = Phase::BRING_UP;
+    getCurrentStats().start_ = start_;
+
+    for (;;) {
+        uint32_t now = getTime();
+
+        if ((options_.getStormTime() != 0) && !storm_triggered_ &&
+            (now >= static_cast<uint32_t>(options_.getStormTime()) * 1000)) {
+            triggerStorm(now);
+        }
+
+        size_t work = startClients(now);
+        work += processTimers(now);
+
+        // Pull some packets from receiver thread, process them, update
+        // the clients and respond to the server if needed.
+        work += tc_.consumeReceivedPackets();
+
+        // Do some sleep if there is nothing to do to not consume 100% CPU.
+        if (work == 0) {
+            usleep(1);
+        }
+
+        if (options_.getReportDelay() > 0) {
+            tc_.printIntermediateStats();
+        }
+
+        if (checkExitConditions()) {
+            break;
+        }
+    }
+
+    getCurrentStats().end_ = microsec_clock::universal_time();
+
+    tc_.stop();
+
+    tc_.printStats();
+
+    for (size_t phase = 0; phase < PHASES_NUM; ++phase) {
+        printPhaseStats(static_cast<Phase>(phase));
+    }
+
+    // Print packet timestamps
+    if (options_.testDiags('t')) {
+        stats_mgr.printTimestamps();
+    }
+
+    // Print server id.
+    if (options_.testDiags('s') && tc_.serverIdReceived()) {
+        std::cout << "Server id: " << tc_.getServerId() << std::endl;
+    }
+
+    return (0);
+}
+
+}
+}
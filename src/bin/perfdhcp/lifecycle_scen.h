@@ -0,0 +1,343 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef LIFECYCLE_SCEN_H
+#define LIFECYCLE_SCEN_H
+
+#include <config.h>
+
+#include <perfdhcp/abstract_scen.h>
+#include <perfdhcp/rate_control.h>
+#include <util/latency_histogram.h>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <array>
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace isc {
+namespace perfdhcp {
+
+/// \brief Lifecycle Scenario class.
+///
+/// This class is used to run the performance test where the simulated
+/// clients go through the whole lease lifecycle. Clients obtain leases
+/// with DORA or SARR exchanges at the configured rate, renew them at T1,
+/// rebind at T2 and start over when the leases expire. Some clients may
+/// release their leases and reconnect later. A reboot storm makes all
+/// clients reconnect at once as after the power is restored.
+///
+/// The state of each client is kept in a compact table indexed by the
+/// client number which is decoded from the MAC address or DUID found in
+/// the server responses, so the sent and received packets are not stored.
+/// Pending timers of the clients are kept in a single priority queue.
+class LifecycleScen : public AbstractScen {
+public:
+    /// \brief States of the simulated client.
+    enum class ClientState : uint8_t {
+        INIT,       ///< No lease, new exchange is to be started.
+        SELECTING,  ///< Discover or Solicit sent, waiting for the lease.
+        BOUND,      ///< Lease obtained, waiting for T1.
+        RENEWING,   ///< Renewing the lease, waiting for the reply.
+        REBINDING,  ///< Rebinding the lease, waiting for the reply.
+        REBOOTING,  ///< Confirming the lease after reboot.
+        RELEASED    ///< Lease released, waiting to reconnect.
+    };
+
+    /// \brief Phases of the test.
+    enum class Phase {
+        BRING_UP,   ///< Clients obtain their first leases.
+        STEADY,     ///< All clients have leases and renew them.
+        STORM,      ///< All clients reconnect after the reboot.
+        RECOVERED   ///< All clients have leases again after the storm.
+    };
+
+    /// \brief Number of phases.
+    static const size_t PHASES_NUM = 4;
+
+    /// \brief Value of the timer which never fires.
+    static const uint32_t NO_TIMER = 0xFFFFFFFF;
+
+    /// \brief Maximum number of timers processed in one loop iteration.
+    static const size_t TIMERS_BATCH = 256;
+
+    /// \brief Number of retransmissions after which rebooting clients
+    /// give up their leases and start over.
+    static const uint8_t MAX_REBOOT_RETRIES = 2;
+
+    /// \brief State of a simulated client.
+    ///
+    /// Times are expressed in milliseconds since the start of the test
+    /// to keep the structure small as millions of clients are simulated.
+    struct Client {
+        uint8_t addr_[16];   ///< Leased address, 4 octets for DHCPv4.
+        uint32_t timer_;     ///< Time of the pending timer.
+        uint32_t started_;   ///< Start of the exchange or time of binding.
+        uint32_t rebind_;    ///< Time to rebind the lease (T2).
+        uint32_t expire_;    ///< Time of the lease expiration, 0 if none.
+        ClientState state_;  ///< State of the client.
+        uint8_t retries_;    ///< Retransmissions in the current state.
+    };
+
+    /// \brief Statistics of a phase of the test.
+    struct PhaseStats {
+        /// \brief Constructor.
+        PhaseStats();
+
+        boost::posix_time::ptime start_;  ///< Start of the phase.
+        boost::posix_time::ptime end_;    ///< End of the phase.
+        uint64_t initiated_;        ///< Discover or Solicit exchanges started.
+        uint64_t renews_;           ///< Renewals started.
+        uint64_t rebinds_;          ///< Rebinds started.
+        uint64_t reboots_;          ///< Lease confirmations after reboot.
+        uint64_t releases_;         ///< Releases sent.
+        uint64_t retransmissions_;  ///< Retransmitted messages.
+        uint64_t leases_;           ///< Leases obtained or extended.
+        uint64_t naks_;             ///< Leases refused by the server.
+        uint64_t expired_;          ///< Leases expired on clients.
+        /// Time from the start of the exchange to the lease in microseconds.
+        util::LatencyHistogram latency_;
+    };
+
+    /// \brief Default and the only constructor of LifecycleScen.
+    ///
+    /// \param options reference to command options,
+    /// \param socket reference to a socket.
+    LifecycleScen(CommandOptions& options, BasePerfSocket &socket);
+
+    /// brief\ Run performance test.
+    ///
+    /// Method runs whole performance test.
+    ///
+    /// \return execution status.
+    int run() override;
+
+    /// \brief Returns state of a client.
+    ///
+    /// \param client index of the client.
+    /// \return state of the client.
+    const Client& getClient(uint32_t client) const {
+        return (clients_.at(client));
+    }
+
+    /// \brief Returns number of clients having valid leases.
+    uint32_t getLeasedNum() const { return (leased_); }
+
+    /// \brief Returns current phase of the test.
+    Phase getPhase() const { return (phase_); }
+
+    /// \brief Returns statistics of a phase.
+    ///
+    /// \param phase phase of the test.
+    /// \return statistics of the phase.
+    const PhaseStats& getPhaseStats(Phase phase) const {
+        return (phase_stats_[static_cast<size_t>(phase)]);
+    }
+
+    /// \brief Returns name of a phase.
+    ///
+    /// \param phase phase of the test.
+    /// \return name of the phase.
+    static std::string phaseToText(Phase phase);
+
+    /// \brief Print statistics of a phase.
+    ///
+    /// \param phase phase of the test.
+    void printPhaseStats(Phase phase) const;
+
+protected:
+    /// \brief Generator returning the index of the client which is
+    /// about to start a new exchange.
+    class ClientGenerator : public TestControl::NumberGenerator {
+    public:
+        /// \brief Constructor.
+        ClientGenerator() : next_(0) { }
+
+        /// \brief Set index of the next client.
+        void setNext(uint32_t next) { next_ = next; }
+
+        /// \brief Returns index of the next client.
+        virtual uint32_t generate() { return (next_); }
+
+    private:
+        uint32_t next_;  ///< Index of the next client.
+    };
+
+    /// \brief Timer: time and index of the client.
+    typedef std::pair<uint32_t, uint32_t> Timer;
+
+    /// \brief Queue of the timers with the earliest timer on top.
+    typedef std::priority_queue<Timer, std::vector<Timer>,
+                                std::greater<Timer> > TimerQueue;
+
+    /// \brief Returns time since the start of the test in milliseconds.
+    uint32_t getTime() const;
+
+    /// \brief Returns time of the timer after a number of seconds.
+    ///
+    /// \param now current time.
+    /// \param seconds delay in seconds.
+    /// \return time of the timer, \ref NO_TIMER if it is too far.
+    static uint32_t getDeadline(uint32_t now, uint64_t seconds);
+
+    /// \brief Returns retransmission delay.
+    ///
+    /// The delay doubles with each retransmission starting from one
+    /// second up to 64 seconds and it is randomized by +/- 10%.
+    ///
+    /// \param retries number of retransmissions so far.
+    /// \return delay in milliseconds.
+    static uint32_t getRetransmissionDelay(uint8_t retries);
+
+    /// \brief Set timer of a client.
+    ///
+    /// \param client index of the client.
+    /// \param time time of the timer, it is capped to the limit.
+    /// \param limit time after which timer must not fire.
+    void setTimer(uint32_t client, uint32_t time, uint32_t limit = NO_TIMER);
+
+    /// \brief Start new exchanges at the configured rate.
+    ///
+    /// \param now current time.
+    /// \return number of started exchanges.
+    size_t startClients(uint32_t now);
+
+    /// \brief Make all clients reconnect at once.
+    ///
+    /// \param now current time.
+    void triggerStorm(uint32_t now);
+
+    /// \brief Process due timers.
+    ///
+    /// \param now current time.
+    /// \return number of processed timers.
+    size_t processTimers(uint32_t now);
+
+    /// \brief Handle timer of a client.
+    ///
+    /// \param client index of the client.
+    /// \param now current time.
+    void handleTimer(uint32_t client, uint32_t now);
+
+    /// \brief Send Discover or Solicit for a client.
+    ///
+    /// \param client index of the client.
+    /// \param now current time.
+    void sendDiscover(uint32_t client, uint32_t now);
+
+    /// \brief Send a message for the lease of a client.
+    ///
+    /// \param client index of the client.
+    /// \param msg kind of the message.
+    void sendLeaseMessage(uint32_t client, TestControl::LeaseMessage msg);
+
+    /// \brief Process a packet received from the server.
+    ///
+    /// \param pkt received packet.
+    void processPacket(const dhcp::PktPtr& pkt);
+
+    /// \brief Process DHCPv4 packet received from the server.
+    ///
+    /// \param pkt4 received packet.
+    /// \param now current time.
+    void processPacket4(const dhcp::Pkt4Ptr& pkt4, uint32_t now);
+
+    /// \brief Process DHCPv6 packet received from the server.
+    ///
+    /// \param pkt6 received packet.
+    /// \param now current time.
+    void processPacket6(const dhcp::Pkt6Ptr& pkt6, uint32_t now);
+
+    /// \brief Returns index of the client owning the identifier.
+    ///
+    /// \param id MAC address or DUID.
+    /// \param [out] client index of the client.
+    /// \return true if the identifier belongs to a simulated client.
+    bool findClient(const std::vector<uint8_t>& id, uint32_t& client) const;
+
+    /// \brief Record the lease obtained by a client.
+    ///
+    /// \param client index of the client.
+    /// \param addr leased address.
+    /// \param t1 renew time sent by the server in seconds.
+    /// \param t2 rebind time sent by the server in seconds.
+    /// \param valid valid lifetime in seconds.
+    /// \param now current time.
+    void bind(uint32_t client, const asiolink::IOAddress& addr,
+              uint32_t t1, uint32_t t2, uint32_t valid, uint32_t now);
+
+    /// \brief Record the lease refused by the server.
+    ///
+    /// \param client index of the client.
+    /// \param now current time.
+    void refuse(uint32_t client, uint32_t now);
+
+    /// \brief Drop the lease of a client.
+    ///
+    /// \param client index of the client.
+    void dropLease(uint32_t client);
+
+    /// \brief Returns true if the client has a valid lease.
+    ///
+    /// \param client state of the client.
+    static bool isLeased(const Client& client);
+
+    /// \brief Returns statistics of the current phase.
+    PhaseStats& getCurrentStats() {
+        return (phase_stats_[static_cast<size_t>(phase_)]);
+    }
+
+    /// \brief Move to the next phase of the test.
+    ///
+    /// \param phase new phase.
+    void changePhase(Phase phase);
+
+    /// \brief Check if the test is over.
+    ///
+    /// \return true if the test is over.
+    bool checkExitConditions();
+
+    /// Generator of the MAC addresses for new exchanges.
+    boost::shared_ptr<ClientGenerator> client_gen_;
+
+    /// Rate control of the new exchanges during the bring up phase.
+    RateControl rate_control_;
+
+    /// Table of the client states.
+    std::vector<Client> clients_;
+
+    /// Pending timers of the clients.
+    TimerQueue timers_;
+
+    /// Index of the next client to be started.
+    uint32_t next_client_;
+
+    /// Number of clients having valid leases.
+    uint32_t leased_;
+
+    /// Server identifier option used to renew and release leases.
+    dhcp::OptionPtr server_id_;
+
+    /// Start time of the test.
+    boost::posix_time::ptime start_;
+
+    /// Indicates if the reboot storm has been triggered.
+    bool storm_triggered_;
+
+    /// Current phase of the test.
+    Phase phase_;
+
+    /// Statistics of the phases.
+    std::array<PhaseStats, PHASES_NUM> phase_stats_;
+};
+
+}
+}
+
+#endif // LIFECYCLE_SCEN_H
@@ -9,6 +9,7 @@
 #include <perfdhcp/avalanche_scen.h>
 #include <perfdhcp/basic_scen.h>
 #include <perfdhcp/command_options.h>
+#include <perfdhcp/lifecycle_scen.h>
 
 #include <exceptions/exceptions.h>
 
@@ -52,6 +53,9 @@ main(int argc, char* argv[]) {
         } else if (scenario == Scenario::AVALANCHE) {
             AvalancheScen scen(command_options, socket);
             ret_code = scen.run();
+        } else if (scenario == Scenario::LIFECYCLE) {
+            LifecycleScen scen(command_options, socket);
+            ret_code = scen.run();
         }
     } catch (std::exception& e) {
         ret_code = 1;
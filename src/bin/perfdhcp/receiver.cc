@@ -53,26 +53,39 @@ Receiver::~Receiver() {
 
 
 PktPtr
-Receiver::getPkt() {
+Receiver::getPkt(size_t queue) {
     if (single_threaded_) {
         // In single thread mode read packet directly from the socket and return it.
         return readPktFromSocket();
     } else {
         // In multi thread mode read packet from the queue which is feed by Receiver thread.
         util::thread::Mutex::Locker lock(pkt_queue_mutex_);
-        if (pkt_queue_.empty()) {
+        auto& pkt_queue = pkt_queues_.at(queue);
+        if (pkt_queue.empty()) {
             if (ip_version_ == 4) {
                 return Pkt4Ptr();
             } else {
                 return Pkt6Ptr();
             }
         }
-        auto pkt = pkt_queue_.front();
-        pkt_queue_.pop();
+        auto pkt = pkt_queue.front();
+        pkt_queue.pop();
         return pkt;
     }
 }
 
+size_t
+Receiver::getWorkerIndex(uint32_t transid, uint8_t ip_version,
+                         size_t workers) {
+    if (workers <= 1) {
+        return (0);
+    }
+    // DHCPv4 transaction id is 32 bits long and DHCPv6 one is 24 bits
+    // long. In both cases the worker index is its most significant byte.
+    size_t index = (transid >> (ip_version == 4 ? 24 : 16)) & 0xFF;
+    return (index % workers);
+}
+
 void
 Receiver::run() {
     if (single_threaded_) {
@@ -123,6 +136,8 @@ Receiver::readPktFromSocket() {
 
 void
 Receiver::receivePackets() {
+    std::vector<PktPtr> batch;
+    batch.reserve(BATCH_SIZE);
     while (true) {
         PktPtr pkt = readPktFromSocket();
         if (!pkt) {
@@ -133,10 +148,29 @@ Receiver::receivePackets() {
         if (pkt->getType() == DHCPOFFER || pkt->getType() == DHCPACK ||
             pkt->getType() == DHCPV6_ADVERTISE || pkt->getType() == DHCPV6_REPLY) {
             // Otherwise push the packet to the queue, to main thread.
-            util::thread::Mutex::Locker lock(pkt_queue_mutex_);
-            pkt_queue_.push(pkt);
+            batch.push_back(pkt);
+            if (batch.size() >= BATCH_SIZE) {
+                pushPackets(batch);
+            }
+        }
+    }
+    pushPackets(batch);
+}
+
+void
+Receiver::pushPackets(std::vector<PktPtr>& batch) {
+    if (batch.empty()) {
+        return;
+    }
+    {
+        util::thread::Mutex::Locker lock(pkt_queue_mutex_);
+        for (auto const& pkt : batch) {
+            size_t index = getWorkerIndex(pkt->getTransid(), ip_version_,
+                                          pkt_queues_.size());
+            pkt_queues_[index].push(pkt);
         }
     }
+    batch.clear();
 }
 
 }
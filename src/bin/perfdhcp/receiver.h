@@ -16,7 +16,9 @@
 
 #include <queue>
 #include <thread>
+#include <vector>
 #include <boost/atomic.hpp>
+#include <boost/shared_ptr.hpp>
 
 namespace isc {
 namespace perfdhcp {
@@ -29,9 +31,14 @@ namespace perfdhcp {
 /// and returns them to consumer using getPkt method.
 ///
 /// In case of multi-thread mode the class starts a thread in backgroud.
-/// The thread reads the packets and pushes them to pkt_queue_. Then
+/// The thread reads the packets and pushes them to pkt_queues_. Then
 /// in main thread packets can be consumed from the queue using getPkt
 /// method.
+///
+/// When more than one queue is used (one per load generating worker),
+/// the receiving thread dispatches each packet to the queue of the worker
+/// which sent the matching request. The worker index is carried in the
+/// most significant byte of the transaction id.
 class Receiver {
 private:
     /// \brief Flag indicating if thread should run (true) or not (false).
@@ -40,10 +47,10 @@ private:
     /// \brief Thread for receiving packets.
     std::unique_ptr<util::thread::Thread> recv_thread_;
 
-    /// \brief Queue for passing packets from receiver thread to main thread.
-    std::queue<dhcp::PktPtr> pkt_queue_;
+    /// \brief Queues for passing packets from receiver thread to workers.
+    std::vector<std::queue<dhcp::PktPtr> > pkt_queues_;
 
-    /// \brief Mutex for controlling access to the queue.
+    /// \brief Mutex for controlling access to the queues.
     util::thread::Mutex pkt_queue_mutex_;
 
     BasePerfSocket &socket_;
@@ -59,7 +66,10 @@ public:
     /// \param socket A socket for receiving packets.
     /// \param single_threaded A flag indicating running mode.
     /// \param ip_version An IP version: 4 or 6
-    Receiver(BasePerfSocket &socket, bool single_threaded, uint8_t ip_version) :
+    /// \param queues A number of queues (workers) to dispatch packets to.
+    Receiver(BasePerfSocket &socket, bool single_threaded, uint8_t ip_version,
+             size_t queues = 1) :
+        pkt_queues_(queues > 0 ? queues : 1),
         socket_(socket),
         single_threaded_(single_threaded),
         ip_version_(ip_version) {
@@ -82,7 +92,26 @@ public:
     ///
     /// In single-thread mode it reads directly from the socket.
     /// In multi-thread mode it reads packets from the queue.
-    dhcp::PktPtr getPkt();
+    ///
+    /// \param queue An index of the queue (worker) to read from.
+    dhcp::PktPtr getPkt(size_t queue = 0);
+
+    /// \brief Returns number of queues.
+    size_t getQueuesNum() const {
+        return (pkt_queues_.size());
+    }
+
+    /// \brief Returns index of the worker owning a transaction id.
+    ///
+    /// \param transid A transaction id of the packet.
+    /// \param ip_version An IP version: 4 or 6.
+    /// \param workers A number of workers.
+    /// \return index of the worker in the range of 0 to workers - 1.
+    static size_t getWorkerIndex(uint32_t transid, uint8_t ip_version,
+                                 size_t workers);
+
+    /// \brief Maximum number of packets pushed to the queues at once.
+    static const size_t BATCH_SIZE = 64;
 
 private:
     /// \brief Receiving thread main function.
@@ -90,13 +119,23 @@ private:
 
     /// \brief Receive packets from sockets and pushes them to the queue.
     ///
-    /// It runs in a loop until socket is empty.
+    /// It runs in a loop until socket is empty. Packets are pushed to the
+    /// queues in batches of up to BATCH_SIZE to limit contention on the
+    /// queue mutex.
     void receivePackets();
 
+    /// \brief Push a batch of packets to the queues.
+    ///
+    /// \param batch Packets to push. The vector is cleared on return.
+    void pushPackets(std::vector<dhcp::PktPtr>& batch);
+
     /// \brief Read a packet directly from the socket.
     dhcp::PktPtr readPktFromSocket();
 };
 
+/// \brief Pointer to a Receiver.
+typedef boost::shared_ptr<Receiver> ReceiverPtr;
+
 }
 }
 
@@ -6,6 +6,11 @@
 
 #include <perfdhcp/stats_mgr.h>
 
+#include <cc/data.h>
+
+#include <algorithm>
+#include <sstream>
+
 
 namespace isc {
 namespace perfdhcp {
@@ -109,6 +114,50 @@ ExchangeStats::updateDelays(const dhcp::PktPtr& sent_packet,
     // mean delays.
     sum_delay_ += delta;
     sum_delay_squared_ += delta * delta;
+
+    // Count the delay in microseconds in the histograms used to
+    // calculate percentiles.
+    uint64_t delta_us =
+        static_cast<uint64_t>(period.length().total_microseconds());
+    delays_.record(delta_us);
+    interval_delays_.record(delta_us);
+}
+
+void
+ExchangeStats::collectExpired(const boost::posix_time::ptime& now) {
+    using namespace boost::posix_time;
+
+    if ((drop_time_ <= 0) || now.is_not_a_date_time()) {
+        return;
+    }
+    while (!sent_packets_.empty()) {
+        PktListIterator it = sent_packets_.begin();
+        ptime packet_time = (*it)->getTimestamp();
+        if (packet_time.is_not_a_date_time()) {
+            break;
+        }
+        time_period packet_period(packet_time, now);
+        if (packet_period.is_null()) {
+            break;
+        }
+        double period_fractional =
+            packet_period.length().total_seconds() +
+            (static_cast<double>(packet_period.length().fractional_seconds())
+             / packet_period.length().ticks_per_second());
+        if (period_fractional <= drop_time_) {
+            // We found first non-expired transaction. All other
+            // transactions were sent later.
+            break;
+        }
+        // If timed out packet is the one the 'next sent' pointer
+        // points to, we need to update it to point to a valid location.
+        if (it == next_sent_) {
+            next_sent_ = eraseSent(it);
+        } else {
+            eraseSent(it);
+        }
+        ++collected_;
+    }
 }
 
 dhcp::PktPtr
@@ -119,6 +168,10 @@ ExchangeStats::matchPackets(const dhcp::PktPtr& rcvd_packet) {
         isc_throw(BadValue, "Received packet is null");
     }
 
+    // Remove the packets which have timed out. The packet matching
+    // the received one is removed too if it has timed out.
+    collectExpired(microsec_clock::universal_time());
+
     if (sent_packets_.size() == 0) {
         // List of sent packets is empty so there is no sense
         // to continue looking fo the packet. It also means
@@ -149,93 +202,25 @@ ExchangeStats::matchPackets(const dhcp::PktPtr& rcvd_packet) {
         // If we are here, it means that we were unable to match the
         // next incoming packet with next sent packet so we need to
         // take a little more expensive approach to look packets using
-        // alternative index (transaction id & 1023).
+        // alternative index (hash table of transaction ids).
         PktListTransidHashIndex& idx = sent_packets_.template get<1>();
-        // Packets are grouped using transaction id masked with value
-        // of 1023. For instance, packets with transaction id equal to
-        // 1, 1024 ... will belong to the same group (a.k.a. bucket).
-        // When using alternative index we don't find the packet but
-        // bucket of packets and we need to iterate through the bucket
-        // to find the one that has desired transaction id.
         std::pair<PktListTransidHashIterator,PktListTransidHashIterator> p =
-            idx.equal_range(hashTransid(rcvd_packet));
+            idx.equal_range(getTransid(rcvd_packet));
         // We want to keep statistics of unordered lookups to make
         // sure that there is a right balance between number of
         // unordered lookups and ordered lookups. If number of unordered
         // lookups is high it may mean that many packets are lost or
         // sent out of order.
         ++unordered_lookups_;
-        // We also want to keep the mean value of the bucket. The lower
-        // bucket size the better. If bucket sizes appear to big we
-        // might want to increase number of buckets.
+        // We also want to keep the mean size of the looked up range.
+        // It is greater than 1 only when transaction ids are reused
+        // before the previous packets have been matched or collected.
         unordered_lookup_size_sum_ += std::distance(p.first, p.second);
-        bool non_expired_found = false;
-        // Removal can be done only after the loop
-        PktListRemovalQueue to_remove;
-        for (PktListTransidHashIterator it = p.first; it != p.second; ++it) {
-            // If transaction id is matching, we found the original
-            // packet sent to the server. Therefore, we reset the
-            // 'next sent' pointer to point to this location. We
-            // also indicate that the matching packet is found.
-            // Even though the packet has been found, we continue
-            // iterating over the bucket to remove all those packets
-            // that are timed out.
-            if (!packet_found && ((*it)->getTransid() == rcvd_packet->getTransid())) {
-                packet_found = true;
-                next_sent_ = sent_packets_.template project<0>(it);
-            }
-
-            if (!non_expired_found) {
-                // Check if the packet should be removed due to timeout.
-                // This includes the packet matching the received one.
-                ptime now = microsec_clock::universal_time();
-                ptime packet_time = (*it)->getTimestamp();
-                time_period packet_period(packet_time, now);
-                if (!packet_period.is_null()) {
-                    double period_fractional =
-                        packet_period.length().total_seconds() +
-                        (static_cast<double>(packet_period.length().fractional_seconds())
-                         / packet_period.length().ticks_per_second());
-                    if (drop_time_ > 0 && (period_fractional > drop_time_)) {
-                        // Push the iterator on the removal queue.
-                        to_remove.push(it);
-
-                    } else {
-                        // We found first non-expired transaction. All other
-                        // transactions within this bucket are considered
-                        // non-expired because packets are held in the
-                        // order of addition within the bucket.
-                        non_expired_found = true;
-                    }
-                }
-            }
-
-            // If we found the packet and all expired transactions,
-            // there is nothing more to do.
-            if (non_expired_found && packet_found) {
-                break;
-            }
-        }
-
-        // Deal with the removal queue.
-        while (!to_remove.empty()) {
-            PktListTransidHashIterator it = to_remove.front();
-            to_remove.pop();
-            // If timed out packet is not the one matching server response,
-            // we simply remove it and keep the pointer to the 'next sent'
-            // packet as it was. If the timed out packet appears to be the
-            // one that is matching the server response, we still want to
-            // remove it, but we need to update the 'next sent' pointer to
-            // point to a valid location.
-            if (sent_packets_.template project<0>(it) != next_sent_) {
-                eraseSent(sent_packets_.template project<0>(it));
-            } else {
-                next_sent_ = eraseSent(sent_packets_.template project<0>(it));
-                // We removed the matching packet because of the timeout. It
-                // means that there is no match anymore.
-                packet_found = false;
-            }
-            ++collected_;
+        if (p.first != p.second) {
+            // We found the original packet sent to the server. Therefore,
+            // we reset the 'next sent' pointer to point to this location.
+            packet_found = true;
+            next_sent_ = sent_packets_.template project<0>(p.first);
         }
     }
 
@@ -281,7 +266,7 @@ ExchangeStats::printTimestamps() {
             archived_packets_.template get<1>();
         std::pair<PktListTransidHashIterator,
                   PktListTransidHashIterator> p =
-            idx.equal_range(hashTransid(rcvd_packet));
+            idx.equal_range(getTransid(rcvd_packet));
         for (PktListTransidHashIterator it_archived = p.first;
              it_archived != p.second;
              ++it_archived) {
@@ -314,9 +299,137 @@ ExchangeStats::printTimestamps() {
     }
 }
 
+void
+ExchangeStats::merge(const ExchangeStats& other) {
+    if (other.xchg_type_ != xchg_type_) {
+        isc_throw(BadValue, "unable to merge statistics of different"
+                  " exchange types");
+    }
+    min_delay_ = std::min(min_delay_, other.min_delay_);
+    max_delay_ = std::max(max_delay_, other.max_delay_);
+    sum_delay_ += other.sum_delay_;
+    sum_delay_squared_ += other.sum_delay_squared_;
+    orphans_ += other.orphans_;
+    collected_ += other.collected_;
+    unordered_lookup_size_sum_ += other.unordered_lookup_size_sum_;
+    unordered_lookups_ += other.unordered_lookups_;
+    ordered_lookups_ += other.ordered_lookups_;
+    sent_packets_num_ += other.sent_packets_num_;
+    rcvd_packets_num_ += other.rcvd_packets_num_;
+    delays_.merge(other.delays_);
+    interval_delays_.merge(other.interval_delays_);
+    if (other.boot_time_ < boot_time_) {
+        boot_time_ = other.boot_time_;
+    }
+    for (auto const& pkt : other.rcvd_packets_) {
+        static_cast<void>(rcvd_packets_.push_back(pkt));
+    }
+    for (auto const& pkt : other.archived_packets_) {
+        static_cast<void>(archived_packets_.push_back(pkt));
+    }
+}
+
+void
+StatsMgr::merge(const StatsMgr& other) {
+    for (auto const& xchg : other.exchanges_) {
+        auto it = exchanges_.find(xchg.first);
+        if (it != exchanges_.end()) {
+            it->second->merge(*xchg.second);
+        }
+    }
+    for (auto const& counter : other.custom_counters_) {
+        auto it = custom_counters_.find(counter.first);
+        if (it != custom_counters_.end()) {
+            *it->second += counter.second->getValue();
+        }
+    }
+    if (other.boot_time_ < boot_time_) {
+        boot_time_ = other.boot_time_;
+    }
+}
+
+std::string
+StatsMgr::getReport(const bool final, const ReportFormat format) const {
+    using namespace isc::data;
+
+    const double percentiles[] = { 50, 90, 99, 99.9 };
+    const char* percentile_names[] = { "p50", "p90", "p99", "p99.9" };
+    const size_t percentiles_num = sizeof(percentiles) / sizeof(percentiles[0]);
+
+    double time = getTestPeriod().length().total_microseconds() / 1e6;
+    std::ostringstream s;
+    ElementPtr report = Element::createMap();
+    report->set("report", Element::create(std::string(final ? "final" : "interval")));
+    report->set("time", Element::create(time));
+    ElementPtr exchanges = Element::createMap();
+    for (auto const& it : exchanges_) {
+        ExchangeStatsPtr xchg_stats = it.second;
+        const util::LatencyHistogram& delays = final ?
+            xchg_stats->getDelays() : xchg_stats->getIntervalDelays();
+        std::ostringstream name;
+        name << it.first;
+        if (format == ReportFormat::CSV) {
+            s << (final ? "final" : "interval") << ","
+              << time << ","
+              << name.str() << ","
+              << xchg_stats->getSentPacketsNum() << ","
+              << xchg_stats->getRcvdPacketsNum() << ","
+              << xchg_stats->getDroppedPacketsNum() << ","
+              << xchg_stats->getOrphans();
+            for (size_t i = 0; i < percentiles_num; ++i) {
+                s << ",";
+                if (delays.getCount() > 0) {
+                    s << delays.getPercentile(percentiles[i]) / 1e3;
+                }
+            }
+            s << std::endl;
+        } else {
+            ElementPtr xchg = Element::createMap();
+            xchg->set("sent", Element::create(static_cast<int64_t>(xchg_stats->getSentPacketsNum())));
+            xchg->set("received", Element::create(static_cast<int64_t>(xchg_stats->getRcvdPacketsNum())));
+            xchg->set("drops", Element::create(static_cast<int64_t>(xchg_stats->getDroppedPacketsNum())));
+            xchg->set("orphans", Element::create(static_cast<int64_t>(xchg_stats->getOrphans())));
+            for (size_t i = 0; i < percentiles_num; ++i) {
+                if (delays.getCount() > 0) {
+                    xchg->set(percentile_names[i],
+                              Element::create(delays.getPercentile(percentiles[i]) / 1e3));
+                } else {
+                    xchg->set(percentile_names[i], Element::create());
+                }
+            }
+            exchanges->set(name.str(), xchg);
+        }
+    }
+    if (format != ReportFormat::CSV) {
+        report->set("exchanges", exchanges);
+        s << report->str() << std::endl;
+    }
+    return (s.str());
+}
+
+std::string
+StatsMgr::getCsvHeader() {
+    return ("report,time,exchange,sent,received,drops,orphans,"
+            "p50,p90,p99,p99.9\n");
+}
+
+void
+StatsMgr::printReport(const bool final) const {
+    if (report_format_ == ReportFormat::TEXT) {
+        return;
+    }
+    if ((report_format_ == ReportFormat::CSV) && !csv_header_printed_) {
+        std::cout << getCsvHeader();
+        csv_header_printed_ = true;
+    }
+    std::cout << getReport(final, report_format_) << std::flush;
+}
+
 StatsMgr::StatsMgr(CommandOptions& options) :
     exchanges_(),
-    boot_time_(boost::posix_time::microsec_clock::universal_time())
+    boot_time_(boost::posix_time::microsec_clock::universal_time()),
+    report_format_(options.getReportFormat()),
+    csv_header_printed_(false)
 {
     // Check if packet archive mode is required. If user
     // requested diagnostics option -x t we have to enable
@@ -328,7 +441,10 @@ StatsMgr::StatsMgr(CommandOptions& options) :
         if (options.getExchangeMode() == CommandOptions::DORA_SARR) {
             addExchangeStats(ExchangeType::RA, options.getDropTime()[1]);
         }
-        if (options.getRenewRate() != 0) {
+        // Lifecycle scenario clients renew, rebind and reboot using
+        // DHCPREQUEST messages which are accounted as renewals.
+        if ((options.getRenewRate() != 0) ||
+            (options.getScenario() == Scenario::LIFECYCLE)) {
             addExchangeStats(ExchangeType::RNA);
         }
 
@@ -337,10 +453,15 @@ StatsMgr::StatsMgr(CommandOptions& options) :
         if (options.getExchangeMode() == CommandOptions::DORA_SARR) {
             addExchangeStats(ExchangeType::RR, options.getDropTime()[1]);
         }
-        if (options.getRenewRate() != 0) {
+        // Lifecycle scenario clients renew, rebind and release their
+        // leases. Rebind messages are accounted as renewals.
+        if ((options.getRenewRate() != 0) ||
+            (options.getScenario() == Scenario::LIFECYCLE)) {
             addExchangeStats(ExchangeType::RN);
         }
-        if (options.getReleaseRate() != 0) {
+        if ((options.getReleaseRate() != 0) ||
+            ((options.getScenario() == Scenario::LIFECYCLE) &&
+             (options.getReleaseRatio() != 0))) {
             addExchangeStats(ExchangeType::RL);
         }
     }
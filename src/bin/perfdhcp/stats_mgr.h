@@ -10,11 +10,12 @@
 #include <dhcp/pkt.h>
 #include <exceptions/exceptions.h>
 #include <perfdhcp/command_options.h>
+#include <util/latency_histogram.h>
 
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/multi_index_container.hpp>
-#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/sequenced_index.hpp>
 #include <boost/multi_index/global_fun.hpp>
 #include <boost/multi_index/mem_fun.hpp>
@@ -129,28 +130,27 @@ typedef typename CustomCountersMap::const_iterator CustomCountersMapIterator;
 class ExchangeStats {
 public:
 
-    /// \brief Hash transaction id of the packet.
+    /// \brief Return transaction id of the packet.
     ///
-    /// Function hashes transaction id of the packet. Hashing is
-    /// non-unique. Many packets may have the same hash value and thus
-    /// they belong to the same packet buckets. Packet buckets are
-    /// used for unordered packets search with multi index container.
+    /// Function returns transaction id of the packet. It is used as
+    /// the key of the hashed index of the multi index container for
+    /// unordered packets search.
     ///
-    /// \param packet packet which transaction id is to be hashed.
+    /// \param packet packet which transaction id is to be returned.
     /// \throw isc::BadValue if packet is null.
-    /// \return transaction id hash.
-    static uint32_t hashTransid(const dhcp::PktPtr& packet) {
+    /// \return transaction id.
+    static uint32_t getTransid(const dhcp::PktPtr& packet) {
         if (!packet) {
             isc_throw(BadValue, "Packet is null");
         }
-        return(packet->getTransid() & 1023);
+        return(packet->getTransid());
     }
 
     /// \brief List of packets (sent or received).
     ///
     /// List of packets based on multi index container allows efficient
     /// search of packets based on their sequence (order in which they
-    /// were inserted) as well as based on their hashed transaction id.
+    /// were inserted) as well as based on their transaction id.
     /// The first index (sequenced) provides the way to use container
     /// as a regular list (including iterators, removal of elements from
     /// the middle of the collection etc.). This index is meant to be used
@@ -163,16 +163,13 @@ public:
     /// dropped by the server or may be sent out of order and we still
     ///  want to have ability to search packets using transaction id.
     /// The second index can be used for this purpose. This index is
-    /// hashing transaction ids using custom function \ref hashTransid.
-    /// Note that other possibility would be to simply specify index
-    /// that uses transaction id directly (instead of hashing with
-    /// \ref hashTransid). In this case however we have chosen to use
-    /// hashing function because it shortens the index size to just
-    /// 1023 values maximum. Search operation on this index generally
-    /// returns the range of packets that have the same transaction id
-    /// hash assigned but most often these ranges will be short so further
-    /// search within a range to find a packet with particular transaction
-    /// id will not be intensive.
+    /// a hash table of transaction ids so the search takes constant time
+    /// whatever the number of outstanding packets. Search operation on
+    /// this index returns the range of packets that have the same
+    /// transaction id, which most often holds a single packet.
+    /// As the first index keeps packets in the order they were sent, the
+    /// timed out packets are always at its front and are collected from
+    /// there (see \ref collectExpired).
     ///
     /// Example 1: Add elements to the list
     /// \code
@@ -202,14 +199,13 @@ public:
     ///      }
     /// \endcode
     ///
-    /// Example 3: Access elements through ordered index by hash
+    /// Example 3: Access elements through hashed index by transaction id
     /// \code
     /// // Get the instance of the second search index.
     /// PktListTransidHashIndex& idx = sent_packets_.template get<1>();
-    /// // Get the range (bucket) of packets sharing the same transaction
-    /// // id hash.
+    /// // Get the range of packets sharing the same transaction id.
     /// std::pair<PktListTransidHashIterator,PktListTransidHashIterator> p =
-    ///     idx.equal_range(hashTransid(rcvd_packet));
+    ///     idx.equal_range(getTransid(rcvd_packet));
     /// // Iterate through the returned bucket.
     /// for (PktListTransidHashIterator it = p.first; it != p.second;
     ///     ++it) {
@@ -225,21 +221,17 @@ public:
             // Sequenced index provides the way to use this container
             // in the same way as std::list.
             boost::multi_index::sequenced<>,
-            // The other index keeps products of transaction id.
-            // Elements with the same hash value are grouped together
-            // into buckets and transactions are ordered from the
-            // oldest to latest within a bucket.
-            boost::multi_index::ordered_non_unique<
-                // Specify hash function to get the product of
-                // transaction id. This product is obtained by calling
-                // hashTransid() function.
+            // The other index is a hash table of transaction ids.
+            boost::multi_index::hashed_non_unique<
+                // Specify the function to get the transaction id.
+                // It is obtained by calling getTransid() function.
                 boost::multi_index::global_fun<
-                    // Hashing function takes PktPtr as argument.
+                    // The function takes PktPtr as argument.
                     const dhcp::PktPtr&,
                     // ... and returns uint32 value.
                     uint32_t,
                     // ... and here is a reference to it.
-                    &ExchangeStats::hashTransid
+                    &ExchangeStats::getTransid
                     >
                 >
             >
@@ -247,15 +239,12 @@ public:
 
     /// Packet list iterator for sequential access to elements.
     typedef typename PktList::iterator PktListIterator;
-    /// Packet list index to search packets using transaction id hash.
+    /// Packet list index to search packets using transaction id.
     typedef typename PktList::template nth_index<1>::type
     PktListTransidHashIndex;
-    /// Packet list iterator to access packets using transaction id hash.
+    /// Packet list iterator to access packets using transaction id.
     typedef typename PktListTransidHashIndex::const_iterator
     PktListTransidHashIterator;
-    /// Packet list iterator queue for removal.
-    typedef typename std::queue<PktListTransidHashIterator>
-    PktListRemovalQueue;
 
     /// \brief Constructor
     ///
@@ -280,6 +269,9 @@ public:
         if (!packet) {
             isc_throw(BadValue, "Packet is null");
         }
+        // Packets are appended in the order they are sent so the timed
+        // out ones can be collected before the list grows any further.
+        collectExpired(packet->getTimestamp());
         static_cast<void>(sent_packets_.template get<0>().push_back(packet));
         ++sent_packets_num_;
     }
@@ -326,6 +318,18 @@ public:
     /// not found
     dhcp::PktPtr matchPackets(const dhcp::PktPtr& rcvd_packet);
 
+    /// \brief Merge statistics collected by another object.
+    ///
+    /// Method adds counters and delays gathered by other exchange
+    /// statistics of the same type to this object. It is used to
+    /// combine results collected by multiple workers at the end of
+    /// the test. Archived and received packets are appended so as
+    /// the timestamps can be printed.
+    ///
+    /// \param other exchange statistics to be merged into this object.
+    /// \throw isc::BadValue if exchange types do not match.
+    void merge(const ExchangeStats& other);
+
     /// \brief Return minimum delay between sent and received packet.
     ///
     /// Method returns minimum delay between sent and received packet.
@@ -374,6 +378,45 @@ public:
                     getAvgDelay() * getAvgDelay()));
     }
 
+    /// \brief Return percentile of packet delay.
+    ///
+    /// Method returns the delay below or equal to which the given
+    /// percentage of packet delays is. The delays are counted in a
+    /// histogram with microsecond resolution and a relative error
+    /// of about 6%.
+    ///
+    /// \param percentile percentile, between 0 and 100.
+    /// \throw isc::InvalidOperation if number of received packets
+    /// for the exchange is equal to zero.
+    /// \throw isc::BadValue if the percentile is out of range.
+    /// \return percentile of packet delay in seconds.
+    double getDelayPercentile(const double percentile) const {
+        if (delays_.getCount() == 0) {
+            isc_throw(InvalidOperation, "no packets received");
+        }
+        return(delays_.getPercentile(percentile) / 1e6);
+    }
+
+    /// \brief Return histogram of packet delays.
+    ///
+    /// \return histogram of delays in microseconds since the test start.
+    const util::LatencyHistogram& getDelays() const {
+        return(delays_);
+    }
+
+    /// \brief Return histogram of packet delays in the current interval.
+    ///
+    /// \return histogram of delays in microseconds since the last call
+    /// to \ref resetIntervalDelays.
+    const util::LatencyHistogram& getIntervalDelays() const {
+        return(interval_delays_);
+    }
+
+    /// \brief Start a new interval of packet delays.
+    void resetIntervalDelays() {
+        interval_delays_.reset();
+    }
+
     /// \brief Return number of orphan packets.
     ///
     /// Method returns number of received packets that had no matching
@@ -501,6 +544,14 @@ public:
                  << "max delay: " << getMaxDelay() * 1e3 << " ms" << endl
                  << "std deviation: " << getStdDevDelay() * 1e3 << " ms"
                  << endl
+                 << "p50 delay: " << getDelayPercentile(50) * 1e3 << " ms"
+                 << endl
+                 << "p90 delay: " << getDelayPercentile(90) * 1e3 << " ms"
+                 << endl
+                 << "p99 delay: " << getDelayPercentile(99) * 1e3 << " ms"
+                 << endl
+                 << "p99.9 delay: " << getDelayPercentile(99.9) * 1e3
+                 << " ms" << endl
                  << "collected packets: " << getCollectedNum() << endl;
         } catch (const Exception&) {
             cout << "Delay summary unavailable! No packets received." << endl;
@@ -533,6 +584,16 @@ private:
     /// class to specify exchange type explicitly.
     ExchangeStats();
 
+    /// \brief Collect timed out packets from the list of sent packets.
+    ///
+    /// Packets are held in the order they were sent so the timed out
+    /// packets are at the front of the list. Method removes them until
+    /// it finds the first packet which has not timed out yet. It does
+    /// nothing when the drop time is not positive.
+    ///
+    /// \param now time against which packets are checked.
+    void collectExpired(const boost::posix_time::ptime& now);
+
     /// \brief Erase packet from the list of sent packets.
     ///
     /// Method erases packet from the list of sent packets.
@@ -615,6 +676,12 @@ private:
     uint64_t sent_packets_num_;    ///< Total number of sent packets.
     uint64_t rcvd_packets_num_;    ///< Total number of received packets.
     boost::posix_time::ptime boot_time_; ///< Time when test is started.
+
+    /// Histogram of delays, in microseconds, since the test start.
+    util::LatencyHistogram delays_;
+
+    /// Histogram of delays, in microseconds, in the current interval.
+    util::LatencyHistogram interval_delays_;
 };
 
 /// Pointer to ExchangeStats.
@@ -845,6 +912,24 @@ public:
         return(xchg_stats->getStdDevDelay());
     }
 
+    /// \brief Return percentile of packet delay.
+    ///
+    /// Method returns the delay below or equal to which the given
+    /// percentage of packet delays for the specified exchange type is.
+    ///
+    /// \param xchg_type exchange type.
+    /// \param percentile percentile, between 0 and 100.
+    /// \throw isc::BadValue if invalid exchange type specified or
+    /// if the percentile is out of range.
+    /// \throw isc::InvalidOperation if no packets for this exchange
+    /// have been received yet.
+    /// \return percentile of packet delay in seconds.
+    double getDelayPercentile(const ExchangeType xchg_type,
+                              const double percentile) const {
+        ExchangeStatsPtr xchg_stats = getExchangeStats(xchg_type);
+        return(xchg_stats->getDelayPercentile(percentile));
+    }
+
     /// \brief Return number of orphan packets.
     ///
     /// Method returns number of orphan packets for specified
@@ -1001,14 +1086,27 @@ public:
             xchg_stats->printRTTStats();
             std::cout << std::endl;
         }
+        if (report_format_ != ReportFormat::TEXT) {
+            printReport(true);
+        }
     }
 
     /// \brief Print intermediate statistics.
     ///
     /// Method prints intermediate statistics for all exchanges.
     /// Statistics includes sent, received and dropped packets
-    /// counters.
-    void printIntermediateStats() const {
+    /// counters. When JSON or CSV report format is selected, the
+    /// report also includes the percentiles of delays in the interval
+    /// since the previous report.
+    void printIntermediateStats() {
+        if (report_format_ != ReportFormat::TEXT) {
+            printReport(false);
+            for (auto const& it : exchanges_) {
+                it.second->resetIntervalDelays();
+            }
+            return;
+        }
+
         std::ostringstream stream_sent;
         std::ostringstream stream_rcvd;
         std::ostringstream stream_drops;
@@ -1029,6 +1127,33 @@ public:
                   << std::endl;
     }
 
+    /// \brief Return machine-readable report.
+    ///
+    /// Method returns the report in the JSON or CSV format. The report
+    /// holds, for each exchange, the number of sent and received packets,
+    /// drops and orphans since the test start, and the 50th, 90th, 99th
+    /// and 99.9th percentiles of delays in milliseconds. The JSON report
+    /// is a single line, the CSV report holds one row per exchange.
+    ///
+    /// \param final if true the percentiles are computed from all delays
+    /// since the test start, otherwise from delays in the interval since
+    /// the previous intermediate report.
+    /// \param format report format, either JSON or CSV.
+    /// \return report, terminated by a new line.
+    std::string getReport(const bool final, const ReportFormat format) const;
+
+    /// \brief Return header of CSV reports.
+    static std::string getCsvHeader();
+
+    /// \brief Print machine-readable report.
+    ///
+    /// Method prints the report in the selected format. The CSV header
+    /// is printed before the first report.
+    ///
+    /// \param final if true the final report is printed, otherwise
+    /// the intermediate one.
+    void printReport(const bool final) const;
+
     /// \brief Print timestamps of all packets.
     ///
     /// Method prints timestamps of all sent and received
@@ -1076,6 +1201,16 @@ public:
         }
     }
 
+    /// \brief Merge statistics collected by another manager.
+    ///
+    /// Method merges exchange statistics of the types tracked by both
+    /// managers and adds values of custom counters defined in both.
+    /// The earliest test start time is preserved so as the test period
+    /// covers all merged results.
+    ///
+    /// \param other statistics manager to be merged into this one.
+    void merge(const StatsMgr& other);
+
     std::tuple<typename ExchangeStats::PktListIterator, typename ExchangeStats::PktListIterator> getSentPackets(const ExchangeType xchg_type) const {
         ExchangeStatsPtr xchg_stats = getExchangeStats(xchg_type);
         std::tuple<typename ExchangeStats::PktListIterator, typename ExchangeStats::PktListIterator> sent_packets_its = xchg_stats->getSentPackets();
@@ -1114,6 +1249,12 @@ private:
     bool archive_enabled_;
 
     boost::posix_time::ptime boot_time_; ///< Time when test is started.
+
+    /// Format of the reports.
+    ReportFormat report_format_;
+
+    /// Indicates that the CSV header has already been printed.
+    mutable bool csv_header_printed_;
 };
 
 /// Pointer to Statistics Manager;
@@ -17,6 +17,7 @@
 #include <dhcp/iface_mgr.h>
 #include <dhcp/dhcp4.h>
 #include <dhcp/option6_ia.h>
+#include <dhcp/option6_iaaddr.h>
 #include <util/unittests/check_valgrind.h>
 
 #include <boost/date_time/posix_time/posix_time.hpp>
@@ -44,7 +45,6 @@ bool TestControl::interrupted_ = false;
 
 bool
 TestControl::waitToExit() const {
-    static ptime exit_time = ptime(not_a_date_time);
     uint32_t wait_time = options_.getExitWaitTime();
 
     // If we care and not all packets are in yet
@@ -52,12 +52,12 @@ TestControl::waitToExit() const {
         const ptime now = microsec_clock::universal_time();
 
         // Init the end time if it hasn't started yet
-        if (exit_time.is_not_a_date_time()) {
-            exit_time = now + time_duration(microseconds(wait_time));
+        if (exit_time_.is_not_a_date_time()) {
+            exit_time_ = now + time_duration(microseconds(wait_time));
         }
 
         // If we're not at end time yet, return true
-        return (now < exit_time);
+        return (now < exit_time_);
     }
 
     // No need to wait, return false;
@@ -75,9 +75,9 @@ TestControl::haveAllPacketsBeenReceived() const {
     }
 
     uint32_t responses = 0;
-    uint32_t requests = num_request[0];
+    uint32_t requests = getWorkerShare(num_request[0]);
     if (num_request_size >= 2) {
-        requests += num_request[1];
+        requests += getWorkerShare(num_request[1]);
     }
 
     if (ipversion == 4) {
@@ -323,35 +323,87 @@ TestControl::generateMacAddress(uint8_t& randomized) {
       if (clients_num < 2) {
           return (options_.getMacTemplate());
       }
-      // Get the base MAC address. We are going to randomize part of it.
-      std::vector<uint8_t> mac_addr(options_.getMacTemplate());
-      if (mac_addr.size() != HW_ETHER_LEN) {
-          isc_throw(BadValue, "invalid MAC address template specified");
-      }
       uint32_t r = macaddr_gen_->generate();
-      randomized = 0;
-      // Randomize MAC address octets.
-      for (std::vector<uint8_t>::iterator it = mac_addr.end() - 1;
-           it >= mac_addr.begin();
-           --it) {
-          // Add the random value to the current octet.
-          (*it) += r;
-          ++randomized;
-          if (r < 256) {
-              // If we are here it means that there is no sense
-              // to randomize the remaining octets of MAC address
-              // because the following bytes of random value
-              // are zero and it will have no effect.
-              break;
-          }
-          // Randomize the next octet with the following
-          // byte of random value.
-          r >>= 8;
-      }
-      return (mac_addr);
+      return (getMacAddress(r, randomized));
     }
 }
 
+std::vector<uint8_t>
+TestControl::getMacAddress(uint32_t r, uint8_t& randomized) const {
+    // Get the base MAC address. We are going to randomize part of it.
+    std::vector<uint8_t> mac_addr(options_.getMacTemplate());
+    if (mac_addr.size() != HW_ETHER_LEN) {
+        isc_throw(BadValue, "invalid MAC address template specified");
+    }
+    randomized = 0;
+    // Randomize MAC address octets.
+    for (std::vector<uint8_t>::iterator it = mac_addr.end() - 1;
+         it >= mac_addr.begin();
+         --it) {
+        // Add the random value to the current octet.
+        (*it) += r;
+        ++randomized;
+        if (r < 256) {
+            // If we are here it means that there is no sense
+            // to randomize the remaining octets of MAC address
+            // because the following bytes of random value
+            // are zero and it will have no effect.
+            break;
+        }
+        // Randomize the next octet with the following
+        // byte of random value.
+        r >>= 8;
+    }
+    return (mac_addr);
+}
+
+std::vector<uint8_t>
+TestControl::getClientMacAddress(uint32_t client) const {
+    if (options_.getClientsNum() < 2) {
+        return (options_.getMacTemplate());
+    }
+    uint8_t randomized = 0;
+    return (getMacAddress(client, randomized));
+}
+
+std::vector<uint8_t>
+TestControl::getClientDuid(uint32_t client) const {
+    if (options_.getClientsNum() < 2) {
+        return (options_.getDuidTemplate());
+    }
+    // The same as generateDuid does: the MAC address of the client
+    // replaces the tail of the DUID template.
+    std::vector<uint8_t> mac_addr(getClientMacAddress(client));
+    std::vector<uint8_t> duid(options_.getDuidTemplate());
+    if (duid.size() < mac_addr.size()) {
+        isc_throw(BadValue, "invalid DUID template specified");
+    }
+    std::copy(mac_addr.begin(), mac_addr.end(),
+              duid.begin() + duid.size() - mac_addr.size());
+    return (duid);
+}
+
+uint32_t
+TestControl::getClientIndex(const std::vector<uint8_t>& id) const {
+    const std::vector<uint8_t>& mac_template = options_.getMacTemplate();
+    if ((id.size() < HW_ETHER_LEN) || (mac_template.size() != HW_ETHER_LEN)) {
+        isc_throw(BadValue, "identifier " << vector2Hex(id) << " is too"
+                  " short to hold the MAC address of the client");
+    }
+    // The client index has been added to the MAC address template
+    // octet by octet, starting from the last octet and without carry.
+    // The last octets of the identifier hold the MAC address both for
+    // the hardware address and for the DUID.
+    uint32_t client = 0;
+    const size_t offset = id.size() - HW_ETHER_LEN;
+    for (size_t i = 0; i < sizeof(client); ++i) {
+        const size_t pos = HW_ETHER_LEN - 1 - i;
+        uint8_t octet = id[offset + pos] - mac_template[pos];
+        client |= static_cast<uint32_t>(octet) << (8 * i);
+    }
+    return (client);
+}
+
 OptionPtr
 TestControl::generateClientId(const dhcp::HWAddrPtr& hwaddr) const {
     std::vector<uint8_t> client_id(1, static_cast<uint8_t>(hwaddr->htype_));
@@ -556,6 +608,10 @@ TestControl::sendMultipleMessages6(const uint32_t msg_type,
 
 void
 TestControl::printDiagnostics() const {
+    // Diagnostics are the same for all workers so print them once.
+    if (worker_ != 0) {
+        return;
+    }
     if (options_.testDiags('a')) {
         // Print all command line parameters.
         options_.printCommandLine();
@@ -778,7 +834,9 @@ TestControl::processReceivedPacket4(const Pkt4Ptr& pkt4) {
             // So, we may need to keep this DHCPACK in the storage if renews.
             // Note that, DHCPACK messages hold the information about
             // leases assigned. We use this information to renew.
-            if (stats_mgr_.hasExchangeStats(ExchangeType::RNA)) {
+            // The lifecycle scenario keeps its own state of the clients.
+            if (stats_mgr_.hasExchangeStats(ExchangeType::RNA) &&
+                (options_.getScenario() != Scenario::LIFECYCLE)) {
                 // Renew messages are sent, because StatsMgr has the
                 // specific exchange type specified. Let's append the DHCPACK.
                 // message to a storage
@@ -825,8 +883,9 @@ TestControl::processReceivedPacket6(const Pkt6Ptr& pkt6) {
             // being sent. Note that, Reply messages hold the information about
             // leases assigned. We use this information to construct Renew and
             // Release messages.
-            if (stats_mgr_.hasExchangeStats(ExchangeType::RN) ||
-                stats_mgr_.hasExchangeStats(ExchangeType::RL)) {
+            if ((stats_mgr_.hasExchangeStats(ExchangeType::RN) ||
+                 stats_mgr_.hasExchangeStats(ExchangeType::RL)) &&
+                (options_.getScenario() != Scenario::LIFECYCLE)) {
                 // Renew or Release messages are sent, because StatsMgr has the
                 // specific exchange type specified. Let's append the Reply
                 // message to a storage.
@@ -853,7 +912,7 @@ unsigned int
 TestControl::consumeReceivedPackets() {
     unsigned int pkt_count = 0;
     PktPtr pkt;
-    while ((pkt = receiver_.getPkt())) {
+    while ((pkt = receiver_->getPkt(worker_))) {
         pkt_count += 1;
         if (options_.getIpVersion() == 4) {
             Pkt4Ptr pkt4 = boost::dynamic_pointer_cast<Pkt4>(pkt);
@@ -862,6 +921,9 @@ TestControl::consumeReceivedPackets() {
             Pkt6Ptr pkt6 = boost::dynamic_pointer_cast<Pkt6>(pkt);
             processReceivedPacket6(pkt6);
         }
+        if (packet_handler_) {
+            packet_handler_(pkt);
+        }
     }
     return pkt_count;
 }
@@ -951,13 +1013,22 @@ TestControl::reset() {
     interrupted_ = false;
 }
 
-TestControl::TestControl(CommandOptions& options, BasePerfSocket &socket) :
+TestControl::TestControl(CommandOptions& options, BasePerfSocket &socket,
+                         const ReceiverPtr& receiver, size_t worker) :
     number_generator_(0, options.getMacsFromFile().size()),
     socket_(socket),
-    receiver_(socket, options.isSingleThreaded(), options.getIpVersion()),
+    receiver_(receiver),
+    worker_(worker),
+    exit_time_(not_a_date_time),
     stats_mgr_(options),
     options_(options)
 {
+    if (!receiver_) {
+        receiver_.reset(new Receiver(socket, options.isSingleThreaded(),
+                                     options.getIpVersion(),
+                                     options.getWorkers()));
+    }
+
     // Reset singleton state before test starts.
     reset();
 
@@ -971,16 +1042,37 @@ TestControl::TestControl(CommandOptions& options, BasePerfSocket &socket) :
     } else if (options_.getIpVersion() == 4) {
         // Turn off packet queueing.
         IfaceMgr::instance().configureDHCPPacketQueue(AF_INET, data::ElementPtr());
-        setTransidGenerator(NumberGeneratorPtr(new SequentialGenerator()));
+        if (options_.getWorkers() > 1) {
+            // The most significant byte of the transaction id holds
+            // the worker index so as the receiver can dispatch responses.
+            setTransidGenerator(NumberGeneratorPtr(new SequentialGenerator(0x01000000,
+                                                                           worker_ << 24)));
+        } else {
+            setTransidGenerator(NumberGeneratorPtr(new SequentialGenerator()));
+        }
     } else {
         // Turn off packet queueing.
         IfaceMgr::instance().configureDHCPPacketQueue(AF_INET6, data::ElementPtr());
-        setTransidGenerator(NumberGeneratorPtr(new SequentialGenerator(0x00FFFFFF)));
+        if (options_.getWorkers() > 1) {
+            setTransidGenerator(NumberGeneratorPtr(new SequentialGenerator(0x00010000,
+                                                                           worker_ << 16)));
+        } else {
+            setTransidGenerator(NumberGeneratorPtr(new SequentialGenerator(0x00FFFFFF)));
+        }
     }
 
     uint32_t clients_num = options_.getClientsNum() == 0 ?
         1 : options_.getClientsNum();
-    setMacAddrGenerator(NumberGeneratorPtr(new SequentialGenerator(clients_num)));
+    if (options_.getWorkers() > 1 && clients_num > 1) {
+        // Each worker simulates its own, disjoint range of clients.
+        uint32_t workers = options_.getWorkers();
+        uint32_t first = worker_ * (clients_num / workers) +
+            std::min(static_cast<uint32_t>(worker_), clients_num % workers);
+        setMacAddrGenerator(NumberGeneratorPtr(new SequentialGenerator(getWorkerShare(clients_num),
+                                                                       first)));
+    } else {
+        setMacAddrGenerator(NumberGeneratorPtr(new SequentialGenerator(clients_num)));
+    }
 
     // Diagnostics are command line options mainly.
     printDiagnostics();
@@ -1173,6 +1265,107 @@ TestControl::sendMessageFromReply(const uint16_t msg_type) {
     return (true);
 }
 
+void
+TestControl::sendLeaseMessage(const LeaseMessage msg, const uint32_t client,
+                              const IOAddress& addr,
+                              const OptionPtr& server_id) {
+    if (options_.getIpVersion() == 4) {
+        sendLeaseMessage4(msg, client, addr, server_id);
+    } else {
+        sendLeaseMessage6(msg, client, addr, server_id);
+    }
+}
+
+void
+TestControl::sendLeaseMessage4(const LeaseMessage msg, const uint32_t client,
+                               const IOAddress& addr,
+                               const OptionPtr& server_id) {
+    if (!addr.isV4() || addr.isV4Zero()) {
+        isc_throw(BadValue, "invalid leased address " << addr);
+    }
+    const uint8_t msg_type =
+        (msg == LeaseMessage::RELEASE ? DHCPRELEASE : DHCPREQUEST);
+    Pkt4Ptr pkt4(new Pkt4(msg_type, generateTransid()));
+    if (msg == LeaseMessage::REBOOT) {
+        // Client in the INIT-REBOOT state asks for its previous address
+        // in the requested IP address option.
+        OptionPtr opt_requested_address =
+            OptionPtr(new Option(Option::V4, DHO_DHCP_REQUESTED_ADDRESS,
+                                 OptionBuffer()));
+        opt_requested_address->setUint32(addr.toUint32());
+        pkt4->addOption(opt_requested_address);
+    } else {
+        pkt4->setCiaddr(addr);
+    }
+    if (msg == LeaseMessage::RELEASE) {
+        if (!server_id) {
+            isc_throw(BadValue, "server identifier is required to send"
+                      " DHCPRELEASE");
+        }
+        pkt4->addOption(server_id);
+    }
+    std::vector<uint8_t> mac_address = getClientMacAddress(client);
+    pkt4->setHWAddr(HTYPE_ETHER, mac_address.size(), mac_address);
+    pkt4->addOption(generateClientId(pkt4->getHWAddr()));
+    setDefaults4(pkt4);
+
+    // Add any extra options that user may have specified.
+    addExtraOpts(pkt4);
+
+    pkt4->pack();
+    socket_.send(pkt4);
+    // There is no response to the DHCPRELEASE. The renewing, rebinding
+    // and rebooting clients all send DHCPREQUEST.
+    if ((msg != LeaseMessage::RELEASE) &&
+        stats_mgr_.hasExchangeStats(ExchangeType::RNA)) {
+        stats_mgr_.passSentPacket(ExchangeType::RNA, pkt4);
+    }
+}
+
+void
+TestControl::sendLeaseMessage6(const LeaseMessage msg, const uint32_t client,
+                               const IOAddress& addr,
+                               const OptionPtr& server_id) {
+    if (!addr.isV6()) {
+        isc_throw(BadValue, "invalid leased address " << addr);
+    }
+    // Rebooting client confirms its lease with Rebind as the Confirm
+    // response does not carry the lease.
+    uint8_t msg_type = DHCPV6_REBIND;
+    if (msg == LeaseMessage::RENEW) {
+        msg_type = DHCPV6_RENEW;
+    } else if (msg == LeaseMessage::RELEASE) {
+        msg_type = DHCPV6_RELEASE;
+    }
+    Pkt6Ptr pkt6(new Pkt6(msg_type, generateTransid()));
+    pkt6->addOption(Option::factory(Option::V6, D6O_ELAPSED_TIME));
+    pkt6->addOption(Option::factory(Option::V6, D6O_CLIENTID,
+                                    getClientDuid(client)));
+    if ((msg == LeaseMessage::RENEW) || (msg == LeaseMessage::RELEASE)) {
+        if (!server_id) {
+            isc_throw(BadValue, "server identifier is required to send"
+                      " Renew or Release");
+        }
+        pkt6->addOption(server_id);
+    }
+    // The IAID is the same as the one sent in the Solicit.
+    Option6IAPtr ia(new Option6IA(D6O_IA_NA, 1));
+    ia->addOption(OptionPtr(new Option6IAAddr(D6O_IAADDR, addr, 0, 0)));
+    pkt6->addOption(ia);
+    setDefaults6(pkt6);
+
+    // Add any extra options that user may have specified.
+    addExtraOpts(pkt6);
+
+    pkt6->pack();
+    socket_.send(pkt6);
+    const ExchangeType xchg_type =
+        (msg == LeaseMessage::RELEASE ? ExchangeType::RL : ExchangeType::RN);
+    if (stats_mgr_.hasExchangeStats(xchg_type)) {
+        stats_mgr_.passSentPacket(xchg_type, pkt6);
+    }
+}
+
 void
 TestControl::sendRequest4(const dhcp::Pkt4Ptr& discover_pkt4,
                           const dhcp::Pkt4Ptr& offer_pkt4) {
@@ -118,7 +118,15 @@ static const size_t DHCPV6_IA_NA_OFFSET = 40;
 class TestControl : public boost::noncopyable {
 public:
     /// \brief Default constructor.
-    TestControl(CommandOptions& options, BasePerfSocket& socket);
+    ///
+    /// \param options reference to command options.
+    /// \param socket reference to a socket.
+    /// \param receiver receiver shared by multiple workers. If null, the
+    /// new receiver is created with a queue for each worker.
+    /// \param worker index of the worker using this object.
+    TestControl(CommandOptions& options, BasePerfSocket& socket,
+                const ReceiverPtr& receiver = ReceiverPtr(),
+                size_t worker = 0);
 
     /// Packet template buffer.
     typedef std::vector<uint8_t> TemplateBuffer;
@@ -161,10 +169,13 @@ public:
         ///
         /// \param range maximum number generated. If 0 is given then
         /// range defaults to maximum uint32_t value.
-        SequentialGenerator(uint32_t range = 0xFFFFFFFF) :
+        /// \param offset value added to each generated number.
+        SequentialGenerator(uint32_t range = 0xFFFFFFFF,
+                            uint32_t offset = 0) :
             NumberGenerator(),
             num_(0),
-            range_(range) {
+            range_(range),
+            offset_(offset) {
             if (range_ == 0) {
                 range_ = 0xFFFFFFFF;
             }
@@ -176,11 +187,23 @@ public:
         virtual uint32_t generate() {
             uint32_t num = num_;
             num_ = (num_ + 1) % range_;
-            return (num);
+            return (offset_ + num);
         }
     private:
-        uint32_t num_;   ///< Current number.
-        uint32_t range_; ///< Number of unique numbers generated.
+        uint32_t num_;    ///< Current number.
+        uint32_t range_;  ///< Number of unique numbers generated.
+        uint32_t offset_; ///< Offset added to generated numbers.
+    };
+
+    /// \brief Handler of the received packets.
+    typedef boost::function<void(const dhcp::PktPtr&)> PacketHandler;
+
+    /// \brief Messages sent by clients for their existing leases.
+    enum class LeaseMessage {
+        RENEW,   ///< Renew the lease with the server which granted it.
+        REBIND,  ///< Extend the lease with any server.
+        REBOOT,  ///< Confirm the lease after reboot (INIT-REBOOT).
+        RELEASE  ///< Release the lease.
     };
 
     /// \brief Length of the Ethernet HW address (MAC) in bytes.
@@ -208,6 +231,17 @@ public:
         macaddr_gen_ = generator;
     }
 
+    /// \brief Set handler of the received packets.
+    ///
+    /// The handler is called for each packet pulled from the receiver
+    /// after the packet has been processed. It allows scenarios to
+    /// track the state of the simulated clients.
+    ///
+    /// \param handler handler to be called, empty handler disables it.
+    void setPacketHandler(const PacketHandler& handler) {
+        packet_handler_ = handler;
+    }
+
     /// \brief Removes cached DHCPv6 Reply packets every second.
     ///
     /// This function wipes cached Reply packets from the storage.
@@ -223,10 +257,52 @@ public:
 
     bool interrupted() const { return interrupted_; }
 
+    /// \brief Interrupt the test.
+    ///
+    /// Sets the same flag as the interrupt signal handler so as all
+    /// workers finish the test.
+    void interrupt() { interrupted_ = true; }
+
     StatsMgr& getStatsMgr() { return stats_mgr_; };
 
-    void start() { receiver_.start(); }
-    void stop() { receiver_.stop(); }
+    /// \brief Start receiving packets.
+    ///
+    /// Only the first worker controls the shared receiver.
+    void start() {
+        if (worker_ == 0) {
+            receiver_->start();
+        }
+    }
+
+    /// \brief Stop receiving packets.
+    ///
+    /// Only the first worker controls the shared receiver.
+    void stop() {
+        if (worker_ == 0) {
+            receiver_->stop();
+        }
+    }
+
+    /// \brief Returns receiver used by this object.
+    const ReceiverPtr& getReceiver() const { return (receiver_); }
+
+    /// \brief Returns index of the worker using this object.
+    size_t getWorker() const { return (worker_); }
+
+    /// \brief Returns the share of a total value for this worker.
+    ///
+    /// The total is divided evenly between workers. The remainder is
+    /// spread over the first workers so as the shares sum to the total.
+    ///
+    /// \param total value to be divided between workers.
+    /// \return share of the total for this worker.
+    uint64_t getWorkerShare(uint64_t total) const {
+        uint64_t workers = options_.getWorkers();
+        if (workers <= 1) {
+            return (total);
+        }
+        return (total / workers + (worker_ < total % workers ? 1 : 0));
+    }
 
     /// \brief Run wrapped command.
     ///
@@ -276,6 +352,47 @@ public:
     uint64_t sendMultipleMessages6(const uint32_t msg_type,
                                    const uint64_t msg_num);
 
+    /// \brief Send a message for the existing lease of a client.
+    ///
+    /// The message is built from the index of the client and its leased
+    /// address so as the callers do not need to keep the server responses.
+    /// DHCPv4 clients send DHCPREQUEST to renew, rebind or confirm the
+    /// lease after reboot and DHCPRELEASE to release it. DHCPv6 clients
+    /// send Renew, Rebind (also after reboot) or Release. Messages are
+    /// accounted in the renew (RNA/RN) or release (RL) exchanges.
+    ///
+    /// \param msg kind of the message.
+    /// \param client index of the client.
+    /// \param addr address leased to the client.
+    /// \param server_id server identifier option, required by DHCPv4
+    /// release and by DHCPv6 renew and release.
+    /// \throw isc::BadValue if the address or server identifier is invalid.
+    void sendLeaseMessage(const LeaseMessage msg, const uint32_t client,
+                          const asiolink::IOAddress& addr,
+                          const dhcp::OptionPtr& server_id);
+
+    /// \brief Returns MAC address of a client.
+    ///
+    /// \param client index of the client.
+    /// \return MAC address generated the same way as for new exchanges.
+    std::vector<uint8_t> getClientMacAddress(uint32_t client) const;
+
+    /// \brief Returns DUID of a client.
+    ///
+    /// \param client index of the client.
+    /// \return DUID generated the same way as for new exchanges.
+    std::vector<uint8_t> getClientDuid(uint32_t client) const;
+
+    /// \brief Returns index of the client owning a MAC address or DUID.
+    ///
+    /// This is the reverse of \ref getClientMacAddress and
+    /// \ref getClientDuid.
+    ///
+    /// \param id MAC address or DUID of the client.
+    /// \return index of the client.
+    /// \throw isc::BadValue if the identifier is too short.
+    uint32_t getClientIndex(const std::vector<uint8_t>& id) const;
+
     /// \brief Pull packets from receiver and process them.
     ///
     /// It runs in a loop until there are no packets in receiver.
@@ -485,6 +602,37 @@ protected:
     /// \return generated MAC address.
     std::vector<uint8_t> generateMacAddress(uint8_t& randomized);
 
+    /// \brief Build MAC address from a number.
+    ///
+    /// The number is added to the MAC address template octet by octet
+    /// starting from the last octet.
+    ///
+    /// \param r number identifying the client.
+    /// \param [out] randomized number of bytes randomized.
+    /// \throw isc::BadValue if MAC address template has invalid size.
+    /// \return MAC address.
+    std::vector<uint8_t> getMacAddress(uint32_t r, uint8_t& randomized) const;
+
+    /// \brief Send a DHCPv4 message for the existing lease of a client.
+    ///
+    /// \param msg kind of the message.
+    /// \param client index of the client.
+    /// \param addr address leased to the client.
+    /// \param server_id server identifier option.
+    void sendLeaseMessage4(const LeaseMessage msg, const uint32_t client,
+                           const asiolink::IOAddress& addr,
+                           const dhcp::OptionPtr& server_id);
+
+    /// \brief Send a DHCPv6 message for the existing lease of a client.
+    ///
+    /// \param msg kind of the message.
+    /// \param client index of the client.
+    /// \param addr address leased to the client.
+    /// \param server_id server identifier option.
+    void sendLeaseMessage6(const LeaseMessage msg, const uint32_t client,
+                           const asiolink::IOAddress& addr,
+                           const dhcp::OptionPtr& server_id);
+
     /// \brief generate transaction id.
     ///
     /// Generate transaction id value (32-bit for DHCPv4,
@@ -920,7 +1068,12 @@ protected:
     void readPacketTemplate(const std::string& file_name);
 
     BasePerfSocket &socket_;
-    Receiver receiver_;
+    ReceiverPtr receiver_;
+
+    size_t worker_; ///< Index of the worker using this object.
+
+    /// Time when the exit wait period ends.
+    mutable boost::posix_time::ptime exit_time_;
 
     boost::posix_time::ptime last_report_; ///< Last intermediate report time.
 
@@ -932,6 +1085,8 @@ protected:
     NumberGeneratorPtr transid_gen_; ///< Transaction id generator.
     NumberGeneratorPtr macaddr_gen_; ///< Numbers generator for MAC address.
 
+    PacketHandler packet_handler_; ///< Handler of the received packets.
+
     /// Buffer holding server id received in first packet
     dhcp::OptionBuffer first_packet_serverid_;
 
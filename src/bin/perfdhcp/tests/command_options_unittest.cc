@@ -752,6 +752,97 @@ TEST_F(CommandOptionsTest, Period) {
                  isc::InvalidParameter);
 }
 
+TEST_F(CommandOptionsTest, Workers) {
+    CommandOptions opt;
+    EXPECT_NO_THROW(process(opt, "perfdhcp -l ethx all"));
+    EXPECT_EQ(1, opt.getWorkers());
+
+    EXPECT_NO_THROW(process(opt, "perfdhcp -g multi --workers 4 -R 100 -r 40 -l ethx all"));
+    EXPECT_EQ(4, opt.getWorkers());
+
+    // Negative test cases
+    // Number of workers must be positive integer
+    EXPECT_THROW(process(opt, "perfdhcp -g multi --workers 0 -l ethx all"),
+                 isc::InvalidParameter);
+    // and it must not exceed 256.
+    EXPECT_THROW(process(opt, "perfdhcp -g multi --workers 257 -l ethx all"),
+                 isc::InvalidParameter);
+    // Workers require multi-thread mode
+    EXPECT_THROW(process(opt, "perfdhcp -g single --workers 2 -l ethx all"),
+                 isc::InvalidParameter);
+    // and the basic scenario.
+    EXPECT_THROW(process(opt, "perfdhcp -g multi --workers 2 -R 10 "
+                         "--scenario avalanche -l ethx all"),
+                 isc::InvalidParameter);
+    // Each worker must have at least one client
+    EXPECT_THROW(process(opt, "perfdhcp -g multi --workers 4 -R 3 -l ethx all"),
+                 isc::InvalidParameter);
+    // and a non-zero rate.
+    EXPECT_THROW(process(opt, "perfdhcp -g multi --workers 4 -r 3 -l ethx all"),
+                 isc::InvalidParameter);
+}
+
+TEST_F(CommandOptionsTest, ReportFormat) {
+    CommandOptions opt;
+    EXPECT_NO_THROW(process(opt, "perfdhcp -l ethx all"));
+    EXPECT_TRUE(opt.getReportFormat() == ReportFormat::TEXT);
+
+    EXPECT_NO_THROW(process(opt, "perfdhcp --report-format json -l ethx all"));
+    EXPECT_TRUE(opt.getReportFormat() == ReportFormat::JSON);
+
+    EXPECT_NO_THROW(process(opt, "perfdhcp --report-format csv -l ethx all"));
+    EXPECT_TRUE(opt.getReportFormat() == ReportFormat::CSV);
+
+    // Negative test cases
+    EXPECT_THROW(process(opt, "perfdhcp --report-format xml -l ethx all"),
+                 isc::InvalidParameter);
+}
+
+TEST_F(CommandOptionsTest, Lifecycle) {
+    CommandOptions opt;
+    EXPECT_NO_THROW(process(opt, "perfdhcp --scenario lifecycle -R 100"
+                            " -p 60 -l ethx all"));
+    EXPECT_TRUE(opt.getScenario() == Scenario::LIFECYCLE);
+    EXPECT_EQ(0, opt.getRenewTime());
+    EXPECT_EQ(0, opt.getRebindTime());
+    EXPECT_EQ(0, opt.getReleaseRatio());
+    EXPECT_EQ(0, opt.getStormTime());
+
+    EXPECT_NO_THROW(process(opt, "perfdhcp --scenario lifecycle -R 100"
+                            " --renew-time 10 --rebind-time 20"
+                            " --release-ratio 5 --storm-time 30"
+                            " -l ethx all"));
+    EXPECT_EQ(10, opt.getRenewTime());
+    EXPECT_EQ(20, opt.getRebindTime());
+    EXPECT_EQ(5, opt.getReleaseRatio());
+    EXPECT_EQ(30, opt.getStormTime());
+
+    // Negative test cases
+    // Lifecycle options require lifecycle scenario.
+    EXPECT_THROW(process(opt, "perfdhcp --storm-time 30 -R 100 -l ethx all"),
+                 isc::InvalidParameter);
+    // Number of clients must be given.
+    EXPECT_THROW(process(opt, "perfdhcp --scenario lifecycle -p 60"
+                         " -l ethx all"), isc::InvalidParameter);
+    // Test period or storm is required to end the test.
+    EXPECT_THROW(process(opt, "perfdhcp --scenario lifecycle -R 100"
+                         " -l ethx all"), isc::InvalidParameter);
+    // Storm must happen within the test period.
+    EXPECT_THROW(process(opt, "perfdhcp --scenario lifecycle -R 100"
+                         " -p 10 --storm-time 10 -l ethx all"),
+                 isc::InvalidParameter);
+    // Rebind must follow renew.
+    EXPECT_THROW(process(opt, "perfdhcp --scenario lifecycle -R 100 -p 60"
+                         " --renew-time 20 --rebind-time 10 -l ethx all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp --scenario lifecycle -R 100 -p 60"
+                         " --release-ratio 101 -l ethx all"),
+                 isc::InvalidParameter);
+    // Full exchanges are required.
+    EXPECT_THROW(process(opt, "perfdhcp --scenario lifecycle -R 100 -p 60"
+                         " -i -l ethx all"), isc::InvalidParameter);
+}
+
 TEST_F(CommandOptionsTest, Interface) {
     // In order to make this test portable we need to know
     // at least one interface name on OS where test is run.
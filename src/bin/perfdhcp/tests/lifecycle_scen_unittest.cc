@@ -0,0 +1,256 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include "command_options_helper.h"
+#include "../lifecycle_scen.h"
+
+#include <asiolink/io_address.h>
+#include <exceptions/exceptions.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/pkt4.h>
+#include <dhcp/pkt6.h>
+#include <dhcp/option6_ia.h>
+#include <dhcp/option6_iaaddr.h>
+#include <dhcp/iface_mgr.h>
+
+#include <list>
+#include <string>
+#include <gtest/gtest.h>
+
+using namespace std;
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::perfdhcp;
+
+/// \brief FakeLifecycleScenPerfSocket class that mocks PerfSocket.
+///
+/// It stubs send and receive operations and simulates a DHCP server
+/// granting leases with T1 of 1 second.
+class FakeLifecycleScenPerfSocket: public BasePerfSocket {
+public:
+    /// \brief Default constructor for FakeLifecycleScenPerfSocket.
+    FakeLifecycleScenPerfSocket() :
+        iface_(boost::make_shared<Iface>("fake", 0)),
+        sent_cnt_(0),
+        released_cnt_(0),
+        rebooted_cnt_(0) {};
+
+    IfacePtr iface_;  ///< Local fake interface.
+
+    int sent_cnt_;      ///< Counter of sent packets.
+    int released_cnt_;  ///< Counter of released leases.
+    int rebooted_cnt_;  ///< Counter of lease confirmations after reboot.
+
+    /// Responses planned to be sent to perfdhcp.
+    std::list<PktPtr> planned_responses_;
+
+    /// \brief Simulate receiving DHCPv4 packet.
+    virtual dhcp::Pkt4Ptr receive4(uint32_t, uint32_t) override {
+        if (planned_responses_.empty()) {
+            return (Pkt4Ptr());
+        }
+        Pkt4Ptr pkt = boost::dynamic_pointer_cast<Pkt4>(planned_responses_.front());
+        planned_responses_.pop_front();
+        pkt->updateTimestamp();
+        return (pkt);
+    };
+
+    /// \brief Simulate receiving DHCPv6 packet.
+    virtual dhcp::Pkt6Ptr receive6(uint32_t, uint32_t) override {
+        if (planned_responses_.empty()) {
+            return (Pkt6Ptr());
+        }
+        Pkt6Ptr pkt = boost::dynamic_pointer_cast<Pkt6>(planned_responses_.front());
+        planned_responses_.pop_front();
+        pkt->updateTimestamp();
+        return (pkt);
+    };
+
+    /// \brief Simulate sending DHCPv4 packet.
+    virtual bool send(const dhcp::Pkt4Ptr& pkt) override {
+        sent_cnt_++;
+        pkt->updateTimestamp();
+        uint8_t type = 0;
+        if (pkt->getType() == DHCPDISCOVER) {
+            type = DHCPOFFER;
+        } else if (pkt->getType() == DHCPREQUEST) {
+            type = DHCPACK;
+            if (pkt->getOption(DHO_DHCP_REQUESTED_ADDRESS) &&
+                !pkt->getOption(DHO_DHCP_SERVER_IDENTIFIER)) {
+                rebooted_cnt_++;
+            }
+        } else if (pkt->getType() == DHCPRELEASE) {
+            released_cnt_++;
+            return (true);
+        } else {
+            ADD_FAILURE() << "unexpected message type " << int(pkt->getType());
+            return (true);
+        }
+        Pkt4Ptr resp(new Pkt4(type, pkt->getTransid()));
+        resp->setHWAddr(pkt->getHWAddr());
+        resp->setYiaddr(IOAddress("192.0.2.1"));
+        resp->addOption(Option::factory(Option::V4, DHO_DHCP_SERVER_IDENTIFIER,
+                                        OptionBuffer(4, 1)));
+        resp->addOption(OptionPtr(new Option(Option::V4, DHO_DHCP_LEASE_TIME,
+                                             OptionBuffer({0, 0, 0, 60}))));
+        resp->addOption(OptionPtr(new Option(Option::V4, DHO_DHCP_RENEWAL_TIME,
+                                             OptionBuffer({0, 0, 0, 1}))));
+        planned_responses_.push_back(resp);
+        return (true);
+    };
+
+    /// \brief Simulate sending DHCPv6 packet.
+    virtual bool send(const dhcp::Pkt6Ptr& pkt) override {
+        sent_cnt_++;
+        pkt->updateTimestamp();
+        uint8_t type = DHCPV6_REPLY;
+        if (pkt->getType() == DHCPV6_SOLICIT) {
+            type = DHCPV6_ADVERTISE;
+        } else if (pkt->getType() == DHCPV6_REBIND) {
+            rebooted_cnt_++;
+        } else if (pkt->getType() == DHCPV6_RELEASE) {
+            released_cnt_++;
+            return (true);
+        }
+        Pkt6Ptr resp(new Pkt6(type, pkt->getTransid()));
+        Option6IAPtr ia(new Option6IA(D6O_IA_NA, 1));
+        ia->setT1(1);
+        ia->setT2(2);
+        ia->addOption(OptionPtr(new Option6IAAddr(D6O_IAADDR,
+                                                  IOAddress("2001:db8::1"),
+                                                  30, 60)));
+        resp->addOption(ia);
+        resp->addOption(OptionPtr(new Option(Option::V6, D6O_SERVERID,
+                                             OptionBuffer(10, 1))));
+        resp->addOption(pkt->getOption(D6O_CLIENTID));
+        planned_responses_.push_back(resp);
+        return (true);
+    };
+
+    /// \brief Override getting interface.
+    virtual IfacePtr getIface() override { return iface_; }
+};
+
+
+/// \brief NakedLifecycleScen class.
+///
+/// It exposes LifecycleScen internals for UT.
+class NakedLifecycleScen: public LifecycleScen {
+public:
+    using LifecycleScen::tc_;
+
+    FakeLifecycleScenPerfSocket fake_sock_;
+
+    NakedLifecycleScen(CommandOptions &opt) : LifecycleScen(opt, fake_sock_) {};
+};
+
+
+/// \brief Test Fixture Class
+///
+/// This test fixture class is used to perform
+/// unit tests on perfdhcp LifecycleScen class.
+class LifecycleScenTest : public virtual ::testing::Test
+{
+public:
+    LifecycleScenTest() { }
+
+    /// \brief Parse command line string with CommandOptions.
+    ///
+    /// \param cmdline command line string to be parsed.
+    /// \throw isc::Unexpected if unexpected error occurred.
+    /// \throw isc::InvalidParameter if command line is invalid.
+    void processCmdLine(CommandOptions &opt, const std::string& cmdline) const {
+        CommandOptionsHelper::process(opt, cmdline);
+    }
+
+    /// \brief Check that all clients went through renewal and the storm.
+    ///
+    /// \param ls scenario which has been run.
+    void checkStorm(const NakedLifecycleScen& ls) const {
+        EXPECT_TRUE(ls.getPhase() == LifecycleScen::Phase::RECOVERED);
+        EXPECT_EQ(10, ls.getLeasedNum());
+
+        // All clients got their first leases in the bring-up phase.
+        const LifecycleScen::PhaseStats& bring_up =
+            ls.getPhaseStats(LifecycleScen::Phase::BRING_UP);
+        EXPECT_EQ(10, bring_up.initiated_);
+        EXPECT_EQ(10, bring_up.leases_);
+        EXPECT_EQ(10, bring_up.latency_.getCount());
+
+        // They renewed at T1 in the steady phase.
+        const LifecycleScen::PhaseStats& steady =
+            ls.getPhaseStats(LifecycleScen::Phase::STEADY);
+        EXPECT_GE(steady.renews_, 10);
+        EXPECT_EQ(0, steady.rebinds_);
+        EXPECT_EQ(0, steady.naks_);
+
+        // And confirmed their leases after the reboot.
+        const LifecycleScen::PhaseStats& storm =
+            ls.getPhaseStats(LifecycleScen::Phase::STORM);
+        EXPECT_EQ(10, storm.reboots_);
+        EXPECT_EQ(0, storm.initiated_);
+        EXPECT_EQ(10, storm.leases_);
+        EXPECT_EQ(10, ls.fake_sock_.rebooted_cnt_);
+        EXPECT_EQ(0, ls.fake_sock_.released_cnt_);
+    }
+};
+
+
+TEST_F(LifecycleScenTest, Packet4Lifecycle) {
+    CommandOptions opt;
+    processCmdLine(opt, "perfdhcp -l fake -4 -R 10 --scenario lifecycle"
+                   " --storm-time 2 -g single 127.0.0.1");
+    NakedLifecycleScen ls(opt);
+
+    EXPECT_EQ(0, ls.run());
+
+    checkStorm(ls);
+    for (uint32_t client = 0; client < 10; ++client) {
+        EXPECT_TRUE(ls.getClient(client).state_ == LifecycleScen::ClientState::BOUND);
+    }
+    EXPECT_EQ(10, ls.tc_.getStatsMgr().getSentPacketsNum(ExchangeType::DO));
+    EXPECT_EQ(10, ls.tc_.getStatsMgr().getRcvdPacketsNum(ExchangeType::RA));
+    // Renewals and reboots are accounted as renew exchanges.
+    EXPECT_GE(ls.tc_.getStatsMgr().getRcvdPacketsNum(ExchangeType::RNA), 20);
+}
+
+
+TEST_F(LifecycleScenTest, Packet6Lifecycle) {
+    CommandOptions opt;
+    processCmdLine(opt, "perfdhcp -l fake -6 -R 10 --scenario lifecycle"
+                   " --storm-time 2 -g single ::1");
+    NakedLifecycleScen ls(opt);
+
+    EXPECT_EQ(0, ls.run());
+
+    checkStorm(ls);
+    EXPECT_EQ(10, ls.tc_.getStatsMgr().getSentPacketsNum(ExchangeType::SA));
+    EXPECT_EQ(10, ls.tc_.getStatsMgr().getRcvdPacketsNum(ExchangeType::RR));
+    EXPECT_GE(ls.tc_.getStatsMgr().getRcvdPacketsNum(ExchangeType::RN), 20);
+}
+
+
+TEST_F(LifecycleScenTest, Packet4Release) {
+    CommandOptions opt;
+    processCmdLine(opt, "perfdhcp -l fake -4 -R 10 --scenario lifecycle"
+                   " --release-ratio 100 -p 2 -g single 127.0.0.1");
+    NakedLifecycleScen ls(opt);
+
+    EXPECT_EQ(0, ls.run());
+
+    // All clients released their leases at T1 instead of renewing them
+    // and reconnected within T1.
+    const LifecycleScen::PhaseStats& steady =
+        ls.getPhaseStats(LifecycleScen::Phase::STEADY);
+    EXPECT_EQ(0, steady.renews_);
+    EXPECT_GE(steady.releases_, 10);
+    EXPECT_GE(steady.initiated_, 1);
+    EXPECT_EQ(steady.releases_, ls.fake_sock_.released_cnt_);
+}
@@ -114,3 +114,37 @@ TEST(Receiver, multiThreaded) {
 
     ASSERT_NO_THROW(receiver.stop());
 }
+
+
+TEST(Receiver, workerIndex) {
+    // With a single worker all packets go to the first queue.
+    EXPECT_EQ(0, Receiver::getWorkerIndex(0xFF000001, 4, 1));
+
+    // The worker index is the most significant byte of the DHCPv4
+    // transaction id and of the 24-bit DHCPv6 transaction id.
+    EXPECT_EQ(0, Receiver::getWorkerIndex(0x00ABCDEF, 4, 4));
+    EXPECT_EQ(3, Receiver::getWorkerIndex(0x03000001, 4, 4));
+    EXPECT_EQ(2, Receiver::getWorkerIndex(0x020001, 6, 4));
+    EXPECT_EQ(1, Receiver::getWorkerIndex(0x01FFFF, 6, 4));
+}
+
+
+TEST(Receiver, multiThreadedQueues) {
+    CommandOptions opt;
+    CommandOptionsHelper::process(opt, "perfdhcp -g multi --workers 3 -l 127.0.0.1 all");
+    ASSERT_EQ(3, opt.getWorkers());
+
+    FakeReceiverPerfSocket socket;
+    Receiver receiver(socket, opt.isSingleThreaded(), opt.getIpVersion(),
+                      opt.getWorkers());
+    EXPECT_EQ(3, receiver.getQueuesNum());
+
+    ASSERT_NO_THROW(receiver.start());
+
+    for (size_t i = 0; i < receiver.getQueuesNum(); ++i) {
+        EXPECT_EQ(receiver.getPkt(i), nullptr);
+    }
+    EXPECT_THROW(receiver.getPkt(3), std::out_of_range);
+
+    ASSERT_NO_THROW(receiver.stop());
+}
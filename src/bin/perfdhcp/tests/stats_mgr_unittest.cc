@@ -10,6 +10,7 @@
 
 #include <perfdhcp/stats_mgr.h>
 
+#include <cc/data.h>
 #include <exceptions/exceptions.h>
 #include <dhcp/dhcp4.h>
 #include <dhcp/dhcp6.h>
@@ -22,6 +23,8 @@
 #include <boost/scoped_ptr.hpp>
 #include <boost/shared_ptr.hpp>
 
+#include <algorithm>
+
 using namespace std;
 using namespace isc;
 using namespace isc::dhcp;
@@ -491,6 +494,63 @@ TEST_F(StatsMgrTest, Delays) {
     EXPECT_GT(stats_mgr->getStdDevDelay(ExchangeType::DO), 0);
 }
 
+TEST_F(StatsMgrTest, DelayPercentiles) {
+    CommandOptions opt;
+    boost::shared_ptr<StatsMgr> stats_mgr(new StatsMgr(opt));
+    stats_mgr->addExchangeStats(ExchangeType::DO, 5);
+
+    // Percentiles are not available until packets are received.
+    EXPECT_THROW(stats_mgr->getDelayPercentile(ExchangeType::DO, 50),
+                 isc::InvalidOperation);
+
+    passDOPacketsWithDelay(stats_mgr, 1, common_transid);
+    passDOPacketsWithDelay(stats_mgr, 2, common_transid + 1);
+    passDOPacketsWithDelay(stats_mgr, 3, common_transid + 2);
+
+    // Percentiles are within the histogram precision.
+    EXPECT_NEAR(2, stats_mgr->getDelayPercentile(ExchangeType::DO, 50),
+                2. / 16);
+    EXPECT_NEAR(3, stats_mgr->getDelayPercentile(ExchangeType::DO, 99),
+                3. / 16);
+    EXPECT_THROW(stats_mgr->getDelayPercentile(ExchangeType::DO, 101),
+                 isc::BadValue);
+}
+
+TEST_F(StatsMgrTest, CollectExpiredOnSend) {
+    CommandOptions opt;
+    boost::scoped_ptr<StatsMgr> stats_mgr(new StatsMgr(opt));
+    stats_mgr->addExchangeStats(ExchangeType::DO, 2);
+
+    // Send packets which are never answered. Their timestamps are
+    // 10s in the past so they are older than the 2s drop time.
+    for (unsigned int i = 0; i < TEST_COLLECTED_PKT_NUM; ++i) {
+        Pkt4ModifiablePtr sent_packet(createPacket4(DHCPDISCOVER,
+                                                    common_transid + i));
+        sent_packet->modifyTimestamp(-10);
+        ASSERT_NO_THROW(
+            stats_mgr->passSentPacket(ExchangeType::DO, sent_packet)
+        );
+    }
+    EXPECT_EQ(0, stats_mgr->getCollectedNum(ExchangeType::DO));
+
+    // Sending the next packet collects all timed out packets even
+    // though no response has been received.
+    Pkt4ModifiablePtr sent_packet(createPacket4(DHCPDISCOVER, 1));
+    ASSERT_NO_THROW(
+        stats_mgr->passSentPacket(ExchangeType::DO, sent_packet)
+    );
+    EXPECT_EQ(TEST_COLLECTED_PKT_NUM,
+              stats_mgr->getCollectedNum(ExchangeType::DO));
+
+    // The remaining packet is still matched.
+    Pkt4ModifiablePtr rcvd_packet(createPacket4(DHCPOFFER, 1));
+    ASSERT_NO_THROW(
+        stats_mgr->passRcvdPacket(ExchangeType::DO, rcvd_packet)
+    );
+    EXPECT_EQ(1, stats_mgr->getRcvdPacketsNum(ExchangeType::DO));
+    EXPECT_EQ(0, stats_mgr->getOrphans(ExchangeType::DO));
+}
+
 TEST_F(StatsMgrTest, CustomCounters) {
     CommandOptions opt;
     boost::scoped_ptr<StatsMgr> stats_mgr(new StatsMgr(opt));
@@ -531,6 +591,90 @@ TEST_F(StatsMgrTest, CustomCounters) {
 
 }
 
+TEST_F(StatsMgrTest, Merge) {
+    CommandOptions opt;
+    boost::shared_ptr<StatsMgr> stats_mgr(new StatsMgr(opt));
+    stats_mgr->addExchangeStats(ExchangeType::DO, 5);
+    stats_mgr->addCustomCounter("shortwait", "Short waits");
+    boost::shared_ptr<StatsMgr> other_mgr(new StatsMgr(opt));
+    other_mgr->addExchangeStats(ExchangeType::DO, 5);
+    other_mgr->addCustomCounter("shortwait", "Short waits");
+
+    // Each manager gets one complete exchange with a different delay.
+    passDOPacketsWithDelay(stats_mgr, 2, common_transid);
+    passDOPacketsWithDelay(other_mgr, 1, common_transid + 1);
+
+    // The other manager also gets one unanswered DISCOVER.
+    boost::shared_ptr<Pkt4> sent_packet(createPacket4(DHCPDISCOVER,
+                                                      common_transid + 2));
+    ASSERT_NO_THROW(other_mgr->passSentPacket(ExchangeType::DO, sent_packet));
+
+    stats_mgr->incrementCounter("shortwait", 3);
+    other_mgr->incrementCounter("shortwait", 4);
+
+    ASSERT_NO_THROW(stats_mgr->merge(*other_mgr));
+
+    EXPECT_EQ(3, stats_mgr->getSentPacketsNum(ExchangeType::DO));
+    EXPECT_EQ(2, stats_mgr->getRcvdPacketsNum(ExchangeType::DO));
+    EXPECT_EQ(1, stats_mgr->getDroppedPacketsNum(ExchangeType::DO));
+    EXPECT_LT(stats_mgr->getMinDelay(ExchangeType::DO), 2);
+    EXPECT_GT(stats_mgr->getMaxDelay(ExchangeType::DO), 2 - 0.001);
+    EXPECT_EQ(7, stats_mgr->getCounter("shortwait")->getValue());
+
+    // The other manager is left untouched.
+    EXPECT_EQ(2, other_mgr->getSentPacketsNum(ExchangeType::DO));
+}
+
+TEST_F(StatsMgrTest, Report) {
+    using namespace isc::data;
+
+    CommandOptions opt;
+    CommandOptionsHelper::process(opt, "perfdhcp -i -d 5 --report-format json"
+                                  " 127.0.0.1");
+    boost::shared_ptr<StatsMgr> stats_mgr(new StatsMgr(opt));
+    passDOPacketsWithDelay(stats_mgr, 1, common_transid);
+
+    // The interval report gives the delays since the test start.
+    ConstElementPtr report;
+    ASSERT_NO_THROW(report = Element::fromJSON(stats_mgr->getReport(false,
+                                                                     ReportFormat::JSON)));
+    ASSERT_TRUE(report);
+    EXPECT_EQ("interval", report->get("report")->stringValue());
+    ConstElementPtr xchg = report->get("exchanges")->get("DISCOVER-OFFER");
+    ASSERT_TRUE(xchg);
+    EXPECT_EQ(1, xchg->get("sent")->intValue());
+    EXPECT_EQ(1, xchg->get("received")->intValue());
+    EXPECT_EQ(0, xchg->get("drops")->intValue());
+    EXPECT_EQ(0, xchg->get("orphans")->intValue());
+    EXPECT_NEAR(1000, xchg->get("p50")->doubleValue(), 1000. / 16);
+    EXPECT_NEAR(1000, xchg->get("p99.9")->doubleValue(), 1000. / 16);
+
+    // Printing the intermediate report starts a new interval.
+    stats_mgr->printIntermediateStats();
+    ASSERT_NO_THROW(report = Element::fromJSON(stats_mgr->getReport(false,
+                                                                     ReportFormat::JSON)));
+    xchg = report->get("exchanges")->get("DISCOVER-OFFER");
+    ASSERT_TRUE(xchg);
+    EXPECT_EQ(Element::null, xchg->get("p50")->getType());
+
+    // The final report gives all delays since the test start.
+    ASSERT_NO_THROW(report = Element::fromJSON(stats_mgr->getReport(true,
+                                                                     ReportFormat::JSON)));
+    EXPECT_EQ("final", report->get("report")->stringValue());
+    xchg = report->get("exchanges")->get("DISCOVER-OFFER");
+    ASSERT_TRUE(xchg);
+    EXPECT_NEAR(1000, xchg->get("p50")->doubleValue(), 1000. / 16);
+
+    // The CSV report holds one row per exchange.
+    std::string csv = stats_mgr->getReport(true, ReportFormat::CSV);
+    EXPECT_EQ(0, csv.find("final,"));
+    EXPECT_NE(std::string::npos, csv.find(",DISCOVER-OFFER,1,1,0,0,"));
+    EXPECT_EQ(1, std::count(csv.begin(), csv.end(), '\n'));
+    std::string header = StatsMgr::getCsvHeader();
+    EXPECT_EQ(std::count(header.begin(), header.end(), ','),
+              std::count(csv.begin(), csv.end(), ','));
+}
+
 TEST_F(StatsMgrTest, PrintStats) {
     std::cout << "This unit test is checking statistics printing "
               << "capabilities. It is expected that some counters "
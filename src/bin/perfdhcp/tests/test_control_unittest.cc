@@ -1166,6 +1166,60 @@ TEST_F(TestControlTest, GenerateMacAddress) {
     ASSERT_TRUE(std::find(macs.begin(), macs.end(), mac) !=  macs.end());
 }
 
+TEST_F(TestControlTest, SequentialGenerator) {
+    // Numbers are generated from the offset and wrap at the range.
+    TestControl::SequentialGenerator gen(3, 0x02000000);
+    EXPECT_EQ(0x02000000, gen.generate());
+    EXPECT_EQ(0x02000001, gen.generate());
+    EXPECT_EQ(0x02000002, gen.generate());
+    EXPECT_EQ(0x02000000, gen.generate());
+}
+
+TEST_F(TestControlTest, WorkerShare) {
+    CommandOptions opt;
+    processCmdLine(opt, "perfdhcp -g multi --workers 3 -R 10 -l 127.0.0.1 all");
+    NakedTestControl tc(opt);
+    EXPECT_EQ(0, tc.getWorker());
+    ASSERT_TRUE(tc.getReceiver());
+    EXPECT_EQ(3, tc.getReceiver()->getQueuesNum());
+
+    // The first worker takes the remainder of the division.
+    EXPECT_EQ(4, tc.getWorkerShare(10));
+    EXPECT_EQ(3, tc.getWorkerShare(9));
+    EXPECT_EQ(0, tc.getWorkerShare(0));
+
+    // Transaction ids of the first worker are dispatched back to it.
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(0, Receiver::getWorkerIndex(tc.transid_gen_->generate(),
+                                              4, 3));
+    }
+}
+
+TEST_F(TestControlTest, ClientIndex) {
+    CommandOptions opt;
+    processCmdLine(opt, "perfdhcp -6 -R 100000 -b mac=00:01:02:03:04:FE"
+                   " -l 127.0.0.1 all");
+    NakedTestControl tc(opt);
+
+    // MAC addresses and DUIDs of the clients map back to their indexes.
+    const uint32_t clients[] = { 0, 1, 255, 256, 99999 };
+    for (auto client : clients) {
+        std::vector<uint8_t> mac = tc.getClientMacAddress(client);
+        EXPECT_EQ(client, tc.getClientIndex(mac));
+        std::vector<uint8_t> duid = tc.getClientDuid(client);
+        EXPECT_EQ(client, tc.getClientIndex(duid));
+        EXPECT_TRUE(std::equal(mac.begin(), mac.end(),
+                               duid.end() - mac.size()));
+    }
+
+    // The same addresses are used for new exchanges.
+    uint8_t randomized = 0;
+    tc.setMacAddrGenerator(TestControl::NumberGeneratorPtr(new TestControl::SequentialGenerator(0, 300)));
+    EXPECT_TRUE(tc.generateMacAddress(randomized) == tc.getClientMacAddress(300));
+
+    EXPECT_THROW(tc.getClientIndex(std::vector<uint8_t>(5, 0)), isc::BadValue);
+}
+
 TEST_F(TestControlTest, Options4) {
     using namespace isc::dhcp;
     CommandOptions opt;
@@ -12,6 +12,7 @@
 #include <asiolink/io_address.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/dhcpsrv_exceptions.h>
+#include <dhcpsrv/lease_change_stream.h>
 #include <dhcpsrv/lease_mgr.h>
 #include <dhcpsrv/lease_mgr_factory.h>
 #include <dhcpsrv/subnet_id.h>
@@ -40,6 +41,126 @@ using namespace std;
 namespace isc {
 namespace lease_cmds {
 
+namespace {
+
+/// @brief Number of leases fetched at once by a streamed lease list.
+const size_t STREAM_PAGE_SIZE = 1000;
+
+/// @brief Generates the leases of a streamed lease4-get-all or
+/// lease6-get-all response.
+///
+/// The leases are fetched from the lease database by pages or by subnet
+/// when they are written, so neither all the leases nor the whole
+/// response are held in memory. A new generator is created each time
+/// the streamed list is written.
+class LeaseGenerator {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param v4 Whether IPv4 or IPv6 leases are generated.
+    /// @param subnet_ids Identifiers of the subnets to get the leases
+    /// from, all the leases are generated when empty.
+    LeaseGenerator(const bool v4, const std::vector<SubnetID>& subnet_ids)
+        : v4_(v4), all_(subnet_ids.empty()), subnet_ids_(subnet_ids),
+          subnet_index_(0), last_(v4 ? IOAddress::IPV4_ZERO_ADDRESS() :
+                                       IOAddress::IPV6_ZERO_ADDRESS()),
+          leases_(), index_(0), done_(false) {
+    }
+
+    /// @brief Creates a generator of the leases.
+    ///
+    /// @param v4 Whether IPv4 or IPv6 leases are generated.
+    /// @param subnet_ids Identifiers of the subnets to get the leases
+    /// from, all the leases are generated when empty.
+    /// @return Function returning the next lease.
+    static StreamedListElement::Generator
+    create(const bool v4, const std::vector<SubnetID>& subnet_ids) {
+        boost::shared_ptr<LeaseGenerator>
+            generator(new LeaseGenerator(v4, subnet_ids));
+        return (boost::bind(&LeaseGenerator::next, generator));
+    }
+
+    /// @brief Returns the next lease, a null pointer at the end.
+    ///
+    /// @throw The exceptions thrown by the lease manager.
+    ElementPtr next() {
+        if (done_) {
+            return (ElementPtr());
+        }
+        if ((index_ == leases_.size()) && !fetch()) {
+            done_ = true;
+            return (ElementPtr());
+        }
+        return (leases_[index_++]->toElement());
+    }
+
+private:
+
+    /// @brief Fetches the next leases.
+    ///
+    /// @return false when there is no more lease.
+    bool fetch() {
+        leases_.clear();
+        index_ = 0;
+        if (all_) {
+            if (v4_) {
+                Lease4Collection leases = LeaseMgrFactory::instance().
+                    getLeases4(last_, LeasePageSize(STREAM_PAGE_SIZE));
+                leases_.assign(leases.begin(), leases.end());
+            } else {
+                Lease6Collection leases = LeaseMgrFactory::instance().
+                    getLeases6(last_, LeasePageSize(STREAM_PAGE_SIZE));
+                leases_.assign(leases.begin(), leases.end());
+            }
+            if (!leases_.empty()) {
+                last_ = leases_.back()->addr_;
+            }
+            return (!leases_.empty());
+        }
+
+        while (leases_.empty() && (subnet_index_ < subnet_ids_.size())) {
+            const SubnetID& subnet_id = subnet_ids_[subnet_index_++];
+            if (v4_) {
+                Lease4Collection leases =
+                    LeaseMgrFactory::instance().getLeases4(subnet_id);
+                leases_.assign(leases.begin(), leases.end());
+            } else {
+                Lease6Collection leases =
+                    LeaseMgrFactory::instance().getLeases6(subnet_id);
+                leases_.assign(leases.begin(), leases.end());
+            }
+        }
+        return (!leases_.empty());
+    }
+
+    /// @brief Whether IPv4 or IPv6 leases are generated.
+    bool v4_;
+
+    /// @brief Whether all the leases are generated.
+    bool all_;
+
+    /// @brief Subnets to get the leases from.
+    std::vector<SubnetID> subnet_ids_;
+
+    /// @brief Index of the next subnet.
+    size_t subnet_index_;
+
+    /// @brief Address of the last fetched lease.
+    IOAddress last_;
+
+    /// @brief Fetched leases.
+    std::vector<LeasePtr> leases_;
+
+    /// @brief Index of the next lease to generate.
+    size_t index_;
+
+    /// @brief Whether all the leases were generated.
+    bool done_;
+};
+
+} // end of anonymous namespace
+
 /// @brief Wrapper class around reservation command handlers.
 class LeaseCmdsImpl : private CmdsImpl {
 public:
@@ -174,6 +295,18 @@ public:
     int
     leaseGetPageHandler(hooks::CalloutHandle& handle);
 
+    /// @brief lease-changes-get command handler
+    ///
+    /// Provides the implementation for @ref
+    /// isc::lease_cmds::LeaseCmds::leaseChangesGetHandler.
+    ///
+    /// @param handle Callout context - which is expected to contain the
+    /// get command JSON text in the "command" argument.
+    /// @return 0 if the handler has been invoked successfully, 1 if an
+    /// error occurs, 3 if no changes are returned.
+    int
+    leaseChangesGetHandler(hooks::CalloutHandle& handle);
+
     /// @brief lease4-del command handler
     ///
     /// Provides the implementation for @ref isc::lease_cmds::LeaseCmds::lease4DelHandler
@@ -553,37 +686,75 @@ LeaseCmdsImpl::leaseGetAllHandler(CalloutHandle& handle) {
         extractCommand(handle);
         v4 = (cmd_name_ == "lease4-get-all");
 
-        ElementPtr leases_json = Element::createList();
-
-        // The argument may contain a list of subnets for which leases should
-        // be returned.
+        // The leases may be streamed rather than gathered in the response.
+        bool stream = false;
+        ConstElementPtr subnets;
         if (cmd_args_) {
-            ConstElementPtr subnets = cmd_args_->get("subnets");
-            if (!subnets) {
+            ConstElementPtr stream_param = cmd_args_->get("stream");
+            if (stream_param) {
+                if (stream_param->getType() != Element::boolean) {
+                    isc_throw(BadValue, "'stream' parameter must be a boolean");
+                }
+                stream = stream_param->boolValue();
+            }
+
+            // The argument may contain a list of subnets for which leases
+            // should be returned.
+            subnets = cmd_args_->get("subnets");
+            if (!subnets && !stream_param) {
                 isc_throw(BadValue, "'subnets' parameter not specified");
             }
-            if (subnets->getType() != Element::list) {
+            if (subnets && (subnets->getType() != Element::list)) {
                 isc_throw(BadValue, "'subnets' parameter must be a list");
             }
+        }
 
-            const std::vector<ElementPtr>& subnet_ids = subnets->listValue();
-            for (auto subnet_id = subnet_ids.begin();
-                 subnet_id != subnet_ids.end();
+        std::vector<SubnetID> subnet_ids;
+        if (subnets) {
+            const std::vector<ElementPtr>& subnet_list = subnets->listValue();
+            for (auto subnet_id = subnet_list.begin();
+                 subnet_id != subnet_list.end();
                  ++subnet_id) {
                 if ((*subnet_id)->getType() != Element::integer) {
                     isc_throw(BadValue, "listed subnet identifiers must be numbers");
                 }
+                subnet_ids.push_back((*subnet_id)->intValue());
+            }
+        }
+
+        ElementPtr leases_json = Element::createList();
 
+        // The answer is built before the leases are generated, so its text
+        // can't give their number. Only check there is a lease, which also
+        // reports database errors before the response is sent.
+        if (stream &&
+            LeaseGenerator::create(v4, subnet_ids)()) {
+            leases_json.reset(new StreamedListElement(
+                boost::bind(&LeaseGenerator::create, v4, subnet_ids)));
+            ElementPtr args = Element::createMap();
+            args->set("leases", leases_json);
+            std::ostringstream s;
+            s << "IPv" << (v4 ? "4" : "6") << " lease(s) found.";
+            ConstElementPtr response = createAnswer(CONTROL_RESULT_SUCCESS,
+                                                    s.str(), args);
+            setResponse(handle, response);
+            return (0);
+        }
+
+        if (subnets) {
+            for (auto subnet_id = subnet_ids.begin();
+                 subnet_id != subnet_ids.end();
+                 ++subnet_id) {
                 if (v4) {
                     Lease4Collection leases =
-                        LeaseMgrFactory::instance().getLeases4((*subnet_id)->intValue());
+                        LeaseMgrFactory::instance().getLeases4(*subnet_id);
                     for (auto lease : leases) {
                         ElementPtr lease_json = lease->toElement();
                         leases_json->add(lease_json);
                     }
                 } else {
                     Lease6Collection leases =
-                        LeaseMgrFactory::instance().getLeases6((*subnet_id)->intValue());
+                        LeaseMgrFactory::instance().getLeases6(*subnet_id);
                     for (auto lease : leases) {
                         ElementPtr lease_json = lease->toElement();
                         leases_json->add(lease_json);
@@ -748,6 +919,90 @@ LeaseCmdsImpl::leaseGetPageHandler(CalloutHandle& handle) {
     return (CONTROL_RESULT_SUCCESS);
 }
 
+int
+LeaseCmdsImpl::leaseChangesGetHandler(CalloutHandle& handle) {
+    try {
+        extractCommand(handle);
+
+        // arguments must always be present
+        if (!cmd_args_) {
+            isc_throw(BadValue, "no parameters specified for the " << cmd_name_
+                      << " command");
+        }
+
+        // The 'from' argument is the sequence number of the last change
+        // the caller processed. The returned changes follow it.
+        ConstElementPtr from = cmd_args_->get("from");
+        if (!from) {
+            isc_throw(BadValue, "'from' parameter not specified");
+        }
+        if ((from->getType() != Element::integer) || (from->intValue() < 0)) {
+            isc_throw(BadValue, "'from' parameter must be a positive number");
+        }
+
+        // The 'limit' is the maximum number of returned changes.
+        ConstElementPtr limit = cmd_args_->get("limit");
+        if (!limit) {
+            isc_throw(BadValue, "'limit' parameter not specified");
+        }
+        if ((limit->getType() != Element::integer) || (limit->intValue() <= 0)) {
+            isc_throw(BadValue, "'limit' parameter must be a positive number");
+        }
+
+        LeaseChangeStream& stream = LeaseChangeStream::instance();
+        if (!stream.enabled()) {
+            isc_throw(InvalidOperation, "the lease change stream is disabled,"
+                      " set the change-stream-capacity parameter of the"
+                      " library to enable it");
+        }
+
+        // The stream identifier and the last sequence number let the
+        // caller detect the server restarts and the missed changes.
+        ElementPtr args = Element::createMap();
+        args->set("stream-id", Element::create(stream.getStreamId()));
+
+        std::vector<LeaseChange> changes;
+        const uint64_t from_value = static_cast<uint64_t>(from->intValue());
+        if (!stream.getChanges(from_value, static_cast<size_t>(limit->intValue()),
+                               changes)) {
+            args->set("last-sequence",
+                      Element::create(static_cast<int64_t>(stream.getLastSequence())));
+            std::ostringstream s;
+            s << "changes following the sequence number " << from_value
+              << " were discarded, the leases must be fetched again";
+            ConstElementPtr response = createAnswer(CONTROL_RESULT_ERROR,
+                                                    s.str(), args);
+            setResponse(handle, response);
+            return (CONTROL_RESULT_ERROR);
+        }
+
+        ElementPtr changes_json = Element::createList();
+        for (auto change : changes) {
+            changes_json->add(change.toElement());
+        }
+        const uint64_t last = (changes.empty() ? from_value :
+                               changes.back().sequence_);
+        args->set("changes", changes_json);
+        args->set("count", Element::create(static_cast<int64_t>(changes.size())));
+        args->set("last-sequence", Element::create(static_cast<int64_t>(last)));
+
+        std::ostringstream s;
+        s << changes.size() << " lease change(s) found.";
+        ConstElementPtr response =
+            createAnswer(changes.empty() ?
+                         CONTROL_RESULT_EMPTY :
+                         CONTROL_RESULT_SUCCESS,
+                         s.str(), args);
+        setResponse(handle, response);
+
+    } catch (std::exception& ex) {
+        setErrorResponse(handle, ex.what());
+        return (CONTROL_RESULT_ERROR);
+    }
+
+    return (CONTROL_RESULT_SUCCESS);
+}
+
 int
 LeaseCmdsImpl::lease4DelHandler(CalloutHandle& handle) {
     Parameters p;
@@ -1323,6 +1578,11 @@ LeaseCmds::leaseGetPageHandler(hooks::CalloutHandle& handle) {
     return (impl_->leaseGetPageHandler(handle));
 }
 
+int
+LeaseCmds::leaseChangesGetHandler(hooks::CalloutHandle& handle) {
+    return (impl_->leaseChangesGetHandler(handle));
+}
+
 int
 LeaseCmds::lease4DelHandler(CalloutHandle& handle) {
     return(impl_->lease4DelHandler(handle));
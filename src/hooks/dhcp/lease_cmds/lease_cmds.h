@@ -234,6 +234,10 @@ public:
     ///     "command": "lease6-get-all",
     /// }
     ///
+    /// When the "stream" boolean argument is true, the leases are fetched
+    /// and converted to JSON while the response is written: the result
+    /// and the text of the response are set once all leases were written.
+    ///
     /// @param handle Callout context - which is expected to contain the
     /// get command JSON text in the "command" argument
     /// @return 0 if the handler has been invoked successfully, 1 if an
@@ -258,6 +262,31 @@ public:
     int
     leaseGetPageHandler(hooks::CalloutHandle& handle);
 
+    /// @brief lease-changes-get command handler
+    ///
+    /// This command retrieves the lease changes following the sequence
+    /// number of the last change the caller processed. The caller tails
+    /// the changes by passing the returned "last-sequence" in the next
+    /// command. The response also holds the identifier of the stream
+    /// which changes when the server restarts.
+    ///
+    /// Example command:
+    /// {
+    ///     "command": "lease-changes-get",
+    ///     "arguments": {
+    ///         "from": 1200,
+    ///         "limit": 100
+    ///     }
+    /// }
+    ///
+    /// @param handle Callout context - which is expected to contain the
+    /// get command JSON text in the "command" argument.
+    /// @return 0 if the handler has been invoked successfully, 1 if an
+    /// error occurs, e.g. the changes following the sequence number were
+    /// discarded, 3 if no changes are returned.
+    int
+    leaseChangesGetHandler(hooks::CalloutHandle& handle);
+
     /// @brief lease4-del command handler
     ///
     /// This command attempts to delete an IPv4 lease that match selected
@@ -13,10 +13,12 @@
 #include <lease_cmds.h>
 #include <lease_cmds_log.h>
 #include <cc/command_interpreter.h>
+#include <dhcpsrv/lease_change_stream.h>
 #include <hooks/hooks.h>
 
 using namespace isc::config;
 using namespace isc::data;
+using namespace isc::dhcp;
 using namespace isc::hooks;
 using namespace isc::lease_cmds;
 
@@ -121,6 +123,17 @@ int lease6_get_page(CalloutHandle& handle) {
     return (lease_cmds.leaseGetPageHandler(handle));
 }
 
+/// @brief This is a command callout for 'lease-changes-get' command.
+///
+/// @param handle Callout handle used to retrieve a command and
+/// provide a response.
+/// @return 0 if this callout has been invoked successfully,
+/// 1 if an error occurs, 3 if no changes are returned.
+int lease_changes_get(CalloutHandle& handle) {
+    LeaseCmds lease_cmds;
+    return (lease_cmds.leaseChangesGetHandler(handle));
+}
+
 /// @brief This is a command callout for 'lease4-del' command.
 ///
 /// @param handle Callout handle used to retrieve a command and
@@ -192,6 +205,22 @@ int lease6_wipe(CalloutHandle& handle) {
 /// @param handle library handle
 /// @return 0 when initialization is successful, 1 otherwise
 int load(LibraryHandle& handle) {
+    // The lease change stream is disabled unless a capacity is given.
+    // The libraries are reloaded when the server is reconfigured: the
+    // retained changes are kept unless the capacity is reduced.
+    size_t stream_capacity = 0;
+    ConstElementPtr capacity = handle.getParameter("change-stream-capacity");
+    if (capacity) {
+        if ((capacity->getType() != Element::integer) ||
+            (capacity->intValue() < 0)) {
+            LOG_ERROR(lease_cmds_logger, LEASE_CMDS_INVALID_CHANGE_STREAM_CAPACITY)
+                .arg(capacity->str());
+            return (1);
+        }
+        stream_capacity = static_cast<size_t>(capacity->intValue());
+    }
+    LeaseChangeStream::instance().setCapacity(stream_capacity);
+
     handle.registerCommandCallout("lease4-add", lease4_add);
     handle.registerCommandCallout("lease6-add", lease6_add);
     handle.registerCommandCallout("lease6-bulk-apply", lease6_bulk_apply);
@@ -201,6 +230,7 @@ int load(LibraryHandle& handle) {
     handle.registerCommandCallout("lease6-get-all", lease6_get_all);
     handle.registerCommandCallout("lease4-get-page", lease4_get_page);
     handle.registerCommandCallout("lease6-get-page", lease6_get_page);
+    handle.registerCommandCallout("lease-changes-get", lease_changes_get);
     handle.registerCommandCallout("lease4-del", lease4_del);
     handle.registerCommandCallout("lease6-del", lease6_del);
     handle.registerCommandCallout("lease4-update", lease4_update);
@@ -216,6 +246,9 @@ int load(LibraryHandle& handle) {
 ///
 /// @return 0 if deregistration was successful, 1 otherwise
 int unload() {
+    // Stop publishing the lease changes and discard the retained ones,
+    // the stream outlives the library.
+    LeaseChangeStream::instance().setCapacity(0);
     LOG_INFO(lease_cmds_logger, LEASE_CMDS_DEINIT_OK);
     return (0);
 }
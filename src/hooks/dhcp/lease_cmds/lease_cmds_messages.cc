@@ -16,6 +16,7 @@ extern const isc::log::MessageID LEASE_CMDS_DEL6 = "LEASE_CMDS_DEL6";
 extern const isc::log::MessageID LEASE_CMDS_DEL6_FAILED = "LEASE_CMDS_DEL6_FAILED";
 extern const isc::log::MessageID LEASE_CMDS_INIT_FAILED = "LEASE_CMDS_INIT_FAILED";
 extern const isc::log::MessageID LEASE_CMDS_INIT_OK = "LEASE_CMDS_INIT_OK";
+extern const isc::log::MessageID LEASE_CMDS_INVALID_CHANGE_STREAM_CAPACITY = "LEASE_CMDS_INVALID_CHANGE_STREAM_CAPACITY";
 
 namespace {
 
@@ -32,6 +33,7 @@ const char* values[] = {
     "LEASE_CMDS_DEL6_FAILED", "lease6-del command failed (parameters: %1, reason: %2)",
     "LEASE_CMDS_INIT_FAILED", "loading Lease Commands hooks library failed: %1",
     "LEASE_CMDS_INIT_OK", "loading Lease Commands hooks library successful",
+    "LEASE_CMDS_INVALID_CHANGE_STREAM_CAPACITY", "invalid change-stream-capacity parameter: %1",
     NULL
 };
 
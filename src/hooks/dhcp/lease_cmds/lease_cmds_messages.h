@@ -17,5 +17,6 @@ extern const isc::log::MessageID LEASE_CMDS_DEL6;
 extern const isc::log::MessageID LEASE_CMDS_DEL6_FAILED;
 extern const isc::log::MessageID LEASE_CMDS_INIT_FAILED;
 extern const isc::log::MessageID LEASE_CMDS_INIT_OK;
+extern const isc::log::MessageID LEASE_CMDS_INVALID_CHANGE_STREAM_CAPACITY;
 
 #endif // LEASE_CMDS_MESSAGES_H
@@ -10,10 +10,12 @@
 #include <hooks/hooks_manager.h>
 #include <config/command_mgr.h>
 #include <dhcpsrv/lease_mgr.h>
+#include <dhcpsrv/lease_change_stream.h>
 #include <dhcpsrv/lease_mgr_factory.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <cc/command_interpreter.h>
 #include <cc/data.h>
+#include <cc/element_writer.h>
 #include <testutils/user_context_utils.h>
 #include <gtest/gtest.h>
 #include <errno.h>
@@ -555,6 +557,7 @@ TEST_F(LeaseCmdsTest, commands) {
                             "lease4-get",      "lease6-get",
                             "lease4-get-all",  "lease6-get-all",
                             "lease4-get-page", "lease6-get-page",
+                            "lease-changes-get",
                             "lease4-del",      "lease6-del",
                             "lease4-update",   "lease6-update",
                             "lease4-wipe",     "lease6-wipe" };
@@ -1980,6 +1983,112 @@ TEST_F(LeaseCmdsTest, Lease4GetAllByMultipleSubnetIds) {
     checkLease4(leases, "192.0.3.2", 88, "09:09:09:09:09:09", true);
 }
 
+// Checks that lease4-get-all streams the leases when asked to.
+TEST_F(LeaseCmdsTest, Lease4GetAllStreamed) {
+
+    // Initialize lease manager (false = v4, true = add a lease)
+    initLeaseMgr(false, true);
+
+    // Query for all leases. The number of leases is not known before
+    // the response is written so the text does not give it.
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-all\",\n"
+        "    \"arguments\": {"
+        "        \"stream\": true\n"
+        "    }\n"
+        "}";
+    ConstElementPtr rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS,
+                                      "IPv4 lease(s) found.");
+    ASSERT_TRUE(rsp);
+    ElementWriter writer(rsp);
+    string text;
+    while (writer.write(text, 100)) {
+    }
+    ConstElementPtr written;
+    ASSERT_NO_THROW(written = Element::fromJSON(text));
+    checkAnswer(written, CONTROL_RESULT_SUCCESS, "IPv4 lease(s) found.");
+
+    ConstElementPtr args = written->get("arguments");
+    ASSERT_TRUE(args);
+    ConstElementPtr leases = args->get("leases");
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(Element::list, leases->getType());
+    EXPECT_EQ(4, leases->size());
+    checkLease4(leases, "192.0.2.1", 44, "08:08:08:08:08:08", true);
+    checkLease4(leases, "192.0.3.2", 88, "09:09:09:09:09:09", true);
+
+    // The response can be written again, e.g. after a hook logged it.
+    EXPECT_EQ(text, rsp->str());
+
+    // The leases of the listed subnets can also be streamed.
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-all\",\n"
+        "    \"arguments\": {"
+        "        \"subnets\": [ 127, 88 ],\n"
+        "        \"stream\": true\n"
+        "    }\n"
+        "}";
+    rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS, "IPv4 lease(s) found.");
+    ASSERT_TRUE(rsp);
+    ASSERT_NO_THROW(written = Element::fromJSON(rsp->str()));
+    leases = written->get("arguments")->get("leases");
+    ASSERT_TRUE(leases);
+    EXPECT_EQ(2, leases->size());
+    checkLease4(leases, "192.0.3.1", 88, "08:08:08:08:08:08", true);
+
+    // No lease is an empty result.
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-all\",\n"
+        "    \"arguments\": {"
+        "        \"subnets\": [ 127 ],\n"
+        "        \"stream\": true\n"
+        "    }\n"
+        "}";
+    rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS, "");
+    ASSERT_TRUE(rsp);
+    ASSERT_NO_THROW(written = Element::fromJSON(rsp->str()));
+    checkAnswer(written, CONTROL_RESULT_EMPTY, "0 IPv4 lease(s) found.");
+
+    // The stream parameter must be a boolean.
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-all\",\n"
+        "    \"arguments\": {"
+        "        \"stream\": 1\n"
+        "    }\n"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_ERROR, "'stream' parameter must be a boolean");
+}
+
+// Checks that lease6-get-all streams the leases when asked to.
+TEST_F(LeaseCmdsTest, Lease6GetAllStreamed) {
+
+    // Initialize lease manager (true = v6, true = add a lease)
+    initLeaseMgr(true, true);
+
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease6-get-all\",\n"
+        "    \"arguments\": {"
+        "        \"stream\": true\n"
+        "    }\n"
+        "}";
+    ConstElementPtr rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS,
+                                      "IPv6 lease(s) found.");
+    ASSERT_TRUE(rsp);
+    ConstElementPtr written;
+    ASSERT_NO_THROW(written = Element::fromJSON(rsp->str()));
+    ConstElementPtr leases = written->get("arguments")->get("leases");
+    ASSERT_TRUE(leases);
+    EXPECT_EQ(4, leases->size());
+
+    // The size of the streamed list is the number of leases.
+    EXPECT_EQ(4, rsp->get("arguments")->get("leases")->size());
+}
+
 // Checks that lease4-get-all checks its input arguments.
 TEST_F(LeaseCmdsTest, Lease4GetBySubnetIdInvalidArguments) {
 
@@ -2570,6 +2679,121 @@ TEST_F(LeaseCmdsTest, Lease6GetPagedLimitIsZero) {
     testCommand(cmd, CONTROL_RESULT_ERROR, exp_rsp);
 }
 
+// Checks that the lease changes can be tailed.
+TEST_F(LeaseCmdsTest, LeaseChangesGet) {
+    // The library enables the change stream so it must be loaded before
+    // the leases are added. The commands below are sent without reloading
+    // it with the default parameters which disable the stream.
+    ElementPtr params = Element::createMap();
+    params->set("change-stream-capacity", Element::create(100));
+    addLib(lib_name_, params);
+    loadLib();
+    const int64_t base = LeaseChangeStream::instance().getLastSequence();
+
+    // Initialize lease manager (false = v4, true = add a lease)
+    initLeaseMgr(false, true);
+    ASSERT_TRUE(lmptr_->deleteLease(IOAddress("192.0.2.1")));
+
+    // Sends the command with the given cursor.
+    auto get_changes = [this](const int64_t from, const int64_t limit,
+                              const int exp_result, const std::string& exp_txt) {
+        std::ostringstream cmd;
+        cmd << "{ \"command\": \"lease-changes-get\", \"arguments\": "
+            << "{ \"from\": " << from << ", \"limit\": " << limit << " } }";
+        ConstElementPtr rsp =
+            CommandMgr::instance().processCommand(Element::fromJSON(cmd.str()));
+        checkAnswer(rsp, exp_result, exp_txt);
+        return (rsp->get("arguments"));
+    };
+
+    ConstElementPtr args = get_changes(base, 3, CONTROL_RESULT_SUCCESS,
+                                       "3 lease change(s) found.");
+    ASSERT_TRUE(args);
+    ASSERT_TRUE(args->get("stream-id"));
+    EXPECT_EQ(LeaseChangeStream::instance().getStreamId(),
+              args->get("stream-id")->stringValue());
+    ASSERT_TRUE(args->get("count"));
+    EXPECT_EQ(3, args->get("count")->intValue());
+    ASSERT_TRUE(args->get("last-sequence"));
+    EXPECT_EQ(base + 3, args->get("last-sequence")->intValue());
+    ConstElementPtr changes = args->get("changes");
+    ASSERT_TRUE(changes);
+    ASSERT_EQ(3, changes->size());
+    EXPECT_EQ(base + 1, changes->get(0)->get("sequence")->intValue());
+    EXPECT_EQ("add", changes->get(0)->get("type")->stringValue());
+    EXPECT_EQ("192.0.2.1", changes->get(0)->get("ip-address")->stringValue());
+    ASSERT_TRUE(changes->get(0)->get("lease"));
+    EXPECT_EQ(44, changes->get(0)->get("lease")->get("subnet-id")->intValue());
+
+    // The next batch starts after the last returned change.
+    args = get_changes(base + 3, 10, CONTROL_RESULT_SUCCESS,
+                       "2 lease change(s) found.");
+    ASSERT_TRUE(args);
+    changes = args->get("changes");
+    ASSERT_TRUE(changes);
+    ASSERT_EQ(2, changes->size());
+    EXPECT_EQ("delete", changes->get(1)->get("type")->stringValue());
+    EXPECT_EQ("192.0.2.1", changes->get(1)->get("ip-address")->stringValue());
+    EXPECT_FALSE(changes->get(1)->get("lease"));
+
+    // No more changes.
+    args = get_changes(base + 5, 10, CONTROL_RESULT_EMPTY,
+                       "0 lease change(s) found.");
+    ASSERT_TRUE(args);
+    EXPECT_EQ(base + 5, args->get("last-sequence")->intValue());
+
+    // A cursor behind the retained changes is reported.
+    LeaseChangeStream::instance().setCapacity(1);
+    get_changes(base, 10, CONTROL_RESULT_ERROR, "");
+
+    // Unloading the library disables the stream and discards the changes.
+    unloadLibs();
+    EXPECT_FALSE(LeaseChangeStream::instance().enabled());
+    std::vector<LeaseChange> retained;
+    LeaseChangeStream::instance().getChanges(0, 10, retained);
+    EXPECT_TRUE(retained.empty());
+}
+
+// Checks that lease-changes-get fails when the stream is disabled or the
+// parameters are invalid.
+TEST_F(LeaseCmdsTest, LeaseChangesGetErrors) {
+    // Initialize lease manager (false = v4, true = add a lease)
+    initLeaseMgr(false, true);
+
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease-changes-get\",\n"
+        "    \"arguments\": {"
+        "        \"from\": 0,"
+        "        \"limit\": 10"
+        "    }"
+        "}";
+    string exp_rsp = "the lease change stream is disabled, set the"
+        " change-stream-capacity parameter of the library to enable it";
+    testCommand(cmd, CONTROL_RESULT_ERROR, exp_rsp);
+
+    cmd =
+        "{\n"
+        "    \"command\": \"lease-changes-get\",\n"
+        "    \"arguments\": {"
+        "        \"limit\": 10"
+        "    }"
+        "}";
+    exp_rsp = "'from' parameter not specified";
+    testCommand(cmd, CONTROL_RESULT_ERROR, exp_rsp);
+
+    cmd =
+        "{\n"
+        "    \"command\": \"lease-changes-get\",\n"
+        "    \"arguments\": {"
+        "        \"from\": 0,"
+        "        \"limit\": 0"
+        "    }"
+        "}";
+    exp_rsp = "'limit' parameter must be a positive number";
+    testCommand(cmd, CONTROL_RESULT_ERROR, exp_rsp);
+}
+
 // Test checks if lease4-update handler refuses calls with missing parameters.
 TEST_F(LeaseCmdsTest, Lease4UpdateMissingParams) {
     // Initialize lease manager (false = v4, true = add a lease)
@@ -1,4 +1,4 @@
-// Copyright (C) 2010-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2010-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -10,6 +10,7 @@
 #include <asiolink/io_error.h>
 #include <exceptions/exceptions.h>
 
+#include <boost/functional/hash.hpp>
 #include <boost/static_assert.hpp>
 
 #include <unistd.h>             // for some IPC/network system calls
@@ -172,6 +173,16 @@ IOAddress::increase(const IOAddress& addr) {
     return (IOAddress::fromBytes(addr.getFamily(), &packed[0]));
 }
 
+size_t
+hash_value(const IOAddress& address) {
+    if (address.isV4()) {
+        return (boost::hash_value(address.toUint32()));
+    }
+    // Hash the binary form without allocating a vector.
+    const ip::address_v6::bytes_type bytes =
+        address.asio_address_.to_v6().to_bytes();
+    return (boost::hash_range(bytes.begin(), bytes.end()));
+}
 
 } // namespace asiolink
 } // namespace isc
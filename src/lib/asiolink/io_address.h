@@ -1,4 +1,4 @@
-// Copyright (C) 2010-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2010-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -321,6 +321,8 @@ public:
 
 private:
     boost::asio::ip::address asio_address_;
+
+    friend size_t hash_value(const IOAddress& address);
 };
 
 /// \brief Insert the IOAddress as a string into stream.
@@ -339,6 +341,16 @@ private:
 std::ostream&
 operator<<(std::ostream& os, const IOAddress& address);
 
+/// \brief Computes the hash of the address.
+///
+/// This function allows for using \c IOAddress objects in hashed
+/// containers, e.g. in hashed indexes of the multi index containers.
+///
+/// \param address The \c IOAddress object to be hashed.
+/// \return Hash value of the address.
+size_t
+hash_value(const IOAddress& address);
+
 } // namespace asiolink
 } // namespace isc
 #endif // IO_ADDRESS_H
@@ -339,3 +339,15 @@ TEST(IOAddressTest, increaseAddr) {
     EXPECT_EQ(IOAddress("::1"), IOAddress::increase(any6));
     EXPECT_EQ(IOAddress("::"), IOAddress::increase(the_last_one));
 }
+
+// Test verifies that the equal addresses have the same hash.
+TEST(IOAddressTest, hash) {
+    EXPECT_EQ(hash_value(IOAddress("192.0.2.1")),
+              hash_value(IOAddress("192.0.2.1")));
+    EXPECT_NE(hash_value(IOAddress("192.0.2.1")),
+              hash_value(IOAddress("192.0.2.2")));
+    EXPECT_EQ(hash_value(IOAddress("2001:db8:1::1")),
+              hash_value(IOAddress("2001:db8:1::1")));
+    EXPECT_NE(hash_value(IOAddress("2001:db8:1::1")),
+              hash_value(IOAddress("2001:db8:1::2")));
+}
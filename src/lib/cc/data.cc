@@ -11,6 +11,7 @@
 #include <cstring>
 #include <cassert>
 #include <climits>
+#include <cstdlib>
 #include <list>
 #include <map>
 #include <cstdio>
@@ -21,16 +22,13 @@
 #include <fstream>
 #include <cerrno>
 
-#include <boost/lexical_cast.hpp>
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
 
 #include <cmath>
 
 using namespace std;
 
-namespace {
-const char* const WHITESPACE = " \b\f\n\r\t";
-} // end anonymous namespace
-
 namespace isc {
 namespace data {
 
@@ -219,14 +217,16 @@ bool operator!=(const Element& a, const Element& b) {
 //
 // factory functions
 //
+// The elements are allocated together with their reference counter.
+//
 ElementPtr
 Element::create(const Position& pos) {
-    return (ElementPtr(new NullElement(pos)));
+    return (boost::make_shared<NullElement>(pos));
 }
 
 ElementPtr
 Element::create(const long long int i, const Position& pos) {
-    return (ElementPtr(new IntElement(static_cast<int64_t>(i), pos)));
+    return (boost::make_shared<IntElement>(static_cast<int64_t>(i), pos));
 }
 
 ElementPtr
@@ -241,17 +241,17 @@ Element::create(const long int i, const Position& pos) {
 
 ElementPtr
 Element::create(const double d, const Position& pos) {
-    return (ElementPtr(new DoubleElement(d, pos)));
+    return (boost::make_shared<DoubleElement>(d, pos));
 }
 
 ElementPtr
 Element::create(const bool b, const Position& pos) {
-    return (ElementPtr(new BoolElement(b, pos)));
+    return (boost::make_shared<BoolElement>(b, pos));
 }
 
 ElementPtr
 Element::create(const std::string& s, const Position& pos) {
-    return (ElementPtr(new StringElement(s, pos)));
+    return (boost::make_shared<StringElement>(s, pos));
 }
 
 ElementPtr
@@ -261,74 +261,104 @@ Element::create(const char *s, const Position& pos) {
 
 ElementPtr
 Element::createList(const Position& pos) {
-    return (ElementPtr(new ListElement(pos)));
+    return (boost::make_shared<ListElement>(pos));
 }
 
 ElementPtr
 Element::createMap(const Position& pos) {
-    return (ElementPtr(new MapElement(pos)));
+    return (boost::make_shared<MapElement>(pos));
 }
 
 
 //
 // helper functions for fromJSON factory
 //
+// The parser reads the characters directly from the stream buffer: the
+// get(), peek() and ignore() members of the stream construct a sentry
+// object for each character they read.
 namespace {
+
+int
+peekChar(std::istream& in) {
+    return (in.rdbuf()->sgetc());
+}
+
+int
+getChar(std::istream& in) {
+    return (in.rdbuf()->sbumpc());
+}
+
+void
+skipChar(std::istream& in) {
+    static_cast<void>(in.rdbuf()->sbumpc());
+}
+
+void
+ungetChar(std::istream& in) {
+    static_cast<void>(in.rdbuf()->sungetc());
+}
+
 bool
 charIn(const int c, const char* chars) {
-    const size_t chars_len = std::strlen(chars);
-    for (size_t i = 0; i < chars_len; ++i) {
-        if (chars[i] == c) {
+    for (; *chars != '\0'; ++chars) {
+        if (*chars == c) {
             return (true);
         }
     }
     return (false);
 }
 
+bool
+isWhitespace(const int c) {
+    switch (c) {
+    case ' ':
+    case '\b':
+    case '\f':
+    case '\n':
+    case '\r':
+    case '\t':
+        return (true);
+    default:
+        return (false);
+    }
+}
+
 void
-skipChars(std::istream& in, const char* chars, int& line, int& pos) {
-    int c = in.peek();
-    while (charIn(c, chars) && c != EOF) {
+skipWhitespace(std::istream& in, int& line, int& pos) {
+    int c = peekChar(in);
+    while (isWhitespace(c)) {
         if (c == '\n') {
             ++line;
             pos = 1;
         } else {
             ++pos;
         }
-        in.ignore();
-        c = in.peek();
+        skipChar(in);
+        c = peekChar(in);
     }
 }
 
 // skip on the input stream to one of the characters in chars
 // if another character is found this function throws JSONError
-// unless that character is specified in the optional may_skip
+// unless that character is a whitespace
 //
 // It returns the found character (as an int value).
 int
 skipTo(std::istream& in, const std::string& file, int& line,
-       int& pos, const char* chars, const char* may_skip="")
+       int& pos, const char* chars)
 {
-    int c = in.get();
+    int c = getChar(in);
     ++pos;
     while (c != EOF) {
         if (c == '\n') {
             pos = 1;
             ++line;
         }
-        if (charIn(c, may_skip)) {
-            c = in.get();
+        if (isWhitespace(c)) {
+            c = getChar(in);
             ++pos;
         } else if (charIn(c, chars)) {
-            while (charIn(in.peek(), may_skip)) {
-                if (in.peek() == '\n') {
-                    pos = 1;
-                    ++line;
-                } else {
-                    ++pos;
-                }
-                in.ignore();
-            }
+            skipWhitespace(in, line, pos);
             return (c);
         } else {
             throwJSONError(std::string("'") + std::string(1, c) + "' read, one of \"" + chars + "\" expected", file, line, pos);
@@ -344,11 +374,11 @@ std::string
 strFromStringstream(std::istream& in, const std::string& file,
                     const int line, int& pos)
 {
-    std::stringstream ss;
-    int c = in.get();
+    std::string str;
+    int c = getChar(in);
     ++pos;
     if (c == '"') {
-        c = in.get();
+        c = getChar(in);
         ++pos;
     } else {
         throwJSONError("String expected", file, line, pos);
@@ -358,7 +388,7 @@ strFromStringstream(std::istream& in, const std::string& file,
         if (c == '\\') {
             // see the spec for allowed escape characters
             int d;
-            switch (in.peek()) {
+            switch (peekChar(in)) {
             case '"':
                 c = '"';
                 break;
@@ -385,23 +415,23 @@ strFromStringstream(std::istream& in, const std::string& file,
                 break;
             case 'u':
                 // skip first 0
-                in.ignore();
+                skipChar(in);
                 ++pos;
-                c = in.peek();
+                c = peekChar(in);
                 if (c != '0') {
                     throwJSONError("Unsupported unicode escape", file, line, pos);
                 }
                 // skip second 0
-                in.ignore();
+                skipChar(in);
                 ++pos;
-                c = in.peek();
+                c = peekChar(in);
                 if (c != '0') {
                     throwJSONError("Unsupported unicode escape", file, line, pos - 2);
                 }
                 // get first digit
-                in.ignore();
+                skipChar(in);
                 ++pos;
-                d = in.peek();
+                d = peekChar(in);
                 if ((d >= '0') && (d <= '9')) {
                     c = (d - '0') << 4;
                 } else if ((d >= 'A') && (d <= 'F')) {
@@ -412,9 +442,9 @@ strFromStringstream(std::istream& in, const std::string& file,
                     throwJSONError("Not hexadecimal in unicode escape", file, line, pos - 3);
                 }
                 // get second digit
-                in.ignore();
+                skipChar(in);
                 ++pos;
-                d = in.peek();
+                d = peekChar(in);
                 if ((d >= '0') && (d <= '9')) {
                     c |= d - '0';
                 } else if ((d >= 'A') && (d <= 'F')) {
@@ -429,44 +459,48 @@ strFromStringstream(std::istream& in, const std::string& file,
                 throwJSONError("Bad escape", file, line, pos);
             }
             // drop the escaped char
-            in.ignore();
+            skipChar(in);
             ++pos;
         }
-        ss.put(c);
-        c = in.get();
+        str.push_back(static_cast<char>(c));
+        c = getChar(in);
         ++pos;
     }
     if (c == EOF) {
         throwJSONError("Unterminated string", file, line, pos);
     }
-    return (ss.str());
+    return (str);
 }
 
 std::string
 wordFromStringstream(std::istream& in, int& pos) {
-    std::stringstream ss;
-    while (isalpha(in.peek())) {
-        ss << (char) in.get();
+    std::string word;
+    while (isalpha(peekChar(in))) {
+        word.push_back(static_cast<char>(getChar(in)));
     }
-    pos += ss.str().size();
-    return (ss.str());
+    pos += word.size();
+    return (word);
 }
 
 std::string
 numberFromStringstream(std::istream& in, int& pos) {
-    std::stringstream ss;
-    while (isdigit(in.peek()) || in.peek() == '+' || in.peek() == '-' ||
-           in.peek() == '.' || in.peek() == 'e' || in.peek() == 'E') {
-        ss << (char) in.get();
+    std::string number;
+    int c = peekChar(in);
+    while (isdigit(c) || c == '+' || c == '-' ||
+           c == '.' || c == 'e' || c == 'E') {
+        number.push_back(static_cast<char>(getChar(in)));
+        c = peekChar(in);
     }
-    pos += ss.str().size();
-    return (ss.str());
+    pos += number.size();
+    return (number);
 }
 
 // Should we change from IntElement and DoubleElement to NumberElement
 // that can also hold an e value? (and have specific getters if the
 // value is larger than an int can handle)
 //
+// The numbers are converted with the C library functions which do not
+// create a stream for each value as boost::lexical_cast does.
 ElementPtr
 fromStringstreamNumber(std::istream& in, const std::string& file,
                        const int& line, int& pos) {
@@ -476,22 +510,24 @@ fromStringstreamNumber(std::istream& in, const std::string& file,
     // This will move the pos to the end of the value.
     const std::string number = numberFromStringstream(in, pos);
 
+    const char* start = number.c_str();
+    char* end = 0;
+    errno = 0;
     if (number.find_first_of(".eE") < number.size()) {
-        try {
-            return (Element::create(boost::lexical_cast<double>(number),
-                                    Element::Position(file, line, start_pos)));
-        } catch (const boost::bad_lexical_cast&) {
+        const double d = strtod(start, &end);
+        if ((end == start) || (*end != '\0') ||
+            ((errno == ERANGE) && ((d == HUGE_VAL) || (d == -HUGE_VAL)))) {
             throwJSONError(std::string("Number overflow: ") + number,
                            file, line, start_pos);
         }
+        return (Element::create(d, Element::Position(file, line, start_pos)));
     } else {
-        try {
-            return (Element::create(boost::lexical_cast<int64_t>(number),
-                                    Element::Position(file, line, start_pos)));
-        } catch (const boost::bad_lexical_cast&) {
+        const long long int i = strtoll(start, &end, 10);
+        if ((end == start) || (*end != '\0') || (errno == ERANGE)) {
             throwJSONError(std::string("Number overflow: ") + number, file,
                            line, start_pos);
         }
+        return (Element::create(i, Element::Position(file, line, start_pos)));
     }
     return (ElementPtr());
 }
@@ -558,14 +594,14 @@ fromStringstreamList(std::istream& in, const std::string& file, int& line,
     ElementPtr list = Element::createList(Element::Position(file, line, pos));
     ElementPtr cur_list_element;
 
-    skipChars(in, WHITESPACE, line, pos);
+    skipWhitespace(in, line, pos);
     while (c != EOF && c != ']') {
-        if (in.peek() != ']') {
+        if (peekChar(in) != ']') {
             cur_list_element = Element::fromJSON(in, file, line, pos);
             list->add(cur_list_element);
-            c = skipTo(in, file, line, pos, ",]", WHITESPACE);
+            c = skipTo(in, file, line, pos, ",]");
         } else {
-            c = in.get();
+            c = getChar(in);
             ++pos;
         }
     }
@@ -577,24 +613,24 @@ fromStringstreamMap(std::istream& in, const std::string& file, int& line,
                     int& pos)
 {
     ElementPtr map = Element::createMap(Element::Position(file, line, pos));
-    skipChars(in, WHITESPACE, line, pos);
-    int c = in.peek();
+    skipWhitespace(in, line, pos);
+    int c = peekChar(in);
     if (c == EOF) {
         throwJSONError(std::string("Unterminated map, <string> or } expected"), file, line, pos);
     } else if (c == '}') {
         // empty map, skip closing curly
-        in.ignore();
+        skipChar(in);
     } else {
         while (c != EOF && c != '}') {
             std::string key = strFromStringstream(in, file, line, pos);
 
-            skipTo(in, file, line, pos, ":", WHITESPACE);
+            skipTo(in, file, line, pos, ":");
             // skip the :
 
             ConstElementPtr value = Element::fromJSON(in, file, line, pos);
             map->set(key, value);
 
-            c = skipTo(in, file, line, pos, ",}", WHITESPACE);
+            c = skipTo(in, file, line, pos, ",}");
         }
     }
     return (map);
@@ -682,9 +718,9 @@ Element::fromJSON(std::istream& in, const std::string& file, int& line,
     int c = 0;
     ElementPtr element;
     bool el_read = false;
-    skipChars(in, WHITESPACE, line, pos);
+    skipWhitespace(in, line, pos);
     while (c != EOF && !el_read) {
-        c = in.get();
+        c = getChar(in);
         pos++;
         switch(c) {
             case '1':
@@ -700,26 +736,26 @@ Element::fromJSON(std::istream& in, const std::string& file, int& line,
             case '-':
             case '+':
             case '.':
-                in.putback(c);
+                ungetChar(in);
                 --pos;
                 element = fromStringstreamNumber(in, file, line, pos);
                 el_read = true;
                 break;
             case 't':
             case 'f':
-                in.putback(c);
+                ungetChar(in);
                 --pos;
                 element = fromStringstreamBool(in, file, line, pos);
                 el_read = true;
                 break;
             case 'n':
-                in.putback(c);
+                ungetChar(in);
                 --pos;
                 element = fromStringstreamNull(in, file, line, pos);
                 el_read = true;
                 break;
             case '"':
-                in.putback('"');
+                ungetChar(in);
                 --pos;
                 element = fromStringstreamString(in, file, line, pos);
                 el_read = true;
@@ -748,8 +784,7 @@ Element::fromJSON(std::istream& in, const std::string& file, int& line,
 
 ElementPtr
 Element::fromJSON(const std::string& in, bool preproc) {
-    std::stringstream ss;
-    ss << in;
+    std::stringstream ss(in);
 
     int line = 1, pos = 1;
     stringstream filtered;
@@ -757,9 +792,9 @@ Element::fromJSON(const std::string& in, bool preproc) {
         preprocess(ss, filtered);
     }
     ElementPtr result(fromJSON(preproc ? filtered : ss, "<string>", line, pos));
-    skipChars(ss, WHITESPACE, line, pos);
+    skipWhitespace(ss, line, pos);
     // ss must now be at end
-    if (ss.peek() != EOF) {
+    if (peekChar(ss) != EOF) {
         throwJSONError("Extra data", "<string>", line, pos);
     }
     return result;
@@ -821,8 +856,12 @@ NullElement::toJSON(std::ostream& ss) const {
 
 void
 StringElement::toJSON(std::ostream& ss) const {
-    ss << "\"";
     const std::string& str = stringValue();
+    // The escaped string is built aside and written at once: writing
+    // each character to the stream is slow.
+    std::string out;
+    out.reserve(str.size() + 2);
+    out.push_back('"');
     for (size_t i = 0; i < str.size(); ++i) {
         const char c = str[i];
         // Escape characters as defined in JSON spec
@@ -830,41 +869,42 @@ StringElement::toJSON(std::ostream& ss) const {
         // is allowed, but not mandatory.
         switch (c) {
         case '"':
-            ss << '\\' << c;
+            out.push_back('\\');
+            out.push_back(c);
             break;
         case '\\':
-            ss << '\\' << c;
+            out.push_back('\\');
+            out.push_back(c);
             break;
         case '\b':
-            ss << '\\' << 'b';
+            out.append("\\b");
             break;
         case '\f':
-            ss << '\\' << 'f';
+            out.append("\\f");
             break;
         case '\n':
-            ss << '\\' << 'n';
+            out.append("\\n");
             break;
         case '\r':
-            ss << '\\' << 'r';
+            out.append("\\r");
             break;
         case '\t':
-            ss << '\\' << 't';
+            out.append("\\t");
             break;
         default:
             if (((c >= 0) && (c < 0x20)) || (c < 0) || (c >= 0x7f)) {
-                std::ostringstream esc;
-                esc << "\\u"
-                    << hex
-                    << setw(4)
-                    << setfill('0')
-                    << (static_cast<unsigned>(c) & 0xff);
-                ss << esc.str();
+                static const char digits[] = "0123456789abcdef";
+                const unsigned u = static_cast<unsigned>(c) & 0xff;
+                out.append("\\u00");
+                out.push_back(digits[u >> 4]);
+                out.push_back(digits[u & 0xf]);
             } else {
-                ss << c;
+                out.push_back(c);
             }
         }
     }
-    ss << "\"";
+    out.push_back('"');
+    ss.write(out.data(), out.size());
 }
 
 void
@@ -882,6 +922,128 @@ ListElement::toJSON(std::ostream& ss) const {
     ss << " ]";
 }
 
+namespace {
+
+/// @brief Generates the elements kept in a list.
+///
+/// @param elements Copy of the elements.
+/// @param index Index of the next element.
+/// @return The next element, a null pointer at the end.
+ElementPtr
+nextKeptElement(const boost::shared_ptr<std::vector<ElementPtr> >& elements,
+                const boost::shared_ptr<size_t>& index) {
+    if (*index >= elements->size()) {
+        return (ElementPtr());
+    }
+    return ((*elements)[(*index)++]);
+}
+
+}
+
+StreamedListElement::Generator
+StreamedListElement::begin() const {
+    if (materialized_) {
+        boost::shared_ptr<std::vector<ElementPtr> >
+            elements(new std::vector<ElementPtr>(ListElement::listValue()));
+        return (boost::bind(&nextKeptElement, elements,
+                            boost::shared_ptr<size_t>(new size_t(0))));
+    }
+    return (factory_());
+}
+
+void
+StreamedListElement::materialize() const {
+    if (materialized_) {
+        return;
+    }
+    std::vector<ElementPtr> elements;
+    Generator generator = factory_();
+    for (ElementPtr element = generator(); element; element = generator()) {
+        elements.push_back(element);
+    }
+    // The list is modified only by keeping the generated elements, which
+    // does not change its value.
+    StreamedListElement* self = const_cast<StreamedListElement*>(this);
+    self->ListElement::setValue(elements);
+    materialized_ = true;
+}
+
+const std::vector<ElementPtr>&
+StreamedListElement::listValue() const {
+    materialize();
+    return (ListElement::listValue());
+}
+
+bool
+StreamedListElement::getValue(std::vector<ElementPtr>& t) const {
+    materialize();
+    return (ListElement::getValue(t));
+}
+
+bool
+StreamedListElement::setValue(const std::vector<ElementPtr>& v) {
+    materialized_ = true;
+    return (ListElement::setValue(v));
+}
+
+ConstElementPtr
+StreamedListElement::get(int i) const {
+    materialize();
+    return (ListElement::get(i));
+}
+
+ElementPtr
+StreamedListElement::getNonConst(int i) const {
+    materialize();
+    return (ListElement::getNonConst(i));
+}
+
+void
+StreamedListElement::set(size_t i, ElementPtr e) {
+    materialize();
+    ListElement::set(i, e);
+}
+
+void
+StreamedListElement::add(ElementPtr e) {
+    materialize();
+    ListElement::add(e);
+}
+
+void
+StreamedListElement::remove(int i) {
+    materialize();
+    ListElement::remove(i);
+}
+
+size_t
+StreamedListElement::size() const {
+    materialize();
+    return (ListElement::size());
+}
+
+bool
+StreamedListElement::empty() const {
+    materialize();
+    return (ListElement::empty());
+}
+
+void
+StreamedListElement::toJSON(std::ostream& ss) const {
+    ss << "[ ";
+
+    Generator next = begin();
+    bool first = true;
+    for (ElementPtr element = next(); element; element = next()) {
+        if (!first) {
+            ss << ", ";
+        }
+        first = false;
+        element->toJSON(ss);
+    }
+    ss << " ]";
+}
+
 void
 MapElement::toJSON(std::ostream& ss) const {
     ss << "{ ";
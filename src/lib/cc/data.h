@@ -11,6 +11,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <boost/function.hpp>
 #include <boost/shared_ptr.hpp>
 #include <stdexcept>
 #include <exceptions/exceptions.h>
@@ -643,6 +644,78 @@ public:
     bool equals(const Element& other) const;
 };
 
+/// @brief List whose elements are generated when the list is written.
+///
+/// Command handlers returning a very large number of elements, e.g. all
+/// the leases, use this list so the elements are neither created all
+/// at once nor converted into one large string: the control channel
+/// writes them in chunks using the @c ElementWriter.
+///
+/// Each writing of the list, by @c toJSON() or by an @c ElementWriter,
+/// creates a new generator, so the list can be written several times.
+/// The functions accessing or modifying the elements directly, e.g.
+/// @c size() or @c listValue(), generate all the elements once and keep
+/// them: the list is then a regular list and no longer streamed.
+class StreamedListElement : public ListElement {
+public:
+    /// @brief Type of the function generating the elements.
+    ///
+    /// It returns the next element or a null pointer when all the
+    /// elements were generated.
+    typedef boost::function<ElementPtr()> Generator;
+
+    /// @brief Type of the function creating a generator of all the
+    /// elements, from the first one.
+    typedef boost::function<Generator()> GeneratorFactory;
+
+    /// @brief Constructor.
+    ///
+    /// @param factory Function creating the generators of the elements.
+    /// @param pos Position of the list.
+    StreamedListElement(const GeneratorFactory& factory,
+                        const Position& pos = ZERO_POSITION())
+        : ListElement(pos), factory_(factory), materialized_(false) {}
+
+    /// @brief Returns a new generator of the elements.
+    ///
+    /// @throw The exceptions thrown by the generator factory.
+    Generator begin() const;
+
+    /// @brief Writes the list generating all its elements.
+    ///
+    /// @param ss Stream to write the list to.
+    void toJSON(std::ostream& ss) const;
+
+    /// @name Functions generating and keeping all the elements.
+    //@{
+    const std::vector<ElementPtr>& listValue() const;
+    using ListElement::getValue;
+    bool getValue(std::vector<ElementPtr>& t) const;
+    using ListElement::setValue;
+    bool setValue(const std::vector<ElementPtr>& v);
+    using ListElement::get;
+    ConstElementPtr get(int i) const;
+    ElementPtr getNonConst(int i) const;
+    using ListElement::set;
+    void set(size_t i, ElementPtr e);
+    void add(ElementPtr e);
+    using ListElement::remove;
+    void remove(int i);
+    size_t size() const;
+    bool empty() const;
+    //@}
+
+private:
+    /// @brief Generates all the elements and keeps them in the list.
+    void materialize() const;
+
+    /// @brief Function creating the generators of the elements.
+    GeneratorFactory factory_;
+
+    /// @brief Whether the elements were generated and kept in the list.
+    mutable bool materialized_;
+};
+
 class MapElement : public Element {
     std::map<std::string, ConstElementPtr> m;
 
@@ -0,0 +1,165 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <cc/element_writer.h>
+
+namespace isc {
+namespace data {
+
+ElementWriter::ElementWriter(const ConstElementPtr& element)
+    : stack_(), scalar_() {
+    if (element) {
+        stack_.push_back(Frame(element));
+    }
+}
+
+bool
+ElementWriter::write(std::string& output, const size_t size) {
+    while (!stack_.empty() && (output.size() < size)) {
+        step(output);
+    }
+    return (!stack_.empty());
+}
+
+void
+ElementWriter::writeValue(std::string& output,
+                          const ConstElementPtr& element) {
+    if (!element) {
+        // This is how toJSON() writes null map values.
+        output.append("None");
+
+    } else if ((element->getType() == Element::map) ||
+               (element->getType() == Element::list)) {
+        stack_.push_back(Frame(element));
+
+    } else {
+        scalar_.str("");
+        element->toJSON(scalar_);
+        output.append(scalar_.str());
+    }
+}
+
+void
+ElementWriter::step(std::string& output) {
+    Frame& frame = stack_.back();
+    const ConstElementPtr element = frame.element_;
+
+    if (element->getType() == Element::map) {
+        const std::map<std::string, ConstElementPtr>& m = element->mapValue();
+        if (!frame.started_) {
+            output.append("{ ");
+            frame.started_ = true;
+            frame.map_it_ = m.begin();
+
+        } else if (frame.map_it_ == m.end()) {
+            output.append(" }");
+            stack_.pop_back();
+
+        } else {
+            if (!frame.first_) {
+                output.append(", ");
+            }
+            frame.first_ = false;
+            output.append("\"");
+            output.append(frame.map_it_->first);
+            output.append("\": ");
+            // The value is read now: it may have been updated while the
+            // previous entries were written.
+            ConstElementPtr value = frame.map_it_->second;
+            ++frame.map_it_;
+            // The frame reference is invalidated by the push.
+            writeValue(output, value);
+        }
+
+    } else if (element->getType() == Element::list) {
+        const StreamedListElement* streamed =
+            dynamic_cast<const StreamedListElement*>(element.get());
+        if (!frame.started_) {
+            if (streamed) {
+                frame.generator_ = streamed->begin();
+            }
+            output.append("[ ");
+            frame.started_ = true;
+            return;
+        }
+
+        ConstElementPtr item;
+        bool more = false;
+        if (streamed) {
+            item = frame.generator_();
+            more = static_cast<bool>(item);
+        } else if (frame.index_ < element->size()) {
+            item = element->get(frame.index_++);
+            more = true;
+        }
+
+        if (!more) {
+            output.append(" ]");
+            stack_.pop_back();
+
+        } else {
+            if (!frame.first_) {
+                output.append(", ");
+            }
+            frame.first_ = false;
+            writeValue(output, item);
+        }
+
+    } else {
+        scalar_.str("");
+        element->toJSON(scalar_);
+        output.append(scalar_.str());
+        stack_.pop_back();
+    }
+}
+
+void
+ElementWriter::abort(std::string& output, const ConstElementPtr& entries) {
+    while (stack_.size() > 1) {
+        const Frame& frame = stack_.back();
+        const int type = frame.element_->getType();
+        if (type == Element::map) {
+            output.append(frame.started_ ? " }" : "{  }");
+        } else if (type == Element::list) {
+            output.append(frame.started_ ? " ]" : "[  ]");
+        }
+        stack_.pop_back();
+    }
+    if (stack_.empty()) {
+        return;
+    }
+
+    Frame& frame = stack_.back();
+    if (frame.element_->getType() != Element::map) {
+        output.append(frame.element_->getType() == Element::list ?
+                      (frame.started_ ? " ]" : "[  ]") : "null");
+        stack_.pop_back();
+        return;
+    }
+    if (!frame.started_) {
+        output.append("{ ");
+    }
+    if (entries) {
+        const std::map<std::string, ConstElementPtr>& m = entries->mapValue();
+        for (auto entry = m.begin(); entry != m.end(); ++entry) {
+            if (!frame.first_) {
+                output.append(", ");
+            }
+            frame.first_ = false;
+            output.append("\"");
+            output.append(entry->first);
+            output.append("\": ");
+            output.append(entry->second ? entry->second->str() : "None");
+        }
+    }
+    output.append(" }");
+    stack_.pop_back();
+}
+
+} // namespace data
+} // namespace isc
@@ -0,0 +1,121 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef ELEMENT_WRITER_H
+#define ELEMENT_WRITER_H
+
+#include <cc/data.h>
+
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace data {
+
+/// @brief Writes an element in the JSON format chunk by chunk.
+///
+/// The @c Element::str() function converts a whole element into a single
+/// string. When the element is very large, e.g. a response holding all the
+/// leases, this string takes a lot of memory and its creation blocks the
+/// server. This class produces the same text in chunks of a bounded size,
+/// so the caller can send a chunk before producing the next one. The
+/// elements of a @c StreamedListElement are generated only when they are
+/// written.
+///
+/// When the generation of the elements fails, @c abort() ends the text
+/// so it remains valid JSON, e.g. with the result and the text of an
+/// error response.
+class ElementWriter {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param element Element to write.
+    explicit ElementWriter(const ConstElementPtr& element);
+
+    /// @brief Appends the next chunk of the text to a string.
+    ///
+    /// The text is appended until the string reaches the given size.
+    /// The string may exceed it by the size of one scalar element or map
+    /// key.
+    ///
+    /// @param [out] output String to append the text to.
+    /// @param size Size the string should reach.
+    ///
+    /// @return true if some text remains to be written, false otherwise.
+    bool write(std::string& output, const size_t size);
+
+    /// @brief Ends the text after an error.
+    ///
+    /// The lists and maps being written are closed. The entries of the
+    /// outermost map which were not written yet are replaced with the
+    /// given entries, so a response which could not be fully written
+    /// ends with the result and the text of an error.
+    ///
+    /// @param [out] output String to append the text to.
+    /// @param entries Map of the entries ending the outermost map.
+    void abort(std::string& output, const ConstElementPtr& entries);
+
+    /// @brief Checks if the whole element was written.
+    bool done() const {
+        return (stack_.empty());
+    }
+
+private:
+
+    /// @brief State of a map or list being written.
+    struct Frame {
+        /// @brief Constructor.
+        ///
+        /// @param element Element to write.
+        explicit Frame(const ConstElementPtr& element)
+            : element_(element), started_(false), first_(true), index_(0),
+              map_it_(), generator_() {
+        }
+
+        /// @brief Element written.
+        ConstElementPtr element_;
+
+        /// @brief Whether the opening bracket was written.
+        bool started_;
+
+        /// @brief Whether no item of the map or list was written.
+        bool first_;
+
+        /// @brief Index of the next item of a list.
+        size_t index_;
+
+        /// @brief Next entry of a map.
+        std::map<std::string, ConstElementPtr>::const_iterator map_it_;
+
+        /// @brief Generator of the items of a streamed list.
+        StreamedListElement::Generator generator_;
+    };
+
+    /// @brief Writes the next token of the top element.
+    ///
+    /// @param [out] output String to append the text to.
+    void step(std::string& output);
+
+    /// @brief Writes a value or, for a map or a list, pushes it.
+    ///
+    /// @param [out] output String to append the text to.
+    /// @param element Value to write.
+    void writeValue(std::string& output, const ConstElementPtr& element);
+
+    /// @brief Maps and lists being written, the innermost last.
+    std::vector<Frame> stack_;
+
+    /// @brief Stream converting the scalar elements.
+    std::ostringstream scalar_;
+};
+
+} // namespace data
+} // namespace isc
+
+#endif // ELEMENT_WRITER_H
@@ -147,6 +147,12 @@ TEST(Element, from_and_to_json) {
     sv.push_back("\"foobar\"hello");
     sv.push_back("[]hello");
     sv.push_back("{}hello");
+    // Malformed numbers
+    sv.push_back("-");
+    sv.push_back("1-2");
+    sv.push_back("1.2.3");
+    sv.push_back("1e");
+    sv.push_back("+-1");
     // String not delimited correctly
     sv.push_back("\"hello");
     sv.push_back("hello\"");
@@ -0,0 +1,196 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <cc/element_writer.h>
+#include <exceptions/exceptions.h>
+#include <boost/bind.hpp>
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace isc::data;
+
+namespace {
+
+/// @brief Generates the integers from 1 to a maximum.
+class Counter {
+public:
+    /// @brief Constructor.
+    ///
+    /// @param max Last generated integer.
+    /// @param fail Integer at which the generation fails, 0 for never.
+    Counter(const int max, const int fail) : max_(max), fail_(fail),
+        current_(0) {
+    }
+
+    /// @brief Returns the next integer, a null pointer at the end.
+    ///
+    /// @throw isc::Unexpected when the failing integer is reached.
+    ElementPtr next() {
+        if (current_ >= max_) {
+            return (ElementPtr());
+        }
+        if (++current_ == fail_) {
+            isc_throw(isc::Unexpected, "failed at " << current_);
+        }
+        return (Element::create(current_));
+    }
+
+    /// @brief Last generated integer.
+    int max_;
+
+    /// @brief Integer at which the generation fails.
+    int fail_;
+
+    /// @brief Last integer generated so far.
+    int current_;
+};
+
+/// @brief Creates a new counter and returns its generator.
+///
+/// @param max Last generated integer.
+/// @param fail Integer at which the generation fails, 0 for never.
+/// @param created Incremented for each created counter.
+StreamedListElement::Generator
+createCounter(const int max, const int fail, int* created) {
+    ++*created;
+    boost::shared_ptr<Counter> counter(new Counter(max, fail));
+    return (boost::bind(&Counter::next, counter));
+}
+
+/// @brief Writes an element in chunks of a given size.
+///
+/// @param element Element to write.
+/// @param size Size of the chunks.
+/// @return The whole text.
+std::string
+writeAll(const ConstElementPtr& element, const size_t size) {
+    ElementWriter writer(element);
+    std::string text;
+    while (!writer.done()) {
+        std::string chunk;
+        writer.write(chunk, size);
+        EXPECT_FALSE(chunk.empty());
+        text += chunk;
+    }
+    return (text);
+}
+
+// This test verifies that the written text is the one returned by str()
+// whatever the size of the chunks.
+TEST(ElementWriterTest, sameText) {
+    ConstElementPtr element = Element::fromJSON(
+        "{ \"a\": [ 1, 2.5, true, null, \"x\\ny\" ], \"b\": { },"
+        "  \"c\": [ ], \"d\": { \"e\": [ { \"f\": \"g\" }, [ 3 ] ] } }");
+    const std::string expected = element->str();
+    for (size_t size = 1; size < expected.size() + 2; ++size) {
+        EXPECT_EQ(expected, writeAll(element, size)) << "size " << size;
+    }
+
+    // Scalars are also supported.
+    EXPECT_EQ("\"abc\"", writeAll(Element::create("abc"), 1));
+    EXPECT_EQ("12", writeAll(Element::create(12), 100));
+}
+
+// This test verifies that the chunks are bounded.
+TEST(ElementWriterTest, chunkSize) {
+    ElementPtr list = Element::createList();
+    for (int i = 0; i < 1000; ++i) {
+        list->add(Element::create(i));
+    }
+    ElementWriter writer(list);
+    size_t total = 0;
+    while (!writer.done()) {
+        std::string chunk;
+        writer.write(chunk, 100);
+        // A chunk exceeds the size by at most one separator and one integer.
+        EXPECT_GE(100 + 5, chunk.size());
+        total += chunk.size();
+    }
+    EXPECT_EQ(list->str().size(), total);
+}
+
+// This test verifies that the elements of a streamed list are generated
+// when they are written and that the list can be written again.
+TEST(ElementWriterTest, streamedList) {
+    int created = 0;
+    ElementPtr map = Element::createMap();
+    map->set("a-list", ElementPtr(new StreamedListElement(
+        boost::bind(&createCounter, 3, 0, &created))));
+    map->set("result", Element::create(0));
+
+    ElementWriter writer(map);
+    std::string text;
+    ASSERT_TRUE(writer.write(text, 15));
+    EXPECT_EQ(1, created);
+
+    EXPECT_FALSE(writer.write(text, 1000));
+    EXPECT_TRUE(writer.done());
+    EXPECT_EQ("{ \"a-list\": [ 1, 2, 3 ], \"result\": 0 }", text);
+
+    // Each write creates a new generator.
+    EXPECT_EQ(text, writeAll(map, 7));
+    EXPECT_EQ(2, created);
+    EXPECT_EQ(text, map->str());
+    EXPECT_EQ(3, created);
+}
+
+// This test verifies that the direct accessors of a streamed list
+// generate the elements once and keep them.
+TEST(ElementWriterTest, streamedListMaterialized) {
+    int created = 0;
+    ElementPtr list(new StreamedListElement(
+        boost::bind(&createCounter, 2, 0, &created)));
+    EXPECT_EQ(Element::list, list->getType());
+    EXPECT_EQ(0, created);
+    EXPECT_EQ(2, list->size());
+    EXPECT_FALSE(list->empty());
+    EXPECT_EQ(1, created);
+    ASSERT_TRUE(list->get(1));
+    EXPECT_EQ(2, list->get(1)->intValue());
+
+    // The kept elements are written.
+    list->add(Element::create(3));
+    EXPECT_EQ("[ 1, 2, 3 ]", list->str());
+    EXPECT_EQ("[ 1, 2, 3 ]", writeAll(list, 2));
+    EXPECT_EQ(1, created);
+    EXPECT_TRUE(list->equals(*Element::fromJSON("[ 1, 2, 3 ]")));
+}
+
+// This test verifies that a failed write can be aborted with a valid
+// text where the outermost map ends with the given entries.
+TEST(ElementWriterTest, abort) {
+    int created = 0;
+    ElementPtr args = Element::createMap();
+    args->set("leases", ElementPtr(new StreamedListElement(
+        boost::bind(&createCounter, 5, 3, &created))));
+    ElementPtr map = Element::createMap();
+    map->set("arguments", args);
+    map->set("result", Element::create(0));
+
+    ElementWriter writer(map);
+    std::string text;
+    EXPECT_THROW(writer.write(text, 1000), isc::Unexpected);
+    ElementPtr error = Element::createMap();
+    error->set("result", Element::create(1));
+    error->set("text", Element::create("failed"));
+    writer.abort(text, error);
+    EXPECT_TRUE(writer.done());
+    EXPECT_EQ("{ \"arguments\": { \"leases\": [ 1, 2 ] }, "
+              "\"result\": 1, \"text\": \"failed\" }", text);
+    ConstElementPtr parsed;
+    ASSERT_NO_THROW(parsed = Element::fromJSON(text));
+    EXPECT_EQ(1, parsed->get("result")->intValue());
+
+    // Aborting before anything was written gives the entries alone.
+    ElementWriter writer2(map);
+    text.clear();
+    writer2.abort(text, error);
+    EXPECT_EQ("{ \"result\": 1, \"text\": \"failed\" }", text);
+}
+
+} // end of anonymous namespace
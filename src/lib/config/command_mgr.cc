@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -15,6 +15,7 @@
 #include <config/command_mgr.h>
 #include <cc/data.h>
 #include <cc/command_interpreter.h>
+#include <cc/element_writer.h>
 #include <cc/json_feed.h>
 #include <dhcp/iface_mgr.h>
 #include <config/config_log.h>
@@ -22,6 +23,7 @@
 #include <util/watch_socket.h>
 #include <boost/bind.hpp>
 #include <boost/enable_shared_from_this.hpp>
+#include <boost/scoped_ptr.hpp>
 #include <array>
 #include <unistd.h>
 
@@ -66,7 +68,7 @@ public:
                ConnectionPool& connection_pool,
                const long timeout)
         : socket_(socket), timeout_timer_(*io_service), timeout_(timeout),
-          buf_(), response_(), connection_pool_(connection_pool), feed_(),
+          buf_(), response_(), writer_(), connection_pool_(connection_pool), feed_(),
           response_in_progress_(false), watch_socket_(new util::WatchSocket()) {
 
         LOG_DEBUG(command_logger, DBG_COMMAND, COMMAND_SOCKET_CONNECTION_OPENED)
@@ -140,6 +142,43 @@ public:
                                           shared_from_this(), _1, _2));
     }
 
+    /// @brief Sets the response to be sent.
+    ///
+    /// The response is converted to text chunk by chunk as it is sent,
+    /// so a large response does not have to be held as a whole in memory.
+    ///
+    /// @param rsp Response to send.
+    void setResponse(const ConstElementPtr& rsp) {
+        response_.clear();
+        writer_.reset(new ElementWriter(rsp));
+        fillResponse();
+    }
+
+    /// @brief Converts the next part of the response to text.
+    ///
+    /// It appends text to @c response_ until it holds a full chunk or the
+    /// whole response was converted. The elements of a streamed list are
+    /// generated here: when their generation fails, the response is ended
+    /// with the result and the text of an error, so the client receives
+    /// valid JSON and the connection is closed as usual once it is sent.
+    void fillResponse() {
+        if (!writer_) {
+            return;
+        }
+        try {
+            if (writer_->write(response_, BUF_SIZE)) {
+                return;
+            }
+        } catch (const std::exception& ex) {
+            LOG_ERROR(command_logger, COMMAND_RESPONSE_WRITE_ERROR)
+                .arg(socket_->getNative()).arg(ex.what());
+            writer_->abort(response_,
+                           createAnswer(CONTROL_RESULT_ERROR,
+                                        std::string(ex.what())));
+        }
+        writer_.reset();
+    }
+
     /// @brief Starts asynchronous send over the unix domain socket.
     ///
     /// This method doesn't block. Once the send operation (that covers the whole
@@ -211,9 +250,12 @@ private:
     /// @brief Buffer used for received data.
     std::array<char, BUF_SIZE> buf_;
 
-    /// @brief Response created by the server.
+    /// @brief Part of the response converted to text and not sent yet.
     std::string response_;
 
+    /// @brief Writer converting the rest of the response to text.
+    boost::scoped_ptr<ElementWriter> writer_;
+
     /// @brief Reference to the pool of connections.
     ConnectionPool& connection_pool_;
 
@@ -376,7 +418,7 @@ Connection::receiveHandler(const boost::system::error_code& ec,
 
         // Let's convert JSON response to text. Note that at this stage
         // the rsp pointer is always set.
-        response_ = rsp->str();
+        setResponse(rsp);
 
         doSend();
         return;
@@ -415,6 +457,9 @@ Connection::sendHandler(const boost::system::error_code& ec,
         // remove the chunk that we have managed to sent with the previous
         // attempt.
         response_.erase(0, bytes_transferred);
+        if (response_.size() < BUF_SIZE) {
+            fillResponse();
+        }
 
         LOG_DEBUG(command_logger, DBG_COMMAND, COMMAND_SOCKET_WRITE)
             .arg(bytes_transferred).arg(response_.size())
@@ -457,7 +502,7 @@ Connection::timeoutHandler() {
     }
 
     ConstElementPtr rsp = createAnswer(CONTROL_RESULT_ERROR, os.str());
-    response_ = rsp->str();
+    setResponse(rsp);
     doSend();
 }
 
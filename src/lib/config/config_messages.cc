@@ -15,6 +15,7 @@ extern const isc::log::MessageID COMMAND_PROCESS_ERROR2 = "COMMAND_PROCESS_ERROR
 extern const isc::log::MessageID COMMAND_RECEIVED = "COMMAND_RECEIVED";
 extern const isc::log::MessageID COMMAND_REGISTERED = "COMMAND_REGISTERED";
 extern const isc::log::MessageID COMMAND_RESPONSE_ERROR = "COMMAND_RESPONSE_ERROR";
+extern const isc::log::MessageID COMMAND_RESPONSE_WRITE_ERROR = "COMMAND_RESPONSE_WRITE_ERROR";
 extern const isc::log::MessageID COMMAND_SOCKET_ACCEPT_FAIL = "COMMAND_SOCKET_ACCEPT_FAIL";
 extern const isc::log::MessageID COMMAND_SOCKET_CLOSED_BY_FOREIGN_HOST = "COMMAND_SOCKET_CLOSED_BY_FOREIGN_HOST";
 extern const isc::log::MessageID COMMAND_SOCKET_CONNECTION_CANCEL_FAIL = "COMMAND_SOCKET_CONNECTION_CANCEL_FAIL";
@@ -45,6 +46,7 @@ const char* values[] = {
     "COMMAND_RECEIVED", "Received command '%1'",
     "COMMAND_REGISTERED", "Command %1 registered",
     "COMMAND_RESPONSE_ERROR", "Server failed to generate response for command: %1",
+    "COMMAND_RESPONSE_WRITE_ERROR", "Failed to write the response over command socket %1: %2",
     "COMMAND_SOCKET_ACCEPT_FAIL", "Failed to accept incoming connection on command socket %1: %2",
     "COMMAND_SOCKET_CLOSED_BY_FOREIGN_HOST", "Closed command socket %1 by foreign host, %2",
     "COMMAND_SOCKET_CONNECTION_CANCEL_FAIL", "Failed to cancel read operation on socket %1: %2",
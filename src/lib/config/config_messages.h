@@ -16,6 +16,7 @@ extern const isc::log::MessageID COMMAND_PROCESS_ERROR2;
 extern const isc::log::MessageID COMMAND_RECEIVED;
 extern const isc::log::MessageID COMMAND_REGISTERED;
 extern const isc::log::MessageID COMMAND_RESPONSE_ERROR;
+extern const isc::log::MessageID COMMAND_RESPONSE_WRITE_ERROR;
 extern const isc::log::MessageID COMMAND_SOCKET_ACCEPT_FAIL;
 extern const isc::log::MessageID COMMAND_SOCKET_CLOSED_BY_FOREIGN_HOST;
 extern const isc::log::MessageID COMMAND_SOCKET_CONNECTION_CANCEL_FAIL;
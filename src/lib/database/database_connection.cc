@@ -19,6 +19,17 @@
 
 using namespace std;
 
+namespace {
+
+/// @brief Indicates if the lost connectivity callback is deferred in
+/// this thread.
+thread_local bool db_lost_deferred = false;
+
+/// @brief ReconnectCtl saved by the deferred callback of this thread.
+thread_local isc::db::ReconnectCtlPtr deferred_db_lost;
+
+}
+
 namespace isc {
 namespace db {
 
@@ -145,6 +156,11 @@ DatabaseConnection::makeReconnectCtl() const {
 
 bool
 DatabaseConnection::invokeDbLostCallback() const {
+    if (db_lost_deferred) {
+        deferred_db_lost = makeReconnectCtl();
+        return (true);
+    }
+
     if (DatabaseConnection::db_lost_callback) {
         // Invoke the callback, passing in a new instance of ReconnectCtl
         return (DatabaseConnection::db_lost_callback)(makeReconnectCtl());
@@ -153,6 +169,18 @@ DatabaseConnection::invokeDbLostCallback() const {
     return (false);
 }
 
+void
+DatabaseConnection::deferDbLostCallback(const bool defer) {
+    db_lost_deferred = defer;
+}
+
+ReconnectCtlPtr
+DatabaseConnection::takeDeferredDbLost() {
+    ReconnectCtlPtr db_lost = deferred_db_lost;
+    deferred_db_lost.reset();
+    return (db_lost);
+}
+
 isc::data::ElementPtr
 DatabaseConnection::toElement(const ParameterMap& params) {
     isc::data::ElementPtr result = isc::data::Element::createMap();
@@ -167,6 +195,7 @@ DatabaseConnection::toElement(const ParameterMap& params) {
             (keyword == "max-reconnect-tries") ||
             (keyword == "request-timeout") ||
             (keyword == "tcp-keepalive") ||
+            (keyword == "pool-size") ||
             (keyword == "port")) {
             // integer parameters
             int64_t int_value;
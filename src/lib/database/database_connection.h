@@ -212,10 +212,31 @@ public:
     /// this function will instantiate a ReconnectCtl and pass it to the
     /// callback.
     ///
+    /// When the callback is deferred in the calling thread, the
+    /// ReconnectCtl is saved for @ref takeDeferredDbLost instead.
+    ///
     /// @return Returns the result of the callback or false if there is no
-    /// callback.
+    /// callback, true when the callback is deferred.
     bool invokeDbLostCallback() const;
 
+    /// @brief Defers the lost connectivity callback in the calling thread.
+    ///
+    /// The callback acts on the server state so it must be invoked by the
+    /// main thread. Threads performing database queries on behalf of the
+    /// main thread defer it and hand the saved ReconnectCtl over to the
+    /// main thread.
+    ///
+    /// @param defer true to defer the callback, false to invoke it.
+    static void deferDbLostCallback(const bool defer);
+
+    /// @brief Returns the ReconnectCtl saved by a deferred callback.
+    ///
+    /// The saved ReconnectCtl is cleared.
+    ///
+    /// @return The ReconnectCtl saved by the last deferred callback of the
+    /// calling thread or null when the connectivity was not lost.
+    static ReconnectCtlPtr takeDeferredDbLost();
+
     /// @brief Unparse a parameter map
     ///
     /// @param params the parameter map to unparse
@@ -0,0 +1,41 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <database/db_context_pool.h>
+#include <exceptions/exceptions.h>
+
+#include <boost/lexical_cast.hpp>
+
+#include <limits>
+
+namespace isc {
+namespace db {
+
+size_t
+getDbPoolMaxSize(const DatabaseConnection::ParameterMap& parameters,
+                 const size_t default_size) {
+    auto param = parameters.find("pool-size");
+    if (param == parameters.end()) {
+        return (default_size > 0 ? default_size : 1);
+    }
+
+    int64_t size = 0;
+    try {
+        size = boost::lexical_cast<int64_t>(param->second);
+    } catch (...) {
+        // Checked below.
+    }
+    if ((size <= 0) || (size > std::numeric_limits<uint32_t>::max())) {
+        isc_throw(BadValue, "database connection pool size ("
+                  << param->second << ") must be an integer greater than 0");
+    }
+    return (static_cast<size_t>(size));
+}
+
+} // namespace db
+} // namespace isc
@@ -0,0 +1,239 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef DB_CONTEXT_POOL_H
+#define DB_CONTEXT_POOL_H
+
+#include <database/database_connection.h>
+#include <util/threads/sync.h>
+
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <ctime>
+#include <vector>
+
+namespace isc {
+namespace db {
+
+/// @brief Default number of seconds a connection may stay idle in the
+/// pool before it is checked when taken again.
+const time_t DB_POOL_DEFAULT_CHECK_INTERVAL = 30;
+
+/// @brief Returns the maximum number of connections of a SQL backend.
+///
+/// The value is taken from the @c pool-size database access parameter.
+///
+/// @param parameters Database access parameters.
+/// @param default_size Number of connections used when the parameter is
+/// not specified.
+/// @return Maximum number of connections, at least 1.
+/// @throw BadValue when the parameter is not a positive integer.
+size_t getDbPoolMaxSize(const DatabaseConnection::ParameterMap& parameters,
+                        const size_t default_size = 1);
+
+/// @brief Pool of database contexts.
+///
+/// A database context is an open connection to the database together with
+/// its prepared statements and the exchange objects used to bind the data
+/// of these statements. The context is used exclusively by one caller at a
+/// time, so concurrent callers, e.g. processing threads, each get their own
+/// connection and can overlap the database round trips. The pool opens new
+/// contexts on demand up to the maximum size: beyond that callers wait for
+/// a context to be released.
+///
+/// The contexts which stayed idle in the pool longer than the check
+/// interval are checked when they are taken again. A context which lost
+/// its connection (e.g. closed by the server on an idle timeout) is
+/// discarded and replaced by a new one. When the replacement can't be
+/// opened either, the database is considered lost: the lost connectivity
+/// callback of the connection is invoked, as it is for a fatal error while
+/// executing a statement, and @c DbOperationError is thrown.
+///
+/// @tparam Context Type of the context. It must have a public @c conn_
+/// member derived from @c DatabaseConnection which provides a @c ping()
+/// method returning true when the connection is usable.
+template<typename Context>
+class DbContextPool : public boost::noncopyable {
+public:
+
+    /// @brief Pointer to a context.
+    typedef boost::shared_ptr<Context> ContextPtr;
+
+    /// @brief Type of the function opening a new context.
+    typedef boost::function<ContextPtr ()> ContextFactory;
+
+    /// @brief Constructor.
+    ///
+    /// @param factory Function opening a new context.
+    /// @param max_size Maximum number of contexts.
+    /// @param check_interval Number of seconds a context may stay idle
+    /// before it is checked when taken again.
+    DbContextPool(const ContextFactory& factory, const size_t max_size,
+                  const time_t check_interval = DB_POOL_DEFAULT_CHECK_INTERVAL)
+        : factory_(factory), max_size_(max_size > 0 ? max_size : 1),
+          check_interval_(check_interval), idle_(), size_(0), mutex_(),
+          released_() {
+    }
+
+    /// @brief Takes a context from the pool.
+    ///
+    /// Returns an idle context when there is one, opens a new context when
+    /// the maximum size is not reached, otherwise waits for a context to
+    /// be released.
+    ///
+    /// @return Context for the exclusive use of the caller.
+    /// @throw DbOpenError when a new context can't be opened.
+    /// @throw DbOperationError when a context lost its connection and it
+    /// can't be replaced.
+    ContextPtr acquire() {
+        ContextPtr lost;
+        for (;;) {
+            ContextPtr ctx;
+            bool check = false;
+            {
+                util::thread::Mutex::Locker lock(mutex_);
+                while (idle_.empty() && (size_ >= max_size_)) {
+                    released_.wait(mutex_);
+                }
+                if (!idle_.empty()) {
+                    ctx = idle_.back().ctx_;
+                    check = (time(NULL) - idle_.back().since_ >= check_interval_);
+                    idle_.pop_back();
+                } else {
+                    // Reserve the place of the new context.
+                    ++size_;
+                }
+            }
+
+            if (!ctx) {
+                try {
+                    ctx = factory_();
+                } catch (...) {
+                    discard();
+                    if (lost) {
+                        // The database is not reachable: let the server
+                        // recover the connectivity.
+                        lost->conn_.invokeDbLostCallback();
+                        isc_throw(DbOperationError,
+                                  "fatal database error or connectivity lost");
+                    }
+                    throw;
+                }
+                return (ctx);
+            }
+
+            if (!check || ctx->conn_.ping()) {
+                return (ctx);
+            }
+
+            // The connection is no longer usable: replace it.
+            discard();
+            lost = ctx;
+        }
+    }
+
+    /// @brief Returns a context to the pool.
+    ///
+    /// @param ctx Context taken by @ref acquire.
+    void release(const ContextPtr& ctx) {
+        util::thread::Mutex::Locker lock(mutex_);
+        IdleContext idle = { ctx, time(NULL) };
+        idle_.push_back(idle);
+        released_.signal();
+    }
+
+    /// @brief Returns the number of open contexts.
+    size_t getSize() const {
+        util::thread::Mutex::Locker lock(mutex_);
+        return (size_);
+    }
+
+    /// @brief Returns the number of idle contexts.
+    size_t getIdleSize() const {
+        util::thread::Mutex::Locker lock(mutex_);
+        return (idle_.size());
+    }
+
+    /// @brief Returns the maximum number of contexts.
+    size_t getMaxSize() const {
+        return (max_size_);
+    }
+
+private:
+
+    /// @brief Forgets a context which is not returned to the pool.
+    void discard() {
+        util::thread::Mutex::Locker lock(mutex_);
+        --size_;
+        released_.signal();
+    }
+
+    /// @brief Idle context with the time it was released.
+    struct IdleContext {
+        ContextPtr ctx_;
+        time_t since_;
+    };
+
+    /// @brief Function opening a new context.
+    ContextFactory factory_;
+
+    /// @brief Maximum number of contexts.
+    const size_t max_size_;
+
+    /// @brief Idle time after which a context is checked.
+    const time_t check_interval_;
+
+    /// @brief Idle contexts, the most recently released last.
+    std::vector<IdleContext> idle_;
+
+    /// @brief Number of open contexts, idle or in use.
+    size_t size_;
+
+    /// @brief Mutex protecting the pool.
+    mutable util::thread::Mutex mutex_;
+
+    /// @brief Condition signaled when a context is released.
+    util::thread::CondVar released_;
+};
+
+/// @brief Takes a context from a pool for the lifetime of this object.
+///
+/// @tparam Context Type of the context.
+template<typename Context>
+class DbContextAlloc : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Takes a context from the pool.
+    ///
+    /// @param pool Pool of contexts.
+    DbContextAlloc(DbContextPool<Context>& pool)
+        : ctx_(pool.acquire()), pool_(pool) {
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Returns the context to the pool.
+    ~DbContextAlloc() {
+        pool_.release(ctx_);
+    }
+
+    /// @brief The context.
+    boost::shared_ptr<Context> ctx_;
+
+private:
+
+    /// @brief Pool the context was taken from.
+    DbContextPool<Context>& pool_;
+};
+
+} // namespace db
+} // namespace isc
+
+#endif // DB_CONTEXT_POOL_H
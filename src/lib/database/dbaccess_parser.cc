@@ -54,6 +54,7 @@ DbAccessParser::parse(std::string& access_string,
     int64_t reconnect_wait_time = 0;
     int64_t request_timeout = 0;
     int64_t tcp_keepalive = 0;
+    int64_t pool_size = 1;
 
     // 2. Update the copy with the passed keywords.
     for (std::pair<std::string, ConstElementPtr> param : database_config->mapValue()) {
@@ -94,6 +95,11 @@ DbAccessParser::parse(std::string& access_string,
                 values_copy[param.first] =
                     boost::lexical_cast<std::string>(tcp_keepalive);
 
+            } else if (param.first == "pool-size") {
+                pool_size = param.second->intValue();
+                values_copy[param.first] =
+                    boost::lexical_cast<std::string>(pool_size);
+
             } else if (param.first == "port") {
                 port = param.second->intValue();
                 values_copy[param.first] =
@@ -217,6 +223,15 @@ DbAccessParser::parse(std::string& access_string,
                   << " (" << value->getPosition() << ")");
     }
 
+    // Check that the pool-size is within a reasonable range.
+    if ((pool_size < 1) ||
+        (pool_size > std::numeric_limits<uint32_t>::max())) {
+        ConstElementPtr value = database_config->get("pool-size");
+        isc_throw(DbConfigError, "pool-size " << pool_size
+                  << " must be in range 1...MAX_UINT32 (4294967295) "
+                  << " (" << value->getPosition() << ")");
+    }
+
     // 4. If all is OK, update the stored keyword/value pairs.  We do this by
     // swapping contents - values_copy is destroyed immediately after the
     // operation (when the method exits), so we are not interested in its new
@@ -120,6 +120,44 @@ TEST_F(DatabaseConnectionCallbackTest, dbLostCallback) {
     EXPECT_EQ(3, db_reconnect_ctl_->maxRetries());
 }
 
+/// @brief deferredDbLostCallback
+///
+/// This test verifies that a deferred DbLostCallback is not invoked
+/// and that its ReconnectCtl is saved for the caller.
+TEST_F(DatabaseConnectionCallbackTest, deferredDbLostCallback) {
+    DatabaseConnection::ParameterMap pmap;
+    pmap[std::string("type")] = std::string("test");
+    pmap[std::string("max-reconnect-tries")] = std::string("3");
+    pmap[std::string("reconnect-wait-time")] = std::string("60000");
+
+    DatabaseConnection::db_lost_callback =
+        boost::bind(&DatabaseConnectionCallbackTest::dbLostCallback, this, _1);
+    DatabaseConnection datasrc(pmap);
+
+    EXPECT_FALSE(DatabaseConnection::takeDeferredDbLost());
+
+    /// The deferred callback is not invoked.
+    DatabaseConnection::deferDbLostCallback(true);
+    bool ret = false;
+    ASSERT_NO_THROW(ret = datasrc.invokeDbLostCallback());
+    DatabaseConnection::deferDbLostCallback(false);
+    EXPECT_TRUE(ret);
+    EXPECT_FALSE(db_reconnect_ctl_);
+
+    /// The saved control is returned once.
+    ReconnectCtlPtr db_lost = DatabaseConnection::takeDeferredDbLost();
+    ASSERT_TRUE(db_lost);
+    EXPECT_EQ("test", db_lost->backendType());
+    EXPECT_EQ(3, db_lost->maxRetries());
+    EXPECT_FALSE(DatabaseConnection::takeDeferredDbLost());
+
+    /// The callback is invoked again when not deferred.
+    ASSERT_NO_THROW(ret = datasrc.invokeDbLostCallback());
+    EXPECT_TRUE(ret);
+    EXPECT_TRUE(db_reconnect_ctl_);
+    DatabaseConnection::db_lost_callback = 0;
+}
+
 // This test checks that a database access string can be parsed correctly.
 TEST(DatabaseConnectionTest, parse) {
 
@@ -0,0 +1,202 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <database/db_context_pool.h>
+#include <exceptions/exceptions.h>
+#include <util/threads/thread.h>
+#include <gtest/gtest.h>
+
+#include <boost/bind.hpp>
+#include <boost/scoped_ptr.hpp>
+
+#include <unistd.h>
+
+using namespace isc;
+using namespace isc::db;
+using namespace isc::util::thread;
+
+namespace {
+
+/// @brief Connection used by the test contexts.
+class TestConnection : public DatabaseConnection {
+public:
+
+    /// @brief Constructor.
+    TestConnection()
+        : DatabaseConnection(ParameterMap()), alive_(true) {
+    }
+
+    /// @brief Checks the connection.
+    bool ping() {
+        return (alive_);
+    }
+
+    /// @brief Connection state returned by ping.
+    bool alive_;
+};
+
+/// @brief Test context.
+class TestContext {
+public:
+
+    /// @brief Test connection.
+    TestConnection conn_;
+};
+
+/// @brief Pointer to a test context.
+typedef boost::shared_ptr<TestContext> TestContextPtr;
+
+/// @brief Test fixture for @c DbContextPool.
+class DbContextPoolTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    DbContextPoolTest()
+        : opened_(0), fail_(false), lost_(0) {
+        DatabaseConnection::db_lost_callback =
+            boost::bind(&DbContextPoolTest::dbLost, this, _1);
+    }
+
+    /// @brief Destructor.
+    virtual ~DbContextPoolTest() {
+        DatabaseConnection::db_lost_callback = 0;
+    }
+
+    /// @brief Opens a test context.
+    TestContextPtr open() {
+        if (fail_) {
+            isc_throw(DbOpenError, "unable to open");
+        }
+        ++opened_;
+        return (TestContextPtr(new TestContext()));
+    }
+
+    /// @brief Lost connectivity callback.
+    bool dbLost(ReconnectCtlPtr) {
+        ++lost_;
+        return (true);
+    }
+
+    /// @brief Number of opened contexts.
+    size_t opened_;
+
+    /// @brief Make the opening of contexts fail.
+    bool fail_;
+
+    /// @brief Number of calls to the lost connectivity callback.
+    size_t lost_;
+};
+
+// This test verifies that the contexts are reused.
+TEST_F(DbContextPoolTest, reuse) {
+    DbContextPool<TestContext> pool(boost::bind(&DbContextPoolTest::open,
+                                                this), 2);
+    EXPECT_EQ(2, pool.getMaxSize());
+    EXPECT_EQ(0, pool.getSize());
+
+    TestContextPtr first;
+    {
+        DbContextAlloc<TestContext> alloc(pool);
+        first = alloc.ctx_;
+        ASSERT_TRUE(first);
+        EXPECT_EQ(1, pool.getSize());
+        EXPECT_EQ(0, pool.getIdleSize());
+    }
+    EXPECT_EQ(1, pool.getIdleSize());
+
+    // The released context is taken again.
+    {
+        DbContextAlloc<TestContext> alloc(pool);
+        EXPECT_EQ(first, alloc.ctx_);
+
+        // A concurrent use opens a second context.
+        DbContextAlloc<TestContext> alloc2(pool);
+        EXPECT_NE(first, alloc2.ctx_);
+        EXPECT_EQ(2, pool.getSize());
+    }
+    EXPECT_EQ(2, opened_);
+    EXPECT_EQ(2, pool.getIdleSize());
+}
+
+// This test verifies that the callers wait for a context when all
+// contexts are used.
+TEST_F(DbContextPoolTest, maxSize) {
+    DbContextPool<TestContext> pool(boost::bind(&DbContextPoolTest::open,
+                                                this), 1);
+    TestContextPtr taken;
+    boost::scoped_ptr<DbContextAlloc<TestContext> >
+        alloc(new DbContextAlloc<TestContext>(pool));
+    TestContextPtr ctx = alloc->ctx_;
+    Thread thread([&pool, &taken]() {
+        DbContextAlloc<TestContext> waiting(pool);
+        taken = waiting.ctx_;
+    });
+    usleep(10000);
+    EXPECT_FALSE(taken);
+    EXPECT_EQ(1, pool.getSize());
+
+    // Release the context to the waiting thread.
+    alloc.reset();
+    thread.wait();
+    EXPECT_EQ(ctx, taken);
+    EXPECT_EQ(1, pool.getIdleSize());
+    EXPECT_EQ(1, opened_);
+}
+
+// This test verifies that the contexts which lost their connection are
+// replaced.
+TEST_F(DbContextPoolTest, healthCheck) {
+    // Check all contexts taken from the pool.
+    DbContextPool<TestContext> pool(boost::bind(&DbContextPoolTest::open,
+                                                this), 1, 0);
+    TestContextPtr first;
+    {
+        DbContextAlloc<TestContext> alloc(pool);
+        first = alloc.ctx_;
+    }
+    first->conn_.alive_ = false;
+    {
+        DbContextAlloc<TestContext> alloc(pool);
+        EXPECT_NE(first, alloc.ctx_);
+        EXPECT_EQ(1, pool.getSize());
+    }
+    EXPECT_EQ(2, opened_);
+    EXPECT_EQ(0, lost_);
+
+    // When the replacement can't be opened the connectivity is lost.
+    {
+        DbContextAlloc<TestContext> alloc(pool);
+        alloc.ctx_->conn_.alive_ = false;
+    }
+    fail_ = true;
+    EXPECT_THROW(DbContextAlloc<TestContext> alloc(pool), DbOperationError);
+    EXPECT_EQ(1, lost_);
+    EXPECT_EQ(0, pool.getSize());
+
+    // Opening errors are reported as they are.
+    EXPECT_THROW(DbContextAlloc<TestContext> alloc(pool), DbOpenError);
+    EXPECT_EQ(1, lost_);
+    EXPECT_EQ(0, pool.getSize());
+}
+
+// This test verifies that the maximum number of connections is taken
+// from the pool-size parameter.
+TEST_F(DbContextPoolTest, maxSizeParameter) {
+    DatabaseConnection::ParameterMap parameters;
+    EXPECT_EQ(1, getDbPoolMaxSize(parameters));
+    EXPECT_EQ(5, getDbPoolMaxSize(parameters, 5));
+    parameters["pool-size"] = "8";
+    EXPECT_EQ(8, getDbPoolMaxSize(parameters));
+    EXPECT_EQ(8, getDbPoolMaxSize(parameters, 5));
+    // The invalid values are rejected.
+    parameters["pool-size"] = "0";
+    EXPECT_THROW(getDbPoolMaxSize(parameters), BadValue);
+    parameters["pool-size"] = "many";
+    EXPECT_THROW(getDbPoolMaxSize(parameters, 5), BadValue);
+}
+
+} // end of anonymous namespace
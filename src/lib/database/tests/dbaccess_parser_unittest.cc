@@ -168,6 +168,7 @@ private:
          return ((parameter != "persist") && (parameter != "lfc-interval") &&
                  (parameter != "connect-timeout") &&
                  (parameter != "port") &&
+                 (parameter != "pool-size") &&
                  (parameter != "readonly"));
     }
 
@@ -452,6 +453,40 @@ TEST_F(DbAccessParserTest, largePort) {
     EXPECT_THROW(parser.parse(json_elements), DbConfigError);
 }
 
+// This test checks that the parser accepts the valid value of the
+// pool-size parameter.
+TEST_F(DbAccessParserTest, validPoolSize) {
+    const char* config[] = {"type", "mysql",
+                            "name", "keatest",
+                            "pool-size", "8",
+                            NULL};
+
+    string json_config = toJson(config);
+    ConstElementPtr json_elements = Element::fromJSON(json_config);
+    EXPECT_TRUE(json_elements);
+
+    TestDbAccessParser parser;
+    EXPECT_NO_THROW(parser.parse(json_elements));
+    checkAccessString("Valid pool size", parser.getDbAccessParameters(),
+                      config);
+}
+
+// This test checks that the parser rejects the zero value of the
+// pool-size parameter.
+TEST_F(DbAccessParserTest, zeroPoolSize) {
+    const char* config[] = {"type", "mysql",
+                            "name", "keatest",
+                            "pool-size", "0",
+                            NULL};
+
+    string json_config = toJson(config);
+    ConstElementPtr json_elements = Element::fromJSON(json_config);
+    EXPECT_TRUE(json_elements);
+
+    TestDbAccessParser parser;
+    EXPECT_THROW(parser.parse(json_elements), DbConfigError);
+}
+
 // Check that the parser works with a valid MySQL configuration
 TEST_F(DbAccessParserTest, validTypeMysql) {
     const char* config[] = {"type",     "mysql",
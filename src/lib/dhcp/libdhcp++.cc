@@ -812,7 +812,7 @@ LibDHCP::packOptions4(isc::util::OutputBuffer& buf,
     if (top) {
         auto x = options.find(DHO_DHCP_MESSAGE_TYPE);
         if (x != options.end()) {
-            x->second->pack(buf);
+            x->second->packCached(buf);
         }
     }
 
@@ -830,19 +830,19 @@ LibDHCP::packOptions4(isc::util::OutputBuffer& buf,
                 end = it->second;
                 break;
             default:
-                it->second->pack(buf);
+                it->second->packCached(buf);
                 break;
         }
     }
 
     // Add the RAI option if it exists.
     if (agent) {
-       agent->pack(buf);
+       agent->packCached(buf);
     }
 
     // And at the end the END option.
     if (end)  {
-       end->pack(buf);
+       end->packCached(buf);
     }
 }
 
@@ -851,7 +851,7 @@ LibDHCP::packOptions6(isc::util::OutputBuffer& buf,
                       const OptionCollection& options) {
     for (OptionCollection::const_iterator it = options.begin();
          it != options.end(); ++it) {
-        it->second->pack(buf);
+        it->second->packCached(buf);
     }
 }
 
@@ -11,7 +11,6 @@
 #include <util/encode/hex.h>
 #include <util/io_utilities.h>
 
-#include <boost/make_shared.hpp>
 
 #include <iomanip>
 #include <list>
@@ -54,18 +53,18 @@ Option::Option(Universe u, uint16_t type, OptionBufferConstIter first,
 Option::Option(const Option& option)
     : universe_(option.universe_), type_(option.type_),
       data_(option.data_), options_(),
-      encapsulated_space_(option.encapsulated_space_) {
+      encapsulated_space_(option.encapsulated_space_), wire_data_() {
     option.getOptionsCopy(options_);
 }
 
 OptionPtr
 Option::create(Universe u, uint16_t type) {
-    return (boost::make_shared<Option>(u, type));
+    return (OptionPtr(new Option(u, type)));
 }
 
 OptionPtr
 Option::create(Universe u, uint16_t type, const OptionBuffer& data) {
-    return (boost::make_shared<Option>(u, type, data));
+    return (OptionPtr(new Option(u, type, data)));
 }
 
 Option&
@@ -76,6 +75,7 @@ Option::operator=(const Option& rhs) {
         data_ = rhs.data_;
         rhs.getOptionsCopy(options_);
         encapsulated_space_ = rhs.encapsulated_space_;
+        clearWireData();
     }
     return (*this);
 }
@@ -120,6 +120,48 @@ void Option::pack(isc::util::OutputBuffer& buf) const {
     packOptions(buf);
 }
 
+void
+Option::packCached(isc::util::OutputBuffer& buf) const {
+    if (hasWireData()) {
+        if (!wire_data_->empty()) {
+            buf.writeData(&(*wire_data_)[0], wire_data_->size());
+        }
+    } else {
+        pack(buf);
+    }
+}
+
+void
+Option::cacheWireData() {
+    // The sub-options are rendered by the pack() of this option but their
+    // wire data is cached too, so as their modifications can be detected
+    // by hasWireData().
+    for (OptionCollection::const_iterator it = options_.begin();
+         it != options_.end(); ++it) {
+        it->second->cacheWireData();
+    }
+    OutputBuffer buf(len());
+    pack(buf);
+    const uint8_t* data = static_cast<const uint8_t*>(buf.getData());
+    wire_data_.reset(new OptionBuffer(data, data + buf.getLength()));
+}
+
+bool
+Option::hasWireData() const {
+    if (!wire_data_) {
+        return (false);
+    }
+    // The cached data include the sub-options, so they are only valid
+    // if none of the sub-options has been modified since.
+    for (OptionCollection::const_iterator it = options_.begin();
+         it != options_.end(); ++it) {
+        if (!it->second->hasWireData()) {
+            return (false);
+        }
+    }
+    return (true);
+}
+
 void
 Option::packHeader(isc::util::OutputBuffer& buf) const {
     if (universe_ == V4) {
@@ -161,6 +203,7 @@ void Option::unpack(OptionBufferConstIter begin,
 
 void
 Option::unpackOptions(const OptionBuffer& buf) {
+    clearWireData();
     list<uint16_t> deferred;
     switch (universe_) {
     case V4:
@@ -231,6 +274,7 @@ Option::getOptionsCopy(OptionCollection& options_copy) const {
 bool Option::delOption(uint16_t opt_type) {
     isc::dhcp::OptionCollection::iterator x = options_.find(opt_type);
     if ( x != options_.end() ) {
+        clearWireData();
         options_.erase(x);
         return true; // delete successful
     }
@@ -350,6 +394,7 @@ void Option::addOption(OptionPtr opt) {
                       << " already present in this message.");
         }
     }
+    clearWireData();
     options_.insert(make_pair(opt->getType(), opt));
 }
 
@@ -372,16 +417,19 @@ uint32_t Option::getUint32() const {
 }
 
 void Option::setUint8(uint8_t value) {
+    clearWireData();
     data_.resize(sizeof(value));
     data_[0] = value;
 }
 
 void Option::setUint16(uint16_t value) {
+    clearWireData();
     data_.resize(sizeof(value));
     writeUint16(value, &data_[0], data_.size());
 }
 
 void Option::setUint32(uint32_t value) {
+    clearWireData();
     data_.resize(sizeof(value));
     writeUint32(value, &data_[0], data_.size());
 }
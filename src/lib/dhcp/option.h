@@ -8,6 +8,8 @@
 #define OPTION_H
 
 #include <util/buffer.h>
+#include <util/memory_arena.h>
+#include <util/small_multimap.h>
 
 #include <boost/function.hpp>
 #include <boost/shared_ptr.hpp>
@@ -37,8 +39,22 @@ typedef boost::shared_ptr<OptionBuffer> OptionBufferPtr;
 class Option;
 typedef boost::shared_ptr<Option> OptionPtr;
 
-/// A collection of DHCP (v4 or v6) options
-typedef std::multimap<unsigned int, OptionPtr> OptionCollection;
+/// @brief Number of options held in an @c OptionCollection without
+/// a heap allocation.
+///
+/// Most options carry no or very few sub-options, while the packets
+/// carrying more options than that pay for a single contiguous heap
+/// array rather than for a tree node per option.
+const size_t OPTION_COLLECTION_INLINE_SIZE = 4;
+
+/// @brief A collection of DHCP (v4 or v6) options
+///
+/// The options are kept in a sorted flat array which is embedded in the
+/// owning object for small collections. It offers the same interface
+/// as the @c std::multimap it replaces, except that inserting or
+/// removing an option invalidates iterators.
+typedef isc::util::SmallMultimap<unsigned int, OptionPtr,
+                                 OPTION_COLLECTION_INLINE_SIZE> OptionCollection;
 /// A pointer to an OptionCollection
 typedef boost::shared_ptr<OptionCollection> OptionCollectionPtr;
 
@@ -55,7 +71,11 @@ public:
         isc::Exception(file, line, what) { };
 };
 
-class Option {
+/// @brief Base class representing a DHCP option.
+///
+/// Options created while a @c isc::util::MemoryArenaScope is active
+/// are allocated from the per-packet arena.
+class Option : public isc::util::ArenaAllocatable {
 public:
     /// length of the usual DHCPv4 option header (there are exceptions)
     const static size_t OPTION4_HDR_LEN = 2;
@@ -227,6 +247,40 @@ public:
     /// @throw BadValue Universe of the option is neither V4 nor V6.
     virtual void pack(isc::util::OutputBuffer& buf) const;
 
+    /// @brief Writes option in wire-format to a buffer using the cached
+    /// wire data, if available.
+    ///
+    /// If the wire data has been cached with @ref cacheWireData, it is
+    /// copied to the buffer as is. Otherwise, the option is packed using
+    /// @ref pack. This is used when packing options into packets.
+    ///
+    /// @param buf pointer to a buffer
+    void packCached(isc::util::OutputBuffer& buf) const;
+
+    /// @brief Renders the option in wire-format and caches the result.
+    ///
+    /// This is meant for options which are not modified anymore, e.g.
+    /// the options from the committed server configuration, so as they
+    /// don't have to be rendered for every packet they are sent in. The
+    /// wire data of the sub-options is cached as well. The cache is
+    /// discarded by the modifiers of this class and of the derived
+    /// classes, such as @ref addOption or @ref setData. The modification
+    /// of a sub-option discards its own cache, which invalidates the
+    /// cache of the option containing it. Derived classes adding new
+    /// modifiers must call @ref clearWireData in them.
+    void cacheWireData();
+
+    /// @brief Discards the cached wire data.
+    void clearWireData() {
+        wire_data_.reset();
+    }
+
+    /// @brief Checks if the wire data has been cached.
+    ///
+    /// @return true if the wire data is available and none of the
+    /// sub-options has been modified since it was cached.
+    bool hasWireData() const;
+
     /// @brief Parses received buffer.
     ///
     /// @param begin iterator to first byte of option data
@@ -391,6 +445,7 @@ public:
     /// limits of the buffer to be assigned to a data_ buffer.
     template<typename InputIterator>
     void setData(InputIterator first, InputIterator last) {
+        clearWireData();
         data_.assign(first, last);
     }
 
@@ -399,6 +454,7 @@ public:
     /// @param encapsulated_space name of the option space encapsulated by
     /// this option.
     void setEncapsulatedSpace(const std::string& encapsulated_space) {
+        clearWireData();
         encapsulated_space_ = encapsulated_space;
     }
 
@@ -550,6 +606,12 @@ protected:
     /// Name of the option space being encapsulated by this option.
     std::string encapsulated_space_;
 
+    /// @brief Cached wire format of the option, including the header
+    /// and sub-options.
+    ///
+    /// It is not copied when the option is copied.
+    boost::shared_ptr<OptionBuffer> wire_data_;
+
     /// @todo probably 2 different containers have to be used for v4 (unique
     /// options) and v6 (options with the same type can repeat)
 };
@@ -85,6 +85,7 @@ Option4AddrLst::pack(isc::util::OutputBuffer& buf) const {
 }
 
 void Option4AddrLst::setAddress(const isc::asiolink::IOAddress& addr) {
+    clearWireData();
     if (!addr.isV4()) {
         isc_throw(BadValue, "Can't store non-IPv4 address in "
                   << "Option4AddrLst option");
@@ -94,6 +95,7 @@ void Option4AddrLst::setAddress(const isc::asiolink::IOAddress& addr) {
 }
 
 void Option4AddrLst::setAddresses(const AddressContainer& addrs) {
+    clearWireData();
 
     // Do not copy it as a whole. addAddress() does sanity checks.
     // i.e. throw if someone tries to set IPv6 address.
@@ -106,6 +108,7 @@ void Option4AddrLst::setAddresses(const AddressContainer& addrs) {
 
 
 void Option4AddrLst::addAddress(const isc::asiolink::IOAddress& addr) {
+    clearWireData();
     if (!addr.isV4()) {
         isc_throw(BadValue, "Can't store non-IPv4 address in "
                   << "Option4AddrLst option");
@@ -387,6 +387,7 @@ Option4ClientFqdn::getFlag(const uint8_t flag) const {
 
 void
 Option4ClientFqdn::setFlag(const uint8_t flag, const bool set_flag) {
+    clearWireData();
     // Check that flag is in range between 0x1 and 0x7. Although it is
     // discouraged this check doesn't preclude the caller from setting
     // multiple flags concurrently.
@@ -419,12 +420,14 @@ Option4ClientFqdn::getRcode() const {
 
 void
 Option4ClientFqdn::setRcode(const Rcode& rcode) {
+    clearWireData();
     impl_->rcode1_ = rcode;
     impl_->rcode2_ = rcode;
 }
 
 void
 Option4ClientFqdn::resetFlags() {
+    clearWireData();
     impl_->flags_ = 0;
 }
 
@@ -470,11 +473,13 @@ Option4ClientFqdn::packDomainName(isc::util::OutputBuffer& buf) const {
 void
 Option4ClientFqdn::setDomainName(const std::string& domain_name,
                                  const DomainNameType domain_name_type) {
+    clearWireData();
     impl_->setDomainName(domain_name, domain_name_type);
 }
 
 void
 Option4ClientFqdn::resetDomainName() {
+    clearWireData();
     setDomainName("", PARTIAL);
 }
 
@@ -499,6 +504,7 @@ Option4ClientFqdn::pack(isc::util::OutputBuffer& buf) const {
 void
 Option4ClientFqdn::unpack(OptionBufferConstIter first,
                           OptionBufferConstIter last) {
+    clearWireData();
     setData(first, last);
     impl_->parseWireData(first, last);
     // Check that the flags in the received option are valid. Ignore MBZ bits,
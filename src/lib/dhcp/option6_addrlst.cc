@@ -48,6 +48,7 @@ Option6AddrLst::clone() const {
 
 void
 Option6AddrLst::setAddress(const isc::asiolink::IOAddress& addr) {
+    clearWireData();
     if (!addr.isV6()) {
         isc_throw(BadValue, "Can't store non-IPv6 address in Option6AddrLst option");
     }
@@ -58,6 +59,7 @@ Option6AddrLst::setAddress(const isc::asiolink::IOAddress& addr) {
 
 void
 Option6AddrLst::setAddresses(const AddressContainer& addrs) {
+    clearWireData();
     addrs_ = addrs;
 }
 
@@ -83,6 +85,7 @@ void Option6AddrLst::pack(isc::util::OutputBuffer& buf) const {
 
 void Option6AddrLst::unpack(OptionBufferConstIter begin,
                         OptionBufferConstIter end) {
+    clearWireData();
     if ((distance(begin, end) % V6ADDRESS_LEN) != 0) {
         isc_throw(OutOfRange, "Option " << type_
                   << " malformed: len=" << distance(begin, end)
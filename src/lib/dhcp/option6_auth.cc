@@ -92,6 +92,7 @@ Option6Auth::packHashInput(isc::util::OutputBuffer& buf) const {
 void
 Option6Auth::unpack(OptionBufferConstIter begin,
                      OptionBufferConstIter end) {
+    clearWireData();
    // throw if it contains length less than minimum size of the auth option
    if (distance(begin, end) < Option6Auth::OPTION6_AUTH_MIN_LEN) {
        isc_throw(OutOfRange, "Option " << type_ << " truncated");
@@ -326,6 +326,7 @@ Option6ClientFqdn::getFlag(const uint8_t flag) const {
 
 void
 Option6ClientFqdn::setFlag(const uint8_t flag, const bool set_flag) {
+    clearWireData();
     // Check that flag is in range between 0x1 and 0x7. Note that this
     // allows to set or clear multiple flags concurrently. Setting
     // concurrent bits is discouraged (see header file) but it is not
@@ -353,6 +354,7 @@ Option6ClientFqdn::setFlag(const uint8_t flag, const bool set_flag) {
 
 void
 Option6ClientFqdn::resetFlags() {
+    clearWireData();
     impl_->flags_ = 0;
 }
 
@@ -389,11 +391,13 @@ Option6ClientFqdn::packDomainName(isc::util::OutputBuffer& buf) const {
 void
 Option6ClientFqdn::setDomainName(const std::string& domain_name,
                                  const DomainNameType domain_name_type) {
+    clearWireData();
     impl_->setDomainName(domain_name, domain_name_type);
 }
 
 void
 Option6ClientFqdn::resetDomainName() {
+    clearWireData();
     setDomainName("", PARTIAL);
 }
 
@@ -415,6 +419,7 @@ Option6ClientFqdn::pack(isc::util::OutputBuffer& buf) const {
 void
 Option6ClientFqdn::unpack(OptionBufferConstIter first,
                           OptionBufferConstIter last) {
+    clearWireData();
     setData(first, last);
     impl_->parseWireData(first, last);
     // Check that the flags in the received option are valid. Ignore MBZ bits
@@ -70,6 +70,7 @@ void Option6IAAddr::pack(isc::util::OutputBuffer& buf) const {
 
 void Option6IAAddr::unpack(OptionBuffer::const_iterator begin,
                       OptionBuffer::const_iterator end) {
+    clearWireData();
     if ( distance(begin, end) < OPTION6_IAADDR_LEN) {
         isc_throw(OutOfRange, "Option " << type_ << " truncated");
     }
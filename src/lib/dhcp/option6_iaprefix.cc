@@ -73,6 +73,7 @@ void Option6IAPrefix::pack(isc::util::OutputBuffer& buf) const {
 
 void Option6IAPrefix::unpack(OptionBuffer::const_iterator begin,
                       OptionBuffer::const_iterator end) {
+    clearWireData();
     if ( distance(begin, end) < OPTION6_IAPREFIX_LEN) {
         isc_throw(OutOfRange, "Option " << type_ << " truncated");
     }
@@ -113,7 +113,11 @@ public:
     /// @param prefix prefix to be sent in this option
     /// @param length prefix length
     void setPrefix(const isc::asiolink::IOAddress& prefix,
-                   uint8_t length) { addr_ = prefix; prefix_len_ = length; }
+                   uint8_t length) {
+        clearWireData();
+        addr_ = prefix;
+        prefix_len_ = length;
+    }
 
     uint8_t getLength() const { return prefix_len_; }
 
@@ -147,6 +147,7 @@ Option6PDExclude::pack(isc::util::OutputBuffer& buf) const {
 void
 Option6PDExclude::unpack(OptionBufferConstIter begin,
                          OptionBufferConstIter end) {
+    clearWireData();
 
     // At this point we don't know the excluded prefix length, but the
     // minimum requirement is that reminder of this option includes the
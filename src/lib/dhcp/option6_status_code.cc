@@ -64,6 +64,7 @@ Option6StatusCode::pack(isc::util::OutputBuffer& buf) const {
 
 void
 Option6StatusCode::unpack(OptionBufferConstIter begin, OptionBufferConstIter end) {
+    clearWireData();
     // Make sure that the option is not truncated.
     if (std::distance(begin, end) < OPTION6_STATUS_CODE_MIN_LEN) {
         isc_throw(OutOfRange, "Status Code option ("
@@ -174,6 +175,7 @@ Option4SlpServiceScope::pack(isc::util::OutputBuffer& buf) const {
 
 void
 Option4SlpServiceScope::unpack(OptionBufferConstIter begin, OptionBufferConstIter end) {
+    clearWireData();
     // Make sure that the option is not truncated.
     if (std::distance(begin, end) < OPTION4_SLP_SERVICE_SCOPEMIN_LEN) {
         isc_throw(OutOfRange, "SLP Service Scope option ("
@@ -84,6 +84,7 @@ public:
     ///
     /// @param status_code New numeric status code.
     void setStatusCode(const uint16_t status_code) {
+        clearWireData();
         status_code_ = status_code;
     }
 
@@ -96,6 +97,7 @@ public:
     ///
     /// @param status_message New status message (empty string is allowed).
     void setStatusMessage(const std::string& status_message) {
+        clearWireData();
         status_message_ = status_message;
     }
 
@@ -178,6 +180,7 @@ public:
     ///
     /// @param mandatory_flag New numeric status code.
     void setMandatoryFlag(const bool mandatory_flag) {
+        clearWireData();
         mandatory_flag_ = mandatory_flag;
     }
 
@@ -190,6 +193,7 @@ public:
     ///
     /// @param scope_list New scope list (empty string is allowed).
     void setScopeList(std::string& scope_list) {
+        clearWireData();
         scope_list_ = scope_list;
     }
 
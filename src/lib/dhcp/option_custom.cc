@@ -49,6 +49,7 @@ OptionCustom::clone() const {
 
 void
 OptionCustom::addArrayDataField(const IOAddress& address) {
+    clearWireData();
     checkArrayType();
 
     if ((address.isV4() && definition_.getType() != OPT_IPV4_ADDRESS_TYPE) ||
@@ -66,6 +67,7 @@ OptionCustom::addArrayDataField(const IOAddress& address) {
 
 void
 OptionCustom::addArrayDataField(const std::string& value) {
+    clearWireData();
     checkArrayType();
 
     OpaqueDataTuple::LengthFieldType lft = getUniverse() == Option::V4 ?
@@ -77,6 +79,7 @@ OptionCustom::addArrayDataField(const std::string& value) {
 
 void
 OptionCustom::addArrayDataField(const OpaqueDataTuple& value) {
+    clearWireData();
     checkArrayType();
 
     OptionBuffer buf;
@@ -86,6 +89,7 @@ OptionCustom::addArrayDataField(const OpaqueDataTuple& value) {
 
 void
 OptionCustom::addArrayDataField(const bool value) {
+    clearWireData();
     checkArrayType();
 
     OptionBuffer buf;
@@ -96,6 +100,7 @@ OptionCustom::addArrayDataField(const bool value) {
 void
 OptionCustom::addArrayDataField(const PrefixLen& prefix_len,
                                 const asiolink::IOAddress& prefix) {
+    clearWireData();
     checkArrayType();
 
     if (definition_.getType() != OPT_IPV6_PREFIX_TYPE) {
@@ -110,6 +115,7 @@ OptionCustom::addArrayDataField(const PrefixLen& prefix_len,
 
 void
 OptionCustom::addArrayDataField(const PSIDLen& psid_len, const PSID& psid) {
+    clearWireData();
     checkArrayType();
 
     if (definition_.getType() != OPT_PSID_TYPE) {
@@ -496,6 +502,7 @@ OptionCustom::readAddress(const uint32_t index) const {
 void
 OptionCustom::writeAddress(const IOAddress& address,
                            const uint32_t index) {
+    clearWireData();
     checkIndex(index);
 
     if ((address.isV4() && buffers_[index].size() != V4ADDRESS_LEN) ||
@@ -520,6 +527,7 @@ OptionCustom::readBinary(const uint32_t index) const {
 void
 OptionCustom::writeBinary(const OptionBuffer& buf,
                           const uint32_t index) {
+    clearWireData();
     checkIndex(index);
     buffers_[index] = buf;
 }
@@ -541,6 +549,7 @@ OptionCustom::readTuple(OpaqueDataTuple& tuple,
 
 void
 OptionCustom::writeTuple(const std::string& value, const uint32_t index) {
+    clearWireData();
     checkIndex(index);
 
     buffers_[index].clear();
@@ -551,6 +560,7 @@ OptionCustom::writeTuple(const std::string& value, const uint32_t index) {
 
 void
 OptionCustom::writeTuple(const OpaqueDataTuple& value, const uint32_t index) {
+    clearWireData();
     checkIndex(index);
 
     buffers_[index].clear();
@@ -565,6 +575,7 @@ OptionCustom::readBoolean(const uint32_t index) const {
 
 void
 OptionCustom::writeBoolean(const bool value, const uint32_t index) {
+    clearWireData();
     checkIndex(index);
 
     buffers_[index].clear();
@@ -579,6 +590,7 @@ OptionCustom::readFqdn(const uint32_t index) const {
 
 void
 OptionCustom::writeFqdn(const std::string& fqdn, const uint32_t index) {
+    clearWireData();
     checkIndex(index);
 
     // Create a temporary buffer where the FQDN will be written.
@@ -604,6 +616,7 @@ void
 OptionCustom::writePrefix(const PrefixLen& prefix_len,
                           const IOAddress& prefix,
                           const uint32_t index) {
+    clearWireData();
     checkIndex(index);
 
     OptionBuffer buf;
@@ -623,6 +636,7 @@ OptionCustom::readPsid(const uint32_t index) const {
 void
 OptionCustom::writePsid(const PSIDLen& psid_len, const PSID& psid,
                         const uint32_t index) {
+    clearWireData();
     checkIndex(index);
 
     OptionBuffer buf;
@@ -641,6 +655,7 @@ OptionCustom::readString(const uint32_t index) const {
 
 void
 OptionCustom::writeString(const std::string& text, const uint32_t index) {
+    clearWireData();
     checkIndex(index);
 
     // Let's clear a buffer as we want to replace the value of the
@@ -657,6 +672,7 @@ OptionCustom::writeString(const std::string& text, const uint32_t index) {
 void
 OptionCustom::unpack(OptionBufferConstIter begin,
                      OptionBufferConstIter end) {
+    clearWireData();
     initialize(begin, end);
 }
 
@@ -130,6 +130,7 @@ public:
     ///
     /// @param value a value being added.
     void addValue(const T value) {
+        clearWireData();
         values_.push_back(value);
     }
 
@@ -182,6 +183,7 @@ public:
     /// equal to 1, 2 or 4 bytes. The data type is not checked in this function
     /// because it is checked in a constructor.
     virtual void unpack(OptionBufferConstIter begin, OptionBufferConstIter end) {
+        clearWireData();
         if (distance(begin, end) == 0) {
             isc_throw(OutOfRange, "option " << getType() << " empty");
         }
@@ -232,7 +234,7 @@ public:
     /// @brief Set option values.
     ///
     /// @param values collection of values to be set for option.
-    void setValues(const std::vector<T>& values) { values_ = values; }
+    void setValues(const std::vector<T>& values) { clearWireData(); values_ = values; }
 
     /// @brief returns complete length of option
     ///
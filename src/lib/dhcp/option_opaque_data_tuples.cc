@@ -45,6 +45,7 @@ OptionOpaqueDataTuples::pack(isc::util::OutputBuffer& buf) const {
 void
 OptionOpaqueDataTuples::unpack(OptionBufferConstIter begin,
                                OptionBufferConstIter end) {
+    clearWireData();
     if (std::distance(begin, end) < getMinimalLength() - getHeaderLen()) {
         isc_throw(OutOfRange, "parsed data tuples option data truncated to"
                   " size " << std::distance(begin, end));
@@ -64,6 +65,7 @@ OptionOpaqueDataTuples::unpack(OptionBufferConstIter begin,
 
 void
 OptionOpaqueDataTuples::addTuple(const OpaqueDataTuple& tuple) {
+    clearWireData();
     if (tuple.getLengthFieldType() != getLengthFieldType()) {
         isc_throw(isc::BadValue, "attempted to add opaque data tuple having"
                   " invalid size of the length field "
@@ -76,6 +78,7 @@ OptionOpaqueDataTuples::addTuple(const OpaqueDataTuple& tuple) {
 
 void
 OptionOpaqueDataTuples::setTuple(const size_t at, const OpaqueDataTuple& tuple) {
+    clearWireData();
     if (at >= getTuplesNum()) {
         isc_throw(isc::OutOfRange, "attempted to set an opaque data for the"
                   " opaque data tuple option at position " << at << " which"
@@ -43,6 +43,7 @@ OptionString::getValue() const {
 
 void
 OptionString::setValue(const std::string& value) {
+    clearWireData();
     // Sanity check that the string value is at least one byte long.
     // This is a requirement for all currently defined options which
     // carry a string value.
@@ -85,6 +86,7 @@ OptionString::pack(isc::util::OutputBuffer& buf) const {
 void
 OptionString::unpack(OptionBufferConstIter begin,
                      OptionBufferConstIter end) {
+    clearWireData();
     // Trim off trailing null(s)
     end = util::str::seekTrimmed(begin, end, 0x0);
     if (std::distance(begin, end) == 0) {
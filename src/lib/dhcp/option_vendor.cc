@@ -53,6 +53,7 @@ void OptionVendor::pack(isc::util::OutputBuffer& buf) const {
 
 void OptionVendor::unpack(OptionBufferConstIter begin,
                           OptionBufferConstIter end) {
+    clearWireData();
 
     // We throw SkipRemainingOptionsError so callers can
     // abandon further unpacking, if desired.
@@ -56,6 +56,7 @@ OptionVendorClass::pack(isc::util::OutputBuffer& buf) const {
 void
 OptionVendorClass::unpack(OptionBufferConstIter begin,
                           OptionBufferConstIter end) {
+    clearWireData();
     if (std::distance(begin, end) < getMinimalLength() - getHeaderLen()) {
         isc_throw(OutOfRange, "parsed Vendor Class option data truncated to"
                   " size " << std::distance(begin, end));
@@ -94,6 +95,7 @@ OptionVendorClass::unpack(OptionBufferConstIter begin,
 
 void
 OptionVendorClass::addTuple(const OpaqueDataTuple& tuple) {
+    clearWireData();
     if (tuple.getLengthFieldType() != getLengthFieldType()) {
         isc_throw(isc::BadValue, "attempted to add opaque data tuple having"
                   " invalid size of the length field "
@@ -106,6 +108,7 @@ OptionVendorClass::addTuple(const OpaqueDataTuple& tuple) {
 
 void
 OptionVendorClass::setTuple(const size_t at, const OpaqueDataTuple& tuple) {
+    clearWireData();
     if (at >= getTuplesNum()) {
         isc_throw(isc::OutOfRange, "attempted to set an opaque data for the"
                   " vendor option at position " << at << " which is out of"
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,6 +9,7 @@
 #include <dhcp/pkt.h>
 #include <dhcp/iface_mgr.h>
 #include <dhcp/hwaddr.h>
+#include <algorithm>
 #include <vector>
 
 namespace isc {
@@ -109,6 +110,42 @@ Pkt::updateTimestamp() {
     timestamp_ = boost::posix_time::microsec_clock::universal_time();
 }
 
+void
+Pkt::copyStageTimes(const Pkt& pkt) {
+    std::copy(pkt.stage_times_, pkt.stage_times_ + STAGE_COUNT, stage_times_);
+}
+
+std::string
+Pkt::stageToText(const Stage stage) {
+    switch (stage) {
+    case RECEIVED:
+        return ("received");
+    case DEQUEUED:
+        return ("dequeued");
+    case UNPACKED:
+        return ("unpacked");
+    case CLASSIFIED:
+        return ("classified");
+    case ACCEPTED:
+        return ("accepted");
+    case SUBNET_SELECTED:
+        return ("subnet-selected");
+    case HOSTS_LOOKED_UP:
+        return ("hosts-looked-up");
+    case LEASES_ALLOCATED:
+        return ("leases-allocated");
+    case PROCESSED:
+        return ("processed");
+    case PACKED:
+        return ("packed");
+    case SENT:
+        return ("sent");
+    default:
+        ;
+    }
+    return ("unknown");
+}
+
 void Pkt::repack() {
     if (!data_.empty()) {
         buffer_out_.writeData(&data_[0], data_.size());
@@ -9,6 +9,7 @@
 
 #include <asiolink/io_address.h>
 #include <util/buffer.h>
+#include <util/memory_arena.h>
 #include <dhcp/option.h>
 #include <dhcp/hwaddr.h>
 #include <dhcp/classify.h>
@@ -85,9 +86,36 @@ private:
 /// for derived classes representing both DHCPv4 and DHCPv6 messages.
 /// The @c Pkt4 and @c Pkt6 classes derive from it.
 ///
+/// Packets created while a @c isc::util::MemoryArenaScope is active are
+/// allocated from the per-packet arena.
+///
 /// @note This is abstract class. Please instantiate derived classes
 /// such as @c Pkt4 or @c Pkt6.
-class Pkt : public hooks::CalloutHandleAssociate {
+class Pkt : public hooks::CalloutHandleAssociate,
+            public isc::util::ArenaAllocatable {
+public:
+
+    /// @brief Stages of the processing of a query.
+    ///
+    /// The time each stage ends is stamped on the query by the server,
+    /// so the latency of each stage is the difference between its stamp
+    /// and the stamp of the previous stage which was reached. The
+    /// stages are listed in processing order.
+    enum Stage {
+        RECEIVED,           ///< Read from the socket.
+        DEQUEUED,           ///< Taken from the receive queue by the server.
+        UNPACKED,           ///< Buffer receive callouts called and unpacked.
+        CLASSIFIED,         ///< First pass of the classification done.
+        ACCEPTED,           ///< Checked and receive callouts called.
+        SUBNET_SELECTED,    ///< Subnet selected.
+        HOSTS_LOOKED_UP,    ///< Host reservations looked up.
+        LEASES_ALLOCATED,   ///< Leases allocated, renewed or released.
+        PROCESSED,          ///< Response built.
+        PACKED,             ///< Send callouts called and response packed.
+        SENT,               ///< Buffer send callouts called and sent.
+        STAGE_COUNT         ///< Number of stages, not a stage.
+    };
+
 protected:
 
     /// @brief Constructor.
@@ -404,6 +432,46 @@ public:
         timestamp_ = timestamp;
     }
 
+    /// @brief Stamps the end of a processing stage with the current time.
+    ///
+    /// A stage already stamped gets the new time.
+    ///
+    /// @param stage the processing stage.
+    void markStage(const Stage stage) {
+        stage_times_[stage] = boost::posix_time::microsec_clock::universal_time();
+    }
+
+    /// @brief Stamps the end of a processing stage with a given time.
+    ///
+    /// @param stage the processing stage.
+    /// @param time the time the stage ended.
+    void markStage(const Stage stage, const boost::posix_time::ptime& time) {
+        stage_times_[stage] = time;
+    }
+
+    /// @brief Returns the time a processing stage ended.
+    ///
+    /// @param stage the processing stage.
+    /// @return the time stamped for the stage, not_a_date_time if the
+    /// stage was not reached.
+    const boost::posix_time::ptime& getStageTime(const Stage stage) const {
+        return (stage_times_[stage]);
+    }
+
+    /// @brief Copies the processing stage stamps of another packet.
+    ///
+    /// The responses get the stamps of their queries so the latency of
+    /// the whole processing can be recorded when they are sent.
+    ///
+    /// @param pkt the packet whose stamps are copied.
+    void copyStageTimes(const Pkt& pkt);
+
+    /// @brief Returns the name of a processing stage.
+    ///
+    /// @param stage the processing stage.
+    /// @return the name of the stage, e.g. "subnet-selected".
+    static std::string stageToText(const Stage stage);
+
     /// @brief Copies content of input buffer to output buffer.
     ///
     /// This is mostly a diagnostic function. It is being used for sending
@@ -772,6 +840,9 @@ protected:
     /// packet timestamp
     boost::posix_time::ptime timestamp_;
 
+    /// @brief Times the processing stages ended, by stage.
+    boost::posix_time::ptime stage_times_[STAGE_COUNT];
+
     // remote HW address (src if receiving packet, dst if sending packet)
     HWAddrPtr remote_hwaddr_;
 
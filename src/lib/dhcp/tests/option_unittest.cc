@@ -635,4 +635,63 @@ TEST_F(OptionTest, createPayload) {
     EXPECT_EQ(buf_, option->getData());
 }
 
+// This test verifies that the cached wire data is used to pack the option
+// and that it is discarded when the option is modified.
+TEST_F(OptionTest, cacheWireData) {
+    OptionPtr option(new Option(Option::V4, 123, buf_.begin(),
+                                buf_.begin() + 4));
+    OptionPtr sub(new Option(Option::V4, 1));
+    option->addOption(sub);
+    EXPECT_FALSE(option->hasWireData());
+
+    OutputBuffer expected(0);
+    option->pack(expected);
+
+    option->cacheWireData();
+    ASSERT_TRUE(option->hasWireData());
+
+    OutputBuffer cached(0);
+    option->packCached(cached);
+    ASSERT_EQ(expected.getLength(), cached.getLength());
+    EXPECT_EQ(0, memcmp(expected.getData(), cached.getData(),
+                        expected.getLength()));
+
+    // Modifying the option discards the cache.
+    option->setUint8(1);
+    EXPECT_FALSE(option->hasWireData());
+
+    option->cacheWireData();
+    option->delOption(1);
+    EXPECT_FALSE(option->hasWireData());
+
+    // The option is packed as usual without the cache.
+    OutputBuffer packed(0);
+    option->packCached(packed);
+    EXPECT_EQ(option->len(), packed.getLength());
+}
+
+// This test verifies that the cached wire data is discarded when a
+// sub-option or an option of a derived class is modified.
+TEST_F(OptionTest, cacheWireDataModified) {
+    OptionPtr option(new Option(Option::V4, 123));
+    boost::shared_ptr<OptionInt<uint8_t> >
+        sub(new OptionInt<uint8_t>(Option::V4, 1, 10));
+    option->addOption(sub);
+
+    option->cacheWireData();
+    ASSERT_TRUE(option->hasWireData());
+    ASSERT_TRUE(sub->hasWireData());
+
+    // Modify the sub-option using the setter of the derived class.
+    sub->setValue(20);
+    EXPECT_FALSE(sub->hasWireData());
+    EXPECT_FALSE(option->hasWireData());
+
+    // The new value is packed.
+    OutputBuffer packed(0);
+    option->packCached(packed);
+    ASSERT_EQ(5, packed.getLength());
+    EXPECT_EQ(20, packed[4]);
+}
+
 }
@@ -836,6 +836,35 @@ TEST_F(Pkt4Test, Timestamp) {
     EXPECT_TRUE(ts_period.length().total_microseconds() >= 0);
 }
 
+// Checks that the processing stages are stamped and copied.
+TEST_F(Pkt4Test, stageTimes) {
+    scoped_ptr<Pkt4> pkt(new Pkt4(DHCPDISCOVER, 1234));
+
+    // No stage is stamped after construction.
+    for (int i = 0; i < Pkt::STAGE_COUNT; ++i) {
+        EXPECT_TRUE(pkt->getStageTime(static_cast<Pkt::Stage>(i)).is_not_a_date_time());
+    }
+
+    pkt->updateTimestamp();
+    pkt->markStage(Pkt::RECEIVED, pkt->getTimestamp());
+    pkt->markStage(Pkt::SUBNET_SELECTED);
+    EXPECT_EQ(pkt->getTimestamp(), pkt->getStageTime(Pkt::RECEIVED));
+    ASSERT_FALSE(pkt->getStageTime(Pkt::SUBNET_SELECTED).is_not_a_date_time());
+    EXPECT_GE(pkt->getStageTime(Pkt::SUBNET_SELECTED), pkt->getTimestamp());
+    EXPECT_TRUE(pkt->getStageTime(Pkt::DEQUEUED).is_not_a_date_time());
+
+    // The response gets the stamps of the query.
+    scoped_ptr<Pkt4> rsp(new Pkt4(DHCPOFFER, 1234));
+    rsp->copyStageTimes(*pkt);
+    EXPECT_EQ(pkt->getStageTime(Pkt::RECEIVED), rsp->getStageTime(Pkt::RECEIVED));
+    EXPECT_EQ(pkt->getStageTime(Pkt::SUBNET_SELECTED),
+              rsp->getStageTime(Pkt::SUBNET_SELECTED));
+    EXPECT_TRUE(rsp->getStageTime(Pkt::SENT).is_not_a_date_time());
+
+    EXPECT_EQ("subnet-selected", Pkt::stageToText(Pkt::SUBNET_SELECTED));
+    EXPECT_EQ("sent", Pkt::stageToText(Pkt::SENT));
+}
+
 TEST_F(Pkt4Test, hwaddr) {
     scoped_ptr<Pkt4> pkt(new Pkt4(DHCPOFFER, 1234));
     const uint8_t hw[] = { 2, 4, 6, 8, 10, 12 }; // MAC
@@ -0,0 +1,197 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <asiolink/io_service.h>
+#include <dhcp_ddns/ncr_udp.h>
+
+#include <benchmark/benchmark.h>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <sstream>
+
+using namespace isc::asiolink;
+using namespace isc::dhcp_ddns;
+
+namespace {
+
+/// @brief A minimum number of NameChangeRequests used in a benchmark.
+constexpr size_t MIN_NCR_COUNT = 512;
+
+/// @brief A maximum number of NameChangeRequests used in a benchmark.
+constexpr size_t MAX_NCR_COUNT = 32768;
+
+/// @brief A time unit used - all results to be expressed in us (microseconds)
+constexpr benchmark::TimeUnit UNIT = benchmark::kMicrosecond;
+
+/// @brief Address the sender and the listener are bound to.
+const char* BENCH_ADDRESS = "127.0.0.1";
+
+/// @brief Port the listener is bound to.
+const uint32_t BENCH_LISTENER_PORT = 5311;
+
+/// @brief Port the sender is bound to.
+const uint32_t BENCH_SENDER_PORT = BENCH_LISTENER_PORT + 1;
+
+/// @brief Time after which the requests still missing are considered lost.
+const long BENCH_IDLE_TIMEOUT_MS = 200;
+
+/// @brief This is a fixture class used for benchmarking the delivery of
+/// the NameChangeRequests from a DHCP server to D2 over UDP loopback.
+///
+/// The sender and the listener are run by the same IO service, as the
+/// requests are first queued and then sent as fast as possible. The
+/// requests dropped by the kernel are reported in the lost counter.
+class NcrUdpBenchmark : public ::benchmark::Fixture,
+                        public NameChangeListener::RequestReceiveHandler,
+                        public NameChangeSender::RequestSendHandler {
+public:
+    /// @brief Constructor.
+    NcrUdpBenchmark() : received_(0) {
+    }
+
+    /// @brief Receive handler counting the received requests.
+    virtual void operator()(const NameChangeListener::Result result,
+                            NameChangeRequestPtr&) {
+        if (result == NameChangeListener::SUCCESS) {
+            ++received_;
+        }
+    }
+
+    /// @brief Batch receive handler counting the received requests.
+    virtual void receiveBatch(const NameChangeListener::Result result,
+                              std::vector<NameChangeRequestPtr>& ncrs) {
+        if (result == NameChangeListener::SUCCESS) {
+            received_ += ncrs.size();
+        }
+    }
+
+    /// @brief Send handler, the outcome is checked on the listener side.
+    virtual void operator()(const NameChangeSender::Result,
+                            NameChangeRequestPtr&) {
+    }
+
+    /// @brief Creates the requests to send.
+    ///
+    /// @param ncr_count number of requests.
+    void createRequests(const size_t ncr_count) {
+        ncrs_.clear();
+        for (size_t i = 0; i < ncr_count; ++i) {
+            std::ostringstream fqdn;
+            fqdn << "host-" << i << ".example.com.";
+            NameChangeRequestPtr ncr(new NameChangeRequest());
+            ncr->setChangeType(i % 2 ? CHG_REMOVE : CHG_ADD);
+            ncr->setForwardChange(true);
+            ncr->setReverseChange(true);
+            ncr->setFqdn(fqdn.str());
+            ncr->setIpAddress("192.0.2.1");
+            ncr->setDhcid("010203040A7F8E3D");
+            ncr->setLeaseExpiresOn("20190121132405");
+            ncr->setLeaseLength(3600);
+            ncrs_.push_back(ncr);
+        }
+    }
+
+    /// @brief Sends the requests and waits until they are received or lost.
+    ///
+    /// @param format wire format used by the sender.
+    void sendRequests(const NameChangeFormat format) {
+        IOService io_service;
+        IOAddress address(BENCH_ADDRESS);
+        // The listener recognizes the binary format in JSON mode, as D2 does.
+        NameChangeUDPListener listener(address, BENCH_LISTENER_PORT, FMT_JSON,
+                                       *this, true);
+        NameChangeUDPSender sender(address, BENCH_SENDER_PORT, address,
+                                   BENCH_LISTENER_PORT, format, *this,
+                                   ncrs_.size(), true);
+        listener.startListening(io_service);
+        sender.startSending(io_service);
+
+        received_ = 0;
+        for (auto ncr = ncrs_.begin(); ncr != ncrs_.end(); ++ncr) {
+            sender.sendRequest(*ncr);
+        }
+
+        boost::posix_time::ptime last_progress =
+            boost::posix_time::microsec_clock::universal_time();
+        while (received_ < ncrs_.size()) {
+            if (io_service.get_io_service().poll() > 0) {
+                last_progress =
+                    boost::posix_time::microsec_clock::universal_time();
+            } else if ((sender.getQueueSize() == 0) &&
+                       ((boost::posix_time::microsec_clock::universal_time() -
+                         last_progress).total_milliseconds() >
+                        BENCH_IDLE_TIMEOUT_MS)) {
+                break;
+            }
+        }
+
+        sender.stopSending();
+        listener.stopListening();
+        io_service.get_io_service().poll();
+
+        lost_ += ncrs_.size() - received_;
+        delivered_ += received_;
+    }
+
+    /// @brief Reports the counters.
+    ///
+    /// @param state benchmark state.
+    void report(::benchmark::State& state) {
+        state.SetItemsProcessed(delivered_);
+        state.counters["lost"] = lost_;
+    }
+
+    /// @brief Requests to send.
+    std::vector<NameChangeRequestPtr> ncrs_;
+
+    /// @brief Number of requests received in the current iteration.
+    size_t received_;
+
+    /// @brief Total number of delivered requests.
+    size_t delivered_ = 0;
+
+    /// @brief Total number of lost requests.
+    size_t lost_ = 0;
+};
+
+/// Defines steps necessary for conducting a benchmark that measures
+/// the delivery of requests sent one per datagram in JSON.
+BENCHMARK_DEFINE_F(NcrUdpBenchmark, sendJSON)(benchmark::State& state) {
+    const size_t ncr_count = state.range(0);
+    createRequests(ncr_count);
+    delivered_ = lost_ = 0;
+    while (state.KeepRunning()) {
+        sendRequests(FMT_JSON);
+    }
+    report(state);
+}
+
+/// Defines steps necessary for conducting a benchmark that measures
+/// the delivery of requests packed in datagrams in the binary format.
+BENCHMARK_DEFINE_F(NcrUdpBenchmark, sendBinary)(benchmark::State& state) {
+    const size_t ncr_count = state.range(0);
+    createRequests(ncr_count);
+    delivered_ = lost_ = 0;
+    while (state.KeepRunning()) {
+        sendRequests(FMT_BINARY);
+    }
+    report(state);
+}
+
+/// Defines parameters necessary for running a benchmark that measures
+/// the delivery of requests sent one per datagram in JSON.
+BENCHMARK_REGISTER_F(NcrUdpBenchmark, sendJSON)
+    ->Range(MIN_NCR_COUNT, MAX_NCR_COUNT)->Unit(UNIT);
+
+/// Defines parameters necessary for running a benchmark that measures
+/// the delivery of requests packed in datagrams in the binary format.
+BENCHMARK_REGISTER_F(NcrUdpBenchmark, sendBinary)
+    ->Range(MIN_NCR_COUNT, MAX_NCR_COUNT)->Unit(UNIT);
+
+}  // namespace
@@ -0,0 +1,22 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <benchmark/benchmark.h>
+#include <log/logger_support.h>
+
+/// @brief A simple class that initializes logging.
+class Initializer {
+public:
+    Initializer() {
+        isc::log::initLogger();
+    }
+};
+
+Initializer initializer;
+
+BENCHMARK_MAIN();
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2017,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -116,6 +116,25 @@ NameChangeListener::invokeRecvHandler(const Result result,
                   .arg(ex.what());
     }
 
+    receiveNextAfterHandler();
+}
+
+void
+NameChangeListener::invokeRecvHandler(const Result result,
+                                      std::vector<NameChangeRequestPtr>& ncrs) {
+    try {
+        io_pending_ = false;
+        recv_handler_.receiveBatch(result, ncrs);
+    } catch (const std::exception& ex) {
+        LOG_ERROR(dhcp_ddns_logger, DHCP_DDNS_UNCAUGHT_NCR_RECV_HANDLER_ERROR)
+                  .arg(ex.what());
+    }
+
+    receiveNextAfterHandler();
+}
+
+void
+NameChangeListener::receiveNextAfterHandler() {
     // Start the next IO layer asynchronous receive.
     // In the event the handler above intervened and decided to stop listening
     // we need to check that first.
@@ -154,7 +173,7 @@ NameChangeListener::invokeRecvHandler(const Result result,
 NameChangeSender::NameChangeSender(RequestSendHandler& send_handler,
                                    size_t send_queue_max)
     : sending_(false), send_handler_(send_handler),
-      send_queue_max_(send_queue_max), io_service_(NULL) {
+      send_queue_max_(send_queue_max), batch_size_(1), io_service_(NULL) {
 
     // Queue size must be big enough to hold at least 1 entry.
     setQueueMaxSize(send_queue_max);
@@ -261,6 +280,7 @@ NameChangeSender::sendNext() {
        // handler need to cycle thru open/close ?
 
        // Call implementation dependent send.
+       batch_size_ = 1;
        doSend(ncr_to_send_);
     }
 }
@@ -268,10 +288,17 @@ NameChangeSender::sendNext() {
 void
 NameChangeSender::invokeSendHandler(const NameChangeSender::Result result) {
     // @todo reset defense timer
+    std::vector<NameChangeRequestPtr> batch;
     if (result == SUCCESS) {
-        // It shipped so pull it off the queue.
+        // It shipped so pull it off the queue, with the requests which
+        // were packed with it.
         send_queue_.pop_front();
+        for (size_t i = 1; (i < batch_size_) && !send_queue_.empty(); ++i) {
+            batch.push_back(send_queue_.front());
+            send_queue_.pop_front();
+        }
     }
+    batch_size_ = 1;
 
     // Invoke the completion handler passing in the result and a pointer
     // the request involved.
@@ -285,6 +312,16 @@ NameChangeSender::invokeSendHandler(const NameChangeSender::Result result) {
                   .arg(ex.what());
     }
 
+    for (auto ncr = batch.begin(); ncr != batch.end(); ++ncr) {
+        try {
+            send_handler_(result, *ncr);
+        } catch (const std::exception& ex) {
+            LOG_ERROR(dhcp_ddns_logger,
+                      DHCP_DDNS_UNCAUGHT_NCR_SEND_HANDLER_ERROR)
+                      .arg(ex.what());
+        }
+    }
+
     // Clear the pending ncr pointer.
     ncr_to_send_.reset();
 
@@ -316,6 +353,16 @@ NameChangeSender::invokeSendHandler(const NameChangeSender::Result result) {
     }
 }
 
+void
+NameChangeSender::setBatchSize(const size_t batch_size) {
+    if ((batch_size == 0) || (batch_size > send_queue_.size())) {
+        isc_throw(NcrSenderError, "NameChangeSender: invalid batch size "
+                  << batch_size << ", queue size: " << send_queue_.size());
+    }
+
+    batch_size_ = batch_size;
+}
+
 void
 NameChangeSender::skipNext() {
     if (!send_queue_.empty()) {
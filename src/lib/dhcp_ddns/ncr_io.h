@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2017,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -54,6 +54,7 @@
 #include <exceptions/exceptions.h>
 
 #include <deque>
+#include <vector>
 
 namespace isc {
 namespace dhcp_ddns {
@@ -194,6 +195,26 @@ public:
         virtual void operator ()(const Result result,
                                  NameChangeRequestPtr& ncr) = 0;
 
+        /// @brief NCR batch receive callback.
+        ///
+        /// This method is invoked when several NameChangeRequests were
+        /// received at once, e.g. packed in a single datagram in the
+        /// binary format. The default implementation hands them off one
+        /// at a time to the function operator: applications able to
+        /// queue requests in bulk should override it.
+        ///
+        /// @param result contains that receive outcome status, always
+        /// NameChangeListener::SUCCESS.
+        /// @param ncrs contains the received NameChangeRequests in the
+        /// order they were sent.
+        /// @throw This method MUST NOT throw.
+        virtual void receiveBatch(const Result result,
+                                  std::vector<NameChangeRequestPtr>& ncrs) {
+            for (auto ncr = ncrs.begin(); ncr != ncrs.end(); ++ncr) {
+                (*this)(result, *ncr);
+            }
+        }
+
         virtual ~RequestReceiveHandler() {
         }
     };
@@ -265,6 +286,17 @@ protected:
     /// wise.
     void invokeRecvHandler(const Result result, NameChangeRequestPtr& ncr);
 
+    /// @brief Calls the NCR batch receive handler registered with the
+    /// listener.
+    ///
+    /// This is the equivalent of @ref invokeRecvHandler for the
+    /// derivations receiving several requests at once.
+    ///
+    /// @param result contains that receive outcome status.
+    /// @param ncrs contains the newly received NameChangeRequests.
+    void invokeRecvHandler(const Result result,
+                           std::vector<NameChangeRequestPtr>& ncrs);
+
     /// @brief Abstract method which opens the IO source for reception.
     ///
     /// The derivation uses this method to perform the steps needed to
@@ -330,6 +362,11 @@ private:
         listening_ = value;
     }
 
+    /// @brief Starts the next receive after the handler was invoked.
+    ///
+    /// Shared tail of the @ref invokeRecvHandler variants.
+    void receiveNextAfterHandler();
+
     /// @brief Indicates if the listener is in listening mode.
     bool listening_;
 
@@ -610,6 +647,20 @@ protected:
     /// @param result contains that send outcome status.
     void invokeSendHandler(const NameChangeSender::Result result);
 
+    /// @brief Sets the number of requests carried by the send in progress.
+    ///
+    /// Derivations packing the requests following the one passed to
+    /// doSend into the same message call this method from doSend so that
+    /// a successful send removes them all from the queue and reports each
+    /// of them to the send completion handler. It is reset to one before
+    /// each send.
+    ///
+    /// @param batch_size number of requests from the front of the queue
+    /// carried by the send, including the one passed to doSend.
+    ///
+    /// @throw NcrSenderError if the value is zero or exceeds the queue size.
+    void setBatchSize(const size_t batch_size);
+
     /// @brief Abstract method which opens the IO sink for transmission.
     ///
     /// The derivation uses this method to perform the steps needed to
@@ -766,6 +817,9 @@ private:
     /// @brief Pointer to the request which is in the process of being sent.
     NameChangeRequestPtr ncr_to_send_;
 
+    /// @brief Number of requests carried by the send in progress.
+    size_t batch_size_;
+
     /// @brief Pointer to the IOService currently being used by the sender.
     /// @note We need to remember the io_service but we receive it by
     /// reference.  Use a raw pointer to store it.  This value should never be
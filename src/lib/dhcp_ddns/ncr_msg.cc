@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2016,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -29,6 +29,10 @@ NameChangeFormat stringToNcrFormat(const std::string& fmt_str) {
         return FMT_JSON;
     }
 
+    if (boost::iequals(fmt_str, "BINARY")) {
+        return FMT_BINARY;
+    }
+
     isc_throw(BadValue, "Invalid NameChangeRequest format: " << fmt_str);
 }
 
@@ -38,6 +42,10 @@ std::string ncrFormatToString(NameChangeFormat format) {
         return ("JSON");
     }
 
+    if (format == FMT_BINARY) {
+        return ("BINARY");
+    }
+
     std::ostringstream stream;
     stream  << "UNKNOWN(" << format << ")";
     return (stream.str());
@@ -255,6 +263,21 @@ NameChangeRequest::fromFormat(const NameChangeFormat format,
                       << ex.what());
         }
 
+        break;
+        }
+    case FMT_BINARY: {
+        std::vector<uint8_t> vec;
+        try {
+            // Get the binary rendition, prefixed by its length.
+            size_t len = buffer.readUint16();
+            buffer.readVector(vec, len);
+        } catch (isc::util::InvalidBufferPosition& ex) {
+            // Read error accessing data in InputBuffer.
+            isc_throw(NcrMessageError, "fromFormat: buffer read error: "
+                      << ex.what());
+        }
+
+        ncr = NameChangeRequest::fromBinary(vec);
         break;
         }
     default:
@@ -283,6 +306,14 @@ NameChangeRequest::toFormat(const NameChangeFormat format,
         buffer.writeData(json.c_str(), length);
         break;
         }
+    case FMT_BINARY: {
+        // Reserve the length and fill it once the rendition is written.
+        size_t start = buffer.getLength();
+        buffer.writeUint16(0);
+        toBinary(buffer);
+        buffer.writeUint16At(buffer.getLength() - start - 2, start);
+        break;
+        }
     default:
         // Programmatic error, shouldn't happen.
         isc_throw(NcrMessageError, "toFormat - invalid format");
@@ -373,6 +404,88 @@ NameChangeRequest::toJSON() const  {
 }
 
 
+const uint8_t NameChangeRequest::BINARY_FORMAT_MARKER;
+
+NameChangeRequestPtr
+NameChangeRequest::fromBinary(const std::vector<uint8_t>& data) {
+    NameChangeRequestPtr ncr(new NameChangeRequest());
+    try {
+        isc::util::InputBuffer buffer(data.empty() ? NULL : &data[0],
+                                      data.size());
+
+        uint8_t marker = buffer.readUint8();
+        if (marker != BINARY_FORMAT_MARKER) {
+            isc_throw(NcrMessageError, "Unsupported binary NameChangeRequest"
+                      " version: " << static_cast<int>(marker));
+        }
+
+        uint8_t change_type = buffer.readUint8();
+        if ((change_type != CHG_ADD) && (change_type != CHG_REMOVE)) {
+            isc_throw(NcrMessageError,
+                      "Invalid data value for change_type: "
+                      << static_cast<int>(change_type));
+        }
+        ncr->setChangeType(static_cast<NameChangeType>(change_type));
+
+        uint8_t flags = buffer.readUint8();
+        ncr->setForwardChange(flags & 0x01);
+        ncr->setReverseChange(flags & 0x02);
+
+        std::vector<uint8_t> vec;
+        buffer.readVector(vec, buffer.readUint16());
+        ncr->setFqdn(std::string(vec.begin(), vec.end()));
+
+        uint8_t addr_len = buffer.readUint8();
+        if ((addr_len != 4) && (addr_len != 16)) {
+            isc_throw(NcrMessageError, "Invalid ip address length: "
+                      << static_cast<int>(addr_len));
+        }
+        buffer.readVector(vec, addr_len);
+        ncr->ip_io_address_ = asiolink::IOAddress::
+            fromBytes(addr_len == 4 ? AF_INET : AF_INET6, &vec[0]);
+
+        buffer.readVector(vec, buffer.readUint16());
+        ncr->dhcid_.fromBytes(vec);
+
+        uint64_t expires_on = buffer.readUint32();
+        expires_on = (expires_on << 32) | buffer.readUint32();
+        ncr->lease_expires_on_ = expires_on;
+        ncr->setLeaseLength(buffer.readUint32());
+
+        if (buffer.getPosition() != buffer.getLength()) {
+            isc_throw(NcrMessageError, "Binary NameChangeRequest has "
+                      << (buffer.getLength() - buffer.getPosition())
+                      << " trailing bytes");
+        }
+    } catch (const isc::util::InvalidBufferPosition& ex) {
+        isc_throw(NcrMessageError, "Truncated binary NameChangeRequest: "
+                  << ex.what());
+    }
+
+    ncr->validateContent();
+    return (ncr);
+}
+
+void
+NameChangeRequest::toBinary(isc::util::OutputBuffer& buffer) const {
+    buffer.writeUint8(BINARY_FORMAT_MARKER);
+    buffer.writeUint8(static_cast<uint8_t>(change_type_));
+    buffer.writeUint8((forward_change_ ? 0x01 : 0) |
+                      (reverse_change_ ? 0x02 : 0));
+    buffer.writeUint16(fqdn_.size());
+    buffer.writeData(fqdn_.c_str(), fqdn_.size());
+    const std::vector<uint8_t>& addr = ip_io_address_.toBytes();
+    buffer.writeUint8(addr.size());
+    buffer.writeData(&addr[0], addr.size());
+    const std::vector<uint8_t>& dhcid = dhcid_.getBytes();
+    buffer.writeUint16(dhcid.size());
+    if (!dhcid.empty()) {
+        buffer.writeData(&dhcid[0], dhcid.size());
+    }
+    buffer.writeUint64(lease_expires_on_);
+    buffer.writeUint32(lease_length_);
+}
+
 void
 NameChangeRequest::validateContent() {
     //@todo This is an initial implementation which provides a minimal amount
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2017,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -58,13 +58,14 @@ enum NameChangeStatus  {
 
 /// @brief Defines the list of data wire formats supported.
 enum NameChangeFormat {
-  FMT_JSON
+  FMT_JSON,
+  FMT_BINARY
 };
 
 /// @brief Function which converts labels to  NameChangeFormat enum values.
 ///
 /// @param fmt_str text to convert to an enum.
-/// Valid string values: "JSON"
+/// Valid string values: "JSON", "BINARY"
 ///
 /// @return NameChangeFormat value which maps to the given string.
 ///
@@ -138,6 +139,13 @@ public:
     /// or there is an odd number of digits.
     void fromStr(const std::string& data);
 
+    /// @brief Sets the DHCID value.
+    ///
+    /// @param data is the DHCID value.
+    void fromBytes(const std::vector<uint8_t>& data) {
+        bytes_ = data;
+    }
+
     /// @brief Sets the DHCID value based on the Client Identifier.
     ///
     /// @param clientid_data Holds the raw bytes representing client identifier.
@@ -272,7 +280,9 @@ public:
     /// is than treated as JSON which is then parsed into the data needed
     /// to create a request instance.
     ///
-    /// (NOTE currently only JSON is supported.)
+    /// BINARY: The buffer is expected to contain a two byte unsigned integer
+    /// which specifies the length of the binary rendition of the request,
+    /// followed by the rendition itself, described under @ref toBinary.
     ///
     /// @param format indicates the data format to use
     /// @param buffer is the input buffer containing the marshalled request
@@ -297,7 +307,13 @@ public:
     /// is identical that described under
     /// isc::dhcp_ddns::NameChangeRequest::fromJSON
     ///
-    /// (NOTE currently only JSON is supported.)
+    /// BINARY: Upon completion, the buffer will contain a two byte unsigned
+    /// integer which specifies the length of the binary rendition of the
+    /// request, followed by the rendition itself, described under
+    /// @ref toBinary.
+    ///
+    /// In both formats, several requests can be marshalled one after the
+    /// other in the same buffer.
     ///
     /// @param format indicates the data format to use
     /// @param buffer is the output buffer to which the request should be
@@ -403,6 +419,40 @@ public:
     /// @return a string containing the JSON rendition of the request
     std::string toJSON() const;
 
+    /// @brief First byte of the binary rendition of a request.
+    ///
+    /// It identifies the version of the binary format and can't be mistaken
+    /// for the opening bracket of the JSON rendition.
+    static const uint8_t BINARY_FORMAT_MARKER = 0xB1;
+
+    /// @brief Static method for creating a NameChangeRequest from its
+    /// binary rendition.
+    ///
+    /// @param data is the binary rendition, without its length.
+    ///
+    /// @return a pointer to the new NameChangeRequest
+    ///
+    /// @throw NcrMessageError if the rendition is truncated or the request
+    /// is invalid.
+    static NameChangeRequestPtr fromBinary(const std::vector<uint8_t>& data);
+
+    /// @brief Instance method for marshalling the contents of the request
+    /// into its compact binary rendition.
+    ///
+    /// The rendition consists of, in network byte order:
+    /// - the @c BINARY_FORMAT_MARKER byte,
+    /// - the change type on one byte,
+    /// - a byte of flags: 1 for the forward change, 2 for the reverse change,
+    /// - the length of the FQDN on two bytes followed by its text,
+    /// - the length of the IP address (4 or 16) on one byte followed by
+    ///   the address,
+    /// - the length of the DHCID on two bytes followed by the DHCID,
+    /// - the lease expiration time on eight bytes,
+    /// - the lease length on four bytes.
+    ///
+    /// @param buffer is the output buffer the rendition is appended to.
+    void toBinary(isc::util::OutputBuffer& buffer) const;
+
     /// @brief Validates the content of a populated request.  This method is
     /// used by both the full constructor and from-wire marshalling to ensure
     /// that the request is content valid.  Currently it enforces the
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2017,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -11,6 +11,9 @@
 
 #include <boost/bind.hpp>
 
+#include <algorithm>
+#include <vector>
+
 namespace isc {
 namespace dhcp_ddns {
 
@@ -154,21 +157,63 @@ NameChangeUDPListener::receiveCompletionHandler(const bool successful,
     Result result = SUCCESS;
 
     if (successful) {
-        // Make an InputBuffer from our internal array
-        isc::util::InputBuffer input_buffer(callback->getData(),
-                                            callback->getBytesTransferred());
+        // A datagram carries either one JSON request or one or more
+        // binary requests, each prefixed by its length.
+        std::vector<NameChangeRequestPtr> ncrs;
+        const uint8_t* data = callback->getData();
+        const size_t length = callback->getBytesTransferred();
+        size_t pos = 0;
+        while (pos < length) {
+            // The binary requests are recognized by their marker whatever
+            // the configured format, so a listener configured for JSON
+            // accepts them too.
+            NameChangeFormat format = format_;
+            if ((length - pos > 2) &&
+                (data[pos + 2] == NameChangeRequest::BINARY_FORMAT_MARKER)) {
+                format = FMT_BINARY;
+            } else if (pos > 0) {
+                // Anything following the requests is ignored as it always
+                // was after a JSON request.
+                break;
+            }
 
-        try {
-            ncr = NameChangeRequest::fromFormat(format_, input_buffer);
-        } catch (const NcrMessageError& ex) {
-            // log it and go back to listening
-            LOG_ERROR(dhcp_ddns_logger, DHCP_DDNS_INVALID_NCR).arg(ex.what());
+            size_t record_len = length - pos;
+            if (record_len >= 2) {
+                record_len = std::min(record_len,
+                                      2 + ((static_cast<size_t>(data[pos]) << 8) |
+                                           data[pos + 1]));
+            }
+
+            // Make an InputBuffer from our internal array
+            isc::util::InputBuffer input_buffer(data + pos, record_len);
+            try {
+                ncrs.push_back(NameChangeRequest::fromFormat(format,
+                                                             input_buffer));
+            } catch (const NcrMessageError& ex) {
+                // log it and skip the request
+                LOG_ERROR(dhcp_ddns_logger, DHCP_DDNS_INVALID_NCR).arg(ex.what());
+            }
+
+            if (format != FMT_BINARY) {
+                break;
+            }
+            pos += record_len;
+        }
 
+        if (ncrs.empty()) {
             // Queue up the next receive.
             // NOTE: We must call the base class, NEVER doReceive
             receiveNext();
             return;
         }
+
+        if (ncrs.size() > 1) {
+            // Hand off the whole batch to the application at once.
+            invokeRecvHandler(result, ncrs);
+            return;
+        }
+
+        ncr = ncrs[0];
     } else {
         boost::system::error_code error_code = callback->getErrorCode();
         if (error_code.value() == boost::asio::error::operation_aborted) {
@@ -289,6 +334,21 @@ NameChangeUDPSender::doSend(NameChangeRequestPtr& ncr) {
     isc::util::OutputBuffer ncr_buffer(SEND_BUF_MAX);
     ncr->toFormat(format_, ncr_buffer);
 
+    // Binary requests are length prefixed: pack the following queued
+    // requests into the same datagram as long as they fit.
+    if (format_ == FMT_BINARY) {
+        size_t count = 1;
+        for (; count < getQueueSize(); ++count) {
+            const size_t length = ncr_buffer.getLength();
+            peekAt(count)->toFormat(format_, ncr_buffer);
+            if (ncr_buffer.getLength() > SEND_BUF_MAX) {
+                ncr_buffer.trim(ncr_buffer.getLength() - length);
+                break;
+            }
+        }
+        setBatchSize(count);
+    }
+
     // Copy the wire-ized request to callback.  This way we know after
     // send completes what we sent (or attempted to send).
     send_callback_->putData(static_cast<const uint8_t*>(ncr_buffer.getData()),
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2016,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -383,6 +383,11 @@ public:
     /// application layer by calling invokeRecvHandler() with a success
     /// status and a pointer to the new NCR.
     ///
+    /// Requests in the binary format are recognized whatever the
+    /// configured format and may be packed several per datagram: when
+    /// more than one was received they are handed off together to the
+    /// application layer's batch receive handler.
+    ///
     /// If the buffer contains invalid data such that construction fails,
     /// the method will log the failure and then call doReceive() to start a
     /// initiate the next receive.
@@ -497,6 +502,11 @@ public:
     /// asyncSend() method is called, passing in send_callback_ member's
     /// transfer buffer as the send buffer and the send_callback_ itself
     /// as the callback object.
+    ///
+    /// In the binary format the requests following the given one in the
+    /// send queue are packed into the same datagram, up to
+    /// @c SEND_BUF_MAX bytes.
+    ///
     /// @param ncr NameChangeRequest to send.
     virtual void doSend(NameChangeRequestPtr& ncr);
 
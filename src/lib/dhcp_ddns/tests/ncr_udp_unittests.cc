@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2017,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -615,10 +615,12 @@ public:
 
     std::vector<NameChangeRequestPtr> sent_ncrs_;
     std::vector<NameChangeRequestPtr> received_ncrs_;
+    size_t received_batches_;
 
     NameChangeUDPTest()
         : io_service_(), recv_result_(NameChangeListener::SUCCESS),
-          send_result_(NameChangeSender::SUCCESS), test_timer_(io_service_) {
+          send_result_(NameChangeSender::SUCCESS), test_timer_(io_service_),
+          received_batches_(0) {
         isc::asiolink::IOAddress addr(TEST_ADDRESS);
         // Create our listener instance. Note that reuse_address is true.
         listener_.reset(
@@ -641,6 +643,17 @@ public:
         received_ncrs_.clear();
     }
 
+    /// @brief Replaces the sender by one using the given format.
+    ///
+    /// @param format wire format of the outbound requests.
+    /// @param queue_max maximum number of entries of the send queue.
+    void resetSender(const NameChangeFormat format, const size_t queue_max) {
+        isc::asiolink::IOAddress addr(TEST_ADDRESS);
+        sender_.reset(
+            new NameChangeUDPSender(addr, SENDER_PORT, addr, LISTENER_PORT,
+                                    format, *this, queue_max, true));
+    }
+
     /// @brief Implements the receive completion handler.
     virtual void operator ()(const NameChangeListener::Result result,
                              NameChangeRequestPtr& ncr) {
@@ -649,6 +662,15 @@ public:
         received_ncrs_.push_back(ncr);
     }
 
+    /// @brief Implements the batch receive completion handler.
+    virtual void receiveBatch(const NameChangeListener::Result result,
+                              std::vector<NameChangeRequestPtr>& ncrs) {
+        // save the result and the NCRs received.
+        recv_result_ = result;
+        received_ncrs_.insert(received_ncrs_.end(), ncrs.begin(), ncrs.end());
+        ++received_batches_;
+    }
+
     /// @brief Implements the send completion handler.
     virtual void operator ()(const NameChangeSender::Result result,
                              NameChangeRequestPtr& ncr) {
@@ -719,6 +741,129 @@ TEST_F (NameChangeUDPTest, roundTripTest) {
     EXPECT_FALSE(sender_->amSending());
 }
 
+/// @brief Uses a sender in the binary format and a listener configured for
+/// JSON to verify that the requests are packed into datagrams, delivered
+/// in order to the batch receive handler and reported one by one to the
+/// send handler.
+TEST_F (NameChangeUDPTest, binaryBatchRoundTripTest) {
+    const size_t num_msgs = 200;
+    resetSender(FMT_BINARY, num_msgs);
+
+    ASSERT_NO_THROW(listener_->startListening(io_service_));
+    ASSERT_NO_THROW(sender_->startSending(io_service_));
+
+    // Queue the requests before running the IO: the first one is sent
+    // alone, the other ones are packed.
+    std::vector<NameChangeRequestPtr> ncrs;
+    for (size_t i = 0; i < num_msgs; ++i) {
+        NameChangeRequestPtr ncr;
+        ASSERT_NO_THROW(ncr = NameChangeRequest::fromJSON(valid_msgs[i % 3]));
+        // Make the requests distinct to check the ordering.
+        ncr->setLeaseLength(i);
+        ncrs.push_back(ncr);
+        ASSERT_NO_THROW(sender_->sendRequest(ncr));
+    }
+
+    size_t events = 0;
+    while (sender_->getQueueSize() > 0 || (received_ncrs_.size() < num_msgs)) {
+        ASSERT_NO_THROW(io_service_.run_one());
+        ++events;
+    }
+
+    // Far fewer datagrams than requests went through.
+    EXPECT_LT(events, num_msgs / 4);
+    EXPECT_GT(received_batches_, 1);
+    EXPECT_EQ(NameChangeListener::SUCCESS, recv_result_);
+    EXPECT_EQ(NameChangeSender::SUCCESS, send_result_);
+
+    // Every request was reported as sent and received, in order.
+    ASSERT_EQ(num_msgs, sent_ncrs_.size());
+    ASSERT_EQ(num_msgs, received_ncrs_.size());
+    for (size_t i = 0; i < num_msgs; ++i) {
+        EXPECT_TRUE(sent_ncrs_[i] == ncrs[i]);
+        EXPECT_TRUE(checkSendVsReceived(ncrs[i], received_ncrs_[i]));
+    }
+
+    EXPECT_NO_THROW(listener_->stopListening());
+    EXPECT_NO_THROW(io_service_.run_one());
+    EXPECT_NO_THROW(sender_->stopSending());
+}
+
+/// @brief Verifies that the listener skips the invalid requests of a
+/// datagram in the binary format and ignores anything following a JSON
+/// request.
+TEST_F (NameChangeUDPTest, binaryInvalidRequests) {
+    ASSERT_NO_THROW(listener_->startListening(io_service_));
+
+    NameChangeRequestPtr ncr;
+    ASSERT_NO_THROW(ncr = NameChangeRequest::fromJSON(valid_msgs[0]));
+
+    // A valid request, a request with a bad change type, a valid request
+    // and a truncated request.
+    isc::util::OutputBuffer buffer(1024);
+    ncr->toFormat(FMT_BINARY, buffer);
+    size_t start = buffer.getLength();
+    ncr->toFormat(FMT_BINARY, buffer);
+    buffer.writeUint8At(7, start + 3);
+    ncr->toFormat(FMT_BINARY, buffer);
+    start = buffer.getLength();
+    ncr->toFormat(FMT_BINARY, buffer);
+    buffer.trim(5);
+
+    boost::asio::ip::udp::socket
+        udp_socket(io_service_.get_io_service(), boost::asio::ip::udp::v4());
+    boost::asio::ip::udp::endpoint
+        listener_endpoint(boost::asio::ip::address::from_string(TEST_ADDRESS),
+                          LISTENER_PORT);
+    udp_socket.send_to(boost::asio::buffer(buffer.getData(),
+                                           buffer.getLength()),
+                       listener_endpoint);
+    ASSERT_NO_THROW(io_service_.run_one());
+
+    // Only the valid requests were received, as a batch.
+    ASSERT_EQ(2, received_ncrs_.size());
+    EXPECT_EQ(1, received_batches_);
+    EXPECT_TRUE(checkSendVsReceived(ncr, received_ncrs_[0]));
+    EXPECT_TRUE(checkSendVsReceived(ncr, received_ncrs_[1]));
+
+    // A binary request following a JSON one is ignored.
+    reset_results();
+    received_batches_ = 0;
+    buffer.clear();
+    ncr->toFormat(FMT_JSON, buffer);
+    ncr->toFormat(FMT_BINARY, buffer);
+    udp_socket.send_to(boost::asio::buffer(buffer.getData(),
+                                           buffer.getLength()),
+                       listener_endpoint);
+    ASSERT_NO_THROW(io_service_.run_one());
+    ASSERT_EQ(1, received_ncrs_.size());
+    EXPECT_EQ(0, received_batches_);
+    EXPECT_TRUE(checkSendVsReceived(ncr, received_ncrs_[0]));
+
+    EXPECT_NO_THROW(listener_->stopListening());
+    EXPECT_NO_THROW(io_service_.run_one());
+}
+
+/// @brief Verifies the batch size of the send in progress is checked.
+TEST(NameChangeSender, setBatchSize) {
+    /// @brief Sender exposing the batch size setter.
+    class TestSender : public NameChangeUDPSender {
+    public:
+        TestSender(const isc::asiolink::IOAddress& addr,
+                   RequestSendHandler& handler)
+            : NameChangeUDPSender(addr, SENDER_PORT, addr, LISTENER_PORT,
+                                  FMT_BINARY, handler, 10, true) {
+        }
+        using NameChangeUDPSender::setBatchSize;
+    };
+
+    isc::asiolink::IOAddress ip_address(TEST_ADDRESS);
+    SimpleSendHandler ncr_handler;
+    TestSender sender(ip_address, ncr_handler);
+    EXPECT_THROW(sender.setBatchSize(0), NcrSenderError);
+    EXPECT_THROW(sender.setBatchSize(1), NcrSenderError);
+}
+
 // Tests error handling of a failure to mark the watch socket ready, when
 // sendRequest() is called.
 TEST(NameChangeUDPSenderBasicTest, watchClosedBeforeSendRequest) {
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2015,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -584,6 +584,95 @@ TEST(NameChangeRequestTest, toFromBufferTest) {
     ASSERT_EQ(final_str, msg_str);
 }
 
+/// @brief Tests that a request survives a round trip through the binary
+/// format, for both address families, and that several requests can be
+/// packed in the same buffer.
+TEST(NameChangeRequestTest, toFromBinaryTest) {
+    std::vector<NameChangeRequestPtr> ncrs;
+    for (int i = 0; i < sizeof(valid_msgs)/sizeof(char*); ++i) {
+        NameChangeRequestPtr ncr;
+        ASSERT_NO_THROW(ncr = NameChangeRequest::fromJSON(valid_msgs[i]));
+        ncrs.push_back(ncr);
+    }
+
+    isc::util::OutputBuffer output_buffer(1024);
+    for (auto ncr = ncrs.begin(); ncr != ncrs.end(); ++ncr) {
+        ASSERT_NO_THROW((*ncr)->toFormat(FMT_BINARY, output_buffer));
+    }
+
+    // The binary format is much more compact than JSON.
+    isc::util::OutputBuffer json_buffer(1024);
+    for (auto ncr = ncrs.begin(); ncr != ncrs.end(); ++ncr) {
+        ASSERT_NO_THROW((*ncr)->toFormat(FMT_JSON, json_buffer));
+    }
+    EXPECT_LT(2 * output_buffer.getLength(), json_buffer.getLength());
+
+    // Read the requests back one after the other.
+    isc::util::InputBuffer input_buffer(output_buffer.getData(),
+                                        output_buffer.getLength());
+    for (auto ncr = ncrs.begin(); ncr != ncrs.end(); ++ncr) {
+        // The marker follows the length.
+        ASSERT_LT(input_buffer.getPosition() + 2, input_buffer.getLength());
+        EXPECT_EQ(NameChangeRequest::BINARY_FORMAT_MARKER,
+                  static_cast<const uint8_t*>(output_buffer.getData())
+                  [input_buffer.getPosition() + 2]);
+        NameChangeRequestPtr ncr2;
+        ASSERT_NO_THROW(ncr2 = NameChangeRequest::fromFormat(FMT_BINARY,
+                                                             input_buffer));
+        ASSERT_TRUE(ncr2);
+        EXPECT_TRUE(**ncr == *ncr2);
+        EXPECT_EQ((*ncr)->toJSON(), ncr2->toJSON());
+    }
+    EXPECT_EQ(input_buffer.getLength(), input_buffer.getPosition());
+}
+
+/// @brief Tests that invalid binary renditions are rejected.
+TEST(NameChangeRequestTest, invalidBinaryTest) {
+    NameChangeRequestPtr ncr;
+    ASSERT_NO_THROW(ncr = NameChangeRequest::fromJSON(valid_msgs[0]));
+    isc::util::OutputBuffer output_buffer(1024);
+    ASSERT_NO_THROW(ncr->toBinary(output_buffer));
+    const uint8_t* data = static_cast<const uint8_t*>(output_buffer.getData());
+    const std::vector<uint8_t> binary(data, data + output_buffer.getLength());
+    ASSERT_NO_THROW(NameChangeRequest::fromBinary(binary));
+
+    // Every truncation is detected.
+    for (size_t len = 0; len < binary.size(); ++len) {
+        std::vector<uint8_t> truncated(binary.begin(), binary.begin() + len);
+        EXPECT_THROW(NameChangeRequest::fromBinary(truncated), NcrMessageError)
+            << "length " << len;
+    }
+
+    // Trailing data is not allowed.
+    std::vector<uint8_t> trailing(binary);
+    trailing.push_back(0);
+    EXPECT_THROW(NameChangeRequest::fromBinary(trailing), NcrMessageError);
+
+    // Nor a wrong marker.
+    std::vector<uint8_t> bad_marker(binary);
+    bad_marker[0] = '{';
+    EXPECT_THROW(NameChangeRequest::fromBinary(bad_marker), NcrMessageError);
+
+    // Nor an invalid change type.
+    std::vector<uint8_t> bad_type(binary);
+    bad_type[1] = 7;
+    EXPECT_THROW(NameChangeRequest::fromBinary(bad_type), NcrMessageError);
+
+    // Nor a request without any change direction.
+    std::vector<uint8_t> no_change(binary);
+    no_change[2] = 0;
+    EXPECT_THROW(NameChangeRequest::fromBinary(no_change), NcrMessageError);
+
+    // A length prefix larger than the data is a read error.
+    isc::util::OutputBuffer prefixed(1024);
+    prefixed.writeUint16(binary.size() + 1);
+    prefixed.writeData(&binary[0], binary.size());
+    isc::util::InputBuffer input_buffer(prefixed.getData(),
+                                        prefixed.getLength());
+    EXPECT_THROW(NameChangeRequest::fromFormat(FMT_BINARY, input_buffer),
+                 NcrMessageError);
+}
+
 /// @brief Tests ip address modification and validation
 TEST(NameChangeRequestTest, ipAddresses) {
     NameChangeRequest ncr;
@@ -610,9 +699,12 @@ TEST(NameChangeRequestTest, ipAddresses) {
 TEST(NameChangeFormatTest, formatEnumConversion){
     ASSERT_EQ(stringToNcrFormat("JSON"), dhcp_ddns::FMT_JSON);
     ASSERT_EQ(stringToNcrFormat("jSoN"), dhcp_ddns::FMT_JSON);
+    ASSERT_EQ(stringToNcrFormat("BINARY"), dhcp_ddns::FMT_BINARY);
+    ASSERT_EQ(stringToNcrFormat("binary"), dhcp_ddns::FMT_BINARY);
     ASSERT_THROW(stringToNcrFormat("bogus"), isc::BadValue);
 
     ASSERT_EQ(ncrFormatToString(dhcp_ddns::FMT_JSON), "JSON");
+    ASSERT_EQ(ncrFormatToString(dhcp_ddns::FMT_BINARY), "BINARY");
 }
 
 /// @brief Tests conversion of NameChangeProtocol between enum and strings.
@@ -80,6 +80,28 @@ struct AllocEngineHooks {
 // module is called.
 AllocEngineHooks Hooks;
 
+/// @brief Number of addresses of a pool scanned by a free address search.
+const uint32_t FREE_ADDRESS4_SCAN_WINDOW = 256;
+
+/// @brief Maximum number of free addresses returned by a search.
+const size_t FREE_ADDRESS4_MAX_CANDIDATES = 8;
+
+/// @brief Maximum number of windows scanned for an allocation.
+const size_t FREE_ADDRESS4_MAX_SCANS = 4;
+
+/// @brief Checks if the renewal changed only the cltt of the lease.
+///
+/// @param lease renewed lease.
+/// @param old_lease lease before the renewal.
+/// @return true if the leases differ only in cltt.
+template<typename LeaseType>
+bool
+onlyClttChanged(const LeaseType& lease, const LeaseType& old_lease) {
+    LeaseType renewed(lease);
+    renewed.cltt_ = old_lease.cltt_;
+    return (renewed == old_lease);
+}
+
 }; // anonymous namespace
 
 namespace isc {
@@ -2077,9 +2099,35 @@ AllocEngine::extendLease6(ClientContext6& ctx, Lease6Ptr lease) {
             }
         }
 
-        // Now that the lease has been reclaimed, we can go ahead and update it
-        // in the lease database.
-        LeaseMgrFactory::instance().updateLease6(lease);
+        // If the extension changed nothing but the cltt and the lease is far
+        // from expiring, return it with the remaining lifetimes instead of
+        // writing it to the lease database.
+        if (onlyClttChanged(*lease, *old_data) &&
+            reuseLease(*ctx.subnet_, *lease, *old_data)) {
+            const uint32_t age = lease->cltt_ - old_data->cltt_;
+            lease->preferred_lft_ = (lease->preferred_lft_ > age ?
+                                     lease->preferred_lft_ - age : 0);
+
+            LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE_DETAIL,
+                      ALLOC_ENGINE_V6_LEASE_REUSE)
+                .arg(ctx.query_->getLabel())
+                .arg(lease->addr_.toText())
+                .arg(static_cast<int>(lease->prefixlen_))
+                .arg(lease->valid_lft_);
+
+            const std::string name = (lease->type_ == Lease::TYPE_NA ?
+                                      "v6-ia-na-lease-reuses" :
+                                      "v6-ia-pd-lease-reuses");
+            StatsMgr::instance().addValue(name, static_cast<int64_t>(1));
+            StatsMgr::instance().addValue(
+                StatsMgr::generateName("subnet", ctx.subnet_->getID(), name),
+                static_cast<int64_t>(1));
+
+        } else {
+            // Now that the lease has been reclaimed, we can go ahead and
+            // update it in the lease database.
+            LeaseMgrFactory::instance().updateLease6(lease);
+        }
 
     } else {
         // Copy back the original date to the lease. For MySQL it doesn't make
@@ -2876,6 +2924,9 @@ hasAddressReservation(AllocEngine::ClientContext4& ctx) {
 /// address, the function also checks if the lease belongs to the client, i.e.
 /// there is no conflict between the client identifiers.
 ///
+/// The leases already fetched in the context are used instead of querying
+/// the lease database again.
+///
 /// @param [out] ctx Context holding data extracted from the client's message,
 /// including the HW address and client identifier. The current subnet may be
 /// modified by this function if it belongs to a shared network.
@@ -2886,6 +2937,14 @@ void findClientLease(AllocEngine::ClientContext4& ctx, Lease4Ptr& client_lease)
 
     Subnet4Ptr original_subnet = ctx.subnet_;
 
+    // Check if the leases fetched before the allocation were fetched for
+    // this client.
+    const ClientLeases4Ptr& fetched = ctx.client_leases_;
+    const bool clientid_fetched = (fetched && ctx.clientid_ && fetched->clientid_ &&
+                                   (*fetched->clientid_ == *ctx.clientid_));
+    const bool hwaddr_fetched = (fetched && ctx.hwaddr_ && fetched->hwaddr_ &&
+                                 (*fetched->hwaddr_ == *ctx.hwaddr_));
+
     // Client identifier is optional. First check if we can try to lookup
     // by client-id.
     bool try_clientid_lookup = (ctx.clientid_ &&
@@ -2897,7 +2956,9 @@ void findClientLease(AllocEngine::ClientContext4& ctx, Lease4Ptr& client_lease)
         // Get all leases for this client identifier. When shared networks are
         // in use it is more efficient to make a single query rather than
         // multiple queries, one for each subnet.
-        Lease4Collection leases_client_id = lease_mgr.getLease4(*ctx.clientid_);
+        Lease4Collection leases_client_id = (clientid_fetched ?
+                                             fetched->clientid_leases_ :
+                                             lease_mgr.getLease4(*ctx.clientid_));
 
         // Iterate over the subnets within the shared network to see if any client's
         // lease belongs to them.
@@ -2926,7 +2987,9 @@ void findClientLease(AllocEngine::ClientContext4& ctx, Lease4Ptr& client_lease)
     if (!client_lease && ctx.hwaddr_) {
 
         // Get all leases for this HW address.
-        Lease4Collection leases_hw_address = lease_mgr.getLease4(*ctx.hwaddr_);
+        Lease4Collection leases_hw_address = (hwaddr_fetched ?
+                                              fetched->hwaddr_leases_ :
+                                              lease_mgr.getLease4(*ctx.hwaddr_));
 
         for (Subnet4Ptr subnet = original_subnet; subnet;
              subnet = subnet->getNextSubnet(original_subnet,
@@ -3001,7 +3064,7 @@ AllocEngine::ClientContext4::ClientContext4()
       fwd_dns_update_(false), rev_dns_update_(false),
       hostname_(""), callout_handle_(), fake_allocation_(false),
       old_lease_(), new_lease_(), hosts_(), conflicting_lease_(),
-      query_(), host_identifiers_() {
+      query_(), host_identifiers_(), client_leases_() {
 }
 
 AllocEngine::ClientContext4::ClientContext4(const Subnet4Ptr& subnet,
@@ -3017,7 +3080,7 @@ AllocEngine::ClientContext4::ClientContext4(const Subnet4Ptr& subnet,
       fwd_dns_update_(fwd_dns_update), rev_dns_update_(rev_dns_update),
       hostname_(hostname), callout_handle_(),
       fake_allocation_(fake_allocation), old_lease_(), new_lease_(),
-      hosts_(), host_identifiers_() {
+      hosts_(), host_identifiers_(), client_leases_() {
 
     // Initialize host identifiers.
     if (hwaddr) {
@@ -3490,9 +3553,18 @@ AllocEngine::requestLease4(AllocEngine::ClientContext4& ctx) {
     return (new_lease);
 }
 
+namespace {
+
+/// @brief Creates a new lease for the client.
+///
+/// @param ctx Client context holding the data extracted from the
+/// client's message.
+/// @param addr Address of the lease.
+///
+/// @return A pointer to the new lease.
+/// @throw BadValue if the context has no HW address or subnet.
 Lease4Ptr
-AllocEngine::createLease4(const ClientContext4& ctx, const IOAddress& addr,
-                          CalloutHandle::CalloutNextStep& callout_status) {
+makeLease4(const AllocEngine::ClientContext4& ctx, const IOAddress& addr) {
     if (!ctx.hwaddr_) {
         isc_throw(BadValue, "Can't create a lease with NULL HW address");
     }
@@ -3528,6 +3600,16 @@ AllocEngine::createLease4(const ClientContext4& ctx, const IOAddress& addr,
     lease->fqdn_rev_ = ctx.rev_dns_update_;
     lease->hostname_ = ctx.hostname_;
 
+    return (lease);
+}
+
+} // end of anonymous namespace
+
+Lease4Ptr
+AllocEngine::createLease4(const ClientContext4& ctx, const IOAddress& addr,
+                          CalloutHandle::CalloutNextStep& callout_status) {
+    Lease4Ptr lease = makeLease4(ctx, addr);
+
     // Let's execute all callouts registered for lease4_select
     if (ctx.callout_handle_ &&
         HooksManager::getHooksManager().calloutsPresent(hook_index_lease4_select_)) {
@@ -3688,8 +3770,28 @@ AllocEngine::renewLease4(const Lease4Ptr& lease,
     }
 
     if (!ctx.fake_allocation_ && !skip) {
-        // for REQUEST we do update the lease
-        LeaseMgrFactory::instance().updateLease4(lease);
+        // If the renewal changed nothing but the cltt and the lease is far
+        // from expiring, return it with the remaining lifetime instead of
+        // writing it to the lease database.
+        if (onlyClttChanged(*lease, *ctx.old_lease_) &&
+            reuseLease(*ctx.subnet_, *lease, *ctx.old_lease_)) {
+            LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE_DETAIL,
+                      ALLOC_ENGINE_V4_LEASE_REUSE)
+                .arg(ctx.query_->getLabel())
+                .arg(lease->addr_.toText())
+                .arg(lease->valid_lft_);
+
+            StatsMgr::instance().addValue("v4-lease-reuses",
+                                          static_cast<int64_t>(1));
+            StatsMgr::instance().addValue(
+                StatsMgr::generateName("subnet", ctx.subnet_->getID(),
+                                       "v4-lease-reuses"),
+                static_cast<int64_t>(1));
+
+        } else {
+            // for REQUEST we do update the lease
+            LeaseMgrFactory::instance().updateLease4(lease);
+        }
 
         // We need to account for the re-assignment of The lease.
         if (ctx.old_lease_->expired() || ctx.old_lease_->state_ == Lease::STATE_EXPIRED_RECLAIMED) {
@@ -3856,6 +3958,9 @@ AllocEngine::allocateUnreservedLease4(ClientContext4& ctx) {
 
     Subnet4Ptr original_subnet = subnet;
 
+    // The lease backend may search the free addresses itself.
+    const bool backend_search = LeaseMgrFactory::instance().canFindFreeAddresses4();
+
     uint64_t total_attempts = 0;
     while (subnet) {
 
@@ -3875,6 +3980,25 @@ AllocEngine::allocateUnreservedLease4(ClientContext4& ctx) {
 
         CalloutHandle::CalloutNextStep callout_status = CalloutHandle::NEXT_STEP_CONTINUE;
 
+        // When the addresses of the pools may be reserved to other
+        // clients, most of them are reserved: let the allocator pick them.
+        // Otherwise ask the backend for free addresses first. It returns
+        // the reclaimed leases but not the expired leases waiting for the
+        // reclamation, so the allocator is still used when it fails.
+        if (backend_search && (max_attempts > 0) &&
+            (subnet->getHostReservationMode() != Network::HR_ALL)) {
+            new_lease = allocateFreeLease4(ctx, allocator, client_id,
+                                           callout_status);
+            if (new_lease) {
+                return (new_lease);
+
+            } else if (ctx.callout_handle_ &&
+                       (callout_status != CalloutHandle::NEXT_STEP_CONTINUE)) {
+                // Don't retry when the callout status is not continue.
+                break;
+            }
+        }
+
         for (uint64_t i = 0; i < max_attempts; ++i) {
             IOAddress candidate = allocator->pickAddress(subnet,
                                                          ctx.query_->getClasses(),
@@ -3918,6 +4042,69 @@ AllocEngine::allocateUnreservedLease4(ClientContext4& ctx) {
     return (new_lease);
 }
 
+Lease4Ptr
+AllocEngine::allocateFreeLease4(ClientContext4& ctx, const AllocatorPtr& allocator,
+                                const ClientIdPtr& client_id,
+                                CalloutHandle::CalloutNextStep& callout_status) {
+    Subnet4Ptr subnet = ctx.subnet_;
+    LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
+
+    for (size_t scan = 0; scan < FREE_ADDRESS4_MAX_SCANS; ++scan) {
+        // The search resumes where the allocator stopped.
+        IOAddress start = allocator->pickAddress(subnet,
+                                                 ctx.query_->getClasses(),
+                                                 client_id,
+                                                 ctx.requested_address_);
+        PoolPtr pool = subnet->getPool(Lease::TYPE_V4, ctx.query_->getClasses(),
+                                       start);
+        if (!pool) {
+            return (Lease4Ptr());
+        }
+
+        // Bound the search to a window of the pool.
+        uint32_t last = pool->getLastAddress().toUint32();
+        if (last - start.toUint32() >= FREE_ADDRESS4_SCAN_WINDOW) {
+            last = start.toUint32() + FREE_ADDRESS4_SCAN_WINDOW - 1;
+        }
+        std::vector<IOAddress> candidates =
+            lease_mgr.findFreeAddresses4(start, IOAddress(last),
+                                         FREE_ADDRESS4_MAX_CANDIDATES);
+
+        // The window has no usable address: the allocator resumes after it.
+        // The next windows are likely as full, so they are left to the
+        // allocator too.
+        if (candidates.empty()) {
+            pool->setLastAllocated(IOAddress(last));
+            subnet->setLastAllocated(Lease::TYPE_V4, IOAddress(last));
+            break;
+        }
+
+        for (const auto& candidate : candidates) {
+            // The candidates pass the same checks and callouts as the
+            // addresses picked by the allocator. A reclaimed lease is
+            // reused.
+            if (addressReserved(candidate, ctx)) {
+                continue;
+            }
+            Lease4Ptr lease = allocateOrReuseLease4(candidate, ctx,
+                                                    callout_status);
+            // The allocator resumes after the candidate.
+            pool->setLastAllocated(candidate);
+            subnet->setLastAllocated(Lease::TYPE_V4, candidate);
+            if (lease) {
+                return (lease);
+
+            } else if (ctx.callout_handle_ &&
+                       (callout_status != CalloutHandle::NEXT_STEP_CONTINUE)) {
+                return (Lease4Ptr());
+            }
+            // Otherwise another server took the address in the meantime.
+        }
+    }
+
+    return (Lease4Ptr());
+}
+
 void
 AllocEngine::updateLease4Information(const Lease4Ptr& lease,
                                      AllocEngine::ClientContext4& ctx) const {
@@ -3947,5 +4134,25 @@ AllocEngine::conditionalExtendLifetime(Lease& lease) const {
     return (true);
 }
 
+bool
+AllocEngine::reuseLease(const Subnet& subnet, Lease& lease,
+                        const Lease& old_lease) const {
+    const util::Optional<double>& threshold = subnet.getCacheThreshold();
+    if (threshold.unspecified() || (threshold.get() <= 0.) ||
+        (old_lease.state_ != Lease::STATE_DEFAULT)) {
+        return (false);
+    }
+
+    // The renewed lease has the current time as cltt.
+    const int64_t remaining = old_lease.getExpirationTime() - lease.cltt_;
+    if ((remaining <= 0) ||
+        (remaining <= threshold.get() * old_lease.valid_lft_)) {
+        return (false);
+    }
+
+    lease.valid_lft_ = static_cast<uint32_t>(remaining);
+    return (true);
+}
+
 }; // end of isc::dhcp namespace
 }; // end of isc namespace
@@ -16,10 +16,12 @@
 #include <dhcp/option6_ia.h>
 #include <dhcp/option6_iaaddr.h>
 #include <dhcp/option6_iaprefix.h>
+#include <dhcpsrv/async_lease_lookup.h>
 #include <dhcpsrv/host.h>
 #include <dhcpsrv/subnet.h>
 #include <dhcpsrv/lease_mgr.h>
 #include <hooks/callout_handle.h>
+#include <util/memory_arena.h>
 
 #include <boost/function.hpp>
 #include <boost/shared_ptr.hpp>
@@ -414,7 +416,11 @@ public:
     /// that the big advantage of using the context structure to pass
     /// information to the allocation engine methods is that adding
     /// new information doesn't modify the API of the allocation engine.
-    struct ClientContext6 : public boost::noncopyable {
+    ///
+    /// Contexts created while a @c isc::util::MemoryArenaScope is active
+    /// are allocated from the per-packet arena.
+    struct ClientContext6 : public boost::noncopyable,
+                            public isc::util::ArenaAllocatable {
 
         /// @name Parameters pertaining to DHCPv6 message
         //@{
@@ -1251,7 +1257,11 @@ public:
     /// that the big advantage of using the context structure to pass
     /// information to the allocation engine methods is that adding
     /// new information doesn't modify the API of the allocation engine.
-    struct ClientContext4 : public boost::noncopyable {
+    ///
+    /// Contexts created while a @c isc::util::MemoryArenaScope is active
+    /// are allocated from the per-packet arena.
+    struct ClientContext4 : public boost::noncopyable,
+                            public isc::util::ArenaAllocatable {
         /// @brief Subnet selected for the client by the server.
         Subnet4Ptr subnet_;
 
@@ -1319,6 +1329,14 @@ public:
         /// received by the server.
         IdentifierList host_identifiers_;
 
+        /// @brief Leases of the client fetched before the allocation.
+        ///
+        /// When set, the existing lease of the client is searched in these
+        /// leases rather than in the lease database, provided they were
+        /// fetched for the client identifier and hardware address of this
+        /// context.
+        ClientLeases4Ptr client_leases_;
+
         /// @brief Convenience function adding host identifier into
         /// @ref host_identifiers_ list.
         ///
@@ -1669,6 +1687,31 @@ private:
     /// was not successful.
     Lease4Ptr allocateUnreservedLease4(ClientContext4& ctx);
 
+    /// @brief Allocates a lease for a free address found by the backend.
+    ///
+    /// Instead of probing the addresses picked by the allocator one by one,
+    /// the lease backend searches the addresses without lease in a bounded
+    /// window of a pool, starting at the address picked by the allocator.
+    /// The returned candidates pass the same reservation checks and
+    /// lease4_select callouts as the addresses picked by the allocator, and
+    /// the allocator resumes after the last used candidate or window. The
+    /// reclaimed leases are reused. The search stops at the first window
+    /// without candidate, and scans another window only when the other
+    /// servers took all the candidates in the meantime.
+    ///
+    /// @param ctx Client context holding the data extracted from the
+    /// client's message.
+    /// @param allocator Allocator picking the start of the windows.
+    /// @param client_id Client identifier given to the allocator.
+    /// @param [out] callout_status callout returned by the lease4_select.
+    ///
+    /// @return A pointer to the allocated lease or NULL if no free address
+    /// was found in the scanned windows.
+    Lease4Ptr allocateFreeLease4(ClientContext4& ctx,
+                                 const AllocatorPtr& allocator,
+                                 const ClientIdPtr& client_id,
+                                 hooks::CalloutHandle::CalloutNextStep& callout_status);
+
     /// @brief Updates the specified lease with the information from a context.
     ///
     /// The context, specified as an argument to this method, holds various
@@ -1713,6 +1756,27 @@ private:
     /// otherwise.
     bool conditionalExtendLifetime(Lease& lease) const;
 
+    /// @brief Reuses the renewed lease if it is not worth updating.
+    ///
+    /// The renewed lease is reused when the old lease is assigned, its
+    /// remaining lifetime is greater than the cache-threshold fraction of
+    /// its valid lifetime, as configured for the subnet, and the caller
+    /// has checked that the renewal changed nothing but the client last
+    /// transmission time. The valid lifetime of the reused
+    /// lease is set to the remaining lifetime, so the lease expires at
+    /// the time stored in the lease database. The reused lease must not
+    /// be updated in the lease database.
+    ///
+    /// @param subnet The subnet of the client context, holding the lease
+    /// cache threshold.
+    /// @param [in,out] lease A renewed lease with the client last
+    /// transmission time set to the current time.
+    /// @param old_lease The lease before the renewal.
+    ///
+    /// @return true if the lease is reused, false otherwise.
+    bool reuseLease(const Subnet& subnet, Lease& lease,
+                    const Lease& old_lease) const;
+
 private:
 
     /// @brief Number of consecutive DHCPv4 leases' reclamations after
@@ -21,6 +21,7 @@ extern const isc::log::MessageID ALLOC_ENGINE_V4_LEASES_RECLAMATION_START;
 extern const isc::log::MessageID ALLOC_ENGINE_V4_LEASES_RECLAMATION_TIMEOUT;
 extern const isc::log::MessageID ALLOC_ENGINE_V4_LEASE_RECLAIM;
 extern const isc::log::MessageID ALLOC_ENGINE_V4_LEASE_RECLAMATION_FAILED;
+extern const isc::log::MessageID ALLOC_ENGINE_V4_LEASE_REUSE;
 extern const isc::log::MessageID ALLOC_ENGINE_V4_NO_MORE_EXPIRED_LEASES;
 extern const isc::log::MessageID ALLOC_ENGINE_V4_OFFER_EXISTING_LEASE;
 extern const isc::log::MessageID ALLOC_ENGINE_V4_OFFER_NEW_LEASE;
@@ -62,6 +63,7 @@ extern const isc::log::MessageID ALLOC_ENGINE_V6_LEASES_RECLAMATION_START;
 extern const isc::log::MessageID ALLOC_ENGINE_V6_LEASES_RECLAMATION_TIMEOUT;
 extern const isc::log::MessageID ALLOC_ENGINE_V6_LEASE_RECLAIM;
 extern const isc::log::MessageID ALLOC_ENGINE_V6_LEASE_RECLAMATION_FAILED;
+extern const isc::log::MessageID ALLOC_ENGINE_V6_LEASE_REUSE;
 extern const isc::log::MessageID ALLOC_ENGINE_V6_NO_MORE_EXPIRED_LEASES;
 extern const isc::log::MessageID ALLOC_ENGINE_V6_RECLAIMED_LEASES_DELETE;
 extern const isc::log::MessageID ALLOC_ENGINE_V6_RECLAIMED_LEASES_DELETE_COMPLETE;
@@ -0,0 +1,222 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcp/iface_mgr.h>
+#include <dhcpsrv/async_lease_lookup.h>
+#include <dhcpsrv/dhcpsrv_log.h>
+#include <dhcpsrv/lease_mgr_factory.h>
+#include <exceptions/exceptions.h>
+
+#ifdef HAVE_MYSQL
+#include <mysql/mysql_connection.h>
+#endif
+
+#include <boost/bind.hpp>
+
+using namespace isc::db;
+using namespace isc::util;
+using namespace isc::util::thread;
+
+namespace isc {
+namespace dhcp {
+
+AsyncLeaseLookup::AsyncLeaseLookup(const size_t threads,
+                                   const size_t max_pending)
+    : queue_(), done_(), in_flight_(), max_pending_(max_pending),
+      stopping_(false), mutex_(), queued_(), done_cond_(), watch_socket_(),
+      threads_() {
+    IfaceMgr::instance().addExternalSocket(watch_socket_.getSelectFd(),
+                                           boost::bind(&AsyncLeaseLookup::runReadyIO,
+                                                       this));
+    for (size_t i = 0; i < (threads > 0 ? threads : 1); ++i) {
+        threads_.push_back(boost::shared_ptr<Thread>
+                           (new Thread(boost::bind(&AsyncLeaseLookup::lookupLoop,
+                                                   this))));
+    }
+}
+
+AsyncLeaseLookup::~AsyncLeaseLookup() {
+    {
+        Mutex::Locker lock(mutex_);
+        stopping_ = true;
+        for (size_t i = 0; i < threads_.size(); ++i) {
+            queued_.signal();
+        }
+    }
+    // The threads complete the queued lookups before they stop.
+    for (auto thread : threads_) {
+        thread->wait();
+    }
+    IfaceMgr::instance().deleteExternalSocket(watch_socket_.getSelectFd());
+}
+
+bool
+AsyncLeaseLookup::isSupported() {
+    if (!LeaseMgrFactory::haveInstance()) {
+        return (false);
+    }
+    return (LeaseMgrFactory::instance().canLookupLeasesConcurrently());
+}
+
+bool
+AsyncLeaseLookup::getClientLeases4(const ClientIdPtr& clientid,
+                                   const HWAddrPtr& hwaddr,
+                                   const ClientLeases4Handler& handler) {
+    if (!hwaddr) {
+        isc_throw(BadValue, "hardware address must not be null for the"
+                  " lookup of the leases of a client");
+    }
+
+    Mutex::Locker lock(mutex_);
+    if ((in_flight_.size() >= max_pending_) ||
+        !in_flight_.insert(hwaddr->hwaddr_).second) {
+        return (false);
+    }
+
+    Lookup lookup;
+    lookup.hwaddr_ = hwaddr;
+    lookup.leases_.reset(new ClientLeases4());
+    lookup.leases_->clientid_ = clientid;
+    lookup.leases_->hwaddr_ = hwaddr;
+    lookup.handler_ = handler;
+    queue_.push_back(lookup);
+    queued_.signal();
+    return (true);
+}
+
+size_t
+AsyncLeaseLookup::getPending() const {
+    Mutex::Locker lock(mutex_);
+    return (in_flight_.size());
+}
+
+void
+AsyncLeaseLookup::wait() {
+    {
+        Mutex::Locker lock(mutex_);
+        while (done_.size() < in_flight_.size()) {
+            done_cond_.wait(mutex_);
+        }
+    }
+    runReadyIO();
+}
+
+void
+AsyncLeaseLookup::runReadyIO() {
+    std::list<Lookup> done;
+    {
+        Mutex::Locker lock(mutex_);
+        done.swap(done_);
+        watch_socket_.clearReady();
+        for (auto lookup : done) {
+            in_flight_.erase(lookup.hwaddr_->hwaddr_);
+        }
+    }
+
+    ReconnectCtlPtr db_lost;
+    bool recovering = true;
+    for (auto lookup : done) {
+        if (lookup.db_lost_ && !db_lost) {
+            db_lost = lookup.db_lost_;
+        }
+    }
+
+    if (db_lost) {
+        // The server reopens the lease backend when it recovers the
+        // connectivity: the pending lookups must not use it anymore.
+        // They most likely fail too, so report the loss only once.
+        {
+            Mutex::Locker lock(mutex_);
+            while (done_.size() < in_flight_.size()) {
+                done_cond_.wait(mutex_);
+            }
+            for (auto& lookup : done_) {
+                lookup.db_lost_.reset();
+            }
+        }
+
+        // Hand the loss to the callback of the server as if it was
+        // detected by the main thread.
+        recovering = (DatabaseConnection::db_lost_callback &&
+                      DatabaseConnection::db_lost_callback(db_lost));
+    }
+
+    for (auto lookup : done) {
+        lookup.handler_(lookup.leases_);
+    }
+
+    // If there's no lost db callback or it returns false, then we're not
+    // attempting to recover: let the caller handle the failure.
+    if (!recovering) {
+        LOG_ERROR(dhcpsrv_logger, DHCPSRV_LEASE_LOOKUP_DB_LOST);
+        isc_throw(DbOperationError, "database connectivity lost during"
+                  " the lease lookups and no reconnection is attempted");
+    }
+}
+
+void
+AsyncLeaseLookup::lookupLoop() {
+    // The server state is only changed by the main thread.
+    DatabaseConnection::deferDbLostCallback(true);
+
+#ifdef HAVE_MYSQL
+    // The MySQL client library requires the threads using connections
+    // opened by other threads to initialize their own data.
+    mysql_thread_init();
+#endif
+
+    for (;;) {
+        Lookup lookup;
+        {
+            Mutex::Locker lock(mutex_);
+            while (queue_.empty() && !stopping_) {
+                queued_.wait(mutex_);
+            }
+            if (queue_.empty()) {
+                break;
+            }
+            lookup = queue_.front();
+            queue_.pop_front();
+        }
+
+        AsyncLeaseLookup::lookup(lookup);
+
+        Mutex::Locker lock(mutex_);
+        done_.push_back(lookup);
+        if (done_.size() == 1) {
+            watch_socket_.markReady();
+        }
+        done_cond_.signal();
+    }
+
+#ifdef HAVE_MYSQL
+    mysql_thread_end();
+#endif
+}
+
+void
+AsyncLeaseLookup::lookup(Lookup& lookup) {
+    const ClientLeases4Ptr& leases = lookup.leases_;
+    try {
+        LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
+        if (leases->clientid_) {
+            leases->clientid_leases_ = lease_mgr.getLease4(*leases->clientid_);
+        }
+        leases->hwaddr_leases_ = lease_mgr.getLease4(*leases->hwaddr_);
+
+    } catch (const std::exception& ex) {
+        LOG_ERROR(dhcpsrv_logger, DHCPSRV_LEASE_LOOKUP_FAILED)
+            .arg(lookup.hwaddr_->toText())
+            .arg(ex.what());
+        lookup.db_lost_ = DatabaseConnection::takeDeferredDbLost();
+        lookup.leases_.reset();
+    }
+}
+
+} // namespace dhcp
+} // namespace isc
@@ -0,0 +1,202 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef ASYNC_LEASE_LOOKUP_H
+#define ASYNC_LEASE_LOOKUP_H
+
+#include <database/database_connection.h>
+#include <dhcp/duid.h>
+#include <dhcp/hwaddr.h>
+#include <dhcpsrv/lease.h>
+#include <util/threads/sync.h>
+#include <util/threads/thread.h>
+#include <util/watch_socket.h>
+
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <list>
+#include <set>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Maximum number of threads performing the asynchronous lease
+/// lookups.
+const size_t MAX_LEASE_LOOKUP_THREADS = 256;
+
+/// @brief Leases of a DHCPv4 client fetched before the packet processing.
+///
+/// They are the leases the allocation engine looks for when it searches
+/// the existing lease of the client.
+struct ClientLeases4 {
+    /// @brief Client identifier used for the lookup, may be null.
+    ClientIdPtr clientid_;
+
+    /// @brief Leases of the client identifier.
+    Lease4Collection clientid_leases_;
+
+    /// @brief Hardware address used for the lookup.
+    HWAddrPtr hwaddr_;
+
+    /// @brief Leases of the hardware address.
+    Lease4Collection hwaddr_leases_;
+};
+
+/// @brief Pointer to the leases of a DHCPv4 client.
+typedef boost::shared_ptr<ClientLeases4> ClientLeases4Ptr;
+
+/// @brief Performs lease lookups outside of the main thread.
+///
+/// A lease lookup in a SQL backend is a round trip to the database server
+/// during which the server can't process other packets. This class hands
+/// the lookups to a set of threads, each using a connection of the backend
+/// pool, and invokes the completion handlers in the main thread so the
+/// server can process other packets while waiting for the database.
+///
+/// The lookups are completed through a watch socket registered with the
+/// @c IfaceMgr: when a lookup is done the socket is marked ready so the
+/// @c IfaceMgr calls @ref runReadyIO from the main thread.
+///
+/// The lost connectivity callback of the database is deferred in the
+/// lookup threads and invoked by @ref runReadyIO.
+class AsyncLeaseLookup : public boost::noncopyable {
+public:
+
+    /// @brief Type of the lookup completion handler.
+    ///
+    /// The handler takes the leases of the client or null when the lookup
+    /// failed.
+    typedef boost::function<void (const ClientLeases4Ptr&)> ClientLeases4Handler;
+
+    /// @brief Default maximum number of pending lookups.
+    static const size_t DEFAULT_MAX_PENDING = 1024;
+
+    /// @brief Constructor.
+    ///
+    /// Starts the lookup threads and registers the watch socket with the
+    /// @c IfaceMgr.
+    ///
+    /// @param threads Number of lookup threads, at least 1.
+    /// @param max_pending Maximum number of pending lookups.
+    AsyncLeaseLookup(const size_t threads,
+                     const size_t max_pending = DEFAULT_MAX_PENDING);
+
+    /// @brief Destructor.
+    ///
+    /// Waits for the pending lookups and stops the threads. The handlers
+    /// of the lookups which were not completed are not invoked.
+    ~AsyncLeaseLookup();
+
+    /// @brief Checks if the current lease backend benefits from the
+    /// asynchronous lookups.
+    ///
+    /// It is called for each packet, so it only checks the capability
+    /// reported by the backend. See
+    /// @ref LeaseMgr::canLookupLeasesConcurrently.
+    ///
+    /// @return true if the lease backend is MySQL or PostgreSQL.
+    static bool isSupported();
+
+    /// @brief Starts the lookup of the leases of a DHCPv4 client.
+    ///
+    /// Only one lookup per hardware address can be pending: a client
+    /// retransmitting its query while the lookup is pending is ignored.
+    ///
+    /// @param clientid Client identifier, may be null.
+    /// @param hwaddr Hardware address.
+    /// @param handler Handler invoked in the main thread with the leases.
+    /// @return false when the lookup was not started because a lookup for
+    /// the hardware address is pending or the maximum number of pending
+    /// lookups is reached, true otherwise.
+    bool getClientLeases4(const ClientIdPtr& clientid, const HWAddrPtr& hwaddr,
+                          const ClientLeases4Handler& handler);
+
+    /// @brief Returns the number of pending lookups.
+    size_t getPending() const;
+
+    /// @brief Waits for the pending lookups and completes them.
+    ///
+    /// It is called before the lease backend is reconfigured.
+    ///
+    /// @throw isc::db::DbOperationError if the connectivity was lost and
+    /// is not recovered, see @ref runReadyIO.
+    void wait();
+
+    /// @brief Invokes the handlers of the completed lookups.
+    ///
+    /// When a lookup lost the connectivity to the database, the lost
+    /// connectivity callback is invoked once before the handlers.
+    ///
+    /// @throw isc::db::DbOperationError if the connectivity was lost and
+    /// the callback is not set or doesn't attempt to reconnect.
+    void runReadyIO();
+
+private:
+
+    /// @brief Lookup of the leases of a client.
+    struct Lookup {
+        /// @brief Hardware address of the client.
+        HWAddrPtr hwaddr_;
+
+        /// @brief Leases of the client, null when the lookup failed.
+        ClientLeases4Ptr leases_;
+
+        /// @brief Completion handler.
+        ClientLeases4Handler handler_;
+
+        /// @brief Reconnect control saved when the connectivity was lost.
+        db::ReconnectCtlPtr db_lost_;
+    };
+
+    /// @brief Main function of the lookup threads.
+    void lookupLoop();
+
+    /// @brief Performs a lookup.
+    ///
+    /// @param lookup Lookup to perform.
+    void lookup(Lookup& lookup);
+
+    /// @brief Lookups not yet taken by a thread.
+    std::list<Lookup> queue_;
+
+    /// @brief Lookups done and waiting for their handler.
+    std::list<Lookup> done_;
+
+    /// @brief Hardware addresses of the pending lookups.
+    std::set<std::vector<uint8_t> > in_flight_;
+
+    /// @brief Maximum number of pending lookups.
+    const size_t max_pending_;
+
+    /// @brief Indicates if the threads must stop.
+    bool stopping_;
+
+    /// @brief Mutex protecting the lookup lists.
+    mutable util::thread::Mutex mutex_;
+
+    /// @brief Condition signaled when a lookup is queued.
+    util::thread::CondVar queued_;
+
+    /// @brief Condition signaled when a lookup is done.
+    util::thread::CondVar done_cond_;
+
+    /// @brief Socket marked ready when lookups are done.
+    util::WatchSocket watch_socket_;
+
+    /// @brief Lookup threads.
+    std::vector<boost::shared_ptr<util::thread::Thread> > threads_;
+};
+
+/// @brief Pointer to an @c AsyncLeaseLookup.
+typedef boost::shared_ptr<AsyncLeaseLookup> AsyncLeaseLookupPtr;
+
+} // namespace dhcp
+} // namespace isc
+
+#endif // ASYNC_LEASE_LOOKUP_H
@@ -31,11 +31,32 @@
 #include <dhcpsrv/host_data_source_factory.h>
 #include <dhcpsrv/testutils/host_data_source_utils.h>
 
+#include <fstream>
+#include <unistd.h>
+
 using isc::asiolink::IOAddress;
 using isc::dhcp::test::HostDataSourceUtils;
 using std::cerr;
 using std::endl;
 
+namespace {
+
+/// @brief Returns the resident set size of the process.
+///
+/// @return Resident set size in bytes or 0 if it can't be determined.
+size_t
+getResidentMemory() {
+    std::ifstream statm("/proc/self/statm");
+    size_t total_pages = 0;
+    size_t resident_pages = 0;
+    if (!(statm >> total_pages >> resident_pages)) {
+        return (0);
+    }
+    return (resident_pages * static_cast<size_t>(sysconf(_SC_PAGESIZE)));
+}
+
+}
+
 namespace isc {
 namespace dhcp {
 namespace bench {
@@ -188,6 +209,17 @@ GenericHostDataSourceBenchmark::insertHosts() {
     }
 }
 
+void
+GenericHostDataSourceBenchmark::insertHostsMeasureMemory(::benchmark::State& state) {
+    const size_t before = getResidentMemory();
+    insertHosts();
+    const size_t after = getResidentMemory();
+    if (!hosts_.empty() && (after > before)) {
+        state.counters["bytes_per_host"] =
+            static_cast<double>(after - before) / hosts_.size();
+    }
+}
+
 void
 GenericHostDataSourceBenchmark::benchGetAll() {
     for (HostPtr host : hosts_) {
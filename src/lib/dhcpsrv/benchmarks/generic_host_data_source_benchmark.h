@@ -182,6 +182,15 @@ public:
     /// @brief Inserts all hosts stored in hosts_ into the benchmarked host backend
     void insertHosts();
 
+    /// @brief Inserts all hosts stored in hosts_ and reports the memory
+    ///        used per host as the "bytes_per_host" counter.
+    ///
+    /// The memory is measured as the growth of the resident set size of
+    /// the process, so it is only meaningful for in-memory backends.
+    ///
+    /// @param state reference to the state of the benchmark
+    void insertHostsMeasureMemory(::benchmark::State& state);
+
     /// @brief Essential steps required to benchmark the
     ///        getAll(identifier-type, identifier) call.
     void benchGetAll();
@@ -0,0 +1,118 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcp/iface_mgr.h>
+#include <dhcpsrv/cb_notify_fifo.h>
+#include <dhcpsrv/dhcpsrv_log.h>
+#include <exceptions/exceptions.h>
+
+#include <boost/bind.hpp>
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace isc {
+namespace dhcp {
+
+CBNotifyFifo::CBNotifyFifo()
+    : path_(), read_fd_(-1), write_fd_(-1), callback_() {
+}
+
+CBNotifyFifo::~CBNotifyFifo() {
+    close();
+}
+
+void
+CBNotifyFifo::open(const std::string& path, const Callback& callback) {
+    close();
+
+    if ((mkfifo(path.c_str(), S_IRUSR | S_IWUSR) < 0) && (errno != EEXIST)) {
+        isc_throw(Unexpected, "failed to create the config backend "
+                  "notification pipe " << path << ": " << strerror(errno));
+    }
+
+    struct stat st;
+    if ((stat(path.c_str(), &st) < 0) || !S_ISFIFO(st.st_mode)) {
+        isc_throw(Unexpected, "the config backend notification pipe "
+                  << path << " is not a named pipe");
+    }
+
+    // Opening the reading end first does not block with O_NONBLOCK and
+    // then the writing end can be opened without blocking either.
+    read_fd_ = ::open(path.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+    if (read_fd_ < 0) {
+        isc_throw(Unexpected, "failed to open the config backend "
+                  "notification pipe " << path << ": " << strerror(errno));
+    }
+    write_fd_ = ::open(path.c_str(), O_WRONLY | O_NONBLOCK | O_CLOEXEC);
+    if (write_fd_ < 0) {
+        const int error = errno;
+        close();
+        isc_throw(Unexpected, "failed to open the config backend "
+                  "notification pipe " << path << ": " << strerror(error));
+    }
+
+    path_ = path;
+    callback_ = callback;
+    IfaceMgr::instance().addExternalSocket(read_fd_,
+                                           boost::bind(&CBNotifyFifo::receive,
+                                                       this));
+
+    LOG_INFO(dhcpsrv_logger, DHCPSRV_CB_NOTIFY_FIFO_OPENED).arg(path_);
+}
+
+void
+CBNotifyFifo::close() {
+    if (read_fd_ >= 0) {
+        IfaceMgr::instance().deleteExternalSocket(read_fd_);
+        static_cast<void>(::close(read_fd_));
+        read_fd_ = -1;
+    }
+    if (write_fd_ >= 0) {
+        static_cast<void>(::close(write_fd_));
+        write_fd_ = -1;
+    }
+    callback_ = Callback();
+}
+
+void
+CBNotifyFifo::receive() {
+    // Drain the pipe: all the pending notifications cause one fetch.
+    char buf[512];
+    size_t received = 0;
+    for (;;) {
+        const ssize_t len = read(read_fd_, buf, sizeof(buf));
+        if (len > 0) {
+            received += static_cast<size_t>(len);
+            continue;
+        }
+        if ((len < 0) && (errno == EINTR)) {
+            continue;
+        }
+        break;
+    }
+
+    if (received == 0) {
+        return;
+    }
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CB_NOTIFY_RECEIVED)
+        .arg(path_).arg(received);
+
+    // The callback may close or reopen the pipe: call a copy.
+    Callback callback = callback_;
+    if (callback) {
+        callback();
+    }
+}
+
+} // namespace dhcp
+} // namespace isc
@@ -0,0 +1,88 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef CB_NOTIFY_FIFO_H
+#define CB_NOTIFY_FIFO_H
+
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <string>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Named pipe notifying the server of config backend changes.
+///
+/// The servers poll the config backends for changes every
+/// config-fetch-wait-time. When the path of a named pipe is set in the
+/// notify-fifo parameter of the config-control, the server also fetches
+/// the changes as soon as anything is written to this pipe, e.g. by the
+/// tool which has just modified the configuration in the database: the
+/// changes are applied immediately and the polling interval can be much
+/// longer, or polling disabled.
+///
+/// The notifications written before the server reads the pipe are
+/// coalesced into one fetch. The pipe is watched by the @c IfaceMgr so
+/// the notifications interrupt the wait for packets.
+class CBNotifyFifo : public boost::noncopyable {
+public:
+
+    /// @brief Type of the function invoked upon notification.
+    typedef boost::function<void()> Callback;
+
+    /// @brief Constructor.
+    CBNotifyFifo();
+
+    /// @brief Destructor.
+    ///
+    /// Closes the pipe.
+    ~CBNotifyFifo();
+
+    /// @brief Opens the pipe and starts watching it.
+    ///
+    /// The pipe is created if it does not exist. A pipe which is already
+    /// open is closed first.
+    ///
+    /// @param path Path of the pipe.
+    /// @param callback Function invoked upon notification.
+    /// @throw isc::Unexpected if the pipe can't be created or opened.
+    void open(const std::string& path, const Callback& callback);
+
+    /// @brief Stops watching the pipe and closes it.
+    void close();
+
+    /// @brief Checks if the pipe is open.
+    bool isOpen() const {
+        return (read_fd_ >= 0);
+    }
+
+    /// @brief Reads all pending notifications and invokes the callback.
+    ///
+    /// It is invoked by the @c IfaceMgr when the pipe is readable.
+    void receive();
+
+private:
+
+    /// @brief Path of the pipe.
+    std::string path_;
+
+    /// @brief Descriptor the notifications are read from.
+    int read_fd_;
+
+    /// @brief Descriptor opened for writing and never written.
+    ///
+    /// It keeps the pipe open when the notifying processes close it,
+    /// otherwise the pipe would remain readable (at the end of file).
+    int write_fd_;
+
+    /// @brief Function invoked upon notification.
+    Callback callback_;
+};
+
+} // namespace dhcp
+} // namespace isc
+
+#endif // CB_NOTIFY_FIFO_H
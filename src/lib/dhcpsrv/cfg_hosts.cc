@@ -437,17 +437,24 @@ CfgHosts::get4(const SubnetID& subnet_id, const IOAddress& address) const {
     LOG_DEBUG(hosts_logger, HOSTS_DBG_TRACE, HOSTS_CFG_GET_ONE_SUBNET_ID_ADDRESS4)
         .arg(subnet_id).arg(address.toText());
 
-    ConstHostCollection hosts = getAll4(address);
-    for (ConstHostCollection::const_iterator host = hosts.begin();
-         host != hosts.end(); ++host) {
-        if ((*host)->getIPv4SubnetID() == subnet_id) {
-            LOG_DEBUG(hosts_logger, HOSTS_DBG_RESULTS,
-                      HOSTS_CFG_GET_ONE_SUBNET_ID_ADDRESS4_HOST)
-                .arg(subnet_id)
-                .arg(address.toText())
-                .arg((*host)->toText());
-            return (*host);
-        }
+    // Must not specify address other than IPv4.
+    if (!address.isV4()) {
+        isc_throw(BadHostAddress, "must specify an IPv4 address when searching"
+                  " for a host, specified address was " << address);
+    }
+
+    // Search for the Host using the reserved IPv4 address and the subnet
+    // id as a key.
+    const HostContainerIndex7& idx = hosts_.get<7>();
+    HostContainerIndex7Range r = idx.equal_range(boost::make_tuple(address,
+                                                                   subnet_id));
+    if (r.first != r.second) {
+        LOG_DEBUG(hosts_logger, HOSTS_DBG_RESULTS,
+                  HOSTS_CFG_GET_ONE_SUBNET_ID_ADDRESS4_HOST)
+            .arg(subnet_id)
+            .arg(address.toText())
+            .arg((*r.first)->toText());
+        return (*r.first);
     }
 
     LOG_DEBUG(hosts_logger, HOSTS_DBG_RESULTS, HOSTS_CFG_GET_ONE_SUBNET_ID_ADDRESS4_NULL)
@@ -577,15 +584,15 @@ CfgHosts::getAllInternal6(const SubnetID& subnet_id,
     }
 
     // Let's get all reservations that match subnet_id, address.
-    const HostContainer6Index1& idx = hosts6_.get<1>();
-    HostContainer6Index1Range r = make_pair(idx.lower_bound(boost::make_tuple(subnet_id, address)),
-                                            idx.upper_bound(boost::make_tuple(subnet_id, address)));
+    const HostContainer6Index3& idx = hosts6_.get<3>();
+    HostContainer6Index3Range r = idx.equal_range(boost::make_tuple(subnet_id,
+                                                                    address));
 
     // For each IPv6 reservation, add the host to the results list. Fortunately,
     // in all sane cases, there will be only one such host. (Each host can have
     // multiple addresses reserved, but for each (address, subnet_id) there should
     // be at most one host reserving it).
-    for(HostContainer6Index1::iterator resrv = r.first; resrv != r.second; ++resrv) {
+    for(HostContainer6Index3::iterator resrv = r.first; resrv != r.second; ++resrv) {
         LOG_DEBUG(hosts_logger, HOSTS_DBG_TRACE_DETAIL_DATA,
                   HOSTS_CFG_GET_ALL_SUBNET_ID_ADDRESS6_HOST)
             .arg(subnet_id)
@@ -612,43 +619,44 @@ CfgHosts::getHostInternal(const SubnetID& subnet_id, const bool subnet6,
         .arg(subnet_id)
         .arg(Host::getIdentifierAsText(identifier_type, identifier, identifier_len));
 
-    // Get all hosts for a specified identifier. This may return multiple hosts
-    // for different subnets, but the number of hosts returned should be low
-    // because one host presumably doesn't show up in many subnets.
+    // Get the hosts for a specified identifier within the subnet using
+    // the hashed index for the subnet type.
+    boost::tuple<const std::vector<uint8_t>, const Host::IdentifierType,
+                 const SubnetID> t =
+        boost::make_tuple(std::vector<uint8_t>(identifier,
+                                               identifier + identifier_len),
+                          identifier_type, subnet_id);
     HostCollection hosts;
-    getAllInternal<HostCollection>(identifier_type, identifier, identifier_len,
-                                   hosts);
+    if (subnet6) {
+        const HostContainerIndex6& idx = hosts_.get<6>();
+        HostContainerIndex6Range r = idx.equal_range(t);
+        hosts.assign(r.first, r.second);
+
+    } else {
+        const HostContainerIndex5& idx = hosts_.get<5>();
+        HostContainerIndex5Range r = idx.equal_range(t);
+        hosts.assign(r.first, r.second);
+    }
+
+    // If we find that there is more than one @c Host object for the same
+    // client in the subnet, it is a misconfiguration. Most likely, the
+    // administrator has specified one reservation for a HW address and
+    // another one for the DUID, which gives an ambiguous result, and we
+    // don't know which reservation we should choose. Therefore, throw an
+    // exception.
+    if (hosts.size() > 1) {
+        isc_throw(DuplicateHost,  "more than one reservation found"
+                  " for the host belonging to the subnet with id '"
+                  << subnet_id << "' and using the identifier '"
+                  << Host::getIdentifierAsText(identifier_type,
+                                               identifier,
+                                               identifier_len)
+                  << "'");
+    }
 
     HostPtr host;
-    // Iterate over the returned hosts and select those for which the
-    // subnet id matches.
-    for (HostCollection::const_iterator host_it = hosts.begin();
-         host_it != hosts.end(); ++host_it) {
-        // Check if this is IPv4 subnet or IPv6 subnet.
-        SubnetID host_subnet_id = subnet6 ? (*host_it)->getIPv6SubnetID() :
-            (*host_it)->getIPv4SubnetID();
-
-        if (subnet_id == host_subnet_id) {
-            // If this is the first occurrence of the host for this subnet,
-            // remember it. But, if we find that this is second @c Host object
-            // for the same client, it is a misconfiguration. Most likely,
-            // the administrator has specified one reservation for a HW
-            // address and another one for the DUID, which gives an ambiguous
-            // result, and we don't know which reservation we should choose.
-            // Therefore, throw an exception.
-            if (!host) {
-                host = *host_it;
-
-            } else {
-                isc_throw(DuplicateHost,  "more than one reservation found"
-                          " for the host belonging to the subnet with id '"
-                          << subnet_id << "' and using the identifier '"
-                          << Host::getIdentifierAsText(identifier_type,
-                                                       identifier,
-                                                       identifier_len)
-                          << "'");
-            }
-        }
+    if (!hosts.empty()) {
+        host = hosts.front();
     }
 
     if (host) {
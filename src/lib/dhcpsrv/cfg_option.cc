@@ -49,7 +49,8 @@ OptionDescriptor::equals(const OptionDescriptor& other) const {
             option_->equals(other.option_));
 }
 
-CfgOption::CfgOption() {
+CfgOption::CfgOption()
+    : modification_count_(0) {
 }
 
 bool
@@ -84,6 +85,7 @@ CfgOption::add(const OptionDescriptor& desc, const std::string& option_space) {
                   << option_space << "'");
     }
 
+    ++modification_count_;
     const uint32_t vendor_id = LibDHCP::optionSpaceToVendorId(option_space);
     if (vendor_id) {
         vendor_options_.addItem(desc, vendor_id);
@@ -114,6 +116,7 @@ CfgOption::replace(const OptionDescriptor& desc, const std::string& option_space
                   << ", it does not exist");
     } 
 
+    ++modification_count_;
     idx.replace(od_itr, desc);
 }
 
@@ -230,6 +233,7 @@ CfgOption::createDescriptorOption(CfgOptionDefPtr cfg_def, const std::string& sp
 
 void
 CfgOption::mergeTo(CfgOption& other) const {
+    ++other.modification_count_;
     // Merge non-vendor options.
     mergeInternal(options_, other.options_);
     // Merge vendor options.
@@ -246,12 +250,49 @@ CfgOption::copyTo(CfgOption& other) const {
 
 void
 CfgOption::encapsulate() {
+    // Encapsulation modifies the options, so the wire data of the
+    // options containing them is no longer valid.
+    clearWireData();
+    ++modification_count_;
     // Append sub-options to the top level "dhcp4" option space.
     encapsulateInternal(DHCP4_OPTION_SPACE);
     // Append sub-options to the top level "dhcp6" option space.
     encapsulateInternal(DHCP6_OPTION_SPACE);
 }
 
+void
+CfgOption::cacheWireData() {
+    // Encapsulated options are also present in their own option spaces,
+    // so discarding the data for all of them makes sure that no stale
+    // data is used when rendering the options encapsulating them.
+    clearWireData();
+    forEachOption(options_, &Option::cacheWireData);
+    forEachOption(vendor_options_, &Option::cacheWireData);
+}
+
+void
+CfgOption::clearWireData() {
+    forEachOption(options_, &Option::clearWireData);
+    forEachOption(vendor_options_, &Option::clearWireData);
+}
+
+template <typename Selector>
+void
+CfgOption::forEachOption(const OptionSpaceContainer<OptionContainer,
+                         OptionDescriptor, Selector>& container,
+                         void (Option::*method)()) {
+    std::list<Selector> selectors = container.getOptionSpaceNames();
+    for (auto selector = selectors.cbegin(); selector != selectors.cend();
+         ++selector) {
+        OptionContainerPtr options = container.getItems(*selector);
+        for (auto desc = options->cbegin(); desc != options->cend(); ++desc) {
+            if (desc->option_) {
+                ((*desc->option_).*method)();
+            }
+        }
+    }
+}
+
 void
 CfgOption::encapsulateInternal(const std::string& option_space) {
     // Get all options for the particular option space.
@@ -369,6 +410,7 @@ CfgOption::del(const std::string& option_space, const uint16_t option_code) {
         }
     }
 
+    ++modification_count_;
     auto& idx = options->get<1>();
     return (idx.erase(option_code));
 }
@@ -382,6 +424,7 @@ CfgOption::del(const uint32_t vendor_id, const uint16_t option_code) {
         return (0);
     }
 
+    ++modification_count_;
     auto& idx = vendor_options->get<1>();
     return (idx.erase(option_code));
 }
@@ -413,6 +456,7 @@ CfgOption::del(const uint64_t id) {
 
     // Now that we got rid of dependencies between the instances of the options
     // we can delete all options having a specified id.
+    ++modification_count_;
     size_t num_deleted = options_.deleteItems(id) + vendor_options_.deleteItems(id);
 
     // Let's encapsulate those options that remain in the configuration.
@@ -488,6 +488,29 @@ public:
     /// options from this option space are appended to top-level options.
     void encapsulate();
 
+    /// @brief Renders all options in wire format and caches the result.
+    ///
+    /// This method is called for the committed configuration, so as the
+    /// configured options don't have to be rendered every time they are
+    /// sent to a client. Any previously cached data is discarded first.
+    /// See @ref Option::cacheWireData for details.
+    void cacheWireData();
+
+    /// @brief Discards wire data cached for all options.
+    void clearWireData();
+
+    /// @brief Returns the number of modifications of this configuration.
+    ///
+    /// The counter is incremented by the methods adding, replacing,
+    /// merging, encapsulating or deleting options, so as the users
+    /// holding results derived from the configuration, such as the
+    /// @c CfgOptionListCache, can detect that they are outdated.
+    ///
+    /// @return Modification counter.
+    uint64_t getModificationCount() const {
+        return (modification_count_);
+    }
+
     /// @brief Returns all options for the specified option space.
     ///
     /// This method will not return vendor options, i.e. having option space
@@ -652,6 +675,16 @@ private:
     /// @param option which encapsulated options.
     void encapsulateInternal(const OptionPtr& option);
 
+    /// @brief Invokes a method of each option in an option container.
+    ///
+    /// @param container Reference to the option container.
+    /// @param method Pointer to the @c Option method to be invoked.
+    /// @tparam Type of the selector: @c std::string or @c uint32_t.
+    template <typename Selector>
+    static void forEachOption(const OptionSpaceContainer<OptionContainer,
+                              OptionDescriptor, Selector>& container,
+                              void (Option::*method)());
+
     /// @brief Merges data from two option containers.
     ///
     /// This method merges options from one option container to another
@@ -682,6 +715,9 @@ private:
                                  uint32_t> VendorOptionSpaceCollection;
     /// @brief Container holding options grouped by vendor id.
     VendorOptionSpaceCollection vendor_options_;
+
+    /// @brief Number of modifications of this configuration.
+    uint64_t modification_count_;
 };
 
 /// @name Pointers to the @c CfgOption objects.
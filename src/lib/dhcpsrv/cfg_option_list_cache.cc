@@ -0,0 +1,121 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/cfg_option_list_cache.h>
+#include <algorithm>
+
+namespace isc {
+namespace dhcp {
+
+ResolvedCfgOption::ResolvedCfgOption(const CfgOptionList& co_list,
+                                     const std::string& option_space)
+    : options_(), persistent_codes_() {
+    for (CfgOptionList::const_iterator copts = co_list.begin();
+         copts != co_list.end(); ++copts) {
+        OptionContainerPtr opts = (*copts)->getAll(option_space);
+        if (!opts) {
+            continue;
+        }
+        for (OptionContainer::const_iterator desc = opts->begin();
+             desc != opts->end(); ++desc) {
+            if (!desc->option_) {
+                continue;
+            }
+            uint16_t code = desc->option_->getType();
+            // The configurations are ordered by precedence, so the first
+            // option found with the given code is used.
+            options_.insert(std::make_pair(code, desc->option_));
+            if (desc->persistent_ &&
+                (std::find(persistent_codes_.begin(), persistent_codes_.end(),
+                           code) == persistent_codes_.end())) {
+                persistent_codes_.push_back(code);
+            }
+        }
+    }
+}
+
+OptionPtr
+ResolvedCfgOption::get(const uint16_t code) const {
+    auto opt = options_.find(code);
+    if (opt != options_.end()) {
+        return (opt->second);
+    }
+    return (OptionPtr());
+}
+
+const size_t CfgOptionListCache::DEFAULT_MAX_SIZE;
+
+CfgOptionListCache::CfgOptionListCache(const size_t max_size)
+    : cfg_options_(), cache_(), max_size_(max_size), mutex_() {
+}
+
+void
+CfgOptionListCache::add(const ConstCfgOptionPtr& cfg_option) {
+    if (cfg_option) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cfg_options_.insert(cfg_option);
+    }
+}
+
+ConstResolvedCfgOptionPtr
+CfgOptionListCache::get(const CfgOptionList& co_list,
+                        const std::string& option_space) {
+    Key key(option_space, std::vector<const CfgOption*>());
+    key.second.reserve(co_list.size());
+    std::vector<uint64_t> modifications;
+    modifications.reserve(co_list.size());
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (CfgOptionList::const_iterator copts = co_list.begin();
+         copts != co_list.end(); ++copts) {
+        if (cfg_options_.count(*copts) == 0) {
+            // This configuration doesn't belong to the cached ones, e.g.
+            // it comes from a host reservation.
+            return (ConstResolvedCfgOptionPtr());
+        }
+        key.second.push_back(copts->get());
+        modifications.push_back((*copts)->getModificationCount());
+    }
+
+    auto cached = cache_.find(key);
+    if ((cached != cache_.end()) &&
+        (cached->second.modifications_ == modifications)) {
+        return (cached->second.resolved_);
+    }
+
+    // Either the list has not been seen yet or some of its configurations
+    // have been modified since the options were resolved.
+    ConstResolvedCfgOptionPtr resolved(new ResolvedCfgOption(co_list,
+                                                             option_space));
+    if (cached != cache_.end()) {
+        cached->second.resolved_ = resolved;
+        cached->second.modifications_.swap(modifications);
+
+    } else if (cache_.size() < max_size_) {
+        Entry& entry = cache_[key];
+        entry.resolved_ = resolved;
+        entry.modifications_.swap(modifications);
+    }
+    return (resolved);
+}
+
+void
+CfgOptionListCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cache_.clear();
+    cfg_options_.clear();
+}
+
+size_t
+CfgOptionListCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (cache_.size());
+}
+
+} // namespace isc::dhcp
+} // namespace isc
@@ -0,0 +1,165 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef CFG_OPTION_LIST_CACHE_H
+#define CFG_OPTION_LIST_CACHE_H
+
+#include <dhcp/option.h>
+#include <dhcpsrv/cfg_option.h>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <map>
+#include <mutex>
+#include <set>
+#include <stdint.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Options selected from an ordered list of option configurations.
+///
+/// The server sends a requested option using the configuration from the
+/// most specific scope (e.g. pool, subnet, shared network, client class,
+/// global) which defines it. The server builds a list of @c CfgOption
+/// objects, ordered by precedence, and searches it for each requested
+/// option. This class holds the outcome of this search for all options
+/// from the given option space, so as it can be performed once for all
+/// clients using the same list.
+class ResolvedCfgOption {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param co_list List of option configurations ordered by precedence.
+    /// @param option_space Option space from which the options are taken.
+    ResolvedCfgOption(const CfgOptionList& co_list,
+                      const std::string& option_space);
+
+    /// @brief Returns the option with the specified code.
+    ///
+    /// @param code Option code.
+    /// @return Option taken from the first configuration in the list which
+    /// defines it or null pointer if there is no such option.
+    OptionPtr get(const uint16_t code) const;
+
+    /// @brief Returns the codes of options which are always sent.
+    ///
+    /// @return Codes of the options configured as persistent in any of
+    /// the configurations in the list, in the order of precedence.
+    const std::vector<uint16_t>& getPersistentCodes() const {
+        return (persistent_codes_);
+    }
+
+private:
+
+    /// @brief Options by code.
+    std::map<uint16_t, OptionPtr> options_;
+
+    /// @brief Codes of the persistent options.
+    std::vector<uint16_t> persistent_codes_;
+};
+
+/// @brief Pointer to the @c ResolvedCfgOption.
+typedef boost::shared_ptr<const ResolvedCfgOption> ConstResolvedCfgOptionPtr;
+
+/// @brief Cache of the options resolved for lists of option configurations.
+///
+/// The lists of option configurations built for the clients depend on the
+/// subnet, pool, shared network and client classes, so there are only few
+/// distinct lists even for many clients. This cache holds the options
+/// resolved for each list seen so far.
+///
+/// Only the lists made of option configurations which have been added
+/// to the cache using @ref add are cached. The lists including other
+/// configurations, e.g. host specific options, are not cached and the
+/// caller has to search them on its own. The number of cached lists is
+/// also limited; when the limit is reached the options are resolved for
+/// the new lists without caching them.
+///
+/// A cached entry is discarded and resolved again when any of the
+/// option configurations in its list has been modified since, as
+/// reported by @c CfgOption::getModificationCount. The cache belongs to
+/// the server configuration and is rebuilt when the configuration is
+/// committed or updated.
+///
+/// The cache can be used from multiple threads.
+class CfgOptionListCache : public boost::noncopyable {
+public:
+
+    /// @brief Default maximum number of cached lists.
+    static const size_t DEFAULT_MAX_SIZE = 1024;
+
+    /// @brief Constructor.
+    ///
+    /// @param max_size Maximum number of cached lists.
+    explicit CfgOptionListCache(const size_t max_size = DEFAULT_MAX_SIZE);
+
+    /// @brief Adds an option configuration which may be a part of the
+    /// cached lists.
+    ///
+    /// @param cfg_option Pointer to the option configuration.
+    void add(const ConstCfgOptionPtr& cfg_option);
+
+    /// @brief Returns the options resolved for the list of option
+    /// configurations.
+    ///
+    /// The options are resolved and cached upon the first call for the
+    /// list.
+    ///
+    /// @param co_list List of option configurations ordered by precedence.
+    /// @param option_space Option space from which the options are taken.
+    /// @return Pointer to the resolved options or null pointer if the list
+    /// includes option configurations not added to the cache.
+    ConstResolvedCfgOptionPtr get(const CfgOptionList& co_list,
+                                  const std::string& option_space);
+
+    /// @brief Removes all option configurations and resolved options.
+    void clear();
+
+    /// @brief Returns the number of cached lists.
+    size_t size() const;
+
+private:
+
+    /// @brief Resolved options and the modification counters of the
+    /// option configurations they were resolved from.
+    struct Entry {
+        /// @brief Resolved options.
+        ConstResolvedCfgOptionPtr resolved_;
+
+        /// @brief Modification counters, in the order of the list.
+        std::vector<uint64_t> modifications_;
+    };
+
+    /// @brief Key of the cache: option space and list of configurations.
+    typedef std::pair<std::string, std::vector<const CfgOption*> > Key;
+
+    /// @brief Option configurations which may be a part of cached lists.
+    ///
+    /// Holding the pointers guarantees that the addresses used in the keys
+    /// are not reused by other objects.
+    std::set<ConstCfgOptionPtr> cfg_options_;
+
+    /// @brief Resolved options by list of configurations.
+    std::map<Key, Entry> cache_;
+
+    /// @brief Maximum number of cached lists.
+    size_t max_size_;
+
+    /// @brief Mutex protecting the cache.
+    mutable std::mutex mutex_;
+};
+
+/// @brief Pointer to the @c CfgOptionListCache.
+typedef boost::shared_ptr<CfgOptionListCache> CfgOptionListCachePtr;
+
+} // namespace isc::dhcp
+} // namespace isc
+
+#endif // CFG_OPTION_LIST_CACHE_H
@@ -492,6 +492,9 @@ CfgSubnets4::removeStatistics() {
 
         stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
                                              "reclaimed-leases"));
+
+        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                             "v4-lease-reuses"));
     }
 }
 
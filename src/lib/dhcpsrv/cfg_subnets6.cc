@@ -408,6 +408,12 @@ CfgSubnets6::removeStatistics() {
 
         stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
                                              "reclaimed-leases"));
+
+        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                             "v6-ia-na-lease-reuses"));
+
+        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                             "v6-ia-pd-lease-reuses"));
     }
 }
 
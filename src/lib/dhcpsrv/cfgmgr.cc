@@ -109,6 +109,9 @@ CfgMgr::commit() {
 
     // Now we need to set the statistics back.
     configuration_->updateStatistics();
+
+    // Render the configured options once for all responses.
+    configuration_->updateOptionsCache();
 }
 
 void
@@ -196,9 +199,11 @@ CfgMgr::mergeIntoCurrentCfg(const uint32_t seq) {
     } catch (...) {
         // Make sure the statistics is updated even if the merge failed.
         getCurrentCfg()->updateStatistics();
+        getCurrentCfg()->updateOptionsCache();
         throw;
     }
     getCurrentCfg()->updateStatistics();
+    getCurrentCfg()->updateOptionsCache();
 }
 
 void
@@ -7,6 +7,8 @@
 namespace isc {
 namespace dhcp {
 
+extern const isc::log::MessageID DHCPSRV_CB_NOTIFY_FIFO_OPENED = "DHCPSRV_CB_NOTIFY_FIFO_OPENED";
+extern const isc::log::MessageID DHCPSRV_CB_NOTIFY_RECEIVED = "DHCPSRV_CB_NOTIFY_RECEIVED";
 extern const isc::log::MessageID DHCPSRV_CFGMGR_ADD_IFACE = "DHCPSRV_CFGMGR_ADD_IFACE";
 extern const isc::log::MessageID DHCPSRV_CFGMGR_ADD_SUBNET4 = "DHCPSRV_CFGMGR_ADD_SUBNET4";
 extern const isc::log::MessageID DHCPSRV_CFGMGR_ADD_SUBNET6 = "DHCPSRV_CFGMGR_ADD_SUBNET6";
@@ -95,6 +97,8 @@ extern const isc::log::MessageID DHCPSRV_HOOK_LEASE6_EXTEND_SKIP = "DHCPSRV_HOOK
 extern const isc::log::MessageID DHCPSRV_HOOK_LEASE6_RECOVER_SKIP = "DHCPSRV_HOOK_LEASE6_RECOVER_SKIP";
 extern const isc::log::MessageID DHCPSRV_HOOK_LEASE6_SELECT_SKIP = "DHCPSRV_HOOK_LEASE6_SELECT_SKIP";
 extern const isc::log::MessageID DHCPSRV_INVALID_ACCESS = "DHCPSRV_INVALID_ACCESS";
+extern const isc::log::MessageID DHCPSRV_LEASE_LOOKUP_DB_LOST = "DHCPSRV_LEASE_LOOKUP_DB_LOST";
+extern const isc::log::MessageID DHCPSRV_LEASE_LOOKUP_FAILED = "DHCPSRV_LEASE_LOOKUP_FAILED";
 extern const isc::log::MessageID DHCPSRV_LEASE_SANITY_FAIL = "DHCPSRV_LEASE_SANITY_FAIL";
 extern const isc::log::MessageID DHCPSRV_LEASE_SANITY_FAIL_DISCARD = "DHCPSRV_LEASE_SANITY_FAIL_DISCARD";
 extern const isc::log::MessageID DHCPSRV_LEASE_SANITY_FIXED = "DHCPSRV_LEASE_SANITY_FIXED";
@@ -159,6 +163,7 @@ extern const isc::log::MessageID DHCPSRV_MYSQL_DELETE_ADDR = "DHCPSRV_MYSQL_DELE
 extern const isc::log::MessageID DHCPSRV_MYSQL_DELETE_EXPIRED_RECLAIMED4 = "DHCPSRV_MYSQL_DELETE_EXPIRED_RECLAIMED4";
 extern const isc::log::MessageID DHCPSRV_MYSQL_DELETE_EXPIRED_RECLAIMED6 = "DHCPSRV_MYSQL_DELETE_EXPIRED_RECLAIMED6";
 extern const isc::log::MessageID DHCPSRV_MYSQL_FATAL_ERROR = "DHCPSRV_MYSQL_FATAL_ERROR";
+extern const isc::log::MessageID DHCPSRV_MYSQL_FIND_FREE_ADDR4 = "DHCPSRV_MYSQL_FIND_FREE_ADDR4";
 extern const isc::log::MessageID DHCPSRV_MYSQL_GET4 = "DHCPSRV_MYSQL_GET4";
 extern const isc::log::MessageID DHCPSRV_MYSQL_GET6 = "DHCPSRV_MYSQL_GET6";
 extern const isc::log::MessageID DHCPSRV_MYSQL_GET_ADDR4 = "DHCPSRV_MYSQL_GET_ADDR4";
@@ -197,6 +202,7 @@ extern const isc::log::MessageID DHCPSRV_PGSQL_DELETE_ADDR = "DHCPSRV_PGSQL_DELE
 extern const isc::log::MessageID DHCPSRV_PGSQL_DELETE_EXPIRED_RECLAIMED4 = "DHCPSRV_PGSQL_DELETE_EXPIRED_RECLAIMED4";
 extern const isc::log::MessageID DHCPSRV_PGSQL_DELETE_EXPIRED_RECLAIMED6 = "DHCPSRV_PGSQL_DELETE_EXPIRED_RECLAIMED6";
 extern const isc::log::MessageID DHCPSRV_PGSQL_FATAL_ERROR = "DHCPSRV_PGSQL_FATAL_ERROR";
+extern const isc::log::MessageID DHCPSRV_PGSQL_FIND_FREE_ADDR4 = "DHCPSRV_PGSQL_FIND_FREE_ADDR4";
 extern const isc::log::MessageID DHCPSRV_PGSQL_GET4 = "DHCPSRV_PGSQL_GET4";
 extern const isc::log::MessageID DHCPSRV_PGSQL_GET6 = "DHCPSRV_PGSQL_GET6";
 extern const isc::log::MessageID DHCPSRV_PGSQL_GET_ADDR4 = "DHCPSRV_PGSQL_GET_ADDR4";
@@ -241,6 +247,8 @@ extern const isc::log::MessageID DHCPSRV_UNKNOWN_DB = "DHCPSRV_UNKNOWN_DB";
 namespace {
 
 const char* values[] = {
+    "DHCPSRV_CB_NOTIFY_FIFO_OPENED", "watching the config backend notification pipe %1",
+    "DHCPSRV_CB_NOTIFY_RECEIVED", "received %2 bytes of notification over the config backend notification pipe %1",
     "DHCPSRV_CFGMGR_ADD_IFACE", "listening on interface %1",
     "DHCPSRV_CFGMGR_ADD_SUBNET4", "adding subnet %1",
     "DHCPSRV_CFGMGR_ADD_SUBNET6", "adding subnet %1",
@@ -329,6 +337,8 @@ const char* values[] = {
     "DHCPSRV_HOOK_LEASE6_RECOVER_SKIP", "DHCPv6 lease %1 was not recovered from declined state because a callout set the skip status.",
     "DHCPSRV_HOOK_LEASE6_SELECT_SKIP", "Lease6 (non-temporary) creation was skipped, because of callout skip flag.",
     "DHCPSRV_INVALID_ACCESS", "invalid database access string: %1",
+    "DHCPSRV_LEASE_LOOKUP_DB_LOST", "the connectivity to the database was lost during the lease lookups and the server does not attempt to reconnect",
+    "DHCPSRV_LEASE_LOOKUP_FAILED", "lookup of the leases of the client %1 failed: %2",
     "DHCPSRV_LEASE_SANITY_FAIL", "The lease %1 with subnet-id %2 failed subnet-id checks (%3).",
     "DHCPSRV_LEASE_SANITY_FAIL_DISCARD", "The lease %1 with subnet-id %2 failed subnet-id checks (%3) and was dropped.",
     "DHCPSRV_LEASE_SANITY_FIXED", "The lease %1 with subnet-id %2 failed subnet-id checks, but was corrected to subnet-id %3.",
@@ -393,6 +403,7 @@ const char* values[] = {
     "DHCPSRV_MYSQL_DELETE_EXPIRED_RECLAIMED4", "deleting reclaimed IPv4 leases that expired more than %1 seconds ago",
     "DHCPSRV_MYSQL_DELETE_EXPIRED_RECLAIMED6", "deleting reclaimed IPv6 leases that expired more than %1 seconds ago",
     "DHCPSRV_MYSQL_FATAL_ERROR", "Unrecoverable MySQL error occurred: %1 for <%2>, reason: %3 (error code: %4).",
+    "DHCPSRV_MYSQL_FIND_FREE_ADDR4", "searching free IPv4 addresses from %1 to %2",
     "DHCPSRV_MYSQL_GET4", "obtaining all IPv4 leases",
     "DHCPSRV_MYSQL_GET6", "obtaining all IPv6 leases",
     "DHCPSRV_MYSQL_GET_ADDR4", "obtaining IPv4 lease for address %1",
@@ -431,6 +442,7 @@ const char* values[] = {
     "DHCPSRV_PGSQL_DELETE_EXPIRED_RECLAIMED4", "deleting reclaimed IPv4 leases that expired more than %1 seconds ago",
     "DHCPSRV_PGSQL_DELETE_EXPIRED_RECLAIMED6", "deleting reclaimed IPv6 leases that expired more than %1 seconds ago",
     "DHCPSRV_PGSQL_FATAL_ERROR", "Unrecoverable PostgreSQL error occurred: Statement: <%1>, reason: %2 (error code: %3).",
+    "DHCPSRV_PGSQL_FIND_FREE_ADDR4", "searching free IPv4 addresses from %1 to %2",
     "DHCPSRV_PGSQL_GET4", "obtaining all IPv4 leases",
     "DHCPSRV_PGSQL_GET6", "obtaining all IPv6 leases",
     "DHCPSRV_PGSQL_GET_ADDR4", "obtaining IPv4 lease for address %1",
@@ -8,6 +8,8 @@
 namespace isc {
 namespace dhcp {
 
+extern const isc::log::MessageID DHCPSRV_CB_NOTIFY_FIFO_OPENED;
+extern const isc::log::MessageID DHCPSRV_CB_NOTIFY_RECEIVED;
 extern const isc::log::MessageID DHCPSRV_CFGMGR_ADD_IFACE;
 extern const isc::log::MessageID DHCPSRV_CFGMGR_ADD_SUBNET4;
 extern const isc::log::MessageID DHCPSRV_CFGMGR_ADD_SUBNET6;
@@ -96,6 +98,8 @@ extern const isc::log::MessageID DHCPSRV_HOOK_LEASE6_EXTEND_SKIP;
 extern const isc::log::MessageID DHCPSRV_HOOK_LEASE6_RECOVER_SKIP;
 extern const isc::log::MessageID DHCPSRV_HOOK_LEASE6_SELECT_SKIP;
 extern const isc::log::MessageID DHCPSRV_INVALID_ACCESS;
+extern const isc::log::MessageID DHCPSRV_LEASE_LOOKUP_DB_LOST;
+extern const isc::log::MessageID DHCPSRV_LEASE_LOOKUP_FAILED;
 extern const isc::log::MessageID DHCPSRV_LEASE_SANITY_FAIL;
 extern const isc::log::MessageID DHCPSRV_LEASE_SANITY_FAIL_DISCARD;
 extern const isc::log::MessageID DHCPSRV_LEASE_SANITY_FIXED;
@@ -160,6 +164,7 @@ extern const isc::log::MessageID DHCPSRV_MYSQL_DELETE_ADDR;
 extern const isc::log::MessageID DHCPSRV_MYSQL_DELETE_EXPIRED_RECLAIMED4;
 extern const isc::log::MessageID DHCPSRV_MYSQL_DELETE_EXPIRED_RECLAIMED6;
 extern const isc::log::MessageID DHCPSRV_MYSQL_FATAL_ERROR;
+extern const isc::log::MessageID DHCPSRV_MYSQL_FIND_FREE_ADDR4;
 extern const isc::log::MessageID DHCPSRV_MYSQL_GET4;
 extern const isc::log::MessageID DHCPSRV_MYSQL_GET6;
 extern const isc::log::MessageID DHCPSRV_MYSQL_GET_ADDR4;
@@ -198,6 +203,7 @@ extern const isc::log::MessageID DHCPSRV_PGSQL_DELETE_ADDR;
 extern const isc::log::MessageID DHCPSRV_PGSQL_DELETE_EXPIRED_RECLAIMED4;
 extern const isc::log::MessageID DHCPSRV_PGSQL_DELETE_EXPIRED_RECLAIMED6;
 extern const isc::log::MessageID DHCPSRV_PGSQL_FATAL_ERROR;
+extern const isc::log::MessageID DHCPSRV_PGSQL_FIND_FREE_ADDR4;
 extern const isc::log::MessageID DHCPSRV_PGSQL_GET4;
 extern const isc::log::MessageID DHCPSRV_PGSQL_GET6;
 extern const isc::log::MessageID DHCPSRV_PGSQL_GET_ADDR4;
@@ -88,6 +88,63 @@ typedef boost::multi_index_container<
             // Index using values returned by the @c Host::getHostId
             boost::multi_index::const_mem_fun<Host, uint64_t,
                                               &Host::getHostId>
+        >,
+
+        // Sixth index is used to search for the host using the identifier
+        // within the IPv4 subnet. It is hashed to provide constant time
+        // lookups of the reservations for a client.
+        boost::multi_index::hashed_non_unique<
+            boost::multi_index::composite_key<
+                Host,
+                boost::multi_index::const_mem_fun<
+                    Host, const std::vector<uint8_t>&,
+                    &Host::getIdentifier
+                >,
+                boost::multi_index::const_mem_fun<
+                    Host, Host::IdentifierType,
+                    &Host::getIdentifierType
+                >,
+                boost::multi_index::const_mem_fun<
+                    Host, SubnetID,
+                    &Host::getIPv4SubnetID
+                >
+            >
+        >,
+
+        // Seventh index is used to search for the host using the identifier
+        // within the IPv6 subnet.
+        boost::multi_index::hashed_non_unique<
+            boost::multi_index::composite_key<
+                Host,
+                boost::multi_index::const_mem_fun<
+                    Host, const std::vector<uint8_t>&,
+                    &Host::getIdentifier
+                >,
+                boost::multi_index::const_mem_fun<
+                    Host, Host::IdentifierType,
+                    &Host::getIdentifierType
+                >,
+                boost::multi_index::const_mem_fun<
+                    Host, SubnetID,
+                    &Host::getIPv6SubnetID
+                >
+            >
+        >,
+
+        // Eighth index is used to search for the host using reserved IPv4
+        // address within the IPv4 subnet.
+        boost::multi_index::hashed_non_unique<
+            boost::multi_index::composite_key<
+                Host,
+                boost::multi_index::const_mem_fun<
+                    Host, const asiolink::IOAddress&,
+                    &Host::getIPv4Reservation
+                >,
+                boost::multi_index::const_mem_fun<
+                    Host, SubnetID,
+                    &Host::getIPv4SubnetID
+                >
+            >
         >
     >
 > HostContainer;
@@ -141,6 +198,36 @@ typedef HostContainer::nth_index<4>::type HostContainerIndex4;
 typedef std::pair<HostContainerIndex4::iterator,
                   HostContainerIndex4::iterator> HostContainerIndex4Range;
 
+/// @brief Sixth index type in the @c HostContainer.
+///
+/// This index allows for searching for @c Host objects using an
+/// identifier + identifier type + IPv4 subnet id tuple.
+typedef HostContainer::nth_index<5>::type HostContainerIndex5;
+
+/// @brief Results range returned using the @c HostContainerIndex5.
+typedef std::pair<HostContainerIndex5::iterator,
+                  HostContainerIndex5::iterator> HostContainerIndex5Range;
+
+/// @brief Seventh index type in the @c HostContainer.
+///
+/// This index allows for searching for @c Host objects using an
+/// identifier + identifier type + IPv6 subnet id tuple.
+typedef HostContainer::nth_index<6>::type HostContainerIndex6;
+
+/// @brief Results range returned using the @c HostContainerIndex6.
+typedef std::pair<HostContainerIndex6::iterator,
+                  HostContainerIndex6::iterator> HostContainerIndex6Range;
+
+/// @brief Eighth index type in the @c HostContainer.
+///
+/// This index allows for searching for @c Host objects using a
+/// reserved IPv4 address + IPv4 subnet id tuple.
+typedef HostContainer::nth_index<7>::type HostContainerIndex7;
+
+/// @brief Results range returned using the @c HostContainerIndex7.
+typedef std::pair<HostContainerIndex7::iterator,
+                  HostContainerIndex7::iterator> HostContainerIndex7Range;
+
 /// @brief Defines one entry for the Host Container for v6 hosts
 ///
 /// It's essentially a pair of (IPv6 reservation, Host pointer).
@@ -224,6 +311,20 @@ typedef boost::multi_index_container<
             // Index using values returned by the @c Host::getIPv6SubnetID
             boost::multi_index::member<HostResrv6Tuple, const SubnetID,
                                        &HostResrv6Tuple::subnet_id_>
+        >,
+
+        // Fourth index is a hashed variant of the second index used for
+        // exact (subnet_id, address) lookups.
+        boost::multi_index::hashed_non_unique<
+            boost::multi_index::composite_key<
+                HostResrv6Tuple,
+                boost::multi_index::member<HostResrv6Tuple, const SubnetID,
+                    &HostResrv6Tuple::subnet_id_>,
+                boost::multi_index::const_mem_fun<
+                    HostResrv6Tuple, const asiolink::IOAddress&,
+                    &HostResrv6Tuple::getKey
+                >
+            >
         >
     >
 > HostContainer6;
@@ -258,6 +359,16 @@ typedef HostContainer6::nth_index<2>::type HostContainer6Index2;
 typedef std::pair<HostContainer6Index2::iterator,
                   HostContainer6Index2::iterator> HostContainer6Index2Range;
 
+/// @brief Fourth index type in the @c HostContainer6.
+///
+/// This index allows for hashed searching for @c Host objects using a
+/// reserved (SubnetID, IPv6 address) tuple.
+typedef HostContainer6::nth_index<3>::type HostContainer6Index3;
+
+/// @brief Results range returned using the @c HostContainer6Index3.
+typedef std::pair<HostContainer6Index3::iterator,
+                  HostContainer6Index3::iterator> HostContainer6Index3Range;
+
 }; // end of isc::dhcp namespace
 }; // end of isc namespace
 
@@ -10,6 +10,13 @@
 #include <dhcpsrv/host_mgr.h>
 #include <dhcpsrv/hosts_log.h>
 #include <dhcpsrv/host_data_source_factory.h>
+#include <dhcpsrv/timer_mgr.h>
+#include <exceptions/exceptions.h>
+#include <stats/stats_mgr.h>
+#include <util/memory_arena.h>
+
+#include <set>
+#include <vector>
 
 namespace {
 
@@ -23,12 +30,30 @@ isc::dhcp::ConstCfgHostsPtr getCfgHosts() {
     return (isc::dhcp::CfgMgr::instance().getCurrentCfg()->getCfgHosts());
 }
 
+/// @brief Name of the timer rebuilding the host filter.
+const char* HOST_FILTER_TIMER_NAME = "HostFilterRebuildTimer";
+
+/// @brief Name of the timer running the steps of a host filter rebuild.
+const char* HOST_FILTER_STEP_TIMER_NAME = "HostFilterRebuildStepTimer";
+
+/// @brief Interval between the steps of a host filter rebuild in
+/// milliseconds.
+const long HOST_FILTER_STEP_INTERVAL = 1;
+
+/// @brief Number of hosts retrieved at once when rebuilding the filter.
+const size_t HOST_FILTER_PAGE_SIZE = 1024;
+
+/// @brief False positive rate of the host filter.
+const double HOST_FILTER_FALSE_POSITIVE_RATE = 0.01;
+
 } // end of anonymous namespace
 
 namespace isc {
 namespace dhcp {
 
 using namespace isc::asiolink;
+using namespace isc::stats;
+using namespace isc::util;
 
 boost::scoped_ptr<HostMgr>&
 HostMgr::getHostMgrPtr() {
@@ -44,6 +69,8 @@ HostMgr::create() {
 void
 HostMgr::addBackend(const std::string& access) {
     HostDataSourceFactory::add(getHostMgrPtr()->alternate_sources_, access);
+    // The filter doesn't know the hosts of the new source.
+    getHostMgrPtr()->resetHostFilter();
 }
 
 bool
@@ -52,12 +79,15 @@ HostMgr::delBackend(const std::string& db_type) {
         getHostMgrPtr()->cache_ptr_->getType() == db_type) {
         getHostMgrPtr()->cache_ptr_.reset();
     }
+    // The rebuild in progress refers to the sources by index.
+    getHostMgrPtr()->host_filter_rebuild_.reset();
     return (HostDataSourceFactory::del(getHostMgrPtr()->alternate_sources_, db_type));
 }
 
 void
 HostMgr::delAllBackends() {
     getHostMgrPtr()->alternate_sources_.clear();
+    getHostMgrPtr()->host_filter_rebuild_.reset();
 }
 
 HostDataSourcePtr
@@ -90,6 +120,186 @@ HostMgr::checkCacheBackend(bool logging) {
     return (false);
 }
 
+void
+HostMgr::setupHostFilterTimer(const long interval) {
+    TimerMgr::instance()->registerTimer(HOST_FILTER_TIMER_NAME,
+                                        &HostMgr::hostFilterTimerCallback,
+                                        interval,
+                                        IntervalTimer::ONE_SHOT);
+    TimerMgr::instance()->registerTimer(HOST_FILTER_STEP_TIMER_NAME,
+                                        &HostMgr::hostFilterStepTimerCallback,
+                                        HOST_FILTER_STEP_INTERVAL,
+                                        IntervalTimer::ONE_SHOT);
+    // The first rebuild was started by the configuration.
+    TimerMgr::instance()->setup(HOST_FILTER_STEP_TIMER_NAME);
+}
+
+void
+HostMgr::hostFilterTimerCallback() {
+    instance().startHostFilterRebuild(CfgMgr::instance().getCurrentCfg());
+    hostFilterStepTimerCallback();
+}
+
+void
+HostMgr::hostFilterStepTimerCallback() {
+    // Reschedule the timers after the step so as the steps don't overlap
+    // when they take longer than the interval.
+    if (instance().rebuildHostFilterStep()) {
+        TimerMgr::instance()->setup(HOST_FILTER_TIMER_NAME);
+    } else {
+        TimerMgr::instance()->setup(HOST_FILTER_STEP_TIMER_NAME);
+    }
+}
+
+void
+HostMgr::rebuildHostFilter(const boost::shared_ptr<const SrvConfig>& cfg) {
+    startHostFilterRebuild(cfg);
+    while (!rebuildHostFilterStep()) {
+    }
+}
+
+void
+HostMgr::startHostFilterRebuild(const boost::shared_ptr<const SrvConfig>& cfg) {
+    // The subnets for which the reservations are retrieved. The global
+    // reservations use a special subnet id.
+    std::set<SubnetID> subnets4;
+    std::set<SubnetID> subnets6;
+    subnets4.insert(SUBNET_ID_GLOBAL);
+    subnets6.insert(SUBNET_ID_GLOBAL);
+    if (cfg) {
+        const Subnet4Collection* all4 = cfg->getCfgSubnets4()->getAll();
+        for (auto subnet = all4->begin(); subnet != all4->end(); ++subnet) {
+            subnets4.insert((*subnet)->getID());
+        }
+        const Subnet6Collection* all6 = cfg->getCfgSubnets6()->getAll();
+        for (auto subnet = all6->begin(); subnet != all6->end(); ++subnet) {
+            subnets6.insert((*subnet)->getID());
+        }
+    }
+
+    host_filter_rebuild_.reset(new HostFilterRebuild());
+    host_filter_rebuild_->subnets4_.assign(subnets4.begin(), subnets4.end());
+    host_filter_rebuild_->subnets6_.assign(subnets6.begin(), subnets6.end());
+}
+
+bool
+HostMgr::rebuildHostFilterStep() {
+    if (!host_filter_rebuild_) {
+        return (true);
+    }
+    HostFilterRebuild& rebuild = *host_filter_rebuild_;
+
+    try {
+        // Skip the cache which holds a subset of the hosts from other sources.
+        while ((rebuild.source_index_ < alternate_sources_.size()) &&
+               (alternate_sources_[rebuild.source_index_] == cache_ptr_)) {
+            ++rebuild.source_index_;
+        }
+
+        const size_t subnets_count = rebuild.subnets4_.size() +
+            rebuild.subnets6_.size();
+        if (rebuild.source_index_ < alternate_sources_.size()) {
+            HostDataSourcePtr source = alternate_sources_[rebuild.source_index_];
+            const HostPageSize page_size(HOST_FILTER_PAGE_SIZE);
+            size_t source_index = 0;
+            ConstHostCollection page;
+            if (rebuild.subnet_index_ < rebuild.subnets4_.size()) {
+                page = source->getPage4(rebuild.subnets4_[rebuild.subnet_index_],
+                                        source_index, rebuild.lower_host_id_,
+                                        page_size);
+            } else {
+                const size_t index = rebuild.subnet_index_ - rebuild.subnets4_.size();
+                page = source->getPage6(rebuild.subnets6_[index],
+                                        source_index, rebuild.lower_host_id_,
+                                        page_size);
+            }
+            for (const auto& host : page) {
+                std::vector<uint8_t> key = getHostFilterKey(host);
+                if (!key.empty()) {
+                    rebuild.keys_.push_back(key);
+                }
+            }
+
+            // Move to the next page, subnet or source.
+            if (page.size() == HOST_FILTER_PAGE_SIZE) {
+                rebuild.lower_host_id_ = page.back()->getHostId();
+            } else {
+                rebuild.lower_host_id_ = 0;
+                if (++rebuild.subnet_index_ >= subnets_count) {
+                    rebuild.subnet_index_ = 0;
+                    ++rebuild.source_index_;
+                }
+            }
+            return (false);
+        }
+
+        // All hosts were retrieved. Leave some room for the hosts added
+        // before the next rebuild.
+        const size_t count = rebuild.keys_.size();
+        BloomFilterPtr filter(new BloomFilter(count + count / 4
+                                              + HOST_FILTER_PAGE_SIZE,
+                                              HOST_FILTER_FALSE_POSITIVE_RATE));
+        for (const auto& key : rebuild.keys_) {
+            filter->add(&key[0], key.size());
+        }
+        boost::atomic_store(&host_filter_, filter);
+        host_filter_rebuild_.reset();
+
+        LOG_INFO(hosts_logger, HOSTS_MGR_FILTER_REBUILT)
+            .arg(filter->getCount())
+            .arg(filter->getBitsCount() / 8);
+
+    } catch (const std::exception& ex) {
+        // Without the filter all lookups go to the alternate sources.
+        resetHostFilter();
+        LOG_ERROR(hosts_logger, HOSTS_MGR_FILTER_REBUILD_FAILED)
+            .arg(ex.what());
+    }
+    return (true);
+}
+
+void
+HostMgr::resetHostFilter() {
+    boost::atomic_store(&host_filter_, BloomFilterPtr());
+    host_filter_rebuild_.reset();
+}
+
+std::vector<uint8_t>
+HostMgr::getHostFilterKey(const ConstHostPtr& host) {
+    std::vector<uint8_t> key;
+    if (!host || host->getNegative()) {
+        return (key);
+    }
+    key.push_back(static_cast<uint8_t>(host->getIdentifierType()));
+    const std::vector<uint8_t>& identifier = host->getIdentifier();
+    key.insert(key.end(), identifier.begin(), identifier.end());
+    return (key);
+}
+
+bool
+HostMgr::mayHaveHost(const Host::IdentifierType& identifier_type,
+                     const uint8_t* identifier_begin,
+                     const size_t identifier_len) const {
+    BloomFilterPtr filter = getHostFilter();
+    if (!filter) {
+        return (true);
+    }
+    std::vector<uint8_t> key(1, static_cast<uint8_t>(identifier_type));
+    key.insert(key.end(), identifier_begin, identifier_begin + identifier_len);
+    if (filter->mayContain(&key[0], key.size())) {
+        StatsMgr::instance().addValue("host-filter-passed-lookups",
+                                      static_cast<int64_t>(1));
+        return (true);
+    }
+
+    StatsMgr::instance().addValue("host-filter-skipped-lookups",
+                                  static_cast<int64_t>(1));
+    LOG_DEBUG(hosts_logger, HOSTS_DBG_RESULTS, HOSTS_MGR_FILTER_SKIP)
+        .arg(Host::getIdentifierAsText(identifier_type, identifier_begin,
+                                       identifier_len));
+    return (false);
+}
+
 HostMgr&
 HostMgr::instance() {
     boost::scoped_ptr<HostMgr>& host_mgr_ptr = getHostMgrPtr();
@@ -221,6 +431,11 @@ HostMgr::get4Any(const SubnetID& subnet_id,
         return (host);
     }
 
+    // Nor if the identifier is certainly not reserved in the backends.
+    if (!mayHaveHost(identifier_type, identifier_begin, identifier_len)) {
+        return (host);
+    }
+
     LOG_DEBUG(hosts_logger, HOSTS_DBG_TRACE,
               HOSTS_MGR_ALTERNATE_GET4_SUBNET_ID_IDENTIFIER)
         .arg(subnet_id)
@@ -229,6 +444,9 @@ HostMgr::get4Any(const SubnetID& subnet_id,
 
     // Try to find a host in each configured backend. We return as soon
     // as we find first hit.
+    // The hosts found in the backends may be cached: take them from the
+    // heap rather than from the per-packet arena they would pin.
+    HeapAllocationScope heap_scope;
     for (auto source : alternate_sources_) {
         host = source->get4(subnet_id, identifier_type,
                            identifier_begin, identifier_len);
@@ -249,6 +467,12 @@ HostMgr::get4Any(const SubnetID& subnet_id,
             return (host);
         }
     }
+    // The filter may be replaced by a rebuild in the meantime.
+    BloomFilterPtr filter = boost::atomic_load(&host_filter_);
+    if (filter) {
+        StatsMgr::instance().addValue("host-filter-false-positives",
+                                      static_cast<int64_t>(1));
+    }
     LOG_DEBUG(hosts_logger, HOSTS_DBG_RESULTS,
               HOSTS_MGR_ALTERNATE_GET4_SUBNET_ID_IDENTIFIER_NULL)
         .arg(subnet_id)
@@ -284,6 +508,8 @@ HostMgr::get4(const SubnetID& subnet_id,
               HOSTS_MGR_ALTERNATE_GET4_SUBNET_ID_ADDRESS4)
         .arg(subnet_id)
         .arg(address.toText());
+    // The hosts found in the backends may be cached.
+    HeapAllocationScope heap_scope;
     for (auto source : alternate_sources_) {
         host = source->get4(subnet_id, address);
         if (host && host->getNegative()) {
@@ -309,6 +535,8 @@ HostMgr::get6(const IOAddress& prefix, const uint8_t prefix_len) const {
     LOG_DEBUG(hosts_logger, HOSTS_DBG_TRACE, HOSTS_MGR_ALTERNATE_GET6_PREFIX)
         .arg(prefix.toText())
         .arg(static_cast<int>(prefix_len));
+    // The hosts found in the backends may be cached.
+    HeapAllocationScope heap_scope;
     for (auto source : alternate_sources_) {
         host = source->get6(prefix, prefix_len);
         if (host && host->getNegative()) {
@@ -335,12 +563,18 @@ HostMgr::get6Any(const SubnetID& subnet_id,
         return (host);
     }
 
+    if (!mayHaveHost(identifier_type, identifier_begin, identifier_len)) {
+        return (host);
+    }
+
     LOG_DEBUG(hosts_logger, HOSTS_DBG_TRACE,
               HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_IDENTIFIER)
         .arg(subnet_id)
         .arg(Host::getIdentifierAsText(identifier_type, identifier_begin,
                                        identifier_len));
 
+    // The hosts found in the backends may be cached.
+    HeapAllocationScope heap_scope;
     for (auto source : alternate_sources_) {
         host = source->get6(subnet_id, identifier_type,
                            identifier_begin, identifier_len);
@@ -362,6 +596,12 @@ HostMgr::get6Any(const SubnetID& subnet_id,
         }
     }
 
+    // The filter may be replaced by a rebuild in the meantime.
+    BloomFilterPtr filter = boost::atomic_load(&host_filter_);
+    if (filter) {
+        StatsMgr::instance().addValue("host-filter-false-positives",
+                                      static_cast<int64_t>(1));
+    }
     LOG_DEBUG(hosts_logger, HOSTS_DBG_RESULTS,
               HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_IDENTIFIER_NULL)
         .arg(subnet_id)
@@ -398,6 +638,8 @@ HostMgr::get6(const SubnetID& subnet_id,
               HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_ADDRESS6)
         .arg(subnet_id)
         .arg(addr.toText());
+    // The hosts found in the backends may be cached.
+    HeapAllocationScope heap_scope;
     for (auto source : alternate_sources_) {
         host = source->get6(subnet_id, addr);
         if (host && host->getNegative()) {
@@ -426,6 +668,16 @@ HostMgr::add(const HostPtr& host) {
     if (cache_ptr_) {
         cache(host);
     }
+    // The host must not be filtered out until the next rebuild, nor by
+    // the filter being rebuilt.
+    std::vector<uint8_t> key = getHostFilterKey(host);
+    BloomFilterPtr filter = getHostFilter();
+    if (filter && !key.empty()) {
+        filter->add(&key[0], key.size());
+    }
+    if (host_filter_rebuild_ && !key.empty()) {
+        host_filter_rebuild_->keys_.push_back(key);
+    }
 }
 
 bool
@@ -12,13 +12,26 @@
 #include <dhcpsrv/cache_host_data_source.h>
 #include <dhcpsrv/host.h>
 #include <dhcpsrv/subnet_id.h>
+#include <util/bloom_filter.h>
 #include <boost/noncopyable.hpp>
 #include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
 #include <string>
+#include <vector>
 
 namespace isc {
 namespace dhcp {
 
+class SrvConfig;
+
+/// @brief Maximum interval between the host filter rebuilds in seconds.
+///
+/// When the @c host-filter-rebuild-interval parameter is set to a positive
+/// number, the DHCP servers build a filter of the identifiers reserved in
+/// the alternate host data sources and rebuild it periodically using the
+/// specified interval. See @ref HostMgr::rebuildHostFilter.
+const uint32_t HOST_FILTER_MAX_REBUILD_INTERVAL = 86400;
+
 /// @brief Host Manager.
 ///
 /// This is a singleton class which provides access to multiple sources of
@@ -90,6 +103,17 @@ public:
     /// @return true if the first host backend is a cache.
     static bool checkCacheBackend(bool logging = false);
 
+    /// @brief Schedules periodic rebuilds of the host filter.
+    ///
+    /// The filter is rebuilt using the current server configuration
+    /// each time the interval elapses.
+    ///
+    /// The rebuild is run by steps which retrieve one page of hosts each,
+    /// so as it doesn't hold the server for long.
+    ///
+    /// @param interval Interval between rebuilds in milliseconds.
+    static void setupHostFilterTimer(const long interval);
+
     /// @brief Returns a sole instance of the @c HostMgr.
     ///
     /// This method should be used to retrieve an instance of the @c HostMgr
@@ -427,6 +451,69 @@ public:
         negative_caching_ = negative_caching;
     }
 
+    /// @brief Rebuilds the filter of the reserved identifiers.
+    ///
+    /// Most clients have no reservations, yet each of them costs a query
+    /// to each alternate host data source for each identifier type. The
+    /// filter holds all identifiers reserved in the alternate sources (the
+    /// host cache excepted) for the subnets of the configuration. When the
+    /// filter says that an identifier is not reserved, the lookups by this
+    /// identifier skip the alternate sources. The filter may give false
+    /// positives, in which case the alternate sources are queried as if
+    /// there was no filter.
+    ///
+    /// The hosts added with @ref add are added to the filter. The hosts
+    /// added to the alternate sources by other means are not found until
+    /// the filter is rebuilt, hence the filter is meant to be rebuilt
+    /// periodically.
+    ///
+    /// The following statistics are updated by the lookups using the
+    /// filter: host-filter-skipped-lookups (alternate sources skipped),
+    /// host-filter-passed-lookups (alternate sources queried) and
+    /// host-filter-false-positives (alternate sources queried and the
+    /// host not found).
+    ///
+    /// This function runs all steps of the rebuild at once. The servers
+    /// use @ref startHostFilterRebuild and @ref rebuildHostFilterStep
+    /// from a timer instead, so as the packets are processed between the
+    /// steps.
+    ///
+    /// @param cfg Server configuration holding the subnets.
+    void rebuildHostFilter(const boost::shared_ptr<const SrvConfig>& cfg);
+
+    /// @brief Starts an incremental rebuild of the host filter.
+    ///
+    /// A rebuild in progress is abandoned. The current filter is used
+    /// until the rebuild completes.
+    ///
+    /// @param cfg Server configuration holding the subnets.
+    void startHostFilterRebuild(const boost::shared_ptr<const SrvConfig>& cfg);
+
+    /// @brief Runs a step of the host filter rebuild.
+    ///
+    /// Each step retrieves one page of hosts from an alternate source.
+    /// The last step replaces the filter with the new one. If the
+    /// reservations can't be retrieved, the filter is disabled until the
+    /// next successful rebuild.
+    ///
+    /// @return true if the rebuild is over (or was not started), false if
+    /// more steps are needed.
+    bool rebuildHostFilterStep();
+
+    /// @brief Checks if a host filter rebuild is in progress.
+    ///
+    /// @return true if more rebuild steps are needed.
+    bool isHostFilterRebuilding() const {
+        return (static_cast<bool>(host_filter_rebuild_));
+    }
+
+    /// @brief Returns the filter of the reserved identifiers.
+    ///
+    /// @return Pointer to the filter or null if the filter is not used.
+    util::BloomFilterPtr getHostFilter() const {
+        return (boost::atomic_load(&host_filter_));
+    }
+
     /// @brief Returns the disable single query flag.
     ///
     /// @return the disable single query flag.
@@ -473,11 +560,75 @@ protected:
                                const uint8_t* identifier_begin,
                                const size_t identifier_len) const;
 
+    /// @brief Checks if the identifier may be reserved in the alternate
+    /// host data sources.
+    ///
+    /// @param identifier_type Identifier type.
+    /// @param identifier_begin Pointer to a beginning of the Identifier.
+    /// @param identifier_len Identifier length.
+    /// @return false if the host filter is used and the identifier is
+    /// not in the filter, true otherwise.
+    bool mayHaveHost(const Host::IdentifierType& identifier_type,
+                     const uint8_t* identifier_begin,
+                     const size_t identifier_len) const;
+
 private:
 
     /// @brief Private default constructor.
     HostMgr() : negative_caching_(false), disable_single_query_(false) { }
 
+    /// @brief Returns the host filter key of a host.
+    ///
+    /// @param host Pointer to the host.
+    /// @return The identifier type followed by the identifier, empty for
+    /// a null or negative host.
+    static std::vector<uint8_t> getHostFilterKey(const ConstHostPtr& host);
+
+    /// @brief Starts a host filter rebuild and runs its first step.
+    static void hostFilterTimerCallback();
+
+    /// @brief Runs a step of the host filter rebuild and schedules the
+    /// next step or the next rebuild.
+    static void hostFilterStepTimerCallback();
+
+    /// @brief Drops the host filter and the rebuild in progress.
+    void resetHostFilter();
+
+    /// @brief State of an incremental host filter rebuild.
+    struct HostFilterRebuild {
+        /// @brief Constructor.
+        HostFilterRebuild()
+            : subnets4_(), subnets6_(), source_index_(0), subnet_index_(0),
+              lower_host_id_(0), keys_() {
+        }
+
+        /// @brief Subnets for which the IPv4 reservations are retrieved.
+        std::vector<SubnetID> subnets4_;
+
+        /// @brief Subnets for which the IPv6 reservations are retrieved.
+        std::vector<SubnetID> subnets6_;
+
+        /// @brief Index of the alternate source being read.
+        size_t source_index_;
+
+        /// @brief Index of the subnet being read, the IPv4 subnets first.
+        size_t subnet_index_;
+
+        /// @brief Host identifier from which the next page starts.
+        uint64_t lower_host_id_;
+
+        /// @brief Keys of the identifiers retrieved so far.
+        std::vector<std::vector<uint8_t> > keys_;
+    };
+
+    /// @brief Filter of the identifiers reserved in the alternate sources.
+    ///
+    /// It is replaced atomically at the end of a rebuild.
+    util::BloomFilterPtr host_filter_;
+
+    /// @brief Host filter rebuild in progress, null if none.
+    boost::scoped_ptr<HostFilterRebuild> host_filter_rebuild_;
+
     /// @brief List of alternate host data sources.
     HostDataSourceList alternate_sources_;
 
@@ -54,6 +54,9 @@ extern const isc::log::MessageID HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_ADDRESS6 = "
 extern const isc::log::MessageID HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_IDENTIFIER = "HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_IDENTIFIER";
 extern const isc::log::MessageID HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_IDENTIFIER_HOST = "HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_IDENTIFIER_HOST";
 extern const isc::log::MessageID HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_IDENTIFIER_NULL = "HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_IDENTIFIER_NULL";
+extern const isc::log::MessageID HOSTS_MGR_FILTER_REBUILD_FAILED = "HOSTS_MGR_FILTER_REBUILD_FAILED";
+extern const isc::log::MessageID HOSTS_MGR_FILTER_REBUILT = "HOSTS_MGR_FILTER_REBUILT";
+extern const isc::log::MessageID HOSTS_MGR_FILTER_SKIP = "HOSTS_MGR_FILTER_SKIP";
 
 } // namespace dhcp
 } // namespace isc
@@ -108,6 +111,9 @@ const char* values[] = {
     "HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_IDENTIFIER", "get one host with IPv6 reservation for subnet id %1, identified by %2",
     "HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_IDENTIFIER_HOST", "using subnet id %1 and identifier %2, found in %3 host: %4",
     "HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_IDENTIFIER_NULL", "host not found using subnet id %1 and identifier %2",
+    "HOSTS_MGR_FILTER_REBUILD_FAILED", "failed to rebuild the host reservations filter: %1",
+    "HOSTS_MGR_FILTER_REBUILT", "rebuilt the host reservations filter holding %1 identifiers using %2 bytes",
+    "HOSTS_MGR_FILTER_SKIP", "identifier %1 is not reserved in alternate sources according to the host reservations filter",
     NULL
 };
 
@@ -55,6 +55,9 @@ extern const isc::log::MessageID HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_ADDRESS6;
 extern const isc::log::MessageID HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_IDENTIFIER;
 extern const isc::log::MessageID HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_IDENTIFIER_HOST;
 extern const isc::log::MessageID HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_IDENTIFIER_NULL;
+extern const isc::log::MessageID HOSTS_MGR_FILTER_REBUILD_FAILED;
+extern const isc::log::MessageID HOSTS_MGR_FILTER_REBUILT;
+extern const isc::log::MessageID HOSTS_MGR_FILTER_SKIP;
 
 } // namespace dhcp
 } // namespace isc
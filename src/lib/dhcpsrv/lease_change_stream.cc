@@ -0,0 +1,155 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/lease_change_stream.h>
+
+#include <ctime>
+#include <sstream>
+
+using namespace isc::asiolink;
+using namespace isc::data;
+using namespace isc::util::thread;
+
+namespace {
+
+/// @brief Returns a new stream identifier: the current time.
+std::string
+makeStreamId() {
+    std::ostringstream s;
+    s << time(NULL);
+    return (s.str());
+}
+
+} // end of anonymous namespace
+
+namespace isc {
+namespace dhcp {
+
+std::string
+LeaseChange::typeToText(const Type& type) {
+    switch (type) {
+    case ADD:
+        return ("add");
+    case UPDATE:
+        return ("update");
+    default:
+        ;
+    }
+    return ("delete");
+}
+
+ElementPtr
+LeaseChange::toElement() const {
+    ElementPtr map = Element::createMap();
+    map->set("sequence", Element::create(static_cast<int64_t>(sequence_)));
+    map->set("type", Element::create(typeToText(type_)));
+    map->set("timestamp", Element::create(static_cast<int64_t>(timestamp_)));
+    map->set("ip-address", Element::create(addr_.toText()));
+    if (lease_) {
+        map->set("lease", lease_->toElement());
+    }
+    return (map);
+}
+
+LeaseChangeStream::LeaseChangeStream()
+    : stream_id_(makeStreamId()), capacity_(0), sequence_(0), changes_(),
+      mutex_() {
+}
+
+LeaseChangeStream&
+LeaseChangeStream::instance() {
+    static LeaseChangeStream stream;
+    return (stream);
+}
+
+void
+LeaseChangeStream::setCapacity(const size_t capacity) {
+    Mutex::Locker lock(mutex_);
+    capacity_ = capacity;
+    while (changes_.size() > capacity_) {
+        changes_.pop_front();
+    }
+}
+
+size_t
+LeaseChangeStream::getCapacity() const {
+    Mutex::Locker lock(mutex_);
+    return (capacity_);
+}
+
+bool
+LeaseChangeStream::enabled() const {
+    Mutex::Locker lock(mutex_);
+    return (capacity_ > 0);
+}
+
+void
+LeaseChangeStream::publish(const LeaseChange::Type& type,
+                           const Lease4Ptr& lease) {
+    if (enabled()) {
+        append(type, lease->addr_, LeasePtr(new Lease4(*lease)));
+    }
+}
+
+void
+LeaseChangeStream::publish(const LeaseChange::Type& type,
+                           const Lease6Ptr& lease) {
+    if (enabled()) {
+        append(type, lease->addr_, LeasePtr(new Lease6(*lease)));
+    }
+}
+
+void
+LeaseChangeStream::publishDelete(const IOAddress& addr) {
+    if (enabled()) {
+        append(LeaseChange::DELETE, addr, LeasePtr());
+    }
+}
+
+void
+LeaseChangeStream::append(const LeaseChange::Type& type,
+                          const IOAddress& addr,
+                          const LeasePtr& lease) {
+    Mutex::Locker lock(mutex_);
+    if (capacity_ == 0) {
+        return;
+    }
+    if (changes_.size() >= capacity_) {
+        changes_.pop_front();
+    }
+    LeaseChange change = { ++sequence_, type, addr, lease, time(NULL) };
+    changes_.push_back(change);
+}
+
+bool
+LeaseChangeStream::getChanges(const uint64_t after, const size_t limit,
+                              std::vector<LeaseChange>& changes) const {
+    Mutex::Locker lock(mutex_);
+    // The sequence numbers of the retained changes are consecutive.
+    const uint64_t first = sequence_ - changes_.size() + 1;
+    if (after + 1 < first) {
+        return (false);
+    }
+    if (after >= sequence_) {
+        return (true);
+    }
+    for (auto change = changes_.begin() + (after + 1 - first);
+         (change != changes_.end()) && (changes.size() < limit); ++change) {
+        changes.push_back(*change);
+    }
+    return (true);
+}
+
+uint64_t
+LeaseChangeStream::getLastSequence() const {
+    Mutex::Locker lock(mutex_);
+    return (sequence_);
+}
+
+} // namespace dhcp
+} // namespace isc
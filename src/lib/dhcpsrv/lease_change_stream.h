@@ -0,0 +1,178 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef LEASE_CHANGE_STREAM_H
+#define LEASE_CHANGE_STREAM_H
+
+#include <asiolink/io_address.h>
+#include <cc/data.h>
+#include <dhcpsrv/lease.h>
+#include <util/threads/sync.h>
+
+#include <boost/noncopyable.hpp>
+
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Change of a lease in the lease database.
+struct LeaseChange {
+    /// @brief Type of the change.
+    typedef enum {
+        ADD,     ///< The lease was added.
+        UPDATE,  ///< The lease was updated.
+        DELETE   ///< The lease was deleted.
+    } Type;
+
+    /// @brief Sequence number of the change, starting at 1.
+    uint64_t sequence_;
+
+    /// @brief Type of the change.
+    Type type_;
+
+    /// @brief Address of the lease.
+    asiolink::IOAddress addr_;
+
+    /// @brief Copy of the lease after the change, null for a deletion.
+    LeasePtr lease_;
+
+    /// @brief Time of the change.
+    time_t timestamp_;
+
+    /// @brief Returns the textual name of a change type.
+    ///
+    /// @param type Type of the change.
+    /// @return "add", "update" or "delete".
+    static std::string typeToText(const Type& type);
+
+    /// @brief Returns the change in the JSON format.
+    ///
+    /// The map holds the sequence number, the type and the time of the
+    /// change, the address and, unless the lease was deleted, the lease.
+    ///
+    /// @return Pointer to the map.
+    data::ElementPtr toElement() const;
+};
+
+/// @brief Ordered stream of the changes of the leases.
+///
+/// The lease backends publish each lease they add, update or delete so
+/// external systems can tail the changes using the sequence number of the
+/// last change they processed as a cursor, instead of reading the whole
+/// lease database again.
+///
+/// The stream retains a bounded number of changes: when a consumer lags
+/// behind so much that the changes following its cursor were discarded,
+/// @ref getChanges reports it and the consumer must read the leases from
+/// the database again. The producers are never blocked by the consumers.
+///
+/// The stream is identified by the time it was created: a consumer
+/// finding a different identifier knows the server restarted and the
+/// sequence numbers were reset.
+///
+/// The stream outlives the lease backends, so it is preserved when the
+/// server is reconfigured. It is disabled until a capacity is set.
+class LeaseChangeStream : public boost::noncopyable {
+public:
+
+    /// @brief Returns the sole instance of the stream.
+    static LeaseChangeStream& instance();
+
+    /// @brief Sets the maximum number of retained changes.
+    ///
+    /// The oldest changes are discarded when the capacity is reduced.
+    ///
+    /// @param capacity Maximum number of retained changes, 0 disables
+    /// the stream and discards all retained changes.
+    void setCapacity(const size_t capacity);
+
+    /// @brief Returns the maximum number of retained changes.
+    size_t getCapacity() const;
+
+    /// @brief Checks if the lease changes are published.
+    bool enabled() const;
+
+    /// @brief Publishes the addition or the update of a lease.
+    ///
+    /// It does nothing when the stream is disabled.
+    ///
+    /// @param type @c LeaseChange::ADD or @c LeaseChange::UPDATE.
+    /// @param lease Lease after the change, it is copied.
+    void publish(const LeaseChange::Type& type, const Lease4Ptr& lease);
+
+    /// @brief Publishes the addition or the update of a lease.
+    ///
+    /// It does nothing when the stream is disabled.
+    ///
+    /// @param type @c LeaseChange::ADD or @c LeaseChange::UPDATE.
+    /// @param lease Lease after the change, it is copied.
+    void publish(const LeaseChange::Type& type, const Lease6Ptr& lease);
+
+    /// @brief Publishes the deletion of a lease.
+    ///
+    /// It does nothing when the stream is disabled.
+    ///
+    /// @param addr Address of the deleted lease.
+    void publishDelete(const asiolink::IOAddress& addr);
+
+    /// @brief Returns the changes following a sequence number.
+    ///
+    /// @param after Sequence number of the last change the consumer
+    /// processed, 0 to get the changes from the beginning.
+    /// @param limit Maximum number of changes to return.
+    /// @param [out] changes Returned changes in the sequence order.
+    ///
+    /// @return false if changes following the sequence number were
+    /// discarded, true otherwise.
+    bool getChanges(const uint64_t after, const size_t limit,
+                    std::vector<LeaseChange>& changes) const;
+
+    /// @brief Returns the sequence number of the last change, 0 when no
+    /// change was published.
+    uint64_t getLastSequence() const;
+
+    /// @brief Returns the identifier of the stream.
+    const std::string& getStreamId() const {
+        return (stream_id_);
+    }
+
+private:
+
+    /// @brief Constructor.
+    LeaseChangeStream();
+
+    /// @brief Appends a change to the stream.
+    ///
+    /// @param type Type of the change.
+    /// @param addr Address of the lease.
+    /// @param lease Copy of the lease, null for a deletion.
+    void append(const LeaseChange::Type& type,
+                const asiolink::IOAddress& addr,
+                const LeasePtr& lease);
+
+    /// @brief Identifier of the stream.
+    const std::string stream_id_;
+
+    /// @brief Maximum number of retained changes.
+    size_t capacity_;
+
+    /// @brief Sequence number of the last change.
+    uint64_t sequence_;
+
+    /// @brief Retained changes.
+    std::deque<LeaseChange> changes_;
+
+    /// @brief Mutex protecting the changes.
+    mutable util::thread::Mutex mutex_;
+};
+
+} // namespace dhcp
+} // namespace isc
+
+#endif // LEASE_CHANGE_STREAM_H
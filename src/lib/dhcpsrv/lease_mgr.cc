@@ -286,6 +286,14 @@ LeaseMgr::startSubnetRangeLeaseStatsQuery6(const SubnetID& /* first_subnet_id */
     return(LeaseStatsQueryPtr());
 }
 
+std::vector<isc::asiolink::IOAddress>
+LeaseMgr::findFreeAddresses4(const isc::asiolink::IOAddress& /* first */,
+                             const isc::asiolink::IOAddress& /* last */,
+                             const size_t /* max_count */) {
+    isc_throw(NotImplemented, "findFreeAddresses4 is not implemented for the "
+              << getType() << " backend");
+}
+
 std::string
 LeaseMgr::getDBVersion() {
     isc_throw(NotImplemented, "LeaseMgr::getDBVersion() called");
@@ -260,6 +260,51 @@ public:
     ///         with the same address was already there or failed sanity checks)
     virtual bool addLease(const Lease6Ptr& lease) = 0;
 
+    /// @brief Checks if the backend can search free IPv4 addresses.
+    ///
+    /// @return true if @ref findFreeAddresses4 is implemented, false
+    /// otherwise.
+    virtual bool canFindFreeAddresses4() const {
+        return (false);
+    }
+
+    /// @brief Checks if the backend can fetch leases from several threads.
+    ///
+    /// The backends holding a pool of database connections let the lease
+    /// lookup threads query the database while the server processes other
+    /// packets.
+    ///
+    /// @return true if the lease getters may be called concurrently,
+    /// false otherwise.
+    virtual bool canLookupLeasesConcurrently() const {
+        return (false);
+    }
+
+    /// @brief Finds IPv4 addresses without lease in a range.
+    ///
+    /// The candidates are the first address of the range, the addresses
+    /// following the leases of the range and the addresses of the reclaimed
+    /// leases of the range, so the database server reads only the leases
+    /// of the range, and a single query replaces the probing of the leased
+    /// addresses one by one. The expired-reclaimed leases make their
+    /// address free: the caller reuses them. The leases in other states,
+    /// e.g. declined or expired but not yet reclaimed, make their address
+    /// not free.
+    ///
+    /// The caller bounds the cost of the query by the size of the range.
+    ///
+    /// @param first First address of the range.
+    /// @param last Last address of the range.
+    /// @param max_count Maximum number of returned addresses.
+    ///
+    /// @return The free addresses in ascending order, empty if the range
+    /// has no free address.
+    /// @throw isc::NotImplemented if the backend does not support it.
+    virtual std::vector<isc::asiolink::IOAddress>
+    findFreeAddresses4(const isc::asiolink::IOAddress& first,
+                       const isc::asiolink::IOAddress& last,
+                       const size_t max_count);
+
     /// @brief Returns an IPv4 lease for specified IPv4 address
     ///
     /// This method return a lease that is associated with a given address.
@@ -9,6 +9,7 @@
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/dhcpsrv_exceptions.h>
 #include <dhcpsrv/dhcpsrv_log.h>
+#include <dhcpsrv/lease_change_stream.h>
 #include <dhcpsrv/lease_file_loader.h>
 #include <dhcpsrv/memfile_lease_mgr.h>
 #include <dhcpsrv/timer_mgr.h>
@@ -263,23 +264,31 @@ class MemfileLeaseStatsQuery : public LeaseStatsQuery {
 public:
     /// @brief Constructor for all subnets query
     ///
-    MemfileLeaseStatsQuery()
-        : rows_(0), next_pos_(rows_.end()) {
+    /// @param counters Lease statistics counters of the storage.
+    MemfileLeaseStatsQuery(const LeaseStatsCounters& counters)
+        : counters_(counters), rows_(0), next_pos_(rows_.end()) {
     };
 
     /// @brief Constructor for single subnet query
     ///
+    /// @param counters Lease statistics counters of the storage.
     /// @param subnet_id ID of the desired subnet
-    MemfileLeaseStatsQuery(const SubnetID& subnet_id)
-        : LeaseStatsQuery(subnet_id), rows_(0), next_pos_(rows_.end()) {
+    MemfileLeaseStatsQuery(const LeaseStatsCounters& counters,
+                           const SubnetID& subnet_id)
+        : LeaseStatsQuery(subnet_id), counters_(counters), rows_(0),
+          next_pos_(rows_.end()) {
     };
 
     /// @brief Constructor for subnet range query
     ///
+    /// @param counters Lease statistics counters of the storage.
     /// @param first_subnet_id ID of the first subnet in the desired range
     /// @param last_subnet_id ID of the last subnet in the desired range
-    MemfileLeaseStatsQuery(const SubnetID& first_subnet_id, const SubnetID& last_subnet_id)
-        : LeaseStatsQuery(first_subnet_id, last_subnet_id), rows_(0), next_pos_(rows_.end()) {
+    MemfileLeaseStatsQuery(const LeaseStatsCounters& counters,
+                           const SubnetID& first_subnet_id,
+                           const SubnetID& last_subnet_id)
+        : LeaseStatsQuery(first_subnet_id, last_subnet_id), counters_(counters),
+          rows_(0), next_pos_(rows_.end()) {
     };
 
     /// @brief Destructor
@@ -311,6 +320,41 @@ public:
     }
 
 protected:
+    /// @brief Returns the range of the counters selected by the query.
+    ///
+    /// @param [out] lower First counter of the range.
+    /// @param [out] upper Counter following the last counter of the range.
+    void getCountersRange(LeaseStatsCounters::const_iterator& lower,
+                          LeaseStatsCounters::const_iterator& upper) const {
+        // Lease::TYPE_V4 is the last lease type.
+        const uint32_t max_state = std::numeric_limits<uint32_t>::max();
+        switch (getSelectMode()) {
+        case ALL_SUBNETS:
+            lower = counters_.begin();
+            upper = counters_.end();
+            break;
+
+        case SINGLE_SUBNET:
+            lower = counters_.lower_bound(boost::make_tuple(getFirstSubnetID(),
+                                                            Lease::TYPE_NA, 0));
+            upper = counters_.upper_bound(boost::make_tuple(getFirstSubnetID(),
+                                                            Lease::TYPE_V4,
+                                                            max_state));
+            break;
+
+        case SUBNET_RANGE:
+            lower = counters_.lower_bound(boost::make_tuple(getFirstSubnetID(),
+                                                            Lease::TYPE_NA, 0));
+            upper = counters_.upper_bound(boost::make_tuple(getLastSubnetID(),
+                                                            Lease::TYPE_V4,
+                                                            max_state));
+            break;
+        }
+    }
+
+    /// @brief The lease statistics counters of the storage
+    const LeaseStatsCounters& counters_;
+
     /// @brief A vector containing the "result set"
     std::vector<LeaseStatsRow> rows_;
 
@@ -321,9 +365,9 @@ protected:
 /// @brief Memfile derivation of the IPv4 statistical lease data query
 ///
 /// This class is used to recalculate IPv4 lease statistics for Memfile
-/// lease storage.  It does so by iterating over the given storage,
-/// accumulating counts of leases in each of the monitored lease states
-/// for each subnet and storing these counts in an internal collection.
+/// lease storage.  It does so by reading the counters of leases in each
+/// of the monitored lease states for each subnet, which the lease manager
+/// maintains as the leases change, rather than by walking the storage.
 /// The populated result set will contain one entry per monitored state
 /// per subnet.
 ///
@@ -331,27 +375,29 @@ class MemfileLeaseStatsQuery4 : public MemfileLeaseStatsQuery {
 public:
     /// @brief Constructor for an all subnets query
     ///
-    /// @param storage4 A pointer to the v4 lease storage to be counted
-    MemfileLeaseStatsQuery4(Lease4Storage& storage4)
-        : MemfileLeaseStatsQuery(), storage4_(storage4) {
+    /// @param counters Lease statistics counters of the v4 storage
+    MemfileLeaseStatsQuery4(const LeaseStatsCounters& counters)
+        : MemfileLeaseStatsQuery(counters) {
     };
 
     /// @brief Constructor for a single subnet query
     ///
-    /// @param storage4 A pointer to the v4 lease storage to be counted
+    /// @param counters Lease statistics counters of the v4 storage
     /// @param subnet_id ID of the desired subnet
-    MemfileLeaseStatsQuery4(Lease4Storage& storage4, const SubnetID& subnet_id)
-        : MemfileLeaseStatsQuery(subnet_id), storage4_(storage4) {
+    MemfileLeaseStatsQuery4(const LeaseStatsCounters& counters,
+                            const SubnetID& subnet_id)
+        : MemfileLeaseStatsQuery(counters, subnet_id) {
     };
 
     /// @brief Constructor for a subnet range query
     ///
-    /// @param storage4 A pointer to the v4 lease storage to be counted
+    /// @param counters Lease statistics counters of the v4 storage
     /// @param first_subnet_id ID of the first subnet in the desired range
     /// @param last_subnet_id ID of the last subnet in the desired range
-    MemfileLeaseStatsQuery4(Lease4Storage& storage4, const SubnetID& first_subnet_id,
+    MemfileLeaseStatsQuery4(const LeaseStatsCounters& counters,
+                            const SubnetID& first_subnet_id,
                             const SubnetID& last_subnet_id)
-        : MemfileLeaseStatsQuery(first_subnet_id, last_subnet_id), storage4_(storage4) {
+        : MemfileLeaseStatsQuery(counters, first_subnet_id, last_subnet_id) {
     };
 
     /// @brief Destructor
@@ -359,141 +405,66 @@ public:
 
     /// @brief Creates the IPv4 lease statistical data result set
     ///
-    /// The result set is populated by iterating over the IPv4 leases in
-    /// storage, in ascending order by address, accumulating the lease state
-    /// counts per subnet.
-    /// At the completion of all entries for a given subnet, the counts are
-    /// used to create LeaseStatsRow instances which are appended to an
-    /// internal vector.  The process results in a vector containing one entry
-    /// per state per subnet.
+    /// The result set is populated from the counters in ascending order
+    /// by subnet id, which results in a vector containing one entry per
+    /// state per subnet.
     ///
     /// Currently the states counted are:
     ///
     /// - Lease::STATE_DEFAULT (i.e. assigned)
     /// - Lease::STATE_DECLINED
     void start() {
-        const Lease4StorageSubnetIdIndex& idx
-            = storage4_.get<SubnetIdIndexTag>();
-
-        // Set lower and upper bounds based on select mode
-        Lease4StorageSubnetIdIndex::const_iterator lower;
-        Lease4StorageSubnetIdIndex::const_iterator upper;
-        switch (getSelectMode()) {
-        case ALL_SUBNETS:
-            lower = idx.begin();
-            upper = idx.end();
-            break;
-
-        case SINGLE_SUBNET:
-            lower = idx.lower_bound(getFirstSubnetID());
-            upper = idx.upper_bound(getFirstSubnetID());
-            break;
-
-        case SUBNET_RANGE:
-            lower = idx.lower_bound(getFirstSubnetID());
-            upper = idx.upper_bound(getLastSubnetID());
-            break;
-        }
-
-        // Return an empty set if there are no rows.
-        if (lower == upper) {
-            return;
-        }
-
-        // Iterate over the leases in order by subnet, accumulating per
-        // subnet counts for each state of interest.  As we finish each
-        // subnet, add the appropriate rows to our result set.
-        SubnetID cur_id = 0;
-        int64_t assigned = 0;
-        int64_t declined = 0;
-        for(Lease4StorageSubnetIdIndex::const_iterator lease = lower;
-            lease != upper; ++lease) {
-            // If we've hit the next subnet, add rows for the current subnet
-            // and wipe the accumulators
-            if ((*lease)->subnet_id_ != cur_id) {
-                if (cur_id > 0) {
-                    if (assigned > 0) {
-                        rows_.push_back(LeaseStatsRow(cur_id,
-                                                      Lease::STATE_DEFAULT,
-                                                      assigned));
-                        assigned = 0;
-                    }
-
-                    if (declined > 0) {
-                        rows_.push_back(LeaseStatsRow(cur_id,
-                                                      Lease::STATE_DECLINED,
-                                                      declined));
-                        declined = 0;
-                    }
-                }
-
-                // Update current subnet id
-                cur_id = (*lease)->subnet_id_;
-            }
-
-            // Bump the appropriate accumulator
-            if ((*lease)->state_ == Lease::STATE_DEFAULT) {
-                ++assigned;
-            } else if ((*lease)->state_ == Lease::STATE_DECLINED) {
-                ++declined;
-            }
-        }
-
-        // Make the rows for last subnet
-        if (assigned > 0) {
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::STATE_DEFAULT,
-                                          assigned));
-        }
-
-        if (declined > 0) {
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::STATE_DECLINED,
-                                          declined));
+        LeaseStatsCounters::const_iterator lower;
+        LeaseStatsCounters::const_iterator upper;
+        getCountersRange(lower, upper);
+        for (auto counter = lower; counter != upper; ++counter) {
+            rows_.push_back(LeaseStatsRow(counter->first.get<0>(),
+                                          counter->first.get<2>(),
+                                          counter->second));
         }
 
         // Reset the next row position back to the beginning of the rows.
         next_pos_ = rows_.begin();
     }
-
-private:
-    /// @brief The Memfile storage containing the IPv4 leases to analyze
-    Lease4Storage& storage4_;
 };
 
 
 /// @brief Memfile derivation of the IPv6 statistical lease data query
 ///
 /// This class is used to recalculate IPv6 lease statistics for Memfile
-/// lease storage.  It does so by iterating over the given storage,
-/// accumulating counts of leases in each of the monitored lease states
-/// for each subnet and storing these counts in an internal collection.
+/// lease storage.  It does so by reading the counters of leases in each
+/// of the monitored lease states for each subnet, which the lease manager
+/// maintains as the leases change, rather than by walking the storage.
 /// The populated result set will contain one entry per monitored state
-/// per subnet.
+/// per lease type per subnet.
 ///
 class MemfileLeaseStatsQuery6 : public MemfileLeaseStatsQuery {
 public:
     /// @brief Constructor
     ///
-    /// @param storage6 A pointer to the v6 lease storage to be counted
-    MemfileLeaseStatsQuery6(Lease6Storage& storage6)
-        : MemfileLeaseStatsQuery(), storage6_(storage6) {
+    /// @param counters Lease statistics counters of the v6 storage
+    MemfileLeaseStatsQuery6(const LeaseStatsCounters& counters)
+        : MemfileLeaseStatsQuery(counters) {
     };
 
     /// @brief Constructor for a single subnet query
     ///
-    /// @param storage6 A pointer to the v6 lease storage to be counted
+    /// @param counters Lease statistics counters of the v6 storage
     /// @param subnet_id ID of the desired subnet
-    MemfileLeaseStatsQuery6(Lease6Storage& storage6, const SubnetID& subnet_id)
-        : MemfileLeaseStatsQuery(subnet_id), storage6_(storage6) {
+    MemfileLeaseStatsQuery6(const LeaseStatsCounters& counters,
+                            const SubnetID& subnet_id)
+        : MemfileLeaseStatsQuery(counters, subnet_id) {
     };
 
     /// @brief Constructor for a subnet range query
     ///
-    /// @param storage6 A pointer to the v6 lease storage to be counted
+    /// @param counters Lease statistics counters of the v6 storage
     /// @param first_subnet_id ID of the first subnet in the desired range
     /// @param last_subnet_id ID of the last subnet in the desired range
-    MemfileLeaseStatsQuery6(Lease6Storage& storage6, const SubnetID& first_subnet_id,
+    MemfileLeaseStatsQuery6(const LeaseStatsCounters& counters,
+                            const SubnetID& first_subnet_id,
                             const SubnetID& last_subnet_id)
-        : MemfileLeaseStatsQuery(first_subnet_id, last_subnet_id), storage6_(storage6) {
+        : MemfileLeaseStatsQuery(counters, first_subnet_id, last_subnet_id) {
     };
 
     /// @brief Destructor
@@ -501,130 +472,83 @@ public:
 
     /// @brief Creates the IPv6 lease statistical data result set
     ///
-    /// The result set is populated by iterating over the IPv6 leases in
-    /// storage, in ascending order by subnet id, accumulating the lease state
-    /// counts per subnet. At the completion of all entries for a given subnet,
-    /// the counts are used to create LeaseStatsRow instances which are appended
-    /// to an internal vector.  The process results in a vector containing one
-    /// entry per state per lease type per subnet.
+    /// The result set is populated from the counters in ascending order
+    /// by subnet id, which results in a vector containing one entry per
+    /// state per lease type per subnet.
     ///
     /// Currently the states counted are:
     ///
     /// - Lease::STATE_DEFAULT (i.e. assigned)
     /// - Lease::STATE_DECLINED
     virtual void start() {
-        // Get the subnet_id index
-        const Lease6StorageSubnetIdIndex& idx
-            = storage6_.get<SubnetIdIndexTag>();
-
-        // Set lower and upper bounds based on select mode
-        Lease6StorageSubnetIdIndex::const_iterator lower;
-        Lease6StorageSubnetIdIndex::const_iterator upper;
-        switch (getSelectMode()) {
-        case ALL_SUBNETS:
-            lower = idx.begin();
-            upper = idx.end();
-            break;
-
-        case SINGLE_SUBNET:
-            lower = idx.lower_bound(getFirstSubnetID());
-            upper = idx.upper_bound(getFirstSubnetID());
-            break;
-
-        case SUBNET_RANGE:
-            lower = idx.lower_bound(getFirstSubnetID());
-            upper = idx.upper_bound(getLastSubnetID());
-            break;
-        }
-
-        // Return an empty set if there are no rows.
-        if (lower == upper) {
-            return;
+        LeaseStatsCounters::const_iterator lower;
+        LeaseStatsCounters::const_iterator upper;
+        getCountersRange(lower, upper);
+        for (auto counter = lower; counter != upper; ++counter) {
+            rows_.push_back(LeaseStatsRow(counter->first.get<0>(),
+                                          counter->first.get<1>(),
+                                          counter->first.get<2>(),
+                                          counter->second));
         }
 
-        // Iterate over the leases in order by subnet, accumulating per
-        // subnet counts for each state of interest.  As we finish each
-        // subnet, add the appropriate rows to our result set.
-        SubnetID cur_id = 0;
-        int64_t assigned = 0;
-        int64_t declined = 0;
-        int64_t assigned_pds = 0;
-        for(Lease6StorageSubnetIdIndex::const_iterator lease = lower;
-            lease != upper; ++lease) {
-            // If we've hit the next subnet, add rows for the current subnet
-            // and wipe the accumulators
-            if ((*lease)->subnet_id_ != cur_id) {
-                if (cur_id > 0) {
-                    if (assigned > 0) {
-                        rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_NA,
-                                                      Lease::STATE_DEFAULT,
-                                                      assigned));
-                        assigned = 0;
-                    }
-
-                    if (declined > 0) {
-                        rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_NA,
-                                                      Lease::STATE_DECLINED,
-                                                      declined));
-                        declined = 0;
-                    }
-
-                    if (assigned_pds > 0) {
-                        rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_PD,
-                                                      Lease::STATE_DEFAULT,
-                                                      assigned_pds));
-                        assigned_pds = 0;
-                    }
-                }
-
-                // Update current subnet id
-                cur_id = (*lease)->subnet_id_;
-            }
-
-            // Bump the appropriate accumulator
-            if ((*lease)->state_ == Lease::STATE_DEFAULT) {
-                switch((*lease)->type_) {
-                case Lease::TYPE_NA:
-                    ++assigned;
-                    break;
-                case Lease::TYPE_PD:
-                    ++assigned_pds;
-                    break;
-                default:
-                    break;
-                }
-            } else if ((*lease)->state_ == Lease::STATE_DECLINED) {
-                // In theory only NAs can be declined
-                if (((*lease)->type_) == Lease::TYPE_NA) {
-                    ++declined;
-                }
-            }
-        }
+        // Set the next row position to the beginning of the rows.
+        next_pos_ = rows_.begin();
+    }
+};
 
-        // Make the rows for last subnet, unless there were no rows
-        if (assigned > 0) {
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_NA,
-                                          Lease::STATE_DEFAULT, assigned));
-        }
+namespace {
 
-        if (declined > 0) {
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_NA,
-                                          Lease::STATE_DECLINED, declined));
-        }
+/// @brief Updates the lease statistics counters for an IPv4 lease.
+///
+/// Only the leases in the monitored states are counted.
+///
+/// @param counters Counters to update.
+/// @param lease Lease added to or removed from the storage.
+/// @param delta 1 when the lease is added, -1 when it is removed.
+void
+countLease(LeaseStatsCounters& counters, const Lease4& lease,
+           const int64_t delta) {
+    if ((lease.subnet_id_ == 0) ||
+        ((lease.state_ != Lease::STATE_DEFAULT) &&
+         (lease.state_ != Lease::STATE_DECLINED))) {
+        return;
+    }
+    LeaseStatsKey key(lease.subnet_id_, Lease::TYPE_V4, lease.state_);
+    if ((counters[key] += delta) <= 0) {
+        counters.erase(key);
+    }
+}
 
-        if (assigned_pds > 0) {
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_PD,
-                                          Lease::STATE_DEFAULT, assigned_pds));
+/// @brief Updates the lease statistics counters for an IPv6 lease.
+///
+/// Only the leases in the monitored states are counted: assigned
+/// addresses and prefixes, and declined addresses.
+///
+/// @param counters Counters to update.
+/// @param lease Lease added to or removed from the storage.
+/// @param delta 1 when the lease is added, -1 when it is removed.
+void
+countLease(LeaseStatsCounters& counters, const Lease6& lease,
+           const int64_t delta) {
+    if (lease.subnet_id_ == 0) {
+        return;
+    }
+    if (lease.state_ == Lease::STATE_DEFAULT) {
+        if ((lease.type_ != Lease::TYPE_NA) && (lease.type_ != Lease::TYPE_PD)) {
+            return;
         }
-
-        // Set the next row position to the beginning of the rows.
-        next_pos_ = rows_.begin();
+    } else if ((lease.state_ != Lease::STATE_DECLINED) ||
+               (lease.type_ != Lease::TYPE_NA)) {
+        // In theory only NAs can be declined
+        return;
     }
+    LeaseStatsKey key(lease.subnet_id_, lease.type_, lease.state_);
+    if ((counters[key] += delta) <= 0) {
+        counters.erase(key);
+    }
+}
 
-private:
-    /// @brief The Memfile storage containing the IPv6 leases to analyze
-    Lease6Storage& storage6_;
-};
+} // end of anonymous namespace
 
 // Explicit definition of class static constants.  Values are given in the
 // declaration so they're not needed here.
@@ -645,6 +569,11 @@ Memfile_LeaseMgr::Memfile_LeaseMgr(const DatabaseConnection::ParameterMap& param
                                                  CSVLeaseFile4>(file4,
                                                                 lease_file4_,
                                                                 storage4_);
+            // Count the loaded leases once, the counters are maintained
+            // as the leases change afterwards.
+            for (auto lease : storage4_) {
+                countLease(stats4_, *lease, 1);
+            }
         }
     } else {
         std::string file6 = initLeaseFilePath(V6);
@@ -653,6 +582,11 @@ Memfile_LeaseMgr::Memfile_LeaseMgr(const DatabaseConnection::ParameterMap& param
                                                  CSVLeaseFile6>(file6,
                                                                 lease_file6_,
                                                                 storage6_);
+            // Count the loaded leases once, the counters are maintained
+            // as the leases change afterwards.
+            for (auto lease : storage6_) {
+                countLease(stats6_, *lease, 1);
+            }
         }
     }
 
@@ -708,7 +642,11 @@ Memfile_LeaseMgr::addLease(const Lease4Ptr& lease) {
         lease_file4_->append(*lease);
     }
 
-    storage4_.insert(lease);
+    // Store a copy so the lease statistics counters are not affected
+    // by the changes the caller makes to its lease before updating it.
+    storage4_.insert(Lease4Ptr(new Lease4(*lease)));
+    countLease(stats4_, *lease, 1);
+    LeaseChangeStream::instance().publish(LeaseChange::ADD, lease);
     return (true);
 }
 
@@ -729,7 +667,11 @@ Memfile_LeaseMgr::addLease(const Lease6Ptr& lease) {
         lease_file6_->append(*lease);
     }
 
-    storage6_.insert(lease);
+    // Store a copy so the lease statistics counters are not affected
+    // by the changes the caller makes to its lease before updating it.
+    storage6_.insert(Lease6Ptr(new Lease6(*lease)));
+    countLease(stats6_, *lease, 1);
+    LeaseChangeStream::instance().publish(LeaseChange::ADD, lease);
     return (true);
 }
 
@@ -1140,8 +1082,13 @@ Memfile_LeaseMgr::updateLease4(const Lease4Ptr& lease) {
         lease_file4_->append(*lease);
     }
 
+    // Move the lease to the counters of its new subnet and state.
+    countLease(stats4_, **lease_it, -1);
+    countLease(stats4_, *lease, 1);
+
     // Use replace() to re-index leases.
     index.replace(lease_it, Lease4Ptr(new Lease4(*lease)));
+    LeaseChangeStream::instance().publish(LeaseChange::UPDATE, lease);
 }
 
 void
@@ -1166,8 +1113,13 @@ Memfile_LeaseMgr::updateLease6(const Lease6Ptr& lease) {
         lease_file6_->append(*lease);
     }
 
+    // Move the lease to the counters of its new subnet and state.
+    countLease(stats6_, **lease_it, -1);
+    countLease(stats6_, *lease, 1);
+
     // Use replace() to re-index leases.
     index.replace(lease_it, Lease6Ptr(new Lease6(*lease)));
+    LeaseChangeStream::instance().publish(LeaseChange::UPDATE, lease);
 }
 
 bool
@@ -1190,7 +1142,9 @@ Memfile_LeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
                 lease_copy.valid_lft_ = 0;
                 lease_file4_->append(lease_copy);
             }
+            countLease(stats4_, **l, -1);
             storage4_.erase(l);
+            LeaseChangeStream::instance().publishDelete(addr);
             return (true);
         }
 
@@ -1211,7 +1165,9 @@ Memfile_LeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
                 lease_file6_->append(lease_copy);
             }
 
+            countLease(stats6_, **l, -1);
             storage6_.erase(l);
+            LeaseChangeStream::instance().publishDelete(addr);
             return (true);
         }
     }
@@ -1292,7 +1248,16 @@ Memfile_LeaseMgr::deleteExpiredReclaimedLeases(const uint32_t secs,
             }
         }
 
-        // Erase leases from memory.
+        // Publish the deletions before the leases are gone.
+        if (LeaseChangeStream::instance().enabled()) {
+            for (typename IndexType::const_iterator lease = lower_limit;
+                 lease != upper_limit; ++lease) {
+                LeaseChangeStream::instance().publishDelete((*lease)->addr_);
+            }
+        }
+
+        // Erase leases from memory. The reclaimed leases are not counted
+        // in the lease statistics so the counters are unchanged.
         index.erase(lower_limit, upper_limit);
     }
     // Return number of leases deleted.
@@ -1569,14 +1534,14 @@ void Memfile_LeaseMgr::lfcExecute(boost::shared_ptr<LeaseFileType>& lease_file)
 
 LeaseStatsQueryPtr
 Memfile_LeaseMgr::startLeaseStatsQuery4() {
-    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery4(storage4_));
+    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery4(stats4_));
     query->start();
     return(query);
 }
 
 LeaseStatsQueryPtr
 Memfile_LeaseMgr::startSubnetLeaseStatsQuery4(const SubnetID& subnet_id) {
-    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery4(storage4_, subnet_id));
+    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery4(stats4_, subnet_id));
     query->start();
     return(query);
 }
@@ -1584,7 +1549,7 @@ Memfile_LeaseMgr::startSubnetLeaseStatsQuery4(const SubnetID& subnet_id) {
 LeaseStatsQueryPtr
 Memfile_LeaseMgr::startSubnetRangeLeaseStatsQuery4(const SubnetID& first_subnet_id,
                                                    const SubnetID& last_subnet_id) {
-    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery4(storage4_, first_subnet_id,
+    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery4(stats4_, first_subnet_id,
                                                          last_subnet_id));
     query->start();
     return(query);
@@ -1592,14 +1557,14 @@ Memfile_LeaseMgr::startSubnetRangeLeaseStatsQuery4(const SubnetID& first_subnet_
 
 LeaseStatsQueryPtr
 Memfile_LeaseMgr::startLeaseStatsQuery6() {
-    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery6(storage6_));
+    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery6(stats6_));
     query->start();
     return(query);
 }
 
 LeaseStatsQueryPtr
 Memfile_LeaseMgr::startSubnetLeaseStatsQuery6(const SubnetID& subnet_id) {
-    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery6(storage6_, subnet_id));
+    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery6(stats6_, subnet_id));
     query->start();
     return(query);
 }
@@ -1607,7 +1572,7 @@ Memfile_LeaseMgr::startSubnetLeaseStatsQuery6(const SubnetID& subnet_id) {
 LeaseStatsQueryPtr
 Memfile_LeaseMgr::startSubnetRangeLeaseStatsQuery6(const SubnetID& first_subnet_id,
                                                    const SubnetID& last_subnet_id) {
-    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery6(storage6_, first_subnet_id,
+    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery6(stats6_, first_subnet_id,
                                                          last_subnet_id));
     query->start();
     return(query);
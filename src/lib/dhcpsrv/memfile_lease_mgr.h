@@ -681,6 +681,12 @@ private:
     /// @brief stores IPv6 leases
     Lease6Storage storage6_;
 
+    /// @brief Lease statistics counters of the IPv4 leases.
+    LeaseStatsCounters stats4_;
+
+    /// @brief Lease statistics counters of the IPv6 leases.
+    LeaseStatsCounters stats6_;
+
     /// @brief Holds the pointer to the DHCPv4 lease file IO.
     boost::shared_ptr<CSVLeaseFile4> lease_file4_;
 
@@ -17,6 +17,10 @@
 #include <boost/multi_index/ordered_index.hpp>
 #include <boost/multi_index_container.hpp>
 #include <boost/multi_index/composite_key.hpp>
+#include <boost/tuple/tuple.hpp>
+#include <boost/tuple/tuple_comparison.hpp>
+
+#include <map>
 
 #include <vector>
 
@@ -287,6 +291,19 @@ Lease4StorageClientIdHWAddressSubnetIdIndex;
 typedef Lease4Storage::index<SubnetIdIndexTag>::type Lease4StorageSubnetIdIndex;
 
 //@}
+
+/// @brief Key of the lease statistics counters.
+///
+/// It holds the subnet identifier, the lease type and the lease state.
+/// The DHCPv4 leases use the @c Lease::TYPE_V4 type.
+typedef boost::tuple<SubnetID, Lease::Type, uint32_t> LeaseStatsKey;
+
+/// @brief Numbers of leases per subnet, lease type and lease state.
+///
+/// The counters are maintained when the leases are added, updated and
+/// deleted so the lease statistics don't require walking the storage.
+/// The counters dropping to zero are removed.
+typedef std::map<LeaseStatsKey, int64_t> LeaseStatsCounters;
 } // end of isc::dhcp namespace
 } // end of isc namespace
 
@@ -6,6 +6,7 @@
 
 #include <config.h>
 
+#include <database/db_context_pool.h>
 #include <database/db_exceptions.h>
 #include <dhcp/libdhcp++.h>
 #include <dhcp/option.h>
@@ -20,6 +21,7 @@
 #include <boost/algorithm/string/split.hpp>
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/array.hpp>
+#include <boost/bind.hpp>
 #include <boost/pointer_cast.hpp>
 #include <boost/static_assert.hpp>
 
@@ -1893,7 +1895,24 @@ private:
 namespace isc {
 namespace dhcp {
 
+class MySqlHostContext;
+
+/// @brief Pointer to a MySQL host context.
+typedef boost::shared_ptr<MySqlHostContext> MySqlHostContextPtr;
+
+/// @brief Pool of MySQL host contexts.
+typedef DbContextPool<MySqlHostContext> MySqlHostContextPool;
+
+/// @brief Takes a MySQL host context from the pool for the scope.
+typedef DbContextAlloc<MySqlHostContext> MySqlHostContextAlloc;
+
 /// @brief Implementation of the @ref MySqlHostDataSource.
+///
+/// The connections to the database are kept in a pool: each operation
+/// takes a connection for its exclusive use. The maximum number of
+/// connections is given by the @c pool-size parameter. Unless it is
+/// configured, the DHCPv4 server sets it to one more than the number of
+/// lease lookup threads.
 class MySqlHostDataSourceImpl {
 public:
 
@@ -1936,62 +1955,80 @@ public:
 
     /// @brief Constructor.
     ///
-    /// This constructor opens database connection and initializes prepared
-    /// statements used in the queries.
+    /// This constructor creates the pool of connections and opens the
+    /// first connection to check the database.
     MySqlHostDataSourceImpl(const MySqlConnection::ParameterMap& parameters);
 
     /// @brief Destructor.
     ~MySqlHostDataSourceImpl();
 
+    /// @brief Opens a new connection to the database.
+    ///
+    /// Checks the schema version and initializes prepared statements used
+    /// in the queries.
+    ///
+    /// @return Pointer to the new context.
+    MySqlHostContextPtr createContext() const;
+
     /// @brief Returns backend version.
     ///
-    /// The method is called by the constructor after opening the database
-    /// but prior to preparing SQL statements, to verify that the schema version
+    /// The method is called after opening a connection but prior to
+    /// preparing SQL statements, to verify that the schema version
     /// is correct. Thus it must not rely on a pre-prepared statement or
     /// formal statement execution error checking.
-    //
+    ///
+    /// @param ctx Context with an open connection to the database.
+    ///
     /// @return Version number stored in the database, as a pair of unsigned
     ///         integers. "first" is the major version number, "second" the
     ///         minor number.
     ///
     /// @throw isc::dhcp::DbOperationError An operation on the open database
     ///        has failed.
-    std::pair<uint32_t, uint32_t> getVersion() const;
+    std::pair<uint32_t, uint32_t> getVersion(MySqlHostContextPtr& ctx) const;
 
     /// @brief Executes statements which inserts a row into one of the tables.
     ///
+    /// @param ctx Context of the operation.
     /// @param stindex Index of a statement being executed.
     /// @param bind Vector of MYSQL_BIND objects to be used when making the
     /// query.
     ///
     /// @throw isc::db::DuplicateEntry Database throws duplicate entry error
-    void addStatement(MySqlHostDataSourceImpl::StatementIndex stindex,
+    void addStatement(MySqlHostContextPtr& ctx,
+                      MySqlHostDataSourceImpl::StatementIndex stindex,
                       std::vector<MYSQL_BIND>& bind);
 
     /// @brief Executes statements that delete records.
     ///
+    /// @param ctx Context of the operation.
     /// @param stindex Index of a statement being executed.
     /// @param bind Vector of MYSQL_BIND objects to be used when making the
     /// query.
     /// @return true if any records were deleted, false otherwise
     bool
-    delStatement(StatementIndex stindex, MYSQL_BIND* bind);
+    delStatement(MySqlHostContextPtr& ctx,
+                 StatementIndex stindex, MYSQL_BIND* bind);
 
     /// @brief Inserts IPv6 Reservation into ipv6_reservation table.
     ///
+    /// @param ctx Context of the operation.
     /// @param resv IPv6 Reservation to be added
     /// @param id ID of a host owning this reservation
-    void addResv(const IPv6Resrv& resv, const HostID& id);
+    void addResv(MySqlHostContextPtr& ctx,
+                 const IPv6Resrv& resv, const HostID& id);
 
     /// @brief Inserts a single DHCP option into the database.
     ///
+    /// @param ctx Context of the operation.
     /// @param stindex Index of a statement being executed.
     /// @param opt_desc Option descriptor holding information about an option
     /// to be inserted into the database.
     /// @param opt_space Option space name.
     /// @param subnet_id Subnet identifier.
     /// @param host_id Host identifier.
-    void addOption(const MySqlHostDataSourceImpl::StatementIndex& stindex,
+    void addOption(MySqlHostContextPtr& ctx,
+                   const MySqlHostDataSourceImpl::StatementIndex& stindex,
                    const OptionDescriptor& opt_desc,
                    const std::string& opt_space,
                    const Optional<SubnetID>& subnet_id,
@@ -1999,24 +2036,28 @@ public:
 
     /// @brief Inserts multiple options into the database.
     ///
+    /// @param ctx Context of the operation.
     /// @param stindex Index of a statement being executed.
     /// @param options_cfg An object holding a collection of options to be
     /// inserted into the database.
     /// @param host_id Host identifier retrieved using @c mysql_insert_id.
-    void addOptions(const StatementIndex& stindex, const ConstCfgOptionPtr& options_cfg,
+    void addOptions(MySqlHostContextPtr& ctx,
+                    const StatementIndex& stindex, const ConstCfgOptionPtr& options_cfg,
                     const uint64_t host_id);
 
     /// @brief Check Error and Throw Exception
     ///
     /// This method invokes @ref db::MySqlConnection::checkError.
     ///
+    /// @param ctx Context of the operation.
     /// @param status Status code: non-zero implies an error
     /// @param index Index of statement that caused the error
     /// @param what High-level description of the error
     ///
     /// @throw isc::dhcp::DbOperationError An operation on the open database has
     ///        failed.
-    void checkError(const int status, const StatementIndex index,
+    void checkError(MySqlHostContextPtr& ctx,
+                    const int status, const StatementIndex index,
                     const char* what) const;
 
     /// @brief Creates collection of @ref Host objects with associated
@@ -2029,6 +2070,7 @@ public:
     /// Whether IPv6 reservations and/or options are assigned to the
     /// @ref Host objects depends on the type of the exchange object.
     ///
+    /// @param ctx Context of the operation.
     /// @param stindex Statement index.
     /// @param bind Pointer to an array of MySQL bindings.
     /// @param exchange Pointer to the exchange object used for the
@@ -2036,7 +2078,8 @@ public:
     /// @param [out] result Reference to the collection of hosts returned.
     /// @param single A boolean value indicating if a single host is
     /// expected to be returned, or multiple hosts.
-    void getHostCollection(StatementIndex stindex, MYSQL_BIND* bind,
+    void getHostCollection(MySqlHostContextPtr& ctx,
+                           StatementIndex stindex, MYSQL_BIND* bind,
                            boost::shared_ptr<MySqlHostExchange> exchange,
                            ConstHostCollection& result, bool single) const;
 
@@ -2045,6 +2088,7 @@ public:
     /// This method is used by both MySqlHostDataSource::get4 and
     /// MySqlHOstDataSource::get6 methods.
     ///
+    /// @param ctx Context of the operation.
     /// @param subnet_id Subnet identifier.
     /// @param identifier_type Identifier type.
     /// @param identifier_begin Pointer to a beginning of a buffer containing
@@ -2056,7 +2100,8 @@ public:
     ///
     /// @return Pointer to const instance of Host or null pointer if
     /// no host found.
-    ConstHostPtr getHost(const SubnetID& subnet_id,
+    ConstHostPtr getHost(MySqlHostContextPtr& ctx,
+                         const SubnetID& subnet_id,
                          const Host::IdentifierType& identifier_type,
                          const uint8_t* identifier_begin,
                          const size_t identifier_len,
@@ -2072,6 +2117,33 @@ public:
     /// @throw DbReadOnly if backend is operating in read only mode.
     void checkReadOnly() const;
 
+    /// @brief Parameters of the connections.
+    MySqlConnection::ParameterMap parameters_;
+
+    /// @brief Pool of connections.
+    boost::scoped_ptr<MySqlHostContextPool> pool_;
+
+    /// @brief Indicates if the database is opened in read only mode.
+    bool is_readonly_;
+};
+
+/// @brief MySQL host context.
+///
+/// An open connection to the database with its prepared statements and
+/// the exchange objects used to transfer the data of these statements.
+/// A context is used by one caller at a time.
+class MySqlHostContext {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param parameters A data structure relating keywords and values
+    ///        concerned with the database.
+    MySqlHostContext(const MySqlConnection::ParameterMap& parameters);
+
+    /// @brief Destructor.
+    ~MySqlHostContext();
+
     /// @brief Pointer to the object representing an exchange which
     /// can be used to retrieve hosts and DHCPv4 options.
     boost::shared_ptr<MySqlHostWithOptionsExchange> host_exchange_;
@@ -2096,9 +2168,6 @@ public:
 
     /// @brief MySQL connection
     MySqlConnection conn_;
-
-    /// @brief Indicates if the database is opened in read only mode.
-    bool is_readonly_;
 };
 
 namespace {
@@ -2403,24 +2472,65 @@ TaggedStatementArray tagged_statements = { {
 
 }; // anonymous namespace
 
-MySqlHostDataSourceImpl::
-MySqlHostDataSourceImpl(const MySqlConnection::ParameterMap& parameters)
+MySqlHostContext::
+MySqlHostContext(const MySqlConnection::ParameterMap& parameters)
     : host_exchange_(new MySqlHostWithOptionsExchange(MySqlHostWithOptionsExchange::DHCP4_ONLY)),
       host_ipv6_exchange_(new MySqlHostIPv6Exchange(MySqlHostWithOptionsExchange::DHCP6_ONLY)),
       host_ipv46_exchange_(new MySqlHostIPv6Exchange(MySqlHostWithOptionsExchange::
                                                      DHCP4_AND_DHCP6)),
       host_ipv6_reservation_exchange_(new MySqlIPv6ReservationExchange()),
       host_option_exchange_(new MySqlOptionExchange()),
-      conn_(parameters),
-      is_readonly_(false) {
+      conn_(parameters) {
+}
+
+MySqlHostContext::~MySqlHostContext() {
+    // Free up the prepared statements, ignoring errors. (What would we do
+    // about them? We're destroying this object and are not really concerned
+    // with errors on a database connection that is about to go away.)
+    for (int i = 0; i < conn_.statements_.size(); ++i) {
+        if (conn_.statements_[i] != NULL) {
+            (void) mysql_stmt_close(conn_.statements_[i]);
+            conn_.statements_[i] = NULL;
+        }
+    }
+
+    // There is no need to close the database in this destructor: it is
+    // closed in the destructor of the mysql_ member variable.
+}
+
+MySqlHostDataSourceImpl::
+MySqlHostDataSourceImpl(const MySqlConnection::ParameterMap& parameters)
+    : parameters_(parameters), is_readonly_(false) {
+
+    pool_.reset(new MySqlHostContextPool(boost::bind(&MySqlHostDataSourceImpl::createContext,
+                                                     this),
+                                         getDbPoolMaxSize(parameters_)));
+
+    // Open the first connection to check the database.
+    MySqlHostContextAlloc get_context(*pool_);
+
+    // Check if the backend is explicitly configured to operate with
+    // read only access to the database.
+    is_readonly_ = get_context.ctx_->conn_.configuredReadOnly();
+    if (is_readonly_) {
+        LOG_INFO(dhcpsrv_logger, DHCPSRV_MYSQL_HOST_DB_READONLY);
+    }
+}
+
+MySqlHostDataSourceImpl::~MySqlHostDataSourceImpl() {
+}
+
+MySqlHostContextPtr
+MySqlHostDataSourceImpl::createContext() const {
+    MySqlHostContextPtr ctx(new MySqlHostContext(parameters_));
 
     // Open the database.
-    conn_.openDatabase();
+    ctx->conn_.openDatabase();
 
     // Test schema version before we try to prepare statements.
     std::pair<uint32_t, uint32_t> code_version(MYSQL_SCHEMA_VERSION_MAJOR,
                                                MYSQL_SCHEMA_VERSION_MINOR);
-    std::pair<uint32_t, uint32_t> db_version = getVersion();
+    std::pair<uint32_t, uint32_t> db_version = getVersion(ctx);
     if (code_version != db_version) {
         isc_throw(DbOpenError, "MySQL schema version mismatch: need version: "
                   << code_version.first << "." << code_version.second
@@ -2435,57 +2545,38 @@ MySqlHostDataSourceImpl(const MySqlConnection::ParameterMap& parameters)
     // caused issues for some unit tests which were unable to cleanup
     // the database after the test because of pending transactions.
     // Use of autocommit will eliminate this problem.
-    my_bool result = mysql_autocommit(conn_.mysql_, 1);
+    my_bool result = mysql_autocommit(ctx->conn_.mysql_, 1);
     if (result != 0) {
-        isc_throw(DbOperationError, mysql_error(conn_.mysql_));
+        isc_throw(DbOperationError, mysql_error(ctx->conn_.mysql_));
     }
 
     // Prepare query statements. Those are will be only used to retrieve
     // information from the database, so they can be used even if the
     // database is read only for the current user.
-    conn_.prepareStatements(tagged_statements.begin(),
-                            tagged_statements.begin() + WRITE_STMTS_BEGIN);
-
-    // Check if the backend is explicitly configured to operate with
-    // read only access to the database.
-    is_readonly_ = conn_.configuredReadOnly();
+    ctx->conn_.prepareStatements(tagged_statements.begin(),
+                                 tagged_statements.begin() + WRITE_STMTS_BEGIN);
 
     // If we are using read-write mode for the database we also prepare
     // statements for INSERTS etc.
-    if (!is_readonly_) {
+    if (!ctx->conn_.configuredReadOnly()) {
         // Prepare statements for writing to the database, e.g. INSERT.
-        conn_.prepareStatements(tagged_statements.begin() + WRITE_STMTS_BEGIN,
-                                tagged_statements.end());
-    } else {
-        LOG_INFO(dhcpsrv_logger, DHCPSRV_MYSQL_HOST_DB_READONLY);
+        ctx->conn_.prepareStatements(tagged_statements.begin() + WRITE_STMTS_BEGIN,
+                                     tagged_statements.end());
     }
-}
 
-MySqlHostDataSourceImpl::~MySqlHostDataSourceImpl() {
-    // Free up the prepared statements, ignoring errors. (What would we do
-    // about them? We're destroying this object and are not really concerned
-    // with errors on a database connection that is about to go away.)
-    for (int i = 0; i < conn_.statements_.size(); ++i) {
-        if (conn_.statements_[i] != NULL) {
-            (void) mysql_stmt_close(conn_.statements_[i]);
-            conn_.statements_[i] = NULL;
-        }
-    }
-
-    // There is no need to close the database in this destructor: it is
-    // closed in the destructor of the mysql_ member variable.
+    return (ctx);
 }
 
 std::pair<uint32_t, uint32_t>
-MySqlHostDataSourceImpl::getVersion() const {
+MySqlHostDataSourceImpl::getVersion(MySqlHostContextPtr& ctx) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MYSQL_HOST_DB_GET_VERSION);
 
     // Allocate a new statement.
-    MYSQL_STMT *stmt = mysql_stmt_init(conn_.mysql_);
+    MYSQL_STMT *stmt = mysql_stmt_init(ctx->conn_.mysql_);
     if (stmt == NULL) {
         isc_throw(DbOperationError, "unable to allocate MySQL prepared "
-                  "statement structure, reason: " << mysql_error(conn_.mysql_));
+                  "statement structure, reason: " << mysql_error(ctx->conn_.mysql_));
     }
 
     // Prepare the statement from SQL text.
@@ -2493,13 +2584,13 @@ MySqlHostDataSourceImpl::getVersion() const {
     int status = mysql_stmt_prepare(stmt, version_sql, strlen(version_sql));
     if (status != 0) {
         isc_throw(DbOperationError, "unable to prepare MySQL statement <"
-                  << version_sql << ">, reason: " << mysql_errno(conn_.mysql_));
+                  << version_sql << ">, reason: " << mysql_errno(ctx->conn_.mysql_));
     }
 
     // Execute the prepared statement.
     if (mysql_stmt_execute(stmt) != 0) {
         isc_throw(DbOperationError, "cannot execute schema version query <"
-                  << version_sql << ">, reason: " << mysql_errno(conn_.mysql_));
+                  << version_sql << ">, reason: " << mysql_errno(ctx->conn_.mysql_));
     }
 
     // Bind the output of the statement to the appropriate variables.
@@ -2520,14 +2611,14 @@ MySqlHostDataSourceImpl::getVersion() const {
 
     if (mysql_stmt_bind_result(stmt, bind)) {
         isc_throw(DbOperationError, "unable to bind result set for <"
-                  << version_sql << ">, reason: " << mysql_errno(conn_.mysql_));
+                  << version_sql << ">, reason: " << mysql_errno(ctx->conn_.mysql_));
     }
 
     // Fetch the data.
     if (mysql_stmt_fetch(stmt)) {
         mysql_stmt_close(stmt);
         isc_throw(DbOperationError, "unable to bind result set for <"
-                  << version_sql << ">, reason: " << mysql_errno(conn_.mysql_));
+                  << version_sql << ">, reason: " << mysql_errno(ctx->conn_.mysql_));
     }
 
     // Discard the statement and its resources
@@ -2538,68 +2629,73 @@ MySqlHostDataSourceImpl::getVersion() const {
 
 
 void
-MySqlHostDataSourceImpl::addStatement(StatementIndex stindex,
+MySqlHostDataSourceImpl::addStatement(MySqlHostContextPtr& ctx,
+                                      StatementIndex stindex,
                                       std::vector<MYSQL_BIND>& bind) {
 
     // Bind the parameters to the statement
-    int status = mysql_stmt_bind_param(conn_.statements_[stindex], &bind[0]);
-    checkError(status, stindex, "unable to bind parameters");
+    int status = mysql_stmt_bind_param(ctx->conn_.statements_[stindex], &bind[0]);
+    checkError(ctx, status, stindex, "unable to bind parameters");
 
     // Execute the statement
-    status = mysql_stmt_execute(conn_.statements_[stindex]);
+    status = mysql_stmt_execute(ctx->conn_.statements_[stindex]);
 
     if (status != 0) {
         // Failure: check for the special case of duplicate entry.
-        if (mysql_errno(conn_.mysql_) == ER_DUP_ENTRY) {
+        if (mysql_errno(ctx->conn_.mysql_) == ER_DUP_ENTRY) {
             isc_throw(DuplicateEntry, "Database duplicate entry error");
         }
-        checkError(status, stindex, "unable to execute");
+        checkError(ctx, status, stindex, "unable to execute");
     }
 }
 
 bool
-MySqlHostDataSourceImpl::delStatement(StatementIndex stindex,
+MySqlHostDataSourceImpl::delStatement(MySqlHostContextPtr& ctx,
+                                      StatementIndex stindex,
                                       MYSQL_BIND* bind) {
     // Bind the parameters to the statement
-    int status = mysql_stmt_bind_param(conn_.statements_[stindex], &bind[0]);
-    checkError(status, stindex, "unable to bind parameters");
+    int status = mysql_stmt_bind_param(ctx->conn_.statements_[stindex], &bind[0]);
+    checkError(ctx, status, stindex, "unable to bind parameters");
 
     // Execute the statement
-    status = mysql_stmt_execute(conn_.statements_[stindex]);
+    status = mysql_stmt_execute(ctx->conn_.statements_[stindex]);
 
     if (status != 0) {
-        checkError(status, stindex, "unable to execute");
+        checkError(ctx, status, stindex, "unable to execute");
     }
 
     // Let's check how many hosts were deleted.
-    my_ulonglong numrows = mysql_stmt_affected_rows(conn_.statements_[stindex]);
+    my_ulonglong numrows = mysql_stmt_affected_rows(ctx->conn_.statements_[stindex]);
     return (numrows != 0);
 }
 
 void
-MySqlHostDataSourceImpl::addResv(const IPv6Resrv& resv,
+MySqlHostDataSourceImpl::addResv(MySqlHostContextPtr& ctx,
+                                 const IPv6Resrv& resv,
                                  const HostID& id) {
     std::vector<MYSQL_BIND> bind =
-        host_ipv6_reservation_exchange_->createBindForSend(resv, id);
+        ctx->host_ipv6_reservation_exchange_->createBindForSend(resv, id);
 
-    addStatement(INSERT_V6_RESRV, bind);
+    addStatement(ctx, INSERT_V6_RESRV, bind);
 }
 
 void
-MySqlHostDataSourceImpl::addOption(const StatementIndex& stindex,
+MySqlHostDataSourceImpl::addOption(MySqlHostContextPtr& ctx,
+                                   const StatementIndex& stindex,
                                    const OptionDescriptor& opt_desc,
                                    const std::string& opt_space,
                                    const Optional<SubnetID>& subnet_id,
                                    const HostID& id) {
     std::vector<MYSQL_BIND> bind =
-        host_option_exchange_->createBindForSend(opt_desc, opt_space,
+        ctx->host_option_exchange_->createBindForSend(opt_desc, opt_space,
                                                  subnet_id, id);
 
-    addStatement(stindex, bind);
+    addStatement(ctx, stindex, bind);
 }
 
 void
-MySqlHostDataSourceImpl::addOptions(const StatementIndex& stindex,
+MySqlHostDataSourceImpl::addOptions(MySqlHostContextPtr& ctx,
+                                    const StatementIndex& stindex,
                                     const ConstCfgOptionPtr& options_cfg,
                                     const uint64_t host_id) {
     // Get option space names and vendor space names and combine them within a
@@ -2617,7 +2713,7 @@ MySqlHostDataSourceImpl::addOptions(const StatementIndex& stindex,
         if (options && !options->empty()) {
             for (OptionContainer::const_iterator opt = options->begin();
                  opt != options->end(); ++opt) {
-                addOption(stindex, *opt, *space, Optional<SubnetID>(),
+                addOption(ctx, stindex, *opt, *space, Optional<SubnetID>(),
                           host_id);
             }
         }
@@ -2626,42 +2722,43 @@ MySqlHostDataSourceImpl::addOptions(const StatementIndex& stindex,
 
 void
 MySqlHostDataSourceImpl::
-checkError(const int status, const StatementIndex index,
-           const char* what) const {
-    conn_.checkError(status, index, what);
+checkError(MySqlHostContextPtr& ctx, const int status,
+           const StatementIndex index, const char* what) const {
+    ctx->conn_.checkError(status, index, what);
 }
 
 void
 MySqlHostDataSourceImpl::
-getHostCollection(StatementIndex stindex, MYSQL_BIND* bind,
+getHostCollection(MySqlHostContextPtr& ctx,
+                  StatementIndex stindex, MYSQL_BIND* bind,
                   boost::shared_ptr<MySqlHostExchange> exchange,
                   ConstHostCollection& result, bool single) const {
 
     // Bind the selection parameters to the statement
-    int status = mysql_stmt_bind_param(conn_.statements_[stindex], bind);
-    checkError(status, stindex, "unable to bind WHERE clause parameter");
+    int status = mysql_stmt_bind_param(ctx->conn_.statements_[stindex], bind);
+    checkError(ctx, status, stindex, "unable to bind WHERE clause parameter");
 
     // Set up the MYSQL_BIND array for the data being returned and bind it to
     // the statement.
     std::vector<MYSQL_BIND> outbind = exchange->createBindForReceive();
-    status = mysql_stmt_bind_result(conn_.statements_[stindex], &outbind[0]);
-    checkError(status, stindex, "unable to bind SELECT clause parameters");
+    status = mysql_stmt_bind_result(ctx->conn_.statements_[stindex], &outbind[0]);
+    checkError(ctx, status, stindex, "unable to bind SELECT clause parameters");
 
     // Execute the statement
-    status = mysql_stmt_execute(conn_.statements_[stindex]);
-    checkError(status, stindex, "unable to execute");
+    status = mysql_stmt_execute(ctx->conn_.statements_[stindex]);
+    checkError(ctx, status, stindex, "unable to execute");
 
     // Ensure that all the lease information is retrieved in one go to avoid
     // overhead of going back and forth between client and server.
-    status = mysql_stmt_store_result(conn_.statements_[stindex]);
-    checkError(status, stindex, "unable to set up for storing all results");
+    status = mysql_stmt_store_result(ctx->conn_.statements_[stindex]);
+    checkError(ctx, status, stindex, "unable to set up for storing all results");
 
     // Set up the fetch "release" object to release resources associated
     // with the call to mysql_stmt_fetch when this method exits, then
     // retrieve the data. mysql_stmt_fetch return value equal to 0 represents
     // successful data fetch.
-    MySqlFreeResult fetch_release(conn_.statements_[stindex]);
-    while ((status = mysql_stmt_fetch(conn_.statements_[stindex])) ==
+    MySqlFreeResult fetch_release(ctx->conn_.statements_[stindex]);
+    while ((status = mysql_stmt_fetch(ctx->conn_.statements_[stindex])) ==
            MLM_MYSQL_FETCH_SUCCESS) {
         try {
             exchange->processFetchedData(result);
@@ -2669,13 +2766,13 @@ getHostCollection(StatementIndex stindex, MYSQL_BIND* bind,
         } catch (const isc::BadValue& ex) {
             // Rethrow the exception with a bit more data.
             isc_throw(BadValue, ex.what() << ". Statement is <" <<
-                    conn_.text_statements_[stindex] << ">");
+                    ctx->conn_.text_statements_[stindex] << ">");
         }
 
         if (single && (result.size() > 1)) {
             isc_throw(MultipleRecords, "multiple records were found in the "
                       "database where only one was expected for query "
-                      << conn_.text_statements_[stindex]);
+                      << ctx->conn_.text_statements_[stindex]);
         }
     }
 
@@ -2683,11 +2780,11 @@ getHostCollection(StatementIndex stindex, MYSQL_BIND* bind,
     // If mysql_stmt_fetch return value is equal to 1 an error occurred.
     if (status == MLM_MYSQL_FETCH_FAILURE) {
         // Error - unable to fetch results
-        checkError(status, stindex, "unable to fetch results");
+        checkError(ctx, status, stindex, "unable to fetch results");
 
     } else if (status == MYSQL_DATA_TRUNCATED) {
         // Data truncated - throw an exception indicating what was at fault
-        isc_throw(DataTruncated, conn_.text_statements_[stindex]
+        isc_throw(DataTruncated, ctx->conn_.text_statements_[stindex]
                   << " returned truncated data: columns affected are "
                   << exchange->getErrorColumns());
     }
@@ -2695,7 +2792,8 @@ getHostCollection(StatementIndex stindex, MYSQL_BIND* bind,
 
 ConstHostPtr
 MySqlHostDataSourceImpl::
-getHost(const SubnetID& subnet_id,
+getHost(MySqlHostContextPtr& ctx,
+        const SubnetID& subnet_id,
         const Host::IdentifierType& identifier_type,
         const uint8_t* identifier_begin,
         const size_t identifier_len,
@@ -2727,7 +2825,7 @@ getHost(const SubnetID& subnet_id,
     inbind[1].is_unsigned = MLM_TRUE;
 
     ConstHostCollection collection;
-    getHostCollection(stindex, inbind, exchange, collection, true);
+    getHostCollection(ctx, stindex, inbind, exchange, collection, true);
 
     // Return single record if present, else clear the host.
     ConstHostPtr result;
@@ -2759,32 +2857,36 @@ MySqlHostDataSource::add(const HostPtr& host) {
     // If operating in read-only mode, throw exception.
     impl_->checkReadOnly();
 
+    // Get a context
+    MySqlHostContextAlloc get_context(*impl_->pool_);
+    MySqlHostContextPtr ctx = get_context.ctx_;
+
     // Initiate MySQL transaction as we will have to make multiple queries
     // to insert host information into multiple tables. If that fails on
     // any stage, the transaction will be rolled back by the destructor of
     // the MySqlTransaction class.
-    MySqlTransaction transaction(impl_->conn_);
+    MySqlTransaction transaction(ctx->conn_);
 
     // Create the MYSQL_BIND array for the host
-    std::vector<MYSQL_BIND> bind = impl_->host_exchange_->createBindForSend(host);
+    std::vector<MYSQL_BIND> bind = ctx->host_exchange_->createBindForSend(host);
 
     // ... and insert the host.
-    impl_->addStatement(MySqlHostDataSourceImpl::INSERT_HOST, bind);
+    impl_->addStatement(ctx, MySqlHostDataSourceImpl::INSERT_HOST, bind);
 
     // Gets the last inserted hosts id
-    uint64_t host_id = mysql_insert_id(impl_->conn_.mysql_);
+    uint64_t host_id = mysql_insert_id(ctx->conn_.mysql_);
 
     // Insert DHCPv4 options.
     ConstCfgOptionPtr cfg_option4 = host->getCfgOption4();
     if (cfg_option4) {
-        impl_->addOptions(MySqlHostDataSourceImpl::INSERT_V4_OPTION,
+        impl_->addOptions(ctx, MySqlHostDataSourceImpl::INSERT_V4_OPTION,
                           cfg_option4, host_id);
     }
 
     // Insert DHCPv6 options.
     ConstCfgOptionPtr cfg_option6 = host->getCfgOption6();
     if (cfg_option6) {
-        impl_->addOptions(MySqlHostDataSourceImpl::INSERT_V6_OPTION,
+        impl_->addOptions(ctx, MySqlHostDataSourceImpl::INSERT_V6_OPTION,
                           cfg_option6, host_id);
     }
 
@@ -2793,7 +2895,7 @@ MySqlHostDataSource::add(const HostPtr& host) {
     if (std::distance(v6resv.first, v6resv.second) > 0) {
         for (IPv6ResrvIterator resv = v6resv.first; resv != v6resv.second;
              ++resv) {
-            impl_->addResv(resv->second, host_id);
+            impl_->addResv(ctx, resv->second, host_id);
         }
     }
 
@@ -2821,8 +2923,12 @@ MySqlHostDataSource::del(const SubnetID& subnet_id, const asiolink::IOAddress& a
         inbind[1].buffer = reinterpret_cast<char*>(&addr4);
         inbind[1].is_unsigned = MLM_TRUE;
 
+        // Get a context
+        MySqlHostContextAlloc get_context(*impl_->pool_);
+        MySqlHostContextPtr ctx = get_context.ctx_;
+
         ConstHostCollection collection;
-        return (impl_->delStatement(MySqlHostDataSourceImpl::DEL_HOST_ADDR4, inbind));
+        return (impl_->delStatement(ctx, MySqlHostDataSourceImpl::DEL_HOST_ADDR4, inbind));
     }
 
     // v6
@@ -2868,8 +2974,12 @@ MySqlHostDataSource::del4(const SubnetID& subnet_id,
     inbind[2].buffer_length = length;
     inbind[2].length = &length;
 
+    // Get a context
+    MySqlHostContextAlloc get_context(*impl_->pool_);
+    MySqlHostContextPtr ctx = get_context.ctx_;
+
     ConstHostCollection collection;
-    return (impl_->delStatement(MySqlHostDataSourceImpl::DEL_HOST_SUBID4_ID, inbind));
+    return (impl_->delStatement(ctx, MySqlHostDataSourceImpl::DEL_HOST_SUBID4_ID, inbind));
 }
 
 bool
@@ -2904,8 +3014,12 @@ MySqlHostDataSource::del6(const SubnetID& subnet_id,
     inbind[2].buffer_length = length;
     inbind[2].length = &length;
 
+    // Get a context
+    MySqlHostContextAlloc get_context(*impl_->pool_);
+    MySqlHostContextPtr ctx = get_context.ctx_;
+
     ConstHostCollection collection;
-    return (impl_->delStatement(MySqlHostDataSourceImpl::DEL_HOST_SUBID6_ID, inbind));
+    return (impl_->delStatement(ctx, MySqlHostDataSourceImpl::DEL_HOST_SUBID6_ID, inbind));
 }
 
 ConstHostCollection
@@ -2931,9 +3045,13 @@ MySqlHostDataSource::getAll(const Host::IdentifierType& identifier_type,
     inbind[0].buffer_length = length;
     inbind[0].length = &length;
 
+    // Get a context
+    MySqlHostContextAlloc get_context(*impl_->pool_);
+    MySqlHostContextPtr ctx = get_context.ctx_;
+
     ConstHostCollection result;
-    impl_->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_DHCPID, inbind,
-                             impl_->host_ipv46_exchange_,
+    impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_DHCPID, inbind,
+                             ctx->host_ipv46_exchange_,
                              result, false);
     return (result);
 }
@@ -2948,9 +3066,13 @@ MySqlHostDataSource::getAll4(const SubnetID& subnet_id) const {
     inbind[0].buffer = reinterpret_cast<char*>(&subnet);
     inbind[0].is_unsigned = MLM_TRUE;
 
+    // Get a context
+    MySqlHostContextAlloc get_context(*impl_->pool_);
+    MySqlHostContextPtr ctx = get_context.ctx_;
+
     ConstHostCollection result;
-    impl_->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_SUBID4,
-                             inbind, impl_->host_exchange_,
+    impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_SUBID4,
+                             inbind, ctx->host_exchange_,
                              result, false);
     return (result);
 }
@@ -2965,9 +3087,13 @@ MySqlHostDataSource::getAll6(const SubnetID& subnet_id) const {
     inbind[0].buffer = reinterpret_cast<char*>(&subnet);
     inbind[0].is_unsigned = MLM_TRUE;
 
+    // Get a context
+    MySqlHostContextAlloc get_context(*impl_->pool_);
+    MySqlHostContextPtr ctx = get_context.ctx_;
+
     ConstHostCollection result;
-    impl_->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_SUBID6,
-                             inbind, impl_->host_ipv6_exchange_,
+    impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_SUBID6,
+                             inbind, ctx->host_ipv6_exchange_,
                              result, false);
     return (result);
 }
@@ -2999,9 +3125,13 @@ MySqlHostDataSource::getPage4(const SubnetID& subnet_id,
     inbind[2].buffer = reinterpret_cast<char*>(&page_size_data);
     inbind[2].is_unsigned = MLM_TRUE;
 
+    // Get a context
+    MySqlHostContextAlloc get_context(*impl_->pool_);
+    MySqlHostContextPtr ctx = get_context.ctx_;
+
     ConstHostCollection result;
-    impl_->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_SUBID4_PAGE,
-                             inbind, impl_->host_exchange_,
+    impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_SUBID4_PAGE,
+                             inbind, ctx->host_exchange_,
                              result, false);
     return (result);
 }
@@ -3033,9 +3163,13 @@ MySqlHostDataSource::getPage6(const SubnetID& subnet_id,
     inbind[2].buffer = reinterpret_cast<char*>(&page_size_data);
     inbind[2].is_unsigned = MLM_TRUE;
 
+    // Get a context
+    MySqlHostContextAlloc get_context(*impl_->pool_);
+    MySqlHostContextPtr ctx = get_context.ctx_;
+
     ConstHostCollection result;
-    impl_->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_SUBID6_PAGE,
-                             inbind, impl_->host_ipv6_exchange_,
+    impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_SUBID6_PAGE,
+                             inbind, ctx->host_ipv6_exchange_,
                              result, false);
     return (result);
 }
@@ -3052,9 +3186,13 @@ MySqlHostDataSource::getAll4(const asiolink::IOAddress& address) const {
     inbind[0].buffer = reinterpret_cast<char*>(&addr4);
     inbind[0].is_unsigned = MLM_TRUE;
 
+    // Get a context
+    MySqlHostContextAlloc get_context(*impl_->pool_);
+    MySqlHostContextPtr ctx = get_context.ctx_;
+
     ConstHostCollection result;
-    impl_->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_ADDR, inbind,
-                             impl_->host_exchange_, result, false);
+    impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_ADDR, inbind,
+                             ctx->host_exchange_, result, false);
 
     return (result);
 }
@@ -3065,9 +3203,13 @@ MySqlHostDataSource::get4(const SubnetID& subnet_id,
                           const uint8_t* identifier_begin,
                           const size_t identifier_len) const {
 
-    return (impl_->getHost(subnet_id, identifier_type, identifier_begin,
+    // Get a context
+    MySqlHostContextAlloc get_context(*impl_->pool_);
+    MySqlHostContextPtr ctx = get_context.ctx_;
+
+    return (impl_->getHost(ctx, subnet_id, identifier_type, identifier_begin,
                    identifier_len, MySqlHostDataSourceImpl::GET_HOST_SUBID4_DHCPID,
-                   impl_->host_exchange_));
+                   ctx->host_exchange_));
 }
 
 ConstHostPtr
@@ -3092,9 +3234,13 @@ MySqlHostDataSource::get4(const SubnetID& subnet_id,
     inbind[1].buffer = reinterpret_cast<char*>(&addr4);
     inbind[1].is_unsigned = MLM_TRUE;
 
+    // Get a context
+    MySqlHostContextAlloc get_context(*impl_->pool_);
+    MySqlHostContextPtr ctx = get_context.ctx_;
+
     ConstHostCollection collection;
-    impl_->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_SUBID_ADDR,
-                             inbind, impl_->host_exchange_, collection, true);
+    impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_SUBID_ADDR,
+                             inbind, ctx->host_exchange_, collection, true);
 
     // Return single record if present, else clear the host.
     ConstHostPtr result;
@@ -3110,9 +3256,13 @@ MySqlHostDataSource::get6(const SubnetID& subnet_id,
                           const uint8_t* identifier_begin,
                           const size_t identifier_len) const {
 
-    return (impl_->getHost(subnet_id, identifier_type, identifier_begin,
+    // Get a context
+    MySqlHostContextAlloc get_context(*impl_->pool_);
+    MySqlHostContextPtr ctx = get_context.ctx_;
+
+    return (impl_->getHost(ctx, subnet_id, identifier_type, identifier_begin,
                    identifier_len, MySqlHostDataSourceImpl::GET_HOST_SUBID6_DHCPID,
-                   impl_->host_ipv6_exchange_));
+                   ctx->host_ipv6_exchange_));
 }
 
 ConstHostPtr
@@ -3138,9 +3288,13 @@ MySqlHostDataSource::get6(const asiolink::IOAddress& prefix,
     inbind[1].buffer = reinterpret_cast<char*>(&tmp);
     inbind[1].is_unsigned = MLM_TRUE;
 
+    // Get a context
+    MySqlHostContextAlloc get_context(*impl_->pool_);
+    MySqlHostContextPtr ctx = get_context.ctx_;
+
     ConstHostCollection collection;
-    impl_->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_PREFIX,
-                             inbind, impl_->host_ipv6_exchange_,
+    impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_PREFIX,
+                             inbind, ctx->host_ipv6_exchange_,
                              collection, true);
 
     // Return single record if present, else clear the host.
@@ -3173,9 +3327,13 @@ MySqlHostDataSource::get6(const SubnetID& subnet_id,
     inbind[1].length = &addr6_length;
     inbind[1].buffer_length = addr6_length;
 
+    // Get a context
+    MySqlHostContextAlloc get_context(*impl_->pool_);
+    MySqlHostContextPtr ctx = get_context.ctx_;
+
     ConstHostCollection collection;
-    impl_->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_SUBID6_ADDR,
-                             inbind, impl_->host_ipv6_exchange_,
+    impl_->getHostCollection(ctx, MySqlHostDataSourceImpl::GET_HOST_SUBID6_ADDR,
+                             inbind, ctx->host_ipv6_exchange_,
                              collection, true);
 
     // Return single record if present, else clear the host.
@@ -3191,10 +3349,9 @@ MySqlHostDataSource::get6(const SubnetID& subnet_id,
 
 std::string MySqlHostDataSource::getName() const {
     std::string name = "";
-    try {
-        name = impl_->conn_.getParameter("name");
-    } catch (...) {
-        // Return an empty name
+    auto param = impl_->parameters_.find("name");
+    if (param != impl_->parameters_.end()) {
+        name = param->second;
     }
     return (name);
 }
@@ -3205,21 +3362,35 @@ std::string MySqlHostDataSource::getDescription() const {
 }
 
 std::pair<uint32_t, uint32_t> MySqlHostDataSource::getVersion() const {
-    return(impl_->getVersion());
+    // Get a context
+    MySqlHostContextAlloc get_context(*impl_->pool_);
+    MySqlHostContextPtr ctx = get_context.ctx_;
+
+    return (impl_->getVersion(ctx));
 }
 
 void
 MySqlHostDataSource::commit() {
     // If operating in read-only mode, throw exception.
     impl_->checkReadOnly();
-    impl_->conn_.commit();
+
+    // Get a context
+    MySqlHostContextAlloc get_context(*impl_->pool_);
+    MySqlHostContextPtr ctx = get_context.ctx_;
+
+    ctx->conn_.commit();
 }
 
 void
 MySqlHostDataSource::rollback() {
     // If operating in read-only mode, throw exception.
     impl_->checkReadOnly();
-    impl_->conn_.rollback();
+
+    // Get a context
+    MySqlHostContextAlloc get_context(*impl_->pool_);
+    MySqlHostContextPtr ctx = get_context.ctx_;
+
+    ctx->conn_.rollback();
 }
 
 }; // end of isc::dhcp namespace
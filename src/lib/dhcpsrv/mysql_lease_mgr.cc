@@ -10,10 +10,12 @@
 #include <dhcp/duid.h>
 #include <dhcp/hwaddr.h>
 #include <dhcpsrv/dhcpsrv_log.h>
+#include <dhcpsrv/lease_change_stream.h>
 #include <dhcpsrv/mysql_lease_mgr.h>
 #include <mysql/mysql_connection.h>
 
 #include <boost/array.hpp>
+#include <boost/bind.hpp>
 #include <boost/static_assert.hpp>
 #include <mysqld_error.h>
 
@@ -303,7 +305,24 @@ tagged_statements = { {
      "SELECT subnet_id, lease_type, state, leases as state_count"
      "  FROM lease6_stat "
      "  WHERE subnet_id >= ? and subnet_id <= ? "
-     "  ORDER BY subnet_id, lease_type, state" }
+     "  ORDER BY subnet_id, lease_type, state" },
+    // The free addresses are the first address of the range, the
+    // addresses following a lease of the range and the addresses of the
+    // reclaimed leases of the range which have no other lease.
+    {MySqlLeaseMgr::FIND_FREE_ADDRESS4,
+     "SELECT DISTINCT a FROM ("
+         "SELECT ? AS a "
+         "UNION ALL "
+         "SELECT address + 1 FROM lease4 "
+             "WHERE address >= ? AND address < ? "
+         "UNION ALL "
+         "SELECT address FROM lease4 "
+             "WHERE address >= ? AND address <= ? AND state = 2"
+     ") AS candidates "
+     "WHERE NOT EXISTS "
+         "(SELECT 1 FROM lease4 "
+             "WHERE address = candidates.a AND state != 2) "
+     "ORDER BY a LIMIT ?"}
     }
 };
 
@@ -1449,6 +1468,9 @@ private:
     my_bool                user_context_null_;         ///< Is user context null?
 };
 
+/// @brief Pointer to an object holding a MySQL lease context.
+typedef boost::shared_ptr<MySqlLeaseContextAlloc> MySqlLeaseContextAllocPtr;
+
 /// @brief MySql derivation of the statistical lease data query
 ///
 /// This class is used to recalculate lease statistics for MySQL
@@ -1462,13 +1484,16 @@ public:
     ///
     ///  The query created will return statistics for all subnets
     ///
-    /// @param conn An open connection to the database housing the lease data
+    /// @param get_context Holder of the context with an open connection to
+    /// the database housing the lease data, kept for the life of the query
     /// @param statement_index Index of the query's prepared statement
     /// @param fetch_type Indicates if query supplies lease type
     /// @throw if statement index is invalid.
-    MySqlLeaseStatsQuery(MySqlConnection& conn, const size_t statement_index,
+    MySqlLeaseStatsQuery(const MySqlLeaseContextAllocPtr& get_context,
+                         const size_t statement_index,
                          const bool fetch_type)
-        : conn_(conn), statement_index_(statement_index), statement_(NULL),
+        : get_context_(get_context), conn_(get_context->ctx_->conn_),
+          statement_index_(statement_index), statement_(NULL),
           fetch_type_(fetch_type),
           // Set the number of columns in the bind array based on fetch_type
           // This is the number of columns expected in the result set
@@ -1481,14 +1506,17 @@ public:
     ///
     /// The query created will return statistics for a single subnet
     ///
-    /// @param conn An open connection to the database housing the lease data
+    /// @param get_context Holder of the context with an open connection to
+    /// the database housing the lease data, kept for the life of the query
     /// @param statement_index Index of the query's prepared statement
     /// @param fetch_type Indicates if query supplies lease type
     /// @param subnet_id id of the subnet for which stats are desired
     /// @throw BadValue if sunbet_id given is 0 or if statement index is invalid.
-    MySqlLeaseStatsQuery(MySqlConnection& conn, const size_t statement_index,
+    MySqlLeaseStatsQuery(const MySqlLeaseContextAllocPtr& get_context,
+                         const size_t statement_index,
                          const bool fetch_type, const SubnetID& subnet_id)
-        : LeaseStatsQuery(subnet_id), conn_(conn), statement_index_(statement_index),
+        : LeaseStatsQuery(subnet_id), get_context_(get_context),
+          conn_(get_context->ctx_->conn_), statement_index_(statement_index),
           statement_(NULL), fetch_type_(fetch_type),
           // Set the number of columns in the bind array based on fetch_type
           // This is the number of columns expected in the result set
@@ -1502,17 +1530,20 @@ public:
     /// The query created will return statistics for the inclusive range of
     /// subnets described by first and last sunbet IDs.
     ///
-    /// @param conn An open connection to the database housing the lease data
+    /// @param get_context Holder of the context with an open connection to
+    /// the database housing the lease data, kept for the life of the query
     /// @param statement_index Index of the query's prepared statement
     /// @param fetch_type Indicates if query supplies lease type
     /// @param first_subnet_id first subnet in the range of subnets
     /// @param last_subnet_id last subnet in the range of subnets
     /// @throw BadValue if either subnet ID is 0 or if last <= first or
     /// if statement index is invalid.
-    MySqlLeaseStatsQuery(MySqlConnection& conn, const size_t statement_index,
+    MySqlLeaseStatsQuery(const MySqlLeaseContextAllocPtr& get_context,
+                         const size_t statement_index,
                          const bool fetch_type, const SubnetID& first_subnet_id,
                          const SubnetID& last_subnet_id)
-        : LeaseStatsQuery(first_subnet_id, last_subnet_id), conn_(conn),
+        : LeaseStatsQuery(first_subnet_id, last_subnet_id),
+          get_context_(get_context), conn_(get_context->ctx_->conn_),
           statement_index_(statement_index), statement_(NULL), fetch_type_(fetch_type),
           // Set the number of columns in the bind array based on fetch_type
           // This is the number of columns expected in the result set
@@ -1640,6 +1671,9 @@ private:
         statement_ = conn_.statements_[statement_index_];
     }
 
+    /// @brief Context used by the query until it is destroyed
+    MySqlLeaseContextAllocPtr get_context_;
+
     /// @brief Database connection to use to execute the query
     MySqlConnection& conn_;
 
@@ -1665,18 +1699,46 @@ private:
     int64_t state_count_;
 };
 
+// MySqlLeaseContext Constructor and Destructor
+
+MySqlLeaseContext::MySqlLeaseContext(const DatabaseConnection::ParameterMap& parameters)
+    : conn_(parameters) {
+}
+
+MySqlLeaseContext::~MySqlLeaseContext() {
+    // The exchange objects are destroyed here where their classes are
+    // known.
+}
+
 // MySqlLeaseMgr Constructor and Destructor
 
 MySqlLeaseMgr::MySqlLeaseMgr(const MySqlConnection::ParameterMap& parameters)
-    : conn_(parameters) {
+    : parameters_(parameters) {
+
+    pool_.reset(new MySqlLeaseContextPool(boost::bind(&MySqlLeaseMgr::createContext,
+                                                      this),
+                                          getDbPoolMaxSize(parameters_)));
+
+    // Open the first connection to check the database.
+    MySqlLeaseContextAlloc get_context(*pool_);
+}
+
+MySqlLeaseMgr::~MySqlLeaseMgr() {
+    // There is no need to close the databases in this destructor: they are
+    // closed in the destructor of the mysql_ member variables.
+}
+
+MySqlLeaseContextPtr
+MySqlLeaseMgr::createContext() const {
+    MySqlLeaseContextPtr ctx(new MySqlLeaseContext(parameters_));
 
     // Open the database.
-    conn_.openDatabase();
+    ctx->conn_.openDatabase();
 
     // Test schema version before we try to prepare statements.
     std::pair<uint32_t, uint32_t> code_version(MYSQL_SCHEMA_VERSION_MAJOR,
                                                MYSQL_SCHEMA_VERSION_MINOR);
-    std::pair<uint32_t, uint32_t> db_version = getVersion();
+    std::pair<uint32_t, uint32_t> db_version = getVersion(ctx->conn_);
     if (code_version != db_version) {
         isc_throw(DbOpenError,
                   "MySQL schema version mismatch: need version: "
@@ -1690,23 +1752,20 @@ MySqlLeaseMgr::MySqlLeaseMgr(const MySqlConnection::ParameterMap& parameters)
     // cause the changes to be written to the log, but flushed to disk in the
     // background every second.  Setting the parameter to that value will speed
     // up the system, but at the risk of losing data if the system crashes.
-    my_bool result = mysql_autocommit(conn_.mysql_, 1);
+    my_bool result = mysql_autocommit(ctx->conn_.mysql_, 1);
     if (result != 0) {
-        isc_throw(DbOperationError, mysql_error(conn_.mysql_));
+        isc_throw(DbOperationError, mysql_error(ctx->conn_.mysql_));
     }
 
     // Prepare all statements likely to be used.
-    conn_.prepareStatements(tagged_statements.begin(), tagged_statements.end());
+    ctx->conn_.prepareStatements(tagged_statements.begin(), tagged_statements.end());
 
     // Create the exchange objects for use in exchanging data between the
     // program and the database.
-    exchange4_.reset(new MySqlLease4Exchange());
-    exchange6_.reset(new MySqlLease6Exchange());
-}
+    ctx->exchange4_.reset(new MySqlLease4Exchange());
+    ctx->exchange6_.reset(new MySqlLease6Exchange());
 
-MySqlLeaseMgr::~MySqlLeaseMgr() {
-    // There is no need to close the database in this destructor: it is
-    // closed in the destructor of the mysql_ member variable.
+    return (ctx);
 }
 
 std::string
@@ -1723,24 +1782,25 @@ MySqlLeaseMgr::getDBVersion() {
 // statement, then call common code to execute the statement.
 
 bool
-MySqlLeaseMgr::addLeaseCommon(StatementIndex stindex,
+MySqlLeaseMgr::addLeaseCommon(MySqlLeaseContextPtr& ctx,
+                              StatementIndex stindex,
                               std::vector<MYSQL_BIND>& bind) {
 
     // Bind the parameters to the statement
-    int status = mysql_stmt_bind_param(conn_.statements_[stindex], &bind[0]);
-    checkError(status, stindex, "unable to bind parameters");
+    int status = mysql_stmt_bind_param(ctx->conn_.statements_[stindex], &bind[0]);
+    checkError(ctx, status, stindex, "unable to bind parameters");
 
     // Execute the statement
-    status = mysql_stmt_execute(conn_.statements_[stindex]);
+    status = mysql_stmt_execute(ctx->conn_.statements_[stindex]);
     if (status != 0) {
 
         // Failure: check for the special case of duplicate entry.  If this is
         // the case, we return false to indicate that the row was not added.
         // Otherwise we throw an exception.
-        if (mysql_errno(conn_.mysql_) == ER_DUP_ENTRY) {
+        if (mysql_errno(ctx->conn_.mysql_) == ER_DUP_ENTRY) {
             return (false);
         }
-        checkError(status, stindex, "unable to execute");
+        checkError(ctx, status, stindex, "unable to execute");
     }
 
     // Insert succeeded
@@ -1752,11 +1812,83 @@ MySqlLeaseMgr::addLease(const Lease4Ptr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MYSQL_ADD_ADDR4).arg(lease->addr_.toText());
 
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Create the MYSQL_BIND array for the lease
-    std::vector<MYSQL_BIND> bind = exchange4_->createBindForSend(lease);
+    std::vector<MYSQL_BIND> bind = ctx->exchange4_->createBindForSend(lease);
 
     // ... and drop to common code.
-    return (addLeaseCommon(INSERT_LEASE4, bind));
+    if (!addLeaseCommon(ctx, INSERT_LEASE4, bind)) {
+        return (false);
+    }
+    LeaseChangeStream::instance().publish(LeaseChange::ADD, lease);
+    return (true);
+}
+
+std::vector<IOAddress>
+MySqlLeaseMgr::findFreeAddresses4(const IOAddress& first, const IOAddress& last,
+                                  const size_t max_count) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MYSQL_FIND_FREE_ADDR4).arg(first.toText())
+        .arg(last.toText());
+
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
+    // Set up the WHERE clause values
+    MYSQL_BIND inbind[6];
+    memset(inbind, 0, sizeof(inbind));
+
+    // The range is bound for each part of the query.
+    uint32_t first_addr = first.toUint32();
+    uint32_t last_addr = last.toUint32();
+    uint32_t* range[] = { &first_addr, &first_addr, &last_addr,
+                          &first_addr, &last_addr };
+    for (size_t i = 0; i < sizeof(range) / sizeof(range[0]); ++i) {
+        inbind[i].buffer_type = MYSQL_TYPE_LONG;
+        inbind[i].buffer = reinterpret_cast<char*>(range[i]);
+        inbind[i].is_unsigned = MLM_TRUE;
+    }
+
+    uint32_t limit = static_cast<uint32_t>(max_count);
+    inbind[5].buffer_type = MYSQL_TYPE_LONG;
+    inbind[5].buffer = reinterpret_cast<char*>(&limit);
+    inbind[5].is_unsigned = MLM_TRUE;
+
+    // The address is computed so it is returned as a 64 bits integer.
+    MYSQL_BIND outbind[1];
+    memset(outbind, 0, sizeof(outbind));
+
+    uint64_t free_addr = 0;
+    outbind[0].buffer_type = MYSQL_TYPE_LONGLONG;
+    outbind[0].buffer = reinterpret_cast<char*>(&free_addr);
+    outbind[0].is_unsigned = MLM_TRUE;
+
+    MYSQL_STMT* statement = ctx->conn_.statements_[FIND_FREE_ADDRESS4];
+    int status = mysql_stmt_bind_param(statement, &inbind[0]);
+    checkError(ctx, status, FIND_FREE_ADDRESS4, "unable to bind WHERE clause parameter");
+
+    status = mysql_stmt_bind_result(statement, &outbind[0]);
+    checkError(ctx, status, FIND_FREE_ADDRESS4, "unable to bind SELECT clause parameters");
+
+    status = mysql_stmt_execute(statement);
+    checkError(ctx, status, FIND_FREE_ADDRESS4, "unable to execute");
+
+    status = mysql_stmt_store_result(statement);
+    checkError(ctx, status, FIND_FREE_ADDRESS4, "unable to set up for storing all results");
+
+    std::vector<IOAddress> addresses;
+    MySqlFreeResult fetch_release(statement);
+    while ((status = mysql_stmt_fetch(statement)) == 0) {
+        addresses.push_back(IOAddress(static_cast<uint32_t>(free_addr)));
+    }
+    if (status != MYSQL_NO_DATA) {
+        checkError(ctx, status, FIND_FREE_ADDRESS4, "unable to fetch results");
+    }
+    return (addresses);
 }
 
 bool
@@ -1765,11 +1897,19 @@ MySqlLeaseMgr::addLease(const Lease6Ptr& lease) {
               DHCPSRV_MYSQL_ADD_ADDR6).arg(lease->addr_.toText())
               .arg(lease->type_);
 
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Create the MYSQL_BIND array for the lease
-    std::vector<MYSQL_BIND> bind = exchange6_->createBindForSend(lease);
+    std::vector<MYSQL_BIND> bind = ctx->exchange6_->createBindForSend(lease);
 
     // ... and drop to common code.
-    return (addLeaseCommon(INSERT_LEASE6, bind));
+    if (!addLeaseCommon(ctx, INSERT_LEASE6, bind)) {
+        return (false);
+    }
+    LeaseChangeStream::instance().publish(LeaseChange::ADD, lease);
+    return (true);
 }
 
 // Extraction of leases from the database.
@@ -1798,7 +1938,8 @@ MySqlLeaseMgr::addLease(const Lease6Ptr& lease) {
 // holding zero or one leases into an appropriate Lease object.
 
 template <typename Exchange, typename LeaseCollection>
-void MySqlLeaseMgr::getLeaseCollection(StatementIndex stindex,
+void MySqlLeaseMgr::getLeaseCollection(MySqlLeaseContextPtr& ctx,
+                                       StatementIndex stindex,
                                        MYSQL_BIND* bind,
                                        Exchange& exchange,
                                        LeaseCollection& result,
@@ -1808,60 +1949,61 @@ void MySqlLeaseMgr::getLeaseCollection(StatementIndex stindex,
 
     if (bind) {
         // Bind the selection parameters to the statement
-        status = mysql_stmt_bind_param(conn_.statements_[stindex], bind);
-        checkError(status, stindex, "unable to bind WHERE clause parameter");
+        status = mysql_stmt_bind_param(ctx->conn_.statements_[stindex], bind);
+        checkError(ctx, status, stindex, "unable to bind WHERE clause parameter");
     }
 
     // Set up the MYSQL_BIND array for the data being returned and bind it to
     // the statement.
     std::vector<MYSQL_BIND> outbind = exchange->createBindForReceive();
-    status = mysql_stmt_bind_result(conn_.statements_[stindex], &outbind[0]);
-    checkError(status, stindex, "unable to bind SELECT clause parameters");
+    status = mysql_stmt_bind_result(ctx->conn_.statements_[stindex], &outbind[0]);
+    checkError(ctx, status, stindex, "unable to bind SELECT clause parameters");
 
     // Execute the statement
-    status = mysql_stmt_execute(conn_.statements_[stindex]);
-    checkError(status, stindex, "unable to execute");
+    status = mysql_stmt_execute(ctx->conn_.statements_[stindex]);
+    checkError(ctx, status, stindex, "unable to execute");
 
     // Ensure that all the lease information is retrieved in one go to avoid
     // overhead of going back and forth between client and server.
-    status = mysql_stmt_store_result(conn_.statements_[stindex]);
-    checkError(status, stindex, "unable to set up for storing all results");
+    status = mysql_stmt_store_result(ctx->conn_.statements_[stindex]);
+    checkError(ctx, status, stindex, "unable to set up for storing all results");
 
     // Set up the fetch "release" object to release resources associated
     // with the call to mysql_stmt_fetch when this method exits, then
     // retrieve the data.
-    MySqlFreeResult fetch_release(conn_.statements_[stindex]);
+    MySqlFreeResult fetch_release(ctx->conn_.statements_[stindex]);
     int count = 0;
-    while ((status = mysql_stmt_fetch(conn_.statements_[stindex])) == 0) {
+    while ((status = mysql_stmt_fetch(ctx->conn_.statements_[stindex])) == 0) {
         try {
             result.push_back(exchange->getLeaseData());
 
         } catch (const isc::BadValue& ex) {
             // Rethrow the exception with a bit more data.
             isc_throw(BadValue, ex.what() << ". Statement is <" <<
-                      conn_.text_statements_[stindex] << ">");
+                      ctx->conn_.text_statements_[stindex] << ">");
         }
 
         if (single && (++count > 1)) {
             isc_throw(MultipleRecords, "multiple records were found in the "
                       "database where only one was expected for query "
-                      << conn_.text_statements_[stindex]);
+                      << ctx->conn_.text_statements_[stindex]);
         }
     }
 
     // How did the fetch end?
     if (status == 1) {
         // Error - unable to fetch results
-        checkError(status, stindex, "unable to fetch results");
+        checkError(ctx, status, stindex, "unable to fetch results");
     } else if (status == MYSQL_DATA_TRUNCATED) {
         // Data truncated - throw an exception indicating what was at fault
-        isc_throw(DataTruncated, conn_.text_statements_[stindex]
+        isc_throw(DataTruncated, ctx->conn_.text_statements_[stindex]
                   << " returned truncated data: columns affected are "
                   << exchange->getErrorColumns());
     }
 }
 
-void MySqlLeaseMgr::getLease(StatementIndex stindex, MYSQL_BIND* bind,
+void MySqlLeaseMgr::getLease(MySqlLeaseContextPtr& ctx,
+                             StatementIndex stindex, MYSQL_BIND* bind,
                              Lease4Ptr& result) const {
     // Create appropriate collection object and get all leases matching
     // the selection criteria.  The "single" parameter is true to indicate
@@ -1869,7 +2011,7 @@ void MySqlLeaseMgr::getLease(StatementIndex stindex, MYSQL_BIND* bind,
     // matching records are found: this particular method is called when only
     // one or zero matches is expected.
     Lease4Collection collection;
-    getLeaseCollection(stindex, bind, exchange4_, collection, true);
+    getLeaseCollection(ctx, stindex, bind, ctx->exchange4_, collection, true);
 
     // Return single record if present, else clear the lease.
     if (collection.empty()) {
@@ -1879,7 +2021,8 @@ void MySqlLeaseMgr::getLease(StatementIndex stindex, MYSQL_BIND* bind,
     }
 }
 
-void MySqlLeaseMgr::getLease(StatementIndex stindex, MYSQL_BIND* bind,
+void MySqlLeaseMgr::getLease(MySqlLeaseContextPtr& ctx,
+                             StatementIndex stindex, MYSQL_BIND* bind,
                              Lease6Ptr& result) const {
     // Create appropriate collection object and get all leases matching
     // the selection criteria.  The "single" parameter is true to indicate
@@ -1887,7 +2030,7 @@ void MySqlLeaseMgr::getLease(StatementIndex stindex, MYSQL_BIND* bind,
     // matching records are found: this particular method is called when only
     // one or zero matches is expected.
     Lease6Collection collection;
-    getLeaseCollection(stindex, bind, exchange6_, collection, true);
+    getLeaseCollection(ctx, stindex, bind, ctx->exchange6_, collection, true);
 
     // Return single record if present, else clear the lease.
     if (collection.empty()) {
@@ -1914,9 +2057,13 @@ MySqlLeaseMgr::getLease4(const isc::asiolink::IOAddress& addr) const {
     inbind[0].buffer = reinterpret_cast<char*>(&addr4);
     inbind[0].is_unsigned = MLM_TRUE;
 
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Get the data
     Lease4Ptr result;
-    getLease(GET_LEASE4_ADDR, inbind, result);
+    getLease(ctx, GET_LEASE4_ADDR, inbind, result);
 
     return (result);
 }
@@ -1950,9 +2097,13 @@ MySqlLeaseMgr::getLease4(const HWAddr& hwaddr) const {
     inbind[0].buffer_length = hwaddr_length;
     inbind[0].length = &hwaddr_length;
 
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Get the data
     Lease4Collection result;
-    getLeaseCollection(GET_LEASE4_HWADDR, inbind, result);
+    getLeaseCollection(ctx, GET_LEASE4_HWADDR, inbind, result);
 
     return (result);
 }
@@ -1991,9 +2142,13 @@ MySqlLeaseMgr::getLease4(const HWAddr& hwaddr, SubnetID subnet_id) const {
     inbind[1].buffer = reinterpret_cast<char*>(&subnet_id);
     inbind[1].is_unsigned = MLM_TRUE;
 
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Get the data
     Lease4Ptr result;
-    getLease(GET_LEASE4_HWADDR_SUBID, inbind, result);
+    getLease(ctx, GET_LEASE4_HWADDR_SUBID, inbind, result);
 
     return (result);
 }
@@ -2022,9 +2177,13 @@ MySqlLeaseMgr::getLease4(const ClientId& clientid) const {
     inbind[0].buffer_length = client_data_length;
     inbind[0].length = &client_data_length;
 
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Get the data
     Lease4Collection result;
-    getLeaseCollection(GET_LEASE4_CLIENTID, inbind, result);
+    getLeaseCollection(ctx, GET_LEASE4_CLIENTID, inbind, result);
 
     return (result);
 }
@@ -2068,9 +2227,13 @@ MySqlLeaseMgr::getLease4(const ClientId& clientid, SubnetID subnet_id) const {
     inbind[1].buffer = reinterpret_cast<char*>(&subnet_id);
     inbind[1].is_unsigned = MLM_TRUE;
 
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Get the data
     Lease4Ptr result;
-    getLease(GET_LEASE4_CLIENTID_SUBID, inbind, result);
+    getLease(ctx, GET_LEASE4_CLIENTID_SUBID, inbind, result);
 
     return (result);
 }
@@ -2089,9 +2252,13 @@ MySqlLeaseMgr::getLeases4(SubnetID subnet_id) const {
     inbind[0].buffer = reinterpret_cast<char*>(&subnet_id);
     inbind[0].is_unsigned = MLM_TRUE;
 
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
     // ... and get the data
     Lease4Collection result;
-    getLeaseCollection(GET_LEASE4_SUBID, inbind, result);
+    getLeaseCollection(ctx, GET_LEASE4_SUBID, inbind, result);
 
     return (result);
 }
@@ -2100,8 +2267,12 @@ Lease4Collection
 MySqlLeaseMgr::getLeases4() const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MYSQL_GET4);
 
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
     Lease4Collection result;
-    getLeaseCollection(GET_LEASE4, 0, result);
+    getLeaseCollection(ctx, GET_LEASE4, 0, result);
 
     return (result);
 }
@@ -2136,9 +2307,13 @@ MySqlLeaseMgr::getLeases4(const asiolink::IOAddress& lower_bound_address,
     inbind[1].buffer = reinterpret_cast<char*>(ps);
     inbind[1].is_unsigned = MLM_TRUE;
 
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Get the leases
     Lease4Collection result;
-    getLeaseCollection(GET_LEASE4_PAGE, inbind, result);
+    getLeaseCollection(ctx, GET_LEASE4_PAGE, inbind, result);
 
     return (result);
 }
@@ -2169,8 +2344,12 @@ MySqlLeaseMgr::getLease6(Lease::Type lease_type,
     inbind[1].buffer = reinterpret_cast<char*>(&lease_type);
     inbind[1].is_unsigned = MLM_TRUE;
 
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
     Lease6Ptr result;
-    getLease(GET_LEASE6_ADDR, inbind, result);
+    getLease(ctx, GET_LEASE6_ADDR, inbind, result);
 
     return (result);
 }
@@ -2225,9 +2404,13 @@ MySqlLeaseMgr::getLeases6(Lease::Type lease_type,
     inbind[2].buffer = reinterpret_cast<char*>(&lease_type);
     inbind[2].is_unsigned = MLM_TRUE;
 
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
     // ... and get the data
     Lease6Collection result;
-    getLeaseCollection(GET_LEASE6_DUID_IAID, inbind, result);
+    getLeaseCollection(ctx, GET_LEASE6_DUID_IAID, inbind, result);
 
     return (result);
 }
@@ -2270,9 +2453,13 @@ MySqlLeaseMgr::getLeases6(Lease::Type lease_type,
     inbind[3].buffer = reinterpret_cast<char*>(&lease_type);
     inbind[3].is_unsigned = MLM_TRUE;
 
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
     // ... and get the data
     Lease6Collection result;
-    getLeaseCollection(GET_LEASE6_DUID_IAID_SUBID, inbind, result);
+    getLeaseCollection(ctx, GET_LEASE6_DUID_IAID_SUBID, inbind, result);
 
     return (result);
 }
@@ -2291,9 +2478,13 @@ MySqlLeaseMgr::getLeases6(SubnetID subnet_id) const {
     inbind[0].buffer = reinterpret_cast<char*>(&subnet_id);
     inbind[0].is_unsigned = MLM_TRUE;
 
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
     // ... and get the data
     Lease6Collection result;
-    getLeaseCollection(GET_LEASE6_SUBID, inbind, result);
+    getLeaseCollection(ctx, GET_LEASE6_SUBID, inbind, result);
 
     return (result);
 }
@@ -2302,8 +2493,12 @@ Lease6Collection
 MySqlLeaseMgr::getLeases6() const {
    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MYSQL_GET6);
 
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
     Lease6Collection result;
-    getLeaseCollection(GET_LEASE6, 0, result);
+    getLeaseCollection(ctx, GET_LEASE6, 0, result);
 
     return (result);
 }
@@ -2328,7 +2523,11 @@ MySqlLeaseMgr::getLeases6(const DUID& duid) const {
     
     Lease6Collection result;
     
-    getLeaseCollection(GET_LEASE6_DUID, inbind, result);
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
+    getLeaseCollection(ctx, GET_LEASE6_DUID, inbind, result);
 
     return result;
 }
@@ -2372,9 +2571,13 @@ MySqlLeaseMgr::getLeases6(const asiolink::IOAddress& lower_bound_address,
     inbind[1].buffer = reinterpret_cast<char*>(ps);
     inbind[1].is_unsigned = MLM_TRUE;
 
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Get the leases
     Lease6Collection result;
-    getLeaseCollection(GET_LEASE6_PAGE, inbind, result);
+    getLeaseCollection(ctx, GET_LEASE6_PAGE, inbind, result);
 
     return (result);
 }
@@ -2412,7 +2615,7 @@ MySqlLeaseMgr::getExpiredLeasesCommon(LeaseCollection& expired_leases,
 
     // Expiration timestamp.
     MYSQL_TIME expire_time;
-    conn_.convertToDatabaseTime(time(NULL), expire_time);
+    MySqlConnection::convertToDatabaseTime(time(NULL), expire_time);
     inbind[1].buffer_type = MYSQL_TYPE_TIMESTAMP;
     inbind[1].buffer = reinterpret_cast<char*>(&expire_time);
     inbind[1].buffer_length = sizeof(expire_time);
@@ -2425,8 +2628,12 @@ MySqlLeaseMgr::getExpiredLeasesCommon(LeaseCollection& expired_leases,
     inbind[2].buffer = reinterpret_cast<char*>(&limit);
     inbind[2].is_unsigned = MLM_TRUE;
 
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Get the data
-    getLeaseCollection(statement_index, inbind, expired_leases);
+    getLeaseCollection(ctx, statement_index, inbind, expired_leases);
 }
 
 // Update lease methods.  These comprise common code that handles the actual
@@ -2435,20 +2642,21 @@ MySqlLeaseMgr::getExpiredLeasesCommon(LeaseCollection& expired_leases,
 
 template <typename LeasePtr>
 void
-MySqlLeaseMgr::updateLeaseCommon(StatementIndex stindex, MYSQL_BIND* bind,
+MySqlLeaseMgr::updateLeaseCommon(MySqlLeaseContextPtr& ctx,
+                                 StatementIndex stindex, MYSQL_BIND* bind,
                                  const LeasePtr& lease) {
 
     // Bind the parameters to the statement
-    int status = mysql_stmt_bind_param(conn_.statements_[stindex], bind);
-    checkError(status, stindex, "unable to bind parameters");
+    int status = mysql_stmt_bind_param(ctx->conn_.statements_[stindex], bind);
+    checkError(ctx, status, stindex, "unable to bind parameters");
 
     // Execute
-    status = mysql_stmt_execute(conn_.statements_[stindex]);
-    checkError(status, stindex, "unable to execute");
+    status = mysql_stmt_execute(ctx->conn_.statements_[stindex]);
+    checkError(ctx, status, stindex, "unable to execute");
 
     // See how many rows were affected.  The statement should only update a
     // single row.
-    int affected_rows = mysql_stmt_affected_rows(conn_.statements_[stindex]);
+    int affected_rows = mysql_stmt_affected_rows(ctx->conn_.statements_[stindex]);
     if (affected_rows == 0) {
         isc_throw(NoSuchLease, "unable to update lease for address " <<
                   lease->addr_ << " as it does not exist");
@@ -2467,8 +2675,12 @@ MySqlLeaseMgr::updateLease4(const Lease4Ptr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MYSQL_UPDATE_ADDR4).arg(lease->addr_.toText());
 
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Create the MYSQL_BIND array for the data being updated
-    std::vector<MYSQL_BIND> bind = exchange4_->createBindForSend(lease);
+    std::vector<MYSQL_BIND> bind = ctx->exchange4_->createBindForSend(lease);
 
     // Set up the WHERE clause and append it to the MYSQL_BIND array
     MYSQL_BIND where;
@@ -2481,7 +2693,8 @@ MySqlLeaseMgr::updateLease4(const Lease4Ptr& lease) {
     bind.push_back(where);
 
     // Drop to common update code
-    updateLeaseCommon(stindex, &bind[0], lease);
+    updateLeaseCommon(ctx, stindex, &bind[0], lease);
+    LeaseChangeStream::instance().publish(LeaseChange::UPDATE, lease);
 }
 
 void
@@ -2492,8 +2705,12 @@ MySqlLeaseMgr::updateLease6(const Lease6Ptr& lease) {
               DHCPSRV_MYSQL_UPDATE_ADDR6).arg(lease->addr_.toText())
               .arg(lease->type_);
 
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Create the MYSQL_BIND array for the data being updated
-    std::vector<MYSQL_BIND> bind = exchange6_->createBindForSend(lease);
+    std::vector<MYSQL_BIND> bind = ctx->exchange6_->createBindForSend(lease);
 
     // Set up the WHERE clause value
     MYSQL_BIND where;
@@ -2511,7 +2728,8 @@ MySqlLeaseMgr::updateLease6(const Lease6Ptr& lease) {
     bind.push_back(where);
 
     // Drop to common update code
-    updateLeaseCommon(stindex, &bind[0], lease);
+    updateLeaseCommon(ctx, stindex, &bind[0], lease);
+    LeaseChangeStream::instance().publish(LeaseChange::UPDATE, lease);
 }
 
 // Delete lease methods.  Similar to other groups of methods, these comprise
@@ -2520,19 +2738,20 @@ MySqlLeaseMgr::updateLease6(const Lease6Ptr& lease) {
 // handles the common processing.
 
 uint64_t
-MySqlLeaseMgr::deleteLeaseCommon(StatementIndex stindex, MYSQL_BIND* bind) {
+MySqlLeaseMgr::deleteLeaseCommon(MySqlLeaseContextPtr& ctx,
+                                 StatementIndex stindex, MYSQL_BIND* bind) {
 
     // Bind the input parameters to the statement
-    int status = mysql_stmt_bind_param(conn_.statements_[stindex], bind);
-    checkError(status, stindex, "unable to bind WHERE clause parameter");
+    int status = mysql_stmt_bind_param(ctx->conn_.statements_[stindex], bind);
+    checkError(ctx, status, stindex, "unable to bind WHERE clause parameter");
 
     // Execute
-    status = mysql_stmt_execute(conn_.statements_[stindex]);
-    checkError(status, stindex, "unable to execute");
+    status = mysql_stmt_execute(ctx->conn_.statements_[stindex]);
+    checkError(ctx, status, stindex, "unable to execute");
 
     // See how many rows were affected.  Note that the statement may delete
     // multiple rows.
-    return (static_cast<uint64_t>(mysql_stmt_affected_rows(conn_.statements_[stindex])));
+    return (static_cast<uint64_t>(mysql_stmt_affected_rows(ctx->conn_.statements_[stindex])));
 }
 
 bool
@@ -2540,10 +2759,15 @@ MySqlLeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MYSQL_DELETE_ADDR).arg(addr.toText());
 
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Set up the WHERE clause value
     MYSQL_BIND inbind[1];
     memset(inbind, 0, sizeof(inbind));
 
+    bool deleted = false;
     if (addr.isV4()) {
         uint32_t addr4 = addr.toUint32();
 
@@ -2551,7 +2775,7 @@ MySqlLeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
         inbind[0].buffer = reinterpret_cast<char*>(&addr4);
         inbind[0].is_unsigned = MLM_TRUE;
 
-        return (deleteLeaseCommon(DELETE_LEASE4, inbind) > 0);
+        deleted = (deleteLeaseCommon(ctx, DELETE_LEASE4, inbind) > 0);
 
     } else {
         std::string addr6 = addr.toText();
@@ -2564,8 +2788,13 @@ MySqlLeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
         inbind[0].buffer_length = addr6_length;
         inbind[0].length = &addr6_length;
 
-        return (deleteLeaseCommon(DELETE_LEASE6, inbind) > 0);
+        deleted = (deleteLeaseCommon(ctx, DELETE_LEASE6, inbind) > 0);
+    }
+
+    if (deleted) {
+        LeaseChangeStream::instance().publishDelete(addr);
     }
+    return (deleted);
 }
 
 uint64_t
@@ -2599,13 +2828,17 @@ MySqlLeaseMgr::deleteExpiredReclaimedLeasesCommon(const uint32_t secs,
 
     // Expiration timestamp.
     MYSQL_TIME expire_time;
-    conn_.convertToDatabaseTime(time(NULL) - static_cast<time_t>(secs), expire_time);
+    MySqlConnection::convertToDatabaseTime(time(NULL) - static_cast<time_t>(secs), expire_time);
     inbind[1].buffer_type = MYSQL_TYPE_TIMESTAMP;
     inbind[1].buffer = reinterpret_cast<char*>(&expire_time);
     inbind[1].buffer_length = sizeof(expire_time);
 
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Get the number of deleted leases and log it.
-    uint64_t deleted_leases = deleteLeaseCommon(statement_index, inbind);
+    uint64_t deleted_leases = deleteLeaseCommon(ctx, statement_index, inbind);
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MYSQL_DELETED_EXPIRED_RECLAIMED)
         .arg(deleted_leases);
@@ -2615,7 +2848,8 @@ MySqlLeaseMgr::deleteExpiredReclaimedLeasesCommon(const uint32_t secs,
 
 LeaseStatsQueryPtr
 MySqlLeaseMgr::startLeaseStatsQuery4() {
-    LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(conn_,
+    MySqlLeaseContextAllocPtr get_context(new MySqlLeaseContextAlloc(*pool_));
+    LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(get_context,
                                                       ALL_LEASE4_STATS,
                                                       false));
     query->start();
@@ -2624,7 +2858,8 @@ MySqlLeaseMgr::startLeaseStatsQuery4() {
 
 LeaseStatsQueryPtr
 MySqlLeaseMgr::startSubnetLeaseStatsQuery4(const SubnetID& subnet_id) {
-    LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(conn_,
+    MySqlLeaseContextAllocPtr get_context(new MySqlLeaseContextAlloc(*pool_));
+    LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(get_context,
                                                        SUBNET_LEASE4_STATS,
                                                        false,
                                                        subnet_id));
@@ -2635,7 +2870,8 @@ MySqlLeaseMgr::startSubnetLeaseStatsQuery4(const SubnetID& subnet_id) {
 LeaseStatsQueryPtr
 MySqlLeaseMgr::startSubnetRangeLeaseStatsQuery4(const SubnetID& first_subnet_id,
                                                    const SubnetID& last_subnet_id) {
-    LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(conn_,
+    MySqlLeaseContextAllocPtr get_context(new MySqlLeaseContextAlloc(*pool_));
+    LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(get_context,
                                                        SUBNET_RANGE_LEASE4_STATS,
                                                        false,
                                                        first_subnet_id, last_subnet_id));
@@ -2645,7 +2881,8 @@ MySqlLeaseMgr::startSubnetRangeLeaseStatsQuery4(const SubnetID& first_subnet_id,
 
 LeaseStatsQueryPtr
 MySqlLeaseMgr::startLeaseStatsQuery6() {
-    LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(conn_,
+    MySqlLeaseContextAllocPtr get_context(new MySqlLeaseContextAlloc(*pool_));
+    LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(get_context,
                                                       ALL_LEASE6_STATS,
                                                       true));
     query->start();
@@ -2654,7 +2891,8 @@ MySqlLeaseMgr::startLeaseStatsQuery6() {
 
 LeaseStatsQueryPtr
 MySqlLeaseMgr::startSubnetLeaseStatsQuery6(const SubnetID& subnet_id) {
-    LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(conn_,
+    MySqlLeaseContextAllocPtr get_context(new MySqlLeaseContextAlloc(*pool_));
+    LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(get_context,
                                                       SUBNET_LEASE6_STATS,
                                                       true,
                                                       subnet_id));
@@ -2665,7 +2903,8 @@ MySqlLeaseMgr::startSubnetLeaseStatsQuery6(const SubnetID& subnet_id) {
 LeaseStatsQueryPtr
 MySqlLeaseMgr::startSubnetRangeLeaseStatsQuery6(const SubnetID& first_subnet_id,
                                                    const SubnetID& last_subnet_id) {
-    LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(conn_,
+    MySqlLeaseContextAllocPtr get_context(new MySqlLeaseContextAlloc(*pool_));
+    LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(get_context,
                                                       SUBNET_RANGE_LEASE6_STATS,
                                                       true,
                                                       first_subnet_id, last_subnet_id));
@@ -2688,10 +2927,9 @@ MySqlLeaseMgr::wipeLeases6(const SubnetID& /*subnet_id*/) {
 std::string
 MySqlLeaseMgr::getName() const {
     std::string name = "";
-    try {
-        name = conn_.getParameter("name");
-    } catch (...) {
-        // Return an empty name
+    auto param = parameters_.find("name");
+    if (param != parameters_.end()) {
+        name = param->second;
     }
     return (name);
 }
@@ -2706,11 +2944,20 @@ MySqlLeaseMgr::getVersion() const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MYSQL_GET_VERSION);
 
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
+    return (getVersion(ctx->conn_));
+}
+
+std::pair<uint32_t, uint32_t>
+MySqlLeaseMgr::getVersion(MySqlConnection& conn) {
     // Allocate a new statement.
-    MYSQL_STMT *stmt = mysql_stmt_init(conn_.mysql_);
+    MYSQL_STMT *stmt = mysql_stmt_init(conn.mysql_);
     if (stmt == NULL) {
         isc_throw(DbOperationError, "unable to allocate MySQL prepared "
-                "statement structure, reason: " << mysql_error(conn_.mysql_));
+                "statement structure, reason: " << mysql_error(conn.mysql_));
     }
 
     // Prepare the statement from SQL text.
@@ -2718,13 +2965,13 @@ MySqlLeaseMgr::getVersion() const {
     int status = mysql_stmt_prepare(stmt, version_sql, strlen(version_sql));
     if (status != 0) {
         isc_throw(DbOperationError, "unable to prepare MySQL statement <"
-                  << version_sql << ">, reason: " << mysql_error(conn_.mysql_));
+                  << version_sql << ">, reason: " << mysql_error(conn.mysql_));
     }
 
     // Execute the prepared statement.
     if (mysql_stmt_execute(stmt) != 0) {
         isc_throw(DbOperationError, "cannot execute schema version query <"
-                  << version_sql << ">, reason: " << mysql_errno(conn_.mysql_));
+                  << version_sql << ">, reason: " << mysql_errno(conn.mysql_));
     }
 
     // Bind the output of the statement to the appropriate variables.
@@ -2745,14 +2992,14 @@ MySqlLeaseMgr::getVersion() const {
 
     if (mysql_stmt_bind_result(stmt, bind)) {
         isc_throw(DbOperationError, "unable to bind result set for <"
-                << version_sql << ">, reason: " << mysql_errno(conn_.mysql_));
+                << version_sql << ">, reason: " << mysql_errno(conn.mysql_));
     }
 
     // Fetch the data.
     if (mysql_stmt_fetch(stmt)) {
         mysql_stmt_close(stmt);
         isc_throw(DbOperationError, "unable to bind result set for <"
-                << version_sql << ">, reason: " << mysql_errno(conn_.mysql_));
+                << version_sql << ">, reason: " << mysql_errno(conn.mysql_));
     }
 
     // Discard the statement and its resources
@@ -2764,23 +3011,34 @@ MySqlLeaseMgr::getVersion() const {
 void
 MySqlLeaseMgr::commit() {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MYSQL_COMMIT);
-    if (mysql_commit(conn_.mysql_) != 0) {
-        isc_throw(DbOperationError, "commit failed: " << mysql_error(conn_.mysql_));
+
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
+    if (mysql_commit(ctx->conn_.mysql_) != 0) {
+        isc_throw(DbOperationError, "commit failed: " << mysql_error(ctx->conn_.mysql_));
     }
 }
 
 void
 MySqlLeaseMgr::rollback() {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MYSQL_ROLLBACK);
-    if (mysql_rollback(conn_.mysql_) != 0) {
-        isc_throw(DbOperationError, "rollback failed: " << mysql_error(conn_.mysql_));
+
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*pool_);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
+    if (mysql_rollback(ctx->conn_.mysql_) != 0) {
+        isc_throw(DbOperationError, "rollback failed: " << mysql_error(ctx->conn_.mysql_));
     }
 }
 
 void
-MySqlLeaseMgr::checkError(int status, StatementIndex index,
-                           const char* what) const {
-    conn_.checkError(status, index, what);
+MySqlLeaseMgr::checkError(MySqlLeaseContextPtr& ctx,
+                          int status, StatementIndex index,
+                          const char* what) const {
+    ctx->conn_.checkError(status, index, what);
 }
 
 }  // namespace dhcp
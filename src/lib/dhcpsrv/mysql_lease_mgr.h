@@ -7,12 +7,14 @@
 #ifndef MYSQL_LEASE_MGR_H
 #define MYSQL_LEASE_MGR_H
 
+#include <database/db_context_pool.h>
 #include <dhcp/hwaddr.h>
 #include <dhcpsrv/dhcpsrv_exceptions.h>
 #include <dhcpsrv/lease_mgr.h>
 #include <mysql/mysql_connection.h>
 
 #include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
 #include <boost/utility.hpp>
 #include <mysql.h>
 
@@ -26,11 +28,55 @@ namespace dhcp {
 class MySqlLease4Exchange;
 class MySqlLease6Exchange;
 
+/// @brief MySQL Lease Context
+///
+/// An open connection to the database with its prepared statements and
+/// the exchange objects used to transfer the data of these statements.
+/// A context is used by one caller at a time: the lease manager takes
+/// one from its pool for each operation.
+class MySqlLeaseContext {
+public:
+
+    /// @brief Constructor
+    ///
+    /// @param parameters A data structure relating keywords and values
+    ///        concerned with the database.
+    MySqlLeaseContext(const db::DatabaseConnection::ParameterMap& parameters);
+
+    /// @brief Destructor
+    ~MySqlLeaseContext();
+
+    /// The exchange objects are used for transfer of data to/from the database.
+    /// They are pointed-to objects as the contents may change in "const" calls,
+    /// while the rest of this object does not.  (At alternative would be to
+    /// declare them as "mutable".)
+    boost::scoped_ptr<MySqlLease4Exchange> exchange4_; ///< Exchange object
+    boost::scoped_ptr<MySqlLease6Exchange> exchange6_; ///< Exchange object
+
+    /// @brief MySQL connection
+    db::MySqlConnection conn_;
+};
+
+/// @brief Type of pointers to MySQL lease contexts.
+typedef boost::shared_ptr<MySqlLeaseContext> MySqlLeaseContextPtr;
+
+/// @brief Pool of MySQL lease contexts.
+typedef db::DbContextPool<MySqlLeaseContext> MySqlLeaseContextPool;
+
+/// @brief Takes a MySQL lease context from the pool for the scope.
+typedef db::DbContextAlloc<MySqlLeaseContext> MySqlLeaseContextAlloc;
+
 /// @brief MySQL Lease Manager
 ///
 /// This class provides the \ref isc::dhcp::LeaseMgr interface to the MySQL
 /// database.  Use of this backend presupposes that a MySQL database is
 /// available and that the Kea schema has been created within it.
+///
+/// The connections to the database are kept in a pool: each operation
+/// takes a connection for its exclusive use, so concurrent operations
+/// use distinct connections. The maximum number of connections is given
+/// by the @c pool-size parameter. Unless it is configured, the DHCPv4
+/// server sets it to one more than the number of lease lookup threads.
 
 class MySqlLeaseMgr : public LeaseMgr {
 public:
@@ -48,7 +94,8 @@ public:
     /// schema_version table will be checked against hard-coded value in
     /// the implementation file.
     ///
-    /// Finally, all the SQL commands are pre-compiled.
+    /// Finally, all the SQL commands are pre-compiled. Further connections
+    /// are opened the same way when they are needed.
     ///
     /// @param parameters A data structure relating keywords and values
     ///        concerned with the database.
@@ -88,6 +135,39 @@ public:
     ///        failed.
     virtual bool addLease(const Lease6Ptr& lease);
 
+    /// @brief Checks if the backend can search free IPv4 addresses.
+    ///
+    /// @return Always true.
+    virtual bool canFindFreeAddresses4() const {
+        return (true);
+    }
+
+    /// @brief Checks if the backend can fetch leases from several threads.
+    ///
+    /// @return Always true: each operation takes its own connection from
+    /// the pool.
+    virtual bool canLookupLeasesConcurrently() const {
+        return (true);
+    }
+
+    /// @brief Finds IPv4 addresses without lease in a range.
+    ///
+    /// The free addresses are found by a single query looking at the gaps
+    /// between the leases of the range.
+    ///
+    /// @param first First address of the range.
+    /// @param last Last address of the range.
+    /// @param max_count Maximum number of returned addresses.
+    ///
+    /// @return The free addresses in ascending order.
+    ///
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual std::vector<isc::asiolink::IOAddress>
+    findFreeAddresses4(const isc::asiolink::IOAddress& first,
+                       const isc::asiolink::IOAddress& last,
+                       const size_t max_count);
+
     /// @brief Returns an IPv4 lease for specified IPv4 address
     ///
     /// This method return a lease that is associated with a given address.
@@ -537,11 +617,6 @@ public:
 
     /// @brief Returns backend version.
     ///
-    /// The method is called by the constructor after opening the database
-    /// but prior to preparing SQL statements, to verify that the schema version
-    /// is correct. Thus it must not rely on a pre-prepared statement or
-    /// formal statement execution error checking.
-    ///
     /// @return Version number as a pair of unsigned integers.  "first" is the
     ///         major version number, "second" the minor number.
     ///
@@ -600,16 +675,46 @@ public:
         ALL_LEASE6_STATS,            // Fetches IPv6 lease statistics
         SUBNET_LEASE6_STATS,         // Fetched IPv6 lease stats for a single subnet.
         SUBNET_RANGE_LEASE6_STATS,   // Fetched IPv6 lease stats for a subnet range.
+        FIND_FREE_ADDRESS4,          // Find free IPv4 addresses of a range.
         NUM_STATEMENTS               // Number of statements
     };
 
 private:
+    /// @brief Opens a new connection to the database.
+    ///
+    /// Checks the schema version, then prepares the statements and creates
+    /// the exchange objects.
+    ///
+    /// @return Pointer to the new context.
+    ///
+    /// @throw isc::db::DbOpenError Error opening the database or the schema
+    /// version is incorrect.
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed.
+    MySqlLeaseContextPtr createContext() const;
+
+    /// @brief Returns the schema version of the database.
+    ///
+    /// The method is called after opening a connection but prior to
+    /// preparing SQL statements, to verify that the schema version is
+    /// correct. Thus it must not rely on a pre-prepared statement or
+    /// formal statement execution error checking.
+    ///
+    /// @param conn Open connection to the database.
+    ///
+    /// @return Version number as a pair of unsigned integers.
+    ///
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed.
+    static std::pair<uint32_t, uint32_t> getVersion(db::MySqlConnection& conn);
+
     /// @brief Add Lease Common Code
     ///
     /// This method performs the common actions for both flavours (V4 and V6)
     /// of the addLease method.  It binds the contents of the lease object to
     /// the prepared statement and adds it to the database.
     ///
+    /// @param ctx Context of the operation
     /// @param stindex Index of statement being executed
     /// @param bind MYSQL_BIND array that has been created for the type
     ///        of lease in question.
@@ -619,13 +724,15 @@ private:
     ///
     /// @throw isc::db::DbOperationError An operation on the open database has
     ///        failed.
-    bool addLeaseCommon(StatementIndex stindex, std::vector<MYSQL_BIND>& bind);
+    bool addLeaseCommon(MySqlLeaseContextPtr& ctx, StatementIndex stindex,
+                        std::vector<MYSQL_BIND>& bind);
 
     /// @brief Get Lease Collection Common Code
     ///
     /// This method performs the common actions for obtaining multiple leases
     /// from the database.
     ///
+    /// @param ctx Context of the operation
     /// @param stindex Index of statement being executed
     /// @param bind MYSQL_BIND array for input parameters
     /// @param exchange Exchange object to use
@@ -642,15 +749,16 @@ private:
     /// @throw isc::db::MultipleRecords Multiple records were retrieved
     ///        from the database where only one was expected.
     template <typename Exchange, typename LeaseCollection>
-    void getLeaseCollection(StatementIndex stindex, MYSQL_BIND* bind,
-                            Exchange& exchange, LeaseCollection& result,
-                            bool single = false) const;
+    void getLeaseCollection(MySqlLeaseContextPtr& ctx, StatementIndex stindex,
+                            MYSQL_BIND* bind, Exchange& exchange,
+                            LeaseCollection& result, bool single = false) const;
 
     /// @brief Get Lease Collection
     ///
     /// Gets a collection of Lease4 objects.  This is just an interface to
     /// the get lease collection common code.
     ///
+    /// @param ctx Context of the operation
     /// @param stindex Index of statement being executed
     /// @param bind MYSQL_BIND array for input parameters
     /// @param lease LeaseCollection object returned.  Note that any leases in
@@ -662,9 +770,9 @@ private:
     ///        failed.
     /// @throw isc::db::MultipleRecords Multiple records were retrieved
     ///        from the database where only one was expected.
-    void getLeaseCollection(StatementIndex stindex, MYSQL_BIND* bind,
-                            Lease4Collection& result) const {
-        getLeaseCollection(stindex, bind, exchange4_, result);
+    void getLeaseCollection(MySqlLeaseContextPtr& ctx, StatementIndex stindex,
+                            MYSQL_BIND* bind, Lease4Collection& result) const {
+        getLeaseCollection(ctx, stindex, bind, ctx->exchange4_, result);
     }
 
     /// @brief Get Lease Collection
@@ -672,6 +780,7 @@ private:
     /// Gets a collection of Lease6 objects.  This is just an interface to
     /// the get lease collection common code.
     ///
+    /// @param ctx Context of the operation
     /// @param stindex Index of statement being executed
     /// @param bind MYSQL_BIND array for input parameters
     /// @param lease LeaseCollection object returned.  Note that any existing
@@ -682,9 +791,9 @@ private:
     ///        failed.
     /// @throw isc::db::MultipleRecords Multiple records were retrieved
     ///        from the database where only one was expected.
-    void getLeaseCollection(StatementIndex stindex, MYSQL_BIND* bind,
-                            Lease6Collection& result) const {
-        getLeaseCollection(stindex, bind, exchange6_, result);
+    void getLeaseCollection(MySqlLeaseContextPtr& ctx, StatementIndex stindex,
+                            MYSQL_BIND* bind, Lease6Collection& result) const {
+        getLeaseCollection(ctx, stindex, bind, ctx->exchange6_, result);
     }
 
     /// @brief Get Lease4 Common Code
@@ -693,11 +802,12 @@ private:
     /// methods.  It acts as an interface to the getLeaseCollection() method,
     /// but retrieving only a single lease.
     ///
+    /// @param ctx Context of the operation
     /// @param stindex Index of statement being executed
     /// @param bind MYSQL_BIND array for input parameters
     /// @param lease Lease4 object returned
-    void getLease(StatementIndex stindex, MYSQL_BIND* bind,
-                  Lease4Ptr& result) const;
+    void getLease(MySqlLeaseContextPtr& ctx, StatementIndex stindex,
+                  MYSQL_BIND* bind, Lease4Ptr& result) const;
 
     /// @brief Get Lease6 Common Code
     ///
@@ -705,11 +815,12 @@ private:
     /// methods.  It acts as an interface to the getLeaseCollection() method,
     /// but retrieving only a single lease.
     ///
+    /// @param ctx Context of the operation
     /// @param stindex Index of statement being executed
     /// @param bind MYSQL_BIND array for input parameters
     /// @param lease Lease6 object returned
-    void getLease(StatementIndex stindex, MYSQL_BIND* bind,
-                   Lease6Ptr& result) const;
+    void getLease(MySqlLeaseContextPtr& ctx, StatementIndex stindex,
+                  MYSQL_BIND* bind, Lease6Ptr& result) const;
 
 
     /// @brief Get expired leases common code.
@@ -737,6 +848,7 @@ private:
     /// to the prepared statement, executes it, then checks how many rows
     /// were affected.
     ///
+    /// @param ctx Context of the operation
     /// @param stindex Index of prepared statement to be executed
     /// @param bind Array of MYSQL_BIND objects representing the parameters.
     ///        (Note that the number is determined by the number of parameters
@@ -748,8 +860,8 @@ private:
     /// @throw isc::db::DbOperationError An operation on the open database has
     ///        failed.
     template <typename LeasePtr>
-    void updateLeaseCommon(StatementIndex stindex, MYSQL_BIND* bind,
-                           const LeasePtr& lease);
+    void updateLeaseCommon(MySqlLeaseContextPtr& ctx, StatementIndex stindex,
+                           MYSQL_BIND* bind, const LeasePtr& lease);
 
     /// @brief Delete lease common code
     ///
@@ -757,6 +869,7 @@ private:
     /// to the prepared statement, executes the statement and checks to
     /// see how many rows were deleted.
     ///
+    /// @param ctx Context of the operation
     /// @param stindex Index of prepared statement to be executed
     /// @param bind Array of MYSQL_BIND objects representing the parameters.
     ///        (Note that the number is determined by the number of parameters
@@ -766,7 +879,8 @@ private:
     ///
     /// @throw isc::db::DbOperationError An operation on the open database has
     ///        failed.
-    uint64_t deleteLeaseCommon(StatementIndex stindex, MYSQL_BIND* bind);
+    uint64_t deleteLeaseCommon(MySqlLeaseContextPtr& ctx, StatementIndex stindex,
+                               MYSQL_BIND* bind);
 
     /// @brief Delete expired-reclaimed leases.
     ///
@@ -784,26 +898,23 @@ private:
     ///
     /// This method invokes @ref MySqlConnection::checkError.
     ///
+    /// @param ctx Context of the operation
     /// @param status Status code: non-zero implies an error
     /// @param index Index of statement that caused the error
     /// @param what High-level description of the error
     ///
     /// @throw isc::db::DbOperationError An operation on the open database has
     ///        failed.
-    void checkError(int status, StatementIndex index,
+    void checkError(MySqlLeaseContextPtr& ctx, int status, StatementIndex index,
                     const char* what) const;
 
     // Members
 
-    /// The exchange objects are used for transfer of data to/from the database.
-    /// They are pointed-to objects as the contents may change in "const" calls,
-    /// while the rest of this object does not.  (At alternative would be to
-    /// declare them as "mutable".)
-    boost::scoped_ptr<MySqlLease4Exchange> exchange4_; ///< Exchange object
-    boost::scoped_ptr<MySqlLease6Exchange> exchange6_; ///< Exchange object
+    /// @brief Parameters of the connections
+    db::DatabaseConnection::ParameterMap parameters_;
 
-    /// @brief MySQL connection
-    db::MySqlConnection conn_;
+    /// @brief Pool of connections
+    boost::scoped_ptr<MySqlLeaseContextPool> pool_;
 };
 
 }  // namespace dhcp
@@ -242,6 +242,10 @@ Network::toElement() const {
         map->set("t2-percent", Element::create(t2_percent_));
     }
 
+    if (!cache_threshold_.unspecified()) {
+        map->set("cache-threshold", Element::create(cache_threshold_));
+    }
+
     return (map);
 }
 
@@ -203,7 +203,8 @@ public:
     Network()
         : iface_name_(), client_class_(), t1_(), t2_(), valid_(),
           host_reservation_mode_(HR_ALL, true), cfg_option_(new CfgOption()),
-          calculate_tee_times_(), t1_percent_(), t2_percent_() {
+          calculate_tee_times_(), t1_percent_(), t2_percent_(),
+          cache_threshold_() {
     }
 
     /// @brief Virtual destructor.
@@ -517,6 +518,27 @@ public:
         t2_percent_ = t2_percent;
     }
 
+    /// @brief Returns the lease cache threshold.
+    ///
+    /// A renewed lease is returned from the lease cache, i.e. without
+    /// updating the lease database, while its remaining lifetime is greater
+    /// than this fraction of its valid lifetime.
+    ///
+    /// @param inheritance inheritance mode to be used.
+    util::Optional<double>
+    getCacheThreshold(const Inheritance& inheritance = Inheritance::ALL) const {
+        return (getProperty<Network>(&Network::getCacheThreshold,
+                                     cache_threshold_,
+                                     inheritance, "cache-threshold"));
+    }
+
+    /// @brief Sets the lease cache threshold.
+    ///
+    /// @param cache_threshold New fraction of the valid lifetime to use.
+    void setCacheThreshold(const util::Optional<double>& cache_threshold) {
+        cache_threshold_ = cache_threshold;
+    }
+
     /// @brief Unparses network object.
     ///
     /// @return A pointer to unparsed network configuration.
@@ -779,6 +801,10 @@ protected:
     /// @brief Percentage of the lease lifetime to use when calculating T2 timer
     util::Optional<double> t2_percent_;
 
+    /// @brief Fraction of the valid lifetime which must remain for a
+    /// renewed lease to be returned without updating the lease database
+    util::Optional<double> cache_threshold_;
+
     /// @brief Pointer to another network that this network belongs to.
     ///
     /// The most common case is that this instance is a subnet which belongs
@@ -0,0 +1,111 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/packet_latency.h>
+#include <stats/stats_mgr.h>
+
+#include <sstream>
+
+using namespace boost::posix_time;
+using namespace isc::stats;
+using namespace isc::util;
+
+namespace {
+
+/// @brief Returns the number of microseconds between two times.
+///
+/// @param from the earlier time.
+/// @param to the later time.
+/// @return The number of microseconds, 0 if the clock went backwards.
+uint64_t
+elapsed(const ptime& from, const ptime& to) {
+    const int64_t microseconds = (to - from).total_microseconds();
+    return (microseconds > 0 ? static_cast<uint64_t>(microseconds) : 0);
+}
+
+} // end of anonymous namespace
+
+namespace isc {
+namespace dhcp {
+
+const long PacketLatency::SLOW_REPORT_INTERVAL_MS;
+
+PacketLatency::PacketLatency(const std::string& prefix)
+    : stages_(Pkt::STAGE_COUNT), total_(), slow_threshold_(0),
+      last_report_() {
+    for (int i = Pkt::RECEIVED + 1; i < Pkt::STAGE_COUNT; ++i) {
+        stages_[i] = StatsMgr::instance().getLatencyHistogram(prefix +
+            "-latency-" + Pkt::stageToText(static_cast<Pkt::Stage>(i)));
+    }
+    total_ = StatsMgr::instance().getLatencyHistogram(prefix +
+                                                      "-latency-total");
+}
+
+uint64_t
+PacketLatency::record(const Pkt& pkt) {
+    ptime first;
+    ptime previous;
+    for (int i = Pkt::RECEIVED; i < Pkt::STAGE_COUNT; ++i) {
+        const ptime& stamp = pkt.getStageTime(static_cast<Pkt::Stage>(i));
+        if (stamp.is_not_a_date_time()) {
+            continue;
+        }
+        if (previous.is_not_a_date_time()) {
+            first = stamp;
+        } else {
+            stages_[i]->record(elapsed(previous, stamp));
+        }
+        previous = stamp;
+    }
+
+    if (first.is_not_a_date_time()) {
+        return (0);
+    }
+    const uint64_t total = elapsed(first, previous);
+    total_->record(total);
+    return (total);
+}
+
+bool
+PacketLatency::reportSlow(const uint64_t total) {
+    if ((slow_threshold_ == 0) || (total < slow_threshold_)) {
+        return (false);
+    }
+    const ptime now = microsec_clock::universal_time();
+    if (!last_report_.is_not_a_date_time() &&
+        ((now - last_report_).total_milliseconds() < SLOW_REPORT_INTERVAL_MS)) {
+        return (false);
+    }
+    last_report_ = now;
+    return (true);
+}
+
+std::string
+PacketLatency::breakdownToText(const Pkt& pkt) {
+    std::ostringstream s;
+    ptime previous;
+    for (int i = Pkt::RECEIVED; i < Pkt::STAGE_COUNT; ++i) {
+        const Pkt::Stage stage = static_cast<Pkt::Stage>(i);
+        const ptime& stamp = pkt.getStageTime(stage);
+        if (stamp.is_not_a_date_time()) {
+            continue;
+        }
+        if (!previous.is_not_a_date_time()) {
+            if (s.tellp() > 0) {
+                s << ", ";
+            }
+            s << Pkt::stageToText(stage) << " " << elapsed(previous, stamp)
+              << " us";
+        }
+        previous = stamp;
+    }
+    return (s.str());
+}
+
+} // namespace isc::dhcp
+} // namespace isc
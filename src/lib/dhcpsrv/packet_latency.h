@@ -0,0 +1,108 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef PACKET_LATENCY_H
+#define PACKET_LATENCY_H
+
+#include <dhcp/pkt.h>
+#include <util/latency_histogram.h>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Records the latencies of the processing stages of the packets.
+///
+/// The time spent in each processing stage of a packet is computed from
+/// the stamps of the stages (see @ref Pkt::Stage) and recorded in a latency
+/// histogram of the statistics manager named "<prefix>-latency-<stage>",
+/// e.g. "pkt4-latency-subnet-selected". The time spent in a stage is the
+/// difference between its stamp and the stamp of the previous stage which
+/// was reached. The whole processing time is recorded in the
+/// "<prefix>-latency-total" histogram.
+///
+/// The packets whose processing took longer than a threshold can be
+/// reported with the breakdown of their processing time. At most one
+/// packet per second is reported, so the report of the outliers doesn't
+/// slow down the server further when all the packets are slow.
+class PacketLatency : public boost::noncopyable {
+public:
+
+    /// @brief Minimum interval between two reported slow packets, in
+    /// milliseconds.
+    static const long SLOW_REPORT_INTERVAL_MS = 1000;
+
+    /// @brief Constructor.
+    ///
+    /// Creates the histograms in the statistics manager if they don't
+    /// exist. The slow packets are not reported.
+    ///
+    /// @param prefix prefix of the names of the histograms, e.g. "pkt4".
+    explicit PacketLatency(const std::string& prefix);
+
+    /// @brief Sets the processing time above which a packet is slow.
+    ///
+    /// @param threshold threshold in microseconds, 0 to not report the
+    /// slow packets.
+    void setSlowThreshold(const uint64_t threshold) {
+        slow_threshold_ = threshold;
+    }
+
+    /// @brief Returns the processing time above which a packet is slow.
+    uint64_t getSlowThreshold() const {
+        return (slow_threshold_);
+    }
+
+    /// @brief Records the latencies of the processing stages of a packet.
+    ///
+    /// @param pkt the packet, usually a sent response carrying the stamps
+    /// of its query.
+    /// @return The whole processing time in microseconds, i.e. the time
+    /// between the first and the last stamped stages.
+    uint64_t record(const Pkt& pkt);
+
+    /// @brief Checks if a packet should be reported as slow.
+    ///
+    /// @param total the whole processing time of the packet in
+    /// microseconds, as returned by @ref record.
+    /// @return true if the packet is slow and no slow packet was reported
+    /// in the last @c SLOW_REPORT_INTERVAL_MS milliseconds.
+    bool reportSlow(const uint64_t total);
+
+    /// @brief Returns the breakdown of the processing time of a packet.
+    ///
+    /// @param pkt the packet.
+    /// @return The time spent in each reached stage, e.g.
+    /// "dequeued 12 us, unpacked 3 us, ...".
+    static std::string breakdownToText(const Pkt& pkt);
+
+private:
+
+    /// @brief Histograms of the stages, by stage.
+    ///
+    /// The first stage has no histogram as it has no previous stage.
+    std::vector<util::LatencyHistogramPtr> stages_;
+
+    /// @brief Histogram of the whole processing time.
+    util::LatencyHistogramPtr total_;
+
+    /// @brief Processing time above which a packet is slow.
+    uint64_t slow_threshold_;
+
+    /// @brief Time the last slow packet was reported.
+    boost::posix_time::ptime last_report_;
+};
+
+} // namespace isc::dhcp
+} // namespace isc
+
+#endif // PACKET_LATENCY_H
@@ -61,6 +61,21 @@ protected:
     void parseTeePercents(const data::ConstElementPtr& network_data,
                           NetworkPtr& network);
 
+    /// @brief Parses parameters related to the lease cache.
+    ///
+    /// The parsed parameters are:
+    /// - cache-threshold.
+    ///
+    /// @param network_data Data element holding shared network
+    /// configuration to be parsed.
+    /// @param [out] network Pointer to a network in which parsed data is
+    /// to be stored.
+    ///
+    /// @throw DhcpConfigError if configuration of these parameters is
+    /// invalid.
+    void parseCacheParams(const data::ConstElementPtr& network_data,
+                          NetworkPtr& network);
+
     /// @brief Parses host reservation mode.
     //
     /// @param network_data Data element holding shared network
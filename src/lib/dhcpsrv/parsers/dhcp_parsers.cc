@@ -924,6 +924,9 @@ Subnet4ConfigParser::initSubnet(data::ConstElementPtr params,
 
     // Parse t1-percent and t2-percent
     parseTeePercents(params, network);
+
+    // Parse cache-threshold
+    parseCacheParams(params, network);
 }
 
 //**************************** Subnets4ListConfigParser **********************
@@ -1301,6 +1304,9 @@ Subnet6ConfigParser::initSubnet(data::ConstElementPtr params,
 
     // Parse t1-percent and t2-percent
     parseTeePercents(params, network);
+
+    // Parse cache-threshold
+    parseCacheParams(params, network);
 }
 
 //**************************** Subnet6ListConfigParser ********************
@@ -1459,13 +1465,6 @@ D2ClientConfigParser::parse(isc::data::ConstElementPtr client_config) {
     // Now we check for logical errors. This repeats what is done in
     // D2ClientConfig::validate(), but doing it here permits us to
     // emit meaningful parameter position info in the error.
-    if (ncr_format != dhcp_ddns::FMT_JSON) {
-        isc_throw(D2ClientError, "D2ClientConfig error: NCR Format: "
-                  << dhcp_ddns::ncrFormatToString(ncr_format)
-                  << " is not supported. ("
-                  << getPosition("ncr-format", client_config) << ")");
-    }
-
     if (ncr_protocol != dhcp_ddns::NCR_UDP) {
         isc_throw(D2ClientError, "D2ClientConfig error: NCR Protocol: "
                   << dhcp_ddns::ncrProtocolToString(ncr_protocol)
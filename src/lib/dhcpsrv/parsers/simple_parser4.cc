@@ -74,6 +74,11 @@ const SimpleKeywords SimpleParser4::GLOBAL4_PARAMETERS = {
     { "calculate-tee-times",          Element::boolean },
     { "t1-percent",                   Element::real },
     { "t2-percent",                   Element::real },
+    { "cache-threshold",              Element::real },
+    { "lease-lookup-threads",         Element::integer },
+    { "packet-arena-chunk-size",      Element::integer },
+    { "packet-slow-threshold",        Element::integer },
+    { "host-filter-rebuild-interval", Element::integer },
     { "loggers",                      Element::list },
     { "hostname-char-set",            Element::string },
     { "hostname-char-replacement",    Element::string }
@@ -192,6 +197,7 @@ const SimpleKeywords SimpleParser4::SUBNET4_PARAMETERS = {
     { "calculate-tee-times",    Element::boolean },
     { "t1-percent",             Element::real },
     { "t2-percent",             Element::real },
+    { "cache-threshold",        Element::real },
     { "metadata",               Element::map }
 };
 
@@ -250,7 +256,8 @@ const ParamsList SimpleParser4::INHERIT_TO_SUBNET4 = {
     "max-valid-lifetime",
     "calculate-tee-times",
     "t1-percent",
-    "t2-percent"
+    "t2-percent",
+    "cache-threshold"
 };
 
 /// @brief This table defines all pool parameters.
@@ -297,6 +304,7 @@ const SimpleKeywords SimpleParser4::SHARED_NETWORK4_PARAMETERS = {
     { "calculate-tee-times",    Element::boolean },
     { "t1-percent",             Element::real },
     { "t2-percent",             Element::real },
+    { "cache-threshold",        Element::real },
     { "metadata",               Element::map }
 };
 
@@ -74,6 +74,10 @@ const SimpleKeywords SimpleParser6::GLOBAL6_PARAMETERS = {
     { "calculate-tee-times",          Element::boolean },
     { "t1-percent",                   Element::real },
     { "t2-percent",                   Element::real },
+    { "cache-threshold",              Element::real },
+    { "packet-arena-chunk-size",      Element::integer },
+    { "packet-slow-threshold",        Element::integer },
+    { "host-filter-rebuild-interval", Element::integer },
     { "loggers",                      Element::list },
     { "hostname-char-set",            Element::string },
     { "hostname-char-replacement",    Element::string }
@@ -185,6 +189,7 @@ const SimpleKeywords SimpleParser6::SUBNET6_PARAMETERS = {
     { "calculate-tee-times",    Element::boolean },
     { "t1-percent",             Element::real },
     { "t2-percent",             Element::real },
+    { "cache-threshold",        Element::real },
     { "metadata",               Element::map }
 };
 
@@ -231,7 +236,8 @@ const ParamsList SimpleParser6::INHERIT_TO_SUBNET6 = {
     "max-valid-lifetime",
     "calculate-tee-times",
     "t1-percent",
-    "t2-percent"
+    "t2-percent",
+    "cache-threshold"
 };
 
 /// @brief This table defines all pool parameters.
@@ -297,6 +303,7 @@ const SimpleKeywords SimpleParser6::SHARED_NETWORK6_PARAMETERS = {
     { "calculate-tee-times",    Element::boolean },
     { "t1-percent",             Element::real },
     { "t2-percent",             Element::real },
+    { "cache-threshold",        Element::real },
     { "metadata",               Element::map }
 };
 
@@ -6,6 +6,7 @@
 
 #include <config.h>
 
+#include <database/db_context_pool.h>
 #include <database/db_exceptions.h>
 #include <dhcp/libdhcp++.h>
 #include <dhcp/option.h>
@@ -20,6 +21,7 @@
 #include <boost/algorithm/string/split.hpp>
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/array.hpp>
+#include <boost/bind.hpp>
 #include <boost/pointer_cast.hpp>
 #include <boost/static_assert.hpp>
 
@@ -1268,7 +1270,24 @@ private:
 namespace isc {
 namespace dhcp {
 
+class PgSqlHostContext;
+
+/// @brief Pointer to a PostgreSQL host context.
+typedef boost::shared_ptr<PgSqlHostContext> PgSqlHostContextPtr;
+
+/// @brief Pool of PostgreSQL host contexts.
+typedef DbContextPool<PgSqlHostContext> PgSqlHostContextPool;
+
+/// @brief Takes a PostgreSQL host context from the pool for the scope.
+typedef DbContextAlloc<PgSqlHostContext> PgSqlHostContextAlloc;
+
 /// @brief Implementation of the @ref PgSqlHostDataSource.
+///
+/// The connections to the database are kept in a pool: each operation
+/// takes a connection for its exclusive use. The maximum number of
+/// connections is given by the @c pool-size parameter. Unless it is
+/// configured, the DHCPv4 server sets it to one more than the number of
+/// lease lookup threads.
 class PgSqlHostDataSourceImpl {
 public:
 
@@ -1311,15 +1330,24 @@ public:
 
     /// @brief Constructor.
     ///
-    /// This constructor opens database connection and initializes prepared
-    /// statements used in the queries.
+    /// This constructor creates the pool of connections and opens the
+    /// first connection to check the database.
     PgSqlHostDataSourceImpl(const PgSqlConnection::ParameterMap& parameters);
 
     /// @brief Destructor.
     ~PgSqlHostDataSourceImpl();
 
+    /// @brief Opens a new connection to the database.
+    ///
+    /// Checks the schema version and initializes prepared statements used
+    /// in the queries.
+    ///
+    /// @return Pointer to the new context.
+    PgSqlHostContextPtr createContext() const;
+
     /// @brief Executes statements which insert a row into one of the tables.
     ///
+    /// @param ctx Context of the operation.
     /// @param stindex Index of a statement being executed.
     /// @param bind Vector of PgsqlBindArray objects to be used for the query
     /// @param return_last_id flag indicating whether or not the insert
@@ -1333,33 +1361,40 @@ public:
     /// the value in the result set in the first col of the first row.
     ///
     /// @throw isc::db::DuplicateEntry Database throws duplicate entry error
-    uint64_t addStatement(PgSqlHostDataSourceImpl::StatementIndex stindex,
+    uint64_t addStatement(PgSqlHostContextPtr& ctx,
+                          PgSqlHostDataSourceImpl::StatementIndex stindex,
                           PsqlBindArrayPtr& bind,
                           const bool return_last_id = false);
 
     /// @brief Executes statements that delete records.
     ///
+    /// @param ctx Context of the operation.
     /// @param stindex Index of a statement being executed.
     /// @param bind pointer to PsqlBindArray objects to be used for the query
     /// @return true if any records were deleted, false otherwise
-    bool delStatement(PgSqlHostDataSourceImpl::StatementIndex stindex,
+    bool delStatement(PgSqlHostContextPtr& ctx,
+                      PgSqlHostDataSourceImpl::StatementIndex stindex,
                       PsqlBindArrayPtr& bind);
 
     /// @brief Inserts IPv6 Reservation into ipv6_reservation table.
     ///
+    /// @param ctx Context of the operation.
     /// @param resv IPv6 Reservation to be added
     /// @param id ID of a host owning this reservation
-    void addResv(const IPv6Resrv& resv, const HostID& id);
+    void addResv(PgSqlHostContextPtr& ctx,
+                 const IPv6Resrv& resv, const HostID& id);
 
     /// @brief Inserts a single DHCP option into the database.
     ///
+    /// @param ctx Context of the operation.
     /// @param stindex Index of a statement being executed.
     /// @param opt_desc Option descriptor holding information about an option
     /// to be inserted into the database.
     /// @param opt_space Option space name.
     /// @param subnet_id Subnet identifier.
     /// @param host_id Host identifier.
-    void addOption(const PgSqlHostDataSourceImpl::StatementIndex& stindex,
+    void addOption(PgSqlHostContextPtr& ctx,
+                   const PgSqlHostDataSourceImpl::StatementIndex& stindex,
                    const OptionDescriptor& opt_desc,
                    const std::string& opt_space,
                    const Optional<SubnetID>& subnet_id,
@@ -1367,12 +1402,14 @@ public:
 
     /// @brief Inserts multiple options into the database.
     ///
+    /// @param ctx Context of the operation.
     /// @param stindex Index of a statement being executed.
     /// @param options_cfg An object holding a collection of options to be
     /// inserted into the database.
     /// @param host_id Host identifier retrieved using getColumnValue
     ///                in addStatement method
-    void addOptions(const StatementIndex& stindex,
+    void addOptions(PgSqlHostContextPtr& ctx,
+                    const StatementIndex& stindex,
                     const ConstCfgOptionPtr& options_cfg,
                     const uint64_t host_id);
 
@@ -1386,6 +1423,7 @@ public:
     /// Whether IPv6 reservations and/or options are assigned to the
     /// @ref Host objects depends on the type of the exchange object.
     ///
+    /// @param ctx Context of the operation.
     /// @param stindex Statement index.
     /// @param bind Pointer to an array of PgSQL bindings.
     /// @param exchange Pointer to the exchange object used for the
@@ -1393,7 +1431,8 @@ public:
     /// @param [out] result Reference to the collection of hosts returned.
     /// @param single A boolean value indicating if a single host is
     /// expected to be returned, or multiple hosts.
-    void getHostCollection(StatementIndex stindex, PsqlBindArrayPtr bind,
+    void getHostCollection(PgSqlHostContextPtr& ctx,
+                           StatementIndex stindex, PsqlBindArrayPtr bind,
                            boost::shared_ptr<PgSqlHostExchange> exchange,
                            ConstHostCollection& result, bool single) const;
 
@@ -1402,6 +1441,7 @@ public:
     /// This method is used by both PgSqlHostDataSource::get4 and
     /// PgSqlHostDataSource::get6 methods.
     ///
+    /// @param ctx Context of the operation.
     /// @param subnet_id Subnet identifier.
     /// @param identifier_type Identifier type.
     /// @param identifier_begin Pointer to a beginning of a buffer containing
@@ -1413,7 +1453,8 @@ public:
     ///
     /// @return Pointer to const instance of Host or null pointer if
     /// no host found.
-    ConstHostPtr getHost(const SubnetID& subnet_id,
+    ConstHostPtr getHost(PgSqlHostContextPtr& ctx,
+                         const SubnetID& subnet_id,
                          const Host::IdentifierType& identifier_type,
                          const uint8_t* identifier_begin,
                          const size_t identifier_len,
@@ -1431,13 +1472,39 @@ public:
 
     /// @brief Returns PostgreSQL schema version of the open database
     ///
+    /// @param ctx Context with an open connection to the database.
+    ///
     /// @return Version number stored in the database, as a pair of unsigned
     ///         integers. "first" is the major version number, "second" the
     ///         minor number.
     ///
     /// @throw isc::db::DbOperationError An operation on the open database
     ///        has failed.
-    std::pair<uint32_t, uint32_t> getVersion() const;
+    std::pair<uint32_t, uint32_t> getVersion(PgSqlHostContextPtr& ctx) const;
+
+    /// @brief Parameters of the connections.
+    PgSqlConnection::ParameterMap parameters_;
+
+    /// @brief Pool of connections.
+    boost::scoped_ptr<PgSqlHostContextPool> pool_;
+
+    /// @brief Indicates if the database is opened in read only mode.
+    bool is_readonly_;
+};
+
+/// @brief PostgreSQL host context.
+///
+/// An open connection to the database with its prepared statements and
+/// the exchange objects used to transfer the data of these statements.
+/// A context is used by one caller at a time.
+class PgSqlHostContext {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param parameters A data structure relating keywords and values
+    ///        concerned with the database.
+    PgSqlHostContext(const PgSqlConnection::ParameterMap& parameters);
 
     /// @brief Pointer to the object representing an exchange which
     /// can be used to retrieve hosts and DHCPv4 options.
@@ -1463,9 +1530,6 @@ public:
 
     /// @brief PgSQL connection
     PgSqlConnection conn_;
-
-    /// @brief Indicates if the database is opened in read only mode.
-    bool is_readonly_;
 };
 
 namespace {
@@ -1827,24 +1891,50 @@ TaggedStatementArray tagged_statements = { {
 
 }; // end anonymous namespace
 
-PgSqlHostDataSourceImpl::
-PgSqlHostDataSourceImpl(const PgSqlConnection::ParameterMap& parameters)
+PgSqlHostContext::
+PgSqlHostContext(const PgSqlConnection::ParameterMap& parameters)
     : host_exchange_(new PgSqlHostWithOptionsExchange(PgSqlHostWithOptionsExchange::DHCP4_ONLY)),
       host_ipv6_exchange_(new PgSqlHostIPv6Exchange(PgSqlHostWithOptionsExchange::DHCP6_ONLY)),
       host_ipv46_exchange_(new PgSqlHostIPv6Exchange(PgSqlHostWithOptionsExchange::
                                                      DHCP4_AND_DHCP6)),
       host_ipv6_reservation_exchange_(new PgSqlIPv6ReservationExchange()),
       host_option_exchange_(new PgSqlOptionExchange()),
-      conn_(parameters),
-      is_readonly_(false) {
+      conn_(parameters) {
+}
+
+PgSqlHostDataSourceImpl::
+PgSqlHostDataSourceImpl(const PgSqlConnection::ParameterMap& parameters)
+    : parameters_(parameters), is_readonly_(false) {
+
+    pool_.reset(new PgSqlHostContextPool(boost::bind(&PgSqlHostDataSourceImpl::createContext,
+                                                     this),
+                                         getDbPoolMaxSize(parameters_)));
+
+    // Open the first connection to check the database.
+    PgSqlHostContextAlloc get_context(*pool_);
+
+    // Check if the backend is explicitly configured to operate with
+    // read only access to the database.
+    is_readonly_ = get_context.ctx_->conn_.configuredReadOnly();
+    if (is_readonly_) {
+        LOG_INFO(dhcpsrv_logger, DHCPSRV_PGSQL_HOST_DB_READONLY);
+    }
+}
+
+PgSqlHostDataSourceImpl::~PgSqlHostDataSourceImpl() {
+}
+
+PgSqlHostContextPtr
+PgSqlHostDataSourceImpl::createContext() const {
+    PgSqlHostContextPtr ctx(new PgSqlHostContext(parameters_));
 
     // Open the database.
-    conn_.openDatabase();
+    ctx->conn_.openDatabase();
 
     // Validate the schema version first.
     std::pair<uint32_t, uint32_t> code_version(PG_SCHEMA_VERSION_MAJOR,
                                                PG_SCHEMA_VERSION_MINOR);
-    std::pair<uint32_t, uint32_t> db_version = getVersion();
+    std::pair<uint32_t, uint32_t> db_version = getVersion(ctx);
     if (code_version != db_version) {
         isc_throw(DbOpenError,
                   "PostgreSQL schema version mismatch: need version: "
@@ -1854,33 +1944,26 @@ PgSqlHostDataSourceImpl(const PgSqlConnection::ParameterMap& parameters)
     }
 
     // Now prepare the SQL statements.
-    conn_.prepareStatements(tagged_statements.begin(),
-                            tagged_statements.begin() + WRITE_STMTS_BEGIN);
-
-    // Check if the backend is explicitly configured to operate with
-    // read only access to the database.
-    is_readonly_ = conn_.configuredReadOnly();
+    ctx->conn_.prepareStatements(tagged_statements.begin(),
+                                 tagged_statements.begin() + WRITE_STMTS_BEGIN);
 
     // If we are using read-write mode for the database we also prepare
     // statements for INSERTS etc.
-    if (!is_readonly_) {
-        conn_.prepareStatements(tagged_statements.begin() + WRITE_STMTS_BEGIN,
-                                tagged_statements.end());
-
-    } else {
-        LOG_INFO(dhcpsrv_logger, DHCPSRV_PGSQL_HOST_DB_READONLY);
+    if (!ctx->conn_.configuredReadOnly()) {
+        ctx->conn_.prepareStatements(tagged_statements.begin() + WRITE_STMTS_BEGIN,
+                                     tagged_statements.end());
     }
-}
 
-PgSqlHostDataSourceImpl::~PgSqlHostDataSourceImpl() {
+    return (ctx);
 }
 
 uint64_t
-PgSqlHostDataSourceImpl::addStatement(StatementIndex stindex,
+PgSqlHostDataSourceImpl::addStatement(PgSqlHostContextPtr& ctx,
+                                      StatementIndex stindex,
                                       PsqlBindArrayPtr& bind_array,
                                       const bool return_last_id) {
     uint64_t last_id = 0;
-    PgSqlResult r(PQexecPrepared(conn_, tagged_statements[stindex].name,
+    PgSqlResult r(PQexecPrepared(ctx->conn_, tagged_statements[stindex].name,
                                  tagged_statements[stindex].nbparams,
                                  &bind_array->values_[0],
                                  &bind_array->lengths_[0],
@@ -1890,13 +1973,13 @@ PgSqlHostDataSourceImpl::addStatement(StatementIndex stindex,
 
     if (s != PGRES_COMMAND_OK) {
         // Failure: check for the special case of duplicate entry.
-        if (conn_.compareError(r, PgSqlConnection::DUPLICATE_KEY)) {
+        if (ctx->conn_.compareError(r, PgSqlConnection::DUPLICATE_KEY)) {
             isc_throw(DuplicateEntry, "Database duplicate entry error");
         }
 
         // Connection determines if the error is fatal or not, and
         // throws the appropriate exception
-        conn_.checkStatementError(r, tagged_statements[stindex]);
+        ctx->conn_.checkStatementError(r, tagged_statements[stindex]);
     }
 
     if (return_last_id) {
@@ -1907,9 +1990,10 @@ PgSqlHostDataSourceImpl::addStatement(StatementIndex stindex,
 }
 
 bool
-PgSqlHostDataSourceImpl::delStatement(StatementIndex stindex,
+PgSqlHostDataSourceImpl::delStatement(PgSqlHostContextPtr& ctx,
+                                      StatementIndex stindex,
                                       PsqlBindArrayPtr& bind_array) {
-    PgSqlResult r(PQexecPrepared(conn_, tagged_statements[stindex].name,
+    PgSqlResult r(PQexecPrepared(ctx->conn_, tagged_statements[stindex].name,
                                  tagged_statements[stindex].nbparams,
                                  &bind_array->values_[0],
                                  &bind_array->lengths_[0],
@@ -1920,7 +2004,7 @@ PgSqlHostDataSourceImpl::delStatement(StatementIndex stindex,
     if (s != PGRES_COMMAND_OK) {
         // Connection determines if the error is fatal or not, and
         // throws the appropriate exception
-        conn_.checkStatementError(r, tagged_statements[stindex]);
+        ctx->conn_.checkStatementError(r, tagged_statements[stindex]);
     }
 
     // Now check how many rows (hosts) were deleted. This should be either
@@ -1934,27 +2018,30 @@ PgSqlHostDataSourceImpl::delStatement(StatementIndex stindex,
 }
 
 void
-PgSqlHostDataSourceImpl::addResv(const IPv6Resrv& resv,
+PgSqlHostDataSourceImpl::addResv(PgSqlHostContextPtr& ctx,
+                                 const IPv6Resrv& resv,
                                  const HostID& id) {
     PsqlBindArrayPtr bind_array;
-    bind_array = host_ipv6_reservation_exchange_->createBindForSend(resv, id);
-    addStatement(INSERT_V6_RESRV, bind_array);
+    bind_array = ctx->host_ipv6_reservation_exchange_->createBindForSend(resv, id);
+    addStatement(ctx, INSERT_V6_RESRV, bind_array);
 }
 
 void
-PgSqlHostDataSourceImpl::addOption(const StatementIndex& stindex,
+PgSqlHostDataSourceImpl::addOption(PgSqlHostContextPtr& ctx,
+                                   const StatementIndex& stindex,
                                    const OptionDescriptor& opt_desc,
                                    const std::string& opt_space,
                                    const Optional<SubnetID>&,
                                    const HostID& id) {
     PsqlBindArrayPtr bind_array;
-    bind_array = host_option_exchange_->createBindForSend(opt_desc, opt_space,
+    bind_array = ctx->host_option_exchange_->createBindForSend(opt_desc, opt_space,
                                                           id);
-    addStatement(stindex, bind_array);
+    addStatement(ctx, stindex, bind_array);
 }
 
 void
-PgSqlHostDataSourceImpl::addOptions(const StatementIndex& stindex,
+PgSqlHostDataSourceImpl::addOptions(PgSqlHostContextPtr& ctx,
+                                    const StatementIndex& stindex,
                                     const ConstCfgOptionPtr& options_cfg,
                                     const uint64_t host_id) {
     // Get option space names and vendor space names and combine them within a
@@ -1972,7 +2059,7 @@ PgSqlHostDataSourceImpl::addOptions(const StatementIndex& stindex,
         if (options && !options->empty()) {
             for (OptionContainer::const_iterator opt = options->begin();
                  opt != options->end(); ++opt) {
-                addOption(stindex, *opt, *space, Optional<SubnetID>(),
+                addOption(ctx, stindex, *opt, *space, Optional<SubnetID>(),
                           host_id);
             }
         }
@@ -1981,18 +2068,19 @@ PgSqlHostDataSourceImpl::addOptions(const StatementIndex& stindex,
 
 void
 PgSqlHostDataSourceImpl::
-getHostCollection(StatementIndex stindex, PsqlBindArrayPtr bind_array,
+getHostCollection(PgSqlHostContextPtr& ctx,
+                  StatementIndex stindex, PsqlBindArrayPtr bind_array,
                   boost::shared_ptr<PgSqlHostExchange> exchange,
                   ConstHostCollection& result, bool single) const {
 
     exchange->clear();
-    PgSqlResult r(PQexecPrepared(conn_, tagged_statements[stindex].name,
+    PgSqlResult r(PQexecPrepared(ctx->conn_, tagged_statements[stindex].name,
                                  tagged_statements[stindex].nbparams,
                                  &bind_array->values_[0],
                                  &bind_array->lengths_[0],
                                  &bind_array->formats_[0], 0));
 
-    conn_.checkStatementError(r, tagged_statements[stindex]);
+    ctx->conn_.checkStatementError(r, tagged_statements[stindex]);
 
     int rows = r.getRows();
     for(int row = 0; row < rows; ++row) {
@@ -2008,7 +2096,8 @@ getHostCollection(StatementIndex stindex, PsqlBindArrayPtr bind_array,
 
 ConstHostPtr
 PgSqlHostDataSourceImpl::
-getHost(const SubnetID& subnet_id,
+getHost(PgSqlHostContextPtr& ctx,
+        const SubnetID& subnet_id,
         const Host::IdentifierType& identifier_type,
         const uint8_t* identifier_begin,
         const size_t identifier_len,
@@ -2028,7 +2117,7 @@ getHost(const SubnetID& subnet_id,
     bind_array->add(identifier_begin, identifier_len);
 
     ConstHostCollection collection;
-    getHostCollection(stindex, bind_array, exchange, collection, true);
+    getHostCollection(ctx, stindex, bind_array, exchange, collection, true);
 
     // Return single record if present, else clear the host.
     ConstHostPtr result;
@@ -2038,14 +2127,15 @@ getHost(const SubnetID& subnet_id,
     return (result);
 }
 
-std::pair<uint32_t, uint32_t> PgSqlHostDataSourceImpl::getVersion() const {
+std::pair<uint32_t, uint32_t>
+PgSqlHostDataSourceImpl::getVersion(PgSqlHostContextPtr& ctx) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_HOST_DB_GET_VERSION);
     const char* version_sql =  "SELECT version, minor FROM schema_version;";
-    PgSqlResult r(PQexec(conn_, version_sql));
+    PgSqlResult r(PQexec(ctx->conn_, version_sql));
     if(PQresultStatus(r) != PGRES_TUPLES_OK) {
         isc_throw(DbOperationError, "unable to execute PostgreSQL statement <"
-                  << version_sql << ">, reason: " << PQerrorMessage(conn_));
+                  << version_sql << ">, reason: " << PQerrorMessage(ctx->conn_));
     }
 
     uint32_t version;
@@ -2081,30 +2171,34 @@ PgSqlHostDataSource::add(const HostPtr& host) {
     // If operating in read-only mode, throw exception.
     impl_->checkReadOnly();
 
+    // Get a context
+    PgSqlHostContextAlloc get_context(*impl_->pool_);
+    PgSqlHostContextPtr ctx = get_context.ctx_;
+
     // Initiate PostgreSQL transaction as we will have to make multiple queries
     // to insert host information into multiple tables. If that fails on
     // any stage, the transaction will be rolled back by the destructor of
     // the PgSqlTransaction class.
-    PgSqlTransaction transaction(impl_->conn_);
+    PgSqlTransaction transaction(ctx->conn_);
 
     // Create the PgSQL Bind array for the host
-    PsqlBindArrayPtr bind_array = impl_->host_exchange_->createBindForSend(host);
+    PsqlBindArrayPtr bind_array = ctx->host_exchange_->createBindForSend(host);
 
     // ... and insert the host.
-    uint32_t host_id = impl_->addStatement(PgSqlHostDataSourceImpl::INSERT_HOST,
+    uint32_t host_id = impl_->addStatement(ctx, PgSqlHostDataSourceImpl::INSERT_HOST,
                                            bind_array, true);
 
     // Insert DHCPv4 options.
     ConstCfgOptionPtr cfg_option4 = host->getCfgOption4();
     if (cfg_option4) {
-        impl_->addOptions(PgSqlHostDataSourceImpl::INSERT_V4_HOST_OPTION,
+        impl_->addOptions(ctx, PgSqlHostDataSourceImpl::INSERT_V4_HOST_OPTION,
                           cfg_option4, host_id);
     }
 
     // Insert DHCPv6 options.
     ConstCfgOptionPtr cfg_option6 = host->getCfgOption6();
     if (cfg_option6) {
-        impl_->addOptions(PgSqlHostDataSourceImpl::INSERT_V6_HOST_OPTION,
+        impl_->addOptions(ctx, PgSqlHostDataSourceImpl::INSERT_V6_HOST_OPTION,
                           cfg_option6, host_id);
     }
 
@@ -2113,7 +2207,7 @@ PgSqlHostDataSource::add(const HostPtr& host) {
     if (std::distance(v6resv.first, v6resv.second) > 0) {
         for (IPv6ResrvIterator resv = v6resv.first; resv != v6resv.second;
              ++resv) {
-            impl_->addResv(resv->second, host_id);
+            impl_->addResv(ctx, resv->second, host_id);
         }
     }
 
@@ -2127,10 +2221,14 @@ PgSqlHostDataSource::del(const SubnetID& subnet_id, const asiolink::IOAddress& a
     impl_->checkReadOnly();
 
     if (addr.isV4()) {
+        // Get a context
+        PgSqlHostContextAlloc get_context(*impl_->pool_);
+        PgSqlHostContextPtr ctx = get_context.ctx_;
+
         PsqlBindArrayPtr bind_array(new PsqlBindArray());
         bind_array->add(subnet_id);
         bind_array->add(addr);
-        return (impl_->delStatement(PgSqlHostDataSourceImpl::DEL_HOST_ADDR4,
+        return (impl_->delStatement(ctx, PgSqlHostDataSourceImpl::DEL_HOST_ADDR4,
                                     bind_array));
     }
 
@@ -2160,7 +2258,11 @@ PgSqlHostDataSource::del4(const SubnetID& subnet_id,
     // identifier
     bind_array->add(identifier_begin, identifier_len);
 
-    return (impl_->delStatement(PgSqlHostDataSourceImpl::DEL_HOST_SUBID4_ID,
+    // Get a context
+    PgSqlHostContextAlloc get_context(*impl_->pool_);
+    PgSqlHostContextPtr ctx = get_context.ctx_;
+
+    return (impl_->delStatement(ctx, PgSqlHostDataSourceImpl::DEL_HOST_SUBID4_ID,
                                 bind_array));
 }
 
@@ -2180,7 +2282,11 @@ PgSqlHostDataSource::del6(const SubnetID& subnet_id,
     // identifier
     bind_array->add(identifier_begin, identifier_len);
 
-    return (impl_->delStatement(PgSqlHostDataSourceImpl::DEL_HOST_SUBID6_ID,
+    // Get a context
+    PgSqlHostContextAlloc get_context(*impl_->pool_);
+    PgSqlHostContextPtr ctx = get_context.ctx_;
+
+    return (impl_->delStatement(ctx, PgSqlHostDataSourceImpl::DEL_HOST_SUBID6_ID,
                                 bind_array));
 }
 
@@ -2197,9 +2303,13 @@ PgSqlHostDataSource::getAll(const Host::IdentifierType& identifier_type,
     // Identifier type.
     bind_array->add(static_cast<uint8_t>(identifier_type));
 
+    // Get a context
+    PgSqlHostContextAlloc get_context(*impl_->pool_);
+    PgSqlHostContextPtr ctx = get_context.ctx_;
+
     ConstHostCollection result;
-    impl_->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_DHCPID,
-                             bind_array, impl_->host_ipv46_exchange_,
+    impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_DHCPID,
+                             bind_array, ctx->host_ipv46_exchange_,
                              result, false);
     return (result);
 }
@@ -2212,9 +2322,13 @@ PgSqlHostDataSource::getAll4(const SubnetID& subnet_id) const {
     // Add the subnet id.
     bind_array->add(subnet_id);
 
+    // Get a context
+    PgSqlHostContextAlloc get_context(*impl_->pool_);
+    PgSqlHostContextPtr ctx = get_context.ctx_;
+
     ConstHostCollection result;
-    impl_->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_SUBID4,
-                             bind_array, impl_->host_exchange_,
+    impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_SUBID4,
+                             bind_array, ctx->host_exchange_,
                              result, false);
 
     return (result);
@@ -2228,9 +2342,13 @@ PgSqlHostDataSource::getAll6(const SubnetID& subnet_id) const {
     // Add the subnet id.
     bind_array->add(subnet_id);
 
+    // Get a context
+    PgSqlHostContextAlloc get_context(*impl_->pool_);
+    PgSqlHostContextPtr ctx = get_context.ctx_;
+
     ConstHostCollection result;
-    impl_->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_SUBID6,
-                             bind_array, impl_->host_ipv6_exchange_,
+    impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_SUBID6,
+                             bind_array, ctx->host_ipv6_exchange_,
                              result, false);
 
     return (result);
@@ -2255,9 +2373,13 @@ PgSqlHostDataSource::getPage4(const SubnetID& subnet_id,
         boost::lexical_cast<std::string>(page_size.page_size_);
     bind_array->add(page_size_data);
 
+    // Get a context
+    PgSqlHostContextAlloc get_context(*impl_->pool_);
+    PgSqlHostContextPtr ctx = get_context.ctx_;
+
     ConstHostCollection result;
-    impl_->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_SUBID4_PAGE,
-                             bind_array, impl_->host_exchange_,
+    impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_SUBID4_PAGE,
+                             bind_array, ctx->host_exchange_,
                              result, false);
 
     return (result);
@@ -2282,9 +2404,13 @@ PgSqlHostDataSource::getPage6(const SubnetID& subnet_id,
         boost::lexical_cast<std::string>(page_size.page_size_);
     bind_array->add(page_size_data);
 
+    // Get a context
+    PgSqlHostContextAlloc get_context(*impl_->pool_);
+    PgSqlHostContextPtr ctx = get_context.ctx_;
+
     ConstHostCollection result;
-    impl_->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_SUBID6_PAGE,
-                             bind_array, impl_->host_ipv6_exchange_,
+    impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_SUBID6_PAGE,
+                             bind_array, ctx->host_ipv6_exchange_,
                              result, false);
 
     return (result);
@@ -2299,9 +2425,13 @@ PgSqlHostDataSource::getAll4(const asiolink::IOAddress& address) const {
     // v4 Reservation address
     bind_array->add(address);
 
+    // Get a context
+    PgSqlHostContextAlloc get_context(*impl_->pool_);
+    PgSqlHostContextPtr ctx = get_context.ctx_;
+
     ConstHostCollection result;
-    impl_->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_ADDR, bind_array,
-                             impl_->host_exchange_, result, false);
+    impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_ADDR, bind_array,
+                             ctx->host_exchange_, result, false);
 
     return (result);
 }
@@ -2312,10 +2442,14 @@ PgSqlHostDataSource::get4(const SubnetID& subnet_id,
                           const uint8_t* identifier_begin,
                           const size_t identifier_len) const {
 
-    return (impl_->getHost(subnet_id, identifier_type, identifier_begin,
+    // Get a context
+    PgSqlHostContextAlloc get_context(*impl_->pool_);
+    PgSqlHostContextPtr ctx = get_context.ctx_;
+
+    return (impl_->getHost(ctx, subnet_id, identifier_type, identifier_begin,
                            identifier_len,
                            PgSqlHostDataSourceImpl::GET_HOST_SUBID4_DHCPID,
-                           impl_->host_exchange_));
+                           ctx->host_exchange_));
 }
 
 ConstHostPtr
@@ -2335,9 +2469,13 @@ PgSqlHostDataSource::get4(const SubnetID& subnet_id,
     // Add the address
     bind_array->add(address);
 
+    // Get a context
+    PgSqlHostContextAlloc get_context(*impl_->pool_);
+    PgSqlHostContextPtr ctx = get_context.ctx_;
+
     ConstHostCollection collection;
-    impl_->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_SUBID_ADDR,
-                             bind_array, impl_->host_exchange_, collection,
+    impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_SUBID_ADDR,
+                             bind_array, ctx->host_exchange_, collection,
                              true);
 
     // Return single record if present, else clear the host.
@@ -2354,9 +2492,13 @@ PgSqlHostDataSource::get6(const SubnetID& subnet_id,
                           const uint8_t* identifier_begin,
                           const size_t identifier_len) const {
 
-    return (impl_->getHost(subnet_id, identifier_type, identifier_begin,
+    // Get a context
+    PgSqlHostContextAlloc get_context(*impl_->pool_);
+    PgSqlHostContextPtr ctx = get_context.ctx_;
+
+    return (impl_->getHost(ctx, subnet_id, identifier_type, identifier_begin,
                    identifier_len, PgSqlHostDataSourceImpl::GET_HOST_SUBID6_DHCPID,
-                   impl_->host_ipv6_exchange_));
+                   ctx->host_ipv6_exchange_));
 }
 
 ConstHostPtr
@@ -2373,9 +2515,13 @@ PgSqlHostDataSource::get6(const asiolink::IOAddress& prefix,
     // Add the prefix length
     bind_array->add(prefix_len);
 
+    // Get a context
+    PgSqlHostContextAlloc get_context(*impl_->pool_);
+    PgSqlHostContextPtr ctx = get_context.ctx_;
+
     ConstHostCollection collection;
-    impl_->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_PREFIX,
-                             bind_array, impl_->host_ipv6_exchange_,
+    impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_PREFIX,
+                             bind_array, ctx->host_ipv6_exchange_,
                              collection, true);
 
     // Return single record if present, else clear the host.
@@ -2401,9 +2547,13 @@ PgSqlHostDataSource::get6(const SubnetID& subnet_id,
     // Add the prefix
     bind_array->add(address);
 
+    // Get a context
+    PgSqlHostContextAlloc get_context(*impl_->pool_);
+    PgSqlHostContextPtr ctx = get_context.ctx_;
+
     ConstHostCollection collection;
-    impl_->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_SUBID6_ADDR,
-                             bind_array, impl_->host_ipv6_exchange_,
+    impl_->getHostCollection(ctx, PgSqlHostDataSourceImpl::GET_HOST_SUBID6_ADDR,
+                             bind_array, ctx->host_ipv6_exchange_,
                              collection, true);
 
     // Return single record if present, else clear the host.
@@ -2419,10 +2569,9 @@ PgSqlHostDataSource::get6(const SubnetID& subnet_id,
 
 std::string PgSqlHostDataSource::getName() const {
     std::string name = "";
-    try {
-        name = impl_->conn_.getParameter("name");
-    } catch (...) {
-        // Return an empty name
+    auto param = impl_->parameters_.find("name");
+    if (param != impl_->parameters_.end()) {
+        name = param->second;
     }
     return (name);
 }
@@ -2433,21 +2582,35 @@ std::string PgSqlHostDataSource::getDescription() const {
 }
 
 std::pair<uint32_t, uint32_t> PgSqlHostDataSource::getVersion() const {
-    return(impl_->getVersion());
+    // Get a context
+    PgSqlHostContextAlloc get_context(*impl_->pool_);
+    PgSqlHostContextPtr ctx = get_context.ctx_;
+
+    return (impl_->getVersion(ctx));
 }
 
 void
 PgSqlHostDataSource::commit() {
     // If operating in read-only mode, throw exception.
     impl_->checkReadOnly();
-    impl_->conn_.commit();
+
+    // Get a context
+    PgSqlHostContextAlloc get_context(*impl_->pool_);
+    PgSqlHostContextPtr ctx = get_context.ctx_;
+
+    ctx->conn_.commit();
 }
 
 void
 PgSqlHostDataSource::rollback() {
     // If operating in read-only mode, throw exception.
     impl_->checkReadOnly();
-    impl_->conn_.rollback();
+
+    // Get a context
+    PgSqlHostContextAlloc get_context(*impl_->pool_);
+    PgSqlHostContextPtr ctx = get_context.ctx_;
+
+    ctx->conn_.rollback();
 }
 
 }; // end of isc::dhcp namespace
@@ -10,9 +10,11 @@
 #include <dhcp/duid.h>
 #include <dhcp/hwaddr.h>
 #include <dhcpsrv/dhcpsrv_log.h>
+#include <dhcpsrv/lease_change_stream.h>
 #include <dhcpsrv/dhcpsrv_exceptions.h>
 #include <dhcpsrv/pgsql_lease_mgr.h>
 
+#include <boost/bind.hpp>
 #include <boost/static_assert.hpp>
 
 #include <iomanip>
@@ -329,6 +331,27 @@ PgSqlTaggedStatement tagged_statements[] = {
       "  FROM lease6_stat "
       "  WHERE subnet_id >= $1 and subnet_id <= $2 "
       "  ORDER BY subnet_id, lease_type, state" },
+
+    // FIND_FREE_ADDRESS4
+    // The free addresses are the first address of the range, the
+    // addresses following a lease of the range and the addresses of the
+    // reclaimed leases of the range which have no other lease.
+    { 3, { OID_INT8, OID_INT8, OID_INT8 },
+      "find_free_address4",
+      "SELECT DISTINCT a FROM ("
+        "SELECT $1::bigint AS a "
+        "UNION ALL "
+        "SELECT address + 1 FROM lease4 "
+          "WHERE address >= $1 AND address < $2 "
+        "UNION ALL "
+        "SELECT address FROM lease4 "
+          "WHERE address >= $1 AND address <= $2 AND state = 2"
+      ") AS candidates "
+      "WHERE NOT EXISTS "
+        "(SELECT 1 FROM lease4 "
+          "WHERE address = candidates.a AND state != 2) "
+      "ORDER BY a LIMIT $3"},
+
     // End of list sentinel
     { 0,  { 0 }, NULL, NULL}
 };
@@ -932,6 +955,9 @@ private:
     //@}
 };
 
+/// @brief Pointer to an object holding a PostgreSQL lease context.
+typedef boost::shared_ptr<PgSqlLeaseContextAlloc> PgSqlLeaseContextAllocPtr;
+
 /// @brief Base PgSql derivation of the statistical lease data query
 ///
 /// This class provides the functionality such as results storage and row
@@ -943,27 +969,33 @@ public:
     ///
     ///  The query created will return statistics for all subnets
     ///
-    /// @param conn A open connection to the database housing the lease data
+    /// @param get_context Holder of the context with an open connection to
+    /// the database housing the lease data, kept for the life of the query
     /// @param statement The lease data SQL prepared statement to execute
     /// @param fetch_type Indicates whether or not lease_type should be
     /// fetched from the result set
-    PgSqlLeaseStatsQuery(PgSqlConnection& conn, PgSqlTaggedStatement& statement,
+    PgSqlLeaseStatsQuery(const PgSqlLeaseContextAllocPtr& get_context,
+                         PgSqlTaggedStatement& statement,
                          const bool fetch_type)
-        : conn_(conn), statement_(statement), result_set_(), next_row_(0),
-         fetch_type_(fetch_type) {
+        : get_context_(get_context), conn_(get_context->ctx_->conn_),
+          statement_(statement), result_set_(), next_row_(0),
+          fetch_type_(fetch_type) {
     }
 
     /// @brief Constructor to query for a single subnet's stats
     ///
     /// The query created will return statistics for a single subnet
     ///
-    /// @param conn A open connection to the database housing the lease data
+    /// @param get_context Holder of the context with an open connection to
+    /// the database housing the lease data, kept for the life of the query
     /// @param statement The lease data SQL prepared statement to execute
     /// @param fetch_type Indicates if query supplies lease type
     /// @param subnet_id id of the subnet for which stats are desired
-    PgSqlLeaseStatsQuery(PgSqlConnection& conn, PgSqlTaggedStatement& statement,
+    PgSqlLeaseStatsQuery(const PgSqlLeaseContextAllocPtr& get_context,
+                         PgSqlTaggedStatement& statement,
                          const bool fetch_type, const SubnetID& subnet_id)
-        : LeaseStatsQuery(subnet_id), conn_(conn), statement_(statement), result_set_(),
+        : LeaseStatsQuery(subnet_id), get_context_(get_context),
+          conn_(get_context->ctx_->conn_), statement_(statement), result_set_(),
           next_row_(0), fetch_type_(fetch_type) {
     }
 
@@ -972,16 +1004,20 @@ public:
     /// The query created will return statistics for the inclusive range of
     /// subnets described by first and last sunbet IDs.
     ///
-    /// @param conn A open connection to the database housing the lease data
+    /// @param get_context Holder of the context with an open connection to
+    /// the database housing the lease data, kept for the life of the query
     /// @param statement The lease data SQL prepared statement to execute
     /// @param fetch_type Indicates if query supplies lease type
     /// @param first_subnet_id first subnet in the range of subnets
     /// @param last_subnet_id last subnet in the range of subnets
-    PgSqlLeaseStatsQuery(PgSqlConnection& conn, PgSqlTaggedStatement& statement,
+    PgSqlLeaseStatsQuery(const PgSqlLeaseContextAllocPtr& get_context,
+                         PgSqlTaggedStatement& statement,
                          const bool fetch_type, const SubnetID& first_subnet_id,
                          const SubnetID& last_subnet_id)
-        : LeaseStatsQuery(first_subnet_id, last_subnet_id), conn_(conn), statement_(statement),
-          result_set_(), next_row_(0), fetch_type_(fetch_type) {
+        : LeaseStatsQuery(first_subnet_id, last_subnet_id),
+          get_context_(get_context), conn_(get_context->ctx_->conn_),
+          statement_(statement), result_set_(), next_row_(0),
+          fetch_type_(fetch_type) {
     }
 
     /// @brief Destructor
@@ -1076,6 +1112,9 @@ public:
     }
 
 protected:
+    /// @brief Context used by the query until it is destroyed
+    PgSqlLeaseContextAllocPtr get_context_;
+
     /// @brief Database connection to use to execute the query
     PgSqlConnection& conn_;
 
@@ -1092,15 +1131,38 @@ protected:
     bool fetch_type_;
 };
 
+PgSqlLeaseContext::PgSqlLeaseContext(const DatabaseConnection::ParameterMap& parameters)
+    : exchange4_(new PgSqlLease4Exchange()),
+      exchange6_(new PgSqlLease6Exchange()), conn_(parameters) {
+}
+
+PgSqlLeaseContext::~PgSqlLeaseContext() {
+}
+
 PgSqlLeaseMgr::PgSqlLeaseMgr(const DatabaseConnection::ParameterMap& parameters)
-    : LeaseMgr(), exchange4_(new PgSqlLease4Exchange()),
-    exchange6_(new PgSqlLease6Exchange()), conn_(parameters) {
-    conn_.openDatabase();
+    : LeaseMgr(), parameters_(parameters) {
+
+    pool_.reset(new PgSqlLeaseContextPool(boost::bind(&PgSqlLeaseMgr::createContext,
+                                                      this),
+                                          getDbPoolMaxSize(parameters_)));
+
+    // Open the first connection to check the database.
+    PgSqlLeaseContextAlloc get_context(*pool_);
+}
+
+PgSqlLeaseMgr::~PgSqlLeaseMgr() {
+}
+
+PgSqlLeaseContextPtr
+PgSqlLeaseMgr::createContext() const {
+    PgSqlLeaseContextPtr ctx(new PgSqlLeaseContext(parameters_));
+
+    ctx->conn_.openDatabase();
 
     // Validate schema version first.
     std::pair<uint32_t, uint32_t> code_version(PG_SCHEMA_VERSION_MAJOR,
                                                PG_SCHEMA_VERSION_MINOR);
-    std::pair<uint32_t, uint32_t> db_version = getVersion();
+    std::pair<uint32_t, uint32_t> db_version = getVersion(ctx->conn_);
     if (code_version != db_version) {
         isc_throw(DbOpenError,
                   "PostgreSQL schema version mismatch: need version: "
@@ -1112,7 +1174,7 @@ PgSqlLeaseMgr::PgSqlLeaseMgr(const DatabaseConnection::ParameterMap& parameters)
     // Now prepare the SQL statements.
     int i = 0;
     for( ; tagged_statements[i].text != NULL ; ++i) {
-        conn_.prepareStatement(tagged_statements[i]);
+        ctx->conn_.prepareStatement(tagged_statements[i]);
     }
 
     // Just in case somebody foo-barred things
@@ -1120,9 +1182,8 @@ PgSqlLeaseMgr::PgSqlLeaseMgr(const DatabaseConnection::ParameterMap& parameters)
         isc_throw(DbOpenError, "Number of statements prepared: " << i
                   << " does not match expected count:" << NUM_STATEMENTS);
     }
-}
 
-PgSqlLeaseMgr::~PgSqlLeaseMgr() {
+    return (ctx);
 }
 
 std::string
@@ -1135,9 +1196,10 @@ PgSqlLeaseMgr::getDBVersion() {
 }
 
 bool
-PgSqlLeaseMgr::addLeaseCommon(StatementIndex stindex,
+PgSqlLeaseMgr::addLeaseCommon(PgSqlLeaseContextPtr& ctx,
+                              StatementIndex stindex,
                               PsqlBindArray& bind_array) {
-    PgSqlResult r(PQexecPrepared(conn_, tagged_statements[stindex].name,
+    PgSqlResult r(PQexecPrepared(ctx->conn_, tagged_statements[stindex].name,
                                  tagged_statements[stindex].nbparams,
                                  &bind_array.values_[0],
                                  &bind_array.lengths_[0],
@@ -1149,11 +1211,11 @@ PgSqlLeaseMgr::addLeaseCommon(StatementIndex stindex,
         // Failure: check for the special case of duplicate entry.  If this is
         // the case, we return false to indicate that the row was not added.
         // Otherwise we throw an exception.
-        if (conn_.compareError(r, PgSqlConnection::DUPLICATE_KEY)) {
+        if (ctx->conn_.compareError(r, PgSqlConnection::DUPLICATE_KEY)) {
             return (false);
         }
 
-        conn_.checkStatementError(r, tagged_statements[stindex]);
+        ctx->conn_.checkStatementError(r, tagged_statements[stindex]);
     }
 
     return (true);
@@ -1164,34 +1226,89 @@ PgSqlLeaseMgr::addLease(const Lease4Ptr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_ADD_ADDR4).arg(lease->addr_.toText());
 
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
     PsqlBindArray bind_array;
-    exchange4_->createBindForSend(lease, bind_array);
-    return (addLeaseCommon(INSERT_LEASE4, bind_array));
+    ctx->exchange4_->createBindForSend(lease, bind_array);
+    if (!addLeaseCommon(ctx, INSERT_LEASE4, bind_array)) {
+        return (false);
+    }
+    LeaseChangeStream::instance().publish(LeaseChange::ADD, lease);
+    return (true);
+}
+
+std::vector<IOAddress>
+PgSqlLeaseMgr::findFreeAddresses4(const IOAddress& first, const IOAddress& last,
+                                  const size_t max_count) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_PGSQL_FIND_FREE_ADDR4).arg(first.toText())
+        .arg(last.toText());
+
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
+    PsqlBindArray bind_array;
+    std::string first_str = boost::lexical_cast<std::string>(first.toUint32());
+    bind_array.add(first_str);
+    std::string last_str = boost::lexical_cast<std::string>(last.toUint32());
+    bind_array.add(last_str);
+    std::string limit_str = boost::lexical_cast<std::string>(max_count);
+    bind_array.add(limit_str);
+
+    PgSqlResult r(PQexecPrepared(ctx->conn_,
+                                 tagged_statements[FIND_FREE_ADDRESS4].name,
+                                 tagged_statements[FIND_FREE_ADDRESS4].nbparams,
+                                 &bind_array.values_[0],
+                                 &bind_array.lengths_[0],
+                                 &bind_array.formats_[0], 0));
+
+    ctx->conn_.checkStatementError(r, tagged_statements[FIND_FREE_ADDRESS4]);
+
+    std::vector<IOAddress> addresses;
+    const int rows = PQntuples(r);
+    for (int row = 0; row < rows; ++row) {
+        uint32_t free_addr = 0;
+        PgSqlExchange::getColumnValue(r, row, 0, free_addr);
+        addresses.push_back(IOAddress(free_addr));
+    }
+    return (addresses);
 }
 
 bool
 PgSqlLeaseMgr::addLease(const Lease6Ptr& lease) {
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_ADD_ADDR6).arg(lease->addr_.toText());
     PsqlBindArray bind_array;
-    exchange6_->createBindForSend(lease, bind_array);
+    ctx->exchange6_->createBindForSend(lease, bind_array);
 
-    return (addLeaseCommon(INSERT_LEASE6, bind_array));
+    if (!addLeaseCommon(ctx, INSERT_LEASE6, bind_array)) {
+        return (false);
+    }
+    LeaseChangeStream::instance().publish(LeaseChange::ADD, lease);
+    return (true);
 }
 
 template <typename Exchange, typename LeaseCollection>
-void PgSqlLeaseMgr::getLeaseCollection(StatementIndex stindex,
+void PgSqlLeaseMgr::getLeaseCollection(PgSqlLeaseContextPtr& ctx,
+                                       StatementIndex stindex,
                                        PsqlBindArray& bind_array,
                                        Exchange& exchange,
                                        LeaseCollection& result,
                                        bool single) const {
     const int n = tagged_statements[stindex].nbparams;
-    PgSqlResult r(PQexecPrepared(conn_, tagged_statements[stindex].name, n,
+    PgSqlResult r(PQexecPrepared(ctx->conn_, tagged_statements[stindex].name, n,
                                  n > 0 ? &bind_array.values_[0] : NULL,
                                  n > 0 ? &bind_array.lengths_[0] : NULL,
                                  n > 0 ? &bind_array.formats_[0] : NULL, 0));
 
-    conn_.checkStatementError(r, tagged_statements[stindex]);
+    ctx->conn_.checkStatementError(r, tagged_statements[stindex]);
 
     int rows = PQntuples(r);
     if (single && rows > 1) {
@@ -1206,15 +1323,15 @@ void PgSqlLeaseMgr::getLeaseCollection(StatementIndex stindex,
 }
 
 void
-PgSqlLeaseMgr::getLease(StatementIndex stindex, PsqlBindArray& bind_array,
-                             Lease4Ptr& result) const {
+PgSqlLeaseMgr::getLease(PgSqlLeaseContextPtr& ctx, StatementIndex stindex,
+                        PsqlBindArray& bind_array, Lease4Ptr& result) const {
     // Create appropriate collection object and get all leases matching
     // the selection criteria.  The "single" parameter is true to indicate
     // that the called method should throw an exception if multiple
     // matching records are found: this particular method is called when only
     // one or zero matches is expected.
     Lease4Collection collection;
-    getLeaseCollection(stindex, bind_array, exchange4_, collection, true);
+    getLeaseCollection(ctx, stindex, bind_array, ctx->exchange4_, collection, true);
 
     // Return single record if present, else clear the lease.
     if (collection.empty()) {
@@ -1225,15 +1342,15 @@ PgSqlLeaseMgr::getLease(StatementIndex stindex, PsqlBindArray& bind_array,
 }
 
 void
-PgSqlLeaseMgr::getLease(StatementIndex stindex, PsqlBindArray& bind_array,
-                             Lease6Ptr& result) const {
+PgSqlLeaseMgr::getLease(PgSqlLeaseContextPtr& ctx, StatementIndex stindex,
+                        PsqlBindArray& bind_array, Lease6Ptr& result) const {
     // Create appropriate collection object and get all leases matching
     // the selection criteria.  The "single" parameter is true to indicate
     // that the called method should throw an exception if multiple
     // matching records are found: this particular method is called when only
     // one or zero matches is expected.
     Lease6Collection collection;
-    getLeaseCollection(stindex, bind_array, exchange6_, collection, true);
+    getLeaseCollection(ctx, stindex, bind_array, ctx->exchange6_, collection, true);
 
     // Return single record if present, else clear the lease.
     if (collection.empty()) {
@@ -1256,9 +1373,13 @@ PgSqlLeaseMgr::getLease4(const isc::asiolink::IOAddress& addr) const {
                            (addr.toUint32());
     bind_array.add(addr_str);
 
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Get the data
     Lease4Ptr result;
-    getLease(GET_LEASE4_ADDR, bind_array, result);
+    getLease(ctx, GET_LEASE4_ADDR, bind_array, result);
 
     return (result);
 }
@@ -1278,9 +1399,13 @@ PgSqlLeaseMgr::getLease4(const HWAddr& hwaddr) const {
         bind_array.add("");
     }
 
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Get the data
     Lease4Collection result;
-    getLeaseCollection(GET_LEASE4_HWADDR, bind_array, result);
+    getLeaseCollection(ctx, GET_LEASE4_HWADDR, bind_array, result);
 
     return (result);
 }
@@ -1305,9 +1430,13 @@ PgSqlLeaseMgr::getLease4(const HWAddr& hwaddr, SubnetID subnet_id) const {
     std::string subnet_id_str = boost::lexical_cast<std::string>(subnet_id);
     bind_array.add(subnet_id_str);
 
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Get the data
     Lease4Ptr result;
-    getLease(GET_LEASE4_HWADDR_SUBID, bind_array, result);
+    getLease(ctx, GET_LEASE4_HWADDR_SUBID, bind_array, result);
 
     return (result);
 }
@@ -1323,9 +1452,13 @@ PgSqlLeaseMgr::getLease4(const ClientId& clientid) const {
     // CLIENT_ID
     bind_array.add(clientid.getClientId());
 
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Get the data
     Lease4Collection result;
-    getLeaseCollection(GET_LEASE4_CLIENTID, bind_array, result);
+    getLeaseCollection(ctx, GET_LEASE4_CLIENTID, bind_array, result);
 
     return (result);
 }
@@ -1356,9 +1489,13 @@ PgSqlLeaseMgr::getLease4(const ClientId& clientid, SubnetID subnet_id) const {
     std::string subnet_id_str = boost::lexical_cast<std::string>(subnet_id);
     bind_array.add(subnet_id_str);
 
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Get the data
     Lease4Ptr result;
-    getLease(GET_LEASE4_CLIENTID_SUBID, bind_array, result);
+    getLease(ctx, GET_LEASE4_CLIENTID_SUBID, bind_array, result);
 
     return (result);
 }
@@ -1375,9 +1512,13 @@ PgSqlLeaseMgr::getLeases4(SubnetID subnet_id) const {
     std::string subnet_id_str = boost::lexical_cast<std::string>(subnet_id);
     bind_array.add(subnet_id_str);
 
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
     // ... and get the data
     Lease4Collection result;
-    getLeaseCollection(GET_LEASE4_SUBID, bind_array, result);
+    getLeaseCollection(ctx, GET_LEASE4_SUBID, bind_array, result);
 
     return (result);
 }
@@ -1386,11 +1527,15 @@ Lease4Collection
 PgSqlLeaseMgr::getLeases4() const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_PGSQL_GET4);
 
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Provide empty binding array because our query has no parameters in
     // WHERE clause.
     PsqlBindArray bind_array;
     Lease4Collection result;
-    getLeaseCollection(GET_LEASE4, bind_array, result);
+    getLeaseCollection(ctx, GET_LEASE4, bind_array, result);
 
     return (result);
 }
@@ -1421,9 +1566,13 @@ PgSqlLeaseMgr::getLeases4(const asiolink::IOAddress& lower_bound_address,
     std::string page_size_data = boost::lexical_cast<std::string>(page_size.page_size_);
     bind_array.add(page_size_data);
 
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Get the leases
     Lease4Collection result;
-    getLeaseCollection(GET_LEASE4_PAGE, bind_array, result);
+    getLeaseCollection(ctx, GET_LEASE4_PAGE, bind_array, result);
 
     return (result);
 }
@@ -1445,9 +1594,13 @@ PgSqlLeaseMgr::getLease6(Lease::Type lease_type,
     std::string type_str_ = boost::lexical_cast<std::string>(lease_type);
     bind_array.add(type_str_);
 
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
     // ... and get the data
     Lease6Ptr result;
-    getLease(GET_LEASE6_ADDR, bind_array, result);
+    getLease(ctx, GET_LEASE6_ADDR, bind_array, result);
 
     return (result);
 }
@@ -1473,9 +1626,13 @@ PgSqlLeaseMgr::getLeases6(Lease::Type lease_type, const DUID& duid,
     std::string lease_type_str = boost::lexical_cast<std::string>(lease_type);
     bind_array.add(lease_type_str);
 
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
     // ... and get the data
     Lease6Collection result;
-    getLeaseCollection(GET_LEASE6_DUID_IAID, bind_array, result);
+    getLeaseCollection(ctx, GET_LEASE6_DUID_IAID, bind_array, result);
 
     return (result);
 }
@@ -1505,9 +1662,13 @@ PgSqlLeaseMgr::getLeases6(Lease::Type lease_type, const DUID& duid,
     std::string subnet_id_str = boost::lexical_cast<std::string>(subnet_id);
     bind_array.add(subnet_id_str);
 
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
     // ... and get the data
     Lease6Collection result;
-    getLeaseCollection(GET_LEASE6_DUID_IAID_SUBID, bind_array, result);
+    getLeaseCollection(ctx, GET_LEASE6_DUID_IAID_SUBID, bind_array, result);
 
     return (result);
 }
@@ -1524,9 +1685,13 @@ PgSqlLeaseMgr::getLeases6(SubnetID subnet_id) const {
     std::string subnet_id_str = boost::lexical_cast<std::string>(subnet_id);
     bind_array.add(subnet_id_str);
 
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
     // ... and get the data
     Lease6Collection result;
-    getLeaseCollection(GET_LEASE6_SUBID, bind_array, result);
+    getLeaseCollection(ctx, GET_LEASE6_SUBID, bind_array, result);
 
     return (result);
 }
@@ -1544,8 +1709,12 @@ PgSqlLeaseMgr::getLeases6(const DUID& duid) const {
     bind_array.add(duid.getDuid());
     Lease6Collection result;
 
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
     // query to fetch the data
-    getLeaseCollection(GET_LEASE6_DUID, bind_array, result);
+    getLeaseCollection(ctx, GET_LEASE6_DUID, bind_array, result);
 
     return (result);
 }
@@ -1554,11 +1723,15 @@ Lease6Collection
 PgSqlLeaseMgr::getLeases6() const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_PGSQL_GET6);
 
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Provide empty binding array because our query has no parameters in
     // WHERE clause.
     PsqlBindArray bind_array;
     Lease6Collection result;
-    getLeaseCollection(GET_LEASE6, bind_array, result);
+    getLeaseCollection(ctx, GET_LEASE6, bind_array, result);
 
     return (result);
 }
@@ -1595,9 +1768,13 @@ PgSqlLeaseMgr::getLeases6(const asiolink::IOAddress& lower_bound_address,
     std::string page_size_data = boost::lexical_cast<std::string>(page_size.page_size_);
     bind_array.add(page_size_data);
 
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Get the leases
     Lease6Collection result;
-    getLeaseCollection(GET_LEASE6_PAGE, bind_array, result);
+    getLeaseCollection(ctx, GET_LEASE6_PAGE, bind_array, result);
 
     return (result);
 }
@@ -1640,25 +1817,30 @@ PgSqlLeaseMgr::getExpiredLeasesCommon(LeaseCollection& expired_leases,
     std::string limit_str = boost::lexical_cast<std::string>(limit);
     bind_array.add(limit_str);
 
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Retrieve leases from the database.
-    getLeaseCollection(statement_index, bind_array, expired_leases);
+    getLeaseCollection(ctx, statement_index, bind_array, expired_leases);
 }
 
 template<typename LeasePtr>
 void
-PgSqlLeaseMgr::updateLeaseCommon(StatementIndex stindex,
+PgSqlLeaseMgr::updateLeaseCommon(PgSqlLeaseContextPtr& ctx,
+                                 StatementIndex stindex,
                                  PsqlBindArray& bind_array,
                                  const LeasePtr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_ADD_ADDR4).arg(tagged_statements[stindex].name);
 
-    PgSqlResult r(PQexecPrepared(conn_, tagged_statements[stindex].name,
+    PgSqlResult r(PQexecPrepared(ctx->conn_, tagged_statements[stindex].name,
                                  tagged_statements[stindex].nbparams,
                                  &bind_array.values_[0],
                                  &bind_array.lengths_[0],
                                  &bind_array.formats_[0], 0));
 
-    conn_.checkStatementError(r, tagged_statements[stindex]);
+    ctx->conn_.checkStatementError(r, tagged_statements[stindex]);
 
     int affected_rows = boost::lexical_cast<int>(PQcmdTuples(r));
 
@@ -1686,9 +1868,13 @@ PgSqlLeaseMgr::updateLease4(const Lease4Ptr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_UPDATE_ADDR4).arg(lease->addr_.toText());
 
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Create the BIND array for the data being updated
     PsqlBindArray bind_array;
-    exchange4_->createBindForSend(lease, bind_array);
+    ctx->exchange4_->createBindForSend(lease, bind_array);
 
     // Set up the WHERE clause and append it to the SQL_BIND array
     std::string addr4_ = boost::lexical_cast<std::string>
@@ -1696,7 +1882,8 @@ PgSqlLeaseMgr::updateLease4(const Lease4Ptr& lease) {
     bind_array.add(addr4_);
 
     // Drop to common update code
-    updateLeaseCommon(stindex, bind_array, lease);
+    updateLeaseCommon(ctx, stindex, bind_array, lease);
+    LeaseChangeStream::instance().publish(LeaseChange::UPDATE, lease);
 }
 
 void
@@ -1706,28 +1893,34 @@ PgSqlLeaseMgr::updateLease6(const Lease6Ptr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_UPDATE_ADDR6).arg(lease->addr_.toText());
 
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Create the BIND array for the data being updated
     PsqlBindArray bind_array;
-    exchange6_->createBindForSend(lease, bind_array);
+    ctx->exchange6_->createBindForSend(lease, bind_array);
 
     // Set up the WHERE clause and append it to the BIND array
     std::string addr_str = lease->addr_.toText();
     bind_array.add(addr_str);
 
     // Drop to common update code
-    updateLeaseCommon(stindex, bind_array, lease);
+    updateLeaseCommon(ctx, stindex, bind_array, lease);
+    LeaseChangeStream::instance().publish(LeaseChange::UPDATE, lease);
 }
 
 uint64_t
-PgSqlLeaseMgr::deleteLeaseCommon(StatementIndex stindex,
+PgSqlLeaseMgr::deleteLeaseCommon(PgSqlLeaseContextPtr& ctx,
+                                 StatementIndex stindex,
                                  PsqlBindArray& bind_array) {
-    PgSqlResult r(PQexecPrepared(conn_, tagged_statements[stindex].name,
+    PgSqlResult r(PQexecPrepared(ctx->conn_, tagged_statements[stindex].name,
                                  tagged_statements[stindex].nbparams,
                                  &bind_array.values_[0],
                                  &bind_array.lengths_[0],
                                  &bind_array.formats_[0], 0));
 
-    conn_.checkStatementError(r, tagged_statements[stindex]);
+    ctx->conn_.checkStatementError(r, tagged_statements[stindex]);
     int affected_rows = boost::lexical_cast<int>(PQcmdTuples(r));
 
     return (affected_rows);
@@ -1738,19 +1931,30 @@ PgSqlLeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_DELETE_ADDR).arg(addr.toText());
 
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Set up the WHERE clause value
     PsqlBindArray bind_array;
 
+    bool deleted = false;
     if (addr.isV4()) {
         std::string addr4_str = boost::lexical_cast<std::string>
                                  (addr.toUint32());
         bind_array.add(addr4_str);
-        return (deleteLeaseCommon(DELETE_LEASE4, bind_array) > 0);
+        deleted = (deleteLeaseCommon(ctx, DELETE_LEASE4, bind_array) > 0);
+
+    } else {
+        std::string addr6_str = addr.toText();
+        bind_array.add(addr6_str);
+        deleted = (deleteLeaseCommon(ctx, DELETE_LEASE6, bind_array) > 0);
     }
 
-    std::string addr6_str = addr.toText();
-    bind_array.add(addr6_str);
-    return (deleteLeaseCommon(DELETE_LEASE6, bind_array) > 0);
+    if (deleted) {
+        LeaseChangeStream::instance().publishDelete(addr);
+    }
+    return (deleted);
 }
 
 uint64_t
@@ -1783,22 +1987,28 @@ PgSqlLeaseMgr::deleteExpiredReclaimedLeasesCommon(const uint32_t secs,
         PgSqlLeaseExchange::convertToDatabaseTime(time(NULL) - static_cast<time_t>(secs));
     bind_array.add(expiration_str);
 
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
     // Delete leases.
-    return (deleteLeaseCommon(statement_index, bind_array));
+    return (deleteLeaseCommon(ctx, statement_index, bind_array));
 }
 
 LeaseStatsQueryPtr
 PgSqlLeaseMgr::startLeaseStatsQuery4() {
+    PgSqlLeaseContextAllocPtr get_context(new PgSqlLeaseContextAlloc(*pool_));
     LeaseStatsQueryPtr query(
-        new PgSqlLeaseStatsQuery(conn_, tagged_statements[ALL_LEASE4_STATS], false));
+        new PgSqlLeaseStatsQuery(get_context, tagged_statements[ALL_LEASE4_STATS], false));
     query->start();
     return(query);
 }
 
 LeaseStatsQueryPtr
 PgSqlLeaseMgr::startSubnetLeaseStatsQuery4(const SubnetID& subnet_id) {
+    PgSqlLeaseContextAllocPtr get_context(new PgSqlLeaseContextAlloc(*pool_));
     LeaseStatsQueryPtr query(
-        new PgSqlLeaseStatsQuery(conn_, tagged_statements[SUBNET_LEASE4_STATS],
+        new PgSqlLeaseStatsQuery(get_context, tagged_statements[SUBNET_LEASE4_STATS],
                                  false, subnet_id));
     query->start();
     return(query);
@@ -1807,8 +2017,9 @@ PgSqlLeaseMgr::startSubnetLeaseStatsQuery4(const SubnetID& subnet_id) {
 LeaseStatsQueryPtr
 PgSqlLeaseMgr::startSubnetRangeLeaseStatsQuery4(const SubnetID& first_subnet_id,
                                                    const SubnetID& last_subnet_id) {
+    PgSqlLeaseContextAllocPtr get_context(new PgSqlLeaseContextAlloc(*pool_));
     LeaseStatsQueryPtr query(
-        new PgSqlLeaseStatsQuery(conn_, tagged_statements[SUBNET_RANGE_LEASE4_STATS],
+        new PgSqlLeaseStatsQuery(get_context, tagged_statements[SUBNET_RANGE_LEASE4_STATS],
                                  false, first_subnet_id, last_subnet_id));
     query->start();
     return(query);
@@ -1816,16 +2027,18 @@ PgSqlLeaseMgr::startSubnetRangeLeaseStatsQuery4(const SubnetID& first_subnet_id,
 
 LeaseStatsQueryPtr
 PgSqlLeaseMgr::startLeaseStatsQuery6() {
+    PgSqlLeaseContextAllocPtr get_context(new PgSqlLeaseContextAlloc(*pool_));
     LeaseStatsQueryPtr query(
-        new PgSqlLeaseStatsQuery(conn_, tagged_statements[ALL_LEASE6_STATS], true));
+        new PgSqlLeaseStatsQuery(get_context, tagged_statements[ALL_LEASE6_STATS], true));
     query->start();
     return(query);
 }
 
 LeaseStatsQueryPtr
 PgSqlLeaseMgr::startSubnetLeaseStatsQuery6(const SubnetID& subnet_id) {
+    PgSqlLeaseContextAllocPtr get_context(new PgSqlLeaseContextAlloc(*pool_));
     LeaseStatsQueryPtr query(
-        new PgSqlLeaseStatsQuery(conn_, tagged_statements[SUBNET_LEASE6_STATS],
+        new PgSqlLeaseStatsQuery(get_context, tagged_statements[SUBNET_LEASE6_STATS],
                                  true, subnet_id));
     query->start();
     return(query);
@@ -1834,8 +2047,9 @@ PgSqlLeaseMgr::startSubnetLeaseStatsQuery6(const SubnetID& subnet_id) {
 LeaseStatsQueryPtr
 PgSqlLeaseMgr::startSubnetRangeLeaseStatsQuery6(const SubnetID& first_subnet_id,
                                                 const SubnetID& last_subnet_id) {
+    PgSqlLeaseContextAllocPtr get_context(new PgSqlLeaseContextAlloc(*pool_));
     LeaseStatsQueryPtr query(
-        new PgSqlLeaseStatsQuery(conn_, tagged_statements[SUBNET_RANGE_LEASE6_STATS],
+        new PgSqlLeaseStatsQuery(get_context, tagged_statements[SUBNET_RANGE_LEASE6_STATS],
                                  true, first_subnet_id, last_subnet_id));
     query->start();
     return(query);
@@ -1854,10 +2068,9 @@ PgSqlLeaseMgr::wipeLeases6(const SubnetID& /*subnet_id*/) {
 string
 PgSqlLeaseMgr::getName() const {
     string name = "";
-    try {
-        name = conn_.getParameter("name");
-    } catch (...) {
-        // Return an empty name
+    auto param = parameters_.find("name");
+    if (param != parameters_.end()) {
+        name = param->second;
     }
     return (name);
 }
@@ -1872,11 +2085,20 @@ PgSqlLeaseMgr::getVersion() const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_GET_VERSION);
 
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
+    return (getVersion(ctx->conn_));
+}
+
+pair<uint32_t, uint32_t>
+PgSqlLeaseMgr::getVersion(PgSqlConnection& conn) {
     const char* version_sql =  "SELECT version, minor FROM schema_version;";
-    PgSqlResult r(PQexec(conn_, version_sql));
+    PgSqlResult r(PQexec(conn, version_sql));
     if(PQresultStatus(r) != PGRES_TUPLES_OK) {
         isc_throw(DbOperationError, "unable to execute PostgreSQL statement <"
-                  << version_sql << ", reason: " << PQerrorMessage(conn_));
+                  << version_sql << ", reason: " << PQerrorMessage(conn));
     }
 
     istringstream tmp;
@@ -1895,12 +2117,20 @@ PgSqlLeaseMgr::getVersion() const {
 
 void
 PgSqlLeaseMgr::commit() {
-    conn_.commit();
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
+    ctx->conn_.commit();
 }
 
 void
 PgSqlLeaseMgr::rollback() {
-    conn_.rollback();
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*pool_);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
+    ctx->conn_.rollback();
 }
 
 }; // end of isc::dhcp namespace
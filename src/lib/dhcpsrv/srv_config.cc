@@ -28,6 +28,7 @@ namespace dhcp {
 SrvConfig::SrvConfig()
     : sequence_(0), cfg_iface_(new CfgIface()),
       cfg_option_def_(new CfgOptionDef()), cfg_option_(new CfgOption()),
+      cfg_option_list_cache_(new CfgOptionListCache()),
       cfg_subnets4_(new CfgSubnets4()), cfg_subnets6_(new CfgSubnets6()),
       cfg_shared_networks4_(new CfgSharedNetworks4()),
       cfg_shared_networks6_(new CfgSharedNetworks6()),
@@ -38,6 +39,8 @@ SrvConfig::SrvConfig()
       cfg_host_operations6_(CfgHostOperations::createConfig6()),
       class_dictionary_(new ClientClassDictionary()),
       decline_timer_(0), echo_v4_client_id_(true), dhcp4o6_port_(0),
+      lease_lookup_threads_(0), packet_arena_chunk_size_(0),
+      packet_slow_threshold_(0), host_filter_rebuild_interval_(0),
       d2_client_config_(new D2ClientConfig()),
       configured_globals_(Element::createMap()),
       cfg_consist_(new CfgConsistency()) {
@@ -46,6 +49,7 @@ SrvConfig::SrvConfig()
 SrvConfig::SrvConfig(const uint32_t sequence)
     : sequence_(sequence), cfg_iface_(new CfgIface()),
       cfg_option_def_(new CfgOptionDef()), cfg_option_(new CfgOption()),
+      cfg_option_list_cache_(new CfgOptionListCache()),
       cfg_subnets4_(new CfgSubnets4()), cfg_subnets6_(new CfgSubnets6()),
       cfg_shared_networks4_(new CfgSharedNetworks4()),
       cfg_shared_networks6_(new CfgSharedNetworks6()),
@@ -56,6 +60,8 @@ SrvConfig::SrvConfig(const uint32_t sequence)
       cfg_host_operations6_(CfgHostOperations::createConfig6()),
       class_dictionary_(new ClientClassDictionary()),
       decline_timer_(0), echo_v4_client_id_(true), dhcp4o6_port_(0),
+      lease_lookup_threads_(0), packet_arena_chunk_size_(0),
+      packet_slow_threshold_(0), host_filter_rebuild_interval_(0),
       d2_client_config_(new D2ClientConfig()),
       configured_globals_(Element::createMap()),
       cfg_consist_(new CfgConsistency()) {
@@ -237,6 +243,18 @@ SrvConfig::mergeGlobals(SrvConfig& other) {
             else if (name == "dhcp4o6-port") {
                 setDhcp4o6Port(element->intValue());
             }
+            else if (name == "lease-lookup-threads") {
+                setLeaseLookupThreads(element->intValue());
+            }
+            else if (name == "packet-arena-chunk-size") {
+                setPacketArenaChunkSize(element->intValue());
+            }
+            else if (name == "packet-slow-threshold") {
+                setPacketSlowThreshold(element->intValue());
+            }
+            else if (name == "host-filter-rebuild-interval") {
+                setHostFilterRebuildInterval(element->intValue());
+            }
             else if (name == "server-tag") {
                 setServerTag(element->stringValue());
             }
@@ -272,6 +290,64 @@ SrvConfig::updateStatistics() {
     }
 }
 
+void
+SrvConfig::updateOptionsCache() {
+    cfg_option_list_cache_->clear();
+
+    std::list<CfgOptionPtr> cfg_options;
+    cfg_options.push_back(cfg_option_);
+
+    const Subnet4Collection* subnets4 = cfg_subnets4_->getAll();
+    for (auto subnet = subnets4->begin(); subnet != subnets4->end();
+         ++subnet) {
+        cfg_options.push_back((*subnet)->getCfgOption());
+        const PoolCollection& pools = (*subnet)->getPools(Lease::TYPE_V4);
+        for (auto pool = pools.begin(); pool != pools.end(); ++pool) {
+            cfg_options.push_back((*pool)->getCfgOption());
+        }
+    }
+
+    const Subnet6Collection* subnets6 = cfg_subnets6_->getAll();
+    for (auto subnet = subnets6->begin(); subnet != subnets6->end();
+         ++subnet) {
+        cfg_options.push_back((*subnet)->getCfgOption());
+        const PoolCollection& pools = (*subnet)->getPools(Lease::TYPE_NA);
+        for (auto pool = pools.begin(); pool != pools.end(); ++pool) {
+            cfg_options.push_back((*pool)->getCfgOption());
+        }
+        const PoolCollection& pd_pools = (*subnet)->getPools(Lease::TYPE_PD);
+        for (auto pool = pd_pools.begin(); pool != pd_pools.end(); ++pool) {
+            cfg_options.push_back((*pool)->getCfgOption());
+        }
+    }
+
+    const SharedNetwork4Collection* networks4 = cfg_shared_networks4_->getAll();
+    for (auto network = networks4->begin(); network != networks4->end();
+         ++network) {
+        cfg_options.push_back((*network)->getCfgOption());
+    }
+
+    const SharedNetwork6Collection* networks6 = cfg_shared_networks6_->getAll();
+    for (auto network = networks6->begin(); network != networks6->end();
+         ++network) {
+        cfg_options.push_back((*network)->getCfgOption());
+    }
+
+    const ClientClassDefListPtr& classes = class_dictionary_->getClasses();
+    for (auto cclass = classes->begin(); cclass != classes->end();
+         ++cclass) {
+        cfg_options.push_back((*cclass)->getCfgOption());
+    }
+
+    for (auto cfg_option = cfg_options.begin(); cfg_option != cfg_options.end();
+         ++cfg_option) {
+        if (*cfg_option) {
+            (*cfg_option)->cacheWireData();
+            cfg_option_list_cache_->add(*cfg_option);
+        }
+    }
+}
+
 void
 SrvConfig::clearConfiguredGlobals() {
     configured_globals_ = isc::data::Element::createMap();
@@ -15,6 +15,7 @@
 #include <dhcpsrv/cfg_hosts.h>
 #include <dhcpsrv/cfg_iface.h>
 #include <dhcpsrv/cfg_option.h>
+#include <dhcpsrv/cfg_option_list_cache.h>
 #include <dhcpsrv/cfg_option_def.h>
 #include <dhcpsrv/cfg_rsoo.h>
 #include <dhcpsrv/cfg_shared_networks.h>
@@ -182,6 +183,14 @@ public:
         return (cfg_option_);
     }
 
+    /// @brief Returns pointer to the cache of options resolved for the
+    /// lists of option configurations.
+    ///
+    /// @return Pointer to the cache, filled by @ref updateOptionsCache.
+    CfgOptionListCachePtr getCfgOptionListCache() const {
+        return (cfg_option_list_cache_);
+    }
+
     /// @brief Returns pointer to non-const object holding subnets configuration
     /// for DHCPv4.
     ///
@@ -537,6 +546,16 @@ public:
     /// @ref CfgSubnets6::removeStatistics for details.
     void removeStatistics();
 
+    /// @brief Updates the caches of configured options.
+    ///
+    /// This method renders the wire format of the global, shared network,
+    /// subnet, pool and client class options so as they are not packed
+    /// for every response. It also resets the cache returned by
+    /// @ref getCfgOptionListCache and registers these option
+    /// configurations in it. It must be called whenever the options of
+    /// the configuration in use by the server are modified.
+    void updateOptionsCache();
+
     /// @brief Sets decline probation-period
     ///
     /// Probation-period is the timer, expressed, in seconds, that specifies how
@@ -589,6 +608,69 @@ public:
         return (dhcp4o6_port_);
     }
 
+    /// @brief Sets the number of threads fetching the leases of the clients
+    ///
+    /// @param threads number of lease lookup threads, 0 when the leases
+    /// are fetched by the packet processing
+    void setLeaseLookupThreads(const uint32_t threads) {
+        lease_lookup_threads_ = threads;
+    }
+
+    /// @brief Returns the number of threads fetching the leases of the
+    /// clients
+    ///
+    /// See @ref setLeaseLookupThreads for brief discussion.
+    /// @return number of lease lookup threads
+    uint32_t getLeaseLookupThreads() const {
+        return (lease_lookup_threads_);
+    }
+
+    /// @brief Sets the chunk size of the per-packet memory arenas
+    ///
+    /// @param chunk_size size in bytes, 0 when the arenas are not used
+    void setPacketArenaChunkSize(const uint32_t chunk_size) {
+        packet_arena_chunk_size_ = chunk_size;
+    }
+
+    /// @brief Returns the chunk size of the per-packet memory arenas
+    ///
+    /// See @ref setPacketArenaChunkSize for brief discussion.
+    /// @return chunk size in bytes
+    uint32_t getPacketArenaChunkSize() const {
+        return (packet_arena_chunk_size_);
+    }
+
+    /// @brief Sets the processing time above which a packet is slow
+    ///
+    /// @param threshold threshold in microseconds, 0 when the slow packets
+    /// are not reported
+    void setPacketSlowThreshold(const uint64_t threshold) {
+        packet_slow_threshold_ = threshold;
+    }
+
+    /// @brief Returns the processing time above which a packet is slow
+    ///
+    /// See @ref setPacketSlowThreshold for brief discussion.
+    /// @return threshold in microseconds
+    uint64_t getPacketSlowThreshold() const {
+        return (packet_slow_threshold_);
+    }
+
+    /// @brief Sets the interval between the rebuilds of the host filter
+    ///
+    /// @param interval interval in seconds, 0 when the filter is not used
+    void setHostFilterRebuildInterval(const uint32_t interval) {
+        host_filter_rebuild_interval_ = interval;
+    }
+
+    /// @brief Returns the interval between the rebuilds of the host filter
+    ///
+    /// See @ref setHostFilterRebuildInterval for brief discussion.
+    /// @return interval in seconds
+    uint32_t getHostFilterRebuildInterval() const {
+        return (host_filter_rebuild_interval_);
+    }
+
     /// @brief Returns pointer to the D2 client configuration
     D2ClientConfigPtr getD2ClientConfig() {
         return (d2_client_config_);
@@ -703,6 +785,10 @@ private:
     /// connected to any subnet.
     CfgOptionPtr cfg_option_;
 
+    /// @brief Pointer to the cache of options resolved for the lists of
+    /// option configurations.
+    CfgOptionListCachePtr cfg_option_list_cache_;
+
     /// @brief Pointer to subnets configuration for IPv4.
     CfgSubnets4Ptr cfg_subnets4_;
 
@@ -776,6 +862,18 @@ private:
     /// this socket is bound and connected to this port and port + 1
     uint16_t dhcp4o6_port_;
 
+    /// @brief Number of threads fetching the leases of the clients
+    uint32_t lease_lookup_threads_;
+
+    /// @brief Chunk size of the per-packet memory arenas in bytes
+    uint32_t packet_arena_chunk_size_;
+
+    /// @brief Processing time above which a packet is slow in microseconds
+    uint64_t packet_slow_threshold_;
+
+    /// @brief Interval between the rebuilds of the host filter in seconds
+    uint32_t host_filter_rebuild_interval_;
+
     /// @brief Stores D2 client configuration
     D2ClientConfigPtr d2_client_config_;
 
@@ -681,6 +681,73 @@ TEST_F(AllocEngine4Test, maxRenew4) {
     EXPECT_EQ(subnet_->getValid().getMax(), lease2->valid_lft_);
 }
 
+// This test checks that the lease renewed long before it expires is
+// returned with the remaining lifetime and not updated in the lease
+// database, and that it is updated when it is close to expire.
+TEST_F(AllocEngine4Test, reuseRenew4) {
+    boost::scoped_ptr<AllocEngine> engine;
+    ASSERT_NO_THROW(engine.reset(new AllocEngine(AllocEngine::ALLOC_ITERATIVE,
+                                                 0, false)));
+    ASSERT_TRUE(engine);
+
+    // Reuse the leases until a half of the lifetime has elapsed.
+    StatsMgr::instance().del("v4-lease-reuses");
+    subnet_->setValid(Triplet<uint32_t>(1000));
+    subnet_->setCacheThreshold(0.5);
+
+    AllocEngine::ClientContext4 ctx(subnet_, clientid_, hwaddr_, IOAddress("0.0.0.0"),
+                                    false, true, "somehost.example.com.", false);
+    ctx.query_.reset(new Pkt4(DHCPREQUEST, 1234));
+
+    Lease4Ptr lease = engine->allocateLease4(ctx);
+    ASSERT_TRUE(lease);
+
+    // The lease was allocated 100 seconds ago.
+    Lease4Ptr from_mgr = LeaseMgrFactory::instance().getLease4(lease->addr_);
+    ASSERT_TRUE(from_mgr);
+    time_t lease_cltt = time(NULL) - 100;
+    from_mgr->cltt_ = lease_cltt;
+    ASSERT_NO_THROW(LeaseMgrFactory::instance().updateLease4(from_mgr));
+
+    // The renewed lease expires at the same time as the stored lease.
+    Lease4Ptr lease2 = engine->allocateLease4(ctx);
+    ASSERT_TRUE(lease2);
+    EXPECT_TRUE(ctx.old_lease_);
+    EXPECT_GT(lease2->cltt_, lease_cltt);
+    EXPECT_GT(1000, lease2->valid_lft_);
+    EXPECT_EQ(from_mgr->getExpirationTime(), lease2->getExpirationTime());
+
+    // The lease database has not been updated.
+    from_mgr = LeaseMgrFactory::instance().getLease4(lease->addr_);
+    ASSERT_TRUE(from_mgr);
+    EXPECT_EQ(lease_cltt, from_mgr->cltt_);
+    EXPECT_EQ(1000, from_mgr->valid_lft_);
+    EXPECT_TRUE(testStatistics("v4-lease-reuses", 1));
+    EXPECT_TRUE(testStatistics("v4-lease-reuses", 1, subnet_->getID()));
+
+    // The lease changed by the renewal is updated.
+    ctx.hostname_ = "otherhost.example.com.";
+    lease2 = engine->allocateLease4(ctx);
+    ASSERT_TRUE(lease2);
+    EXPECT_EQ(1000, lease2->valid_lft_);
+    from_mgr = LeaseMgrFactory::instance().getLease4(lease->addr_);
+    ASSERT_TRUE(from_mgr);
+    detailCompareLease(lease2, from_mgr);
+
+    // The lease allocated 600 seconds ago is updated.
+    lease_cltt = time(NULL) - 600;
+    from_mgr->cltt_ = lease_cltt;
+    ASSERT_NO_THROW(LeaseMgrFactory::instance().updateLease4(from_mgr));
+    lease2 = engine->allocateLease4(ctx);
+    ASSERT_TRUE(lease2);
+    EXPECT_EQ(1000, lease2->valid_lft_);
+    from_mgr = LeaseMgrFactory::instance().getLease4(lease->addr_);
+    ASSERT_TRUE(from_mgr);
+    EXPECT_GT(from_mgr->cltt_, lease_cltt);
+    detailCompareLease(lease2, from_mgr);
+    EXPECT_TRUE(testStatistics("v4-lease-reuses", 1));
+}
+
 // This test verifies that the allocator picks addresses that belong to the
 // pool
 TEST_F(AllocEngine4Test, IterativeAllocator) {
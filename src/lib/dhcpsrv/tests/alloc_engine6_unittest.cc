@@ -1250,6 +1250,66 @@ TEST_F(AllocEngine6Test, renewExtendLeaseLifetime) {
         << "Lease lifetime was not extended, but it should";
 }
 
+// Checks that the lease extended long before it expires is returned with
+// the remaining lifetimes and not updated in the lease database.
+TEST_F(AllocEngine6Test, renewReuseLeaseLifetime) {
+    StatsMgr::instance().del("v6-ia-na-lease-reuses");
+
+    // Create a lease for the client.
+    Lease6Ptr lease(new Lease6(Lease::TYPE_NA, IOAddress("2001:db8:1::15"),
+                               duid_, iaid_, 300, 400,
+                               subnet_->getID(), HWAddrPtr(), 128));
+
+    // Allocated 100 seconds ago - a quarter of the lifetime.
+    time_t lease_cltt = time(NULL) - 100;
+    lease->cltt_ = lease_cltt;
+
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+
+    AllocEngine engine(AllocEngine::ALLOC_ITERATIVE, 100);
+    subnet_->setCacheThreshold(0.5);
+
+    // This is what the client will send in his renew message.
+    AllocEngine::HintContainer hints;
+    hints.push_back(AllocEngine::Resource(IOAddress("2001:db8:1::15"), 128));
+
+    Pkt6Ptr query(new Pkt6(DHCPV6_RENEW, 1234));
+    AllocEngine::ClientContext6 ctx(subnet_, duid_, false, false, "",
+                                    false, query);
+    ctx.currentIA().hints_ = hints;
+    ctx.currentIA().iaid_ = iaid_;
+    ctx.currentIA().type_ = Lease::TYPE_NA;
+
+    // Client should receive the lease with the remaining lifetimes.
+    Lease6Collection renewed = engine.renewLeases6(ctx);
+    ASSERT_EQ(1, renewed.size());
+    EXPECT_GT(renewed[0]->cltt_, lease_cltt);
+    EXPECT_EQ(lease->getExpirationTime(), renewed[0]->getExpirationTime());
+    EXPECT_EQ(renewed[0]->valid_lft_ - 100, renewed[0]->preferred_lft_);
+
+    // But the lease database should not be updated.
+    Lease6Ptr from_mgr =
+        LeaseMgrFactory::instance().getLease6(Lease::TYPE_NA,
+                                              IOAddress("2001:db8:1::15"));
+    ASSERT_TRUE(from_mgr);
+    EXPECT_EQ(lease_cltt, from_mgr->cltt_);
+    EXPECT_EQ(400, from_mgr->valid_lft_);
+    EXPECT_TRUE(testStatistics("v6-ia-na-lease-reuses", 1));
+    EXPECT_TRUE(testStatistics("v6-ia-na-lease-reuses", 1, subnet_->getID()));
+
+    // Allocated 300 seconds ago - the lease lifetime should be extended.
+    lease_cltt = time(NULL) - 300;
+    from_mgr->cltt_ = lease_cltt;
+    ASSERT_NO_THROW(LeaseMgrFactory::instance().updateLease6(from_mgr));
+
+    renewed = renewTest(engine, pool_, hints, true);
+    ASSERT_EQ(1, renewed.size());
+    EXPECT_GT(renewed[0]->cltt_, lease_cltt);
+    EXPECT_EQ(300, renewed[0]->preferred_lft_);
+    EXPECT_EQ(400, renewed[0]->valid_lft_);
+    EXPECT_TRUE(testStatistics("v6-ia-na-lease-reuses", 1));
+}
+
 // Checks that a renewed lease uses default lifetimes.
 TEST_F(AllocEngine6Test, defaultRenewLeaseLifetime) {
     // Create a lease for the client.
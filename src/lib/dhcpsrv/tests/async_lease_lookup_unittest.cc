@@ -0,0 +1,131 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/io_address.h>
+#include <dhcpsrv/async_lease_lookup.h>
+#include <dhcpsrv/lease_mgr_factory.h>
+#include <exceptions/exceptions.h>
+#include <gtest/gtest.h>
+
+#include <boost/bind.hpp>
+
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Test fixture for @c AsyncLeaseLookup.
+class AsyncLeaseLookupTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Creates a memfile lease backend with a lease.
+    AsyncLeaseLookupTest()
+        : clientid_(ClientId::fromText("01:02:03:04")),
+          hwaddr_(new HWAddr(std::vector<uint8_t>(6, 0x0a), HTYPE_ETHER)),
+          results_() {
+        LeaseMgrFactory::create("type=memfile universe=4 persist=false");
+        Lease4Ptr lease(new Lease4(IOAddress("192.0.2.10"), hwaddr_,
+                                   &clientid_->getClientId()[0],
+                                   clientid_->getClientId().size(),
+                                   3600, time(NULL), 1));
+        LeaseMgrFactory::instance().addLease(lease);
+    }
+
+    /// @brief Destructor.
+    virtual ~AsyncLeaseLookupTest() {
+        LeaseMgrFactory::destroy();
+    }
+
+    /// @brief Lookup completion handler.
+    ///
+    /// @param leases Leases of the client.
+    void handler(const ClientLeases4Ptr& leases) {
+        results_.push_back(leases);
+    }
+
+    /// @brief Client identifier of the lease.
+    ClientIdPtr clientid_;
+
+    /// @brief Hardware address of the lease.
+    HWAddrPtr hwaddr_;
+
+    /// @brief Leases passed to the handler.
+    std::vector<ClientLeases4Ptr> results_;
+};
+
+// This test verifies that the leases of a client are fetched.
+TEST_F(AsyncLeaseLookupTest, getClientLeases4) {
+    AsyncLeaseLookup lookup(2);
+    // The memfile backend does not benefit from the lookups.
+    EXPECT_FALSE(AsyncLeaseLookup::isSupported());
+
+    ASSERT_TRUE(lookup.getClientLeases4(clientid_, hwaddr_,
+                                        boost::bind(&AsyncLeaseLookupTest::handler,
+                                                    this, _1)));
+    HWAddrPtr unknown(new HWAddr(std::vector<uint8_t>(6, 0x0b), HTYPE_ETHER));
+    ASSERT_TRUE(lookup.getClientLeases4(ClientIdPtr(), unknown,
+                                        boost::bind(&AsyncLeaseLookupTest::handler,
+                                                    this, _1)));
+    EXPECT_EQ(2, lookup.getPending());
+
+    lookup.wait();
+    EXPECT_EQ(0, lookup.getPending());
+    ASSERT_EQ(2, results_.size());
+
+    // The lookups may complete in any order.
+    ClientLeases4Ptr known = results_[0];
+    ClientLeases4Ptr other = results_[1];
+    ASSERT_TRUE(known);
+    ASSERT_TRUE(other);
+    if (known->hwaddr_ != hwaddr_) {
+        std::swap(known, other);
+    }
+    EXPECT_EQ(clientid_, known->clientid_);
+    ASSERT_EQ(1, known->clientid_leases_.size());
+    EXPECT_EQ("192.0.2.10", known->clientid_leases_[0]->addr_.toText());
+    ASSERT_EQ(1, known->hwaddr_leases_.size());
+    EXPECT_EQ("192.0.2.10", known->hwaddr_leases_[0]->addr_.toText());
+
+    EXPECT_FALSE(other->clientid_);
+    EXPECT_TRUE(other->clientid_leases_.empty());
+    EXPECT_TRUE(other->hwaddr_leases_.empty());
+}
+
+// This test verifies that only one lookup per client can be pending and
+// that the number of pending lookups is limited.
+TEST_F(AsyncLeaseLookupTest, pendingLimits) {
+    AsyncLeaseLookup lookup(1, 2);
+    AsyncLeaseLookup::ClientLeases4Handler handler =
+        boost::bind(&AsyncLeaseLookupTest::handler, this, _1);
+
+    EXPECT_THROW(lookup.getClientLeases4(clientid_, HWAddrPtr(), handler),
+                 BadValue);
+
+    ASSERT_TRUE(lookup.getClientLeases4(clientid_, hwaddr_, handler));
+    // The client is already looked up.
+    EXPECT_FALSE(lookup.getClientLeases4(clientid_, hwaddr_, handler));
+
+    HWAddrPtr second(new HWAddr(std::vector<uint8_t>(6, 0x0b), HTYPE_ETHER));
+    HWAddrPtr third(new HWAddr(std::vector<uint8_t>(6, 0x0c), HTYPE_ETHER));
+    EXPECT_TRUE(lookup.getClientLeases4(ClientIdPtr(), second, handler));
+    // Too many pending lookups.
+    EXPECT_FALSE(lookup.getClientLeases4(ClientIdPtr(), third, handler));
+
+    // The completed lookups free their place.
+    lookup.wait();
+    EXPECT_EQ(2, results_.size());
+    EXPECT_TRUE(lookup.getClientLeases4(clientid_, hwaddr_, handler));
+    lookup.wait();
+    EXPECT_EQ(3, results_.size());
+}
+
+} // end of anonymous namespace
@@ -0,0 +1,112 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcp/iface_mgr.h>
+#include <dhcpsrv/cb_notify_fifo.h>
+#include <exceptions/exceptions.h>
+#include <boost/bind.hpp>
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace isc;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Test fixture for @c CBNotifyFifo.
+class CBNotifyFifoTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    CBNotifyFifoTest()
+        : path_(TEST_DATA_BUILDDIR "/cb-notify.fifo"), count_(0) {
+        static_cast<void>(remove(path_.c_str()));
+    }
+
+    /// @brief Destructor.
+    virtual ~CBNotifyFifoTest() {
+        fifo_.close();
+        static_cast<void>(remove(path_.c_str()));
+    }
+
+    /// @brief Notification callback counting the invocations.
+    void notified() {
+        ++count_;
+    }
+
+    /// @brief Writes to the pipe as a notifying tool would.
+    ///
+    /// @param data Written data.
+    void notify(const std::string& data) {
+        int fd = open(path_.c_str(), O_WRONLY | O_NONBLOCK);
+        ASSERT_GE(fd, 0);
+        ASSERT_EQ(static_cast<ssize_t>(data.size()),
+                  write(fd, data.c_str(), data.size()));
+        close(fd);
+    }
+
+    /// @brief Path of the pipe.
+    std::string path_;
+
+    /// @brief Number of the callback invocations.
+    int count_;
+
+    /// @brief Tested pipe.
+    CBNotifyFifo fifo_;
+};
+
+// This test verifies that the pending notifications are coalesced into
+// one callback invocation driven by the interface manager.
+TEST_F(CBNotifyFifoTest, notify) {
+    ASSERT_NO_THROW(fifo_.open(path_, boost::bind(&CBNotifyFifoTest::notified,
+                                                  this)));
+    EXPECT_TRUE(fifo_.isOpen());
+
+    // The pipe was created.
+    struct stat st;
+    ASSERT_EQ(0, stat(path_.c_str(), &st));
+    EXPECT_TRUE(S_ISFIFO(st.st_mode));
+
+    // Nothing happens without notification.
+    IfaceMgr::instance().receive4(0, 0);
+    EXPECT_EQ(0, count_);
+
+    notify("1\n");
+    notify("2\n");
+    IfaceMgr::instance().receive4(0, 0);
+    EXPECT_EQ(1, count_);
+
+    // The pipe was drained and the notifier closing it does not make
+    // the pipe readable.
+    IfaceMgr::instance().receive4(0, 0);
+    EXPECT_EQ(1, count_);
+
+    notify("3\n");
+    IfaceMgr::instance().receive4(0, 0);
+    EXPECT_EQ(2, count_);
+
+    // No notification is received after closing.
+    fifo_.close();
+    EXPECT_FALSE(fifo_.isOpen());
+    IfaceMgr::instance().receive4(0, 0);
+    EXPECT_EQ(2, count_);
+}
+
+// This test verifies that a file which is not a pipe is rejected.
+TEST_F(CBNotifyFifoTest, notFifo) {
+    FILE* f = fopen(path_.c_str(), "w");
+    ASSERT_TRUE(f);
+    fclose(f);
+    EXPECT_THROW(fifo_.open(path_, CBNotifyFifo::Callback()), Unexpected);
+    EXPECT_FALSE(fifo_.isOpen());
+}
+
+} // end of anonymous namespace
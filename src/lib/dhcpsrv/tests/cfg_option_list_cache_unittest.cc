@@ -0,0 +1,188 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcp/option.h>
+#include <dhcp/option_space.h>
+#include <dhcpsrv/cfg_option.h>
+#include <dhcpsrv/cfg_option_list_cache.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace isc;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Test fixture class for @c CfgOptionListCache.
+class CfgOptionListCacheTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Creates two option configurations: the subnet one holding
+    /// options 1 and 2 and the global one holding options 2 and 3,
+    /// where option 3 is persistent.
+    CfgOptionListCacheTest()
+        : subnet_(new CfgOption()), global_(new CfgOption()),
+          option1_(new Option(Option::V4, 1)),
+          option2_(new Option(Option::V4, 2)),
+          option2_global_(new Option(Option::V4, 2)),
+          option3_(new Option(Option::V4, 3)) {
+        subnet_->add(option1_, false, DHCP4_OPTION_SPACE);
+        subnet_->add(option2_, false, DHCP4_OPTION_SPACE);
+        global_->add(option2_global_, false, DHCP4_OPTION_SPACE);
+        global_->add(option3_, true, DHCP4_OPTION_SPACE);
+    }
+
+    /// @brief Subnet level option configuration.
+    CfgOptionPtr subnet_;
+
+    /// @brief Global option configuration.
+    CfgOptionPtr global_;
+
+    /// @brief Options used in the tests.
+    OptionPtr option1_;
+    OptionPtr option2_;
+    OptionPtr option2_global_;
+    OptionPtr option3_;
+};
+
+// This test verifies that the options are resolved in the order of
+// precedence of the option configurations.
+TEST_F(CfgOptionListCacheTest, resolve) {
+    CfgOptionList co_list;
+    co_list.push_back(subnet_);
+    co_list.push_back(global_);
+
+    ResolvedCfgOption resolved(co_list, DHCP4_OPTION_SPACE);
+    EXPECT_EQ(option1_, resolved.get(1));
+    EXPECT_EQ(option2_, resolved.get(2));
+    EXPECT_EQ(option3_, resolved.get(3));
+    EXPECT_FALSE(resolved.get(4));
+
+    ASSERT_EQ(1, resolved.getPersistentCodes().size());
+    EXPECT_EQ(3, resolved.getPersistentCodes()[0]);
+
+    // Options from other spaces are not taken.
+    ResolvedCfgOption resolved6(co_list, DHCP6_OPTION_SPACE);
+    EXPECT_FALSE(resolved6.get(1));
+    EXPECT_TRUE(resolved6.getPersistentCodes().empty());
+}
+
+// This test verifies that the resolved options are cached per list of
+// option configurations.
+TEST_F(CfgOptionListCacheTest, cache) {
+    CfgOptionListCache cache;
+    cache.add(subnet_);
+    cache.add(global_);
+
+    CfgOptionList co_list;
+    co_list.push_back(subnet_);
+    co_list.push_back(global_);
+
+    ConstResolvedCfgOptionPtr resolved = cache.get(co_list, DHCP4_OPTION_SPACE);
+    ASSERT_TRUE(resolved);
+    EXPECT_EQ(option2_, resolved->get(2));
+    EXPECT_EQ(1, cache.size());
+
+    // The same list yields the same object.
+    EXPECT_EQ(resolved, cache.get(co_list, DHCP4_OPTION_SPACE));
+    EXPECT_EQ(1, cache.size());
+
+    // The reversed list is cached separately.
+    CfgOptionList reversed(co_list.rbegin(), co_list.rend());
+    ConstResolvedCfgOptionPtr resolved_reversed =
+        cache.get(reversed, DHCP4_OPTION_SPACE);
+    ASSERT_TRUE(resolved_reversed);
+    EXPECT_EQ(option2_global_, resolved_reversed->get(2));
+    EXPECT_EQ(2, cache.size());
+
+    // The list including an option configuration not added to the cache,
+    // e.g. host reservation options, is not cached.
+    CfgOptionList host_list(co_list);
+    host_list.push_front(CfgOptionPtr(new CfgOption()));
+    EXPECT_FALSE(cache.get(host_list, DHCP4_OPTION_SPACE));
+    EXPECT_EQ(2, cache.size());
+
+    cache.clear();
+    EXPECT_EQ(0, cache.size());
+    EXPECT_FALSE(cache.get(co_list, DHCP4_OPTION_SPACE));
+}
+
+// This test verifies that the cached options are resolved again when
+// any of the option configurations in the list is modified.
+TEST_F(CfgOptionListCacheTest, modified) {
+    CfgOptionListCache cache;
+    cache.add(subnet_);
+    cache.add(global_);
+
+    CfgOptionList co_list;
+    co_list.push_back(subnet_);
+    co_list.push_back(global_);
+
+    ConstResolvedCfgOptionPtr resolved = cache.get(co_list, DHCP4_OPTION_SPACE);
+    ASSERT_TRUE(resolved);
+    EXPECT_EQ(option2_, resolved->get(2));
+
+    // Delete the option from the subnet: the global one is used instead.
+    EXPECT_EQ(1, subnet_->del(DHCP4_OPTION_SPACE, 2));
+    resolved = cache.get(co_list, DHCP4_OPTION_SPACE);
+    ASSERT_TRUE(resolved);
+    EXPECT_EQ(option2_global_, resolved->get(2));
+    EXPECT_EQ(1, cache.size());
+
+    // Add a new option to the global configuration.
+    OptionPtr option4(new Option(Option::V4, 4));
+    global_->add(option4, true, DHCP4_OPTION_SPACE);
+    resolved = cache.get(co_list, DHCP4_OPTION_SPACE);
+    ASSERT_TRUE(resolved);
+    EXPECT_EQ(option4, resolved->get(4));
+    EXPECT_EQ(2, resolved->getPersistentCodes().size());
+    EXPECT_EQ(1, cache.size());
+}
+
+// This test verifies that the number of cached lists is limited.
+TEST_F(CfgOptionListCacheTest, maxSize) {
+    CfgOptionListCache cache(1);
+    cache.add(subnet_);
+    cache.add(global_);
+
+    CfgOptionList co_list;
+    co_list.push_back(subnet_);
+    co_list.push_back(global_);
+    ConstResolvedCfgOptionPtr resolved = cache.get(co_list, DHCP4_OPTION_SPACE);
+    ASSERT_TRUE(resolved);
+    EXPECT_EQ(1, cache.size());
+
+    // The options are still resolved for other lists but not cached.
+    CfgOptionList reversed(co_list.rbegin(), co_list.rend());
+    ConstResolvedCfgOptionPtr resolved_reversed =
+        cache.get(reversed, DHCP4_OPTION_SPACE);
+    ASSERT_TRUE(resolved_reversed);
+    EXPECT_EQ(option2_global_, resolved_reversed->get(2));
+    EXPECT_EQ(1, cache.size());
+    EXPECT_NE(resolved_reversed, cache.get(reversed, DHCP4_OPTION_SPACE));
+
+    // The cached list is still returned.
+    EXPECT_EQ(resolved, cache.get(co_list, DHCP4_OPTION_SPACE));
+}
+
+// This test verifies that the option configuration renders and discards
+// the wire format of the options.
+TEST_F(CfgOptionListCacheTest, wireData) {
+    EXPECT_FALSE(option1_->hasWireData());
+    subnet_->cacheWireData();
+    EXPECT_TRUE(option1_->hasWireData());
+    EXPECT_TRUE(option2_->hasWireData());
+    EXPECT_FALSE(option3_->hasWireData());
+
+    subnet_->clearWireData();
+    EXPECT_FALSE(option1_->hasWireData());
+    EXPECT_FALSE(option2_->hasWireData());
+}
+
+} // end of anonymous namespace
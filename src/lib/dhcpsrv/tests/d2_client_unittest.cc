@@ -1326,4 +1326,26 @@ TEST(D2ClientMgr, sanitizeFqdnV6) {
     }
 }
 
+/// @brief Checks that the manager accepts the binary NCR format.
+TEST(D2ClientMgr, binaryFormatConfig) {
+    D2ClientMgrPtr d2_client_mgr;
+    ASSERT_NO_THROW(d2_client_mgr.reset(new D2ClientMgr()));
+
+    // Create a new, enabled config sending the binary format.
+    D2ClientConfigPtr new_cfg;
+    ASSERT_NO_THROW(new_cfg.reset(new D2ClientConfig(true,
+                                  isc::asiolink::IOAddress("127.0.0.1"), 477,
+                                  isc::asiolink::IOAddress("127.0.0.1"), 478,
+                                  1024,
+                                  dhcp_ddns::NCR_UDP, dhcp_ddns::FMT_BINARY,
+                                  true, true, D2ClientConfig::RCM_WHEN_PRESENT,
+                                  "pre-fix", "suf-fix", "", "")));
+
+    // Verify that it is used.
+    ASSERT_NO_THROW(d2_client_mgr->setD2ClientConfig(new_cfg));
+    D2ClientConfigPtr updated_config = d2_client_mgr->getD2ClientConfig();
+    ASSERT_TRUE(updated_config);
+    EXPECT_EQ(dhcp_ddns::FMT_BINARY, updated_config->getNcrFormat());
+}
+
 } // end of anonymous namespace
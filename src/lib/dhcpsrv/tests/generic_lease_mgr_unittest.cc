@@ -3127,6 +3127,67 @@ GenericLeaseMgrTest::checkQueryAgainstRowSet(const LeaseStatsQueryPtr& query,
     ASSERT_EQ(rows_matched, expected_rows.size()) << "rows mismatched";
 }
 
+void
+GenericLeaseMgrTest::testFindFreeAddresses4() {
+    ASSERT_TRUE(lmptr_->canFindFreeAddresses4());
+
+    // Add leases for the first, second and fourth address of the range.
+    std::vector<std::string> used = { "192.0.2.10", "192.0.2.11", "192.0.2.13" };
+    for (auto address : used) {
+        Lease4Ptr lease = initializeLease4(straddress4_[1]);
+        lease->addr_ = IOAddress(address);
+        ASSERT_TRUE(lmptr_->addLease(lease));
+    }
+
+    // The free addresses follow the leases.
+    std::vector<IOAddress> free_addresses =
+        lmptr_->findFreeAddresses4(IOAddress("192.0.2.10"),
+                                   IOAddress("192.0.2.20"), 10);
+    ASSERT_EQ(2, free_addresses.size());
+    EXPECT_EQ("192.0.2.12", free_addresses[0].toText());
+    EXPECT_EQ("192.0.2.14", free_addresses[1].toText());
+
+    // The number of returned addresses is bounded.
+    free_addresses = lmptr_->findFreeAddresses4(IOAddress("192.0.2.10"),
+                                                IOAddress("192.0.2.20"), 1);
+    ASSERT_EQ(1, free_addresses.size());
+    EXPECT_EQ("192.0.2.12", free_addresses[0].toText());
+
+    // The range may start with a free address.
+    free_addresses = lmptr_->findFreeAddresses4(IOAddress("192.0.2.9"),
+                                                IOAddress("192.0.2.20"), 1);
+    ASSERT_EQ(1, free_addresses.size());
+    EXPECT_EQ("192.0.2.9", free_addresses[0].toText());
+
+    // The addresses after the last one of the range are not returned.
+    free_addresses = lmptr_->findFreeAddresses4(IOAddress("192.0.2.10"),
+                                                IOAddress("192.0.2.13"), 10);
+    ASSERT_EQ(1, free_addresses.size());
+    EXPECT_EQ("192.0.2.12", free_addresses[0].toText());
+
+    // A declined lease makes its address not free.
+    Lease4Ptr lease = initializeLease4(straddress4_[2]);
+    lease->addr_ = IOAddress("192.0.2.12");
+    lease->decline(100);
+    ASSERT_TRUE(lmptr_->addLease(lease));
+    free_addresses = lmptr_->findFreeAddresses4(IOAddress("192.0.2.10"),
+                                                IOAddress("192.0.2.13"), 10);
+    EXPECT_TRUE(free_addresses.empty());
+
+    // A reclaimed lease makes its address free, once.
+    lease = lmptr_->getLease4(IOAddress("192.0.2.11"));
+    ASSERT_TRUE(lease);
+    lease->state_ = Lease::STATE_EXPIRED_RECLAIMED;
+    ASSERT_NO_THROW(lmptr_->updateLease4(lease));
+    free_addresses = lmptr_->findFreeAddresses4(IOAddress("192.0.2.10"),
+                                                IOAddress("192.0.2.13"), 10);
+    ASSERT_EQ(1, free_addresses.size());
+    EXPECT_EQ("192.0.2.11", free_addresses[0].toText());
+
+    // Nothing is added by the search.
+    EXPECT_FALSE(lmptr_->getLease4(IOAddress("192.0.2.14")));
+}
+
 void
 GenericLeaseMgrTest::testLeaseStatsQuery4() {
     // Create three subnets.
@@ -405,6 +405,13 @@ public:
     /// attempts to delete them, one subnet at a time.
     void testWipeLeases6();
 
+    /// @brief Checks that the backend finds the free IPv4 addresses
+    /// of a range.
+    ///
+    /// It is only relevant to the backends for which
+    /// @c LeaseMgr::canFindFreeAddresses4 returns true.
+    void testFindFreeAddresses4();
+
     /// @brief Checks operation of v4 LeaseStatsQuery variants
     ///
     /// It creates three subnets with leasese in various states in
@@ -11,7 +11,11 @@
 #include <dhcpsrv/host.h>
 #include <dhcpsrv/host_data_source_factory.h>
 #include <dhcpsrv/host_mgr.h>
+#include <dhcpsrv/srv_config.h>
+#include <dhcpsrv/testutils/host_data_source_utils.h>
+#include <dhcpsrv/testutils/memory_host_data_source.h>
 #include <dhcpsrv/tests/test_utils.h>
+#include <stats/stats_mgr.h>
 
 #if defined HAVE_MYSQL
 #include <mysql/testutils/mysql_schema.h>
@@ -33,6 +37,8 @@ using namespace isc::db;
 using namespace isc::dhcp;
 using namespace isc::dhcp::test;
 using namespace isc::asiolink;
+using namespace isc::stats;
+using namespace isc::util;
 
 namespace {
 
@@ -853,6 +859,172 @@ TEST_F(HostMgrTest, addNoDataSource) {
     EXPECT_THROW(HostMgr::instance().add(host), NoHostDataSourceManager);
 }
 
+/// @brief Test fixture for the host filter of the host manager.
+class HostMgrFilterTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    HostMgrFilterTest() {
+        HostMgr::create();
+        StatsMgr::instance().removeAll();
+
+        memptr_.reset(new MemHostDataSource());
+        auto testFactory = [this](const DatabaseConnection::ParameterMap&) {
+            return (memptr_);
+        };
+        HostDataSourceFactory::registerFactory("test", testFactory);
+        HostMgr::addBackend("type=test");
+    }
+
+    /// @brief Destructor.
+    virtual ~HostMgrFilterTest() {
+        HostDataSourceFactory::deregisterFactory("test");
+        StatsMgr::instance().removeAll();
+    }
+
+    /// @brief Returns the value of a statistic or 0 when it doesn't exist.
+    ///
+    /// @param name Name of the statistic.
+    int64_t getStat(const std::string& name) const {
+        ObservationPtr stat = StatsMgr::instance().getObservation(name);
+        return (stat ? stat->getInteger().first : 0);
+    }
+
+    /// @brief Test host data source.
+    MemHostDataSourcePtr memptr_;
+};
+
+// Check that the host filter skips the lookups of unknown identifiers
+// and passes the lookups of the reserved ones.
+TEST_F(HostMgrFilterTest, get4) {
+    HostPtr host = HostDataSourceUtils::initializeHost4("192.0.2.1",
+                                                        Host::IDENT_HWADDR);
+    ASSERT_TRUE(host);
+    ASSERT_NO_THROW(memptr_->add(host));
+
+    // Not reserved host, only its identifier is used.
+    HostPtr other = HostDataSourceUtils::initializeHost4("192.0.2.2",
+                                                         Host::IDENT_HWADDR);
+    ASSERT_TRUE(other);
+
+    // Without the filter all lookups go to the backend.
+    EXPECT_FALSE(HostMgr::instance().getHostFilter());
+    EXPECT_FALSE(HostMgr::instance().get4(host->getIPv4SubnetID(),
+                                          other->getIdentifierType(),
+                                          &other->getIdentifier()[0],
+                                          other->getIdentifier().size()));
+    EXPECT_EQ(0, getStat("host-filter-skipped-lookups"));
+
+    // Build the filter for the subnet of the reservation.
+    SrvConfigPtr cfg(new SrvConfig());
+    Subnet4Ptr subnet(new Subnet4(IOAddress("192.0.2.0"), 24, 1, 2, 3,
+                                  host->getIPv4SubnetID()));
+    cfg->getCfgSubnets4()->add(subnet);
+    ASSERT_NO_THROW(HostMgr::instance().rebuildHostFilter(cfg));
+    ASSERT_TRUE(HostMgr::instance().getHostFilter());
+    EXPECT_EQ(1, HostMgr::instance().getHostFilter()->getCount());
+
+    // The reserved host is still found.
+    ConstHostPtr got = HostMgr::instance().get4(host->getIPv4SubnetID(),
+                                                host->getIdentifierType(),
+                                                &host->getIdentifier()[0],
+                                                host->getIdentifier().size());
+    ASSERT_TRUE(got);
+    HostDataSourceUtils::compareHosts(got, host);
+    EXPECT_EQ(1, getStat("host-filter-passed-lookups"));
+
+    // The unknown identifier is filtered out.
+    EXPECT_FALSE(HostMgr::instance().get4(host->getIPv4SubnetID(),
+                                          other->getIdentifierType(),
+                                          &other->getIdentifier()[0],
+                                          other->getIdentifier().size()));
+    EXPECT_EQ(1, getStat("host-filter-skipped-lookups"));
+
+    // The host added through the host manager is added to the filter.
+    other->setIPv4SubnetID(host->getIPv4SubnetID());
+    ASSERT_NO_THROW(HostMgr::instance().add(other));
+    EXPECT_EQ(2, HostMgr::instance().getHostFilter()->getCount());
+    got = HostMgr::instance().get4(host->getIPv4SubnetID(),
+                                   other->getIdentifierType(),
+                                   &other->getIdentifier()[0],
+                                   other->getIdentifier().size());
+    ASSERT_TRUE(got);
+    EXPECT_EQ(2, getStat("host-filter-passed-lookups"));
+    EXPECT_EQ(1, getStat("host-filter-skipped-lookups"));
+
+    // Adding a backend drops the filter.
+    HostMgr::addBackend("type=test");
+    EXPECT_FALSE(HostMgr::instance().getHostFilter());
+}
+
+// Check that the host filter is rebuilt by steps and replaced only when
+// the rebuild completes.
+TEST_F(HostMgrFilterTest, incrementalRebuild) {
+    HostPtr host = HostDataSourceUtils::initializeHost4("192.0.2.1",
+                                                        Host::IDENT_HWADDR);
+    ASSERT_TRUE(host);
+    ASSERT_NO_THROW(memptr_->add(host));
+
+    SrvConfigPtr cfg(new SrvConfig());
+    Subnet4Ptr subnet(new Subnet4(IOAddress("192.0.2.0"), 24, 1, 2, 3,
+                                  host->getIPv4SubnetID()));
+    cfg->getCfgSubnets4()->add(subnet);
+    ASSERT_NO_THROW(HostMgr::instance().rebuildHostFilter(cfg));
+    BloomFilterPtr filter = HostMgr::instance().getHostFilter();
+    ASSERT_TRUE(filter);
+    EXPECT_EQ(1, filter->getCount());
+    EXPECT_FALSE(HostMgr::instance().isHostFilterRebuilding());
+
+    // A host added to the backend by other means is not in the filter.
+    HostPtr other = HostDataSourceUtils::initializeHost4("192.0.2.2",
+                                                         Host::IDENT_HWADDR);
+    ASSERT_TRUE(other);
+    other->setIPv4SubnetID(host->getIPv4SubnetID());
+    ASSERT_NO_THROW(memptr_->add(other));
+
+    // The current filter is used while the new one is being built.
+    HostMgr::instance().startHostFilterRebuild(cfg);
+    EXPECT_TRUE(HostMgr::instance().isHostFilterRebuilding());
+    EXPECT_FALSE(HostMgr::instance().rebuildHostFilterStep());
+    EXPECT_EQ(filter, HostMgr::instance().getHostFilter());
+    EXPECT_FALSE(HostMgr::instance().get4(other->getIPv4SubnetID(),
+                                          other->getIdentifierType(),
+                                          &other->getIdentifier()[0],
+                                          other->getIdentifier().size()));
+
+    // A host added through the host manager goes to both filters.
+    HostPtr third = HostDataSourceUtils::initializeHost4("192.0.2.3",
+                                                         Host::IDENT_HWADDR);
+    ASSERT_TRUE(third);
+    third->setIPv4SubnetID(host->getIPv4SubnetID());
+    ASSERT_NO_THROW(HostMgr::instance().add(third));
+    EXPECT_EQ(2, filter->getCount());
+
+    // Run the remaining steps: the new filter replaces the old one.
+    size_t steps = 1;
+    while (!HostMgr::instance().rebuildHostFilterStep()) {
+        ASSERT_GT(100, ++steps);
+    }
+    EXPECT_LT(1, steps);
+    EXPECT_FALSE(HostMgr::instance().isHostFilterRebuilding());
+    BloomFilterPtr rebuilt = HostMgr::instance().getHostFilter();
+    ASSERT_TRUE(rebuilt);
+    EXPECT_NE(filter, rebuilt);
+    // The third host is both retrieved and added during the rebuild.
+    EXPECT_LE(3, rebuilt->getCount());
+    EXPECT_TRUE(HostMgr::instance().get4(other->getIPv4SubnetID(),
+                                         other->getIdentifierType(),
+                                         &other->getIdentifier()[0],
+                                         other->getIdentifier().size()));
+
+    // Adding a backend abandons the rebuild in progress.
+    HostMgr::instance().startHostFilterRebuild(cfg);
+    HostMgr::addBackend("type=test");
+    EXPECT_FALSE(HostMgr::instance().isHostFilterRebuilding());
+    EXPECT_TRUE(HostMgr::instance().rebuildHostFilterStep());
+    EXPECT_FALSE(HostMgr::instance().getHostFilter());
+}
+
 class HostMgrDbLostCallbackTest : public ::testing::Test {
 public:
     HostMgrDbLostCallbackTest() : callback_called_(false) {};
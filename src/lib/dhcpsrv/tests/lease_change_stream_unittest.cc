@@ -0,0 +1,154 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/io_address.h>
+#include <dhcpsrv/lease_change_stream.h>
+#include <dhcpsrv/lease_mgr_factory.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::data;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Test fixture for @c LeaseChangeStream.
+class LeaseChangeStreamTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Remembers the last sequence number of the stream which is shared
+    /// by all tests.
+    LeaseChangeStreamTest()
+        : stream_(LeaseChangeStream::instance()),
+          base_(stream_.getLastSequence()) {
+        stream_.setCapacity(0);
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Disables the stream.
+    virtual ~LeaseChangeStreamTest() {
+        stream_.setCapacity(0);
+        LeaseMgrFactory::destroy();
+    }
+
+    /// @brief Creates an IPv4 lease.
+    ///
+    /// @param address Address of the lease.
+    /// @return Pointer to the lease.
+    Lease4Ptr createLease4(const std::string& address) {
+        HWAddrPtr hwaddr(new HWAddr(std::vector<uint8_t>(6, 0x0a), HTYPE_ETHER));
+        return (Lease4Ptr(new Lease4(IOAddress(address), hwaddr, 0, 0,
+                                     3600, time(NULL), 1)));
+    }
+
+    /// @brief The stream.
+    LeaseChangeStream& stream_;
+
+    /// @brief Last sequence number when the test started.
+    uint64_t base_;
+};
+
+// This test verifies that the changes are only published when the stream
+// is enabled and that the oldest changes are discarded.
+TEST_F(LeaseChangeStreamTest, publish) {
+    EXPECT_FALSE(stream_.enabled());
+    stream_.publish(LeaseChange::ADD, createLease4("192.0.2.1"));
+    EXPECT_EQ(base_, stream_.getLastSequence());
+
+    stream_.setCapacity(3);
+    EXPECT_TRUE(stream_.enabled());
+    EXPECT_EQ(3, stream_.getCapacity());
+
+    Lease4Ptr lease = createLease4("192.0.2.1");
+    stream_.publish(LeaseChange::ADD, lease);
+    // The published lease is a copy.
+    lease->hostname_ = "changed";
+    stream_.publish(LeaseChange::UPDATE, lease);
+    stream_.publishDelete(IOAddress("192.0.2.1"));
+    stream_.publish(LeaseChange::ADD, createLease4("192.0.2.2"));
+    EXPECT_EQ(base_ + 4, stream_.getLastSequence());
+
+    // The first change was discarded.
+    std::vector<LeaseChange> changes;
+    EXPECT_FALSE(stream_.getChanges(base_, 10, changes));
+    EXPECT_TRUE(changes.empty());
+
+    ASSERT_TRUE(stream_.getChanges(base_ + 1, 10, changes));
+    ASSERT_EQ(3, changes.size());
+    EXPECT_EQ(base_ + 2, changes[0].sequence_);
+    EXPECT_EQ(LeaseChange::UPDATE, changes[0].type_);
+    ASSERT_TRUE(changes[0].lease_);
+    EXPECT_EQ("changed", changes[0].lease_->hostname_);
+    EXPECT_EQ(LeaseChange::DELETE, changes[1].type_);
+    EXPECT_EQ("192.0.2.1", changes[1].addr_.toText());
+    EXPECT_FALSE(changes[1].lease_);
+    EXPECT_EQ(LeaseChange::ADD, changes[2].type_);
+    EXPECT_EQ("192.0.2.2", changes[2].addr_.toText());
+
+    // The number of returned changes is limited.
+    changes.clear();
+    ASSERT_TRUE(stream_.getChanges(base_ + 2, 1, changes));
+    ASSERT_EQ(1, changes.size());
+    EXPECT_EQ(base_ + 3, changes[0].sequence_);
+
+    // No change follows the last one.
+    changes.clear();
+    ASSERT_TRUE(stream_.getChanges(base_ + 4, 10, changes));
+    EXPECT_TRUE(changes.empty());
+}
+
+// This test verifies the JSON format of the changes.
+TEST_F(LeaseChangeStreamTest, toElement) {
+    LeaseChange change = { 5, LeaseChange::DELETE, IOAddress("192.0.2.1"),
+                           LeasePtr(), 1000 };
+    ElementPtr json = change.toElement();
+    ASSERT_TRUE(json);
+    EXPECT_EQ("{ \"ip-address\": \"192.0.2.1\", \"sequence\": 5, "
+              "\"timestamp\": 1000, \"type\": \"delete\" }", json->str());
+
+    change.type_ = LeaseChange::ADD;
+    change.lease_ = createLease4("192.0.2.1");
+    json = change.toElement();
+    ASSERT_TRUE(json);
+    EXPECT_EQ("add", json->get("type")->stringValue());
+    ASSERT_TRUE(json->get("lease"));
+    EXPECT_EQ("192.0.2.1", json->get("lease")->get("ip-address")->stringValue());
+}
+
+// This test verifies that the memfile backend publishes the changes.
+TEST_F(LeaseChangeStreamTest, memfile) {
+    stream_.setCapacity(10);
+    LeaseMgrFactory::create("type=memfile universe=4 persist=false");
+    LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
+
+    Lease4Ptr lease = createLease4("192.0.2.1");
+    ASSERT_TRUE(lease_mgr.addLease(lease));
+    // A failed addition is not published.
+    ASSERT_FALSE(lease_mgr.addLease(lease));
+    lease->state_ = Lease::STATE_DECLINED;
+    ASSERT_NO_THROW(lease_mgr.updateLease4(lease));
+    ASSERT_TRUE(lease_mgr.deleteLease(lease->addr_));
+    ASSERT_FALSE(lease_mgr.deleteLease(lease->addr_));
+
+    std::vector<LeaseChange> changes;
+    ASSERT_TRUE(stream_.getChanges(base_, 10, changes));
+    ASSERT_EQ(3, changes.size());
+    EXPECT_EQ(LeaseChange::ADD, changes[0].type_);
+    EXPECT_EQ(LeaseChange::UPDATE, changes[1].type_);
+    ASSERT_TRUE(changes[1].lease_);
+    EXPECT_EQ(Lease::STATE_DECLINED, changes[1].lease_->state_);
+    EXPECT_EQ(LeaseChange::DELETE, changes[2].type_);
+    EXPECT_EQ("192.0.2.1", changes[2].addr_.toText());
+}
+
+} // end of anonymous namespace
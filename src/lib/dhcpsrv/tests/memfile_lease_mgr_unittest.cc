@@ -1957,5 +1957,57 @@ TEST_F(MemfileLeaseMgrTest, leaseStatsQuery6) {
     testLeaseStatsQuery6();
 }
 
+// Verifies that the IPv4 lease statistics follow the lease changes and
+// are restored when the leases are loaded from the lease file.
+TEST_F(MemfileLeaseMgrTest, leaseStatsCounters4) {
+    startBackend(V4);
+
+    // Returns the number of leases of the subnet in the given state.
+    auto count = [this](const SubnetID& subnet_id, const uint32_t state) {
+        LeaseStatsQueryPtr query = lmptr_->startSubnetLeaseStatsQuery4(subnet_id);
+        LeaseStatsRow row;
+        while (query->getNextRow(row)) {
+            if (row.lease_state_ == state) {
+                return (row.state_count_);
+            }
+        }
+        return (static_cast<int64_t>(0));
+    };
+
+    std::vector<Lease4Ptr> leases = createLeases4();
+    for (size_t i = 0; i < 3; ++i) {
+        leases[i]->subnet_id_ = 1;
+        ASSERT_TRUE(lmptr_->addLease(leases[i]));
+    }
+    EXPECT_EQ(3, count(1, Lease::STATE_DEFAULT));
+
+    // Changing the caller's lease has no effect until it is updated.
+    leases[0]->state_ = Lease::STATE_DECLINED;
+    EXPECT_EQ(3, count(1, Lease::STATE_DEFAULT));
+    ASSERT_NO_THROW(lmptr_->updateLease4(leases[0]));
+    EXPECT_EQ(2, count(1, Lease::STATE_DEFAULT));
+    EXPECT_EQ(1, count(1, Lease::STATE_DECLINED));
+
+    // Moving a lease to another subnet.
+    leases[1]->subnet_id_ = 2;
+    ASSERT_NO_THROW(lmptr_->updateLease4(leases[1]));
+    EXPECT_EQ(1, count(1, Lease::STATE_DEFAULT));
+    EXPECT_EQ(1, count(2, Lease::STATE_DEFAULT));
+
+    // Reclaimed leases are not counted.
+    leases[2]->state_ = Lease::STATE_EXPIRED_RECLAIMED;
+    ASSERT_NO_THROW(lmptr_->updateLease4(leases[2]));
+    EXPECT_EQ(0, count(1, Lease::STATE_DEFAULT));
+
+    ASSERT_TRUE(lmptr_->deleteLease(leases[0]->addr_));
+    EXPECT_EQ(0, count(1, Lease::STATE_DECLINED));
+
+    // The counters are rebuilt from the lease file.
+    reopen(V4);
+    EXPECT_EQ(0, count(1, Lease::STATE_DEFAULT));
+    EXPECT_EQ(0, count(1, Lease::STATE_DECLINED));
+    EXPECT_EQ(1, count(2, Lease::STATE_DEFAULT));
+}
+
 
 }  // namespace
@@ -568,6 +568,11 @@ TEST_F(MySqlLeaseMgrTest, DISABLED_wipeLeases6) {
     testWipeLeases6();
 }
 
+/// @brief Tests that the free IPv4 addresses of a range are found.
+TEST_F(MySqlLeaseMgrTest, findFreeAddresses4) {
+    testFindFreeAddresses4();
+}
+
 /// @brief Test fixture class for validating @c LeaseMgr using
 /// MySQL as back end and MySQL connectivity loss.
 class MySQLLeaseMgrDbLostCallbackTest : public LeaseMgrDbLostCallbackTest {
@@ -169,6 +169,7 @@ TEST_F(NetworkTest, inheritanceSupport4) {
     globals_->set("calculate-tee-times", Element::create(false));
     globals_->set("t1-percent", Element::create(0.75));
     globals_->set("t2-percent", Element::create(0.6));
+    globals_->set("cache-threshold", Element::create(0.25));
     globals_->set("match-client-id", Element::create(true));
     globals_->set("authoritative", Element::create(false));
     globals_->set("next-server", Element::create("192.0.2.3"));
@@ -229,6 +230,12 @@ TEST_F(NetworkTest, inheritanceSupport4) {
                                             &Network::setT2Percent,
                                             0.3, 0.6);
     }
+    {
+        SCOPED_TRACE("cache-threshold");
+        testNetworkInheritance<TestNetwork>(&Network::getCacheThreshold,
+                                            &Network::setCacheThreshold,
+                                            0.5, 0.25);
+    }
     {
         SCOPED_TRACE("match-client-id");
         testNetworkInheritance<TestNetwork4>(&Network4::getMatchClientId,
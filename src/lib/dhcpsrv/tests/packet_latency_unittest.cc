@@ -0,0 +1,114 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/pkt4.h>
+#include <dhcpsrv/packet_latency.h>
+#include <exceptions/exceptions.h>
+#include <stats/stats_mgr.h>
+#include <gtest/gtest.h>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+using namespace isc;
+using namespace isc::dhcp;
+using namespace isc::stats;
+using namespace isc::util;
+using namespace boost::posix_time;
+
+namespace {
+
+/// @brief Test fixture for @c PacketLatency.
+class PacketLatencyTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Resets the latency histograms.
+    PacketLatencyTest() {
+        StatsMgr::instance().resetLatencies();
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Resets the latency histograms.
+    virtual ~PacketLatencyTest() {
+        StatsMgr::instance().resetLatencies();
+    }
+
+    /// @brief Creates a packet with stamped stages.
+    ///
+    /// The packet is received at a fixed time, dequeued 10 us later,
+    /// its subnet is selected 100 us later and it is sent 1000 us later.
+    Pkt4Ptr createPacket() {
+        Pkt4Ptr pkt(new Pkt4(DHCPOFFER, 1234));
+        const ptime received(time_from_string("2019-01-01 00:00:00"));
+        pkt->markStage(Pkt::RECEIVED, received);
+        pkt->markStage(Pkt::DEQUEUED, received + microseconds(10));
+        pkt->markStage(Pkt::SUBNET_SELECTED, received + microseconds(110));
+        pkt->markStage(Pkt::SENT, received + microseconds(1110));
+        return (pkt);
+    }
+};
+
+// Checks that the latencies of the stages are recorded in the histograms
+// of the statistics manager.
+TEST_F(PacketLatencyTest, record) {
+    PacketLatency latency("pkt4");
+    EXPECT_EQ(1110, latency.record(*createPacket()));
+
+    LatencyHistogramPtr dequeued =
+        StatsMgr::instance().getLatencyHistogram("pkt4-latency-dequeued");
+    EXPECT_EQ(1, dequeued->getCount());
+    EXPECT_EQ(10, dequeued->getMax());
+
+    LatencyHistogramPtr subnet =
+        StatsMgr::instance().getLatencyHistogram("pkt4-latency-subnet-selected");
+    EXPECT_EQ(1, subnet->getCount());
+    EXPECT_EQ(100, subnet->getMax());
+
+    LatencyHistogramPtr sent =
+        StatsMgr::instance().getLatencyHistogram("pkt4-latency-sent");
+    EXPECT_EQ(1, sent->getCount());
+    EXPECT_EQ(1000, sent->getMax());
+
+    // Stages which were not reached are not recorded.
+    EXPECT_EQ(0, StatsMgr::instance().
+              getLatencyHistogram("pkt4-latency-unpacked")->getCount());
+
+    LatencyHistogramPtr total =
+        StatsMgr::instance().getLatencyHistogram("pkt4-latency-total");
+    EXPECT_EQ(1, total->getCount());
+    EXPECT_EQ(1110, total->getMax());
+
+    // A packet without stamps is not recorded.
+    EXPECT_EQ(0, latency.record(Pkt4(DHCPOFFER, 1234)));
+    EXPECT_EQ(1, total->getCount());
+}
+
+// Checks the breakdown of the processing time.
+TEST_F(PacketLatencyTest, breakdownToText) {
+    EXPECT_EQ("dequeued 10 us, subnet-selected 100 us, sent 1000 us",
+              PacketLatency::breakdownToText(*createPacket()));
+    EXPECT_EQ("", PacketLatency::breakdownToText(Pkt4(DHCPOFFER, 1234)));
+}
+
+// Checks that the slow packets are reported at most once per interval.
+TEST_F(PacketLatencyTest, reportSlow) {
+    PacketLatency latency("pkt4");
+    // Not reported by default.
+    EXPECT_FALSE(latency.reportSlow(1000000));
+
+    latency.setSlowThreshold(1000);
+    EXPECT_EQ(1000, latency.getSlowThreshold());
+    EXPECT_FALSE(latency.reportSlow(999));
+    EXPECT_TRUE(latency.reportSlow(1000));
+    // The next one is sampled out.
+    EXPECT_FALSE(latency.reportSlow(2000));
+}
+
+} // end of anonymous namespace
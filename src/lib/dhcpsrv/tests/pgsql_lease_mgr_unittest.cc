@@ -558,6 +558,11 @@ TEST_F(PgSqlLeaseMgrTest, DISABLED_wipeLeases6) {
     testWipeLeases6();
 }
 
+/// @brief Tests that the free IPv4 addresses of a range are found.
+TEST_F(PgSqlLeaseMgrTest, findFreeAddresses4) {
+    testFindFreeAddresses4();
+}
+
 // Tests v4 lease stats query variants.
 TEST_F(PgSqlLeaseMgrTest, leaseStatsQuery4) {
     testLeaseStatsQuery4();
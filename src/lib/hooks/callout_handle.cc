@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -11,6 +11,7 @@
 #include <hooks/library_handle.h>
 #include <hooks/server_hooks.h>
 
+#include <algorithm>
 #include <string>
 #include <utility>
 #include <vector>
@@ -23,7 +24,8 @@ namespace hooks {
 // Constructor.
 CalloutHandle::CalloutHandle(const boost::shared_ptr<CalloutManager>& manager,
                     const boost::shared_ptr<LibraryManagerCollection>& lmcoll)
-    : lm_collection_(lmcoll), arguments_(), context_collection_(),
+    : lm_collection_(lmcoll), arguments_(), argument_count_(0),
+      context_collection_(),
       manager_(manager), server_hooks_(ServerHooks::getServerHooks()),
       next_step_(NEXT_STEP_CONTINUE) {
 
@@ -44,6 +46,7 @@ CalloutHandle::~CalloutHandle() {
     // Explicitly clear the argument and context objects.  This should free up
     // all memory that could have been allocated by libraries that were loaded.
     arguments_.clear();
+    argument_count_ = 0;
     context_collection_.clear();
 
     // Normal destruction of the remaining variables will include the
@@ -66,14 +69,146 @@ vector<string>
 CalloutHandle::getArgumentNames() const {
 
     vector<string> names;
-    for (ElementCollection::const_iterator i = arguments_.begin();
-         i != arguments_.end(); ++i) {
-        names.push_back(i->first);
+    for (size_t i = 0; i < argument_count_; ++i) {
+        names.push_back(arguments_[i].name_);
     }
+    sort(names.begin(), names.end());
 
     return (names);
 }
 
+// Delete an argument.  The slot is moved after the last argument so it
+// can be reused.
+
+void
+CalloutHandle::deleteArgument(const std::string& name) {
+    for (size_t i = 0; i < argument_count_; ++i) {
+        if (arguments_[i].name_ == name) {
+            arguments_[i].value_ = boost::any();
+            --argument_count_;
+            if (i != argument_count_) {
+                swap(arguments_[i].name_, arguments_[argument_count_].name_);
+                swap(arguments_[i].index_, arguments_[argument_count_].index_);
+                arguments_[i].value_.swap(arguments_[argument_count_].value_);
+            }
+            return;
+        }
+    }
+}
+
+// Delete all arguments.  The values are released so the data the callouts
+// got from the server doesn't outlive the hook point, but the slots are
+// kept.
+
+void
+CalloutHandle::deleteAllArguments() {
+    for (size_t i = 0; i < argument_count_; ++i) {
+        arguments_[i].value_ = boost::any();
+    }
+    argument_count_ = 0;
+}
+
+boost::any*
+CalloutHandle::findArgument(const std::string& name) {
+    for (size_t i = 0; i < argument_count_; ++i) {
+        if (arguments_[i].name_ == name) {
+            return (&arguments_[i].value_);
+        }
+    }
+    return (0);
+}
+
+const boost::any*
+CalloutHandle::findArgument(const std::string& name) const {
+    for (size_t i = 0; i < argument_count_; ++i) {
+        if (arguments_[i].name_ == name) {
+            return (&arguments_[i].value_);
+        }
+    }
+    return (0);
+}
+
+boost::any&
+CalloutHandle::addArgument(const std::string& name) {
+    if (argument_count_ == arguments_.size()) {
+        arguments_.push_back(Element());
+    }
+    // A released slot usually held the same argument at the previous
+    // hook point: the name and the index are then kept.
+    Element& element = arguments_[argument_count_++];
+    if (element.name_ != name) {
+        element.name_.assign(name);
+        element.index_ = server_hooks_.findArgumentIndex(name);
+    }
+    return (element.value_);
+}
+
+boost::any*
+CalloutHandle::findArgument(const int index) {
+    // The arguments set by names which are not registered have no index.
+    if (index < 0) {
+        return (0);
+    }
+    for (size_t i = 0; i < argument_count_; ++i) {
+        if (arguments_[i].index_ == index) {
+            return (&arguments_[i].value_);
+        }
+    }
+    return (0);
+}
+
+const boost::any*
+CalloutHandle::findArgument(const int index) const {
+    if (index < 0) {
+        return (0);
+    }
+    for (size_t i = 0; i < argument_count_; ++i) {
+        if (arguments_[i].index_ == index) {
+            return (&arguments_[i].value_);
+        }
+    }
+    return (0);
+}
+
+boost::any&
+CalloutHandle::addArgument(const int index) {
+    // Check the index before a slot is taken.
+    const std::string& name = server_hooks_.getArgumentName(index);
+    if (argument_count_ == arguments_.size()) {
+        arguments_.push_back(Element());
+    }
+    Element& element = arguments_[argument_count_++];
+    if (element.index_ != index) {
+        element.name_.assign(name);
+        element.index_ = index;
+    }
+    return (element.value_);
+}
+
+boost::any*
+CalloutHandle::findElement(ElementCollection& elements,
+                           const std::string& name) {
+    for (auto element = elements.begin(); element != elements.end();
+         ++element) {
+        if (element->name_ == name) {
+            return (&element->value_);
+        }
+    }
+    return (0);
+}
+
+const boost::any*
+CalloutHandle::findElement(const ElementCollection& elements,
+                           const std::string& name) {
+    for (auto element = elements.begin(); element != elements.end();
+         ++element) {
+        if (element->name_ == name) {
+            return (&element->value_);
+        }
+    }
+    return (0);
+}
+
 ParkingLotHandlePtr
 CalloutHandle::getParkingLotHandlePtr() const {
     return (boost::make_shared<ParkingLotHandle>(server_hooks_.getParkingLotPtr(manager_->getHookIndex())));
@@ -97,7 +232,14 @@ CalloutHandle::getContextForLibrary() {
 
     // Access a reference to the element collection for the given index,
     // creating a new element collection if necessary, and return it.
-    return (context_collection_[libindex]);
+    for (ContextCollection::iterator libcontext = context_collection_.begin();
+         libcontext != context_collection_.end(); ++libcontext) {
+        if (libcontext->first == libindex) {
+            return (libcontext->second);
+        }
+    }
+    context_collection_.push_back(make_pair(libindex, ElementCollection()));
+    return (context_collection_.back().second);
 }
 
 // The "const" version of the above, used by the "getContext()" method.  If
@@ -107,16 +249,18 @@ const CalloutHandle::ElementCollection&
 CalloutHandle::getContextForLibrary() const {
     int libindex = manager_->getLibraryIndex();
 
-    ContextCollection::const_iterator libcontext =
-        context_collection_.find(libindex);
-    if (libcontext == context_collection_.end()) {
-        isc_throw(NoSuchCalloutContext, "unable to find callout context "
-                  "associated with the current library index (" << libindex <<
-                  ")");
+    for (ContextCollection::const_iterator libcontext =
+             context_collection_.begin();
+         libcontext != context_collection_.end(); ++libcontext) {
+        if (libcontext->first == libindex) {
+            // Return a reference to the context's element collection.
+            return (libcontext->second);
+        }
     }
 
-    // Return a reference to the context's element collection.
-    return (libcontext->second);
+    isc_throw(NoSuchCalloutContext, "unable to find callout context "
+              "associated with the current library index (" << libindex <<
+              ")");
 }
 
 // Return the name of all items in the context associated with the current]
@@ -130,12 +274,27 @@ CalloutHandle::getContextNames() const {
     const ElementCollection& elements = getContextForLibrary();
     for (ElementCollection::const_iterator i = elements.begin();
          i != elements.end(); ++i) {
-        names.push_back(i->first);
+        names.push_back(i->name_);
     }
+    sort(names.begin(), names.end());
 
     return (names);
 }
 
+// Delete an item from the context associated with the current library.
+
+void
+CalloutHandle::deleteContext(const std::string& name) {
+    ElementCollection& elements = getContextForLibrary();
+    for (ElementCollection::iterator i = elements.begin();
+         i != elements.end(); ++i) {
+        if (i->name_ == name) {
+            static_cast<void>(elements.erase(i));
+            return;
+        }
+    }
+}
+
 // Return name of current hook (the hook to which the current callout is
 // attached) or the empty string if not called within the context of a
 // callout.
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -10,12 +10,14 @@
 #include <exceptions/exceptions.h>
 #include <hooks/library_handle.h>
 #include <hooks/parking_lots.h>
+#include <util/memory_arena.h>
 
 #include <boost/any.hpp>
 #include <boost/shared_ptr.hpp>
 
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace isc {
@@ -80,8 +82,11 @@ class LibraryManagerCollection;
 ///   case, only functions registered by functions in the same library as the
 ///   callout doing the deregistration can be removed: callouts registered by
 ///   other libraries cannot be modified.
+///
+/// Handles created while a @c isc::util::MemoryArenaScope is active are
+/// allocated from the per-packet arena.
 
-class CalloutHandle {
+class CalloutHandle : public isc::util::ArenaAllocatable {
 public:
 
     /// @brief Specifies allowed next steps
@@ -97,10 +102,34 @@ public:
     };
 
 
-    /// Typedef to allow abbreviation of iterator specification in methods.
-    /// The std::string is the argument name and the "boost::any" is the
+    /// @brief Argument or context item.
+    ///
+    /// The std::string is the item name and the "boost::any" is the
     /// corresponding value associated with it.
-    typedef std::map<std::string, boost::any> ElementCollection;
+    struct Element {
+        /// @brief Constructor.
+        Element() : name_(), index_(-1), value_() {
+        }
+
+        /// @brief Name of the item.
+        std::string name_;
+
+        /// @brief Index of the argument registered in ServerHooks, or -1.
+        ///
+        /// Not used by the context items.
+        int index_;
+
+        /// @brief Value of the item.
+        boost::any value_;
+    };
+
+    /// Typedef to allow abbreviation of iterator specification in methods.
+    ///
+    /// The items are held in a flat vector rather than in a map: there are
+    /// only a few arguments per hook point and a linear search of a
+    /// contiguous array is faster than a tree walk, while setting an
+    /// argument doesn't allocate a node.
+    typedef std::vector<Element> ElementCollection;
 
     /// Typedef to allow abbreviations in specifications when accessing
     /// context.  The ElementCollection is the name/value collection for
@@ -108,11 +137,12 @@ public:
     /// associated library - there is a 1:1 correspondence between libraries
     /// and a name.value collection.
     ///
-    /// The collection of contexts is stored in a map, as not every library
-    /// will require creation of a context associated with each packet.  In
-    /// addition, the structure is more flexible in that the size does not
-    /// need to be set when the CalloutHandle is constructed.
-    typedef std::map<int, ElementCollection> ContextCollection;
+    /// The collection of contexts is stored in a vector searched by the
+    /// library index, as not every library will require creation of a
+    /// context associated with each packet.  In addition, the structure is
+    /// more flexible in that the size does not need to be set when the
+    /// CalloutHandle is constructed.
+    typedef std::vector<std::pair<int, ElementCollection> > ContextCollection;
 
     /// @brief Constructor
     ///
@@ -151,7 +181,11 @@ public:
     /// @param value Value to set.  That can be of any data type.
     template <typename T>
     void setArgument(const std::string& name, T value) {
-        arguments_[name] = value;
+        boost::any* element = findArgument(name);
+        if (!element) {
+            element = &addArgument(name);
+        }
+        *element = value;
     }
 
     /// @brief Get argument
@@ -168,19 +202,59 @@ public:
     ///        the variable provided to receive the value.
     template <typename T>
     void getArgument(const std::string& name, T& value) const {
-        ElementCollection::const_iterator element_ptr = arguments_.find(name);
-        if (element_ptr == arguments_.end()) {
+        const boost::any* element = findArgument(name);
+        if (!element) {
             isc_throw(NoSuchArgument, "unable to find argument with name " <<
                       name);
         }
 
-        value = boost::any_cast<T>(element_ptr->second);
+        value = boost::any_cast<T>(*element);
+    }
+
+    /// @brief Set argument by index
+    ///
+    /// Sets the value of an argument registered by
+    /// HooksManager::registerArgument().  The argument is created if it
+    /// does not already exist.  The callouts get it by name as usual: the
+    /// index only saves the comparisons of the names.
+    ///
+    /// @param index Index of the argument.
+    /// @param value Value to set.  That can be of any data type.
+    ///
+    /// @throw isc::BadValue The index is not registered.
+    template <typename T>
+    void setArgument(const int index, T value) {
+        boost::any* element = findArgument(index);
+        if (!element) {
+            element = &addArgument(index);
+        }
+        *element = value;
+    }
+
+    /// @brief Get argument by index
+    ///
+    /// @param index Index of the argument.
+    /// @param value [out] Value to set.  The type of "value" is important:
+    ///        it must match the type of the value set.
+    ///
+    /// @throw NoSuchArgument No argument with the given index is present.
+    /// @throw boost::bad_any_cast The data type of the value is not the same
+    ///        as the type of the variable provided to receive the value.
+    template <typename T>
+    void getArgument(const int index, T& value) const {
+        const boost::any* element = findArgument(index);
+        if (!element) {
+            isc_throw(NoSuchArgument, "unable to find argument with index " <<
+                      index);
+        }
+
+        value = boost::any_cast<T>(*element);
     }
 
     /// @brief Get argument names
     ///
     /// Returns a vector holding the names of arguments in the argument
-    /// vector.
+    /// vector, in alphabetical order.
     ///
     /// @return Vector of strings reflecting argument names.
     std::vector<std::string> getArgumentNames() const;
@@ -194,19 +268,18 @@ public:
     /// by this method.
     ///
     /// @param name Name of the element in the argument list to set.
-    void deleteArgument(const std::string& name) {
-        static_cast<void>(arguments_.erase(name));
-    }
+    void deleteArgument(const std::string& name);
 
     /// @brief Delete all arguments
     ///
     /// Deletes all arguments associated with this context.
     ///
+    /// The values are released but the slots holding them are kept, so
+    /// the arguments set at the next hook point reuse them.
+    ///
     /// N.B. If any elements are raw pointers, the pointed-to data is NOT
     /// deleted by this method.
-    void deleteAllArguments() {
-        arguments_.clear();
-    }
+    void deleteAllArguments();
 
     /// @brief Sets the next processing step.
     ///
@@ -272,7 +345,14 @@ public:
     /// @param value Value to set.
     template <typename T>
     void setContext(const std::string& name, T value) {
-        getContextForLibrary()[name] = value;
+        ElementCollection& lib_context = getContextForLibrary();
+        boost::any* element = findElement(lib_context, name);
+        if (!element) {
+            lib_context.push_back(Element());
+            lib_context.back().name_ = name;
+            element = &lib_context.back().value_;
+        }
+        *element = value;
     }
 
     /// @brief Get context
@@ -292,14 +372,14 @@ public:
     void getContext(const std::string& name, T& value) const {
         const ElementCollection& lib_context = getContextForLibrary();
 
-        ElementCollection::const_iterator element_ptr = lib_context.find(name);
-        if (element_ptr == lib_context.end()) {
+        const boost::any* element = findElement(lib_context, name);
+        if (!element) {
             isc_throw(NoSuchCalloutContext, "unable to find callout context "
                       "item " << name << " in the context associated with "
                       "current library");
         }
 
-        value = boost::any_cast<T>(element_ptr->second);
+        value = boost::any_cast<T>(*element);
     }
 
     /// @brief Get context names
@@ -321,9 +401,7 @@ public:
     /// by this.
     ///
     /// @param name Name of the context item to delete.
-    void deleteContext(const std::string& name) {
-        static_cast<void>(getContextForLibrary().erase(name));
-    }
+    void deleteContext(const std::string& name);
 
     /// @brief Delete all context items
     ///
@@ -351,6 +429,76 @@ public:
 
 private:
 
+    /// @brief Find an argument
+    ///
+    /// @param name Name of the argument.
+    ///
+    /// @return Pointer to the value of the argument or null if there is
+    ///         no argument with this name.
+    boost::any* findArgument(const std::string& name);
+
+    /// @brief Find an argument (const version)
+    ///
+    /// @param name Name of the argument.
+    ///
+    /// @return Pointer to the value of the argument or null if there is
+    ///         no argument with this name.
+    const boost::any* findArgument(const std::string& name) const;
+
+    /// @brief Add an argument
+    ///
+    /// Reuses the first slot released by @ref deleteAllArguments, if any.
+    ///
+    /// @param name Name of the argument, which must not exist.
+    ///
+    /// @return Reference to the (empty) value of the new argument.
+    boost::any& addArgument(const std::string& name);
+
+    /// @brief Find an argument by index
+    ///
+    /// @param index Index of the argument.
+    ///
+    /// @return Pointer to the value of the argument or null if there is
+    ///         no argument with this index.
+    boost::any* findArgument(const int index);
+
+    /// @brief Find an argument by index (const version)
+    ///
+    /// @param index Index of the argument.
+    ///
+    /// @return Pointer to the value of the argument or null if there is
+    ///         no argument with this index.
+    const boost::any* findArgument(const int index) const;
+
+    /// @brief Add an argument by index
+    ///
+    /// @param index Index of the argument, which must not exist.
+    ///
+    /// @return Reference to the (empty) value of the new argument.
+    ///
+    /// @throw isc::BadValue The index is not registered.
+    boost::any& addArgument(const int index);
+
+    /// @brief Find an item in a collection
+    ///
+    /// @param elements Collection of items.
+    /// @param name Name of the item.
+    ///
+    /// @return Pointer to the value of the item or null if there is no
+    ///         item with this name.
+    static boost::any* findElement(ElementCollection& elements,
+                                   const std::string& name);
+
+    /// @brief Find an item in a collection (const version)
+    ///
+    /// @param elements Collection of items.
+    /// @param name Name of the item.
+    ///
+    /// @return Pointer to the value of the item or null if there is no
+    ///         item with this name.
+    static const boost::any* findElement(const ElementCollection& elements,
+                                         const std::string& name);
+
     /// @brief Check index
     ///
     /// Gets the current library index, throwing an exception if it is not set
@@ -395,8 +543,14 @@ private:
     boost::shared_ptr<LibraryManagerCollection> lm_collection_;
 
     /// Collection of arguments passed to the callouts
+    ///
+    /// Only the first @c argument_count_ slots hold arguments: the
+    /// following ones were released and are kept to be reused.
     ElementCollection arguments_;
 
+    /// Number of arguments.
+    size_t argument_count_;
+
     /// Context collection - there is one entry per library context.
     ContextCollection context_collection_;
 
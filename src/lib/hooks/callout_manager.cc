@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -19,6 +19,8 @@
 #include <functional>
 #include <utility>
 
+using namespace isc::data;
+using namespace isc::util;
 using namespace std;
 
 namespace isc {
@@ -30,7 +32,8 @@ CalloutManager::CalloutManager(int num_libraries)
       current_hook_(-1), current_library_(-1),
       hook_vector_(ServerHooks::getServerHooks().getCount()),
       library_handle_(this), pre_library_handle_(this, 0),
-      post_library_handle_(this, INT_MAX), num_libraries_(num_libraries)
+      post_library_handle_(this, INT_MAX), num_libraries_(num_libraries),
+      latencies_()
 {
     if (num_libraries < 0) {
         isc_throw(isc::BadValue, "number of libraries passed to the "
@@ -174,6 +177,8 @@ CalloutManager::callCallouts(int hook_index, CalloutHandle& callout_handle) {
                 stopwatch.start();
                 int status = (*i->second)(callout_handle);
                 stopwatch.stop();
+                getLatencyHistogram(hook_index, current_library_)
+                    .record(stopwatch.getLastMicroseconds());
                 if (status == 0) {
                     LOG_DEBUG(callouts_logger, HOOKS_DBG_EXTENDED_CALLS,
                               HOOKS_CALLOUT_CALLED).arg(current_library_)
@@ -191,6 +196,8 @@ CalloutManager::callCallouts(int hook_index, CalloutHandle& callout_handle) {
                 // If an exception occurred, the stopwatch.stop() hasn't been
                 // called, so we have to call it here.
                 stopwatch.stop();
+                getLatencyHistogram(hook_index, current_library_)
+                    .record(stopwatch.getLastMicroseconds());
                 // Any exception, not just ones based on isc::Exception
                 LOG_ERROR(callouts_logger, HOOKS_CALLOUT_EXCEPTION)
                     .arg(current_library_)
@@ -202,6 +209,9 @@ CalloutManager::callCallouts(int hook_index, CalloutHandle& callout_handle) {
 
         }
 
+        getLatencyHistogram(hook_index, -1)
+            .record(stopwatch.getTotalMicroseconds());
+
         // Mark end of callout execution. Include the total execution
         // time for callouts.
         LOG_DEBUG(callouts_logger, HOOKS_DBG_CALLS, HOOKS_CALLOUTS_COMPLETE)
@@ -341,6 +351,76 @@ CalloutManager::registerCommandHook(const std::string& command_name) {
     }
 }
 
+// Return the latency histogram of a hook and library, creating it if needed.
+// The histograms of a hook are stored in the order of the libraries, after
+// the histogram of all the callouts of the hook.
+
+LatencyHistogram&
+CalloutManager::getLatencyHistogram(int hook_index, int library_index) {
+    if (latencies_.size() <= static_cast<size_t>(hook_index)) {
+        latencies_.resize(hook_index + 1);
+    }
+    std::vector<LatencyHistogramPtr>& histograms = latencies_[hook_index];
+    if (histograms.empty()) {
+        histograms.resize(num_libraries_ + 3);
+    }
+
+    size_t slot = (library_index == INT_MAX ? num_libraries_ + 2 :
+                   library_index + 1);
+    if (!histograms[slot]) {
+        histograms[slot].reset(new LatencyHistogram());
+    }
+    return (*histograms[slot]);
+}
+
+ElementPtr
+CalloutManager::getLatencies(const std::vector<std::string>& library_names) const {
+    ElementPtr latencies = Element::createMap();
+    for (size_t hook_index = 0; hook_index < latencies_.size(); ++hook_index) {
+        const std::vector<LatencyHistogramPtr>& histograms =
+            latencies_[hook_index];
+        if (histograms.empty() || !histograms[0] ||
+            (histograms[0]->getCount() == 0)) {
+            continue;
+        }
+
+        ElementPtr hook = latencyHistogramToElement<Element>(*histograms[0]);
+        ElementPtr libraries = Element::createList();
+        for (size_t slot = 1; slot < histograms.size(); ++slot) {
+            if (!histograms[slot] || (histograms[slot]->getCount() == 0)) {
+                continue;
+            }
+            int library_index = (slot == histograms.size() - 1 ? INT_MAX :
+                                 static_cast<int>(slot) - 1);
+            ElementPtr library =
+                latencyHistogramToElement<Element>(*histograms[slot]);
+            library->set("index", Element::create(library_index));
+            if ((library_index > 0) &&
+                (static_cast<size_t>(library_index) <= library_names.size())) {
+                library->set("library",
+                             Element::create(library_names[library_index - 1]));
+            }
+            libraries->add(library);
+        }
+        hook->set("libraries", libraries);
+
+        latencies->set(server_hooks_.getName(hook_index), hook);
+    }
+    return (latencies);
+}
+
+void
+CalloutManager::resetLatencies() {
+    for (auto hook = latencies_.begin(); hook != latencies_.end(); ++hook) {
+        for (auto histogram = hook->begin(); histogram != hook->end();
+             ++histogram) {
+            if (*histogram) {
+                (*histogram)->reset();
+            }
+        }
+    }
+}
+
 void
 CalloutManager::ensureHookLibsVectorSize() {
     ServerHooks& hooks = ServerHooks::getServerHooks();
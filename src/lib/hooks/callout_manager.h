@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,15 +7,18 @@
 #ifndef CALLOUT_MANAGER_H
 #define CALLOUT_MANAGER_H
 
+#include <cc/data.h>
 #include <exceptions/exceptions.h>
 #include <hooks/library_handle.h>
 #include <hooks/server_hooks.h>
+#include <util/latency_histogram.h>
 
 #include <boost/shared_ptr.hpp>
 
 #include <climits>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace isc {
 namespace hooks {
@@ -230,6 +233,10 @@ public:
     /// Iterates through the library handles and calls the callouts associated
     /// with the given hook index.
     ///
+    /// The execution time of each callout is recorded in the latency
+    /// histogram of its hook and library, and the execution time of all the
+    /// callouts in the latency histogram of the hook.
+    ///
     /// @note This method invalidates the current library index set with
     ///       setLibraryIndex().
     ///
@@ -372,6 +379,26 @@ public:
         return (hook_vector_.size());
     }
 
+    /// @brief Returns the latencies of the callouts.
+    ///
+    /// Returns a map with an entry for each hook point whose callouts were
+    /// called, holding the statistics of the execution times of all the
+    /// callouts of the hook point and a "libraries" list with the
+    /// statistics of the callouts of each library. The statistics are the
+    /// number of calls ("count") and the minimum, maximum, mean and 50th,
+    /// 90th, 99th and 99.9th percentiles of the execution times, in
+    /// microseconds.
+    ///
+    /// @param library_names Names of the libraries, the first one having
+    ///        the index 1.
+    ///
+    /// @return Map of the latencies by hook point name.
+    data::ElementPtr
+    getLatencies(const std::vector<std::string>& library_names) const;
+
+    /// @brief Resets the latencies of the callouts.
+    void resetLatencies();
+
 private:
 
     /// @brief This method checks whether the hook_vector_ size is suffucient
@@ -407,6 +434,18 @@ private:
     /// @throw NoSuchLibrary Library index is not valid.
     void checkLibraryIndex(int library_index) const;
 
+    /// @brief Returns the latency histogram of a hook and library
+    ///
+    /// The histogram is created when it is first needed.
+    ///
+    /// @param hook_index Index of the hook.
+    /// @param library_index Index of the library, or -1 for the histogram
+    ///        of all the callouts of the hook.
+    ///
+    /// @return The latency histogram.
+    util::LatencyHistogram& getLatencyHistogram(int hook_index,
+                                                int library_index);
+
     /// @brief Compare two callout entries for library equality
     ///
     /// This is used in callout removal code when all callouts on a hook for a
@@ -464,6 +503,14 @@ private:
 
     /// Number of libraries.
     int num_libraries_;
+
+    /// Latency histograms, indexed by hook index.  For each hook, the first
+    /// element is the histogram of all the callouts, the next ones the
+    /// histograms of the callouts registered by the server before the
+    /// user-library callouts, by each library and by the server after the
+    /// user-library callouts.  The elements are null until callouts of the
+    /// corresponding library are called on the hook.
+    std::vector<std::vector<util::LatencyHistogramPtr> > latencies_;
 };
 
 } // namespace util
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -6,6 +6,7 @@
 
 #include <config.h>
 
+#include <cc/command_interpreter.h>
 #include <hooks/callout_handle.h>
 #include <hooks/callout_manager.h>
 #include <hooks/callout_manager.h>
@@ -19,6 +20,7 @@
 #include <string>
 #include <vector>
 
+using namespace isc::data;
 using namespace std;
 
 namespace isc {
@@ -175,6 +177,56 @@ HooksManager::getLibraryInfo() {
     return (getHooksManager().getLibraryInfoInternal());
 }
 
+// Get the latencies of the callouts.
+
+ElementPtr
+HooksManager::getCalloutLatenciesInternal() {
+    conditionallyInitialize();
+    return (callout_manager_->getLatencies(getLibraryNamesInternal()));
+}
+
+ElementPtr
+HooksManager::getCalloutLatencies() {
+    return (getHooksManager().getCalloutLatenciesInternal());
+}
+
+void
+HooksManager::resetCalloutLatenciesInternal() {
+    conditionallyInitialize();
+    callout_manager_->resetLatencies();
+}
+
+void
+HooksManager::resetCalloutLatencies() {
+    getHooksManager().resetCalloutLatenciesInternal();
+}
+
+ConstElementPtr
+HooksManager::calloutLatencyGetHandler(const std::string&,
+                                       const ConstElementPtr& params) {
+    bool reset = false;
+    if (params) {
+        if (params->getType() != Element::map) {
+            return (config::createAnswer(config::CONTROL_RESULT_ERROR,
+                                         "arguments must be a map"));
+        }
+        ConstElementPtr reset_elem = params->get("reset");
+        if (reset_elem) {
+            if (reset_elem->getType() != Element::boolean) {
+                return (config::createAnswer(config::CONTROL_RESULT_ERROR,
+                                             "'reset' must be a boolean"));
+            }
+            reset = reset_elem->boolValue();
+        }
+    }
+
+    ElementPtr latencies = getCalloutLatencies();
+    if (reset) {
+        resetCalloutLatencies();
+    }
+    return (config::createAnswer(config::CONTROL_RESULT_SUCCESS, latencies));
+}
+
 // Perform conditional initialization if nothing is loaded.
 
 void
@@ -196,6 +248,13 @@ HooksManager::registerHook(const std::string& name) {
     return (ServerHooks::getServerHooks().registerHook(name));
 }
 
+// Shell around ServerHooks::registerArgument()
+
+int
+HooksManager::registerArgument(const std::string& name) {
+    return (ServerHooks::getServerHooks().registerArgument(name));
+}
+
 // Return pre- and post- library handles.
 
 isc::hooks::LibraryHandle&
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,6 +7,7 @@
 #ifndef HOOKS_MANAGER_H
 #define HOOKS_MANAGER_H
 
+#include <cc/data.h>
 #include <hooks/server_hooks.h>
 #include <hooks/libinfo.h>
 
@@ -191,6 +192,17 @@ public:
     ///         registered.
     static int registerHook(const std::string& name);
 
+    /// @brief Register callout argument
+    ///
+    /// This is a convenience shell around the
+    /// ServerHooks::registerArgument() method.  The returned index is used
+    /// with the index-based CalloutHandle::setArgument() method.
+    ///
+    /// @param name Name of the argument
+    ///
+    /// @return Index of the argument.
+    static int registerArgument(const std::string& name);
+
     /// @brief Return list of loaded libraries
     ///
     /// Returns the names of the loaded libraries.
@@ -205,6 +217,33 @@ public:
     /// @return List of loaded libraries (names + parameters)
     static HookLibsCollection getLibraryInfo();
 
+    /// @brief Return the latencies of the callouts
+    ///
+    /// Returns the statistics of the execution times of the callouts by
+    /// hook point and library.  See @ref CalloutManager::getLatencies for
+    /// the format.  The latencies are reset when the libraries are loaded
+    /// or reloaded.
+    ///
+    /// @return Map of the latencies by hook point name.
+    static data::ElementPtr getCalloutLatencies();
+
+    /// @brief Reset the latencies of the callouts
+    static void resetCalloutLatencies();
+
+    /// @brief Handler for the 'hooks-latency-get' command
+    ///
+    /// Returns the latencies of the callouts. When the optional "reset"
+    /// boolean argument is true, the latencies are reset after they are
+    /// returned.
+    ///
+    /// @param name Name of the command (ignored).
+    /// @param params Arguments of the command.
+    ///
+    /// @return Answer holding the latencies.
+    static data::ConstElementPtr
+    calloutLatencyGetHandler(const std::string& name,
+                             const data::ConstElementPtr& params);
+
     /// @brief Validate library list
     ///
     /// For each library passed to it, checks that the library can be opened
@@ -475,6 +514,14 @@ private:
     /// @brief Return a collection of library names with parameters.
     HookLibsCollection getLibraryInfoInternal() const;
 
+    /// @brief Return the latencies of the callouts
+    ///
+    /// @return Map of the latencies by hook point name.
+    data::ElementPtr getCalloutLatenciesInternal();
+
+    /// @brief Reset the latencies of the callouts
+    void resetCalloutLatenciesInternal();
+
     //@}
 
     /// @brief Initialization to No Libraries
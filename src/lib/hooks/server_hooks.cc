@@ -168,6 +168,35 @@ ServerHooks::getHookNames() const {
     return (names);
 }
 
+// Register an argument.  As for the hooks, the index is the number of
+// arguments registered before.
+
+int
+ServerHooks::registerArgument(const std::string& name) {
+    int index = argument_names_.size();
+    pair<HookCollection::iterator, bool> result =
+        arguments_.insert(make_pair(name, index));
+    if (result.second) {
+        argument_names_.push_back(name);
+    }
+    return (result.first->second);
+}
+
+int
+ServerHooks::findArgumentIndex(const std::string& name) const {
+    auto i = arguments_.find(name);
+    return ((i == arguments_.end()) ? -1 : i->second);
+}
+
+const std::string&
+ServerHooks::getArgumentName(int index) const {
+    if ((index < 0) || (index >= static_cast<int>(argument_names_.size()))) {
+        isc_throw(BadValue, "argument index " << index
+                  << " is not recognized");
+    }
+    return (argument_names_[index]);
+}
+
 // Return global ServerHooks object
 
 ServerHooks&
@@ -141,6 +141,38 @@ public:
     /// @return Vector of strings holding hook names.
     std::vector<std::string> getHookNames() const;
 
+    /// @brief Register a callout argument
+    ///
+    /// Registers the name of an argument passed to the callouts and returns
+    /// its index.  The server code uses the index to set the argument in the
+    /// callout handle without comparing its name.  Registering a name again
+    /// returns the same index.
+    ///
+    /// The arguments are not cleared by @ref reset: the indexes are held by
+    /// the server code in static objects.
+    ///
+    /// @param name Name of the argument.
+    ///
+    /// @return Index of the argument, greater than or equal to zero.
+    int registerArgument(const std::string& name);
+
+    /// @brief Find argument index
+    ///
+    /// @param name Name of the argument.
+    ///
+    /// @return Index of the argument, or -1 if the argument was not
+    ///         registered.
+    int findArgumentIndex(const std::string& name) const;
+
+    /// @brief Get argument name
+    ///
+    /// @param index Index of the argument.
+    ///
+    /// @return Name of the argument.
+    ///
+    /// @throw isc::BadValue if the argument index is invalid.
+    const std::string& getArgumentName(int index) const;
+
     /// @brief Return ServerHooks object
     ///
     /// Returns the global ServerHooks object.
@@ -237,6 +269,12 @@ private:
     HookCollection  hooks_;                 ///< Hook name/index collection
     InverseHookCollection inverse_hooks_;   ///< Hook index/name collection
 
+    /// Argument name/index collection.
+    HookCollection arguments_;
+
+    /// Argument names, by index.
+    std::vector<std::string> argument_names_;
+
     ParkingLotsPtr parking_lots_;
 };
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -301,6 +301,94 @@ TEST_F(CalloutHandleTest, DeleteAllArguments) {
     EXPECT_THROW(handle.getArgument("four", value), NoSuchArgument);
 }
 
+// Test that the arguments can be set again after they were all deleted
+// and that the deleted values are released.
+
+TEST_F(CalloutHandleTest, ReuseArguments) {
+    CalloutHandle handle(getCalloutManager());
+
+    boost::shared_ptr<int> one(new int(1));
+    boost::shared_ptr<int> two(new int(2));
+    boost::shared_ptr<int> value;
+
+    handle.setArgument("one", one);
+    handle.setArgument("two", two);
+    EXPECT_EQ(2, one.use_count());
+
+    // The values must not be held by the handle anymore.
+    handle.deleteAllArguments();
+    EXPECT_EQ(1, one.use_count());
+    EXPECT_EQ(1, two.use_count());
+    EXPECT_TRUE(handle.getArgumentNames().empty());
+
+    // Set other arguments in the released slots.
+    handle.setArgument("two", one);
+    handle.setArgument("three", two);
+    handle.setArgument("four", two);
+    vector<string> expected_names;
+    expected_names.push_back("four");
+    expected_names.push_back("three");
+    expected_names.push_back("two");
+    EXPECT_TRUE(expected_names == handle.getArgumentNames());
+
+    handle.getArgument("two", value);
+    EXPECT_EQ(1, *value);
+    handle.getArgument("three", value);
+    EXPECT_EQ(2, *value);
+    EXPECT_THROW(handle.getArgument("one", value), NoSuchArgument);
+
+    // Delete an argument in the middle and replace the value of another.
+    handle.deleteArgument("three");
+    EXPECT_THROW(handle.getArgument("three", value), NoSuchArgument);
+    handle.setArgument("four", one);
+    handle.getArgument("four", value);
+    EXPECT_EQ(1, *value);
+    handle.setArgument("three", one);
+    handle.getArgument("three", value);
+    EXPECT_EQ(1, *value);
+    EXPECT_EQ(3, handle.getArgumentNames().size());
+}
+
+// Test that the arguments set by index are seen by name and vice versa.
+
+TEST_F(CalloutHandleTest, ArgumentIndex) {
+    ServerHooks& hooks = ServerHooks::getServerHooks();
+    const int one = hooks.registerArgument("test-index-one");
+    const int two = hooks.registerArgument("test-index-two");
+
+    CalloutHandle handle(getCalloutManager());
+    int value = 0;
+    EXPECT_THROW(handle.getArgument(one, value), NoSuchArgument);
+    EXPECT_THROW(handle.setArgument(1000000, value), isc::BadValue);
+
+    handle.setArgument(one, 1);
+    handle.setArgument("test-index-two", 2);
+    handle.setArgument("unregistered", 3);
+    handle.getArgument("test-index-one", value);
+    EXPECT_EQ(1, value);
+    handle.getArgument(two, value);
+    EXPECT_EQ(2, value);
+    EXPECT_THROW(handle.getArgument(-1, value), NoSuchArgument);
+
+    // The slots reused at the next hook point keep their index.
+    handle.deleteAllArguments();
+    EXPECT_THROW(handle.getArgument(one, value), NoSuchArgument);
+    handle.setArgument("test-index-two", 4);
+    handle.setArgument(one, 5);
+    handle.getArgument(two, value);
+    EXPECT_EQ(4, value);
+    handle.getArgument("test-index-one", value);
+    EXPECT_EQ(5, value);
+
+    handle.deleteArgument("test-index-two");
+    EXPECT_THROW(handle.getArgument(two, value), NoSuchArgument);
+    handle.getArgument(one, value);
+    EXPECT_EQ(5, value);
+    vector<string> expected_names;
+    expected_names.push_back("test-index-one");
+    EXPECT_TRUE(expected_names == handle.getArgumentNames());
+}
+
 // Test the "status" field.
 TEST_F(CalloutHandleTest, StatusField) {
     CalloutHandle handle(getCalloutManager());
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -939,6 +939,71 @@ TEST_F(CalloutManagerTest, VectorSize) {
 }
 
 
+// This test checks that the execution times of the callouts are recorded
+// by hook point and library.
+TEST_F(CalloutManagerTest, Latencies) {
+    // Nothing called yet.
+    EXPECT_TRUE(getCalloutManager()->getLatencies(vector<string>())->empty());
+
+    getCalloutManager()->setLibraryIndex(0);
+    getCalloutManager()->registerCallout("alpha", callout_one);
+    getCalloutManager()->setLibraryIndex(2);
+    getCalloutManager()->registerCallout("alpha", callout_two);
+    getCalloutManager()->registerCallout("alpha", callout_three);
+    getCalloutManager()->registerCallout("beta", callout_four);
+    getCalloutManager()->getPostLibraryHandle().registerCallout("alpha",
+                                                                callout_five);
+
+    for (int i = 0; i < 3; ++i) {
+        getCalloutManager()->callCallouts(alpha_index_, getCalloutHandle());
+    }
+
+    vector<string> names;
+    names.push_back("lib1.so");
+    names.push_back("lib2.so");
+    isc::data::ConstElementPtr latencies =
+        getCalloutManager()->getLatencies(names);
+    ASSERT_TRUE(latencies);
+    ASSERT_EQ(1, latencies->size());
+
+    // The callouts of all libraries were called 3 times.
+    isc::data::ConstElementPtr alpha = latencies->get("alpha");
+    ASSERT_TRUE(alpha);
+    ASSERT_TRUE(alpha->get("count"));
+    EXPECT_EQ(3, alpha->get("count")->intValue());
+    EXPECT_TRUE(alpha->get("min"));
+    EXPECT_TRUE(alpha->get("max"));
+    EXPECT_TRUE(alpha->get("mean"));
+    EXPECT_TRUE(alpha->get("p50"));
+    EXPECT_TRUE(alpha->get("p99.9"));
+
+    // The server callouts come before and after the library ones. The
+    // two callouts of the library were called 3 times each.
+    isc::data::ConstElementPtr libraries = alpha->get("libraries");
+    ASSERT_TRUE(libraries);
+    ASSERT_EQ(3, libraries->size());
+    EXPECT_EQ(0, libraries->get(0)->get("index")->intValue());
+    EXPECT_FALSE(libraries->get(0)->get("library"));
+    EXPECT_EQ(3, libraries->get(0)->get("count")->intValue());
+    EXPECT_EQ(2, libraries->get(1)->get("index")->intValue());
+    ASSERT_TRUE(libraries->get(1)->get("library"));
+    EXPECT_EQ("lib2.so", libraries->get(1)->get("library")->stringValue());
+    EXPECT_EQ(6, libraries->get(1)->get("count")->intValue());
+    EXPECT_EQ(INT_MAX, libraries->get(2)->get("index")->intValue());
+    EXPECT_EQ(3, libraries->get(2)->get("count")->intValue());
+
+    // The reset latencies are not reported.
+    getCalloutManager()->resetLatencies();
+    EXPECT_TRUE(getCalloutManager()->getLatencies(names)->empty());
+
+    getCalloutManager()->callCallouts(beta_index_, getCalloutHandle());
+    latencies = getCalloutManager()->getLatencies(names);
+    ASSERT_EQ(1, latencies->size());
+    ASSERT_TRUE(latencies->get("beta"));
+    EXPECT_EQ(1, latencies->get("beta")->get("count")->intValue());
+}
+
+
 // The setting of the hook index is checked in the handles_unittest
 // set of tests, as access restrictions mean it is not easily tested
 // on its own.
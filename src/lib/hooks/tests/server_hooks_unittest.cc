@@ -219,6 +219,25 @@ TEST(ServerHooksTest, HookToCommandName) {
     EXPECT_TRUE(ServerHooks::hookToCommandName("abc").empty());
 }
 
+// Check that the arguments are registered once and survive a reset.
+
+TEST(ServerHooksTest, RegisterArgument) {
+    ServerHooks& hooks = ServerHooks::getServerHooks();
+    int alpha = hooks.registerArgument("test-argument-alpha");
+    int beta = hooks.registerArgument("test-argument-beta");
+    EXPECT_LE(0, alpha);
+    EXPECT_NE(alpha, beta);
+    EXPECT_EQ(alpha, hooks.registerArgument("test-argument-alpha"));
+
+    hooks.reset();
+    EXPECT_EQ(alpha, hooks.findArgumentIndex("test-argument-alpha"));
+    EXPECT_EQ(beta, hooks.findArgumentIndex("test-argument-beta"));
+    EXPECT_EQ(-1, hooks.findArgumentIndex("test-argument-gamma"));
+    EXPECT_EQ("test-argument-beta", hooks.getArgumentName(beta));
+    EXPECT_THROW(hooks.getArgumentName(-1), isc::BadValue);
+    EXPECT_THROW(hooks.getArgumentName(1000000), isc::BadValue);
+}
+
 TEST(ServerHooksTest, getParkingLots) {
     ServerHooks& hooks = ServerHooks::getServerHooks();
     hooks.reset();
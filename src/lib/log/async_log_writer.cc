@@ -0,0 +1,311 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <log/async_log_writer.h>
+#include <log/log_formatter.h>
+#include <log/log_messages.h>
+#include <log/logger_impl.h>
+#include <log/logger_name.h>
+#include <log/message_dictionary.h>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <cstdlib>
+#include <utility>
+
+using namespace std;
+
+namespace {
+
+/// \brief Stops the writer used by the loggers at exit.
+///
+/// It is registered when the writer is first configured, so it runs
+/// before the log4cplus objects created earlier are destroyed.
+void
+stopInstance() {
+    isc::log::AsyncLogWriter::instance().stop();
+}
+
+} // end of anonymous namespace
+
+namespace isc {
+namespace log {
+
+const size_t AsyncLogWriter::DEFAULT_QUEUE_SIZE;
+
+AsyncLogWriter::AsyncLogWriter()
+    : mutex_(), not_empty_(), not_full_(), ring_(), head_(0), count_(0),
+      writing_(false), running_(false), stopping_(false), paused_(false),
+      policy_(BLOCK),
+      dropped_(0), reported_(0), thread_(), loggers_() {
+}
+
+AsyncLogWriter::~AsyncLogWriter() {
+    stop();
+}
+
+AsyncLogWriter&
+AsyncLogWriter::instance() {
+    static AsyncLogWriter writer;
+    return (writer);
+}
+
+void
+AsyncLogWriter::start(const size_t queue_size, const OverflowPolicy& policy) {
+    if (queue_size == 0) {
+        isc_throw(BadValue, "the asynchronous logging queue size must be"
+                  " greater than zero");
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        isc_throw(InvalidOperation, "the asynchronous logging is running");
+    }
+    ring_.clear();
+    ring_.resize(queue_size);
+    head_ = 0;
+    count_ = 0;
+    policy_ = policy;
+    stopping_ = false;
+    thread_ = std::thread(&AsyncLogWriter::run, this);
+    running_ = true;
+}
+
+void
+AsyncLogWriter::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        // Messages logged from now on are written synchronously.
+        running_ = false;
+        stopping_ = true;
+    }
+    not_empty_.notify_one();
+    // The blocked loggers write their messages synchronously.
+    not_full_.notify_all();
+    thread_.join();
+}
+
+bool
+AsyncLogWriter::push(const std::string& logger, const Severity& severity,
+                     std::string& message, std::vector<std::string>& args) {
+    const std::chrono::system_clock::time_point now =
+        std::chrono::system_clock::now();
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!running_) {
+        return (false);
+    }
+
+    if (count_ == ring_.size()) {
+        if (paused_) {
+            return (false);
+        }
+        if (policy_ != BLOCK) {
+            ++dropped_;
+            return (true);
+        }
+        not_full_.wait(lock, [this] {
+            return ((count_ < ring_.size()) || !running_ || paused_);
+        });
+        if (!running_ || (count_ == ring_.size())) {
+            return (false);
+        }
+    }
+
+    Entry& entry = ring_[(head_ + count_) % ring_.size()];
+    entry.logger_.assign(logger);
+    entry.severity_ = severity;
+    entry.message_.swap(message);
+    entry.args_.swap(args);
+    entry.time_ = now;
+    // The previous content of the slot is left in the caller's variables.
+    ++count_;
+    if (count_ == 1) {
+        lock.unlock();
+        not_empty_.notify_one();
+    }
+    return (true);
+}
+
+void
+AsyncLogWriter::flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_.wait(lock, [this] {
+        return (((count_ == 0) && !writing_) || !running_ || paused_);
+    });
+}
+
+void
+AsyncLogWriter::pause() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_.wait(lock, [this] {
+        return (((count_ == 0) && !writing_) || !running_);
+    });
+    paused_ = true;
+    // The loggers waiting for room write their messages synchronously.
+    not_full_.notify_all();
+}
+
+void
+AsyncLogWriter::resume() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        paused_ = false;
+    }
+    not_empty_.notify_one();
+}
+
+uint64_t
+AsyncLogWriter::getDroppedCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (dropped_);
+}
+
+void
+AsyncLogWriter::formatMessage(std::string& message,
+                              const std::vector<std::string>& args) {
+    for (size_t i = 0; i < args.size(); ++i) {
+        replacePlaceholder(&message, args[i], i + 1);
+    }
+    checkExcessPlaceholders(&message, args.size() + 1);
+}
+
+AsyncLogWriter::OverflowPolicy
+AsyncLogWriter::stringToPolicy(const std::string& policy) {
+    if (boost::iequals(policy, "block")) {
+        return (BLOCK);
+    } else if (boost::iequals(policy, "drop")) {
+        return (DROP);
+    } else if (boost::iequals(policy, "count")) {
+        return (COUNT);
+    }
+    isc_throw(BadValue, "invalid asynchronous logging overflow policy '"
+              << policy << "': expected block, drop or count");
+}
+
+void
+AsyncLogWriter::configure(const bool enable, const size_t queue_size,
+                          const OverflowPolicy& policy) {
+    AsyncLogWriter& writer = instance();
+    if (!enable) {
+        writer.stop();
+        return;
+    }
+
+    if (queue_size == 0) {
+        isc_throw(BadValue, "the asynchronous logging queue size must be"
+                  " greater than zero");
+    }
+
+    if (writer.isRunning()) {
+        if ((writer.getQueueSize() == queue_size) &&
+            (writer.getPolicy() == policy)) {
+            return;
+        }
+        // The pending messages are written before the queue is replaced.
+        writer.stop();
+    }
+
+    static bool registered = false;
+    writer.start(queue_size, policy);
+    if (!registered) {
+        registered = true;
+        atexit(stopInstance);
+    }
+}
+
+void
+AsyncLogWriter::write(const std::string& logger, const Severity& severity,
+                      const std::string& message,
+                      const std::chrono::system_clock::time_point& time) {
+    boost::shared_ptr<LoggerImpl>& impl = loggers_[logger];
+    if (!impl) {
+        impl.reset(new LoggerImpl(logger));
+    }
+    impl->outputRaw(severity, message, time);
+}
+
+void
+AsyncLogWriter::Entry::swap(Entry& other) {
+    logger_.swap(other.logger_);
+    std::swap(severity_, other.severity_);
+    message_.swap(other.message_);
+    args_.swap(other.args_);
+    std::swap(time_, other.time_);
+}
+
+void
+AsyncLogWriter::run() {
+    std::vector<Entry> batch;
+    for (;;) {
+        uint64_t dropped = 0;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            writing_ = false;
+            not_full_.notify_all();
+            not_empty_.wait(lock, [this] {
+                return (((count_ > 0) && !paused_) || stopping_);
+            });
+            if (count_ == 0) {
+                // Stopping and all the messages were written.
+                return;
+            }
+
+            // Take all the queued messages at once so the loggers don't
+            // wait for the writes.
+            batch.resize(count_);
+            for (size_t i = 0; i < count_; ++i) {
+                batch[i].swap(ring_[(head_ + i) % ring_.size()]);
+            }
+            head_ = (head_ + count_) % ring_.size();
+            count_ = 0;
+            writing_ = true;
+            if (policy_ == COUNT) {
+                dropped = dropped_ - reported_;
+                reported_ = dropped_;
+            }
+        }
+        not_full_.notify_all();
+
+        writeBatch(batch, dropped);
+    }
+}
+
+void
+AsyncLogWriter::writeBatch(std::vector<Entry>& batch, const uint64_t dropped) {
+    for (auto entry = batch.begin(); entry != batch.end(); ++entry) {
+        try {
+            formatMessage(entry->message_, entry->args_);
+            write(entry->logger_, entry->severity_, entry->message_,
+                  entry->time_);
+        } catch (...) {
+            // A broken message is not written, as by the formatter.
+        }
+        entry->args_.clear();
+    }
+
+    if (dropped > 0) {
+        try {
+            std::string message = std::string(LOG_ASYNC_MESSAGES_DROPPED) +
+                " " + MessageDictionary::globalDictionary()->
+                getText(LOG_ASYNC_MESSAGES_DROPPED);
+            replacePlaceholder(&message, boost::lexical_cast<std::string>(dropped),
+                               1);
+            write(getRootLoggerName(), WARN, message,
+                  std::chrono::system_clock::now());
+        } catch (...) {
+            // Nothing more can be done.
+        }
+    }
+}
+
+} // namespace log
+} // namespace isc
@@ -0,0 +1,264 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef ASYNC_LOG_WRITER_H
+#define ASYNC_LOG_WRITER_H
+
+#include <exceptions/exceptions.h>
+#include <log/logger_level.h>
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace isc {
+namespace log {
+
+class LoggerImpl;
+
+/// \brief Writes the log messages from a background thread.
+///
+/// When the asynchronous logging is enabled, the formatters don't replace
+/// the placeholders of the messages: the text of the message and the
+/// arguments converted to strings are queued, and a background thread
+/// replaces the placeholders and writes the messages through the log4cplus
+/// appenders. The thread logging the message doesn't wait for the
+/// appenders, the file locks or the system calls of the destinations.
+///
+/// The messages are queued in a bounded ring whose slots are reused: the
+/// strings of a message are moved to the ring rather than copied. When the
+/// ring is full, the overflow policy decides what happens to a new message:
+/// - \c BLOCK: the logging thread waits for room, no message is lost.
+/// - \c DROP: the message is discarded.
+/// - \c COUNT: the message is discarded and the number of discarded messages
+///   is logged once room is available again.
+///
+/// The messages are written in the order they were logged. The time a
+/// message is logged is queued with it, so its timestamp doesn't include
+/// the time it waited in the queue.
+class AsyncLogWriter : public boost::noncopyable {
+public:
+
+    /// \brief What to do with a message when the queue is full.
+    enum OverflowPolicy {
+        BLOCK,
+        DROP,
+        COUNT
+    };
+
+    /// \brief Default number of messages the queue holds.
+    static const size_t DEFAULT_QUEUE_SIZE = 8192;
+
+    /// \brief Constructor.
+    ///
+    /// The writer is stopped.
+    AsyncLogWriter();
+
+    /// \brief Destructor.
+    ///
+    /// Writes the pending messages and stops the thread.
+    virtual ~AsyncLogWriter();
+
+    /// \brief Returns the writer used by the loggers.
+    static AsyncLogWriter& instance();
+
+    /// \brief Starts the background thread.
+    ///
+    /// \param queue_size number of messages the queue holds.
+    /// \param policy overflow policy.
+    /// \throw isc::BadValue if the queue size is zero.
+    /// \throw isc::InvalidOperation if the writer is running.
+    void start(const size_t queue_size, const OverflowPolicy& policy);
+
+    /// \brief Writes the pending messages and stops the background thread.
+    ///
+    /// Does nothing if the writer is not running.
+    void stop();
+
+    /// \brief Checks if the background thread is running.
+    bool isRunning() const {
+        return (running_);
+    }
+
+    /// \brief Queues a message.
+    ///
+    /// The content of the strings and of the vector is moved to the queue.
+    ///
+    /// \param logger full name of the logger.
+    /// \param severity severity of the message.
+    /// \param message text of the message with its placeholders.
+    /// \param args arguments replacing the placeholders, in order.
+    /// \return false if the writer is not running and the message was not
+    /// queued, true otherwise, including when it was dropped.
+    bool push(const std::string& logger, const Severity& severity,
+              std::string& message, std::vector<std::string>& args);
+
+    /// \brief Waits until all the queued messages were written.
+    void flush();
+
+    /// \brief Writes the queued messages and suspends the writes.
+    ///
+    /// The messages logged while the writer is paused are queued and
+    /// written once it is resumed. When the queue is full they are
+    /// written synchronously, whatever the overflow policy, so a paused
+    /// writer never blocks the logging thread, and \ref flush returns
+    /// at once. Used while the appenders are replaced.
+    void pause();
+
+    /// \brief Resumes the writes suspended by \ref pause.
+    void resume();
+
+    /// \brief Returns the overflow policy.
+    OverflowPolicy getPolicy() const {
+        return (policy_);
+    }
+
+    /// \brief Returns the number of messages the queue holds.
+    size_t getQueueSize() const {
+        return (ring_.size());
+    }
+
+    /// \brief Returns the number of messages dropped since the writer
+    /// was created.
+    uint64_t getDroppedCount() const;
+
+    /// \brief Replaces the placeholders of a message by its arguments.
+    ///
+    /// \param message the text of the message, updated.
+    /// \param args the arguments.
+    static void formatMessage(std::string& message,
+                              const std::vector<std::string>& args);
+
+    /// \brief Converts the name of an overflow policy.
+    ///
+    /// \param policy "block", "drop" or "count", case insensitive.
+    /// \return The overflow policy.
+    /// \throw isc::BadValue if the name is not recognized.
+    static OverflowPolicy stringToPolicy(const std::string& policy);
+
+    /// \brief Configures the writer returned by \ref instance.
+    ///
+    /// Starts the writer, restarts it when its queue size or overflow
+    /// policy changes, or stops it.
+    ///
+    /// \param enable true to log asynchronously, false to stop the writer.
+    /// \param queue_size number of messages the queue holds.
+    /// \param policy overflow policy.
+    /// \throw isc::BadValue if the writer is enabled with a zero queue size.
+    static void configure(const bool enable, const size_t queue_size,
+                          const OverflowPolicy& policy);
+
+protected:
+
+    /// \brief Writes a formatted message.
+    ///
+    /// Called from the background thread. The default implementation
+    /// writes the message through the log4cplus logger of the given name.
+    ///
+    /// \param logger full name of the logger.
+    /// \param severity severity of the message.
+    /// \param message the formatted message.
+    /// \param time the time the message was logged.
+    virtual void write(const std::string& logger, const Severity& severity,
+                       const std::string& message,
+                       const std::chrono::system_clock::time_point& time);
+
+private:
+
+    /// \brief Queued message.
+    struct Entry {
+        /// \brief Full name of the logger.
+        std::string logger_;
+
+        /// \brief Severity of the message.
+        Severity severity_;
+
+        /// \brief Text of the message with its placeholders.
+        std::string message_;
+
+        /// \brief Arguments of the message.
+        std::vector<std::string> args_;
+
+        /// \brief Time the message was logged.
+        std::chrono::system_clock::time_point time_;
+
+        /// \brief Exchanges the content of two entries.
+        ///
+        /// \param other the other entry.
+        void swap(Entry& other);
+    };
+
+    /// \brief Body of the background thread.
+    void run();
+
+    /// \brief Formats and writes a batch of messages.
+    ///
+    /// \param batch the messages.
+    /// \param dropped number of messages dropped before the batch was
+    /// taken, reported with the \c COUNT policy.
+    void writeBatch(std::vector<Entry>& batch, const uint64_t dropped);
+
+    /// \brief Protects the queue and the state.
+    mutable std::mutex mutex_;
+
+    /// \brief Signaled when a message is queued or the writer is stopped.
+    std::condition_variable not_empty_;
+
+    /// \brief Signaled when messages were taken from the queue or written.
+    std::condition_variable not_full_;
+
+    /// \brief The ring of queued messages.
+    std::vector<Entry> ring_;
+
+    /// \brief Index of the oldest queued message.
+    size_t head_;
+
+    /// \brief Number of queued messages.
+    size_t count_;
+
+    /// \brief Whether the background thread is writing a batch.
+    bool writing_;
+
+    /// \brief Whether the writer is running.
+    ///
+    /// It is checked without the mutex for each logged message.
+    std::atomic<bool> running_;
+
+    /// \brief Whether the background thread was asked to stop.
+    bool stopping_;
+
+    /// \brief Whether the writes are suspended.
+    bool paused_;
+
+    /// \brief Overflow policy.
+    OverflowPolicy policy_;
+
+    /// \brief Number of dropped messages.
+    uint64_t dropped_;
+
+    /// \brief Number of dropped messages already reported.
+    uint64_t reported_;
+
+    /// \brief The background thread.
+    std::thread thread_;
+
+    /// \brief Loggers used by the background thread, by name.
+    std::map<std::string, boost::shared_ptr<LoggerImpl> > loggers_;
+};
+
+} // namespace log
+} // namespace isc
+
+#endif // ASYNC_LOG_WRITER_H
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2015,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -10,6 +10,7 @@
 #include <cstddef>
 #include <string>
 #include <iostream>
+#include <vector>
 
 #include <exceptions/exceptions.h>
 #include <boost/lexical_cast.hpp>
@@ -99,6 +100,11 @@ replacePlaceholder(std::string* message, const std::string& replacement,
 /// destroyed before any call to .arg, producing an output, and then the one
 /// the .arg calls are called on would get destroyed as well, producing output
 /// again. So, think of this behavior as soul moving from one to another.
+///
+/// A deferred formatter doesn't replace the placeholders: it collects the
+/// arguments and hands them with the message to the logger's
+/// outputDeferred() method, which may format the message later, e.g. in
+/// another thread.
 template<class Logger> class Formatter {
 private:
     /// \brief The logger we will use to output the final message.
@@ -115,6 +121,12 @@ private:
     /// \brief Which will be the next placeholder to replace
     unsigned nextPlaceholder_;
 
+    /// \brief Whether the replacement of the placeholders is deferred
+    bool deferred_;
+
+    /// \brief The arguments of a deferred formatter
+    mutable std::vector<std::string> args_;
+
 
 public:
     /// \brief Constructor of "active" formatter
@@ -131,10 +143,12 @@ public:
     ///     logger is also NULL, but it's not checked.
     /// \param logger The logger where the final output will go, or NULL
     ///     if no output is wanted.
+    /// \param deferred Whether the placeholders are replaced by the logger
+    ///     rather than by the formatter.
     Formatter(const Severity& severity = NONE, std::string* message = NULL,
-              Logger* logger = NULL) :
+              Logger* logger = NULL, bool deferred = false) :
         logger_(logger), severity_(severity), message_(message),
-        nextPlaceholder_(0)
+        nextPlaceholder_(0), deferred_(deferred), args_()
     {
     }
 
@@ -145,8 +159,10 @@ public:
     /// object being copied relinquishes that responsibility.
     Formatter(const Formatter& other) :
         logger_(other.logger_), severity_(other.severity_),
-        message_(other.message_), nextPlaceholder_(other.nextPlaceholder_)
+        message_(other.message_), nextPlaceholder_(other.nextPlaceholder_),
+        deferred_(other.deferred_), args_()
     {
+        args_.swap(other.args_);
         other.logger_ = NULL;
     }
 
@@ -156,8 +172,12 @@ public:
     ~ Formatter() {
         if (logger_) {
             try {
-                checkExcessPlaceholders(message_, ++nextPlaceholder_);
-                logger_->output(severity_, *message_);
+                if (deferred_) {
+                    logger_->outputDeferred(severity_, *message_, args_);
+                } else {
+                    checkExcessPlaceholders(message_, ++nextPlaceholder_);
+                    logger_->output(severity_, *message_);
+                }
             } catch (...) {
                 // Catch and ignore all exceptions here.
             }
@@ -175,6 +195,9 @@ public:
             severity_ = other.severity_;
             message_ = other.message_;
             nextPlaceholder_ = other.nextPlaceholder_;
+            deferred_ = other.deferred_;
+            args_.swap(other.args_);
+            other.args_.clear();
             other.logger_ = NULL;
         }
 
@@ -227,6 +250,11 @@ public:
             // occurrences of "%2" with 42. (Conversely, the sequence
             // .arg(42).arg("%1") would return "42 %1" - there are no recursive
             // replacements).
+            if (deferred_) {
+                // The logger replaces the placeholders in the same order.
+                args_.push_back(arg);
+                return (*this);
+            }
             try {
                 replacePlaceholder(message_, arg, ++nextPlaceholder_ );
             }
@@ -254,6 +282,7 @@ public:
             delete message_;
             message_ = NULL;
             logger_ = NULL;
+            args_.clear();
         }
     }
 };
@@ -9,6 +9,7 @@
 namespace isc {
 namespace log {
 
+extern const isc::log::MessageID LOG_ASYNC_MESSAGES_DROPPED = "LOG_ASYNC_MESSAGES_DROPPED";
 extern const isc::log::MessageID LOG_BAD_DESTINATION = "LOG_BAD_DESTINATION";
 extern const isc::log::MessageID LOG_BAD_SEVERITY = "LOG_BAD_SEVERITY";
 extern const isc::log::MessageID LOG_BAD_STREAM = "LOG_BAD_STREAM";
@@ -36,6 +37,7 @@ extern const isc::log::MessageID LOG_WRITE_ERROR = "LOG_WRITE_ERROR";
 namespace {
 
 const char* values[] = {
+    "LOG_ASYNC_MESSAGES_DROPPED", "%1 log messages were dropped as the asynchronous logging queue was full",
     "LOG_BAD_DESTINATION", "unrecognized log destination: %1",
     "LOG_BAD_SEVERITY", "unrecognized log severity: %1",
     "LOG_BAD_STREAM", "bad log console output stream: %1",
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2015,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,6 +9,7 @@
 #include <stdarg.h>
 #include <stdio.h>
 
+#include <log/async_log_writer.h>
 #include <log/logger.h>
 #include <log/logger_impl.h>
 #include <log/logger_name.h>
@@ -134,11 +135,26 @@ Logger::output(const Severity& severity, const std::string& message) {
     getLoggerPtr()->outputRaw(severity, message);
 }
 
+void
+Logger::outputDeferred(const Severity& severity, std::string& message,
+                       std::vector<std::string>& args) {
+    if (!AsyncLogWriter::instance().push(getLoggerPtr()->getName(), severity,
+                                         message, args)) {
+        AsyncLogWriter::formatMessage(message, args);
+        output(severity, message);
+    }
+}
+
+bool
+Logger::isAsync() {
+    return (AsyncLogWriter::instance().isRunning());
+}
+
 Logger::Formatter
 Logger::debug(int dbglevel, const isc::log::MessageID& ident) {
     if (isDebugEnabled(dbglevel)) {
         return (Formatter(DEBUG, getLoggerPtr()->lookupMessage(ident),
-                          this));
+                          this, isAsync()));
     } else {
         return (Formatter());
     }
@@ -148,7 +164,7 @@ Logger::Formatter
 Logger::info(const isc::log::MessageID& ident) {
     if (isInfoEnabled()) {
         return (Formatter(INFO, getLoggerPtr()->lookupMessage(ident),
-                          this));
+                          this, isAsync()));
     } else {
         return (Formatter());
     }
@@ -158,7 +174,7 @@ Logger::Formatter
 Logger::warn(const isc::log::MessageID& ident) {
     if (isWarnEnabled()) {
         return (Formatter(WARN, getLoggerPtr()->lookupMessage(ident),
-                          this));
+                          this, isAsync()));
     } else {
         return (Formatter());
     }
@@ -168,7 +184,7 @@ Logger::Formatter
 Logger::error(const isc::log::MessageID& ident) {
     if (isErrorEnabled()) {
         return (Formatter(ERROR, getLoggerPtr()->lookupMessage(ident),
-                          this));
+                          this, isAsync()));
     } else {
         return (Formatter());
     }
@@ -178,7 +194,7 @@ Logger::Formatter
 Logger::fatal(const isc::log::MessageID& ident) {
     if (isFatalEnabled()) {
         return (Formatter(FATAL, getLoggerPtr()->lookupMessage(ident),
-                          this));
+                          this, isAsync()));
     } else {
         return (Formatter());
     }
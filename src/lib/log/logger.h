@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2015,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -11,6 +11,7 @@
 #include <cstdlib>
 #include <string>
 #include <cstring>
+#include <vector>
 
 #include <boost/static_assert.hpp>
 
@@ -320,6 +321,22 @@ private:
     /// \param message Text of the message to be output.
     void output(const Severity& severity, const std::string& message);
 
+    /// \brief Deferred output function
+    ///
+    /// This is used by the deferred formatter, when the asynchronous logging
+    /// is enabled, to queue the message and its arguments for the
+    /// background writer. The message is formatted and output immediately
+    /// if the writer was stopped meanwhile.
+    ///
+    /// \param severity Severity of the message being output.
+    /// \param message Text of the message with its placeholders, moved.
+    /// \param args Arguments of the message, moved.
+    void outputDeferred(const Severity& severity, std::string& message,
+                        std::vector<std::string>& args);
+
+    /// \brief Returns whether the messages are formatted asynchronously.
+    static bool isAsync();
+
     /// \brief Copy Constructor
     ///
     /// Disabled (marked private) as it makes no sense to copy the logger -
@@ -21,6 +21,7 @@
 #include <log4cplus/version.h>
 #include <log4cplus/configurator.h>
 #include <log4cplus/loggingmacros.h>
+#include <log4cplus/spi/loggingevent.h>
 
 #include <log/logger.h>
 #include <log/logger_impl.h>
@@ -41,6 +42,41 @@
 
 using namespace std;
 
+namespace {
+
+/// @brief log4cplus logging event with a given timestamp.
+///
+/// The log4cplus events take the current time when they are created: the
+/// timestamp is protected, so it is replaced by a derived class.
+class TimedLoggingEvent : public log4cplus::spi::InternalLoggingEvent {
+public:
+    /// @brief Constructor.
+    ///
+    /// @param logger name of the logger.
+    /// @param level log4cplus level of the message.
+    /// @param message text of the message.
+    /// @param time time the message was logged.
+    TimedLoggingEvent(const log4cplus::tstring& logger,
+                      const log4cplus::LogLevel level,
+                      const log4cplus::tstring& message,
+                      const std::chrono::system_clock::time_point& time)
+        : log4cplus::spi::InternalLoggingEvent(logger, level, message,
+                                               NULL, -1) {
+#if LOG4CPLUS_VERSION < LOG4CPLUS_MAKE_VERSION(2, 0, 0)
+        const int64_t usecs =
+            std::chrono::duration_cast<std::chrono::microseconds>
+            (time.time_since_epoch()).count();
+        timestamp = log4cplus::helpers::Time(usecs / 1000000,
+                                             usecs % 1000000);
+#else
+        timestamp = std::chrono::time_point_cast<
+            log4cplus::helpers::Time::duration>(time);
+#endif
+    }
+};
+
+} // end of anonymous namespace
+
 namespace isc {
 namespace log {
 
@@ -197,5 +233,32 @@ LoggerImpl::outputRaw(const Severity& severity, const string& message) {
     }
 }
 
+void
+LoggerImpl::outputRaw(const Severity& severity, const string& message,
+                      const std::chrono::system_clock::time_point& time) {
+    if ((severity == NONE) || (severity == DEFAULT)) {
+        outputRaw(severity, message);
+        return;
+    }
+    const log4cplus::LogLevel level =
+        LoggerLevelImpl::convertFromBindLevel(Level(severity));
+    if (!logger_.isEnabledFor(level)) {
+        return;
+    }
+    TimedLoggingEvent event(logger_.getName(), level, message, time);
+
+    isc::util::thread::Mutex::Locker mutex_locker(LoggerManager::getMutex());
+    interprocess::InterprocessSyncLocker locker(*sync_);
+    if (!locker.lock()) {
+        LOG4CPLUS_ERROR(logger_, "Unable to lock logger lockfile");
+    }
+
+    logger_.callAppenders(event);
+
+    if (!locker.unlock()) {
+        LOG4CPLUS_ERROR(logger_, "Unable to unlock logger lockfile");
+    }
+}
+
 } // namespace log
 } // namespace isc
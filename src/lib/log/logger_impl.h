@@ -10,6 +10,7 @@
 #include <stdarg.h>
 #include <time.h>
 
+#include <chrono>
 #include <iostream>
 #include <cstdlib>
 #include <string>
@@ -160,6 +161,17 @@ public:
     /// \param message Text of the message.
     void outputRaw(const Severity& severity, const std::string& message);
 
+    /// \brief Raw output with a given time
+    ///
+    /// Writes the message into the log with the time it was logged rather
+    /// than the current time. Used by the asynchronous writer.
+    ///
+    /// \param severity Severity of the message.
+    /// \param message Text of the message.
+    /// \param time Time the message was logged.
+    void outputRaw(const Severity& severity, const std::string& message,
+                   const std::chrono::system_clock::time_point& time);
+
     /// \brief Look up message text in dictionary
     ///
     /// This gets you the unformatted text of message for given ID.
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2015,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <vector>
 
+#include <log/async_log_writer.h>
 #include <log/logger.h>
 #include <log/logger_manager.h>
 #include <log/logger_manager_impl.h>
@@ -68,6 +69,9 @@ LoggerManager::~LoggerManager() {
 // Initialize processing
 void
 LoggerManager::processInit() {
+    // The background writer must not use the appenders being replaced:
+    // it is paused until the new ones are in place.
+    AsyncLogWriter::instance().pause();
     impl_->processInit();
 }
 
@@ -81,6 +85,7 @@ LoggerManager::processSpecification(const LoggerSpecification& spec) {
 void
 LoggerManager::processEnd() {
     impl_->processEnd();
+    AsyncLogWriter::instance().resume();
 }
 
 
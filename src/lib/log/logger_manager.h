@@ -54,8 +54,14 @@ public:
     template <typename T>
     void process(T start, T finish) {
         processInit();
-        for (T i = start; i != finish; ++i) {
-            processSpecification(*i);
+        try {
+            for (T i = start; i != finish; ++i) {
+                processSpecification(*i);
+            }
+        } catch (...) {
+            // Resume the asynchronous writer paused by processInit.
+            processEnd();
+            throw;
         }
         processEnd();
     }
@@ -67,7 +73,12 @@ public:
     /// \param spec Specification to process
     void process(const LoggerSpecification& spec) {
         processInit();
-        processSpecification(spec);
+        try {
+            processSpecification(spec);
+        } catch (...) {
+            processEnd();
+            throw;
+        }
         processEnd();
     }
 
@@ -146,7 +157,8 @@ private:
     /// Initializes the processing of a list of specifications by resetting all
     /// loggers to their defaults, which is to pass the message to their
     /// parent logger.  (Except for the root logger, where the default action is
-    /// to output the message.)
+    /// to output the message.)  The asynchronous writer is paused until
+    /// \ref processEnd is called.
     void processInit();
 
     /// \brief Process Logging Specification
@@ -157,7 +169,9 @@ private:
 
     /// \brief End Processing
     ///
-    /// Place holder for finish processing.
+    /// Flushes the buffered messages, starts or stops the asynchronous
+    /// logging as configured by the output options, and resumes the
+    /// asynchronous writer.
     /// TODO: Check that the root logger has something enabled
     void processEnd();
 
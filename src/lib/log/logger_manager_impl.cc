@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2017,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -18,6 +18,7 @@
 #include <log4cplus/helpers/loglog.h>
 #include <log4cplus/version.h>
 
+#include <log/async_log_writer.h>
 #include <log/logger.h>
 #include <log/logger_support.h>
 #include <log/logger_level_impl.h>
@@ -47,11 +48,20 @@ LoggerManagerImpl::processInit() {
 
     log4cplus::Logger::getDefaultHierarchy().resetConfiguration();
     initRootLogger();
+
+    async_ = false;
+    async_queue_size_ = 0;
+    async_policy_ = AsyncLogWriter::BLOCK;
 }
 
-// Flush the BufferAppenders at the end of processing a new specification
+// Start, restart or stop the asynchronous logging as configured and flush
+// the BufferAppenders at the end of processing a new specification
 void
 LoggerManagerImpl::processEnd() {
+    AsyncLogWriter::configure(async_,
+                              async_queue_size_ > 0 ? async_queue_size_ :
+                              AsyncLogWriter::DEFAULT_QUEUE_SIZE,
+                              async_policy_);
     flushBufferAppenders();
 }
 
@@ -77,6 +87,15 @@ LoggerManagerImpl::processSpecification(const LoggerSpecification& spec) {
         // Now process output specifications.
         for (LoggerSpecification::const_iterator i = spec.begin();
              i != spec.end(); ++i) {
+            if (!i->async.empty()) {
+                if (!async_) {
+                    async_policy_ = AsyncLogWriter::stringToPolicy(i->async);
+                    async_ = true;
+                }
+                async_queue_size_ = std::max(async_queue_size_,
+                                             i->async_queue_size);
+            }
+
             switch (i->destination) {
             case OutputOption::DEST_CONSOLE:
                 createConsoleAppender(logger, *i);
@@ -121,18 +140,20 @@ LoggerManagerImpl::createConsoleAppender(log4cplus::Logger& logger,
 // log4cplus internally avoids race in rolling over the files by multiple
 // processes.  This feature isn't supported in log4cplus 1.0.x, but setting
 // the property unconditionally is okay as unknown properties are simply
-// ignored.
+// ignored.  When the output option enables the asynchronous logging the
+// file is not flushed after each message: the writes are buffered.
 void
 LoggerManagerImpl::createFileAppender(log4cplus::Logger& logger,
                                       const OutputOption& opt)
 {
     // Append to existing file
     const std::ios::openmode mode = std::ios::app;
+    const bool flush = opt.flush && opt.async.empty();
 
     log4cplus::SharedAppenderPtr fileapp;
     if (opt.maxsize == 0) {
         fileapp = log4cplus::SharedAppenderPtr(new log4cplus::FileAppender(
-            opt.filename, mode, opt.flush));
+            opt.filename, mode, flush));
     } else {
         log4cplus::helpers::Properties properties;
         properties.setProperty("File", opt.filename);
@@ -140,7 +161,7 @@ LoggerManagerImpl::createFileAppender(log4cplus::Logger& logger,
                                lexical_cast<string>(opt.maxsize));
         properties.setProperty("MaxBackupIndex",
                                lexical_cast<string>(opt.maxver));
-        properties.setProperty("ImmediateFlush", opt.flush ? "true" : "false");
+        properties.setProperty("ImmediateFlush", flush ? "true" : "false");
         properties.setProperty("UseLockFile", "true");
         fileapp = log4cplus::SharedAppenderPtr(
             new log4cplus::RollingFileAppender(properties));
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2015,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -10,6 +10,7 @@
 #include <string>
 
 #include <log4cplus/appender.h>
+#include <log/async_log_writer.h>
 #include <log/logger_level.h>
 
 // Forward declaration to avoid need to include log4cplus header file here.
@@ -43,7 +44,10 @@ class LoggerManagerImpl {
 public:
 
     /// \brief Constructor
-    LoggerManagerImpl() {}
+    LoggerManagerImpl()
+        : async_(false), async_queue_size_(0),
+          async_policy_(AsyncLogWriter::BLOCK) {
+    }
 
     /// \brief Initialize Processing
     ///
@@ -57,11 +61,16 @@ public:
     /// Processes the specification for a single logger.
     ///
     /// \param spec Logging specification for this logger
-    static void processSpecification(const LoggerSpecification& spec);
+    /// \throw isc::BadValue if the asynchronous logging overflow policy of
+    /// an output option is not valid.
+    void processSpecification(const LoggerSpecification& spec);
 
     /// \brief End Processing
     ///
-    /// Terminates the processing of the logging specifications.
+    /// Terminates the processing of the logging specifications.  The
+    /// asynchronous logging is enabled when an output option of the
+    /// specifications enables it, with the overflow policy of the first
+    /// such option and the largest queue size, and is disabled otherwise.
     void processEnd();
 
     /// \brief Implementation-specific initialization
@@ -185,6 +194,12 @@ private:
     /// store the buffer appenders in order to flush them after
     /// processSpecification() calls have been completed
     std::vector<log4cplus::SharedAppenderPtr> buffer_appender_store_;
+
+    /// Only used between processInit() and processEnd(): whether an output
+    /// option enables the asynchronous logging, and its settings.
+    bool async_;
+    size_t async_queue_size_;
+    AsyncLogWriter::OverflowPolicy async_policy_;
 };
 
 } // namespace log
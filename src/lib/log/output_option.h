@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2015,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -53,7 +53,7 @@ struct OutputOption {
     /// \brief Constructor
     OutputOption() : destination(DEST_CONSOLE), stream(STR_STDERR),
                      flush(true), facility("LOCAL0"), filename(""),
-                     maxsize(0), maxver(0)
+                     maxsize(0), maxver(0), async(""), async_queue_size(0)
     {}
 
     /// Members. 
@@ -65,6 +65,8 @@ struct OutputOption {
     std::string     filename;           ///< Filename if file output
     size_t          maxsize;            ///< 0 if no maximum size
     unsigned int    maxver;             ///< Maximum versions (none if <= 0)
+    std::string     async;              ///< Overflow policy if asynchronous
+    size_t          async_queue_size;   ///< Asynchronous logging queue size
 };
 
 OutputOption::Destination getDestination(const std::string& dest_str);
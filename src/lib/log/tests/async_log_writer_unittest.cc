@@ -0,0 +1,317 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <log/async_log_writer.h>
+#include <log/log_messages.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace isc;
+using namespace isc::log;
+using namespace std;
+
+namespace {
+
+/// \brief Writer recording the written messages.
+///
+/// The writes may be held to fill the queue.
+class TestWriter : public AsyncLogWriter {
+public:
+    /// \brief Constructor.
+    TestWriter() : held_(false), holding_(false) {
+    }
+
+    /// \brief Destructor.
+    ///
+    /// Stops the thread before the members it uses are destroyed.
+    virtual ~TestWriter() {
+        release();
+        stop();
+    }
+
+    /// \brief Holds the next write until \ref release is called.
+    void hold() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        held_ = true;
+    }
+
+    /// \brief Waits until a write is held.
+    void waitHolding() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cond_.wait(lock, [this] { return (holding_); });
+    }
+
+    /// \brief Releases the held write.
+    void release() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            held_ = false;
+        }
+        cond_.notify_all();
+    }
+
+    /// \brief Queues a message.
+    ///
+    /// \param message the text of the message.
+    /// \param arg the argument of the message, if any.
+    /// \return the value returned by push.
+    bool log(const std::string& message, const char* arg = NULL) {
+        std::string text(message);
+        std::vector<std::string> args;
+        if (arg) {
+            args.push_back(arg);
+        }
+        return (push("kea.test", INFO, text, args));
+    }
+
+    /// \brief Returns the written messages.
+    std::vector<std::string> getWritten() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return (written_);
+    }
+
+    /// \brief Returns the times of the written messages.
+    std::vector<std::chrono::system_clock::time_point> getTimes() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return (times_);
+    }
+
+protected:
+    /// \brief Records a written message.
+    virtual void write(const std::string& logger, const Severity&,
+                       const std::string& message,
+                       const std::chrono::system_clock::time_point& time) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        holding_ = held_;
+        cond_.notify_all();
+        cond_.wait(lock, [this] { return (!held_); });
+        holding_ = false;
+        written_.push_back(logger + ": " + message);
+        times_.push_back(time);
+    }
+
+private:
+    /// \brief Protects the members.
+    std::mutex mutex_;
+
+    /// \brief Signaled when a write is held or released.
+    std::condition_variable cond_;
+
+    /// \brief Whether the writes are held.
+    bool held_;
+
+    /// \brief Whether a write is held.
+    bool holding_;
+
+    /// \brief The written messages.
+    std::vector<std::string> written_;
+
+    /// \brief The times of the written messages.
+    std::vector<std::chrono::system_clock::time_point> times_;
+};
+
+// This test verifies that the writer is started and stopped.
+TEST(AsyncLogWriterTest, startStop) {
+    TestWriter writer;
+    EXPECT_FALSE(writer.isRunning());
+    // Not queued when the writer is stopped.
+    EXPECT_FALSE(writer.log("message"));
+
+    EXPECT_THROW(writer.start(0, AsyncLogWriter::BLOCK), BadValue);
+    ASSERT_NO_THROW(writer.start(16, AsyncLogWriter::DROP));
+    EXPECT_TRUE(writer.isRunning());
+    EXPECT_EQ(16, writer.getQueueSize());
+    EXPECT_EQ(AsyncLogWriter::DROP, writer.getPolicy());
+    EXPECT_THROW(writer.start(16, AsyncLogWriter::BLOCK), InvalidOperation);
+
+    // The pending messages are written when the writer is stopped.
+    EXPECT_TRUE(writer.log("message %1", "one"));
+    writer.stop();
+    EXPECT_FALSE(writer.isRunning());
+    ASSERT_EQ(1, writer.getWritten().size());
+    EXPECT_FALSE(writer.log("message"));
+
+    // It can be started again.
+    ASSERT_NO_THROW(writer.start(4, AsyncLogWriter::BLOCK));
+    EXPECT_TRUE(writer.isRunning());
+}
+
+// This test verifies that the messages are formatted and written in order.
+TEST(AsyncLogWriterTest, write) {
+    TestWriter writer;
+    ASSERT_NO_THROW(writer.start(4, AsyncLogWriter::BLOCK));
+
+    // More messages than the queue holds: the logger waits for room.
+    for (int i = 0; i < 10; ++i) {
+        std::string arg = std::to_string(i);
+        ASSERT_TRUE(writer.log("message %1", arg.c_str()));
+    }
+    writer.flush();
+
+    std::vector<std::string> written = writer.getWritten();
+    ASSERT_EQ(10, written.size());
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ("kea.test: message " + std::to_string(i), written[i]);
+    }
+    EXPECT_EQ(0, writer.getDroppedCount());
+}
+
+// This test verifies that the messages are dropped when the queue is full
+// with the drop policy.
+TEST(AsyncLogWriterTest, drop) {
+    TestWriter writer;
+    ASSERT_NO_THROW(writer.start(2, AsyncLogWriter::DROP));
+
+    // Hold the write of the first message, then fill the queue.
+    writer.hold();
+    ASSERT_TRUE(writer.log("first"));
+    writer.waitHolding();
+    ASSERT_TRUE(writer.log("second"));
+    ASSERT_TRUE(writer.log("third"));
+    ASSERT_TRUE(writer.log("dropped"));
+    EXPECT_EQ(1, writer.getDroppedCount());
+
+    writer.release();
+    writer.flush();
+    std::vector<std::string> written = writer.getWritten();
+    ASSERT_EQ(3, written.size());
+    EXPECT_EQ("kea.test: third", written[2]);
+}
+
+// This test verifies that the number of dropped messages is logged with
+// the count policy.
+TEST(AsyncLogWriterTest, count) {
+    TestWriter writer;
+    ASSERT_NO_THROW(writer.start(1, AsyncLogWriter::COUNT));
+
+    writer.hold();
+    ASSERT_TRUE(writer.log("first"));
+    writer.waitHolding();
+    ASSERT_TRUE(writer.log("second"));
+    ASSERT_TRUE(writer.log("dropped"));
+    ASSERT_TRUE(writer.log("dropped"));
+    EXPECT_EQ(2, writer.getDroppedCount());
+
+    writer.release();
+    writer.flush();
+    std::vector<std::string> written = writer.getWritten();
+    ASSERT_EQ(3, written.size());
+    EXPECT_EQ("kea.test: second", written[1]);
+    EXPECT_NE(std::string::npos, written[2].find(std::string(": ") +
+                                                 LOG_ASYNC_MESSAGES_DROPPED +
+                                                 " 2 log messages"));
+}
+
+// This test verifies that a message is written with the time it was
+// logged rather than the time it is written.
+TEST(AsyncLogWriterTest, time) {
+    TestWriter writer;
+    ASSERT_NO_THROW(writer.start(4, AsyncLogWriter::BLOCK));
+
+    writer.hold();
+    ASSERT_TRUE(writer.log("first"));
+    writer.waitHolding();
+    const std::chrono::system_clock::time_point before =
+        std::chrono::system_clock::now();
+    ASSERT_TRUE(writer.log("second"));
+    const std::chrono::system_clock::time_point after =
+        std::chrono::system_clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    writer.release();
+    writer.flush();
+
+    std::vector<std::chrono::system_clock::time_point> times =
+        writer.getTimes();
+    ASSERT_EQ(2, times.size());
+    EXPECT_LE(before, times[1]);
+    EXPECT_GE(after, times[1]);
+}
+
+// This test verifies that the messages logged while the writer is paused
+// are written when it is resumed, and that a full queue doesn't block.
+TEST(AsyncLogWriterTest, pause) {
+    TestWriter writer;
+    ASSERT_NO_THROW(writer.start(2, AsyncLogWriter::BLOCK));
+
+    ASSERT_TRUE(writer.log("first"));
+    writer.pause();
+    EXPECT_EQ(1, writer.getWritten().size());
+
+    ASSERT_TRUE(writer.log("second"));
+    ASSERT_TRUE(writer.log("third"));
+    // The queue is full: the message is left to the caller.
+    EXPECT_FALSE(writer.log("fourth"));
+    writer.flush();
+    EXPECT_EQ(1, writer.getWritten().size());
+
+    writer.resume();
+    writer.flush();
+    std::vector<std::string> written = writer.getWritten();
+    ASSERT_EQ(3, written.size());
+    EXPECT_EQ("kea.test: third", written[2]);
+}
+
+// This test verifies the conversion of the overflow policy names.
+TEST(AsyncLogWriterTest, stringToPolicy) {
+    EXPECT_EQ(AsyncLogWriter::BLOCK, AsyncLogWriter::stringToPolicy("block"));
+    EXPECT_EQ(AsyncLogWriter::DROP, AsyncLogWriter::stringToPolicy("Drop"));
+    EXPECT_EQ(AsyncLogWriter::COUNT, AsyncLogWriter::stringToPolicy("COUNT"));
+    EXPECT_THROW(AsyncLogWriter::stringToPolicy("wait"), BadValue);
+}
+
+// This test verifies the formatting of the messages.
+TEST(AsyncLogWriterTest, formatMessage) {
+    std::string message("The %2 are %1");
+    std::vector<std::string> args;
+    args.push_back("switched");
+    args.push_back("arguments");
+    AsyncLogWriter::formatMessage(message, args);
+    EXPECT_EQ("The arguments are switched", message);
+}
+
+// This test verifies that the writer used by the loggers is started,
+// restarted and stopped by its configuration.
+TEST(AsyncLogWriterTest, configure) {
+    AsyncLogWriter& writer = AsyncLogWriter::instance();
+    ASSERT_FALSE(writer.isRunning());
+
+    ASSERT_NO_THROW(AsyncLogWriter::configure(false, 100,
+                                              AsyncLogWriter::BLOCK));
+    EXPECT_FALSE(writer.isRunning());
+
+    // A zero queue size is rejected.
+    EXPECT_THROW(AsyncLogWriter::configure(true, 0, AsyncLogWriter::DROP),
+                 BadValue);
+    EXPECT_FALSE(writer.isRunning());
+
+    ASSERT_NO_THROW(AsyncLogWriter::configure(true, 100,
+                                              AsyncLogWriter::DROP));
+    EXPECT_TRUE(writer.isRunning());
+    EXPECT_EQ(100, writer.getQueueSize());
+    EXPECT_EQ(AsyncLogWriter::DROP, writer.getPolicy());
+
+    // New settings restart the writer.
+    ASSERT_NO_THROW(AsyncLogWriter::configure(true, 200,
+                                              AsyncLogWriter::COUNT));
+    EXPECT_TRUE(writer.isRunning());
+    EXPECT_EQ(200, writer.getQueueSize());
+    EXPECT_EQ(AsyncLogWriter::COUNT, writer.getPolicy());
+
+    ASSERT_NO_THROW(AsyncLogWriter::configure(false, 200,
+                                              AsyncLogWriter::COUNT));
+    EXPECT_FALSE(writer.isRunning());
+}
+
+} // end of anonymous namespace
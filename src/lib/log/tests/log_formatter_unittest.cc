@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2015,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -25,10 +25,16 @@ protected:
     typedef pair<isc::log::Severity, string> Output;
     typedef isc::log::Formatter<FormatterTest> Formatter;
     vector<Output> outputs;
+    vector<vector<string> > deferred_args;
 public:
     void output(const isc::log::Severity& prefix, const string& message) {
         outputs.push_back(Output(prefix, message));
     }
+    void outputDeferred(const isc::log::Severity& prefix, string& message,
+                        vector<string>& args) {
+        outputs.push_back(Output(prefix, message));
+        deferred_args.push_back(args);
+    }
     // Just shortcut for new string
     string* s(const char* text) {
         return (new string(text));
@@ -99,6 +105,31 @@ TEST_F(FormatterTest, multiArg) {
     EXPECT_EQ("The arguments are switched", outputs[0].second);
 }
 
+// A deferred formatter passes the arguments with the unformatted message
+TEST_F(FormatterTest, deferred) {
+    Formatter(isc::log::WARN, s("The %2 are %1"), this, true).arg("switched").
+        arg(42);
+    ASSERT_EQ(1, outputs.size());
+    EXPECT_EQ(isc::log::WARN, outputs[0].first);
+    EXPECT_EQ("The %2 are %1", outputs[0].second);
+    ASSERT_EQ(1, deferred_args.size());
+    ASSERT_EQ(2, deferred_args[0].size());
+    EXPECT_EQ("switched", deferred_args[0][0]);
+    EXPECT_EQ("42", deferred_args[0][1]);
+
+    // The arguments follow the formatter when it is copied.
+    {
+        Formatter copy = Formatter(isc::log::INFO, s("%1 %2"), this,
+                                   true).arg("a");
+        copy.arg("b");
+    }
+    ASSERT_EQ(2, outputs.size());
+    ASSERT_EQ(2, deferred_args.size());
+    ASSERT_EQ(2, deferred_args[1].size());
+    EXPECT_EQ("a", deferred_args[1][0]);
+    EXPECT_EQ("b", deferred_args[1][1]);
+}
+
 #ifdef ENABLE_LOGGER_CHECKS
 
 TEST_F(FormatterTest, mismatchedPlaceholders) {
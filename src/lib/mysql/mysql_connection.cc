@@ -340,6 +340,11 @@ MySqlConnection::rollback() {
     }
 }
 
+bool
+MySqlConnection::ping() {
+    return (mysql_ping(mysql_) == 0);
+}
+
 
 } // namespace isc::db
 } // namespace isc
@@ -519,6 +519,14 @@ public:
     /// @throw DbOperationError If the rollback failed.
     void rollback();
 
+    /// @brief Checks if the connection to the database is usable.
+    ///
+    /// The automatic reconnection is disabled so a lost connection is
+    /// not silently reopened without the prepared statements.
+    ///
+    /// @return true if the server answered, false otherwise.
+    bool ping();
+
     /// @brief Check Error and Throw Exception
     ///
     /// Virtually all MySQL functions return a status which, if non-zero,
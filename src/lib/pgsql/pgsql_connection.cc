@@ -360,5 +360,14 @@ PgSqlConnection::rollback() {
     }
 }
 
+bool
+PgSqlConnection::ping() {
+    if (PQstatus(conn_) != CONNECTION_OK) {
+        return (false);
+    }
+    PgSqlResult r(PQexec(conn_, ""));
+    return (PQresultStatus(r) == PGRES_EMPTY_QUERY);
+}
+
 }; // end of isc::db namespace
 }; // end of isc namespace
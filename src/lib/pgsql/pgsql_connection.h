@@ -367,6 +367,13 @@ public:
     /// @throw DbOperationError If the rollback failed.
     void rollback();
 
+    /// @brief Checks if the connection to the database is usable.
+    ///
+    /// Sends an empty query to the server.
+    ///
+    /// @return true if the server answered, false otherwise.
+    bool ping();
+
     /// @brief Checks a result set's SQL state against an error state.
     ///
     /// @param r result set to check
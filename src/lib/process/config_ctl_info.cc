@@ -44,7 +44,8 @@ ConfigDbInfo::getParameterValue(const std::string& name, std::string& value) con
 //********* ConfiControlInfo ************//
 
 ConfigControlInfo::ConfigControlInfo(const ConfigControlInfo& other)
-    : config_fetch_wait_time_(other.config_fetch_wait_time_) {
+    : config_fetch_wait_time_(other.config_fetch_wait_time_),
+      notify_fifo_(other.notify_fifo_) {
     for (auto db : other.db_infos_) {
         addConfigDatabase(db.getAccessString());
     }
@@ -91,6 +92,7 @@ void
 ConfigControlInfo::clear() {
     db_infos_.clear();
     config_fetch_wait_time_ = Optional<uint16_t>(30, true);
+    notify_fifo_.clear();
 }
 
 void
@@ -115,13 +117,18 @@ ConfigControlInfo::toElement() const {
                     Element::create(static_cast<int>(config_fetch_wait_time_)));
     }
 
+    if (!notify_fifo_.empty()) {
+        result->set("notify-fifo", Element::create(notify_fifo_));
+    }
+
     return(result);
 }
 
 bool
 ConfigControlInfo::equals(const ConfigControlInfo& other) const {
    return ((db_infos_ == other.db_infos_) &&
-           (config_fetch_wait_time_ == other.config_fetch_wait_time_));
+           (config_fetch_wait_time_ == other.config_fetch_wait_time_) &&
+           (notify_fifo_ == other.notify_fifo_));
 }
 
 } // end of namespace isc::process
@@ -13,6 +13,7 @@
 
 #include <boost/shared_ptr.hpp>
 #include <stdint.h>
+#include <string>
 #include <vector>
 
 namespace isc {
@@ -131,8 +132,9 @@ typedef std::vector<ConfigDbInfo> ConfigDbInfoList;
 ///     {
 ///         # next config db
 ///     }
-///     ]
-///
+///     ],
+///     "config-fetch-wait-time": <seconds>,
+///     "notify-fifo": <"named pipe path">
 /// }
 /// @endcode
 ///
@@ -141,7 +143,7 @@ public:
 
     /// @brief Constructor.
     ConfigControlInfo()
-        : config_fetch_wait_time_(30, true) {};
+        : config_fetch_wait_time_(30, true), notify_fifo_() {};
 
     /// @brief Copy Constructor.
     ConfigControlInfo(const ConfigControlInfo& other);
@@ -170,6 +172,25 @@ public:
         return (config_fetch_wait_time_);
     }
 
+    /// @brief Sets new value of the notify-fifo.
+    ///
+    /// @param notify_fifo Path of the named pipe notifying the server of
+    /// the configuration updates. An empty path disables the notifications.
+    void setNotifyFifo(const std::string& notify_fifo) {
+        notify_fifo_ = notify_fifo;
+    }
+
+    /// @brief Returns configured notify-fifo value.
+    ///
+    /// The server fetches the configuration updates as soon as anything
+    /// is written to this named pipe, in addition to the periodic attempts.
+    ///
+    /// @return Path of the named pipe or an empty string if the
+    /// notifications are disabled.
+    const std::string& getNotifyFifo() const {
+        return (notify_fifo_);
+    }
+
     /// @brief Sets configuration database access string.
     ///
     /// @param access_str database access string.
@@ -229,6 +250,9 @@ private:
     /// @brief Configured value of the config-fetch-wait-time.
     util::Optional<uint16_t> config_fetch_wait_time_;
 
+    /// @brief Configured value of the notify-fifo.
+    std::string notify_fifo_;
+
     /// @brief List of configuration databases
     ConfigDbInfoList db_infos_;
 };
@@ -50,6 +50,10 @@ ConfigControlParser::parse(const data::ConstElementPtr& config_control) {
             ctl_info->setConfigFetchWaitTime(static_cast<uint16_t>(config_fetch_wait_time));
         }
 
+        if (config_control->contains("notify-fifo")) {
+            ctl_info->setNotifyFifo(getString(config_control, "notify-fifo"));
+        }
+
     } catch (const isc::ConfigError&) {
         // Position was already added
         throw;
@@ -9,10 +9,12 @@
 #include <process/log_parser.h>
 #include <boost/foreach.hpp>
 #include <boost/lexical_cast.hpp>
+#include <log/async_log_writer.h>
 #include <log/logger_specification.h>
 #include <log/logger_support.h>
 #include <log/logger_manager.h>
 #include <log/logger_name.h>
+#include <limits>
 
 using namespace isc::data;
 using namespace isc::log;
@@ -150,6 +152,29 @@ void LogConfigParser::parseOutputOptions(std::vector<LoggingDestination>& destin
             dest.flush_ = flush_ptr->boolValue();
         }
 
+        isc::data::ConstElementPtr async_ptr = output_option->get("async");
+        if (async_ptr) {
+            dest.async_ = async_ptr->stringValue();
+            try {
+                static_cast<void>(AsyncLogWriter::stringToPolicy(dest.async_));
+            } catch (const BadValue& ex) {
+                isc_throw(BadValue, ex.what() << " ("
+                          << async_ptr->getPosition() << ")");
+            }
+        }
+
+        isc::data::ConstElementPtr queue_size_ptr =
+            output_option->get("async-queue-size");
+        if (queue_size_ptr) {
+            int64_t queue_size = queue_size_ptr->intValue();
+            if ((queue_size <= 0) ||
+                (queue_size > std::numeric_limits<uint32_t>::max())) {
+                isc_throw(BadValue, "async-queue-size must be greater than"
+                          " zero (" << queue_size_ptr->getPosition() << ")");
+            }
+            dest.async_queue_size_ = static_cast<uint32_t>(queue_size);
+        }
+
         destination.push_back(dest);
     }
 }
@@ -28,7 +28,9 @@ namespace process {
 ///             "output": "/home/thomson/kea-inst/kea-warn.log",
 ///             "maxver": 8,
 ///             "maxsize": 204800,
-///             "flush": true
+///             "flush": true,
+///             "async": "drop",
+///             "async-queue-size": 16384
 ///         }
 ///     ],
 ///     "severity": "WARN"
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -20,7 +20,9 @@ LoggingDestination::equals(const LoggingDestination& other) const {
     return (output_ == other.output_ &&
             maxver_ == other.maxver_ &&
             maxsize_ == other.maxsize_ &&
-            flush_ == other.flush_);
+            flush_ == other.flush_ &&
+            async_ == other.async_ &&
+            async_queue_size_ == other.async_queue_size_);
 }
 
 ElementPtr
@@ -35,6 +37,15 @@ LoggingDestination::toElement() const {
     result->set("maxsize", Element::create(static_cast<long long>(maxsize_)));
     // Set flush
     result->set("flush", Element::create(flush_));
+    // Set async
+    if (!async_.empty()) {
+        result->set("async", Element::create(async_));
+    }
+    // Set async-queue-size
+    if (async_queue_size_ > 0) {
+        result->set("async-queue-size",
+                    Element::create(static_cast<long long>(async_queue_size_)));
+    }
 
     return(result);
 }
@@ -149,6 +160,10 @@ LoggingInfo::toSpec() const {
         // Copy the immediate flush flag
         option.flush = dest->flush_;
 
+        // Copy the asynchronous logging settings
+        option.async = dest->async_;
+        option.async_queue_size = dest->async_queue_size_;
+
         // ... and set the destination
         spec.addOutputOption(option);
     }
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -12,6 +12,7 @@
 #include <cc/cfg_to_element.h>
 #include <cc/user_context.h>
 #include <stdint.h>
+#include <string>
 #include <vector>
 
 namespace isc {
@@ -38,6 +39,15 @@ public:
     /// @brief Immediate flush
     bool flush_;
 
+    /// @brief Asynchronous logging overflow policy
+    ///
+    /// Values accepted are: block, drop, count. Empty when the logging
+    /// is synchronous.
+    std::string async_;
+
+    /// @brief Asynchronous logging queue size, 0 for the default size
+    uint32_t async_queue_size_;
+
     /// @brief Compares two objects for equality.
     ///
     /// @param other Object to be compared with this object.
@@ -47,7 +57,8 @@ public:
 
     /// @brief Default constructor.
     LoggingDestination()
-        : output_("stdout"), maxver_(1), maxsize_(10240000), flush_(true) {
+        : output_("stdout"), maxver_(1), maxsize_(10240000), flush_(true),
+          async_(""), async_queue_size_(0) {
     }
 
     /// @brief Unparse a configuration object
@@ -67,7 +78,9 @@ public:
 ///                    "output": "/path/to/the/logfile.log",
 ///                    "maxver": 8,
 ///                    "maxsize": 204800,
-///                    "flush": true
+///                    "flush": true,
+///                    "async": "block",
+///                    "async-queue-size": 16384
 ///                }
 ///            ],
 ///            "severity": "WARN",
@@ -117,6 +117,11 @@ TEST(ConfigControlInfo, basicOperation) {
     ctl.setConfigFetchWaitTime(Optional<uint16_t>(123));
     EXPECT_EQ(123, ctl.getConfigFetchWaitTime().get());
 
+    // The notification pipe is not set by default.
+    EXPECT_TRUE(ctl.getNotifyFifo().empty());
+    ctl.setNotifyFifo("/tmp/kea-cb-notify");
+    EXPECT_EQ("/tmp/kea-cb-notify", ctl.getNotifyFifo());
+
     // We should be able to add two distinct, valid dbs
     std::string access_str1 = "type=mysql host=machine1.org";
     ASSERT_NO_THROW(ctl.addConfigDatabase(access_str1));
@@ -153,6 +158,7 @@ TEST(ConfigControlInfo, basicOperation) {
     EXPECT_EQ(0, ctl.getConfigDatabases().size());
     EXPECT_TRUE(ctl.getConfigFetchWaitTime().unspecified());
     EXPECT_EQ(30, ctl.getConfigFetchWaitTime().get());
+    EXPECT_TRUE(ctl.getNotifyFifo().empty());
 }
 
 // Verifies the copy ctor and equality functions ConfigControlInfo
@@ -163,6 +169,7 @@ TEST(ConfigControlInfo, copyAndEquality) {
     ASSERT_NO_THROW(ctl1.addConfigDatabase("type=mysql host=mach1.org"));
     ASSERT_NO_THROW(ctl1.addConfigDatabase("type=postgresql host=mach2.org"));
     ctl1.setConfigFetchWaitTime(Optional<uint16_t>(123));
+    ctl1.setNotifyFifo("/tmp/kea-cb-notify");
 
     // Clone that instance.
     ConfigControlInfo ctl2(ctl1);
@@ -170,6 +177,10 @@ TEST(ConfigControlInfo, copyAndEquality) {
     // They should be equal.
     EXPECT_TRUE(ctl1.equals(ctl2));
 
+    // A different notification pipe makes them differ.
+    ctl2.setNotifyFifo("/tmp/other-notify");
+    EXPECT_FALSE(ctl1.equals(ctl2));
+
     // Make a third instance with a different db.
     ConfigControlInfo ctl3;
     ASSERT_NO_THROW(ctl1.addConfigDatabase("type=cql host=other.org"));
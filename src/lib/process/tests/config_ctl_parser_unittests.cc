@@ -28,6 +28,10 @@ TEST(ConfigCtlInfoParser, validConfigs) {
        "  \"config-fetch-wait-time\": 20 \n"
        "}",
 
+       "{ \"config-databases\": [], \n"
+       "  \"notify-fifo\": \"/tmp/kea-cb-notify\" \n"
+       "}",
+
        "{ \"config-databases\": [ \n"
        "    { \n"
        "        \"type\": \"mysql\", \n"
@@ -85,6 +89,7 @@ TEST(ConfigCtlInfoParser, invalidConfigs) {
        "{ \"config-fetch-wait-time\": -1 }",
        "{ \"config-fetch-wait-time\": 65537 }",
        "{ \"config-fetch-wait-time\": \"a-string\" }",
+       "{ \"notify-fifo\": 1 }",
     };
 
     for (auto config : configs) {
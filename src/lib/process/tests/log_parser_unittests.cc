@@ -9,6 +9,7 @@
 #include <process/log_parser.h>
 #include <process/process_messages.h>
 #include <exceptions/exceptions.h>
+#include <log/async_log_writer.h>
 #include <log/logger_support.h>
 #include <process/d_log.h>
 #include <testutils/io_utils.h>
@@ -18,6 +19,7 @@
 using namespace isc;
 using namespace isc::process;
 using namespace isc::data;
+using isc::log::AsyncLogWriter;
 
 namespace {
 
@@ -370,6 +372,73 @@ TEST_F(LoggingTest, logRotate) {
     wipeFiles();
 }
 
+// Checks that the asynchronous logging is configured by the output
+// options and started and stopped when the configuration is applied.
+TEST_F(LoggingTest, asyncOutput) {
+    const char* config_txt =
+    "{ \"loggers\": ["
+    "    {"
+    "        \"name\": \"kea\","
+    "        \"output_options\": ["
+    "            {"
+    "                \"output\": \"stdout\","
+    "                \"async\": \"drop\","
+    "                \"async-queue-size\": 100"
+    "            }"
+    "        ],"
+    "        \"severity\": \"INFO\""
+    "    }"
+    "]}";
+
+    ConfigPtr storage(new ConfigBase());
+    LogConfigParser parser(storage);
+    ConstElementPtr config = Element::fromJSON(config_txt);
+    config = config->get("loggers");
+    ASSERT_NO_THROW(parser.parseConfiguration(config));
+
+    ASSERT_EQ(1, storage->getLoggingInfo().size());
+    ASSERT_EQ(1, storage->getLoggingInfo()[0].destinations_.size());
+    EXPECT_EQ("drop", storage->getLoggingInfo()[0].destinations_[0].async_);
+    EXPECT_EQ(100, storage->getLoggingInfo()[0].destinations_[0].async_queue_size_);
+
+    // Applying the configuration starts the asynchronous logging.
+    AsyncLogWriter& writer = AsyncLogWriter::instance();
+    ASSERT_NO_THROW(storage->applyLoggingCfg());
+    EXPECT_TRUE(writer.isRunning());
+    EXPECT_EQ(AsyncLogWriter::DROP, writer.getPolicy());
+    EXPECT_EQ(100, writer.getQueueSize());
+
+    // A configuration without asynchronous output stops it.
+    ConfigPtr sync_storage(new ConfigBase());
+    LogConfigParser sync_parser(sync_storage);
+    config = Element::fromJSON("[ { \"name\": \"kea\","
+                               "    \"output_options\": ["
+                               "        { \"output\": \"stdout\" } ],"
+                               "    \"severity\": \"INFO\" } ]");
+    ASSERT_NO_THROW(sync_parser.parseConfiguration(config));
+    ASSERT_NO_THROW(sync_storage->applyLoggingCfg());
+    EXPECT_FALSE(writer.isRunning());
+}
+
+// Checks that invalid asynchronous logging settings are rejected.
+TEST_F(LoggingTest, asyncOutputInvalid) {
+    ConfigPtr storage(new ConfigBase());
+    LogConfigParser parser(storage);
+
+    ConstElementPtr config =
+        Element::fromJSON("[ { \"name\": \"kea\","
+                          "    \"output_options\": ["
+                          "        { \"output\": \"stdout\","
+                          "          \"async\": \"wait\" } ] } ]");
+    EXPECT_THROW(parser.parseConfiguration(config), BadValue);
+
+    config = Element::fromJSON("[ { \"name\": \"kea\","
+                               "    \"output_options\": ["
+                               "        { \"output\": \"stdout\","
+                               "          \"async-queue-size\": 0 } ] } ]");
+    EXPECT_THROW(parser.parseConfiguration(config), BadValue);
+}
+
 /// @todo Add tests for malformed logging configuration
 
 /// @todo There is no easy way to test applyConfiguration() and defaultLogging().
@@ -45,6 +45,18 @@ TEST(LoggingDestination, equals) {
 
     dest1.maxsize_ = 32;
     EXPECT_TRUE(dest1.equals(dest2));
+
+    dest1.async_ = "drop";
+    EXPECT_FALSE(dest1.equals(dest2));
+
+    dest2.async_ = "drop";
+    EXPECT_TRUE(dest1.equals(dest2));
+
+    dest1.async_queue_size_ = 100;
+    EXPECT_FALSE(dest1.equals(dest2));
+
+    dest2.async_queue_size_ = 100;
+    EXPECT_TRUE(dest1.equals(dest2));
 }
 
 /// @brief Test fixture class for testing @c LoggingInfo.
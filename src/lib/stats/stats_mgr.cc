@@ -26,7 +26,7 @@ StatsMgr& StatsMgr::instance() {
 }
 
 StatsMgr::StatsMgr() :
-    global_(new StatContext()) {
+    global_(new StatContext()), latencies_() {
 
 }
 
@@ -139,6 +139,30 @@ void StatsMgr::removeAll() {
     global_->stats_.clear();
 }
 
+util::LatencyHistogramPtr
+StatsMgr::getLatencyHistogram(const std::string& name) {
+    util::LatencyHistogramPtr& histogram = latencies_[name];
+    if (!histogram) {
+        histogram.reset(new util::LatencyHistogram());
+    }
+    return (histogram);
+}
+
+isc::data::ConstElementPtr StatsMgr::getLatencies() const {
+    isc::data::ElementPtr latencies = isc::data::Element::createMap();
+    for (auto l = latencies_.begin(); l != latencies_.end(); ++l) {
+        latencies->set(l->first,
+                       util::latencyHistogramToElement<Element>(*l->second));
+    }
+    return (latencies);
+}
+
+void StatsMgr::resetLatencies() {
+    for (auto l = latencies_.begin(); l != latencies_.end(); ++l) {
+        l->second->reset();
+    }
+}
+
 isc::data::ConstElementPtr StatsMgr::get(const std::string& name) const {
     isc::data::ElementPtr response = isc::data::Element::createMap(); // a map
     ObservationPtr obs = getObservation(name);
@@ -284,6 +308,31 @@ StatsMgr::statisticGetAllHandler(const std::string& /*name*/,
     return (createAnswer(CONTROL_RESULT_SUCCESS, all_stats));
 }
 
+isc::data::ConstElementPtr
+StatsMgr::statisticLatencyGetHandler(const std::string& /*name*/,
+                                     const isc::data::ConstElementPtr& params) {
+    bool reset = false;
+    if (params) {
+        if (params->getType() != Element::map) {
+            return (createAnswer(CONTROL_RESULT_ERROR,
+                                 "Parameters expected to be a map."));
+        }
+        ConstElementPtr reset_elem = params->get("reset");
+        if (reset_elem) {
+            if (reset_elem->getType() != Element::boolean) {
+                return (createAnswer(CONTROL_RESULT_ERROR,
+                                     "'reset' parameter expected to be a boolean."));
+            }
+            reset = reset_elem->boolValue();
+        }
+    }
+    ConstElementPtr latencies = StatsMgr::instance().getLatencies();
+    if (reset) {
+        StatsMgr::instance().resetLatencies();
+    }
+    return (createAnswer(CONTROL_RESULT_SUCCESS, latencies));
+}
+
 isc::data::ConstElementPtr
 StatsMgr::statisticResetAllHandler(const std::string& /*name*/,
                                    const isc::data::ConstElementPtr& /*params*/) {
@@ -9,6 +9,7 @@
 
 #include <stats/observation.h>
 #include <stats/context.h>
+#include <util/latency_histogram.h>
 #include <boost/noncopyable.hpp>
 
 #include <map>
@@ -217,6 +218,36 @@ class StatsMgr : public boost::noncopyable {
 
     /// @}
 
+    /// @defgroup latency_methods Methods handling latency histograms.
+    ///
+    /// @brief Latency histograms hold the distribution of durations which
+    /// are recorded too often to be stored as observations, e.g. for each
+    /// packet. The producers get the histogram once and then record the
+    /// values directly in it. The histograms are neither reset by
+    /// @ref resetAll nor removed by @ref removeAll.
+    ///
+    /// @{
+
+    /// @brief Returns a latency histogram, creating it if needed.
+    ///
+    /// @param name name of the histogram
+    /// @return Pointer to the histogram.
+    util::LatencyHistogramPtr getLatencyHistogram(const std::string& name);
+
+    /// @brief Returns the statistics of all the latency histograms.
+    ///
+    /// The statistics of a histogram are the number of recorded values
+    /// ("count") and their minimum, maximum, mean, 50th, 90th, 99th and
+    /// 99.9th percentiles.
+    ///
+    /// @return Map of the statistics by histogram name.
+    isc::data::ConstElementPtr getLatencies() const;
+
+    /// @brief Removes the recorded values from all the latency histograms.
+    void resetLatencies();
+
+    /// @}
+
     /// @brief Returns an observation.
     ///
     /// Used in testing only. Production code should use @ref get() method.
@@ -424,6 +455,21 @@ class StatsMgr : public boost::noncopyable {
     statisticSetMaxSampleCountAllHandler(const std::string& name,
                                          const isc::data::ConstElementPtr& params);
 
+    /// @brief Handles statistic-latency-get command
+    ///
+    /// This method handles statistic-latency-get command, which returns the
+    /// statistics of all the latency histograms. When the optional "reset"
+    /// boolean parameter is true, the histograms are reset after they are
+    /// returned.
+    ///
+    /// @param name name of the command (ignored, should be
+    /// "statistic-latency-get")
+    /// @param params structure containing a map that may contain "reset"
+    /// @return answer containing the statistics of the latency histograms
+    static isc::data::ConstElementPtr
+    statisticLatencyGetHandler(const std::string& name,
+                               const isc::data::ConstElementPtr& params);
+
     /// @}
 
 private:
@@ -562,6 +608,9 @@ private:
 
     // This is a global context. All statistics will initially be stored here.
     StatContextPtr global_;
+
+    // Latency histograms by name.
+    std::map<std::string, util::LatencyHistogramPtr> latencies_;
 };
 
 };
@@ -955,4 +955,70 @@ TEST_F(StatsMgrTest, commandSetMaxSampleCountAll) {
     EXPECT_EQ(StatsMgr::instance().getObservation("delta")->getMaxSampleAge().first, false);
 }
 
+// This test checks that the latency histograms are created once and
+// reported.
+TEST_F(StatsMgrTest, latencies) {
+    EXPECT_TRUE(StatsMgr::instance().getLatencies()->mapValue().empty());
+
+    util::LatencyHistogramPtr histogram =
+        StatsMgr::instance().getLatencyHistogram("alpha");
+    ASSERT_TRUE(histogram);
+    EXPECT_EQ(histogram, StatsMgr::instance().getLatencyHistogram("alpha"));
+    for (uint64_t i = 1; i <= 10; ++i) {
+        histogram->record(i);
+    }
+
+    ConstElementPtr latencies = StatsMgr::instance().getLatencies();
+    ASSERT_TRUE(latencies);
+    ConstElementPtr alpha = latencies->get("alpha");
+    ASSERT_TRUE(alpha);
+    EXPECT_EQ(10, alpha->get("count")->intValue());
+    EXPECT_EQ(1, alpha->get("min")->intValue());
+    EXPECT_EQ(10, alpha->get("max")->intValue());
+    EXPECT_DOUBLE_EQ(5.5, alpha->get("mean")->doubleValue());
+    EXPECT_EQ(5, alpha->get("p50")->intValue());
+    EXPECT_EQ(10, alpha->get("p99.9")->intValue());
+
+    // The histograms are kept by removeAll and reset by resetLatencies.
+    StatsMgr::instance().removeAll();
+    EXPECT_EQ(10, histogram->getCount());
+    StatsMgr::instance().resetLatencies();
+    EXPECT_EQ(0, histogram->getCount());
+    EXPECT_EQ(histogram, StatsMgr::instance().getLatencyHistogram("alpha"));
+}
+
+// This test checks the statistic-latency-get command.
+TEST_F(StatsMgrTest, commandStatisticLatencyGet) {
+    util::LatencyHistogramPtr histogram =
+        StatsMgr::instance().getLatencyHistogram("beta");
+    histogram->record(100);
+
+    // Without parameters.
+    ConstElementPtr rsp =
+        StatsMgr::statisticLatencyGetHandler("statistic-latency-get",
+                                             ElementPtr());
+    int status_code;
+    ConstElementPtr args = parseAnswer(status_code, rsp);
+    ASSERT_EQ(CONTROL_RESULT_SUCCESS, status_code);
+    ASSERT_TRUE(args);
+    ASSERT_TRUE(args->get("beta"));
+    EXPECT_EQ(1, args->get("beta")->get("count")->intValue());
+    EXPECT_EQ(1, histogram->getCount());
+
+    // Invalid reset parameter.
+    ElementPtr params = Element::createMap();
+    params->set("reset", Element::create("yes"));
+    rsp = StatsMgr::statisticLatencyGetHandler("statistic-latency-get", params);
+    parseAnswer(status_code, rsp);
+    EXPECT_EQ(CONTROL_RESULT_ERROR, status_code);
+
+    // With reset the histograms are returned, then reset.
+    params->set("reset", Element::create(true));
+    rsp = StatsMgr::statisticLatencyGetHandler("statistic-latency-get", params);
+    args = parseAnswer(status_code, rsp);
+    ASSERT_EQ(CONTROL_RESULT_SUCCESS, status_code);
+    EXPECT_EQ(1, args->get("beta")->get("count")->intValue());
+    EXPECT_EQ(0, histogram->getCount());
+}
+
 };
@@ -0,0 +1,101 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <exceptions/exceptions.h>
+#include <util/bloom_filter.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+/// @brief Maximum number of hash functions.
+const size_t MAX_HASHES_COUNT = 16;
+
+}
+
+namespace isc {
+namespace util {
+
+BloomFilter::BloomFilter(const size_t expected_count,
+                         const double false_positive_rate)
+    : bits_(), bits_count_(0), hashes_count_(0), count_(0) {
+    if ((false_positive_rate <= 0.0) || (false_positive_rate >= 1.0)) {
+        isc_throw(BadValue, "false positive rate of the Bloom filter must be"
+                  " greater than 0 and lower than 1, got "
+                  << false_positive_rate);
+    }
+
+    // Optimal number of bits is -n * ln(p) / ln(2)^2 and optimal number
+    // of hash functions is bits / n * ln(2).
+    const double count = static_cast<double>(std::max(expected_count,
+                                                      static_cast<size_t>(1)));
+    const double ln2 = std::log(2.0);
+    const double bits = std::ceil(-count * std::log(false_positive_rate) /
+                                  (ln2 * ln2));
+    bits_count_ = std::max(static_cast<size_t>(bits), static_cast<size_t>(64));
+    hashes_count_ = static_cast<size_t>(std::round(bits_count_ / count * ln2));
+    hashes_count_ = std::min(std::max(hashes_count_, static_cast<size_t>(1)),
+                             MAX_HASHES_COUNT);
+    bits_.resize((bits_count_ + 63) / 64, 0);
+}
+
+void
+BloomFilter::add(const uint8_t* data, const size_t length) {
+    uint64_t hash1;
+    uint64_t hash2;
+    hash(data, length, hash1, hash2);
+    for (size_t i = 0; i < hashes_count_; ++i) {
+        const uint64_t bit = (hash1 + i * hash2) % bits_count_;
+        bits_[bit / 64] |= (static_cast<uint64_t>(1) << (bit % 64));
+    }
+    ++count_;
+}
+
+bool
+BloomFilter::mayContain(const uint8_t* data, const size_t length) const {
+    uint64_t hash1;
+    uint64_t hash2;
+    hash(data, length, hash1, hash2);
+    for (size_t i = 0; i < hashes_count_; ++i) {
+        const uint64_t bit = (hash1 + i * hash2) % bits_count_;
+        if ((bits_[bit / 64] & (static_cast<uint64_t>(1) << (bit % 64))) == 0) {
+            return (false);
+        }
+    }
+    return (true);
+}
+
+void
+BloomFilter::clear() {
+    std::fill(bits_.begin(), bits_.end(), 0);
+    count_ = 0;
+}
+
+void
+BloomFilter::hash(const uint8_t* data, const size_t length,
+                  uint64_t& hash1, uint64_t& hash2) {
+    // 64-bit FNV-1a.
+    uint64_t h = 14695981039346656037ULL;
+    for (size_t i = 0; i < length; ++i) {
+        h ^= data[i];
+        h *= 1099511628211ULL;
+    }
+    hash1 = h;
+
+    // The second hash is derived from the first one using the SplitMix64
+    // finalizer, which is enough to make the two hashes independent.
+    h += 0x9e3779b97f4a7c15ULL;
+    h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+    h ^= (h >> 31);
+    hash2 = h | 1;
+}
+
+} // namespace isc::util
+} // namespace isc
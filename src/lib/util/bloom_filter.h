@@ -0,0 +1,106 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef BLOOM_FILTER_H
+#define BLOOM_FILTER_H
+
+#include <boost/shared_ptr.hpp>
+
+#include <cstddef>
+#include <stdint.h>
+#include <vector>
+
+namespace isc {
+namespace util {
+
+/// @brief Bloom filter.
+///
+/// A space efficient probabilistic set of byte strings. It answers whether
+/// a string may belong to the set: the answer "no" is always correct while
+/// the answer "yes" is wrong with a small probability (false positive)
+/// which depends on the number of strings added and the filter size.
+/// Strings can't be removed from the filter.
+///
+/// The filter is sized for the expected number of strings and the desired
+/// false positive rate. Adding more strings than expected increases the
+/// false positive rate.
+class BloomFilter {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param expected_count Expected number of strings in the filter.
+    /// @param false_positive_rate Desired false positive rate, e.g. 0.01.
+    /// @throw isc::BadValue if the false positive rate is not in the
+    /// (0, 1) range.
+    BloomFilter(const size_t expected_count, const double false_positive_rate);
+
+    /// @brief Adds a string to the filter.
+    ///
+    /// @param data Pointer to the string.
+    /// @param length Length of the string.
+    void add(const uint8_t* data, const size_t length);
+
+    /// @brief Checks if the string may belong to the filter.
+    ///
+    /// @param data Pointer to the string.
+    /// @param length Length of the string.
+    /// @return false if the string has certainly not been added, true
+    /// otherwise.
+    bool mayContain(const uint8_t* data, const size_t length) const;
+
+    /// @brief Removes all strings from the filter.
+    void clear();
+
+    /// @brief Returns the number of strings added to the filter.
+    size_t getCount() const {
+        return (count_);
+    }
+
+    /// @brief Returns the size of the filter in bits.
+    size_t getBitsCount() const {
+        return (bits_count_);
+    }
+
+    /// @brief Returns the number of hash functions used.
+    size_t getHashesCount() const {
+        return (hashes_count_);
+    }
+
+private:
+
+    /// @brief Computes two independent hashes of the string.
+    ///
+    /// The positions of the bits for the string are derived from these
+    /// hashes using double hashing.
+    ///
+    /// @param data Pointer to the string.
+    /// @param length Length of the string.
+    /// @param [out] hash1 First hash.
+    /// @param [out] hash2 Second hash, always odd.
+    static void hash(const uint8_t* data, const size_t length,
+                     uint64_t& hash1, uint64_t& hash2);
+
+    /// @brief Bits of the filter.
+    std::vector<uint64_t> bits_;
+
+    /// @brief Number of bits of the filter.
+    size_t bits_count_;
+
+    /// @brief Number of hash functions.
+    size_t hashes_count_;
+
+    /// @brief Number of strings added.
+    size_t count_;
+};
+
+/// @brief Pointer to the @c BloomFilter.
+typedef boost::shared_ptr<BloomFilter> BloomFilterPtr;
+
+} // namespace isc::util
+} // namespace isc
+
+#endif // BLOOM_FILTER_H
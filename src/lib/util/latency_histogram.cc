@@ -0,0 +1,190 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <exceptions/exceptions.h>
+#include <util/latency_histogram.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+/// @brief Number of bits of a value selecting the bucket in its power of
+/// two range.
+const unsigned SUB_BUCKET_BITS = 4;
+
+/// @brief Number of buckets in a power of two range.
+const uint64_t SUB_BUCKETS_COUNT = 1 << SUB_BUCKET_BITS;
+
+/// @brief Values below this one have their own bucket.
+const uint64_t EXACT_LIMIT = 2 * SUB_BUCKETS_COUNT;
+
+/// @brief Position of the highest bit of the first value which doesn't have
+/// its own bucket.
+const unsigned FIRST_RANGE_BIT = SUB_BUCKET_BITS + 1;
+
+/// @brief Returns the position of the highest bit set in a value.
+///
+/// @param value A value which is not 0.
+/// @return The position of its highest bit set, from 0.
+unsigned
+highestBit(const uint64_t value) {
+    return (63 - __builtin_clzll(value));
+}
+
+}
+
+namespace isc {
+namespace util {
+
+const size_t LatencyHistogram::BUCKETS_COUNT = EXACT_LIMIT +
+    (64 - FIRST_RANGE_BIT) * SUB_BUCKETS_COUNT;
+
+LatencyHistogram::LatencyHistogram()
+    : buckets_(BUCKETS_COUNT), count_(0), sum_(0),
+      min_(std::numeric_limits<uint64_t>::max()), max_(0) {
+    // The atomic values of the vector are not initialized by their default
+    // constructor.
+    reset();
+}
+
+void
+LatencyHistogram::record(const uint64_t value) {
+    buckets_[getBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t current = min_.load(std::memory_order_relaxed);
+    while ((value < current) &&
+           !min_.compare_exchange_weak(current, value,
+                                       std::memory_order_relaxed)) {
+    }
+    current = max_.load(std::memory_order_relaxed);
+    while ((value > current) &&
+           !max_.compare_exchange_weak(current, value,
+                                       std::memory_order_relaxed)) {
+    }
+}
+
+void
+LatencyHistogram::reset() {
+    for (auto bucket = buckets_.begin(); bucket != buckets_.end(); ++bucket) {
+        bucket->store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    sum_.store(0, std::memory_order_relaxed);
+    min_.store(std::numeric_limits<uint64_t>::max(),
+               std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+void
+LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (size_t index = 0; index < BUCKETS_COUNT; ++index) {
+        uint64_t count = other.buckets_[index].load(std::memory_order_relaxed);
+        if (count > 0) {
+            buckets_[index].fetch_add(count, std::memory_order_relaxed);
+        }
+    }
+    count_.fetch_add(other.getCount(), std::memory_order_relaxed);
+    sum_.fetch_add(other.getSum(), std::memory_order_relaxed);
+
+    uint64_t value = other.min_.load(std::memory_order_relaxed);
+    uint64_t current = min_.load(std::memory_order_relaxed);
+    while ((value < current) &&
+           !min_.compare_exchange_weak(current, value,
+                                       std::memory_order_relaxed)) {
+    }
+    value = other.getMax();
+    current = max_.load(std::memory_order_relaxed);
+    while ((value > current) &&
+           !max_.compare_exchange_weak(current, value,
+                                       std::memory_order_relaxed)) {
+    }
+}
+
+uint64_t
+LatencyHistogram::getMin() const {
+    uint64_t min = min_.load(std::memory_order_relaxed);
+    return (min == std::numeric_limits<uint64_t>::max() ? 0 : min);
+}
+
+double
+LatencyHistogram::getMean() const {
+    uint64_t count = getCount();
+    if (count == 0) {
+        return (0.0);
+    }
+    return (static_cast<double>(getSum()) / count);
+}
+
+uint64_t
+LatencyHistogram::getPercentile(const double percentile) const {
+    if ((percentile < 0.0) || (percentile > 100.0)) {
+        isc_throw(BadValue, "percentile " << percentile
+                  << " is not between 0 and 100");
+    }
+
+    // Count the values from the buckets rather than using the counter of
+    // values, which may be ahead of them when values are being recorded.
+    uint64_t total = 0;
+    for (auto bucket = buckets_.begin(); bucket != buckets_.end(); ++bucket) {
+        total += bucket->load(std::memory_order_relaxed);
+    }
+    if (total == 0) {
+        return (0);
+    }
+
+    uint64_t rank = static_cast<uint64_t>(std::ceil(percentile / 100.0 *
+                                                    total));
+    rank = std::max(rank, static_cast<uint64_t>(1));
+    uint64_t seen = 0;
+    size_t index = 0;
+    for (; index < BUCKETS_COUNT - 1; ++index) {
+        seen += buckets_[index].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            break;
+        }
+    }
+    return (std::max(std::min(getBucketHighest(index), getMax()), getMin()));
+}
+
+size_t
+LatencyHistogram::getBucketIndex(const uint64_t value) {
+    if (value < EXACT_LIMIT) {
+        return (static_cast<size_t>(value));
+    }
+    unsigned bit = highestBit(value);
+    return (EXACT_LIMIT + (bit - FIRST_RANGE_BIT) * SUB_BUCKETS_COUNT +
+            ((value >> (bit - SUB_BUCKET_BITS)) & (SUB_BUCKETS_COUNT - 1)));
+}
+
+uint64_t
+LatencyHistogram::getBucketLowest(const size_t index) {
+    if (index < EXACT_LIMIT) {
+        return (index);
+    }
+    unsigned bit = (index - EXACT_LIMIT) / SUB_BUCKETS_COUNT + FIRST_RANGE_BIT;
+    uint64_t sub_bucket = (index - EXACT_LIMIT) % SUB_BUCKETS_COUNT;
+    return ((static_cast<uint64_t>(1) << bit) |
+            (sub_bucket << (bit - SUB_BUCKET_BITS)));
+}
+
+uint64_t
+LatencyHistogram::getBucketHighest(const size_t index) {
+    if (index < EXACT_LIMIT) {
+        return (index);
+    }
+    unsigned bit = (index - EXACT_LIMIT) / SUB_BUCKETS_COUNT + FIRST_RANGE_BIT;
+    return (getBucketLowest(index) +
+            ((static_cast<uint64_t>(1) << (bit - SUB_BUCKET_BITS)) - 1));
+}
+
+} // namespace isc::util
+} // namespace isc
@@ -0,0 +1,159 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <stdint.h>
+#include <vector>
+
+namespace isc {
+namespace util {
+
+/// @brief Histogram of latencies with a bounded relative error.
+///
+/// The recorded values (typically durations in microseconds) are counted
+/// in log-linear buckets, as in HDR histograms: the values below 32 have
+/// their own bucket and each following power of two range is split into
+/// 16 buckets. The width of a bucket is therefore at most 1/16 of the
+/// values it holds, which bounds the error of the reported percentiles to
+/// about 6%, while the whole range of 64 bit values takes less than 1000
+/// buckets of fixed size.
+///
+/// The counters are atomic: the values are recorded without a lock and
+/// the histogram can be read while values are recorded by other threads.
+/// The statistics read in that case may not include the values recorded
+/// concurrently.
+class LatencyHistogram : public boost::noncopyable {
+public:
+
+    /// @brief Number of buckets.
+    static const size_t BUCKETS_COUNT;
+
+    /// @brief Constructor.
+    ///
+    /// Creates an empty histogram.
+    LatencyHistogram();
+
+    /// @brief Records a value.
+    ///
+    /// @param value The value to record.
+    void record(const uint64_t value);
+
+    /// @brief Removes all the recorded values.
+    void reset();
+
+    /// @brief Adds the values recorded by another histogram.
+    ///
+    /// @param other The histogram which values are added to this one.
+    void merge(const LatencyHistogram& other);
+
+    /// @brief Returns the number of recorded values.
+    uint64_t getCount() const {
+        return (count_.load(std::memory_order_relaxed));
+    }
+
+    /// @brief Returns the sum of the recorded values.
+    uint64_t getSum() const {
+        return (sum_.load(std::memory_order_relaxed));
+    }
+
+    /// @brief Returns the smallest recorded value or 0 if none.
+    uint64_t getMin() const;
+
+    /// @brief Returns the largest recorded value or 0 if none.
+    uint64_t getMax() const {
+        return (max_.load(std::memory_order_relaxed));
+    }
+
+    /// @brief Returns the mean of the recorded values or 0 if none.
+    double getMean() const;
+
+    /// @brief Returns a percentile of the recorded values.
+    ///
+    /// The returned value is the largest value of the bucket holding the
+    /// percentile, bounded by the largest recorded value.
+    ///
+    /// @param percentile The percentile, between 0 and 100.
+    /// @return The value below or equal to which the given percentage of
+    /// the recorded values is, or 0 if no value was recorded.
+    /// @throw isc::BadValue if the percentile is out of range.
+    uint64_t getPercentile(const double percentile) const;
+
+    /// @brief Returns the index of the bucket counting a value.
+    ///
+    /// @param value The value.
+    /// @return The index of the bucket.
+    static size_t getBucketIndex(const uint64_t value);
+
+    /// @brief Returns the smallest value counted by a bucket.
+    ///
+    /// @param index The index of the bucket.
+    /// @return The smallest value of the bucket.
+    static uint64_t getBucketLowest(const size_t index);
+
+    /// @brief Returns the largest value counted by a bucket.
+    ///
+    /// @param index The index of the bucket.
+    /// @return The largest value of the bucket.
+    static uint64_t getBucketHighest(const size_t index);
+
+private:
+
+    /// @brief Counters of the buckets.
+    std::vector<std::atomic<uint64_t> > buckets_;
+
+    /// @brief Number of recorded values.
+    std::atomic<uint64_t> count_;
+
+    /// @brief Sum of the recorded values.
+    std::atomic<uint64_t> sum_;
+
+    /// @brief Smallest recorded value, all bits set when none.
+    std::atomic<uint64_t> min_;
+
+    /// @brief Largest recorded value.
+    std::atomic<uint64_t> max_;
+};
+
+/// @brief Pointer to a latency histogram.
+typedef boost::shared_ptr<LatencyHistogram> LatencyHistogramPtr;
+
+/// @brief Converts the statistics of a latency histogram to a map.
+///
+/// The map holds the count, min, max, mean, p50, p90, p99 and p99.9
+/// entries returned by the hooks-latency-get and statistic-latency-get
+/// commands. This is a template because libkea-cc, which provides the
+/// elements, depends on libkea-util: it is instantiated with
+/// @c isc::data::Element by the callers.
+///
+/// @param histogram The latency histogram.
+/// @tparam ElementT The element class.
+/// @return The map holding the statistics of the histogram.
+template <typename ElementT>
+boost::shared_ptr<ElementT>
+latencyHistogramToElement(const LatencyHistogram& histogram) {
+    boost::shared_ptr<ElementT> map = ElementT::createMap();
+    map->set("count", ElementT::create(static_cast<int64_t>(histogram.getCount())));
+    map->set("min", ElementT::create(static_cast<int64_t>(histogram.getMin())));
+    map->set("max", ElementT::create(static_cast<int64_t>(histogram.getMax())));
+    map->set("mean", ElementT::create(histogram.getMean()));
+    map->set("p50", ElementT::create(static_cast<int64_t>(histogram.getPercentile(50))));
+    map->set("p90", ElementT::create(static_cast<int64_t>(histogram.getPercentile(90))));
+    map->set("p99", ElementT::create(static_cast<int64_t>(histogram.getPercentile(99))));
+    map->set("p99.9", ElementT::create(static_cast<int64_t>(histogram.getPercentile(99.9))));
+    return (map);
+}
+
+} // namespace isc::util
+} // namespace isc
+
+#endif // LATENCY_HISTOGRAM_H
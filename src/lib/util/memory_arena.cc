@@ -0,0 +1,127 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <util/memory_arena.h>
+
+namespace {
+
+/// @brief Alignment of the memory handed out by the arena.
+const size_t ARENA_ALIGNMENT = alignof(std::max_align_t);
+
+/// @brief Rounds the size up to the arena alignment.
+size_t
+alignSize(const size_t size) {
+    return ((size + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1));
+}
+
+/// @brief Size of the header preceding objects allocated by
+/// @c ArenaAllocatable.
+const size_t OBJECT_HEADER_SIZE = alignSize(sizeof(isc::util::MemoryArena*));
+
+}
+
+namespace isc {
+namespace util {
+
+thread_local MemoryArena* MemoryArena::current_ = NULL;
+
+MemoryArena*
+MemoryArena::create(const size_t chunk_size) {
+    return (new MemoryArena(chunk_size));
+}
+
+MemoryArena::MemoryArena(const size_t chunk_size)
+    : chunk_size_(alignSize(chunk_size > 0 ? chunk_size : DEFAULT_CHUNK_SIZE)),
+      chunks_(NULL), free_(NULL), free_size_(0), chunks_count_(0),
+      allocated_size_(0), refs_(1) {
+}
+
+MemoryArena::~MemoryArena() {
+    while (chunks_) {
+        Chunk* next = chunks_->next_;
+        ::operator delete(chunks_);
+        chunks_ = next;
+    }
+}
+
+void*
+MemoryArena::allocate(const size_t size) {
+    const size_t aligned_size = alignSize(size > 0 ? size : 1);
+    allocated_size_ += aligned_size;
+
+    // Large allocations get their own chunk so as they don't waste
+    // the remaining space of the current chunk.
+    if (aligned_size > chunk_size_ / 4) {
+        return (allocateChunk(aligned_size));
+    }
+
+    if (aligned_size > free_size_) {
+        free_ = allocateChunk(chunk_size_);
+        free_size_ = chunk_size_;
+    }
+    void* ptr = free_;
+    free_ += aligned_size;
+    free_size_ -= aligned_size;
+    return (ptr);
+}
+
+char*
+MemoryArena::allocateChunk(const size_t size) {
+    const size_t header_size = alignSize(sizeof(Chunk));
+    Chunk* chunk = static_cast<Chunk*>(::operator new(header_size + size));
+    chunk->next_ = chunks_;
+    chunks_ = chunk;
+    ++chunks_count_;
+    return (reinterpret_cast<char*>(chunk) + header_size);
+}
+
+MemoryArenaScope::MemoryArenaScope(const size_t chunk_size)
+    : arena_(NULL), previous_(MemoryArena::current_) {
+    if (chunk_size > 0) {
+        arena_ = MemoryArena::create(chunk_size);
+        MemoryArena::current_ = arena_;
+    }
+}
+
+MemoryArenaScope::~MemoryArenaScope() {
+    if (arena_) {
+        MemoryArena::current_ = previous_;
+        arena_->detach();
+    }
+}
+
+void*
+ArenaAllocatable::operator new(size_t size) {
+    MemoryArena* arena = MemoryArena::getCurrent();
+    void* mem;
+    if (arena) {
+        mem = arena->allocate(OBJECT_HEADER_SIZE + size);
+        arena->attach();
+    } else {
+        mem = ::operator new(OBJECT_HEADER_SIZE + size);
+    }
+    *static_cast<MemoryArena**>(mem) = arena;
+    return (static_cast<char*>(mem) + OBJECT_HEADER_SIZE);
+}
+
+void
+ArenaAllocatable::operator delete(void* ptr) {
+    if (ptr == NULL) {
+        return;
+    }
+    void* mem = static_cast<char*>(ptr) - OBJECT_HEADER_SIZE;
+    MemoryArena* arena = *static_cast<MemoryArena**>(mem);
+    if (arena) {
+        arena->detach();
+    } else {
+        ::operator delete(mem);
+    }
+}
+
+} // namespace isc::util
+} // namespace isc
@@ -0,0 +1,245 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef MEMORY_ARENA_H
+#define MEMORY_ARENA_H
+
+#include <boost/noncopyable.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+namespace isc {
+namespace util {
+
+/// @brief Monotonic memory arena.
+///
+/// The arena hands out memory carved sequentially out of large chunks
+/// and never frees individual allocations. Instead, it counts the live
+/// allocations and releases all chunks at once when the last of them is
+/// returned and the arena is no longer referenced by its owner. This
+/// makes allocation a pointer bump and deallocation a counter decrement,
+/// replacing a number of small malloc/free calls with a few large ones.
+///
+/// The arena is meant to be used for objects sharing the same lifetime,
+/// e.g. objects created during processing of a single DHCP packet. The
+/// objects may outlive the code which created the arena (e.g. parked
+/// packets) because the arena is kept alive by the allocations.
+///
+/// Memory is allocated from the arena by one thread, the one which has
+/// installed the arena with @c MemoryArenaScope. Allocations may be
+/// returned from any thread.
+class MemoryArena : public boost::noncopyable {
+public:
+
+    /// @brief Default chunk size.
+    static const size_t DEFAULT_CHUNK_SIZE = 16384;
+
+    /// @brief Creates new arena.
+    ///
+    /// The returned arena is referenced once by the caller, which must
+    /// call @c detach when it no longer needs the arena.
+    ///
+    /// @param chunk_size Size of the chunks of memory allocated from
+    /// the heap.
+    /// @return Pointer to the new arena.
+    static MemoryArena* create(const size_t chunk_size = DEFAULT_CHUNK_SIZE);
+
+    /// @brief Allocates memory from the arena.
+    ///
+    /// The returned memory is suitably aligned for any type. The caller
+    /// must call @c detach when it is done with the memory.
+    ///
+    /// @param size Size of the requested memory in bytes.
+    /// @return Pointer to the allocated memory.
+    /// @throw std::bad_alloc if the memory can't be allocated.
+    void* allocate(const size_t size);
+
+    /// @brief Adds a reference to the arena.
+    void attach() {
+        refs_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// @brief Removes a reference to the arena.
+    ///
+    /// The arena and all its memory are freed when the last reference
+    /// is removed.
+    void detach() {
+        if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete this;
+        }
+    }
+
+    /// @brief Returns number of chunks allocated from the heap.
+    size_t getChunksCount() const {
+        return (chunks_count_);
+    }
+
+    /// @brief Returns number of bytes handed out by the arena.
+    size_t getAllocatedSize() const {
+        return (allocated_size_);
+    }
+
+    /// @brief Returns the arena installed for the current thread.
+    ///
+    /// @return Pointer to the arena or null if no arena is installed.
+    static MemoryArena* getCurrent() {
+        return (current_);
+    }
+
+private:
+
+    /// @brief Header of a chunk of memory.
+    struct Chunk {
+        /// @brief Pointer to the previously allocated chunk.
+        Chunk* next_;
+    };
+
+    /// @brief Constructor.
+    ///
+    /// @param chunk_size Size of the chunks of memory.
+    explicit MemoryArena(const size_t chunk_size);
+
+    /// @brief Destructor.
+    ///
+    /// Frees all chunks.
+    ~MemoryArena();
+
+    /// @brief Allocates new chunk from the heap.
+    ///
+    /// @param size Minimal usable size of the chunk.
+    /// @return Pointer to the usable memory of the chunk.
+    char* allocateChunk(const size_t size);
+
+    /// @brief Size of the chunks.
+    size_t chunk_size_;
+
+    /// @brief List of allocated chunks.
+    Chunk* chunks_;
+
+    /// @brief Pointer to the free memory in the current chunk.
+    char* free_;
+
+    /// @brief Number of bytes left in the current chunk.
+    size_t free_size_;
+
+    /// @brief Number of allocated chunks.
+    size_t chunks_count_;
+
+    /// @brief Number of bytes handed out.
+    size_t allocated_size_;
+
+    /// @brief Number of references including live allocations.
+    std::atomic<size_t> refs_;
+
+    /// @brief Arena installed for the current thread.
+    static thread_local MemoryArena* current_;
+
+    friend class MemoryArenaScope;
+    friend class HeapAllocationScope;
+};
+
+/// @brief Installs a new arena for the current thread.
+///
+/// While an instance of this class exists, objects of classes derived
+/// from @c ArenaAllocatable created by the current thread are allocated
+/// from the arena. The scopes may be nested, in which case the previous
+/// arena is restored when the inner scope ends.
+class MemoryArenaScope : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param chunk_size Size of the arena chunks. If 0, no arena is
+    /// created and the objects are allocated from the heap.
+    explicit MemoryArenaScope(const size_t chunk_size);
+
+    /// @brief Destructor.
+    ///
+    /// Uninstalls the arena. The arena memory is freed when all objects
+    /// allocated from it are destroyed.
+    ~MemoryArenaScope();
+
+    /// @brief Returns the arena created by this scope.
+    ///
+    /// @return Pointer to the arena or null if arenas are disabled.
+    MemoryArena* getArena() const {
+        return (arena_);
+    }
+
+private:
+
+    /// @brief Arena created by this scope.
+    MemoryArena* arena_;
+
+    /// @brief Arena installed before this scope.
+    MemoryArena* previous_;
+};
+
+/// @brief Uninstalls the current arena for the current thread.
+///
+/// While an instance of this class exists, objects are allocated from
+/// the heap even if a @c MemoryArenaScope is active. It is meant for
+/// code which creates objects kept after the packet was processed,
+/// e.g. hosts put in a cache, as each of them would otherwise keep a
+/// whole chunk of the arena alive.
+class HeapAllocationScope : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    HeapAllocationScope() : previous_(MemoryArena::current_) {
+        MemoryArena::current_ = NULL;
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Restores the previous arena.
+    ~HeapAllocationScope() {
+        MemoryArena::current_ = previous_;
+    }
+
+private:
+
+    /// @brief Arena installed before this scope.
+    MemoryArena* previous_;
+};
+
+/// @brief Base class for the objects which can be allocated from
+/// the arena installed for the current thread.
+///
+/// The class defines class specific allocation functions which take
+/// memory from the current @c MemoryArena if any, and from the heap
+/// otherwise. Every allocation is preceded by a small header pointing
+/// to the arena, so the objects may be freed regardless of whether an
+/// arena is installed at that time.
+class ArenaAllocatable {
+public:
+
+    /// @brief Allocates memory for an object.
+    ///
+    /// @param size Size of the object.
+    static void* operator new(size_t size);
+
+    /// @brief Frees memory of an object.
+    ///
+    /// @param ptr Pointer to the object memory.
+    static void operator delete(void* ptr);
+
+    /// @brief Placement new.
+    static void* operator new(size_t, void* ptr) {
+        return (ptr);
+    }
+
+    /// @brief Placement delete.
+    static void operator delete(void*, void*) {
+    }
+};
+
+} // namespace isc::util
+} // namespace isc
+
+#endif // MEMORY_ARENA_H
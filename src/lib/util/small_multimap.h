@@ -0,0 +1,549 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef SMALL_MULTIMAP_H
+#define SMALL_MULTIMAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace isc {
+namespace util {
+
+/// @brief Sorted, vector backed replacement for @c std::multimap.
+///
+/// This container keeps its elements in a contiguous array sorted by
+/// key. Up to @c N elements are held in storage embedded in the
+/// container object itself, so that small collections do not require
+/// any heap allocation at all. When the number of elements exceeds
+/// @c N the elements are moved to a heap allocated array, which then
+/// grows geometrically like a @c std::vector.
+///
+/// The public interface mimics the subset of the @c std::multimap
+/// interface commonly used by the code (iteration, @c find,
+/// @c equal_range, @c insert, @c erase etc.), so the container can be
+/// used as a drop in replacement for the multimap. Elements with
+/// equal keys are kept in insertion order, as in the multimap.
+///
+/// There are the following differences with respect to the
+/// @c std::multimap which the callers must be aware of:
+/// - insertion and removal of elements invalidate all iterators,
+/// - the key of the stored elements is not const, but it must not be
+///   modified via an iterator because this would break the ordering.
+///
+/// Lookups are binary searches over contiguous memory and iteration
+/// is a walk over an array, which is considerably cheaper than walking
+/// the multimap's tree for the typical sizes of a few tens of elements.
+///
+/// @tparam Key Type of the key.
+/// @tparam T Type of the mapped value.
+/// @tparam N Number of elements stored without heap allocation.
+/// @tparam Compare Key comparison function.
+template<typename Key, typename T, size_t N,
+         typename Compare = std::less<Key> >
+class SmallMultimap {
+public:
+
+    /// @brief Type of the key.
+    typedef Key key_type;
+
+    /// @brief Type of the mapped value.
+    typedef T mapped_type;
+
+    /// @brief Type of the stored element.
+    typedef std::pair<Key, T> value_type;
+
+    /// @brief Type of the key comparison function.
+    typedef Compare key_compare;
+
+    /// @brief Unsigned integer type used for sizes.
+    typedef size_t size_type;
+
+    /// @brief Reference to an element.
+    typedef value_type& reference;
+
+    /// @brief Const reference to an element.
+    typedef const value_type& const_reference;
+
+    /// @brief Iterator.
+    typedef value_type* iterator;
+
+    /// @brief Const iterator.
+    typedef const value_type* const_iterator;
+
+    /// @brief Reverse iterator.
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+
+    /// @brief Const reverse iterator.
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    /// @brief Constructor.
+    ///
+    /// Creates an empty container using the embedded storage.
+    SmallMultimap()
+        : data_(inlineData()), size_(0), capacity_(N) {
+    }
+
+    /// @brief Constructor from the range of elements.
+    ///
+    /// @param first Iterator pointing to the first element to copy.
+    /// @param last Iterator pointing past the last element to copy.
+    /// @tparam InputIterator Type of the input iterators.
+    template<typename InputIterator>
+    SmallMultimap(InputIterator first, InputIterator last)
+        : data_(inlineData()), size_(0), capacity_(N) {
+        insert(first, last);
+    }
+
+    /// @brief Copy constructor.
+    ///
+    /// @param other Container to be copied.
+    SmallMultimap(const SmallMultimap& other)
+        : data_(inlineData()), size_(0), capacity_(N) {
+        reserve(other.size_);
+        std::uninitialized_copy(other.begin(), other.end(), data_);
+        size_ = other.size_;
+    }
+
+    /// @brief Move constructor.
+    ///
+    /// If the other container keeps its elements on the heap, the
+    /// heap array is taken over. Otherwise, the elements are moved
+    /// one by one to the embedded storage of this container.
+    ///
+    /// @param other Container to be moved.
+    SmallMultimap(SmallMultimap&& other)
+        : data_(inlineData()), size_(0), capacity_(N) {
+        takeOver(other);
+    }
+
+    /// @brief Destructor.
+    ~SmallMultimap() {
+        clear();
+        releaseStorage();
+    }
+
+    /// @brief Copy assignment operator.
+    ///
+    /// @param other Container to be copied.
+    /// @return Reference to this container.
+    SmallMultimap& operator=(const SmallMultimap& other) {
+        if (this != &other) {
+            SmallMultimap copy(other);
+            swap(copy);
+        }
+        return (*this);
+    }
+
+    /// @brief Move assignment operator.
+    ///
+    /// @param other Container to be moved.
+    /// @return Reference to this container.
+    SmallMultimap& operator=(SmallMultimap&& other) {
+        if (this != &other) {
+            clear();
+            releaseStorage();
+            takeOver(other);
+        }
+        return (*this);
+    }
+
+    /// @brief Returns iterator to the first element.
+    iterator begin() {
+        return (data_);
+    }
+
+    /// @brief Returns const iterator to the first element.
+    const_iterator begin() const {
+        return (data_);
+    }
+
+    /// @brief Returns const iterator to the first element.
+    const_iterator cbegin() const {
+        return (data_);
+    }
+
+    /// @brief Returns iterator pointing past the last element.
+    iterator end() {
+        return (data_ + size_);
+    }
+
+    /// @brief Returns const iterator pointing past the last element.
+    const_iterator end() const {
+        return (data_ + size_);
+    }
+
+    /// @brief Returns const iterator pointing past the last element.
+    const_iterator cend() const {
+        return (data_ + size_);
+    }
+
+    /// @brief Returns reverse iterator to the last element.
+    reverse_iterator rbegin() {
+        return (reverse_iterator(end()));
+    }
+
+    /// @brief Returns const reverse iterator to the last element.
+    const_reverse_iterator rbegin() const {
+        return (const_reverse_iterator(end()));
+    }
+
+    /// @brief Returns reverse iterator pointing before the first element.
+    reverse_iterator rend() {
+        return (reverse_iterator(begin()));
+    }
+
+    /// @brief Returns const reverse iterator pointing before the first
+    /// element.
+    const_reverse_iterator rend() const {
+        return (const_reverse_iterator(begin()));
+    }
+
+    /// @brief Checks if the container is empty.
+    bool empty() const {
+        return (size_ == 0);
+    }
+
+    /// @brief Returns number of elements in the container.
+    size_type size() const {
+        return (size_);
+    }
+
+    /// @brief Returns number of elements which can be held without
+    /// reallocation.
+    size_type capacity() const {
+        return (capacity_);
+    }
+
+    /// @brief Checks if the elements are held in the embedded storage.
+    ///
+    /// @return true if no heap allocation is in use, false otherwise.
+    bool isInline() const {
+        return (data_ == inlineData());
+    }
+
+    /// @brief Makes sure that the container can hold the specified
+    /// number of elements without reallocation.
+    ///
+    /// @param capacity Requested capacity.
+    void reserve(const size_type capacity) {
+        if (capacity <= capacity_) {
+            return;
+        }
+        value_type* new_data = allocator().allocate(capacity);
+        value_type* dst = new_data;
+        for (value_type* src = data_; src != data_ + size_; ++src, ++dst) {
+            ::new (static_cast<void*>(dst)) value_type(std::move(*src));
+            src->~value_type();
+        }
+        releaseStorage();
+        data_ = new_data;
+        capacity_ = capacity;
+    }
+
+    /// @brief Removes all elements from the container.
+    ///
+    /// The storage is retained for reuse.
+    void clear() {
+        for (value_type* it = data_; it != data_ + size_; ++it) {
+            it->~value_type();
+        }
+        size_ = 0;
+    }
+
+    /// @brief Inserts an element.
+    ///
+    /// The element is placed after all elements with the same key.
+    ///
+    /// @param value Element to be inserted.
+    /// @return Iterator pointing to the inserted element.
+    iterator insert(const value_type& value) {
+        return (insertAt(upper_bound(value.first), value_type(value)));
+    }
+
+    /// @brief Inserts an element.
+    ///
+    /// The element is placed after all elements with the same key.
+    ///
+    /// @param value Element to be inserted.
+    /// @return Iterator pointing to the inserted element.
+    iterator insert(value_type&& value) {
+        iterator pos = upper_bound(value.first);
+        return (insertAt(pos, std::move(value)));
+    }
+
+    /// @brief Inserts an element converted from a compatible pair.
+    ///
+    /// This allows for inserting elements created with
+    /// @c std::make_pair with the key of a different integer type.
+    ///
+    /// @param value Pair to be converted and inserted.
+    /// @return Iterator pointing to the inserted element.
+    /// @tparam Pair Type of the pair.
+    template<typename Pair>
+    typename std::enable_if<std::is_constructible<value_type, Pair&&>::value,
+                            iterator>::type
+    insert(Pair&& value) {
+        return (insert(value_type(std::forward<Pair>(value))));
+    }
+
+    /// @brief Inserts elements from the range.
+    ///
+    /// @param first Iterator pointing to the first element to insert.
+    /// @param last Iterator pointing past the last element to insert.
+    /// @tparam InputIterator Type of the input iterators.
+    template<typename InputIterator>
+    void insert(InputIterator first, InputIterator last) {
+        for (; first != last; ++first) {
+            insert(value_type(*first));
+        }
+    }
+
+    /// @brief Removes an element.
+    ///
+    /// @param pos Iterator pointing to the element to be removed.
+    /// @return Iterator pointing to the element following the removed
+    /// one.
+    iterator erase(const_iterator pos) {
+        return (erase(pos, pos + 1));
+    }
+
+    /// @brief Removes a range of elements.
+    ///
+    /// @param first Iterator pointing to the first element to remove.
+    /// @param last Iterator pointing past the last element to remove.
+    /// @return Iterator pointing to the element following the last
+    /// removed one.
+    iterator erase(const_iterator first, const_iterator last) {
+        iterator dst = data_ + (first - data_);
+        iterator src = data_ + (last - data_);
+        if (dst == src) {
+            return (dst);
+        }
+        iterator new_end = std::move(src, end(), dst);
+        for (iterator it = new_end; it != end(); ++it) {
+            it->~value_type();
+        }
+        size_ = new_end - data_;
+        return (dst);
+    }
+
+    /// @brief Removes all elements with the specified key.
+    ///
+    /// @param key Key of the elements to remove.
+    /// @return Number of removed elements.
+    size_type erase(const key_type& key) {
+        std::pair<iterator, iterator> range = equal_range(key);
+        size_type removed = range.second - range.first;
+        erase(range.first, range.second);
+        return (removed);
+    }
+
+    /// @brief Swaps the contents of two containers.
+    ///
+    /// @param other Container to swap the contents with.
+    void swap(SmallMultimap& other) {
+        SmallMultimap tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    /// @brief Returns first element with a key not less than specified.
+    ///
+    /// @param key Key to search for.
+    iterator lower_bound(const key_type& key) {
+        return (std::lower_bound(begin(), end(), key, KeyLess()));
+    }
+
+    /// @brief Returns first element with a key not less than specified.
+    ///
+    /// @param key Key to search for.
+    const_iterator lower_bound(const key_type& key) const {
+        return (std::lower_bound(begin(), end(), key, KeyLess()));
+    }
+
+    /// @brief Returns first element with a key greater than specified.
+    ///
+    /// @param key Key to search for.
+    iterator upper_bound(const key_type& key) {
+        return (std::upper_bound(begin(), end(), key, KeyLess()));
+    }
+
+    /// @brief Returns first element with a key greater than specified.
+    ///
+    /// @param key Key to search for.
+    const_iterator upper_bound(const key_type& key) const {
+        return (std::upper_bound(begin(), end(), key, KeyLess()));
+    }
+
+    /// @brief Returns range of elements with the specified key.
+    ///
+    /// @param key Key to search for.
+    std::pair<iterator, iterator> equal_range(const key_type& key) {
+        return (std::equal_range(begin(), end(), key, KeyLess()));
+    }
+
+    /// @brief Returns range of elements with the specified key.
+    ///
+    /// @param key Key to search for.
+    std::pair<const_iterator, const_iterator>
+    equal_range(const key_type& key) const {
+        return (std::equal_range(begin(), end(), key, KeyLess()));
+    }
+
+    /// @brief Returns first element with the specified key.
+    ///
+    /// @param key Key to search for.
+    /// @return Iterator pointing to the found element or @c end().
+    iterator find(const key_type& key) {
+        iterator it = lower_bound(key);
+        if ((it != end()) && !Compare()(key, it->first)) {
+            return (it);
+        }
+        return (end());
+    }
+
+    /// @brief Returns first element with the specified key.
+    ///
+    /// @param key Key to search for.
+    /// @return Iterator pointing to the found element or @c end().
+    const_iterator find(const key_type& key) const {
+        const_iterator it = lower_bound(key);
+        if ((it != end()) && !Compare()(key, it->first)) {
+            return (it);
+        }
+        return (end());
+    }
+
+    /// @brief Returns number of elements with the specified key.
+    ///
+    /// @param key Key to search for.
+    size_type count(const key_type& key) const {
+        std::pair<const_iterator, const_iterator> range = equal_range(key);
+        return (range.second - range.first);
+    }
+
+    /// @brief Equality operator.
+    ///
+    /// @param other Container to compare to.
+    /// @return true if both containers hold equal elements in the same
+    /// order.
+    bool operator==(const SmallMultimap& other) const {
+        return ((size_ == other.size_) &&
+                std::equal(begin(), end(), other.begin()));
+    }
+
+    /// @brief Inequality operator.
+    ///
+    /// @param other Container to compare to.
+    bool operator!=(const SmallMultimap& other) const {
+        return (!(*this == other));
+    }
+
+private:
+
+    /// @brief Compares keys of the elements with keys.
+    struct KeyLess {
+        bool operator()(const value_type& value, const key_type& key) const {
+            return (Compare()(value.first, key));
+        }
+        bool operator()(const key_type& key, const value_type& value) const {
+            return (Compare()(key, value.first));
+        }
+    };
+
+    /// @brief Returns allocator used for the heap storage.
+    static std::allocator<value_type> allocator() {
+        return (std::allocator<value_type>());
+    }
+
+    /// @brief Returns pointer to the embedded storage.
+    value_type* inlineData() {
+        return (reinterpret_cast<value_type*>(&inline_storage_));
+    }
+
+    /// @brief Returns pointer to the embedded storage.
+    const value_type* inlineData() const {
+        return (reinterpret_cast<const value_type*>(&inline_storage_));
+    }
+
+    /// @brief Frees the heap storage, if any, and switches to the
+    /// embedded storage.
+    ///
+    /// The container must be empty when this is called.
+    void releaseStorage() {
+        if (!isInline()) {
+            allocator().deallocate(data_, capacity_);
+            data_ = inlineData();
+            capacity_ = N;
+        }
+    }
+
+    /// @brief Moves the contents of the other container to this one.
+    ///
+    /// This container must be empty and use its embedded storage.
+    ///
+    /// @param other Container from which the elements are moved.
+    void takeOver(SmallMultimap& other) {
+        if (other.isInline()) {
+            for (size_type i = 0; i < other.size_; ++i) {
+                ::new (static_cast<void*>(data_ + i))
+                    value_type(std::move(other.data_[i]));
+            }
+            size_ = other.size_;
+            other.clear();
+
+        } else {
+            data_ = other.data_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inlineData();
+            other.size_ = 0;
+            other.capacity_ = N;
+        }
+    }
+
+    /// @brief Inserts an element at the specified position.
+    ///
+    /// @param pos Position at which the element is inserted.
+    /// @param value Element to be inserted.
+    /// @return Iterator pointing to the inserted element.
+    iterator insertAt(iterator pos, value_type&& value) {
+        const size_type index = pos - data_;
+        if (size_ == capacity_) {
+            reserve(capacity_ > 0 ? 2 * capacity_ : 1);
+        }
+        ::new (static_cast<void*>(data_ + size_)) value_type(std::move(value));
+        ++size_;
+        std::rotate(data_ + index, data_ + size_ - 1, data_ + size_);
+        return (data_ + index);
+    }
+
+    /// @brief Pointer to the storage currently in use.
+    value_type* data_;
+
+    /// @brief Number of elements in the container.
+    size_type size_;
+
+    /// @brief Number of elements which fit in the current storage.
+    size_type capacity_;
+
+    /// @brief Embedded storage for up to @c N elements.
+    typename std::aligned_storage<sizeof(value_type) * (N > 0 ? N : 1),
+                                  std::alignment_of<value_type>::value>::type
+    inline_storage_;
+};
+
+} // namespace isc::util
+} // namespace isc
+
+#endif // SMALL_MULTIMAP_H
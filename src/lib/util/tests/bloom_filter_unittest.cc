@@ -0,0 +1,68 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <exceptions/exceptions.h>
+#include <util/bloom_filter.h>
+#include <gtest/gtest.h>
+#include <stdint.h>
+
+namespace {
+
+using namespace isc::util;
+
+// This test verifies that the filter is sized according to the
+// parameters.
+TEST(BloomFilterTest, size) {
+    BloomFilter filter(1000, 0.01);
+    // About 9.6 bits and 7 hashes per element for 1% false positives.
+    EXPECT_GE(filter.getBitsCount(), 9585);
+    EXPECT_LE(filter.getBitsCount(), 9600);
+    EXPECT_EQ(7, filter.getHashesCount());
+    EXPECT_EQ(0, filter.getCount());
+
+    EXPECT_THROW(BloomFilter(1000, 0.0), isc::BadValue);
+    EXPECT_THROW(BloomFilter(1000, 1.0), isc::BadValue);
+
+    // Empty filter is still usable.
+    BloomFilter empty(0, 0.01);
+    EXPECT_GT(empty.getBitsCount(), 0);
+    uint8_t data = 1;
+    EXPECT_FALSE(empty.mayContain(&data, 1));
+}
+
+// This test verifies that added strings are always found and that the
+// false positive rate is close to the expected one.
+TEST(BloomFilterTest, lookup) {
+    const uint32_t count = 10000;
+    BloomFilter filter(count, 0.01);
+    for (uint32_t i = 0; i < count; ++i) {
+        filter.add(reinterpret_cast<const uint8_t*>(&i), sizeof(i));
+    }
+    EXPECT_EQ(count, filter.getCount());
+
+    for (uint32_t i = 0; i < count; ++i) {
+        EXPECT_TRUE(filter.mayContain(reinterpret_cast<const uint8_t*>(&i),
+                                      sizeof(i)));
+    }
+
+    size_t false_positives = 0;
+    for (uint32_t i = count; i < 2 * count; ++i) {
+        if (filter.mayContain(reinterpret_cast<const uint8_t*>(&i),
+                              sizeof(i))) {
+            ++false_positives;
+        }
+    }
+    EXPECT_LT(false_positives, count / 50);
+
+    filter.clear();
+    EXPECT_EQ(0, filter.getCount());
+    uint32_t i = 0;
+    EXPECT_FALSE(filter.mayContain(reinterpret_cast<const uint8_t*>(&i),
+                                   sizeof(i)));
+}
+
+} // end of anonymous namespace
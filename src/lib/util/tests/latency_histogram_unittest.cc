@@ -0,0 +1,139 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <exceptions/exceptions.h>
+#include <util/latency_histogram.h>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <thread>
+#include <vector>
+
+using namespace isc;
+using namespace isc::util;
+
+namespace {
+
+// This test verifies that the buckets cover all the values without gaps
+// and with a bounded relative width.
+TEST(LatencyHistogramTest, buckets) {
+    EXPECT_EQ(0, LatencyHistogram::getBucketIndex(0));
+    EXPECT_EQ(31, LatencyHistogram::getBucketIndex(31));
+    EXPECT_EQ(LatencyHistogram::BUCKETS_COUNT - 1,
+              LatencyHistogram::getBucketIndex(std::numeric_limits<uint64_t>::max()));
+    EXPECT_EQ(std::numeric_limits<uint64_t>::max(),
+              LatencyHistogram::getBucketHighest(LatencyHistogram::BUCKETS_COUNT - 1));
+
+    EXPECT_EQ(0, LatencyHistogram::getBucketLowest(0));
+    for (size_t i = 1; i < LatencyHistogram::BUCKETS_COUNT; ++i) {
+        uint64_t lowest = LatencyHistogram::getBucketLowest(i);
+        uint64_t highest = LatencyHistogram::getBucketHighest(i);
+        ASSERT_EQ(LatencyHistogram::getBucketHighest(i - 1) + 1, lowest);
+        ASSERT_EQ(i, LatencyHistogram::getBucketIndex(lowest));
+        ASSERT_EQ(i, LatencyHistogram::getBucketIndex(highest));
+        ASSERT_LE(highest - lowest, lowest / 16);
+    }
+}
+
+// This test verifies the statistics of the recorded values.
+TEST(LatencyHistogramTest, statistics) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(0, histogram.getCount());
+    EXPECT_EQ(0, histogram.getMin());
+    EXPECT_EQ(0, histogram.getMax());
+    EXPECT_EQ(0.0, histogram.getMean());
+    EXPECT_EQ(0, histogram.getPercentile(50));
+
+    for (uint64_t value = 1; value <= 1000; ++value) {
+        histogram.record(value);
+    }
+    EXPECT_EQ(1000, histogram.getCount());
+    EXPECT_EQ(500500, histogram.getSum());
+    EXPECT_EQ(1, histogram.getMin());
+    EXPECT_EQ(1000, histogram.getMax());
+    EXPECT_DOUBLE_EQ(500.5, histogram.getMean());
+
+    // The percentiles are within the bucket precision.
+    EXPECT_EQ(1, histogram.getPercentile(0));
+    EXPECT_NEAR(500, histogram.getPercentile(50), 500 / 16);
+    EXPECT_NEAR(990, histogram.getPercentile(99), 990 / 16);
+    EXPECT_EQ(1000, histogram.getPercentile(100));
+    EXPECT_THROW(histogram.getPercentile(-1), BadValue);
+    EXPECT_THROW(histogram.getPercentile(100.5), BadValue);
+
+    histogram.reset();
+    EXPECT_EQ(0, histogram.getCount());
+    EXPECT_EQ(0, histogram.getSum());
+    EXPECT_EQ(0, histogram.getMin());
+    EXPECT_EQ(0, histogram.getMax());
+    EXPECT_EQ(0, histogram.getPercentile(99));
+}
+
+// This test verifies that the percentiles are exact for small values.
+TEST(LatencyHistogramTest, smallValues) {
+    LatencyHistogram histogram;
+    for (int i = 0; i < 90; ++i) {
+        histogram.record(3);
+    }
+    for (int i = 0; i < 10; ++i) {
+        histogram.record(20);
+    }
+    EXPECT_EQ(3, histogram.getPercentile(50));
+    EXPECT_EQ(3, histogram.getPercentile(90));
+    EXPECT_EQ(20, histogram.getPercentile(91));
+}
+
+// This test verifies that histograms can be merged.
+TEST(LatencyHistogramTest, merge) {
+    LatencyHistogram histogram;
+    LatencyHistogram other;
+    histogram.record(3);
+    histogram.record(5);
+    other.record(1);
+    other.record(20);
+    other.record(20);
+
+    histogram.merge(other);
+    EXPECT_EQ(5, histogram.getCount());
+    EXPECT_EQ(49, histogram.getSum());
+    EXPECT_EQ(1, histogram.getMin());
+    EXPECT_EQ(20, histogram.getMax());
+    EXPECT_EQ(5, histogram.getPercentile(60));
+    EXPECT_EQ(20, histogram.getPercentile(61));
+
+    // The other histogram is left untouched.
+    EXPECT_EQ(3, other.getCount());
+
+    // Merging an empty histogram changes nothing.
+    LatencyHistogram empty;
+    histogram.merge(empty);
+    EXPECT_EQ(5, histogram.getCount());
+    EXPECT_EQ(1, histogram.getMin());
+}
+
+// This test verifies that values can be recorded by several threads.
+TEST(LatencyHistogramTest, threads) {
+    LatencyHistogram histogram;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.push_back(std::thread([&histogram, t] {
+            for (uint64_t value = 0; value < 10000; ++value) {
+                histogram.record(value * (t + 1));
+            }
+        }));
+    }
+    for (auto thread = threads.begin(); thread != threads.end(); ++thread) {
+        thread->join();
+    }
+    EXPECT_EQ(40000, histogram.getCount());
+    EXPECT_EQ(0, histogram.getMin());
+    EXPECT_EQ(39996, histogram.getMax());
+}
+
+}
@@ -0,0 +1,147 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <exceptions/exceptions.h>
+#include <util/memory_arena.h>
+#include <boost/shared_ptr.hpp>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using namespace isc::util;
+
+/// @brief Test object which can be allocated from the arena.
+class TestObject : public ArenaAllocatable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param value Value held by the object.
+    explicit TestObject(const int value) : value_(value) {
+        ++instances_;
+    }
+
+    /// @brief Destructor.
+    virtual ~TestObject() {
+        --instances_;
+    }
+
+    /// @brief Value held by the object.
+    int value_;
+
+    /// @brief Number of existing objects.
+    static int instances_;
+};
+
+int TestObject::instances_ = 0;
+
+/// @brief Test object larger than the base object.
+class LargeTestObject : public TestObject {
+public:
+
+    /// @brief Constructor.
+    LargeTestObject() : TestObject(0) {
+    }
+
+    /// @brief Payload making the object large.
+    char payload_[4096];
+};
+
+// This test verifies that the arena hands out aligned memory and that it
+// allocates new chunks as needed.
+TEST(MemoryArenaTest, allocate) {
+    MemoryArena* arena = MemoryArena::create(1024);
+    EXPECT_EQ(0, arena->getChunksCount());
+
+    std::vector<void*> ptrs;
+    for (int i = 0; i < 100; ++i) {
+        void* ptr = arena->allocate(i + 1);
+        ASSERT_TRUE(ptr);
+        EXPECT_EQ(0, reinterpret_cast<uintptr_t>(ptr) %
+                  alignof(std::max_align_t));
+        ptrs.push_back(ptr);
+    }
+    EXPECT_GT(arena->getChunksCount(), 1);
+    EXPECT_GE(arena->getAllocatedSize(), 5050);
+
+    // Large allocations get their own chunks.
+    size_t chunks = arena->getChunksCount();
+    ASSERT_TRUE(arena->allocate(4096));
+    EXPECT_EQ(chunks + 1, arena->getChunksCount());
+
+    arena->detach();
+}
+
+// This test verifies that objects are taken from the arena while the
+// scope is active and from the heap otherwise.
+TEST(MemoryArenaTest, scope) {
+    EXPECT_FALSE(MemoryArena::getCurrent());
+
+    boost::shared_ptr<TestObject> outside(new TestObject(1));
+    boost::shared_ptr<TestObject> inside;
+    boost::shared_ptr<TestObject> large;
+    {
+        MemoryArenaScope scope(1024);
+        ASSERT_TRUE(scope.getArena());
+        EXPECT_EQ(scope.getArena(), MemoryArena::getCurrent());
+
+        inside.reset(new TestObject(2));
+        large.reset(new LargeTestObject());
+        EXPECT_GE(scope.getArena()->getAllocatedSize(),
+                  sizeof(TestObject) + sizeof(LargeTestObject));
+
+        // Destroying the objects while the scope is active works too.
+        delete new TestObject(3);
+    }
+    EXPECT_FALSE(MemoryArena::getCurrent());
+
+    // Objects outlive the scope.
+    EXPECT_EQ(1, outside->value_);
+    EXPECT_EQ(2, inside->value_);
+    EXPECT_EQ(3, TestObject::instances_);
+
+    inside.reset();
+    large.reset();
+    outside.reset();
+    EXPECT_EQ(0, TestObject::instances_);
+}
+
+// This test verifies that scopes can be nested and that the zero chunk
+// size disables the arena.
+TEST(MemoryArenaTest, nestedScopes) {
+    MemoryArenaScope outer(1024);
+    {
+        MemoryArenaScope disabled(0);
+        EXPECT_FALSE(disabled.getArena());
+        EXPECT_EQ(outer.getArena(), MemoryArena::getCurrent());
+        {
+            MemoryArenaScope inner(1024);
+            EXPECT_EQ(inner.getArena(), MemoryArena::getCurrent());
+        }
+        EXPECT_EQ(outer.getArena(), MemoryArena::getCurrent());
+    }
+    EXPECT_EQ(outer.getArena(), MemoryArena::getCurrent());
+}
+
+// This test verifies that objects are allocated from the heap while
+// a heap allocation scope is active.
+TEST(MemoryArenaTest, heapAllocationScope) {
+    MemoryArenaScope scope(1024);
+    const size_t allocated = scope.getArena()->getAllocatedSize();
+    {
+        HeapAllocationScope heap_scope;
+        EXPECT_FALSE(MemoryArena::getCurrent());
+        boost::shared_ptr<TestObject> object(new TestObject(1));
+        EXPECT_EQ(allocated, scope.getArena()->getAllocatedSize());
+    }
+    EXPECT_EQ(scope.getArena(), MemoryArena::getCurrent());
+    EXPECT_EQ(0, TestObject::instances_);
+}
+
+} // end of anonymous namespace
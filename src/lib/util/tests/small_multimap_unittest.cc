@@ -0,0 +1,145 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <util/small_multimap.h>
+#include <boost/shared_ptr.hpp>
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+
+namespace {
+
+using namespace isc::util;
+
+/// @brief Container type used in the tests.
+typedef SmallMultimap<unsigned int, boost::shared_ptr<std::string>, 4> TestMap;
+
+/// @brief Convenience function creating a pointer to a string.
+boost::shared_ptr<std::string> str(const std::string& s) {
+    return (boost::shared_ptr<std::string>(new std::string(s)));
+}
+
+/// @brief Compares an element of the container with a multimap element.
+template<typename Pair>
+bool sameElement(const TestMap::value_type& elem, const Pair& other) {
+    return ((elem.first == other.first) && (elem.second == other.second));
+}
+
+// This test verifies that the elements are kept sorted by key and that
+// elements with the same key are kept in insertion order.
+TEST(SmallMultimapTest, insertOrder) {
+    TestMap map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_TRUE(map.isInline());
+
+    map.insert(std::make_pair(5, str("a")));
+    map.insert(std::make_pair(1, str("b")));
+    map.insert(std::make_pair(5, str("c")));
+    map.insert(std::make_pair(3, str("d")));
+    ASSERT_EQ(4, map.size());
+    EXPECT_TRUE(map.isInline());
+
+    TestMap::const_iterator it = map.begin();
+    EXPECT_EQ(1, it->first);
+    EXPECT_EQ("b", *(it++)->second);
+    EXPECT_EQ(3, it->first);
+    EXPECT_EQ("d", *(it++)->second);
+    EXPECT_EQ(5, it->first);
+    EXPECT_EQ("a", *(it++)->second);
+    EXPECT_EQ(5, it->first);
+    EXPECT_EQ("c", *(it++)->second);
+    EXPECT_TRUE(it == map.end());
+}
+
+// This test verifies that the container spills to the heap when the
+// embedded storage is exhausted and that it behaves like a multimap.
+TEST(SmallMultimapTest, spillToHeap) {
+    TestMap map;
+    typedef std::multimap<unsigned int, boost::shared_ptr<std::string> >
+        Reference;
+    Reference reference;
+    for (unsigned int i = 0; i < 100; ++i) {
+        unsigned int key = (i * 37) % 11;
+        boost::shared_ptr<std::string> value = str(std::to_string(i));
+        map.insert(std::make_pair(key, value));
+        reference.insert(std::make_pair(key, value));
+    }
+    EXPECT_FALSE(map.isInline());
+    ASSERT_EQ(reference.size(), map.size());
+    EXPECT_TRUE(std::equal(map.begin(), map.end(), reference.begin(),
+                           sameElement<Reference::value_type>));
+
+    for (unsigned int key = 0; key < 12; ++key) {
+        EXPECT_EQ(reference.count(key), map.count(key));
+        auto range = map.equal_range(key);
+        auto ref_range = reference.equal_range(key);
+        EXPECT_TRUE(std::equal(range.first, range.second, ref_range.first,
+                               sameElement<Reference::value_type>));
+    }
+}
+
+// This test verifies find and erase operations.
+TEST(SmallMultimapTest, findErase) {
+    TestMap map;
+    for (unsigned int i = 0; i < 10; ++i) {
+        map.insert(std::make_pair(i % 5, str(std::to_string(i))));
+    }
+
+    TestMap::iterator it = map.find(3);
+    ASSERT_TRUE(it != map.end());
+    EXPECT_EQ("3", *it->second);
+    EXPECT_TRUE(map.find(7) == map.end());
+
+    map.erase(it);
+    EXPECT_EQ(9, map.size());
+    it = map.find(3);
+    ASSERT_TRUE(it != map.end());
+    EXPECT_EQ("8", *it->second);
+
+    EXPECT_EQ(2, map.erase(1));
+    EXPECT_EQ(7, map.size());
+    EXPECT_TRUE(map.find(1) == map.end());
+    EXPECT_EQ(0, map.erase(1));
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+}
+
+// This test verifies copying, moving and swapping the containers.
+TEST(SmallMultimapTest, copyMoveSwap) {
+    TestMap small;
+    small.insert(std::make_pair(1, str("one")));
+
+    TestMap large;
+    for (unsigned int i = 0; i < 10; ++i) {
+        large.insert(std::make_pair(i, str(std::to_string(i))));
+    }
+
+    TestMap small_copy(small);
+    EXPECT_TRUE(small_copy == small);
+    TestMap large_copy(large);
+    EXPECT_TRUE(large_copy == large);
+    EXPECT_TRUE(large_copy != small_copy);
+
+    TestMap moved(std::move(large_copy));
+    EXPECT_TRUE(moved == large);
+    EXPECT_TRUE(large_copy.empty());
+
+    moved.swap(small_copy);
+    EXPECT_TRUE(moved == small);
+    EXPECT_TRUE(small_copy == large);
+
+    moved = large;
+    EXPECT_TRUE(moved == large);
+
+    // Range constructor.
+    TestMap range(large.find(5), large.end());
+    EXPECT_EQ(5, range.size());
+    EXPECT_EQ(5, range.begin()->first);
+}
+
+} // end of anonymous namespace